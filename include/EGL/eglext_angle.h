@@ -76,6 +76,13 @@
 #define EGL_PLATFORM_ANGLE_D3D_LUID_LOW_ANGLE 0x34A1
 #endif /* EGL_ANGLE_platform_angle_d3d_luid */
 
+#ifndef EGL_ANGLE_platform_angle_device_id
+#define EGL_ANGLE_platform_angle_device_id 1
+#define EGL_PLATFORM_ANGLE_DEVICE_ID_HIGH_ANGLE 0x34AA
+#define EGL_PLATFORM_ANGLE_DEVICE_ID_LOW_ANGLE 0x34AB
+#define EGL_PLATFORM_ANGLE_DEVICE_INDEX_ANGLE 0x34AC
+#endif /* EGL_ANGLE_platform_angle_device_id */
+
 #ifndef EGL_ANGLE_platform_angle_d3d11on12
 #define EGL_ANGLE_platform_angle_d3d11on12 1
 #define EGL_PLATFORM_ANGLE_D3D11ON12_ANGLE 0x3488
@@ -355,6 +362,12 @@ EGLAPI EGLBoolean EGLAPIENTRY eglSwapBuffersWithFrameTokenANGLE(EGLDisplay dpy,
 #define EGL_EXTERNAL_CONTEXT_SAVE_STATE_ANGLE 0x3490
 #endif /* EGL_ANGLE_external_context_and_surface */
 
+#ifndef EGL_ANGLE_histogram_query
+#define EGL_ANGLE_histogram_query 1
+#define EGL_HISTOGRAMS_ANGLE 0x34A8
+#define EGL_HISTOGRAMS_AND_RESET_ANGLE 0x34A9
+#endif /* EGL_ANGLE_histogram_query */
+
 // clang-format on
 
 #endif  // INCLUDE_EGL_EGLEXT_ANGLE_
@@ -62,6 +62,8 @@ GL_APICALL void GL_APIENTRY glCoverageModulationCHROMIUM(GLenum components);
 #ifndef GL_ANGLE_memory_size
 #define GL_ANGLE_memory_size
 #define GL_MEMORY_SIZE_ANGLE 0x93AD
+#define GL_MEMORY_BUDGET_ANGLE 0x969B
+#define GL_MEMORY_USAGE_ANGLE 0x969C
 #endif /* GL_ANGLE_memory_size */
 
 // needed by NV_path_rendering (and thus CHROMIUM_path_rendering)
@@ -573,8 +575,18 @@ GL_APICALL void GL_APIENTRY glImportSemaphoreZirconHandleANGLE(GLuint memory,
 #ifndef GL_ANGLE_get_serialized_context_string
 #define GL_ANGLE_get_serialized_context_string
 #define GL_SERIALIZED_CONTEXT_STRING_ANGLE 0x96B0
+#define GL_SERIALIZED_CONTEXT_HASHES_STRING_ANGLE 0x96B1
 #endif /* GL_ANGLE_get_serialized_context_string */
 
+#ifndef GL_ANGLE_prewarm_draw_state
+#define GL_ANGLE_prewarm_draw_state 1
+#define GL_PREWARM_COMPLETION_STATUS_ANGLE 0x969D
+typedef void(GL_APIENTRYP PFNGLPREWARMDRAWSTATEANGLEPROC)(GLenum mode);
+#ifdef GL_GLEXT_PROTOTYPES
+GL_APICALL void GL_APIENTRY glPrewarmDrawStateANGLE(GLenum mode);
+#endif
+#endif /* GL_ANGLE_prewarm_draw_state */
+
 // clang-format on
 
 #endif  // INCLUDE_GLES2_GL2EXT_ANGLE_H_
@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 257
+#define ANGLE_SH_VERSION 260
 
 enum ShShaderSpec
 {
@@ -337,6 +337,18 @@ const ShCompileOptions SH_ADD_VULKAN_XFB_EXTENSION_SUPPORT_CODE = UINT64_C(1) <<
 // gl_FragColor is not written.
 const ShCompileOptions SH_INIT_FRAGMENT_OUTPUT_VARIABLES = UINT64_C(1) << 57;
 
+// Writes the time spent in each pass of the translator to the info log, to see where compile time
+// goes.
+const ShCompileOptions SH_LOG_PASS_TIMINGS = UINT64_C(1) << 58;
+
+// Propagates constants through local variables, and removes dead branches and dead stores to local
+// variables before output, for drivers that don't optimize the generated shaders much.
+const ShCompileOptions SH_OPTIMIZE_AST = UINT64_C(1) << 59;
+
+// Declares the Vulkan driver uniforms block as a push constant block instead of a uniform buffer,
+// so they can be updated with vkCmdPushConstants.
+const ShCompileOptions SH_USE_PUSH_CONSTANTS_FOR_DRIVER_UNIFORMS = UINT64_C(1) << 60;
+
 // Defines alternate strategies for implementing array index clamping.
 enum ShArrayIndexClampingStrategy
 {
@@ -663,6 +675,8 @@ void Destruct(ShHandle handle);
 //                 Can be queried by calling sh::GetObjectCode().
 // SH_VARIABLES: Extracts attributes, uniforms, and varyings.
 //               Can be queried by calling ShGetVariableInfo().
+// SH_LOG_PASS_TIMINGS: Writes the time spent in each translator pass to info log.
+//                      Can be queried by calling sh::GetInfoLog().
 //
 bool Compile(const ShHandle handle,
              const char *const shaderStrings[],
@@ -214,6 +214,28 @@ struct FeaturesD3D : FeatureSetBase
         "There is a slow fxc compile performance issue with dynamic uniform indexing if "
         "translating a uniform block with a large array member to cbuffer.",
         &members, "http://anglebug.com/3682"};
+
+    // Compile the vertex shader variants for the most common unnormalized integer vertex formats
+    // in the background while linking, so that drawing with them first doesn't stall on fxc.
+    Feature preCompileVertexInputLayoutVariants = {
+        "pre_compile_vertex_input_layout_variants", FeatureCategory::D3DWorkarounds,
+        "Drawing with an input layout that needs a new vertex shader variant stalls on shader "
+        "compilation.",
+        &members};
+
+    // Convert UNSIGNED_BYTE indices and indices that need primitive restart translation, and
+    // generate the indices of line loops, with a compute shader when the index data is only up to
+    // date in GPU memory.
+    Feature convertIndexBuffersOnGPU = {
+        "convert_index_buffers_on_gpu", FeatureCategory::D3DWorkarounds,
+        "Translating indices that are only in GPU memory on the CPU reads them back.", &members};
+
+    // Release the resources that are cached to speed up later operations when the video memory
+    // usage of the process gets close to the budget given by the OS.
+    Feature releaseCachedResourcesNearMemoryBudget = {
+        "release_cached_resources_near_memory_budget", FeatureCategory::D3DWorkarounds,
+        "Going over the video memory budget makes the OS page the resources of the process out.",
+        &members};
 };
 
 inline FeaturesD3D::FeaturesD3D()  = default;
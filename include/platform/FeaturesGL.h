@@ -549,6 +549,14 @@ struct FeaturesGL : FeatureSetBase
                                         "Switching framebuffers without a flush can lead to "
                                         "crashes on Intel 9th Generation GPU Macs.",
                                         &members, "http://crbug.com/1181068"};
+
+    // Client-side vertex arrays and indices are written to a persistently mapped ring buffer
+    // instead of being uploaded with glBufferData/glBufferSubData, which can stall for every draw.
+    // Texture uploads from client memory are staged in one too, so that the driver doesn't copy
+    // them synchronously.
+    Feature usePersistentMappedStreamingBuffers = {
+        "use_persistent_mapped_streaming_buffers", FeatureCategory::OpenGLWorkarounds,
+        "Stream client-side data through a persistently mapped ring buffer", &members};
 };
 
 inline FeaturesGL::FeaturesGL()  = default;
@@ -83,6 +83,18 @@ struct FeaturesMtl : FeatureSetBase
 
     Feature forceD24S8AsUnsupported = {"force_d24s8_as_unsupported", FeatureCategory::MetalFeatures,
                                        "Force Depth24Stencil8 format as unsupported.", &members};
+
+    Feature useTextureArgumentBuffers = {
+        "use_texture_argument_buffers_mtl", FeatureCategory::MetalFeatures,
+        "Bind the textures and samplers of a shader with one argument buffer instead of a call "
+        "per texture and sampler. Requires tier 2 argument buffers.",
+        &members};
+
+    Feature allocateStreamingBuffersFromHeap = {
+        "allocate_streaming_buffers_from_heap_mtl", FeatureCategory::MetalFeatures,
+        "Suballocate small shared memory buffers of buffer pools from a few MTLHeaps instead of "
+        "creating a new MTLBuffer for each of them.",
+        &members};
 };
 
 }  // namespace angle
@@ -98,6 +98,13 @@ struct FeaturesVk : FeatureSetBase
         "Some drivers have an issue with creating single-layer views on cube map textures",
         &members};
 
+    // Whether mipmaps should always be generated on the CPU, even when compute or blit could be
+    // used.  This is used to measure the CPU path, which is otherwise only taken for formats that
+    // the device can't filter.
+    Feature forceCPUPathForGenerateMipmap = {
+        "forceCPUPathForGenerateMipmap", FeatureCategory::VulkanFeatures,
+        "Generate mipmaps on the CPU even when the GPU could be used", &members};
+
     // Whether the VkDevice supports the VK_ANDROID_external_memory_android_hardware_buffer
     // extension, on which the EGL_ANDROID_image_native_buffer extension can be layered.
     Feature supportsAndroidHardwareBuffer = {
@@ -459,6 +466,14 @@ struct FeaturesVk : FeatureSetBase
                                          "possible. Using this feature makes ANGLE non-conformant.",
                                          &members};
 
+    // Transcode ETC2 RGBA8 and EAC textures to BC3, BC4 and BC5 on devices without ETC2 support,
+    // instead of decompressing them.  ANGLE is non-conformant if this feature is enabled.
+    angle::Feature transcodeEtcToBc = {
+        "transcode_etc_to_bc", angle::FeatureCategory::VulkanWorkarounds,
+        "Transcode ETC2 and EAC textures to BC formats when ETC2 is not supported, keeping them "
+        "compressed in memory. Using this feature makes ANGLE non-conformant.",
+        &members};
+
     // Qualcomm missynchronizes vkCmdClearAttachments in the middle of render pass.
     // https://issuetracker.google.com/166809097
     Feature preferDrawClearOverVkCmdClearAttachments = {
@@ -521,6 +536,170 @@ struct FeaturesVk : FeatureSetBase
         "preferSubmitAtFBOBoundary", FeatureCategory::VulkanWorkarounds,
         "Submit commands to driver at each FBO boundary for performance improvements.", &members,
         "https://issuetracker.google.com/187425444"};
+
+    // Whether graphics pipelines should be created on a worker thread.  The draw call that needs a
+    // new pipeline only waits for it when the pipeline is bound, so pipeline creation overlaps
+    // with the rest of the draw call's state processing.
+    Feature asyncGraphicsPipelineCreation = {
+        "asyncGraphicsPipelineCreation", FeatureCategory::VulkanFeatures,
+        "Create graphics pipelines on a worker thread.", &members};
+
+    // Whether the contents of command buffer helpers should be recorded into Vulkan secondary
+    // command buffers on worker threads, then executed in the primary command buffer in
+    // submission order.  Only used with the synchronous command queue (asyncCommandQueue off).
+    Feature parallelCommandBufferRecording = {
+        "parallelCommandBufferRecording", FeatureCategory::VulkanFeatures,
+        "Record command buffers into secondary command buffers on worker threads.", &members};
+
+    // Whether the graphics pipeline descs used by a program should be recorded in its program
+    // binary, so that the pipelines are created on worker threads as soon as the program is
+    // loaded from the program cache, instead of at the first draw call that uses them.
+    Feature preCreateRecordedGraphicsPipelines = {
+        "preCreateRecordedGraphicsPipelines", FeatureCategory::VulkanFeatures,
+        "Record the graphics pipelines used by a program in its binary and create them on worker "
+        "threads when the binary is loaded.",
+        &members};
+
+    // Whether buffers retired by dynamic buffers should be returned to a pool shared by the
+    // renderer, so that other dynamic buffers of the same kind reuse them instead of allocating
+    // new VkBuffers and memory.
+    Feature shareDynamicBufferAllocations = {
+        "shareDynamicBufferAllocations", FeatureCategory::VulkanFeatures,
+        "Reuse buffers retired by dynamic buffers across all dynamic buffers of the renderer.",
+        &members};
+
+    // Whether compressed texture data that has to be decoded on the CPU, because the device
+    // doesn't support the format, should be decoded on worker threads in parallel.
+    Feature parallelCompressedTextureDecode = {
+        "parallelCompressedTextureDecode", FeatureCategory::VulkanFeatures,
+        "Decode compressed textures unsupported by the device on multiple worker threads.",
+        &members};
+
+    // Whether large texture uploads that only lack the alpha channel of the image format, such as
+    // RGB8 uploads to RGBA8 images, should be staged as-is and expanded by a compute shader
+    // instead of being converted on the CPU.
+    Feature expandTextureChannelsOnGpu = {
+        "expandTextureChannelsOnGpu", FeatureCategory::VulkanFeatures,
+        "Add the missing alpha channel of large RGB texture uploads with a compute shader.",
+        &members};
+
+    // Whether large texture uploads to images that haven't been used yet should be done on a
+    // transfer-only queue, if the device has one.  The graphics queue then only waits for the
+    // upload when the texture is first used.
+    Feature transferQueueUploads = {
+        "transferQueueUploads", FeatureCategory::VulkanFeatures,
+        "Upload large textures on a dedicated transfer queue when available.", &members};
+
+    // Whether a render pass left open when the draw framebuffer binding changed should be resumed
+    // if the same framebuffer is bound again before another render pass starts, for example with
+    // FBO A -> B -> A where B is only cleared.  Clears deferred in the meantime become loadOps of
+    // the resumed render pass if it has no commands yet.
+    Feature resumeRenderPassOnFramebufferRebind = {
+        "resumeRenderPassOnFramebufferRebind", FeatureCategory::VulkanFeatures,
+        "Continue the open render pass when its framebuffer is bound again.", &members};
+
+    // Whether the next swapchain image should be acquired right after present instead of when the
+    // default framebuffer is next used.  vkAcquireNextImageKHR then blocks eglSwapBuffers rather
+    // than a random draw call of the next frame, which keeps the frame latency stable.
+    Feature acquireSwapchainImageAfterPresent = {
+        "acquireSwapchainImageAfterPresent", FeatureCategory::VulkanFeatures,
+        "Acquire the next swapchain image during eglSwapBuffers.", &members};
+
+    // Whether the VkDevice supports the VK_EXT_extended_dynamic_state extension.  When enabled,
+    // cull mode, front face, depth and stencil test state are set on the command buffer instead of
+    // being part of the pipeline, which reduces the number of pipelines that need to be created.
+    Feature supportsExtendedDynamicState = {
+        "supportsExtendedDynamicState", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_EXT_extended_dynamic_state extension.", &members};
+
+    // Whether the VkDevice supports the VK_KHR_descriptor_update_template extension.  When
+    // enabled, texture descriptor sets are written with one template update per program instead
+    // of a VkWriteDescriptorSet per sampler array element.
+    Feature supportsDescriptorUpdateTemplate = {
+        "supportsDescriptorUpdateTemplate", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_descriptor_update_template extension.", &members};
+
+    // Whether the VkDevice supports the VK_KHR_timeline_semaphore extension.  When enabled, each
+    // submission signals a timeline semaphore with its queue serial, which replaces the fence that
+    // is otherwise allocated per submission for tracking GPU completion.
+    Feature supportsTimelineSemaphore = {
+        "supportsTimelineSemaphore", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_timeline_semaphore extension.", &members};
+
+    // Whether the VkDevice supports the VK_KHR_synchronization2 extension.  When enabled, the
+    // barriers recorded before a command buffer's commands keep their own stage masks and are
+    // issued with a single vkCmdPipelineBarrier2KHR, instead of being merged into the union of
+    // their stages.
+    Feature supportsSynchronization2 = {
+        "supportsSynchronization2", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_synchronization2 extension.", &members};
+
+    // Whether the VkDevice supports the VK_KHR_push_descriptor extension.  When enabled, the driver
+    // uniforms are pushed into the command buffer instead of being bound through descriptor sets
+    // allocated from a pool.
+    Feature supportsPushDescriptor = {
+        "supportsPushDescriptor", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_push_descriptor extension.", &members};
+
+    // Whether the driver uniforms should be push constants instead of a uniform buffer.  When
+    // enabled, they are updated with a single vkCmdPushConstants instead of being written to a
+    // newly allocated region of a buffer whose descriptor set is then bound.
+    Feature usePushConstantsForDriverUniforms = {
+        "usePushConstantsForDriverUniforms", FeatureCategory::VulkanFeatures,
+        "Push the driver uniforms as push constants instead of binding them as a uniform buffer.",
+        &members};
+
+    // On tiling GPUs, the depth/stencil buffer of window surfaces is often cleared at the start of
+    // the frame and discarded at its end, in which case it never needs backing memory.  Once that
+    // has been the case for a number of frames, the buffer is recreated as a transient attachment
+    // in lazily allocated memory.
+    Feature lazilyAllocateDiscardedDepthStencil = {
+        "lazilyAllocateDiscardedDepthStencil", FeatureCategory::VulkanFeatures,
+        "Allocate the depth/stencil buffer of window surfaces from lazily allocated memory once "
+        "the application keeps discarding its contents.",
+        &members};
+
+    // Applications that draw from client memory often draw the same unchanged data several times
+    // per frame.  Hashing it is cheaper than converting and writing it to the streaming buffer
+    // again.
+    Feature reuseStreamedClientVertexData = {
+        "reuseStreamedClientVertexData", FeatureCategory::VulkanFeatures,
+        "Reuse the client vertex data streamed by a previous draw if it is unchanged.", &members};
+
+    // Creating and destroying many small offscreen surfaces pays for an allocation and memory
+    // binding each time.  The images of destroyed pbuffers are kept around for new pbuffers of the
+    // same size, format and sample count.
+    Feature poolOffscreenSurfaceImages = {
+        "poolOffscreenSurfaceImages", FeatureCategory::VulkanFeatures,
+        "Reuse the images of destroyed pbuffer surfaces for new ones.", &members};
+
+    // Whether the VkDevice supports the multiDrawIndirect and drawIndirectFirstInstance features.
+    // When enabled, the draws of a multi-draw call are written to an indirect buffer and issued
+    // with a single indirect draw if none of them needs to be set up on its own.
+    Feature supportsMultiDrawIndirect = {
+        "supportsMultiDrawIndirect", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the multiDrawIndirect and drawIndirectFirstInstance features.",
+        &members};
+
+    // Whether the VkDevice supports the sparseBinding and sparseResidencyImage2D features on its
+    // graphics queues.  When enabled, EXT_sparse_texture is exposed and the pages of sparse
+    // textures are bound to memory only when they are committed.
+    Feature supportsSparseTexture = {
+        "supportsSparseTexture", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the sparseBinding and sparseResidencyImage2D features.", &members};
+
+    // Whether garbage objects that the GPU is done with should be destroyed by a background
+    // thread of the renderer, instead of by the thread that found their commands completed.
+    Feature asyncGarbageCleanup = {
+        "asyncGarbageCleanup", FeatureCategory::VulkanFeatures,
+        "Destroy completed garbage on a background thread.", &members};
+
+    // Whether the VkDevice supports the VK_EXT_memory_budget extension.  When enabled, the
+    // allocator tracks the budget the driver reports for each heap, and contexts trim the memory
+    // they keep around for reuse when the device-local heaps are close to their budget.
+    Feature supportsMemoryBudget = {
+        "supportsMemoryBudget", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_EXT_memory_budget extension", &members};
 };
 
 inline FeaturesVk::FeaturesVk()  = default;
@@ -76,6 +76,31 @@ struct FrontendFeatures : angle::FeatureSetBase
     angle::Feature enableCompressingPipelineCacheInThreadPool = {
         "enableCompressingPipelineCacheInThreadPool", angle::FeatureCategory::FrontendWorkarounds,
         "Enable compressing pipeline cache in thread pool.", &members, "http://anglebug.com/4722"};
+
+    // Record draw calls in a per-context list, and validate and execute them in bulk the next time
+    // another call reaches the context. Draws reading client memory and shared contexts are not
+    // affected. Errors are reported at the call that flushes the draws.
+    angle::Feature recordDeferredCommands = {
+        "record_deferred_commands", angle::FeatureCategory::FrontendFeatures,
+        "Record draw calls and execute them at the next non-draw call", &members};
+
+    // Store the translator output of compiled shaders in the blob cache, keyed by the source and
+    // the compile options, so compiling the same shader again skips the translator entirely.
+    angle::Feature cacheTranslatedShaders = {
+        "cache_translated_shaders", angle::FeatureCategory::FrontendFeatures,
+        "Cache the translated source and reflection data of compiled shaders", &members};
+
+    // Sync the state of draw calls to the back end, then drop them before the back end records
+    // them.  Used to measure the CPU cost of an application without the GPU work it generates.
+    angle::Feature discardDrawCalls = {
+        "discard_draw_calls", angle::FeatureCategory::FrontendFeatures,
+        "Discard draw calls after syncing their state", &members};
+
+    // Compress the data stored in the blob cache with raw deflate at the fastest level instead of
+    // gzip, trading some cache space for faster stores and cache hits.
+    angle::Feature fastBlobCacheCompression = {
+        "fast_blob_cache_compression", angle::FeatureCategory::FrontendFeatures,
+        "Compress blob cache data with a faster codec", &members};
 };
 
 inline FrontendFeatures::FrontendFeatures()  = default;
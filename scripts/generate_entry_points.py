@@ -31,6 +31,14 @@ NO_EVENT_MARKER_EXCEPTIONS_LIST = sorted([
     "glInsertEventMarkerEXT",
 ])
 
+# Entry points that Context can record instead of executing, see libANGLE/DeferredCommands.h.
+DEFERRABLE_COMMANDS_LIST = sorted([
+    "glDrawArrays",
+    "glDrawArraysInstanced",
+    "glDrawElements",
+    "glDrawElementsInstanced",
+])
+
 # glRenderbufferStorageMultisampleEXT aliases glRenderbufferStorageMultisample on desktop GL, and is
 # marked as such in the registry.  However, that is not correct for GLES where this entry point
 # comes from GL_EXT_multisampled_render_to_texture which is never promoted to core GLES.
@@ -104,6 +112,8 @@ TEMPLATE_ENTRY_POINTS_ENUM_HEADER = """\
 #ifndef COMMON_ENTRYPOINTSENUM_AUTOGEN_H_
 #define COMMON_ENTRYPOINTSENUM_AUTOGEN_H_
 
+#include <cstddef>
+
 namespace angle
 {{
 enum class EntryPoint
@@ -111,6 +121,9 @@ enum class EntryPoint
 {entry_points_list}
 }};
 
+// The number of entry points, for tables indexed by EntryPoint.
+constexpr size_t kEntryPointCount = {entry_point_count};
+
 const char *GetEntryPointName(EntryPoint ep);
 }}  // namespace angle
 #endif  // COMMON_ENTRY_POINTS_ENUM_AUTOGEN_H_
@@ -178,6 +191,35 @@ void GL_APIENTRY GL_{name}{explicit_context_suffix}({explicit_context_param}{exp
     {{{assert_explicit_context}{packed_gl_enum_conversions}
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || Validate{name}({validate_params}));
+        ANGLE_PROFILE_VALIDATION_END();
+        if (isCallValid)
+        {{
+            context->{name_lower_no_suffix}({internal_params});
+        }}
+        ANGLE_CAPTURE({name}, isCallValid, {validate_params});
+    }}
+    else
+    {{
+        {constext_lost_error_generator}
+    }}
+}}
+"""
+
+TEMPLATE_GLES_DEFERRABLE_ENTRY_POINT = """\
+void GL_APIENTRY GL_{name}{explicit_context_suffix}({explicit_context_param}{explicit_context_comma}{params})
+{{
+    Context *context = {context_getter};
+    {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
+
+    if ({valid_context_check})
+    {{{assert_explicit_context}{packed_gl_enum_conversions}
+        if (context->isRecordingDeferredCommands() && context->record{name}({internal_params}))
+        {{
+            return;
+        }}
+        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        bool isCallValid = (context->skipValidation() || Validate{name}({validate_params}));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {{
             context->{name_lower_no_suffix}({internal_params});
@@ -202,6 +244,7 @@ TEMPLATE_GLES_ENTRY_POINT_WITH_RETURN = """\
     {{{assert_explicit_context}{packed_gl_enum_conversions}
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || Validate{name}({validate_params}));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {{
             returnValue = context->{name_lower_no_suffix}({internal_params});
@@ -224,7 +267,7 @@ TEMPLATE_GLES_ENTRY_POINT_WITH_RETURN = """\
 TEMPLATE_EGL_ENTRY_POINT_NO_RETURN = """\
 void EGLAPIENTRY EGL_{name}({params})
 {{
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT({name}, "{format_params}"{comma_if_needed}{pass_params});
 
     Thread *thread = egl::GetCurrentThread();
@@ -240,7 +283,7 @@ void EGLAPIENTRY EGL_{name}({params})
 TEMPLATE_EGL_ENTRY_POINT_WITH_RETURN = """\
 {return_type} EGLAPIENTRY EGL_{name}({params})
 {{
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT({name}, "{format_params}"{comma_if_needed}{pass_params});
 
     Thread *thread = egl::GetCurrentThread();
@@ -1565,7 +1608,10 @@ def format_entry_point_def(api, command_node, cmd_name, proto, params, is_explic
             get_egl_entry_point_labeled_object(ep_to_object, cmd_name, params, packed_enums)
     }
 
-    template = get_def_template(api, return_type)
+    if cmd_name in DEFERRABLE_COMMANDS_LIST and not is_explicit_context:
+        template = TEMPLATE_GLES_DEFERRABLE_ENTRY_POINT
+    else:
+        template = get_def_template(api, return_type)
     return template.format(**format_params)
 
 
@@ -3094,7 +3140,8 @@ def main():
         script_name=os.path.basename(sys.argv[0]),
         data_source_name="gl.xml and gl_angle_ext.xml",
         lib="GL/GLES",
-        entry_points_list=",\n".join(["    " + enum for (enum, _) in all_enums]))
+        entry_points_list=",\n".join(["    " + enum for (enum, _) in all_enums]),
+        entry_point_count=len(all_enums))
 
     entry_points_enum_header_path = path_to("common", "entry_points_enum_autogen.h")
     with open(entry_points_enum_header_path, "w") as out:
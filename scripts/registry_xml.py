@@ -38,6 +38,7 @@ angle_extensions = [
     "GL_ANGLE_get_image",
     "GL_ANGLE_get_serialized_context_string",
     "GL_ANGLE_get_tex_level_parameter",
+    "GL_ANGLE_prewarm_draw_state",
     "GL_ANGLE_program_binary",
     "GL_ANGLE_request_extension",
     "GL_ANGLE_robust_client_memory",
@@ -97,6 +98,7 @@ gles_extensions = [
     "GL_EXT_separate_shader_objects",
     "GL_EXT_shader_framebuffer_fetch_non_coherent",
     "GL_EXT_shader_io_blocks",
+    "GL_EXT_sparse_texture",
     "GL_EXT_sRGB",
     "GL_EXT_tessellation_shader",
     "GL_EXT_texture_border_clamp",
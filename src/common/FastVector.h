@@ -12,6 +12,7 @@
 #define COMMON_FASTVECTOR_H_
 
 #include "bitset_utils.h"
+#include "common/angleutils.h"
 #include "common/debug.h"
 
 #include <algorithm>
@@ -438,6 +439,8 @@ void FastVector<T, N, Storage>::ensure_capacity(size_t capacity)
     }
 }
 
+// Up to N entries are kept in fixed storage and searched linearly.  Past that, all the entries
+// move to a hash map, so lookups don't degrade to a linear search of the whole map.
 template <class Key, class Value, size_t N>
 class FastUnorderedMap final
 {
@@ -450,11 +453,30 @@ class FastUnorderedMap final
     void insert(Key key, Value value)
     {
         ASSERT(!contains(key));
-        mData.push_back(Pair(key, value));
+        if (mHashData.empty())
+        {
+            if (mData.size() < N)
+            {
+                mData.push_back(Pair(key, value));
+                return;
+            }
+
+            for (const Pair &item : mData)
+            {
+                mHashData.emplace(item.first, item.second);
+            }
+            mData.clear();
+        }
+        mHashData.emplace(key, value);
     }
 
     bool contains(Key key) const
     {
+        if (!mHashData.empty())
+        {
+            return mHashData.count(key) > 0;
+        }
+
         for (size_t index = 0; index < mData.size(); ++index)
         {
             if (mData[index].first == key)
@@ -463,10 +485,25 @@ class FastUnorderedMap final
         return false;
     }
 
-    void clear() { mData.clear(); }
+    void clear()
+    {
+        mData.clear();
+        mHashData.clear();
+    }
 
     bool get(Key key, Value *value) const
     {
+        if (!mHashData.empty())
+        {
+            auto iter = mHashData.find(key);
+            if (iter == mHashData.end())
+            {
+                return false;
+            }
+            *value = iter->second;
+            return true;
+        }
+
         for (size_t index = 0; index < mData.size(); ++index)
         {
             const Pair &item = mData[index];
@@ -479,11 +516,13 @@ class FastUnorderedMap final
         return false;
     }
 
-    bool empty() const { return mData.empty(); }
-    size_t size() const { return mData.size(); }
+    bool empty() const { return mData.empty() && mHashData.empty(); }
+    size_t size() const { return mData.size() + mHashData.size(); }
 
   private:
+    // Only one of these holds entries at a time.
     FastVector<Pair, N> mData;
+    HashMap<Key, Value> mHashData;
 };
 
 template <class T, size_t N>
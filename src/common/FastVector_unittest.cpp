@@ -271,6 +271,41 @@ TEST(FastUnorderedMap, BasicUsage)
     }
 }
 
+// Tests that the values are kept when FastUnorderedMap grows past its fixed storage, and that it
+// can be reused after being cleared.
+TEST(FastUnorderedMap, GrowPastFixedStorage)
+{
+    FastUnorderedMap<int, int, 3> testMap;
+
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            testMap.insert(i, i * 10);
+            EXPECT_EQ(testMap.size(), static_cast<size_t>(i + 1));
+        }
+
+        for (int i = 0; i < 20; ++i)
+        {
+            int value = -1;
+            EXPECT_TRUE(testMap.contains(i));
+            EXPECT_TRUE(testMap.get(i, &value));
+            EXPECT_EQ(value, i * 10);
+        }
+        EXPECT_FALSE(testMap.contains(20));
+
+        testMap.clear();
+        EXPECT_TRUE(testMap.empty());
+
+        testMap.insert(7, 70);
+        int value = -1;
+        EXPECT_TRUE(testMap.get(7, &value));
+        EXPECT_EQ(value, 70);
+        EXPECT_FALSE(testMap.contains(0));
+        testMap.clear();
+    }
+}
+
 // Basic functionality for FastUnorderedSet
 TEST(FastUnorderedSet, BasicUsage)
 {
@@ -21,6 +21,36 @@
 
 namespace angle
 {
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+namespace
+{
+// Bounds the memory a thread keeps around for allocators that use the thread page cache.
+constexpr size_t kMaxThreadCachedPages = 128;
+}  // anonymous namespace
+
+struct PoolAllocator::ThreadPageCache
+{
+    ~ThreadPageCache()
+    {
+        while (pages)
+        {
+            Header *next = pages->nextPage;
+            delete[] reinterpret_cast<char *>(pages);
+            pages = next;
+        }
+    }
+
+    Header *pages    = nullptr;
+    size_t pageCount = 0;
+};
+
+// static
+PoolAllocator::ThreadPageCache &PoolAllocator::GetThreadPageCache()
+{
+    thread_local ThreadPageCache cache;
+    return cache;
+}
+#endif
 
 //
 // Implement the functionality of the PoolAllocator class, which
@@ -34,6 +64,7 @@ PoolAllocator::PoolAllocator(int growthIncrement, int allocationAlignment)
       mInUseList(0),
       mNumCalls(0),
       mTotalBytes(0),
+      mUseThreadPageCache(false),
 #endif
       mLocked(false)
 {
@@ -86,11 +117,29 @@ void PoolAllocator::initialize(int pageSize, int alignment)
     // be obtained to allocate memory.
     //
     mCurrentPageOffset = mPageSize;
+
+    //
+    // Pages are aligned like any operator new allocation, and allocations are
+    // laid out at aligned offsets in them.  Unless guard blocks get in the way or
+    // a larger alignment is requested, allocations need no padding to be aligned.
+    //
+#    if defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
+    mAlignmentPadding = mAlignment;
+#    else
+    mAlignmentPadding = mAlignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ? mAlignment : 0;
+#    endif
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
     mStack.push_back({});
 #endif
 }
 
+void PoolAllocator::enableThreadPageCache()
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    mUseThreadPageCache = true;
+#endif
+}
+
 PoolAllocator::~PoolAllocator()
 {
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
@@ -185,6 +234,20 @@ void PoolAllocator::pop()
         Header *nextInUse = mInUseList->nextPage;
         if (mInUseList->pageCount > 1)
             delete[] reinterpret_cast<char *>(mInUseList);
+        else if (usesThreadPageCache())
+        {
+            ThreadPageCache &cache = GetThreadPageCache();
+            if (cache.pageCount < kMaxThreadCachedPages)
+            {
+                mInUseList->nextPage = cache.pages;
+                cache.pages          = mInUseList;
+                ++cache.pageCount;
+            }
+            else
+            {
+                delete[] reinterpret_cast<char *>(mInUseList);
+            }
+        }
         else
         {
             mInUseList->nextPage = mFreeList;
@@ -229,7 +292,7 @@ void *PoolAllocator::allocate(size_t numBytes)
     // much memory the caller asked for.  allocationSize is the total
     // size including guard blocks.  In release build,
     // kGuardBlockSize=0 and this all gets optimized away.
-    size_t allocationSize = Allocation::AllocationSize(numBytes) + mAlignment;
+    size_t allocationSize = Allocation::AllocationSize(numBytes) + mAlignmentPadding;
     // Detect integer overflow.
     if (allocationSize < numBytes)
         return 0;
@@ -290,6 +353,11 @@ void *PoolAllocator::allocate(size_t numBytes)
 }
 
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
+bool PoolAllocator::usesThreadPageCache() const
+{
+    return mUseThreadPageCache && mPageSize == static_cast<size_t>(kDefaultPageSize);
+}
+
 void *PoolAllocator::allocateNewPage(size_t numBytes, size_t allocationSize)
 {
     //
@@ -301,6 +369,13 @@ void *PoolAllocator::allocateNewPage(size_t numBytes, size_t allocationSize)
         memory    = mFreeList;
         mFreeList = mFreeList->nextPage;
     }
+    else if (usesThreadPageCache() && GetThreadPageCache().pages)
+    {
+        ThreadPageCache &cache = GetThreadPageCache();
+        memory                 = cache.pages;
+        cache.pages            = cache.pages->nextPage;
+        --cache.pageCount;
+    }
     else
     {
         memory = reinterpret_cast<Header *>(::new char[mPageSize]);
@@ -124,11 +124,13 @@ class PoolAllocator : angle::NonCopyable
 {
   public:
     static const int kDefaultAlignment = 16;
+    static const int kDefaultPageSize  = 8 * 1024;
     //
     // Create PoolAllocator. If alignment is set to 1 byte then fastAllocate()
     //  function can be used to make allocations with less overhead.
     //
-    PoolAllocator(int growthIncrement = 8 * 1024, int allocationAlignment = kDefaultAlignment);
+    PoolAllocator(int growthIncrement = kDefaultPageSize,
+                  int allocationAlignment = kDefaultAlignment);
 
     //
     // Don't call the destructor just to free up the memory, call pop()
@@ -140,6 +142,15 @@ class PoolAllocator : angle::NonCopyable
     //
     void initialize(int pageSize, int alignment);
 
+    //
+    // Call enableThreadPageCache() to have pop() release pages to a cache shared by
+    // all such allocators of the calling thread, instead of keeping them in this
+    // allocator.  Allocators that are used one after the other, such as the
+    // translator's, then reuse each other's pages.  The cache is bounded, and only
+    // holds pages of the default size.
+    //
+    void enableThreadPageCache();
+
     //
     // Call push() to establish a new place to pop memory to.  Does not
     // have to be called to get things started.
@@ -242,6 +253,10 @@ class PoolAllocator : angle::NonCopyable
     };
     using AllocStack = std::vector<AllocState>;
 
+    struct ThreadPageCache;
+    static ThreadPageCache &GetThreadPageCache();
+    bool usesThreadPageCache() const;
+
     // Slow path of allocation when we have to get a new page.
     void *allocateNewPage(size_t numBytes, size_t allocationSize);
     // Track allocations if and only if we're using guard blocks
@@ -262,6 +277,7 @@ class PoolAllocator : angle::NonCopyable
                                 //      header (basically, size of header, rounded
                                 //      up to make it aligned
     size_t mCurrentPageOffset;  // next offset in top of inUseList to allocate from
+    size_t mAlignmentPadding;   // extra bytes given to each allocation to align it
     Header *mFreeList;          // list of popped memory
     Header *mInUseList;         // list of all memory currently being used
     AllocStack mStack;          // stack of where to allocate from, to partition pool
@@ -269,6 +285,8 @@ class PoolAllocator : angle::NonCopyable
     int mNumCalls;       // just an interesting statistic
     size_t mTotalBytes;  // just an interesting statistic
 
+    bool mUseThreadPageCache;
+
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
     std::vector<std::vector<void *>> mStack;
 #endif
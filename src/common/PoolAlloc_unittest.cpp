@@ -50,6 +50,28 @@ TEST(PoolAllocatorTest, Interface)
     poolAllocator.popAll();
 }
 
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+// Verify that allocators using the thread page cache reuse the pages popped by each other
+TEST(PoolAllocatorTest, ThreadPageCache)
+{
+    void *firstAllocation = nullptr;
+    {
+        PoolAllocator poolAllocator;
+        poolAllocator.enableThreadPageCache();
+        poolAllocator.push();
+        firstAllocation = poolAllocator.allocate(64);
+        EXPECT_NE(nullptr, firstAllocation);
+        poolAllocator.pop();
+    }
+
+    PoolAllocator poolAllocator;
+    poolAllocator.enableThreadPageCache();
+    poolAllocator.push();
+    EXPECT_EQ(firstAllocation, poolAllocator.allocate(64));
+    poolAllocator.pop();
+}
+#endif
+
 #if !defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
 // Verify allocations are correctly aligned for different alignments
 class PoolAllocatorAlignmentTest : public testing::TestWithParam<int>
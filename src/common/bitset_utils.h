@@ -730,7 +730,14 @@ typename BitSetArray<N>::Iterator &BitSetArray<N>::Iterator::operator++()
     ++mCurrentIterator;
     if (mCurrentIterator == mCurrentParent->mBaseBitSetArray[mIndex].end())
     {
-        mIndex++;
+        // Skip the empty elements.  An iterator over an empty element compares equal to end(), so
+        // stopping on one would end the iteration early.
+        do
+        {
+            mIndex++;
+        } while (mIndex < mCurrentParent->kArraySize &&
+                 mCurrentParent->mBaseBitSetArray[mIndex].none());
+
         if (mIndex < mCurrentParent->kArraySize)
         {
             mCurrentIterator = mCurrentParent->mBaseBitSetArray[mIndex].begin();
@@ -824,14 +831,13 @@ BitSetArray<N> BitSetArray<N>::operator^(const angle::BitSetArray<N> &other) con
 template <std::size_t N>
 bool BitSetArray<N>::operator==(const angle::BitSetArray<N> &other) const
 {
+    // The elements are combined without branches so that the loop can be vectorized.
+    value_type difference = 0;
     for (std::size_t index = 0; index < kArraySize; index++)
     {
-        if (mBaseBitSetArray[index] != other.mBaseBitSetArray[index])
-        {
-            return false;
-        }
+        difference |= mBaseBitSetArray[index].bits() ^ other.mBaseBitSetArray[index].bits();
     }
-    return true;
+    return difference == 0;
 }
 
 template <std::size_t N>
@@ -932,27 +938,18 @@ bool BitSetArray<N>::all() const
 template <std::size_t N>
 bool BitSetArray<N>::any() const
 {
+    value_type bits = 0;
     for (const BaseBitSet &baseBitSet : mBaseBitSetArray)
     {
-        if (baseBitSet.any())
-        {
-            return true;
-        }
+        bits |= baseBitSet.bits();
     }
-    return false;
+    return bits != 0;
 }
 
 template <std::size_t N>
 bool BitSetArray<N>::none() const
 {
-    for (const BaseBitSet &baseBitSet : mBaseBitSetArray)
-    {
-        if (!baseBitSet.none())
-        {
-            return false;
-        }
-    }
-    return true;
+    return !any();
 }
 
 template <std::size_t N>
@@ -969,14 +966,12 @@ std::size_t BitSetArray<N>::count() const
 template <std::size_t N>
 bool BitSetArray<N>::intersects(const BitSetArray<N> &other) const
 {
+    value_type bits = 0;
     for (std::size_t index = 0; index < kArraySize; index++)
     {
-        if ((mBaseBitSetArray[index].bits() & other.mBaseBitSetArray[index].bits()) != 0)
-        {
-            return true;
-        }
+        bits |= mBaseBitSetArray[index].bits() & other.mBaseBitSetArray[index].bits();
     }
-    return false;
+    return bits != 0;
 }
 
 template <std::size_t N>
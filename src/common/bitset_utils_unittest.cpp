@@ -575,4 +575,36 @@ TYPED_TEST(BitSetArrayTest, BasicTest)
         EXPECT_TRUE(testBitSet.test(bit));
     }
 }
+
+// Tests that iteration goes past the elements that have no bit set.
+TYPED_TEST(BitSetArrayTest, IterateOverEmptyElements)
+{
+    TypeParam &mBits = this->mBitSet;
+
+    std::set<std::size_t> expectedValues = {0, mBits.size() / 2, mBits.size() - 1};
+    for (std::size_t bit : expectedValues)
+    {
+        mBits.set(bit);
+    }
+
+    std::set<std::size_t> actualValues;
+    for (auto bit : mBits)
+    {
+        EXPECT_EQ(actualValues.count(bit), 0u);
+        actualValues.insert(bit);
+    }
+    EXPECT_EQ(expectedValues, actualValues);
+
+    // Only the last bit set.
+    mBits.reset();
+    mBits.set(mBits.size() - 1);
+    actualValues.clear();
+    for (auto bit : mBits)
+    {
+        actualValues.insert(bit);
+    }
+    EXPECT_EQ(std::set<std::size_t>({mBits.size() - 1}), actualValues);
+    EXPECT_TRUE(mBits.any());
+    EXPECT_FALSE(mBits.none());
+}
 }  // anonymous namespace
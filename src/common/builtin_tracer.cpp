@@ -0,0 +1,326 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// builtin_tracer.cpp: A trace event recorder for when the embedder doesn't collect ANGLE's trace
+// events, in builds with angle_enable_builtin_tracer.
+
+#include "common/builtin_tracer.h"
+
+#if defined(ANGLE_ENABLE_BUILTIN_TRACER)
+
+#    include <algorithm>
+#    include <array>
+#    include <atomic>
+#    include <chrono>
+#    include <cstring>
+#    include <fstream>
+#    include <iomanip>
+#    include <mutex>
+#    include <string>
+#    include <vector>
+
+#    include "anglebase/no_destructor.h"
+#    include "common/debug.h"
+#    include "common/platform.h"
+#    include "common/string_utils.h"
+#    include "common/system_utils.h"
+
+#    if defined(ANGLE_PLATFORM_POSIX)
+#        include <signal.h>
+#    endif
+
+#    if !defined(ANGLE_BUILTIN_TRACER_CATEGORIES)
+#        define ANGLE_BUILTIN_TRACER_CATEGORIES "*"
+#    endif
+
+namespace angle
+{
+namespace
+{
+constexpr size_t kMaxCategoryCount = 32;
+// 16k events of 24 bytes per thread.
+constexpr size_t kEventsPerThread = 16 * 1024;
+
+// TRACE_EVENT_FLAG_COPY: the name is a temporary string.
+constexpr unsigned char kTraceEventFlagCopy = 0x1;
+
+constexpr char kDefaultTraceFile[] = "angle_trace.json";
+
+// The slots are written by their thread while WriteBuiltinTrace may read them, so their fields
+// are atomics.  Relaxed accesses compile to plain loads and stores.
+struct TraceEventSlot
+{
+    std::atomic<uint64_t> timestampNanoseconds{0};
+    std::atomic<const char *> name{nullptr};
+    std::atomic<uint32_t> phaseAndCategory{0};
+};
+
+struct ThreadTraceEvents
+{
+    uint32_t threadId;
+    // The number of events this thread has recorded; the newest kEventsPerThread are in |slots|.
+    std::atomic<uint64_t> eventCount{0};
+    std::array<TraceEventSlot, kEventsPerThread> slots;
+};
+
+struct BuiltinTracer
+{
+    BuiltinTracer();
+
+    bool isCategoryRecorded(const char *categoryName) const;
+
+    std::vector<std::string> compiledCategories;
+    std::vector<std::string> runtimeCategories;
+
+    // Guards the category names and the list of threads.  Recording an event doesn't take it.
+    std::mutex mutex;
+    std::array<const char *, kMaxCategoryCount> categoryNames = {};
+    std::array<unsigned char, kMaxCategoryCount> categoryEnabledFlags = {};
+    size_t categoryCount = 0;
+
+    // Never freed, so that the events of the threads that have exited are still written.
+    std::vector<ThreadTraceEvents *> threads;
+};
+
+std::atomic<bool> gWriteRequested(false);
+
+#    if defined(ANGLE_PLATFORM_POSIX)
+void OnWriteTraceSignal(int signal)
+{
+    gWriteRequested.store(true, std::memory_order_relaxed);
+}
+#    endif
+
+bool MatchesCategory(const std::vector<std::string> &categories, const char *categoryName)
+{
+    for (const std::string &category : categories)
+    {
+        if (category == "*" || category == categoryName)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+BuiltinTracer::BuiltinTracer()
+{
+    compiledCategories = SplitString(ANGLE_BUILTIN_TRACER_CATEGORIES, ",", TRIM_WHITESPACE,
+                                     SPLIT_WANT_NONEMPTY);
+    runtimeCategories  = SplitString(GetEnvironmentVar("ANGLE_TRACE_CATEGORIES"), ",",
+                                     TRIM_WHITESPACE, SPLIT_WANT_NONEMPTY);
+    if (runtimeCategories.empty())
+    {
+        runtimeCategories.push_back("*");
+    }
+
+#    if defined(ANGLE_PLATFORM_POSIX)
+    signal(SIGUSR2, OnWriteTraceSignal);
+#    endif
+}
+
+bool BuiltinTracer::isCategoryRecorded(const char *categoryName) const
+{
+    return MatchesCategory(compiledCategories, categoryName) &&
+           MatchesCategory(runtimeCategories, categoryName);
+}
+
+BuiltinTracer &GetBuiltinTracer()
+{
+    static angle::base::NoDestructor<BuiltinTracer> tracer;
+    return *tracer;
+}
+
+ThreadTraceEvents &GetThreadTraceEvents()
+{
+    thread_local ThreadTraceEvents *threadEvents = nullptr;
+    if (ANGLE_UNLIKELY(threadEvents == nullptr))
+    {
+        threadEvents = new ThreadTraceEvents;
+
+        BuiltinTracer &tracer = GetBuiltinTracer();
+        std::lock_guard<std::mutex> lock(tracer.mutex);
+        threadEvents->threadId = static_cast<uint32_t>(tracer.threads.size()) + 1;
+        tracer.threads.push_back(threadEvents);
+    }
+    return *threadEvents;
+}
+
+uint64_t GetNanoseconds()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void WriteJSONString(std::ostream &out, const char *str)
+{
+    out << '"';
+    for (const char *c = str; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            out << '\\';
+        }
+        out << *c;
+    }
+    out << '"';
+}
+}  // anonymous namespace
+
+const unsigned char *GetBuiltinTraceCategoryEnabledFlag(const char *categoryName)
+{
+    BuiltinTracer &tracer = GetBuiltinTracer();
+    if (!tracer.isCategoryRecorded(categoryName))
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(tracer.mutex);
+
+    for (size_t index = 0; index < tracer.categoryCount; ++index)
+    {
+        if (strcmp(tracer.categoryNames[index], categoryName) == 0)
+        {
+            return &tracer.categoryEnabledFlags[index];
+        }
+    }
+
+    if (tracer.categoryCount == kMaxCategoryCount)
+    {
+        return nullptr;
+    }
+
+    const size_t index                 = tracer.categoryCount++;
+    tracer.categoryNames[index]        = categoryName;
+    tracer.categoryEnabledFlags[index] = 1;
+    return &tracer.categoryEnabledFlags[index];
+}
+
+bool IsBuiltinTraceCategoryEnabledFlag(const unsigned char *categoryEnabledFlag)
+{
+    const BuiltinTracer &tracer = GetBuiltinTracer();
+    return categoryEnabledFlag >= tracer.categoryEnabledFlags.data() &&
+           categoryEnabledFlag < tracer.categoryEnabledFlags.data() + kMaxCategoryCount;
+}
+
+void AddBuiltinTraceEvent(char phase,
+                          const unsigned char *categoryEnabledFlag,
+                          const char *name,
+                          unsigned char flags)
+{
+    if (ANGLE_UNLIKELY(gWriteRequested.load(std::memory_order_relaxed)) &&
+        gWriteRequested.exchange(false))
+    {
+        WriteBuiltinTrace();
+    }
+
+    // Temporary names would have to be copied, which the fixed size slots don't allow for.
+    if ((flags & kTraceEventFlagCopy) != 0)
+    {
+        return;
+    }
+
+    const uint32_t categoryIndex =
+        static_cast<uint32_t>(categoryEnabledFlag - GetBuiltinTracer().categoryEnabledFlags.data());
+
+    ThreadTraceEvents &threadEvents = GetThreadTraceEvents();
+    const uint64_t eventIndex       = threadEvents.eventCount.load(std::memory_order_relaxed);
+    TraceEventSlot &slot            = threadEvents.slots[eventIndex % kEventsPerThread];
+
+    // Pairs with the fence in WriteBuiltinTrace, so that a reader that sees any of this event also
+    // sees the event count this overwrites the oldest event at.
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timestampNanoseconds.store(GetNanoseconds(), std::memory_order_relaxed);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.phaseAndCategory.store(static_cast<uint32_t>(static_cast<unsigned char>(phase)) << 8 |
+                                    categoryIndex,
+                                std::memory_order_relaxed);
+    threadEvents.eventCount.store(eventIndex + 1, std::memory_order_release);
+}
+
+void WriteBuiltinTrace()
+{
+    std::string path = GetEnvironmentVar("ANGLE_TRACE_FILE");
+    if (path.empty())
+    {
+        path = kDefaultTraceFile;
+    }
+
+    std::ofstream out(path);
+    if (!out.good())
+    {
+        WARN() << "Failed to open the trace file " << path;
+        return;
+    }
+
+    BuiltinTracer &tracer = GetBuiltinTracer();
+    std::lock_guard<std::mutex> lock(tracer.mutex);
+
+    out << "{\"traceEvents\":[";
+    bool isFirstEvent = true;
+
+    for (ThreadTraceEvents *threadEvents : tracer.threads)
+    {
+        const uint64_t endIndex   = threadEvents->eventCount.load(std::memory_order_acquire);
+        const uint64_t beginIndex = endIndex > kEventsPerThread ? endIndex - kEventsPerThread : 0;
+
+        struct CopiedEvent
+        {
+            uint64_t timestampNanoseconds;
+            const char *name;
+            uint32_t phaseAndCategory;
+        };
+        std::vector<CopiedEvent> events;
+        events.reserve(static_cast<size_t>(endIndex - beginIndex));
+
+        for (uint64_t eventIndex = beginIndex; eventIndex < endIndex; ++eventIndex)
+        {
+            const TraceEventSlot &slot = threadEvents->slots[eventIndex % kEventsPerThread];
+            events.push_back({slot.timestampNanoseconds.load(std::memory_order_relaxed),
+                              slot.name.load(std::memory_order_relaxed),
+                              slot.phaseAndCategory.load(std::memory_order_relaxed)});
+        }
+
+        // The thread may have wrapped around while the slots were copied.  The events it may have
+        // overwritten in the meantime, including by the event it may be in the middle of
+        // recording, are dropped.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t newEndIndex = threadEvents->eventCount.load(std::memory_order_relaxed);
+        const uint64_t firstValidIndex =
+            newEndIndex + 1 > kEventsPerThread ? newEndIndex + 1 - kEventsPerThread : 0;
+        const size_t overwrittenCount = static_cast<size_t>(std::min<uint64_t>(
+            events.size(), firstValidIndex > beginIndex ? firstValidIndex - beginIndex : 0));
+
+        for (size_t index = overwrittenCount; index < events.size(); ++index)
+        {
+            const CopiedEvent &event     = events[index];
+            const char phase             = static_cast<char>(event.phaseAndCategory >> 8);
+            const uint32_t categoryIndex = event.phaseAndCategory & 0xFF;
+
+            out << (isFirstEvent ? "\n" : ",\n") << "{\"name\":";
+            WriteJSONString(out, event.name);
+            out << ",\"cat\":";
+            WriteJSONString(out, tracer.categoryNames[categoryIndex]);
+            out << ",\"ph\":\"" << phase << "\",\"ts\":" << event.timestampNanoseconds / 1000
+                << '.' << std::setw(3) << std::setfill('0') << event.timestampNanoseconds % 1000
+                << ",\"pid\":1,\"tid\":" << threadEvents->threadId;
+            if (phase == 'I')
+            {
+                // Instant events are scoped to their thread.
+                out << ",\"s\":\"t\"";
+            }
+            out << "}";
+            isFirstEvent = false;
+        }
+    }
+
+    out << "\n]}\n";
+    INFO() << "Wrote the trace to " << path;
+}
+}  // namespace angle
+
+#endif  // defined(ANGLE_ENABLE_BUILTIN_TRACER)
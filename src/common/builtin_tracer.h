@@ -0,0 +1,41 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// builtin_tracer.h: A trace event recorder for when the embedder doesn't collect ANGLE's trace
+// events, in builds with angle_enable_builtin_tracer.  Every thread records its events in a ring
+// buffer of its own, so the recent history of all threads can be written out at any time in the
+// Chrome JSON trace format, which chrome://tracing and Perfetto load.
+//
+// The categories recorded are those in both angle_builtin_tracer_categories and the
+// comma-separated ANGLE_TRACE_CATEGORIES environment variable; either can be "*" for all of them.
+// The trace is written to the file named by ANGLE_TRACE_FILE, angle_trace.json by default, when:
+//
+//   - WriteBuiltinTrace() is called,
+//   - the application inserts the GL_DEBUG_TYPE_MARKER message "ANGLE_write_trace" with
+//     glDebugMessageInsert,
+//   - or on POSIX, the process receives SIGUSR2.  The trace is then written by the next thread that
+//     records an event.
+
+#ifndef COMMON_BUILTIN_TRACER_H_
+#define COMMON_BUILTIN_TRACER_H_
+
+namespace angle
+{
+#if defined(ANGLE_ENABLE_BUILTIN_TRACER)
+// Returns the enabled flag of the category, or nullptr if the category is not recorded.
+const unsigned char *GetBuiltinTraceCategoryEnabledFlag(const char *categoryName);
+bool IsBuiltinTraceCategoryEnabledFlag(const unsigned char *categoryEnabledFlag);
+
+void AddBuiltinTraceEvent(char phase,
+                          const unsigned char *categoryEnabledFlag,
+                          const char *name,
+                          unsigned char flags);
+
+void WriteBuiltinTrace();
+#endif  // defined(ANGLE_ENABLE_BUILTIN_TRACER)
+}  // namespace angle
+
+#endif  // COMMON_BUILTIN_TRACER_H_
@@ -20,6 +20,7 @@
 #include <string>
 
 #include "common/angleutils.h"
+#include "common/entry_point_profile.h"
 #include "common/entry_points_enum_autogen.h"
 #include "common/platform.h"
 
@@ -253,10 +254,12 @@ std::ostream &FmtHex(std::ostream &os, T value)
 #define ERR() ANGLE_LOG(ERR)
 #define FATAL() ANGLE_LOG(FATAL)
 
-// A macro to log a performance event around a scope.
+// A macro to log a performance event around a scope.  It also times the scope in builds with
+// entry point profiling.
 #if defined(ANGLE_TRACE_ENABLED)
 #    if defined(_MSC_VER)
 #        define EVENT(context, entryPoint, message, ...)                                     \
+            ANGLE_PROFILE_ENTRY_POINT(entryPoint);                                           \
             gl::ScopedPerfEventHelper scopedPerfEventHelper##__LINE__(                       \
                 context, angle::EntryPoint::entryPoint);                                     \
             do                                                                               \
@@ -270,6 +273,7 @@ std::ostream &FmtHex(std::ostream &os, T value)
             } while (0)
 #    else
 #        define EVENT(context, entryPoint, message, ...)                                          \
+            ANGLE_PROFILE_ENTRY_POINT(entryPoint);                                                \
             gl::ScopedPerfEventHelper scopedPerfEventHelper(context,                              \
                                                             angle::EntryPoint::entryPoint);       \
             do                                                                                    \
@@ -282,6 +286,8 @@ std::ostream &FmtHex(std::ostream &os, T value)
                 }                                                                                 \
             } while (0)
 #    endif  // _MSC_VER
+#elif defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+#    define EVENT(context, entryPoint, message, ...) ANGLE_PROFILE_ENTRY_POINT(entryPoint)
 #else
 #    define EVENT(message, ...) (void(0))
 #endif
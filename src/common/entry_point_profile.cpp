@@ -0,0 +1,147 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// entry_point_profile.cpp: Per-entry-point call counts and CPU times, collected in builds with
+// angle_enable_entry_point_profiling.
+
+#include "common/entry_point_profile.h"
+
+#if defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+
+#    include <atomic>
+#    include <chrono>
+#    include <mutex>
+#    include <vector>
+
+#    include "anglebase/no_destructor.h"
+
+namespace angle
+{
+namespace
+{
+struct EntryPointCounters
+{
+    std::atomic<uint64_t> callCount{0};
+    std::atomic<uint64_t> totalNanoseconds{0};
+    std::atomic<uint64_t> validationNanoseconds{0};
+};
+
+using EntryPointCounterTable = std::array<EntryPointCounters, kEntryPointCount>;
+
+// The tables of all the threads that called an entry point, with the mutex that guards the list.
+// Only the list is guarded; the counters are atomics that are only written by their own thread.
+// The tables are never freed, so the calls of threads that have exited are still reported.
+struct EntryPointCounterTables
+{
+    std::mutex mutex;
+    std::vector<EntryPointCounterTable *> tables;
+};
+
+EntryPointCounterTables &GetEntryPointCounterTables()
+{
+    static angle::base::NoDestructor<EntryPointCounterTables> tables;
+    return *tables;
+}
+
+EntryPointCounterTable &GetThreadEntryPointCounterTable()
+{
+    thread_local EntryPointCounterTable *threadTable = nullptr;
+    if (ANGLE_UNLIKELY(threadTable == nullptr))
+    {
+        threadTable = new EntryPointCounterTable;
+
+        EntryPointCounterTables &tables = GetEntryPointCounterTables();
+        std::lock_guard<std::mutex> lock(tables.mutex);
+        tables.tables.push_back(threadTable);
+    }
+    return *threadTable;
+}
+
+// The innermost entry point being called on this thread.
+thread_local ScopedEntryPointProfile *gCurrentEntryPointProfile = nullptr;
+
+uint64_t GetNanoseconds()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+}  // anonymous namespace
+
+ScopedEntryPointProfile::ScopedEntryPointProfile(EntryPoint entryPoint)
+    : mEntryPoint(entryPoint),
+      mParent(gCurrentEntryPointProfile),
+      mBeginTime(GetNanoseconds()),
+      mValidationBeginTime(0),
+      mValidationEndTime(0)
+{
+    gCurrentEntryPointProfile = this;
+}
+
+ScopedEntryPointProfile::~ScopedEntryPointProfile()
+{
+    const uint64_t endTime    = GetNanoseconds();
+    gCurrentEntryPointProfile = mParent;
+
+    // A call that fails validation doesn't reach the end marker, so all of it after the context
+    // lock counts as validation.
+    uint64_t validationNanoseconds = 0;
+    if (mValidationBeginTime != 0)
+    {
+        const uint64_t validationEndTime = mValidationEndTime != 0 ? mValidationEndTime : endTime;
+        validationNanoseconds            = validationEndTime - mValidationBeginTime;
+    }
+
+    EntryPointCounters &counters =
+        GetThreadEntryPointCounterTable()[static_cast<size_t>(mEntryPoint)];
+    counters.callCount.fetch_add(1, std::memory_order_relaxed);
+    counters.totalNanoseconds.fetch_add(endTime - mBeginTime, std::memory_order_relaxed);
+    counters.validationNanoseconds.fetch_add(validationNanoseconds, std::memory_order_relaxed);
+}
+
+// static
+void ScopedEntryPointProfile::OnValidationBegin()
+{
+    if (gCurrentEntryPointProfile != nullptr)
+    {
+        gCurrentEntryPointProfile->mValidationBeginTime = GetNanoseconds();
+    }
+}
+
+// static
+void ScopedEntryPointProfile::OnValidationEnd()
+{
+    if (gCurrentEntryPointProfile != nullptr)
+    {
+        gCurrentEntryPointProfile->mValidationEndTime = GetNanoseconds();
+    }
+}
+
+void GetAndResetEntryPointProfiles(EntryPointProfiles *profilesOut)
+{
+    profilesOut->fill({});
+
+    EntryPointCounterTables &tables = GetEntryPointCounterTables();
+    std::lock_guard<std::mutex> lock(tables.mutex);
+
+    for (EntryPointCounterTable *table : tables.tables)
+    {
+        for (size_t index = 0; index < kEntryPointCount; ++index)
+        {
+            EntryPointCounters &counters = (*table)[index];
+            EntryPointProfile &profile   = (*profilesOut)[index];
+
+            profile.callCount += counters.callCount.exchange(0, std::memory_order_relaxed);
+            profile.totalNanoseconds +=
+                counters.totalNanoseconds.exchange(0, std::memory_order_relaxed);
+            profile.validationNanoseconds +=
+                counters.validationNanoseconds.exchange(0, std::memory_order_relaxed);
+        }
+    }
+}
+}  // namespace angle
+
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
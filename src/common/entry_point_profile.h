@@ -0,0 +1,68 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// entry_point_profile.h: Per-entry-point call counts and CPU times, collected in builds with
+// angle_enable_entry_point_profiling.  The profile is reported through the debug output of the
+// context, and reset, when the application inserts the GL_DEBUG_TYPE_MARKER message
+// "ANGLE_report_entry_point_profile" with glDebugMessageInsert.
+
+#ifndef COMMON_ENTRY_POINT_PROFILE_H_
+#define COMMON_ENTRY_POINT_PROFILE_H_
+
+#include <array>
+#include <cstdint>
+
+#include "common/angleutils.h"
+#include "common/entry_points_enum_autogen.h"
+
+namespace angle
+{
+struct EntryPointProfile
+{
+    uint64_t callCount;
+    // The time spent in the entry point, including validation.
+    uint64_t totalNanoseconds;
+    // The time spent between taking the context lock and the end of validation.
+    uint64_t validationNanoseconds;
+};
+
+using EntryPointProfiles = std::array<EntryPointProfile, kEntryPointCount>;
+
+#if defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+// Times a call to an entry point.  The counters are kept in a table per thread, which only that
+// thread writes to, so the calls don't contend on a lock.
+class ScopedEntryPointProfile final : angle::NonCopyable
+{
+  public:
+    explicit ScopedEntryPointProfile(EntryPoint entryPoint);
+    ~ScopedEntryPointProfile();
+
+    static void OnValidationBegin();
+    static void OnValidationEnd();
+
+  private:
+    EntryPoint mEntryPoint;
+    ScopedEntryPointProfile *mParent;
+    uint64_t mBeginTime;
+    uint64_t mValidationBeginTime;
+    uint64_t mValidationEndTime;
+};
+
+// Sums the tables of all threads into |profilesOut|, and restarts counting from zero.
+void GetAndResetEntryPointProfiles(EntryPointProfiles *profilesOut);
+
+#    define ANGLE_PROFILE_ENTRY_POINT(entryPoint) \
+        angle::ScopedEntryPointProfile scopedEntryPointProfile(angle::EntryPoint::entryPoint)
+#    define ANGLE_PROFILE_VALIDATION_BEGIN() angle::ScopedEntryPointProfile::OnValidationBegin()
+#    define ANGLE_PROFILE_VALIDATION_END() angle::ScopedEntryPointProfile::OnValidationEnd()
+#else
+#    define ANGLE_PROFILE_ENTRY_POINT(entryPoint) (void(0))
+#    define ANGLE_PROFILE_VALIDATION_BEGIN() (void(0))
+#    define ANGLE_PROFILE_VALIDATION_END() (void(0))
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+}  // namespace angle
+
+#endif  // COMMON_ENTRY_POINT_PROFILE_H_
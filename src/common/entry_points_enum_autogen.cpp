@@ -2196,6 +2196,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glPopMatrix";
         case EntryPoint::GLPopName:
             return "glPopName";
+        case EntryPoint::GLPrewarmDrawStateANGLE:
+            return "glPrewarmDrawStateANGLE";
         case EntryPoint::GLPrimitiveBoundingBox:
             return "glPrimitiveBoundingBox";
         case EntryPoint::GLPrimitiveBoundingBoxEXT:
@@ -2770,6 +2772,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glTexImage3DOES";
         case EntryPoint::GLTexImage3DRobustANGLE:
             return "glTexImage3DRobustANGLE";
+        case EntryPoint::GLTexPageCommitmentEXT:
+            return "glTexPageCommitmentEXT";
         case EntryPoint::GLTexParameterIiv:
             return "glTexParameterIiv";
         case EntryPoint::GLTexParameterIivEXT:
@@ -11,6 +11,8 @@
 #ifndef COMMON_ENTRYPOINTSENUM_AUTOGEN_H_
 #define COMMON_ENTRYPOINTSENUM_AUTOGEN_H_
 
+#include <cstddef>
+
 namespace angle
 {
 enum class EntryPoint
@@ -1104,6 +1106,7 @@ enum class EntryPoint
     GLPopGroupMarkerEXT,
     GLPopMatrix,
     GLPopName,
+    GLPrewarmDrawStateANGLE,
     GLPrimitiveBoundingBox,
     GLPrimitiveBoundingBoxEXT,
     GLPrimitiveRestartIndex,
@@ -1391,6 +1394,7 @@ enum class EntryPoint
     GLTexImage3DMultisample,
     GLTexImage3DOES,
     GLTexImage3DRobustANGLE,
+    GLTexPageCommitmentEXT,
     GLTexParameterIiv,
     GLTexParameterIivEXT,
     GLTexParameterIivOES,
@@ -1689,6 +1693,9 @@ enum class EntryPoint
     WGLUseFontOutlinesW
 };
 
+// The number of entry points, for tables indexed by EntryPoint.
+constexpr size_t kEntryPointCount = 1673;
+
 const char *GetEntryPointName(EntryPoint ep);
 }  // namespace angle
 #endif  // COMMON_ENTRY_POINTS_ENUM_AUTOGEN_H_
@@ -4,6 +4,7 @@
 
 #include "common/event_tracer.h"
 
+#include "common/builtin_tracer.h"
 #include "common/debug.h"
 
 namespace angle
@@ -20,6 +21,15 @@ const unsigned char *GetTraceCategoryEnabledFlag(PlatformMethods *platform, cons
         return categoryEnabledFlag;
     }
 
+#if defined(ANGLE_ENABLE_BUILTIN_TRACER)
+    // The embedder doesn't record this category, so it's recorded in process.
+    categoryEnabledFlag = GetBuiltinTraceCategoryEnabledFlag(name);
+    if (categoryEnabledFlag != nullptr)
+    {
+        return categoryEnabledFlag;
+    }
+#endif  // defined(ANGLE_ENABLE_BUILTIN_TRACER)
+
     static unsigned char disabled = 0;
     return &disabled;
 }
@@ -37,6 +47,14 @@ angle::TraceEventHandle AddTraceEvent(PlatformMethods *platform,
 {
     ASSERT(platform);
 
+#if defined(ANGLE_ENABLE_BUILTIN_TRACER)
+    if (IsBuiltinTraceCategoryEnabledFlag(categoryGroupEnabled))
+    {
+        AddBuiltinTraceEvent(phase, categoryGroupEnabled, name, flags);
+        return static_cast<angle::TraceEventHandle>(0);
+    }
+#endif  // defined(ANGLE_ENABLE_BUILTIN_TRACER)
+
     double timestamp = platform->monotonicallyIncreasingTime(platform);
 
     if (timestamp != 0)
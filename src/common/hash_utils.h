@@ -28,6 +28,14 @@ inline std::size_t ComputeGenericHash(const void *key, size_t keySize)
 #endif  // defined(ANGLE_IS_64_BIT_CPU)
 }
 
+// Computes a 64-bit hash of |dataSize| bytes of |data|.  Unlike ComputeGenericHash, this is meant
+// for hashing contents of any size and alignment, such as to detect that a buffer is unchanged.
+inline uint64_t ComputeContentHash(const void *data, size_t dataSize)
+{
+    static constexpr unsigned long long kSeed = 0x9E3779B1;
+    return XXH64(data, dataSize, kSeed);
+}
+
 template <typename T>
 std::size_t ComputeGenericHash(const T &key)
 {
@@ -102,6 +102,15 @@
 #    define ANGLE_USE_SSE
 #endif
 
+// SSE2 is part of the x86-64 baseline and NEON of the AArch64 one, so code using them doesn't need
+// a CPU check.  32-bit x86 builds only use SSE2 when they target it.
+#if defined(ANGLE_USE_SSE) && (defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || \
+                               (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define ANGLE_USE_SSE2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#    define ANGLE_USE_NEON
+#endif
+
 // Mips and arm devices need to include stddef for size_t.
 #if defined(__mips__) || defined(__arm__) || defined(__aarch64__)
 #    include <stddef.h>
@@ -14,6 +14,10 @@
 
 #include <set>
 
+#if defined(ANGLE_USE_NEON)
+#    include <arm_neon.h>
+#endif
+
 #if defined(ANGLE_ENABLE_WINDOWS_UWP)
 #    include <windows.applicationmodel.core.h>
 #    include <windows.graphics.display.h>
@@ -24,69 +28,332 @@
 namespace
 {
 
+// The primitive restart index is always the largest value of the index type, so restart indices
+// never lower the minimum index.  The kernels below clear them before computing the maximum.
+#if defined(ANGLE_USE_SSE2)
+// SSE2 only has signed 16-bit min/max and no 32-bit min/max, so the 16-bit and 32-bit indices are
+// biased into the signed range when loaded.
 template <class IndexType>
-gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
-                                      size_t count,
-                                      bool primitiveRestartEnabled,
-                                      GLuint primitiveRestartIndex)
+struct SIMDIndexRangeOps;
+
+template <>
+struct SIMDIndexRangeOps<GLubyte>
 {
-    ASSERT(count > 0);
+    using Vector = __m128i;
+
+    static Vector Load(const GLubyte *indices)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices));
+    }
+    static Vector Zero() { return _mm_setzero_si128(); }
+    static Vector Lowest() { return Zero(); }
+    static Vector Highest() { return _mm_set1_epi8(-1); }
+    static Vector Min(Vector a, Vector b) { return _mm_min_epu8(a, b); }
+    static Vector Max(Vector a, Vector b) { return _mm_max_epu8(a, b); }
+    static Vector Equal(Vector a, Vector b) { return _mm_cmpeq_epi8(a, b); }
+    static Vector CountLanes(Vector counts, Vector mask) { return _mm_sub_epi8(counts, mask); }
+    static GLubyte Unbias(GLubyte value) { return value; }
+};
+
+template <>
+struct SIMDIndexRangeOps<GLushort>
+{
+    using Vector = __m128i;
+
+    static Vector Load(const GLushort *indices)
+    {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices)),
+                             Lowest());
+    }
+    static Vector Zero() { return _mm_setzero_si128(); }
+    static Vector Lowest() { return _mm_set1_epi16(std::numeric_limits<int16_t>::min()); }
+    static Vector Highest() { return _mm_set1_epi16(std::numeric_limits<int16_t>::max()); }
+    static Vector Min(Vector a, Vector b) { return _mm_min_epi16(a, b); }
+    static Vector Max(Vector a, Vector b) { return _mm_max_epi16(a, b); }
+    static Vector Equal(Vector a, Vector b) { return _mm_cmpeq_epi16(a, b); }
+    static Vector CountLanes(Vector counts, Vector mask) { return _mm_sub_epi16(counts, mask); }
+    static GLushort Unbias(GLushort value) { return static_cast<GLushort>(value ^ 0x8000u); }
+};
+
+template <>
+struct SIMDIndexRangeOps<GLuint>
+{
+    using Vector = __m128i;
+
+    static Vector Load(const GLuint *indices)
+    {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices)),
+                             Lowest());
+    }
+    static Vector Zero() { return _mm_setzero_si128(); }
+    static Vector Lowest() { return _mm_set1_epi32(std::numeric_limits<int32_t>::min()); }
+    static Vector Highest() { return _mm_set1_epi32(std::numeric_limits<int32_t>::max()); }
+    static Vector Min(Vector a, Vector b)
+    {
+        const __m128i aIsGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aIsGreater, b), _mm_andnot_si128(aIsGreater, a));
+    }
+    static Vector Max(Vector a, Vector b)
+    {
+        const __m128i aIsGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aIsGreater, a), _mm_andnot_si128(aIsGreater, b));
+    }
+    static Vector Equal(Vector a, Vector b) { return _mm_cmpeq_epi32(a, b); }
+    static Vector CountLanes(Vector counts, Vector mask) { return _mm_sub_epi32(counts, mask); }
+    static GLuint Unbias(GLuint value) { return value ^ 0x80000000u; }
+};
+
+template <class IndexType>
+__m128i SIMDClearLanes(__m128i value, __m128i mask)
+{
+    using Ops = SIMDIndexRangeOps<IndexType>;
+    return _mm_or_si128(_mm_and_si128(mask, Ops::Lowest()), _mm_andnot_si128(mask, value));
+}
+
+template <class IndexType>
+size_t SIMDSumLanes(__m128i counts)
+{
+    constexpr size_t kLanes = sizeof(__m128i) / sizeof(IndexType);
+
+    alignas(16) IndexType lanes[kLanes];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), counts);
+
+    size_t sum = 0;
+    for (IndexType lane : lanes)
+    {
+        sum += lane;
+    }
+    return sum;
+}
+
+template <class IndexType, class Reduce>
+IndexType SIMDReduce(__m128i value, Reduce reduce)
+{
+    using Ops = SIMDIndexRangeOps<IndexType>;
+    constexpr size_t kLanes = sizeof(__m128i) / sizeof(IndexType);
+
+    alignas(16) IndexType lanes[kLanes];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), value);
+
+    IndexType result = Ops::Unbias(lanes[0]);
+    for (size_t lane = 1; lane < kLanes; ++lane)
+    {
+        result = reduce(result, Ops::Unbias(lanes[lane]));
+    }
+    return result;
+}
+
+template <class IndexType>
+IndexType SIMDReduceMin(__m128i value)
+{
+    return SIMDReduce<IndexType>(value, [](IndexType a, IndexType b) { return std::min(a, b); });
+}
+
+template <class IndexType>
+IndexType SIMDReduceMax(__m128i value)
+{
+    return SIMDReduce<IndexType>(value, [](IndexType a, IndexType b) { return std::max(a, b); });
+}
+#elif defined(ANGLE_USE_NEON)
+template <class IndexType>
+struct SIMDIndexRangeOps;
+
+template <>
+struct SIMDIndexRangeOps<GLubyte>
+{
+    using Vector = uint8x16_t;
+
+    static Vector Load(const GLubyte *indices) { return vld1q_u8(indices); }
+    static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u8(a, b); }
+    static Vector Zero() { return vdupq_n_u8(0); }
+    static Vector Lowest() { return Zero(); }
+    static Vector Highest() { return vdupq_n_u8(0xFF); }
+    static Vector ClearLanes(Vector value, Vector mask) { return vbicq_u8(value, mask); }
+    static Vector CountLanes(Vector counts, Vector mask) { return vsubq_u8(counts, mask); }
+    static size_t SumLanes(Vector counts) { return vaddlvq_u8(counts); }
+    static GLubyte ReduceMin(Vector value) { return vminvq_u8(value); }
+    static GLubyte ReduceMax(Vector value) { return vmaxvq_u8(value); }
+};
+
+template <>
+struct SIMDIndexRangeOps<GLushort>
+{
+    using Vector = uint16x8_t;
+
+    static Vector Load(const GLushort *indices) { return vld1q_u16(indices); }
+    static Vector Min(Vector a, Vector b) { return vminq_u16(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u16(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u16(a, b); }
+    static Vector Zero() { return vdupq_n_u16(0); }
+    static Vector Lowest() { return Zero(); }
+    static Vector Highest() { return vdupq_n_u16(0xFFFF); }
+    static Vector ClearLanes(Vector value, Vector mask) { return vbicq_u16(value, mask); }
+    static Vector CountLanes(Vector counts, Vector mask) { return vsubq_u16(counts, mask); }
+    static size_t SumLanes(Vector counts) { return vaddlvq_u16(counts); }
+    static GLushort ReduceMin(Vector value) { return vminvq_u16(value); }
+    static GLushort ReduceMax(Vector value) { return vmaxvq_u16(value); }
+};
+
+template <>
+struct SIMDIndexRangeOps<GLuint>
+{
+    using Vector = uint32x4_t;
+
+    static Vector Load(const GLuint *indices) { return vld1q_u32(indices); }
+    static Vector Min(Vector a, Vector b) { return vminq_u32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u32(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u32(a, b); }
+    static Vector Zero() { return vdupq_n_u32(0); }
+    static Vector Lowest() { return Zero(); }
+    static Vector Highest() { return vdupq_n_u32(0xFFFFFFFF); }
+    static Vector ClearLanes(Vector value, Vector mask) { return vbicq_u32(value, mask); }
+    static Vector CountLanes(Vector counts, Vector mask) { return vsubq_u32(counts, mask); }
+    static size_t SumLanes(Vector counts) { return vaddlvq_u32(counts); }
+    static GLuint ReduceMin(Vector value) { return vminvq_u32(value); }
+    static GLuint ReduceMax(Vector value) { return vmaxvq_u32(value); }
+};
+
+template <class IndexType, class Vector>
+Vector SIMDClearLanes(Vector value, Vector mask)
+{
+    return SIMDIndexRangeOps<IndexType>::ClearLanes(value, mask);
+}
+
+template <class IndexType, class Vector>
+size_t SIMDSumLanes(Vector counts)
+{
+    return SIMDIndexRangeOps<IndexType>::SumLanes(counts);
+}
+
+template <class IndexType, class Vector>
+IndexType SIMDReduceMin(Vector value)
+{
+    return SIMDIndexRangeOps<IndexType>::ReduceMin(value);
+}
+
+template <class IndexType, class Vector>
+IndexType SIMDReduceMax(Vector value)
+{
+    return SIMDIndexRangeOps<IndexType>::ReduceMax(value);
+}
+#endif
+
+#if defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+// Scans the largest multiple of the vector width of |indices| and merges the result into
+// |minIndex|, |maxIndex| and |primitiveRestartCount|.  Returns the number of indices scanned.
+template <class IndexType>
+size_t ComputeIndexRangeSIMD(const IndexType *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled,
+                             IndexType *minIndex,
+                             IndexType *maxIndex,
+                             size_t *primitiveRestartCount)
+{
+    using Ops    = SIMDIndexRangeOps<IndexType>;
+    using Vector = typename Ops::Vector;
 
-    IndexType minIndex                = 0;
-    IndexType maxIndex                = 0;
-    size_t nonPrimitiveRestartIndices = 0;
+    constexpr size_t kLanes = sizeof(Vector) / sizeof(IndexType);
+    const size_t simdCount  = count - count % kLanes;
+    if (simdCount == 0)
+    {
+        return 0;
+    }
+
+    const Vector highest = Ops::Highest();
+    Vector minVector     = highest;
+    Vector maxVector     = Ops::Lowest();
 
     if (primitiveRestartEnabled)
     {
-        // Find the first non-primitive restart index to initialize the min and max values
-        size_t i = 0;
-        for (; i < count; i++)
+        // Restart indices are counted per lane, and the counters are summed before they overflow.
+        constexpr size_t kMaxBatchCount =
+            std::min<size_t>(std::numeric_limits<IndexType>::max(), 0xFFFF) * kLanes;
+        for (size_t batchStart = 0; batchStart < simdCount; batchStart += kMaxBatchCount)
         {
-            if (indices[i] != primitiveRestartIndex)
+            const size_t batchEnd = std::min(simdCount, batchStart + kMaxBatchCount);
+            Vector restartCounts  = Ops::Zero();
+            for (size_t i = batchStart; i < batchEnd; i += kLanes)
             {
-                minIndex = indices[i];
-                maxIndex = indices[i];
-                nonPrimitiveRestartIndices++;
-                break;
+                const Vector value     = Ops::Load(indices + i);
+                const Vector isRestart = Ops::Equal(value, highest);
+
+                minVector     = Ops::Min(minVector, value);
+                maxVector     = Ops::Max(maxVector, SIMDClearLanes<IndexType>(value, isRestart));
+                restartCounts = Ops::CountLanes(restartCounts, isRestart);
             }
+            *primitiveRestartCount += SIMDSumLanes<IndexType>(restartCounts);
         }
+    }
+    else
+    {
+        for (size_t i = 0; i < simdCount; i += kLanes)
+        {
+            const Vector value = Ops::Load(indices + i);
 
-        // Loop over the rest of the indices
+            minVector = Ops::Min(minVector, value);
+            maxVector = Ops::Max(maxVector, value);
+        }
+    }
+
+    *minIndex = std::min(*minIndex, SIMDReduceMin<IndexType>(minVector));
+    *maxIndex = std::max(*maxIndex, SIMDReduceMax<IndexType>(maxVector));
+
+    return simdCount;
+}
+#endif
+
+template <class IndexType>
+gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
+                                      size_t count,
+                                      bool primitiveRestartEnabled,
+                                      GLuint primitiveRestartIndex)
+{
+    ASSERT(count > 0);
+    ASSERT(primitiveRestartIndex == std::numeric_limits<IndexType>::max());
+
+    const IndexType restartIndex = static_cast<IndexType>(primitiveRestartIndex);
+
+    IndexType minIndex           = std::numeric_limits<IndexType>::max();
+    IndexType maxIndex           = 0;
+    size_t primitiveRestartCount = 0;
+    size_t i                     = 0;
+
+#if defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+    i = ComputeIndexRangeSIMD(indices, count, primitiveRestartEnabled, &minIndex, &maxIndex,
+                              &primitiveRestartCount);
+#endif
+
+    // Scan what the vector kernel left over.
+    if (primitiveRestartEnabled)
+    {
         for (; i < count; i++)
         {
-            if (indices[i] != primitiveRestartIndex)
+            if (indices[i] == restartIndex)
             {
-                if (minIndex > indices[i])
-                {
-                    minIndex = indices[i];
-                }
-                if (maxIndex < indices[i])
-                {
-                    maxIndex = indices[i];
-                }
-                nonPrimitiveRestartIndices++;
+                primitiveRestartCount++;
+                continue;
             }
+            minIndex = std::min(minIndex, indices[i]);
+            maxIndex = std::max(maxIndex, indices[i]);
         }
     }
     else
     {
-        minIndex                   = indices[0];
-        maxIndex                   = indices[0];
-        nonPrimitiveRestartIndices = count;
-
-        for (size_t i = 1; i < count; i++)
+        for (; i < count; i++)
         {
-            if (minIndex > indices[i])
-            {
-                minIndex = indices[i];
-            }
-            if (maxIndex < indices[i])
-            {
-                maxIndex = indices[i];
-            }
+            minIndex = std::min(minIndex, indices[i]);
+            maxIndex = std::max(maxIndex, indices[i]);
         }
     }
 
+    const size_t nonPrimitiveRestartIndices = count - primitiveRestartCount;
+    if (nonPrimitiveRestartIndices == 0)
+    {
+        return gl::IndexRange();
+    }
+
     return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
                           nonPrimitiveRestartIndices);
 }
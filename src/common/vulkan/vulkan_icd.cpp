@@ -269,6 +269,34 @@ void ChoosePhysicalDevice(const std::vector<VkPhysicalDevice> &physicalDevices,
     vkGetPhysicalDeviceProperties(*physicalDeviceOut, physicalDevicePropertiesOut);
 }
 
+bool SelectPhysicalDevice(const std::vector<VkPhysicalDevice> &physicalDevices,
+                          uint32_t vendorID,
+                          uint32_t deviceID,
+                          uint32_t deviceIndex,
+                          VkPhysicalDevice *physicalDeviceOut,
+                          VkPhysicalDeviceProperties *physicalDevicePropertiesOut)
+{
+    uint32_t matchingDeviceIndex = 0;
+    for (const VkPhysicalDevice &physicalDevice : physicalDevices)
+    {
+        vkGetPhysicalDeviceProperties(physicalDevice, physicalDevicePropertiesOut);
+        if (vendorID != 0 && physicalDevicePropertiesOut->vendorID != vendorID)
+        {
+            continue;
+        }
+        if (deviceID != 0 && physicalDevicePropertiesOut->deviceID != deviceID)
+        {
+            continue;
+        }
+        if (matchingDeviceIndex++ == deviceIndex)
+        {
+            *physicalDeviceOut = physicalDevice;
+            return true;
+        }
+    }
+    return false;
+}
+
 }  // namespace vk
 
 }  // namespace angle
@@ -60,6 +60,16 @@ void ChoosePhysicalDevice(const std::vector<VkPhysicalDevice> &physicalDevices,
                           VkPhysicalDevice *physicalDeviceOut,
                           VkPhysicalDeviceProperties *physicalDevicePropertiesOut);
 
+// Selects the |deviceIndex|th device, in enumeration order, of those with |vendorID| and
+// |deviceID|, either of which can be 0 to match any.  The index tells apart identical GPUs.
+// Returns false if there is no such device.
+bool SelectPhysicalDevice(const std::vector<VkPhysicalDevice> &physicalDevices,
+                          uint32_t vendorID,
+                          uint32_t deviceID,
+                          uint32_t deviceIndex,
+                          VkPhysicalDevice *physicalDeviceOut,
+                          VkPhysicalDeviceProperties *physicalDevicePropertiesOut);
+
 }  // namespace vk
 
 }  // namespace angle
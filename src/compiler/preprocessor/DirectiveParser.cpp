@@ -144,6 +144,7 @@ namespace pp
 {
 DirectiveParser::DirectiveParser(Tokenizer *tokenizer,
                                  MacroSet *macroSet,
+                                 MacroExpansionCache *expansionCache,
                                  Diagnostics *diagnostics,
                                  DirectiveHandler *directiveHandler,
                                  const PreprocessorSettings &settings)
@@ -151,6 +152,7 @@ DirectiveParser::DirectiveParser(Tokenizer *tokenizer,
       mSeenNonPreprocessorToken(false),
       mTokenizer(tokenizer),
       mMacroSet(macroSet),
+      mExpansionCache(expansionCache),
       mDiagnostics(diagnostics),
       mDirectiveHandler(directiveHandler),
       mShaderVersion(100),
@@ -362,6 +364,7 @@ void DirectiveParser::parseDefine(Token *token)
         return;
     }
     mMacroSet->insert(std::make_pair(macro->name, macro));
+    mExpansionCache->clear();
 }
 
 void DirectiveParser::parseUndef(Token *token)
@@ -393,6 +396,7 @@ void DirectiveParser::parseUndef(Token *token)
         else
         {
             mMacroSet->erase(iter);
+            mExpansionCache->clear();
         }
     }
 
@@ -820,7 +824,7 @@ void DirectiveParser::parseLine(Token *token)
     bool parsedFileNumber = false;
     int line = 0, file = 0;
 
-    MacroExpander macroExpander(mTokenizer, mMacroSet, mDiagnostics, mSettings, false);
+    MacroExpander macroExpander(mTokenizer, mMacroSet, nullptr, mDiagnostics, mSettings, false);
 
     // Lex the first token after "#line" so we can check it for EOD.
     macroExpander.lex(token);
@@ -928,7 +932,7 @@ int DirectiveParser::parseExpressionIf(Token *token)
 {
     ASSERT((getDirective(token) == DIRECTIVE_IF) || (getDirective(token) == DIRECTIVE_ELIF));
 
-    MacroExpander macroExpander(mTokenizer, mMacroSet, mDiagnostics, mSettings, true);
+    MacroExpander macroExpander(mTokenizer, mMacroSet, nullptr, mDiagnostics, mSettings, true);
     ExpressionParser expressionParser(&macroExpander, mDiagnostics);
 
     int expression = 0;
@@ -27,6 +27,7 @@ class DirectiveParser : public Lexer
   public:
     DirectiveParser(Tokenizer *tokenizer,
                     MacroSet *macroSet,
+                    MacroExpansionCache *expansionCache,
                     Diagnostics *diagnostics,
                     DirectiveHandler *directiveHandler,
                     const PreprocessorSettings &settings);
@@ -75,6 +76,7 @@ class DirectiveParser : public Lexer
     std::vector<ConditionalBlock> mConditionalStack;
     Tokenizer *mTokenizer;
     MacroSet *mMacroSet;
+    MacroExpansionCache *mExpansionCache;
     Diagnostics *mDiagnostics;
     DirectiveHandler *mDirectiveHandler;
     int mShaderVersion;
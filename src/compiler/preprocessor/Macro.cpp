@@ -25,6 +25,10 @@ bool Macro::equals(const Macro &other) const
            (replacements == other.replacements);
 }
 
+MacroExpansion::MacroExpansion() : memoized(false), identifierFlags(0) {}
+
+MacroExpansion::~MacroExpansion() {}
+
 void PredefineMacro(MacroSet *macroSet, const char *name, int value)
 {
     Token token;
@@ -7,9 +7,9 @@
 #ifndef COMPILER_PREPROCESSOR_MACRO_H_
 #define COMPILER_PREPROCESSOR_MACRO_H_
 
-#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace angle
@@ -44,7 +44,27 @@ struct Macro
     Replacements replacements;
 };
 
-typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
+typedef std::unordered_map<std::string, std::shared_ptr<Macro>> MacroSet;
+
+// The replacement list of an object-like macro with all the macros in it expanded, memoized by the
+// macro expander.
+struct MacroExpansion
+{
+    MacroExpansion();
+    ~MacroExpansion();
+
+    // False if the expansion depends on more than the macro definitions, e.g. because it contains
+    // the name of a function-like macro, in which case the macro is expanded as usual.
+    bool memoized;
+    // The padding flags of the identifier the replacements were expanded for, which the first
+    // replacement may have inherited.
+    unsigned int identifierFlags;
+    std::vector<Token> replacements;
+};
+
+// Expansions depend on the definitions of the macros they contain, so the cache must be cleared
+// whenever a macro is defined or undefined.
+typedef std::unordered_map<const Macro *, MacroExpansion> MacroExpansionCache;
 
 void PredefineMacro(MacroSet *macroSet, const char *name, int value);
 
@@ -24,6 +24,9 @@ namespace
 
 const size_t kMaxContextTokens = 10000;
 
+// Deeper chains of object-like macros are expanded lazily rather than recursively.
+const int kMaxMemoizedExpansionDepth = 64;
+
 class TokenLexer : public Lexer
 {
   public:
@@ -86,17 +89,22 @@ MacroExpander::ScopedMacroReenabler::~ScopedMacroReenabler()
 
 MacroExpander::MacroExpander(Lexer *lexer,
                              MacroSet *macroSet,
+                             MacroExpansionCache *expansionCache,
                              Diagnostics *diagnostics,
                              const PreprocessorSettings &settings,
                              bool parseDefined)
     : mLexer(lexer),
       mMacroSet(macroSet),
+      mExpansionCache(expansionCache),
       mDiagnostics(diagnostics),
       mParseDefined(parseDefined),
       mTotalTokensInContexts(0),
       mSettings(settings),
       mDeferReenablingMacros(false)
-{}
+{
+    // The defined operator makes expansions depend on where the macro is used.
+    ASSERT(mExpansionCache == nullptr || !mParseDefined);
+}
 
 MacroExpander::~MacroExpander()
 {
@@ -176,6 +184,14 @@ void MacroExpander::lex(Token *token)
             break;
         }
 
+        // Macros are only disabled while their replacements are in a context, so outside of any
+        // context the expansion of an object-like macro only depends on the macro definitions.
+        if (mExpansionCache != nullptr && macro->type == Macro::kTypeObj &&
+            mContextStack.empty() && pushMemoizedMacro(macro, *token))
+        {
+            continue;
+        }
+
         // Bump the expansion count before peeking if the next token is a '('
         // otherwise there could be a #undef of the macro before the next token.
         macro->expansionCount++;
@@ -265,6 +281,55 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     return true;
 }
 
+bool MacroExpander::pushMemoizedMacro(std::shared_ptr<Macro> macro, const Token &identifier)
+{
+    ASSERT(macro->type == Macro::kTypeObj);
+    ASSERT(mContextStack.empty());
+
+    constexpr unsigned int kPaddingFlags = Token::AT_START_OF_LINE | Token::HAS_LEADING_SPACE;
+    const unsigned int identifierFlags   = identifier.flags & kPaddingFlags;
+
+    MacroExpansion *expansion = nullptr;
+    auto iter                 = mExpansionCache->find(macro.get());
+    if (iter != mExpansionCache->end())
+    {
+        if (!iter->second.memoized)
+        {
+            return false;
+        }
+        expansion = &iter->second;
+    }
+
+    if (expansion == nullptr || expansion->identifierFlags != identifierFlags)
+    {
+        expansion                  = &(*mExpansionCache)[macro.get()];
+        expansion->identifierFlags = identifierFlags;
+        expansion->replacements.clear();
+        expansion->memoized =
+            expandMemoizableMacro(*macro, identifier, 0, &expansion->replacements);
+        if (!expansion->memoized)
+        {
+            expansion->replacements.clear();
+            return false;
+        }
+    }
+
+    MacroContext *context = new MacroContext;
+    context->macro        = macro;
+    context->replacements = expansion->replacements;
+    for (Token &repl : context->replacements)
+    {
+        repl.location = identifier.location;
+    }
+
+    // Like for any other expansion, the macro is disabled until it is popped off the stack.
+    macro->expansionCount++;
+    macro->disabled = true;
+    mContextStack.push_back(context);
+    mTotalTokensInContexts += context->replacements.size();
+    return true;
+}
+
 void MacroExpander::popMacro()
 {
     ASSERT(!mContextStack.empty());
@@ -346,6 +411,66 @@ bool MacroExpander::expandMacro(const Macro &macro,
     return true;
 }
 
+bool MacroExpander::expandMemoizableMacro(const Macro &macro,
+                                          const Token &identifier,
+                                          int depth,
+                                          std::vector<Token> *replacements)
+{
+    // __LINE__ and __FILE__ depend on where they are used, and __VERSION__ may change.
+    if (macro.predefined || depth > kMaxMemoizedExpansionDepth)
+    {
+        return false;
+    }
+
+    // Produces the same tokens as rescanning the replacements of the macro would, so the macro is
+    // disabled during its own expansion.
+    macro.disabled  = true;
+    bool memoizable = true;
+    for (std::size_t i = 0; i < macro.replacements.size() && memoizable; ++i)
+    {
+        Token repl = macro.replacements[i];
+        if (i == 0)
+        {
+            repl.setAtStartOfLine(identifier.atStartOfLine());
+            repl.setHasLeadingSpace(identifier.hasLeadingSpace());
+        }
+
+        MacroSet::const_iterator iter = mMacroSet->end();
+        if (repl.type == Token::IDENTIFIER)
+        {
+            iter = mMacroSet->find(repl.text);
+        }
+
+        if (iter == mMacroSet->end() || iter->second->disabled)
+        {
+            // None of the identifiers left in the expansion are macros that can be expanded,
+            // disabling their expansion saves looking them up again.
+            if (repl.type == Token::IDENTIFIER)
+            {
+                repl.setExpansionDisabled(true);
+            }
+            replacements->push_back(repl);
+        }
+        else if (iter->second->type == Macro::kTypeFunc)
+        {
+            // Whether it is invoked depends on the tokens following the expansion.
+            memoizable = false;
+        }
+        else
+        {
+            memoizable = expandMemoizableMacro(*iter->second, repl, depth + 1, replacements);
+        }
+
+        if (replacements->size() > kMaxContextTokens)
+        {
+            memoizable = false;
+        }
+    }
+    macro.disabled = false;
+
+    return memoizable;
+}
+
 bool MacroExpander::collectMacroArgs(const Macro &macro,
                                      const Token &identifier,
                                      std::vector<MacroArg> *args,
@@ -441,7 +566,8 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
         }
         PreprocessorSettings nestedSettings(mSettings.shaderSpec);
         nestedSettings.maxMacroExpansionDepth = mSettings.maxMacroExpansionDepth - 1;
-        MacroExpander expander(&lexer, mMacroSet, mDiagnostics, nestedSettings, mParseDefined);
+        MacroExpander expander(&lexer, mMacroSet, nullptr, mDiagnostics, nestedSettings,
+                               mParseDefined);
 
         arg.clear();
         expander.lex(&token);
@@ -26,8 +26,11 @@ struct SourceLocation;
 class MacroExpander : public Lexer
 {
   public:
+    // If |expansionCache| is not null, the expansions of object-like macros that don't depend on
+    // the surrounding tokens are memoized in it.
     MacroExpander(Lexer *lexer,
                   MacroSet *macroSet,
+                  MacroExpansionCache *expansionCache,
                   Diagnostics *diagnostics,
                   const PreprocessorSettings &settings,
                   bool parseDefined);
@@ -41,9 +44,14 @@ class MacroExpander : public Lexer
     bool isNextTokenLeftParen();
 
     bool pushMacro(std::shared_ptr<Macro> macro, const Token &identifier);
+    bool pushMemoizedMacro(std::shared_ptr<Macro> macro, const Token &identifier);
     void popMacro();
 
     bool expandMacro(const Macro &macro, const Token &identifier, std::vector<Token> *replacements);
+    bool expandMemoizableMacro(const Macro &macro,
+                               const Token &identifier,
+                               int depth,
+                               std::vector<Token> *replacements);
 
     typedef std::vector<Token> MacroArg;
     bool collectMacroArgs(const Macro &macro,
@@ -69,6 +77,7 @@ class MacroExpander : public Lexer
 
     Lexer *mLexer;
     MacroSet *mMacroSet;
+    MacroExpansionCache *mExpansionCache;
     Diagnostics *mDiagnostics;
     bool mParseDefined;
 
@@ -24,6 +24,7 @@ struct PreprocessorImpl
 {
     Diagnostics *diagnostics;
     MacroSet macroSet;
+    MacroExpansionCache expansionCache;
     Tokenizer tokenizer;
     DirectiveParser directiveParser;
     MacroExpander macroExpander;
@@ -33,8 +34,8 @@ struct PreprocessorImpl
                      const PreprocessorSettings &settings)
         : diagnostics(diag),
           tokenizer(diag),
-          directiveParser(&tokenizer, &macroSet, diag, directiveHandler, settings),
-          macroExpander(&directiveParser, &macroSet, diag, settings, false)
+          directiveParser(&tokenizer, &macroSet, &expansionCache, diag, directiveHandler, settings),
+          macroExpander(&directiveParser, &macroSet, &expansionCache, diag, settings, false)
     {}
 };
 
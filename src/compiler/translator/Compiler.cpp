@@ -32,6 +32,7 @@
 #include "compiler/translator/tree_ops/FoldExpressions.h"
 #include "compiler/translator/tree_ops/ForcePrecisionQualifier.h"
 #include "compiler/translator/tree_ops/InitializeVariables.h"
+#include "compiler/translator/tree_ops/OptimizeAST.h"
 #include "compiler/translator/tree_ops/PruneEmptyCases.h"
 #include "compiler/translator/tree_ops/PruneNoOps.h"
 #include "compiler/translator/tree_ops/RemoveArrayLengthMethod.h"
@@ -53,6 +54,7 @@
 #include "compiler/translator/tree_ops/vulkan/EarlyFragmentTestsOptimization.h"
 #include "compiler/translator/tree_util/BuiltIn.h"
 #include "compiler/translator/tree_util/IntermNodePatternMatcher.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
 #include "compiler/translator/tree_util/ReplaceShadowingVariables.h"
 #include "compiler/translator/util.h"
 #include "third_party/compiler/ArrayBoundsClamper.h"
@@ -280,6 +282,9 @@ bool ValidateFragColorAndFragData(GLenum shaderType,
 
 TShHandleBase::TShHandleBase()
 {
+    // Translators come and go with the contexts and are used one at a time, so let them share
+    // their pages instead of each keeping its own.
+    allocator.enableThreadPageCache();
     allocator.push();
     SetGlobalPoolAllocator(&allocator);
 }
@@ -353,6 +358,7 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
 {
     // Remember the compile options for helper functions such as validateAST.
     mCompileOptions = compileOptions;
+    mPassTimer.reset((compileOptions & SH_LOG_PASS_TIMINGS) != 0);
 
     clearResults();
 
@@ -423,6 +429,8 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
         return nullptr;
     }
 
+    mPassTimer.record("Parse");
+
     TIntermBlock *root = parseContext.getTreeRoot();
     if (!checkAndSimplifyAST(root, parseContext, compileOptions))
     {
@@ -571,18 +579,21 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mPassTimer.record("validateAST");
 
     // Disallow expressions deemed too complex.
     if ((compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY) != 0 && !limitExpressionComplexity(root))
     {
         return false;
     }
+    mPassTimer.record("limitExpressionComplexity");
 
     if (shouldRunLoopAndIndexingValidation(compileOptions) &&
         !ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics))
     {
         return false;
     }
+    mPassTimer.record("ValidateLimitations");
 
     if (!ValidateFragColorAndFragData(mShaderType, mShaderVersion, mSymbolTable, &mDiagnostics))
     {
@@ -595,6 +606,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mPassTimer.record("FoldExpressions");
     // Folding should only be able to generate warnings.
     ASSERT(mDiagnostics.numErrors() == 0);
 
@@ -609,6 +621,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mPassTimer.record("PruneNoOps");
 
     // We need to generate globals early if we have non constant initializers enabled
     bool initializeLocalsAndGlobals = (compileOptions & SH_INITIALIZE_UNINITIALIZED_LOCALS) != 0 &&
@@ -625,17 +638,20 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mPassTimer.record("DeferGlobalInitializers");
 
     // Create the function DAG and check there is no recursion
     if (!initCallDag(root))
     {
         return false;
     }
+    mPassTimer.record("initCallDag");
 
     if ((compileOptions & SH_LIMIT_CALL_STACK_DEPTH) != 0 && !checkCallDepth())
     {
         return false;
     }
+    mPassTimer.record("checkCallDepth");
 
     // Checks which functions are used and if "main" exists
     mFunctionMetadata.clear();
@@ -644,31 +660,48 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mPassTimer.record("tagUsedFunctions");
 
     pruneUnusedFunctions(root);
+    mPassTimer.record("pruneUnusedFunctions");
     if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
     {
         if (!ReplaceShadowingVariables(this, root, &mSymbolTable))
         {
             return false;
         }
+        mPassTimer.record("ReplaceShadowingVariables");
     }
 
-    if (mShaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, mShaderType))
+    // These validation passes only read the tree, so they share a single traversal.
+    TIntermReadOnlyPassList validationPasses;
+    if (mShaderVersion >= 310)
     {
-        return false;
+        validationPasses.push_back(CreateValidateVaryingLocationsPass(&mDiagnostics, mShaderType));
     }
 
-    if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER &&
-        !ValidateOutputs(root, getExtensionBehavior(), mResources.MaxDrawBuffers, &mDiagnostics))
+    if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER)
     {
-        return false;
+        validationPasses.push_back(CreateValidateOutputsPass(
+            getExtensionBehavior(), mResources.MaxDrawBuffers, &mDiagnostics));
+    }
+
+    if (mShaderType == GL_TESS_CONTROL_SHADER)
+    {
+        validationPasses.push_back(CreateValidateBarrierFunctionCallPass(&mDiagnostics));
+    }
+
+    if (parseContext.isExtensionEnabled(TExtension::EXT_clip_cull_distance))
+    {
+        validationPasses.push_back(CreateValidateClipCullDistancePass(
+            &mDiagnostics, mResources.MaxCombinedClipAndCullDistances));
     }
 
-    if (mShaderType == GL_TESS_CONTROL_SHADER && !ValidateBarrierFunctionCall(root, &mDiagnostics))
+    if (!RunReadOnlyPasses(root, validationPasses))
     {
         return false;
     }
+    mPassTimer.record("ValidationPasses");
 
     // Fail compilation if precision emulation not supported.
     if (getResources().WEBGL_debug_shader_precision && getPragma().debugShaderPrecision &&
@@ -678,19 +711,11 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
 
-    if (parseContext.isExtensionEnabled(TExtension::EXT_clip_cull_distance))
-    {
-        if (!ValidateClipCullDistance(root, &mDiagnostics,
-                                      mResources.MaxCombinedClipAndCullDistances))
-        {
-            return false;
-        }
-    }
-
     // Clamping uniform array bounds needs to happen after validateLimitations pass.
     if ((compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS) != 0)
     {
         mArrayBoundsClamper.MarkIndirectArrayBoundsForClamping(root);
+        mPassTimer.record("MarkIndirectArrayBoundsForClamping");
     }
 
     if ((compileOptions & SH_INITIALIZE_BUILTINS_FOR_INSTANCED_MULTIVIEW) != 0 &&
@@ -703,6 +728,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("DeclareAndInitBuiltinsForInstancedMultiview");
     }
 
     // This pass might emit short circuits so keep it before the short circuit unfolding
@@ -712,6 +738,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("RewriteDoWhile");
     }
 
     if ((compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION) != 0)
@@ -720,6 +747,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("AddAndTrueToLoopCondition");
     }
 
     if ((compileOptions & SH_UNFOLD_SHORT_CIRCUIT) != 0)
@@ -728,6 +756,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("UnfoldShortCircuitAST");
     }
 
     if ((compileOptions & SH_REGENERATE_STRUCT_NAMES) != 0)
@@ -736,6 +765,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("RegenerateStructNames");
     }
 
     if (mShaderType == GL_VERTEX_SHADER &&
@@ -748,6 +778,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            mPassTimer.record("EmulateGLDrawID");
         }
     }
 
@@ -762,6 +793,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            mPassTimer.record("EmulateGLBaseVertexBaseInstance");
         }
     }
 
@@ -774,6 +806,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("EmulateGLFragColorBroadcast");
     }
 
     int simplifyScalarized = (compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS) != 0
@@ -791,6 +824,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mPassTimer.record("SimplifyLoopConditions");
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
@@ -798,6 +832,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mPassTimer.record("SeparateDeclarations");
     mValidateASTOptions.validateMultiDeclarations = true;
 
     if (!SplitSequenceOperator(this, root,
@@ -806,16 +841,29 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mPassTimer.record("SplitSequenceOperator");
 
     if (!RemoveArrayLengthMethod(this, root))
     {
         return false;
     }
+    mPassTimer.record("RemoveArrayLengthMethod");
+
+    // The declarations left unreferenced by the optimizations are removed below.
+    if ((compileOptions & SH_OPTIMIZE_AST) != 0)
+    {
+        if (!OptimizeAST(this, root, &mSymbolTable, &mDiagnostics))
+        {
+            return false;
+        }
+        mPassTimer.record("OptimizeAST");
+    }
 
     if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
     {
         return false;
     }
+    mPassTimer.record("RemoveUnreferencedVariables");
 
     // In case the last case inside a switch statement is a certain type of no-op, GLSL compilers in
     // drivers may not accept it. In this case we clean up the dead code from the end of switch
@@ -827,6 +875,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mPassTimer.record("PruneEmptyCases");
 
     // Built-in function emulation needs to happen after validateLimitations pass.
     // TODO(jmadill): Remove global pool allocator.
@@ -834,6 +883,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     initBuiltInFunctionEmulator(&mBuiltInFunctionEmulator, compileOptions);
     GetGlobalPoolAllocator()->unlock();
     mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+    mPassTimer.record("markBuiltInFunctionsForEmulation");
 
     if ((compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS) != 0)
     {
@@ -842,6 +892,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("ScalarizeVecAndMatConstructorArgs");
     }
 
     if ((compileOptions & SH_FORCE_SHADER_PRECISION_HIGHP_TO_MEDIUMP) != 0)
@@ -850,6 +901,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("ForceShaderPrecisionToMediump");
     }
 
     if (shouldCollectVariables(compileOptions))
@@ -861,12 +913,14 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                          mExtensionBehavior, mResources, mTessControlShaderOutputVertices);
         collectInterfaceBlocks();
         mVariablesCollected = true;
+        mPassTimer.record("CollectVariables");
         if ((compileOptions & SH_USE_UNUSED_STANDARD_SHARED_BLOCKS) != 0)
         {
             if (!useAllMembersInUnusedStandardAndSharedBlocks(root))
             {
                 return false;
             }
+            mPassTimer.record("useAllMembersInUnusedStandardAndSharedBlocks");
         }
         if ((compileOptions & SH_ENFORCE_PACKING_RESTRICTIONS) != 0)
         {
@@ -890,6 +944,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            mPassTimer.record("initializeOutputVariables");
         }
     }
 
@@ -901,6 +956,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("RemoveInvariantDeclaration");
     }
 
     // gl_Position is always written in compatibility output mode.
@@ -914,6 +970,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("initializeGLPosition");
         mGLPositionInitialized = true;
     }
 
@@ -930,6 +987,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    mPassTimer.record("DeferGlobalInitializers");
 
     if (initializeLocalsAndGlobals)
     {
@@ -950,6 +1008,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            mPassTimer.record("SimplifyLoopConditions");
         }
 
         if (!InitializeUninitializedLocals(this, root, getShaderVersion(), canUseLoopsToInitialize,
@@ -957,6 +1016,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("InitializeUninitializedLocals");
     }
 
     if (getShaderType() == GL_VERTEX_SHADER && (compileOptions & SH_CLAMP_POINT_SIZE) != 0)
@@ -965,6 +1025,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("ClampPointSize");
     }
 
     if (getShaderType() == GL_FRAGMENT_SHADER && (compileOptions & SH_CLAMP_FRAG_DEPTH) != 0)
@@ -973,6 +1034,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("ClampFragDepth");
     }
 
     if ((compileOptions & SH_REWRITE_REPEATED_ASSIGN_TO_SWIZZLED) != 0)
@@ -981,6 +1043,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("RewriteRepeatedAssignToSwizzled");
     }
 
     if ((compileOptions & SH_REWRITE_VECTOR_SCALAR_ARITHMETIC) != 0)
@@ -989,6 +1052,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("VectorizeVectorScalarArithmetic");
     }
 
     if ((compileOptions & SH_REMOVE_DYNAMIC_INDEXING_OF_SWIZZLED_VECTOR) != 0)
@@ -997,6 +1061,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        mPassTimer.record("RemoveDynamicIndexingOfSwizzledVector");
     }
 
     mEarlyFragmentTestsOptimized = false;
@@ -1006,12 +1071,38 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             !isEarlyFragmentTestsSpecified())
         {
             mEarlyFragmentTestsOptimized = CheckEarlyFragmentTestsFeasible(this, root);
+            mPassTimer.record("CheckEarlyFragmentTestsFeasible");
         }
     }
 
     return true;
 }
 
+void TPassTimer::reset(bool enabled)
+{
+    mEnabled = enabled;
+    mPassTimes.clear();
+    mLastRecordTime = Clock::now();
+}
+
+void TPassTimer::recordPass(const char *passName)
+{
+    Clock::time_point now = Clock::now();
+    mPassTimes.emplace_back(passName, now - mLastRecordTime);
+    mLastRecordTime = now;
+}
+
+void TPassTimer::log(TInfoSinkBase &sink) const
+{
+    sink << "Pass timings:\n";
+    for (const auto &passTime : mPassTimes)
+    {
+        sink << "  " << passTime.first << ": "
+             << std::chrono::duration_cast<std::chrono::microseconds>(passTime.second).count()
+             << "us\n";
+    }
+}
+
 bool TCompiler::compile(const char *const shaderStrings[],
                         size_t numStrings,
                         ShCompileOptions compileOptionsIn)
@@ -1050,6 +1141,12 @@ bool TCompiler::compile(const char *const shaderStrings[],
             {
                 return false;
             }
+            mPassTimer.record("translate");
+        }
+
+        if ((compileOptions & SH_LOG_PASS_TIMINGS) != 0)
+        {
+            mPassTimer.log(mInfoSink.info);
         }
 
         if (mShaderType == GL_VERTEX_SHADER)
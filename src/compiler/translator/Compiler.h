@@ -16,6 +16,8 @@
 
 #include <GLSLANG/ShaderVars.h>
 
+#include <chrono>
+
 #include "common/PackedEnums.h"
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "compiler/translator/CallDAG.h"
@@ -54,6 +56,33 @@ bool RemoveInvariant(sh::GLenum shaderType,
                      ShShaderOutput outputType,
                      ShCompileOptions compileOptions);
 
+//
+// Measures where the time of a compile goes when SH_LOG_PASS_TIMINGS is set.  Each recorded pass
+// is attributed the time since the previous one was recorded.
+//
+class TPassTimer
+{
+  public:
+    void reset(bool enabled);
+    void record(const char *passName)
+    {
+        if (mEnabled)
+        {
+            recordPass(passName);
+        }
+    }
+    void log(TInfoSinkBase &sink) const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    void recordPass(const char *passName);
+
+    bool mEnabled = false;
+    Clock::time_point mLastRecordTime;
+    std::vector<std::pair<const char *, Clock::duration>> mPassTimes;
+};
+
 //
 // The base class used to back handles returned to the driver.
 //
@@ -334,6 +363,8 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     ShCompileOptions mCompileOptions;
+
+    TPassTimer mPassTimer;
 };
 
 //
@@ -1642,26 +1642,7 @@ bool OutputHLSL::visitBinary(Visit visit, TIntermBinary *node)
             }
             else
             {
-                outputTriplet(out, visit, "", "[", "]");
-                if (visit == PostVisit)
-                {
-                    const TInterfaceBlock *interfaceBlock =
-                        GetInterfaceBlockOfUniformBlockNearestIndexOperator(node->getLeft());
-                    if (interfaceBlock &&
-                        mUniformBlockOptimizedMap.count(interfaceBlock->uniqueId().get()) != 0)
-                    {
-                        // If the uniform block member's type is not structure, we had explicitly
-                        // packed the member into a structure, so need to add an operator of field
-                        // slection.
-                        const TField *field    = interfaceBlock->fields()[0];
-                        const TType *fieldType = field->type();
-                        if (fieldType->isMatrix() || fieldType->isVectorArray() ||
-                            fieldType->isScalarArray())
-                        {
-                            out << "." << Decorate(field->name());
-                        }
-                    }
-                }
+                outputArrayIndexing(out, visit, node);
             }
         }
         break;
@@ -1677,26 +1658,7 @@ bool OutputHLSL::visitBinary(Visit visit, TIntermBinary *node)
             }
             else
             {
-                outputTriplet(out, visit, "", "[", "]");
-                if (visit == PostVisit)
-                {
-                    const TInterfaceBlock *interfaceBlock =
-                        GetInterfaceBlockOfUniformBlockNearestIndexOperator(node->getLeft());
-                    if (interfaceBlock &&
-                        mUniformBlockOptimizedMap.count(interfaceBlock->uniqueId().get()) != 0)
-                    {
-                        // If the uniform block member's type is not structure, we had explicitly
-                        // packed the member into a structure, so need to add an operator of field
-                        // slection.
-                        const TField *field    = interfaceBlock->fields()[0];
-                        const TType *fieldType = field->type();
-                        if (fieldType->isMatrix() || fieldType->isVectorArray() ||
-                            fieldType->isScalarArray())
-                        {
-                            out << "." << Decorate(field->name());
-                        }
-                    }
-                }
+                outputArrayIndexing(out, visit, node);
             }
             break;
         }
@@ -3201,6 +3163,47 @@ void OutputHLSL::outputTriplet(TInfoSinkBase &out,
     }
 }
 
+void OutputHLSL::outputArrayIndexing(TInfoSinkBase &out, Visit visit, TIntermBinary *node)
+{
+    const TInterfaceBlock *interfaceBlock =
+        GetInterfaceBlockOfUniformBlockNearestIndexOperator(node->getLeft());
+    if (!interfaceBlock || mUniformBlockOptimizedMap.count(interfaceBlock->uniqueId().get()) == 0)
+    {
+        outputTriplet(out, visit, "", "[", "]");
+        return;
+    }
+
+    // If the uniform block member's type is not structure, we had explicitly packed the member
+    // into a structure, so need to add an operator of field slection. Matrices that std140 pads are
+    // stored padded, and truncated back to their own type by a cast.
+    const TField *field    = interfaceBlock->fields()[0];
+    const TType *fieldType = field->type();
+    const bool isPadded    = fieldType->isMatrix() && MatrixNeedsStd140Padding(*fieldType);
+    if (visit == PreVisit)
+    {
+        if (isPadded)
+        {
+            out << "((" << TypeString(*fieldType) << ")";
+        }
+    }
+    else if (visit == InVisit)
+    {
+        out << "[";
+    }
+    else if (visit == PostVisit)
+    {
+        out << "]";
+        if (fieldType->isMatrix() || fieldType->isVectorArray() || fieldType->isScalarArray())
+        {
+            out << "." << Decorate(field->name());
+        }
+        if (isPadded)
+        {
+            out << ")";
+        }
+    }
+}
+
 void OutputHLSL::outputLineDirective(TInfoSinkBase &out, int line)
 {
     if ((mCompileOptions & SH_LINE_DIRECTIVES) != 0 && line > 0)
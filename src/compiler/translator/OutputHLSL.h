@@ -117,6 +117,9 @@ class OutputHLSL : public TIntermTraverser
                        const char *preString,
                        const char *inString,
                        const char *postString);
+    // Emit the indexing of an array, which is a StructuredBuffer if it is the member of a uniform
+    // block that is translated to one.
+    void outputArrayIndexing(TInfoSinkBase &out, Visit visit, TIntermBinary *node);
     void outputLineDirective(TInfoSinkBase &out, int line);
     void writeParameter(const TVariable *param, TInfoSinkBase &out);
 
@@ -43,7 +43,9 @@ TOutputVulkanGLSL::TOutputVulkanGLSL(TInfoSinkBase &objSink,
       mNextUnusedInputLocation(0),
       mNextUnusedOutputLocation(0),
       mForceHighp(forceHighp),
-      mEnablePrecision(enablePrecision)
+      mEnablePrecision(enablePrecision),
+      mUsePushConstantsForDriverUniforms((compileOptions &
+                                          SH_USE_PUSH_CONSTANTS_FOR_DRIVER_UNIFORMS) != 0)
 {}
 
 void TOutputVulkanGLSL::writeLayoutQualifier(TIntermTyped *variable)
@@ -59,8 +61,13 @@ void TOutputVulkanGLSL::writeLayoutQualifier(TIntermTyped *variable)
                          type.getQualifier() == EvqFragmentOut || IsVarying(type.getQualifier());
     bool needsInputAttachmentIndex = IsSubpassInputType(type.getBasicType());
 
+    // Push constants don't take set & binding layout qualifiers.
+    bool isPushConstantBlock = mUsePushConstantsForDriverUniforms && type.isInterfaceBlock() &&
+                               type.getInterfaceBlock()->name() == vk::kDriverUniformsBlockName;
+    needsSetBinding          = needsSetBinding && !isPushConstantBlock;
+
     if (!NeedsToWriteLayoutQualifier(type) && !needsSetBinding && !needsLocation &&
-        !needsInputAttachmentIndex)
+        !needsInputAttachmentIndex && !isPushConstantBlock)
     {
         return;
     }
@@ -96,7 +103,9 @@ void TOutputVulkanGLSL::writeLayoutQualifier(TIntermTyped *variable)
             storage = EbsStd140;
         }
 
-        if (interfaceBlock->blockStorage() != EbsUnspecified)
+        // Push constant blocks default to std430, so std140 is specified for them to keep the
+        // layout that uniform blocks default to.
+        if (interfaceBlock->blockStorage() != EbsUnspecified || isPushConstantBlock)
         {
             blockStorage = getBlockStorageString(storage);
         }
@@ -126,6 +135,12 @@ void TOutputVulkanGLSL::writeLayoutQualifier(TIntermTyped *variable)
         separator = kCommaSeparator;
     }
 
+    if (isPushConstantBlock)
+    {
+        out << separator << "push_constant";
+        separator = kCommaSeparator;
+    }
+
     if (needsLocation)
     {
         const unsigned int locationCount = CalculateVaryingLocationCount(symbol, getShaderType());
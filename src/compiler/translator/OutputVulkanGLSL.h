@@ -65,6 +65,7 @@ class TOutputVulkanGLSL : public TOutputGLSL
   private:
     bool mForceHighp;
     bool mEnablePrecision;
+    bool mUsePushConstantsForDriverUniforms;
 };
 
 }  // namespace sh
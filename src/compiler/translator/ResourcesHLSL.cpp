@@ -839,6 +839,14 @@ TString ResourcesHLSL::uniformBlockWithOneLargeArrayMemberString(
     const TType &fieldType = *field.type();
     if (fieldType.isMatrix())
     {
+        if (MatrixNeedsStd140Padding(fieldType))
+        {
+            // Store the matrix padded as std140 lays it out. See OutputHLSL, which casts the
+            // elements back to the matrix type.
+            typeString = fieldType.getLayoutQualifier().matrixPacking == EmpRowMajor
+                             ? "column_major float4x" + str(fieldType.getRows())
+                             : "row_major float" + str(fieldType.getCols()) + "x4";
+        }
         if (arrayIndex == GL_INVALID_INDEX || arrayIndex == 0)
         {
             hlsl += "struct pack" + Decorate(interfaceBlock.name()) + " { " + typeString + " " +
@@ -51,6 +51,13 @@ class TranslatorVulkan : public TCompiler
     }
 
     // Generate SPIR-V out of intermediate GLSL through glslang.
+    //
+    // This round trip parses every shader a second time and builds a glslang AST that is only
+    // used to produce SPIR-V.  Generating SPIR-V directly from the AST (with the builders in
+    // common/spirv) would remove it, but needs a full code generator: type and constant
+    // deduplication, interface block layout decorations, precision decorations, and the mapping of
+    // every built-in function to SPIR-V instructions or GLSL.std.450.  Until such a generator can
+    // be validated against this path for all shaders, glslang remains the only SPIR-V backend.
     ANGLE_NO_DISCARD bool compileToSpirv(const TInfoSinkBase &glsl);
 };
 
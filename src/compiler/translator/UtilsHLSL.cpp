@@ -989,6 +989,13 @@ TString TypeString(const TType &type)
     return "<unknown type>";
 }
 
+bool MatrixNeedsStd140Padding(const TType &type)
+{
+    ASSERT(type.isMatrix());
+    const bool isRowMajor = type.getLayoutQualifier().matrixPacking == EmpRowMajor;
+    return isRowMajor ? type.getCols() != 4 : type.getRows() != 4;
+}
+
 TString StructNameString(const TStructure &structure)
 {
     if (structure.symbolType() == SymbolType::Empty)
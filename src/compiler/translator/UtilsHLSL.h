@@ -120,6 +120,9 @@ TString DecorateFunctionIfNeeded(const TFunction *func);
 TString DecorateField(const ImmutableString &string, const TStructure &structure);
 TString DecoratePrivate(const ImmutableString &privateText);
 TString TypeString(const TType &type);
+// Whether std140 pads the columns of a column-major matrix type, or the rows of a row-major one,
+// to a vec4, which tightly packed HLSL types such as StructuredBuffer elements don't do.
+bool MatrixNeedsStd140Padding(const TType &type);
 TString StructNameString(const TStructure &structure);
 TString QualifiedStructNameString(const TStructure &structure,
                                   bool useHLSLRowMajorPacking,
@@ -16,11 +16,11 @@ namespace sh
 {
 namespace
 {
-class Traverser : public TIntermTraverser
+class Traverser : public TIntermReadOnlyPass
 {
   public:
     Traverser(TDiagnostics *diagnostics)
-        : TIntermTraverser(true, false, true), mDiagnostics(diagnostics)
+        : TIntermReadOnlyPass(true, false, true), mDiagnostics(diagnostics)
     {}
 
     bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
@@ -80,7 +80,7 @@ class Traverser : public TIntermTraverser
         return true;
     }
 
-    bool valid() const { return mValid; }
+    bool finish() override { return mValid; }
 
   private:
     TDiagnostics *mDiagnostics = nullptr;
@@ -91,10 +91,9 @@ class Traverser : public TIntermTraverser
 };
 }  // anonymous namespace
 
-bool ValidateBarrierFunctionCall(TIntermBlock *root, TDiagnostics *diagnostics)
+std::unique_ptr<TIntermReadOnlyPass> CreateValidateBarrierFunctionCallPass(
+    TDiagnostics *diagnostics)
 {
-    Traverser traverser(diagnostics);
-    root->traverse(&traverser);
-    return traverser.valid();
+    return std::make_unique<Traverser>(diagnostics);
 }
 }  // namespace sh
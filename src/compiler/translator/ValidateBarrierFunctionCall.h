@@ -9,14 +9,15 @@
 #ifndef COMPILER_TRANSLATOR_VALIDATEBARRIERFUNCTIONCALL_H_
 #define COMPILER_TRANSLATOR_VALIDATEBARRIERFUNCTIONCALL_H_
 
-#include "common/angleutils.h"
+#include <memory>
 
 namespace sh
 {
 class TDiagnostics;
-class TIntermBlock;
+class TIntermReadOnlyPass;
 
-ANGLE_NO_DISCARD bool ValidateBarrierFunctionCall(TIntermBlock *root, TDiagnostics *diagnostics);
+std::unique_ptr<TIntermReadOnlyPass> CreateValidateBarrierFunctionCallPass(
+    TDiagnostics *diagnostics);
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_VALIDATEBARRIERFUNCTIONCALL_H_
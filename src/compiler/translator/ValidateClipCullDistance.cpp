@@ -25,11 +25,13 @@ void error(const TIntermSymbol &symbol, const char *reason, TDiagnostics *diagno
     diagnostics->error(symbol.getLine(), reason, symbol.getName().data());
 }
 
-class ValidateClipCullDistanceTraverser : public TIntermTraverser
+class ValidateClipCullDistanceTraverser : public TIntermReadOnlyPass
 {
   public:
-    ValidateClipCullDistanceTraverser();
+    ValidateClipCullDistanceTraverser(TDiagnostics *diagnostics,
+                                      unsigned int maxCombinedClipAndCullDistances);
     void validate(TDiagnostics *diagnostics, const unsigned int maxCombinedClipAndCullDistances);
+    bool finish() override;
 
   private:
     bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
@@ -43,16 +45,23 @@ class ValidateClipCullDistanceTraverser : public TIntermTraverser
 
     const TIntermSymbol *mClipDistance;
     const TIntermSymbol *mCullDistance;
+
+    TDiagnostics *mDiagnostics;
+    unsigned int mMaxCombinedClipAndCullDistances;
 };
 
-ValidateClipCullDistanceTraverser::ValidateClipCullDistanceTraverser()
-    : TIntermTraverser(true, false, false),
+ValidateClipCullDistanceTraverser::ValidateClipCullDistanceTraverser(
+    TDiagnostics *diagnostics,
+    unsigned int maxCombinedClipAndCullDistances)
+    : TIntermReadOnlyPass(true, false, false),
       mClipDistanceSize(0),
       mCullDistanceSize(0),
       mMaxClipDistanceIndex(0),
       mMaxCullDistanceIndex(0),
       mClipDistance(nullptr),
-      mCullDistance(nullptr)
+      mCullDistance(nullptr),
+      mDiagnostics(diagnostics),
+      mMaxCombinedClipAndCullDistances(maxCombinedClipAndCullDistances)
 {}
 
 bool ValidateClipCullDistanceTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
@@ -184,17 +193,21 @@ void ValidateClipCullDistanceTraverser::validate(TDiagnostics *diagnostics,
     }
 }
 
+bool ValidateClipCullDistanceTraverser::finish()
+{
+    int numErrorsBefore = mDiagnostics->numErrors();
+    validate(mDiagnostics, mMaxCombinedClipAndCullDistances);
+    return (mDiagnostics->numErrors() == numErrorsBefore);
+}
+
 }  // anonymous namespace
 
-bool ValidateClipCullDistance(TIntermBlock *root,
-                              TDiagnostics *diagnostics,
-                              const unsigned int maxCombinedClipAndCullDistances)
+std::unique_ptr<TIntermReadOnlyPass> CreateValidateClipCullDistancePass(
+    TDiagnostics *diagnostics,
+    const unsigned int maxCombinedClipAndCullDistances)
 {
-    ValidateClipCullDistanceTraverser varyingValidator;
-    root->traverse(&varyingValidator);
-    int numErrorsBefore = diagnostics->numErrors();
-    varyingValidator.validate(diagnostics, maxCombinedClipAndCullDistances);
-    return (diagnostics->numErrors() == numErrorsBefore);
+    return std::make_unique<ValidateClipCullDistanceTraverser>(diagnostics,
+                                                               maxCombinedClipAndCullDistances);
 }
 
 }  // namespace sh
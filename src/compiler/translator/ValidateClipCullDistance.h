@@ -10,17 +10,19 @@
 #ifndef COMPILER_TRANSLATOR_VALIDATECLIPCULLDISTANCE_H_
 #define COMPILER_TRANSLATOR_VALIDATECLIPCULLDISTANCE_H_
 
+#include <memory>
+
 #include "GLSLANG/ShaderVars.h"
 
 namespace sh
 {
 
-class TIntermBlock;
+class TIntermReadOnlyPass;
 class TDiagnostics;
 
-bool ValidateClipCullDistance(TIntermBlock *root,
-                              TDiagnostics *diagnostics,
-                              const unsigned int maxCombinedClipAndCullDistances);
+std::unique_ptr<TIntermReadOnlyPass> CreateValidateClipCullDistancePass(
+    TDiagnostics *diagnostics,
+    const unsigned int maxCombinedClipAndCullDistances);
 
 }  // namespace sh
 
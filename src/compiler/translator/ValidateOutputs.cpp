@@ -26,16 +26,20 @@ void error(const TIntermSymbol &symbol, const char *reason, TDiagnostics *diagno
     diagnostics->error(symbol.getLine(), reason, symbol.getName().data());
 }
 
-class ValidateOutputsTraverser : public TIntermTraverser
+class ValidateOutputsTraverser : public TIntermReadOnlyPass
 {
   public:
-    ValidateOutputsTraverser(const TExtensionBehavior &extBehavior, int maxDrawBuffers);
+    ValidateOutputsTraverser(const TExtensionBehavior &extBehavior,
+                             int maxDrawBuffers,
+                             TDiagnostics *diagnostics);
 
     void validate(TDiagnostics *diagnostics) const;
+    bool finish() override;
 
     void visitSymbol(TIntermSymbol *) override;
 
   private:
+    TDiagnostics *mDiagnostics;
     int mMaxDrawBuffers;
     bool mAllowUnspecifiedOutputLocationResolution;
     bool mUsesFragDepth;
@@ -48,8 +52,10 @@ class ValidateOutputsTraverser : public TIntermTraverser
 };
 
 ValidateOutputsTraverser::ValidateOutputsTraverser(const TExtensionBehavior &extBehavior,
-                                                   int maxDrawBuffers)
-    : TIntermTraverser(true, false, false),
+                                                   int maxDrawBuffers,
+                                                   TDiagnostics *diagnostics)
+    : TIntermReadOnlyPass(true, false, false),
+      mDiagnostics(diagnostics),
       mMaxDrawBuffers(maxDrawBuffers),
       mAllowUnspecifiedOutputLocationResolution(
           IsExtensionEnabled(extBehavior, TExtension::EXT_blend_func_extended)),
@@ -167,18 +173,21 @@ void ValidateOutputsTraverser::validate(TDiagnostics *diagnostics) const
     }
 }
 
+bool ValidateOutputsTraverser::finish()
+{
+    int numErrorsBefore = mDiagnostics->numErrors();
+    validate(mDiagnostics);
+    return (mDiagnostics->numErrors() == numErrorsBefore);
+}
+
 }  // anonymous namespace
 
-bool ValidateOutputs(TIntermBlock *root,
-                     const TExtensionBehavior &extBehavior,
-                     int maxDrawBuffers,
-                     TDiagnostics *diagnostics)
+std::unique_ptr<TIntermReadOnlyPass> CreateValidateOutputsPass(
+    const TExtensionBehavior &extBehavior,
+    int maxDrawBuffers,
+    TDiagnostics *diagnostics)
 {
-    ValidateOutputsTraverser validateOutputs(extBehavior, maxDrawBuffers);
-    root->traverse(&validateOutputs);
-    int numErrorsBefore = diagnostics->numErrors();
-    validateOutputs.validate(diagnostics);
-    return (diagnostics->numErrors() == numErrorsBefore);
+    return std::make_unique<ValidateOutputsTraverser>(extBehavior, maxDrawBuffers, diagnostics);
 }
 
 }  // namespace sh
@@ -11,19 +11,21 @@
 #ifndef COMPILER_TRANSLATOR_VALIDATEOUTPUTS_H_
 #define COMPILER_TRANSLATOR_VALIDATEOUTPUTS_H_
 
+#include <memory>
+
 #include "compiler/translator/ExtensionBehavior.h"
 
 namespace sh
 {
 
-class TIntermBlock;
+class TIntermReadOnlyPass;
 class TDiagnostics;
 
-// Returns true if the shader has no conflicting or otherwise erroneous fragment outputs.
-bool ValidateOutputs(TIntermBlock *root,
-                     const TExtensionBehavior &extBehavior,
-                     int maxDrawBuffers,
-                     TDiagnostics *diagnostics);
+// Returns a pass that fails if the shader has conflicting or otherwise erroneous fragment outputs.
+std::unique_ptr<TIntermReadOnlyPass> CreateValidateOutputsPass(
+    const TExtensionBehavior &extBehavior,
+    int maxDrawBuffers,
+    TDiagnostics *diagnostics);
 
 }  // namespace sh
 
@@ -274,11 +274,11 @@ void ValidateShaderInterfaceAndAssignLocations(TDiagnostics *diagnostics,
     }
 }
 
-class ValidateVaryingLocationsTraverser : public TIntermTraverser
+class ValidateVaryingLocationsTraverser : public TIntermReadOnlyPass
 {
   public:
-    ValidateVaryingLocationsTraverser(GLenum shaderType);
-    void validate(TDiagnostics *diagnostics);
+    ValidateVaryingLocationsTraverser(TDiagnostics *diagnostics, GLenum shaderType);
+    bool finish() override;
 
   private:
     bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
@@ -286,11 +286,13 @@ class ValidateVaryingLocationsTraverser : public TIntermTraverser
 
     VaryingVector mInputVaryingsWithLocation;
     VaryingVector mOutputVaryingsWithLocation;
+    TDiagnostics *mDiagnostics;
     GLenum mShaderType;
 };
 
-ValidateVaryingLocationsTraverser::ValidateVaryingLocationsTraverser(GLenum shaderType)
-    : TIntermTraverser(true, false, false), mShaderType(shaderType)
+ValidateVaryingLocationsTraverser::ValidateVaryingLocationsTraverser(TDiagnostics *diagnostics,
+                                                                     GLenum shaderType)
+    : TIntermReadOnlyPass(true, false, false), mDiagnostics(diagnostics), mShaderType(shaderType)
 {}
 
 bool ValidateVaryingLocationsTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
@@ -333,13 +335,16 @@ bool ValidateVaryingLocationsTraverser::visitFunctionDefinition(Visit visit,
     return false;
 }
 
-void ValidateVaryingLocationsTraverser::validate(TDiagnostics *diagnostics)
+bool ValidateVaryingLocationsTraverser::finish()
 {
-    ASSERT(diagnostics);
+    ASSERT(mDiagnostics);
 
-    ValidateShaderInterfaceAndAssignLocations(diagnostics, mInputVaryingsWithLocation, mShaderType);
-    ValidateShaderInterfaceAndAssignLocations(diagnostics, mOutputVaryingsWithLocation,
+    int numErrorsBefore = mDiagnostics->numErrors();
+    ValidateShaderInterfaceAndAssignLocations(mDiagnostics, mInputVaryingsWithLocation,
                                               mShaderType);
+    ValidateShaderInterfaceAndAssignLocations(mDiagnostics, mOutputVaryingsWithLocation,
+                                              mShaderType);
+    return (mDiagnostics->numErrors() == numErrorsBefore);
 }
 
 }  // anonymous namespace
@@ -358,13 +363,10 @@ unsigned int CalculateVaryingLocationCount(TIntermSymbol *varying, GLenum shader
     return GetLocationCount(varying, ignoreVaryingArraySize);
 }
 
-bool ValidateVaryingLocations(TIntermBlock *root, TDiagnostics *diagnostics, GLenum shaderType)
+std::unique_ptr<TIntermReadOnlyPass> CreateValidateVaryingLocationsPass(TDiagnostics *diagnostics,
+                                                                        GLenum shaderType)
 {
-    ValidateVaryingLocationsTraverser varyingValidator(shaderType);
-    root->traverse(&varyingValidator);
-    int numErrorsBefore = diagnostics->numErrors();
-    varyingValidator.validate(diagnostics);
-    return (diagnostics->numErrors() == numErrorsBefore);
+    return std::make_unique<ValidateVaryingLocationsTraverser>(diagnostics, shaderType);
 }
 
 }  // namespace sh
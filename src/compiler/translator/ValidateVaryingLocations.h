@@ -10,17 +10,20 @@
 #ifndef COMPILER_TRANSLATOR_VALIDATEVARYINGLOCATIONS_H_
 #define COMPILER_TRANSLATOR_VALIDATEVARYINGLOCATIONS_H_
 
+#include <memory>
+
 #include "GLSLANG/ShaderVars.h"
 
 namespace sh
 {
 
-class TIntermBlock;
+class TIntermReadOnlyPass;
 class TIntermSymbol;
 class TDiagnostics;
 
 unsigned int CalculateVaryingLocationCount(TIntermSymbol *varying, GLenum shaderType);
-bool ValidateVaryingLocations(TIntermBlock *root, TDiagnostics *diagnostics, GLenum shaderType);
+std::unique_ptr<TIntermReadOnlyPass> CreateValidateVaryingLocationsPass(TDiagnostics *diagnostics,
+                                                                        GLenum shaderType);
 
 }  // namespace sh
 
@@ -24,7 +24,8 @@ constexpr const ImmutableString kAngleFrlString("angle_frl");
 class RoundingHelperWriter : angle::NonCopyable
 {
   public:
-    static RoundingHelperWriter *createHelperWriter(const ShShaderOutput outputLanguage);
+    static RoundingHelperWriter *createHelperWriter(const ShShaderOutput outputLanguage,
+                                                    const int shaderVersion);
 
     void writeCommonRoundingHelpers(TInfoSinkBase &sink, const int shaderVersion);
     void writeCompoundAssignmentHelper(TInfoSinkBase &sink,
@@ -36,11 +37,17 @@ class RoundingHelperWriter : angle::NonCopyable
     virtual ~RoundingHelperWriter() {}
 
   protected:
-    RoundingHelperWriter(const ShShaderOutput outputLanguage) : mOutputLanguage(outputLanguage) {}
+    RoundingHelperWriter(const ShShaderOutput outputLanguage, const bool useBitOperations)
+        : mOutputLanguage(outputLanguage), mUseBitOperations(useBitOperations)
+    {}
     RoundingHelperWriter() = delete;
 
     const ShShaderOutput mOutputLanguage;
 
+    // Whether angle_frm can round by masking the bits of the floats, which is a lot cheaper than
+    // computing their exponents with log2 and exp2.
+    const bool mUseBitOperations;
+
   private:
     virtual std::string getTypeString(const char *glslType)                               = 0;
     virtual void writeFloatRoundingHelpers(TInfoSinkBase &sink)                           = 0;
@@ -54,8 +61,8 @@ class RoundingHelperWriter : angle::NonCopyable
 class RoundingHelperWriterGLSL : public RoundingHelperWriter
 {
   public:
-    RoundingHelperWriterGLSL(const ShShaderOutput outputLanguage)
-        : RoundingHelperWriter(outputLanguage)
+    RoundingHelperWriterGLSL(const ShShaderOutput outputLanguage, const bool useBitOperations)
+        : RoundingHelperWriter(outputLanguage, useBitOperations)
     {}
 
   private:
@@ -71,8 +78,8 @@ class RoundingHelperWriterGLSL : public RoundingHelperWriter
 class RoundingHelperWriterESSL : public RoundingHelperWriterGLSL
 {
   public:
-    RoundingHelperWriterESSL(const ShShaderOutput outputLanguage)
-        : RoundingHelperWriterGLSL(outputLanguage)
+    RoundingHelperWriterESSL(const ShShaderOutput outputLanguage, const bool useBitOperations)
+        : RoundingHelperWriterGLSL(outputLanguage, useBitOperations)
     {}
 
   private:
@@ -83,7 +90,7 @@ class RoundingHelperWriterHLSL : public RoundingHelperWriter
 {
   public:
     RoundingHelperWriterHLSL(const ShShaderOutput outputLanguage)
-        : RoundingHelperWriter(outputLanguage)
+        : RoundingHelperWriter(outputLanguage, true)
     {}
 
   private:
@@ -96,7 +103,8 @@ class RoundingHelperWriterHLSL : public RoundingHelperWriter
                                    const char *functionName) override;
 };
 
-RoundingHelperWriter *RoundingHelperWriter::createHelperWriter(const ShShaderOutput outputLanguage)
+RoundingHelperWriter *RoundingHelperWriter::createHelperWriter(const ShShaderOutput outputLanguage,
+                                                               const int shaderVersion)
 {
     ASSERT(EmulatePrecision::SupportedInLanguage(outputLanguage));
     switch (outputLanguage)
@@ -104,9 +112,15 @@ RoundingHelperWriter *RoundingHelperWriter::createHelperWriter(const ShShaderOut
         case SH_HLSL_4_1_OUTPUT:
             return new RoundingHelperWriterHLSL(outputLanguage);
         case SH_ESSL_OUTPUT:
-            return new RoundingHelperWriterESSL(outputLanguage);
+            // floatBitsToUint and uintBitsToFloat are available from ESSL 3.00.
+            return new RoundingHelperWriterESSL(outputLanguage, shaderVersion >= 300);
         default:
-            return new RoundingHelperWriterGLSL(outputLanguage);
+            // floatBitsToUint and uintBitsToFloat are available from GLSL 3.30.
+            return new RoundingHelperWriterGLSL(
+                outputLanguage, IsGLSL130OrNewer(outputLanguage) &&
+                                    outputLanguage != SH_GLSL_130_OUTPUT &&
+                                    outputLanguage != SH_GLSL_140_OUTPUT &&
+                                    outputLanguage != SH_GLSL_150_CORE_OUTPUT);
     }
 }
 
@@ -231,18 +245,42 @@ void RoundingHelperWriterGLSL::writeFloatRoundingHelpers(TInfoSinkBase &sink)
     //    numbers will be flushed to zero either way (2^-15 is the smallest
     //    normal positive number), this does not introduce any error.
 
+    // When the bits of floats are accessible, the same rounding towards zero is done by clearing
+    // the 13 mantissa bits that half floats don't have, and the numbers with an exponent below
+    // -15 (0x38000000 is the biased exponent 112 in place) are flushed to zero.
+
     std::string floatType = getTypeString("float");
 
+    if (mUseBitOperations)
+    {
+        std::string uintType = getTypeString("uint");
+
+        // clang-format off
+        sink <<
+            floatType << " angle_frm(in " << floatType << " x) {\n"
+            "    x = clamp(x, -65504.0, 65504.0);\n"
+            "    " << uintType << " bits = floatBitsToUint(x);\n"
+            "    bool isNonZero = ((bits & 0x7f800000u) >= 0x38000000u);\n"
+            "    return uintBitsToFloat(bits & 0xffffe000u) * float(isNonZero);\n"
+            "}\n";
+        // clang-format on
+    }
+    else
+    {
+        // clang-format off
+        sink <<
+            floatType << " angle_frm(in " << floatType << " x) {\n"
+            "    x = clamp(x, -65504.0, 65504.0);\n"
+            "    " << floatType << " exponent = floor(log2(abs(x) + 1e-30)) - 10.0;\n"
+            "    bool isNonZero = (exponent >= -25.0);\n"
+            "    x = x * exp2(-exponent);\n"
+            "    x = sign(x) * floor(abs(x));\n"
+            "    return x * exp2(exponent) * float(isNonZero);\n"
+            "}\n";
+        // clang-format on
+    }
+
     // clang-format off
-    sink <<
-        floatType << " angle_frm(in " << floatType << " x) {\n"
-        "    x = clamp(x, -65504.0, 65504.0);\n"
-        "    " << floatType << " exponent = floor(log2(abs(x) + 1e-30)) - 10.0;\n"
-        "    bool isNonZero = (exponent >= -25.0);\n"
-        "    x = x * exp2(-exponent);\n"
-        "    x = sign(x) * floor(abs(x));\n"
-        "    return x * exp2(exponent) * float(isNonZero);\n"
-        "}\n";
 
     sink <<
         floatType << " angle_frl(in " << floatType << " x) {\n"
@@ -261,16 +299,40 @@ void RoundingHelperWriterGLSL::writeVectorRoundingHelpers(TInfoSinkBase &sink,
     vecTypeStrStr << "vec" << size;
     std::string vecType = getTypeString(vecTypeStrStr.str().c_str());
 
+    if (mUseBitOperations)
+    {
+        std::stringstream uvecTypeStrStr = sh::InitializeStream<std::stringstream>();
+        uvecTypeStrStr << "uvec" << size;
+        std::string uvecType = getTypeString(uvecTypeStrStr.str().c_str());
+
+        // clang-format off
+        sink <<
+            vecType << " angle_frm(in " << vecType << " v) {\n"
+            "    v = clamp(v, -65504.0, 65504.0);\n"
+            "    " << uvecType << " bits = floatBitsToUint(v);\n"
+            "    bvec" << size << " isNonZero = greaterThanEqual(bits & 0x7f800000u,\n"
+            "                                     uvec" << size << "(0x38000000u));\n"
+            "    return uintBitsToFloat(bits & 0xffffe000u) * vec" << size << "(isNonZero);\n"
+            "}\n";
+        // clang-format on
+    }
+    else
+    {
+        // clang-format off
+        sink <<
+            vecType << " angle_frm(in " << vecType << " v) {\n"
+            "    v = clamp(v, -65504.0, 65504.0);\n"
+            "    " << vecType << " exponent = floor(log2(abs(v) + 1e-30)) - 10.0;\n"
+            "    bvec" << size << " isNonZero = "
+                "greaterThanEqual(exponent, vec" << size << "(-25.0));\n"
+            "    v = v * exp2(-exponent);\n"
+            "    v = sign(v) * floor(abs(v));\n"
+            "    return v * exp2(exponent) * vec" << size << "(isNonZero);\n"
+            "}\n";
+        // clang-format on
+    }
+
     // clang-format off
-    sink <<
-        vecType << " angle_frm(in " << vecType << " v) {\n"
-        "    v = clamp(v, -65504.0, 65504.0);\n"
-        "    " << vecType << " exponent = floor(log2(abs(v) + 1e-30)) - 10.0;\n"
-        "    bvec" << size << " isNonZero = greaterThanEqual(exponent, vec" << size << "(-25.0));\n"
-        "    v = v * exp2(-exponent);\n"
-        "    v = sign(v) * floor(abs(v));\n"
-        "    return v * exp2(exponent) * vec" << size << "(isNonZero);\n"
-        "}\n";
 
     sink <<
         vecType << " angle_frl(in " << vecType << " v) {\n"
@@ -383,15 +445,16 @@ void RoundingHelperWriterHLSL::writeVectorRoundingHelpers(TInfoSinkBase &sink,
     vecTypeStrStr << "float" << size;
     std::string vecType = vecTypeStrStr.str();
 
+    // Shader model 4 and newer can always access the bits of floats.
+    ASSERT(mUseBitOperations);
+
     // clang-format off
     sink <<
         vecType << " angle_frm(" << vecType << " v) {\n"
         "    v = clamp(v, -65504.0, 65504.0);\n"
-        "    " << vecType << " exponent = floor(log2(abs(v) + 1e-30)) - 10.0;\n"
-        "    bool" << size << " isNonZero = exponent < -25.0;\n"
-        "    v = v * exp2(-exponent);\n"
-        "    v = sign(v) * floor(abs(v));\n"
-        "    return v * exp2(exponent) * (float" << size << ")(isNonZero);\n"
+        "    uint" << size << " bits = asuint(v);\n"
+        "    bool" << size << " isNonZero = (bits & 0x7f800000u) >= 0x38000000u;\n"
+        "    return asfloat(bits & 0xffffe000u) * (float" << size << ")(isNonZero);\n"
         "}\n";
 
     sink <<
@@ -668,7 +731,7 @@ void EmulatePrecision::writeEmulationHelpers(TInfoSinkBase &sink,
                                              const ShShaderOutput outputLanguage)
 {
     std::unique_ptr<RoundingHelperWriter> roundingHelperWriter(
-        RoundingHelperWriter::createHelperWriter(outputLanguage));
+        RoundingHelperWriter::createHelperWriter(outputLanguage, shaderVersion));
 
     roundingHelperWriter->writeCommonRoundingHelpers(sink, shaderVersion);
 
@@ -0,0 +1,400 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeAST.cpp: Optional optimizations done on the AST before the backend output. Only
+// function-local variables are considered, since they can't be observed outside of the shader and
+// can only be written by the function that declares them.
+//
+
+#include "compiler/translator/tree_ops/OptimizeAST.h"
+
+#include <set>
+
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/tree_ops/FoldExpressions.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+
+// Bounds the time spent optimizing large shaders. Each iteration only starts if the previous one
+// changed the tree.
+constexpr int kMaxOptimizationIterations = 8;
+
+bool IsOptimizableLocal(const TIntermSymbol *symbol)
+{
+    return symbol->getQualifier() == EvqTemporary;
+}
+
+// Returns the local variable that an l-value of a statement-level store writes to, if writing to
+// it has no other effect.
+TIntermSymbol *GetStoredLocal(TIntermTyped *lvalue)
+{
+    if (lvalue->getAsSwizzleNode() != nullptr)
+    {
+        lvalue = lvalue->getAsSwizzleNode()->getOperand();
+    }
+    else if (lvalue->getAsBinaryNode() != nullptr &&
+             lvalue->getAsBinaryNode()->getOp() == EOpIndexDirect)
+    {
+        lvalue = lvalue->getAsBinaryNode()->getLeft();
+    }
+
+    TIntermSymbol *symbol = lvalue->getAsSymbolNode();
+    if (symbol == nullptr || !IsOptimizableLocal(symbol))
+    {
+        return nullptr;
+    }
+    return symbol;
+}
+
+bool IsDeclarationWithoutSideEffects(TIntermNode *node)
+{
+    TIntermDeclaration *declaration = node->getAsDeclarationNode();
+    if (declaration == nullptr)
+    {
+        return false;
+    }
+
+    for (TIntermNode *declarator : *declaration->getSequence())
+    {
+        TIntermBinary *initNode = declarator->getAsBinaryNode();
+        if (initNode != nullptr && initNode->getRight()->hasSideEffects())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Counts how each function-local variable is used.
+class CollectLocalUsageTraverser : public TLValueTrackingTraverser
+{
+  public:
+    struct LocalUsage
+    {
+        unsigned int readCount             = 0;
+        unsigned int otherWriteCount       = 0;
+        const TConstantUnion *initialValue = nullptr;
+        // Statement-level stores that could be removed if the variable is never read.
+        std::vector<TIntermOperator *> stores;
+    };
+    using LocalUsageMap = angle::HashMap<const TVariable *, LocalUsage>;
+
+    CollectLocalUsageTraverser(TSymbolTable *symbolTable)
+        : TLValueTrackingTraverser(true, false, false, symbolTable)
+    {}
+
+    const LocalUsageMap &getUsage() const { return mUsage; }
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        // Declarators without an initializer neither read nor write the variable.
+        if (!IsOptimizableLocal(node) || getParentNode()->getAsDeclarationNode() != nullptr)
+        {
+            return;
+        }
+
+        LocalUsage &usage = mUsage[&node->variable()];
+        if (isLValueRequiredHere())
+        {
+            ++usage.otherWriteCount;
+        }
+        else
+        {
+            ++usage.readCount;
+        }
+    }
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        if (node->getOp() == EOpInitialize)
+        {
+            TIntermSymbol *symbol = node->getLeft()->getAsSymbolNode();
+            ASSERT(symbol);
+            TIntermConstantUnion *initializer = node->getRight()->getAsConstantUnion();
+            const TType &type                 = symbol->getType();
+            if (IsOptimizableLocal(symbol) && initializer != nullptr && !type.isArray() &&
+                type.getStruct() == nullptr)
+            {
+                mUsage[&symbol->variable()].initialValue = initializer->getConstantValue();
+            }
+
+            // The declared variable is neither read nor written by its own initialization.
+            node->getRight()->traverse(this);
+            return false;
+        }
+
+        if (node->isAssignment() && isStatement() && !node->getRight()->hasSideEffects())
+        {
+            TIntermSymbol *symbol = GetStoredLocal(node->getLeft());
+            if (symbol != nullptr)
+            {
+                mUsage[&symbol->variable()].stores.push_back(node);
+                node->getRight()->traverse(this);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        if (node->isAssignment() && isStatement())
+        {
+            TIntermSymbol *symbol = GetStoredLocal(node->getOperand());
+            if (symbol != nullptr)
+            {
+                mUsage[&symbol->variable()].stores.push_back(node);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+  private:
+    bool isStatement() { return getParentNode()->getAsBlock() != nullptr; }
+
+    LocalUsageMap mUsage;
+};
+
+// Replaces the reads of the given variables with their constant initial values.
+class PropagateConstantLocalsTraverser : public TIntermTraverser
+{
+  public:
+    PropagateConstantLocalsTraverser(
+        const CollectLocalUsageTraverser::LocalUsageMap &constantLocals)
+        : TIntermTraverser(true, false, false), mConstantLocals(constantLocals)
+    {}
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        auto iter = mConstantLocals.find(&node->variable());
+        if (iter == mConstantLocals.end())
+        {
+            return;
+        }
+
+        TIntermBinary *parentBinary = getParentNode()->getAsBinaryNode();
+        if (parentBinary != nullptr && parentBinary->getOp() == EOpInitialize &&
+            parentBinary->getLeft() == node)
+        {
+            return;
+        }
+
+        // Keep the precision of the variable, so the constant is recorded with it in the output if
+        // needed.
+        TType constantType(node->getType());
+        constantType.setQualifier(EvqConst);
+        queueReplacement(new TIntermConstantUnion(iter->second.initialValue, constantType),
+                         OriginalNode::IS_DROPPED);
+    }
+
+  private:
+    const CollectLocalUsageTraverser::LocalUsageMap &mConstantLocals;
+};
+
+// Removes the given statement-level stores.
+class RemoveDeadStoresTraverser : public TIntermTraverser
+{
+  public:
+    RemoveDeadStoresTraverser(const std::set<TIntermOperator *> &deadStores)
+        : TIntermTraverser(true, false, false), mDeadStores(deadStores)
+    {}
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override { return visitStore(node); }
+    bool visitUnary(Visit visit, TIntermUnary *node) override { return visitStore(node); }
+
+  private:
+    bool visitStore(TIntermOperator *node)
+    {
+        if (mDeadStores.count(node) == 0)
+        {
+            return true;
+        }
+
+        TIntermBlock *parentBlock = getParentNode()->getAsBlock();
+        ASSERT(parentBlock);
+        mMultiReplacements.emplace_back(parentBlock, node, TIntermSequence());
+        return false;
+    }
+
+    const std::set<TIntermOperator *> &mDeadStores;
+};
+
+// Prunes code that can't be reached.
+class PruneDeadCodeTraverser : public TIntermTraverser
+{
+  public:
+    PruneDeadCodeTraverser() : TIntermTraverser(true, false, false), mDidPrune(false) {}
+
+    bool didPrune() const { return mDidPrune; }
+
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override
+    {
+        TIntermConstantUnion *condition = node->getCondition()->getAsConstantUnion();
+        if (condition == nullptr)
+        {
+            return true;
+        }
+
+        // The taken branch is kept as a nested block, so its declarations stay in their own scope.
+        TIntermBlock *takenBlock =
+            condition->getBConst(0) ? node->getTrueBlock() : node->getFalseBlock();
+        if (takenBlock != nullptr)
+        {
+            queueReplacement(takenBlock, OriginalNode::IS_DROPPED);
+        }
+        else
+        {
+            removeStatement(node);
+        }
+        mDidPrune = true;
+        return false;
+    }
+
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        // The body of a do-while loop runs once even if the condition is false, and may contain
+        // break or continue statements, so it can't be simply unwrapped.
+        TIntermConstantUnion *condition =
+            node->getCondition() != nullptr ? node->getCondition()->getAsConstantUnion() : nullptr;
+        if (node->getType() == ELoopDoWhile || condition == nullptr || condition->getBConst(0))
+        {
+            return true;
+        }
+
+        if (node->getInit() != nullptr && !IsDeclarationWithoutSideEffects(node->getInit()))
+        {
+            return true;
+        }
+
+        removeStatement(node);
+        mDidPrune = true;
+        return false;
+    }
+
+    bool visitBlock(Visit visit, TIntermBlock *node) override
+    {
+        // The pruned statements are not traversed, so that nothing else is queued for them.  Their
+        // surviving siblings are handled in the next iteration.
+        bool isUnreachable = false;
+        bool didPrune      = false;
+        for (TIntermNode *statement : *node->getSequence())
+        {
+            if (statement->getAsCaseNode() != nullptr)
+            {
+                isUnreachable = false;
+            }
+            else if (statement->getAsConstantUnion() != nullptr ||
+                     (isUnreachable && statement->getAsDeclarationNode() == nullptr))
+            {
+                // Declarations are kept, since a later case of a switch statement may use them.
+                removeStatement(node, statement);
+                didPrune = true;
+            }
+            else if (statement->getAsBranchNode() != nullptr)
+            {
+                isUnreachable = true;
+            }
+        }
+        mDidPrune = mDidPrune || didPrune;
+        return !didPrune;
+    }
+
+  private:
+    void removeStatement(TIntermNode *statement)
+    {
+        TIntermBlock *parentBlock = getParentNode()->getAsBlock();
+        ASSERT(parentBlock);
+        removeStatement(parentBlock, statement);
+    }
+    void removeStatement(TIntermBlock *parentBlock, TIntermNode *statement)
+    {
+        mMultiReplacements.emplace_back(parentBlock, statement, TIntermSequence());
+    }
+
+    bool mDidPrune;
+};
+
+}  // anonymous namespace
+
+bool OptimizeAST(TCompiler *compiler,
+                 TIntermBlock *root,
+                 TSymbolTable *symbolTable,
+                 TDiagnostics *diagnostics)
+{
+    for (int iteration = 0; iteration < kMaxOptimizationIterations; ++iteration)
+    {
+        CollectLocalUsageTraverser collectUsage(symbolTable);
+        root->traverse(&collectUsage);
+
+        CollectLocalUsageTraverser::LocalUsageMap constantLocals;
+        std::set<TIntermOperator *> deadStores;
+        for (const auto &localUsage : collectUsage.getUsage())
+        {
+            const CollectLocalUsageTraverser::LocalUsage &usage = localUsage.second;
+            if (usage.otherWriteCount > 0)
+            {
+                continue;
+            }
+            if (usage.initialValue != nullptr && usage.stores.empty() && usage.readCount > 0)
+            {
+                constantLocals.insert(localUsage);
+            }
+            else if (usage.readCount == 0)
+            {
+                deadStores.insert(usage.stores.begin(), usage.stores.end());
+            }
+        }
+
+        bool didChange = false;
+
+        if (!constantLocals.empty())
+        {
+            PropagateConstantLocalsTraverser propagate(constantLocals);
+            root->traverse(&propagate);
+            if (!propagate.updateTree(compiler, root) ||
+                !FoldExpressions(compiler, root, diagnostics))
+            {
+                return false;
+            }
+            didChange = true;
+        }
+
+        if (!deadStores.empty())
+        {
+            RemoveDeadStoresTraverser removeDeadStores(deadStores);
+            root->traverse(&removeDeadStores);
+            if (!removeDeadStores.updateTree(compiler, root))
+            {
+                return false;
+            }
+            didChange = true;
+        }
+
+        PruneDeadCodeTraverser pruneDeadCode;
+        root->traverse(&pruneDeadCode);
+        if (!pruneDeadCode.updateTree(compiler, root))
+        {
+            return false;
+        }
+        didChange = didChange || pruneDeadCode.didPrune();
+
+        if (!didChange)
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+}  // namespace sh
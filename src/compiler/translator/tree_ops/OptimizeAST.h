@@ -0,0 +1,38 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeAST.h: Optional optimizations done on the AST before the backend output, for drivers
+// that take the generated shader mostly as written. Repeats the following until none applies:
+//   1. Replaces reads of function-local variables that are initialized with a constant and never
+//      written to with the constant, and folds the resulting constant expressions.
+//   2. Prunes if statements with a constant condition, loops whose condition is constant false and
+//      statements that follow a branch, up to the next case label.
+//   3. Removes statement-level stores without side effects to function-local variables that are
+//      never read.
+// The declarations left unreferenced are removed by RemoveUnreferencedVariables, which must be run
+// after this.
+//
+
+#ifndef COMPILER_TRANSLATOR_TREEOPS_OPTIMIZEAST_H_
+#define COMPILER_TRANSLATOR_TREEOPS_OPTIMIZEAST_H_
+
+#include "common/angleutils.h"
+
+namespace sh
+{
+
+class TCompiler;
+class TDiagnostics;
+class TIntermBlock;
+class TSymbolTable;
+
+ANGLE_NO_DISCARD bool OptimizeAST(TCompiler *compiler,
+                                  TIntermBlock *root,
+                                  TSymbolTable *symbolTable,
+                                  TDiagnostics *diagnostics);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEOPS_OPTIMIZEAST_H_
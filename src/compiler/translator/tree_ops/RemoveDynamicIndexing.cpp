@@ -115,49 +115,78 @@ const TType *GetBaseType(const TType &type, bool write)
     return baseType;
 }
 
+// Append the statements that read or write base[index] to block, with index clamped to
+// [first, last].  The field is selected by binary search, so a vector or matrix of n fields needs
+// log2(n) comparisons.
+void AppendIndexSelection(TIntermBlock *block,
+                          int first,
+                          int last,
+                          bool write,
+                          TIntermSymbol *baseParam,
+                          TIntermSymbol *indexParam,
+                          TIntermSymbol *valueParam)
+{
+    if (first == last)
+    {
+        TIntermBinary *indexNode =
+            new TIntermBinary(EOpIndexDirect, baseParam->deepCopy(), CreateIndexNode(first));
+        if (write)
+        {
+            block->appendStatement(new TIntermBinary(EOpAssign, indexNode, valueParam->deepCopy()));
+            block->appendStatement(new TIntermBranch(EOpReturn, nullptr));
+        }
+        else
+        {
+            block->appendStatement(new TIntermBranch(EOpReturn, indexNode));
+        }
+        return;
+    }
+
+    const int middle = (first + last + 1) / 2;
+
+    TIntermBlock *lowerBlock = new TIntermBlock();
+    AppendIndexSelection(lowerBlock, first, middle - 1, write, baseParam, indexParam, valueParam);
+
+    TIntermBinary *cond =
+        new TIntermBinary(EOpLessThan, indexParam->deepCopy(), CreateIntConstantNode(middle));
+    block->appendStatement(new TIntermIfElse(cond, lowerBlock, nullptr));
+
+    AppendIndexSelection(block, middle, last, write, baseParam, indexParam, valueParam);
+}
+
 // Generate a read or write function for one field in a vector/matrix.
 // Out-of-range indices are clamped. This is consistent with how ANGLE handles out-of-range
 // indices in other places.
 // Note that indices can be either int or uint. We create only int versions of the functions,
 // and convert uint indices to int at the call site.
+// The field is found by binary search instead of a switch over all fields, which keeps both the
+// generated code and the number of comparisons at run time small.
 // read function example:
-// float dyn_index_vec2(in vec2 base, in int index)
+// float dyn_index_vec4(in vec4 base, in int index)
 // {
-//    switch(index)
+//    if (index < 2)
 //    {
-//      case (0):
+//      if (index < 1)
 //        return base[0];
-//      case (1):
-//        return base[1];
-//      default:
-//        break;
+//      return base[1];
 //    }
-//    if (index < 0)
-//      return base[0];
-//    return base[1];
+//    if (index < 3)
+//      return base[2];
+//    return base[3];
 // }
 // write function example:
 // void dyn_index_write_vec2(inout vec2 base, in int index, in float value)
 // {
-//    switch(index)
-//    {
-//      case (0):
-//        base[0] = value;
-//        return;
-//      case (1):
-//        base[1] = value;
-//        return;
-//      default:
-//        break;
-//    }
-//    if (index < 0)
+//    if (index < 1)
 //    {
 //      base[0] = value;
 //      return;
 //    }
 //    base[1] = value;
+//    return;
 // }
-// Note that else is not used in above functions to avoid the RewriteElseBlocks transformation.
+// Note that else is not used in above functions to avoid the RewriteElseBlocks transformation,
+// and neither is the ternary operator, which the HLSL output doesn't support.
 TIntermFunctionDefinition *GetIndexFunctionDefinition(const TType &type,
                                                       bool write,
                                                       const TFunction &func,
@@ -165,17 +194,16 @@ TIntermFunctionDefinition *GetIndexFunctionDefinition(const TType &type,
 {
     ASSERT(!type.isArray());
 
-    int numCases = 0;
+    int numFields = 0;
     if (type.isMatrix())
     {
-        numCases = type.getCols();
+        numFields = type.getCols();
     }
     else
     {
-        numCases = type.getNominalSize();
+        numFields = type.getNominalSize();
     }
 
-    std::string functionName                = GetIndexFunctionName(type, write);
     TIntermFunctionPrototype *prototypeNode = CreateInternalFunctionPrototypeNode(func);
 
     TIntermSymbol *baseParam  = new TIntermSymbol(func.getParam(0));
@@ -186,74 +214,8 @@ TIntermFunctionDefinition *GetIndexFunctionDefinition(const TType &type,
         valueParam = new TIntermSymbol(func.getParam(2));
     }
 
-    TIntermBlock *statementList = new TIntermBlock();
-    for (int i = 0; i < numCases; ++i)
-    {
-        TIntermCase *caseNode = new TIntermCase(CreateIntConstantNode(i));
-        statementList->getSequence()->push_back(caseNode);
-
-        TIntermBinary *indexNode =
-            new TIntermBinary(EOpIndexDirect, baseParam->deepCopy(), CreateIndexNode(i));
-        if (write)
-        {
-            TIntermBinary *assignNode =
-                new TIntermBinary(EOpAssign, indexNode, valueParam->deepCopy());
-            statementList->getSequence()->push_back(assignNode);
-            TIntermBranch *returnNode = new TIntermBranch(EOpReturn, nullptr);
-            statementList->getSequence()->push_back(returnNode);
-        }
-        else
-        {
-            TIntermBranch *returnNode = new TIntermBranch(EOpReturn, indexNode);
-            statementList->getSequence()->push_back(returnNode);
-        }
-    }
-
-    // Default case
-    TIntermCase *defaultNode = new TIntermCase(nullptr);
-    statementList->getSequence()->push_back(defaultNode);
-    TIntermBranch *breakNode = new TIntermBranch(EOpBreak, nullptr);
-    statementList->getSequence()->push_back(breakNode);
-
-    TIntermSwitch *switchNode = new TIntermSwitch(indexParam->deepCopy(), statementList);
-
     TIntermBlock *bodyNode = new TIntermBlock();
-    bodyNode->getSequence()->push_back(switchNode);
-
-    TIntermBinary *cond =
-        new TIntermBinary(EOpLessThan, indexParam->deepCopy(), CreateIntConstantNode(0));
-
-    // Two blocks: one accesses (either reads or writes) the first element and returns,
-    // the other accesses the last element.
-    TIntermBlock *useFirstBlock = new TIntermBlock();
-    TIntermBlock *useLastBlock  = new TIntermBlock();
-    TIntermBinary *indexFirstNode =
-        new TIntermBinary(EOpIndexDirect, baseParam->deepCopy(), CreateIndexNode(0));
-    TIntermBinary *indexLastNode =
-        new TIntermBinary(EOpIndexDirect, baseParam->deepCopy(), CreateIndexNode(numCases - 1));
-    if (write)
-    {
-        TIntermBinary *assignFirstNode =
-            new TIntermBinary(EOpAssign, indexFirstNode, valueParam->deepCopy());
-        useFirstBlock->getSequence()->push_back(assignFirstNode);
-        TIntermBranch *returnNode = new TIntermBranch(EOpReturn, nullptr);
-        useFirstBlock->getSequence()->push_back(returnNode);
-
-        TIntermBinary *assignLastNode =
-            new TIntermBinary(EOpAssign, indexLastNode, valueParam->deepCopy());
-        useLastBlock->getSequence()->push_back(assignLastNode);
-    }
-    else
-    {
-        TIntermBranch *returnFirstNode = new TIntermBranch(EOpReturn, indexFirstNode);
-        useFirstBlock->getSequence()->push_back(returnFirstNode);
-
-        TIntermBranch *returnLastNode = new TIntermBranch(EOpReturn, indexLastNode);
-        useLastBlock->getSequence()->push_back(returnLastNode);
-    }
-    TIntermIfElse *ifNode = new TIntermIfElse(cond, useFirstBlock, nullptr);
-    bodyNode->getSequence()->push_back(ifNode);
-    bodyNode->getSequence()->push_back(useLastBlock);
+    AppendIndexSelection(bodyNode, 0, numFields - 1, write, baseParam, indexParam, valueParam);
 
     TIntermFunctionDefinition *indexingFunction =
         new TIntermFunctionDefinition(prototypeNode, bodyNode);
@@ -91,16 +91,10 @@ static bool IsSupportedTypeForStructuredBuffer(const TType &type)
         }
         return false;
     }
-    else if (type.isMatrix())
-    {
-        // Only supports the matrix types that we do not need to pad in a structure or an array
-        // explicitly.
-        return (matrixPacking != EmpRowMajor && type.getRows() == 4) ||
-               (matrixPacking == EmpRowMajor && type.getCols() == 4);
-    }
     else
     {
-        // Supports vector and scalar types in a structure or an array.
+        // Supports matrix, vector and scalar types in an array. The matrix types that std140 pads
+        // are padded explicitly.
         return true;
     }
 }
@@ -641,4 +641,240 @@ void TIntermTraverser::traverseLoop(TIntermLoop *node)
 {
     traverse(node);
 }
+
+// Dispatches the visits of a traversal to several read-only passes.  The passes are visited in
+// order, and a pass that returns false from a visit function is left out until the traversal is
+// done with that node.
+class TIntermFusedTraverser : public TIntermTraverser
+{
+  public:
+    TIntermFusedTraverser(const TIntermReadOnlyPassList &passes);
+
+    void visitSymbol(TIntermSymbol *node) override;
+    void visitConstantUnion(TIntermConstantUnion *node) override;
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override;
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+    bool visitUnary(Visit visit, TIntermUnary *node) override;
+    bool visitTernary(Visit visit, TIntermTernary *node) override;
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override;
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override;
+    bool visitCase(Visit visit, TIntermCase *node) override;
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override;
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override;
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override;
+    bool visitBlock(Visit visit, TIntermBlock *node) override;
+    bool visitGlobalQualifierDeclaration(Visit visit,
+                                         TIntermGlobalQualifierDeclaration *node) override;
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
+    bool visitLoop(Visit visit, TIntermLoop *node) override;
+    bool visitBranch(Visit visit, TIntermBranch *node) override;
+    void visitPreprocessorDirective(TIntermPreprocessorDirective *node) override;
+
+  private:
+    struct FusedPass
+    {
+        TIntermReadOnlyPass *pass;
+        // The node the pass has stopped visiting, if any.  The fused traverser always post-visits,
+        // so it knows when the traversal leaves that node.
+        TIntermNode *skippedNode;
+    };
+
+    static bool AnyInVisit(const TIntermReadOnlyPassList &passes);
+
+    template <typename NodeT>
+    bool visitNode(Visit visit, NodeT *node, bool (TIntermTraverser::*visitFunc)(Visit, NodeT *));
+    template <typename NodeT>
+    void visitLeaf(NodeT *node, void (TIntermTraverser::*visitFunc)(NodeT *));
+
+    std::vector<FusedPass> mPasses;
+};
+
+TIntermFusedTraverser::TIntermFusedTraverser(const TIntermReadOnlyPassList &passes)
+    : TIntermTraverser(true, AnyInVisit(passes), true)
+{
+    for (const std::unique_ptr<TIntermReadOnlyPass> &pass : passes)
+    {
+        mPasses.push_back({pass.get(), nullptr});
+    }
+}
+
+// static
+bool TIntermFusedTraverser::AnyInVisit(const TIntermReadOnlyPassList &passes)
+{
+    for (const std::unique_ptr<TIntermReadOnlyPass> &pass : passes)
+    {
+        if (pass->inVisit)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename NodeT>
+bool TIntermFusedTraverser::visitNode(Visit visit,
+                                      NodeT *node,
+                                      bool (TIntermTraverser::*visitFunc)(Visit, NodeT *))
+{
+    bool anyVisiting = false;
+    for (FusedPass &fused : mPasses)
+    {
+        if (fused.skippedNode == nullptr)
+        {
+            TIntermReadOnlyPass *pass = fused.pass;
+            const bool visitsThis     = (visit == PreVisit && pass->preVisit) ||
+                                        (visit == InVisit && pass->inVisit) ||
+                                        (visit == PostVisit && pass->postVisit);
+            if (visitsThis && !(pass->*visitFunc)(visit, node) && visit != PostVisit)
+            {
+                fused.skippedNode = node;
+            }
+        }
+        else if (visit == PostVisit && fused.skippedNode == node)
+        {
+            fused.skippedNode = nullptr;
+        }
+
+        anyVisiting = anyVisiting || fused.skippedNode == nullptr;
+    }
+
+    if (anyVisiting || visit == PostVisit)
+    {
+        return true;
+    }
+
+    // None of the passes want to see the rest of this node, so skip it.  It won't be post-visited,
+    // so resume the passes that stopped at it here.
+    for (FusedPass &fused : mPasses)
+    {
+        if (fused.skippedNode == node)
+        {
+            fused.skippedNode = nullptr;
+        }
+    }
+    return false;
+}
+
+template <typename NodeT>
+void TIntermFusedTraverser::visitLeaf(NodeT *node, void (TIntermTraverser::*visitFunc)(NodeT *))
+{
+    for (FusedPass &fused : mPasses)
+    {
+        if (fused.skippedNode == nullptr)
+        {
+            (fused.pass->*visitFunc)(node);
+        }
+    }
+}
+
+void TIntermFusedTraverser::visitSymbol(TIntermSymbol *node)
+{
+    visitLeaf(node, &TIntermTraverser::visitSymbol);
+}
+
+void TIntermFusedTraverser::visitConstantUnion(TIntermConstantUnion *node)
+{
+    visitLeaf(node, &TIntermTraverser::visitConstantUnion);
+}
+
+bool TIntermFusedTraverser::visitSwizzle(Visit visit, TIntermSwizzle *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitSwizzle);
+}
+
+bool TIntermFusedTraverser::visitBinary(Visit visit, TIntermBinary *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitBinary);
+}
+
+bool TIntermFusedTraverser::visitUnary(Visit visit, TIntermUnary *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitUnary);
+}
+
+bool TIntermFusedTraverser::visitTernary(Visit visit, TIntermTernary *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitTernary);
+}
+
+bool TIntermFusedTraverser::visitIfElse(Visit visit, TIntermIfElse *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitIfElse);
+}
+
+bool TIntermFusedTraverser::visitSwitch(Visit visit, TIntermSwitch *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitSwitch);
+}
+
+bool TIntermFusedTraverser::visitCase(Visit visit, TIntermCase *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitCase);
+}
+
+void TIntermFusedTraverser::visitFunctionPrototype(TIntermFunctionPrototype *node)
+{
+    visitLeaf(node, &TIntermTraverser::visitFunctionPrototype);
+}
+
+bool TIntermFusedTraverser::visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitFunctionDefinition);
+}
+
+bool TIntermFusedTraverser::visitAggregate(Visit visit, TIntermAggregate *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitAggregate);
+}
+
+bool TIntermFusedTraverser::visitBlock(Visit visit, TIntermBlock *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitBlock);
+}
+
+bool TIntermFusedTraverser::visitGlobalQualifierDeclaration(Visit visit,
+                                                            TIntermGlobalQualifierDeclaration *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitGlobalQualifierDeclaration);
+}
+
+bool TIntermFusedTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitDeclaration);
+}
+
+bool TIntermFusedTraverser::visitLoop(Visit visit, TIntermLoop *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitLoop);
+}
+
+bool TIntermFusedTraverser::visitBranch(Visit visit, TIntermBranch *node)
+{
+    return visitNode(visit, node, &TIntermTraverser::visitBranch);
+}
+
+void TIntermFusedTraverser::visitPreprocessorDirective(TIntermPreprocessorDirective *node)
+{
+    visitLeaf(node, &TIntermTraverser::visitPreprocessorDirective);
+}
+
+bool RunReadOnlyPasses(TIntermNode *root, const TIntermReadOnlyPassList &passes)
+{
+    if (passes.size() == 1)
+    {
+        root->traverse(passes.front().get());
+    }
+    else if (passes.size() > 1)
+    {
+        TIntermFusedTraverser fusedTraverser(passes);
+        root->traverse(&fusedTraverser);
+    }
+
+    bool success = true;
+    for (const std::unique_ptr<TIntermReadOnlyPass> &pass : passes)
+    {
+        success = pass->finish() && success;
+    }
+    return success;
+}
 }  // namespace sh
@@ -9,6 +9,8 @@
 #ifndef COMPILER_TRANSLATOR_TREEUTIL_INTERMTRAVERSE_H_
 #define COMPILER_TRANSLATOR_TREEUTIL_INTERMTRAVERSE_H_
 
+#include <memory>
+
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/tree_util/Visit.h"
 
@@ -331,6 +333,39 @@ class TLValueTrackingTraverser : public TIntermTraverser
     bool mInFunctionCallOutParameter;
 };
 
+// Base class of passes that only gather information from the tree and act on it once the traversal
+// is over, such as validation passes.  Such passes don't depend on each other's results, so
+// RunReadOnlyPasses() can run several of them in a single traversal of the tree.  To be fused that
+// way, a pass must not:
+//
+// - modify the tree, or queue replacements and insertions,
+// - use the traversal state of TIntermTraverser such as the path, the parent blocks or the scope,
+//   which is only tracked by the traverser that fuses the passes,
+// - override the traverse*() functions.
+//
+// Returning false from a visit function only skips the rest of that node for the pass that returned
+// it, like it would when the pass is run on its own.
+class TIntermReadOnlyPass : public TIntermTraverser
+{
+  public:
+    TIntermReadOnlyPass(bool preVisit, bool inVisit, bool postVisit)
+        : TIntermTraverser(preVisit, inVisit, postVisit)
+    {}
+
+    // Called once the tree is traversed.  Returns false if the pass failed, e.g. found the tree to
+    // be invalid.
+    virtual bool finish() = 0;
+
+  private:
+    friend class TIntermFusedTraverser;
+};
+
+using TIntermReadOnlyPassList = std::vector<std::unique_ptr<TIntermReadOnlyPass>>;
+
+// Runs the passes in a single traversal of the tree, then finishes them in order.  Returns false if
+// any of them failed.
+ANGLE_NO_DISCARD bool RunReadOnlyPasses(TIntermNode *root, const TIntermReadOnlyPassList &passes);
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_TREEUTIL_INTERMTRAVERSE_H_
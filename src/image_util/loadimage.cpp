@@ -12,67 +12,276 @@
 #include "common/platform.h"
 #include "image_util/imageformats.h"
 
+#if defined(ANGLE_USE_NEON)
+#    include <arm_neon.h>
+#endif
+
 namespace angle
 {
 
-void LoadA8ToRGBA8(size_t width,
-                   size_t height,
-                   size_t depth,
-                   const uint8_t *input,
-                   size_t inputRowPitch,
-                   size_t inputDepthPitch,
-                   uint8_t *output,
-                   size_t outputRowPitch,
-                   size_t outputDepthPitch)
+namespace
+{
+// Vectorized row conversions.  Each one converts as many pixels of the row as it can and returns
+// how many it converted, so that the caller's scalar loop handles the rest of the row.
+size_t LoadRowA8ToRGBA8(const uint8_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE2)
+    const __m128i zeroWide = _mm_setzero_si128();
+    for (; x + 7 < width; x += 8)
+    {
+        __m128i sourceData = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&source[x]));
+        // Interleave each byte to 16bit, make the lower byte to zero
+        sourceData = _mm_unpacklo_epi8(zeroWide, sourceData);
+        // Interleave each 16bit to 32bit, make the lower 16bit to zero
+        __m128i lo = _mm_unpacklo_epi16(zeroWide, sourceData);
+        __m128i hi = _mm_unpackhi_epi16(zeroWide, sourceData);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x + 4]), hi);
+    }
+#elif defined(ANGLE_USE_NEON)
+    const uint8x16_t zero = vdupq_n_u8(0);
+    for (; x + 15 < width; x += 16)
+    {
+        const uint8x16x4_t rgba = {{zero, zero, zero, vld1q_u8(&source[x])}};
+        vst4q_u8(reinterpret_cast<uint8_t *>(&dest[x]), rgba);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRowL8ToRGBA8(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE2)
+    const __m128i opaque = _mm_set1_epi8(-1);
+    for (; x + 7 < width; x += 8)
+    {
+        const __m128i luminance = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&source[x]));
+        // Make LL and LA pairs, then interleave them to LLLA.
+        const __m128i ll = _mm_unpacklo_epi8(luminance, luminance);
+        const __m128i la = _mm_unpacklo_epi8(luminance, opaque);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x]), _mm_unpacklo_epi16(ll, la));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 16]),
+                         _mm_unpackhi_epi16(ll, la));
+    }
+#elif defined(ANGLE_USE_NEON)
+    const uint8x16_t opaque = vdupq_n_u8(0xFF);
+    for (; x + 15 < width; x += 16)
+    {
+        const uint8x16_t luminance = vld1q_u8(&source[x]);
+        const uint8x16x4_t rgba    = {{luminance, luminance, luminance, opaque}};
+        vst4q_u8(&dest[4 * x], rgba);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRowLA8ToRGBA8(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE2)
+    const __m128i luminanceMask = _mm_set1_epi16(0x00FF);
+    for (; x + 7 < width; x += 8)
+    {
+        const __m128i la = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[2 * x]));
+        // Make LL pairs, then interleave them with the LA pairs to LLLA.
+        const __m128i luminance = _mm_and_si128(la, luminanceMask);
+        const __m128i ll        = _mm_or_si128(luminance, _mm_slli_epi16(luminance, 8));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x]), _mm_unpacklo_epi16(ll, la));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 16]),
+                         _mm_unpackhi_epi16(ll, la));
+    }
+#elif defined(ANGLE_USE_NEON)
+    for (; x + 15 < width; x += 16)
+    {
+        const uint8x16x2_t la   = vld2q_u8(&source[2 * x]);
+        const uint8x16x4_t rgba = {{la.val[0], la.val[0], la.val[0], la.val[1]}};
+        vst4q_u8(&dest[4 * x], rgba);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRowRGB8ToBGRX8(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    // SSE2 has no byte shuffle, so only NEON converts RGB rows.
+#if defined(ANGLE_USE_NEON)
+    const uint8x16_t opaque = vdupq_n_u8(0xFF);
+    for (; x + 15 < width; x += 16)
+    {
+        const uint8x16x3_t rgb  = vld3q_u8(&source[3 * x]);
+        const uint8x16x4_t bgrx = {{rgb.val[2], rgb.val[1], rgb.val[0], opaque}};
+        vst4q_u8(&dest[4 * x], bgrx);
+    }
+#else
+    ANGLE_UNUSED_VARIABLE(source);
+    ANGLE_UNUSED_VARIABLE(dest);
+    ANGLE_UNUSED_VARIABLE(width);
+#endif
+    return x;
+}
+
+size_t LoadRowRGBA8ToBGRA8(const uint32_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE2)
+    const __m128i brMask = _mm_set1_epi32(0x00ff00ff);
+    for (; x + 3 < width; x += 4)
+    {
+        __m128i sourceData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+        // Mask out g and a, which don't change
+        __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
+        // Mask out b and r
+        __m128i brComponents = _mm_and_si128(sourceData, brMask);
+        // Swap b and r
+        __m128i brSwapped = _mm_shufflehi_epi16(
+            _mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+        __m128i result = _mm_or_si128(gaComponents, brSwapped);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
+    }
+#elif defined(ANGLE_USE_NEON)
+    for (; x + 15 < width; x += 16)
+    {
+        uint8x16x4_t rgba = vld4q_u8(reinterpret_cast<const uint8_t *>(&source[x]));
+        std::swap(rgba.val[0], rgba.val[2]);
+        vst4q_u8(reinterpret_cast<uint8_t *>(&dest[x]), rgba);
+    }
+#endif
+    return x;
+}
+
+#if defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+// Converts four floats to half floats the same way as gl::float32ToFloat16.  Returns false without
+// writing anything if one of them converts to a denormal half float, which is left to the scalar
+// conversion.
+bool Float32ToFloat16x4(const float *source, uint16_t *dest)
+{
+#    if defined(ANGLE_USE_SSE2)
+    const __m128i bits     = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+    const __m128i abs      = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+    const __m128i sign     = _mm_srli_epi32(_mm_andnot_si128(abs, bits), 16);
+    const __m128i isNaN    = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F800000));
+    const __m128i isInf    = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x47FFEFFF));
+    const __m128i isSmall  = _mm_cmpgt_epi32(_mm_set1_epi32(0x38800000), abs);
+    const __m128i isTiny   = _mm_cmpgt_epi32(_mm_set1_epi32(0x2D000000), abs);
+    const __m128i isDenorm = _mm_andnot_si128(isTiny, isSmall);
+
+    if (_mm_movemask_epi8(isDenorm) != 0)
+    {
+        return false;
+    }
+
+    // Rebias the exponent and round to nearest even.
+    const __m128i lsb  = _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1));
+    const __m128i bias = _mm_set1_epi32(static_cast<int32_t>(0xC8000FFFu));
+    __m128i result     = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(abs, bias), lsb), 13);
+
+    // Values too small for a half float become zero, and values too large become infinity.
+    result = _mm_andnot_si128(isTiny, result);
+    result = _mm_or_si128(_mm_and_si128(isInf, _mm_set1_epi32(0x7C00)),
+                          _mm_andnot_si128(isInf, result));
+    result = _mm_or_si128(result, sign);
+    result = _mm_or_si128(_mm_and_si128(isNaN, _mm_set1_epi32(0x7FFF)),
+                          _mm_andnot_si128(isNaN, result));
+
+    // Sign-extend the results so that the saturating pack keeps them as is.
+    result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dest), _mm_packs_epi32(result, result));
+#    else
+    const uint32x4_t bits     = vld1q_u32(reinterpret_cast<const uint32_t *>(source));
+    const uint32x4_t sign     = vshrq_n_u32(vandq_u32(bits, vdupq_n_u32(0x80000000)), 16);
+    const uint32x4_t abs      = vandq_u32(bits, vdupq_n_u32(0x7FFFFFFF));
+    const uint32x4_t isNaN    = vcgtq_u32(abs, vdupq_n_u32(0x7F800000));
+    const uint32x4_t isInf    = vcgtq_u32(abs, vdupq_n_u32(0x47FFEFFF));
+    const uint32x4_t isSmall  = vcltq_u32(abs, vdupq_n_u32(0x38800000));
+    const uint32x4_t isTiny   = vcltq_u32(abs, vdupq_n_u32(0x2D000000));
+    const uint32x4_t isDenorm = vbicq_u32(isSmall, isTiny);
+
+    if (vmaxvq_u32(isDenorm) != 0)
+    {
+        return false;
+    }
+
+    // Rebias the exponent and round to nearest even.
+    const uint32x4_t lsb  = vandq_u32(vshrq_n_u32(abs, 13), vdupq_n_u32(1));
+    const uint32x4_t bias = vdupq_n_u32(0xC8000FFF);
+    uint32x4_t result     = vshrq_n_u32(vaddq_u32(vaddq_u32(abs, bias), lsb), 13);
+
+    // Values too small for a half float become zero, and values too large become infinity.
+    result = vbicq_u32(result, isTiny);
+    result = vbslq_u32(isInf, vdupq_n_u32(0x7C00), result);
+    result = vorrq_u32(result, sign);
+    result = vbslq_u32(isNaN, vdupq_n_u32(0x7FFF), result);
+
+    vst1_u16(dest, vmovn_u32(result));
+#    endif
+    return true;
+}
+#endif  // defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+
+size_t LoadRowRGB32FToRGBA16F(const float *source, uint16_t *dest, size_t width)
 {
-#if defined(ANGLE_USE_SSE)
-    if (gl::supportsSSE2())
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+    // Each pixel is converted with the red of the next one, which is then replaced by the alpha.
+    for (; x + 1 < width; x++)
     {
-        __m128i zeroWide = _mm_setzero_si128();
+        if (!Float32ToFloat16x4(&source[x * 3], &dest[x * 4]))
+        {
+            dest[x * 4 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
+            dest[x * 4 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
+            dest[x * 4 + 2] = gl::float32ToFloat16(source[x * 3 + 2]);
+        }
+        dest[x * 4 + 3] = gl::Float16One;
+    }
+#else
+    ANGLE_UNUSED_VARIABLE(source);
+    ANGLE_UNUSED_VARIABLE(dest);
+    ANGLE_UNUSED_VARIABLE(width);
+#endif
+    return x;
+}
+}  // anonymous namespace
 
-        for (size_t z = 0; z < depth; z++)
+namespace priv
+{
+void Float32ToFloat16Row(const float *source, uint16_t *dest, size_t count)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+    for (; x + 3 < count; x += 4)
+    {
+        if (!Float32ToFloat16x4(&source[x], &dest[x]))
         {
-            for (size_t y = 0; y < height; y++)
+            for (size_t i = x; i < x + 4; i++)
             {
-                const uint8_t *source =
-                    priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 0xF) != 0 && x < width); x++)
-                {
-                    dest[x] = static_cast<uint32_t>(source[x]) << 24;
-                }
-
-                for (; x + 7 < width; x += 8)
-                {
-                    __m128i sourceData =
-                        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Interleave each byte to 16bit, make the lower byte to zero
-                    sourceData = _mm_unpacklo_epi8(zeroWide, sourceData);
-                    // Interleave each 16bit to 32bit, make the lower 16bit to zero
-                    __m128i lo = _mm_unpacklo_epi16(zeroWide, sourceData);
-                    __m128i hi = _mm_unpackhi_epi16(zeroWide, sourceData);
-
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), lo);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x + 4]), hi);
-                }
-
-                // Handle the remainder
-                for (; x < width; x++)
-                {
-                    dest[x] = static_cast<uint32_t>(source[x]) << 24;
-                }
+                dest[i] = gl::float32ToFloat16(source[i]);
             }
         }
-
-        return;
     }
 #endif
+    for (; x < count; x++)
+    {
+        dest[x] = gl::float32ToFloat16(source[x]);
+    }
+}
+}  // namespace priv
 
+void LoadA8ToRGBA8(size_t width,
+                   size_t height,
+                   size_t depth,
+                   const uint8_t *input,
+                   size_t inputRowPitch,
+                   size_t inputDepthPitch,
+                   uint8_t *output,
+                   size_t outputRowPitch,
+                   size_t outputDepthPitch)
+{
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -81,7 +290,7 @@ void LoadA8ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRowA8ToRGBA8(source, dest, width); x < width; x++)
             {
                 dest[x] = static_cast<uint32_t>(source[x]) << 24;
             }
@@ -180,7 +389,7 @@ void LoadL8ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRowL8ToRGBA8(source, dest, width); x < width; x++)
             {
                 uint8_t sourceVal = source[x];
                 dest[4 * x + 0]   = sourceVal;
@@ -283,7 +492,7 @@ void LoadLA8ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRowLA8ToRGBA8(source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[2 * x + 0];
                 dest[4 * x + 1] = source[2 * x + 0];
@@ -449,7 +658,7 @@ void LoadRGB8ToBGRX8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRowRGB8ToBGRX8(source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[x * 3 + 2];
                 dest[4 * x + 1] = source[x * 3 + 1];
@@ -594,58 +803,6 @@ void LoadRGBA8ToBGRA8(size_t width,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-#if defined(ANGLE_USE_SSE)
-    if (gl::supportsSSE2())
-    {
-        __m128i brMask = _mm_set1_epi32(0x00ff00ff);
-
-        for (size_t z = 0; z < depth; z++)
-        {
-            for (size_t y = 0; y < height; y++)
-            {
-                const uint32_t *source =
-                    priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 15) != 0) && x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-
-                for (; x + 3 < width; x += 4)
-                {
-                    __m128i sourceData =
-                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Mask out g and a, which don't change
-                    __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
-                    // Mask out b and r
-                    __m128i brComponents = _mm_and_si128(sourceData, brMask);
-                    // Swap b and r
-                    __m128i brSwapped = _mm_shufflehi_epi16(
-                        _mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
-                        _MM_SHUFFLE(2, 3, 0, 1));
-                    __m128i result = _mm_or_si128(gaComponents, brSwapped);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
-                }
-
-                // Perform leftover writes
-                for (; x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-            }
-        }
-
-        return;
-    }
-#endif
-
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -654,7 +811,7 @@ void LoadRGBA8ToBGRA8(size_t width,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRowRGBA8ToBGRA8(source, dest, width); x < width; x++)
             {
                 uint32_t rgba = source[x];
                 dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
@@ -1626,7 +1783,7 @@ void LoadRGB32FToRGBA16F(size_t width,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRowRGB32FToRGBA16F(source, dest, width); x < width; x++)
             {
                 dest[x * 4 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
                 dest[x * 4 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
@@ -1655,12 +1812,7 @@ void LoadRGB32FToRGB16F(size_t width,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x * 3 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
-                dest[x * 3 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
-                dest[x * 3 + 2] = gl::float32ToFloat16(source[x * 3 + 2]);
-            }
+            priv::Float32ToFloat16Row(source, dest, width * 3);
         }
     }
 }
@@ -207,6 +207,38 @@ struct ETC2Block
         }
     }
 
+    // Transcodes 8-bit single channel ETC2 block, such as the alpha of an RGBA8 block, to BC4
+    void transcodeAsSingleETC2ChannelToBC4(uint8_t *dest) const
+    {
+        float values[kNumPixelsInBlock];
+        for (size_t j = 0; j < 4; j++)
+        {
+            for (size_t i = 0; i < 4; i++)
+            {
+                values[j * 4 + i] = clampByte(getSingleETC2Channel(i, j, false));
+            }
+        }
+
+        packBC4(dest, values, false);
+    }
+
+    // Transcodes 11-bit single channel EAC block to BC4
+    void transcodeAsSingleEACChannelToBC4(uint8_t *dest, bool isSigned) const
+    {
+        float values[kNumPixelsInBlock];
+        for (size_t j = 0; j < 4; j++)
+        {
+            for (size_t i = 0; i < 4; i++)
+            {
+                int value = getSingleEACChannel(i, j, isSigned);
+                values[j * 4 + i] = isSigned ? gl::clamp(value, -1023, 1023) * (127.0f / 1023.0f)
+                                             : gl::clamp(value, 0, 2047) * (255.0f / 2047.0f);
+            }
+        }
+
+        packBC4(dest, values, isSigned);
+    }
+
   private:
     union
     {
@@ -413,6 +445,61 @@ struct ETC2Block
         return createRGBA(red, green, blue, 255);
     }
 
+    // Packs the pixel values, given in the range of the BC4 endpoints, to a BC4 block.  The
+    // endpoints are the extremes of the block, and each pixel picks the nearest of the eight
+    // values interpolated between them.
+    static void packBC4(uint8_t *dest, const float *values, bool isSigned)
+    {
+        float minValue = values[0];
+        float maxValue = values[0];
+        for (int i = 1; i < kNumPixelsInBlock; i++)
+        {
+            minValue = std::min(minValue, values[i]);
+            maxValue = std::max(maxValue, values[i]);
+        }
+
+        const int lower = isSigned ? -127 : 0;
+        const int upper = isSigned ? 127 : 255;
+        const int red0  = gl::clamp(static_cast<int>(std::round(maxValue)), lower, upper);
+        const int red1  = gl::clamp(static_cast<int>(std::round(minValue)), lower, upper);
+
+        // With red0 > red1, codes 2 to 7 are interpolated between the endpoints.  If the
+        // endpoints are equal, code 0 is the value of every pixel.
+        uint64_t bits = 0;
+        if (red0 != red1)
+        {
+            float palette[8] = {static_cast<float>(red0), static_cast<float>(red1)};
+            for (int code = 2; code < 8; code++)
+            {
+                palette[code] = ((8 - code) * red0 + (code - 1) * red1) / 7.0f;
+            }
+
+            for (int i = 0; i < kNumPixelsInBlock; i++)
+            {
+                uint64_t bestCode = 0;
+                float bestError   = std::abs(values[i] - palette[0]);
+                for (int code = 1; code < 8; code++)
+                {
+                    float error = std::abs(values[i] - palette[code]);
+                    if (error < bestError)
+                    {
+                        bestCode  = code;
+                        bestError = error;
+                    }
+                }
+                bits |= bestCode << (i * 3);
+            }
+        }
+
+        // Signed endpoints are stored in two's complement.
+        dest[0] = static_cast<uint8_t>(red0);
+        dest[1] = static_cast<uint8_t>(red1);
+        for (int byte = 0; byte < 6; byte++)
+        {
+            dest[2 + byte] = static_cast<uint8_t>(bits >> (byte * 8));
+        }
+    }
+
     static int extend_4to8bits(int x) { return (x << 4) | x; }
     static int extend_5to8bits(int x) { return (x << 3) | (x >> 2); }
     static int extend_6to8bits(int x) { return (x << 2) | (x >> 4); }
@@ -1551,6 +1638,72 @@ void LoadRG11EACToRG16(size_t width,
     }
 }
 
+void LoadR11EACToBC4(size_t width,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch,
+                     bool isSigned)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                const ETC2Block *sourceBlock = sourceRow + (x / 4);
+                uint8_t *destBlock           = destRow + (x * 2);
+
+                sourceBlock->transcodeAsSingleEACChannelToBC4(destBlock, isSigned);
+            }
+        }
+    }
+}
+
+void LoadRG11EACToBC5(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch,
+                      bool isSigned)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                // BC5 is a BC4 block for red followed by a BC4 block for green, like RG11 EAC.
+                uint8_t *destBlockRed           = destRow + (x * 4);
+                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
+                sourceBlockRed->transcodeAsSingleEACChannelToBC4(destBlockRed, isSigned);
+
+                uint8_t *destBlockGreen           = destBlockRed + 8;
+                const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+                sourceBlockGreen->transcodeAsSingleEACChannelToBC4(destBlockGreen, isSigned);
+            }
+        }
+    }
+}
+
 void LoadETC2RGB8ToRGBA8(size_t width,
                          size_t height,
                          size_t depth,
@@ -1851,6 +2004,62 @@ void LoadEACRG11SToRG16F(size_t width,
                       outputRowPitch, outputDepthPitch, true, true);
 }
 
+void LoadEACR11ToBC4(size_t width,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch)
+{
+    LoadR11EACToBC4(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                    outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadEACR11SToBC4(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+{
+    LoadR11EACToBC4(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                    outputRowPitch, outputDepthPitch, true);
+}
+
+void LoadEACRG11ToBC5(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+{
+    LoadRG11EACToBC5(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadEACRG11SToBC5(size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch)
+{
+    LoadRG11EACToBC5(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch, true);
+}
+
 void LoadETC2RGB8ToRGBA8(size_t width,
                          size_t height,
                          size_t depth,
@@ -1991,4 +2200,53 @@ void LoadETC2SRGBA8ToSRGBA8(size_t width,
                          outputRowPitch, outputDepthPitch, true);
 }
 
+void LoadETC2RGBA8ToBC3(size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                // Both formats store the alpha block first, then the color block.
+                uint8_t *destBlock                = destRow + (x * 4);
+                const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
+                sourceBlockAlpha->transcodeAsSingleETC2ChannelToBC4(destBlock);
+
+                // The color block of BC3 is always decoded in BC1's opaque four color mode.
+                const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
+                sourceBlockRGB->transcodeAsBC1(destBlock + 8, x, y, width, height,
+                                               DefaultETCAlphaValues, false);
+            }
+        }
+    }
+}
+
+void LoadETC2SRGBA8ToBC3(size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch)
+{
+    LoadETC2RGBA8ToBC3(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                       outputRowPitch, outputDepthPitch);
+}
+
 }  // namespace angle
@@ -30,26 +30,100 @@ enum CacheResult
     kCacheResultMax,
 };
 
+// Compressed data starts with this header.  Data compressed before the header existed is gzip
+// data, which starts with 0x1f 0x8b instead, so it can't be mistaken for the header.
+struct CompressedDataHeader
+{
+    uint8_t magic[2];
+    uint8_t version;
+    BlobCacheCodec codec;
+    uint32_t uncompressedSize;
+};
+static_assert(sizeof(CompressedDataHeader) == 8, "Unexpected compressed data header size");
+
+constexpr uint8_t kCompressedDataMagic[2] = {'A', 'B'};
+constexpr uint8_t kCompressedDataVersion  = 1;
+
+bool IsLegacyGzipData(const uint8_t *compressedData, size_t compressedSize)
+{
+    return compressedSize >= 2 && compressedData[0] == 0x1f && compressedData[1] == 0x8b;
+}
+
+bool DecompressLegacyGzipData(const uint8_t *compressedData,
+                              const size_t compressedSize,
+                              angle::MemoryBuffer *uncompressedData)
+{
+    // Call zlib function to decompress.
+    uint32_t uncompressedSize =
+        zlib_internal::GetGzipUncompressedSize(compressedData, compressedSize);
+
+    // Allocate enough memory.
+    if (!uncompressedData->resize(uncompressedSize))
+    {
+        ERR() << "Failed to allocate memory for decompression";
+        return false;
+    }
+
+    uLong destLen = uncompressedSize;
+    int zResult   = zlib_internal::GzipUncompressHelper(
+        uncompressedData->data(), &destLen, compressedData, static_cast<uLong>(compressedSize));
+
+    if (zResult != Z_OK)
+    {
+        ERR() << "Failed to decompress data: " << zResult << "\n";
+        return false;
+    }
+
+    // Resize it to expected size.
+    return uncompressedData->resize(destLen);
+}
 }  // anonymous namespace
 
 // In oder to store more cache in blob cache, compress cacheData to compressedData
 // before being stored.
-bool CompressBlobCacheData(const size_t cacheSize,
+bool CompressBlobCacheData(BlobCacheCodec codec,
+                           const size_t cacheSize,
                            const uint8_t *cacheData,
                            angle::MemoryBuffer *compressedData)
 {
+    ASSERT(codec < BlobCacheCodec::EnumCount);
+
     uLong uncompressedSize       = static_cast<uLong>(cacheSize);
     uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
 
     // Allocate memory.
-    if (!compressedData->resize(expectedCompressedSize))
+    if (!compressedData->resize(sizeof(CompressedDataHeader) + expectedCompressedSize))
     {
         ERR() << "Failed to allocate memory for compression";
         return false;
     }
 
-    int zResult = zlib_internal::GzipCompressHelper(compressedData->data(), &expectedCompressedSize,
-                                                    cacheData, uncompressedSize, nullptr, nullptr);
+    CompressedDataHeader header = {};
+    header.magic[0]             = kCompressedDataMagic[0];
+    header.magic[1]             = kCompressedDataMagic[1];
+    header.version              = kCompressedDataVersion;
+    header.codec                = codec;
+    header.uncompressedSize     = static_cast<uint32_t>(cacheSize);
+    memcpy(compressedData->data(), &header, sizeof(header));
+
+    uint8_t *dest = compressedData->data() + sizeof(header);
+    int zResult   = Z_OK;
+    switch (codec)
+    {
+        case BlobCacheCodec::Gzip:
+            zResult = zlib_internal::GzipCompressHelper(dest, &expectedCompressedSize, cacheData,
+                                                        uncompressedSize, nullptr, nullptr);
+            break;
+        case BlobCacheCodec::FastDeflate:
+            zResult = zlib_internal::CompressHelper(zlib_internal::ZRAW, dest,
+                                                    &expectedCompressedSize, cacheData,
+                                                    uncompressedSize, Z_BEST_SPEED, nullptr,
+                                                    nullptr);
+            break;
+        default:
+            UNREACHABLE();
+            return false;
+    }
 
     if (zResult != Z_OK)
     {
@@ -58,7 +132,7 @@ bool CompressBlobCacheData(const size_t cacheSize,
     }
 
     // Resize it to expected size.
-    if (!compressedData->resize(expectedCompressedSize))
+    if (!compressedData->resize(sizeof(header) + expectedCompressedSize))
     {
         return false;
     }
@@ -70,30 +144,55 @@ bool DecompressBlobCacheData(const uint8_t *compressedData,
                              const size_t compressedSize,
                              angle::MemoryBuffer *uncompressedData)
 {
-    // Call zlib function to decompress.
-    uint32_t uncompressedSize =
-        zlib_internal::GetGzipUncompressedSize(compressedData, compressedSize);
+    if (IsLegacyGzipData(compressedData, compressedSize))
+    {
+        return DecompressLegacyGzipData(compressedData, compressedSize, uncompressedData);
+    }
 
-    // Allocate enough memory.
-    if (!uncompressedData->resize(uncompressedSize))
+    CompressedDataHeader header;
+    if (compressedSize < sizeof(header))
     {
-        ERR() << "Failed to allocate memory for decompression";
+        ERR() << "Compressed data is too small";
         return false;
     }
+    memcpy(&header, compressedData, sizeof(header));
 
-    uLong destLen = uncompressedSize;
-    int zResult   = zlib_internal::GzipUncompressHelper(
-        uncompressedData->data(), &destLen, compressedData, static_cast<uLong>(compressedSize));
+    if (header.magic[0] != kCompressedDataMagic[0] || header.magic[1] != kCompressedDataMagic[1] ||
+        header.version != kCompressedDataVersion || header.codec >= BlobCacheCodec::EnumCount)
+    {
+        ERR() << "Unrecognized compressed data header";
+        return false;
+    }
 
-    if (zResult != Z_OK)
+    // Allocate enough memory.
+    if (!uncompressedData->resize(header.uncompressedSize))
     {
-        ERR() << "Failed to decompress data: " << zResult << "\n";
+        ERR() << "Failed to allocate memory for decompression";
         return false;
     }
 
-    // Resize it to expected size.
-    if (!uncompressedData->resize(destLen))
+    const uint8_t *source    = compressedData + sizeof(header);
+    const uLong sourceLength = static_cast<uLong>(compressedSize - sizeof(header));
+    uLong destLen            = header.uncompressedSize;
+    int zResult              = Z_OK;
+    switch (header.codec)
     {
+        case BlobCacheCodec::Gzip:
+            zResult = zlib_internal::GzipUncompressHelper(uncompressedData->data(), &destLen,
+                                                          source, sourceLength);
+            break;
+        case BlobCacheCodec::FastDeflate:
+            zResult = zlib_internal::UncompressHelper(
+                zlib_internal::ZRAW, uncompressedData->data(), &destLen, source, sourceLength);
+            break;
+        default:
+            UNREACHABLE();
+            return false;
+    }
+
+    if (zResult != Z_OK || destLen != header.uncompressedSize)
+    {
+        ERR() << "Failed to decompress data: " << zResult << "\n";
         return false;
     }
 
@@ -101,8 +200,14 @@ bool DecompressBlobCacheData(const uint8_t *compressedData,
 }
 
 BlobCache::BlobCache(size_t maxCacheSizeBytes)
-    : mBlobCache(maxCacheSizeBytes), mSetBlobFunc(nullptr), mGetBlobFunc(nullptr)
-{}
+    : mTotalSize(0),
+      mMaxSize(maxCacheSizeBytes),
+      mSetBlobFunc(nullptr),
+      mGetBlobFunc(nullptr),
+      mCodec(BlobCacheCodec::Gzip)
+{
+    resize(maxCacheSizeBytes);
+}
 
 BlobCache::~BlobCache() {}
 
@@ -130,18 +235,60 @@ void BlobCache::putApplication(const BlobCache::Key &key, const angle::MemoryBuf
 
 void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source)
 {
+    const size_t valueSize = value.size();
+    const size_t maxSize   = mMaxSize;
+    if (valueSize > maxSize)
+    {
+        return;
+    }
+
     CacheEntry newEntry;
-    newEntry.first  = std::move(value);
+    newEntry.first  = std::make_shared<angle::MemoryBuffer>(std::move(value));
     newEntry.second = source;
 
-    // Cache it inside blob cache only if caching inside the application is not possible.
-    mBlobCache.put(key, std::move(newEntry), newEntry.first.size());
+    const size_t shardIndex = key[0] % kShardCount;
+    Shard &shard            = mShards[shardIndex];
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        // Cache it inside blob cache only if caching inside the application is not possible.
+        const size_t previousShardSize = shard.cache.size();
+        shard.cache.put(key, std::move(newEntry), valueSize);
+        mTotalSize += shard.cache.size();
+        mTotalSize -= previousShardSize;
+
+        // The new entry is the most recently used, so it's not evicted while there are others.
+        while (mTotalSize > maxSize && shard.cache.entryCount() > 1)
+        {
+            mTotalSize -= shard.cache.eraseLeastRecentlyUsed();
+        }
+    }
+
+    if (mTotalSize > maxSize)
+    {
+        evictFromShards(shardIndex + 1, kShardCount - 1, maxSize);
+    }
+}
+
+size_t BlobCache::evictFromShards(size_t firstShardIndex, size_t shardCount, size_t limit)
+{
+    size_t freedSize = 0;
+    for (size_t offset = 0; offset < shardCount && mTotalSize > limit; ++offset)
+    {
+        Shard &shard = mShards[(firstShardIndex + offset) % kShardCount];
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        while (mTotalSize > limit && !shard.cache.empty())
+        {
+            const size_t erasedSize = shard.cache.eraseLeastRecentlyUsed();
+            mTotalSize -= erasedSize;
+            freedSize += erasedSize;
+        }
+    }
+    return freedSize;
 }
 
-bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
-                    const BlobCache::Key &key,
-                    BlobCache::Value *valueOut,
-                    size_t *bufferSizeOut)
+bool BlobCache::get(const BlobCache::Key &key, BlobCache::Value *valueOut, size_t *bufferSizeOut)
 {
     // Look into the application's cache, if there is such a cache
     if (areBlobCacheFuncsSet())
@@ -152,16 +299,15 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
             return false;
         }
 
-        angle::MemoryBuffer *scratchMemory;
-        bool result = scratchBuffer->get(valueSize, &scratchMemory);
-        if (!result)
+        std::shared_ptr<angle::MemoryBuffer> memory = std::make_shared<angle::MemoryBuffer>();
+        if (!memory->resize(valueSize))
         {
             ERR() << "Failed to allocate memory for binary blob";
             return false;
         }
 
         EGLsizeiANDROID originalValueSize = valueSize;
-        valueSize = mGetBlobFunc(key.data(), key.size(), scratchMemory->data(), valueSize);
+        valueSize = mGetBlobFunc(key.data(), key.size(), memory->data(), valueSize);
 
         // Make sure the key/value pair still exists/is unchanged after the second call
         // (modifications to the application cache by another thread are a possibility)
@@ -174,18 +320,30 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
             return false;
         }
 
-        *valueOut      = BlobCache::Value(scratchMemory->data(), scratchMemory->size());
+        *valueOut      = BlobCache::Value(std::move(memory));
         *bufferSizeOut = valueSize;
         return true;
     }
 
-    // Otherwise we are doing caching internally, so try to find it there
-    const CacheEntry *entry;
-    bool result = mBlobCache.get(key, &entry);
+    // Otherwise we are doing caching internally, so try to find it there.  The shard is only
+    // locked for the lookup, the copy of the entry references the same data.
+    CacheEntry entry;
+    bool result = false;
+    {
+        Shard &shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        const CacheEntry *cachedEntry;
+        result = shard.cache.get(key, &cachedEntry);
+        if (result)
+        {
+            entry = *cachedEntry;
+        }
+    }
 
     if (result)
     {
-        if (entry->second == CacheSource::Memory)
+        if (entry.second == CacheSource::Memory)
         {
             ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheHitMemory,
                                         kCacheResultMax);
@@ -196,8 +354,8 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
                                         kCacheResultMax);
         }
 
-        *valueOut      = BlobCache::Value(entry->first.data(), entry->first.size());
-        *bufferSizeOut = entry->first.size();
+        *bufferSizeOut = entry.first->size();
+        *valueOut      = BlobCache::Value(std::move(entry.first));
     }
     else
     {
@@ -208,20 +366,75 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
     return result;
 }
 
-bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Value *valueOut)
+bool BlobCache::getAt(size_t index, BlobCache::Key *keyOut, BlobCache::Value *valueOut)
 {
-    const CacheEntry *valueBuf;
-    bool result = mBlobCache.getAt(index, keyOut, &valueBuf);
-    if (result)
+    for (Shard &shard : mShards)
     {
-        *valueOut = BlobCache::Value(valueBuf->first.data(), valueBuf->first.size());
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (index >= shard.cache.entryCount())
+        {
+            index -= shard.cache.entryCount();
+            continue;
+        }
+
+        const BlobCache::Key *key;
+        const CacheEntry *valueBuf;
+        bool result = shard.cache.getAt(index, &key, &valueBuf);
+        ASSERT(result);
+        *keyOut   = *key;
+        *valueOut = BlobCache::Value(valueBuf->first);
+        return true;
     }
-    return result;
+    return false;
 }
 
 void BlobCache::remove(const BlobCache::Key &key)
 {
-    mBlobCache.eraseByKey(key);
+    Shard &shard = getShard(key);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const size_t previousShardSize = shard.cache.size();
+    shard.cache.eraseByKey(key);
+    mTotalSize -= previousShardSize - shard.cache.size();
+}
+
+void BlobCache::clear()
+{
+    for (Shard &shard : mShards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        mTotalSize -= shard.cache.size();
+        shard.cache.clear();
+    }
+}
+
+void BlobCache::resize(size_t maxCacheSizeBytes)
+{
+    mMaxSize = maxCacheSizeBytes;
+    for (Shard &shard : mShards)
+    {
+        // Every shard can hold up to the whole size, the total size is kept under the maximum by
+        // populate().
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        mTotalSize -= shard.cache.size();
+        shard.cache.resize(maxCacheSizeBytes);
+    }
+}
+
+size_t BlobCache::entryCount() const
+{
+    size_t count = 0;
+    for (const Shard &shard : mShards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        count += shard.cache.entryCount();
+    }
+    return count;
+}
+
+size_t BlobCache::trim(size_t limit)
+{
+    return evictFromShards(0, kShardCount, limit);
 }
 
 void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
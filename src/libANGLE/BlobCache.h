@@ -11,7 +11,10 @@
 #define LIBANGLE_BLOB_CACHE_H_
 
 #include <array>
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <mutex>
 
 #include <anglebase/sha1.h>
 #include "common/MemoryBuffer.h"
@@ -48,7 +51,21 @@ struct hash<egl::BlobCacheKey>
 namespace egl
 {
 
-bool CompressBlobCacheData(const size_t cacheSize,
+// How blob cache data is compressed.  The codec is recorded in a header of the compressed data, so
+// data compressed with any codec, or before the header existed, can be decompressed.
+enum class BlobCacheCodec : uint8_t
+{
+    // zlib with a gzip wrapper, at the default compression level.
+    Gzip = 0,
+    // zlib without a wrapper or checksum, at the fastest compression level.
+    FastDeflate = 1,
+
+    InvalidEnum = 2,
+    EnumCount   = 2,
+};
+
+bool CompressBlobCacheData(BlobCacheCodec codec,
+                           const size_t cacheSize,
                            const uint8_t *cacheData,
                            angle::MemoryBuffer *compressedData);
 bool DecompressBlobCacheData(const uint8_t *compressedData,
@@ -62,26 +79,27 @@ class BlobCache final : angle::NonCopyable
     // simplicity and efficiency.
     static constexpr size_t kKeyLength = kBlobCacheKeyLength;
     using Key                          = BlobCacheKey;
+    // A reference to the data of a blob.  The data stays valid as long as the Value lives, even if
+    // the blob is evicted or replaced by another thread in the meantime.
     class Value
     {
       public:
-        Value() : mPtr(nullptr), mSize(0) {}
-        Value(const uint8_t *ptr, size_t sz) : mPtr(ptr), mSize(sz) {}
+        Value() = default;
+        explicit Value(std::shared_ptr<const angle::MemoryBuffer> buffer)
+            : mBuffer(std::move(buffer))
+        {}
 
-        // A very basic struct to hold the pointer and size together.  The objects of this class
-        // don't own the memory.
-        const uint8_t *data() { return mPtr; }
-        size_t size() { return mSize; }
+        const uint8_t *data() const { return mBuffer ? mBuffer->data() : nullptr; }
+        size_t size() const { return mBuffer ? mBuffer->size() : 0; }
 
         const uint8_t &operator[](size_t pos) const
         {
-            ASSERT(pos < mSize);
-            return mPtr[pos];
+            ASSERT(pos < size());
+            return data()[pos];
         }
 
       private:
-        const uint8_t *mPtr;
-        size_t mSize;
+        std::shared_ptr<const angle::MemoryBuffer> mBuffer;
     };
     enum class CacheSource
     {
@@ -107,39 +125,36 @@ class BlobCache final : angle::NonCopyable
 
     // Check if the cache contains the blob corresponding to this key.  If application callbacks are
     // set, those will be used.  Otherwise they key is looked up in this object's cache.
-    ANGLE_NO_DISCARD bool get(angle::ScratchBuffer *scratchBuffer,
-                              const BlobCache::Key &key,
+    ANGLE_NO_DISCARD bool get(const BlobCache::Key &key,
                               BlobCache::Value *valueOut,
                               size_t *bufferSizeOut);
 
     // For querying the contents of the cache.
-    ANGLE_NO_DISCARD bool getAt(size_t index,
-                                const BlobCache::Key **keyOut,
-                                BlobCache::Value *valueOut);
+    ANGLE_NO_DISCARD bool getAt(size_t index, BlobCache::Key *keyOut, BlobCache::Value *valueOut);
 
     // Evict a blob from the binary cache.
     void remove(const BlobCache::Key &key);
 
     // Empty the cache.
-    void clear() { mBlobCache.clear(); }
+    void clear();
 
     // Resize the cache. Discards current contents.
-    void resize(size_t maxCacheSizeBytes) { mBlobCache.resize(maxCacheSizeBytes); }
+    void resize(size_t maxCacheSizeBytes);
 
     // Returns the number of entries in the cache.
-    size_t entryCount() const { return mBlobCache.entryCount(); }
+    size_t entryCount() const;
 
     // Reduces the current cache size and returns the number of bytes freed.
-    size_t trim(size_t limit) { return mBlobCache.shrinkToSize(limit); }
+    size_t trim(size_t limit);
 
     // Returns the current cache size in bytes.
-    size_t size() const { return mBlobCache.size(); }
+    size_t size() const { return mTotalSize; }
 
     // Returns whether the cache is empty
-    bool empty() const { return mBlobCache.empty(); }
+    bool empty() const { return entryCount() == 0; }
 
     // Returns the maximum cache size in bytes.
-    size_t maxSize() const { return mBlobCache.maxSize(); }
+    size_t maxSize() const { return mMaxSize; }
 
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
 
@@ -147,15 +162,42 @@ class BlobCache final : angle::NonCopyable
 
     bool isCachingEnabled() const { return areBlobCacheFuncsSet() || maxSize() > 0; }
 
+    // The codec that users of the cache compress new values with.
+    void setCodec(BlobCacheCodec codec) { mCodec = codec; }
+    BlobCacheCodec getCodec() const { return mCodec; }
+
   private:
     // This internal cache is used only if the application is not providing caching callbacks
-    using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
+    using CacheEntry = std::pair<std::shared_ptr<const angle::MemoryBuffer>, CacheSource>;
+
+    // The internal cache is split by the first byte of the keys, so that threads accessing
+    // different keys rarely contend on the same lock.  Each shard keeps its entries in MRU order,
+    // and the total size is kept under the maximum by evicting the least recently used entries of
+    // the shard being added to first, then of the others.
+    static constexpr size_t kShardCount = 16;
+    struct Shard
+    {
+        Shard() : cache(0) {}
+
+        mutable std::mutex mutex;
+        angle::SizedMRUCache<BlobCache::Key, CacheEntry> cache;
+    };
+
+    Shard &getShard(const BlobCache::Key &key) { return mShards[key[0] % kShardCount]; }
+    // Evicts the least recently used entries of |shardCount| shards, starting at
+    // |firstShardIndex|, until the total size is at most |limit|.  Returns the number of bytes
+    // freed.
+    size_t evictFromShards(size_t firstShardIndex, size_t shardCount, size_t limit);
 
     std::mutex mBlobCacheMutex;
-    angle::SizedMRUCache<BlobCache::Key, CacheEntry> mBlobCache;
+    std::array<Shard, kShardCount> mShards;
+    std::atomic<size_t> mTotalSize;
+    std::atomic<size_t> mMaxSize;
 
     EGLSetBlobFuncANDROID mSetBlobFunc;
     EGLGetBlobFuncANDROID mGetBlobFunc;
+
+    BlobCacheCodec mCodec;
 };
 
 }  // namespace egl
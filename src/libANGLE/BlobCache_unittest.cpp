@@ -7,6 +7,9 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 #include "libANGLE/BlobCache.h"
 
 namespace egl
@@ -59,7 +62,7 @@ TEST(BlobCacheTest, MaxSizedValue)
 
     Blob blob;
     size_t blobSize;
-    EXPECT_FALSE(blobCache.get(nullptr, MakeKey(0), &blob, &blobSize));
+    EXPECT_FALSE(blobCache.get(MakeKey(0), &blob, &blobSize));
 
     blobCache.clear();
     EXPECT_TRUE(blobCache.empty());
@@ -77,7 +80,7 @@ TEST(BlobCacheTest, ManySmallValues)
 
         Blob qvalue;
         size_t blobSize;
-        EXPECT_TRUE(blobCache.get(nullptr, MakeKey(value), &qvalue, &blobSize));
+        EXPECT_TRUE(blobCache.get(MakeKey(value), &qvalue, &blobSize));
         if (qvalue.size() > 0)
         {
             EXPECT_EQ(value, qvalue[0]);
@@ -92,7 +95,7 @@ TEST(BlobCacheTest, ManySmallValues)
 
     Blob qvalue;
     size_t blobSize;
-    EXPECT_FALSE(blobCache.get(nullptr, MakeKey(0), &qvalue, &blobSize));
+    EXPECT_FALSE(blobCache.get(MakeKey(0), &qvalue, &blobSize));
 
     // Putting one large element cleans out the whole stack.
     blobCache.populate(MakeKey(kSize + 1), MakeBlob(kSize, kSize + 1));
@@ -101,9 +104,9 @@ TEST(BlobCacheTest, ManySmallValues)
 
     for (size_t value = 0; value <= kSize; ++value)
     {
-        EXPECT_FALSE(blobCache.get(nullptr, MakeKey(value), &qvalue, &blobSize));
+        EXPECT_FALSE(blobCache.get(MakeKey(value), &qvalue, &blobSize));
     }
-    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(kSize + 1), &qvalue, &blobSize));
+    EXPECT_TRUE(blobCache.get(MakeKey(kSize + 1), &qvalue, &blobSize));
     if (qvalue.size() > 0)
     {
         EXPECT_EQ(kSize + 1, qvalue[0]);
@@ -128,7 +131,108 @@ TEST(BlobCacheTest, OversizeValue)
 
     Blob qvalue;
     size_t blobSize;
-    EXPECT_FALSE(blobCache.get(nullptr, MakeKey(5), &qvalue, &blobSize));
+    EXPECT_FALSE(blobCache.get(MakeKey(5), &qvalue, &blobSize));
+}
+
+// Tests that a value stays valid after its entry is evicted.
+TEST(BlobCacheTest, ValueOutlivesEviction)
+{
+    constexpr size_t kSize = 32;
+    BlobCache blobCache(kSize);
+
+    blobCache.populate(MakeKey(0), MakeBlob(kSize, 7));
+
+    Blob blob;
+    size_t blobSize;
+    ASSERT_TRUE(blobCache.get(MakeKey(0), &blob, &blobSize));
+
+    // Evicts the first value.
+    blobCache.populate(MakeKey(1), MakeBlob(kSize, 9));
+
+    Blob evictedBlob;
+    EXPECT_FALSE(blobCache.get(MakeKey(0), &evictedBlob, &blobSize));
+
+    ASSERT_EQ(kSize, blob.size());
+    for (size_t index = 0; index < kSize; ++index)
+    {
+        EXPECT_EQ(index + 7, blob[index]);
+    }
+}
+
+// Tests that threads can put and get values concurrently, and that the cache stays in its size.
+TEST(BlobCacheTest, ConcurrentAccess)
+{
+    constexpr size_t kThreadCount     = 4;
+    constexpr size_t kValuesPerThread = 200;
+    constexpr size_t kValueSize       = 8;
+    constexpr size_t kSize            = 64 * kValueSize;
+    BlobCache blobCache(kSize);
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&blobCache, threadIndex]() {
+            for (size_t value = 0; value < kValuesPerThread; ++value)
+            {
+                const uint8_t start = static_cast<uint8_t>(threadIndex * kValuesPerThread + value);
+                Key key             = MakeKey(start);
+                key[1]              = static_cast<uint8_t>(threadIndex);
+                blobCache.populate(key, MakeBlob(kValueSize, start));
+
+                // The value may have been evicted by the other threads, but not changed.
+                Blob blob;
+                size_t blobSize;
+                if (blobCache.get(key, &blob, &blobSize))
+                {
+                    ASSERT_EQ(kValueSize, blob.size());
+                    EXPECT_EQ(start, blob[0]);
+                }
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_LE(blobCache.size(), kSize);
+    EXPECT_EQ(blobCache.size(), blobCache.entryCount() * kValueSize);
+}
+
+// Tests that data compressed with each codec decompresses to the original data.
+TEST(BlobCacheTest, CompressionCodecs)
+{
+    BlobPut data = MakeBlob(1000);
+
+    for (BlobCacheCodec codec : {BlobCacheCodec::Gzip, BlobCacheCodec::FastDeflate})
+    {
+        angle::MemoryBuffer compressedData;
+        ASSERT_TRUE(CompressBlobCacheData(codec, data.size(), data.data(), &compressedData));
+
+        angle::MemoryBuffer uncompressedData;
+        ASSERT_TRUE(DecompressBlobCacheData(compressedData.data(), compressedData.size(),
+                                            &uncompressedData));
+        ASSERT_EQ(data.size(), uncompressedData.size());
+        EXPECT_EQ(0, memcmp(data.data(), uncompressedData.data(), data.size()));
+    }
+}
+
+// Tests that data with an unknown header isn't decompressed.
+TEST(BlobCacheTest, UnknownCompressedDataHeader)
+{
+    BlobPut data = MakeBlob(100);
+
+    angle::MemoryBuffer compressedData;
+    ASSERT_TRUE(
+        CompressBlobCacheData(BlobCacheCodec::Gzip, data.size(), data.data(), &compressedData));
+
+    // Bump the header version.
+    compressedData[2]++;
+
+    angle::MemoryBuffer uncompressedData;
+    EXPECT_FALSE(DecompressBlobCacheData(compressedData.data(), compressedData.size(),
+                                         &uncompressedData));
 }
 
 }  // namespace egl
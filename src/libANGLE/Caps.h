@@ -49,12 +49,19 @@ struct TextureCaps
     // Set of supported sample counts, only guaranteed to be valid in ES3.
     SupportedSampleSet sampleCounts;
 
+    // GL_EXT_sparse_texture: the virtual page size of sparse 2D and 2D array textures, or empty if
+    // the format can't be used for sparse textures.  Pages are one layer deep.
+    Extents sparsePageSize;
+
     // Get the maximum number of samples supported
     GLuint getMaxSamples() const;
 
     // Get the number of supported samples that is at least as many as requested.  Returns 0 if
     // there are no sample counts available
     GLuint getNearestSamples(GLuint requestedSamples) const;
+
+    // Get the number of virtual page sizes of sparse textures of the given type
+    GLuint getSparsePageSizeCount(TextureType type) const;
 };
 
 TextureCaps GenerateMinimumTextureCaps(GLenum internalFormat,
@@ -627,6 +634,9 @@ struct Extensions
     // GL_ANGLE_provoking_vertex
     bool provokingVertex = false;
 
+    // GL_ANGLE_prewarm_draw_state
+    bool prewarmDrawStateANGLE = false;
+
     // GL_CHROMIUM_texture_filtering_hint
     bool textureFilteringCHROMIUM = false;
 
@@ -716,6 +726,9 @@ struct Extensions
     // GL_EXT_tessellation_shader
     bool tessellationShaderEXT = false;
 
+    // GL_EXT_sparse_texture
+    bool sparseTextureEXT = false;
+
     // GL_EXT_copy_image
     bool copyImageEXT = false;
 
@@ -1005,6 +1018,12 @@ struct Caps
     // ES 3.2 Table 20.41: Implementation Dependent Values (cont.)
     GLint maxTextureBufferSize         = 0;
     GLint textureBufferOffsetAlignment = 0;
+
+    // GL_EXT_sparse_texture
+    GLint maxSparseTextureSize             = 0;
+    GLint maxSparse3DTextureSize           = 0;
+    GLint maxSparseArrayTextureLayers      = 0;
+    bool sparseTextureFullArrayCubeMipmaps = false;
 };
 
 Caps GenerateMinimumCaps(const Version &clientVersion, const Extensions &extensions);
@@ -1306,6 +1325,9 @@ struct ClientExtensions
     // EGL_ANGLE_platform_angle_vulkan
     bool platformANGLEVulkan = false;
 
+    // EGL_ANGLE_platform_angle_device_id
+    bool platformANGLEDeviceId = false;
+
     // EGL_ANGLE_platform_angle_metal
     bool platformANGLEMetal = false;
 
@@ -1342,6 +1364,9 @@ struct ClientExtensions
     // EGL_ANGLE_feature_control
     bool featureControlANGLE = false;
 
+    // EGL_ANGLE_histogram_query
+    bool histogramQueryANGLE = false;
+
     // EGL_ANGLE_platform_angle_device_type_swiftshader
     bool platformANGLEDeviceTypeSwiftShader = false;
 
@@ -8,6 +8,10 @@
 
 #include "libANGLE/Compiler.h"
 
+#include <string.h>
+
+#include <algorithm>
+
 #include "common/debug.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
@@ -21,9 +25,48 @@ namespace gl
 namespace
 {
 
-// To know when to call sh::Initialize and sh::Finalize.
+// To know when to call sh::Initialize and sh::Finalize.  Compiler instance caches that hold
+// instances count as active compilers too.
 size_t gActiveCompilers = 0;
 
+// Bounds the number of idle instances kept per shader type, by a compiler or by each cached
+// configuration of a display.
+constexpr size_t kMaxPoolSize = 32;
+
+// Contexts of a display usually share very few configurations.
+constexpr size_t kMaxCachedConfigurations = 4;
+
+void AddActiveCompiler()
+{
+    if (gActiveCompilers == 0)
+    {
+        sh::Initialize();
+    }
+    ++gActiveCompilers;
+}
+
+void RemoveActiveCompiler()
+{
+    ASSERT(gActiveCompilers > 0);
+    --gActiveCompilers;
+    if (gActiveCompilers == 0)
+    {
+        sh::Finalize();
+    }
+}
+
+void DestroyInstances(ShaderMap<std::vector<ShCompilerInstance>> *pools)
+{
+    for (std::vector<ShCompilerInstance> &pool : *pools)
+    {
+        for (ShCompilerInstance &instance : pool)
+        {
+            instance.destroy();
+        }
+        pool.clear();
+    }
+}
+
 ShShaderSpec SelectShaderSpec(GLint majorVersion,
                               GLint minorVersion,
                               bool isWebGL,
@@ -63,7 +106,8 @@ ShShaderSpec SelectShaderSpec(GLint majorVersion,
 }  // anonymous namespace
 
 Compiler::Compiler(rx::GLImplFactory *implFactory, const State &state, egl::Display *display)
-    : mImplementation(implFactory->createCompiler()),
+    : mDisplay(display),
+      mImplementation(implFactory->createCompiler()),
       mSpec(SelectShaderSpec(state.getClientMajorVersion(),
                              state.getClientMinorVersion(),
                              state.getExtensions().webglCompatibility,
@@ -80,11 +124,7 @@ Compiler::Compiler(rx::GLImplFactory *implFactory, const State &state, egl::Disp
 
     {
         std::lock_guard<std::mutex> lock(display->getDisplayGlobalMutex());
-        if (gActiveCompilers == 0)
-        {
-            sh::Initialize();
-        }
-        ++gActiveCompilers;
+        AddActiveCompiler();
     }
 
     sh::InitBuiltInResources(&mResources);
@@ -278,19 +318,10 @@ Compiler::~Compiler() = default;
 
 void Compiler::onDestroy(const Context *context)
 {
-    std::lock_guard<std::mutex> lock(context->getDisplay()->getDisplayGlobalMutex());
-    for (auto &pool : mPools)
-    {
-        for (ShCompilerInstance &instance : pool)
-        {
-            instance.destroy();
-        }
-    }
-    --gActiveCompilers;
-    if (gActiveCompilers == 0)
-    {
-        sh::Finalize();
-    }
+    std::lock_guard<std::mutex> lock(mDisplay->getDisplayGlobalMutex());
+    // Hand the idle instances over to the display, for the next contexts to use.
+    mDisplay->getCompilerInstanceCache()->put(mSpec, mOutputType, mResources, &mPools);
+    RemoveActiveCompiler();
 }
 
 ShCompilerInstance Compiler::getInstance(ShaderType type)
@@ -299,6 +330,16 @@ ShCompilerInstance Compiler::getInstance(ShaderType type)
     auto &pool = mPools[type];
     if (pool.empty())
     {
+        {
+            std::lock_guard<std::mutex> lock(mDisplay->getDisplayGlobalMutex());
+            ShCompilerInstance instance = mDisplay->getCompilerInstanceCache()->take(
+                mSpec, mOutputType, mResources, type);
+            if (instance.getHandle() != nullptr)
+            {
+                return instance;
+            }
+        }
+
         ShHandle handle = sh::ConstructCompiler(ToGLenum(type), mSpec, mOutputType, &mResources);
         ASSERT(handle);
         return ShCompilerInstance(handle, mOutputType, type);
@@ -313,8 +354,7 @@ ShCompilerInstance Compiler::getInstance(ShaderType type)
 
 void Compiler::putInstance(ShCompilerInstance &&instance)
 {
-    static constexpr size_t kMaxPoolSize = 32;
-    auto &pool                           = mPools[instance.getShaderType()];
+    auto &pool = mPools[instance.getShaderType()];
     if (pool.size() < kMaxPoolSize)
     {
         pool.push_back(std::move(instance));
@@ -382,4 +422,116 @@ ShShaderOutput ShCompilerInstance::getShaderOutputType() const
     return mOutputType;
 }
 
+CompilerInstanceCache::CompilerInstanceCache() = default;
+
+CompilerInstanceCache::~CompilerInstanceCache()
+{
+    ASSERT(mEntries.empty());
+}
+
+ShCompilerInstance CompilerInstanceCache::take(ShShaderSpec spec,
+                                               ShShaderOutput outputType,
+                                               const ShBuiltInResources &resources,
+                                               ShaderType shaderType)
+{
+    for (Entry &entry : mEntries)
+    {
+        // The resources are memset to zero by sh::InitBuiltInResources, so they can be compared
+        // bytewise.
+        if (entry.spec != spec || entry.outputType != outputType ||
+            memcmp(&entry.resources, &resources, sizeof(resources)) != 0)
+        {
+            continue;
+        }
+
+        std::vector<ShCompilerInstance> &pool = entry.pools[shaderType];
+        if (pool.empty())
+        {
+            break;
+        }
+
+        ShCompilerInstance instance = std::move(pool.back());
+        pool.pop_back();
+        return instance;
+    }
+
+    return ShCompilerInstance();
+}
+
+void CompilerInstanceCache::put(ShShaderSpec spec,
+                                ShShaderOutput outputType,
+                                const ShBuiltInResources &resources,
+                                ShaderMap<std::vector<ShCompilerInstance>> *pools)
+{
+    if (std::all_of(pools->begin(), pools->end(),
+                    [](const std::vector<ShCompilerInstance> &pool) { return pool.empty(); }))
+    {
+        return;
+    }
+
+    auto entryIter = std::find_if(mEntries.begin(), mEntries.end(), [&](const Entry &entry) {
+        return entry.spec == spec && entry.outputType == outputType &&
+               memcmp(&entry.resources, &resources, sizeof(resources)) == 0;
+    });
+
+    Entry entry;
+    if (entryIter != mEntries.end())
+    {
+        entry = std::move(*entryIter);
+        mEntries.erase(entryIter);
+    }
+    else
+    {
+        if (mEntries.empty())
+        {
+            // Keep the translator initialized for as long as instances are cached.
+            AddActiveCompiler();
+        }
+        else if (mEntries.size() >= kMaxCachedConfigurations)
+        {
+            DestroyInstances(&mEntries.front().pools);
+            mEntries.erase(mEntries.begin());
+        }
+
+        entry.spec       = spec;
+        entry.outputType = outputType;
+        entry.resources  = resources;
+    }
+
+    for (ShaderType shaderType : AllShaderTypes())
+    {
+        std::vector<ShCompilerInstance> &from = (*pools)[shaderType];
+        std::vector<ShCompilerInstance> &to   = entry.pools[shaderType];
+        while (!from.empty())
+        {
+            if (to.size() < kMaxPoolSize)
+            {
+                to.push_back(std::move(from.back()));
+            }
+            else
+            {
+                from.back().destroy();
+            }
+            from.pop_back();
+        }
+    }
+
+    mEntries.push_back(std::move(entry));
+}
+
+void CompilerInstanceCache::clear()
+{
+    if (mEntries.empty())
+    {
+        return;
+    }
+
+    for (Entry &entry : mEntries)
+    {
+        DestroyInstances(&entry.pools);
+    }
+    mEntries.clear();
+    RemoveActiveCompiler();
+}
+
 }  // namespace gl
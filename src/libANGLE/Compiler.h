@@ -23,6 +23,11 @@ class CompilerImpl;
 class GLImplFactory;
 }  // namespace rx
 
+namespace egl
+{
+class Display;
+}  // namespace egl
+
 namespace gl
 {
 class ShCompilerInstance;
@@ -41,6 +46,7 @@ class Compiler final : public RefCountObjectNoID
 
   private:
     ~Compiler() override;
+    egl::Display *mDisplay;
     std::unique_ptr<rx::CompilerImpl> mImplementation;
     ShShaderSpec mSpec;
     ShShaderOutput mOutputType;
@@ -70,6 +76,43 @@ class ShCompilerInstance final : public angle::NonCopyable
     ShaderType mShaderType;
 };
 
+// Holds the idle translator instances of destroyed compilers, so that contexts created later on the
+// same display reuse them instead of constructing and initializing new translators. Instances are
+// only handed out to compilers with the same spec, output type and resources. All methods must be
+// called with the display global mutex held.
+class CompilerInstanceCache final : angle::NonCopyable
+{
+  public:
+    CompilerInstanceCache();
+    ~CompilerInstanceCache();
+
+    // Returns an instance with a null handle if there is no matching idle instance.
+    ShCompilerInstance take(ShShaderSpec spec,
+                            ShShaderOutput outputType,
+                            const ShBuiltInResources &resources,
+                            ShaderType shaderType);
+    // Moves the instances out of |pools|.
+    void put(ShShaderSpec spec,
+             ShShaderOutput outputType,
+             const ShBuiltInResources &resources,
+             ShaderMap<std::vector<ShCompilerInstance>> *pools);
+
+    // Destroys all the cached instances.
+    void clear();
+
+  private:
+    struct Entry
+    {
+        ShShaderSpec spec;
+        ShShaderOutput outputType;
+        ShBuiltInResources resources;
+        ShaderMap<std::vector<ShCompilerInstance>> pools;
+    };
+
+    // Most recently used last.
+    std::vector<Entry> mEntries;
+};
+
 }  // namespace gl
 
 #endif  // LIBANGLE_COMPILER_H_
@@ -0,0 +1,374 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ConcurrentResourceMap:
+//   A read-mostly variant of ResourceMap. query() and contains() on the flat array may run on
+//   any thread without locking, concurrently with a writer calling assign() or erase(). When the
+//   flat array grows, a new copy is published and the old one is retired rather than freed, so
+//   that readers still holding it remain valid. Because the array grows by powers of two, the
+//   retired copies never take more memory than the live one; they are released with the map.
+//
+//   Handles past the flat array limit fall back to a hash map that is guarded by the writer lock.
+//   Iteration, clear() and empty() must not race with writers.
+//
+
+#ifndef LIBANGLE_CONCURRENT_RESOURCE_MAP_H_
+#define LIBANGLE_CONCURRENT_RESOURCE_MAP_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "libANGLE/angletypes.h"
+
+namespace gl
+{
+
+template <typename ResourceType, typename IDType>
+class ConcurrentResourceMap final : angle::NonCopyable
+{
+  public:
+    ConcurrentResourceMap();
+    ~ConcurrentResourceMap();
+
+    ANGLE_INLINE ResourceType *query(IDType id) const
+    {
+        GLuint handle             = GetIDValue(id);
+        const FlatResources *flat = mFlatResources.load(std::memory_order_acquire);
+        if (handle < flat->size)
+        {
+            ResourceType *value = flat->resources[handle].load(std::memory_order_acquire);
+            return (value == InvalidPointer() ? nullptr : value);
+        }
+        return queryHashed(handle);
+    }
+
+    // Returns true if the handle was reserved. Not necessarily if the resource is created.
+    bool contains(IDType id) const;
+
+    // Returns the element that was at this location.
+    bool erase(IDType id, ResourceType **resourceOut);
+
+    void assign(IDType id, ResourceType *resource);
+
+    // Clears the map.
+    void clear();
+
+    using IndexAndResource = std::pair<GLuint, ResourceType *>;
+    using HashMap          = angle::HashMap<GLuint, ResourceType *>;
+
+    class Iterator final
+    {
+      public:
+        bool operator==(const Iterator &other) const;
+        bool operator!=(const Iterator &other) const;
+        Iterator &operator++();
+        const IndexAndResource *operator->() const;
+        const IndexAndResource &operator*() const;
+
+      private:
+        friend class ConcurrentResourceMap;
+        Iterator(const ConcurrentResourceMap &origin,
+                 GLuint flatIndex,
+                 typename HashMap::const_iterator hashIndex);
+        void updateValue();
+
+        const ConcurrentResourceMap &mOrigin;
+        GLuint mFlatIndex;
+        typename HashMap::const_iterator mHashIndex;
+        IndexAndResource mValue;
+    };
+
+    // null values represent reserved handles, and are skipped.
+    Iterator begin() const;
+    Iterator end() const;
+
+    // Not a constant-time operation, should only be used for verification.
+    bool empty() const;
+
+  private:
+    friend class Iterator;
+
+    struct FlatResources final : angle::NonCopyable
+    {
+        explicit FlatResources(size_t sizeIn);
+
+        size_t size;
+        std::unique_ptr<std::atomic<ResourceType *>[]> resources;
+    };
+
+    ResourceType *queryHashed(GLuint handle) const;
+    GLuint nextResource(size_t flatIndex) const;
+    const FlatResources *currentFlatResources() const { return mFlatAllocations.back().get(); }
+
+    // constexpr methods cannot contain reinterpret_cast, so we need a static method.
+    static ResourceType *InvalidPointer();
+    static constexpr intptr_t kInvalidPointer = static_cast<intptr_t>(-1);
+
+    // Start with 32 maximum elements in the map, which can grow.
+    static constexpr size_t kInitialFlatResourcesSize = 0x20;
+
+    // Experimental testing suggests that 16k is a reasonable upper limit.
+    static constexpr size_t kFlatResourcesLimit = 0x4000;
+
+    // Serializes writers, and guards mHashedResources.
+    mutable std::mutex mWriteMutex;
+
+    // The array readers use. Always the last entry of mFlatAllocations.
+    std::atomic<const FlatResources *> mFlatResources;
+
+    // Every flat array allocated so far, including the retired ones.
+    std::vector<std::unique_ptr<FlatResources>> mFlatAllocations;
+
+    // A map of GL objects indexed by object ID.
+    HashMap mHashedResources;
+};
+
+template <typename ResourceType, typename IDType>
+ConcurrentResourceMap<ResourceType, IDType>::FlatResources::FlatResources(size_t sizeIn)
+    : size(sizeIn), resources(new std::atomic<ResourceType *>[sizeIn])
+{
+    for (size_t index = 0; index < size; ++index)
+    {
+        resources[index].store(InvalidPointer(), std::memory_order_relaxed);
+    }
+}
+
+template <typename ResourceType, typename IDType>
+ConcurrentResourceMap<ResourceType, IDType>::ConcurrentResourceMap()
+{
+    mFlatAllocations.emplace_back(new FlatResources(kInitialFlatResourcesSize));
+    mFlatResources.store(mFlatAllocations.back().get(), std::memory_order_release);
+}
+
+template <typename ResourceType, typename IDType>
+ConcurrentResourceMap<ResourceType, IDType>::~ConcurrentResourceMap()
+{
+    ASSERT(empty());
+}
+
+template <typename ResourceType, typename IDType>
+ANGLE_INLINE bool ConcurrentResourceMap<ResourceType, IDType>::contains(IDType id) const
+{
+    GLuint handle             = GetIDValue(id);
+    const FlatResources *flat = mFlatResources.load(std::memory_order_acquire);
+    if (handle < flat->size)
+    {
+        return (flat->resources[handle].load(std::memory_order_acquire) != InvalidPointer());
+    }
+
+    std::lock_guard<std::mutex> lock(mWriteMutex);
+    return (mHashedResources.find(handle) != mHashedResources.end());
+}
+
+template <typename ResourceType, typename IDType>
+bool ConcurrentResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resourceOut)
+{
+    std::lock_guard<std::mutex> lock(mWriteMutex);
+
+    GLuint handle             = GetIDValue(id);
+    const FlatResources *flat = currentFlatResources();
+    if (handle < flat->size)
+    {
+        ResourceType *value = flat->resources[handle].load(std::memory_order_relaxed);
+        if (value == InvalidPointer())
+        {
+            return false;
+        }
+        *resourceOut = value;
+        flat->resources[handle].store(InvalidPointer(), std::memory_order_release);
+    }
+    else
+    {
+        auto it = mHashedResources.find(handle);
+        if (it == mHashedResources.end())
+        {
+            return false;
+        }
+        *resourceOut = it->second;
+        mHashedResources.erase(it);
+    }
+    return true;
+}
+
+template <typename ResourceType, typename IDType>
+void ConcurrentResourceMap<ResourceType, IDType>::assign(IDType id, ResourceType *resource)
+{
+    std::lock_guard<std::mutex> lock(mWriteMutex);
+
+    GLuint handle = GetIDValue(id);
+    if (handle >= kFlatResourcesLimit)
+    {
+        mHashedResources[handle] = resource;
+        return;
+    }
+
+    const FlatResources *flat = currentFlatResources();
+    if (handle >= flat->size)
+    {
+        // Use power-of-two.
+        size_t newSize = flat->size;
+        while (newSize <= handle)
+        {
+            newSize *= 2;
+        }
+
+        // Writers are serialized, so the old array cannot change while it is being copied.
+        // Readers that loaded it before the new one is published keep seeing consistent values.
+        std::unique_ptr<FlatResources> newFlat(new FlatResources(newSize));
+        for (size_t index = 0; index < flat->size; ++index)
+        {
+            newFlat->resources[index].store(flat->resources[index].load(std::memory_order_relaxed),
+                                            std::memory_order_relaxed);
+        }
+
+        flat = newFlat.get();
+        mFlatAllocations.push_back(std::move(newFlat));
+        mFlatResources.store(flat, std::memory_order_release);
+    }
+
+    ASSERT(flat->size > handle);
+    flat->resources[handle].store(resource, std::memory_order_release);
+}
+
+template <typename ResourceType, typename IDType>
+typename ConcurrentResourceMap<ResourceType, IDType>::Iterator
+ConcurrentResourceMap<ResourceType, IDType>::begin() const
+{
+    return Iterator(*this, nextResource(0), mHashedResources.begin());
+}
+
+template <typename ResourceType, typename IDType>
+typename ConcurrentResourceMap<ResourceType, IDType>::Iterator
+ConcurrentResourceMap<ResourceType, IDType>::end() const
+{
+    return Iterator(*this, static_cast<GLuint>(currentFlatResources()->size),
+                    mHashedResources.end());
+}
+
+template <typename ResourceType, typename IDType>
+bool ConcurrentResourceMap<ResourceType, IDType>::empty() const
+{
+    return (begin() == end());
+}
+
+template <typename ResourceType, typename IDType>
+void ConcurrentResourceMap<ResourceType, IDType>::clear()
+{
+    std::lock_guard<std::mutex> lock(mWriteMutex);
+
+    // Keep the current array so that no more memory needs to be retired.
+    const FlatResources *flat = currentFlatResources();
+    for (size_t index = 0; index < flat->size; ++index)
+    {
+        flat->resources[index].store(InvalidPointer(), std::memory_order_release);
+    }
+    mHashedResources.clear();
+}
+
+template <typename ResourceType, typename IDType>
+ResourceType *ConcurrentResourceMap<ResourceType, IDType>::queryHashed(GLuint handle) const
+{
+    std::lock_guard<std::mutex> lock(mWriteMutex);
+    auto it = mHashedResources.find(handle);
+    return (it == mHashedResources.end() ? nullptr : it->second);
+}
+
+template <typename ResourceType, typename IDType>
+GLuint ConcurrentResourceMap<ResourceType, IDType>::nextResource(size_t flatIndex) const
+{
+    const FlatResources *flat = currentFlatResources();
+    for (size_t index = flatIndex; index < flat->size; index++)
+    {
+        ResourceType *value = flat->resources[index].load(std::memory_order_relaxed);
+        if (value != nullptr && value != InvalidPointer())
+        {
+            return static_cast<GLuint>(index);
+        }
+    }
+    return static_cast<GLuint>(flat->size);
+}
+
+template <typename ResourceType, typename IDType>
+// static
+ResourceType *ConcurrentResourceMap<ResourceType, IDType>::InvalidPointer()
+{
+    return reinterpret_cast<ResourceType *>(kInvalidPointer);
+}
+
+template <typename ResourceType, typename IDType>
+ConcurrentResourceMap<ResourceType, IDType>::Iterator::Iterator(
+    const ConcurrentResourceMap &origin,
+    GLuint flatIndex,
+    typename ConcurrentResourceMap<ResourceType, IDType>::HashMap::const_iterator hashIndex)
+    : mOrigin(origin), mFlatIndex(flatIndex), mHashIndex(hashIndex)
+{
+    updateValue();
+}
+
+template <typename ResourceType, typename IDType>
+bool ConcurrentResourceMap<ResourceType, IDType>::Iterator::operator==(
+    const Iterator &other) const
+{
+    return (mFlatIndex == other.mFlatIndex && mHashIndex == other.mHashIndex);
+}
+
+template <typename ResourceType, typename IDType>
+bool ConcurrentResourceMap<ResourceType, IDType>::Iterator::operator!=(
+    const Iterator &other) const
+{
+    return !(*this == other);
+}
+
+template <typename ResourceType, typename IDType>
+typename ConcurrentResourceMap<ResourceType, IDType>::Iterator &
+ConcurrentResourceMap<ResourceType, IDType>::Iterator::operator++()
+{
+    if (mFlatIndex < static_cast<GLuint>(mOrigin.currentFlatResources()->size))
+    {
+        mFlatIndex = mOrigin.nextResource(mFlatIndex + 1);
+    }
+    else
+    {
+        mHashIndex++;
+    }
+    updateValue();
+    return *this;
+}
+
+template <typename ResourceType, typename IDType>
+const typename ConcurrentResourceMap<ResourceType, IDType>::IndexAndResource *
+ConcurrentResourceMap<ResourceType, IDType>::Iterator::operator->() const
+{
+    return &mValue;
+}
+
+template <typename ResourceType, typename IDType>
+const typename ConcurrentResourceMap<ResourceType, IDType>::IndexAndResource &
+ConcurrentResourceMap<ResourceType, IDType>::Iterator::operator*() const
+{
+    return mValue;
+}
+
+template <typename ResourceType, typename IDType>
+void ConcurrentResourceMap<ResourceType, IDType>::Iterator::updateValue()
+{
+    const FlatResources *flat = mOrigin.currentFlatResources();
+    if (mFlatIndex < static_cast<GLuint>(flat->size))
+    {
+        mValue.first  = mFlatIndex;
+        mValue.second = flat->resources[mFlatIndex].load(std::memory_order_relaxed);
+    }
+    else if (mHashIndex != mOrigin.mHashedResources.end())
+    {
+        mValue.first  = mHashIndex->first;
+        mValue.second = mHashIndex->second;
+    }
+}
+
+}  // namespace gl
+
+#endif  // LIBANGLE_CONCURRENT_RESOURCE_MAP_H_
@@ -11,12 +11,14 @@
 #include "libANGLE/Context.inl.h"
 
 #include <string.h>
+#include <algorithm>
 #include <iterator>
 #include <sstream>
 #include <vector>
 
 #include "common/PackedEnums.h"
 #include "common/angle_version.h"
+#include "common/builtin_tracer.h"
 #include "common/matrix_utils.h"
 #include "common/platform.h"
 #include "common/system_utils.h"
@@ -301,6 +303,52 @@ bool GetSaveAndRestoreState(const egl::AttributeMap &attribs)
     return (attribs.get(EGL_EXTERNAL_CONTEXT_SAVE_STATE_ANGLE, EGL_FALSE) == EGL_TRUE);
 }
 
+#if defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+// An application marker with this message reports the entry point profile through the debug
+// output, one message per entry point called since the last report, most expensive first.
+constexpr char kReportEntryPointProfileMarker[] = "ANGLE_report_entry_point_profile";
+
+void InsertEntryPointProfileMessages(const Debug &debug)
+{
+    angle::EntryPointProfiles profiles;
+    angle::GetAndResetEntryPointProfiles(&profiles);
+
+    std::vector<size_t> calledEntryPoints;
+    for (size_t index = 0; index < profiles.size(); ++index)
+    {
+        if (profiles[index].callCount > 0)
+        {
+            calledEntryPoints.push_back(index);
+        }
+    }
+    std::sort(calledEntryPoints.begin(), calledEntryPoints.end(), [&profiles](size_t a, size_t b) {
+        return profiles[a].totalNanoseconds > profiles[b].totalNanoseconds;
+    });
+
+    for (size_t index : calledEntryPoints)
+    {
+        const angle::EntryPointProfile &profile = profiles[index];
+
+        // Running the same calls on the null backend tells the frontend and backend apart.
+        std::ostringstream message;
+        message << angle::GetEntryPointName(static_cast<angle::EntryPoint>(index))
+                << ": calls = " << profile.callCount
+                << ", total = " << profile.totalNanoseconds / 1000 << "us"
+                << ", validation = " << profile.validationNanoseconds / 1000 << "us"
+                << ", execution = "
+                << (profile.totalNanoseconds - profile.validationNanoseconds) / 1000 << "us";
+
+        debug.insertMessage(GL_DEBUG_SOURCE_THIRD_PARTY, GL_DEBUG_TYPE_PERFORMANCE,
+                            static_cast<GLuint>(index), GL_DEBUG_SEVERITY_NOTIFICATION,
+                            message.str(), gl::LOG_INFO);
+    }
+}
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+
+#if defined(ANGLE_ENABLE_BUILTIN_TRACER)
+// An application marker with this message writes the trace events recorded in process.
+constexpr char kWriteTraceMarker[] = "ANGLE_write_trace";
+#endif  // defined(ANGLE_ENABLE_BUILTIN_TRACER)
 }  // anonymous namespace
 
 thread_local Context *gCurrentValidContext = nullptr;
@@ -353,6 +401,7 @@ Context::Context(egl::Display *display,
       mBufferAccessValidationEnabled(false),
       mExtensionsEnabled(GetExtensionsEnabled(attribs, mWebGLContext)),
       mMemoryProgramCache(memoryProgramCache),
+      mMemoryShaderCache(nullptr),
       mVertexArrayObserverBinding(this, kVertexArraySubjectIndex),
       mDrawFramebufferObserverBinding(this, kDrawFramebufferSubjectIndex),
       mReadFramebufferObserverBinding(this, kReadFramebufferSubjectIndex),
@@ -362,7 +411,9 @@ Context::Context(egl::Display *display,
       mOverlay(mImplementation.get()),
       mIsExternal(GetIsExternal(attribs)),
       mSaveAndRestoreState(GetSaveAndRestoreState(attribs)),
-      mIsCurrent(false)
+      mIsCurrent(false),
+      mRecordDeferredCommands(false),
+      mDiscardDrawCalls(false)
 {
     for (angle::SubjectIndex uboIndex = kUniformBuffer0SubjectIndex;
          uboIndex < kUniformBufferMaxSubjectIndex; ++uboIndex)
@@ -384,6 +435,14 @@ Context::Context(egl::Display *display,
 
     // Implementations now require the display to be set at context creation.
     ASSERT(mDisplay);
+
+#if !defined(ANGLE_FORCE_CONTEXT_CHECK_EVERY_CALL)
+    // Recorded draws are not captured, and bypass the per-call context check.
+    mRecordDeferredCommands =
+        mDisplay->getFrontendFeatures().recordDeferredCommands.enabled && !mFrameCapture->enabled();
+#endif
+
+    mDiscardDrawCalls = mDisplay->getFrontendFeatures().discardDrawCalls.enabled;
 }
 
 egl::Error Context::initialize()
@@ -399,6 +458,14 @@ void Context::initializeDefaultResources()
 
     initCaps();
 
+    // The shader cache shares the blob cache with programs, so it's disabled along with the program
+    // cache by EGL_ANGLE_program_cache_control.
+    if (mDisplay->getFrontendFeatures().cacheTranslatedShaders.enabled &&
+        mState.isProgramBinaryCacheEnabled())
+    {
+        mMemoryShaderCache = mDisplay->getMemoryShaderCache();
+    }
+
     if (mDisplay->getFrontendFeatures().syncFramebufferBindingsOnTexImage.enabled)
     {
         mTexImageDirtyBits.set(State::DIRTY_BIT_READ_FRAMEBUFFER_BINDING);
@@ -597,6 +664,10 @@ void Context::initializeDefaultResources()
 
 egl::Error Context::onDestroy(const egl::Display *display)
 {
+    // The EGL entry points flush the deferred commands of the current context, so any left here
+    // belong to a context that is not current on this thread and are dropped.
+    mDeferredCommands.clear();
+
     // Dump frame capture if enabled.
     mFrameCapture->onDestroyContext(this);
 
@@ -1472,6 +1543,11 @@ void Context::getBooleanvImpl(GLenum pname, GLboolean *params) const
             *params = ConvertToGLBoolean(mRobustAccess);
             break;
 
+        // GL_EXT_sparse_texture
+        case GL_SPARSE_TEXTURE_FULL_ARRAY_CUBE_MIPMAPS_EXT:
+            *params = ConvertToGLBoolean(mState.mCaps.sparseTextureFullArrayCubeMipmaps);
+            break;
+
         default:
             mState.getBooleanv(pname, params);
             break;
@@ -2047,6 +2123,17 @@ void Context::getIntegervImpl(GLenum pname, GLint *params) const
             *params = mState.mClipControlDepth;
             break;
 
+        // GL_EXT_sparse_texture
+        case GL_MAX_SPARSE_TEXTURE_SIZE_EXT:
+            *params = mState.mCaps.maxSparseTextureSize;
+            break;
+        case GL_MAX_SPARSE_3D_TEXTURE_SIZE_EXT:
+            *params = mState.mCaps.maxSparse3DTextureSize;
+            break;
+        case GL_MAX_SPARSE_ARRAY_TEXTURE_LAYERS_EXT:
+            *params = mState.mCaps.maxSparseArrayTextureLayers;
+            break;
+
         default:
             ANGLE_CONTEXT_TRY(mState.getIntegerv(this, pname, params));
             break;
@@ -2086,6 +2173,14 @@ void Context::getInteger64vImpl(GLenum pname, GLint64 *params) const
             *params = mImplementation->getTimestamp();
             break;
 
+        // GL_ANGLE_memory_size
+        case GL_MEMORY_BUDGET_ANGLE:
+            *params = mImplementation->getMemoryBudget();
+            break;
+        case GL_MEMORY_USAGE_ANGLE:
+            *params = mImplementation->getMemoryUsage();
+            break;
+
         case GL_MAX_SHADER_STORAGE_BLOCK_SIZE:
             *params = mState.mCaps.maxShaderStorageBlockSize;
             break;
@@ -3222,6 +3317,18 @@ const GLubyte *Context::getString(GLenum name) const
                 return nullptr;
             }
 
+        case GL_SERIALIZED_CONTEXT_HASHES_STRING_ANGLE:
+            if (angle::SerializeContextToHashString(this, &mCachedSerializedStateHashesString) ==
+                angle::Result::Continue)
+            {
+                return reinterpret_cast<const GLubyte *>(
+                    mCachedSerializedStateHashesString.c_str());
+            }
+            else
+            {
+                return nullptr;
+            }
+
         default:
             UNREACHABLE();
             return nullptr;
@@ -3421,6 +3528,7 @@ Extensions Context::generateSupportedExtensions() const
         // Disable ES3.1+ extensions
         supportedExtensions.geometryShader        = false;
         supportedExtensions.tessellationShaderEXT = false;
+        supportedExtensions.sparseTextureEXT      = false;
 
         // TODO(http://anglebug.com/2775): Multisample arrays could be supported on ES 3.0 as well
         // once 2D multisample texture extension is exposed there.
@@ -3965,6 +4073,11 @@ void Context::updateCaps()
     mStateCache.initialize(this);
 }
 
+void Context::flushDeferredCommands()
+{
+    mDeferredCommands.replay(this);
+}
+
 bool Context::noopDrawInstanced(PrimitiveMode mode, GLsizei count, GLsizei instanceCount) const
 {
     return (instanceCount == 0) || noopDraw(mode, count);
@@ -5823,6 +5936,23 @@ void Context::debugMessageInsert(GLenum source,
                                  const GLchar *buf)
 {
     std::string msg(buf, (length > 0) ? static_cast<size_t>(length) : strlen(buf));
+
+#if defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+    if (type == GL_DEBUG_TYPE_MARKER && msg == kReportEntryPointProfileMarker)
+    {
+        InsertEntryPointProfileMessages(mState.getDebug());
+        return;
+    }
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+
+#if defined(ANGLE_ENABLE_BUILTIN_TRACER)
+    if (type == GL_DEBUG_TYPE_MARKER && msg == kWriteTraceMarker)
+    {
+        angle::WriteBuiltinTrace();
+        return;
+    }
+#endif  // defined(ANGLE_ENABLE_BUILTIN_TRACER)
+
     mState.getDebug().insertMessage(source, type, id, severity, std::move(msg), gl::LOG_INFO);
 }
 
@@ -6438,6 +6568,12 @@ void Context::multiDrawElementsInstancedBaseVertexBaseInstance(PrimitiveMode mod
         this, mode, counts, type, indices, instanceCounts, baseVertices, baseInstances, drawcount));
 }
 
+void Context::prewarmDrawState(PrimitiveMode mode)
+{
+    ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_CONTEXT_TRY(mImplementation->prewarmDrawState(this, mode));
+}
+
 void Context::provokingVertex(ProvokingVertexConvention provokeMode)
 {
     mState.setProvokingVertex(provokeMode);
@@ -7719,7 +7855,7 @@ void Context::getInternalformativ(GLenum target,
                                   GLint *params)
 {
     const TextureCaps &formatCaps = mState.mTextureCaps.get(internalformat);
-    QueryInternalFormativ(formatCaps, pname, bufSize, params);
+    QueryInternalFormativ(target, formatCaps, pname, bufSize, params);
 }
 
 void Context::getInternalformativRobust(GLenum target,
@@ -8546,6 +8682,21 @@ void Context::framebufferFetchBarrier()
     mImplementation->framebufferFetchBarrier();
 }
 
+void Context::texPageCommitment(TextureType targetPacked,
+                                GLint level,
+                                GLint xoffset,
+                                GLint yoffset,
+                                GLint zoffset,
+                                GLsizei width,
+                                GLsizei height,
+                                GLsizei depth,
+                                GLboolean commit)
+{
+    Texture *texture = getTextureByType(targetPacked);
+    Box area(xoffset, yoffset, zoffset, width, height, depth);
+    ANGLE_CONTEXT_TRY(texture->setPageCommitment(this, level, area, ConvertToBool(commit)));
+}
+
 void Context::texStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
 {
     UNIMPLEMENTED();
@@ -8979,6 +9130,12 @@ void Context::dirtyAllState()
     mState.setAllDirtyObjects();
 }
 
+void Context::dirtyStateDifferingFrom(const Context *previousContext)
+{
+    mState.setDirtyBitsDifferingFrom(previousContext->getState());
+    mState.setAllDirtyObjects();
+}
+
 // ErrorSet implementation.
 ErrorSet::ErrorSet(Context *context) : mContext(context) {}
 
@@ -9040,8 +9197,11 @@ StateCache::StateCache()
     : mCachedHasAnyEnabledClientAttrib(false),
       mCachedNonInstancedVertexElementLimit(0),
       mCachedInstancedVertexElementLimit(0),
+      mCachedVertexElementLimitsDirty(false),
       mCachedBasicDrawStatesError(kInvalidPointer),
       mCachedBasicDrawElementsError(kInvalidPointer),
+      mCachedValidatedDrawModes(0),
+      mCachedValidatedDrawElementsTypes(0),
       mCachedTransformFeedbackActiveUnpaused(false),
       mCachedCanDraw(false)
 {
@@ -9054,7 +9214,7 @@ ANGLE_INLINE void StateCache::updateVertexElementLimits(Context *context)
 {
     if (context->isBufferAccessValidationEnabled())
     {
-        updateVertexElementLimitsImpl(context);
+        mCachedVertexElementLimitsDirty = true;
     }
 }
 
@@ -9099,7 +9259,7 @@ void StateCache::updateActiveAttribsMask(Context *context)
     mCachedHasAnyEnabledClientAttrib = (clientAttribs & enabledAttribs).any();
 }
 
-void StateCache::updateVertexElementLimitsImpl(Context *context)
+void StateCache::updateVertexElementLimitsImpl(const Context *context) const
 {
     ASSERT(context->isBufferAccessValidationEnabled());
 
@@ -9107,6 +9267,7 @@ void StateCache::updateVertexElementLimitsImpl(Context *context)
 
     mCachedNonInstancedVertexElementLimit = std::numeric_limits<GLint64>::max();
     mCachedInstancedVertexElementLimit    = std::numeric_limits<GLint64>::max();
+    mCachedVertexElementLimitsDirty       = false;
 
     // VAO can be null on Context startup. If we make this computation lazier we could ASSERT.
     // If there are no buffered attributes then we should not limit the draw call count.
@@ -9143,17 +9304,54 @@ void StateCache::updateVertexElementLimitsImpl(Context *context)
 void StateCache::updateBasicDrawStatesError()
 {
     mCachedBasicDrawStatesError = kInvalidPointer;
+    mCachedValidatedDrawModes   = 0;
 }
 
 void StateCache::updateBasicDrawElementsError()
 {
-    mCachedBasicDrawElementsError = kInvalidPointer;
+    mCachedBasicDrawElementsError     = kInvalidPointer;
+    mCachedValidatedDrawElementsTypes = 0;
+}
+
+void StateCache::updateValidatedDrawModes() const
+{
+    mCachedValidatedDrawModes = 0;
+    if (mCachedBasicDrawStatesError != 0)
+    {
+        return;
+    }
+
+    for (PrimitiveMode mode : angle::AllEnums<PrimitiveMode>())
+    {
+        if (mCachedValidDrawModes[mode])
+        {
+            mCachedValidatedDrawModes |= 1u << static_cast<uint32_t>(mode);
+        }
+    }
+}
+
+void StateCache::updateValidatedDrawElementsTypes() const
+{
+    mCachedValidatedDrawElementsTypes = 0;
+    if (mCachedBasicDrawElementsError != 0)
+    {
+        return;
+    }
+
+    for (DrawElementsType type : angle::AllEnums<DrawElementsType>())
+    {
+        if (mCachedValidDrawElementsTypes[type])
+        {
+            mCachedValidatedDrawElementsTypes |= 1u << static_cast<uint32_t>(type);
+        }
+    }
 }
 
 intptr_t StateCache::getBasicDrawStatesErrorImpl(const Context *context) const
 {
     ASSERT(mCachedBasicDrawStatesError == kInvalidPointer);
     mCachedBasicDrawStatesError = reinterpret_cast<intptr_t>(ValidateDrawStates(context));
+    updateValidatedDrawModes();
     return mCachedBasicDrawStatesError;
 }
 
@@ -9161,6 +9359,7 @@ intptr_t StateCache::getBasicDrawElementsErrorImpl(const Context *context) const
 {
     ASSERT(mCachedBasicDrawElementsError == kInvalidPointer);
     mCachedBasicDrawElementsError = reinterpret_cast<intptr_t>(ValidateDrawElementsStates(context));
+    updateValidatedDrawElementsTypes();
     return mCachedBasicDrawElementsError;
 }
 
@@ -9288,6 +9487,12 @@ void StateCache::setValidDrawModes(bool pointsOK,
 }
 
 void StateCache::updateValidDrawModes(Context *context)
+{
+    updateValidDrawModesImpl(context);
+    updateValidatedDrawModes();
+}
+
+void StateCache::updateValidDrawModesImpl(Context *context)
 {
     const State &state = context->getState();
 
@@ -9371,6 +9576,7 @@ void StateCache::updateValidDrawElementsTypes(Context *context)
         {DrawElementsType::UnsignedShort, true},
         {DrawElementsType::UnsignedInt, supportsUint},
     }};
+    updateValidatedDrawElementsTypes();
 }
 
 void StateCache::updateTransformFeedbackActiveUnpaused(Context *context)
@@ -30,6 +30,7 @@
 #include "libANGLE/Context_gles_3_1_autogen.h"
 #include "libANGLE/Context_gles_3_2_autogen.h"
 #include "libANGLE/Context_gles_ext_autogen.h"
+#include "libANGLE/DeferredCommands.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/RefCountObject.h"
@@ -68,6 +69,7 @@ class FenceNV;
 class Framebuffer;
 class GLES1Renderer;
 class MemoryProgramCache;
+class MemoryShaderCache;
 class MemoryObject;
 class Program;
 class ProgramPipeline;
@@ -138,11 +140,24 @@ class StateCache final : angle::NonCopyable
     // 3. onVertexArrayFormatChange.
     // 4. onVertexArrayBufferChange.
     // 5. onVertexArrayStateChange.
-    GLint64 getNonInstancedVertexElementLimit() const
+    // The limits are only marked dirty there, and are recomputed from the per-attribute limits
+    // cached in the VertexAttributes on the first draw that reads them.
+    GLint64 getNonInstancedVertexElementLimit(const Context *context) const
     {
+        if (mCachedVertexElementLimitsDirty)
+        {
+            updateVertexElementLimitsImpl(context);
+        }
         return mCachedNonInstancedVertexElementLimit;
     }
-    GLint64 getInstancedVertexElementLimit() const { return mCachedInstancedVertexElementLimit; }
+    GLint64 getInstancedVertexElementLimit(const Context *context) const
+    {
+        if (mCachedVertexElementLimitsDirty)
+        {
+            updateVertexElementLimitsImpl(context);
+        }
+        return mCachedInstancedVertexElementLimit;
+    }
 
     // Places that can trigger updateBasicDrawStatesError:
     // 1. onVertexArrayBindingChange.
@@ -208,6 +223,22 @@ class StateCache final : angle::NonCopyable
         return mCachedValidDrawModes[primitiveMode];
     }
 
+    // Draw validation fast path. A set bit means the basic draw states are known to be valid and
+    // the draw mode is valid, so ValidateDrawBase has nothing left to check. Cleared by every
+    // place that triggers updateBasicDrawStatesError or updateValidDrawModes, and filled again by
+    // the first draw that recomputes the basic draw states error.
+    bool isDrawModeValidated(PrimitiveMode primitiveMode) const
+    {
+        return (mCachedValidatedDrawModes >> static_cast<uint32_t>(primitiveMode)) & 1u;
+    }
+
+    // Same as above for ValidateDrawElementsBase. Cleared by every place that triggers
+    // updateBasicDrawElementsError.
+    bool isDrawElementsTypeValidated(DrawElementsType type) const
+    {
+        return (mCachedValidatedDrawElementsTypes >> static_cast<uint32_t>(type)) & 1u;
+    }
+
     // Cannot change except on Context/Extension init.
     bool isValidBindTextureType(TextureType type) const
     {
@@ -277,12 +308,15 @@ class StateCache final : angle::NonCopyable
     // Cache update functions.
     void updateActiveAttribsMask(Context *context);
     void updateVertexElementLimits(Context *context);
-    void updateVertexElementLimitsImpl(Context *context);
+    void updateVertexElementLimitsImpl(const Context *context) const;
     void updateValidDrawModes(Context *context);
+    void updateValidDrawModesImpl(Context *context);
     void updateValidBindTextureTypes(Context *context);
     void updateValidDrawElementsTypes(Context *context);
     void updateBasicDrawStatesError();
     void updateBasicDrawElementsError();
+    void updateValidatedDrawModes() const;
+    void updateValidatedDrawElementsTypes() const;
     void updateTransformFeedbackActiveUnpaused(Context *context);
     void updateVertexAttribTypesValidation(Context *context);
     void updateActiveShaderStorageBufferIndices(Context *context);
@@ -305,10 +339,14 @@ class StateCache final : angle::NonCopyable
     AttributesMask mCachedActiveClientAttribsMask;
     AttributesMask mCachedActiveDefaultAttribsMask;
     bool mCachedHasAnyEnabledClientAttrib;
-    GLint64 mCachedNonInstancedVertexElementLimit;
-    GLint64 mCachedInstancedVertexElementLimit;
+    mutable GLint64 mCachedNonInstancedVertexElementLimit;
+    mutable GLint64 mCachedInstancedVertexElementLimit;
+    mutable bool mCachedVertexElementLimitsDirty;
     mutable intptr_t mCachedBasicDrawStatesError;
     mutable intptr_t mCachedBasicDrawElementsError;
+    // Bit masks indexed by PrimitiveMode and DrawElementsType. The InvalidEnum bits are never set.
+    mutable uint32_t mCachedValidatedDrawModes;
+    mutable uint32_t mCachedValidatedDrawElementsTypes;
     bool mCachedTransformFeedbackActiveUnpaused;
     StorageBuffersMask mCachedActiveShaderStorageBufferIndices;
     ImageUnitMask mCachedActiveImageUnitIndices;
@@ -489,6 +527,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     angle::Result prepareForDispatch();
 
     MemoryProgramCache *getMemoryProgramCache() const { return mMemoryProgramCache; }
+    MemoryShaderCache *getMemoryShaderCache() const { return mMemoryShaderCache; }
     std::mutex &getProgramCacheMutex() const;
 
     bool hasBeenCurrent() const { return mHasBeenCurrent; }
@@ -509,6 +548,28 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     // Once a context is setShared() it cannot be undone
     void setShared() { mShared = true; }
 
+    // Draw calls recorded by the entry points instead of executed, see DeferredCommands.h. The
+    // recording happens without taking any lock, so shared contexts never record.
+    bool isRecordingDeferredCommands() const { return mRecordDeferredCommands && !mShared; }
+    bool hasDeferredCommands() const { return !mDeferredCommands.empty(); }
+    void flushDeferredCommands();
+
+    // Return false if the draw could not be recorded and has to run now.
+    bool recordDrawArrays(PrimitiveMode mode, GLint first, GLsizei count);
+    bool recordDrawArraysInstanced(PrimitiveMode mode,
+                                   GLint first,
+                                   GLsizei count,
+                                   GLsizei instanceCount);
+    bool recordDrawElements(PrimitiveMode mode,
+                            GLsizei count,
+                            DrawElementsType type,
+                            const void *indices);
+    bool recordDrawElementsInstanced(PrimitiveMode mode,
+                                     GLsizei count,
+                                     DrawElementsType type,
+                                     const void *indices,
+                                     GLsizei instanceCount);
+
     const State &getState() const { return mState; }
     GLint getClientMajorVersion() const { return mState.getClientMajorVersion(); }
     GLint getClientMinorVersion() const { return mState.getClientMinorVersion(); }
@@ -620,11 +681,15 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
 
     bool supportsGeometryOrTesselation() const;
     void dirtyAllState();
+    // Like dirtyAllState, but leaves the state values that are equal in |previousContext| clean.
+    void dirtyStateDifferingFrom(const Context *previousContext);
 
   private:
     void initializeDefaultResources();
 
     angle::Result prepareForDraw(PrimitiveMode mode);
+    bool canDeferDraw(bool indexed) const;
+    void onDeferredDrawRecorded();
     angle::Result prepareForClear(GLbitfield mask);
     angle::Result prepareForClearBuffer(GLenum buffer, GLint drawbuffer);
     angle::Result syncState(const State::DirtyBits &bitMask,
@@ -746,6 +811,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool mBufferAccessValidationEnabled;
     const bool mExtensionsEnabled;
     MemoryProgramCache *mMemoryProgramCache;
+    MemoryShaderCache *mMemoryShaderCache;
 
     State::DirtyObjects mDrawDirtyObjects;
 
@@ -784,6 +850,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
 
     // Cache representation of the serialized context string.
     mutable std::string mCachedSerializedStateString;
+    mutable std::string mCachedSerializedStateHashesString;
 
     mutable size_t mRefCount;
 
@@ -793,6 +860,11 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     const bool mSaveAndRestoreState;
 
     bool mIsCurrent;
+
+    bool mRecordDeferredCommands;
+    DeferredCommands mDeferredCommands;
+
+    bool mDiscardDrawCalls;
 };
 
 // Thread-local current valid context bound to the thread.
@@ -116,7 +116,10 @@ ANGLE_INLINE angle::Result Context::prepareForDraw(PrimitiveMode mode)
     ANGLE_TRY(syncDirtyObjects(mDrawDirtyObjects, Command::Draw));
     ASSERT(!isRobustResourceInitEnabled() ||
            !mState.getDrawFramebuffer()->hasResourceThatNeedsInit());
-    return syncDirtyBits();
+    ANGLE_TRY(syncDirtyBits());
+
+    // Stopping without an error makes the draw call return before reaching the back end.
+    return ANGLE_UNLIKELY(mDiscardDrawCalls) ? angle::Result::Stop : angle::Result::Continue;
 }
 
 ANGLE_INLINE void Context::drawArrays(PrimitiveMode mode, GLint first, GLsizei count)
@@ -147,6 +150,82 @@ ANGLE_INLINE void Context::drawElements(PrimitiveMode mode,
     ANGLE_CONTEXT_TRY(mImplementation->drawElements(this, mode, count, type, indices));
 }
 
+ANGLE_INLINE bool Context::canDeferDraw(bool indexed) const
+{
+    // Client memory can change as soon as the call returns, so those draws have to run now.
+    if (mStateCache.hasAnyEnabledClientAttrib())
+    {
+        return false;
+    }
+    return !indexed || mState.getVertexArray()->getElementArrayBuffer() != nullptr;
+}
+
+ANGLE_INLINE void Context::onDeferredDrawRecorded()
+{
+    if (mDeferredCommands.full())
+    {
+        flushDeferredCommands();
+    }
+}
+
+ANGLE_INLINE bool Context::recordDrawArrays(PrimitiveMode mode, GLint first, GLsizei count)
+{
+    if (!canDeferDraw(false))
+    {
+        return false;
+    }
+
+    mDeferredCommands.recordDrawArrays(mode, first, count);
+    onDeferredDrawRecorded();
+    return true;
+}
+
+ANGLE_INLINE bool Context::recordDrawArraysInstanced(PrimitiveMode mode,
+                                                     GLint first,
+                                                     GLsizei count,
+                                                     GLsizei instanceCount)
+{
+    if (!canDeferDraw(false))
+    {
+        return false;
+    }
+
+    mDeferredCommands.recordDrawArraysInstanced(mode, first, count, instanceCount);
+    onDeferredDrawRecorded();
+    return true;
+}
+
+ANGLE_INLINE bool Context::recordDrawElements(PrimitiveMode mode,
+                                              GLsizei count,
+                                              DrawElementsType type,
+                                              const void *indices)
+{
+    if (!canDeferDraw(true))
+    {
+        return false;
+    }
+
+    mDeferredCommands.recordDrawElements(mode, count, type, indices);
+    onDeferredDrawRecorded();
+    return true;
+}
+
+ANGLE_INLINE bool Context::recordDrawElementsInstanced(PrimitiveMode mode,
+                                                       GLsizei count,
+                                                       DrawElementsType type,
+                                                       const void *indices,
+                                                       GLsizei instanceCount)
+{
+    if (!canDeferDraw(true))
+    {
+        return false;
+    }
+
+    mDeferredCommands.recordDrawElementsInstanced(mode, count, type, indices, instanceCount);
+    onDeferredDrawRecorded();
+    return true;
+}
+
 ANGLE_INLINE void StateCache::onBufferBindingChange(Context *context)
 {
     updateBasicDrawStatesError();
@@ -94,6 +94,8 @@
     void multiDrawElementsInstanced(PrimitiveMode modePacked, const GLsizei *counts,               \
                                     DrawElementsType typePacked, const GLvoid *const *indices,     \
                                     const GLsizei *instanceCounts, GLsizei drawcount);             \
+    /* GL_ANGLE_prewarm_draw_state */                                                              \
+    void prewarmDrawState(PrimitiveMode modePacked);                                               \
     /* GL_ANGLE_provoking_vertex */                                                                \
     void provokingVertex(ProvokingVertexConvention modePacked);                                    \
     /* GL_ANGLE_semaphore_fuchsia */                                                               \
@@ -206,6 +208,10 @@
     /* GL_EXT_shader_framebuffer_fetch_non_coherent */                                             \
     void framebufferFetchBarrier();                                                                \
     /* GL_EXT_shader_io_blocks */                                                                  \
+    /* GL_EXT_sparse_texture */                                                                    \
+    void texPageCommitment(TextureType targetPacked, GLint level, GLint xoffset, GLint yoffset,    \
+                           GLint zoffset, GLsizei width, GLsizei height, GLsizei depth,            \
+                           GLboolean commit);                                                      \
     /* GL_EXT_tessellation_shader */                                                               \
     /* GL_EXT_texture_border_clamp */                                                              \
     /* GL_EXT_texture_buffer */                                                                    \
@@ -0,0 +1,87 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DeferredCommands.cpp:
+//   Implements the replay of draw calls recorded by the entry points.
+//
+
+#include "libANGLE/DeferredCommands.h"
+
+#include "libANGLE/Context.h"
+#include "libANGLE/Context.inl.h"
+#include "libANGLE/validationES2.h"
+#include "libANGLE/validationES3.h"
+
+namespace gl
+{
+DeferredCommands::DeferredCommands()
+{
+    mCommands.reserve(kMaxCommands);
+}
+
+DeferredCommands::~DeferredCommands() = default;
+
+void DeferredCommands::replay(Context *context)
+{
+    const bool skipValidation = context->skipValidation();
+
+    for (const DeferredCommand &command : mCommands)
+    {
+        // A draw may lose the context, in which case the remaining ones are dropped like any call
+        // made on a lost context.
+        if (context->isContextLost())
+        {
+            break;
+        }
+
+        switch (command.id)
+        {
+            case DeferredCommandID::DrawArrays:
+                if (skipValidation ||
+                    ValidateDrawArrays(context, command.mode, command.first, command.count))
+                {
+                    context->drawArrays(command.mode, command.first, command.count);
+                }
+                break;
+
+            case DeferredCommandID::DrawArraysInstanced:
+                if (skipValidation ||
+                    ValidateDrawArraysInstanced(context, command.mode, command.first,
+                                                command.count, command.instanceCount))
+                {
+                    context->drawArraysInstanced(command.mode, command.first, command.count,
+                                                 command.instanceCount);
+                }
+                break;
+
+            case DeferredCommandID::DrawElements:
+                if (skipValidation || ValidateDrawElements(context, command.mode, command.count,
+                                                           command.type, command.indices))
+                {
+                    context->drawElements(command.mode, command.count, command.type,
+                                          command.indices);
+                }
+                break;
+
+            case DeferredCommandID::DrawElementsInstanced:
+                if (skipValidation ||
+                    ValidateDrawElementsInstanced(context, command.mode, command.count,
+                                                  command.type, command.indices,
+                                                  command.instanceCount))
+                {
+                    context->drawElementsInstanced(command.mode, command.count, command.type,
+                                                   command.indices, command.instanceCount);
+                }
+                break;
+
+            default:
+                UNREACHABLE();
+                break;
+        }
+    }
+
+    mCommands.clear();
+}
+}  // namespace gl
@@ -0,0 +1,105 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DeferredCommands.h:
+//   A per-context list of packed draw calls recorded by the entry points when the
+//   recordDeferredCommands frontend feature is enabled. The commands are validated and executed
+//   in bulk the next time any other GL or EGL call reaches the context.
+//
+//   Only draws that read nothing from client memory are recorded. Every call that is not recorded
+//   replays the list first, so the GL state a recorded draw sees at replay time is the state it
+//   was recorded with. Errors are generated at replay time, before the call that flushed them.
+//
+
+#ifndef LIBANGLE_DEFERRED_COMMANDS_H_
+#define LIBANGLE_DEFERRED_COMMANDS_H_
+
+#include <vector>
+
+#include "common/PackedEnums.h"
+#include "common/angleutils.h"
+
+namespace gl
+{
+class Context;
+
+enum class DeferredCommandID : uint8_t
+{
+    DrawArrays,
+    DrawArraysInstanced,
+    DrawElements,
+    DrawElementsInstanced,
+};
+
+struct DeferredCommand
+{
+    DeferredCommandID id;
+    PrimitiveMode mode;
+    DrawElementsType type;
+    // The first vertex of array draws, unused otherwise.
+    GLint first;
+    GLsizei count;
+    GLsizei instanceCount;
+    // The offset into the element array buffer of indexed draws, unused otherwise.
+    const void *indices;
+};
+
+class DeferredCommands final : angle::NonCopyable
+{
+  public:
+    DeferredCommands();
+    ~DeferredCommands();
+
+    bool empty() const { return mCommands.empty(); }
+    bool full() const { return mCommands.size() >= kMaxCommands; }
+
+    void recordDrawArrays(PrimitiveMode mode, GLint first, GLsizei count)
+    {
+        mCommands.push_back({DeferredCommandID::DrawArrays, mode, DrawElementsType::InvalidEnum,
+                             first, count, 0, nullptr});
+    }
+
+    void recordDrawArraysInstanced(PrimitiveMode mode,
+                                   GLint first,
+                                   GLsizei count,
+                                   GLsizei instanceCount)
+    {
+        mCommands.push_back({DeferredCommandID::DrawArraysInstanced, mode,
+                             DrawElementsType::InvalidEnum, first, count, instanceCount, nullptr});
+    }
+
+    void recordDrawElements(PrimitiveMode mode,
+                            GLsizei count,
+                            DrawElementsType type,
+                            const void *indices)
+    {
+        mCommands.push_back({DeferredCommandID::DrawElements, mode, type, 0, count, 0, indices});
+    }
+
+    void recordDrawElementsInstanced(PrimitiveMode mode,
+                                     GLsizei count,
+                                     DrawElementsType type,
+                                     const void *indices,
+                                     GLsizei instanceCount)
+    {
+        mCommands.push_back({DeferredCommandID::DrawElementsInstanced, mode, type, 0, count,
+                             instanceCount, indices});
+    }
+
+    // Validates and executes the recorded commands in order, then empties the list.
+    void replay(Context *context);
+
+    void clear() { mCommands.clear(); }
+
+  private:
+    // Bounds the latency of recorded draws and the memory they use. The storage is reserved
+    // upfront and reused, so recording never allocates.
+    static constexpr size_t kMaxCommands = 256;
+
+    std::vector<DeferredCommand> mCommands;
+};
+}  // namespace gl
+
+#endif  // LIBANGLE_DEFERRED_COMMANDS_H_
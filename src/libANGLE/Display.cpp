@@ -14,6 +14,7 @@
 #include <iterator>
 #include <map>
 #include <sstream>
+#include <tuple>
 #include <vector>
 
 #include <EGL/eglext.h>
@@ -39,6 +40,7 @@
 #include "libANGLE/Thread.h"
 #include "libANGLE/capture/FrameCapture.h"
 #include "libANGLE/histogram_macros.h"
+#include "libANGLE/histogram_registry.h"
 #include "libANGLE/renderer/DeviceImpl.h"
 #include "libANGLE/renderer/DisplayImpl.h"
 #include "libANGLE/renderer/ImageImpl.h"
@@ -99,7 +101,31 @@ static WindowSurfaceMap *GetWindowSurfaces()
     return windowSurfaces.get();
 }
 
-typedef std::map<EGLNativeDisplayType, Display *> ANGLEPlatformDisplayMap;
+// Displays of the same native display that select different devices are separate, so that one
+// process can render on several GPUs.
+struct ANGLEPlatformDisplay
+{
+    ANGLEPlatformDisplay(EGLNativeDisplayType nativeDisplay, const AttributeMap &attribMap)
+        : nativeDisplay(nativeDisplay),
+          deviceIdHigh(attribMap.get(EGL_PLATFORM_ANGLE_DEVICE_ID_HIGH_ANGLE, 0)),
+          deviceIdLow(attribMap.get(EGL_PLATFORM_ANGLE_DEVICE_ID_LOW_ANGLE, 0)),
+          deviceIndex(attribMap.get(EGL_PLATFORM_ANGLE_DEVICE_INDEX_ANGLE, 0))
+    {}
+
+    bool operator<(const ANGLEPlatformDisplay &other) const
+    {
+        return std::tie(nativeDisplay, deviceIdHigh, deviceIdLow, deviceIndex) <
+               std::tie(other.nativeDisplay, other.deviceIdHigh, other.deviceIdLow,
+                        other.deviceIndex);
+    }
+
+    EGLNativeDisplayType nativeDisplay;
+    EGLAttrib deviceIdHigh;
+    EGLAttrib deviceIdLow;
+    EGLAttrib deviceIndex;
+};
+
+typedef std::map<ANGLEPlatformDisplay, Display *> ANGLEPlatformDisplayMap;
 static ANGLEPlatformDisplayMap *GetANGLEPlatformDisplayMap()
 {
     static angle::base::NoDestructor<ANGLEPlatformDisplayMap> displays;
@@ -495,6 +521,7 @@ static constexpr uint32_t kScratchBufferLifetime = 64u;
 // ShareGroup
 ShareGroup::ShareGroup(rx::EGLImplFactory *factory)
     : mRefCount(1),
+      mMutex(std::make_shared<std::recursive_mutex>()),
       mImplementation(factory->createShareGroup()),
       mFrameCaptureShared(new angle::FrameCaptureShared)
 {}
@@ -569,8 +596,10 @@ Display *Display::GetDisplayFromNativeDisplay(EGLNativeDisplayType nativeDisplay
 {
     Display *display = nullptr;
 
+    const ANGLEPlatformDisplay key(nativeDisplay, attribMap);
+
     ANGLEPlatformDisplayMap *displays = GetANGLEPlatformDisplayMap();
-    const auto &iter                  = displays->find(nativeDisplay);
+    const auto &iter                  = displays->find(key);
     if (iter != displays->end())
     {
         display = iter->second;
@@ -585,7 +614,7 @@ Display *Display::GetDisplayFromNativeDisplay(EGLNativeDisplayType nativeDisplay
         }
 
         display = new Display(EGL_PLATFORM_ANGLE_ANGLE, nativeDisplay, nullptr);
-        displays->insert(std::make_pair(nativeDisplay, display));
+        displays->insert(std::make_pair(key, display));
     }
 
     // Apply new attributes if the display is not initialized yet.
@@ -621,15 +650,17 @@ Display *Display::GetDisplayFromNativeDisplay(EGLNativeDisplayType nativeDisplay
 Display *Display::GetExistingDisplayFromNativeDisplay(EGLNativeDisplayType nativeDisplay)
 {
     ANGLEPlatformDisplayMap *displays = GetANGLEPlatformDisplayMap();
-    const auto &iter                  = displays->find(nativeDisplay);
 
-    // Check that there is a matching display
-    if (iter == displays->end())
+    // Return the first display of the native display, whichever device it selects.
+    for (const auto &displayPair : *displays)
     {
-        return nullptr;
+        if (displayPair.first.nativeDisplay == nativeDisplay)
+        {
+            return displayPair.second;
+        }
     }
 
-    return iter->second;
+    return nullptr;
 }
 
 // static
@@ -702,6 +733,7 @@ Display::Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDe
       mSemaphoreManager(nullptr),
       mBlobCache(gl::kDefaultMaxProgramCacheMemoryBytes),
       mMemoryProgramCache(mBlobCache),
+      mMemoryShaderCache(mBlobCache, mProgramCacheMutex),
       mGlobalTextureShareGroupUsers(0),
       mGlobalSemaphoreShareGroupUsers(0)
 {}
@@ -713,11 +745,15 @@ Display::~Display()
 
     if (mPlatform == EGL_PLATFORM_ANGLE_ANGLE)
     {
-        ANGLEPlatformDisplayMap *displays      = GetANGLEPlatformDisplayMap();
-        ANGLEPlatformDisplayMap::iterator iter = displays->find(mState.displayId);
-        if (iter != displays->end())
+        ANGLEPlatformDisplayMap *displays = GetANGLEPlatformDisplayMap();
+        for (ANGLEPlatformDisplayMap::iterator iter = displays->begin(); iter != displays->end();
+             ++iter)
         {
-            displays->erase(iter);
+            if (iter->second == this)
+            {
+                displays->erase(iter);
+                break;
+            }
         }
     }
     else if (mPlatform == EGL_PLATFORM_DEVICE_EXT)
@@ -869,6 +905,10 @@ Error Display::initialize()
         initializeFrontendFeatures();
     }
 
+    mBlobCache.setCodec(mFrontendFeatures.fastBlobCacheCompression.enabled
+                            ? egl::BlobCacheCodec::FastDeflate
+                            : egl::BlobCacheCodec::Gzip);
+
     mFeatures.clear();
     mFrontendFeatures.populateFeatureList(&mFeatures);
     mImplementation->populateFeatureList(&mFeatures);
@@ -925,6 +965,12 @@ Error Display::terminate(const Thread *thread)
 
     ANGLE_TRY(makeCurrent(thread->getContext(), nullptr, nullptr, nullptr));
 
+    // All the compilers were destroyed with the contexts, release the instances they left behind.
+    {
+        std::lock_guard<std::mutex> lock(mDisplayGlobalMutex);
+        mCompilerInstanceCache.clear();
+    }
+
     // The global texture and semaphore managers should be deleted with the last context that uses
     // it.
     ASSERT(mGlobalTextureShareGroupUsers == 0 && mTextureManager == nullptr);
@@ -1665,7 +1711,8 @@ static ClientExtensions GenerateClientExtensions()
 #endif
 
 #if defined(ANGLE_ENABLE_VULKAN)
-    extensions.platformANGLEVulkan = true;
+    extensions.platformANGLEVulkan   = true;
+    extensions.platformANGLEDeviceId = true;
 #endif
 
 #if defined(ANGLE_ENABLE_SWIFTSHADER)
@@ -1697,6 +1744,7 @@ static ClientExtensions GenerateClientExtensions()
     extensions.debug                     = true;
     extensions.explicitContext           = true;
     extensions.featureControlANGLE       = true;
+    extensions.histogramQueryANGLE       = true;
     extensions.deviceQueryEXT            = true;
 
     return extensions;
@@ -1858,13 +1906,25 @@ void Display::initializeFrontendFeatures()
     // No longer enable this on any Impl - crbug.com/1165751
     ANGLE_FEATURE_CONDITION((&mFrontendFeatures), scalarizeVecAndMatConstructorArgs, false);
 
-    mImplementation->initializeFrontendFeatures(&mFrontendFeatures);
-
-    rx::ApplyFeatureOverrides(&mFrontendFeatures, mState);
-
     // Disabled by default. To reduce the risk, create a feature to enable
     // compressing pipeline cache in multi-thread pool.
     ANGLE_FEATURE_CONDITION(&mFrontendFeatures, enableCompressingPipelineCacheInThreadPool, false);
+
+    // Opt-in, it changes when draw call errors are generated.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, recordDeferredCommands, false);
+
+    // Opt-in, cached shaders take up room in the blob cache otherwise used by programs.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, cacheTranslatedShaders, false);
+
+    // Testing only, nothing is rendered.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, discardDrawCalls, false);
+
+    // Opt-in, entries compressed with it take more room in the blob cache.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, fastBlobCacheCompression, false);
+
+    mImplementation->initializeFrontendFeatures(&mFrontendFeatures);
+
+    rx::ApplyFeatureOverrides(&mFrontendFeatures, mState);
 }
 
 const DisplayExtensions &Display::getExtensions() const
@@ -1941,9 +2001,8 @@ Error Display::programCacheQuery(EGLint index,
 {
     ASSERT(index >= 0 && index < static_cast<EGLint>(mMemoryProgramCache.entryCount()));
 
-    const BlobCache::Key *programHash = nullptr;
+    BlobCache::Key programHash;
     BlobCache::Value programBinary;
-    // TODO(jmadill): Make this thread-safe.
     bool result =
         mMemoryProgramCache.getAt(static_cast<size_t>(index), &programHash, &programBinary);
     if (!result)
@@ -1956,7 +2015,7 @@ Error Display::programCacheQuery(EGLint index,
     if (key)
     {
         ASSERT(*keysize == static_cast<EGLint>(BlobCache::kKeyLength));
-        memcpy(key, programHash->data(), BlobCache::kKeyLength);
+        memcpy(key, programHash.data(), BlobCache::kKeyLength);
     }
 
     if (binary)
@@ -2045,6 +2104,12 @@ const char *Display::queryStringi(const EGLint name, const EGLint index)
         case EGL_FEATURE_CONDITION_ANGLE:
             result = mFeatures[index]->condition;
             break;
+        case EGL_HISTOGRAMS_ANGLE:
+        case EGL_HISTOGRAMS_AND_RESET_ANGLE:
+            // The histograms are process-wide; the string is kept until the next query.
+            mHistogramsString = angle::SerializeHistograms(name == EGL_HISTOGRAMS_AND_RESET_ANGLE);
+            result            = mHistogramsString.c_str();
+            break;
         default:
             UNREACHABLE();
             return nullptr;
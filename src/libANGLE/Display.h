@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_DISPLAY_H_
 #define LIBANGLE_DISPLAY_H_
 
+#include <memory>
 #include <mutex>
 #include <set>
 #include <vector>
@@ -18,11 +19,13 @@
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/Caps.h"
+#include "libANGLE/Compiler.h"
 #include "libANGLE/Config.h"
 #include "libANGLE/Debug.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/LoggingAnnotator.h"
 #include "libANGLE/MemoryProgramCache.h"
+#include "libANGLE/MemoryShaderCache.h"
 #include "libANGLE/Observer.h"
 #include "libANGLE/Version.h"
 #include "platform/Feature.h"
@@ -86,11 +89,17 @@ class ShareGroup final : angle::NonCopyable
 
     angle::FrameCaptureShared *getFrameCaptureShared() { return mFrameCaptureShared.get(); }
 
+    // Serializes the GL calls made on the shared contexts of this share group, and the EGL calls
+    // that operate on them.  It's reference counted so that an EGL call that destroys the share
+    // group can still unlock it.
+    const std::shared_ptr<std::recursive_mutex> &getMutex() const { return mMutex; }
+
   protected:
     ~ShareGroup();
 
   private:
     size_t mRefCount;
+    std::shared_ptr<std::recursive_mutex> mMutex;
     rx::ShareGroupImpl *mImplementation;
     rx::SerialFactory mFramebufferSerialFactory;
 
@@ -219,6 +228,8 @@ class Display final : public LabeledObject,
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
     bool areBlobCacheFuncsSet() const { return mBlobCache.areBlobCacheFuncsSet(); }
     BlobCache &getBlobCache() { return mBlobCache; }
+    gl::MemoryShaderCache *getMemoryShaderCache() { return &mMemoryShaderCache; }
+    gl::CompilerInstanceCache *getCompilerInstanceCache() { return &mCompilerInstanceCache; }
 
     static EGLClientBuffer GetNativeClientBuffer(const struct AHardwareBuffer *buffer);
     static Error CreateNativeClientBuffer(const egl::AttributeMap &attribMap,
@@ -349,6 +360,8 @@ class Display final : public LabeledObject,
     gl::SemaphoreManager *mSemaphoreManager;
     BlobCache mBlobCache;
     gl::MemoryProgramCache mMemoryProgramCache;
+    gl::MemoryShaderCache mMemoryShaderCache;
+    gl::CompilerInstanceCache mCompilerInstanceCache;
     size_t mGlobalTextureShareGroupUsers;
     size_t mGlobalSemaphoreShareGroupUsers;
 
@@ -356,6 +369,9 @@ class Display final : public LabeledObject,
 
     angle::FeatureList mFeatures;
 
+    // The result of the last EGL_ANGLE_histogram_query query.
+    std::string mHistogramsString;
+
     std::mutex mScratchBufferMutex;
     std::vector<angle::ScratchBuffer> mScratchBuffers;
     std::vector<angle::ScratchBuffer> mZeroFilledBuffers;
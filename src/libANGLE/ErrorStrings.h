@@ -495,6 +495,9 @@ MSG kSourceLevelNotDefined = "The source level of the source texture must be def
 MSG kSourceTextureLevelZeroDefined = "Source texture must level 0 defined.";
 MSG kSourceTextureMustBeCompressed = "Source texture must have a compressed internal format.";
 MSG kSourceTextureTooSmall = "The specified dimensions are outside of the bounds of the texture.";
+MSG kSparseTextureNoPageSize = "The internal format has no virtual page size at VIRTUAL_PAGE_SIZE_INDEX_EXT for the texture target.";
+MSG kSparseTextureNotPageAligned = "The region is not aligned to the virtual page size of the sparse texture.";
+MSG kSparseTextureSizeNotPageAligned = "Sparse texture dimensions must be multiples of the virtual page size.";
 MSG kStencilReferenceMaskOrMismatch = "Stencil reference and mask values must be the same for front facing and back facing triangles.";
 MSG kStrideExceedsWebGLLimit = "Stride is over the maximum stride allowed by WebGL.";
 MSG kStrideMustBeMultipleOfType = "Stride must be a multiple of the passed in datatype.";
@@ -513,6 +516,7 @@ MSG kTextureBufferInvalidBuffer = "If buffer is nonzero, it must match the name
 MSG kTextureFormatMismatch = "Passed in texture target and format must match the one originally used to define the texture.";
 MSG kTextureIsImmutable = "Texture is immutable.";
 MSG kTextureIsNotImmutable = "Texture is not immutable.";
+MSG kTextureIsNotSparse = "Texture is not an immutable sparse texture.";
 MSG kTextureNotBound = "A texture must be bound.";
 MSG kTextureNotPow2 = "The texture is a non-power-of-two texture.";
 MSG kTextureRectangleNotSupported = "Context does not support GL_ANGLE_texture_rectangle";
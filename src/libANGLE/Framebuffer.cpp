@@ -1168,6 +1168,12 @@ bool Framebuffer::usingExtendedDrawBuffers() const
 }
 
 void Framebuffer::invalidateCompletenessCache()
+{
+    mAttachmentCompletenessValid.reset();
+    invalidateCachedStatus();
+}
+
+void Framebuffer::invalidateCachedStatus()
 {
     if (!isDefault())
     {
@@ -1176,6 +1182,51 @@ void Framebuffer::invalidateCompletenessCache()
     onStateChange(angle::SubjectMessage::DirtyBitsFlagged);
 }
 
+const FramebufferStatus &Framebuffer::getAttachmentCompleteness(
+    const Context *context,
+    size_t index,
+    const FramebufferAttachment &attachment) const
+{
+    FramebufferStatus &status = mAttachmentCompleteness[index];
+    if (mAttachmentCompletenessValid.test(index))
+    {
+        return status;
+    }
+
+    status = CheckAttachmentCompleteness(context, attachment);
+    if (status.isComplete())
+    {
+        const InternalFormat &format = *attachment.getFormat().info;
+        if (index == DIRTY_BIT_DEPTH_ATTACHMENT)
+        {
+            if (format.depthBits == 0)
+            {
+                status = FramebufferStatus::Incomplete(
+                    GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT,
+                    err::kFramebufferIncompleteAttachmentNoDepthBitsInDepthBuffer);
+            }
+        }
+        else if (index == DIRTY_BIT_STENCIL_ATTACHMENT)
+        {
+            if (format.stencilBits == 0)
+            {
+                status = FramebufferStatus::Incomplete(
+                    GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT,
+                    err::kFramebufferIncompleteAttachmentNoStencilBitsInStencilBuffer);
+            }
+        }
+        else if (format.depthBits > 0 || format.stencilBits > 0)
+        {
+            status = FramebufferStatus::Incomplete(
+                GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT,
+                err::kFramebufferIncompleteDepthStencilInColorBuffer);
+        }
+    }
+
+    mAttachmentCompletenessValid.set(index);
+    return status;
+}
+
 const FramebufferStatus &Framebuffer::checkStatusImpl(const Context *context) const
 {
     ASSERT(!isDefault());
@@ -1223,24 +1274,19 @@ FramebufferStatus Framebuffer::checkStatusWithGLFrontEnd(const Context *context)
     Optional<bool> isLayered;
     Optional<TextureType> colorAttachmentsTextureType;
 
-    for (const FramebufferAttachment &colorAttachment : mState.mColorAttachments)
+    for (size_t colorIndex = 0; colorIndex < mState.mColorAttachments.size(); ++colorIndex)
     {
+        const FramebufferAttachment &colorAttachment = mState.mColorAttachments[colorIndex];
         if (colorAttachment.isAttached())
         {
-            FramebufferStatus attachmentCompleteness =
-                CheckAttachmentCompleteness(context, colorAttachment);
+            const FramebufferStatus &attachmentCompleteness = getAttachmentCompleteness(
+                context, DIRTY_BIT_COLOR_ATTACHMENT_0 + colorIndex, colorAttachment);
             if (!attachmentCompleteness.isComplete())
             {
                 return attachmentCompleteness;
             }
 
             const InternalFormat &format = *colorAttachment.getFormat().info;
-            if (format.depthBits > 0 || format.stencilBits > 0)
-            {
-                return FramebufferStatus::Incomplete(
-                    GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT,
-                    err::kFramebufferIncompleteDepthStencilInColorBuffer);
-            }
 
             FramebufferStatus attachmentSampleCompleteness =
                 CheckAttachmentSampleCompleteness(context, colorAttachment, true, &samples,
@@ -1318,21 +1364,13 @@ FramebufferStatus Framebuffer::checkStatusWithGLFrontEnd(const Context *context)
     const FramebufferAttachment &depthAttachment = mState.mDepthAttachment;
     if (depthAttachment.isAttached())
     {
-        FramebufferStatus attachmentCompleteness =
-            CheckAttachmentCompleteness(context, depthAttachment);
+        const FramebufferStatus &attachmentCompleteness =
+            getAttachmentCompleteness(context, DIRTY_BIT_DEPTH_ATTACHMENT, depthAttachment);
         if (!attachmentCompleteness.isComplete())
         {
             return attachmentCompleteness;
         }
 
-        const InternalFormat &format = *depthAttachment.getFormat().info;
-        if (format.depthBits == 0)
-        {
-            return FramebufferStatus::Incomplete(
-                GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT,
-                err::kFramebufferIncompleteAttachmentNoDepthBitsInDepthBuffer);
-        }
-
         FramebufferStatus attachmentSampleCompleteness =
             CheckAttachmentSampleCompleteness(context, depthAttachment, false, &samples,
                                               &fixedSampleLocations, &renderToTextureSamples);
@@ -1373,21 +1411,13 @@ FramebufferStatus Framebuffer::checkStatusWithGLFrontEnd(const Context *context)
     const FramebufferAttachment &stencilAttachment = mState.mStencilAttachment;
     if (stencilAttachment.isAttached())
     {
-        FramebufferStatus attachmentCompleteness =
-            CheckAttachmentCompleteness(context, stencilAttachment);
+        const FramebufferStatus &attachmentCompleteness =
+            getAttachmentCompleteness(context, DIRTY_BIT_STENCIL_ATTACHMENT, stencilAttachment);
         if (!attachmentCompleteness.isComplete())
         {
             return attachmentCompleteness;
         }
 
-        const InternalFormat &format = *stencilAttachment.getFormat().info;
-        if (format.stencilBits == 0)
-        {
-            return FramebufferStatus::Incomplete(
-                GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT,
-                err::kFramebufferIncompleteAttachmentNoStencilBitsInStencilBuffer);
-        }
-
         FramebufferStatus attachmentSampleCompleteness =
             CheckAttachmentSampleCompleteness(context, stencilAttachment, false, &samples,
                                               &fixedSampleLocations, &renderToTextureSamples);
@@ -2013,7 +2043,8 @@ void Framebuffer::updateAttachment(const Context *context,
     mState.mResourceNeedsInit.set(dirtyBit, attachment->initState() == InitState::MayNeedInit);
     onDirtyBinding->bind(resource);
 
-    invalidateCompletenessCache();
+    mAttachmentCompletenessValid.reset(dirtyBit);
+    invalidateCachedStatus();
 }
 
 void Framebuffer::resetAttachment(const Context *context, GLenum binding)
@@ -2051,7 +2082,16 @@ void Framebuffer::onSubjectStateChange(angle::SubjectIndex index, angle::Subject
         // This can be triggered by SubImage calls for Textures.
         if (message == angle::SubjectMessage::ContentsChanged)
         {
-            mDirtyBits.set(DIRTY_BIT_COLOR_BUFFER_CONTENTS_0 + index);
+            // Merge repeated contents changes until the next syncState. While the bit is set, the
+            // contexts this framebuffer is bound to already hold it as a dirty object, so the
+            // notification would be redundant.
+            const size_t contentsDirtyBit = DIRTY_BIT_COLOR_BUFFER_CONTENTS_0 + index;
+            if (mDirtyBits.test(contentsDirtyBit))
+            {
+                return;
+            }
+
+            mDirtyBits.set(contentsDirtyBit);
             onStateChange(angle::SubjectMessage::DirtyBitsFlagged);
             return;
         }
@@ -2065,15 +2105,18 @@ void Framebuffer::onSubjectStateChange(angle::SubjectIndex index, angle::Subject
             return;
         }
 
-        // This can be triggered by the GL back-end TextureGL class.
+        // This can be triggered by the GL back-end TextureGL class, and by changes to the texture
+        // parameters that the attachment's completeness depends on, such as the base level.
         ASSERT(message == angle::SubjectMessage::DirtyBitsFlagged);
+        mAttachmentCompletenessValid.reset(index);
         return;
     }
 
     ASSERT(!mDirtyBitsGuard.valid() || mDirtyBitsGuard.value().test(index));
     mDirtyBits.set(index);
 
-    invalidateCompletenessCache();
+    mAttachmentCompletenessValid.reset(index);
+    invalidateCachedStatus();
 
     FramebufferAttachment *attachment = getAttachmentFromSubjectIndex(index);
 
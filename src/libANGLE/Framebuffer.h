@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_FRAMEBUFFER_H_
 #define LIBANGLE_FRAMEBUFFER_H_
 
+#include <array>
 #include <vector>
 
 #include "common/FixedVector.h"
@@ -442,6 +443,11 @@ class Framebuffer final : public angle::ObserverInterface,
                                   GLuint matchId);
     FramebufferStatus checkStatusWithGLFrontEnd(const Context *context) const;
     const FramebufferStatus &checkStatusImpl(const Context *context) const;
+    const FramebufferStatus &getAttachmentCompleteness(
+        const Context *context,
+        size_t index,
+        const FramebufferAttachment &attachment) const;
+    void invalidateCachedStatus();
     void setAttachment(const Context *context,
                        GLenum type,
                        GLenum binding,
@@ -503,6 +509,13 @@ class Framebuffer final : public angle::ObserverInterface,
     rx::FramebufferImpl *mImpl;
 
     mutable Optional<FramebufferStatus> mCachedStatus;
+
+    // The completeness of each attachment on its own, indexed by its dirty bit.  A change to one
+    // attachment only recomputes that attachment's checks; the checks across attachments (samples,
+    // layers, multiview) are cheap comparisons and are redone on each status check.
+    static constexpr size_t kAttachmentCount = DIRTY_BIT_STENCIL_ATTACHMENT + 1;
+    mutable std::array<FramebufferStatus, kAttachmentCount> mAttachmentCompleteness;
+    mutable angle::BitSet<kAttachmentCount> mAttachmentCompletenessValid;
     std::vector<angle::ObserverBinding> mDirtyColorAttachmentBindings;
     angle::ObserverBinding mDirtyDepthAttachmentBinding;
     angle::ObserverBinding mDirtyStencilAttachmentBinding;
@@ -8,11 +8,13 @@
 
 #include "libANGLE/GLES1Renderer.h"
 
+#include <stddef.h>
 #include <string.h>
 #include <iterator>
 #include <sstream>
 #include <vector>
 
+#include "libANGLE/Buffer.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Context.inl.h"
 #include "libANGLE/Program.h"
@@ -37,7 +39,18 @@ void GLES1Renderer::onDestroy(Context *context, State *state)
     {
         (void)state->setProgram(context, 0);
 
-        mShaderPrograms->deleteProgram(context, {mProgramState.program});
+        for (const auto &programState : mProgramStates)
+        {
+            mShaderPrograms->deleteProgram(context, {programState.second.program});
+        }
+        mProgramStates.clear();
+        mCurrentProgramState = nullptr;
+
+        context->deleteBuffers(1, &mVertexUniformBuffer);
+        context->deleteBuffers(1, &mFragmentUniformBuffer);
+        mVertexUniformBuffer   = {0};
+        mFragmentUniformBuffer = {0};
+
         mShaderPrograms->release(context);
         mShaderPrograms             = nullptr;
         mRendererProgramInitialized = false;
@@ -48,50 +61,43 @@ GLES1Renderer::~GLES1Renderer() = default;
 
 angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context, State *glState)
 {
-    ANGLE_TRY(initializeRendererProgram(context, glState));
-
     GLES1State &gles1State = glState->gles1();
 
-    Program *programObject = getProgram(mProgramState.program);
-
-    GLES1UniformBuffers &uniformBuffers = mUniformBuffers;
-
-    // If anything is dirty in gles1 or the common parts of gles1/2, just redo these parts
-    // completely for now.
-
     // Feature enables
+    GLES1StateEnables enables;
     {
-        setUniform1i(context, programObject, mProgramState.enableAlphaTestLoc,
-                     glState->getEnableFeature(GL_ALPHA_TEST));
-        setUniform1i(context, programObject, mProgramState.enableLightingLoc,
-                     glState->getEnableFeature(GL_LIGHTING));
-        setUniform1i(context, programObject, mProgramState.enableRescaleNormalLoc,
-                     glState->getEnableFeature(GL_RESCALE_NORMAL));
-        setUniform1i(context, programObject, mProgramState.enableNormalizeLoc,
-                     glState->getEnableFeature(GL_NORMALIZE));
-        setUniform1i(context, programObject, mProgramState.enableColorMaterialLoc,
-                     glState->getEnableFeature(GL_COLOR_MATERIAL));
-        setUniform1i(context, programObject, mProgramState.fogEnableLoc,
-                     glState->getEnableFeature(GL_FOG));
+        enables.set(kEnableAlphaTest, glState->getEnableFeature(GL_ALPHA_TEST));
+        enables.set(kEnableLighting, glState->getEnableFeature(GL_LIGHTING));
+        enables.set(kEnableRescaleNormal, glState->getEnableFeature(GL_RESCALE_NORMAL));
+        enables.set(kEnableNormalize, glState->getEnableFeature(GL_NORMALIZE));
+        enables.set(kEnableColorMaterial, glState->getEnableFeature(GL_COLOR_MATERIAL));
+        enables.set(kEnableFog, glState->getEnableFeature(GL_FOG));
+        enables.set(kEnableDrawTexture, mDrawTextureEnabled);
+        enables.set(kEnablePointRasterization, mode == PrimitiveMode::Points);
+        enables.set(kEnablePointSprite, glState->getEnableFeature(GL_POINT_SPRITE_OES));
+        enables.set(kEnableShadeModelFlat, gles1State.mShadeModel == ShadingModel::Flat);
 
         bool enableClipPlanes = false;
         for (int i = 0; i < kClipPlaneCount; i++)
         {
-            uniformBuffers.clipPlaneEnables[i] = glState->getEnableFeature(GL_CLIP_PLANE0 + i);
-            enableClipPlanes = enableClipPlanes || uniformBuffers.clipPlaneEnables[i];
+            const bool enableClipPlane = glState->getEnableFeature(GL_CLIP_PLANE0 + i);
+            enables.set(kEnableClipPlaneBase + i, enableClipPlane);
+            enableClipPlanes = enableClipPlanes || enableClipPlane;
         }
+        enables.set(kEnableClipPlanes, enableClipPlanes);
 
-        setUniform1i(context, programObject, mProgramState.enableClipPlanesLoc, enableClipPlanes);
-    }
-
-    // Texture unit enables and format info
-    {
-        std::array<GLint, kTexUnitCount> &tex2DEnables   = uniformBuffers.tex2DEnables;
-        std::array<GLint, kTexUnitCount> &texCubeEnables = uniformBuffers.texCubeEnables;
-
-        std::vector<int> tex2DFormats = {GL_RGBA, GL_RGBA, GL_RGBA, GL_RGBA};
+        // The per-light and per-unit enables of features that are off don't need their own
+        // programs.
+        if (enables.test(kEnableLighting))
+        {
+            for (int i = 0; i < kLightCount; i++)
+            {
+                enables.set(kEnableLightBase + i, gles1State.mLights[i].enabled);
+            }
+        }
 
-        Vec4Uniform *cropRectBuffer = uniformBuffers.texCropRects.data();
+        const bool pointSprites =
+            enables.test(kEnablePointRasterization) && enables.test(kEnablePointSprite);
 
         for (int i = 0; i < kTexUnitCount; i++)
         {
@@ -113,10 +119,38 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
             //      Otherwise, a texture value is found according to the parameter values of
             //      the currently bound texture image of the appropriate dimensionality.
 
-            texCubeEnables[i] = gles1State.isTextureTargetEnabled(i, TextureType::CubeMap);
-            tex2DEnables[i] =
-                !texCubeEnables[i] && (gles1State.isTextureTargetEnabled(i, TextureType::_2D));
+            const bool enableCubeMap = gles1State.isTextureTargetEnabled(i, TextureType::CubeMap);
+            enables.set(kEnableTextureCubeMapBase + i, enableCubeMap);
+            enables.set(kEnableTexture2DBase + i,
+                        !enableCubeMap && gles1State.isTextureTargetEnabled(i, TextureType::_2D));
+
+            if (pointSprites)
+            {
+                enables.set(kEnablePointSpriteCoordBase + i,
+                            gles1State.textureEnvironment(i).pointSpriteCoordReplace);
+            }
+        }
+    }
+
+    ANGLE_TRY(initializeRendererProgram(context, glState, enables));
 
+    const GLES1ProgramState &programState = *mCurrentProgramState;
+
+    Program *programObject = getProgram(programState.program);
+
+    GLES1UniformBuffers &uniformBuffers = mUniformBuffers;
+
+    // If anything is dirty in gles1 or the common parts of gles1/2, just redo these parts
+    // completely for now.
+
+    // Texture unit format info
+    {
+        std::vector<int> tex2DFormats = {GL_RGBA, GL_RGBA, GL_RGBA, GL_RGBA};
+
+        Vec4Uniform *cropRectBuffer = uniformBuffers.texCropRects.data();
+
+        for (int i = 0; i < kTexUnitCount; i++)
+        {
             Texture *curr2DTexture = glState->getSamplerTexture(i, TextureType::_2D);
             if (curr2DTexture)
             {
@@ -140,15 +174,10 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
             }
         }
 
-        setUniform1iv(context, programObject, mProgramState.enableTexture2DLoc, kTexUnitCount,
-                      tex2DEnables.data());
-        setUniform1iv(context, programObject, mProgramState.enableTextureCubeMapLoc, kTexUnitCount,
-                      texCubeEnables.data());
-
-        setUniform1iv(context, programObject, mProgramState.textureFormatLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.textureFormatLoc, kTexUnitCount,
                       tex2DFormats.data());
 
-        setUniform4fv(programObject, mProgramState.drawTextureNormalizedCropRectLoc, kTexUnitCount,
+        setUniform4fv(programObject, programState.drawTextureNormalizedCropRectLoc, kTexUnitCount,
                       reinterpret_cast<GLfloat *>(cropRectBuffer));
     }
 
@@ -187,29 +216,27 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     }
 
     // Matrices
+    bool vertexUniformsDirty = false;
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_MATRICES))
     {
+        GLES1VertexUniformBlock &uniforms = mVertexUniforms;
+
         angle::Mat4 proj = gles1State.mProjectionMatrices.back();
-        setUniformMatrix4fv(programObject, mProgramState.projMatrixLoc, 1, GL_FALSE, proj.data());
+        memcpy(uniforms.projection, proj.data(), sizeof(Mat4Uniform));
 
         angle::Mat4 modelview = gles1State.mModelviewMatrices.back();
-        setUniformMatrix4fv(programObject, mProgramState.modelviewMatrixLoc, 1, GL_FALSE,
-                            modelview.data());
+        memcpy(uniforms.modelview, modelview.data(), sizeof(Mat4Uniform));
 
         angle::Mat4 modelviewInvTr = modelview.transpose().inverse();
-        setUniformMatrix4fv(programObject, mProgramState.modelviewInvTrLoc, 1, GL_FALSE,
-                            modelviewInvTr.data());
-
-        Mat4Uniform *textureMatrixBuffer = uniformBuffers.textureMatrices.data();
+        memcpy(uniforms.modelviewInvTr, modelviewInvTr.data(), sizeof(Mat4Uniform));
 
         for (int i = 0; i < kTexUnitCount; i++)
         {
             angle::Mat4 textureMatrix = gles1State.mTextureMatrices[i].back();
-            memcpy(textureMatrixBuffer + i, textureMatrix.data(), sizeof(Mat4Uniform));
+            memcpy(uniforms.textureMatrices[i], textureMatrix.data(), sizeof(Mat4Uniform));
         }
 
-        setUniformMatrix4fv(programObject, mProgramState.textureMatrixLoc, kTexUnitCount, GL_FALSE,
-                            reinterpret_cast<float *>(uniformBuffers.textureMatrices.data()));
+        vertexUniformsDirty = true;
     }
 
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_TEXTURE_ENVIRONMENT))
@@ -243,187 +270,149 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
 
             uniformBuffers.texEnvRgbScales[i]   = env.rgbScale;
             uniformBuffers.texEnvAlphaScales[i] = env.alphaScale;
-
-            uniformBuffers.pointSpriteCoordReplaces[i] = env.pointSpriteCoordReplace;
         }
 
-        setUniform1iv(context, programObject, mProgramState.textureEnvModeLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.textureEnvModeLoc, kTexUnitCount,
                       uniformBuffers.texEnvModes.data());
-        setUniform1iv(context, programObject, mProgramState.combineRgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.combineRgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineRgbs.data());
-        setUniform1iv(context, programObject, mProgramState.combineAlphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.combineAlphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineAlphas.data());
 
-        setUniform1iv(context, programObject, mProgramState.src0rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src0rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc0Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.src0alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src0alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc0Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.src1rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src1rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc1Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.src1alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src1alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc1Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.src2rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src2rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc2Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.src2alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src2alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc2Alphas.data());
 
-        setUniform1iv(context, programObject, mProgramState.op0rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op0rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp0Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.op0alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op0alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp0Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.op1rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op1rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp1Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.op1alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op1alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp1Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.op2rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op2rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp2Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.op2alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op2alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp2Alphas.data());
 
-        setUniform4fv(programObject, mProgramState.textureEnvColorLoc, kTexUnitCount,
+        setUniform4fv(programObject, programState.textureEnvColorLoc, kTexUnitCount,
                       reinterpret_cast<float *>(uniformBuffers.texEnvColors.data()));
-        setUniform1fv(programObject, mProgramState.rgbScaleLoc, kTexUnitCount,
+        setUniform1fv(programObject, programState.rgbScaleLoc, kTexUnitCount,
                       uniformBuffers.texEnvRgbScales.data());
-        setUniform1fv(programObject, mProgramState.alphaScaleLoc, kTexUnitCount,
+        setUniform1fv(programObject, programState.alphaScaleLoc, kTexUnitCount,
                       uniformBuffers.texEnvAlphaScales.data());
-
-        setUniform1iv(context, programObject, mProgramState.pointSpriteCoordReplaceLoc,
-                      kTexUnitCount, uniformBuffers.pointSpriteCoordReplaces.data());
     }
 
+    GLES1FragmentUniformBlock &fragmentUniforms = mFragmentUniforms;
+    bool fragmentUniformsDirty                  = false;
+
     // Alpha test
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_ALPHA_TEST))
     {
-        setUniform1i(context, programObject, mProgramState.alphaFuncLoc,
-                     ToGLenum(gles1State.mAlphaTestFunc));
-        setUniform1f(programObject, mProgramState.alphaTestRefLoc, gles1State.mAlphaTestRef);
-    }
-
-    // Shading, materials, and lighting
-    if (gles1State.isDirty(GLES1State::DIRTY_GLES1_SHADE_MODEL))
-    {
-        setUniform1i(context, programObject, mProgramState.shadeModelFlatLoc,
-                     gles1State.mShadeModel == ShadingModel::Flat);
+        fragmentUniforms.alphaFunc    = ToGLenum(gles1State.mAlphaTestFunc);
+        fragmentUniforms.alphaTestRef = gles1State.mAlphaTestRef;
+        fragmentUniformsDirty         = true;
     }
 
+    // Materials and lighting
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_MATERIAL))
     {
         const auto &material = gles1State.mMaterial;
 
-        setUniform4fv(programObject, mProgramState.materialAmbientLoc, 1, material.ambient.data());
-        setUniform4fv(programObject, mProgramState.materialDiffuseLoc, 1, material.diffuse.data());
-        setUniform4fv(programObject, mProgramState.materialSpecularLoc, 1,
-                      material.specular.data());
-        setUniform4fv(programObject, mProgramState.materialEmissiveLoc, 1,
-                      material.emissive.data());
-        setUniform1f(programObject, mProgramState.materialSpecularExponentLoc,
-                     material.specularExponent);
+        memcpy(fragmentUniforms.materialAmbient, material.ambient.data(), sizeof(Vec4Uniform));
+        memcpy(fragmentUniforms.materialDiffuse, material.diffuse.data(), sizeof(Vec4Uniform));
+        memcpy(fragmentUniforms.materialSpecular, material.specular.data(), sizeof(Vec4Uniform));
+        memcpy(fragmentUniforms.materialEmissive, material.emissive.data(), sizeof(Vec4Uniform));
+        fragmentUniforms.materialSpecularExponent = material.specularExponent;
+        fragmentUniformsDirty                     = true;
     }
 
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_LIGHTS))
     {
         const auto &lightModel = gles1State.mLightModel;
 
-        setUniform4fv(programObject, mProgramState.lightModelSceneAmbientLoc, 1,
-                      lightModel.color.data());
+        memcpy(fragmentUniforms.lightModelSceneAmbient, lightModel.color.data(),
+               sizeof(Vec4Uniform));
 
         // TODO (lfy@google.com): Implement two-sided lighting model
-        // gl->uniform1i(mProgramState.lightModelTwoSidedLoc, lightModel.twoSided);
+        // gl->uniform1i(programState.lightModelTwoSidedLoc, lightModel.twoSided);
 
         for (int i = 0; i < kLightCount; i++)
         {
-            const auto &light              = gles1State.mLights[i];
-            uniformBuffers.lightEnables[i] = light.enabled;
-            memcpy(uniformBuffers.lightAmbients.data() + i, light.ambient.data(),
-                   sizeof(Vec4Uniform));
-            memcpy(uniformBuffers.lightDiffuses.data() + i, light.diffuse.data(),
-                   sizeof(Vec4Uniform));
-            memcpy(uniformBuffers.lightSpeculars.data() + i, light.specular.data(),
-                   sizeof(Vec4Uniform));
-            memcpy(uniformBuffers.lightPositions.data() + i, light.position.data(),
-                   sizeof(Vec4Uniform));
-            memcpy(uniformBuffers.lightDirections.data() + i, light.direction.data(),
+            const auto &light = gles1State.mLights[i];
+            memcpy(fragmentUniforms.lightAmbients[i], light.ambient.data(), sizeof(Vec4Uniform));
+            memcpy(fragmentUniforms.lightDiffuses[i], light.diffuse.data(), sizeof(Vec4Uniform));
+            memcpy(fragmentUniforms.lightSpeculars[i], light.specular.data(), sizeof(Vec4Uniform));
+            memcpy(fragmentUniforms.lightPositions[i], light.position.data(), sizeof(Vec4Uniform));
+            memcpy(fragmentUniforms.lightDirections[i], light.direction.data(),
                    sizeof(Vec3Uniform));
-            uniformBuffers.spotlightExponents[i]    = light.spotlightExponent;
-            uniformBuffers.spotlightCutoffAngles[i] = light.spotlightCutoffAngle;
-            uniformBuffers.attenuationConsts[i]     = light.attenuationConst;
-            uniformBuffers.attenuationLinears[i]    = light.attenuationLinear;
-            uniformBuffers.attenuationQuadratics[i] = light.attenuationQuadratic;
+            fragmentUniforms.spotlightExponents[i][0]    = light.spotlightExponent;
+            fragmentUniforms.spotlightCutoffAngles[i][0] = light.spotlightCutoffAngle;
+            fragmentUniforms.attenuationConsts[i][0]     = light.attenuationConst;
+            fragmentUniforms.attenuationLinears[i][0]    = light.attenuationLinear;
+            fragmentUniforms.attenuationQuadratics[i][0] = light.attenuationQuadratic;
         }
 
-        setUniform1iv(context, programObject, mProgramState.lightEnablesLoc, kLightCount,
-                      uniformBuffers.lightEnables.data());
-        setUniform4fv(programObject, mProgramState.lightAmbientsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.lightAmbients.data()));
-        setUniform4fv(programObject, mProgramState.lightDiffusesLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.lightDiffuses.data()));
-        setUniform4fv(programObject, mProgramState.lightSpecularsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.lightSpeculars.data()));
-        setUniform4fv(programObject, mProgramState.lightPositionsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.lightPositions.data()));
-        setUniform3fv(programObject, mProgramState.lightDirectionsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.lightDirections.data()));
-        setUniform1fv(programObject, mProgramState.lightSpotlightExponentsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.spotlightExponents.data()));
-        setUniform1fv(programObject, mProgramState.lightSpotlightCutoffAnglesLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.spotlightCutoffAngles.data()));
-        setUniform1fv(programObject, mProgramState.lightAttenuationConstsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.attenuationConsts.data()));
-        setUniform1fv(programObject, mProgramState.lightAttenuationLinearsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.attenuationLinears.data()));
-        setUniform1fv(programObject, mProgramState.lightAttenuationQuadraticsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.attenuationQuadratics.data()));
+        fragmentUniformsDirty = true;
     }
 
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_FOG))
     {
         const FogParameters &fog = gles1State.fogParameters();
-        setUniform1i(context, programObject, mProgramState.fogModeLoc, ToGLenum(fog.mode));
-        setUniform1f(programObject, mProgramState.fogDensityLoc, fog.density);
-        setUniform1f(programObject, mProgramState.fogStartLoc, fog.start);
-        setUniform1f(programObject, mProgramState.fogEndLoc, fog.end);
-        setUniform4fv(programObject, mProgramState.fogColorLoc, 1, fog.color.data());
+        fragmentUniforms.fogMode    = ToGLenum(fog.mode);
+        fragmentUniforms.fogDensity = fog.density;
+        fragmentUniforms.fogStart   = fog.start;
+        fragmentUniforms.fogEnd     = fog.end;
+        memcpy(fragmentUniforms.fogColor, fog.color.data(), sizeof(Vec4Uniform));
+        fragmentUniformsDirty = true;
     }
 
     // Clip planes
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_CLIP_PLANES))
     {
-        bool enableClipPlanes = false;
         for (int i = 0; i < kClipPlaneCount; i++)
         {
-            uniformBuffers.clipPlaneEnables[i] = glState->getEnableFeature(GL_CLIP_PLANE0 + i);
-            enableClipPlanes = enableClipPlanes || uniformBuffers.clipPlaneEnables[i];
-            gles1State.getClipPlane(
-                i, reinterpret_cast<float *>(uniformBuffers.clipPlanes.data() + i));
+            gles1State.getClipPlane(i, fragmentUniforms.clipPlanes[i]);
         }
+        fragmentUniformsDirty = true;
+    }
 
-        setUniform1i(context, programObject, mProgramState.enableClipPlanesLoc, enableClipPlanes);
-        setUniform1iv(context, programObject, mProgramState.clipPlaneEnablesLoc, kClipPlaneCount,
-                      uniformBuffers.clipPlaneEnables.data());
-        setUniform4fv(programObject, mProgramState.clipPlanesLoc, kClipPlaneCount,
-                      reinterpret_cast<float *>(uniformBuffers.clipPlanes.data()));
+    // Each uniform block is uploaded with a single update of its buffer.
+    if (vertexUniformsDirty)
+    {
+        ANGLE_TRY(updateUniformBuffer(context, mVertexUniformBuffer, &mVertexUniforms,
+                                      sizeof(mVertexUniforms)));
+    }
+    if (fragmentUniformsDirty)
+    {
+        ANGLE_TRY(updateUniformBuffer(context, mFragmentUniformBuffer, &mFragmentUniforms,
+                                      sizeof(mFragmentUniforms)));
     }
 
     // Point rasterization
     {
         const PointParameters &pointParams = gles1State.mPointParameters;
 
-        setUniform1i(context, programObject, mProgramState.pointRasterizationLoc,
-                     mode == PrimitiveMode::Points);
-        setUniform1i(context, programObject, mProgramState.pointSpriteEnabledLoc,
-                     glState->getEnableFeature(GL_POINT_SPRITE_OES));
-        setUniform1f(programObject, mProgramState.pointSizeMinLoc, pointParams.pointSizeMin);
-        setUniform1f(programObject, mProgramState.pointSizeMaxLoc, pointParams.pointSizeMax);
-        setUniform3fv(programObject, mProgramState.pointDistanceAttenuationLoc, 1,
+        setUniform1f(programObject, programState.pointSizeMinLoc, pointParams.pointSizeMin);
+        setUniform1f(programObject, programState.pointSizeMaxLoc, pointParams.pointSizeMax);
+        setUniform3fv(programObject, programState.pointDistanceAttenuationLoc, 1,
                       pointParams.pointDistanceAttenuation.data());
     }
 
     // Draw texture
     {
-        setUniform1i(context, programObject, mProgramState.enableDrawTextureLoc,
-                     mDrawTextureEnabled ? 1 : 0);
-        setUniform4fv(programObject, mProgramState.drawTextureCoordsLoc, 1, mDrawTextureCoords);
-        setUniform2fv(programObject, mProgramState.drawTextureDimsLoc, 1, mDrawTextureDims);
+        setUniform4fv(programObject, programState.drawTextureCoordsLoc, 1, mDrawTextureCoords);
+        setUniform2fv(programObject, programState.drawTextureDimsLoc, 1, mDrawTextureDims);
     }
 
     gles1State.clearDirty();
@@ -614,22 +603,73 @@ angle::Result GLES1Renderer::linkProgram(Context *context,
     return angle::Result::Continue;
 }
 
-angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *glState)
+angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
+                                                       State *glState,
+                                                       const GLES1StateEnables &enables)
 {
-    if (mRendererProgramInitialized)
+    const uint64_t stateEnables = enables.bits();
+    if (mCurrentProgramState != nullptr && mCurrentStateEnables == stateEnables)
     {
         return angle::Result::Continue;
     }
 
-    mShaderPrograms = new ShaderProgramManager();
+    if (!mRendererProgramInitialized)
+    {
+        mShaderPrograms             = new ShaderProgramManager();
+        mRendererProgramInitialized = true;
+
+        ANGLE_TRY(initializeUniformBuffers(context));
+    }
+
+    auto programIter = mProgramStates.find(stateEnables);
+    if (programIter == mProgramStates.end())
+    {
+        if (mProgramStates.size() >= kMaxProgramCount)
+        {
+            evictLeastRecentlyUsedProgram(context);
+        }
+
+        GLES1ProgramState programState;
+        ANGLE_TRY(createProgram(context, glState, enables, &programState));
+        programIter = mProgramStates.emplace(stateEnables, programState).first;
+    }
+
+    mCurrentProgramState                = &programIter->second;
+    mCurrentStateEnables                = stateEnables;
+    mCurrentProgramState->lastUseSerial = ++mProgramUseSerial;
+
+    ANGLE_TRY(glState->setProgram(context, getProgram(mCurrentProgramState->program)));
+    glState->setObjectDirty(GL_PROGRAM);
+
+    // The uniforms of the program were last set when it was last used.
+    glState->gles1().setAllDirty();
+
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::createProgram(Context *context,
+                                           State *glState,
+                                           const GLES1StateEnables &enables,
+                                           GLES1ProgramState *programStateOut)
+{
+    GLES1ProgramState &programState = *programStateOut;
+
+    const std::string stateEnableConstants = GetStateEnableConstants(enables);
 
     ShaderProgramID vertexShader;
     ShaderProgramID fragmentShader;
 
-    ANGLE_TRY(compileShader(context, ShaderType::Vertex, kGLES1DrawVShader, &vertexShader));
+    std::stringstream vertexStream;
+    vertexStream << kGLES1DrawVShaderHeader;
+    vertexStream << stateEnableConstants;
+    vertexStream << kGLES1DrawVShader;
+
+    ANGLE_TRY(
+        compileShader(context, ShaderType::Vertex, vertexStream.str().c_str(), &vertexShader));
 
     std::stringstream fragmentStream;
     fragmentStream << kGLES1DrawFShaderHeader;
+    fragmentStream << stateEnableConstants;
     fragmentStream << kGLES1DrawFShaderUniformDefs;
     fragmentStream << kGLES1DrawFShaderFunctions;
     fragmentStream << kGLES1DrawFShaderMultitexturing;
@@ -653,17 +693,24 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
     }
 
     ANGLE_TRY(linkProgram(context, glState, vertexShader, fragmentShader, attribLocs,
-                          &mProgramState.program));
+                          &programState.program));
+    programState.lastUseSerial = 0;
 
     mShaderPrograms->deleteShader(context, vertexShader);
     mShaderPrograms->deleteShader(context, fragmentShader);
 
-    Program *programObject = getProgram(mProgramState.program);
+    Program *programObject = getProgram(programState.program);
 
-    mProgramState.projMatrixLoc      = programObject->getUniformLocation("projection");
-    mProgramState.modelviewMatrixLoc = programObject->getUniformLocation("modelview");
-    mProgramState.textureMatrixLoc   = programObject->getUniformLocation("texture_matrix");
-    mProgramState.modelviewInvTrLoc  = programObject->getUniformLocation("modelview_invtr");
+    // A uniform block is inactive in the programs that use none of its state.
+    auto bindUniformBlock = [programObject](const char *name, GLuint binding) {
+        GLuint blockIndex = programObject->getUniformBlockIndex(name);
+        if (blockIndex != GL_INVALID_INDEX)
+        {
+            programObject->bindUniformBlock({blockIndex}, binding);
+        }
+    };
+    bindUniformBlock("GLES1VertexUniforms", kVertexUniformBlockBinding);
+    bindUniformBlock("GLES1FragmentUniforms", kFragmentUniformBlockBinding);
 
     for (int i = 0; i < kTexUnitCount; i++)
     {
@@ -673,117 +720,146 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
         ss2d << "tex_sampler" << i;
         sscube << "tex_cube_sampler" << i;
 
-        mProgramState.tex2DSamplerLocs[i] = programObject->getUniformLocation(ss2d.str().c_str());
-        mProgramState.texCubeSamplerLocs[i] =
+        programState.tex2DSamplerLocs[i] = programObject->getUniformLocation(ss2d.str().c_str());
+        programState.texCubeSamplerLocs[i] =
             programObject->getUniformLocation(sscube.str().c_str());
     }
 
-    mProgramState.enableTexture2DLoc = programObject->getUniformLocation("enable_texture_2d");
-    mProgramState.enableTextureCubeMapLoc =
-        programObject->getUniformLocation("enable_texture_cube_map");
-
-    mProgramState.textureFormatLoc   = programObject->getUniformLocation("texture_format");
-    mProgramState.textureEnvModeLoc  = programObject->getUniformLocation("texture_env_mode");
-    mProgramState.combineRgbLoc      = programObject->getUniformLocation("combine_rgb");
-    mProgramState.combineAlphaLoc    = programObject->getUniformLocation("combine_alpha");
-    mProgramState.src0rgbLoc         = programObject->getUniformLocation("src0_rgb");
-    mProgramState.src0alphaLoc       = programObject->getUniformLocation("src0_alpha");
-    mProgramState.src1rgbLoc         = programObject->getUniformLocation("src1_rgb");
-    mProgramState.src1alphaLoc       = programObject->getUniformLocation("src1_alpha");
-    mProgramState.src2rgbLoc         = programObject->getUniformLocation("src2_rgb");
-    mProgramState.src2alphaLoc       = programObject->getUniformLocation("src2_alpha");
-    mProgramState.op0rgbLoc          = programObject->getUniformLocation("op0_rgb");
-    mProgramState.op0alphaLoc        = programObject->getUniformLocation("op0_alpha");
-    mProgramState.op1rgbLoc          = programObject->getUniformLocation("op1_rgb");
-    mProgramState.op1alphaLoc        = programObject->getUniformLocation("op1_alpha");
-    mProgramState.op2rgbLoc          = programObject->getUniformLocation("op2_rgb");
-    mProgramState.op2alphaLoc        = programObject->getUniformLocation("op2_alpha");
-    mProgramState.textureEnvColorLoc = programObject->getUniformLocation("texture_env_color");
-    mProgramState.rgbScaleLoc        = programObject->getUniformLocation("texture_env_rgb_scale");
-    mProgramState.alphaScaleLoc      = programObject->getUniformLocation("texture_env_alpha_scale");
-    mProgramState.pointSpriteCoordReplaceLoc =
-        programObject->getUniformLocation("point_sprite_coord_replace");
-
-    mProgramState.enableAlphaTestLoc = programObject->getUniformLocation("enable_alpha_test");
-    mProgramState.alphaFuncLoc       = programObject->getUniformLocation("alpha_func");
-    mProgramState.alphaTestRefLoc    = programObject->getUniformLocation("alpha_test_ref");
-
-    mProgramState.shadeModelFlatLoc = programObject->getUniformLocation("shade_model_flat");
-    mProgramState.enableLightingLoc = programObject->getUniformLocation("enable_lighting");
-    mProgramState.enableRescaleNormalLoc =
-        programObject->getUniformLocation("enable_rescale_normal");
-    mProgramState.enableNormalizeLoc = programObject->getUniformLocation("enable_normalize");
-    mProgramState.enableColorMaterialLoc =
-        programObject->getUniformLocation("enable_color_material");
-
-    mProgramState.materialAmbientLoc  = programObject->getUniformLocation("material_ambient");
-    mProgramState.materialDiffuseLoc  = programObject->getUniformLocation("material_diffuse");
-    mProgramState.materialSpecularLoc = programObject->getUniformLocation("material_specular");
-    mProgramState.materialEmissiveLoc = programObject->getUniformLocation("material_emissive");
-    mProgramState.materialSpecularExponentLoc =
-        programObject->getUniformLocation("material_specular_exponent");
-
-    mProgramState.lightModelSceneAmbientLoc =
-        programObject->getUniformLocation("light_model_scene_ambient");
-    mProgramState.lightModelTwoSidedLoc =
+    programState.textureFormatLoc   = programObject->getUniformLocation("texture_format");
+    programState.textureEnvModeLoc  = programObject->getUniformLocation("texture_env_mode");
+    programState.combineRgbLoc      = programObject->getUniformLocation("combine_rgb");
+    programState.combineAlphaLoc    = programObject->getUniformLocation("combine_alpha");
+    programState.src0rgbLoc         = programObject->getUniformLocation("src0_rgb");
+    programState.src0alphaLoc       = programObject->getUniformLocation("src0_alpha");
+    programState.src1rgbLoc         = programObject->getUniformLocation("src1_rgb");
+    programState.src1alphaLoc       = programObject->getUniformLocation("src1_alpha");
+    programState.src2rgbLoc         = programObject->getUniformLocation("src2_rgb");
+    programState.src2alphaLoc       = programObject->getUniformLocation("src2_alpha");
+    programState.op0rgbLoc          = programObject->getUniformLocation("op0_rgb");
+    programState.op0alphaLoc        = programObject->getUniformLocation("op0_alpha");
+    programState.op1rgbLoc          = programObject->getUniformLocation("op1_rgb");
+    programState.op1alphaLoc        = programObject->getUniformLocation("op1_alpha");
+    programState.op2rgbLoc          = programObject->getUniformLocation("op2_rgb");
+    programState.op2alphaLoc        = programObject->getUniformLocation("op2_alpha");
+    programState.textureEnvColorLoc = programObject->getUniformLocation("texture_env_color");
+    programState.rgbScaleLoc        = programObject->getUniformLocation("texture_env_rgb_scale");
+    programState.alphaScaleLoc      = programObject->getUniformLocation("texture_env_alpha_scale");
+
+    programState.lightModelTwoSidedLoc =
         programObject->getUniformLocation("light_model_two_sided");
 
-    mProgramState.lightEnablesLoc    = programObject->getUniformLocation("light_enables");
-    mProgramState.lightAmbientsLoc   = programObject->getUniformLocation("light_ambients");
-    mProgramState.lightDiffusesLoc   = programObject->getUniformLocation("light_diffuses");
-    mProgramState.lightSpecularsLoc  = programObject->getUniformLocation("light_speculars");
-    mProgramState.lightPositionsLoc  = programObject->getUniformLocation("light_positions");
-    mProgramState.lightDirectionsLoc = programObject->getUniformLocation("light_directions");
-    mProgramState.lightSpotlightExponentsLoc =
-        programObject->getUniformLocation("light_spotlight_exponents");
-    mProgramState.lightSpotlightCutoffAnglesLoc =
-        programObject->getUniformLocation("light_spotlight_cutoff_angles");
-    mProgramState.lightAttenuationConstsLoc =
-        programObject->getUniformLocation("light_attenuation_consts");
-    mProgramState.lightAttenuationLinearsLoc =
-        programObject->getUniformLocation("light_attenuation_linears");
-    mProgramState.lightAttenuationQuadraticsLoc =
-        programObject->getUniformLocation("light_attenuation_quadratics");
-
-    mProgramState.fogEnableLoc  = programObject->getUniformLocation("enable_fog");
-    mProgramState.fogModeLoc    = programObject->getUniformLocation("fog_mode");
-    mProgramState.fogDensityLoc = programObject->getUniformLocation("fog_density");
-    mProgramState.fogStartLoc   = programObject->getUniformLocation("fog_start");
-    mProgramState.fogEndLoc     = programObject->getUniformLocation("fog_end");
-    mProgramState.fogColorLoc   = programObject->getUniformLocation("fog_color");
-
-    mProgramState.enableClipPlanesLoc = programObject->getUniformLocation("enable_clip_planes");
-    mProgramState.clipPlaneEnablesLoc = programObject->getUniformLocation("clip_plane_enables");
-    mProgramState.clipPlanesLoc       = programObject->getUniformLocation("clip_planes");
-
-    mProgramState.pointRasterizationLoc = programObject->getUniformLocation("point_rasterization");
-    mProgramState.pointSizeMinLoc       = programObject->getUniformLocation("point_size_min");
-    mProgramState.pointSizeMaxLoc       = programObject->getUniformLocation("point_size_max");
-    mProgramState.pointDistanceAttenuationLoc =
+    programState.pointSizeMinLoc = programObject->getUniformLocation("point_size_min");
+    programState.pointSizeMaxLoc = programObject->getUniformLocation("point_size_max");
+    programState.pointDistanceAttenuationLoc =
         programObject->getUniformLocation("point_distance_attenuation");
-    mProgramState.pointSpriteEnabledLoc = programObject->getUniformLocation("point_sprite_enabled");
 
-    mProgramState.enableDrawTextureLoc = programObject->getUniformLocation("enable_draw_texture");
-    mProgramState.drawTextureCoordsLoc = programObject->getUniformLocation("draw_texture_coords");
-    mProgramState.drawTextureDimsLoc   = programObject->getUniformLocation("draw_texture_dims");
-    mProgramState.drawTextureNormalizedCropRectLoc =
+    programState.drawTextureCoordsLoc = programObject->getUniformLocation("draw_texture_coords");
+    programState.drawTextureDimsLoc   = programObject->getUniformLocation("draw_texture_dims");
+    programState.drawTextureNormalizedCropRectLoc =
         programObject->getUniformLocation("draw_texture_normalized_crop_rect");
 
-    ANGLE_TRY(glState->setProgram(context, programObject));
-
     for (int i = 0; i < kTexUnitCount; i++)
     {
-        setUniform1i(context, programObject, mProgramState.tex2DSamplerLocs[i], i);
-        setUniform1i(context, programObject, mProgramState.texCubeSamplerLocs[i],
-                     i + kTexUnitCount);
+        setUniform1i(context, programObject, programState.tex2DSamplerLocs[i], i);
+        setUniform1i(context, programObject, programState.texCubeSamplerLocs[i], i + kTexUnitCount);
     }
 
-    glState->setObjectDirty(GL_PROGRAM);
+    return angle::Result::Continue;
+}
+
+void GLES1Renderer::evictLeastRecentlyUsedProgram(Context *context)
+{
+    auto oldestIter = mProgramStates.end();
+    for (auto iter = mProgramStates.begin(); iter != mProgramStates.end(); ++iter)
+    {
+        if (oldestIter == mProgramStates.end() ||
+            iter->second.lastUseSerial < oldestIter->second.lastUseSerial)
+        {
+            oldestIter = iter;
+        }
+    }
+
+    // The current program is the most recently used one, so it's only evicted if it's alone.
+    if (&oldestIter->second == mCurrentProgramState)
+    {
+        mCurrentProgramState = nullptr;
+    }
+
+    mShaderPrograms->deleteProgram(context, {oldestIter->second.program});
+    mProgramStates.erase(oldestIter);
+}
+
+angle::Result GLES1Renderer::initializeUniformBuffers(Context *context)
+{
+    static_assert(sizeof(GLES1VertexUniformBlock) % sizeof(Vec4Uniform) == 0,
+                  "GLES1VertexUniformBlock doesn't match its std140 layout");
+    static_assert(offsetof(GLES1FragmentUniformBlock, lightAmbients) % sizeof(Vec4Uniform) == 0,
+                  "GLES1FragmentUniformBlock doesn't match its std140 layout");
+
+    context->genBuffers(1, &mVertexUniformBuffer);
+    context->genBuffers(1, &mFragmentUniformBuffer);
+
+    context->bindBufferRange(BufferBinding::Uniform, kVertexUniformBlockBinding,
+                             mVertexUniformBuffer, 0, sizeof(mVertexUniforms));
+    context->bindBufferRange(BufferBinding::Uniform, kFragmentUniformBlockBinding,
+                             mFragmentUniformBuffer, 0, sizeof(mFragmentUniforms));
+
+    ANGLE_TRY(context->getBuffer(mVertexUniformBuffer)
+                  ->bufferData(context, BufferBinding::Uniform, &mVertexUniforms,
+                               sizeof(mVertexUniforms), BufferUsage::DynamicDraw));
+    ANGLE_TRY(context->getBuffer(mFragmentUniformBuffer)
+                  ->bufferData(context, BufferBinding::Uniform, &mFragmentUniforms,
+                               sizeof(mFragmentUniforms), BufferUsage::DynamicDraw));
 
-    mRendererProgramInitialized = true;
     return angle::Result::Continue;
 }
 
+angle::Result GLES1Renderer::updateUniformBuffer(Context *context,
+                                                 BufferID buffer,
+                                                 const void *data,
+                                                 size_t size)
+{
+    return context->getBuffer(buffer)->bufferSubData(context, BufferBinding::Uniform, data,
+                                                     static_cast<GLsizeiptr>(size), 0);
+}
+
+// static
+std::string GLES1Renderer::GetStateEnableConstants(const GLES1StateEnables &enables)
+{
+    auto toString = [&enables](size_t bit) { return enables.test(bit) ? "true" : "false"; };
+    auto addArray = [&toString](std::stringstream &stream, const char *name, size_t bitBase,
+                                size_t count) {
+        stream << "const bool " << name << "[] = bool[](";
+        for (size_t i = 0; i < count; i++)
+        {
+            stream << (i > 0 ? ", " : "") << toString(bitBase + i);
+        }
+        stream << ");\n";
+    };
+
+    std::stringstream stream;
+    stream << "\n";
+    stream << "const bool enable_alpha_test = " << toString(kEnableAlphaTest) << ";\n";
+    stream << "const bool enable_lighting = " << toString(kEnableLighting) << ";\n";
+    stream << "const bool enable_rescale_normal = " << toString(kEnableRescaleNormal) << ";\n";
+    stream << "const bool enable_normalize = " << toString(kEnableNormalize) << ";\n";
+    stream << "const bool enable_color_material = " << toString(kEnableColorMaterial) << ";\n";
+    stream << "const bool enable_fog = " << toString(kEnableFog) << ";\n";
+    stream << "const bool enable_clip_planes = " << toString(kEnableClipPlanes) << ";\n";
+    stream << "const bool enable_draw_texture = " << toString(kEnableDrawTexture) << ";\n";
+    stream << "const bool point_rasterization = " << toString(kEnablePointRasterization) << ";\n";
+    stream << "const bool point_sprite_enabled = " << toString(kEnablePointSprite) << ";\n";
+    stream << "const bool shade_model_flat = " << toString(kEnableShadeModelFlat) << ";\n";
+
+    addArray(stream, "enable_texture_2d", kEnableTexture2DBase, kTexUnitCount);
+    addArray(stream, "enable_texture_cube_map", kEnableTextureCubeMapBase, kTexUnitCount);
+    addArray(stream, "point_sprite_coord_replace", kEnablePointSpriteCoordBase, kTexUnitCount);
+    addArray(stream, "light_enables", kEnableLightBase, kLightCount);
+    addArray(stream, "clip_plane_enables", kEnableClipPlaneBase, kClipPlaneCount);
+
+    return stream.str();
+}
+
 void GLES1Renderer::setUniform1i(Context *context,
                                  Program *programObject,
                                  UniformLocation location,
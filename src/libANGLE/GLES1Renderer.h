@@ -12,6 +12,7 @@
 
 #include "angle_gl.h"
 #include "common/angleutils.h"
+#include "common/bitset_utils.h"
 #include "libANGLE/angletypes.h"
 
 #include <memory>
@@ -56,6 +57,38 @@ class GLES1Renderer final : angle::NonCopyable
     using Vec4Uniform = float[4];
     using Vec3Uniform = float[3];
 
+    static constexpr int kLightCount     = 8;
+    static constexpr int kClipPlaneCount = 6;
+
+    // The fixed-function enables are compiled into the programs as constants rather than read
+    // from uniforms, so that the code of the disabled features is removed from the shaders.
+    enum GLES1StateEnable
+    {
+        kEnableAlphaTest,
+        kEnableLighting,
+        kEnableRescaleNormal,
+        kEnableNormalize,
+        kEnableColorMaterial,
+        kEnableFog,
+        kEnableClipPlanes,
+        kEnableDrawTexture,
+        kEnablePointRasterization,
+        kEnablePointSprite,
+        kEnableShadeModelFlat,
+        kEnableTexture2DBase,
+        kEnableTextureCubeMapBase   = kEnableTexture2DBase + kTexUnitCount,
+        kEnablePointSpriteCoordBase = kEnableTextureCubeMapBase + kTexUnitCount,
+        kEnableLightBase            = kEnablePointSpriteCoordBase + kTexUnitCount,
+        kEnableClipPlaneBase        = kEnableLightBase + kLightCount,
+        kGLES1StateEnableCount      = kEnableClipPlaneBase + kClipPlaneCount,
+    };
+    using GLES1StateEnables = angle::BitSet64<kGLES1StateEnableCount>;
+
+    // Programs are evicted, least recently used first, past this count.
+    static constexpr size_t kMaxProgramCount = 64;
+
+    struct GLES1ProgramState;
+
     Shader *getShader(ShaderProgramID handle) const;
     Program *getProgram(ShaderProgramID handle) const;
 
@@ -69,7 +102,20 @@ class GLES1Renderer final : angle::NonCopyable
                               ShaderProgramID fshader,
                               const angle::HashMap<GLint, std::string> &attribLocs,
                               ShaderProgramID *programOut);
-    angle::Result initializeRendererProgram(Context *context, State *glState);
+    angle::Result initializeRendererProgram(Context *context,
+                                            State *glState,
+                                            const GLES1StateEnables &enables);
+    angle::Result createProgram(Context *context,
+                                State *glState,
+                                const GLES1StateEnables &enables,
+                                GLES1ProgramState *programStateOut);
+    void evictLeastRecentlyUsedProgram(Context *context);
+    angle::Result initializeUniformBuffers(Context *context);
+    angle::Result updateUniformBuffer(Context *context,
+                                      BufferID buffer,
+                                      const void *data,
+                                      size_t size);
+    static std::string GetStateEnableConstants(const GLES1StateEnables &enables);
 
     void setUniform1i(Context *context,
                       Program *programObject,
@@ -105,9 +151,6 @@ class GLES1Renderer final : angle::NonCopyable
 
     void setAttributesEnabled(Context *context, State *glState, AttributesMask mask);
 
-    static constexpr int kLightCount     = 8;
-    static constexpr int kClipPlaneCount = 6;
-
     static constexpr int kVertexAttribIndex           = 0;
     static constexpr int kNormalAttribIndex           = 1;
     static constexpr int kColorAttribIndex            = 2;
@@ -120,15 +163,9 @@ class GLES1Renderer final : angle::NonCopyable
     struct GLES1ProgramState
     {
         ShaderProgramID program;
-
-        UniformLocation projMatrixLoc;
-        UniformLocation modelviewMatrixLoc;
-        UniformLocation textureMatrixLoc;
-        UniformLocation modelviewInvTrLoc;
+        uint64_t lastUseSerial;
 
         // Texturing
-        UniformLocation enableTexture2DLoc;
-        UniformLocation enableTextureCubeMapLoc;
         std::array<UniformLocation, kTexUnitCount> tex2DSamplerLocs;
         std::array<UniformLocation, kTexUnitCount> texCubeSamplerLocs;
 
@@ -152,63 +189,15 @@ class GLES1Renderer final : angle::NonCopyable
         UniformLocation textureEnvColorLoc;
         UniformLocation rgbScaleLoc;
         UniformLocation alphaScaleLoc;
-        UniformLocation pointSpriteCoordReplaceLoc;
-
-        // Alpha test
-        UniformLocation enableAlphaTestLoc;
-        UniformLocation alphaFuncLoc;
-        UniformLocation alphaTestRefLoc;
-
-        // Shading, materials, and lighting
-        UniformLocation shadeModelFlatLoc;
-        UniformLocation enableLightingLoc;
-        UniformLocation enableRescaleNormalLoc;
-        UniformLocation enableNormalizeLoc;
-        UniformLocation enableColorMaterialLoc;
-
-        UniformLocation materialAmbientLoc;
-        UniformLocation materialDiffuseLoc;
-        UniformLocation materialSpecularLoc;
-        UniformLocation materialEmissiveLoc;
-        UniformLocation materialSpecularExponentLoc;
-
-        UniformLocation lightModelSceneAmbientLoc;
-        UniformLocation lightModelTwoSidedLoc;
 
-        UniformLocation lightEnablesLoc;
-        UniformLocation lightAmbientsLoc;
-        UniformLocation lightDiffusesLoc;
-        UniformLocation lightSpecularsLoc;
-        UniformLocation lightPositionsLoc;
-        UniformLocation lightDirectionsLoc;
-        UniformLocation lightSpotlightExponentsLoc;
-        UniformLocation lightSpotlightCutoffAnglesLoc;
-        UniformLocation lightAttenuationConstsLoc;
-        UniformLocation lightAttenuationLinearsLoc;
-        UniformLocation lightAttenuationQuadraticsLoc;
-
-        // Fog
-        UniformLocation fogEnableLoc;
-        UniformLocation fogModeLoc;
-        UniformLocation fogDensityLoc;
-        UniformLocation fogStartLoc;
-        UniformLocation fogEndLoc;
-        UniformLocation fogColorLoc;
-
-        // Clip planes
-        UniformLocation enableClipPlanesLoc;
-        UniformLocation clipPlaneEnablesLoc;
-        UniformLocation clipPlanesLoc;
+        UniformLocation lightModelTwoSidedLoc;
 
         // Point rasterization
-        UniformLocation pointRasterizationLoc;
         UniformLocation pointSizeMinLoc;
         UniformLocation pointSizeMaxLoc;
         UniformLocation pointDistanceAttenuationLoc;
-        UniformLocation pointSpriteEnabledLoc;
 
         // Draw texture
-        UniformLocation enableDrawTextureLoc;
         UniformLocation drawTextureCoordsLoc;
         UniformLocation drawTextureDimsLoc;
         UniformLocation drawTextureNormalizedCropRectLoc;
@@ -216,10 +205,6 @@ class GLES1Renderer final : angle::NonCopyable
 
     struct GLES1UniformBuffers
     {
-        std::array<Mat4Uniform, kTexUnitCount> textureMatrices;
-        std::array<GLint, kTexUnitCount> tex2DEnables;
-        std::array<GLint, kTexUnitCount> texCubeEnables;
-
         std::array<GLint, kTexUnitCount> texEnvModes;
         std::array<GLint, kTexUnitCount> texCombineRgbs;
         std::array<GLint, kTexUnitCount> texCombineAlphas;
@@ -239,31 +224,71 @@ class GLES1Renderer final : angle::NonCopyable
         std::array<Vec4Uniform, kTexUnitCount> texEnvColors;
         std::array<GLfloat, kTexUnitCount> texEnvRgbScales;
         std::array<GLfloat, kTexUnitCount> texEnvAlphaScales;
-        std::array<GLint, kTexUnitCount> pointSpriteCoordReplaces;
 
-        // Lighting
-        std::array<GLint, kLightCount> lightEnables;
+        // Texture crop rectangles
+        std::array<Vec4Uniform, kTexUnitCount> texCropRects;
+    };
+
+    // Mirrors the std140 layout of GLES1VertexUniforms in GLES1Shaders.inc.
+    struct GLES1VertexUniformBlock
+    {
+        Mat4Uniform projection;
+        Mat4Uniform modelview;
+        Mat4Uniform modelviewInvTr;
+        std::array<Mat4Uniform, kTexUnitCount> textureMatrices;
+    };
+
+    // Mirrors the std140 layout of GLES1FragmentUniforms in GLES1Shaders.inc.  The elements of
+    // scalar and vec3 arrays are vec4 aligned in std140, so they're kept in Vec4Uniforms.
+    struct GLES1FragmentUniformBlock
+    {
+        Vec4Uniform materialAmbient;
+        Vec4Uniform materialDiffuse;
+        Vec4Uniform materialSpecular;
+        Vec4Uniform materialEmissive;
+        Vec4Uniform lightModelSceneAmbient;
+        Vec4Uniform fogColor;
+
+        GLfloat materialSpecularExponent;
+        GLfloat fogDensity;
+        GLfloat fogStart;
+        GLfloat fogEnd;
+        GLfloat alphaTestRef;
+        GLint alphaFunc;
+        GLint fogMode;
+        GLint padding;
+
         std::array<Vec4Uniform, kLightCount> lightAmbients;
         std::array<Vec4Uniform, kLightCount> lightDiffuses;
         std::array<Vec4Uniform, kLightCount> lightSpeculars;
         std::array<Vec4Uniform, kLightCount> lightPositions;
-        std::array<Vec3Uniform, kLightCount> lightDirections;
-        std::array<GLfloat, kLightCount> spotlightExponents;
-        std::array<GLfloat, kLightCount> spotlightCutoffAngles;
-        std::array<GLfloat, kLightCount> attenuationConsts;
-        std::array<GLfloat, kLightCount> attenuationLinears;
-        std::array<GLfloat, kLightCount> attenuationQuadratics;
-
-        // Clip planes
-        std::array<GLint, kClipPlaneCount> clipPlaneEnables;
-        std::array<Vec4Uniform, kClipPlaneCount> clipPlanes;
+        std::array<Vec4Uniform, kLightCount> lightDirections;
+        std::array<Vec4Uniform, kLightCount> spotlightExponents;
+        std::array<Vec4Uniform, kLightCount> spotlightCutoffAngles;
+        std::array<Vec4Uniform, kLightCount> attenuationConsts;
+        std::array<Vec4Uniform, kLightCount> attenuationLinears;
+        std::array<Vec4Uniform, kLightCount> attenuationQuadratics;
 
-        // Texture crop rectangles
-        std::array<Vec4Uniform, kTexUnitCount> texCropRects;
+        std::array<Vec4Uniform, kClipPlaneCount> clipPlanes;
     };
 
     GLES1UniformBuffers mUniformBuffers;
-    GLES1ProgramState mProgramState;
+
+    static constexpr GLuint kVertexUniformBlockBinding   = 0;
+    static constexpr GLuint kFragmentUniformBlockBinding = 1;
+
+    // The uniform blocks are shared by all the programs, and each is uploaded in one go when any
+    // of its state changes.
+    GLES1VertexUniformBlock mVertexUniforms     = {};
+    GLES1FragmentUniformBlock mFragmentUniforms = {};
+    BufferID mVertexUniformBuffer               = {0};
+    BufferID mFragmentUniformBuffer             = {0};
+
+    // The programs built so far, by the bits of their GLES1StateEnables.
+    angle::HashMap<uint64_t, GLES1ProgramState> mProgramStates;
+    GLES1ProgramState *mCurrentProgramState = nullptr;
+    uint64_t mCurrentStateEnables           = 0;
+    uint64_t mProgramUseSerial              = 0;
 
     bool mDrawTextureEnabled      = false;
     GLfloat mDrawTextureCoords[4] = {0.0f, 0.0f, 0.0f, 0.0f};
@@ -22,13 +22,14 @@ struct HandleAllocator::HandleRangeComparator
     bool operator()(const HandleRange &range, GLuint handle) const { return (range.end < handle); }
 };
 
-HandleAllocator::HandleAllocator() : mBaseValue(1), mNextValue(1), mLoggingEnabled(false)
+HandleAllocator::HandleAllocator()
+    : mBaseValue(1), mNextValue(1), mLoggingEnabled(false), mRecycleReleasedHandles(false)
 {
     mUnallocatedList.push_back(HandleRange(1, std::numeric_limits<GLuint>::max()));
 }
 
 HandleAllocator::HandleAllocator(GLuint maximumHandleValue)
-    : mBaseValue(1), mNextValue(1), mLoggingEnabled(false)
+    : mBaseValue(1), mNextValue(1), mLoggingEnabled(false), mRecycleReleasedHandles(false)
 {
     mUnallocatedList.push_back(HandleRange(1, maximumHandleValue));
 }
@@ -46,10 +47,13 @@ GLuint HandleAllocator::allocate()
 {
     ASSERT(!mUnallocatedList.empty() || !mReleasedList.empty());
 
-    // Allocate from released list, logarithmic time for pop_heap.
+    // Allocate from released list, logarithmic time for pop_heap, constant time when recycling.
     if (!mReleasedList.empty())
     {
-        std::pop_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
+        if (!mRecycleReleasedHandles)
+        {
+            std::pop_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
+        }
         GLuint reusedHandle = mReleasedList.back();
         mReleasedList.pop_back();
 
@@ -91,9 +95,12 @@ void HandleAllocator::release(GLuint handle)
         WARN() << "HandleAllocator::release releasing " << handle << std::endl;
     }
 
-    // Add to released list, logarithmic time for push_heap.
+    // Add to released list, logarithmic time for push_heap, constant time when recycling.
     mReleasedList.push_back(handle);
-    std::push_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
+    if (!mRecycleReleasedHandles)
+    {
+        std::push_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
+    }
 }
 
 void HandleAllocator::reserve(GLuint handle)
@@ -109,6 +116,14 @@ void HandleAllocator::reserve(GLuint handle)
         auto releasedIt = std::find(mReleasedList.begin(), mReleasedList.end(), handle);
         if (releasedIt != mReleasedList.end())
         {
+            if (mRecycleReleasedHandles)
+            {
+                // The order of the stack is only a preference, so there is no need to keep it.
+                *releasedIt = mReleasedList.back();
+                mReleasedList.pop_back();
+                return;
+            }
+
             mReleasedList.erase(releasedIt);
             std::make_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
             return;
@@ -164,4 +179,10 @@ void HandleAllocator::enableLogging(bool enabled)
     mLoggingEnabled = enabled;
 }
 
+void HandleAllocator::setRecycleReleasedHandles(bool recycle)
+{
+    ASSERT(mReleasedList.empty());
+    mRecycleReleasedHandles = recycle;
+}
+
 }  // namespace gl
@@ -36,6 +36,12 @@ class HandleAllocator final : angle::NonCopyable
 
     void enableLogging(bool enabled);
 
+    // By default, released handles are reused smallest first, which costs a heap operation on
+    // every allocate and release.  When recycling, the most recently released handle is reused
+    // first instead, and both operations take constant time.  Must be set before any handle is
+    // released.
+    void setRecycleReleasedHandles(bool recycle);
+
   private:
     GLuint mBaseValue;
     GLuint mNextValue;
@@ -57,9 +63,11 @@ class HandleAllocator final : angle::NonCopyable
     // as ranges, and handles that were previously allocated and
     // released, stored in a heap.
     std::vector<HandleRange> mUnallocatedList;
+    // A min-heap, or a stack when recycling released handles.
     std::vector<GLuint> mReleasedList;
 
     bool mLoggingEnabled;
+    bool mRecycleReleasedHandles;
 };
 
 }  // namespace gl
@@ -193,4 +193,50 @@ TEST(HandleAllocatorTest, ReserveAfterReleaseBug)
     allocator.allocate();
 }
 
+// Tests that when recycling, the most recently released handle is reused first.
+TEST(HandleAllocatorTest, RecycleMostRecentlyReleased)
+{
+    gl::HandleAllocator allocator;
+    allocator.setRecycleReleasedHandles(true);
+
+    for (GLuint count = 1; count <= 5; count++)
+    {
+        EXPECT_EQ(count, allocator.allocate());
+    }
+
+    allocator.release(2);
+    allocator.release(4);
+
+    EXPECT_EQ(4u, allocator.allocate());
+    EXPECT_EQ(2u, allocator.allocate());
+    EXPECT_EQ(6u, allocator.allocate());
+}
+
+// Tests that when recycling, reserving a released handle removes it from the released handles.
+TEST(HandleAllocatorTest, RecycleReserveReleasedHandle)
+{
+    gl::HandleAllocator allocator;
+    allocator.setRecycleReleasedHandles(true);
+
+    for (GLuint count = 1; count <= 4; count++)
+    {
+        allocator.allocate();
+    }
+
+    for (GLuint count = 1; count <= 4; count++)
+    {
+        allocator.release(count);
+    }
+
+    allocator.reserve(2);
+
+    std::set<GLuint> reused;
+    for (int count = 0; count < 3; count++)
+    {
+        reused.insert(allocator.allocate());
+    }
+    EXPECT_EQ(std::set<GLuint>({1, 3, 4}), reused);
+    EXPECT_EQ(5u, allocator.allocate());
+}
+
 }  // anonymous namespace
@@ -17,6 +17,7 @@
 #include "libANGLE/BinaryStream.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Uniform.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/ProgramImpl.h"
 #include "platform/PlatformMethods.h"
@@ -91,13 +92,55 @@ HashStream &operator<<(HashStream &stream, const std::vector<gl::VariableLocatio
     return stream;
 }
 
+class CompressAndStoreProgramTask final : public angle::Closure
+{
+  public:
+    CompressAndStoreProgramTask(egl::BlobCache *blobCache,
+                                const egl::BlobCache::Key &programHash,
+                                angle::MemoryBuffer &&serializedProgram)
+        : mBlobCache(blobCache),
+          mProgramHash(programHash),
+          mSerializedProgram(std::move(serializedProgram))
+    {}
+
+    void operator()() override
+    {
+        angle::MemoryBuffer compressedData;
+        if (!egl::CompressBlobCacheData(mBlobCache->getCodec(), mSerializedProgram.size(),
+                                        mSerializedProgram.data(), &compressedData))
+        {
+            ERR() << "Error compressing binary data.";
+            return;
+        }
+
+        ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ProgramCache.ProgramBinarySizeBytes",
+                               static_cast<int>(compressedData.size()));
+
+        // TODO(syoussefi): to be removed.  Compatibility for Chrome until it supports
+        // EGL_ANDROID_blob_cache. http://anglebug.com/2516
+        auto *platform = ANGLEPlatformCurrent();
+        platform->cacheProgram(platform, mProgramHash, compressedData.size(),
+                               compressedData.data());
+
+        mBlobCache->put(mProgramHash, std::move(compressedData));
+    }
+
+  private:
+    egl::BlobCache *mBlobCache;
+    egl::BlobCache::Key mProgramHash;
+    angle::MemoryBuffer mSerializedProgram;
+};
+
 }  // anonymous namespace
 
 MemoryProgramCache::MemoryProgramCache(egl::BlobCache &blobCache)
     : mBlobCache(blobCache), mIssuedWarnings(0)
 {}
 
-MemoryProgramCache::~MemoryProgramCache() {}
+MemoryProgramCache::~MemoryProgramCache()
+{
+    waitForAllPendingPuts();
+}
 
 void MemoryProgramCache::ComputeHash(const Context *context,
                                      const Program *program,
@@ -181,18 +224,21 @@ bool MemoryProgramCache::get(const Context *context,
                              egl::BlobCache::Value *programOut,
                              size_t *programSizeOut)
 {
-    return mBlobCache.get(context->getScratchBuffer(), programHash, programOut, programSizeOut);
+    waitForPendingPut(programHash);
+    return mBlobCache.get(programHash, programOut, programSizeOut);
 }
 
 bool MemoryProgramCache::getAt(size_t index,
-                               const egl::BlobCache::Key **hashOut,
+                               egl::BlobCache::Key *hashOut,
                                egl::BlobCache::Value *programOut)
 {
+    waitForAllPendingPuts();
     return mBlobCache.getAt(index, hashOut, programOut);
 }
 
 void MemoryProgramCache::remove(const egl::BlobCache::Key &programHash)
 {
+    waitForPendingPut(programHash);
     mBlobCache.remove(programHash);
 }
 
@@ -209,23 +255,29 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
     angle::MemoryBuffer serializedProgram;
     ANGLE_TRY(program->serialize(context, &serializedProgram));
 
-    angle::MemoryBuffer compressedData;
-    if (!egl::CompressBlobCacheData(serializedProgram.size(), serializedProgram.data(),
-                                    &compressedData))
+    // A previous store of the same program must not overwrite this one.
+    waitForPendingPut(programHash);
+
+    std::shared_ptr<CompressAndStoreProgramTask> compressAndStoreTask =
+        std::make_shared<CompressAndStoreProgramTask>(&mBlobCache, programHash,
+                                                      std::move(serializedProgram));
+
+    std::lock_guard<std::mutex> lock(mPendingPutsMutex);
+
+    std::shared_ptr<angle::WaitableEvent> event = angle::WorkerThreadPool::PostWorkerTask(
+        context->getWorkerThreadPool(), compressAndStoreTask, angle::WorkerTaskPriority::Low);
+
+    // Forget about the stores that have already finished.
+    for (auto iter = mPendingPuts.begin(); iter != mPendingPuts.end();)
     {
-        ERR() << "Error compressing binary data.";
-        return angle::Result::Incomplete;
+        iter = iter->second->isReady() ? mPendingPuts.erase(iter) : std::next(iter);
     }
 
-    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ProgramCache.ProgramBinarySizeBytes",
-                           static_cast<int>(compressedData.size()));
-
-    // TODO(syoussefi): to be removed.  Compatibility for Chrome until it supports
-    // EGL_ANDROID_blob_cache. http://anglebug.com/2516
-    auto *platform = ANGLEPlatformCurrent();
-    platform->cacheProgram(platform, programHash, compressedData.size(), compressedData.data());
+    if (!event->isReady())
+    {
+        mPendingPuts[programHash] = event;
+    }
 
-    mBlobCache.put(programHash, std::move(compressedData));
     return angle::Result::Continue;
 }
 
@@ -256,27 +308,32 @@ bool MemoryProgramCache::putBinary(const egl::BlobCache::Key &programHash,
 
 void MemoryProgramCache::clear()
 {
+    waitForAllPendingPuts();
     mBlobCache.clear();
     mIssuedWarnings = 0;
 }
 
 void MemoryProgramCache::resize(size_t maxCacheSizeBytes)
 {
+    waitForAllPendingPuts();
     mBlobCache.resize(maxCacheSizeBytes);
 }
 
 size_t MemoryProgramCache::entryCount() const
 {
+    waitForAllPendingPuts();
     return mBlobCache.entryCount();
 }
 
 size_t MemoryProgramCache::trim(size_t limit)
 {
+    waitForAllPendingPuts();
     return mBlobCache.trim(limit);
 }
 
 size_t MemoryProgramCache::size() const
 {
+    waitForAllPendingPuts();
     return mBlobCache.size();
 }
 
@@ -285,4 +342,51 @@ size_t MemoryProgramCache::maxSize() const
     return mBlobCache.maxSize();
 }
 
+void MemoryProgramCache::waitForPendingPut(const egl::BlobCache::Key &programHash)
+{
+    std::shared_ptr<angle::WaitableEvent> event;
+    {
+        std::lock_guard<std::mutex> lock(mPendingPutsMutex);
+        auto iter = mPendingPuts.find(programHash);
+        if (iter == mPendingPuts.end())
+        {
+            return;
+        }
+        event = iter->second;
+    }
+
+    // The entry is kept until the store is done, so that other threads wait for it too.
+    event->wait();
+
+    std::lock_guard<std::mutex> lock(mPendingPutsMutex);
+    auto iter = mPendingPuts.find(programHash);
+    if (iter != mPendingPuts.end() && iter->second == event)
+    {
+        mPendingPuts.erase(iter);
+    }
+}
+
+void MemoryProgramCache::waitForAllPendingPuts() const
+{
+    std::vector<std::shared_ptr<angle::WaitableEvent>> events;
+    {
+        std::lock_guard<std::mutex> lock(mPendingPutsMutex);
+        for (const auto &pendingPut : mPendingPuts)
+        {
+            events.push_back(pendingPut.second);
+        }
+    }
+
+    for (const std::shared_ptr<angle::WaitableEvent> &event : events)
+    {
+        event->wait();
+    }
+
+    std::lock_guard<std::mutex> lock(mPendingPutsMutex);
+    for (auto iter = mPendingPuts.begin(); iter != mPendingPuts.end();)
+    {
+        iter = iter->second->isReady() ? mPendingPuts.erase(iter) : std::next(iter);
+    }
+}
+
 }  // namespace gl
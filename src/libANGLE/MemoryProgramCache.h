@@ -11,11 +11,19 @@
 #define LIBANGLE_MEMORY_PROGRAM_CACHE_H_
 
 #include <array>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "common/MemoryBuffer.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/Error.h"
 
+namespace angle
+{
+class WaitableEvent;
+}  // namespace angle
+
 namespace gl
 {
 class Context;
@@ -39,14 +47,14 @@ class MemoryProgramCache final : angle::NonCopyable
              size_t *programSizeOut);
 
     // For querying the contents of the cache.
-    bool getAt(size_t index,
-               const egl::BlobCache::Key **hashOut,
-               egl::BlobCache::Value *programOut);
+    bool getAt(size_t index, egl::BlobCache::Key *hashOut, egl::BlobCache::Value *programOut);
 
     // Evict a program from the binary cache.
     void remove(const egl::BlobCache::Key &programHash);
 
-    // Helper method that serializes a program.
+    // Helper method that serializes a program.  The serialized program is compressed and stored in
+    // the blob cache by the context's worker thread pool.  Until that's done, the other methods
+    // wait for it before accessing the blob cache.
     angle::Result putProgram(const egl::BlobCache::Key &programHash,
                              const Context *context,
                              const Program *program);
@@ -85,8 +93,16 @@ class MemoryProgramCache final : angle::NonCopyable
     size_t maxSize() const;
 
   private:
+    void waitForPendingPut(const egl::BlobCache::Key &programHash);
+    void waitForAllPendingPuts() const;
+
     egl::BlobCache &mBlobCache;
     unsigned int mIssuedWarnings;
+
+    // The compression and store tasks that may still be running, by program hash.
+    mutable std::mutex mPendingPutsMutex;
+    mutable std::unordered_map<egl::BlobCache::Key, std::shared_ptr<angle::WaitableEvent>>
+        mPendingPuts;
 };
 
 }  // namespace gl
@@ -0,0 +1,112 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores translated shaders and their reflection data in memory so they don't
+//   always have to be re-translated. Shares the blob cache of the program cache, so it can be
+//   warmed up from disk through the platform layer as well.
+
+#include "libANGLE/MemoryShaderCache.h"
+
+#include <anglebase/sha1.h>
+
+#include <sstream>
+
+#include "common/angle_version.h"
+#include "libANGLE/BinaryStream.h"
+#include "libANGLE/Compiler.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Shader.h"
+
+namespace gl
+{
+
+MemoryShaderCache::MemoryShaderCache(egl::BlobCache &blobCache, std::mutex &cacheMutex)
+    : mBlobCache(blobCache), mCacheMutex(cacheMutex)
+{}
+
+MemoryShaderCache::~MemoryShaderCache() {}
+
+void MemoryShaderCache::ComputeHash(const Context *context,
+                                    ShaderType shaderType,
+                                    const std::string &source,
+                                    ShCompilerInstance *compilerInstance,
+                                    ShCompileOptions compileOptions,
+                                    egl::BlobCache::Key *hashOut)
+{
+    constexpr char kSeparator = ':';
+
+    // The program cache shares the blob cache, so tag the key to keep the two apart.
+    std::ostringstream hashStream;
+    hashStream << "Shader" << kSeparator << ANGLE_COMMIT_HASH << kSeparator
+               << context->getString(GL_RENDERER) << kSeparator
+               << static_cast<int>(shaderType) << kSeparator
+               << compilerInstance->getShaderOutputType() << kSeparator << compileOptions
+               << kSeparator << compilerInstance->getBuiltinResourcesString() << kSeparator;
+
+    // These limits are checked against the translator output once it is collected.
+    hashStream << context->getCaps().maxComputeWorkGroupInvocations << kSeparator
+               << context->getCaps().maxComputeSharedMemorySize << kSeparator;
+
+    hashStream << source.length() << kSeparator << source;
+
+    // Call the secure SHA hashing function.
+    const std::string &shaderKey = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(shaderKey.c_str()),
+                               shaderKey.length(), hashOut->data());
+}
+
+bool MemoryShaderCache::getShader(const Context *context,
+                                  const egl::BlobCache::Key &shaderHash,
+                                  angle::MemoryBuffer *shaderOut)
+{
+    std::lock_guard<std::mutex> cacheLock(mCacheMutex);
+
+    egl::BlobCache::Value compressedShader;
+    size_t compressedSize = 0;
+    if (!mBlobCache.get(shaderHash, &compressedShader, &compressedSize))
+    {
+        return false;
+    }
+
+    if (!egl::DecompressBlobCacheData(compressedShader.data(), compressedSize, shaderOut))
+    {
+        ERR() << "Error decompressing shader data.";
+        mBlobCache.remove(shaderHash);
+        return false;
+    }
+
+    return true;
+}
+
+void MemoryShaderCache::putShader(const egl::BlobCache::Key &shaderHash, const Shader *shader)
+{
+    // If caching is effectively disabled, don't bother serializing the shader.
+    if (!mBlobCache.isCachingEnabled())
+    {
+        return;
+    }
+
+    BinaryOutputStream stream;
+    shader->serialize(&stream);
+
+    angle::MemoryBuffer compressedData;
+    if (!egl::CompressBlobCacheData(mBlobCache.getCodec(), stream.length(),
+                                    static_cast<const uint8_t *>(stream.data()), &compressedData))
+    {
+        ERR() << "Error compressing shader data.";
+        return;
+    }
+
+    std::lock_guard<std::mutex> cacheLock(mCacheMutex);
+    mBlobCache.put(shaderHash, std::move(compressedData));
+}
+
+void MemoryShaderCache::remove(const egl::BlobCache::Key &shaderHash)
+{
+    std::lock_guard<std::mutex> cacheLock(mCacheMutex);
+    mBlobCache.remove(shaderHash);
+}
+
+}  // namespace gl
@@ -0,0 +1,63 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores translated shaders and their reflection data in memory so they don't
+//   always have to be re-translated. Shares the blob cache of the program cache, so it can be
+//   warmed up from disk through the platform layer as well.
+
+#ifndef LIBANGLE_MEMORY_SHADER_CACHE_H_
+#define LIBANGLE_MEMORY_SHADER_CACHE_H_
+
+#include <mutex>
+
+#include <GLSLANG/ShaderLang.h>
+
+#include "common/MemoryBuffer.h"
+#include "common/PackedEnums.h"
+#include "libANGLE/BlobCache.h"
+
+namespace gl
+{
+class Context;
+class Shader;
+class ShCompilerInstance;
+
+// Shaders are resolved without a context at hand, so unlike the program cache this cache takes the
+// display's program cache mutex itself.
+class MemoryShaderCache final : angle::NonCopyable
+{
+  public:
+    MemoryShaderCache(egl::BlobCache &blobCache, std::mutex &cacheMutex);
+    ~MemoryShaderCache();
+
+    // Hashes everything the translator output depends on: the source, the translator resources
+    // and output type, and the final compile options.
+    static void ComputeHash(const Context *context,
+                            ShaderType shaderType,
+                            const std::string &source,
+                            ShCompilerInstance *compilerInstance,
+                            ShCompileOptions compileOptions,
+                            egl::BlobCache::Key *hashOut);
+
+    // Check the cache, and decompress the serialized shader if found. Evict existing hash if
+    // decompression fails.
+    bool getShader(const Context *context,
+                   const egl::BlobCache::Key &shaderHash,
+                   angle::MemoryBuffer *shaderOut);
+
+    // Helper method that serializes a successfully compiled shader.
+    void putShader(const egl::BlobCache::Key &shaderHash, const Shader *shader);
+
+    // Evict a shader from the cache.
+    void remove(const egl::BlobCache::Key &shaderHash);
+
+  private:
+    egl::BlobCache &mBlobCache;
+    std::mutex &mCacheMutex;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_MEMORY_SHADER_CACHE_H_
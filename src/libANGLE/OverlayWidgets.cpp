@@ -431,6 +431,22 @@ void AppendWidgetDataHelper::AppendVulkanWriteDescriptorSetCount(const overlay::
     AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
 }
 
+void AppendWidgetDataHelper::AppendVulkanDispatchWriteDescriptorSetCount(
+    const overlay::Widget *widget,
+    const gl::Extents &imageExtent,
+    TextWidgetData *textWidget,
+    GraphWidgetData *graphWidget,
+    OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](size_t maxValue) {
+        std::ostringstream text;
+        text << "Dispatch WriteDescriptorSet Count (Max: " << maxValue << ")";
+        return text.str();
+    };
+
+    AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
+}
+
 void AppendWidgetDataHelper::AppendVulkanDescriptorSetAllocations(const overlay::Widget *widget,
                                                                   const gl::Extents &imageExtent,
                                                                   TextWidgetData *textWidget,
@@ -476,6 +492,81 @@ void AppendWidgetDataHelper::AppendVulkanDynamicBufferAllocations(const overlay:
     AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
 }
 
+void AppendWidgetDataHelper::AppendVulkanPipelineCacheEvictions(const overlay::Widget *widget,
+                                                                const gl::Extents &imageExtent,
+                                                                TextWidgetData *textWidget,
+                                                                GraphWidgetData *graphWidget,
+                                                                OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](size_t maxValue) {
+        std::ostringstream text;
+        text << "Pipeline Cache Evictions (Max: " << maxValue << ")";
+        return text.str();
+    };
+
+    AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
+}
+
+void AppendWidgetDataHelper::AppendVulkanRenderPassGpuTime(const overlay::Widget *widget,
+                                                           const gl::Extents &imageExtent,
+                                                           TextWidgetData *textWidget,
+                                                           GraphWidgetData *graphWidget,
+                                                           OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](size_t maxValue) {
+        std::ostringstream text;
+        text << "RenderPass GPU Time (Max: " << maxValue << "us)";
+        return text.str();
+    };
+
+    AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
+}
+
+void AppendWidgetDataHelper::AppendVulkanFrameGpuTime(const overlay::Widget *widget,
+                                                      const gl::Extents &imageExtent,
+                                                      TextWidgetData *textWidget,
+                                                      GraphWidgetData *graphWidget,
+                                                      OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](size_t maxValue) {
+        std::ostringstream text;
+        text << "Frame GPU Time (Max: " << maxValue << "us)";
+        return text.str();
+    };
+
+    AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
+}
+
+void AppendWidgetDataHelper::AppendVulkanGarbageObjectCount(const overlay::Widget *widget,
+                                                            const gl::Extents &imageExtent,
+                                                            TextWidgetData *textWidget,
+                                                            GraphWidgetData *graphWidget,
+                                                            OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](size_t maxValue) {
+        std::ostringstream text;
+        text << "Garbage Objects (Max: " << maxValue << ")";
+        return text.str();
+    };
+
+    AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
+}
+
+void AppendWidgetDataHelper::AppendVulkanMemoryBudgetUsage(const overlay::Widget *widget,
+                                                           const gl::Extents &imageExtent,
+                                                           TextWidgetData *textWidget,
+                                                           GraphWidgetData *graphWidget,
+                                                           OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](size_t maxValue) {
+        std::ostringstream text;
+        text << "Memory Budget Used (Max: " << maxValue << "%)";
+        return text.str();
+    };
+
+    AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
+}
+
 std::ostream &AppendWidgetDataHelper::OutputPerSecond(std::ostream &out,
                                                       const overlay::PerSecond *perSecond)
 {
@@ -26,12 +26,24 @@ enum class WidgetId
     VulkanSecondaryCommandBufferPoolWaste,
     // Number of Descriptor Set writes in a frame (Count).
     VulkanWriteDescriptorSetCount,
+    // Number of Descriptor Set writes made to set up dispatches in a frame (Count).
+    VulkanDispatchWriteDescriptorSetCount,
     // Descriptor Set Allocations.
     VulkanDescriptorSetAllocations,
     // Shader Buffer Descriptor Set Cache Hit Rate.
     VulkanShaderBufferDSHitRate,
     // Buffer Allocations Made By vk::DynamicBuffer.
     VulkanDynamicBufferAllocations,
+    // Graphics Pipelines Evicted From The Pipeline Caches.
+    VulkanPipelineCacheEvictions,
+    // GPU time of each RenderPass (Microseconds).
+    VulkanRenderPassGpuTime,
+    // GPU time of each frame, from its first RenderPass to present (Microseconds).
+    VulkanFrameGpuTime,
+    // Garbage objects waiting to be destroyed, sampled at each present.
+    VulkanGarbageObjectCount,
+    // Percentage of the device memory budget in use, sampled at each present.
+    VulkanMemoryBudgetUsage,
 
     InvalidEnum,
     EnumCount = InvalidEnum,
@@ -46,8 +58,14 @@ enum class WidgetId
     PROC(VulkanRenderPassBufferCount)           \
     PROC(VulkanSecondaryCommandBufferPoolWaste) \
     PROC(VulkanWriteDescriptorSetCount)         \
+    PROC(VulkanDispatchWriteDescriptorSetCount) \
     PROC(VulkanDescriptorSetAllocations)        \
     PROC(VulkanShaderBufferDSHitRate)           \
-    PROC(VulkanDynamicBufferAllocations)
+    PROC(VulkanDynamicBufferAllocations)        \
+    PROC(VulkanPipelineCacheEvictions)          \
+    PROC(VulkanRenderPassGpuTime)               \
+    PROC(VulkanFrameGpuTime)                    \
+    PROC(VulkanGarbageObjectCount)              \
+    PROC(VulkanMemoryBudgetUsage)
 
 }  // namespace gl
@@ -17,6 +17,7 @@
 #include "common/debug.h"
 #include "common/platform.h"
 #include "common/string_utils.h"
+#include "common/system_utils.h"
 #include "common/utilities.h"
 #include "compiler/translator/blocklayout.h"
 #include "libANGLE/Context.h"
@@ -1208,7 +1209,24 @@ GLuint ProgramState::getUniformIndexFromName(const std::string &name) const
 
 GLuint ProgramState::getBufferVariableIndexFromName(const std::string &name) const
 {
-    return GetResourceIndexFromName(mBufferVariables, name);
+    return GetResourceIndexFromName(getBufferVariables(), name);
+}
+
+void ProgramState::decodeBufferVariables() const
+{
+    ASSERT(mBufferVariables.empty());
+
+    BinaryInputStream stream(mEncodedBufferVariables.data(), mEncodedBufferVariables.size());
+    size_t bufferVariableCount = stream.readInt<size_t>();
+    mBufferVariables.resize(bufferVariableCount);
+    for (BufferVariable &bufferVariable : mBufferVariables)
+    {
+        LoadBufferVariable(&stream, &bufferVariable);
+    }
+    ASSERT(!stream.error() && stream.endOfStream());
+
+    mEncodedBufferVariables.clear();
+    mEncodedBufferVariables.shrink_to_fit();
 }
 
 GLuint ProgramState::getUniformIndexFromLocation(UniformLocation location) const
@@ -1458,8 +1476,7 @@ angle::Result Program::linkImpl(const Context *context)
     ASSERT(!mLinkingState);
     // Don't make any local variables pointing to anything within the ProgramExecutable, since
     // unlink() could make a new ProgramExecutable making any references/pointers invalid.
-    auto *platform   = ANGLEPlatformCurrent();
-    double startTime = platform->currentTime(platform);
+    double startTime = angle::GetCurrentTime();
 
     // Unlink the program, but do not clear the validation-related caching yet, since we can still
     // use the previously linked program if linking the shaders fails.
@@ -1488,7 +1505,7 @@ angle::Result Program::linkImpl(const Context *context)
         {
             // Succeeded in loading the binaries in the front-end, back end may still be loading
             // asynchronously
-            double delta = platform->currentTime(platform) - startTime;
+            double delta = angle::GetCurrentTime() - startTime;
             int us       = static_cast<int>(delta * 1000000.0);
             ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ProgramCache.ProgramCacheHitTimeUS", us);
             return angle::Result::Continue;
@@ -1801,6 +1818,7 @@ void Program::unlink()
 
     mState.mUniformLocations.clear();
     mState.mBufferVariables.clear();
+    mState.mEncodedBufferVariables.clear();
     mState.mOutputVariableTypes.clear();
     mState.mDrawBufferTypeMask.reset();
     mState.mYUVOutput = false;
@@ -1992,6 +2010,12 @@ bool Program::isSeparable() const
     return mState.mSeparable;
 }
 
+bool Program::isPrewarmComplete() const
+{
+    ASSERT(!mLinkingState);
+    return mProgram->isPrewarmComplete();
+}
+
 void Program::deleteSelf(const Context *context)
 {
     ASSERT(mRefCount == 0 && mDeleteStatus);
@@ -2355,8 +2379,8 @@ void Program::getBufferVariableResourceName(GLuint index,
                                             GLchar *name) const
 {
     ASSERT(!mLinkingState);
-    ASSERT(index < mState.mBufferVariables.size());
-    getResourceName(mState.mBufferVariables[index].name, bufSize, length, name);
+    ASSERT(index < mState.getBufferVariables().size());
+    getResourceName(mState.getBufferVariables()[index].name, bufSize, length, name);
 }
 
 const std::string Program::getResourceName(const sh::ShaderVariable &resource) const
@@ -2514,7 +2538,7 @@ GLint Program::getActiveUniformCount() const
 size_t Program::getActiveBufferVariableCount() const
 {
     ASSERT(!mLinkingState);
-    return mLinked ? mState.mBufferVariables.size() : 0;
+    return mLinked ? mState.getBufferVariables().size() : 0;
 }
 
 GLint Program::getActiveUniformMaxLength() const
@@ -2569,8 +2593,8 @@ const VariableLocation &Program::getUniformLocation(UniformLocation location) co
 const BufferVariable &Program::getBufferVariableByIndex(GLuint index) const
 {
     ASSERT(!mLinkingState);
-    ASSERT(index < static_cast<size_t>(mState.mBufferVariables.size()));
-    return mState.mBufferVariables[index];
+    ASSERT(index < static_cast<size_t>(mState.getBufferVariables().size()));
+    return mState.getBufferVariables()[index];
 }
 
 UniformLocation Program::getUniformLocation(const std::string &name) const
@@ -4624,10 +4648,25 @@ angle::Result Program::serialize(const Context *context, angle::MemoryBuffer *bi
         stream.writeBool(variable.ignored);
     }
 
-    stream.writeInt(mState.getBufferVariables().size());
-    for (const BufferVariable &bufferVariable : mState.getBufferVariables())
+    // The buffer variables are written as a sized section so that loading can skip over them.
+    // A loaded program that hasn't decoded them yet writes them back as they are.
+    if (!mState.mEncodedBufferVariables.empty())
+    {
+        stream.writeInt(mState.mEncodedBufferVariables.size());
+        stream.writeBytes(mState.mEncodedBufferVariables.data(),
+                          mState.mEncodedBufferVariables.size());
+    }
+    else
     {
-        WriteBufferVariable(&stream, bufferVariable);
+        BinaryOutputStream bufferVariableStream;
+        bufferVariableStream.writeInt(mState.mBufferVariables.size());
+        for (const BufferVariable &bufferVariable : mState.mBufferVariables)
+        {
+            WriteBufferVariable(&bufferVariableStream, bufferVariable);
+        }
+        stream.writeInt(bufferVariableStream.length());
+        stream.writeBytes(static_cast<const uint8_t *>(bufferVariableStream.data()),
+                          bufferVariableStream.length());
     }
 
     // Warn the app layer if saving a binary with unsupported transform feedback.
@@ -4715,14 +4754,16 @@ angle::Result Program::deserialize(const Context *context,
         mState.mUniformLocations.push_back(variable);
     }
 
-    size_t bufferVariableCount = stream.readInt<size_t>();
-    ASSERT(mState.mBufferVariables.empty());
-    for (size_t bufferVarIndex = 0; bufferVarIndex < bufferVariableCount; ++bufferVarIndex)
+    // Only the size of the buffer variable section is checked here; it's decoded on first use.
+    size_t bufferVariableDataSize = stream.readInt<size_t>();
+    ASSERT(mState.mBufferVariables.empty() && mState.mEncodedBufferVariables.empty());
+    if (stream.error() || bufferVariableDataSize > stream.remainingSize())
     {
-        BufferVariable bufferVariable;
-        LoadBufferVariable(&stream, &bufferVariable);
-        mState.mBufferVariables.push_back(bufferVariable);
+        infoLog << "Invalid program binary.";
+        return angle::Result::Stop;
     }
+    mState.mEncodedBufferVariables.resize(bufferVariableDataSize);
+    stream.readBytes(mState.mEncodedBufferVariables.data(), bufferVariableDataSize);
 
     size_t outputTypeCount = stream.readInt<size_t>();
     for (size_t outputIndex = 0; outputIndex < outputTypeCount; ++outputIndex)
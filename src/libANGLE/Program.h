@@ -268,7 +268,11 @@ class ProgramState final : angle::NonCopyable
     {
         return mExecutable->getShaderStorageBlocks();
     }
-    const std::vector<BufferVariable> &getBufferVariables() const { return mBufferVariables; }
+    const std::vector<BufferVariable> &getBufferVariables() const
+    {
+        resolveBufferVariables();
+        return mBufferVariables;
+    }
     const std::vector<SamplerBinding> &getSamplerBindings() const
     {
         return mExecutable->getSamplerBindings();
@@ -374,6 +378,17 @@ class ProgramState final : angle::NonCopyable
     // Scans the sampler bindings for type conflicts with sampler 'textureUnitIndex'.
     void setSamplerUniformTextureTypeAndFormat(size_t textureUnitIndex);
 
+    // Buffer variables are only used by resource queries, so a program loaded from a binary
+    // decodes them when they are first queried.
+    void resolveBufferVariables() const
+    {
+        if (ANGLE_UNLIKELY(!mEncodedBufferVariables.empty()))
+        {
+            decodeBufferVariables();
+        }
+    }
+    void decodeBufferVariables() const;
+
     std::string mLabel;
 
     sh::WorkGroupSize mComputeShaderLocalSize;
@@ -384,7 +399,9 @@ class ProgramState final : angle::NonCopyable
     std::vector<std::string> mTransformFeedbackVaryingNames;
 
     std::vector<VariableLocation> mUniformLocations;
-    std::vector<BufferVariable> mBufferVariables;
+    mutable std::vector<BufferVariable> mBufferVariables;
+    // The serialized buffer variables of a program loaded from a binary, until they are decoded.
+    mutable std::vector<uint8_t> mEncodedBufferVariables;
     RangeUI mAtomicCounterUniformRange;
 
     DrawBufferMask mActiveOutputVariables;
@@ -515,6 +532,9 @@ class Program final : public LabeledObject, public angle::Subject, public HasAtt
     void setSeparable(bool separable);
     bool isSeparable() const;
 
+    // GL_ANGLE_prewarm_draw_state
+    bool isPrewarmComplete() const;
+
     void getAttachedShaders(GLsizei maxCount, GLsizei *count, ShaderProgramID *shaders) const;
 
     GLuint getAttributeLocation(const std::string &name) const;
@@ -4,11 +4,15 @@
 // found in the LICENSE file.
 //
 // ResourceMap_unittest:
-//   Unit tests for the ResourceMap template class.
+//   Unit tests for the ResourceMap and ConcurrentResourceMap template classes.
 //
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
+#include "libANGLE/ConcurrentResourceMap.h"
 #include "libANGLE/ResourceMap.h"
 
 using namespace gl;
@@ -133,4 +137,127 @@ TEST(ResourceMapTest, QueryUnassigned)
     ASSERT_FALSE(resourceMap.contains(100));
     ASSERT_EQ(nullptr, resourceMap.query(100));
 }
+
+// Tests assigning, querying and erasing in the concurrent map, across flat array growth and into
+// the hashed range.
+TEST(ConcurrentResourceMapTest, AssignQueryAndErase)
+{
+    ConcurrentResourceMap<size_t, GLuint> resourceMap;
+    std::vector<size_t> objects = {1, 7, 31, 32, 100, 1000, 0x4000, 0x10000};
+
+    for (size_t &object : objects)
+    {
+        ASSERT_FALSE(resourceMap.contains(static_cast<GLuint>(object)));
+        resourceMap.assign(static_cast<GLuint>(object), &object);
+    }
+
+    ASSERT_FALSE(resourceMap.empty());
+
+    size_t count = 0;
+    for (const auto &resource : resourceMap)
+    {
+        ASSERT_EQ(resource.first, *resource.second);
+        count++;
+    }
+    ASSERT_EQ(objects.size(), count);
+
+    for (size_t &object : objects)
+    {
+        ASSERT_TRUE(resourceMap.contains(static_cast<GLuint>(object)));
+        ASSERT_EQ(&object, resourceMap.query(static_cast<GLuint>(object)));
+    }
+
+    ASSERT_EQ(nullptr, resourceMap.query(2));
+    ASSERT_EQ(nullptr, resourceMap.query(0x4001));
+
+    for (size_t object : objects)
+    {
+        size_t *found = nullptr;
+        ASSERT_TRUE(resourceMap.erase(static_cast<GLuint>(object), &found));
+        ASSERT_EQ(object, *found);
+        ASSERT_FALSE(resourceMap.erase(static_cast<GLuint>(object), &found));
+    }
+
+    ASSERT_TRUE(resourceMap.empty());
+}
+
+// Tests that reserved handles are reported by contains() but not by query() or iteration.
+TEST(ConcurrentResourceMapTest, ReservedHandles)
+{
+    ConcurrentResourceMap<size_t, GLuint> resourceMap;
+    resourceMap.assign(5, nullptr);
+
+    ASSERT_TRUE(resourceMap.contains(5));
+    ASSERT_EQ(nullptr, resourceMap.query(5));
+    ASSERT_TRUE(resourceMap.empty());
+
+    resourceMap.clear();
+    ASSERT_FALSE(resourceMap.contains(5));
+}
+
+// Stress test: reader threads query continuously while a writer creates and deletes objects and
+// grows the flat array. Readers must only ever see nullptr or the object assigned to the handle.
+TEST(ConcurrentResourceMapTest, ConcurrentQueryStress)
+{
+    constexpr size_t kHandleCount = 4096;
+    constexpr size_t kRounds      = 8;
+    constexpr size_t kReaderCount = 4;
+
+    ConcurrentResourceMap<size_t, GLuint> resourceMap;
+    std::vector<size_t> objects(kHandleCount);
+    for (size_t index = 0; index < kHandleCount; ++index)
+    {
+        objects[index] = index;
+    }
+
+    std::atomic<bool> done(false);
+    std::atomic<size_t> mismatches(0);
+
+    auto readerFunc = [&](size_t seed) {
+        size_t handle = seed;
+        while (!done.load(std::memory_order_acquire))
+        {
+            handle = (handle * 1103515245 + 12345) % kHandleCount;
+
+            size_t *found = resourceMap.query(static_cast<GLuint>(handle));
+            if (found != nullptr && found != &objects[handle])
+            {
+                mismatches++;
+            }
+        }
+    };
+
+    std::vector<std::thread> readers;
+    for (size_t reader = 0; reader < kReaderCount; ++reader)
+    {
+        readers.emplace_back(readerFunc, reader);
+    }
+
+    for (size_t round = 0; round < kRounds; ++round)
+    {
+        // Assign in increasing order so the flat array grows while readers are active.
+        for (size_t index = round; index < kHandleCount; index += kRounds)
+        {
+            resourceMap.assign(static_cast<GLuint>(index), &objects[index]);
+        }
+
+        for (size_t index = round; index < kHandleCount; index += 2 * kRounds)
+        {
+            size_t *found = nullptr;
+            EXPECT_TRUE(resourceMap.erase(static_cast<GLuint>(index), &found));
+            EXPECT_EQ(&objects[index], found);
+        }
+    }
+
+    done = true;
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+
+    ASSERT_EQ(0u, mismatches.load());
+
+    resourceMap.clear();
+    ASSERT_TRUE(resourceMap.empty());
+}
 }  // anonymous namespace
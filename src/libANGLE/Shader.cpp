@@ -15,10 +15,13 @@
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/utilities.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/MemoryShaderCache.h"
+#include "libANGLE/Program.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/ShaderImpl.h"
@@ -52,6 +55,82 @@ const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableLis
     return *variableList;
 }
 
+void WriteShaderVariables(BinaryOutputStream *stream, const std::vector<sh::ShaderVariable> &vars)
+{
+    stream->writeInt(vars.size());
+    for (const sh::ShaderVariable &var : vars)
+    {
+        WriteShaderVar(stream, var);
+    }
+}
+
+void LoadShaderVariables(BinaryInputStream *stream, std::vector<sh::ShaderVariable> *vars)
+{
+    vars->resize(stream->readInt<size_t>());
+    for (sh::ShaderVariable &var : *vars)
+    {
+        LoadShaderVar(stream, &var);
+    }
+}
+
+void WriteShInterfaceBlocks(BinaryOutputStream *stream,
+                            const std::vector<sh::InterfaceBlock> &blocks)
+{
+    stream->writeInt(blocks.size());
+    for (const sh::InterfaceBlock &block : blocks)
+    {
+        stream->writeString(block.name);
+        stream->writeString(block.mappedName);
+        stream->writeString(block.instanceName);
+        stream->writeInt(block.arraySize);
+        stream->writeEnum(block.layout);
+        stream->writeBool(block.isRowMajorLayout);
+        stream->writeInt(block.binding);
+        stream->writeBool(block.staticUse);
+        stream->writeBool(block.active);
+        stream->writeEnum(block.blockType);
+        WriteShaderVariables(stream, block.fields);
+    }
+}
+
+void LoadShInterfaceBlocks(BinaryInputStream *stream, std::vector<sh::InterfaceBlock> *blocks)
+{
+    blocks->resize(stream->readInt<size_t>());
+    for (sh::InterfaceBlock &block : *blocks)
+    {
+        stream->readString(&block.name);
+        stream->readString(&block.mappedName);
+        stream->readString(&block.instanceName);
+        block.arraySize        = stream->readInt<unsigned int>();
+        block.layout           = stream->readEnum<sh::BlockLayoutType>();
+        block.isRowMajorLayout = stream->readBool();
+        block.binding          = stream->readInt<int>();
+        block.staticUse        = stream->readBool();
+        block.active           = stream->readBool();
+        block.blockType        = stream->readEnum<sh::BlockType>();
+        LoadShaderVariables(stream, &block.fields);
+    }
+}
+
+template <typename T>
+void WriteOptionalInt(BinaryOutputStream *stream, const Optional<T> &value)
+{
+    stream->writeBool(value.valid());
+    if (value.valid())
+    {
+        stream->writeInt(static_cast<int>(value.value()));
+    }
+}
+
+template <typename T>
+void LoadOptionalInt(BinaryInputStream *stream, Optional<T> *value)
+{
+    if (stream->readBool())
+    {
+        *value = static_cast<T>(stream->readInt<int>());
+    }
+}
+
 }  // anonymous namespace
 
 // true if varying x has a higher priority in packing than y
@@ -118,6 +197,7 @@ struct Shader::CompilingState
 {
     std::shared_ptr<rx::WaitableCompileEvent> compileEvent;
     ShCompilerInstance shCompilerInstance;
+    MemoryShaderCache *shaderCache;
 };
 
 ShaderState::ShaderState(ShaderType shaderType)
@@ -311,13 +391,10 @@ void Shader::getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length,
     GetSourceImpl(debugInfo, bufSize, length, buffer);
 }
 
-void Shader::compile(const Context *context)
+void Shader::resetCompiledState()
 {
-    resolveCompile();
-
     mState.mTranslatedSource.clear();
     mState.mCompiledBinary.clear();
-    mInfoLog.clear();
     mState.mShaderVersion = 100;
     mState.mInputVaryings.clear();
     mState.mOutputVaryings.clear();
@@ -338,6 +415,14 @@ void Shader::compile(const Context *context)
     mState.mTessGenPointMode               = 0;
     mState.mEarlyFragmentTestsOptimization = false;
     mState.mSpecConstUsageBits.reset();
+}
+
+void Shader::compile(const Context *context)
+{
+    resolveCompile();
+
+    resetCompiledState();
+    mInfoLog.clear();
 
     mState.mCompileStatus = CompileStatus::COMPILE_REQUESTED;
     mBoundCompiler.set(context, context->getCompiler());
@@ -382,6 +467,7 @@ void Shader::compile(const Context *context)
 
     mCompilingState.reset(new CompilingState());
     mCompilingState->shCompilerInstance = std::move(compilerInstance);
+    mCompilingState->shaderCache        = context->getMemoryShaderCache();
     mCompilingState->compileEvent =
         mImplementation->compile(context, &(mCompilingState->shCompilerInstance), options);
 }
@@ -405,8 +491,28 @@ void Shader::resolveCompile()
         mCompilingState.reset();
     });
 
+    rx::WaitableCompileEvent *compileEvent = mCompilingState->compileEvent.get();
+    MemoryShaderCache *shaderCache         = mCompilingState->shaderCache;
+
+    const angle::MemoryBuffer *cachedShader = compileEvent->getCachedShader();
+    if (cachedShader != nullptr)
+    {
+        BinaryInputStream stream(cachedShader->data(), cachedShader->size());
+        if (deserialize(stream))
+        {
+            mState.mCompileStatus = CompileStatus::COMPILED;
+            return;
+        }
+
+        // The cache entry is unusable, evict it and run the translator after all.
+        WARN() << "Failed to load translated shader from cache.";
+        shaderCache->remove(compileEvent->getShaderCacheKey().value());
+        resetCompiledState();
+        compileEvent->translate();
+    }
+
     ShHandle compilerHandle = mCompilingState->shCompilerInstance.getHandle();
-    if (!mCompilingState->compileEvent->getResult())
+    if (!compileEvent->getResult())
     {
         mInfoLog += sh::GetInfoLog(compilerHandle);
         INFO() << std::endl << mInfoLog;
@@ -586,8 +692,86 @@ void Shader::resolveCompile()
 
     ASSERT(!mState.mTranslatedSource.empty() || !mState.mCompiledBinary.empty());
 
-    bool success          = mCompilingState->compileEvent->postTranslate(&mInfoLog);
+    bool success          = compileEvent->postTranslate(&mInfoLog);
     mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+
+    if (success && compileEvent->getShaderCacheKey().valid())
+    {
+        shaderCache->putShader(compileEvent->getShaderCacheKey().value(), this);
+    }
+}
+
+void Shader::serialize(BinaryOutputStream *stream) const
+{
+    stream->writeString(mState.mTranslatedSource);
+    stream->writeIntVector(mState.mCompiledBinary);
+    stream->writeInt(mState.mShaderVersion);
+
+    stream->writeInt(mState.mLocalSize[0]);
+    stream->writeInt(mState.mLocalSize[1]);
+    stream->writeInt(mState.mLocalSize[2]);
+
+    WriteShaderVariables(stream, mState.mInputVaryings);
+    WriteShaderVariables(stream, mState.mOutputVaryings);
+    WriteShaderVariables(stream, mState.mUniforms);
+    WriteShInterfaceBlocks(stream, mState.mUniformBlocks);
+    WriteShInterfaceBlocks(stream, mState.mShaderStorageBlocks);
+    WriteShaderVariables(stream, mState.mAllAttributes);
+    WriteShaderVariables(stream, mState.mActiveAttributes);
+    WriteShaderVariables(stream, mState.mActiveOutputVariables);
+
+    stream->writeBool(mState.mEarlyFragmentTestsOptimization);
+    stream->writeInt(mState.mSpecConstUsageBits.bits());
+    stream->writeInt(mState.mNumViews);
+
+    WriteOptionalInt(stream, mState.mGeometryShaderInputPrimitiveType);
+    WriteOptionalInt(stream, mState.mGeometryShaderOutputPrimitiveType);
+    WriteOptionalInt(stream, mState.mGeometryShaderMaxVertices);
+    stream->writeInt(mState.mGeometryShaderInvocations);
+
+    stream->writeInt(mState.mTessControlShaderVertices);
+    stream->writeInt(mState.mTessGenMode);
+    stream->writeInt(mState.mTessGenSpacing);
+    stream->writeInt(mState.mTessGenVertexOrder);
+    stream->writeInt(mState.mTessGenPointMode);
+}
+
+bool Shader::deserialize(BinaryInputStream &stream)
+{
+    stream.readString(&mState.mTranslatedSource);
+    stream.readIntVector<uint32_t>(&mState.mCompiledBinary);
+    mState.mShaderVersion = stream.readInt<int>();
+
+    mState.mLocalSize[0] = stream.readInt<int>();
+    mState.mLocalSize[1] = stream.readInt<int>();
+    mState.mLocalSize[2] = stream.readInt<int>();
+
+    LoadShaderVariables(&stream, &mState.mInputVaryings);
+    LoadShaderVariables(&stream, &mState.mOutputVaryings);
+    LoadShaderVariables(&stream, &mState.mUniforms);
+    LoadShInterfaceBlocks(&stream, &mState.mUniformBlocks);
+    LoadShInterfaceBlocks(&stream, &mState.mShaderStorageBlocks);
+    LoadShaderVariables(&stream, &mState.mAllAttributes);
+    LoadShaderVariables(&stream, &mState.mActiveAttributes);
+    LoadShaderVariables(&stream, &mState.mActiveOutputVariables);
+
+    mState.mEarlyFragmentTestsOptimization = stream.readBool();
+    mState.mSpecConstUsageBits             = rx::SpecConstUsageBits(stream.readInt<uint32_t>());
+    mState.mNumViews                       = stream.readInt<int>();
+
+    LoadOptionalInt(&stream, &mState.mGeometryShaderInputPrimitiveType);
+    LoadOptionalInt(&stream, &mState.mGeometryShaderOutputPrimitiveType);
+    LoadOptionalInt(&stream, &mState.mGeometryShaderMaxVertices);
+    mState.mGeometryShaderInvocations = stream.readInt<int>();
+
+    mState.mTessControlShaderVertices = stream.readInt<int>();
+    mState.mTessGenMode               = stream.readInt<GLenum>();
+    mState.mTessGenSpacing            = stream.readInt<GLenum>();
+    mState.mTessGenVertexOrder        = stream.readInt<GLenum>();
+    mState.mTessGenPointMode          = stream.readInt<GLenum>();
+
+    return !stream.error() && stream.endOfStream() &&
+           (!mState.mTranslatedSource.empty() || !mState.mCompiledBinary.empty());
 }
 
 void Shader::addRef()
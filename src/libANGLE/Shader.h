@@ -43,8 +43,11 @@ class WorkerThreadPool;
 
 namespace gl
 {
+class BinaryInputStream;
+class BinaryOutputStream;
 class CompileTask;
 class Context;
+class MemoryShaderCache;
 class ShaderProgramManager;
 class State;
 
@@ -247,6 +250,9 @@ class Shader final : angle::NonCopyable, public LabeledObject
     unsigned int getMaxComputeSharedMemory() const { return mMaxComputeSharedMemory; }
     bool hasBeenDeleted() const { return mDeleteStatus; }
 
+    // Serializes the translator output of a compiled shader for the shader cache.
+    void serialize(BinaryOutputStream *stream) const;
+
   private:
     struct CompilingState;
 
@@ -256,7 +262,9 @@ class Shader final : angle::NonCopyable, public LabeledObject
                               GLsizei *length,
                               char *buffer);
 
+    void resetCompiledState();
     void resolveCompile();
+    bool deserialize(BinaryInputStream &stream);
 
     ShaderState mState;
     std::unique_ptr<rx::ShaderImpl> mImplementation;
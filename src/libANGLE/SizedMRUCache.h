@@ -115,6 +115,17 @@ class SizedMRUCache final : angle::NonCopyable
 
     size_t maxSize() const { return mMaximumTotalSize; }
 
+    // Erases the least recently used entry and returns its size.
+    size_t eraseLeastRecentlyUsed()
+    {
+        ASSERT(!mStore.empty());
+        auto iter         = mStore.rbegin();
+        size_t erasedSize = iter->second.size;
+        mCurrentSize -= erasedSize;
+        mStore.Erase(iter);
+        return erasedSize;
+    }
+
   private:
     struct ValueAndSize
     {
@@ -139,9 +150,9 @@ class SizedMRUCache final : angle::NonCopyable
     SizedMRUCacheStore mStore;
 };
 
-// Helper function used in a few places.
+// Helper function used in a few places. Returns the number of evicted elements.
 template <typename T>
-void TrimCache(size_t maxStates, size_t gcLimit, const char *name, T *cache)
+size_t TrimCache(size_t maxStates, size_t gcLimit, const char *name, T *cache)
 {
     const size_t kGarbageCollectionLimit = maxStates / 2 + gcLimit;
 
@@ -149,8 +160,11 @@ void TrimCache(size_t maxStates, size_t gcLimit, const char *name, T *cache)
     {
         WARN() << "Overflowed the " << name << " cache limit of " << (maxStates / 2)
                << " elements, removing the least recently used to make room.";
+        size_t previousSize = cache->size();
         cache->ShrinkToSize(maxStates / 2);
+        return previousSize - cache->size();
     }
+    return 0;
 }
 }  // namespace angle
 #endif  // LIBANGLE_SIZED_MRU_CACHE_H_
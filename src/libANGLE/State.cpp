@@ -114,6 +114,13 @@ bool IsTextureCompatibleWithSampler(TextureType texture, TextureType sampler)
     return false;
 }
 
+bool IsPixelStoreStateEqual(const PixelStoreStateBase &a, const PixelStoreStateBase &b)
+{
+    return a.alignment == b.alignment && a.rowLength == b.rowLength && a.skipRows == b.skipRows &&
+           a.skipPixels == b.skipPixels && a.imageHeight == b.imageHeight &&
+           a.skipImages == b.skipImages;
+}
+
 uint32_t gIDCounter = 1;
 }  // namespace
 
@@ -3635,6 +3642,107 @@ AttributesMask State::getAndResetDirtyCurrentValues() const
     return retVal;
 }
 
+void State::setDirtyBitsDifferingFrom(const State &previous)
+{
+    // Only the state values are compared.  Object bindings, the program, the current vertex
+    // attribute values and the extended state are always synced again.
+    const RasterizerState &rasterizer     = previous.mRasterizer;
+    const DepthStencilState &depthStencil = previous.mDepthStencil;
+    const BlendStateExt &blendStateExt    = previous.mBlendStateExt;
+
+    const std::pair<bool, DirtyBitType> equalStates[] = {
+        {mScissorTest == previous.mScissorTest, DIRTY_BIT_SCISSOR_TEST_ENABLED},
+        {mScissor == previous.mScissor, DIRTY_BIT_SCISSOR},
+        {mViewport == previous.mViewport, DIRTY_BIT_VIEWPORT},
+        {mNearZ == previous.mNearZ && mFarZ == previous.mFarZ, DIRTY_BIT_DEPTH_RANGE},
+        {mBlendStateExt.mEnabledMask == blendStateExt.mEnabledMask, DIRTY_BIT_BLEND_ENABLED},
+        {mBlendColor == previous.mBlendColor, DIRTY_BIT_BLEND_COLOR},
+        {mBlendStateExt.mSrcColor == blendStateExt.mSrcColor &&
+             mBlendStateExt.mDstColor == blendStateExt.mDstColor &&
+             mBlendStateExt.mSrcAlpha == blendStateExt.mSrcAlpha &&
+             mBlendStateExt.mDstAlpha == blendStateExt.mDstAlpha,
+         DIRTY_BIT_BLEND_FUNCS},
+        {mBlendStateExt.mEquationColor == blendStateExt.mEquationColor &&
+             mBlendStateExt.mEquationAlpha == blendStateExt.mEquationAlpha,
+         DIRTY_BIT_BLEND_EQUATIONS},
+        {mBlendStateExt.mColorMask == blendStateExt.mColorMask, DIRTY_BIT_COLOR_MASK},
+        {mSampleAlphaToCoverage == previous.mSampleAlphaToCoverage,
+         DIRTY_BIT_SAMPLE_ALPHA_TO_COVERAGE_ENABLED},
+        {mSampleCoverage == previous.mSampleCoverage, DIRTY_BIT_SAMPLE_COVERAGE_ENABLED},
+        {mSampleCoverageValue == previous.mSampleCoverageValue &&
+             mSampleCoverageInvert == previous.mSampleCoverageInvert,
+         DIRTY_BIT_SAMPLE_COVERAGE},
+        {mSampleMask == previous.mSampleMask, DIRTY_BIT_SAMPLE_MASK_ENABLED},
+        {mSampleMaskValues == previous.mSampleMaskValues, DIRTY_BIT_SAMPLE_MASK},
+        {mDepthStencil.depthTest == depthStencil.depthTest, DIRTY_BIT_DEPTH_TEST_ENABLED},
+        {mDepthStencil.depthFunc == depthStencil.depthFunc, DIRTY_BIT_DEPTH_FUNC},
+        {mDepthStencil.depthMask == depthStencil.depthMask, DIRTY_BIT_DEPTH_MASK},
+        {mDepthStencil.stencilTest == depthStencil.stencilTest, DIRTY_BIT_STENCIL_TEST_ENABLED},
+        {mDepthStencil.stencilFunc == depthStencil.stencilFunc &&
+             mDepthStencil.stencilMask == depthStencil.stencilMask &&
+             mStencilRef == previous.mStencilRef,
+         DIRTY_BIT_STENCIL_FUNCS_FRONT},
+        {mDepthStencil.stencilBackFunc == depthStencil.stencilBackFunc &&
+             mDepthStencil.stencilBackMask == depthStencil.stencilBackMask &&
+             mStencilBackRef == previous.mStencilBackRef,
+         DIRTY_BIT_STENCIL_FUNCS_BACK},
+        {mDepthStencil.stencilFail == depthStencil.stencilFail &&
+             mDepthStencil.stencilPassDepthFail == depthStencil.stencilPassDepthFail &&
+             mDepthStencil.stencilPassDepthPass == depthStencil.stencilPassDepthPass,
+         DIRTY_BIT_STENCIL_OPS_FRONT},
+        {mDepthStencil.stencilBackFail == depthStencil.stencilBackFail &&
+             mDepthStencil.stencilBackPassDepthFail == depthStencil.stencilBackPassDepthFail &&
+             mDepthStencil.stencilBackPassDepthPass == depthStencil.stencilBackPassDepthPass,
+         DIRTY_BIT_STENCIL_OPS_BACK},
+        {mDepthStencil.stencilWritemask == depthStencil.stencilWritemask,
+         DIRTY_BIT_STENCIL_WRITEMASK_FRONT},
+        {mDepthStencil.stencilBackWritemask == depthStencil.stencilBackWritemask,
+         DIRTY_BIT_STENCIL_WRITEMASK_BACK},
+        {mRasterizer.cullFace == rasterizer.cullFace, DIRTY_BIT_CULL_FACE_ENABLED},
+        {mRasterizer.cullMode == rasterizer.cullMode, DIRTY_BIT_CULL_FACE},
+        {mRasterizer.frontFace == rasterizer.frontFace, DIRTY_BIT_FRONT_FACE},
+        {mRasterizer.polygonOffsetFill == rasterizer.polygonOffsetFill,
+         DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED},
+        {mRasterizer.polygonOffsetFactor == rasterizer.polygonOffsetFactor &&
+             mRasterizer.polygonOffsetUnits == rasterizer.polygonOffsetUnits,
+         DIRTY_BIT_POLYGON_OFFSET},
+        {mRasterizer.rasterizerDiscard == rasterizer.rasterizerDiscard,
+         DIRTY_BIT_RASTERIZER_DISCARD_ENABLED},
+        {mLineWidth == previous.mLineWidth, DIRTY_BIT_LINE_WIDTH},
+        {mPrimitiveRestart == previous.mPrimitiveRestart, DIRTY_BIT_PRIMITIVE_RESTART_ENABLED},
+        {mColorClearValue == previous.mColorClearValue, DIRTY_BIT_CLEAR_COLOR},
+        {mDepthClearValue == previous.mDepthClearValue, DIRTY_BIT_CLEAR_DEPTH},
+        {mStencilClearValue == previous.mStencilClearValue, DIRTY_BIT_CLEAR_STENCIL},
+        {IsPixelStoreStateEqual(mUnpack, previous.mUnpack), DIRTY_BIT_UNPACK_STATE},
+        {IsPixelStoreStateEqual(mPack, previous.mPack) &&
+             mPack.reverseRowOrder == previous.mPack.reverseRowOrder,
+         DIRTY_BIT_PACK_STATE},
+        {mRasterizer.dither == rasterizer.dither, DIRTY_BIT_DITHER_ENABLED},
+        {mMultiSampling == previous.mMultiSampling, DIRTY_BIT_MULTISAMPLING},
+        {mSampleAlphaToOne == previous.mSampleAlphaToOne, DIRTY_BIT_SAMPLE_ALPHA_TO_ONE},
+        {mCoverageModulation == previous.mCoverageModulation, DIRTY_BIT_COVERAGE_MODULATION},
+        {mFramebufferSRGB == previous.mFramebufferSRGB,
+         DIRTY_BIT_FRAMEBUFFER_SRGB_WRITE_CONTROL_MODE},
+        {mProvokingVertex == previous.mProvokingVertex, DIRTY_BIT_PROVOKING_VERTEX},
+        {mIsSampleShadingEnabled == previous.mIsSampleShadingEnabled &&
+             mMinSampleShading == previous.mMinSampleShading,
+         DIRTY_BIT_SAMPLE_SHADING},
+        {mPatchVertices == previous.mPatchVertices, DIRTY_BIT_PATCH_VERTICES},
+    };
+
+    DirtyBits equalBits;
+    for (const std::pair<bool, DirtyBitType> &equalState : equalStates)
+    {
+        equalBits.set(equalState.second, equalState.first);
+    }
+
+    // A change |previous| hasn't synced yet may not have reached the backend.
+    equalBits &= ~previous.mDirtyBits;
+
+    mDirtyBits |= ~equalBits;
+    mDirtyCurrentValues.set();
+}
+
 State::ExtendedDirtyBits State::getAndResetExtendedDirtyBits() const
 {
     ExtendedDirtyBits retVal = mExtendedDirtyBits;
@@ -724,6 +724,10 @@ class State : angle::NonCopyable
         mDirtyBits.set();
         mDirtyCurrentValues.set();
     }
+    // Like setAllDirtyBits, but leaves the plain state values that are equal to |previous| clean,
+    // as long as |previous| has no pending change to them either.  Used when the backend state was
+    // last synced from |previous|.
+    void setDirtyBitsDifferingFrom(const State &previous);
 
     using ExtendedDirtyBits = angle::BitSet32<EXTENDED_DIRTY_BIT_MAX>;
     const ExtendedDirtyBits &getExtendedDirtyBits() const { return mExtendedDirtyBits; }
@@ -144,6 +144,8 @@ TextureState::TextureState(TextureType type)
       mImmutableFormat(false),
       mImmutableLevels(0),
       mUsage(GL_NONE),
+      mSparse(false),
+      mVirtualPageSizeIndex(0),
       mImageDescs((IMPLEMENTATION_MAX_TEXTURE_LEVELS + 1) * (type == TextureType::CubeMap ? 6 : 1)),
       mCropRect(0, 0, 0, 0),
       mGenerateMipmapHint(GL_FALSE),
@@ -726,7 +728,8 @@ Texture::Texture(rx::GLImplFactory *factory, TextureID id, TextureType type)
       mBufferObserver(this, kBufferSubjectIndex),
       mLabel(),
       mBoundSurface(nullptr),
-      mBoundStream(nullptr)
+      mBoundStream(nullptr),
+      mCompletenessCacheNextEntry(0)
 {
     mImplObserver.bind(mTexture);
 
@@ -1046,6 +1049,36 @@ GLenum Texture::getUsage() const
     return mState.mUsage;
 }
 
+void Texture::setSparse(bool sparse)
+{
+    mState.mSparse = sparse;
+}
+
+bool Texture::isSparse() const
+{
+    return mState.mSparse;
+}
+
+void Texture::setVirtualPageSizeIndex(GLuint index)
+{
+    mState.mVirtualPageSizeIndex = index;
+}
+
+GLuint Texture::getVirtualPageSizeIndex() const
+{
+    return mState.mVirtualPageSizeIndex;
+}
+
+GLuint Texture::getNumSparseLevels() const
+{
+    if (!mState.mImmutableFormat || !mState.mSparse)
+    {
+        return 0;
+    }
+
+    return mTexture->getSparseLevelCount();
+}
+
 const TextureState &Texture::getTextureState() const
 {
     return mState;
@@ -1690,6 +1723,17 @@ angle::Result Texture::generateMipmap(Context *context)
     return angle::Result::Continue;
 }
 
+angle::Result Texture::setPageCommitment(Context *context,
+                                         GLint level,
+                                         const Box &area,
+                                         bool commit)
+{
+    ASSERT(mState.mImmutableFormat && mState.mSparse);
+
+    // The contents of newly committed pages are undefined, the rest of the texture is untouched.
+    return mTexture->setPageCommitment(context, level, area, commit);
+}
+
 angle::Result Texture::bindTexImageFromSurface(Context *context, egl::Surface *surface)
 {
     ASSERT(surface);
@@ -2034,16 +2078,23 @@ bool Texture::isSamplerComplete(const Context *context, const Sampler *optionalS
         optionalSampler ? optionalSampler->getSamplerState() : mState.mSamplerState;
     const auto &contextState = context->getState();
 
-    if (contextState.getContextID() != mCompletenessCache.context ||
-        !mCompletenessCache.samplerState.sameCompleteness(samplerState))
+    for (const SamplerCompletenessCache &cacheEntry : mCompletenessCache)
     {
-        mCompletenessCache.context      = context->getState().getContextID();
-        mCompletenessCache.samplerState = samplerState;
-        mCompletenessCache.samplerComplete =
-            mState.computeSamplerCompleteness(samplerState, contextState);
+        if (cacheEntry.context == contextState.getContextID() &&
+            cacheEntry.samplerState.sameCompleteness(samplerState))
+        {
+            return cacheEntry.samplerComplete;
+        }
     }
 
-    return mCompletenessCache.samplerComplete;
+    SamplerCompletenessCache &cacheEntry = mCompletenessCache[mCompletenessCacheNextEntry];
+    mCompletenessCacheNextEntry = (mCompletenessCacheNextEntry + 1) % mCompletenessCache.size();
+
+    cacheEntry.context         = contextState.getContextID();
+    cacheEntry.samplerState    = samplerState;
+    cacheEntry.samplerComplete = mState.computeSamplerCompleteness(samplerState, contextState);
+
+    return cacheEntry.samplerComplete;
 }
 
 Texture::SamplerCompletenessCache::SamplerCompletenessCache()
@@ -2052,7 +2103,10 @@ Texture::SamplerCompletenessCache::SamplerCompletenessCache()
 
 void Texture::invalidateCompletenessCache() const
 {
-    mCompletenessCache.context = {0};
+    for (SamplerCompletenessCache &cacheEntry : mCompletenessCache)
+    {
+        cacheEntry.context = {0};
+    }
 }
 
 angle::Result Texture::ensureInitialized(const Context *context)
@@ -9,6 +9,7 @@
 #ifndef LIBANGLE_TEXTURE_H_
 #define LIBANGLE_TEXTURE_H_
 
+#include <array>
 #include <map>
 #include <vector>
 
@@ -168,6 +169,9 @@ class TextureState final : private angle::NonCopyable
     bool getImmutableFormat() const { return mImmutableFormat; }
     GLuint getImmutableLevels() const { return mImmutableLevels; }
 
+    bool isSparse() const { return mSparse; }
+    GLuint getVirtualPageSizeIndex() const { return mVirtualPageSizeIndex; }
+
     const std::vector<ImageDesc> &getImageDescs() const { return mImageDescs; }
 
     InitState getInitState() const { return mInitState; }
@@ -222,6 +226,10 @@ class TextureState final : private angle::NonCopyable
     // From GL_ANGLE_texture_usage
     GLenum mUsage;
 
+    // From GL_EXT_sparse_texture, only used when the storage is specified
+    bool mSparse;
+    GLuint mVirtualPageSizeIndex;
+
     std::vector<ImageDesc> mImageDescs;
 
     // GLES1 emulation: Texture crop rectangle
@@ -325,6 +333,14 @@ class Texture final : public RefCountObject<TextureID>,
     void setUsage(const Context *context, GLenum usage);
     GLenum getUsage() const;
 
+    void setSparse(bool sparse);
+    bool isSparse() const;
+
+    void setVirtualPageSizeIndex(GLuint index);
+    GLuint getVirtualPageSizeIndex() const;
+
+    GLuint getNumSparseLevels() const;
+
     const TextureState &getState() const { return mState; }
 
     void setBorderColor(const Context *context, const ColorGeneric &color);
@@ -489,6 +505,9 @@ class Texture final : public RefCountObject<TextureID>,
 
     angle::Result generateMipmap(Context *context);
 
+    // GL_EXT_sparse_texture
+    angle::Result setPageCommitment(Context *context, GLint level, const Box &area, bool commit);
+
     void onBindAsImageTexture();
 
     egl::Surface *getBoundSurface() const;
@@ -672,7 +691,12 @@ class Texture final : public RefCountObject<TextureID>,
         bool samplerComplete;
     };
 
-    mutable SamplerCompletenessCache mCompletenessCache;
+    // A few entries are kept so that a texture sampled alternately through different samplers,
+    // or through a sampler and its own sampler state, doesn't recompute its completeness on every
+    // bind.  Entries are replaced round-robin.
+    static constexpr size_t kSamplerCompletenessCacheSize = 4;
+    mutable std::array<SamplerCompletenessCache, kSamplerCompletenessCacheSize> mCompletenessCache;
+    mutable size_t mCompletenessCacheNextEntry;
 };
 
 inline bool operator==(const TextureState &a, const TextureState &b)
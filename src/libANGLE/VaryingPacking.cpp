@@ -11,16 +11,130 @@
 
 #include "libANGLE/VaryingPacking.h"
 
+#include <mutex>
+
+#include "anglebase/no_destructor.h"
 #include "common/utilities.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/ProgramExecutable.h"
 #include "libANGLE/Shader.h"
+#include "libANGLE/SizedMRUCache.h"
 
 namespace gl
 {
 
 namespace
 {
+constexpr uint8_t kFullRegisterMask = 0xF;
+
+// Packing only depends on the register count and the sizes of the varyings in order, as well as on
+// the array elements that transform feedback captures, so the packings of recently linked
+// interfaces are kept for the programs that are linked again.
+constexpr size_t kMaxCachedVaryingPackings = 64;
+
+struct VaryingRegisters
+{
+    unsigned int row;
+    unsigned int column;
+};
+
+struct VaryingPackingCache
+{
+    std::mutex mutex;
+    angle::SizedMRUCache<std::string, std::vector<VaryingRegisters>> packings{
+        kMaxCachedVaryingPackings};
+};
+
+VaryingPackingCache &GetVaryingPackingCache()
+{
+    static angle::base::NoDestructor<VaryingPackingCache> cache;
+    return *cache;
+}
+
+std::string GetVaryingPackingKey(unsigned int maxVaryingVectors,
+                                 const std::vector<PackedVarying> &packedVaryings,
+                                 const std::vector<unsigned int> &varyingRows,
+                                 const std::vector<unsigned int> &varyingColumns)
+{
+    std::vector<uint32_t> key;
+    key.reserve(packedVaryings.size() * 2 + 1);
+    key.push_back(maxVaryingVectors);
+    for (size_t varyingIndex = 0; varyingIndex < packedVaryings.size(); ++varyingIndex)
+    {
+        const PackedVarying &packedVarying = packedVaryings[varyingIndex];
+        ASSERT(varyingColumns[varyingIndex] <= 4);
+        key.push_back(varyingRows[varyingIndex] << 3 | varyingColumns[varyingIndex]);
+        key.push_back(packedVarying.isTransformFeedbackArrayElement() ? packedVarying.arrayIndex
+                                                                      : GL_INVALID_INDEX);
+    }
+    return std::string(reinterpret_cast<const char *>(key.data()), key.size() * sizeof(uint32_t));
+}
+
+bool GetCachedVaryingPacking(const std::string &key, std::vector<VaryingRegisters> *registersOut)
+{
+    VaryingPackingCache &cache = GetVaryingPackingCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+
+    const std::vector<VaryingRegisters> *registers = nullptr;
+    if (!cache.packings.get(key, &registers))
+    {
+        return false;
+    }
+    *registersOut = *registers;
+    return true;
+}
+
+void CacheVaryingPacking(const std::string &key, std::vector<VaryingRegisters> &&registers)
+{
+    VaryingPackingCache &cache = GetVaryingPackingCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.packings.put(key, std::move(registers), 1);
+}
+
+uint8_t GetColumnMask(unsigned int column, unsigned int columnCount)
+{
+    return static_cast<uint8_t>(((1u << columnCount) - 1u) << column);
+}
+
+void GetVaryingSizeInRegisters(PackMode packMode,
+                               const PackedVarying &packedVarying,
+                               unsigned int *rowsOut,
+                               unsigned int *columnsOut)
+{
+    const sh::ShaderVariable &varying = packedVarying.varying();
+
+    // "Non - square matrices of type matCxR consume the same space as a square matrix of type matN
+    // where N is the greater of C and R."
+    // Here we are a bit more conservative and allow packing non-square matrices more tightly.
+    // Make sure we use transposed matrix types to count registers correctly.
+    ASSERT(!varying.isStruct());
+    GLenum transposedType       = gl::TransposeMatrixType(varying.type);
+    unsigned int varyingRows    = gl::VariableRowCount(transposedType);
+    unsigned int varyingColumns = gl::VariableColumnCount(transposedType);
+
+    // Special pack mode for D3D9. Each varying takes a full register, no sharing.
+    // TODO(jmadill): Implement more sophisticated component packing in D3D9.
+    if (packMode == PackMode::ANGLE_NON_CONFORMANT_D3D9)
+    {
+        varyingColumns = 4;
+    }
+
+    // "Variables of type mat2 occupies 2 complete rows."
+    // For non-WebGL contexts, we allow mat2 to occupy only two columns per row.
+    else if (packMode == PackMode::WEBGL_STRICT && varying.type == GL_FLOAT_MAT2)
+    {
+        varyingColumns = 4;
+    }
+
+    // "Arrays of size N are assumed to take N times the size of the base type"
+    // GLSL ES 3.10 section 4.3.6: Output variables cannot be arrays of arrays or arrays of
+    // structures, so we may use getBasicTypeElementCount().
+    const unsigned int elementCount = packedVarying.getBasicTypeElementCount();
+    varyingRows *= (packedVarying.isTransformFeedbackArrayElement() ? 1 : elementCount);
+
+    *rowsOut    = varyingRows;
+    *columnsOut = varyingColumns;
+}
 
 // true if varying x has a higher priority in packing than y
 bool ComparePackedVarying(const PackedVarying &x, const PackedVarying &y)
@@ -296,47 +410,18 @@ void VaryingPacking::reset()
 
 void VaryingPacking::clearRegisterMap()
 {
-    std::fill(mRegisterMap.begin(), mRegisterMap.end(), Register());
+    std::fill(mRegisterMap.begin(), mRegisterMap.end(), 0);
 }
 
 // Packs varyings into generic varying registers, using the algorithm from
 // See [OpenGL ES Shading Language 1.00 rev. 17] appendix A section 7 page 111
 // Also [OpenGL ES Shading Language 3.00 rev. 4] Section 11 page 119
 // Returns false if unsuccessful.
-bool VaryingPacking::packVaryingIntoRegisterMap(PackMode packMode,
-                                                const PackedVarying &packedVarying)
+bool VaryingPacking::findVaryingRegisters(unsigned int varyingRows,
+                                          unsigned int varyingColumns,
+                                          unsigned int *registerRowOut,
+                                          unsigned int *registerColumnOut) const
 {
-    const sh::ShaderVariable &varying = packedVarying.varying();
-
-    // "Non - square matrices of type matCxR consume the same space as a square matrix of type matN
-    // where N is the greater of C and R."
-    // Here we are a bit more conservative and allow packing non-square matrices more tightly.
-    // Make sure we use transposed matrix types to count registers correctly.
-    ASSERT(!varying.isStruct());
-    GLenum transposedType       = gl::TransposeMatrixType(varying.type);
-    unsigned int varyingRows    = gl::VariableRowCount(transposedType);
-    unsigned int varyingColumns = gl::VariableColumnCount(transposedType);
-
-    // Special pack mode for D3D9. Each varying takes a full register, no sharing.
-    // TODO(jmadill): Implement more sophisticated component packing in D3D9.
-    if (packMode == PackMode::ANGLE_NON_CONFORMANT_D3D9)
-    {
-        varyingColumns = 4;
-    }
-
-    // "Variables of type mat2 occupies 2 complete rows."
-    // For non-WebGL contexts, we allow mat2 to occupy only two columns per row.
-    else if (packMode == PackMode::WEBGL_STRICT && varying.type == GL_FLOAT_MAT2)
-    {
-        varyingColumns = 4;
-    }
-
-    // "Arrays of size N are assumed to take N times the size of the base type"
-    // GLSL ES 3.10 section 4.3.6: Output variables cannot be arrays of arrays or arrays of
-    // structures, so we may use getBasicTypeElementCount().
-    const unsigned int elementCount = packedVarying.getBasicTypeElementCount();
-    varyingRows *= (packedVarying.isTransformFeedbackArrayElement() ? 1 : elementCount);
-
     unsigned int maxVaryingVectors = static_cast<unsigned int>(mRegisterMap.size());
 
     // Fail if we are packing a single over-large varying.
@@ -353,7 +438,8 @@ bool VaryingPacking::packVaryingIntoRegisterMap(PackMode packMode,
         {
             if (isRegisterRangeFree(row, 0, varyingRows, varyingColumns))
             {
-                insertVaryingIntoRegisterMap(row, 0, varyingColumns, packedVarying);
+                *registerRowOut    = row;
+                *registerColumnOut = 0;
                 return true;
             }
         }
@@ -367,7 +453,8 @@ bool VaryingPacking::packVaryingIntoRegisterMap(PackMode packMode,
             {
                 if (isRegisterRangeFree(r, 2, varyingRows, 2))
                 {
-                    insertVaryingIntoRegisterMap(r, 2, varyingColumns, packedVarying);
+                    *registerRowOut    = r;
+                    *registerColumnOut = 2;
                     return true;
                 }
             }
@@ -386,9 +473,16 @@ bool VaryingPacking::packVaryingIntoRegisterMap(PackMode packMode,
 
     for (unsigned int row = 0; row < maxVaryingVectors; ++row)
     {
+        const uint8_t occupiedColumns = mRegisterMap[row];
+        if (occupiedColumns == kFullRegisterMask)
+        {
+            std::fill(std::begin(contiguousSpace), std::end(contiguousSpace), 0);
+            continue;
+        }
+
         for (unsigned int column = 0; column < 4; ++column)
         {
-            if (mRegisterMap[row][column])
+            if ((occupiedColumns & GetColumnMask(column, 1)) != 0)
             {
                 contiguousSpace[column] = 0;
             }
@@ -422,29 +516,11 @@ bool VaryingPacking::packVaryingIntoRegisterMap(PackMode packMode,
         {
             if (isRegisterRangeFree(row, bestColumn, varyingRows, 1))
             {
-                for (unsigned int arrayIndex = 0; arrayIndex < varyingRows; ++arrayIndex)
-                {
-                    // If varyingRows > 1, it must be an array.
-                    PackedVaryingRegister registerInfo;
-                    registerInfo.packedVarying  = &packedVarying;
-                    registerInfo.registerRow    = row + arrayIndex;
-                    registerInfo.registerColumn = bestColumn;
-                    registerInfo.varyingArrayIndex =
-                        (packedVarying.isTransformFeedbackArrayElement() ? packedVarying.arrayIndex
-                                                                         : arrayIndex);
-                    registerInfo.varyingRowIndex = 0;
-                    // Do not record register info for builtins.
-                    // TODO(jmadill): Clean this up.
-                    if (!varying.isBuiltIn())
-                    {
-                        mRegisterList.push_back(registerInfo);
-                    }
-                    mRegisterMap[row + arrayIndex][bestColumn] = true;
-                }
-                break;
+                *registerRowOut    = row;
+                *registerColumnOut = bestColumn;
+                return true;
             }
         }
-        return true;
     }
 
     return false;
@@ -455,16 +531,15 @@ bool VaryingPacking::isRegisterRangeFree(unsigned int registerRow,
                                          unsigned int varyingRows,
                                          unsigned int varyingColumns) const
 {
+    ASSERT(registerColumn + varyingColumns <= 4);
+    const uint8_t columnMask = GetColumnMask(registerColumn, varyingColumns);
+
     for (unsigned int row = 0; row < varyingRows; ++row)
     {
         ASSERT(registerRow + row < mRegisterMap.size());
-        for (unsigned int column = 0; column < varyingColumns; ++column)
+        if ((mRegisterMap[registerRow + row] & columnMask) != 0)
         {
-            ASSERT(registerColumn + column < 4);
-            if (mRegisterMap[registerRow + row][registerColumn + column])
-            {
-                return false;
-            }
+            return false;
         }
     }
 
@@ -487,6 +562,8 @@ void VaryingPacking::insertVaryingIntoRegisterMap(unsigned int registerRow,
     registerInfo.packedVarying  = &packedVarying;
     registerInfo.registerColumn = registerColumn;
 
+    const uint8_t columnMask = GetColumnMask(registerColumn, varyingColumns);
+
     // GLSL ES 3.10 section 4.3.6: Output variables cannot be arrays of arrays or arrays of
     // structures, so we may use getBasicTypeElementCount().
     const unsigned int arrayElementCount = packedVarying.getBasicTypeElementCount();
@@ -509,11 +586,37 @@ void VaryingPacking::insertVaryingIntoRegisterMap(unsigned int registerRow,
                 mRegisterList.push_back(registerInfo);
             }
 
-            for (unsigned int columnIndex = 0; columnIndex < varyingColumns; ++columnIndex)
-            {
-                mRegisterMap[registerInfo.registerRow][registerColumn + columnIndex] = true;
-            }
+            mRegisterMap[registerInfo.registerRow] |= columnMask;
+        }
+    }
+}
+
+void VaryingPacking::insertScalarVaryingIntoRegisterMap(unsigned int registerRow,
+                                                        unsigned int registerColumn,
+                                                        unsigned int varyingRows,
+                                                        const PackedVarying &packedVarying)
+{
+    const sh::ShaderVariable &varying = packedVarying.varying();
+    const uint8_t columnMask          = GetColumnMask(registerColumn, 1);
+
+    for (unsigned int arrayIndex = 0; arrayIndex < varyingRows; ++arrayIndex)
+    {
+        // If varyingRows > 1, it must be an array.
+        PackedVaryingRegister registerInfo;
+        registerInfo.packedVarying     = &packedVarying;
+        registerInfo.registerRow       = registerRow + arrayIndex;
+        registerInfo.registerColumn    = registerColumn;
+        registerInfo.varyingArrayIndex = (packedVarying.isTransformFeedbackArrayElement()
+                                              ? packedVarying.arrayIndex
+                                              : arrayIndex);
+        registerInfo.varyingRowIndex   = 0;
+        // Do not record register info for builtins.
+        // TODO(jmadill): Clean this up.
+        if (!varying.isBuiltIn())
+        {
+            mRegisterList.push_back(registerInfo);
         }
+        mRegisterMap[registerRow + arrayIndex] |= columnMask;
     }
 }
 
@@ -945,11 +1048,52 @@ bool VaryingPacking::packUserVaryings(gl::InfoLog &infoLog,
     clearRegisterMap();
     mRegisterMap.resize(maxVaryingVectors);
 
+    std::vector<unsigned int> varyingRows(packedVaryings.size());
+    std::vector<unsigned int> varyingColumns(packedVaryings.size());
+    for (size_t varyingIndex = 0; varyingIndex < packedVaryings.size(); ++varyingIndex)
+    {
+        GetVaryingSizeInRegisters(packMode, packedVaryings[varyingIndex],
+                                  &varyingRows[varyingIndex], &varyingColumns[varyingIndex]);
+    }
+
+    const std::string packingKey =
+        GetVaryingPackingKey(maxVaryingVectors, packedVaryings, varyingRows, varyingColumns);
+    std::vector<VaryingRegisters> varyingRegisters;
+    const bool isCached = GetCachedVaryingPacking(packingKey, &varyingRegisters);
+    ASSERT(!isCached || varyingRegisters.size() == packedVaryings.size());
+
     // "Variables are packed into the registers one at a time so that they each occupy a contiguous
     // subrectangle. No splitting of variables is permitted."
-    for (const PackedVarying &packedVarying : packedVaryings)
+    for (size_t varyingIndex = 0; varyingIndex < packedVaryings.size(); ++varyingIndex)
     {
-        if (!packVaryingIntoRegisterMap(packMode, packedVarying))
+        const PackedVarying &packedVarying = packedVaryings[varyingIndex];
+        const unsigned int rows            = varyingRows[varyingIndex];
+        const unsigned int columns         = varyingColumns[varyingIndex];
+
+        if (!isCached)
+        {
+            VaryingRegisters registers;
+            if (findVaryingRegisters(rows, columns, &registers.row, &registers.column))
+            {
+                varyingRegisters.push_back(registers);
+            }
+        }
+
+        if (varyingIndex < varyingRegisters.size())
+        {
+            const VaryingRegisters &registers = varyingRegisters[varyingIndex];
+            if (columns == 1)
+            {
+                insertScalarVaryingIntoRegisterMap(registers.row, registers.column, rows,
+                                                   packedVarying);
+            }
+            else
+            {
+                insertVaryingIntoRegisterMap(registers.row, registers.column, columns,
+                                             packedVarying);
+            }
+        }
+        else
         {
             ShaderType eitherStage = packedVarying.frontVarying.varying
                                          ? packedVarying.frontVarying.stage
@@ -967,6 +1111,11 @@ bool VaryingPacking::packUserVaryings(gl::InfoLog &infoLog,
         }
     }
 
+    if (!isCached)
+    {
+        CacheVaryingPacking(packingKey, std::move(varyingRegisters));
+    }
+
     // Sort the packed register list
     std::sort(mRegisterList.begin(), mRegisterList.end());
 
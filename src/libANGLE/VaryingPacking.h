@@ -220,19 +220,6 @@ class VaryingPacking final : angle::NonCopyable
                                                      const std::vector<std::string> &tfVaryings,
                                                      const bool isSeparableProgram);
 
-    struct Register
-    {
-        Register() { data[0] = data[1] = data[2] = data[3] = false; }
-
-        bool &operator[](unsigned int index) { return data[index]; }
-        bool operator[](unsigned int index) const { return data[index]; }
-
-        bool data[4];
-    };
-
-    Register &operator[](unsigned int index) { return mRegisterMap[index]; }
-    const Register &operator[](unsigned int index) const { return mRegisterMap[index]; }
-
     const std::vector<PackedVaryingRegister> &getRegisterList() const { return mRegisterList; }
     unsigned int getMaxSemanticIndex() const
     {
@@ -259,7 +246,10 @@ class VaryingPacking final : angle::NonCopyable
                           GLint maxVaryingVectors,
                           PackMode packMode,
                           const std::vector<PackedVarying> &packedVaryings);
-    bool packVaryingIntoRegisterMap(PackMode packMode, const PackedVarying &packedVarying);
+    bool findVaryingRegisters(unsigned int varyingRows,
+                              unsigned int varyingColumns,
+                              unsigned int *registerRowOut,
+                              unsigned int *registerColumnOut) const;
     bool isRegisterRangeFree(unsigned int registerRow,
                              unsigned int registerColumn,
                              unsigned int varyingRows,
@@ -268,6 +258,10 @@ class VaryingPacking final : angle::NonCopyable
                                       unsigned int registerColumn,
                                       unsigned int varyingColumns,
                                       const PackedVarying &packedVarying);
+    void insertScalarVaryingIntoRegisterMap(unsigned int registerRow,
+                                            unsigned int registerColumn,
+                                            unsigned int varyingRows,
+                                            const PackedVarying &packedVarying);
     void clearRegisterMap();
 
     // Collection functions.
@@ -290,7 +284,8 @@ class VaryingPacking final : angle::NonCopyable
                           const ProgramVaryingRef &ref,
                           VaryingUniqueFullNames *uniqueFullNames);
 
-    std::vector<Register> mRegisterMap;
+    // The mask of the occupied columns of every register.
+    std::vector<uint8_t> mRegisterMap;
     std::vector<PackedVaryingRegister> mRegisterList;
     std::vector<PackedVarying> mPackedVaryings;
     ShaderMap<std::vector<std::string>> mInactiveVaryingMappedNames;
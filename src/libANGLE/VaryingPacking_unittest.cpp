@@ -29,6 +29,15 @@ class VaryingPackingTest : public ::testing::TestWithParam<GLuint>
     bool testVaryingPacking(GLint maxVaryings,
                             PackMode packMode,
                             const std::vector<sh::ShaderVariable> &shVaryings)
+    {
+        VaryingPacking varyingPacking;
+        return testVaryingPacking(maxVaryings, packMode, shVaryings, &varyingPacking);
+    }
+
+    bool testVaryingPacking(GLint maxVaryings,
+                            PackMode packMode,
+                            const std::vector<sh::ShaderVariable> &shVaryings,
+                            VaryingPacking *varyingPacking)
     {
         ProgramMergedVaryings mergedVaryings;
         for (const sh::ShaderVariable &shVarying : shVaryings)
@@ -44,8 +53,7 @@ class VaryingPackingTest : public ::testing::TestWithParam<GLuint>
         InfoLog infoLog;
         std::vector<std::string> transformFeedbackVaryings;
 
-        VaryingPacking varyingPacking;
-        return varyingPacking.collectAndPackUserVaryings(
+        return varyingPacking->collectAndPackUserVaryings(
             infoLog, maxVaryings, packMode, ShaderType::Vertex, ShaderType::Fragment,
             mergedVaryings, transformFeedbackVaryings, false);
     }
@@ -170,6 +178,35 @@ TEST_P(VaryingPackingTest, MaxPlusOneMat2VaryingsFailsWebGL)
     ASSERT_FALSE(packVaryingsStrict(kMaxVaryings, varyings));
 }
 
+// Test that packing the same varyings again assigns them the same registers.
+TEST_P(VaryingPackingTest, RepackingAssignsSameRegisters)
+{
+    std::vector<sh::ShaderVariable> varyings = MakeVaryings(GL_FLOAT_VEC3, kMaxVaryings / 4, 2);
+    AddVaryings(&varyings, GL_FLOAT_VEC2, kMaxVaryings / 2, 0);
+    AddVaryings(&varyings, GL_FLOAT, kMaxVaryings / 2, 0);
+    AddVaryings(&varyings, GL_FLOAT_VEC4, 1, 0);
+
+    VaryingPacking firstPacking;
+    ASSERT_TRUE(
+        testVaryingPacking(kMaxVaryings, PackMode::ANGLE_RELAXED, varyings, &firstPacking));
+    VaryingPacking secondPacking;
+    ASSERT_TRUE(
+        testVaryingPacking(kMaxVaryings, PackMode::ANGLE_RELAXED, varyings, &secondPacking));
+
+    const std::vector<PackedVaryingRegister> &firstRegisters  = firstPacking.getRegisterList();
+    const std::vector<PackedVaryingRegister> &secondRegisters = secondPacking.getRegisterList();
+    ASSERT_EQ(firstRegisters.size(), secondRegisters.size());
+    for (size_t index = 0; index < firstRegisters.size(); ++index)
+    {
+        EXPECT_EQ(firstRegisters[index].packedVarying->varying().name,
+                  secondRegisters[index].packedVarying->varying().name);
+        EXPECT_EQ(firstRegisters[index].varyingArrayIndex,
+                  secondRegisters[index].varyingArrayIndex);
+        EXPECT_EQ(firstRegisters[index].registerRow, secondRegisters[index].registerRow);
+        EXPECT_EQ(firstRegisters[index].registerColumn, secondRegisters[index].registerColumn);
+    }
+}
+
 // Makes separate tests for different values of kMaxVaryings.
 INSTANTIATE_TEST_SUITE_P(, VaryingPackingTest, ::testing::Values(1, 4, 8));
 
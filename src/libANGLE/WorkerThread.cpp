@@ -14,10 +14,11 @@
 
 #if (ANGLE_DELEGATE_WORKERS == ANGLE_ENABLED) || (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 #    include <condition_variable>
-#    include <future>
 #    include <mutex>
 #    include <queue>
 #    include <thread>
+
+#    include "common/PackedEnums.h"
 #endif  // (ANGLE_DELEGATE_WORKERS == ANGLE_ENABLED) || (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
 namespace angle
@@ -56,14 +57,16 @@ bool SingleThreadedWaitableEvent::isReady()
 class SingleThreadedWorkerPool final : public WorkerThreadPool
 {
   public:
-    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  WorkerTaskPriority priority) override;
     void setMaxThreads(size_t maxThreads) override;
     bool isAsync() override;
 };
 
 // SingleThreadedWorkerPool implementation.
 std::shared_ptr<WaitableEvent> SingleThreadedWorkerPool::postWorkerTask(
-    std::shared_ptr<Closure> task)
+    std::shared_ptr<Closure> task,
+    WorkerTaskPriority priority)
 {
     (*task)();
     return std::make_shared<SingleThreadedWaitableEvent>();
@@ -77,100 +80,186 @@ bool SingleThreadedWorkerPool::isAsync()
 }
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// The event holds the task until it has run, so that whichever of a worker thread or the thread
+// waiting for the event gets to it first runs it.
 class AsyncWaitableEvent final : public WaitableEvent
 {
   public:
-    AsyncWaitableEvent() : mIsPending(true) {}
+    AsyncWaitableEvent(std::shared_ptr<Closure> &&task)
+        : mState(State::Pending),
+          mCanRunOnWaitingThread(task->canRunOnWaitingThread()),
+          mTask(std::move(task))
+    {}
     ~AsyncWaitableEvent() override = default;
 
     void wait() override;
     bool isReady() override;
 
+    // Runs the task, unless another thread has already started it.
+    void run();
+
   private:
-    friend class AsyncWorkerPool;
-    void setFuture(std::future<void> &&future);
+    enum class State
+    {
+        Pending,
+        Running,
+        Ready,
+    };
 
-    // To block wait() when the task is still in queue to be run.
-    // Also to protect the concurrent accesses from both main thread and
-    // background threads to the member fields.
+    // To block wait() until the task has run. Also to protect the concurrent accesses from both
+    // main thread and background threads to the member fields.
     std::mutex mMutex;
 
-    bool mIsPending;
+    State mState;
     std::condition_variable mCondition;
-    std::future<void> mFuture;
+
+    const bool mCanRunOnWaitingThread;
+    std::shared_ptr<Closure> mTask;
 };
 
-void AsyncWaitableEvent::setFuture(std::future<void> &&future)
+void AsyncWaitableEvent::run()
 {
-    mFuture = std::move(future);
+    std::shared_ptr<Closure> task;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mState != State::Pending)
+        {
+            return;
+        }
+        mState = State::Running;
+        task   = std::move(mTask);
+    }
+
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "AsyncWorkerPool::RunTask");
+        (*task)();
+    }
+
+    // Release the task before the event is ready, so nothing it holds on to outlives the wait.
+    task = {};
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mState = State::Ready;
+    mCondition.notify_all();
 }
 
 void AsyncWaitableEvent::wait()
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "AsyncWaitableEvent::wait");
+
+    // Rather than block until a worker thread gets to the task, run it right away.
+    if (mCanRunOnWaitingThread)
     {
-        std::unique_lock<std::mutex> lock(mMutex);
-        mCondition.wait(lock, [this] { return !mIsPending; });
+        run();
     }
 
-    ASSERT(mFuture.valid());
-    mFuture.wait();
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [this] { return mState == State::Ready; });
 }
 
 bool AsyncWaitableEvent::isReady()
 {
     std::lock_guard<std::mutex> lock(mMutex);
-    if (mIsPending)
-    {
-        return false;
-    }
-    ASSERT(mFuture.valid());
-    return mFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    return mState == State::Ready;
 }
 
+// The task queue is shared between the pool and its threads. A thread may drop the last reference
+// to the pool when it releases a finished task, so the threads never touch the pool itself.
+struct AsyncTaskQueue
+{
+    // To protect the concurrent accesses from both main thread and background
+    // threads to the member fields.
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    // One queue per priority.  A task that was run by the thread waiting for it is left in the
+    // queue, and skipped by the worker thread that pops it.
+    angle::PackedEnumMap<WorkerTaskPriority, std::queue<std::shared_ptr<AsyncWaitableEvent>>>
+        tasks;
+    size_t pendingTaskCount = 0;
+    size_t maxThreads       = 0;
+    size_t threadCount      = 0;
+    size_t runningThreads   = 0;
+    bool terminated         = false;
+};
+
+// Runs the queued tasks on a set of long-lived threads. Threads are started on demand, up to the
+// maximum thread count, and stay around until the pool is destroyed. A burst of tasks doesn't pay
+// for a thread start per task this way.
 class AsyncWorkerPool final : public WorkerThreadPool
 {
   public:
-    AsyncWorkerPool(size_t maxThreads) : mMaxThreads(maxThreads), mRunningThreads(0) {}
-    ~AsyncWorkerPool() override = default;
+    AsyncWorkerPool(size_t maxThreads);
+    ~AsyncWorkerPool() override;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  WorkerTaskPriority priority) override;
     void setMaxThreads(size_t maxThreads) override;
     bool isAsync() override;
 
   private:
-    void checkToRunPendingTasks();
+    static void ThreadLoop(std::shared_ptr<AsyncTaskQueue> queue);
 
-    // To protect the concurrent accesses from both main thread and background
-    // threads to the member fields.
-    std::mutex mMutex;
+    // Must be called with the queue locked.
+    void startThreadsForPendingTasks();
 
-    size_t mMaxThreads;
-    size_t mRunningThreads;
-    std::queue<std::pair<std::shared_ptr<AsyncWaitableEvent>, std::shared_ptr<Closure>>> mTaskQueue;
+    std::shared_ptr<AsyncTaskQueue> mQueue;
+    std::vector<std::thread> mThreads;
 };
 
 // AsyncWorkerPool implementation.
-std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(std::shared_ptr<Closure> task)
+AsyncWorkerPool::AsyncWorkerPool(size_t maxThreads) : mQueue(std::make_shared<AsyncTaskQueue>())
+{
+    mQueue->maxThreads = maxThreads;
+}
+
+AsyncWorkerPool::~AsyncWorkerPool()
 {
-    ASSERT(mMaxThreads > 0);
+    {
+        std::lock_guard<std::mutex> lock(mQueue->mutex);
+        mQueue->terminated = true;
+    }
+    mQueue->condition.notify_all();
 
-    auto waitable = std::make_shared<AsyncWaitableEvent>();
+    for (std::thread &thread : mThreads)
     {
-        std::lock_guard<std::mutex> lock(mMutex);
-        mTaskQueue.push(std::make_pair(waitable, task));
+        // The pool is destroyed on one of its own threads if that thread released the last task
+        // holding a reference to it. That thread exits on its own once it sees the termination.
+        if (thread.get_id() == std::this_thread::get_id())
+        {
+            thread.detach();
+        }
+        else
+        {
+            thread.join();
+        }
     }
-    checkToRunPendingTasks();
+}
+
+std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(std::shared_ptr<Closure> task,
+                                                               WorkerTaskPriority priority)
+{
+    auto waitable = std::make_shared<AsyncWaitableEvent>(std::move(task));
+    {
+        std::lock_guard<std::mutex> lock(mQueue->mutex);
+        ASSERT(mQueue->maxThreads > 0);
+        mQueue->tasks[priority].push(waitable);
+        ++mQueue->pendingTaskCount;
+        startThreadsForPendingTasks();
+    }
+    mQueue->condition.notify_one();
     return std::move(waitable);
 }
 
 void AsyncWorkerPool::setMaxThreads(size_t maxThreads)
 {
     {
-        std::lock_guard<std::mutex> lock(mMutex);
-        mMaxThreads = (maxThreads == 0xFFFFFFFF ? std::thread::hardware_concurrency() : maxThreads);
+        std::lock_guard<std::mutex> lock(mQueue->mutex);
+        mQueue->maxThreads =
+            (maxThreads == 0xFFFFFFFF ? std::thread::hardware_concurrency() : maxThreads);
+        startThreadsForPendingTasks();
     }
-    checkToRunPendingTasks();
+    mQueue->condition.notify_all();
 }
 
 bool AsyncWorkerPool::isAsync()
@@ -178,37 +267,63 @@ bool AsyncWorkerPool::isAsync()
     return true;
 }
 
-void AsyncWorkerPool::checkToRunPendingTasks()
+void AsyncWorkerPool::startThreadsForPendingTasks()
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-    while (mRunningThreads < mMaxThreads && !mTaskQueue.empty())
+    // Threads beyond the running ones are idle and will pick up queued tasks.
+    while (mQueue->threadCount < mQueue->maxThreads &&
+           mQueue->pendingTaskCount > mQueue->threadCount - mQueue->runningThreads)
     {
-        auto task = mTaskQueue.front();
-        mTaskQueue.pop();
-        auto waitable = task.first;
-        auto closure  = task.second;
+        mThreads.emplace_back(ThreadLoop, mQueue);
+        ++mQueue->threadCount;
+    }
+}
 
-        auto future = std::async(std::launch::async, [closure, this] {
-            {
-                ANGLE_TRACE_EVENT0("gpu.angle", "AsyncWorkerPool::RunTask");
-                (*closure)();
-            }
-            {
-                std::lock_guard<std::mutex> lock(mMutex);
-                ASSERT(mRunningThreads != 0);
-                --mRunningThreads;
-            }
-            checkToRunPendingTasks();
+// static
+void AsyncWorkerPool::ThreadLoop(std::shared_ptr<AsyncTaskQueue> queue)
+{
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    while (true)
+    {
+        // Threads beyond a lowered maximum stay idle rather than exit.
+        queue->condition.wait(lock, [&queue] {
+            return queue->terminated ||
+                   (queue->pendingTaskCount != 0 && queue->runningThreads < queue->maxThreads);
         });
 
-        ++mRunningThreads;
+        if (queue->terminated)
+        {
+            return;
+        }
 
+        // Take the oldest task of the highest priority.
+        std::shared_ptr<AsyncWaitableEvent> task;
+        for (size_t priorityIndex = 0; priorityIndex < queue->tasks.size(); ++priorityIndex)
         {
-            std::lock_guard<std::mutex> waitableLock(waitable->mMutex);
-            waitable->mIsPending = false;
-            waitable->setFuture(std::move(future));
+            auto &priorityTasks = queue->tasks[static_cast<WorkerTaskPriority>(
+                queue->tasks.size() - 1 - priorityIndex)];
+            if (!priorityTasks.empty())
+            {
+                task = std::move(priorityTasks.front());
+                priorityTasks.pop();
+                break;
+            }
         }
-        waitable->mCondition.notify_all();
+        ASSERT(task);
+        --queue->pendingTaskCount;
+        ++queue->runningThreads;
+        lock.unlock();
+
+        task->run();
+
+        // Release the task before taking the lock, as this may destroy the pool.
+        task = {};
+
+        lock.lock();
+        ASSERT(queue->runningThreads != 0);
+        --queue->runningThreads;
+
+        // Another thread may be held back by the maximum thread count.
+        queue->condition.notify_one();
     }
 }
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
@@ -259,7 +374,8 @@ class DelegateWorkerPool final : public WorkerThreadPool
     DelegateWorkerPool()           = default;
     ~DelegateWorkerPool() override = default;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  WorkerTaskPriority priority) override;
 
     void setMaxThreads(size_t maxThreads) override;
     bool isAsync() override;
@@ -294,7 +410,9 @@ class DelegateWorkerTask
     std::shared_ptr<DelegateWaitableEvent> mWaitable;
 };
 
-std::shared_ptr<WaitableEvent> DelegateWorkerPool::postWorkerTask(std::shared_ptr<Closure> task)
+// The platform's worker threads have no notion of priority.
+std::shared_ptr<WaitableEvent> DelegateWorkerPool::postWorkerTask(std::shared_ptr<Closure> task,
+                                                                  WorkerTaskPriority priority)
 {
     auto waitable = std::make_shared<DelegateWaitableEvent>();
 
@@ -343,9 +461,10 @@ std::shared_ptr<WorkerThreadPool> WorkerThreadPool::Create(bool multithreaded)
 // static
 std::shared_ptr<WaitableEvent> WorkerThreadPool::PostWorkerTask(
     std::shared_ptr<WorkerThreadPool> pool,
-    std::shared_ptr<Closure> task)
+    std::shared_ptr<Closure> task,
+    WorkerTaskPriority priority)
 {
-    std::shared_ptr<WaitableEvent> event = pool->postWorkerTask(task);
+    std::shared_ptr<WaitableEvent> event = pool->postWorkerTask(task, priority);
     if (event.get())
     {
         event->setWorkerThreadPool(pool);
@@ -29,6 +29,24 @@ class Closure
   public:
     virtual ~Closure()        = default;
     virtual void operator()() = 0;
+
+    // Whether the task may be run by the thread that waits for it, if no worker thread has started
+    // it yet.  Tasks that depend on the thread they run on, for example to make a worker context
+    // current, must not be.
+    virtual bool canRunOnWaitingThread() const { return false; }
+};
+
+// The pending tasks of a higher priority are started before those of a lower priority.
+enum class WorkerTaskPriority
+{
+    // Work that nothing waits for soon, such as writing to a cache.
+    Low,
+    Normal,
+    // Work that is likely to be waited for soon, such as a pipeline needed by a draw call.
+    High,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
 };
 
 // An event that we can wait on, useful for joining worker threads.
@@ -76,8 +94,10 @@ class WorkerThreadPool : angle::NonCopyable
     virtual ~WorkerThreadPool();
 
     static std::shared_ptr<WorkerThreadPool> Create(bool multithreaded);
-    static std::shared_ptr<WaitableEvent> PostWorkerTask(std::shared_ptr<WorkerThreadPool> pool,
-                                                         std::shared_ptr<Closure> task);
+    static std::shared_ptr<WaitableEvent> PostWorkerTask(
+        std::shared_ptr<WorkerThreadPool> pool,
+        std::shared_ptr<Closure> task,
+        WorkerTaskPriority priority = WorkerTaskPriority::Normal);
 
     virtual void setMaxThreads(size_t maxThreads) = 0;
 
@@ -86,7 +106,8 @@ class WorkerThreadPool : angle::NonCopyable
   private:
     // Returns an event to wait on for the task to finish.
     // If the pool fails to create the task, returns null.
-    virtual std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) = 0;
+    virtual std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                          WorkerTaskPriority priority) = 0;
 };
 
 }  // namespace angle
@@ -8,6 +8,10 @@
 
 #include <gtest/gtest.h>
 #include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #include "libANGLE/WorkerThread.h"
 
@@ -49,4 +53,172 @@ TEST(WorkerPoolTest, SimpleTask)
     }
 }
 
+// Tests that a burst of tasks larger than the thread count runs to completion, including when the
+// pool is released before the tasks are done.
+TEST(WorkerPoolTest, TaskBurst)
+{
+    class TestTask : public Closure
+    {
+      public:
+        TestTask(std::atomic<int> *counter) : mCounter(counter) {}
+        void operator()() override { (*mCounter)++; }
+
+      private:
+        std::atomic<int> *mCounter;
+    };
+
+    constexpr int kTaskCount = 100;
+    std::atomic<int> counter(0);
+    std::vector<std::shared_ptr<WaitableEvent>> waitables;
+
+    {
+        std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(true);
+        pool->setMaxThreads(2);
+        for (int taskIndex = 0; taskIndex < kTaskCount; ++taskIndex)
+        {
+            waitables.push_back(
+                WorkerThreadPool::PostWorkerTask(pool, std::make_shared<TestTask>(&counter)));
+        }
+    }
+
+    for (const std::shared_ptr<WaitableEvent> &waitable : waitables)
+    {
+        waitable->wait();
+    }
+
+    EXPECT_EQ(kTaskCount, counter);
+}
+
+// A task that blocks the worker thread running it until it's released.
+class BlockingTask : public Closure
+{
+  public:
+    void operator()() override
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mStarted = true;
+        mCondition.notify_all();
+        mCondition.wait(lock, [this] { return mReleased; });
+    }
+
+    void waitUntilStarted()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return mStarted; });
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mReleased = true;
+        mCondition.notify_all();
+    }
+
+  private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStarted  = false;
+    bool mReleased = false;
+};
+
+// Tests that pending tasks of a higher priority are run before those of a lower priority.
+TEST(WorkerPoolTest, TaskPriority)
+{
+    class TestTask : public Closure
+    {
+      public:
+        TestTask(std::mutex *mutex, std::vector<int> *order, int id)
+            : mMutex(mutex), mOrder(order), mId(id)
+        {}
+        void operator()() override
+        {
+            std::lock_guard<std::mutex> lock(*mMutex);
+            mOrder->push_back(mId);
+        }
+
+      private:
+        std::mutex *mMutex;
+        std::vector<int> *mOrder;
+        int mId;
+    };
+
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(true);
+    if (!pool->isAsync())
+    {
+        GTEST_SKIP() << "Test requires worker threads.";
+    }
+    pool->setMaxThreads(1);
+
+    // Keep the only thread busy while the other tasks are posted.
+    auto blockingTask = std::make_shared<BlockingTask>();
+    std::shared_ptr<WaitableEvent> blockingWaitable =
+        WorkerThreadPool::PostWorkerTask(pool, blockingTask);
+    blockingTask->waitUntilStarted();
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::array<std::shared_ptr<WaitableEvent>, 4> waitables = {
+        {WorkerThreadPool::PostWorkerTask(pool, std::make_shared<TestTask>(&mutex, &order, 0),
+                                          WorkerTaskPriority::Low),
+         WorkerThreadPool::PostWorkerTask(pool, std::make_shared<TestTask>(&mutex, &order, 1)),
+         WorkerThreadPool::PostWorkerTask(pool, std::make_shared<TestTask>(&mutex, &order, 2),
+                                          WorkerTaskPriority::High),
+         WorkerThreadPool::PostWorkerTask(pool, std::make_shared<TestTask>(&mutex, &order, 3),
+                                          WorkerTaskPriority::High)}};
+
+    blockingTask->release();
+    blockingWaitable->wait();
+    WaitableEvent::WaitMany(&waitables);
+
+    EXPECT_EQ((std::vector<int>{2, 3, 1, 0}), order);
+}
+
+// Tests that a task that can run on the waiting thread is run by it if no worker thread has
+// started it.
+TEST(WorkerPoolTest, RunTaskOnWaitingThread)
+{
+    class TestTask : public Closure
+    {
+      public:
+        TestTask(bool canRunOnWaitingThread) : mCanRunOnWaitingThread(canRunOnWaitingThread) {}
+        void operator()() override { threadId = std::this_thread::get_id(); }
+        bool canRunOnWaitingThread() const override { return mCanRunOnWaitingThread; }
+
+        std::thread::id threadId;
+
+      private:
+        bool mCanRunOnWaitingThread;
+    };
+
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(true);
+    if (!pool->isAsync())
+    {
+        GTEST_SKIP() << "Test requires worker threads.";
+    }
+    pool->setMaxThreads(1);
+
+    // Keep the only thread busy while the other tasks are posted.
+    auto blockingTask = std::make_shared<BlockingTask>();
+    std::shared_ptr<WaitableEvent> blockingWaitable =
+        WorkerThreadPool::PostWorkerTask(pool, blockingTask);
+    blockingTask->waitUntilStarted();
+
+    auto inlineTask = std::make_shared<TestTask>(true);
+    auto workerTask = std::make_shared<TestTask>(false);
+    std::shared_ptr<WaitableEvent> inlineWaitable =
+        WorkerThreadPool::PostWorkerTask(pool, inlineTask);
+    std::shared_ptr<WaitableEvent> workerWaitable =
+        WorkerThreadPool::PostWorkerTask(pool, workerTask);
+
+    // The only worker thread is blocked, so the task can only finish if run here.
+    inlineWaitable->wait();
+    EXPECT_EQ(std::this_thread::get_id(), inlineTask->threadId);
+    EXPECT_FALSE(workerWaitable->isReady());
+
+    blockingTask->release();
+    workerWaitable->wait();
+    EXPECT_NE(std::this_thread::get_id(), workerTask->threadId);
+    blockingWaitable->wait();
+}
+
 }  // anonymous namespace
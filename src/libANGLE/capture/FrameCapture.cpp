@@ -16,6 +16,7 @@
 
 #include "sys/stat.h"
 
+#include "common/hash_utils.h"
 #include "common/mathutil.h"
 #include "common/string_utils.h"
 #include "common/system_utils.h"
@@ -62,10 +63,14 @@ constexpr char kCaptureTriggerVarName[]        = "ANGLE_CAPTURE_TRIGGER";
 constexpr char kCaptureLabel[]                 = "ANGLE_CAPTURE_LABEL";
 constexpr char kCompression[]                  = "ANGLE_CAPTURE_COMPRESSION";
 constexpr char kSerializeStateEnabledVarName[] = "ANGLE_CAPTURE_SERIALIZE_STATE";
+constexpr char kAsyncWriteVarName[]            = "ANGLE_CAPTURE_ASYNC_WRITE";
 
 constexpr size_t kBinaryAlignment   = 16;
 constexpr size_t kFunctionSizeLimit = 5000;
 
+// Smaller binary data is appended without looking for a copy of it.
+constexpr size_t kMinDeduplicatedBinaryDataSize = 256;
+
 // Limit based on MSVC Compiler Error C2026
 constexpr size_t kStringLengthLimit = 16380;
 
@@ -77,6 +82,7 @@ constexpr char kAndroidFrameEnd[]       = "debug.angle.capture.frame_end";
 constexpr char kAndroidCaptureTrigger[] = "debug.angle.capture.trigger";
 constexpr char kAndroidCaptureLabel[]   = "debug.angle.capture.label";
 constexpr char kAndroidCompression[]    = "debug.angle.capture.compression";
+constexpr char kAndroidAsyncWrite[]     = "debug.angle.capture.async_write";
 
 std::string GetDefaultOutDirectory()
 {
@@ -471,7 +477,7 @@ void WriteBinaryParamReplay(DataTracker *dataTracker,
                             std::ostream &header,
                             const CallCapture &call,
                             const ParamCapture &param,
-                            std::vector<uint8_t> *binaryData)
+                            ReplayBinaryData *binaryData)
 {
     int counter = dataTracker->getCounters().getAndIncrement(call.entryPoint, param.name);
 
@@ -505,10 +511,7 @@ void WriteBinaryParamReplay(DataTracker *dataTracker,
     else
     {
         // Store in binary file if data are not of type string or enum
-        // Round up to 16-byte boundary for cross ABI safety
-        size_t offset = rx::roundUpPow2(binaryData->size(), kBinaryAlignment);
-        binaryData->resize(offset + data.size());
-        memcpy(binaryData->data() + offset, data.data(), data.size());
+        size_t offset = binaryData->append(data);
         out << "reinterpret_cast<" << ParamTypeToString(overrideType) << ">(&gBinaryData[" << offset
             << "])";
     }
@@ -523,7 +526,7 @@ void WriteCppReplayForCall(const CallCapture &call,
                            DataTracker *dataTracker,
                            std::ostream &out,
                            std::ostream &header,
-                           std::vector<uint8_t> *binaryData)
+                           ReplayBinaryData *binaryData)
 {
     std::ostringstream callOut;
 
@@ -761,7 +764,7 @@ void SaveBinaryData(bool compression,
                     const std::string &outDir,
                     gl::ContextID contextId,
                     const std::string &captureLabel,
-                    const std::vector<uint8_t> &binaryData)
+                    const ReplayBinaryData &binaryData)
 {
     std::string binaryDataFileName = GetBinaryDataFilePath(compression, contextId, captureLabel);
     std::string dataFilepath       = outDir + binaryDataFileName;
@@ -811,7 +814,7 @@ void MaybeResetResources(std::stringstream &out,
                          DataTracker *dataTracker,
                          std::stringstream &header,
                          ResourceTracker *resourceTracker,
-                         std::vector<uint8_t> *binaryData)
+                         ReplayBinaryData *binaryData)
 {
     switch (resourceIDType)
     {
@@ -951,7 +954,7 @@ void MaybeResetFenceSyncObjects(std::stringstream &out,
                                 DataTracker *dataTracker,
                                 std::stringstream &header,
                                 ResourceTracker *resourceTracker,
-                                std::vector<uint8_t> *binaryData)
+                                ReplayBinaryData *binaryData)
 {
     FenceSyncCalls &fenceSyncRegenCalls = resourceTracker->getFenceSyncRegenCalls();
 
@@ -973,7 +976,7 @@ void MaybeResetOpaqueTypeObjects(std::stringstream &out,
                                  DataTracker *dataTracker,
                                  std::stringstream &header,
                                  ResourceTracker *resourceTracker,
-                                 std::vector<uint8_t> *binaryData)
+                                 ReplayBinaryData *binaryData)
 {
     MaybeResetFenceSyncObjects(out, dataTracker, header, resourceTracker, binaryData);
 }
@@ -982,7 +985,7 @@ void WriteCppReplayFunctionWithParts(const gl::Context *context,
                                      ReplayFunc replayFunc,
                                      DataTracker *dataTracker,
                                      uint32_t frameIndex,
-                                     std::vector<uint8_t> *binaryData,
+                                     ReplayBinaryData *binaryData,
                                      const std::vector<CallCapture> &calls,
                                      std::stringstream &header,
                                      std::stringstream &callStream,
@@ -1049,10 +1052,11 @@ void WriteCppReplay(bool compression,
                     const std::vector<CallCapture> &frameCalls,
                     const std::vector<CallCapture> &setupCalls,
                     ResourceTracker *resourceTracker,
-                    std::vector<uint8_t> *binaryData,
+                    ReplayBinaryData *binaryData,
                     const gl::AttribArray<size_t> &clientArraySizes,
                     size_t readBufferSize,
-                    bool serializeStateEnabled)
+                    bool serializeStateEnabled,
+                    bool serializeStateHashes)
 {
     DataTracker dataTracker;
 
@@ -1140,9 +1144,14 @@ void WriteCppReplay(bool compression,
 
     if (serializeStateEnabled)
     {
+        // The hashes are much smaller than the state itself, and the replay can still compare them
+        // to find which objects differ.
         std::string serializedContextString;
-        if (SerializeContextToString(const_cast<gl::Context *>(context),
-                                     &serializedContextString) == Result::Continue)
+        Result serializeResult =
+            serializeStateHashes
+                ? SerializeContextToHashString(context, &serializedContextString)
+                : SerializeContextToString(context, &serializedContextString);
+        if (serializeResult == Result::Continue)
         {
             out << "const char *" << FmtGetSerializedContextStateFunction(context->id(), frameIndex)
                 << "\n";
@@ -1172,6 +1181,58 @@ void WriteCppReplay(bool compression,
     }
 }
 
+// Writes the C++ replay of a frame that is neither the first nor the last one, so it needs neither
+// the setup calls nor the resource tracker.
+class WriteCppReplayTask final : public Closure
+{
+  public:
+    WriteCppReplayTask(bool compression,
+                       const std::string &outDir,
+                       const gl::Context *context,
+                       const std::string &captureLabel,
+                       uint32_t frameIndex,
+                       uint32_t frameCount,
+                       std::vector<CallCapture> &&frameCalls,
+                       ResourceTracker *resourceTracker,
+                       ReplayBinaryData *binaryData,
+                       const gl::AttribArray<size_t> &clientArraySizes,
+                       size_t readBufferSize)
+        : mCompression(compression),
+          mOutDir(outDir),
+          mContext(context),
+          mCaptureLabel(captureLabel),
+          mFrameIndex(frameIndex),
+          mFrameCount(frameCount),
+          mFrameCalls(std::move(frameCalls)),
+          mResourceTracker(resourceTracker),
+          mBinaryData(binaryData),
+          mClientArraySizes(clientArraySizes),
+          mReadBufferSize(readBufferSize)
+    {
+        ASSERT(mFrameIndex != 1 && mFrameIndex != mFrameCount);
+    }
+
+    void operator()() override
+    {
+        WriteCppReplay(mCompression, mOutDir, mContext, mCaptureLabel, mFrameIndex, mFrameCount,
+                       mFrameCalls, {}, mResourceTracker, mBinaryData, mClientArraySizes,
+                       mReadBufferSize, false, false);
+    }
+
+  private:
+    bool mCompression;
+    std::string mOutDir;
+    const gl::Context *mContext;
+    std::string mCaptureLabel;
+    uint32_t mFrameIndex;
+    uint32_t mFrameCount;
+    std::vector<CallCapture> mFrameCalls;
+    ResourceTracker *mResourceTracker;
+    ReplayBinaryData *mBinaryData;
+    gl::AttribArray<size_t> mClientArraySizes;
+    size_t mReadBufferSize;
+};
+
 void WriteCppReplayIndexFiles(bool compression,
                               const std::string &outDir,
                               const gl::Context *context,
@@ -1181,7 +1242,7 @@ void WriteCppReplayIndexFiles(bool compression,
                               const HasResourceTypeMap &hasResourceType,
                               bool serializeStateEnabled,
                               bool writeResetContextCall,
-                              std::vector<uint8_t> &binaryData)
+                              const ReplayBinaryData &binaryData)
 {
     const gl::ContextID contextId       = context->id();
     const egl::Config *config           = context->getConfig();
@@ -3807,6 +3868,7 @@ ReplayContext::~ReplayContext() {}
 FrameCapture::FrameCapture()
     : mEnabled(true),
       mSerializeStateEnabled(false),
+      mSerializeStateHashes(false),
       mCompression(true),
       mClientVertexArrayMap{},
       mFrameIndex(1),
@@ -3889,9 +3951,33 @@ FrameCapture::FrameCapture()
     {
         mSerializeStateEnabled = true;
     }
+    else if (serializeStateEnabledFromEnv == "hashes")
+    {
+        mSerializeStateEnabled = true;
+        mSerializeStateHashes  = true;
+    }
+
+    std::string asyncWriteFromEnv =
+        GetEnvironmentVarOrUnCachedAndroidProperty(kAsyncWriteVarName, kAndroidAsyncWrite);
+    if (asyncWriteFromEnv == "1")
+    {
+        mWriteThreadPool = WorkerThreadPool::Create(true);
+    }
+}
+
+FrameCapture::~FrameCapture()
+{
+    waitForPendingWrite();
 }
 
-FrameCapture::~FrameCapture() = default;
+void FrameCapture::waitForPendingWrite()
+{
+    if (mPendingWriteEvent)
+    {
+        mPendingWriteEvent->wait();
+        mPendingWriteEvent.reset();
+    }
+}
 
 void FrameCapture::copyCompressedTextureData(const gl::Context *context, const CallCapture &call)
 {
@@ -4796,6 +4882,20 @@ void FrameCapture::onEndFrame(const gl::Context *context)
         setCaptureActive();
     }
 
+    // Count resource IDs. This is also done on every frame. It could probably be done by checking
+    // the GL state instead of the calls.
+    for (const CallCapture &call : mFrameCalls)
+    {
+        for (const ParamCapture &param : call.params.getParamCaptures())
+        {
+            ResourceIDType idType = GetResourceIDTypeFromParamType(param.type);
+            if (idType != ResourceIDType::InvalidEnum)
+            {
+                mHasResourceType.set(idType);
+            }
+        }
+    }
+
     // Note that we currently capture before the start frame to collect shader and program sources.
     if (!mFrameCalls.empty() && isCaptureActive())
     {
@@ -4804,9 +4904,32 @@ void FrameCapture::onEndFrame(const gl::Context *context)
             mCaptureStartFrame = mFrameIndex;
             mIsFirstFrame      = false;
         }
-        WriteCppReplay(mCompression, mOutDirectory, context, mCaptureLabel, getReplayFrameIndex(),
-                       getFrameCount(), mFrameCalls, mSetupCalls, &mResourceTracker, &mBinaryData,
-                       mClientArraySizes, mReadBufferSize, mSerializeStateEnabled);
+
+        const uint32_t replayFrameIndex = getReplayFrameIndex();
+        const uint32_t frameCount       = getFrameCount();
+
+        // Frames are written one at a time since they all append to the same binary data.
+        waitForPendingWrite();
+
+        // The first and last frames use the setup calls, the resource tracker or the context
+        // state, so only the frames in between can be written in the background.
+        if (mWriteThreadPool && replayFrameIndex != 1 && replayFrameIndex != frameCount &&
+            !mSerializeStateEnabled)
+        {
+            auto task = std::make_shared<WriteCppReplayTask>(
+                mCompression, mOutDirectory, context, mCaptureLabel, replayFrameIndex, frameCount,
+                std::move(mFrameCalls), &mResourceTracker, &mBinaryData, mClientArraySizes,
+                mReadBufferSize);
+            mPendingWriteEvent = WorkerThreadPool::PostWorkerTask(mWriteThreadPool, task);
+        }
+        else
+        {
+            WriteCppReplay(mCompression, mOutDirectory, context, mCaptureLabel, replayFrameIndex,
+                           frameCount, mFrameCalls, mSetupCalls, &mResourceTracker, &mBinaryData,
+                           mClientArraySizes, mReadBufferSize, mSerializeStateEnabled,
+                           mSerializeStateHashes);
+        }
+
         if (mFrameIndex == mCaptureEndFrame)
         {
             // Save the index files after the last frame.
@@ -4823,20 +4946,6 @@ void FrameCapture::onEndFrame(const gl::Context *context)
         }
     }
 
-    // Count resource IDs. This is also done on every frame. It could probably be done by checking
-    // the GL state instead of the calls.
-    for (const CallCapture &call : mFrameCalls)
-    {
-        for (const ParamCapture &param : call.params.getParamCaptures())
-        {
-            ResourceIDType idType = GetResourceIDTypeFromParamType(param.type);
-            if (idType != ResourceIDType::InvalidEnum)
-            {
-                mHasResourceType.set(idType);
-            }
-        }
-    }
-
     reset();
     mFrameIndex++;
 
@@ -4853,6 +4962,9 @@ void FrameCapture::onDestroyContext(const gl::Context *context)
     {
         return;
     }
+
+    waitForPendingWrite();
+
     if (!mWroteIndexFile && mFrameIndex > mCaptureStartFrame)
     {
         // If context is destroyed before end frame is reached and at least
@@ -4896,6 +5008,51 @@ DataTracker::DataTracker() = default;
 
 DataTracker::~DataTracker() = default;
 
+ReplayBinaryData::ReplayBinaryData() = default;
+
+ReplayBinaryData::~ReplayBinaryData() = default;
+
+size_t ReplayBinaryData::append(const std::vector<uint8_t> &data)
+{
+    // Only larger data is looked up. Hashing requires a multiple of 4 bytes.
+    const bool deduplicate = data.size() >= kMinDeduplicatedBinaryDataSize && data.size() % 4 == 0;
+
+    size_t hash = 0;
+    if (deduplicate)
+    {
+        hash = ComputeGenericHash(data.data(), data.size());
+
+        auto range = mOffsetsByHash.equal_range(hash);
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+            size_t offset = iter->second;
+            if (offset + data.size() <= mData.size() &&
+                memcmp(mData.data() + offset, data.data(), data.size()) == 0)
+            {
+                return offset;
+            }
+        }
+    }
+
+    // Round up to 16-byte boundary for cross ABI safety
+    size_t offset = rx::roundUpPow2(mData.size(), kBinaryAlignment);
+    mData.resize(offset + data.size());
+    memcpy(mData.data() + offset, data.data(), data.size());
+
+    if (deduplicate)
+    {
+        mOffsetsByHash.emplace(hash, offset);
+    }
+
+    return offset;
+}
+
+void ReplayBinaryData::clear()
+{
+    mData.clear();
+    mOffsetsByHash.clear();
+}
+
 StringCounters::StringCounters() = default;
 
 StringCounters::~StringCounters() = default;
@@ -12,6 +12,7 @@
 
 #include "common/PackedEnums.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/capture/frame_capture_utils_autogen.h"
 #include "libANGLE/entry_points_utils.h"
@@ -207,6 +208,30 @@ class DataTracker final : angle::NonCopyable
     StringCounters mStringCounters;
 };
 
+// The binary data of the whole CPP replay. Identical data, such as a buffer's starting contents
+// used by both the setup and the reset calls, or data uploaded again every frame, is only stored
+// once.
+class ReplayBinaryData final : angle::NonCopyable
+{
+  public:
+    ReplayBinaryData();
+    ~ReplayBinaryData();
+
+    // Returns the offset of |data|, appending it if the same data isn't already stored.
+    size_t append(const std::vector<uint8_t> &data);
+
+    const uint8_t *data() const { return mData.data(); }
+    size_t size() const { return mData.size(); }
+    bool empty() const { return mData.empty(); }
+    void clear();
+
+  private:
+    std::vector<uint8_t> mData;
+
+    // Offsets of the stored data, by hash of the data.
+    std::unordered_multimap<size_t, size_t> mOffsetsByHash;
+};
+
 using BufferSet   = std::set<gl::BufferID>;
 using BufferCalls = std::map<gl::BufferID, std::vector<CallCapture>>;
 
@@ -379,6 +404,8 @@ class FrameCapture final : angle::NonCopyable
     void captureCompressedTextureData(const gl::Context *context, const CallCapture &call);
 
     void reset();
+    // Blocks until the frame being written on the write thread, if any, is done.
+    void waitForPendingWrite();
     void maybeOverrideEntryPoint(const gl::Context *context, CallCapture &call);
     void maybeCapturePreCallUpdates(const gl::Context *context, CallCapture &call);
     void maybeCapturePostCallUpdates(const gl::Context *context);
@@ -402,10 +429,12 @@ class FrameCapture final : angle::NonCopyable
 
     // We save one large buffer of binary data for the whole CPP replay.
     // This simplifies a lot of file management.
-    std::vector<uint8_t> mBinaryData;
+    ReplayBinaryData mBinaryData;
 
     bool mEnabled = false;
     bool mSerializeStateEnabled;
+    // Only serialize the hashes of the context objects, from ANGLE_CAPTURE_SERIALIZE_STATE=hashes.
+    bool mSerializeStateHashes;
     std::string mOutDirectory;
     std::string mCaptureLabel;
     bool mCompression;
@@ -429,6 +458,10 @@ class FrameCapture final : angle::NonCopyable
     uint32_t mCaptureTrigger;
 
     bool mCaptureActive = false;
+
+    // Set when frames are written on a worker thread instead of at the end of the frame.
+    std::shared_ptr<WorkerThreadPool> mWriteThreadPool;
+    std::shared_ptr<WaitableEvent> mPendingWriteEvent;
 };
 
 // Shared class for any items that need to be tracked by FrameCapture across shared contexts
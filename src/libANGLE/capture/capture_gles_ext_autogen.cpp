@@ -982,6 +982,17 @@ CallCapture CaptureMultiDrawElementsInstancedANGLE(const State &glState,
                        std::move(paramBuffer));
 }
 
+CallCapture CapturePrewarmDrawStateANGLE(const State &glState,
+                                         bool isCallValid,
+                                         PrimitiveMode modePacked)
+{
+    ParamBuffer paramBuffer;
+
+    paramBuffer.addValueParam("modePacked", ParamType::TPrimitiveMode, modePacked);
+
+    return CallCapture(angle::EntryPoint::GLPrewarmDrawStateANGLE, std::move(paramBuffer));
+}
+
 CallCapture CaptureProvokingVertexANGLE(const State &glState,
                                         bool isCallValid,
                                         ProvokingVertexConvention modePacked)
@@ -7567,6 +7578,33 @@ CallCapture CaptureFramebufferFetchBarrierEXT(const State &glState, bool isCallV
     return CallCapture(angle::EntryPoint::GLFramebufferFetchBarrierEXT, std::move(paramBuffer));
 }
 
+CallCapture CaptureTexPageCommitmentEXT(const State &glState,
+                                        bool isCallValid,
+                                        TextureType targetPacked,
+                                        GLint level,
+                                        GLint xoffset,
+                                        GLint yoffset,
+                                        GLint zoffset,
+                                        GLsizei width,
+                                        GLsizei height,
+                                        GLsizei depth,
+                                        GLboolean commit)
+{
+    ParamBuffer paramBuffer;
+
+    paramBuffer.addValueParam("targetPacked", ParamType::TTextureType, targetPacked);
+    paramBuffer.addValueParam("level", ParamType::TGLint, level);
+    paramBuffer.addValueParam("xoffset", ParamType::TGLint, xoffset);
+    paramBuffer.addValueParam("yoffset", ParamType::TGLint, yoffset);
+    paramBuffer.addValueParam("zoffset", ParamType::TGLint, zoffset);
+    paramBuffer.addValueParam("width", ParamType::TGLsizei, width);
+    paramBuffer.addValueParam("height", ParamType::TGLsizei, height);
+    paramBuffer.addValueParam("depth", ParamType::TGLsizei, depth);
+    paramBuffer.addValueParam("commit", ParamType::TGLboolean, commit);
+
+    return CallCapture(angle::EntryPoint::GLTexPageCommitmentEXT, std::move(paramBuffer));
+}
+
 CallCapture CapturePatchParameteriEXT(const State &glState,
                                       bool isCallValid,
                                       GLenum pname,
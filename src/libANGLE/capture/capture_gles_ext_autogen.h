@@ -249,6 +249,11 @@ angle::CallCapture CaptureMultiDrawElementsInstancedANGLE(const State &glState,
                                                           const GLsizei *instanceCounts,
                                                           GLsizei drawcount);
 
+// GL_ANGLE_prewarm_draw_state
+angle::CallCapture CapturePrewarmDrawStateANGLE(const State &glState,
+                                                bool isCallValid,
+                                                PrimitiveMode modePacked);
+
 // GL_ANGLE_program_binary
 
 // GL_ANGLE_provoking_vertex
@@ -1620,6 +1625,19 @@ angle::CallCapture CaptureFramebufferFetchBarrierEXT(const State &glState, bool
 
 // GL_EXT_shader_io_blocks
 
+// GL_EXT_sparse_texture
+angle::CallCapture CaptureTexPageCommitmentEXT(const State &glState,
+                                               bool isCallValid,
+                                               TextureType targetPacked,
+                                               GLint level,
+                                               GLint xoffset,
+                                               GLint yoffset,
+                                               GLint zoffset,
+                                               GLsizei width,
+                                               GLsizei height,
+                                               GLsizei depth,
+                                               GLboolean commit);
+
 // GL_EXT_tessellation_shader
 angle::CallCapture CapturePatchParameteriEXT(const State &glState,
                                              bool isCallValid,
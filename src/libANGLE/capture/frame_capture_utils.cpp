@@ -9,11 +9,14 @@
 
 #include "libANGLE/capture/frame_capture_utils.h"
 
+#include <iomanip>
+#include <sstream>
 #include <vector>
 
 #include "common/Color.h"
 #include "common/MemoryBuffer.h"
 #include "common/angleutils.h"
+#include "common/hash_utils.h"
 #include "libANGLE/Buffer.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Context.h"
@@ -1242,6 +1245,99 @@ void SerializeVertexArray(JsonSerializer *json, gl::VertexArray *vertexArray)
                     vertexArray->isBufferAccessValidationEnabled());
 }
 
+// Calls |visit| with the name of the context state and of every object of the context, and a
+// function serializing it into a given JsonSerializer.  The names are unique in the context.
+template <typename VisitFunc>
+Result SerializeContextObjects(const gl::Context *context,
+                               ScratchBuffer *scratchBuffer,
+                               VisitFunc &&visit)
+{
+    ANGLE_TRY(visit("ContextState", [context](JsonSerializer *json) {
+        SerializeContextState(json, context->getState());
+        return Result::Continue;
+    }));
+    const gl::FramebufferManager &framebufferManager =
+        context->getState().getFramebufferManagerForCapture();
+    for (const auto &framebuffer : framebufferManager)
+    {
+        gl::Framebuffer *framebufferPtr = framebuffer.second;
+        ANGLE_TRY(visit("Framebuffer" + std::to_string(framebuffer.first),
+                        [=](JsonSerializer *json) {
+                            return SerializeFramebuffer(context, json, scratchBuffer,
+                                                        framebufferPtr);
+                        }));
+    }
+    const gl::BufferManager &bufferManager = context->getState().getBufferManagerForCapture();
+    for (const auto &buffer : bufferManager)
+    {
+        gl::Buffer *bufferPtr = buffer.second;
+        ANGLE_TRY(visit("Buffer" + std::to_string(buffer.first), [=](JsonSerializer *json) {
+            return SerializeBuffer(context, json, scratchBuffer, bufferPtr);
+        }));
+    }
+    const gl::SamplerManager &samplerManager = context->getState().getSamplerManagerForCapture();
+    for (const auto &sampler : samplerManager)
+    {
+        gl::Sampler *samplerPtr = sampler.second;
+        ANGLE_TRY(visit("Sampler" + std::to_string(sampler.first), [=](JsonSerializer *json) {
+            SerializeSampler(json, samplerPtr);
+            return Result::Continue;
+        }));
+    }
+    const gl::RenderbufferManager &renderbufferManager =
+        context->getState().getRenderbufferManagerForCapture();
+    for (const auto &renderbuffer : renderbufferManager)
+    {
+        gl::Renderbuffer *renderbufferPtr = renderbuffer.second;
+        ANGLE_TRY(visit("Renderbuffer" + std::to_string(renderbuffer.first),
+                        [=](JsonSerializer *json) {
+                            return SerializeRenderbuffer(context, json, scratchBuffer,
+                                                         renderbufferPtr);
+                        }));
+    }
+    const gl::ShaderProgramManager &shaderProgramManager =
+        context->getState().getShaderProgramManagerForCapture();
+    const gl::ResourceMap<gl::Shader, gl::ShaderProgramID> &shaderManager =
+        shaderProgramManager.getShadersForCapture();
+    for (const auto &shader : shaderManager)
+    {
+        gl::Shader *shaderPtr = shader.second;
+        ANGLE_TRY(visit("Shader" + std::to_string(shader.first), [=](JsonSerializer *json) {
+            SerializeShader(json, shaderPtr);
+            return Result::Continue;
+        }));
+    }
+    const gl::ResourceMap<gl::Program, gl::ShaderProgramID> &programManager =
+        shaderProgramManager.getProgramsForCaptureAndPerf();
+    for (const auto &program : programManager)
+    {
+        gl::Program *programPtr = program.second;
+        ANGLE_TRY(visit("Program" + std::to_string(program.first), [=](JsonSerializer *json) {
+            SerializeProgram(json, programPtr);
+            return Result::Continue;
+        }));
+    }
+    const gl::TextureManager &textureManager = context->getState().getTextureManagerForCapture();
+    for (const auto &texture : textureManager)
+    {
+        gl::Texture *texturePtr = texture.second;
+        ANGLE_TRY(visit("Texture" + std::to_string(texture.first), [=](JsonSerializer *json) {
+            return SerializeTexture(context, json, scratchBuffer, texturePtr);
+        }));
+    }
+    const gl::VertexArrayMap &vertexArrayMap = context->getVertexArraysForCapture();
+    for (auto &vertexArray : vertexArrayMap)
+    {
+        gl::VertexArray *vertexArrayPtr = vertexArray.second;
+        ANGLE_TRY(visit("VertexArray" + std::to_string(vertexArray.first),
+                        [=](JsonSerializer *json) {
+                            SerializeVertexArray(json, vertexArrayPtr);
+                            return Result::Continue;
+                        }));
+    }
+    return Result::Continue;
+}
+
 }  // namespace
 
 Result SerializeContextToString(const gl::Context *context, std::string *stringOut)
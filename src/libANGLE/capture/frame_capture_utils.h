@@ -19,5 +19,12 @@ class Context;
 namespace angle
 {
 Result SerializeContextToString(const gl::Context *context, std::string *stringOut);
+
+// The first line of the string SerializeContextToHashString returns.  Every following line names
+// the context state or an object of the context, and holds the hash of its serialization by
+// SerializeContextToString, in hexadecimal.  The state of two contexts can be compared through
+// these strings, and only the objects whose hashes differ need to be serialized in full.
+constexpr char kSerializedContextHashesHeader[] = "SerializedContextHashes";
+Result SerializeContextToHashString(const gl::Context *context, std::string *stringOut);
 }  // namespace angle
 #endif  // FRAME_CAPTURE_UTILS_H_
@@ -16,4 +16,10 @@ Result SerializeContextToString(const gl::Context *context, std::string *stringO
     *stringOut = "SerializationNotAvailable";
     return angle::Result::Continue;
 }
+
+Result SerializeContextToHashString(const gl::Context *context, std::string *stringOut)
+{
+    *stringOut = "SerializationNotAvailable";
+    return angle::Result::Continue;
+}
 }  // namespace angle
@@ -1641,12 +1641,34 @@ const char *GLenumToString(GLenumGroup enumGroup, unsigned int value)
                     return "GL_QUERY_OBJECT_EXT";
                 case 0x9154:
                     return "GL_VERTEX_ARRAY_OBJECT_EXT";
+                case 0x9195:
+                    return "GL_VIRTUAL_PAGE_SIZE_X_EXT";
+                case 0x9196:
+                    return "GL_VIRTUAL_PAGE_SIZE_Y_EXT";
+                case 0x9197:
+                    return "GL_VIRTUAL_PAGE_SIZE_Z_EXT";
+                case 0x9198:
+                    return "GL_MAX_SPARSE_TEXTURE_SIZE_EXT";
+                case 0x9199:
+                    return "GL_MAX_SPARSE_3D_TEXTURE_SIZE_EXT";
+                case 0x919A:
+                    return "GL_MAX_SPARSE_ARRAY_TEXTURE_LAYERS_EXT";
                 case 0x919D:
                     return "GL_TEXTURE_BUFFER_OFFSET";
                 case 0x919E:
                     return "GL_TEXTURE_BUFFER_SIZE";
                 case 0x919F:
                     return "GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT";
+                case 0x91A6:
+                    return "GL_TEXTURE_SPARSE_EXT";
+                case 0x91A7:
+                    return "GL_VIRTUAL_PAGE_SIZE_INDEX_EXT";
+                case 0x91A8:
+                    return "GL_NUM_VIRTUAL_PAGE_SIZES_EXT";
+                case 0x91A9:
+                    return "GL_SPARSE_TEXTURE_FULL_ARRAY_CUBE_MIPMAPS_EXT";
+                case 0x91AA:
+                    return "GL_NUM_SPARSE_LEVELS_EXT";
                 case 0x91B0:
                     return "GL_MAX_SHADER_COMPILER_THREADS_KHR";
                 case 0x91B1:
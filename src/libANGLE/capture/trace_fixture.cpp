@@ -11,6 +11,13 @@
 
 #include "angle_trace_gl.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+#    include <sys/mman.h>
+#    define ANGLE_REPLAY_MAP_BINARY_DATA 1
+#else
+#    define ANGLE_REPLAY_MAP_BINARY_DATA 0
+#endif
+
 namespace
 {
 void UpdateResourceMap(ResourceMap *resourceMap, GLuint id, GLsizei readBufferOffset)
@@ -23,13 +30,61 @@ void UpdateResourceMap(ResourceMap *resourceMap, GLuint id, GLsizei readBufferOf
 DecompressCallback gDecompressCallback;
 const char *gBinaryDataDir = ".";
 
-void LoadBinaryData(const char *fileName)
+// Non-zero when gBinaryData maps an uncompressed data file instead of pointing to heap memory.
+size_t gBinaryDataMappedSize = 0;
+
+void ReleaseBinaryData()
 {
+    if (gBinaryData == nullptr)
+    {
+        return;
+    }
+
+#if ANGLE_REPLAY_MAP_BINARY_DATA
+    if (gBinaryDataMappedSize > 0)
+    {
+        munmap(gBinaryData, gBinaryDataMappedSize);
+        gBinaryData           = nullptr;
+        gBinaryDataMappedSize = 0;
+        return;
+    }
+#endif  // ANGLE_REPLAY_MAP_BINARY_DATA
+
     // TODO(b/179188489): Fix cross-module deallocation.
-    if (gBinaryData != nullptr)
+    delete[] gBinaryData;
+    gBinaryData = nullptr;
+}
+
+// Maps the file so that only the pages used by the replayed frames are read, and they can be
+// evicted again under memory pressure.  The mapping is private so the replay may still write to
+// the data.
+bool MapBinaryData(FILE *fp, long size)
+{
+#if ANGLE_REPLAY_MAP_BINARY_DATA
+    if (size <= 0)
+    {
+        return false;
+    }
+
+    void *mapped = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                        fileno(fp), 0);
+    if (mapped == MAP_FAILED)
     {
-        delete[] gBinaryData;
+        return false;
     }
+
+    gBinaryData           = static_cast<uint8_t *>(mapped);
+    gBinaryDataMappedSize = static_cast<size_t>(size);
+    return true;
+#else
+    return false;
+#endif  // ANGLE_REPLAY_MAP_BINARY_DATA
+}
+
+void LoadBinaryData(const char *fileName)
+{
+    ReleaseBinaryData();
+
     char pathBuffer[1000] = {};
     sprintf(pathBuffer, "%s/%s", gBinaryDataDir, fileName);
     FILE *fp = fopen(pathBuffer, "rb");
@@ -59,8 +114,11 @@ void LoadBinaryData(const char *fileName)
             fprintf(stderr, "Filename does not end in .angledata");
             exit(1);
         }
-        gBinaryData = new uint8_t[size];
-        (void)fread(gBinaryData, 1, size, fp);
+        if (!MapBinaryData(fp, size))
+        {
+            gBinaryData = new uint8_t[size];
+            (void)fread(gBinaryData, 1, size, fp);
+        }
     }
     fclose(fp);
 }
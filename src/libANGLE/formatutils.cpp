@@ -13,6 +13,7 @@
 #include "gpu_info_util/SystemInfo.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Framebuffer.h"
+#include "libANGLE/renderer/Format.h"
 
 using namespace angle;
 
@@ -1235,8 +1236,55 @@ uint32_t GetPackedTypeInfo(GLenum type)
     }
 }
 
+using SizedInternalFormatTable = angle::FormatMap<const InternalFormat *>;
+
+static SizedInternalFormatTable BuildSizedInternalFormatTable()
+{
+    SizedInternalFormatTable table;
+    table.fill(nullptr);
+
+    for (const auto &internalFormat : GetInternalFormatMap())
+    {
+        if (internalFormat.second.size() != 1 || !internalFormat.second.begin()->second.sized)
+        {
+            continue;
+        }
+
+        angle::FormatID formatID = angle::Format::InternalFormatToID(internalFormat.first);
+        if (formatID != angle::FormatID::NONE && table[formatID] == nullptr)
+        {
+            table[formatID] = &internalFormat.second.begin()->second;
+        }
+    }
+
+    return table;
+}
+
+// The sized formats are looked up in a table indexed by their angle::FormatID instead of in the
+// hash maps.  Returns nullptr for the formats that the table doesn't have.
+static const InternalFormat *GetSizedInternalFormatFromTable(GLenum internalFormat)
+{
+    static const angle::base::NoDestructor<SizedInternalFormatTable> formatTable(
+        BuildSizedInternalFormatTable());
+
+    angle::FormatID formatID = angle::Format::InternalFormatToID(internalFormat);
+    const InternalFormat *internalFormatInfo = (*formatTable)[formatID];
+    if (internalFormatInfo == nullptr || internalFormatInfo->internalFormat != internalFormat)
+    {
+        return nullptr;
+    }
+
+    return internalFormatInfo;
+}
+
 const InternalFormat &GetSizedInternalFormatInfo(GLenum internalFormat)
 {
+    const InternalFormat *tableInternalFormatInfo = GetSizedInternalFormatFromTable(internalFormat);
+    if (tableInternalFormatInfo != nullptr)
+    {
+        return *tableInternalFormatInfo;
+    }
+
     static const InternalFormat defaultInternalFormat;
     const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
     auto iter                              = formatMap.find(internalFormat);
@@ -1258,6 +1306,13 @@ const InternalFormat &GetSizedInternalFormatInfo(GLenum internalFormat)
 
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat, GLenum type)
 {
+    // If the internal format is sized, simply return it without the type check.
+    const InternalFormat *tableInternalFormatInfo = GetSizedInternalFormatFromTable(internalFormat);
+    if (tableInternalFormatInfo != nullptr)
+    {
+        return *tableInternalFormatInfo;
+    }
+
     static const InternalFormat defaultInternalFormat;
     const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
 
@@ -0,0 +1,51 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// formatutils_unittest.cpp: Unit tests of the internal format lookups.
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/formatutils.h"
+
+namespace
+{
+
+// Checks that the lookups return the entries of the internal format map, whichever way they're
+// looked up.
+TEST(FormatUtilsTest, LookupsMatchInternalFormatMap)
+{
+    for (const auto &internalFormat : gl::GetInternalFormatMap())
+    {
+        const bool sized = internalFormat.second.size() == 1 &&
+                           internalFormat.second.begin()->second.sized;
+
+        const gl::InternalFormat &sizedInfo = gl::GetSizedInternalFormatInfo(internalFormat.first);
+        if (sized)
+        {
+            EXPECT_EQ(&internalFormat.second.begin()->second, &sizedInfo);
+        }
+        else
+        {
+            EXPECT_EQ(static_cast<GLenum>(GL_NONE), sizedInfo.internalFormat);
+        }
+
+        for (const auto &type : internalFormat.second)
+        {
+            EXPECT_EQ(&type.second, &gl::GetInternalFormatInfo(internalFormat.first, type.first));
+        }
+    }
+}
+
+// Checks that unknown formats get the default internal format.
+TEST(FormatUtilsTest, UnknownFormat)
+{
+    EXPECT_EQ(static_cast<GLenum>(GL_NONE), gl::GetSizedInternalFormatInfo(GL_RGBA).internalFormat);
+    EXPECT_EQ(static_cast<GLenum>(GL_NONE), gl::GetSizedInternalFormatInfo(0xFFFF).internalFormat);
+    EXPECT_EQ(static_cast<GLenum>(GL_NONE),
+              gl::GetInternalFormatInfo(GL_RGBA, GL_FLOAT_32_UNSIGNED_INT_24_8_REV).internalFormat);
+}
+
+}  // anonymous namespace
@@ -5,13 +5,17 @@
 //
 // histogram_macros.h:
 //   Helpers for making histograms, to keep consistency with Chromium's
-//   histogram_macros.h.
+//   histogram_macros.h.  Besides going to the platform, the samples are aggregated in process,
+//   see histogram_registry.h.
 
 #ifndef LIBANGLE_HISTOGRAM_MACROS_H_
 #define LIBANGLE_HISTOGRAM_MACROS_H_
 
 #include <platform/Platform.h>
 
+#include "common/system_utils.h"
+#include "libANGLE/histogram_registry.h"
+
 #define ANGLE_HISTOGRAM_TIMES(name, sample) ANGLE_HISTOGRAM_CUSTOM_TIMES(name, sample, 1, 10000, 50)
 
 #define ANGLE_HISTOGRAM_MEDIUM_TIMES(name, sample) \
@@ -40,19 +44,36 @@
 #define ANGLE_HISTOGRAM_COUNTS_10000(name, sample) \
     ANGLE_HISTOGRAM_CUSTOM_COUNTS(name, sample, 1, 10000, 50)
 
-#define ANGLE_HISTOGRAM_CUSTOM_COUNTS(name, sample, min, max, bucket_count)                       \
-    ANGLEPlatformCurrent()->histogramCustomCounts(ANGLEPlatformCurrent(), name, sample, min, max, \
-                                                  bucket_count)
+#define ANGLE_HISTOGRAM_CUSTOM_COUNTS(name, sample, min, max, bucket_count)                        \
+    do                                                                                             \
+    {                                                                                              \
+        ANGLEPlatformCurrent()->histogramCustomCounts(ANGLEPlatformCurrent(), name, sample, min,   \
+                                                      max, bucket_count);                          \
+        static angle::Histogram *const histogram =                                                 \
+            angle::GetCustomCountsHistogram(name, min, max, bucket_count);                         \
+        histogram->add(sample);                                                                    \
+    } while (0)
 
 #define ANGLE_HISTOGRAM_PERCENTAGE(name, under_one_hundred) \
     ANGLE_HISTOGRAM_ENUMERATION(name, under_one_hundred, 101)
 
-#define ANGLE_HISTOGRAM_BOOLEAN(name, sample) \
-    ANGLEPlatformCurrent()->histogramBoolean(ANGLEPlatformCurrent(), name, sample)
-
-#define ANGLE_HISTOGRAM_ENUMERATION(name, sample, boundary_value)                      \
-    ANGLEPlatformCurrent()->histogramEnumeration(ANGLEPlatformCurrent(), name, sample, \
-                                                 boundary_value)
+#define ANGLE_HISTOGRAM_BOOLEAN(name, sample)                                                      \
+    do                                                                                             \
+    {                                                                                              \
+        ANGLEPlatformCurrent()->histogramBoolean(ANGLEPlatformCurrent(), name, sample);            \
+        static angle::Histogram *const histogram = angle::GetEnumerationHistogram(name, 2);        \
+        histogram->add((sample) ? 1 : 0);                                                          \
+    } while (0)
+
+#define ANGLE_HISTOGRAM_ENUMERATION(name, sample, boundary_value)                                \
+    do                                                                                           \
+    {                                                                                            \
+        ANGLEPlatformCurrent()->histogramEnumeration(ANGLEPlatformCurrent(), name, sample,       \
+                                                     boundary_value);                            \
+        static angle::Histogram *const histogram =                                               \
+            angle::GetEnumerationHistogram(name, boundary_value);                                \
+        histogram->add(sample);                                                                  \
+    } while (0)
 
 #define ANGLE_HISTOGRAM_MEMORY_KB(name, sample) \
     ANGLE_HISTOGRAM_CUSTOM_COUNTS(name, sample, 1000, 500000, 50)
@@ -60,6 +81,7 @@
 #define ANGLE_HISTOGRAM_MEMORY_MB(name, sample) \
     ANGLE_HISTOGRAM_CUSTOM_COUNTS(name, sample, 1, 1000, 50)
 
+// Sparse histograms are only reported to the platform.
 #define ANGLE_HISTOGRAM_SPARSE_SLOWLY(name, sample) \
     ANGLEPlatformCurrent()->histogramSparse(ANGLEPlatformCurrent(), name, sample)
 
@@ -84,14 +106,11 @@
     {                                                                                   \
       public:                                                                           \
         ScopedHistogramTimer##key()                                                     \
-            : constructed_(ANGLEPlatformCurrent()->currentTime(ANGLEPlatformCurrent())) \
+            : constructed_(angle::GetCurrentTime())                                     \
         {}                                                                              \
         ~ScopedHistogramTimer##key()                                                    \
         {                                                                               \
-            if (constructed_ == 0)                                                      \
-                return;                                                                 \
-            auto *platform = ANGLEPlatformCurrent();                                    \
-            double elapsed = platform->currentTime(platform) - constructed_;            \
+            double elapsed = angle::GetCurrentTime() - constructed_;                    \
             int elapsedMS  = static_cast<int>(elapsed * 1000.0);                        \
             if (is_long)                                                                \
             {                                                                           \
@@ -0,0 +1,171 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// histogram_registry.cpp:
+//   Aggregates the samples of the ANGLE_HISTOGRAM_* macros in process.
+
+#include "libANGLE/histogram_registry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "anglebase/no_destructor.h"
+#include "common/debug.h"
+
+namespace angle
+{
+namespace
+{
+constexpr int kOverflowBucketEnd = std::numeric_limits<int>::max();
+
+struct HistogramRegistry
+{
+    std::mutex mutex;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms;
+};
+
+HistogramRegistry &GetHistogramRegistry()
+{
+    static angle::base::NoDestructor<HistogramRegistry> registry;
+    return *registry;
+}
+
+template <typename CreateRangesFunc>
+Histogram *GetHistogram(const char *name, CreateRangesFunc &&createRanges)
+{
+    HistogramRegistry &registry = GetHistogramRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::unique_ptr<Histogram> &histogram = registry.histograms[name];
+    if (!histogram)
+    {
+        histogram = std::make_unique<Histogram>(name, createRanges());
+    }
+    return histogram.get();
+}
+
+// The same exponential ranges as Chromium's, so the histograms compare directly to the ones Chrome
+// reports: an underflow bucket below |min|, an overflow bucket from |max|, and buckets in between
+// that grow by a constant ratio, but by at least one.
+std::vector<int> CreateExponentialRanges(int min, int max, int bucketCount)
+{
+    min         = std::max(min, 1);
+    max         = std::max(max, min + 1);
+    bucketCount = std::max(bucketCount, 3);
+
+    std::vector<int> ranges(bucketCount + 1);
+    ranges[0]           = 0;
+    ranges[1]           = min;
+    ranges[bucketCount] = kOverflowBucketEnd;
+
+    const double logMax = std::log(static_cast<double>(max));
+    int current         = min;
+    for (int bucketIndex = 2; bucketIndex < bucketCount; ++bucketIndex)
+    {
+        const double logCurrent = std::log(static_cast<double>(current));
+        const double logRatio   = (logMax - logCurrent) / (bucketCount - bucketIndex);
+        const int next          = static_cast<int>(std::round(std::exp(logCurrent + logRatio)));
+        current                 = std::max(next, current + 1);
+        ranges[bucketIndex]     = current;
+    }
+    return ranges;
+}
+
+std::vector<int> CreateEnumerationRanges(int boundaryValue)
+{
+    boundaryValue = std::max(boundaryValue, 1);
+
+    std::vector<int> ranges(boundaryValue + 2);
+    for (int value = 0; value <= boundaryValue; ++value)
+    {
+        ranges[value] = value;
+    }
+    ranges[boundaryValue + 1] = kOverflowBucketEnd;
+    return ranges;
+}
+}  // anonymous namespace
+
+Histogram::Histogram(const char *name, std::vector<int> &&bucketRanges)
+    : mName(name),
+      mBucketRanges(std::move(bucketRanges)),
+      mBucketCounts(mBucketRanges.size() - 1),
+      mSum(0)
+{
+    ASSERT(mBucketRanges.size() >= 2);
+}
+
+Histogram::~Histogram() = default;
+
+void Histogram::add(int sample)
+{
+    // Samples below the first bucket, which only negative ones can be, are counted in it.
+    auto bucketEnd = std::upper_bound(mBucketRanges.begin() + 1, mBucketRanges.end() - 1, sample);
+    const size_t bucketIndex = bucketEnd - mBucketRanges.begin() - 1;
+
+    mBucketCounts[bucketIndex].fetch_add(1, std::memory_order_relaxed);
+    mSum.fetch_add(sample, std::memory_order_relaxed);
+}
+
+void Histogram::serialize(bool reset, std::string *out)
+{
+    std::string buckets;
+    uint64_t count = 0;
+
+    for (size_t bucketIndex = 0; bucketIndex < mBucketCounts.size(); ++bucketIndex)
+    {
+        std::atomic<uint32_t> &bucketCount = mBucketCounts[bucketIndex];
+        const uint32_t bucketSamples =
+            reset ? bucketCount.exchange(0, std::memory_order_relaxed)
+                  : bucketCount.load(std::memory_order_relaxed);
+        if (bucketSamples == 0)
+        {
+            continue;
+        }
+
+        buckets += buckets.empty() ? "" : ",";
+        buckets += "{\"min\":" + std::to_string(mBucketRanges[bucketIndex]) +
+                   ",\"max\":" + std::to_string(mBucketRanges[bucketIndex + 1]) +
+                   ",\"count\":" + std::to_string(bucketSamples) + "}";
+        count += bucketSamples;
+    }
+
+    const int64_t sum =
+        reset ? mSum.exchange(0, std::memory_order_relaxed) : mSum.load(std::memory_order_relaxed);
+
+    *out += "{\"name\":\"" + std::string(mName) + "\",\"count\":" + std::to_string(count) +
+            ",\"sum\":" + std::to_string(sum) + ",\"buckets\":[" + buckets + "]}";
+}
+
+Histogram *GetCustomCountsHistogram(const char *name, int min, int max, int bucketCount)
+{
+    return GetHistogram(name, [=]() { return CreateExponentialRanges(min, max, bucketCount); });
+}
+
+Histogram *GetEnumerationHistogram(const char *name, int boundaryValue)
+{
+    return GetHistogram(name, [=]() { return CreateEnumerationRanges(boundaryValue); });
+}
+
+std::string SerializeHistograms(bool reset)
+{
+    HistogramRegistry &registry = GetHistogramRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::string out = "{\"histograms\":[";
+    bool isFirst    = true;
+    for (auto &nameAndHistogram : registry.histograms)
+    {
+        out += isFirst ? "" : ",";
+        nameAndHistogram.second->serialize(reset, &out);
+        isFirst = false;
+    }
+    out += "]}";
+    return out;
+}
+}  // namespace angle
@@ -0,0 +1,58 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// histogram_registry.h:
+//   Aggregates the samples of the ANGLE_HISTOGRAM_* macros in process, for the embedders that
+//   don't implement the platform's histogram methods.  The histograms are read and reset through
+//   EGL_ANGLE_histogram_query.
+
+#ifndef LIBANGLE_HISTOGRAM_REGISTRY_H_
+#define LIBANGLE_HISTOGRAM_REGISTRY_H_
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+class Histogram final : angle::NonCopyable
+{
+  public:
+    // |bucketRanges| holds the inclusive lower bound of every bucket, and the exclusive upper
+    // bound of the last one.
+    Histogram(const char *name, std::vector<int> &&bucketRanges);
+    ~Histogram();
+
+    // Lock-free, so that it can be called from any thread.
+    void add(int sample);
+
+    void serialize(bool reset, std::string *out);
+
+  private:
+    const char *mName;
+    std::vector<int> mBucketRanges;
+    std::vector<std::atomic<uint32_t>> mBucketCounts;
+    std::atomic<int64_t> mSum;
+};
+
+// Returns the histogram of |name|, creating it on first use.  The callers keep the result around,
+// so there is no lookup per sample.  The parameters of the first call of a name are used.
+//
+// Exponentially growing buckets between |min| and |max|, as for histogramCustomCounts.
+Histogram *GetCustomCountsHistogram(const char *name, int min, int max, int bucketCount);
+// One bucket per value below |boundaryValue|, as for histogramEnumeration.
+Histogram *GetEnumerationHistogram(const char *name, int boundaryValue);
+
+// Writes all histograms as JSON, optionally resetting them to empty.  Only the buckets that
+// received samples are written:
+//
+//   {"histograms":[{"name":"GPU.ANGLE.ProgramCache.CacheResult","count":3,"sum":2,
+//                   "buckets":[{"min":0,"max":1,"count":1},{"min":1,"max":2,"count":2}]}]}
+std::string SerializeHistograms(bool reset);
+}  // namespace angle
+
+#endif  // LIBANGLE_HISTOGRAM_REGISTRY_H_
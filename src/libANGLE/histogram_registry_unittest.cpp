@@ -0,0 +1,80 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// histogram_registry_unittest.cpp: Unit tests for the in-process histograms.
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/histogram_registry.h"
+
+namespace angle
+{
+namespace
+{
+std::string SerializeHistogram(Histogram *histogram, bool reset)
+{
+    std::string out;
+    histogram->serialize(reset, &out);
+    return out;
+}
+
+// Test that enumeration samples land in one bucket per value, with overflow past the boundary.
+TEST(HistogramRegistryTest, Enumeration)
+{
+    Histogram *histogram = GetEnumerationHistogram("Test.Enumeration", 3);
+
+    histogram->add(0);
+    histogram->add(2);
+    histogram->add(2);
+    histogram->add(5);
+
+    EXPECT_EQ(
+        "{\"name\":\"Test.Enumeration\",\"count\":4,\"sum\":9,\"buckets\":["
+        "{\"min\":0,\"max\":1,\"count\":1},{\"min\":2,\"max\":3,\"count\":2},"
+        "{\"min\":3,\"max\":2147483647,\"count\":1}]}",
+        SerializeHistogram(histogram, false));
+}
+
+// Test that the same name returns the same histogram.
+TEST(HistogramRegistryTest, SameName)
+{
+    EXPECT_EQ(GetCustomCountsHistogram("Test.SameName", 1, 1000, 50),
+              GetCustomCountsHistogram("Test.SameName", 1, 1000, 50));
+}
+
+// Test the underflow and overflow buckets of exponential histograms, and that the buckets in
+// between are increasing.
+TEST(HistogramRegistryTest, CustomCounts)
+{
+    Histogram *histogram = GetCustomCountsHistogram("Test.CustomCounts", 10, 1000, 10);
+
+    histogram->add(5);
+    histogram->add(10);
+    histogram->add(1000);
+    histogram->add(100000);
+
+    EXPECT_EQ(
+        "{\"name\":\"Test.CustomCounts\",\"count\":4,\"sum\":101015,\"buckets\":["
+        "{\"min\":0,\"max\":10,\"count\":1},{\"min\":10,\"max\":18,\"count\":1},"
+        "{\"min\":1000,\"max\":2147483647,\"count\":2}]}",
+        SerializeHistogram(histogram, false));
+}
+
+// Test that resetting empties the histogram, and that the registry serializes it.
+TEST(HistogramRegistryTest, Reset)
+{
+    Histogram *histogram = GetEnumerationHistogram("Test.Reset", 2);
+    histogram->add(1);
+
+    const std::string serialized = SerializeHistograms(true);
+    EXPECT_NE(std::string::npos,
+              serialized.find("{\"name\":\"Test.Reset\",\"count\":1,\"sum\":1,\"buckets\":["
+                              "{\"min\":1,\"max\":2,\"count\":1}]}"));
+
+    EXPECT_EQ("{\"name\":\"Test.Reset\",\"count\":0,\"sum\":0,\"buckets\":[]}",
+              SerializeHistogram(histogram, false));
+}
+}  // anonymous namespace
+}  // namespace angle
@@ -369,6 +369,15 @@ void QueryTexParameterBase(const Context *context,
             *params = CastFromGLintStateValue<ParamType>(
                 pname, texture->getRequiredTextureImageUnits(context));
             break;
+        case GL_TEXTURE_SPARSE_EXT:
+            *params = CastFromGLintStateValue<ParamType>(pname, texture->isSparse());
+            break;
+        case GL_VIRTUAL_PAGE_SIZE_INDEX_EXT:
+            *params = CastFromGLintStateValue<ParamType>(pname, texture->getVirtualPageSizeIndex());
+            break;
+        case GL_NUM_SPARSE_LEVELS_EXT:
+            *params = CastFromGLintStateValue<ParamType>(pname, texture->getNumSparseLevels());
+            break;
         default:
             UNREACHABLE();
             break;
@@ -479,6 +488,13 @@ void SetTexParameterBase(Context *context, Texture *texture, GLenum pname, const
             texture->setInitState(ConvertToBool(params[0]) ? InitState::Initialized
                                                            : InitState::MayNeedInit);
             break;
+        case GL_TEXTURE_SPARSE_EXT:
+            texture->setSparse(ConvertToBool(params[0]));
+            break;
+        case GL_VIRTUAL_PAGE_SIZE_INDEX_EXT:
+            texture->setVirtualPageSizeIndex(
+                clampCast<GLuint>(CastQueryValueTo<GLint>(pname, params[0])));
+            break;
         default:
             UNREACHABLE();
             break;
@@ -1292,6 +1308,9 @@ void QueryProgramiv(Context *context, const Program *program, GLenum pname, GLin
                 *params = program->isLinking() ? GL_FALSE : GL_TRUE;
             }
             return;
+        case GL_PREWARM_COMPLETION_STATUS_ANGLE:
+            *params = context->isContextLost() || program->isPrewarmComplete() ? GL_TRUE : GL_FALSE;
+            return;
         case GL_VALIDATE_STATUS:
             *params = program->isValidated();
             return;
@@ -1635,8 +1654,15 @@ void QueryActiveUniformBlockiv(const Program *program,
                            std::numeric_limits<GLsizei>::max(), nullptr, params);
 }
 
-void QueryInternalFormativ(const TextureCaps &format, GLenum pname, GLsizei bufSize, GLint *params)
+void QueryInternalFormativ(GLenum target,
+                           const TextureCaps &format,
+                           GLenum pname,
+                           GLsizei bufSize,
+                           GLint *params)
 {
+    const GLuint sparsePageSizeCount =
+        format.getSparsePageSizeCount(FromGLenum<TextureType>(target));
+
     switch (pname)
     {
         case GL_NUM_SAMPLE_COUNTS:
@@ -1657,6 +1683,34 @@ void QueryInternalFormativ(const TextureCaps &format, GLenum pname, GLsizei bufS
         }
         break;
 
+        case GL_NUM_VIRTUAL_PAGE_SIZES_EXT:
+            if (bufSize != 0)
+            {
+                *params = sparsePageSizeCount;
+            }
+            break;
+
+        case GL_VIRTUAL_PAGE_SIZE_X_EXT:
+            if (bufSize != 0 && sparsePageSizeCount > 0)
+            {
+                *params = format.sparsePageSize.width;
+            }
+            break;
+
+        case GL_VIRTUAL_PAGE_SIZE_Y_EXT:
+            if (bufSize != 0 && sparsePageSizeCount > 0)
+            {
+                *params = format.sparsePageSize.height;
+            }
+            break;
+
+        case GL_VIRTUAL_PAGE_SIZE_Z_EXT:
+            if (bufSize != 0 && sparsePageSizeCount > 0)
+            {
+                *params = format.sparsePageSize.depth;
+            }
+            break;
+
         default:
             UNREACHABLE();
             break;
@@ -3022,6 +3076,9 @@ unsigned int GetTexParameterCount(GLenum pname)
         case GL_TEXTURE_SRGB_DECODE_EXT:
         case GL_DEPTH_STENCIL_TEXTURE_MODE:
         case GL_TEXTURE_NATIVE_ID_ANGLE:
+        case GL_TEXTURE_SPARSE_EXT:
+        case GL_VIRTUAL_PAGE_SIZE_INDEX_EXT:
+        case GL_NUM_SPARSE_LEVELS_EXT:
             return 1;
         default:
             return 0;
@@ -3236,6 +3293,15 @@ bool GetQueryParameterInfo(const State &glState,
             *type      = GL_INT_64_ANGLEX;
             *numParams = 1;
             return true;
+        case GL_MEMORY_BUDGET_ANGLE:
+        case GL_MEMORY_USAGE_ANGLE:
+            if (!extensions.memorySize)
+            {
+                return false;
+            }
+            *type      = GL_INT_64_ANGLEX;
+            *numParams = 1;
+            return true;
         case GL_GPU_DISJOINT_EXT:
             if (!extensions.disjointTimerQuery)
             {
@@ -3845,6 +3911,23 @@ bool GetQueryParameterInfo(const State &glState,
         }
     }
 
+    if (extensions.sparseTextureEXT)
+    {
+        switch (pname)
+        {
+            case GL_SPARSE_TEXTURE_FULL_ARRAY_CUBE_MIPMAPS_EXT:
+                *type      = GL_BOOL;
+                *numParams = 1;
+                return true;
+            case GL_MAX_SPARSE_TEXTURE_SIZE_EXT:
+            case GL_MAX_SPARSE_3D_TEXTURE_SIZE_EXT:
+            case GL_MAX_SPARSE_ARRAY_TEXTURE_LAYERS_EXT:
+                *type      = GL_INT;
+                *numParams = 1;
+                return true;
+        }
+    }
+
     if (extensions.tessellationShaderEXT)
     {
         switch (pname)
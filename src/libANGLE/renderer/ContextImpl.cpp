@@ -45,11 +45,26 @@ void ContextImpl::handleError(GLenum errorCode,
     mErrors->handleError(errorCode, errorStream.str().c_str(), file, function, line);
 }
 
+angle::Result ContextImpl::prewarmDrawState(const gl::Context *context, gl::PrimitiveMode mode)
+{
+    return angle::Result::Continue;
+}
+
 egl::ContextPriority ContextImpl::getContextPriority() const
 {
     return egl::ContextPriority::Medium;
 }
 
+GLint64 ContextImpl::getMemoryBudget() const
+{
+    return 0;
+}
+
+GLint64 ContextImpl::getMemoryUsage() const
+{
+    return 0;
+}
+
 egl::Error ContextImpl::releaseHighPowerGPU(gl::Context *)
 {
     return egl::NoError();
@@ -158,6 +158,10 @@ class ContextImpl : public GLImplFactory
         const GLuint *baseInstances,
         GLsizei drawcount) = 0;
 
+    // GL_ANGLE_prewarm_draw_state.  Prepares what a draw call of |mode| with the current state
+    // would need, without drawing.  Does nothing by default.
+    virtual angle::Result prewarmDrawState(const gl::Context *context, gl::PrimitiveMode mode);
+
     // Device loss
     virtual gl::GraphicsResetStatus getResetStatus() = 0;
 
@@ -233,6 +237,10 @@ class ContextImpl : public GLImplFactory
 
     virtual egl::ContextPriority getContextPriority() const;
 
+    // GL_ANGLE_memory_size budget queries.  Zero if the budget is unknown.
+    virtual GLint64 getMemoryBudget() const;
+    virtual GLint64 getMemoryUsage() const;
+
     // EGL_ANGLE_power_preference implementation.
     virtual egl::Error releaseHighPowerGPU(gl::Context *context);
     virtual egl::Error reacquireHighPowerGPU(gl::Context *context);
@@ -159,6 +159,10 @@ class ProgramImpl : angle::NonCopyable
     virtual angle::Result syncState(const gl::Context *context,
                                     const gl::Program::DirtyBits &dirtyBits);
 
+    // GL_ANGLE_prewarm_draw_state.  Whether what prewarmDrawState() started for this program is
+    // done.
+    virtual bool isPrewarmComplete() const { return true; }
+
   protected:
     const gl::ProgramState &mState;
 };
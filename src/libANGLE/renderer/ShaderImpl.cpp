@@ -9,6 +9,7 @@
 #include "libANGLE/renderer/ShaderImpl.h"
 
 #include "libANGLE/Context.h"
+#include "libANGLE/MemoryShaderCache.h"
 #include "libANGLE/trace.h"
 
 namespace rx
@@ -79,6 +80,42 @@ class WaitableCompileEventImpl final : public WaitableCompileEvent
     std::shared_ptr<TranslateTask> mTranslateTask;
 };
 
+class CachedCompileEventImpl final : public WaitableCompileEvent
+{
+  public:
+    CachedCompileEventImpl(angle::MemoryBuffer &&cachedShader,
+                           std::shared_ptr<TranslateTask> translateTask)
+        : WaitableCompileEvent(std::make_shared<angle::WaitableEventDone>()),
+          mCachedShader(std::move(cachedShader)),
+          mTranslateTask(translateTask),
+          mTranslated(false)
+    {}
+
+    bool getResult() override
+    {
+        ASSERT(mTranslated);
+        return mTranslateTask->getResult();
+    }
+
+    bool postTranslate(std::string *infoLog) override { return true; }
+
+    const angle::MemoryBuffer *getCachedShader() override
+    {
+        return mTranslated ? nullptr : &mCachedShader;
+    }
+
+    void translate() override
+    {
+        (*mTranslateTask)();
+        mTranslated = true;
+    }
+
+  private:
+    angle::MemoryBuffer mCachedShader;
+    std::shared_ptr<TranslateTask> mTranslateTask;
+    bool mTranslated;
+};
+
 std::shared_ptr<WaitableCompileEvent> ShaderImpl::compileImpl(
     const gl::Context *context,
     gl::ShCompilerInstance *compilerInstance,
@@ -89,12 +126,35 @@ std::shared_ptr<WaitableCompileEvent> ShaderImpl::compileImpl(
     compileOptions |= SH_VALIDATE_AST;
 #endif
 
-    auto workerThreadPool = context->getWorkerThreadPool();
     auto translateTask =
         std::make_shared<TranslateTask>(compilerInstance->getHandle(), compileOptions, source);
 
-    return std::make_shared<WaitableCompileEventImpl>(
+    // Skip the translator entirely if the same source was translated with the same options before.
+    gl::MemoryShaderCache *shaderCache = context->getMemoryShaderCache();
+    egl::BlobCache::Key shaderHash;
+    if (shaderCache != nullptr)
+    {
+        gl::MemoryShaderCache::ComputeHash(context, mState.getShaderType(), source,
+                                           compilerInstance, compileOptions, &shaderHash);
+
+        angle::MemoryBuffer cachedShader;
+        if (shaderCache->getShader(context, shaderHash, &cachedShader))
+        {
+            auto cachedEvent =
+                std::make_shared<CachedCompileEventImpl>(std::move(cachedShader), translateTask);
+            cachedEvent->setShaderCacheKey(shaderHash);
+            return cachedEvent;
+        }
+    }
+
+    auto workerThreadPool = context->getWorkerThreadPool();
+    auto compileEvent     = std::make_shared<WaitableCompileEventImpl>(
         angle::WorkerThreadPool::PostWorkerTask(workerThreadPool, translateTask), translateTask);
+    if (shaderCache != nullptr)
+    {
+        compileEvent->setShaderCacheKey(shaderHash);
+    }
+    return compileEvent;
 }
 
 }  // namespace rx
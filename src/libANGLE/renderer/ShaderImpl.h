@@ -11,7 +11,10 @@
 
 #include <functional>
 
+#include "common/MemoryBuffer.h"
+#include "common/Optional.h"
 #include "common/angleutils.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/Shader.h"
 #include "libANGLE/WorkerThread.h"
 
@@ -40,9 +43,19 @@ class WaitableCompileEvent : public angle::WaitableEvent
 
     const std::string &getInfoLog();
 
+    // The translator output found in the shader cache, in which case no translation was run. If
+    // it can't be loaded, translate() runs the translation synchronously instead.
+    virtual const angle::MemoryBuffer *getCachedShader() { return nullptr; }
+    virtual void translate() { UNREACHABLE(); }
+
+    // The key the translator output is cached under, if the shader cache is in use.
+    const Optional<egl::BlobCache::Key> &getShaderCacheKey() const { return mShaderCacheKey; }
+    void setShaderCacheKey(const egl::BlobCache::Key &key) { mShaderCacheKey = key; }
+
   protected:
     std::shared_ptr<angle::WaitableEvent> mWaitableEvent;
     std::string mInfoLog;
+    Optional<egl::BlobCache::Key> mShaderCacheKey;
 };
 
 class ShaderImpl : angle::NonCopyable
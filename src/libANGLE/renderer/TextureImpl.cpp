@@ -181,4 +181,19 @@ GLint TextureImpl::getRequiredExternalTextureImageUnits(const gl::Context *conte
     return 0;
 }
 
+GLuint TextureImpl::getSparseLevelCount() const
+{
+    UNREACHABLE();
+    return 0;
+}
+
+angle::Result TextureImpl::setPageCommitment(const gl::Context *context,
+                                             GLint level,
+                                             const gl::Box &area,
+                                             bool commit)
+{
+    UNREACHABLE();
+    return angle::Result::Stop;
+}
+
 }  // namespace rx
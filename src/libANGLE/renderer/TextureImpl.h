@@ -236,6 +236,13 @@ class TextureImpl : public FramebufferAttachmentObjectImpl
 
     virtual GLint getRequiredExternalTextureImageUnits(const gl::Context *context);
 
+    // GL_EXT_sparse_texture
+    virtual GLuint getSparseLevelCount() const;
+    virtual angle::Result setPageCommitment(const gl::Context *context,
+                                            GLint level,
+                                            const gl::Box &area,
+                                            bool commit);
+
   protected:
     const gl::TextureState &mState;
 };
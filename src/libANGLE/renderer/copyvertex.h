@@ -11,6 +11,10 @@
 
 #include "common/mathutil.h"
 
+#if defined(ANGLE_USE_NEON)
+#    include <arm_neon.h>
+#endif
+
 namespace rx
 {
 
@@ -9,6 +9,268 @@
 namespace rx
 {
 
+#if defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+namespace priv
+{
+// Vector helpers for the conversions that output one float per component.  Each vertex is
+// converted in one vector, whose lanes past the input components are zero.
+#    if defined(ANGLE_USE_SSE2)
+using VertexVector = __m128;
+using VertexBits   = __m128i;
+
+inline VertexBits LoadVertexBits(const uint8_t *input, size_t loadSize)
+{
+    if (loadSize == 4)
+    {
+        int32_t bits;
+        memcpy(&bits, input, sizeof(bits));
+        return _mm_cvtsi32_si128(bits);
+    }
+    if (loadSize == 8)
+    {
+        return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input));
+    }
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(input));
+}
+
+inline VertexBits AndVertexBits(VertexBits a, VertexBits b)
+{
+    return _mm_and_si128(a, b);
+}
+
+// Widens the components to 32 bits, replicating the sign bit for signed types, and converts them.
+template <typename T>
+inline VertexVector ConvertVertexBits(VertexBits data)
+{
+    if (sizeof(T) == 1)
+    {
+        data = std::is_signed<T>::value ? _mm_srai_epi16(_mm_unpacklo_epi8(data, data), 8)
+                                        : _mm_unpacklo_epi8(data, _mm_setzero_si128());
+    }
+    if (sizeof(T) <= 2)
+    {
+        data = std::is_signed<T>::value ? _mm_srai_epi32(_mm_unpacklo_epi16(data, data), 16)
+                                        : _mm_unpacklo_epi16(data, _mm_setzero_si128());
+    }
+
+    return _mm_cvtepi32_ps(data);
+}
+
+inline VertexVector SetVertexVector(float value)
+{
+    return _mm_set1_ps(value);
+}
+
+inline VertexVector SetVertexVector(float x, float y, float z, float w)
+{
+    return _mm_setr_ps(x, y, z, w);
+}
+
+inline VertexVector AddVertexVector(VertexVector a, VertexVector b)
+{
+    return _mm_add_ps(a, b);
+}
+
+inline VertexVector MultiplyVertexVector(VertexVector a, VertexVector b)
+{
+    return _mm_mul_ps(a, b);
+}
+
+inline VertexVector DivideVertexVector(VertexVector a, VertexVector b)
+{
+    return _mm_div_ps(a, b);
+}
+
+inline VertexVector MaxVertexVector(VertexVector a, VertexVector b)
+{
+    return _mm_max_ps(a, b);
+}
+
+inline void StoreVertexVector(float *output, VertexVector value)
+{
+    _mm_storeu_ps(output, value);
+}
+#    else
+using VertexVector = float32x4_t;
+using VertexBits   = uint8x16_t;
+
+inline VertexBits LoadVertexBits(const uint8_t *input, size_t loadSize)
+{
+    if (loadSize == 4)
+    {
+        uint32_t bits;
+        memcpy(&bits, input, sizeof(bits));
+        return vreinterpretq_u8_u32(vsetq_lane_u32(bits, vdupq_n_u32(0), 0));
+    }
+    if (loadSize == 8)
+    {
+        return vcombine_u8(vld1_u8(input), vdup_n_u8(0));
+    }
+    return vld1q_u8(input);
+}
+
+inline VertexBits AndVertexBits(VertexBits a, VertexBits b)
+{
+    return vandq_u8(a, b);
+}
+
+// Widens the components to 32 bits, replicating the sign bit for signed types, and converts them.
+template <typename T>
+inline VertexVector ConvertVertexBits(VertexBits data)
+{
+    if (sizeof(T) == 1)
+    {
+        return std::is_signed<T>::value
+                   ? vcvtq_f32_s32(vmovl_s16(
+                         vget_low_s16(vmovl_s8(vget_low_s8(vreinterpretq_s8_u8(data))))))
+                   : vcvtq_f32_u32(vmovl_u16(vget_low_u16(vmovl_u8(vget_low_u8(data)))));
+    }
+    if (sizeof(T) == 2)
+    {
+        return std::is_signed<T>::value
+                   ? vcvtq_f32_s32(vmovl_s16(vget_low_s16(vreinterpretq_s16_u8(data))))
+                   : vcvtq_f32_u32(vmovl_u16(vget_low_u16(vreinterpretq_u16_u8(data))));
+    }
+    return vcvtq_f32_s32(vreinterpretq_s32_u8(data));
+}
+
+inline VertexVector SetVertexVector(float value)
+{
+    return vdupq_n_f32(value);
+}
+
+inline VertexVector SetVertexVector(float x, float y, float z, float w)
+{
+    const float values[4] = {x, y, z, w};
+    return vld1q_f32(values);
+}
+
+inline VertexVector AddVertexVector(VertexVector a, VertexVector b)
+{
+    return vaddq_f32(a, b);
+}
+
+inline VertexVector MultiplyVertexVector(VertexVector a, VertexVector b)
+{
+    return vmulq_f32(a, b);
+}
+
+inline VertexVector DivideVertexVector(VertexVector a, VertexVector b)
+{
+    return vdivq_f32(a, b);
+}
+
+inline VertexVector MaxVertexVector(VertexVector a, VertexVector b)
+{
+    return vmaxq_f32(a, b);
+}
+
+inline void StoreVertexVector(float *output, VertexVector value)
+{
+    vst1q_f32(output, value);
+}
+#    endif
+
+// Loads the components of one vertex.  When the input is known to extend far enough, the vertex is
+// loaded with a single load that may read past its last component, and the extra bytes are masked
+// off.  Otherwise it is copied to a zeroed buffer first.
+template <typename T, size_t componentCount>
+class VertexLoader final
+{
+  public:
+    static constexpr size_t kVertexSize = componentCount * sizeof(T);
+    static constexpr size_t kLoadSize   = kVertexSize <= 4 ? 4 : (kVertexSize <= 8 ? 8 : 16);
+    static_assert(kVertexSize <= 16, "Vertex doesn't fit in a vector.");
+
+    VertexLoader()
+    {
+        alignas(16) uint8_t maskBytes[16] = {};
+        memset(maskBytes, 0xFF, kVertexSize);
+        mMask = LoadVertexBits(maskBytes, 16);
+    }
+
+    VertexVector load(const uint8_t *input, bool canReadPastVertex) const
+    {
+        if (canReadPastVertex)
+        {
+            return ConvertVertexBits<T>(AndVertexBits(LoadVertexBits(input, kLoadSize), mMask));
+        }
+
+        alignas(16) uint8_t bytes[16] = {};
+        memcpy(bytes, input, kVertexSize);
+        return ConvertVertexBits<T>(LoadVertexBits(bytes, 16));
+    }
+
+  private:
+    VertexBits mMask;
+};
+
+// Stores the |outputComponentCount| first lanes of the vertex at |index|.  All four lanes are
+// stored when they fit in the output, since the extra lanes are overwritten by the next vertex.
+template <size_t outputComponentCount>
+inline void StoreVertex(float *output, size_t index, size_t count, VertexVector value)
+{
+    float *offsetOutput = output + index * outputComponentCount;
+    if (index * outputComponentCount + 4 <= count * outputComponentCount)
+    {
+        StoreVertexVector(offsetOutput, value);
+        return;
+    }
+
+    float lanes[4];
+    StoreVertexVector(lanes, value);
+    memcpy(offsetOutput, lanes, outputComponentCount * sizeof(float));
+}
+
+template <typename T, size_t inputComponentCount, size_t outputComponentCount, bool normalized>
+inline void CopyToFloatVertexDataSIMD(const uint8_t *input,
+                                      size_t stride,
+                                      size_t count,
+                                      uint8_t *output)
+{
+    typedef std::numeric_limits<T> NL;
+    typedef VertexLoader<T, inputComponentCount> Loader;
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    const Loader loader;
+    const size_t inputSize = stride * (count - 1) + Loader::kVertexSize;
+
+    const VertexVector maxValue = SetVertexVector(static_cast<float>(NL::max()));
+    const VertexVector minusOne = SetVertexVector(-1.0f);
+
+    // The missing components are zero, except for a missing alpha which is one.
+    const bool hasDefaultAlpha = inputComponentCount < 4 && outputComponentCount == 4;
+    const VertexVector padding = SetVertexVector(0.0f, 0.0f, 0.0f, hasDefaultAlpha ? 1.0f : 0.0f);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const bool canReadPastVertex = stride * i + Loader::kLoadSize <= inputSize;
+        VertexVector result          = loader.load(input + stride * i, canReadPastVertex);
+
+        if (normalized)
+        {
+            result = DivideVertexVector(result, maxValue);
+            if (NL::is_signed)
+            {
+                result = MaxVertexVector(result, minusOne);
+            }
+        }
+
+        if (hasDefaultAlpha)
+        {
+            result = AddVertexVector(result, padding);
+        }
+
+        StoreVertex<outputComponentCount>(reinterpret_cast<float *>(output), i, count, result);
+    }
+}
+}  // namespace priv
+#endif  // defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+
 template <typename T,
           size_t inputComponentCount,
           size_t outputComponentCount,
@@ -141,6 +403,32 @@ inline void Copy32FixedTo32FVertexData(const uint8_t *input,
 {
     static const float divisor = 1.0f / (1 << 16);
 
+    // 4-component output formats would need special padding in the alpha channel.
+    static_assert(!(inputComponentCount < 4 && outputComponentCount == 4),
+                  "An inputComponentCount less than 4 and an outputComponentCount equal to 4 "
+                  "is not supported.");
+
+#if defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+    typedef priv::VertexLoader<GLfixed, inputComponentCount> Loader;
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    const Loader loader;
+    const size_t inputSize                 = stride * (count - 1) + Loader::kVertexSize;
+    const priv::VertexVector divisorVector = priv::SetVertexVector(divisor);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const bool canReadPastVertex = i * stride + Loader::kLoadSize <= inputSize;
+        priv::VertexVector result    = loader.load(input + i * stride, canReadPastVertex);
+        result                       = priv::MultiplyVertexVector(result, divisorVector);
+        priv::StoreVertex<outputComponentCount>(reinterpret_cast<float *>(output), i, count,
+                                                result);
+    }
+#else
     for (size_t i = 0; i < count; i++)
     {
         const uint8_t *offsetInput = input + i * stride;
@@ -165,16 +453,12 @@ inline void Copy32FixedTo32FVertexData(const uint8_t *input,
             }
         }
 
-        // 4-component output formats would need special padding in the alpha channel.
-        static_assert(!(inputComponentCount < 4 && outputComponentCount == 4),
-                      "An inputComponentCount less than 4 and an outputComponentCount equal to 4 "
-                      "is not supported.");
-
         for (size_t j = inputComponentCount; j < outputComponentCount; j++)
         {
             offsetOutput[j] = 0.0f;
         }
     }
+#endif  // defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
 }
 
 template <typename T,
@@ -190,6 +474,16 @@ inline void CopyToFloatVertexData(const uint8_t *input,
     typedef std::numeric_limits<T> NL;
     typedef typename std::conditional<toHalf, GLhalf, float>::type outputType;
 
+#if defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+    // 32-bit unsigned integers can't be converted with the signed vector conversion.
+    if (!toHalf && std::is_integral<T>::value && (sizeof(T) <= 2 || NL::is_signed))
+    {
+        priv::CopyToFloatVertexDataSIMD<T, inputComponentCount, outputComponentCount, normalized>(
+            input, stride, count, output);
+        return;
+    }
+#endif
+
     for (size_t i = 0; i < count; i++)
     {
         const T *offsetInput = reinterpret_cast<const T *>(input + (stride * i));
@@ -240,7 +534,7 @@ inline void CopyToFloatVertexData(const uint8_t *input,
             }
             else
             {
-                offsetOutput[3] = static_cast<outputType>(gl::Float32One);
+                offsetOutput[3] = static_cast<outputType>(gl::bitCast<float>(gl::Float32One));
             }
         }
     }
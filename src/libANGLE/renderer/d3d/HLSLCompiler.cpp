@@ -6,8 +6,11 @@
 
 #include "libANGLE/renderer/d3d/HLSLCompiler.h"
 
+#include <anglebase/sha1.h>
+
 #include <sstream>
 
+#include "common/angle_version.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Program.h"
@@ -176,12 +179,17 @@ angle::Result HLSLCompiler::ensureInitialized(d3d::Context *context)
         reinterpret_cast<pD3DDisassemble>(GetProcAddress(mD3DCompilerModule, "D3DDisassemble"));
     ASSERT(mD3DDisassembleFunc);
 
+    char modulePath[MAX_PATH];
+    DWORD modulePathLength = GetModuleFileNameA(mD3DCompilerModule, modulePath, MAX_PATH);
+    mD3DCompilerName.assign(modulePath, modulePathLength);
+
 #else
     // D3D Shader compiler is linked already into this module, so the export
     // can be directly assigned.
     mD3DCompilerModule  = nullptr;
     mD3DCompileFunc     = reinterpret_cast<pD3DCompile>(D3DCompile);
     mD3DDisassembleFunc = reinterpret_cast<pD3DDisassemble>(D3DDisassemble);
+    mD3DCompilerName    = D3DCOMPILER_DLL_A;
 #endif
 
     ANGLE_CHECK_HR(context, mD3DCompileFunc, "Error finding D3DCompile entry point.",
@@ -200,6 +208,7 @@ void HLSLCompiler::release()
         mD3DCompileFunc     = nullptr;
         mD3DDisassembleFunc = nullptr;
         mInitialized        = false;
+        mD3DCompilerName.clear();
     }
 }
 
@@ -356,6 +365,41 @@ angle::Result HLSLCompiler::compileToBinary(d3d::Context *context,
     return angle::Result::Continue;
 }
 
+void HLSLCompiler::computeBinaryCacheKey(const std::string &hlsl,
+                                         const std::string &profile,
+                                         const std::vector<CompileConfig> &configs,
+                                         const D3D_SHADER_MACRO *overrideMacros,
+                                         egl::BlobCache::Key *keyOut) const
+{
+    ASSERT(mInitialized);
+
+    constexpr char kSeparator = ':';
+
+    // The program cache shares the blob cache, so tag the key to keep the two apart.
+    std::ostringstream hashStream;
+    hashStream << "HLSL" << kSeparator << ANGLE_COMMIT_HASH << kSeparator << mD3DCompilerName
+               << kSeparator << profile << kSeparator;
+
+    for (const CompileConfig &config : configs)
+    {
+        hashStream << config.flags << kSeparator;
+    }
+
+    if (overrideMacros != nullptr)
+    {
+        for (const D3D_SHADER_MACRO *macro = overrideMacros; macro->Name != nullptr; ++macro)
+        {
+            hashStream << macro->Name << '=' << macro->Definition << kSeparator;
+        }
+    }
+
+    hashStream << hlsl.length() << kSeparator << hlsl;
+
+    const std::string &binaryKey = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(binaryKey.c_str()),
+                               binaryKey.length(), keyOut->data());
+}
+
 angle::Result HLSLCompiler::disassembleBinary(d3d::Context *context,
                                               ID3DBlob *shaderBinary,
                                               std::string *disassemblyOut)
@@ -9,6 +9,7 @@
 #ifndef LIBANGLE_RENDERER_D3D_HLSLCOMPILER_H_
 #define LIBANGLE_RENDERER_D3D_HLSLCOMPILER_H_
 
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/Error.h"
 
 #include "common/angleutils.h"
@@ -57,6 +58,15 @@ class HLSLCompiler : angle::NonCopyable
                                   ID3DBlob **outCompiledBlob,
                                   std::string *outDebugInfo);
 
+    // Hashes everything the binary output by compileToBinary() depends on: the HLSL, the profile,
+    // the flags of the configurations, the macros and the D3DCompiler module.  Used to cache the
+    // binaries across runs.  Must only be called once the compiler is initialized.
+    void computeBinaryCacheKey(const std::string &hlsl,
+                               const std::string &profile,
+                               const std::vector<CompileConfig> &configs,
+                               const D3D_SHADER_MACRO *overrideMacros,
+                               egl::BlobCache::Key *keyOut) const;
+
     angle::Result disassembleBinary(d3d::Context *context,
                                     ID3DBlob *shaderBinary,
                                     std::string *disassemblyOut);
@@ -67,6 +77,8 @@ class HLSLCompiler : angle::NonCopyable
     HMODULE mD3DCompilerModule;
     pD3DCompile mD3DCompileFunc;
     pD3DDisassemble mD3DDisassembleFunc;
+    // The path of the loaded D3DCompiler module, which identifies its version.
+    std::string mD3DCompilerName;
 };
 
 }  // namespace rx
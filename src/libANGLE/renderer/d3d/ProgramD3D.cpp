@@ -22,6 +22,7 @@
 #include "libANGLE/features.h"
 #include "libANGLE/queryconversions.h"
 #include "libANGLE/renderer/ContextImpl.h"
+#include "libANGLE/renderer/Format.h"
 #include "libANGLE/renderer/d3d/ContextD3D.h"
 #include "libANGLE/renderer/d3d/DynamicHLSL.h"
 #include "libANGLE/renderer/d3d/FramebufferD3D.h"
@@ -39,6 +40,10 @@ namespace rx
 namespace
 {
 
+// Bounds the extra vertex shader compiles done while linking to predict the input layouts used by
+// the first draws.
+constexpr size_t kMaxPredictedVertexExecutables = 4;
+
 void GetDefaultInputLayoutFromShader(gl::Shader *vertexShader, gl::InputLayout *inputLayoutOut)
 {
     inputLayoutOut->clear();
@@ -1700,6 +1705,51 @@ class ProgramD3D::GetVertexExecutableTask : public ProgramD3D::GetExecutableTask
     }
 };
 
+// Compiles the vertex executable of a predicted input layout. Doesn't use the cached input layout
+// of the program, so it can run along with GetVertexExecutableTask.
+class ProgramD3D::GetPredictedVertexExecutableTask : public ProgramD3D::GetExecutableTask
+{
+  public:
+    GetPredictedVertexExecutableTask(ProgramD3D *program, const gl::InputLayout &inputLayout)
+        : GetExecutableTask(program), mInputLayout(inputLayout)
+    {}
+    ~GetPredictedVertexExecutableTask() override { SafeDelete(mExecutable); }
+
+    angle::Result run() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ProgramD3D::GetPredictedVertexExecutableTask::run");
+        std::string finalVertexHLSL = mProgram->mDynamicHLSL->generateVertexShaderForInputLayout(
+            mProgram->mShaderHLSL[gl::ShaderType::Vertex], mInputLayout,
+            mProgram->mState.getProgramInputs());
+
+        ANGLE_TRY(mProgram->mRenderer->compileToExecutable(
+            this, mInfoLog, finalVertexHLSL, gl::ShaderType::Vertex, mProgram->mStreamOutVaryings,
+            (mProgram->mState.getTransformFeedbackBufferMode() == GL_SEPARATE_ATTRIBS),
+            mProgram->mShaderWorkarounds[gl::ShaderType::Vertex], &mExecutable));
+
+        return angle::Result::Continue;
+    }
+
+    // Hands the executable over to the program. Failing to compile a predicted variant is not a
+    // link error, the variant is compiled again if a draw call uses it.
+    void addToProgram()
+    {
+        if (mResult != angle::Result::Continue || mExecutable == nullptr)
+        {
+            return;
+        }
+
+        VertexExecutable::Signature signature;
+        VertexExecutable::getSignature(mProgram->mRenderer, mInputLayout, &signature);
+        mProgram->mVertexExecutables.push_back(std::unique_ptr<VertexExecutable>(
+            new VertexExecutable(mInputLayout, signature, mExecutable)));
+        mExecutable = nullptr;
+    }
+
+  private:
+    gl::InputLayout mInputLayout;
+};
+
 void ProgramD3D::updateCachedInputLayoutFromShader()
 {
     GetDefaultInputLayoutFromShader(mState.getAttachedShader(gl::ShaderType::Vertex),
@@ -1708,6 +1758,61 @@ void ProgramD3D::updateCachedInputLayoutFromShader()
     updateCachedVertexExecutableIndex();
 }
 
+void ProgramD3D::getPredictedInputLayouts(std::vector<gl::InputLayout> *inputLayoutsOut) const
+{
+    inputLayoutsOut->clear();
+
+    gl::InputLayout defaultInputLayout;
+    GetDefaultInputLayoutFromShader(mState.getAttachedShader(gl::ShaderType::Vertex),
+                                    &defaultInputLayout);
+
+    std::vector<VertexExecutable::Signature> signatures(1);
+    VertexExecutable::getSignature(mRenderer, defaultInputLayout, &signatures[0]);
+
+    // Normalized and float data both match the default vertex executable of a float attribute.
+    // Only unnormalized integer data gets converted in the vertex shader, so predict that each
+    // float attribute may be fed with the usual signed and unsigned integer types.
+    constexpr gl::VertexAttribType kPredictedTypes[] = {gl::VertexAttribType::Short,
+                                                        gl::VertexAttribType::UnsignedByte};
+
+    for (size_t index = 0; index < defaultInputLayout.size(); ++index)
+    {
+        angle::FormatID defaultFormatID = defaultInputLayout[index];
+        if (defaultFormatID == angle::FormatID::NONE)
+        {
+            continue;
+        }
+
+        const angle::Format &defaultFormat = angle::Format::Get(defaultFormatID);
+        if (defaultFormat.isInt())
+        {
+            continue;
+        }
+
+        for (gl::VertexAttribType type : kPredictedTypes)
+        {
+            if (inputLayoutsOut->size() >= kMaxPredictedVertexExecutables)
+            {
+                return;
+            }
+
+            gl::InputLayout inputLayout = defaultInputLayout;
+            inputLayout[index] =
+                gl::GetVertexFormatID(type, GL_FALSE, defaultFormat.channelCount, false);
+
+            VertexExecutable::Signature signature;
+            VertexExecutable::getSignature(mRenderer, inputLayout, &signature);
+            if (std::find(signatures.begin(), signatures.end(), signature) != signatures.end())
+            {
+                continue;
+            }
+
+            signatures.push_back(signature);
+            inputLayoutsOut->push_back(inputLayout);
+        }
+    }
+}
+
 class ProgramD3D::GetPixelExecutableTask : public ProgramD3D::GetExecutableTask
 {
   public:
@@ -1786,11 +1891,15 @@ class ProgramD3D::GetComputeExecutableTask : public ProgramD3D::GetExecutableTas
 class ProgramD3D::GraphicsProgramLinkEvent final : public LinkEvent
 {
   public:
+    using PredictedVertexTasks =
+        std::vector<std::shared_ptr<ProgramD3D::GetPredictedVertexExecutableTask>>;
+
     GraphicsProgramLinkEvent(gl::InfoLog &infoLog,
                              std::shared_ptr<WorkerThreadPool> workerPool,
                              std::shared_ptr<ProgramD3D::GetVertexExecutableTask> vertexTask,
                              std::shared_ptr<ProgramD3D::GetPixelExecutableTask> pixelTask,
                              std::shared_ptr<ProgramD3D::GetGeometryExecutableTask> geometryTask,
+                             PredictedVertexTasks predictedVertexTasks,
                              bool useGS,
                              const ShaderD3D *vertexShader,
                              const ShaderD3D *fragmentShader)
@@ -1798,6 +1907,7 @@ class ProgramD3D::GraphicsProgramLinkEvent final : public LinkEvent
           mVertexTask(vertexTask),
           mPixelTask(pixelTask),
           mGeometryTask(geometryTask),
+          mPredictedVertexTasks(std::move(predictedVertexTasks)),
           mWaitEvents({{std::shared_ptr<WaitableEvent>(
                             angle::WorkerThreadPool::PostWorkerTask(workerPool, mVertexTask)),
                         std::shared_ptr<WaitableEvent>(
@@ -1807,13 +1917,25 @@ class ProgramD3D::GraphicsProgramLinkEvent final : public LinkEvent
           mUseGS(useGS),
           mVertexShader(vertexShader),
           mFragmentShader(fragmentShader)
-    {}
+    {
+        for (const auto &predictedVertexTask : mPredictedVertexTasks)
+        {
+            mPredictedWaitEvents.push_back(
+                angle::WorkerThreadPool::PostWorkerTask(workerPool, predictedVertexTask));
+        }
+    }
 
     angle::Result wait(const gl::Context *context) override
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "ProgramD3D::GraphicsProgramLinkEvent::wait");
         WaitableEvent::WaitMany(&mWaitEvents);
 
+        // The predicted tasks use the program state too, so they must be done before returning.
+        for (auto &event : mPredictedWaitEvents)
+        {
+            event->wait();
+        }
+
         ANGLE_TRY(checkTask(context, mVertexTask.get()));
         ANGLE_TRY(checkTask(context, mPixelTask.get()));
         ANGLE_TRY(checkTask(context, mGeometryTask.get()));
@@ -1853,8 +1975,14 @@ class ProgramD3D::GraphicsProgramLinkEvent final : public LinkEvent
         if (!isLinked)
         {
             mInfoLog << "Failed to create D3D Shaders";
+            return angle::Result::Incomplete;
         }
-        return isLinked ? angle::Result::Continue : angle::Result::Incomplete;
+
+        for (const auto &predictedVertexTask : mPredictedVertexTasks)
+        {
+            predictedVertexTask->addToProgram();
+        }
+        return angle::Result::Continue;
     }
 
     bool isLinking() override
@@ -1866,6 +1994,13 @@ class ProgramD3D::GraphicsProgramLinkEvent final : public LinkEvent
                 return true;
             }
         }
+        for (auto &event : mPredictedWaitEvents)
+        {
+            if (!event->isReady())
+            {
+                return true;
+            }
+        }
         return false;
     }
 
@@ -1892,7 +2027,9 @@ class ProgramD3D::GraphicsProgramLinkEvent final : public LinkEvent
     std::shared_ptr<ProgramD3D::GetVertexExecutableTask> mVertexTask;
     std::shared_ptr<ProgramD3D::GetPixelExecutableTask> mPixelTask;
     std::shared_ptr<ProgramD3D::GetGeometryExecutableTask> mGeometryTask;
+    PredictedVertexTasks mPredictedVertexTasks;
     std::array<std::shared_ptr<WaitableEvent>, 3> mWaitEvents;
+    std::vector<std::shared_ptr<WaitableEvent>> mPredictedWaitEvents;
     bool mUseGS;
     const ShaderD3D *mVertexShader;
     const ShaderD3D *mFragmentShader;
@@ -1950,9 +2087,23 @@ std::unique_ptr<LinkEvent> ProgramD3D::compileProgramExecutables(const gl::Conte
     const ShaderD3D *fragmentShaderD3D =
         fragmentShader ? GetImplAs<ShaderD3D>(fragmentShader) : nullptr;
 
-    return std::make_unique<GraphicsProgramLinkEvent>(infoLog, context->getWorkerThreadPool(),
-                                                      vertexTask, pixelTask, geometryTask, useGS,
-                                                      vertexShaderD3D, fragmentShaderD3D);
+    // Without worker threads, the predicted variants would only make the link slower.
+    GraphicsProgramLinkEvent::PredictedVertexTasks predictedVertexTasks;
+    if (vertexShader && mRenderer->getFeatures().preCompileVertexInputLayoutVariants.enabled &&
+        context->getWorkerThreadPool()->isAsync())
+    {
+        std::vector<gl::InputLayout> predictedInputLayouts;
+        getPredictedInputLayouts(&predictedInputLayouts);
+        for (const gl::InputLayout &inputLayout : predictedInputLayouts)
+        {
+            predictedVertexTasks.push_back(
+                std::make_shared<GetPredictedVertexExecutableTask>(this, inputLayout));
+        }
+    }
+
+    return std::make_unique<GraphicsProgramLinkEvent>(
+        infoLog, context->getWorkerThreadPool(), vertexTask, pixelTask, geometryTask,
+        std::move(predictedVertexTasks), useGS, vertexShaderD3D, fragmentShaderD3D);
 }
 
 std::unique_ptr<LinkEvent> ProgramD3D::compileComputeExecutable(const gl::Context *context,
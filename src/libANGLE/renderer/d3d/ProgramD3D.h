@@ -354,6 +354,7 @@ class ProgramD3D : public ProgramImpl
     // These forward-declared tasks are used for multi-thread shader compiles.
     class GetExecutableTask;
     class GetVertexExecutableTask;
+    class GetPredictedVertexExecutableTask;
     class GetPixelExecutableTask;
     class GetGeometryExecutableTask;
     class GetComputeExecutableTask;
@@ -518,6 +519,7 @@ class ProgramD3D : public ProgramImpl
     void initializeShaderStorageBlocks();
 
     void updateCachedInputLayoutFromShader();
+    void getPredictedInputLayouts(std::vector<gl::InputLayout> *inputLayoutsOut) const;
     void updateCachedOutputLayoutFromShader();
     void updateCachedImage2DBindLayoutFromComputeShader();
     void updateCachedVertexExecutableIndex();
@@ -157,6 +157,52 @@ Serial RendererD3D::generateSerial()
     return mSerialFactory.generate();
 }
 
+bool RendererD3D::isShaderBinaryCachingEnabled() const
+{
+    return mDisplay->getBlobCache().isCachingEnabled();
+}
+
+bool RendererD3D::getCachedShaderBinary(const egl::BlobCache::Key &key,
+                                        angle::MemoryBuffer *binaryOut)
+{
+    egl::BlobCache &blobCache = mDisplay->getBlobCache();
+
+    // The blob cache is shared with the program cache, so it's guarded by the same mutex.
+    std::lock_guard<std::mutex> cacheLock(mDisplay->getProgramCacheMutex());
+
+    egl::BlobCache::Value compressedBinary;
+    size_t compressedSize = 0;
+    if (!blobCache.get(key, &compressedBinary, &compressedSize))
+    {
+        return false;
+    }
+
+    if (!egl::DecompressBlobCacheData(compressedBinary.data(), compressedSize, binaryOut))
+    {
+        ERR() << "Error decompressing shader binary data.";
+        blobCache.remove(key);
+        return false;
+    }
+
+    return true;
+}
+
+void RendererD3D::putCachedShaderBinary(const egl::BlobCache::Key &key,
+                                        const uint8_t *binary,
+                                        size_t binarySize)
+{
+    angle::MemoryBuffer compressedBinary;
+    if (!egl::CompressBlobCacheData(mDisplay->getBlobCache().getCodec(), binarySize, binary,
+                                    &compressedBinary))
+    {
+        ERR() << "Error compressing shader binary data.";
+        return;
+    }
+
+    std::lock_guard<std::mutex> cacheLock(mDisplay->getProgramCacheMutex());
+    mDisplay->getBlobCache().put(key, std::move(compressedBinary));
+}
+
 bool InstancedPointSpritesActive(ProgramD3D *programD3D, gl::PrimitiveMode mode)
 {
     return programD3D->usesPointSize() && programD3D->usesInstancedPointSpriteEmulation() &&
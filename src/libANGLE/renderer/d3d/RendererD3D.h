@@ -14,6 +14,7 @@
 #include "common/Color.h"
 #include "common/MemoryBuffer.h"
 #include "common/debug.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/Device.h"
 #include "libANGLE/State.h"
 #include "libANGLE/Version.h"
@@ -407,6 +408,16 @@ class RendererD3D : public BufferFactoryD3D
 
     Serial generateSerial();
 
+    // Cache of the binaries output by the HLSL compiler, keyed by
+    // HLSLCompiler::computeBinaryCacheKey().  Lives in the blob cache of the display, so the
+    // shaders compiled in an earlier run skip D3DCompile, including the executables created for new
+    // input and output layouts after link.  Safe to call from the worker threads.
+    bool getCachedShaderBinary(const egl::BlobCache::Key &key, angle::MemoryBuffer *binaryOut);
+    void putCachedShaderBinary(const egl::BlobCache::Key &key,
+                               const uint8_t *binary,
+                               size_t binarySize);
+    bool isShaderBinaryCachingEnabled() const;
+
     virtual bool canSelectViewInVertexShader() const = 0;
 
   protected:
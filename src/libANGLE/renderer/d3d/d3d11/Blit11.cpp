@@ -1944,4 +1944,12 @@ void Blit11::releaseResolveDepthStencilResources()
     mResolvedDepthStencilRTView.reset();
 }
 
+void Blit11::releaseScratchResources()
+{
+    releaseResolveDepthStencilResources();
+    mResolvedDepthStencil.reset();
+    mResolvedDepthDSView.reset();
+    mResolvedDepth.reset();
+}
+
 }  // namespace rx
@@ -90,6 +90,10 @@ class Blit11 : angle::NonCopyable
                                  bool alsoDepth,
                                  TextureHelper11 *textureOut);
 
+    // Releases the textures kept to resolve multisampled depth and stencil. They are created again
+    // by the next resolve.
+    void releaseScratchResources();
+
     using BlitConvertFunction = void(const gl::Box &sourceArea,
                                      const gl::Box &destArea,
                                      const gl::Rectangle &clipRect,
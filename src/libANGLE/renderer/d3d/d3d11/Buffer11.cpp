@@ -62,6 +62,22 @@ void CalculateConstantBufferParams(GLintptr offset,
     // https://msdn.microsoft.com/en-us/library/windows/desktop/hh404649%28v=vs.85%29.aspx
 }
 
+// Storages with a default usage buffer, which can be updated with a copy on the GPU.
+bool IsUploadRingDestination(BufferUsage usage)
+{
+    switch (usage)
+    {
+        case BUFFER_USAGE_VERTEX_OR_TRANSFORM_FEEDBACK:
+        case BUFFER_USAGE_INDEX:
+        case BUFFER_USAGE_INDIRECT:
+        case BUFFER_USAGE_PIXEL_UNPACK:
+        case BUFFER_USAGE_RAW_UAV:
+            return true;
+        default:
+            return false;
+    }
+}
+
 }  // anonymous namespace
 
 namespace gl_d3d11
@@ -415,6 +431,7 @@ angle::Result Buffer11::setSubData(const gl::Context *context,
         // Use system memory storage for dynamic buffers.
         // Try using a constant storage for constant buffers
         BufferStorage *writeBuffer = nullptr;
+        bool useUploadRing         = false;
         if (target == gl::BufferBinding::Uniform)
         {
             // If we are a very large uniform buffer, keep system memory storage around so that we
@@ -444,7 +461,21 @@ angle::Result Buffer11::setSubData(const gl::Context *context,
         }
         else if (supportsDirectBinding())
         {
-            ANGLE_TRY(getStagingStorage(context, &writeBuffer));
+            // Small updates of data that is already on the GPU are copied there through the upload
+            // ring. Mapping the staging storage instead may wait for copies from it to be done.
+            BufferStorage *latestStorage = nullptr;
+            ANGLE_TRY(getLatestBufferStorage(context, &latestStorage));
+            if (latestStorage && IsUploadRingDestination(latestStorage->getUsage()) &&
+                latestStorage->getSize() >= requiredSize &&
+                size <= Renderer11::kMaxBufferUploadRingCopySize)
+            {
+                writeBuffer   = latestStorage;
+                useUploadRing = true;
+            }
+            else
+            {
+                ANGLE_TRY(getStagingStorage(context, &writeBuffer));
+            }
         }
         else
         {
@@ -461,7 +492,17 @@ angle::Result Buffer11::setSubData(const gl::Context *context,
             ANGLE_TRY(writeBuffer->resize(context, requiredSize, preserveData));
         }
 
-        ANGLE_TRY(writeBuffer->setData(context, static_cast<const uint8_t *>(data), offset, size));
+        if (useUploadRing)
+        {
+            ANGLE_TRY(mRenderer->copyToBufferThroughUploadRing(
+                context, GetAs<NativeStorage>(writeBuffer)->getBuffer(), offset,
+                static_cast<const uint8_t *>(data), size));
+        }
+        else
+        {
+            ANGLE_TRY(
+                writeBuffer->setData(context, static_cast<const uint8_t *>(data), offset, size));
+        }
         onStorageUpdate(writeBuffer);
     }
 
@@ -643,6 +684,15 @@ angle::Result Buffer11::checkForDeallocation(const gl::Context *context, BufferU
     return angle::Result::Continue;
 }
 
+void Buffer11::releaseStagingStorage()
+{
+    BufferStorage *&storage = mBufferStorages[BUFFER_USAGE_STAGING];
+    if (storage != nullptr && storage != mLatestBufferStorage && storage != mMappedStorage)
+    {
+        SafeDelete(storage);
+    }
+}
+
 // Keep system memory when we are using it for the canonical version of data.
 bool Buffer11::canDeallocateSystemMemory() const
 {
@@ -771,6 +821,13 @@ angle::Result Buffer11::getSRV(const gl::Context *context,
     return nativeStorage->getSRVForFormat(context, srvFormat, srvOut);
 }
 
+bool Buffer11::isLatestDataInSystemMemory() const
+{
+    // The latest storage is the one with the lowest usage among the up to date ones.
+    return mLatestBufferStorage == nullptr ||
+           mLatestBufferStorage->getUsage() == BUFFER_USAGE_SYSTEM_MEMORY;
+}
+
 angle::Result Buffer11::packPixels(const gl::Context *context,
                                    const gl::FramebufferAttachment &readAttachment,
                                    const PackPixelsParams &params)
@@ -83,10 +83,14 @@ class Buffer11 : public BufferD3D
 
     angle::Result markRawBufferUsage(const gl::Context *context);
     bool isMapped() const { return mMappedStorage != nullptr; }
+    // Returns false if getData() would have to read the data back from GPU memory.
+    bool isLatestDataInSystemMemory() const;
     angle::Result packPixels(const gl::Context *context,
                              const gl::FramebufferAttachment &readAttachment,
                              const PackPixelsParams &params);
     size_t getTotalCPUBufferMemoryBytes() const;
+    // Frees the staging storage unless it holds the only copy of the latest data.
+    void releaseStagingStorage();
 
     // BufferD3D implementation
     size_t getSize() const override;
@@ -21,6 +21,7 @@
 #include "libANGLE/renderer/d3d/d3d11/formatutils11.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
 #include "libANGLE/renderer/d3d/d3d11/texture_format_table.h"
+#include "libANGLE/renderer/renderer_utils.h"
 
 namespace rx
 {
@@ -65,8 +66,9 @@ angle::Result Image11::GenerateMipmap(const gl::Context *context,
 
     auto mipGenerationFunction =
         d3d11::Format::Get(src->getInternalFormat(), rendererCaps).format().mipGenerationFunction;
-    mipGenerationFunction(src->getWidth(), src->getHeight(), src->getDepth(), sourceData,
-                          srcMapped.RowPitch, srcMapped.DepthPitch, destData, destMapped.RowPitch,
+    GenerateMipInParallel(context->getWorkerThreadPool(), mipGenerationFunction, src->getWidth(),
+                          src->getHeight(), src->getDepth(), sourceData, srcMapped.RowPitch,
+                          srcMapped.DepthPitch, destData, destMapped.RowPitch,
                           destMapped.DepthPitch);
 
     dest->markDirty();
@@ -0,0 +1,299 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// IndexConversion11.cpp:
+//   Implementation of the GPU index buffer conversion.
+//
+
+#include "libANGLE/renderer/d3d/d3d11/IndexConversion11.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/d3d/IndexDataManager.h"
+#include "libANGLE/renderer/d3d/d3d11/Buffer11.h"
+#include "libANGLE/renderer/d3d/d3d11/Context11.h"
+#include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
+#include "libANGLE/renderer/d3d/d3d11/ShaderExecutable11.h"
+#include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
+
+namespace rx
+{
+
+namespace
+{
+
+constexpr unsigned int kConvertThreadGroupSize = 64;
+
+// Each thread writes one dword of the destination, so two indices when converting to
+// UNSIGNED_SHORT.  The source is read through an R32_UINT view, so it doesn't need to be aligned
+// to four bytes.  The destination indices past the source ones wrap around to its start, which
+// closes line loops.
+constexpr char kConvertIndicesHLSL[] = R"(
+cbuffer ConvertParams : register(b0)
+{
+    uint SrcOffset;
+    uint SrcIndexCount;
+    uint DstIndexCount;
+    uint SrcIndexShift;
+    uint DstIndexShift;
+    uint UsePrimitiveRestart;
+};
+
+Buffer<uint> SrcIndices : register(t0);
+RWByteAddressBuffer DstIndices : register(u0);
+
+uint ReadIndex(uint index)
+{
+    uint srcIndex   = (index < SrcIndexCount) ? index : index - SrcIndexCount;
+    uint byteOffset = SrcOffset + (srcIndex << SrcIndexShift);
+    uint srcMask    = (SrcIndexShift == 0) ? 0xFF : ((SrcIndexShift == 1) ? 0xFFFF : 0xFFFFFFFF);
+    uint value      = (SrcIndices[byteOffset >> 2] >> ((byteOffset & 3) * 8)) & srcMask;
+    if (UsePrimitiveRestart != 0 && value == srcMask)
+    {
+        return (DstIndexShift == 1) ? 0xFFFF : 0xFFFFFFFF;
+    }
+    return value;
+}
+
+[numthreads(64, 1, 1)]
+void main(uint3 threadId : SV_DispatchThreadID)
+{
+    uint indicesPerDword = 4 >> DstIndexShift;
+    uint firstIndex      = threadId.x * indicesPerDword;
+    if (firstIndex >= DstIndexCount)
+    {
+        return;
+    }
+
+    uint value = ReadIndex(firstIndex);
+    if (indicesPerDword == 2 && firstIndex + 1 < DstIndexCount)
+    {
+        value |= ReadIndex(firstIndex + 1) << 16;
+    }
+    DstIndices.Store(threadId.x * 4, value);
+}
+)";
+
+unsigned int GetConvertThreadGroupCount(gl::DrawElementsType dstType, GLsizei count)
+{
+    size_t dstSize    = static_cast<size_t>(count) << gl::GetDrawElementsTypeShift(dstType);
+    size_t dwordCount = roundUpPow2<size_t>(dstSize, 4u) / 4;
+    return static_cast<unsigned int>(roundUpPow2<size_t>(dwordCount, kConvertThreadGroupSize) /
+                                     kConvertThreadGroupSize);
+}
+}  // anonymous namespace
+
+IndexConversion11::IndexConversion11(Renderer11 *renderer)
+    : mRenderer(renderer),
+      mResourcesLoaded(false),
+      mConvertIndicesCS(),
+      mParamsConstantBuffer(),
+      mDestBuffer(),
+      mDestBufferUAV(),
+      mDestBufferSize(0)
+{
+    StructZero(&mParamsData);
+}
+
+IndexConversion11::~IndexConversion11() {}
+
+bool IndexConversion11::canConvertIndexBuffer(const Buffer11 &sourceBuffer,
+                                              gl::DrawElementsType srcType,
+                                              gl::DrawElementsType dstType,
+                                              GLsizei count,
+                                              unsigned int offset) const
+{
+    return gl::GetDrawElementsTypeSize(dstType) > gl::GetDrawElementsTypeSize(srcType) &&
+           canDispatch(sourceBuffer, srcType, dstType, count, count, offset);
+}
+
+angle::Result IndexConversion11::convertIndexBuffer(const gl::Context *context,
+                                                    Buffer11 *sourceBuffer,
+                                                    gl::DrawElementsType srcType,
+                                                    gl::DrawElementsType dstType,
+                                                    GLsizei count,
+                                                    unsigned int offset,
+                                                    bool usePrimitiveRestartFixedIndex,
+                                                    const d3d11::Buffer **bufferOut)
+{
+    ASSERT(canConvertIndexBuffer(*sourceBuffer, srcType, dstType, count, offset));
+    return dispatch(context, sourceBuffer, srcType, dstType, count, count, offset,
+                    usePrimitiveRestartFixedIndex, bufferOut);
+}
+
+bool IndexConversion11::canGenerateLineLoopIndexBuffer(const Buffer11 &sourceBuffer,
+                                                       gl::DrawElementsType srcType,
+                                                       GLsizei count,
+                                                       unsigned int offset) const
+{
+    return count < std::numeric_limits<GLsizei>::max() &&
+           canDispatch(sourceBuffer, srcType, gl::DrawElementsType::UnsignedInt, count, count + 1,
+                       offset);
+}
+
+angle::Result IndexConversion11::generateLineLoopIndexBuffer(const gl::Context *context,
+                                                             Buffer11 *sourceBuffer,
+                                                             gl::DrawElementsType srcType,
+                                                             GLsizei count,
+                                                             unsigned int offset,
+                                                             const d3d11::Buffer **bufferOut)
+{
+    ASSERT(canGenerateLineLoopIndexBuffer(*sourceBuffer, srcType, count, offset));
+    return dispatch(context, sourceBuffer, srcType, gl::DrawElementsType::UnsignedInt, count,
+                    count + 1, offset, false, bufferOut);
+}
+
+bool IndexConversion11::canDispatch(const Buffer11 &sourceBuffer,
+                                    gl::DrawElementsType srcType,
+                                    gl::DrawElementsType dstType,
+                                    GLsizei srcCount,
+                                    GLsizei dstCount,
+                                    unsigned int offset) const
+{
+    if (srcCount <= 0 || !IsOffsetAligned(srcType, offset))
+    {
+        return false;
+    }
+
+    // The view of the source only covers whole dwords.
+    size_t srcSize = static_cast<size_t>(srcCount) << gl::GetDrawElementsTypeShift(srcType);
+    size_t srcEnd  = roundUpPow2<size_t>(offset + srcSize, 4u);
+    if (srcEnd > sourceBuffer.getSize() / 4 * 4)
+    {
+        return false;
+    }
+
+    return GetConvertThreadGroupCount(dstType, dstCount) <=
+           D3D11_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION;
+}
+
+angle::Result IndexConversion11::loadResources(const gl::Context *context)
+{
+    if (mResourcesLoaded)
+    {
+        return angle::Result::Continue;
+    }
+
+    Context11 *context11 = GetImplAs<Context11>(context);
+
+    D3D11_BUFFER_DESC constantBufferDesc = {};
+    d3d11::InitConstantBufferDesc(&constantBufferDesc, sizeof(ConvertShaderParams));
+    ANGLE_TRY(mRenderer->allocateResource(context11, constantBufferDesc, &mParamsConstantBuffer));
+    mParamsConstantBuffer.setDebugName("IndexConversion11 constant buffer");
+
+    gl::InfoLog infoLog;
+    ShaderExecutableD3D *convertIndicesCS = nullptr;
+    ANGLE_TRY(mRenderer->compileToExecutable(context11, infoLog, kConvertIndicesHLSL,
+                                             gl::ShaderType::Compute, std::vector<D3DVarying>(),
+                                             false, angle::CompilerWorkaroundsD3D(),
+                                             &convertIndicesCS));
+    ANGLE_CHECK(context11, convertIndicesCS, "Error compiling the index conversion shader.",
+                GL_OUT_OF_MEMORY);
+    mConvertIndicesCS.reset(convertIndicesCS);
+
+    mResourcesLoaded = true;
+
+    return angle::Result::Continue;
+}
+
+angle::Result IndexConversion11::ensureDestBufferSize(const gl::Context *context, size_t size)
+{
+    if (mDestBufferSize >= size)
+    {
+        return angle::Result::Continue;
+    }
+
+    Context11 *context11 = GetImplAs<Context11>(context);
+    size_t newSize       = std::max<size_t>(gl::ceilPow2(static_cast<unsigned int>(size)), 4096u);
+
+    mDestBufferUAV.reset();
+    mDestBuffer.reset();
+    mDestBufferSize = 0;
+
+    D3D11_BUFFER_DESC bufferDesc   = {};
+    bufferDesc.ByteWidth           = static_cast<UINT>(newSize);
+    bufferDesc.Usage               = D3D11_USAGE_DEFAULT;
+    bufferDesc.BindFlags           = D3D11_BIND_INDEX_BUFFER | D3D11_BIND_UNORDERED_ACCESS;
+    bufferDesc.CPUAccessFlags      = 0;
+    bufferDesc.MiscFlags           = D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+    bufferDesc.StructureByteStride = 0;
+
+    ANGLE_TRY(mRenderer->allocateResource(context11, bufferDesc, &mDestBuffer));
+    mDestBuffer.setDebugName("IndexConversion11 index buffer");
+
+    D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc;
+    uavDesc.Format              = DXGI_FORMAT_R32_TYPELESS;
+    uavDesc.ViewDimension       = D3D11_UAV_DIMENSION_BUFFER;
+    uavDesc.Buffer.FirstElement = 0;
+    uavDesc.Buffer.NumElements  = static_cast<UINT>(newSize / 4);
+    uavDesc.Buffer.Flags        = D3D11_BUFFER_UAV_FLAG_RAW;
+
+    ANGLE_TRY(mRenderer->allocateResource(context11, uavDesc, mDestBuffer.get(), &mDestBufferUAV));
+
+    mDestBufferSize = newSize;
+    return angle::Result::Continue;
+}
+
+angle::Result IndexConversion11::dispatch(const gl::Context *context,
+                                          Buffer11 *sourceBuffer,
+                                          gl::DrawElementsType srcType,
+                                          gl::DrawElementsType dstType,
+                                          GLsizei srcCount,
+                                          GLsizei dstCount,
+                                          unsigned int offset,
+                                          bool usePrimitiveRestartFixedIndex,
+                                          const d3d11::Buffer **bufferOut)
+{
+    ANGLE_TRY(loadResources(context));
+
+    size_t dstSize = static_cast<size_t>(dstCount) << gl::GetDrawElementsTypeShift(dstType);
+    ANGLE_TRY(ensureDestBufferSize(context, roundUpPow2<size_t>(dstSize, 4u)));
+
+    const d3d11::ShaderResourceView *sourceSRV = nullptr;
+    ANGLE_TRY(sourceBuffer->getSRV(context, DXGI_FORMAT_R32_UINT, &sourceSRV));
+    ASSERT(sourceSRV != nullptr);
+
+    ConvertShaderParams shaderParams;
+    StructZero(&shaderParams);
+    shaderParams.SrcOffset           = offset;
+    shaderParams.SrcIndexCount       = static_cast<unsigned int>(srcCount);
+    shaderParams.DstIndexCount       = static_cast<unsigned int>(dstCount);
+    shaderParams.SrcIndexShift       = gl::GetDrawElementsTypeShift(srcType);
+    shaderParams.DstIndexShift       = gl::GetDrawElementsTypeShift(dstType);
+    shaderParams.UsePrimitiveRestart = usePrimitiveRestartFixedIndex ? 1 : 0;
+
+    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+
+    if (!StructEquals(mParamsData, shaderParams))
+    {
+        d3d11::SetBufferData(deviceContext, mParamsConstantBuffer.get(), shaderParams);
+        mParamsData = shaderParams;
+    }
+
+    StateManager11 *stateManager = mRenderer->getStateManager();
+
+    // Binding the destination as a UAV would silently unbind it as the index buffer.
+    stateManager->setIndexBuffer(nullptr, DXGI_FORMAT_UNKNOWN, 0);
+
+    stateManager->setComputeShader(
+        &GetAs<ShaderExecutable11>(mConvertIndicesCS.get())->getComputeShader());
+    stateManager->setComputeConstantBuffer(
+        d3d11::RESERVED_CONSTANT_BUFFER_SLOT_DEFAULT_UNIFORM_BLOCK, &mParamsConstantBuffer);
+    stateManager->setShaderResource(gl::ShaderType::Compute, 0, sourceSRV);
+    stateManager->setComputeUnorderedAccessView(0, &mDestBufferUAV);
+
+    deviceContext->Dispatch(GetConvertThreadGroupCount(dstType, dstCount), 1, 1);
+
+    // Unbind the destination, so that it can be bound as the index buffer.
+    stateManager->setComputeUnorderedAccessView(0, nullptr);
+
+    *bufferOut = &mDestBuffer;
+    return angle::Result::Continue;
+}
+
+}  // namespace rx
@@ -0,0 +1,117 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// IndexConversion11.h:
+//   Converts index buffers and generates line loop index buffers with a compute shader, so that
+//   index data that is only in GPU memory doesn't have to be read back to be translated.  Requires
+//   feature level 11_0.
+
+#ifndef LIBANGLE_RENDERER_D3D_D3D11_INDEXCONVERSION11_H_
+#define LIBANGLE_RENDERER_D3D_D3D11_INDEXCONVERSION11_H_
+
+#include <memory>
+
+#include "common/PackedEnums.h"
+#include "libANGLE/Error.h"
+#include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
+
+namespace gl
+{
+class Context;
+}  // namespace gl
+
+namespace rx
+{
+class Buffer11;
+class Renderer11;
+class ShaderExecutableD3D;
+
+class IndexConversion11 : angle::NonCopyable
+{
+  public:
+    explicit IndexConversion11(Renderer11 *renderer);
+    ~IndexConversion11();
+
+    // Returns true if |count| indices of srcType at |offset| in the buffer can be converted to
+    // dstType on the GPU.
+    bool canConvertIndexBuffer(const Buffer11 &sourceBuffer,
+                               gl::DrawElementsType srcType,
+                               gl::DrawElementsType dstType,
+                               GLsizei count,
+                               unsigned int offset) const;
+
+    // Converts the indices into an index buffer of dstType that starts at offset zero.  The
+    // primitive restart index of srcType is replaced with the one of dstType if
+    // usePrimitiveRestartFixedIndex is true.  The returned buffer is only valid until the next
+    // conversion.
+    angle::Result convertIndexBuffer(const gl::Context *context,
+                                     Buffer11 *sourceBuffer,
+                                     gl::DrawElementsType srcType,
+                                     gl::DrawElementsType dstType,
+                                     GLsizei count,
+                                     unsigned int offset,
+                                     bool usePrimitiveRestartFixedIndex,
+                                     const d3d11::Buffer **bufferOut);
+
+    // Same as the above for the UNSIGNED_INT index buffer of a line loop without primitive
+    // restart, which repeats the first index after the last one.
+    bool canGenerateLineLoopIndexBuffer(const Buffer11 &sourceBuffer,
+                                        gl::DrawElementsType srcType,
+                                        GLsizei count,
+                                        unsigned int offset) const;
+    angle::Result generateLineLoopIndexBuffer(const gl::Context *context,
+                                              Buffer11 *sourceBuffer,
+                                              gl::DrawElementsType srcType,
+                                              GLsizei count,
+                                              unsigned int offset,
+                                              const d3d11::Buffer **bufferOut);
+
+  private:
+    struct ConvertShaderParams
+    {
+        unsigned int SrcOffset;
+        unsigned int SrcIndexCount;
+        unsigned int DstIndexCount;
+        unsigned int SrcIndexShift;
+        unsigned int DstIndexShift;
+        unsigned int UsePrimitiveRestart;
+        unsigned int Padding[2];
+    };
+
+    bool canDispatch(const Buffer11 &sourceBuffer,
+                     gl::DrawElementsType srcType,
+                     gl::DrawElementsType dstType,
+                     GLsizei srcCount,
+                     GLsizei dstCount,
+                     unsigned int offset) const;
+    angle::Result dispatch(const gl::Context *context,
+                           Buffer11 *sourceBuffer,
+                           gl::DrawElementsType srcType,
+                           gl::DrawElementsType dstType,
+                           GLsizei srcCount,
+                           GLsizei dstCount,
+                           unsigned int offset,
+                           bool usePrimitiveRestartFixedIndex,
+                           const d3d11::Buffer **bufferOut);
+
+    angle::Result loadResources(const gl::Context *context);
+    angle::Result ensureDestBufferSize(const gl::Context *context, size_t size);
+
+    Renderer11 *mRenderer;
+
+    bool mResourcesLoaded;
+    std::unique_ptr<ShaderExecutableD3D> mConvertIndicesCS;
+    d3d11::Buffer mParamsConstantBuffer;
+    ConvertShaderParams mParamsData;
+
+    d3d11::Buffer mDestBuffer;
+    d3d11::UnorderedAccessView mDestBufferUAV;
+    size_t mDestBufferSize;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_D3D_D3D11_INDEXCONVERSION11_H_
@@ -100,7 +100,9 @@ bool PackedAttributeLayout::operator==(const PackedAttributeLayout &other) const
            (attributeData == other.attributeData);
 }
 
-InputLayoutCache::InputLayoutCache() : mLayoutCache(kDefaultCacheSize * 2) {}
+InputLayoutCache::InputLayoutCache()
+    : mLayoutCache(kDefaultCacheSize * 2), mTrimSize(kDefaultCacheSize / 2)
+{}
 
 InputLayoutCache::~InputLayoutCache() {}
 
@@ -109,6 +111,14 @@ void InputLayoutCache::clear()
     mLayoutCache.Clear();
 }
 
+void InputLayoutCache::logCacheStats() const
+{
+#if defined(ANGLE_ENABLE_PERF_COUNTER_OUTPUT)
+    INFO() << "D3D11 input layout cache stats: hit ratio " << mCacheStats.getHitRatio() << ", "
+           << mCacheStats.getEvictionCount() << " evictions";
+#endif  // defined(ANGLE_ENABLE_PERF_COUNTER_OUTPUT)
+}
+
 angle::Result InputLayoutCache::getInputLayout(
     Context11 *context11,
     const gl::State &state,
@@ -172,11 +182,25 @@ angle::Result InputLayoutCache::getInputLayout(
         auto it = mLayoutCache.Get(layout);
         if (it != mLayoutCache.end())
         {
+            mCacheStats.hit();
             *inputLayoutOut = &it->second;
         }
         else
         {
-            angle::TrimCache(mLayoutCache.max_size() / 2, kGCLimit, "input layout", &mLayoutCache);
+            mCacheStats.miss();
+
+            size_t evictedCount =
+                angle::TrimCache(mTrimSize * 2, kGCLimit, "input layout", &mLayoutCache);
+            if (evictedCount > 0)
+            {
+                mCacheStats.evict(evictedCount);
+                mTrimSize = std::min(mTrimSize * 2, mLayoutCache.max_size() - kGCLimit);
+            }
+            else if (mLayoutCache.size() >= mLayoutCache.max_size())
+            {
+                // Put evicts the least recently used layout of a full cache.
+                mCacheStats.evict();
+            }
 
             d3d11::InputLayout newInputLayout;
             ANGLE_TRY(createInputLayout(context11, sortedSemanticIndices, currentAttributes, mode,
@@ -308,6 +332,7 @@ void InputLayoutCache::setCacheSize(size_t newCacheSize)
     // Forces a reset of the cache.
     LayoutCache newCache(newCacheSize);
     mLayoutCache.Swap(newCache);
+    mTrimSize = newCacheSize / 4;
 }
 
 }  // namespace rx
@@ -88,6 +88,10 @@ class InputLayoutCache : angle::NonCopyable
 
     // Useful for testing
     void setCacheSize(size_t newCacheSize);
+    const CacheStats &getCacheStats() const { return mCacheStats; }
+
+    // Logs the hit ratio and the number of evictions, if perf counter output is enabled.
+    void logCacheStats() const;
 
     angle::Result getInputLayout(Context11 *context,
                                  const gl::State &state,
@@ -116,6 +120,11 @@ class InputLayoutCache : angle::NonCopyable
 
     using LayoutCache = angle::base::HashingMRUCache<PackedAttributeLayout, d3d11::InputLayout>;
     LayoutCache mLayoutCache;
+    CacheStats mCacheStats;
+
+    // The number of layouts kept when the cache is trimmed. Grows each time the cache has to
+    // evict, up to the size of the cache.
+    size_t mTrimSize;
 };
 
 }  // namespace rx
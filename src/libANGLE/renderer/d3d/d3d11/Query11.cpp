@@ -19,6 +19,14 @@
 namespace
 {
 
+// Fetching the result of a query only needs the commands up to its end to be submitted, so the
+// command buffer is flushed on the first attempt and then only once in a while, like
+// Renderer11::finish does.
+constexpr unsigned int kGetDataFlushFrequency = 100;
+
+// The most finished queries each query object keeps for reuse.
+constexpr size_t kMaxFreeQueries = 4;
+
 GLuint64 MergeQueryResults(gl::QueryType type, GLuint64 currentResult, GLuint64 newResult)
 {
     switch (type)
@@ -158,21 +166,31 @@ angle::Result Query11::resume(Context11 *context11)
         gl::QueryType type       = getType();
         D3D11_QUERY d3dQueryType = gl_d3d11::ConvertQueryType(type);
 
-        D3D11_QUERY_DESC queryDesc;
-        queryDesc.Query     = d3dQueryType;
-        queryDesc.MiscFlags = 0;
-
-        ANGLE_TRY(mRenderer->allocateResource(context11, queryDesc, &mActiveQuery->query));
-
-        // If we are doing time elapsed we also need a query to actually query the timestamp
-        if (type == gl::QueryType::TimeElapsed)
+        if (!mFreeQueries.empty())
         {
-            D3D11_QUERY_DESC desc;
-            desc.Query     = D3D11_QUERY_TIMESTAMP;
-            desc.MiscFlags = 0;
+            mActiveQuery = std::move(mFreeQueries.back());
+            mFreeQueries.pop_back();
+        }
+        else
+        {
+            D3D11_QUERY_DESC queryDesc;
+            queryDesc.Query     = d3dQueryType;
+            queryDesc.MiscFlags = 0;
+
+            ANGLE_TRY(mRenderer->allocateResource(context11, queryDesc, &mActiveQuery->query));
 
-            ANGLE_TRY(mRenderer->allocateResource(context11, desc, &mActiveQuery->beginTimestamp));
-            ANGLE_TRY(mRenderer->allocateResource(context11, desc, &mActiveQuery->endTimestamp));
+            // If we are doing time elapsed we also need a query to actually query the timestamp
+            if (type == gl::QueryType::TimeElapsed)
+            {
+                D3D11_QUERY_DESC desc;
+                desc.Query     = D3D11_QUERY_TIMESTAMP;
+                desc.MiscFlags = 0;
+
+                ANGLE_TRY(
+                    mRenderer->allocateResource(context11, desc, &mActiveQuery->beginTimestamp));
+                ANGLE_TRY(
+                    mRenderer->allocateResource(context11, desc, &mActiveQuery->endTimestamp));
+            }
         }
 
         ID3D11DeviceContext *context = mRenderer->getDeviceContext();
@@ -205,20 +223,44 @@ angle::Result Query11::flush(Context11 *context11, bool force)
             {
                 return angle::Result::Continue;
             }
+
+            if (!query->finished)
+            {
+                // Keep polling, but allow other threads to do something useful first
+                ScheduleYield();
+            }
         } while (!query->finished);
 
         mResultSum = MergeQueryResults(getType(), mResultSum, mResult);
+        recycleQuery(std::move(mPendingQueries.front()));
         mPendingQueries.pop_front();
     }
 
     return angle::Result::Continue;
 }
 
+void Query11::recycleQuery(std::unique_ptr<QueryState> &&queryState)
+{
+    // Timestamp queries don't have a D3D11 query to reuse.
+    if (!queryState->query.valid() || mFreeQueries.size() >= kMaxFreeQueries)
+    {
+        return;
+    }
+
+    queryState->getDataAttemptCount = 0;
+    queryState->finished            = false;
+    mFreeQueries.push_back(std::move(queryState));
+}
+
 angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
 {
     if (!queryState->finished)
     {
         ID3D11DeviceContext *context = mRenderer->getDeviceContext();
+
+        bool flushCommands = (queryState->getDataAttemptCount % kGetDataFlushFrequency) == 0;
+        UINT getDataFlags  = flushCommands ? 0 : D3D11_ASYNC_GETDATA_DONOTFLUSH;
+
         switch (getType())
         {
             case gl::QueryType::AnySamples:
@@ -226,8 +268,8 @@ angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
             {
                 ASSERT(queryState->query.valid());
                 UINT64 numPixels = 0;
-                HRESULT result =
-                    context->GetData(queryState->query.get(), &numPixels, sizeof(numPixels), 0);
+                HRESULT result = context->GetData(queryState->query.get(), &numPixels,
+                                                  sizeof(numPixels), getDataFlags);
                 ANGLE_TRY_HR(context11, result, "Failed to get the data of an internal query");
 
                 if (result == S_OK)
@@ -242,8 +284,8 @@ angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
             {
                 ASSERT(queryState->query.valid());
                 D3D11_QUERY_DATA_SO_STATISTICS soStats = {};
-                HRESULT result =
-                    context->GetData(queryState->query.get(), &soStats, sizeof(soStats), 0);
+                HRESULT result = context->GetData(queryState->query.get(), &soStats,
+                                                  sizeof(soStats), getDataFlags);
                 ANGLE_TRY_HR(context11, result, "Failed to get the data of an internal query");
 
                 if (result == S_OK)
@@ -260,21 +302,21 @@ angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
                 ASSERT(queryState->beginTimestamp.valid());
                 ASSERT(queryState->endTimestamp.valid());
                 D3D11_QUERY_DATA_TIMESTAMP_DISJOINT timeStats = {};
-                HRESULT result =
-                    context->GetData(queryState->query.get(), &timeStats, sizeof(timeStats), 0);
+                HRESULT result = context->GetData(queryState->query.get(), &timeStats,
+                                                  sizeof(timeStats), getDataFlags);
                 ANGLE_TRY_HR(context11, result, "Failed to get the data of an internal query");
 
                 if (result == S_OK)
                 {
                     UINT64 beginTime = 0;
                     HRESULT beginRes = context->GetData(queryState->beginTimestamp.get(),
-                                                        &beginTime, sizeof(UINT64), 0);
+                                                        &beginTime, sizeof(UINT64), getDataFlags);
                     ANGLE_TRY_HR(context11, beginRes,
                                  "Failed to get the data of an internal query");
 
                     UINT64 endTime = 0;
                     HRESULT endRes = context->GetData(queryState->endTimestamp.get(), &endTime,
-                                                      sizeof(UINT64), 0);
+                                                      sizeof(UINT64), getDataFlags);
                     ANGLE_TRY_HR(context11, endRes, "Failed to get the data of an internal query");
 
                     if (beginRes == S_OK && endRes == S_OK)
@@ -322,8 +364,8 @@ angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
             {
                 ASSERT(queryState->query.valid());
                 BOOL completed = 0;
-                HRESULT result =
-                    context->GetData(queryState->query.get(), &completed, sizeof(completed), 0);
+                HRESULT result = context->GetData(queryState->query.get(), &completed,
+                                                  sizeof(completed), getDataFlags);
                 ANGLE_TRY_HR(context11, result, "Failed to get the data of an internal query");
 
                 if (result == S_OK)
@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_D3D_D3D11_QUERY11_H_
 
 #include <deque>
+#include <vector>
 
 #include "libANGLE/renderer/QueryImpl.h"
 #include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
@@ -53,6 +54,7 @@ class Query11 : public QueryImpl
 
     angle::Result flush(Context11 *context11, bool force);
     angle::Result testQuery(Context11 *context11, QueryState *queryState);
+    void recycleQuery(std::unique_ptr<QueryState> &&queryState);
 
     template <typename T>
     angle::Result getResultBase(Context11 *context11, T *params);
@@ -64,6 +66,10 @@ class Query11 : public QueryImpl
 
     std::unique_ptr<QueryState> mActiveQuery;
     std::deque<std::unique_ptr<QueryState>> mPendingQueries;
+
+    // Finished queries kept to be issued again, so that queries used every frame don't allocate
+    // D3D11 queries each time.
+    std::vector<std::unique_ptr<QueryState>> mFreeQueries;
 };
 
 }  // namespace rx
@@ -42,6 +42,33 @@ void RenderStateCache::clear()
     mSamplerStateCache.Clear();
 }
 
+void RenderStateCache::logCacheStats() const
+{
+#if defined(ANGLE_ENABLE_PERF_COUNTER_OUTPUT)
+    auto logStats = [](const char *name, const StateCacheUsage &usage) {
+        INFO() << "    " << name << ": hit ratio " << usage.stats.getHitRatio() << ", "
+               << usage.stats.getEvictionCount() << " evictions";
+    };
+
+    INFO() << "D3D11 render state cache stats: ";
+    logStats("Blend state", mBlendStateUsage);
+    logStats("Rasterizer state", mRasterizerStateUsage);
+    logStats("Depth stencil state", mDepthStencilStateUsage);
+    logStats("Sampler state", mSamplerStateUsage);
+#endif  // defined(ANGLE_ENABLE_PERF_COUNTER_OUTPUT)
+}
+
+template <typename CacheT>
+void RenderStateCache::trimStateCache(const char *name, CacheT *cache, StateCacheUsage *usage)
+{
+    size_t evictedCount = TrimCache(usage->trimSize * 2, kGCLimit, name, cache);
+    if (evictedCount > 0)
+    {
+        usage->stats.evict(evictedCount);
+        usage->trimSize = std::min<size_t>(usage->trimSize + usage->trimSize / 2, kMaxTrimSize);
+    }
+}
+
 // static
 d3d11::BlendStateKey RenderStateCache::GetBlendStateKey(const gl::Context *context,
                                                         Framebuffer11 *framebuffer11,
@@ -110,11 +137,13 @@ angle::Result RenderStateCache::getBlendState(const gl::Context *context,
     auto keyIter = mBlendStateCache.Get(key);
     if (keyIter != mBlendStateCache.end())
     {
+        mBlendStateUsage.stats.hit();
         *outBlendState = &keyIter->second;
         return angle::Result::Continue;
     }
 
-    TrimCache(kMaxStates, kGCLimit, "blend state", &mBlendStateCache);
+    mBlendStateUsage.stats.miss();
+    trimStateCache("blend state", &mBlendStateCache, &mBlendStateUsage);
 
     // Create a new blend state and insert it into the cache
     D3D11_BLEND_DESC blendDesc             = {};  // avoid undefined fields
@@ -174,11 +203,13 @@ angle::Result RenderStateCache::getRasterizerState(const gl::Context *context,
     auto keyIter = mRasterizerStateCache.Get(key);
     if (keyIter != mRasterizerStateCache.end())
     {
+        mRasterizerStateUsage.stats.hit();
         *outRasterizerState = keyIter->second.get();
         return angle::Result::Continue;
     }
 
-    TrimCache(kMaxStates, kGCLimit, "rasterizer state", &mRasterizerStateCache);
+    mRasterizerStateUsage.stats.miss();
+    trimStateCache("rasterizer state", &mRasterizerStateCache, &mRasterizerStateUsage);
 
     D3D11_CULL_MODE cullMode =
         gl_d3d11::ConvertCullMode(rasterState.cullFace, rasterState.cullMode);
@@ -228,11 +259,13 @@ angle::Result RenderStateCache::getDepthStencilState(const gl::Context *context,
     auto keyIter = mDepthStencilStateCache.Get(glState);
     if (keyIter != mDepthStencilStateCache.end())
     {
+        mDepthStencilStateUsage.stats.hit();
         *outDSState = &keyIter->second;
         return angle::Result::Continue;
     }
 
-    TrimCache(kMaxStates, kGCLimit, "depth stencil state", &mDepthStencilStateCache);
+    mDepthStencilStateUsage.stats.miss();
+    trimStateCache("depth stencil state", &mDepthStencilStateCache, &mDepthStencilStateUsage);
 
     D3D11_DEPTH_STENCIL_DESC dsDesc     = {};
     dsDesc.DepthEnable                  = glState.depthTest ? TRUE : FALSE;
@@ -268,11 +301,13 @@ angle::Result RenderStateCache::getSamplerState(const gl::Context *context,
     auto keyIter = mSamplerStateCache.Get(samplerState);
     if (keyIter != mSamplerStateCache.end())
     {
+        mSamplerStateUsage.stats.hit();
         *outSamplerState = keyIter->second.get();
         return angle::Result::Continue;
     }
 
-    TrimCache(kMaxStates, kGCLimit, "sampler state", &mSamplerStateCache);
+    mSamplerStateUsage.stats.miss();
+    trimStateCache("sampler state", &mSamplerStateCache, &mSamplerStateUsage);
 
     const auto &featureLevel = renderer->getRenderer11DeviceCaps().featureLevel;
 
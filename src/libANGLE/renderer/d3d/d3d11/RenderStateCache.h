@@ -89,6 +89,10 @@ class RenderStateCache : angle::NonCopyable
                                   const gl::SamplerState &samplerState,
                                   ID3D11SamplerState **outSamplerState);
 
+    // Logs the hit ratio and the number of evictions of each cache, if perf counter output is
+    // enabled.
+    void logCacheStats() const;
+
   private:
     // MSDN's documentation of ID3D11Device::CreateBlendState, ID3D11Device::CreateRasterizerState,
     // ID3D11Device::CreateDepthStencilState and ID3D11Device::CreateSamplerState claims the maximum
@@ -100,23 +104,42 @@ class RenderStateCache : angle::NonCopyable
     // The cache tries to clean up this many states at once.
     static constexpr unsigned int kGCLimit = 128;
 
+    // The most states a cache keeps when trimmed. Leaves room for the states created outside of
+    // the cache, for example by Blit11 and Clear11.
+    static constexpr unsigned int kMaxTrimSize = kMaxStates * 3 / 4;
+
+    // A cache starts by keeping half of the maximum number of states when trimmed, and keeps more
+    // each time it has to evict, so that apps using many states don't keep recreating them.
+    struct StateCacheUsage
+    {
+        CacheStats stats;
+        size_t trimSize = kMaxStates / 2;
+    };
+
+    template <typename CacheT>
+    void trimStateCache(const char *name, CacheT *cache, StateCacheUsage *usage);
+
     // Blend state cache
     using BlendStateMap = angle::base::HashingMRUCache<d3d11::BlendStateKey, d3d11::BlendState>;
     BlendStateMap mBlendStateCache;
+    StateCacheUsage mBlendStateUsage;
 
     // Rasterizer state cache
     using RasterizerStateMap =
         angle::base::HashingMRUCache<d3d11::RasterizerStateKey, d3d11::RasterizerState>;
     RasterizerStateMap mRasterizerStateCache;
+    StateCacheUsage mRasterizerStateUsage;
 
     // Depth stencil state cache
     using DepthStencilStateMap =
         angle::base::HashingMRUCache<gl::DepthStencilState, d3d11::DepthStencilState>;
     DepthStencilStateMap mDepthStencilStateCache;
+    StateCacheUsage mDepthStencilStateUsage;
 
     // Sample state cache
     using SamplerStateMap = angle::base::HashingMRUCache<gl::SamplerState, d3d11::SamplerState>;
     SamplerStateMap mSamplerStateCache;
+    StateCacheUsage mSamplerStateUsage;
 };
 
 }  // namespace rx
@@ -43,6 +43,7 @@
 #include "libANGLE/renderer/d3d/d3d11/Framebuffer11.h"
 #include "libANGLE/renderer/d3d/d3d11/Image11.h"
 #include "libANGLE/renderer/d3d/d3d11/IndexBuffer11.h"
+#include "libANGLE/renderer/d3d/d3d11/IndexConversion11.h"
 #include "libANGLE/renderer/d3d/d3d11/PixelTransfer11.h"
 #include "libANGLE/renderer/d3d/d3d11/Program11.h"
 #include "libANGLE/renderer/d3d/d3d11/Query11.h"
@@ -350,6 +351,9 @@ GLsizei GetAdjustedInstanceCount(const ProgramD3D *program, GLsizei instanceCoun
 
 const uint32_t ScratchMemoryBufferLifetime = 1000;
 
+// Large enough to hold the small buffer updates of a few frames before wrapping around.
+constexpr size_t kBufferUploadRingSize = 4 * 1024 * 1024;
+
 void PopulateFormatDeviceCaps(ID3D11Device *device,
                               DXGI_FORMAT format,
                               UINT *outSupport,
@@ -412,19 +416,23 @@ Renderer11::Renderer11(egl::Display *display)
       mStateManager(this),
       mLastHistogramUpdateTime(
           ANGLEPlatformCurrent()->monotonicallyIncreasingTime(ANGLEPlatformCurrent())),
+      mLastMemoryBudgetCheckTime(0.0),
       mDebug(nullptr),
       mScratchMemoryBuffer(ScratchMemoryBufferLifetime)
 {
     mLineLoopIB    = nullptr;
     mTriangleFanIB = nullptr;
 
-    mBlit          = nullptr;
-    mPixelTransfer = nullptr;
+    mBlit            = nullptr;
+    mPixelTransfer   = nullptr;
+    mIndexConversion = nullptr;
 
     mClear = nullptr;
 
     mTrim = nullptr;
 
+    mBufferUploadRingOffset = 0;
+
     mRenderer11DeviceCaps.supportsClearView                      = false;
     mRenderer11DeviceCaps.supportsConstantBufferOffsets          = false;
     mRenderer11DeviceCaps.supportsVpRtIndexWriteFromVertexShader = false;
@@ -999,6 +1007,9 @@ egl::Error Renderer11::initializeDevice()
     ASSERT(!mPixelTransfer);
     mPixelTransfer = new PixelTransfer11(this);
 
+    ASSERT(!mIndexConversion);
+    mIndexConversion = new IndexConversion11(this);
+
     // Gather stats on DXGI and D3D feature level
     ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.SupportsDXGI1_2", mRenderer11DeviceCaps.supportsDXGI1_2);
 
@@ -1965,6 +1976,35 @@ angle::Result Renderer11::drawLineLoop(const gl::Context *context,
     // Get the raw indices for an indexed draw
     if (type != gl::DrawElementsType::InvalidEnum && elementArrayBuffer)
     {
+        Buffer11 *buffer11 = GetImplAs<Buffer11>(elementArrayBuffer);
+        unsigned int bufferOffset =
+            static_cast<unsigned int>(reinterpret_cast<uintptr_t>(indexPointer));
+
+        // Generate the looping indices on the GPU to avoid reading back the element buffer.
+        if (getFeatures().convertIndexBuffersOnGPU.enabled &&
+            !glState.isPrimitiveRestartEnabled() && !buffer11->isLatestDataInSystemMemory() &&
+            mIndexConversion->canGenerateLineLoopIndexBuffer(*buffer11, type,
+                                                             static_cast<GLsizei>(count),
+                                                             bufferOffset))
+        {
+            const d3d11::Buffer *loopBuffer = nullptr;
+            ANGLE_TRY(mIndexConversion->generateLineLoopIndexBuffer(
+                context, buffer11, type, static_cast<GLsizei>(count), bufferOffset, &loopBuffer));
+
+            mStateManager.setIndexBuffer(loopBuffer->get(), DXGI_FORMAT_R32_UINT, 0);
+
+            UINT loopIndexCount = static_cast<UINT>(count) + 1;
+            if (instances > 0)
+            {
+                mDeviceContext->DrawIndexedInstanced(loopIndexCount, instances, 0, baseVertex, 0);
+            }
+            else
+            {
+                mDeviceContext->DrawIndexed(loopIndexCount, 0, baseVertex);
+            }
+            return angle::Result::Continue;
+        }
+
         BufferD3D *storage = GetImplAs<BufferD3D>(elementArrayBuffer);
         intptr_t offset    = reinterpret_cast<intptr_t>(indices);
 
@@ -2118,9 +2158,12 @@ void Renderer11::releaseDeviceResources()
     SafeDelete(mClear);
     SafeDelete(mTrim);
     SafeDelete(mPixelTransfer);
+    SafeDelete(mIndexConversion);
 
     mSyncQuery.reset();
 
+    mBufferUploadRing.reset();
+
     mCachedResolveTexture.reset();
 }
 
@@ -2181,6 +2224,8 @@ bool Renderer11::testDeviceResettable()
 
 void Renderer11::release()
 {
+    mStateCache.logCacheStats();
+
     mScratchMemoryBuffer.clear();
 
     mAnnotator.release();
@@ -3106,6 +3151,20 @@ angle::Result Renderer11::compileToExecutable(d3d::Context *context,
 
     D3D_SHADER_MACRO loopMacros[] = {{"ANGLE_ENABLE_LOOP_FLATTEN", "1"}, {0, 0}};
 
+    egl::BlobCache::Key binaryCacheKey;
+    const bool useBinaryCache = isShaderBinaryCachingEnabled();
+    if (useBinaryCache)
+    {
+        mCompiler.computeBinaryCacheKey(shaderHLSL, profile, configs, loopMacros, &binaryCacheKey);
+
+        angle::MemoryBuffer cachedBinary;
+        if (getCachedShaderBinary(binaryCacheKey, &cachedBinary))
+        {
+            return loadExecutable(context, cachedBinary.data(), cachedBinary.size(), type,
+                                  streamOutVaryings, separatedOutputBuffers, outExectuable);
+        }
+    }
+
     // TODO(jmadill): Use ComPtr?
     ID3DBlob *binary = nullptr;
     std::string debugInfo;
@@ -3121,9 +3180,14 @@ angle::Result Renderer11::compileToExecutable(d3d::Context *context,
         return angle::Result::Continue;
     }
 
-    angle::Result error = loadExecutable(
-        context, static_cast<const uint8_t *>(binary->GetBufferPointer()), binary->GetBufferSize(),
-        type, streamOutVaryings, separatedOutputBuffers, outExectuable);
+    const uint8_t *binaryData = static_cast<const uint8_t *>(binary->GetBufferPointer());
+    if (useBinaryCache)
+    {
+        putCachedShaderBinary(binaryCacheKey, binaryData, binary->GetBufferSize());
+    }
+
+    angle::Result error = loadExecutable(context, binaryData, binary->GetBufferSize(), type,
+                                         streamOutVaryings, separatedOutputBuffers, outExectuable);
 
     SafeRelease(binary);
     if (error == angle::Result::Stop)
@@ -3806,6 +3870,11 @@ void Renderer11::onSwap()
         updateHistograms();
         mLastHistogramUpdateTime = currentTime;
     }
+
+    if (getFeatures().releaseCachedResourcesNearMemoryBudget.enabled)
+    {
+        checkMemoryBudget(currentTime);
+    }
 }
 
 void Renderer11::updateHistograms()
@@ -3823,12 +3892,63 @@ void Renderer11::updateHistograms()
     }
 }
 
-void Renderer11::onBufferCreate(const Buffer11 *created)
+void Renderer11::checkMemoryBudget(double currentTime)
+{
+    // Querying the budget goes to the kernel, so it is done at most once per second.
+    const double kMemoryBudgetCheckInterval = 1.0;
+    if (currentTime - mLastMemoryBudgetCheckTime < kMemoryBudgetCheckInterval)
+    {
+        return;
+    }
+    mLastMemoryBudgetCheckTime = currentTime;
+
+    // DXGI 1.4 is required to query the budget.
+    IDXGIAdapter3 *dxgiAdapter3 = d3d11::DynamicCastComObject<IDXGIAdapter3>(mDxgiAdapter);
+    if (!dxgiAdapter3)
+    {
+        return;
+    }
+
+    DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo = {};
+    HRESULT result =
+        dxgiAdapter3->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &memoryInfo);
+    SafeRelease(dxgiAdapter3);
+    if (FAILED(result))
+    {
+        return;
+    }
+
+    // The OS starts demoting the resources of the process to system memory once the usage goes
+    // over the budget, so the cached resources are released a bit before that.
+    if (memoryInfo.CurrentUsage > memoryInfo.Budget - memoryInfo.Budget / 10)
+    {
+        INFO() << "Video memory usage of " << memoryInfo.CurrentUsage
+               << " bytes is close to the budget of " << memoryInfo.Budget
+               << " bytes, releasing cached resources. ANGLE allocated "
+               << mResourceManager11.getTotalAllocatedDeviceMemory() << " bytes.";
+        releaseCachedResources();
+    }
+}
+
+void Renderer11::releaseCachedResources()
+{
+    for (Buffer11 *buffer : mAliveBuffers)
+    {
+        buffer->releaseStagingStorage();
+    }
+
+    if (mBlit)
+    {
+        mBlit->releaseScratchResources();
+    }
+}
+
+void Renderer11::onBufferCreate(Buffer11 *created)
 {
     mAliveBuffers.insert(created);
 }
 
-void Renderer11::onBufferDelete(const Buffer11 *deleted)
+void Renderer11::onBufferDelete(Buffer11 *deleted)
 {
     mAliveBuffers.erase(deleted);
 }
@@ -4245,6 +4365,60 @@ angle::Result Renderer11::mapResource(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result Renderer11::copyToBufferThroughUploadRing(const gl::Context *context,
+                                                        const d3d11::Buffer &destBuffer,
+                                                        size_t destOffset,
+                                                        const uint8_t *data,
+                                                        size_t size)
+{
+    ASSERT(size > 0 && size <= kMaxBufferUploadRingCopySize);
+
+    D3D11_MAP mapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (!mBufferUploadRing.valid())
+    {
+        D3D11_BUFFER_DESC bufferDesc;
+        bufferDesc.ByteWidth           = static_cast<UINT>(kBufferUploadRingSize);
+        bufferDesc.Usage               = D3D11_USAGE_DYNAMIC;
+        bufferDesc.BindFlags           = D3D11_BIND_VERTEX_BUFFER;
+        bufferDesc.CPUAccessFlags      = D3D11_CPU_ACCESS_WRITE;
+        bufferDesc.MiscFlags           = 0;
+        bufferDesc.StructureByteStride = 0;
+
+        ANGLE_TRY(allocateResource(GetImplAs<Context11>(context), bufferDesc, &mBufferUploadRing));
+        mBufferUploadRing.setDebugName("Renderer11::BufferUploadRing");
+
+        mapType                 = D3D11_MAP_WRITE_DISCARD;
+        mBufferUploadRingOffset = 0;
+    }
+    else if (mBufferUploadRingOffset + size > kBufferUploadRingSize)
+    {
+        // Discarding gives the ring new memory, so the copies the GPU hasn't done yet still read
+        // the data they were recorded with.
+        mapType                 = D3D11_MAP_WRITE_DISCARD;
+        mBufferUploadRingOffset = 0;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mappedResource;
+    ANGLE_TRY(mapResource(context, mBufferUploadRing.get(), 0, mapType, 0, &mappedResource));
+    memcpy(static_cast<uint8_t *>(mappedResource.pData) + mBufferUploadRingOffset, data, size);
+    mDeviceContext->Unmap(mBufferUploadRing.get(), 0);
+
+    D3D11_BOX srcBox;
+    srcBox.left   = static_cast<unsigned int>(mBufferUploadRingOffset);
+    srcBox.right  = static_cast<unsigned int>(mBufferUploadRingOffset + size);
+    srcBox.top    = 0;
+    srcBox.bottom = 1;
+    srcBox.front  = 0;
+    srcBox.back   = 1;
+
+    mDeviceContext->CopySubresourceRegion(destBuffer.get(), 0,
+                                          static_cast<unsigned int>(destOffset), 0, 0,
+                                          mBufferUploadRing.get(), 0, &srcBox);
+
+    mBufferUploadRingOffset += size;
+    return angle::Result::Continue;
+}
+
 angle::Result Renderer11::markRawBufferUsage(const gl::Context *context)
 {
     const gl::State &glState   = context->getState();
@@ -35,6 +35,7 @@ class Blit11;
 class Buffer11;
 class Clear11;
 class Context11;
+class IndexConversion11;
 class IndexDataManager;
 struct PackPixelsParams;
 class PixelTransfer11;
@@ -307,6 +308,7 @@ class Renderer11 : public RendererD3D
 
     Blit11 *getBlitter() { return mBlit; }
     Clear11 *getClearer() { return mClear; }
+    IndexConversion11 *getIndexConversion() { return mIndexConversion; }
     gl::DebugAnnotator *getAnnotator();
 
     // Buffer-to-texture and Texture-to-buffer copies
@@ -366,8 +368,14 @@ class Renderer11 : public RendererD3D
     StateManager11 *getStateManager() { return &mStateManager; }
 
     void onSwap();
-    void onBufferCreate(const Buffer11 *created);
-    void onBufferDelete(const Buffer11 *deleted);
+    void onBufferCreate(Buffer11 *created);
+    void onBufferDelete(Buffer11 *deleted);
+
+    const ResourceManager11 &getResourceManager() const { return mResourceManager11; }
+
+    // Releases the resources that are only kept to speed up later operations, such as buffer
+    // staging copies and the blit scratch textures.
+    void releaseCachedResources();
 
     DeviceImpl *createEGLDevice() override;
 
@@ -471,6 +479,15 @@ class Renderer11 : public RendererD3D
                               UINT mapFlags,
                               D3D11_MAPPED_SUBRESOURCE *mappedResource);
 
+    // Copies data to a buffer through a dynamic upload ring shared by the whole device, so that
+    // updating a buffer doesn't have to wait for the GPU to be done with it or with a staging copy.
+    static constexpr size_t kMaxBufferUploadRingCopySize = 64 * 1024;
+    angle::Result copyToBufferThroughUploadRing(const gl::Context *context,
+                                                const d3d11::Buffer &destBuffer,
+                                                size_t destOffset,
+                                                const uint8_t *data,
+                                                size_t size);
+
     angle::Result getIncompleteTexture(const gl::Context *context,
                                        gl::TextureType type,
                                        gl::Texture **textureOut) override;
@@ -511,6 +528,7 @@ class Renderer11 : public RendererD3D
     void populateRenderer11DeviceCaps();
 
     void updateHistograms();
+    void checkMemoryBudget(double currentTime);
 
     angle::Result copyImageInternal(const gl::Context *context,
                                     const gl::Framebuffer *framebuffer,
@@ -563,6 +581,7 @@ class Renderer11 : public RendererD3D
     // Texture copy resources
     Blit11 *mBlit;
     PixelTransfer11 *mPixelTransfer;
+    IndexConversion11 *mIndexConversion;
 
     // Masked clear resources
     Clear11 *mClear;
@@ -573,10 +592,15 @@ class Renderer11 : public RendererD3D
     // Sync query
     d3d11::Query mSyncQuery;
 
+    // Buffer upload ring
+    d3d11::Buffer mBufferUploadRing;
+    size_t mBufferUploadRingOffset;
+
     // Created objects state tracking
-    std::set<const Buffer11 *> mAliveBuffers;
+    std::set<Buffer11 *> mAliveBuffers;
 
     double mLastHistogramUpdateTime;
+    double mLastMemoryBudgetCheckTime;
 
     angle::ComPtr<ID3D12Device> mDevice12;
     angle::ComPtr<ID3D12CommandQueue> mCommandQueue;
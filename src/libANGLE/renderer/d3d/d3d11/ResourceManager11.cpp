@@ -551,6 +551,16 @@ void ResourceManager11::setAllocationsInitialized(bool initialize)
     mInitializeAllocations = initialize;
 }
 
+uint64_t ResourceManager11::getTotalAllocatedDeviceMemory() const
+{
+    uint64_t memorySize = 0;
+    for (const std::atomic_uint64_t &typeMemorySize : mAllocatedResourceDeviceMemory)
+    {
+        memorySize += typeMemorySize;
+    }
+    return memorySize;
+}
+
 #define ANGLE_INSTANTIATE_OP(NAME, RESTYPE, D3D11TYPE, DESCTYPE, INITDATATYPE) \
                                                                                \
     template angle::Result ResourceManager11::allocate(                        \
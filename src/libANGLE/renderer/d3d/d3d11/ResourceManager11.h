@@ -333,6 +333,16 @@ class ResourceManager11 final : angle::NonCopyable
 
     void setAllocationsInitialized(bool initialize);
 
+    size_t getAllocatedResourceCount(ResourceType resourceType) const
+    {
+        return mAllocatedResourceCounts[ResourceTypeIndex(resourceType)];
+    }
+    uint64_t getAllocatedDeviceMemory(ResourceType resourceType) const
+    {
+        return mAllocatedResourceDeviceMemory[ResourceTypeIndex(resourceType)];
+    }
+    uint64_t getTotalAllocatedDeviceMemory() const;
+
   private:
     void incrResource(ResourceType resourceType, uint64_t memorySize);
     void decrResource(ResourceType resourceType, uint64_t memorySize);
@@ -22,6 +22,7 @@
 #include "libANGLE/renderer/d3d/d3d11/Context11.h"
 #include "libANGLE/renderer/d3d/d3d11/Framebuffer11.h"
 #include "libANGLE/renderer/d3d/d3d11/IndexBuffer11.h"
+#include "libANGLE/renderer/d3d/d3d11/IndexConversion11.h"
 #include "libANGLE/renderer/d3d/d3d11/RenderTarget11.h"
 #include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
 #include "libANGLE/renderer/d3d/d3d11/ShaderExecutable11.h"
@@ -237,6 +238,20 @@ bool CullsEverything(const gl::State &glState)
     return (glState.getRasterizerState().cullFace &&
             glState.getRasterizerState().cullMode == gl::CullFaceMode::FrontAndBack);
 }
+
+// Translating indices on the CPU reads them back if they are only up to date in GPU memory, unless
+// the static translated copy can be used.
+bool ShouldConvertIndicesOnGPU(Buffer11 *buffer, gl::DrawElementsType destElementType)
+{
+    if (buffer->isLatestDataInSystemMemory())
+    {
+        return false;
+    }
+
+    StaticIndexBufferInterface *staticBuffer = buffer->getStaticIndexBuffer();
+    return staticBuffer == nullptr || staticBuffer->getBufferSize() == 0 ||
+           staticBuffer->getIndexType() != destElementType;
+}
 }  // anonymous namespace
 
 // StateManager11::ViewCache Implementation.
@@ -675,6 +690,7 @@ StateManager11::StateManager11(Renderer11 *renderer)
       mCurStencilRef(0),
       mCurStencilBackRef(0),
       mCurStencilSize(0),
+      mCurSimpleStencilRef(0),
       mCurScissorEnabled(false),
       mCurScissorRect(),
       mCurViewport(),
@@ -1254,6 +1270,7 @@ angle::Result StateManager11::syncBlendState(const gl::Context *context,
     blendColors[3]       = blendColor.alpha;
 
     mRenderer->getDeviceContext()->OMSetBlendState(dxBlendState->get(), blendColors, sampleMask);
+    mCurSimpleBlendState.reset();
 
     mCurBlendStateExt         = blendStateExt;
     mCurBlendColor            = blendColor;
@@ -1325,6 +1342,7 @@ angle::Result StateManager11::syncDepthStencilState(const gl::Context *context)
     UINT dxStencilRef = static_cast<UINT>(gl::clamp(mCurStencilRef, 0, 0xFF));
 
     mRenderer->getDeviceContext()->OMSetDepthStencilState(d3dState->get(), dxStencilRef);
+    mCurSimpleDepthStencilState.reset();
 
     return angle::Result::Continue;
 }
@@ -1366,6 +1384,7 @@ angle::Result StateManager11::syncRasterizerState(const gl::Context *context,
     }
 
     mRenderer->getDeviceContext()->RSSetState(dxRasterState);
+    mCurSimpleRasterizerState.reset();
 
     mCurRasterState = rasterState;
 
@@ -1486,6 +1505,7 @@ void StateManager11::syncViewport(const gl::Context *context)
     dxViewport.MaxDepth = actualZFar;
 
     mRenderer->getDeviceContext()->RSSetViewports(1, &dxViewport);
+    mCurSimpleViewportSize.reset();
 
     mCurViewport = viewport;
     mCurNear     = actualZNear;
@@ -1941,6 +1961,7 @@ angle::Result StateManager11::ensureInitialized(const gl::Context *context)
 void StateManager11::deinitialize()
 {
     mCurrentValueAttribs.clear();
+    mInputLayoutCache.logCacheStats();
     mInputLayoutCache.clear();
     mVertexDataManager.deinitialize();
     mIndexDataManager.deinitialize();
@@ -1952,6 +1973,12 @@ void StateManager11::deinitialize()
 
     mPointSpriteVertexBuffer.reset();
     mPointSpriteIndexBuffer.reset();
+
+    // The device context is cleared when the device is released.
+    mCurSimpleBlendState.reset();
+    mCurSimpleDepthStencilState.reset();
+    mCurSimpleRasterizerState.reset();
+    mCurSimpleViewportSize.reset();
 }
 
 // Applies the render target surface, depth stencil surface, viewport rectangle and
@@ -2447,6 +2474,31 @@ void StateManager11::setComputeShader(const d3d11::ComputeShader *shader)
     }
 }
 
+void StateManager11::setComputeConstantBuffer(unsigned int slot, const d3d11::Buffer *buffer)
+{
+    // Only the slot of the default uniform block is tracked outside of the uniform buffer sync.
+    ASSERT(slot == d3d11::RESERVED_CONSTANT_BUFFER_SLOT_DEFAULT_UNIFORM_BLOCK);
+    ASSERT(buffer);
+
+    if (mCurrentComputeConstantBuffer != buffer->getSerial())
+    {
+        mRenderer->getDeviceContext()->CSSetConstantBuffers(slot, 1, buffer->getPointer());
+        mCurrentComputeConstantBuffer = buffer->getSerial();
+        invalidateProgramUniforms();
+    }
+}
+
+void StateManager11::setComputeUnorderedAccessView(UINT resourceSlot,
+                                                   const d3d11::UnorderedAccessView *uav)
+{
+    setUnorderedAccessViewInternal(gl::ShaderType::Compute, resourceSlot, uav);
+
+    // The slot may be used by an image, an atomic counter buffer or a shader storage buffer.
+    mInternalDirtyBits.set(DIRTY_BIT_COMPUTE_SRVUAV_STATE);
+    invalidateProgramAtomicCounterBuffers();
+    invalidateProgramShaderStorageBuffers();
+}
+
 void StateManager11::setVertexConstantBuffer(unsigned int slot, const d3d11::Buffer *buffer)
 {
     ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
@@ -2508,49 +2560,44 @@ void StateManager11::setPixelConstantBuffer(unsigned int slot, const d3d11::Buff
 void StateManager11::setDepthStencilState(const d3d11::DepthStencilState *depthStencilState,
                                           UINT stencilRef)
 {
-    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
-
-    if (depthStencilState)
-    {
-        deviceContext->OMSetDepthStencilState(depthStencilState->get(), stencilRef);
-    }
-    else
+    ID3D11DepthStencilState *d3dState = depthStencilState ? depthStencilState->get() : nullptr;
+    if (mCurSimpleDepthStencilState == d3dState && mCurSimpleStencilRef == stencilRef)
     {
-        deviceContext->OMSetDepthStencilState(nullptr, stencilRef);
+        return;
     }
 
+    mRenderer->getDeviceContext()->OMSetDepthStencilState(d3dState, stencilRef);
+    mCurSimpleDepthStencilState = d3dState;
+    mCurSimpleStencilRef        = stencilRef;
+
     mInternalDirtyBits.set(DIRTY_BIT_DEPTH_STENCIL_STATE);
 }
 
 void StateManager11::setSimpleBlendState(const d3d11::BlendState *blendState)
 {
-    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
-
-    if (blendState)
-    {
-        deviceContext->OMSetBlendState(blendState->get(), nullptr, 0xFFFFFFFF);
-    }
-    else
+    ID3D11BlendState *d3dState = blendState ? blendState->get() : nullptr;
+    if (mCurSimpleBlendState == d3dState)
     {
-        deviceContext->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFF);
+        return;
     }
 
+    mRenderer->getDeviceContext()->OMSetBlendState(d3dState, nullptr, 0xFFFFFFFF);
+    mCurSimpleBlendState = d3dState;
+
     mInternalDirtyBits.set(DIRTY_BIT_BLEND_STATE);
 }
 
 void StateManager11::setRasterizerState(const d3d11::RasterizerState *rasterizerState)
 {
-    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
-
-    if (rasterizerState)
+    ID3D11RasterizerState *d3dState = rasterizerState ? rasterizerState->get() : nullptr;
+    if (mCurSimpleRasterizerState == d3dState)
     {
-        deviceContext->RSSetState(rasterizerState->get());
-    }
-    else
-    {
-        deviceContext->RSSetState(nullptr);
+        return;
     }
 
+    mRenderer->getDeviceContext()->RSSetState(d3dState);
+    mCurSimpleRasterizerState = d3dState;
+
     mInternalDirtyBits.set(DIRTY_BIT_RASTERIZER_STATE);
 }
 
@@ -2561,6 +2608,12 @@ void StateManager11::setSimpleViewport(const gl::Extents &extents)
 
 void StateManager11::setSimpleViewport(int width, int height)
 {
+    gl::Extents viewportSize(width, height, 1);
+    if (mCurSimpleViewportSize == viewportSize)
+    {
+        return;
+    }
+
     D3D11_VIEWPORT viewport;
     viewport.TopLeftX = 0;
     viewport.TopLeftY = 0;
@@ -2570,6 +2623,8 @@ void StateManager11::setSimpleViewport(int width, int height)
     viewport.MaxDepth = 1.0f;
 
     mRenderer->getDeviceContext()->RSSetViewports(1, &viewport);
+    mCurSimpleViewportSize = viewportSize;
+
     mInternalDirtyBits.set(DIRTY_BIT_VIEWPORT_STATE);
 }
 
@@ -3184,25 +3239,59 @@ angle::Result StateManager11::applyIndexBuffer(const gl::Context *context,
     gl::Buffer *elementArrayBuffer       = mVertexArray11->getState().getElementArrayBuffer();
 
     TranslatedIndexData indexInfo;
-    ANGLE_TRY(mIndexDataManager.prepareIndexData(context, indexType, destElementType, indexCount,
-                                                 elementArrayBuffer, indices, &indexInfo));
-
-    ID3D11Buffer *buffer     = nullptr;
-    DXGI_FORMAT bufferFormat = (indexInfo.indexType == gl::DrawElementsType::UnsignedInt)
-                                   ? DXGI_FORMAT_R32_UINT
-                                   : DXGI_FORMAT_R16_UINT;
-
-    if (indexInfo.storage)
-    {
-        Buffer11 *storage = GetAs<Buffer11>(indexInfo.storage);
-        ANGLE_TRY(storage->getBuffer(context, BUFFER_USAGE_INDEX, &buffer));
+    ID3D11Buffer *buffer = nullptr;
+
+    Buffer11 *elementArrayBuffer11 =
+        elementArrayBuffer ? GetImplAs<Buffer11>(elementArrayBuffer) : nullptr;
+    unsigned int offset = static_cast<unsigned int>(reinterpret_cast<uintptr_t>(indices));
+    IndexConversion11 *indexConversion = mRenderer->getIndexConversion();
+
+    if (elementArrayBuffer11 && indexType != destElementType &&
+        mRenderer->getFeatures().convertIndexBuffersOnGPU.enabled &&
+        ShouldConvertIndicesOnGPU(elementArrayBuffer11, destElementType) &&
+        indexConversion->canConvertIndexBuffer(*elementArrayBuffer11, indexType, destElementType,
+                                               indexCount, offset))
+    {
+        const d3d11::Buffer *convertedBuffer = nullptr;
+        ANGLE_TRY(indexConversion->convertIndexBuffer(
+            context, elementArrayBuffer11, indexType, destElementType, indexCount, offset,
+            context->getState().isPrimitiveRestartEnabled(), &convertedBuffer));
+        buffer = convertedBuffer->get();
+
+        indexInfo.startIndex                     = 0;
+        indexInfo.startOffset                    = 0;
+        indexInfo.indexBuffer                    = nullptr;
+        indexInfo.storage                        = nullptr;
+        indexInfo.indexType                      = destElementType;
+        indexInfo.serial                         = 0;
+        indexInfo.srcIndexData.srcBuffer         = elementArrayBuffer11;
+        indexInfo.srcIndexData.srcIndices        = indices;
+        indexInfo.srcIndexData.srcCount          = static_cast<unsigned int>(indexCount);
+        indexInfo.srcIndexData.srcIndexType      = indexType;
+        indexInfo.srcIndexData.srcIndicesChanged = false;
     }
     else
     {
-        IndexBuffer11 *indexBuffer = GetAs<IndexBuffer11>(indexInfo.indexBuffer);
-        buffer                     = indexBuffer->getBuffer().get();
+        ANGLE_TRY(mIndexDataManager.prepareIndexData(context, indexType, destElementType,
+                                                     indexCount, elementArrayBuffer, indices,
+                                                     &indexInfo));
+
+        if (indexInfo.storage)
+        {
+            Buffer11 *storage = GetAs<Buffer11>(indexInfo.storage);
+            ANGLE_TRY(storage->getBuffer(context, BUFFER_USAGE_INDEX, &buffer));
+        }
+        else
+        {
+            IndexBuffer11 *indexBuffer = GetAs<IndexBuffer11>(indexInfo.indexBuffer);
+            buffer                     = indexBuffer->getBuffer().get();
+        }
     }
 
+    DXGI_FORMAT bufferFormat = (indexInfo.indexType == gl::DrawElementsType::UnsignedInt)
+                                   ? DXGI_FORMAT_R32_UINT
+                                   : DXGI_FORMAT_R16_UINT;
+
     // Track dirty indices in the index range cache.
     indexInfo.srcIndexData.srcIndicesChanged =
         syncIndexBuffer(buffer, bufferFormat, indexInfo.startOffset);
@@ -3285,9 +3374,8 @@ angle::Result StateManager11::generateSwizzle(const gl::Context *context, gl::Te
 
     if (texStorage)
     {
-        TextureStorage11 *storage11          = GetAs<TextureStorage11>(texStorage);
-        const gl::TextureState &textureState = texture->getTextureState();
-        ANGLE_TRY(storage11->generateSwizzles(context, textureState.getSwizzleState()));
+        TextureStorage11 *storage11 = GetAs<TextureStorage11>(texStorage);
+        ANGLE_TRY(storage11->generateSwizzles(context, texture->getTextureState()));
     }
 
     return angle::Result::Continue;
@@ -258,6 +258,10 @@ class StateManager11 final : angle::NonCopyable
     void setGeometryShader(const d3d11::GeometryShader *shader);
     void setPixelShader(const d3d11::PixelShader *shader);
     void setComputeShader(const d3d11::ComputeShader *shader);
+    // Used by internal compute passes.  The program's compute resources are bound again before its
+    // next dispatch.
+    void setComputeConstantBuffer(unsigned int slot, const d3d11::Buffer *buffer);
+    void setComputeUnorderedAccessView(UINT resourceSlot, const d3d11::UnorderedAccessView *uav);
     void setVertexConstantBuffer(unsigned int slot, const d3d11::Buffer *buffer);
     void setPixelConstantBuffer(unsigned int slot, const d3d11::Buffer *buffer);
     void setDepthStencilState(const d3d11::DepthStencilState *depthStencilState, UINT stencilRef);
@@ -483,6 +487,15 @@ class StateManager11 final : angle::NonCopyable
     // Currently applied rasterizer state
     gl::RasterizerState mCurRasterState;
 
+    // The states applied by the simple setters used by internal passes such as Clear11, so that
+    // back to back passes don't set them again. Reset when the GL state is applied. The objects
+    // are bound to the device context, so they are alive and their addresses are unique.
+    Optional<ID3D11BlendState *> mCurSimpleBlendState;
+    Optional<ID3D11DepthStencilState *> mCurSimpleDepthStencilState;
+    UINT mCurSimpleStencilRef;
+    Optional<ID3D11RasterizerState *> mCurSimpleRasterizerState;
+    Optional<gl::Extents> mCurSimpleViewportSize;
+
     // Currently applied scissor rectangle state
     bool mCurScissorEnabled;
     gl::Rectangle mCurScissorRect;
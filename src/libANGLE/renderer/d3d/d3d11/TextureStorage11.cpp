@@ -245,7 +245,7 @@ angle::Result TextureStorage11::getSRVForSampler(const gl::Context *context,
 
     if (swizzleRequired)
     {
-        verifySwizzleExists(textureState.getSwizzleState());
+        verifySwizzleExists(textureState.getSwizzleState(), effectiveBaseLevel, mipLevels);
     }
 
     // We drop the stencil when sampling from the SRV if three conditions hold:
@@ -462,10 +462,18 @@ const d3d11::Format &TextureStorage11::getFormatSet() const
 }
 
 angle::Result TextureStorage11::generateSwizzles(const gl::Context *context,
-                                                 const gl::SwizzleState &swizzleTarget)
+                                                 const gl::TextureState &textureState)
 {
     ANGLE_TRY(resolveTexture(context));
-    for (int level = 0; level < getLevelCount(); level++)
+
+    // Only the levels the texture can currently be sampled from are swizzled.  The others keep
+    // their out of date swizzle until a draw samples them, so updating their contents while
+    // streaming a texture in doesn't cost a blit per update.
+    const gl::SwizzleState &swizzleTarget = textureState.getSwizzleState();
+    const int baseLevel                   = static_cast<int>(textureState.getEffectiveBaseLevel());
+    const int maxLevel =
+        std::min(static_cast<int>(textureState.getEffectiveMaxLevel()), getLevelCount() - 1);
+    for (int level = baseLevel; level <= maxLevel; level++)
     {
         // Check if the swizzle for this level is out of date
         if (mSwizzleCache[level] != swizzleTarget)
@@ -680,9 +688,11 @@ angle::Result TextureStorage11::generateMipmap(const gl::Context *context,
                                 false);
 }
 
-void TextureStorage11::verifySwizzleExists(const gl::SwizzleState &swizzleState)
+void TextureStorage11::verifySwizzleExists(const gl::SwizzleState &swizzleState,
+                                           GLuint baseLevel,
+                                           GLuint levelCount)
 {
-    for (unsigned int level = 0; level < mMipLevels; level++)
+    for (GLuint level = baseLevel; level < baseLevel + levelCount; level++)
     {
         ASSERT(mSwizzleCache[level] == swizzleState);
     }
@@ -82,7 +82,7 @@ class TextureStorage11 : public TextureStorage
                                GLint maxLevel,
                                const d3d11::SharedSRV **outSRV);
     angle::Result generateSwizzles(const gl::Context *context,
-                                   const gl::SwizzleState &swizzleTarget);
+                                   const gl::TextureState &textureState);
     void markLevelDirty(int mipLevel);
     void markDirty();
 
@@ -191,7 +191,9 @@ class TextureStorage11 : public TextureStorage
                                             const TextureHelper11 &texture,
                                             d3d11::SharedUAV *outUAV)   = 0;
 
-    void verifySwizzleExists(const gl::SwizzleState &swizzleState);
+    void verifySwizzleExists(const gl::SwizzleState &swizzleState,
+                             GLuint baseLevel,
+                             GLuint levelCount);
 
     // Clear all cached non-swizzle SRVs and invalidate the swizzle cache.
     void clearSRVCache();
@@ -2482,6 +2482,11 @@ void InitializeFeatures(const Renderer11DeviceCaps &deviceCaps,
     ANGLE_FEATURE_CONDITION(features, allowTranslateUniformBlockToStructuredBuffer,
                             IsWin10OrGreater());
 
+    ANGLE_FEATURE_CONDITION(features, preCompileVertexInputLayoutVariants, true);
+    ANGLE_FEATURE_CONDITION(features, convertIndexBuffersOnGPU,
+                            deviceCaps.featureLevel >= D3D_FEATURE_LEVEL_11_0);
+    ANGLE_FEATURE_CONDITION(features, releaseCachedResourcesNearMemoryBudget, true);
+
     // Call platform hooks for testing overrides.
     auto *platform = ANGLEPlatformCurrent();
     platform->overrideWorkaroundsD3D(platform, features);
@@ -2718,6 +2718,20 @@ angle::Result Renderer9::compileToExecutable(d3d::Context *context,
     configs.push_back(CompileConfig(flags | D3DCOMPILE_AVOID_FLOW_CONTROL, "avoid flow control"));
     configs.push_back(CompileConfig(flags | D3DCOMPILE_PREFER_FLOW_CONTROL, "prefer flow control"));
 
+    egl::BlobCache::Key binaryCacheKey;
+    const bool useBinaryCache = isShaderBinaryCachingEnabled();
+    if (useBinaryCache)
+    {
+        mCompiler.computeBinaryCacheKey(shaderHLSL, profile, configs, nullptr, &binaryCacheKey);
+
+        angle::MemoryBuffer cachedBinary;
+        if (getCachedShaderBinary(binaryCacheKey, &cachedBinary))
+        {
+            return loadExecutable(context, cachedBinary.data(), cachedBinary.size(), type,
+                                  streamOutVaryings, separatedOutputBuffers, outExectuable);
+        }
+    }
+
     ID3DBlob *binary = nullptr;
     std::string debugInfo;
     angle::Result error = mCompiler.compileToBinary(context, infoLog, shaderHLSL, profile, configs,
@@ -2733,9 +2747,14 @@ angle::Result Renderer9::compileToExecutable(d3d::Context *context,
         return angle::Result::Continue;
     }
 
-    error = loadExecutable(context, reinterpret_cast<const uint8_t *>(binary->GetBufferPointer()),
-                           binary->GetBufferSize(), type, streamOutVaryings, separatedOutputBuffers,
-                           outExectuable);
+    const uint8_t *binaryData = reinterpret_cast<const uint8_t *>(binary->GetBufferPointer());
+    if (useBinaryCache)
+    {
+        putCachedShaderBinary(binaryCacheKey, binaryData, binary->GetBufferSize());
+    }
+
+    error = loadExecutable(context, binaryData, binary->GetBufferSize(), type, streamOutVaryings,
+                           separatedOutputBuffers, outExectuable);
 
     SafeRelease(binary);
     ANGLE_TRY(error);
@@ -19,14 +19,8 @@
 namespace rx
 {
 
-VertexDeclarationCache::VertexDeclarationCache() : mMaxLru(0)
+VertexDeclarationCache::VertexDeclarationCache() : mVertexDeclCache(kMaxVertexDeclarations)
 {
-    for (int i = 0; i < NUM_VERTEX_DECL_CACHE_ENTRIES; i++)
-    {
-        mVertexDeclCache[i].vertexDeclaration = nullptr;
-        mVertexDeclCache[i].lruCount          = 0;
-    }
-
     for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
     {
         mAppliedVBs[i].serial = 0;
@@ -38,9 +32,9 @@ VertexDeclarationCache::VertexDeclarationCache() : mMaxLru(0)
 
 VertexDeclarationCache::~VertexDeclarationCache()
 {
-    for (int i = 0; i < NUM_VERTEX_DECL_CACHE_ENTRIES; i++)
+    for (auto &entry : mVertexDeclCache)
     {
-        SafeRelease(mVertexDeclCache[i].vertexDeclaration);
+        SafeRelease(entry.second);
     }
 }
 
@@ -201,49 +195,36 @@ angle::Result VertexDeclarationCache::applyDeclaration(
     static const D3DVERTEXELEMENT9 end = D3DDECL_END();
     *(element++)                       = end;
 
-    for (int i = 0; i < NUM_VERTEX_DECL_CACHE_ENTRIES; i++)
+    const std::string key(reinterpret_cast<const char *>(elements),
+                          (element - elements) * sizeof(D3DVERTEXELEMENT9));
+    auto cacheIter = mVertexDeclCache.Get(key);
+    if (cacheIter != mVertexDeclCache.end())
     {
-        VertexDeclCacheEntry *entry = &mVertexDeclCache[i];
-        if (memcmp(entry->cachedElements, elements,
-                   (element - elements) * sizeof(D3DVERTEXELEMENT9)) == 0 &&
-            entry->vertexDeclaration)
+        if (cacheIter->second != mLastSetVDecl)
         {
-            entry->lruCount = ++mMaxLru;
-            if (entry->vertexDeclaration != mLastSetVDecl)
-            {
-                device->SetVertexDeclaration(entry->vertexDeclaration);
-                mLastSetVDecl = entry->vertexDeclaration;
-            }
-
-            return angle::Result::Continue;
+            device->SetVertexDeclaration(cacheIter->second);
+            mLastSetVDecl = cacheIter->second;
         }
-    }
-
-    VertexDeclCacheEntry *lastCache = mVertexDeclCache;
 
-    for (int i = 0; i < NUM_VERTEX_DECL_CACHE_ENTRIES; i++)
-    {
-        if (mVertexDeclCache[i].lruCount < lastCache->lruCount)
-        {
-            lastCache = &mVertexDeclCache[i];
-        }
+        return angle::Result::Continue;
     }
 
-    if (lastCache->vertexDeclaration != nullptr)
-    {
-        SafeRelease(lastCache->vertexDeclaration);
-        // mLastSetVDecl is set to the replacement, so we don't have to worry
-        // about it.
-    }
+    IDirect3DVertexDeclaration9 *vertexDeclaration = nullptr;
 
-    memcpy(lastCache->cachedElements, elements, (element - elements) * sizeof(D3DVERTEXELEMENT9));
-    HRESULT result = device->CreateVertexDeclaration(elements, &lastCache->vertexDeclaration);
+    HRESULT result = device->CreateVertexDeclaration(elements, &vertexDeclaration);
     ANGLE_TRY_HR(GetImplAs<Context9>(context), result,
                  "Failed to create internal vertex declaration");
 
-    device->SetVertexDeclaration(lastCache->vertexDeclaration);
-    mLastSetVDecl       = lastCache->vertexDeclaration;
-    lastCache->lruCount = ++mMaxLru;
+    if (mVertexDeclCache.size() >= mVertexDeclCache.max_size())
+    {
+        // mLastSetVDecl is set to the replacement, so we don't have to worry about it.
+        SafeRelease(mVertexDeclCache.rbegin()->second);
+        mVertexDeclCache.ShrinkToSize(mVertexDeclCache.size() - 1);
+    }
+    mVertexDeclCache.Put(key, vertexDeclaration);
+
+    device->SetVertexDeclaration(vertexDeclaration);
+    mLastSetVDecl = vertexDeclaration;
 
     return angle::Result::Continue;
 }
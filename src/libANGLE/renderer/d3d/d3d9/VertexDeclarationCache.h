@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_D3D_D3D9_VERTEXDECLARATIONCACHE_H_
 
 #include "libANGLE/Error.h"
+#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/renderer/d3d/VertexDataManager.h"
 
 namespace gl
@@ -37,12 +38,8 @@ class VertexDeclarationCache
     void markStateDirty();
 
   private:
-    UINT mMaxLru;
-
-    enum
-    {
-        NUM_VERTEX_DECL_CACHE_ENTRIES = 32
-    };
+    // The least recently used declarations are released past this count.
+    static constexpr size_t kMaxVertexDeclarations = 256;
 
     struct VBData
     {
@@ -55,12 +52,10 @@ class VertexDeclarationCache
     IDirect3DVertexDeclaration9 *mLastSetVDecl;
     bool mInstancingEnabled;
 
-    struct VertexDeclCacheEntry
-    {
-        D3DVERTEXELEMENT9 cachedElements[gl::MAX_VERTEX_ATTRIBS + 1];
-        UINT lruCount;
-        IDirect3DVertexDeclaration9 *vertexDeclaration;
-    } mVertexDeclCache[NUM_VERTEX_DECL_CACHE_ENTRIES];
+    // Keyed by the bytes of the vertex elements, up to and including D3DDECL_END.
+    using VertexDeclarationMap =
+        angle::base::HashingMRUCache<std::string, IDirect3DVertexDeclaration9 *>;
+    VertexDeclarationMap mVertexDeclCache;
 };
 
 }  // namespace rx
@@ -221,6 +221,7 @@ BlitGL::BlitGL(const FunctionsGL *functions,
       mFeatures(features),
       mStateManager(stateManager),
       mScratchFBO(0),
+      mScratchReadFBO(0),
       mVAO(0),
       mVertexBuffer(0)
 {
@@ -256,6 +257,12 @@ BlitGL::~BlitGL()
         mScratchFBO = 0;
     }
 
+    if (mScratchReadFBO != 0)
+    {
+        mStateManager->deleteFramebuffer(mScratchReadFBO);
+        mScratchReadFBO = 0;
+    }
+
     if (mOwnsVAOState)
     {
         mStateManager->deleteVertexArray(mVAO);
@@ -848,6 +855,65 @@ angle::Result BlitGL::copyTexSubImage(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result BlitGL::copySubTextureWithBlitFramebuffer(const gl::Context *context,
+                                                        TextureGL *source,
+                                                        size_t sourceLevel,
+                                                        TextureGL *dest,
+                                                        gl::TextureTarget destTarget,
+                                                        size_t destLevel,
+                                                        const gl::Rectangle &sourceArea,
+                                                        const gl::Offset &destOffset,
+                                                        bool unpackFlipY,
+                                                        bool *copySucceededOut)
+{
+    ASSERT(mFunctions->blitFramebuffer != nullptr);
+    ANGLE_TRY(initializeResources(context));
+
+    mStateManager->bindFramebuffer(GL_READ_FRAMEBUFFER, mScratchReadFBO);
+    ANGLE_GL_TRY(context,
+                 mFunctions->framebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                                                  ToGLenum(source->getType()),
+                                                  source->getTextureID(),
+                                                  static_cast<GLint>(sourceLevel)));
+    GLenum readStatus =
+        ANGLE_GL_TRY(context, mFunctions->checkFramebufferStatus(GL_READ_FRAMEBUFFER));
+
+    mStateManager->bindFramebuffer(GL_DRAW_FRAMEBUFFER, mScratchFBO);
+    ANGLE_GL_TRY(context, mFunctions->framebufferTexture2D(
+                              GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, ToGLenum(destTarget),
+                              dest->getTextureID(), static_cast<GLint>(destLevel)));
+    GLenum drawStatus =
+        ANGLE_GL_TRY(context, mFunctions->checkFramebufferStatus(GL_DRAW_FRAMEBUFFER));
+
+    if (readStatus != GL_FRAMEBUFFER_COMPLETE || drawStatus != GL_FRAMEBUFFER_COMPLETE)
+    {
+        *copySucceededOut = false;
+        return angle::Result::Continue;
+    }
+
+    // Blits are affected by the scissor test.
+    ScopedGLState scopedState;
+    ANGLE_TRY(scopedState.enter(context, gl::Rectangle(destOffset.x, destOffset.y,
+                                                       sourceArea.width, sourceArea.height)));
+
+    // Swapping the destination rows flips the image vertically.
+    GLint destY0 = destOffset.y;
+    GLint destY1 = destOffset.y + sourceArea.height;
+    if (unpackFlipY)
+    {
+        std::swap(destY0, destY1);
+    }
+
+    ANGLE_GL_TRY(context, mFunctions->blitFramebuffer(
+                              sourceArea.x, sourceArea.y, sourceArea.x1(), sourceArea.y1(),
+                              destOffset.x, destY0, destOffset.x + sourceArea.width, destY1,
+                              GL_COLOR_BUFFER_BIT, GL_NEAREST));
+
+    ANGLE_TRY(scopedState.exit(context));
+    *copySucceededOut = true;
+    return angle::Result::Continue;
+}
+
 angle::Result BlitGL::clearRenderableTexture(const gl::Context *context,
                                              TextureGL *source,
                                              GLenum sizedInternalFormat,
@@ -1121,6 +1187,7 @@ angle::Result BlitGL::initializeResources(const gl::Context *context)
     }
 
     ANGLE_GL_TRY(context, mFunctions->genFramebuffers(1, &mScratchFBO));
+    ANGLE_GL_TRY(context, mFunctions->genFramebuffers(1, &mScratchReadFBO));
 
     ANGLE_GL_TRY(context, mFunctions->genBuffers(1, &mVertexBuffer));
     mStateManager->bindBuffer(gl::BufferBinding::Array, mVertexBuffer);
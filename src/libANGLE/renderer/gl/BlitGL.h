@@ -138,6 +138,19 @@ class BlitGL : angle::NonCopyable
                                   const gl::Offset &destOffset,
                                   bool *copySucceededOut);
 
+    // Copies between two textures of the same format with glBlitFramebuffer, which converts
+    // nothing but can flip the rows.
+    angle::Result copySubTextureWithBlitFramebuffer(const gl::Context *context,
+                                                    TextureGL *source,
+                                                    size_t sourceLevel,
+                                                    TextureGL *dest,
+                                                    gl::TextureTarget destTarget,
+                                                    size_t destLevel,
+                                                    const gl::Rectangle &sourceArea,
+                                                    const gl::Offset &destOffset,
+                                                    bool unpackFlipY,
+                                                    bool *copySucceededOut);
+
     angle::Result clearRenderableTexture(const gl::Context *context,
                                          TextureGL *source,
                                          GLenum sizedInternalFormat,
@@ -200,6 +213,7 @@ class BlitGL : angle::NonCopyable
 
     GLuint mScratchTextures[2] = {0};
     GLuint mScratchFBO         = 0;
+    GLuint mScratchReadFBO     = 0;
 
     GLuint mVAO                   = 0;
     VertexArrayStateGL *mVAOState = nullptr;
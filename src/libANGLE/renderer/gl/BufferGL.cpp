@@ -182,9 +182,24 @@ angle::Result BufferGL::mapRange(const gl::Context *context,
     else
     {
         stateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+
+        // When the whole contents are invalidated, give the buffer new storage so that the map
+        // doesn't have to wait for the commands that use the previous contents.  Some drivers
+        // do this themselves, others synchronize with the GPU.
+        GLbitfield nativeAccess = access;
+        if ((access & GL_MAP_INVALIDATE_BUFFER_BIT) != 0 &&
+            (access & GL_MAP_UNSYNCHRONIZED_BIT) == 0 &&
+            mState.getUsage() != gl::BufferUsage::InvalidEnum)
+        {
+            ANGLE_GL_TRY(context,
+                         functions->bufferData(gl::ToGLenum(DestBufferOperationTarget), mBufferSize,
+                                               nullptr, ToGLenum(mState.getUsage())));
+            nativeAccess |= GL_MAP_UNSYNCHRONIZED_BIT;
+        }
+
         *mapPtr =
             ANGLE_GL_TRY(context, functions->mapBufferRange(gl::ToGLenum(DestBufferOperationTarget),
-                                                            offset, length, access));
+                                                            offset, length, nativeAccess));
     }
 
     mIsMapped  = true;
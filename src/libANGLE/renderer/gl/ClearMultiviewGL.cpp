@@ -8,6 +8,7 @@
 //
 
 #include "libANGLE/renderer/gl/ClearMultiviewGL.h"
+#include "common/FixedVector.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
 #include "libANGLE/renderer/gl/TextureGL.h"
@@ -16,6 +17,42 @@
 
 namespace rx
 {
+namespace
+{
+using AttachmentPointVector =
+    angle::FixedVector<std::pair<GLenum, const gl::FramebufferAttachment *>,
+                       gl::IMPLEMENTATION_MAX_DRAW_BUFFERS + 1>;
+
+// Returns the attachments that a multiview clear writes to, along with their attachment points.
+void GetClearedAttachments(const gl::FramebufferState &state, AttachmentPointVector *attachmentsOut)
+{
+    for (auto drawBufferId : state.getEnabledDrawBuffers())
+    {
+        const gl::FramebufferAttachment *attachment = state.getColorAttachment(drawBufferId);
+        if (attachment != nullptr)
+        {
+            attachmentsOut->push_back(std::make_pair(
+                static_cast<GLenum>(GL_COLOR_ATTACHMENT0 + static_cast<int>(drawBufferId)),
+                attachment));
+        }
+    }
+
+    if (state.getDepthStencilAttachment() != nullptr)
+    {
+        attachmentsOut->push_back(
+            std::make_pair(GL_DEPTH_STENCIL_ATTACHMENT, state.getDepthStencilAttachment()));
+    }
+    else if (state.getDepthAttachment() != nullptr)
+    {
+        attachmentsOut->push_back(std::make_pair(GL_DEPTH_ATTACHMENT, state.getDepthAttachment()));
+    }
+    else if (state.getStencilAttachment() != nullptr)
+    {
+        attachmentsOut->push_back(
+            std::make_pair(GL_STENCIL_ATTACHMENT, state.getStencilAttachment()));
+    }
+}
+}  // anonymous namespace
 
 ClearMultiviewGL::ClearMultiviewGL(const FunctionsGL *functions, StateManagerGL *stateManager)
     : mFunctions(functions), mStateManager(stateManager), mFramebuffer(0u)
@@ -65,9 +102,19 @@ void ClearMultiviewGL::clearLayeredFBO(const gl::FramebufferState &state,
     const auto &drawBuffers = state.getDrawBufferStates();
     mFunctions->drawBuffers(static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
 
-    // Attach the new attachments and clear.
     int numViews      = firstAttachment->getNumViews();
     int baseViewIndex = firstAttachment->getBaseViewIndex();
+
+    // Clear all views at once through views of the active layers if possible.
+    if (attachTextureViews(state, baseViewIndex, numViews))
+    {
+        genericClear(clearCommandType, mask, buffer, drawbuffer, values, depth, stencil);
+        detachTextures(state);
+        deleteTextureViews();
+        return;
+    }
+
+    // Attach the new attachments and clear.
     for (int i = 0; i < numViews; ++i)
     {
         attachTextures(state, baseViewIndex + i);
@@ -198,6 +245,56 @@ void ClearMultiviewGL::detachTextures(const gl::FramebufferState &state)
     }
 }
 
+bool ClearMultiviewGL::attachTextureViews(const gl::FramebufferState &state,
+                                          int baseLayer,
+                                          int numLayers)
+{
+    if (mFunctions->textureView == nullptr || mFunctions->framebufferTexture == nullptr)
+    {
+        return false;
+    }
+
+    AttachmentPointVector attachments;
+    GetClearedAttachments(state, &attachments);
+
+    // Only textures with immutable storage can have views.
+    for (const auto &attachment : attachments)
+    {
+        if (!attachment.second->getTexture()->getImmutableFormat())
+        {
+            return false;
+        }
+    }
+
+    ASSERT(mTextureViews.empty());
+    mTextureViews.resize(attachments.size(), 0);
+    mFunctions->genTextures(static_cast<GLsizei>(mTextureViews.size()), mTextureViews.data());
+
+    for (size_t attachmentIndex = 0; attachmentIndex < attachments.size(); ++attachmentIndex)
+    {
+        const gl::FramebufferAttachment *attachment = attachments[attachmentIndex].second;
+        const auto &imageIndex                      = attachment->getTextureImageIndex();
+        ASSERT(imageIndex.getType() == gl::TextureType::_2DArray);
+
+        const TextureGL *textureGL = GetImplAs<TextureGL>(attachment->getTexture());
+        GLuint textureView         = mTextureViews[attachmentIndex];
+        mFunctions->textureView(textureView, GL_TEXTURE_2D_ARRAY, textureGL->getTextureID(),
+                                textureGL->getNativeInternalFormat(imageIndex),
+                                static_cast<GLuint>(imageIndex.getLevelIndex()), 1,
+                                static_cast<GLuint>(baseLayer), static_cast<GLuint>(numLayers));
+        mFunctions->framebufferTexture(GL_DRAW_FRAMEBUFFER, attachments[attachmentIndex].first,
+                                       textureView, 0);
+    }
+
+    return true;
+}
+
+void ClearMultiviewGL::deleteTextureViews()
+{
+    mFunctions->deleteTextures(static_cast<GLsizei>(mTextureViews.size()), mTextureViews.data());
+    mTextureViews.clear();
+}
+
 void ClearMultiviewGL::initializeResources()
 {
     if (mFramebuffer == 0u)
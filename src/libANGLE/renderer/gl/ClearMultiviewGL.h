@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_RENDERER_GL_CLEARMULTIVIEWGL_H_
 #define LIBANGLE_RENDERER_GL_CLEARMULTIVIEWGL_H_
 
+#include <vector>
+
 #include "angle_gl.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/angletypes.h"
@@ -60,6 +62,11 @@ class ClearMultiviewGL : angle::NonCopyable
   private:
     void attachTextures(const gl::FramebufferState &state, int layer);
     void detachTextures(const gl::FramebufferState &state);
+    // Attaches views of the layers [baseLayer, baseLayer + numLayers) of every attachment as
+    // layered attachments, so that a single clear covers all views.  Returns false without
+    // attaching anything if views can't be made for this framebuffer.
+    bool attachTextureViews(const gl::FramebufferState &state, int baseLayer, int numLayers);
+    void deleteTextureViews();
     void clearLayeredFBO(const gl::FramebufferState &state,
                          ClearCommandType clearCommandType,
                          GLbitfield mask,
@@ -80,6 +87,7 @@ class ClearMultiviewGL : angle::NonCopyable
     StateManagerGL *mStateManager;
 
     GLuint mFramebuffer;
+    std::vector<GLuint> mTextureViews;
 };
 }  // namespace rx
 
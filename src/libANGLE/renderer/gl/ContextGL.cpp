@@ -208,7 +208,8 @@ OverlayImpl *ContextGL::createOverlay(const gl::OverlayState &state)
 
 angle::Result ContextGL::flush(const gl::Context *context)
 {
-    return mRenderer->flush();
+    ANGLE_TRY(mRenderer->flush());
+    return getStateManager()->pollPendingQueryResults(context);
 }
 
 angle::Result ContextGL::finish(const gl::Context *context)
@@ -894,6 +895,11 @@ ClearMultiviewGL *ContextGL::getMultiviewClearer() const
     return mRenderer->getMultiviewClearer();
 }
 
+StreamingBufferGL *ContextGL::getStreamingPixelUnpackBuffer() const
+{
+    return mRenderer->getStreamingPixelUnpackBuffer();
+}
+
 angle::Result ContextGL::dispatchCompute(const gl::Context *context,
                                          GLuint numGroupsX,
                                          GLuint numGroupsY,
@@ -30,6 +30,7 @@ class ClearMultiviewGL;
 class FunctionsGL;
 class RendererGL;
 class StateManagerGL;
+class StreamingBufferGL;
 
 enum class RobustnessVideoMemoryPurgeStatus
 {
@@ -250,6 +251,7 @@ class ContextGL : public ContextImpl
     const angle::FeaturesGL &getFeaturesGL() const;
     BlitGL *getBlitter() const;
     ClearMultiviewGL *getMultiviewClearer() const;
+    StreamingBufferGL *getStreamingPixelUnpackBuffer() const;
 
     angle::Result dispatchCompute(const gl::Context *context,
                                   GLuint numGroupsX,
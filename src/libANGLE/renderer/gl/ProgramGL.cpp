@@ -23,12 +23,23 @@
 #include "libANGLE/renderer/gl/RendererGL.h"
 #include "libANGLE/renderer/gl/ShaderGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/renderergl_utils.h"
 #include "libANGLE/trace.h"
 #include "platform/FeaturesGL.h"
 #include "platform/PlatformMethods.h"
 
 namespace rx
 {
+namespace
+{
+// Native program binaries can only be loaded by the driver that created them.  Unlike the strings
+// exposed by the display, these are not sanitized, so that any driver update is noticed.
+std::string GetNativeBinaryDriverString(const FunctionsGL *functions)
+{
+    return GetVendorString(functions) + " " + GetRendererString(functions) + " " +
+           GetVersionString(functions);
+}
+}  // anonymous namespace
 
 ProgramGL::ProgramGL(const gl::ProgramState &data,
                      const FunctionsGL *functions,
@@ -63,6 +74,14 @@ std::unique_ptr<LinkEvent> ProgramGL::load(const gl::Context *context,
     ANGLE_TRACE_EVENT0("gpu.angle", "ProgramGL::load");
     preLink();
 
+    // Don't hand the driver a binary that it didn't create, some drivers crash on it instead of
+    // failing the link.  The program is relinked from its shaders instead.
+    if (stream->readString() != GetNativeBinaryDriverString(mFunctions))
+    {
+        infoLog << "Program binary was created by a different driver.";
+        return std::make_unique<LinkEventDone>(angle::Result::Incomplete);
+    }
+
     // Read the binary format, size and blob
     GLenum binaryFormat   = stream->readInt<GLenum>();
     GLint binaryLength    = stream->readInt<GLint>();
@@ -94,6 +113,7 @@ void ProgramGL::save(const gl::Context *context, gl::BinaryOutputStream *stream)
     mFunctions->getProgramBinary(mProgramID, binaryLength, &binaryLength, &binaryFormat,
                                  binary.data());
 
+    stream->writeString(GetNativeBinaryDriverString(mFunctions));
     stream->writeInt(binaryFormat);
     stream->writeInt(binaryLength);
     stream->writeBytes(binary.data(), binaryLength);
@@ -82,6 +82,7 @@ StandardQueryGL::~StandardQueryGL()
         mFunctions->deleteQueries(1, &id);
         mPendingQueries.pop_front();
     }
+    mStateManager->setQueryResultsPending(this, false);
 }
 
 angle::Result StandardQueryGL::begin(const gl::Context *context)
@@ -105,6 +106,7 @@ angle::Result StandardQueryGL::queryCounter(const gl::Context *context)
     mFunctions->genQueries(1, &query);
     mFunctions->queryCounter(query, GL_TIMESTAMP);
     mPendingQueries.push_back(query);
+    mStateManager->setQueryResultsPending(this, true);
 
     return angle::Result::Continue;
 }
@@ -158,6 +160,7 @@ angle::Result StandardQueryGL::pause(const gl::Context *context)
 
         mPendingQueries.push_back(mActiveQuery);
         mActiveQuery = 0;
+        mStateManager->setQueryResultsPending(this, true);
     }
 
     // Flush to make sure the pending queries don't add up too much.
@@ -222,9 +225,15 @@ angle::Result StandardQueryGL::flush(const gl::Context *context, bool force)
         mPendingQueries.pop_front();
     }
 
+    mStateManager->setQueryResultsPending(this, false);
     return angle::Result::Continue;
 }
 
+angle::Result StandardQueryGL::pollResults(const gl::Context *context)
+{
+    return flush(context, false);
+}
+
 class SyncProviderGL
 {
   public:
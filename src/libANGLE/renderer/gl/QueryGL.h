@@ -53,6 +53,9 @@ class StandardQueryGL : public QueryGL
     angle::Result pause(const gl::Context *context) override;
     angle::Result resume(const gl::Context *context) override;
 
+    // Accumulates the results of the pending native queries that are available, without waiting.
+    angle::Result pollResults(const gl::Context *context);
+
   private:
     angle::Result flush(const gl::Context *context, bool force);
 
@@ -31,6 +31,7 @@
 #include "libANGLE/renderer/gl/SamplerGL.h"
 #include "libANGLE/renderer/gl/ShaderGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 #include "libANGLE/renderer/gl/SurfaceGL.h"
 #include "libANGLE/renderer/gl/SyncGL.h"
 #include "libANGLE/renderer/gl/TextureGL.h"
@@ -144,6 +145,7 @@ RendererGL::RendererGL(std::unique_ptr<FunctionsGL> functions,
       mStateManager(nullptr),
       mBlitter(nullptr),
       mMultiviewClearer(nullptr),
+      mStreamingPixelUnpackBuffer(nullptr),
       mUseDebugOutput(false),
       mCapsInitialized(false),
       mMultiviewImplementationType(MultiviewImplementationTypeGL::UNSPECIFIED),
@@ -158,8 +160,9 @@ RendererGL::RendererGL(std::unique_ptr<FunctionsGL> functions,
     ApplyFeatureOverrides(&mFeatures, display->getState());
     mStateManager =
         new StateManagerGL(mFunctions.get(), getNativeCaps(), getNativeExtensions(), mFeatures);
-    mBlitter          = new BlitGL(mFunctions.get(), mFeatures, mStateManager);
-    mMultiviewClearer = new ClearMultiviewGL(mFunctions.get(), mStateManager);
+    mBlitter                    = new BlitGL(mFunctions.get(), mFeatures, mStateManager);
+    mMultiviewClearer           = new ClearMultiviewGL(mFunctions.get(), mStateManager);
+    mStreamingPixelUnpackBuffer = new StreamingBufferGL(gl::BufferBinding::PixelUnpack);
 
     bool hasDebugOutput = mFunctions->isAtLeastGL(gl::Version(4, 3)) ||
                           mFunctions->hasGLExtension("GL_KHR_debug") ||
@@ -205,6 +208,8 @@ RendererGL::~RendererGL()
 {
     SafeDelete(mBlitter);
     SafeDelete(mMultiviewClearer);
+    mStreamingPixelUnpackBuffer->destroy(mFunctions.get(), mStateManager);
+    SafeDelete(mStreamingPixelUnpackBuffer);
     SafeDelete(mStateManager);
 
     std::lock_guard<std::mutex> lock(mWorkerMutex);
@@ -367,8 +372,17 @@ bool RendererGL::bindWorkerContext(std::string *infoLog)
     std::unique_ptr<WorkerContext> workerContext;
     if (!mWorkerContextPool.empty())
     {
-        auto it       = mWorkerContextPool.begin();
-        workerContext = std::move(*it);
+        // Prefer the context that this thread used last, so that each worker thread keeps using
+        // the same native context instead of the driver moving contexts between threads.
+        auto it = std::find_if(mWorkerContextPool.begin(), mWorkerContextPool.end(),
+                               [threadID](const IdleWorkerContext &idleContext) {
+                                   return idleContext.lastThreadID == threadID;
+                               });
+        if (it == mWorkerContextPool.end())
+        {
+            it = mWorkerContextPool.begin();
+        }
+        workerContext = std::move(it->context);
         mWorkerContextPool.erase(it);
     }
     else
@@ -383,7 +397,7 @@ bool RendererGL::bindWorkerContext(std::string *infoLog)
 
     if (!workerContext->makeCurrent())
     {
-        mWorkerContextPool.push_back(std::move(workerContext));
+        mWorkerContextPool.push_back({std::thread::id(), std::move(workerContext)});
         return false;
     }
     mCurrentWorkerContexts[threadID] = std::move(workerContext);
@@ -398,7 +412,7 @@ void RendererGL::unbindWorkerContext()
     auto it = mCurrentWorkerContexts.find(threadID);
     ASSERT(it != mCurrentWorkerContexts.end());
     (*it).second->unmakeCurrent();
-    mWorkerContextPool.push_back(std::move((*it).second));
+    mWorkerContextPool.push_back({threadID, std::move((*it).second)});
     mCurrentWorkerContexts.erase(it);
 }
 
@@ -50,6 +50,7 @@ class DisplayGL;
 class FunctionsGL;
 class RendererGL;
 class StateManagerGL;
+class StreamingBufferGL;
 
 // WorkerContext wraps a native GL context shared from the main context. It is used by the workers
 // for khr_parallel_shader_compile.
@@ -106,6 +107,7 @@ class RendererGL : angle::NonCopyable
     const angle::FeaturesGL &getFeatures() const { return mFeatures; }
     BlitGL *getBlitter() const { return mBlitter; }
     ClearMultiviewGL *getMultiviewClearer() const { return mMultiviewClearer; }
+    StreamingBufferGL *getStreamingPixelUnpackBuffer() const { return mStreamingPixelUnpackBuffer; }
 
     MultiviewImplementationTypeGL getMultiviewImplementationType() const;
     const gl::Caps &getNativeCaps() const;
@@ -154,6 +156,7 @@ class RendererGL : angle::NonCopyable
 
     BlitGL *mBlitter;
     ClearMultiviewGL *mMultiviewClearer;
+    StreamingBufferGL *mStreamingPixelUnpackBuffer;
 
     bool mUseDebugOutput;
 
@@ -166,8 +169,13 @@ class RendererGL : angle::NonCopyable
 
     // The thread-to-context mapping for the currently active worker threads.
     angle::HashMap<std::thread::id, std::unique_ptr<WorkerContext>> mCurrentWorkerContexts;
-    // The worker contexts available to use.
-    std::list<std::unique_ptr<WorkerContext>> mWorkerContextPool;
+    // The worker contexts available to use, and the thread that last used each of them.
+    struct IdleWorkerContext
+    {
+        std::thread::id lastThreadID;
+        std::unique_ptr<WorkerContext> context;
+    };
+    std::list<IdleWorkerContext> mWorkerContextPool;
     // Protect the concurrent accesses to worker contexts.
     std::mutex mWorkerMutex;
 
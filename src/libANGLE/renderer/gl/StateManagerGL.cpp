@@ -766,6 +766,31 @@ void StateManagerGL::endQuery(gl::QueryType type, QueryGL *queryObject, GLuint q
     mFunctions->endQuery(ToGLenum(type));
 }
 
+void StateManagerGL::setQueryResultsPending(StandardQueryGL *queryObject, bool pending)
+{
+    if (pending)
+    {
+        mQueriesWithPendingResults.insert(queryObject);
+    }
+    else
+    {
+        mQueriesWithPendingResults.erase(queryObject);
+    }
+}
+
+angle::Result StateManagerGL::pollPendingQueryResults(const gl::Context *context)
+{
+    for (auto queryIter = mQueriesWithPendingResults.begin();
+         queryIter != mQueriesWithPendingResults.end();)
+    {
+        // Polling can remove the query from the set.
+        StandardQueryGL *query = *queryIter++;
+        ANGLE_TRY(query->pollResults(context));
+    }
+
+    return angle::Result::Continue;
+}
+
 void StateManagerGL::updateDrawIndirectBufferBinding(const gl::Context *context)
 {
     gl::Buffer *drawIndirectBuffer =
@@ -916,6 +941,12 @@ void StateManagerGL::updateProgramTextureBindings(const gl::Context *context)
     const gl::ActiveTextureMask &activeTextures    = executable->getActiveSamplersMask();
     const gl::ActiveTextureTypeArray &textureTypes = executable->getActiveSamplerTypes();
 
+    if (mFunctions->bindTextures != nullptr)
+    {
+        updateProgramTextureBindingsMultiBind(textures, activeTextures, textureTypes);
+        return;
+    }
+
     for (size_t textureUnitIndex : activeTextures)
     {
         gl::TextureType textureType = textureTypes[textureUnitIndex];
@@ -939,6 +970,75 @@ void StateManagerGL::updateProgramTextureBindings(const gl::Context *context)
     }
 }
 
+void StateManagerGL::updateProgramTextureBindingsMultiBind(
+    const gl::ActiveTexturesCache &textures,
+    const gl::ActiveTextureMask &activeTextures,
+    const gl::ActiveTextureTypeArray &textureTypes)
+{
+    gl::ActiveTextureArray<GLuint> textureIDs;
+    gl::ActiveTextureMask changedUnits;
+    for (size_t textureUnitIndex : activeTextures)
+    {
+        // A nullptr texture indicates incomplete.
+        const gl::Texture *texture = textures[textureUnitIndex];
+        GLuint textureID = texture != nullptr ? GetImplAs<TextureGL>(texture)->getTextureID() : 0;
+
+        gl::TextureType nativeType = nativegl::GetNativeTextureType(textureTypes[textureUnitIndex]);
+        if (mTextures[nativeType][textureUnitIndex] != textureID)
+        {
+            textureIDs[textureUnitIndex] = textureID;
+            changedUnits.set(textureUnitIndex);
+        }
+    }
+
+    if (changedUnits.none())
+    {
+        return;
+    }
+
+    // glBindTextures binds each texture to the target it was created with, and unbinds all targets
+    // of the unit for zero.  The units in between that don't change are given back one of the
+    // textures they already have bound, which is a no-op.
+    const size_t firstUnit = changedUnits.first();
+    const size_t lastUnit  = changedUnits.last();
+    for (size_t unit = firstUnit; unit <= lastUnit; ++unit)
+    {
+        if (changedUnits.test(unit))
+        {
+            continue;
+        }
+
+        textureIDs[unit] = 0;
+        for (const gl::ActiveTextureArray<GLuint> &boundTextures : mTextures)
+        {
+            if (boundTextures[unit] != 0)
+            {
+                textureIDs[unit] = boundTextures[unit];
+                break;
+            }
+        }
+    }
+
+    const GLsizei unitCount = static_cast<GLsizei>(lastUnit - firstUnit + 1);
+    mFunctions->bindTextures(static_cast<GLuint>(firstUnit), unitCount, &textureIDs[firstUnit]);
+
+    for (size_t unit : changedUnits)
+    {
+        if (textureIDs[unit] == 0)
+        {
+            for (gl::ActiveTextureArray<GLuint> &boundTextures : mTextures)
+            {
+                boundTextures[unit] = 0;
+            }
+        }
+        else
+        {
+            mTextures[nativegl::GetNativeTextureType(textureTypes[unit])][unit] = textureIDs[unit];
+        }
+    }
+    mLocalDirtyBits.set(gl::State::DIRTY_BIT_TEXTURE_BINDINGS);
+}
+
 void StateManagerGL::updateProgramStorageBufferBindings(const gl::Context *context)
 {
     const gl::State &glState   = context->getState();
@@ -2474,6 +2574,12 @@ void StateManagerGL::syncSamplersState(const gl::Context *context)
 {
     const gl::SamplerBindingVector &samplers = context->getState().getSamplers();
 
+    if (mFunctions->bindSamplers != nullptr)
+    {
+        syncSamplersStateMultiBind(samplers);
+        return;
+    }
+
     // This could be optimized by using a separate binding dirty bit per sampler.
     for (size_t samplerIndex = 0; samplerIndex < samplers.size(); ++samplerIndex)
     {
@@ -2490,6 +2596,35 @@ void StateManagerGL::syncSamplersState(const gl::Context *context)
     }
 }
 
+void StateManagerGL::syncSamplersStateMultiBind(const gl::SamplerBindingVector &samplers)
+{
+    gl::ActiveTextureArray<GLuint> samplerIDs;
+    gl::ActiveTextureMask changedUnits;
+    for (size_t samplerIndex = 0; samplerIndex < samplers.size(); ++samplerIndex)
+    {
+        const gl::Sampler *sampler = samplers[samplerIndex].get();
+        samplerIDs[samplerIndex] =
+            sampler != nullptr ? GetImplAs<SamplerGL>(sampler)->getSamplerID() : 0;
+        if (mSamplers[samplerIndex] != samplerIDs[samplerIndex])
+        {
+            mSamplers[samplerIndex] = samplerIDs[samplerIndex];
+            changedUnits.set(samplerIndex);
+        }
+    }
+
+    if (changedUnits.none())
+    {
+        return;
+    }
+
+    // The units in between that don't change are given their current sampler again.
+    const size_t firstUnit  = changedUnits.first();
+    const size_t lastUnit   = changedUnits.last();
+    const GLsizei unitCount = static_cast<GLsizei>(lastUnit - firstUnit + 1);
+    mFunctions->bindSamplers(static_cast<GLuint>(firstUnit), unitCount, &samplerIDs[firstUnit]);
+    mLocalDirtyBits.set(gl::State::DIRTY_BIT_SAMPLER_BINDINGS);
+}
+
 void StateManagerGL::syncTransformFeedbackState(const gl::Context *context)
 {
     // Set the current transform feedback state
@@ -18,6 +18,7 @@
 
 #include <array>
 #include <map>
+#include <set>
 
 namespace gl
 {
@@ -34,6 +35,7 @@ class FunctionsGL;
 class TransformFeedbackGL;
 class VertexArrayGL;
 class QueryGL;
+class StandardQueryGL;
 
 // TODO(penghuang): use gl::State?
 struct ExternalContextState
@@ -190,6 +192,10 @@ class StateManagerGL final : angle::NonCopyable
     void onTransformFeedbackStateChange();
     void beginQuery(gl::QueryType type, QueryGL *queryObject, GLuint queryId);
     void endQuery(gl::QueryType type, QueryGL *queryObject, GLuint queryId);
+    // Queries with native results that haven't been read yet are polled on every flush, so that
+    // reading the result later doesn't have to wait for all of them.
+    void setQueryResultsPending(StandardQueryGL *queryObject, bool pending);
+    angle::Result pollPendingQueryResults(const gl::Context *context);
 
     void setAttributeCurrentData(size_t index, const gl::VertexAttribCurrentValueData &data);
 
@@ -309,6 +315,10 @@ class StateManagerGL final : angle::NonCopyable
                                VertexArrayGL *vao);
 
     void updateProgramTextureBindings(const gl::Context *context);
+    // Uses glBindTextures from GL_ARB_multi_bind to bind all the changed units in one call.
+    void updateProgramTextureBindingsMultiBind(const gl::ActiveTexturesCache &textures,
+                                               const gl::ActiveTextureMask &activeTextures,
+                                               const gl::ActiveTextureTypeArray &textureTypes);
     void updateProgramStorageBufferBindings(const gl::Context *context);
     void updateProgramUniformBufferBindings(const gl::Context *context);
     void updateProgramAtomicCounterBufferBindings(const gl::Context *context);
@@ -324,6 +334,7 @@ class StateManagerGL final : angle::NonCopyable
     void get(GLenum name, std::array<T, n> *values);
 
     void syncSamplersState(const gl::Context *context);
+    void syncSamplersStateMultiBind(const gl::SamplerBindingVector &samplers);
     void syncTransformFeedbackState(const gl::Context *context);
 
     void updateMultiviewBaseViewLayerIndexUniformImpl(
@@ -424,6 +435,8 @@ class StateManagerGL final : angle::NonCopyable
     // by other operations
     angle::PackedEnumMap<gl::QueryType, QueryGL *> mTemporaryPausedQueries;
 
+    std::set<StandardQueryGL *> mQueriesWithPendingResults;
+
     gl::ContextID mPrevDrawContext;
 
     GLint mUnpackAlignment;
@@ -0,0 +1,173 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.cpp: Implements the class methods for StreamingBufferGL.
+
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
+
+#include <algorithm>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/renderergl_utils.h"
+
+namespace rx
+{
+namespace
+{
+constexpr size_t kMinimumBufferSize = 256 * 1024;
+
+// Enough for any vertex attribute or index type.
+constexpr size_t kAllocationAlignment = 16;
+
+constexpr GLbitfield kStorageFlags =
+    GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+}  // anonymous namespace
+
+StreamingBufferGL::StreamingBufferGL(gl::BufferBinding target)
+    : mTarget(target),
+      mBufferID(0),
+      mSize(0),
+      mOffset(0),
+      mMappedPointer(nullptr),
+      mCurrentRegion(0)
+{
+    mRegionFences.fill(nullptr);
+}
+
+StreamingBufferGL::~StreamingBufferGL()
+{
+    ASSERT(mBufferID == 0);
+}
+
+void StreamingBufferGL::destroy(const FunctionsGL *functions, StateManagerGL *stateManager)
+{
+    releaseFences(functions);
+
+    // Deleting the buffer also unmaps it.
+    stateManager->deleteBuffer(mBufferID);
+    mBufferID      = 0;
+    mSize          = 0;
+    mOffset        = 0;
+    mMappedPointer = nullptr;
+}
+
+angle::Result StreamingBufferGL::allocate(const gl::Context *context,
+                                          size_t size,
+                                          uint8_t **ptrOut,
+                                          size_t *offsetOut)
+{
+    ASSERT(size > 0);
+
+    // Keeping allocations to at most half of the buffer bounds the number of regions that one
+    // allocation can move past.
+    if (size > mSize / 2)
+    {
+        ANGLE_TRY(reallocate(context, size * 2));
+    }
+    else
+    {
+        GetStateManagerGL(context)->bindBuffer(mTarget, mBufferID);
+    }
+
+    size_t offset = roundUp(mOffset, kAllocationAlignment);
+    bool wraps    = offset + size > mSize;
+    if (wraps)
+    {
+        offset = 0;
+    }
+
+    // Every region that is written to before the allocation is fenced, and every region that it
+    // covers is waited on.
+    const size_t regionSize = mSize / kRegionCount;
+    const size_t lastRegion = (offset + size - 1) / regionSize;
+    const size_t regionsToAdvance =
+        wraps ? kRegionCount - mCurrentRegion + lastRegion : lastRegion - mCurrentRegion;
+    for (size_t regionIndex = 0; regionIndex < regionsToAdvance; ++regionIndex)
+    {
+        ANGLE_TRY(advanceRegion(context));
+    }
+    ASSERT(mCurrentRegion == lastRegion);
+
+    mOffset    = offset + size;
+    *ptrOut    = mMappedPointer + offset;
+    *offsetOut = offset;
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingBufferGL::reallocate(const gl::Context *context, size_t minSize)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    StateManagerGL *stateManager = GetStateManagerGL(context);
+
+    // The data of the previous buffer stays alive until the GPU is done with it, so it doesn't
+    // need to be waited on.
+    destroy(functions, stateManager);
+
+    const size_t size =
+        roundUp(std::max(minSize, kMinimumBufferSize), kRegionCount * kAllocationAlignment);
+    const GLenum target = gl::ToGLenum(mTarget);
+
+    functions->genBuffers(1, &mBufferID);
+    stateManager->bindBuffer(mTarget, mBufferID);
+    ANGLE_GL_TRY_ALWAYS_CHECK(context,
+                              functions->bufferStorage(target, size, nullptr, kStorageFlags));
+
+    mMappedPointer =
+        static_cast<uint8_t *>(functions->mapBufferRange(target, 0, size, kStorageFlags));
+    ANGLE_CHECK(GetImplAs<ContextGL>(context), mMappedPointer != nullptr,
+                "Failed to map the client data streaming buffer.", GL_OUT_OF_MEMORY);
+
+    mSize          = size;
+    mOffset        = 0;
+    mCurrentRegion = 0;
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingBufferGL::advanceRegion(const gl::Context *context)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    ContextGL *contextGL         = GetImplAs<ContextGL>(context);
+
+    ASSERT(mRegionFences[mCurrentRegion] == nullptr);
+    mRegionFences[mCurrentRegion] = functions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    ANGLE_CHECK(contextGL, mRegionFences[mCurrentRegion] != nullptr,
+                "glFenceSync failed to create a GLsync object.", GL_OUT_OF_MEMORY);
+
+    mCurrentRegion = (mCurrentRegion + 1) % kRegionCount;
+
+    GLsync &nextFence = mRegionFences[mCurrentRegion];
+    if (nextFence != nullptr)
+    {
+        GLenum result =
+            functions->clientWaitSync(nextFence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        functions->deleteSync(nextFence);
+        nextFence = nullptr;
+        ANGLE_CHECK(contextGL, result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED,
+                    "glClientWaitSync did not return GL_ALREADY_SIGNALED or "
+                    "GL_CONDITION_SATISFIED.",
+                    GL_OUT_OF_MEMORY);
+    }
+
+    return angle::Result::Continue;
+}
+
+void StreamingBufferGL::releaseFences(const FunctionsGL *functions)
+{
+    for (GLsync &fence : mRegionFences)
+    {
+        if (fence != nullptr)
+        {
+            functions->deleteSync(fence);
+            fence = nullptr;
+        }
+    }
+}
+}  // namespace rx
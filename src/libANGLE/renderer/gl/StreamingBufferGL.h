@@ -0,0 +1,68 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.h: Defines the class interface for StreamingBufferGL, a persistently mapped
+// ring buffer that client data is written to before the draw calls that use it.
+
+#ifndef LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+#define LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+
+#include <array>
+
+#include "common/PackedEnums.h"
+#include "libANGLE/Error.h"
+#include "libANGLE/renderer/gl/functionsgl_typedefs.h"
+
+namespace gl
+{
+class Context;
+}  // namespace gl
+
+namespace rx
+{
+class FunctionsGL;
+class StateManagerGL;
+
+// The buffer is split into regions, each one is fenced when writing moves past it and waited on
+// before it is written again.  Requires GL_ARB_buffer_storage or GL_EXT_buffer_storage and fence
+// syncs.
+class StreamingBufferGL : angle::NonCopyable
+{
+  public:
+    explicit StreamingBufferGL(gl::BufferBinding target);
+    ~StreamingBufferGL();
+
+    void destroy(const FunctionsGL *functions, StateManagerGL *stateManager);
+
+    // Binds the buffer to its target and returns a pointer to |size| bytes of it at *offsetOut.
+    // The GPU reads the data in place, so it must be written before the draw call that uses it.
+    // For element array buffers, the vertex array must be bound first.
+    angle::Result allocate(const gl::Context *context,
+                           size_t size,
+                           uint8_t **ptrOut,
+                           size_t *offsetOut);
+
+    GLuint getBufferID() const { return mBufferID; }
+
+  private:
+    static constexpr size_t kRegionCount = 4;
+
+    angle::Result reallocate(const gl::Context *context, size_t minSize);
+    angle::Result advanceRegion(const gl::Context *context);
+    void releaseFences(const FunctionsGL *functions);
+
+    gl::BufferBinding mTarget;
+    GLuint mBufferID;
+    size_t mSize;
+    size_t mOffset;
+    uint8_t *mMappedPointer;
+
+    size_t mCurrentRegion;
+    std::array<GLsync, kRegionCount> mRegionFences;
+};
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
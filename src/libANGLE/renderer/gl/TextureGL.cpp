@@ -26,6 +26,7 @@
 #include "libANGLE/renderer/gl/ImageGL.h"
 #include "libANGLE/renderer/gl/MemoryObjectGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 #include "libANGLE/renderer/gl/SurfaceGL.h"
 #include "libANGLE/renderer/gl/formatutilsgl.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
@@ -111,6 +112,50 @@ size_t GetMaxLevelInfoCountForTextureType(gl::TextureType type)
     }
 }
 
+// Bigger uploads are left to the driver rather than growing the streaming buffer for them.
+constexpr GLuint kMaxStreamedPixelUploadSize = 4 * 1024 * 1024;
+
+// Copies the client data read by a texture upload to the streaming pixel unpack buffer.  When the
+// data is staged, the buffer is left bound and *pixelsOut is the offset of the copy.
+angle::Result StagePixelsInStreamingBuffer(const gl::Context *context,
+                                           const gl::Box &area,
+                                           GLenum format,
+                                           GLenum type,
+                                           bool is3D,
+                                           const gl::PixelUnpackState &unpack,
+                                           const uint8_t *pixels,
+                                           const uint8_t **pixelsOut,
+                                           bool *stagedOut)
+{
+    ContextGL *contextGL                 = GetImplAs<ContextGL>(context);
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(format, type);
+    const gl::Extents size(area.width, area.height, area.depth);
+
+    GLuint endByte = 0;
+    ANGLE_CHECK_GL_MATH(contextGL,
+                        formatInfo.computePackUnpackEndByte(type, size, unpack, is3D, &endByte));
+    if (endByte == 0 || endByte > kMaxStreamedPixelUploadSize)
+    {
+        *stagedOut = false;
+        return angle::Result::Continue;
+    }
+
+    // Some drivers expect the padding of the last row to be in the buffer as well.
+    GLuint rowPitch = 0;
+    ANGLE_CHECK_GL_MATH(contextGL, formatInfo.computeRowPitch(type, size.width, unpack.alignment,
+                                                              unpack.rowLength, &rowPitch));
+
+    uint8_t *stagingPointer = nullptr;
+    size_t stagingOffset    = 0;
+    ANGLE_TRY(contextGL->getStreamingPixelUnpackBuffer()->allocate(
+        context, static_cast<size_t>(endByte) + rowPitch, &stagingPointer, &stagingOffset));
+    memcpy(stagingPointer, pixels, endByte);
+
+    *pixelsOut = reinterpret_cast<const uint8_t *>(stagingOffset);
+    *stagedOut = true;
+    return angle::Result::Continue;
+}
+
 }  // anonymous namespace
 
 LUMAWorkaroundGL::LUMAWorkaroundGL() : LUMAWorkaroundGL(false, GL_NONE) {}
@@ -356,6 +401,20 @@ angle::Result TextureGL::setSubImage(const gl::Context *context,
         }
     }
 
+    // Uploading from a buffer lets the driver copy the data asynchronously.  The rows of the
+    // overlapping rows workaround are uploaded one by one, so they aren't staged.
+    const uint8_t *uploadPixels = pixels;
+    bool stagedPixels           = false;
+    if (features.usePersistentMappedStreamingBuffers.enabled && unpackBuffer == nullptr &&
+        pixels != nullptr &&
+        !(features.unpackOverlappingRowsSeparatelyUnpackBuffer.enabled && unpack.rowLength != 0 &&
+          unpack.rowLength < area.width))
+    {
+        ANGLE_TRY(StagePixelsInStreamingBuffer(context, area, format, type,
+                                               nativegl::UseTexImage3D(getType()), unpack, pixels,
+                                               &uploadPixels, &stagedPixels));
+    }
+
     if (nativegl::UseTexImage2D(getType()))
     {
         ASSERT(area.z == 0 && area.depth == 1);
@@ -363,7 +422,7 @@ angle::Result TextureGL::setSubImage(const gl::Context *context,
                      functions->texSubImage2D(nativegl::GetTextureBindingTarget(target),
                                               static_cast<GLint>(level), area.x, area.y, area.width,
                                               area.height, texSubImageFormat.format,
-                                              texSubImageFormat.type, pixels));
+                                              texSubImageFormat.type, uploadPixels));
     }
     else
     {
@@ -371,7 +430,13 @@ angle::Result TextureGL::setSubImage(const gl::Context *context,
         ANGLE_GL_TRY(context, functions->texSubImage3D(
                                   ToGLenum(target), static_cast<GLint>(level), area.x, area.y,
                                   area.z, area.width, area.height, area.depth,
-                                  texSubImageFormat.format, texSubImageFormat.type, pixels));
+                                  texSubImageFormat.format, texSubImageFormat.type, uploadPixels));
+    }
+
+    if (stagedPixels)
+    {
+        // There is no unpack buffer in the front-end state.
+        stateManager->bindBuffer(gl::BufferBinding::PixelUnpack, 0);
     }
 
     return angle::Result::Continue;
@@ -942,6 +1007,27 @@ angle::Result TextureGL::copySubTextureHelper(const gl::Context *context,
     GLenum sourceComponentType = sourceFormatInfo.componentType;
     GLenum destComponentType   = destFormat.componentType;
     bool destSRGB              = destFormat.colorEncoding == GL_SRGB;
+
+    // Copies between identical formats that don't touch the alpha channel can be done with a blit,
+    // which also handles the flip.
+    const LevelInfoGL &destLevelInfo = getLevelInfo(target, level);
+    if (functions->blitFramebuffer != nullptr && unpackPremultiplyAlpha == unpackUnmultiplyAlpha &&
+        !needsLumaWorkaround && !destLevelInfo.lumaWorkaround.enabled && !destSRGB &&
+        sourceFormatInfo.sizedInternalFormat == destFormat.sizedInternalFormat &&
+        sourceLevelInfo.nativeInternalFormat == destLevelInfo.nativeInternalFormat &&
+        (sourceGL->getType() == gl::TextureType::_2D ||
+         sourceGL->getType() == gl::TextureType::Rectangle))
+    {
+        bool copySucceeded = false;
+        ANGLE_TRY(blitter->copySubTextureWithBlitFramebuffer(context, sourceGL, sourceLevel, this,
+                                                             target, level, sourceArea, destOffset,
+                                                             unpackFlipY, &copySucceeded));
+        if (copySucceeded)
+        {
+            return angle::Result::Continue;
+        }
+    }
+
     if (!unpackFlipY && unpackPremultiplyAlpha == unpackUnmultiplyAlpha && !needsLumaWorkaround &&
         sourceFormatContainSupersetOfDestFormat && sourceComponentType == destComponentType &&
         !destSRGB && sourceGL->getType() == gl::TextureType::_2D)
@@ -956,7 +1042,6 @@ angle::Result TextureGL::copySubTextureHelper(const gl::Context *context,
     }
 
     // Check if the destination is renderable and copy on the GPU
-    const LevelInfoGL &destLevelInfo = getLevelInfo(target, level);
     // todo(jonahr): http://crbug.com/773861
     // Behavior for now is to fallback to CPU readback implementation if the destination texture
     // is a luminance format. The correct solution is to handle both source and destination in the
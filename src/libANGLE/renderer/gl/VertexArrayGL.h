@@ -14,6 +14,7 @@
 #include "common/mathutil.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 
 namespace rx
 {
@@ -96,6 +97,17 @@ class VertexArrayGL : public VertexArrayImpl
                                    GLsizei instanceCount,
                                    const gl::IndexRange &indexRange,
                                    bool applyExtraOffsetWorkaroundForInstancedAttributes) const;
+    // Writes the attributes to the mapped streaming buffer, starting at bufferOffset
+    angle::Result writeStreamedAttributes(
+        const gl::Context *context,
+        const gl::AttributesMask &attribsToStream,
+        GLsizei instanceCount,
+        const gl::IndexRange &indexRange,
+        bool applyExtraOffsetWorkaroundForInstancedAttributes,
+        size_t maxAttributeDataSize,
+        GLuint streamingBuffer,
+        uint8_t *bufferPointer,
+        size_t bufferOffset) const;
     void syncDirtyAttrib(const gl::Context *context,
                          size_t attribIndex,
                          const gl::VertexArray::DirtyAttribBits &dirtyAttribBits);
@@ -144,6 +156,10 @@ class VertexArrayGL : public VertexArrayImpl
     mutable size_t mStreamingArrayBufferSize = 0;
     mutable GLuint mStreamingArrayBuffer     = 0;
 
+    // Used instead of the streaming buffers above when the features allow persistent mapping
+    mutable StreamingBufferGL mStreamingElementArrayRingBuffer{gl::BufferBinding::ElementArray};
+    mutable StreamingBufferGL mStreamingArrayRingBuffer{gl::BufferBinding::Array};
+
     // Used for Mac Intel instanced draw workaround
     mutable gl::AttributesMask mForcedStreamingAttributesForDrawArraysInstancedMask;
     mutable gl::AttributesMask mInstancedAttributesMask;
@@ -2114,6 +2114,10 @@ void InitializeFeatures(const FunctionsGL *functions, angle::FeaturesGL *feature
     // http://crbug.com/1181068 and http://crbug.com/783979
     ANGLE_FEATURE_CONDITION(features, flushOnFramebufferChange,
                             IsApple() && Has9thGenIntelGPU(systemInfo));
+
+    ANGLE_FEATURE_CONDITION(features, usePersistentMappedStreamingBuffers,
+                            nativegl::SupportsBufferStorage(functions) &&
+                                nativegl::SupportsFenceSync(functions));
 }
 
 void InitializeFrontendFeatures(const FunctionsGL *functions, angle::FrontendFeatures *features)
@@ -2178,6 +2182,13 @@ bool SupportsFenceSync(const FunctionsGL *functions)
            functions->isAtLeastGLES(gl::Version(3, 0));
 }
 
+bool SupportsBufferStorage(const FunctionsGL *functions)
+{
+    return functions->isAtLeastGL(gl::Version(4, 4)) ||
+           functions->hasGLExtension("GL_ARB_buffer_storage") ||
+           functions->hasGLESExtension("GL_EXT_buffer_storage");
+}
+
 bool SupportsOcclusionQueries(const FunctionsGL *functions)
 {
     return functions->isAtLeastGL(gl::Version(1, 5)) ||
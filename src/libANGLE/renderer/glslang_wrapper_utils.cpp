@@ -677,9 +677,13 @@ void AssignUniformBindings(const GlslangSourceOptions &options,
                         programInterfaceInfo->currentUniformBindingIndex);
         ++programInterfaceInfo->currentUniformBindingIndex;
 
-        // Assign binding to the driver uniforms block
-        AddResourceInfoToAllStages(variableInfoMapOut, shaderType, sh::vk::kDriverUniformsBlockName,
-                                   programInterfaceInfo->driverUniformsDescriptorSetIndex, 0);
+        // Assign binding to the driver uniforms block, unless it's a push constant block.
+        if (!options.usePushConstantsForDriverUniforms)
+        {
+            AddResourceInfoToAllStages(variableInfoMapOut, shaderType,
+                                       sh::vk::kDriverUniformsBlockName,
+                                       programInterfaceInfo->driverUniformsDescriptorSetIndex, 0);
+        }
     }
 }
 
@@ -909,6 +913,9 @@ class SpirvTransformerBase : angle::NonCopyable
     void onTransformBegin();
     const uint32_t *getCurrentInstruction(spv::Op *opCodeOut, uint32_t *wordCountOut) const;
     void copyInstruction(const uint32_t *instruction, size_t wordCount);
+    // Copies the instructions from the current one up to the first one for which
+    // |isTransformed| returns true in a single copy, and advances past them.
+    void copyUntransformedInstructions(bool (*isTransformed)(spv::Op opCode));
 
     // SPIR-V to transform:
     const spirv::Blob &mSpirvBlobIn;
@@ -945,6 +952,9 @@ void SpirvTransformerBase::onTransformBegin()
     // Make sure the spirv::Blob is not reused.
     ASSERT(mSpirvBlobOut->empty());
 
+    // The transformed SPIR-V is roughly as large as the original.
+    mSpirvBlobOut->reserve(mSpirvBlobIn.size());
+
     // Copy the header to SPIR-V blob, we need that to be defined for SpirvTransformerBase::getNewId
     // to work.
     mSpirvBlobOut->assign(mSpirvBlobIn.begin(), mSpirvBlobIn.begin() + kHeaderIndexInstructions);
@@ -971,6 +981,25 @@ void SpirvTransformerBase::copyInstruction(const uint32_t *instruction, size_t w
     mSpirvBlobOut->insert(mSpirvBlobOut->end(), instruction, instruction + wordCount);
 }
 
+void SpirvTransformerBase::copyUntransformedInstructions(bool (*isTransformed)(spv::Op opCode))
+{
+    const size_t firstWord = mCurrentWord;
+    while (mCurrentWord < mSpirvBlobIn.size())
+    {
+        uint32_t wordCount;
+        spv::Op opCode;
+        getCurrentInstruction(&opCode, &wordCount);
+        if (isTransformed(opCode))
+        {
+            break;
+        }
+        mCurrentWord += wordCount;
+    }
+
+    mSpirvBlobOut->insert(mSpirvBlobOut->end(), mSpirvBlobIn.begin() + firstWord,
+                          mSpirvBlobIn.begin() + mCurrentWord);
+}
+
 spirv::IdRef SpirvTransformerBase::GetNewId(spirv::Blob *blob)
 {
     return spirv::IdRef((*blob)[kHeaderIndexIndexBound]++);
@@ -2815,6 +2844,7 @@ class SpirvTransformer final : public SpirvTransformerBase
 
     // Transform instructions:
     void transformInstruction();
+    static bool IsTransformedInFunction(spv::Op opCode);
 
     // Instructions that are purely informational:
     void visitDecorate(const uint32_t *instruction);
@@ -2877,10 +2907,38 @@ void SpirvTransformer::transform()
 
     while (mCurrentWord < mSpirvBlobIn.size())
     {
+        // Most instructions inside functions are left as is, so they are copied in bulk.
+        if (mIsInFunctionSection && !mInsertFunctionVariables)
+        {
+            copyUntransformedInstructions(IsTransformedInFunction);
+            if (mCurrentWord == mSpirvBlobIn.size())
+            {
+                break;
+            }
+        }
+
         transformInstruction();
     }
 }
 
+bool SpirvTransformer::IsTransformedInFunction(spv::Op opCode)
+{
+    // The instructions looked at by transformInstruction() in the function section.
+    switch (opCode)
+    {
+        case spv::OpFunction:
+        case spv::OpAccessChain:
+        case spv::OpInBoundsAccessChain:
+        case spv::OpPtrAccessChain:
+        case spv::OpInBoundsPtrAccessChain:
+        case spv::OpEmitVertex:
+        case spv::OpReturn:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void SpirvTransformer::resolveVariableIds()
 {
     const size_t indexBound = mSpirvBlobIn[kHeaderIndexIndexBound];
@@ -3658,6 +3716,7 @@ class SpirvVertexAttributeAliasingTransformer final : public SpirvTransformerBas
 
     // Transform instructions:
     void transformInstruction();
+    static bool IsTransformedInFunction(spv::Op opCode);
 
     // Helpers:
     spirv::IdRef getAliasingAttributeReplacementId(spirv::IdRef aliasingId, uint32_t offset) const;
@@ -3755,10 +3814,35 @@ void SpirvVertexAttributeAliasingTransformer::transform()
 
     while (mCurrentWord < mSpirvBlobIn.size())
     {
+        // Most instructions inside functions are left as is, so they are copied in bulk.
+        if (mIsInFunctionSection && !mWriteExpandedMatrixInitialization)
+        {
+            copyUntransformedInstructions(IsTransformedInFunction);
+            if (mCurrentWord == mSpirvBlobIn.size())
+            {
+                break;
+            }
+        }
+
         transformInstruction();
     }
 }
 
+bool SpirvVertexAttributeAliasingTransformer::IsTransformedInFunction(spv::Op opCode)
+{
+    // The instructions looked at by transformInstruction() in the function section.
+    switch (opCode)
+    {
+        case spv::OpFunction:
+        case spv::OpAccessChain:
+        case spv::OpInBoundsAccessChain:
+        case spv::OpLoad:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void SpirvVertexAttributeAliasingTransformer::preprocessAliasingAttributes()
 {
     const uint32_t indexBound = mSpirvBlobIn[kHeaderIndexIndexBound];
@@ -49,6 +49,7 @@ struct GlslangSourceOptions
     bool supportsTransformFeedbackEmulation = false;
     bool enableTransformFeedbackEmulation   = false;
     bool emulateBresenhamLines              = false;
+    bool usePushConstantsForDriverUniforms  = false;
 };
 
 struct GlslangSpirvOptions
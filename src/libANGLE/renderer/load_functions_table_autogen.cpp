@@ -314,6 +314,18 @@ LoadImageFunctionInfo BGRX8_ANGLEX_to_B8G8R8X8_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_R11_EAC_to_BC4_RED_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACR11ToBC4, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_R11_EAC_to_EAC_R11_UNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -374,6 +386,18 @@ LoadImageFunctionInfo COMPRESSED_RED_RGTC1_EXT_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RG11_EAC_to_BC5_RG_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACRG11ToBC5, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RG11_EAC_to_EAC_R11G11_UNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -484,6 +508,18 @@ COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE_to_BC1_RGBA_UNORM_BL
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA8_ETC2_EAC_to_BC3_RGBA_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2RGBA8ToBC3, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA8_ETC2_EAC_to_ETC2_R8G8B8A8_UNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -880,6 +916,18 @@ LoadImageFunctionInfo COMPRESSED_RGB_S3TC_DXT1_EXT_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SIGNED_R11_EAC_to_BC4_RED_SNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACR11SToBC4, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SIGNED_R11_EAC_to_EAC_R11_SNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -940,6 +988,18 @@ LoadImageFunctionInfo COMPRESSED_SIGNED_RED_RGTC1_EXT_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SIGNED_RG11_EAC_to_BC5_RG_SNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACRG11SToBC5, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SIGNED_RG11_EAC_to_EAC_R11G11_SNORM_BLOCK(GLenum type)
 {
     switch (type)
@@ -1264,6 +1324,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR_to_default(GLenum typ
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_BC3_RGBA_UNORM_SRGB_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2SRGBA8ToBC3, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_ETC2_R8G8B8A8_SRGB_BLOCK(GLenum type)
 {
     switch (type)
@@ -3321,6 +3393,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC4_RED_UNORM_BLOCK:
+                    return COMPRESSED_R11_EAC_to_BC4_RED_UNORM_BLOCK;
                 case FormatID::EAC_R11_UNORM_BLOCK:
                     return COMPRESSED_R11_EAC_to_EAC_R11_UNORM_BLOCK;
                 case FormatID::R16_FLOAT:
@@ -3340,6 +3414,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC5_RG_UNORM_BLOCK:
+                    return COMPRESSED_RG11_EAC_to_BC5_RG_UNORM_BLOCK;
                 case FormatID::EAC_R11G11_UNORM_BLOCK:
                     return COMPRESSED_RG11_EAC_to_EAC_R11G11_UNORM_BLOCK;
                 case FormatID::R16G16_FLOAT:
@@ -3403,6 +3479,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC3_RGBA_UNORM_BLOCK:
+                    return COMPRESSED_RGBA8_ETC2_EAC_to_BC3_RGBA_UNORM_BLOCK;
                 case FormatID::ETC2_R8G8B8A8_UNORM_BLOCK:
                     return COMPRESSED_RGBA8_ETC2_EAC_to_ETC2_R8G8B8A8_UNORM_BLOCK;
                 case FormatID::R8G8B8A8_UNORM:
@@ -3478,6 +3556,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC4_RED_SNORM_BLOCK:
+                    return COMPRESSED_SIGNED_R11_EAC_to_BC4_RED_SNORM_BLOCK;
                 case FormatID::EAC_R11_SNORM_BLOCK:
                     return COMPRESSED_SIGNED_R11_EAC_to_EAC_R11_SNORM_BLOCK;
                 case FormatID::R16_FLOAT:
@@ -3497,6 +3577,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC5_RG_SNORM_BLOCK:
+                    return COMPRESSED_SIGNED_RG11_EAC_to_BC5_RG_SNORM_BLOCK;
                 case FormatID::EAC_R11G11_SNORM_BLOCK:
                     return COMPRESSED_SIGNED_RG11_EAC_to_EAC_R11G11_SNORM_BLOCK;
                 case FormatID::R16G16_FLOAT:
@@ -3560,6 +3642,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::BC3_RGBA_UNORM_SRGB_BLOCK:
+                    return COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_BC3_RGBA_UNORM_SRGB_BLOCK;
                 case FormatID::ETC2_R8G8B8A8_SRGB_BLOCK:
                     return COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_ETC2_R8G8B8A8_SRGB_BLOCK;
                 case FormatID::R8G8B8A8_UNORM_SRGB:
@@ -292,6 +292,8 @@ class ContextMtl : public ContextImpl, public mtl::Context
     // Invoke by mtl::Sync
     void queueEventSignal(const mtl::SharedEventRef &event, uint64_t value);
     void serverWaitEvent(const mtl::SharedEventRef &event, uint64_t value);
+    // Returns the queue serial of the command buffer that commands are currently recorded into.
+    uint64_t getCurrentCommandBufferQueueSerial();
 
     const mtl::ClearColorValue &getClearColorValue() const;
     const mtl::WriteMaskArray &getWriteMaskArray() const;
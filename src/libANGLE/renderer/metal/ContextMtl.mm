@@ -1847,6 +1847,12 @@ void ContextMtl::serverWaitEvent(const mtl::SharedEventRef &event, uint64_t valu
     mCmdBuffer.serverWaitEvent(event, value);
 }
 
+uint64_t ContextMtl::getCurrentCommandBufferQueueSerial()
+{
+    ensureCommandBufferReady();
+    return mCmdBuffer.getQueueSerial();
+}
+
 void ContextMtl::updateProgramExecutable(const gl::Context *context)
 {
     // Need to rebind textures
@@ -1934,6 +1940,12 @@ angle::Result ContextMtl::setupDraw(const gl::Context *context,
         ANGLE_TRY(handleDirtyRenderPass(context));
     }
 
+    if (mDrawFramebuffer->hasInvalidatedAttachments() && !IsTransformFeedbackOnly(getState()))
+    {
+        // The draw defines new content for the invalidated attachments, so it has to be stored.
+        mDrawFramebuffer->restoreInvalidatedAttachments(this);
+    }
+
     if (mOcclusionQuery && mOcclusionQueryPool.getNumRenderPassAllocatedQueries() == 0)
     {
         // The occlusion query is still active, and a new render pass has started.
@@ -10,9 +10,11 @@
 #ifndef LIBANGLE_RENDERER_METAL_DISPLAYMTL_H_
 #define LIBANGLE_RENDERER_METAL_DISPLAYMTL_H_
 
+#include "common/MemoryBuffer.h"
 #include "common/PackedEnums.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/DisplayImpl.h"
+#include "libANGLE/renderer/metal/mtl_buffer_pool.h"
 #include "libANGLE/renderer/metal/mtl_command_buffer.h"
 #include "libANGLE/renderer/metal/mtl_format_utils.h"
 #include "libANGLE/renderer/metal/mtl_render_utils.h"
@@ -134,9 +136,12 @@ class DisplayMtl : public DisplayImpl
     const mtl::FormatTable &getFormatTable() const { return mFormatTable; }
     mtl::RenderUtils &getUtils() { return mUtils; }
     mtl::StateCache &getStateCache() { return mStateCache; }
+    mtl::BufferHeapAllocator &getBufferHeapAllocator() { return mBufferHeapAllocator; }
 
     id<MTLLibrary> getDefaultShadersLib();
 
+    angle::ScratchBuffer *getScratchBuffer() const { return &mScratchBuffer; }
+
     id<MTLDepthStencilState> getDepthStencilState(const mtl::DepthStencilDesc &desc)
     {
         return mStateCache.getDepthStencilState(getMetalDevice(), desc);
@@ -185,6 +190,10 @@ class DisplayMtl : public DisplayImpl
     mutable mtl::FormatTable mFormatTable;
     mtl::StateCache mStateCache;
     mtl::RenderUtils mUtils;
+    mtl::BufferHeapAllocator mBufferHeapAllocator;
+
+    // Used to read from the blob cache.
+    mutable angle::ScratchBuffer mScratchBuffer;
 
     // Built-in Shaders
     std::shared_ptr<DefaultShaderAsyncInfoMtl> mDefaultShadersAsyncInfo;
@@ -60,7 +60,9 @@ struct DefaultShaderAsyncInfoMtl
 };
 
 // DisplayMtl implementation
-DisplayMtl::DisplayMtl(const egl::DisplayState &state) : DisplayImpl(state), mUtils(this) {}
+DisplayMtl::DisplayMtl(const egl::DisplayState &state)
+    : DisplayImpl(state), mUtils(this), mScratchBuffer(1000u)
+{}
 
 DisplayMtl::~DisplayMtl() {}
 
@@ -102,6 +104,14 @@ angle::Result DisplayMtl::initializeImpl(egl::Display *display)
             initializeFeatures();
         }
 
+#if ANGLE_MTL_EVENT_AVAILABLE
+        if (mFeatures.hasEvents.enabled)
+        {
+            // Track command buffer completion and fence syncs with a single shared event timeline.
+            mCmdQueue.enableSerialEvent(mMetalDevice.get());
+        }
+#endif
+
         ANGLE_TRY(mFormatTable.initialize(this));
         ANGLE_TRY(initializeShaderLibrary());
 
@@ -113,6 +123,7 @@ void DisplayMtl::terminate()
 {
     mUtils.onDestroy();
     mCmdQueue.reset();
+    mBufferHeapAllocator.destroy();
     mDefaultShadersAsyncInfo = nullptr;
     mMetalDevice             = nil;
 #if ANGLE_MTL_EVENT_AVAILABLE
@@ -831,6 +842,13 @@ void DisplayMtl::initializeFeatures()
     // D24S8 is unreliable on AMD.
     ANGLE_FEATURE_CONDITION((&mFeatures), forceD24S8AsUnsupported, isAMD());
 
+    // Not enabled by default until it is validated on all tier 2 devices.
+    ANGLE_FEATURE_CONDITION((&mFeatures), useTextureArgumentBuffers, false);
+
+    // Shared storage heaps with tracked hazards need an Apple GPU and Metal 2.2.
+    ANGLE_FEATURE_CONDITION((&mFeatures), allocateStreamingBuffersFromHeap,
+                            isMetal2_2 && supportsAppleGPUFamily(1));
+
     // Base Vertex drawing is only supported since GPU family 3.
     ANGLE_FEATURE_CONDITION((&mFeatures), hasBaseVertexInstancedDraw,
                             isOSX || isCatalyst || supportsAppleGPUFamily(3));
@@ -106,6 +106,15 @@ class FramebufferMtl : public FramebufferImpl
     void onStartedDrawingToFrameBuffer(const gl::Context *context);
     void onFrameEnd(const gl::Context *context);
 
+    // Invalidated attachments are discarded at the end of the render pass until they are drawn
+    // to again.  Call this before writing to the attachments to keep their new content.
+    bool hasInvalidatedAttachments() const
+    {
+        return mInvalidatedColorBuffers.any() || mInvalidatedDepthBuffer ||
+               mInvalidatedStencilBuffer;
+    }
+    void restoreInvalidatedAttachments(ContextMtl *contextMtl);
+
     // The actual area will be adjusted based on framebuffer flipping property.
     gl::Rectangle getCorrectFlippedReadArea(const gl::Context *context,
                                             const gl::Rectangle &glArea) const;
@@ -153,6 +162,8 @@ class FramebufferMtl : public FramebufferImpl
     // Initialize load store options for a render pass's first start (i.e. not render pass resuming
     // from interruptions such as those caused by a conversion compute pass)
     void setLoadStoreActionOnRenderPassFirstStart(mtl::RenderPassAttachmentDesc *attachmentOut);
+    MTLStoreAction getDefaultStoreAction(const mtl::RenderPassAttachmentDesc &attachment) const;
+    void resetInvalidatedAttachments();
 
     // Fill RenderPassDesc with relevant attachment's info from GL front end.
     angle::Result prepareRenderPass(const gl::Context *context, mtl::RenderPassDesc *descOut);
@@ -189,6 +200,11 @@ class FramebufferMtl : public FramebufferImpl
     // as by a compute pass.
     bool mRenderPassCleanStart = false;
 
+    // Attachments whose store action was set to MTLStoreActionDontCare by invalidate().
+    gl::DrawBufferMask mInvalidatedColorBuffers;
+    bool mInvalidatedDepthBuffer   = false;
+    bool mInvalidatedStencilBuffer = false;
+
     WindowSurfaceMtl *mBackbuffer = nullptr;
     const bool mFlipY             = false;
 };
@@ -393,6 +393,9 @@ angle::Result FramebufferMtl::blitWithDraw(const gl::Context *context,
     // Use blit with draw
     mtl::RenderCommandEncoder *renderEncoder = nullptr;
 
+    // The blitted content has to be kept even if the attachments were invalidated.
+    restoreInvalidatedAttachments(contextMtl);
+
     // Blit Depth & stencil
     if (blitDepthBuffer || blitStencilBuffer)
     {
@@ -719,30 +722,90 @@ void FramebufferMtl::setLoadStoreActionOnRenderPassFirstStart(
         attachment.loadAction = MTLLoadActionLoad;
     }
 
+    attachment.storeAction = getDefaultStoreAction(attachment);
+}
+
+MTLStoreAction FramebufferMtl::getDefaultStoreAction(
+    const mtl::RenderPassAttachmentDesc &attachment) const
+{
     if (attachment.hasImplicitMSTexture())
     {
         if (mBackbuffer)
         {
             // Default action for default framebuffer is resolve and keep MS texture's content.
             // We only discard MS texture's content at the end of the frame. See onFrameEnd().
-            attachment.storeAction = MTLStoreActionStoreAndMultisampleResolve;
+            return MTLStoreActionStoreAndMultisampleResolve;
         }
-        else
+
+        // Default action is resolve but don't keep MS texture's content.
+        return MTLStoreActionMultisampleResolve;
+    }
+
+    return MTLStoreActionStore;  // Default action is store
+}
+
+void FramebufferMtl::restoreInvalidatedAttachments(ContextMtl *contextMtl)
+{
+    if (!hasInvalidatedAttachments())
+    {
+        return;
+    }
+
+    // The attachments are written to again after being invalidated, so their new content must
+    // be stored at the end of the render pass instead of being discarded.
+    bool renderPassStarted = contextMtl->hasStartedRenderPass(mRenderPassDesc);
+    mtl::RenderCommandEncoder *encoder =
+        renderPassStarted ? contextMtl->getRenderCommandEncoder() : nullptr;
+
+    for (size_t colorIndex : mInvalidatedColorBuffers)
+    {
+        mtl::RenderPassColorAttachmentDesc &colorAttachment =
+            mRenderPassDesc.colorAttachments[colorIndex];
+        colorAttachment.storeAction = getDefaultStoreAction(colorAttachment);
+        if (renderPassStarted)
         {
-            // Default action is resolve but don't keep MS texture's content.
-            attachment.storeAction = MTLStoreActionMultisampleResolve;
+            encoder->setColorStoreAction(colorAttachment.storeAction,
+                                         static_cast<uint32_t>(colorIndex));
         }
     }
-    else
+
+    if (mInvalidatedDepthBuffer)
     {
-        attachment.storeAction = MTLStoreActionStore;  // Default action is store
+        mRenderPassDesc.depthAttachment.storeAction =
+            getDefaultStoreAction(mRenderPassDesc.depthAttachment);
+        if (renderPassStarted)
+        {
+            encoder->setDepthStoreAction(mRenderPassDesc.depthAttachment.storeAction);
+        }
     }
+
+    if (mInvalidatedStencilBuffer)
+    {
+        mRenderPassDesc.stencilAttachment.storeAction =
+            getDefaultStoreAction(mRenderPassDesc.stencilAttachment);
+        if (renderPassStarted)
+        {
+            encoder->setStencilStoreAction(mRenderPassDesc.stencilAttachment.storeAction);
+        }
+    }
+
+    resetInvalidatedAttachments();
+}
+
+void FramebufferMtl::resetInvalidatedAttachments()
+{
+    mInvalidatedColorBuffers.reset();
+    mInvalidatedDepthBuffer   = false;
+    mInvalidatedStencilBuffer = false;
 }
 
 void FramebufferMtl::onStartedDrawingToFrameBuffer(const gl::Context *context)
 {
     mRenderPassCleanStart = true;
 
+    // The store actions of invalidated attachments are reset below as well.
+    resetInvalidatedAttachments();
+
     // Compute loadOp based on previous storeOp and reset storeOp flags:
     for (mtl::RenderPassColorAttachmentDesc &colorAttachment : mRenderPassDesc.colorAttachments)
     {
@@ -788,6 +851,7 @@ angle::Result FramebufferMtl::updateColorRenderTarget(const gl::Context *context
     ASSERT(colorIndexGL < mtl::kMaxRenderTargets);
     // Reset load store action
     mRenderPassDesc.colorAttachments[colorIndexGL].reset();
+    mInvalidatedColorBuffers.reset(colorIndexGL);
     return updateCachedRenderTarget(context, mState.getColorAttachment(colorIndexGL),
                                     &mColorRenderTargets[colorIndexGL]);
 }
@@ -796,6 +860,7 @@ angle::Result FramebufferMtl::updateDepthRenderTarget(const gl::Context *context
 {
     // Reset load store action
     mRenderPassDesc.depthAttachment.reset();
+    mInvalidatedDepthBuffer = false;
     return updateCachedRenderTarget(context, mState.getDepthAttachment(), &mDepthRenderTarget);
 }
 
@@ -803,6 +868,7 @@ angle::Result FramebufferMtl::updateStencilRenderTarget(const gl::Context *conte
 {
     // Reset load store action
     mRenderPassDesc.stencilAttachment.reset();
+    mInvalidatedStencilBuffer = false;
     return updateCachedRenderTarget(context, mState.getStencilAttachment(), &mStencilRenderTarget);
 }
 
@@ -1089,6 +1155,9 @@ angle::Result FramebufferMtl::clearImpl(const gl::Context *context,
         return angle::Result::Continue;
     }
 
+    // The cleared content has to be kept even if the attachments were invalidated.
+    restoreInvalidatedAttachments(contextMtl);
+
     clearOpts.clearWriteMaskArray = contextMtl->getWriteMaskArray();
     uint32_t stencilMask          = contextMtl->getStencilMask();
     if (!contextMtl->getDepthMask())
@@ -1170,6 +1239,7 @@ angle::Result FramebufferMtl::invalidateImpl(ContextMtl *contextMtl,
             mtl::RenderPassColorAttachmentDesc &colorAttachment =
                 mRenderPassDesc.colorAttachments[i];
             colorAttachment.storeAction = MTLStoreActionDontCare;
+            mInvalidatedColorBuffers.set(i);
             if (renderPassStarted)
             {
                 encoder->setColorStoreAction(MTLStoreActionDontCare, i);
@@ -1180,6 +1250,7 @@ angle::Result FramebufferMtl::invalidateImpl(ContextMtl *contextMtl,
     if (invalidateDepthBuffer && mDepthRenderTarget)
     {
         mRenderPassDesc.depthAttachment.storeAction = MTLStoreActionDontCare;
+        mInvalidatedDepthBuffer                     = true;
         if (renderPassStarted)
         {
             encoder->setDepthStoreAction(MTLStoreActionDontCare);
@@ -1189,6 +1260,7 @@ angle::Result FramebufferMtl::invalidateImpl(ContextMtl *contextMtl,
     if (invalidateStencilBuffer && mStencilRenderTarget)
     {
         mRenderPassDesc.stencilAttachment.storeAction = MTLStoreActionDontCare;
+        mInvalidatedStencilBuffer                     = true;
         if (renderPassStarted)
         {
             encoder->setStencilStoreAction(MTLStoreActionDontCare);
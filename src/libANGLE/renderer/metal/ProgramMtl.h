@@ -16,6 +16,7 @@
 
 #include "common/Optional.h"
 #include "common/utilities.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/renderer/ProgramImpl.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/metal/mtl_buffer_pool.h"
@@ -46,6 +47,9 @@ struct ProgramShaderObjVariantMtl
     // UBO's argument buffer encoder. Used when number of UBOs used exceeds number of allowed
     // discrete slots, and thus needs to encode all into one argument buffer.
     ProgramArgumentBufferEncoderMtl uboArgBufferEncoder;
+    // Textures' and samplers' argument buffer encoder. Used when the translated shader binds them
+    // through an argument buffer.
+    ProgramArgumentBufferEncoderMtl textureArgBufferEncoder;
 
     // Store reference to the TranslatedShaderInfo to easy querying mapped textures/UBO/XFB
     // bindings.
@@ -161,6 +165,9 @@ class ProgramMtl : public ProgramImpl, public mtl::RenderPipelineCacheSpecialize
     angle::Result updateTextures(const gl::Context *glContext,
                                  mtl::RenderCommandEncoder *cmdEncoder,
                                  bool forceUpdate);
+    angle::Result encodeTexturesArgumentBuffer(const gl::Context *glContext,
+                                               mtl::RenderCommandEncoder *cmdEncoder,
+                                               gl::ShaderType shaderType);
 
     angle::Result updateUniformBuffers(ContextMtl *context,
                                        mtl::RenderCommandEncoder *cmdEncoder,
@@ -187,12 +194,21 @@ class ProgramMtl : public ProgramImpl, public mtl::RenderPipelineCacheSpecialize
     angle::Result linkImpl(const gl::Context *glContext,
                            const gl::ProgramLinkedResources &resources,
                            gl::InfoLog &infoLog);
+    // Compiles the Metal libraries of all stages in parallel.  The returned event finishes the
+    // link once they are ready.
+    std::unique_ptr<LinkEvent> compileMslShaderLibsAsync(const gl::Context *context,
+                                                         gl::InfoLog &infoLog);
 
     angle::Result createMslShaderLib(mtl::Context *context,
                                      gl::ShaderType shaderType,
                                      gl::InfoLog &infoLog,
                                      mtl::TranslatedShaderInfo *translatedMslInfo);
 
+    // The descs of the render pipeline states used with the program are kept in the blob cache,
+    // so that the states can be created in the background once the same program is linked again.
+    void prewarmRenderPipelineStates(ContextMtl *context);
+    void putRenderPipelineDescsInCache(ContextMtl *context);
+
     // State for the default uniform blocks.
     struct DefaultUniformBlock final : private angle::NonCopyable
     {
@@ -239,6 +255,7 @@ class ProgramMtl : public ProgramImpl, public mtl::RenderPipelineCacheSpecialize
     std::vector<uint32_t> mArgumentBufferRenderStageUsages;
 
     mtl::RenderPipelineCache mMetalRenderPipelineCache;
+    egl::BlobCache::Key mRenderPipelineDescsCacheKey;
 };
 
 }  // namespace rx
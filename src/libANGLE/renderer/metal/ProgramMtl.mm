@@ -11,9 +11,16 @@
 
 #include <TargetConditionals.h>
 
+#include <condition_variable>
+#include <functional>
+#include <mutex>
 #include <sstream>
 
+#include <anglebase/sha1.h>
+
+#include "common/angle_version.h"
 #include "common/debug.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/ProgramLinkedResources.h"
 #include "libANGLE/renderer/metal/BufferMtl.h"
@@ -33,6 +40,155 @@ namespace
 #define SHADER_ENTRY_NAME @"main0"
 constexpr char kSpirvCrossSpecConstSuffix[] = "_tmp";
 
+// Results of compiling the Metal libraries of a program, written by Metal's completion handlers.
+struct MslLibraryAsyncInfoMtl
+{
+    gl::ShaderMap<mtl::AutoObjCPtr<id<MTLLibrary>>> libraries;
+    gl::ShaderMap<mtl::AutoObjCPtr<NSError *>> errors;
+
+    std::condition_variable cv;
+    std::mutex lock;
+
+    size_t pendingCount = 0;
+};
+
+using PostCompileFunctor = std::function<angle::Result(const gl::Context *)>;
+
+// The event for a link whose Metal libraries are compiled asynchronously.
+class MslLibraryLinkEventMtl final : public LinkEvent
+{
+  public:
+    MslLibraryLinkEventMtl(std::shared_ptr<MslLibraryAsyncInfoMtl> asyncInfo,
+                           PostCompileFunctor &&functor)
+        : mAsyncInfo(std::move(asyncInfo)), mPostCompileFunctor(std::move(functor))
+    {}
+
+    angle::Result wait(const gl::Context *context) override
+    {
+        {
+            std::unique_lock<std::mutex> lg(mAsyncInfo->lock);
+            mAsyncInfo->cv.wait(lg, [this] { return mAsyncInfo->pendingCount == 0; });
+        }
+        return mPostCompileFunctor(context);
+    }
+
+    bool isLinking() override
+    {
+        std::lock_guard<std::mutex> lg(mAsyncInfo->lock);
+        return mAsyncInfo->pendingCount != 0;
+    }
+
+  private:
+    std::shared_ptr<MslLibraryAsyncInfoMtl> mAsyncInfo;
+    PostCompileFunctor mPostCompileFunctor;
+};
+
+angle::Result CheckMslShaderLib(mtl::Context *context,
+                                gl::InfoLog &infoLog,
+                                const mtl::AutoObjCPtr<id<MTLLibrary>> &library,
+                                const mtl::AutoObjCPtr<NSError *> &err)
+{
+    if (err && !library)
+    {
+        std::ostringstream ss;
+        ss << "Internal error compiling Metal shader:\n"
+           << err.get().localizedDescription.UTF8String << "\n";
+
+        ERR() << ss.str();
+
+        infoLog << ss.str();
+
+        ANGLE_MTL_CHECK(context, false, GL_INVALID_OPERATION);
+    }
+
+    return angle::Result::Continue;
+}
+
+// The descs only apply to the same translated shaders, so the sources make up the key.
+void ComputeRenderPipelineDescsCacheKey(
+    const gl::ShaderMap<mtl::TranslatedShaderInfo> &translatedMslInfo,
+    const mtl::TranslatedShaderInfo &xfbOnlyVertexShaderInfo,
+    egl::BlobCache::Key *hashOut)
+{
+    gl::BinaryOutputStream stream;
+    stream.writeString("ANGLE Metal render pipeline descs: ");
+    stream.writeString(ANGLE_COMMIT_HASH);
+    for (gl::ShaderType shaderType : gl::kAllGLES2ShaderTypes)
+    {
+        stream.writeString(translatedMslInfo[shaderType].metalShaderSource);
+    }
+    stream.writeString(xfbOnlyVertexShaderInfo.metalShaderSource);
+
+    angle::base::SHA1HashBytes(static_cast<const unsigned char *>(stream.data()),
+                               stream.length(), hashOut->data());
+}
+
+// RenderPipelineDesc is zero initialized and compared with memcmp, so it is stored as is.
+bool GetRenderPipelineDescsFromCache(DisplayMtl *display,
+                                     const egl::BlobCache::Key &key,
+                                     std::vector<mtl::RenderPipelineDesc> *descsOut)
+{
+    egl::BlobCache *blobCache = display->getBlobCache();
+    if (blobCache == nullptr)
+    {
+        return false;
+    }
+
+    egl::BlobCache::Value compressedData;
+    size_t compressedSize = 0;
+    if (!blobCache->get(display->getScratchBuffer(), key, &compressedData, &compressedSize))
+    {
+        return false;
+    }
+
+    angle::MemoryBuffer uncompressedData;
+    if (!egl::DecompressBlobCacheData(compressedData.data(), compressedSize, &uncompressedData))
+    {
+        return false;
+    }
+
+    gl::BinaryInputStream stream(uncompressedData.data(), uncompressedData.size());
+    uint32_t descSize  = stream.readInt<uint32_t>();
+    uint32_t descCount = stream.readInt<uint32_t>();
+    if (stream.error() || descSize != sizeof(mtl::RenderPipelineDesc) ||
+        stream.remainingSize() != static_cast<size_t>(descCount) * descSize)
+    {
+        WARN() << "Ignoring corrupted cached Metal render pipeline descs.";
+        return false;
+    }
+
+    descsOut->resize(descCount);
+    stream.readBytes(reinterpret_cast<unsigned char *>(descsOut->data()),
+                     stream.remainingSize());
+    return true;
+}
+
+void PutRenderPipelineDescsInCache(DisplayMtl *display,
+                                   const egl::BlobCache::Key &key,
+                                   const std::vector<mtl::RenderPipelineDesc> &descs)
+{
+    egl::BlobCache *blobCache = display->getBlobCache();
+    if (blobCache == nullptr)
+    {
+        return;
+    }
+
+    gl::BinaryOutputStream stream;
+    stream.writeInt(static_cast<uint32_t>(sizeof(mtl::RenderPipelineDesc)));
+    stream.writeInt(static_cast<uint32_t>(descs.size()));
+    stream.writeBytes(reinterpret_cast<const unsigned char *>(descs.data()),
+                      descs.size() * sizeof(mtl::RenderPipelineDesc));
+
+    angle::MemoryBuffer compressedData;
+    if (!egl::CompressBlobCacheData(stream.length(), static_cast<const uint8_t *>(stream.data()),
+                                    &compressedData))
+    {
+        return;
+    }
+
+    blobCache->put(key, std::move(compressedData));
+}
+
 template <typename T>
 class ScopedAutoClearVector
 {
@@ -219,6 +375,7 @@ void ProgramShaderObjVariantMtl::reset(ContextMtl *contextMtl)
     metalShader = nil;
 
     uboArgBufferEncoder.reset(contextMtl);
+    textureArgBufferEncoder.reset(contextMtl);
 
     translatedSrcInfo = nullptr;
 }
@@ -300,8 +457,13 @@ std::unique_ptr<LinkEvent> ProgramMtl::link(const gl::Context *context,
     // assignment done in that function.
     linkResources(resources);
 
-    // NOTE(hqle): Parallelize linking.
-    return std::make_unique<LinkEventDone>(linkImpl(context, resources, infoLog));
+    angle::Result result = linkImpl(context, resources, infoLog);
+    if (result != angle::Result::Continue)
+    {
+        return std::make_unique<LinkEventDone>(result);
+    }
+
+    return compileMslShaderLibsAsync(context, infoLog);
 }
 
 angle::Result ProgramMtl::linkImpl(const gl::Context *glContext,
@@ -341,14 +503,56 @@ angle::Result ProgramMtl::linkImpl(const gl::Context *glContext,
                                   &xfbOnlyShaderCodes[gl::ShaderType::Vertex],
                                   &mMslShaderTranslateInfo, &mMslXfbOnlyVertexShaderInfo));
 
-    for (gl::ShaderType shaderType : gl::kAllGLES2ShaderTypes)
+    return angle::Result::Continue;
+}
+
+std::unique_ptr<LinkEvent> ProgramMtl::compileMslShaderLibsAsync(const gl::Context *context,
+                                                                 gl::InfoLog &infoLog)
+{
+    ContextMtl *contextMtl  = mtl::GetImpl(context);
+    id<MTLDevice> mtlDevice = contextMtl->getDisplay()->getMetalDevice();
+
+    // The completion handlers hold a reference to the results, since they may be called after the
+    // link event is gone.
+    std::shared_ptr<MslLibraryAsyncInfoMtl> asyncInfo = std::make_shared<MslLibraryAsyncInfoMtl>();
+    asyncInfo->pendingCount                           = gl::kAllGLES2ShaderTypes.size();
+
+    ANGLE_MTL_OBJC_SCOPE
     {
-        // Create actual Metal shader library
-        ANGLE_TRY(createMslShaderLib(contextMtl, shaderType, infoLog,
-                                     &mMslShaderTranslateInfo[shaderType]));
+        for (gl::ShaderType shaderType : gl::kAllGLES2ShaderTypes)
+        {
+            // Metal may read the source after this returns, so it is copied.
+            auto nsSource = [NSString
+                stringWithUTF8String:mMslShaderTranslateInfo[shaderType].metalShaderSource.c_str()];
+            auto options  = [[[MTLCompileOptions alloc] init] ANGLE_MTL_AUTORELEASE];
+            [mtlDevice newLibraryWithSource:nsSource
+                                    options:options
+                          completionHandler:^(id<MTLLibrary> library, NSError *error) {
+                            std::unique_lock<std::mutex> lg(asyncInfo->lock);
+
+                            asyncInfo->libraries[shaderType] = std::move(library);
+                            asyncInfo->errors[shaderType]    = std::move(error);
+
+                            asyncInfo->pendingCount--;
+                            asyncInfo->cv.notify_one();
+                          }];
+        }
     }
 
-    return angle::Result::Continue;
+    auto postCompileTask = [this, &infoLog, asyncInfo](const gl::Context *glContext) {
+        for (gl::ShaderType shaderType : gl::kAllGLES2ShaderTypes)
+        {
+            ANGLE_TRY(CheckMslShaderLib(mtl::GetImpl(glContext), infoLog,
+                                        asyncInfo->libraries[shaderType],
+                                        asyncInfo->errors[shaderType]));
+            mMslShaderTranslateInfo[shaderType].metalLibrary = asyncInfo->libraries[shaderType];
+        }
+
+        prewarmRenderPipelineStates(mtl::GetImpl(glContext));
+        return angle::Result::Continue;
+    };
+
+    return std::make_unique<MslLibraryLinkEventMtl>(std::move(asyncInfo), postCompileTask);
 }
 
 void ProgramMtl::linkResources(const gl::ProgramLinkedResources &resources)
@@ -545,11 +749,36 @@ angle::Result ProgramMtl::getSpecializedShader(mtl::Context *context,
                                   mtl::kUBOArgumentBufferBindingIndex,
                                   &shaderVariant->uboArgBufferEncoder);
     }
+    if (translatedMslInfo->hasTextureArgumentBuffer)
+    {
+        InitArgumentBufferEncoder(context, shaderVariant->metalShader,
+                                  mtl::kTextureArgumentBufferBindingIndex,
+                                  &shaderVariant->textureArgBufferEncoder);
+    }
 
     *shaderOut = shaderVariant->metalShader;
 
     return angle::Result::Continue;
 }
+void ProgramMtl::prewarmRenderPipelineStates(ContextMtl *context)
+{
+    ComputeRenderPipelineDescsCacheKey(mMslShaderTranslateInfo, mMslXfbOnlyVertexShaderInfo,
+                                       &mRenderPipelineDescsCacheKey);
+
+    std::vector<mtl::RenderPipelineDesc> descs;
+    if (GetRenderPipelineDescsFromCache(context->getDisplay(), mRenderPipelineDescsCacheKey,
+                                        &descs))
+    {
+        mMetalRenderPipelineCache.prewarmRenderPipelineStates(context, descs);
+    }
+}
+
+void ProgramMtl::putRenderPipelineDescsInCache(ContextMtl *context)
+{
+    PutRenderPipelineDescsInCache(context->getDisplay(), mRenderPipelineDescsCacheKey,
+                                  mMetalRenderPipelineCache.getRenderPipelineDescs());
+}
+
 bool ProgramMtl::hasSpecializedShader(gl::ShaderType shaderType,
                                       const mtl::RenderPipelineDesc &renderPipelineDesc)
 {
@@ -570,20 +799,7 @@ angle::Result ProgramMtl::createMslShaderLib(mtl::Context *context,
         mtl::AutoObjCPtr<NSError *> err = nil;
         translatedMslInfo->metalLibrary =
             mtl::CreateShaderLibrary(mtlDevice, translatedMslInfo->metalShaderSource, &err);
-        if (err && !translatedMslInfo->metalLibrary)
-        {
-            std::ostringstream ss;
-            ss << "Internal error compiling Metal shader:\n"
-               << err.get().localizedDescription.UTF8String << "\n";
-
-            ERR() << ss.str();
-
-            infoLog << ss.str();
-
-            ANGLE_MTL_CHECK(context, false, GL_INVALID_OPERATION);
-        }
-
-        return angle::Result::Continue;
+        return CheckMslShaderLib(context, infoLog, translatedMslInfo->metalLibrary, err);
     }
 }
 
@@ -878,6 +1094,7 @@ angle::Result ProgramMtl::setupDraw(const gl::Context *glContext,
     if (pipelineDescChanged)
     {
         // Render pipeline state needs to be changed
+        size_t pipelineStateCount = mMetalRenderPipelineCache.getRenderPipelineStateCount();
         id<MTLRenderPipelineState> pipelineState =
             mMetalRenderPipelineCache.getRenderPipelineState(context, pipelineDesc);
         if (!pipelineState)
@@ -887,6 +1104,11 @@ angle::Result ProgramMtl::setupDraw(const gl::Context *glContext,
         }
         cmdEncoder->setRenderPipelineState(pipelineState);
 
+        if (mMetalRenderPipelineCache.getRenderPipelineStateCount() != pipelineStateCount)
+        {
+            putRenderPipelineDescsInCache(context);
+        }
+
         // We need to rebind uniform buffers & textures also
         mDefaultUniformBlocksDirty.set();
         mSamplerBindingsDirty.set();
@@ -959,6 +1181,12 @@ angle::Result ProgramMtl::updateTextures(const gl::Context *glContext,
         const mtl::TranslatedShaderInfo &shaderInfo =
             *mCurrentShaderVariants[shaderType]->translatedSrcInfo;
 
+        if (shaderInfo.hasTextureArgumentBuffer)
+        {
+            ANGLE_TRY(encodeTexturesArgumentBuffer(glContext, cmdEncoder, shaderType));
+            continue;
+        }
+
         for (uint32_t textureIndex = 0; textureIndex < mState.getSamplerBindings().size();
              ++textureIndex)
         {
@@ -1012,6 +1240,90 @@ angle::Result ProgramMtl::updateTextures(const gl::Context *glContext,
     return angle::Result::Continue;
 }
 
+angle::Result ProgramMtl::encodeTexturesArgumentBuffer(const gl::Context *glContext,
+                                                       mtl::RenderCommandEncoder *cmdEncoder,
+                                                       gl::ShaderType shaderType)
+{
+    ContextMtl *contextMtl = mtl::GetImpl(glContext);
+    const auto &glState    = glContext->getState();
+
+    const gl::ActiveTexturesCache &completeTextures = glState.getActiveTexturesCache();
+    const mtl::TranslatedShaderInfo &shaderInfo =
+        *mCurrentShaderVariants[shaderType]->translatedSrcInfo;
+
+    // Encode all textures and samplers into an argument buffer.
+    ProgramArgumentBufferEncoderMtl &bufferEncoder =
+        mCurrentShaderVariants[shaderType]->textureArgBufferEncoder;
+    ANGLE_MTL_CHECK(contextMtl, bufferEncoder.metalArgBufferEncoder, GL_INVALID_OPERATION);
+
+    mtl::BufferRef argumentBuffer;
+    size_t argumentBufferOffset;
+    bufferEncoder.bufferPool.releaseInFlightBuffers(contextMtl);
+    ANGLE_TRY(bufferEncoder.bufferPool.allocate(
+        contextMtl, bufferEncoder.metalArgBufferEncoder.get().encodedLength, nullptr,
+        &argumentBuffer, &argumentBufferOffset));
+
+    [bufferEncoder.metalArgBufferEncoder setArgumentBuffer:argumentBuffer->get()
+                                                    offset:argumentBufferOffset];
+
+    const mtl::RenderStages mtlRenderStage = shaderType == gl::ShaderType::Vertex
+                                                 ? mtl::kRenderStageVertex
+                                                 : mtl::kRenderStageFragment;
+
+    for (uint32_t textureIndex = 0; textureIndex < mState.getSamplerBindings().size();
+         ++textureIndex)
+    {
+        const gl::SamplerBinding &samplerBinding = mState.getSamplerBindings()[textureIndex];
+        const mtl::SamplerBinding &mslBinding    = shaderInfo.actualSamplerBindings[textureIndex];
+        if (mslBinding.textureBinding >= mtl::kMaxTextureArgumentBufferIds)
+        {
+            // Not used by this shader
+            continue;
+        }
+
+        gl::TextureType textureType = samplerBinding.textureType;
+
+        for (uint32_t arrayElement = 0; arrayElement < samplerBinding.boundTextureUnits.size();
+             ++arrayElement)
+        {
+            GLuint textureUnit   = samplerBinding.boundTextureUnits[arrayElement];
+            gl::Texture *texture = completeTextures[textureUnit];
+            gl::Sampler *sampler = contextMtl->getState().getSampler(textureUnit);
+            if (!texture)
+            {
+                ANGLE_TRY(contextMtl->getIncompleteTexture(glContext, textureType, &texture));
+            }
+
+            // Shadow samplers are validated the same way as in updateTextures().
+            const gl::SamplerState *samplerState =
+                sampler ? &sampler->getSamplerState() : &texture->getSamplerState();
+            if (samplerBinding.format == gl::SamplerFormat::Shadow &&
+                ANGLE_UNLIKELY(samplerState->getCompareMode() != GL_COMPARE_REF_TO_TEXTURE))
+            {
+                ERR() << "GL_TEXTURE_COMPARE_MODE != GL_COMPARE_REF_TO_TEXTURE is not supported";
+                ANGLE_MTL_TRY(contextMtl, false);
+            }
+
+            TextureMtl *textureMtl = mtl::GetImpl(texture);
+            ANGLE_TRY(textureMtl->encodeToArgumentBuffer(
+                glContext, cmdEncoder, bufferEncoder.metalArgBufferEncoder, mtlRenderStage,
+                sampler, mslBinding.textureBinding + arrayElement,
+                mslBinding.samplerBinding + arrayElement));
+        }  // for array elements
+    }      // for sampler bindings
+
+    ANGLE_TRY(bufferEncoder.bufferPool.commit(contextMtl));
+
+    cmdEncoder->setBuffer(shaderType, argumentBuffer, static_cast<uint32_t>(argumentBufferOffset),
+                          mtl::kTextureArgumentBufferBindingIndex);
+
+    // Unlike discrete bindings, which the encoder deduplicates, the argument buffer is only
+    // encoded again when the textures or the pipeline change.
+    mSamplerBindingsDirty.reset(shaderType);
+
+    return angle::Result::Continue;
+}
+
 angle::Result ProgramMtl::updateUniformBuffers(ContextMtl *context,
                                                mtl::RenderCommandEncoder *cmdEncoder,
                                                const mtl::RenderPipelineDesc &pipelineDesc)
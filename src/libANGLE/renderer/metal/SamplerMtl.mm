@@ -34,6 +34,10 @@ const mtl::AutoObjCPtr<id<MTLSamplerState>> &SamplerMtl::getSampler(ContextMtl *
         DisplayMtl *displayMtl = contextMtl->getDisplay();
 
         mtl::SamplerDesc samplerDesc(mState);
+        if (displayMtl->getFeatures().useTextureArgumentBuffers.enabled)
+        {
+            samplerDesc.enableArgumentBuffers(mState);
+        }
 
         mSamplerState =
             displayMtl->getStateCache().getSamplerState(displayMtl->getMetalDevice(), samplerDesc);
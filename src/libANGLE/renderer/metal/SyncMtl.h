@@ -53,8 +53,11 @@ class Sync
     angle::Result getStatus(bool *signaled);
 
   private:
+    // Either the command queue's serial event, waited on for the serial of the command buffer the
+    // sync was set in, or an event owned by this sync if the queue has no serial event.
     SharedEventRef mMetalSharedEvent;
-    uint64_t mSetCounter = 0;
+    uint64_t mSignalValue = 0;
+    bool mUsesQueueSerial = false;
 
     std::shared_ptr<std::condition_variable> mCv;
     std::shared_ptr<std::mutex> mLock;
@@ -9,7 +9,9 @@
 
 #include "libANGLE/renderer/metal/SyncMtl.h"
 
+#include <algorithm>
 #include <chrono>
+#include <limits>
 
 #include "common/debug.h"
 #include "libANGLE/Context.h"
@@ -29,18 +31,32 @@ Sync::~Sync() {}
 void Sync::onDestroy()
 {
     mMetalSharedEvent = nil;
+    mUsesQueueSerial  = false;
     mCv               = nullptr;
     mLock             = nullptr;
 }
 
 angle::Result Sync::initialize(ContextMtl *contextMtl)
 {
-    ANGLE_MTL_OBJC_SCOPE
+    const SharedEventRef &serialEvent = contextMtl->cmdQueue().getSerialEvent();
+    if (serialEvent.get())
     {
-        mMetalSharedEvent = [[contextMtl->getMetalDevice() newSharedEvent] ANGLE_MTL_AUTORELEASE];
+        // The queue's event is shared by every context of the display, so no event needs to be
+        // created and other contexts can wait on it as well.
+        mMetalSharedEvent = serialEvent;
+        mUsesQueueSerial  = true;
+    }
+    else
+    {
+        ANGLE_MTL_OBJC_SCOPE
+        {
+            mMetalSharedEvent =
+                [[contextMtl->getMetalDevice() newSharedEvent] ANGLE_MTL_AUTORELEASE];
+        }
+        mUsesQueueSerial = false;
     }
 
-    mSetCounter = mMetalSharedEvent.get().signaledValue;
+    mSignalValue = mMetalSharedEvent.get().signaledValue;
 
     mCv.reset(new std::condition_variable());
     mLock.reset(new std::mutex());
@@ -56,8 +72,17 @@ angle::Result Sync::set(ContextMtl *contextMtl, GLenum condition, GLbitfield fla
     ASSERT(condition == GL_SYNC_GPU_COMMANDS_COMPLETE);
     ASSERT(flags == 0);
 
-    mSetCounter++;
-    contextMtl->queueEventSignal(mMetalSharedEvent, mSetCounter);
+    if (mUsesQueueSerial)
+    {
+        // The command buffer signals its serial once all of its commands, including the ones
+        // recorded before this sync, are done.
+        mSignalValue = contextMtl->getCurrentCommandBufferQueueSerial();
+    }
+    else
+    {
+        mSignalValue++;
+        contextMtl->queueEventSignal(mMetalSharedEvent, mSignalValue);
+    }
     return angle::Result::Continue;
 }
 angle::Result Sync::clientWait(ContextMtl *contextMtl,
@@ -66,7 +91,7 @@ angle::Result Sync::clientWait(ContextMtl *contextMtl,
                                GLenum *outResult)
 {
     std::unique_lock<std::mutex> lg(*mLock);
-    if (mMetalSharedEvent.get().signaledValue >= mSetCounter)
+    if (mMetalSharedEvent.get().signaledValue >= mSignalValue)
     {
         *outResult = GL_ALREADY_SIGNALED;
         return angle::Result::Continue;
@@ -91,31 +116,49 @@ angle::Result Sync::clientWait(ContextMtl *contextMtl,
     AutoObjCObj<MTLSharedEventListener> eventListener =
         contextMtl->getDisplay()->getOrCreateSharedEventListener();
     [mMetalSharedEvent.get() notifyListener:eventListener
-                                    atValue:mSetCounter
+                                    atValue:mSignalValue
                                       block:^(id<MTLSharedEvent> sharedEvent, uint64_t value) {
                                         std::unique_lock<std::mutex> lg(*lockRef);
                                         cvRef->notify_one();
                                       }];
 
-    if (!mCv->wait_for(lg, std::chrono::nanoseconds(timeout),
-                       [this] { return mMetalSharedEvent.get().signaledValue >= mSetCounter; }))
+    // GL_TIMEOUT_IGNORED and EGL_FOREVER_KHR don't fit in a signed duration.
+    const uint64_t maxTimeout = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+    if (!mCv->wait_for(lg, std::chrono::nanoseconds(std::min(timeout, maxTimeout)),
+                       [this] { return mMetalSharedEvent.get().signaledValue >= mSignalValue; }))
     {
         *outResult = GL_TIMEOUT_EXPIRED;
         return angle::Result::Incomplete;
     }
 
-    ASSERT(mMetalSharedEvent.get().signaledValue >= mSetCounter);
+    ASSERT(mMetalSharedEvent.get().signaledValue >= mSignalValue);
     *outResult = GL_CONDITION_SATISFIED;
 
     return angle::Result::Continue;
 }
 void Sync::serverWait(ContextMtl *contextMtl)
 {
-    contextMtl->serverWaitEvent(mMetalSharedEvent, mSetCounter);
+    if (mUsesQueueSerial)
+    {
+        uint64_t currentSerial = contextMtl->getCurrentCommandBufferQueueSerial();
+        if (mSignalValue == currentSerial)
+        {
+            // The sync was set in the command buffer being recorded, whose commands already
+            // execute in order.
+            return;
+        }
+        if (mSignalValue > currentSerial)
+        {
+            // The sync's command buffer was enqueued after the current one, so waiting for it here
+            // would never finish. Commit the current one first.
+            contextMtl->flushCommandBufer();
+        }
+    }
+    contextMtl->serverWaitEvent(mMetalSharedEvent, mSignalValue);
 }
 angle::Result Sync::getStatus(bool *signaled)
 {
-    *signaled = mMetalSharedEvent.get().signaledValue >= mSetCounter;
+    *signaled = mMetalSharedEvent.get().signaledValue >= mSignalValue;
     return angle::Result::Continue;
 }
 #endif  // #if ANGLE_MTL_EVENT_AVAILABLE
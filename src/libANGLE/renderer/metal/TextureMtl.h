@@ -165,6 +165,15 @@ class TextureMtl : public TextureImpl
                                gl::Sampler *sampler, /** nullable */
                                int textureSlotIndex,
                                int samplerSlotIndex);
+    // Encodes the texture and its sampler into the argument buffer that |argumentEncoder| is set
+    // to, and marks the texture as used by |stages| of |cmdEncoder|.
+    angle::Result encodeToArgumentBuffer(const gl::Context *context,
+                                         mtl::RenderCommandEncoder *cmdEncoder,
+                                         id<MTLArgumentEncoder> argumentEncoder,
+                                         mtl::RenderStages stages,
+                                         gl::Sampler *sampler, /** nullable */
+                                         int textureIndex,
+                                         int samplerIndex);
 
     const mtl::Format &getFormat() const { return mFormat; }
     const mtl::TextureRef &getNativeTexture() const { return mNativeTexture; }
@@ -178,6 +187,12 @@ class TextureMtl : public TextureImpl
                                       const gl::Extents &size);
     angle::Result onBaseMaxLevelsChanged(const gl::Context *context);
     angle::Result ensureSamplerStateCreated(const gl::Context *context);
+    // Creates the sampling view if needed and returns the sampler state to use with it.
+    void getShaderResources(const gl::Context *context,
+                            gl::Sampler *sampler, /** nullable */
+                            id<MTLSamplerState> *samplerStateOut,
+                            float *minLodClampOut,
+                            float *maxLodClampOut);
     // Ensure image at given index is created:
     angle::Result ensureImageCreated(const gl::Context *context, const gl::ImageIndex &index);
     // Ensure all image views at all faces/levels are retained.
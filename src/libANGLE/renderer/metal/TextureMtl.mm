@@ -666,6 +666,11 @@ angle::Result TextureMtl::ensureSamplerStateCreated(const gl::Context *context)
         samplerDesc.maxAnisotropy = 1;
     }
 
+    if (displayMtl->getFeatures().useTextureArgumentBuffers.enabled)
+    {
+        samplerDesc.enableArgumentBuffers(mState.getSamplerState());
+    }
+
     mMetalSamplerState =
         displayMtl->getStateCache().getSamplerState(displayMtl->getMetalDevice(), samplerDesc);
 
@@ -1329,11 +1334,49 @@ angle::Result TextureMtl::bindToShader(const gl::Context *context,
                                        int textureSlotIndex,
                                        int samplerSlotIndex)
 {
-    ASSERT(mNativeTexture);
+    float minLodClamp;
+    float maxLodClamp;
+    id<MTLSamplerState> samplerState;
+    getShaderResources(context, sampler, &samplerState, &minLodClamp, &maxLodClamp);
 
+    cmdEncoder->setTexture(shaderType, mNativeSwizzleSamplingView, textureSlotIndex);
+    cmdEncoder->setSamplerState(shaderType, samplerState, minLodClamp, maxLodClamp,
+                                samplerSlotIndex);
+
+    return angle::Result::Continue;
+}
+
+angle::Result TextureMtl::encodeToArgumentBuffer(const gl::Context *context,
+                                                 mtl::RenderCommandEncoder *cmdEncoder,
+                                                 id<MTLArgumentEncoder> argumentEncoder,
+                                                 mtl::RenderStages stages,
+                                                 gl::Sampler *sampler,
+                                                 int textureIndex,
+                                                 int samplerIndex)
+{
+    // The LOD clamps are also part of the sampler state objects, see mtl::SamplerDesc.
     float minLodClamp;
     float maxLodClamp;
     id<MTLSamplerState> samplerState;
+    getShaderResources(context, sampler, &samplerState, &minLodClamp, &maxLodClamp);
+
+    [argumentEncoder setTexture:mNativeSwizzleSamplingView->get() atIndex:textureIndex];
+    [argumentEncoder setSamplerState:samplerState atIndex:samplerIndex];
+
+    // Textures referenced through an argument buffer must be made resident explicitly.
+    cmdEncoder->useResource(mNativeSwizzleSamplingView,
+                            MTLResourceUsageRead | MTLResourceUsageSample, stages);
+
+    return angle::Result::Continue;
+}
+
+void TextureMtl::getShaderResources(const gl::Context *context,
+                                    gl::Sampler *sampler,
+                                    id<MTLSamplerState> *samplerStateOut,
+                                    float *minLodClampOut,
+                                    float *maxLodClampOut)
+{
+    ASSERT(mNativeTexture);
 
     if (!mNativeSwizzleSamplingView)
     {
@@ -1365,27 +1408,21 @@ angle::Result TextureMtl::bindToShader(const gl::Context *context,
         }
     }
 
+    const gl::SamplerState *glSamplerState;
     if (!sampler)
     {
-        samplerState = mMetalSamplerState;
-        minLodClamp  = mState.getSamplerState().getMinLod();
-        maxLodClamp  = mState.getSamplerState().getMaxLod();
+        *samplerStateOut = mMetalSamplerState;
+        glSamplerState   = &mState.getSamplerState();
     }
     else
     {
         SamplerMtl *samplerMtl = mtl::GetImpl(sampler);
-        samplerState           = samplerMtl->getSampler(mtl::GetImpl(context));
-        minLodClamp            = sampler->getSamplerState().getMinLod();
-        maxLodClamp            = sampler->getSamplerState().getMaxLod();
+        *samplerStateOut       = samplerMtl->getSampler(mtl::GetImpl(context));
+        glSamplerState         = &sampler->getSamplerState();
     }
 
-    minLodClamp = std::max(minLodClamp, 0.f);
-
-    cmdEncoder->setTexture(shaderType, mNativeSwizzleSamplingView, textureSlotIndex);
-    cmdEncoder->setSamplerState(shaderType, samplerState, minLodClamp, maxLodClamp,
-                                samplerSlotIndex);
-
-    return angle::Result::Continue;
+    *minLodClampOut = std::max(glSamplerState->getMinLod(), 0.f);
+    *maxLodClampOut = glSamplerState->getMaxLod();
 }
 
 angle::Result TextureMtl::redefineImage(const gl::Context *context,
@@ -13,6 +13,8 @@
 #include "libANGLE/renderer/metal/mtl_resources.h"
 
 #include <deque>
+#include <mutex>
+#include <vector>
 
 namespace rx
 {
@@ -36,6 +38,29 @@ enum class BufferPoolMemPolicy
     Auto,
 };
 
+// Suballocates the small shared memory buffers of every buffer pool of a display from a bounded
+// number of MTLHeaps, so that streaming data doesn't need a new device allocation each time. A
+// buffer's memory returns to its heap once the last reference to it is released, which buffer
+// pools only do after the GPU is done with it.
+class BufferHeapAllocator : angle::NonCopyable
+{
+  public:
+    BufferHeapAllocator();
+    ~BufferHeapAllocator();
+
+    void destroy();
+
+    // *bufferOut is null if the buffer is too big to be suballocated or all the heaps are full, in
+    // which case the caller should create a buffer on its own.
+    angle::Result allocate(ContextMtl *contextMtl, size_t size, BufferRef *bufferOut);
+
+  private:
+    std::vector<AutoObjCPtr<id<MTLHeap>>> mHeaps;
+
+    // Buffer pools of different contexts may allocate concurrently.
+    std::mutex mLock;
+};
+
 // A buffer pool is conceptually an infinitely long buffer. Each time you write to the buffer,
 // you will always write to a previously unused portion. After a series of writes, you must flush
 // the buffer data to the device. Buffer lifetime currently assumes that each new allocation will
@@ -46,7 +71,8 @@ enum class BufferPoolMemPolicy
 //
 // Internally buffer pool keeps a collection of mtl::Buffer. When we write past the end of a
 // currently active mtl::Buffer we keep it until it is no longer in use. We then mark it available
-// for future allocations in a free list.
+// for future allocations in a free list. Small shared memory buffers are suballocated from the
+// display's BufferHeapAllocator when the allocateStreamingBuffersFromHeap feature is enabled.
 class BufferPool
 {
   public:
@@ -9,6 +9,8 @@
 
 #include "libANGLE/renderer/metal/mtl_buffer_pool.h"
 
+#include <algorithm>
+
 #include "libANGLE/renderer/metal/ContextMtl.h"
 #include "libANGLE/renderer/metal/DisplayMtl.h"
 
@@ -18,6 +20,84 @@ namespace rx
 namespace mtl
 {
 
+namespace
+{
+constexpr size_t kBufferHeapSize = 4 * 1024 * 1024;
+// Bounds the memory used by the heaps to 32 MiB. Allocations past that fall back to dedicated
+// buffers.
+constexpr size_t kMaxBufferHeaps = 8;
+}  // namespace
+
+// BufferHeapAllocator implementation.
+BufferHeapAllocator::BufferHeapAllocator() = default;
+
+BufferHeapAllocator::~BufferHeapAllocator() = default;
+
+void BufferHeapAllocator::destroy()
+{
+    std::lock_guard<std::mutex> lg(mLock);
+    mHeaps.clear();
+}
+
+angle::Result BufferHeapAllocator::allocate(ContextMtl *contextMtl,
+                                            size_t size,
+                                            BufferRef *bufferOut)
+{
+    bufferOut->reset();
+    if (size > kSharedMemBufferMaxBufSizeHint)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        id<MTLDevice> metalDevice = contextMtl->getMetalDevice();
+        MTLSizeAndAlign sizeAndAlign =
+            [metalDevice heapBufferSizeAndAlignWithLength:size
+                                                  options:MTLResourceStorageModeShared];
+
+        std::lock_guard<std::mutex> lg(mLock);
+
+        for (AutoObjCPtr<id<MTLHeap>> &heap : mHeaps)
+        {
+            if ([heap.get() maxAvailableSizeWithAlignment:sizeAndAlign.align] >= sizeAndAlign.size)
+            {
+                ANGLE_TRY(Buffer::MakeBufferFromHeap(contextMtl, heap.get(), size, bufferOut));
+                if (*bufferOut)
+                {
+                    return angle::Result::Continue;
+                }
+            }
+        }
+
+        if (mHeaps.size() >= kMaxBufferHeaps)
+        {
+            return angle::Result::Continue;
+        }
+
+        MTLHeapDescriptor *heapDesc = [[MTLHeapDescriptor new] ANGLE_MTL_AUTORELEASE];
+        heapDesc.size               = kBufferHeapSize;
+        heapDesc.storageMode        = MTLStorageModeShared;
+        heapDesc.cpuCacheMode       = MTLCPUCacheModeDefaultCache;
+        if (ANGLE_APPLE_AVAILABLE_XCI(10.15, 13.0, 13.0))
+        {
+            // Some of the buffers are written by GPU, e.g. index conversion, so hazards must be
+            // tracked like for other buffers.
+            heapDesc.hazardTrackingMode = MTLHazardTrackingModeTracked;
+        }
+
+        AutoObjCPtr<id<MTLHeap>> heap =
+            [[metalDevice newHeapWithDescriptor:heapDesc] ANGLE_MTL_AUTORELEASE];
+        if (!heap)
+        {
+            return angle::Result::Continue;
+        }
+        mHeaps.push_back(heap);
+
+        return Buffer::MakeBufferFromHeap(contextMtl, heap.get(), size, bufferOut);
+    }
+}
+
 // BufferPool implementation.
 BufferPool::BufferPool() : BufferPool(false) {}
 BufferPool::BufferPool(bool alwaysAllocNewBuffer)
@@ -158,9 +238,17 @@ angle::Result BufferPool::allocateNewBuffer(ContextMtl *contextMtl)
         return angle::Result::Continue;
     }
 
-    bool useSharedMem = shouldAllocateInSharedMem(contextMtl);
-    ANGLE_TRY(
-        Buffer::MakeBufferWithSharedMemOpt(contextMtl, useSharedMem, mSize, nullptr, &mBuffer));
+    bool useSharedMem   = shouldAllocateInSharedMem(contextMtl);
+    DisplayMtl *display = contextMtl->getDisplay();
+    if (useSharedMem && display->getFeatures().allocateStreamingBuffersFromHeap.enabled)
+    {
+        ANGLE_TRY(display->getBufferHeapAllocator().allocate(contextMtl, mSize, &mBuffer));
+    }
+    if (!mBuffer)
+    {
+        ANGLE_TRY(Buffer::MakeBufferWithSharedMemOpt(contextMtl, useSharedMem, mSize, nullptr,
+                                                     &mBuffer));
+    }
 
     ASSERT(mBuffer);
 
@@ -199,16 +287,22 @@ angle::Result BufferPool::allocate(ContextMtl *contextMtl,
             destroyBufferList(contextMtl, &mBufferFreeList);
         }
 
-        // The front of the free list should be the oldest. Thus if it is in use the rest of the
-        // free list should be in use as well.
-        if (mBufferFreeList.empty() || mBufferFreeList.front()->isBeingUsedByGPU(contextMtl))
+        // Buffers enter the free list in order, but a buffer can still be used after it was put in
+        // flight, e.g. by another context sharing it, so take the first buffer whose last queue
+        // serial has completed rather than only checking the oldest one.
+        auto freeBufferIter =
+            std::find_if(mBufferFreeList.begin(), mBufferFreeList.end(),
+                         [contextMtl](const BufferRef &buffer) {
+                             return !buffer->isBeingUsedByGPU(contextMtl);
+                         });
+        if (freeBufferIter == mBufferFreeList.end())
         {
             ANGLE_TRY(allocateNewBuffer(contextMtl));
         }
         else
         {
-            mBuffer = mBufferFreeList.front();
-            mBufferFreeList.erase(mBufferFreeList.begin());
+            mBuffer = *freeBufferIter;
+            mBufferFreeList.erase(freeBufferIter);
         }
 
         ASSERT(mBuffer->size() == mSize);
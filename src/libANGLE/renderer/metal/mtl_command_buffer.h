@@ -14,6 +14,7 @@
 #import <Metal/Metal.h>
 #import <QuartzCore/CAMetalLayer.h>
 
+#include <algorithm>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -72,8 +73,19 @@ class CommandQueue final : public WrappedObject<id<MTLCommandQueue>>, angle::Non
     AutoObjCPtr<id<MTLCommandBuffer>> makeMetalCommandBuffer(uint64_t *queueSerialOut);
     void onCommandBufferCommitted(id<MTLCommandBuffer> buf, uint64_t serial);
 
+    // Creates a shared event that every command buffer signals with its queue serial once its work
+    // is done. Command buffers are enqueued when they are created, so the signaled value only
+    // grows. Completion handlers are no longer installed once this is enabled.
+    void enableSerialEvent(id<MTLDevice> metalDevice);
+    // The shared event carrying the serial of the last completed command buffer, nil if the serial
+    // event is not enabled.
+    const SharedEventRef &getSerialEvent() const { return mSerialEvent; }
+    // Returns the serial of the last command buffer known to have completed on the GPU.
+    uint64_t getCompletedSerial() const;
+
   private:
     void onCommandBufferCompleted(id<MTLCommandBuffer> buf, uint64_t serial);
+    void retireCompletedCommandBuffers();
     using ParentClass = WrappedObject<id<MTLCommandQueue>>;
 
     struct CmdBufferQueueEntry
@@ -88,6 +100,8 @@ class CommandQueue final : public WrappedObject<id<MTLCommandQueue>>, angle::Non
     std::atomic<uint64_t> mCommittedBufferSerial{0};
     std::atomic<uint64_t> mCompletedBufferSerial{0};
 
+    SharedEventRef mSerialEvent;
+
     mutable std::mutex mLock;
 };
 
@@ -119,6 +133,7 @@ class CommandBuffer final : public WrappedObject<id<MTLCommandBuffer>>, angle::N
     void popDebugGroup();
 
     CommandQueue &cmdQueue() { return mCmdQueue; }
+    uint64_t getQueueSerial() const { return mQueueSerial; }
 
     // Private use only
     void setActiveCommandEncoder(CommandEncoder *encoder);
@@ -194,67 +209,82 @@ class CommandEncoder : public WrappedObject<id<MTLCommandEncoder>>, angle::NonCo
     CommandBuffer &mCmdBuffer;
 };
 
-// Stream to store commands before encoding them into the real MTLCommandEncoder
+// Stream to store commands before encoding them into the real MTLCommandEncoder.  The commands
+// are written to a list of fixed-size blocks that is kept across clear() calls, so recording
+// doesn't reallocate or copy once the stream has grown to the size of a render pass.  A pushed
+// value never straddles two blocks, so fetch(bytes) returns a contiguous pointer.
 class IntermediateCommandStream
 {
   public:
+    IntermediateCommandStream();
+    ~IntermediateCommandStream();
+
     template <typename T>
     inline IntermediateCommandStream &push(const T &val)
     {
-        const uint8_t *ptr = reinterpret_cast<const uint8_t *>(&val);
-        mBuffer.insert(mBuffer.end(), ptr, ptr + sizeof(T));
-        return *this;
+        return push(reinterpret_cast<const uint8_t *>(&val), sizeof(T));
     }
 
     inline IntermediateCommandStream &push(const uint8_t *bytes, size_t len)
     {
-        mBuffer.insert(mBuffer.end(), bytes, bytes + len);
+        if (mBlocks.empty() || mBlocks[mWriteBlock].used + len > mBlocks[mWriteBlock].capacity)
+        {
+            advanceWriteBlock(len);
+        }
+
+        Block &block = mBlocks[mWriteBlock];
+        std::copy(bytes, bytes + len, block.data.get() + block.used);
+        block.used += len;
         return *this;
     }
 
-    template <typename T>
-    inline T peek()
-    {
-        ASSERT(mReadPtr <= mBuffer.size() - sizeof(T));
-        T re;
-        uint8_t *ptr = reinterpret_cast<uint8_t *>(&re);
-        std::copy(mBuffer.data() + mReadPtr, mBuffer.data() + mReadPtr + sizeof(T), ptr);
-        return re;
-    }
-
     template <typename T>
     inline T fetch()
     {
-        T re = peek<T>();
-        mReadPtr += sizeof(T);
+        T re;
+        const uint8_t *src = fetch(sizeof(T));
+        std::copy(src, src + sizeof(T), reinterpret_cast<uint8_t *>(&re));
         return re;
     }
 
     inline const uint8_t *fetch(size_t bytes)
     {
-        ASSERT(mReadPtr <= mBuffer.size() - bytes);
-        size_t cur = mReadPtr;
-        mReadPtr += bytes;
-        return mBuffer.data() + cur;
+        // The writer moves to the next block whenever a value doesn't fit in the current one.
+        if (mReadOffset + bytes > mBlocks[mReadBlock].used)
+        {
+            ++mReadBlock;
+            mReadOffset = 0;
+        }
+        ASSERT(mReadBlock <= mWriteBlock && mReadOffset + bytes <= mBlocks[mReadBlock].used);
+
+        const uint8_t *ptr = mBlocks[mReadBlock].data.get() + mReadOffset;
+        mReadOffset += bytes;
+        return ptr;
     }
 
-    inline void clear()
+    // Empties the stream, keeping its blocks for the next commands.
+    void clear();
+
+    inline bool good() const
     {
-        mBuffer.clear();
-        mReadPtr = 0;
+        return !mBlocks.empty() &&
+               (mReadBlock < mWriteBlock || mReadOffset < mBlocks[mReadBlock].used);
     }
 
-    inline void resetReadPtr(size_t readPtr)
+  private:
+    struct Block
     {
-        ASSERT(readPtr <= mBuffer.size());
-        mReadPtr = readPtr;
-    }
+        std::unique_ptr<uint8_t[]> data;
+        size_t capacity = 0;
+        size_t used     = 0;
+    };
 
-    inline bool good() const { return mReadPtr < mBuffer.size(); }
+    void advanceWriteBlock(size_t len);
 
-  private:
-    std::vector<uint8_t> mBuffer;
-    size_t mReadPtr = 0;
+    std::vector<Block> mBlocks;
+    size_t mWriteBlock = 0;
+    size_t mReadBlock  = 0;
+    size_t mReadOffset = 0;
 };
 
 // Per shader stage's states
@@ -440,6 +470,9 @@ class RenderCommandEncoder final : public CommandEncoder
     RenderCommandEncoder &useResource(const BufferRef &resource,
                                       MTLResourceUsage usage,
                                       mtl::RenderStages states);
+    RenderCommandEncoder &useResource(const TextureRef &resource,
+                                      MTLResourceUsage usage,
+                                      mtl::RenderStages states);
 
     RenderCommandEncoder &memoryBarrierWithResource(const BufferRef &resource,
                                                     mtl::RenderStages after,
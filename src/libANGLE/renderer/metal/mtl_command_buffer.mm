@@ -404,6 +404,7 @@ void CommandQueue::reset()
 {
     finishAllCommands();
     ParentClass::reset();
+    mSerialEvent = nil;
 }
 
 void CommandQueue::set(id<MTLCommandQueue> metalQueue)
@@ -459,6 +460,9 @@ void CommandQueue::ensureResourceReadyForCPU(Resource *resource)
         [metalBufferEntry.buffer waitUntilCompleted];
 
         mLock.lock();
+        uint64_t completedSerial = mCompletedBufferSerial.load(std::memory_order_relaxed);
+        mCompletedBufferSerial.store(std::max(completedSerial, metalBufferEntry.serial),
+                                     std::memory_order_relaxed);
     }
     mLock.unlock();
 
@@ -475,8 +479,7 @@ bool CommandQueue::isResourceBeingUsedByGPU(const Resource *resource) const
         return false;
     }
 
-    return mCompletedBufferSerial.load(std::memory_order_relaxed) <
-           resource->getCommandBufferQueueSerial();
+    return getCompletedSerial() < resource->getCommandBufferQueueSerial();
 }
 
 bool CommandQueue::resourceHasPendingWorks(const Resource *resource) const
@@ -500,14 +503,23 @@ AutoObjCPtr<id<MTLCommandBuffer>> CommandQueue::makeMetalCommandBuffer(uint64_t
 
         uint64_t serial = mQueueSerialCounter++;
 
+        if (mSerialEvent.get())
+        {
+            // Completion is tracked by the serial event, so drop the command buffers it has
+            // already reached instead of waiting for a completion handler to do it.
+            retireCompletedCommandBuffers();
+        }
+        else
+        {
+            [metalCmdBuffer addCompletedHandler:^(id<MTLCommandBuffer> buf) {
+              onCommandBufferCompleted(buf, serial);
+            }];
+        }
+
         mMetalCmdBuffers.push_back({metalCmdBuffer, serial});
 
         ANGLE_MTL_LOG("Created MTLCommandBuffer %llu:%p", serial, metalCmdBuffer.get());
 
-        [metalCmdBuffer addCompletedHandler:^(id<MTLCommandBuffer> buf) {
-          onCommandBufferCompleted(buf, serial);
-        }];
-
         [metalCmdBuffer enqueue];
 
         ASSERT(metalCmdBuffer);
@@ -556,6 +568,57 @@ void CommandQueue::onCommandBufferCompleted(id<MTLCommandBuffer> buf, uint64_t s
         std::memory_order_relaxed);
 }
 
+void CommandQueue::enableSerialEvent(id<MTLDevice> metalDevice)
+{
+#if ANGLE_MTL_EVENT_AVAILABLE
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        std::lock_guard<std::mutex> lg(mLock);
+
+        // Command buffers created before this point keep their completion handlers, which still
+        // advance mCompletedBufferSerial.
+        mSerialEvent = [[metalDevice newSharedEvent] ANGLE_MTL_AUTORELEASE];
+    }
+#else
+    UNREACHABLE();
+#endif  // #if ANGLE_MTL_EVENT_AVAILABLE
+}
+
+uint64_t CommandQueue::getCompletedSerial() const
+{
+    uint64_t completedSerial = mCompletedBufferSerial.load(std::memory_order_relaxed);
+#if ANGLE_MTL_EVENT_AVAILABLE
+    if (mSerialEvent.get())
+    {
+        completedSerial = std::max<uint64_t>(completedSerial, mSerialEvent.get().signaledValue);
+    }
+#endif  // #if ANGLE_MTL_EVENT_AVAILABLE
+    return completedSerial;
+}
+
+void CommandQueue::retireCompletedCommandBuffers()
+{
+    // Must be called with mLock held.
+    uint64_t completedSerial = getCompletedSerial();
+    while (!mMetalCmdBuffers.empty())
+    {
+        const CmdBufferQueueEntry &metalBufferEntry = mMetalCmdBuffers.front();
+        // A command buffer that failed never signals the event, so its status is checked too.
+        if (metalBufferEntry.serial > completedSerial &&
+            metalBufferEntry.buffer.get().status < MTLCommandBufferStatusCompleted)
+        {
+            break;
+        }
+
+        ANGLE_MTL_LOG("Popped MTLCommandBuffer %llu:%p", metalBufferEntry.serial,
+                      metalBufferEntry.buffer.get());
+        completedSerial = std::max(completedSerial, metalBufferEntry.serial);
+        mMetalCmdBuffers.pop_front();
+    }
+
+    mCompletedBufferSerial.store(completedSerial, std::memory_order_relaxed);
+}
+
 // CommandBuffer implementation
 CommandBuffer::CommandBuffer(CommandQueue *cmdQueue) : mCmdQueue(*cmdQueue) {}
 
@@ -752,6 +815,14 @@ void CommandBuffer::commitImpl()
     // Encoding any pending event's signalling.
     setPendingEvents();
 
+    // Signal the queue's serial event last, so that it is only reached once all of this command
+    // buffer's work is done.
+    const SharedEventRef &serialEvent = mCmdQueue.getSerialEvent();
+    if (serialEvent.get())
+    {
+        setEventImpl(serialEvent, mQueueSerial);
+    }
+
     // Notify command queue
     mCmdQueue.onCommandBufferCommitted(get(), mQueueSerial);
 
@@ -834,6 +905,56 @@ void CommandBuffer::popDebugGroupImpl()
     [get() popDebugGroup];
 }
 
+// IntermediateCommandStream implementation
+IntermediateCommandStream::IntermediateCommandStream() = default;
+
+IntermediateCommandStream::~IntermediateCommandStream() = default;
+
+void IntermediateCommandStream::clear()
+{
+    for (size_t blockIndex = 0; blockIndex < mBlocks.size() && blockIndex <= mWriteBlock;
+         ++blockIndex)
+    {
+        mBlocks[blockIndex].used = 0;
+    }
+
+    mWriteBlock = 0;
+    mReadBlock  = 0;
+    mReadOffset = 0;
+}
+
+void IntermediateCommandStream::advanceWriteBlock(size_t len)
+{
+    // Large enough for a few hundred draw calls.
+    constexpr size_t kBlockSize = 16 * 1024;
+
+    if (!mBlocks.empty())
+    {
+        ++mWriteBlock;
+    }
+
+    // Reuse the next block from a previous recording if it is large enough.  Only setBytes() can
+    // push more than kBlockSize bytes at once.
+    if (mWriteBlock < mBlocks.size() && mBlocks[mWriteBlock].capacity >= len)
+    {
+        ASSERT(mBlocks[mWriteBlock].used == 0);
+        return;
+    }
+
+    Block block;
+    block.capacity = std::max(kBlockSize, len);
+    block.data.reset(new uint8_t[block.capacity]);
+
+    if (mWriteBlock < mBlocks.size())
+    {
+        mBlocks[mWriteBlock] = std::move(block);
+    }
+    else
+    {
+        mBlocks.push_back(std::move(block));
+    }
+}
+
 // CommandEncoder implementation
 CommandEncoder::CommandEncoder(CommandBuffer *cmdBuffer, Type type)
     : mType(type), mCmdBuffer(*cmdBuffer)
@@ -1654,6 +1775,25 @@ RenderCommandEncoder &RenderCommandEncoder::useResource(const BufferRef &resourc
     return *this;
 }
 
+RenderCommandEncoder &RenderCommandEncoder::useResource(const TextureRef &resource,
+                                                        MTLResourceUsage usage,
+                                                        mtl::RenderStages states)
+{
+    if (!resource)
+    {
+        return *this;
+    }
+
+    cmdBuffer().setReadDependency(resource);
+
+    mCommands.push(CmdType::UseResource)
+        .push([resource->get() ANGLE_MTL_RETAIN])
+        .push(usage)
+        .push(states);
+
+    return *this;
+}
+
 RenderCommandEncoder &RenderCommandEncoder::memoryBarrierWithResource(const BufferRef &resource,
                                                                       mtl::RenderStages after,
                                                                       mtl::RenderStages before)
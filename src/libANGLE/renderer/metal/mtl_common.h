@@ -147,6 +147,9 @@ constexpr uint32_t kTextureToBufferBlittingAlignment = 256;
 constexpr uint32_t kMaxGLSamplerBindings = 2 * kMaxShaderSamplers;
 constexpr uint32_t kMaxGLUBOBindings     = 2 * kMaxShaderUBOs;
 
+// Textures and samplers share the ids of an argument buffer
+constexpr uint32_t kMaxTextureArgumentBufferIds = 2 * kMaxShaderSamplers;
+
 // Binding index start for vertex data buffers:
 constexpr uint32_t kVboBindingIndexStart = 0;
 
@@ -154,6 +157,8 @@ constexpr uint32_t kVboBindingIndexStart = 0;
 constexpr uint32_t kDefaultAttribsBindingIndex = kVboBindingIndexStart + kMaxVertexAttribs;
 // Binding index for driver uniforms:
 constexpr uint32_t kDriverUniformsBindingIndex = kDefaultAttribsBindingIndex + 1;
+// Binding index for the textures & samplers argument buffer:
+constexpr uint32_t kTextureArgumentBufferBindingIndex = kDefaultAttribsBindingIndex + 2;
 // Binding index for default uniforms:
 constexpr uint32_t kDefaultUniformsBindingIndex = kDefaultAttribsBindingIndex + 3;
 // Binding index for UBO's argument buffer or starting discrete slot
@@ -39,6 +39,9 @@ struct TranslatedShaderInfo
     std::array<uint32_t, kMaxGLUBOBindings> actualUBOBindings;
     std::array<uint32_t, kMaxShaderXFBs> actualXFBBindings;
     bool hasUBOArgumentBuffer;
+    // If set, actualSamplerBindings are ids in the argument buffer bound at
+    // kTextureArgumentBufferBindingIndex instead of discrete slots.
+    bool hasTextureArgumentBuffer;
 };
 
 // spirvBlobsOut is the SPIR-V code per shader stage.
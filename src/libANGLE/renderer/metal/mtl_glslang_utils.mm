@@ -8,11 +8,16 @@
 
 #include "libANGLE/renderer/metal/mtl_glslang_utils.h"
 
+#include <algorithm>
 #include <regex>
 
+#include <anglebase/sha1.h>
 #include <spirv_msl.hpp>
 
+#include "common/angle_version.h"
 #include "common/apple_platform_utils.h"
+#include "libANGLE/BinaryStream.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/metal/DisplayMtl.h"
 
@@ -247,6 +252,225 @@ void GetAssignedSamplerBindings(const spirv_cross::CompilerMSL &compilerMsl,
     }
 }
 
+// Assigns the ids of the textures and samplers in the argument buffer.  Their ids are assigned
+// explicitly so that the samplers of an array follow each other the same way as with discrete
+// slots.
+void AssignTextureArgumentBufferIds(
+    spirv_cross::CompilerMSL *compiler,
+    gl::ShaderType shaderType,
+    const OriginalSamplerBindingMap &originalBindings,
+    std::array<SamplerBinding, mtl::kMaxGLSamplerBindings> *bindings)
+{
+    uint32_t currentId = 0;
+    for (const spirv_cross::Resource &resource : compiler->get_shader_resources().sampled_images)
+    {
+        ASSERT(compiler->has_decoration(resource.id, spv::DecorationBinding));
+
+        const std::vector<std::pair<uint32_t, uint32_t>> &resOrignalBindings =
+            originalBindings.at(resource.name);
+        uint32_t arraySize = 0;
+        for (const std::pair<uint32_t, uint32_t> &originalBindingRange : resOrignalBindings)
+        {
+            arraySize += originalBindingRange.second;
+        }
+
+        spirv_cross::MSLResourceBinding resBinding;
+        resBinding.stage       = ShaderTypeToSpvExecutionModel(shaderType);
+        resBinding.desc_set    = kGlslangTextureDescSet;
+        resBinding.binding     = compiler->get_decoration(resource.id, spv::DecorationBinding);
+        resBinding.msl_texture = currentId;
+        resBinding.msl_sampler = currentId + arraySize;
+        compiler->add_msl_resource_binding(resBinding);
+
+        // Assign sequential ids for subsequent array elements
+        uint32_t currentTextureId = resBinding.msl_texture;
+        uint32_t currentSamplerId = resBinding.msl_sampler;
+        for (const std::pair<uint32_t, uint32_t> &originalBindingRange : resOrignalBindings)
+        {
+            SamplerBinding &actualBinding = bindings->at(originalBindingRange.first);
+            actualBinding.textureBinding  = currentTextureId;
+            actualBinding.samplerBinding  = currentSamplerId;
+
+            currentTextureId += originalBindingRange.second;
+            currentSamplerId += originalBindingRange.second;
+        }
+
+        currentId += 2 * arraySize;
+    }
+    ASSERT(currentId <= kMaxTextureArgumentBufferIds);
+}
+
+// The target platform and Metal language version of the translated shaders.
+spirv_cross::CompilerMSL::Options GetMslTargetOptions()
+{
+    spirv_cross::CompilerMSL::Options compOpt;
+
+#if TARGET_OS_OSX || TARGET_OS_MACCATALYST
+    compOpt.platform = spirv_cross::CompilerMSL::Options::macOS;
+#else
+    compOpt.platform = spirv_cross::CompilerMSL::Options::iOS;
+#endif
+
+    if (ANGLE_APPLE_AVAILABLE_XCI(10.14, 13.0, 12))
+    {
+        // Use Metal 2.1
+        compOpt.set_msl_version(2, 1);
+    }
+    else
+    {
+        // Always use at least Metal 2.0.
+        compOpt.set_msl_version(2);
+    }
+
+    return compOpt;
+}
+
+template <typename KeyT, typename ValueT>
+std::vector<std::pair<KeyT, ValueT>> GetSortedEntries(const angle::HashMap<KeyT, ValueT> &map)
+{
+    std::vector<std::pair<KeyT, ValueT>> entries(map.begin(), map.end());
+    std::sort(entries.begin(), entries.end());
+    return entries;
+}
+
+// The translation only depends on its inputs and the target options, so they make up the key.
+// The hash maps are sorted since their iteration order may differ between processes.
+void ComputeMslCacheKey(gl::ShaderType shaderType,
+                        const angle::HashMap<std::string, uint32_t> &uboOriginalBindings,
+                        const angle::HashMap<uint32_t, uint32_t> &xfbOriginalBindings,
+                        const OriginalSamplerBindingMap &originalSamplerBindings,
+                        bool disableRasterization,
+                        bool useTextureArgumentBuffer,
+                        const angle::spirv::Blob &spirvCode,
+                        egl::BlobCache::Key *hashOut)
+{
+    const spirv_cross::CompilerMSL::Options compOpt = GetMslTargetOptions();
+
+    gl::BinaryOutputStream stream;
+    stream.writeString("ANGLE Metal translated shader: ");
+    stream.writeString(ANGLE_COMMIT_HASH);
+    stream.writeInt(static_cast<uint32_t>(compOpt.platform));
+    stream.writeInt(compOpt.msl_version);
+    stream.writeEnum(shaderType);
+    stream.writeBool(disableRasterization);
+    stream.writeBool(useTextureArgumentBuffer);
+    stream.writeIntVector(spirvCode);
+
+    for (const auto &binding : GetSortedEntries(uboOriginalBindings))
+    {
+        stream.writeString(binding.first);
+        stream.writeInt(binding.second);
+    }
+    for (const auto &binding : GetSortedEntries(xfbOriginalBindings))
+    {
+        stream.writeInt(binding.first);
+        stream.writeInt(binding.second);
+    }
+    for (const auto &binding : GetSortedEntries(originalSamplerBindings))
+    {
+        stream.writeString(binding.first);
+        for (const std::pair<uint32_t, uint32_t> &slotRange : binding.second)
+        {
+            stream.writeInt(slotRange.first);
+            stream.writeInt(slotRange.second);
+        }
+    }
+
+    angle::base::SHA1HashBytes(static_cast<const unsigned char *>(stream.data()),
+                               stream.length(), hashOut->data());
+}
+
+bool GetTranslatedShaderFromCache(DisplayMtl *display,
+                                  const egl::BlobCache::Key &key,
+                                  TranslatedShaderInfo *translatedShaderInfoOut)
+{
+    egl::BlobCache *blobCache = display->getBlobCache();
+    if (blobCache == nullptr)
+    {
+        return false;
+    }
+
+    egl::BlobCache::Value compressedData;
+    size_t compressedSize = 0;
+    if (!blobCache->get(display->getScratchBuffer(), key, &compressedData, &compressedSize))
+    {
+        return false;
+    }
+
+    angle::MemoryBuffer uncompressedData;
+    if (!egl::DecompressBlobCacheData(compressedData.data(), compressedSize, &uncompressedData))
+    {
+        WARN() << "Failed to decompress a cached Metal translated shader.";
+        return false;
+    }
+
+    gl::BinaryInputStream stream(uncompressedData.data(), uncompressedData.size());
+    stream.readString(&translatedShaderInfoOut->metalShaderSource);
+    for (SamplerBinding &binding : translatedShaderInfoOut->actualSamplerBindings)
+    {
+        stream.readInt(&binding.textureBinding);
+        stream.readInt(&binding.samplerBinding);
+    }
+    for (uint32_t &binding : translatedShaderInfoOut->actualUBOBindings)
+    {
+        stream.readInt(&binding);
+    }
+    for (uint32_t &binding : translatedShaderInfoOut->actualXFBBindings)
+    {
+        stream.readInt(&binding);
+    }
+    stream.readBool(&translatedShaderInfoOut->hasUBOArgumentBuffer);
+    stream.readBool(&translatedShaderInfoOut->hasTextureArgumentBuffer);
+
+    if (stream.error() || !stream.endOfStream() ||
+        translatedShaderInfoOut->metalShaderSource.empty())
+    {
+        WARN() << "Ignoring a corrupted cached Metal translated shader.";
+        translatedShaderInfoOut->reset();
+        return false;
+    }
+
+    return true;
+}
+
+void PutTranslatedShaderInCache(DisplayMtl *display,
+                                const egl::BlobCache::Key &key,
+                                const TranslatedShaderInfo &translatedShaderInfo)
+{
+    egl::BlobCache *blobCache = display->getBlobCache();
+    if (blobCache == nullptr)
+    {
+        return;
+    }
+
+    gl::BinaryOutputStream stream;
+    stream.writeString(translatedShaderInfo.metalShaderSource);
+    for (const SamplerBinding &binding : translatedShaderInfo.actualSamplerBindings)
+    {
+        stream.writeInt(binding.textureBinding);
+        stream.writeInt(binding.samplerBinding);
+    }
+    for (uint32_t binding : translatedShaderInfo.actualUBOBindings)
+    {
+        stream.writeInt(binding);
+    }
+    for (uint32_t binding : translatedShaderInfo.actualXFBBindings)
+    {
+        stream.writeInt(binding);
+    }
+    stream.writeBool(translatedShaderInfo.hasUBOArgumentBuffer);
+    stream.writeBool(translatedShaderInfo.hasTextureArgumentBuffer);
+
+    angle::MemoryBuffer compressedData;
+    if (!egl::CompressBlobCacheData(stream.length(), static_cast<const uint8_t *>(stream.data()),
+                                    &compressedData))
+    {
+        return;
+    }
+
+    blobCache->put(key, std::move(compressedData));
+}
+
 std::string PostProcessTranslatedMsl(const std::string &translatedSource)
 {
     // Add function_constant attribute to gl_SampleMask.
@@ -273,27 +497,10 @@ class SpirvToMslCompiler : public spirv_cross::CompilerMSL
                    const angle::HashMap<uint32_t, uint32_t> &xfbOriginalBindings,
                    const OriginalSamplerBindingMap &originalSamplerBindings,
                    bool disableRasterization,
+                   bool useTextureArgumentBuffer,
                    TranslatedShaderInfo *mslShaderInfoOut)
     {
-        spirv_cross::CompilerMSL::Options compOpt;
-
-#if TARGET_OS_OSX || TARGET_OS_MACCATALYST
-        compOpt.platform = spirv_cross::CompilerMSL::Options::macOS;
-#else
-        compOpt.platform = spirv_cross::CompilerMSL::Options::iOS;
-#endif
-
-        if (ANGLE_APPLE_AVAILABLE_XCI(10.14, 13.0, 12))
-        {
-            // Use Metal 2.1
-            compOpt.set_msl_version(2, 1);
-        }
-        else
-        {
-            // Always use at least Metal 2.0.
-            compOpt.set_msl_version(2);
-        }
-
+        spirv_cross::CompilerMSL::Options compOpt = GetMslTargetOptions();
         compOpt.pad_fragment_output_components = true;
         compOpt.disable_rasterization          = disableRasterization;
 
@@ -307,23 +514,52 @@ class SpirvToMslCompiler : public spirv_cross::CompilerMSL
                     &mslShaderInfoOut->actualUBOBindings, &mslShaderInfoOut->actualXFBBindings,
                     &mslShaderInfoOut->hasUBOArgumentBuffer);
 
-        if (mslShaderInfoOut->hasUBOArgumentBuffer)
+        mslShaderInfoOut->hasTextureArgumentBuffer =
+            useTextureArgumentBuffer && !mslRes.sampled_images.empty();
+        if (mslShaderInfoOut->hasTextureArgumentBuffer)
+        {
+            AssignTextureArgumentBufferIds(this, shaderType, originalSamplerBindings,
+                                           &mslShaderInfoOut->actualSamplerBindings);
+        }
+
+        if (mslShaderInfoOut->hasUBOArgumentBuffer || mslShaderInfoOut->hasTextureArgumentBuffer)
         {
             // Enable argument buffer.
             compOpt.argument_buffers = true;
 
-            // Force UBO argument buffer binding to start at kUBOArgumentBufferBindingIndex.
-            spirv_cross::MSLResourceBinding argBufferBinding = {};
-            argBufferBinding.stage    = ShaderTypeToSpvExecutionModel(shaderType);
-            argBufferBinding.desc_set = kGlslangShaderResourceDescSet;
-            argBufferBinding.binding =
-                spirv_cross::kArgumentBufferBinding;  // spirv-cross built-in binding.
-            argBufferBinding.msl_buffer = kUBOArgumentBufferBindingIndex;  // Actual binding.
-            spirv_cross::CompilerMSL::add_msl_resource_binding(argBufferBinding);
-
-            // Force discrete slot bindings for textures, default uniforms & driver uniforms
-            // instead of using argument buffer.
-            spirv_cross::CompilerMSL::add_discrete_descriptor_set(kGlslangTextureDescSet);
+            if (mslShaderInfoOut->hasUBOArgumentBuffer)
+            {
+                // Force UBO argument buffer binding to start at kUBOArgumentBufferBindingIndex.
+                spirv_cross::MSLResourceBinding argBufferBinding = {};
+                argBufferBinding.stage    = ShaderTypeToSpvExecutionModel(shaderType);
+                argBufferBinding.desc_set = kGlslangShaderResourceDescSet;
+                argBufferBinding.binding =
+                    spirv_cross::kArgumentBufferBinding;  // spirv-cross built-in binding.
+                argBufferBinding.msl_buffer = kUBOArgumentBufferBindingIndex;  // Actual binding.
+                spirv_cross::CompilerMSL::add_msl_resource_binding(argBufferBinding);
+            }
+            else
+            {
+                spirv_cross::CompilerMSL::add_discrete_descriptor_set(
+                    kGlslangShaderResourceDescSet);
+            }
+
+            if (mslShaderInfoOut->hasTextureArgumentBuffer)
+            {
+                spirv_cross::MSLResourceBinding argBufferBinding = {};
+                argBufferBinding.stage      = ShaderTypeToSpvExecutionModel(shaderType);
+                argBufferBinding.desc_set   = kGlslangTextureDescSet;
+                argBufferBinding.binding    = spirv_cross::kArgumentBufferBinding;
+                argBufferBinding.msl_buffer = kTextureArgumentBufferBindingIndex;
+                spirv_cross::CompilerMSL::add_msl_resource_binding(argBufferBinding);
+            }
+            else
+            {
+                spirv_cross::CompilerMSL::add_discrete_descriptor_set(kGlslangTextureDescSet);
+            }
+
+            // Force discrete slot bindings for default uniforms & driver uniforms instead of
+            // using argument buffer.
             spirv_cross::CompilerMSL::add_discrete_descriptor_set(
                 kGlslangDefaultUniformAndXfbDescSet);
             spirv_cross::CompilerMSL::add_discrete_descriptor_set(kGlslangDriverUniformsDescSet);
@@ -340,9 +576,12 @@ class SpirvToMslCompiler : public spirv_cross::CompilerMSL
         mslShaderInfoOut->metalShaderSource =
             PostProcessTranslatedMsl(spirv_cross::CompilerMSL::compile());
 
-        // Retrieve automatic texture slot assignments
-        GetAssignedSamplerBindings(*this, originalSamplerBindings,
-                                   &mslShaderInfoOut->actualSamplerBindings);
+        if (!mslShaderInfoOut->hasTextureArgumentBuffer)
+        {
+            // Retrieve automatic texture slot assignments
+            GetAssignedSamplerBindings(*this, originalSamplerBindings,
+                                       &mslShaderInfoOut->actualSamplerBindings);
+        }
     }
 };
 
@@ -360,17 +599,34 @@ angle::Result ConvertSpirvToMsl(Context *context,
         return angle::Result::Continue;
     }
 
+    // The spirv-cross pass is skipped if an identical shader was translated before, possibly in an
+    // earlier run.
+    const bool useTextureArgumentBuffer =
+        context->getDisplay()->getFeatures().useTextureArgumentBuffers.enabled;
+
+    egl::BlobCache::Key cacheKey;
+    ComputeMslCacheKey(shaderType, uboOriginalBindings, xfbOriginalBindings,
+                       originalSamplerBindings, disableRasterization, useTextureArgumentBuffer,
+                       *sprivCode, &cacheKey);
+    if (GetTranslatedShaderFromCache(context->getDisplay(), cacheKey, translatedShaderInfoOut))
+    {
+        return angle::Result::Continue;
+    }
+
     SpirvToMslCompiler compilerMsl(std::move(*sprivCode));
 
     // NOTE(hqle): spirv-cross uses exceptions to report error, what should we do here
     // in case of error?
     compilerMsl.compileEx(shaderType, uboOriginalBindings, xfbOriginalBindings,
-                          originalSamplerBindings, disableRasterization, translatedShaderInfoOut);
+                          originalSamplerBindings, disableRasterization, useTextureArgumentBuffer,
+                          translatedShaderInfoOut);
     if (translatedShaderInfoOut->metalShaderSource.size() == 0)
     {
         ANGLE_MTL_CHECK(context, false, GL_INVALID_OPERATION);
     }
 
+    PutTranslatedShaderInCache(context->getDisplay(), cacheKey, *translatedShaderInfoOut);
+
     return angle::Result::Continue;
 }
 
@@ -379,11 +635,13 @@ angle::Result ConvertSpirvToMsl(Context *context,
 void TranslatedShaderInfo::reset()
 {
     metalShaderSource.clear();
-    metalLibrary         = nil;
-    hasUBOArgumentBuffer = false;
+    metalLibrary             = nil;
+    hasUBOArgumentBuffer     = false;
+    hasTextureArgumentBuffer = false;
     for (mtl::SamplerBinding &binding : actualSamplerBindings)
     {
-        binding.textureBinding = mtl::kMaxShaderSamplers;
+        // Larger than any discrete slot or argument buffer id.
+        binding.textureBinding = mtl::kMaxTextureArgumentBufferIds;
     }
 
     for (uint32_t &binding : actualUBOBindings)
@@ -50,8 +50,16 @@ class OcclusionQueryPool
     void resolveVisibilityResults(ContextMtl *contextMtl);
 
   private:
+    // Make mRenderPassResultsPool hold at least |minSize| bytes, reusing the buffer of a previous
+    // render pass once the GPU is done with it.
+    angle::Result ensureRenderPassResultsPool(ContextMtl *contextMtl, size_t minSize);
+
     // Buffer to hold the visibility results for current render pass
     BufferRef mRenderPassResultsPool;
+    // Buffers used by previous render passes. Consecutive render passes write to different
+    // buffers, so a render pass doesn't have to wait for the previous one's results to be
+    // resolved.
+    std::vector<BufferRef> mUsedResultsPools;
 
     // List of allocated queries per render pass
     std::vector<QueryMtl *> mAllocatedQueries;
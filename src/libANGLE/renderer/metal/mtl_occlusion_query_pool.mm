@@ -9,6 +9,8 @@
 
 #include "libANGLE/renderer/metal/mtl_occlusion_query_pool.h"
 
+#include <algorithm>
+
 #include "libANGLE/renderer/metal/ContextMtl.h"
 #include "libANGLE/renderer/metal/DisplayMtl.h"
 #include "libANGLE/renderer/metal/QueryMtl.h"
@@ -17,6 +19,11 @@ namespace rx
 {
 namespace mtl
 {
+namespace
+{
+constexpr size_t kInitialRenderPassResultsPoolSize = 64 * kOcclusionQueryResultSize;
+constexpr size_t kMaxUsedResultsPools              = 4;
+}  // namespace
 
 // OcclusionQueryPool implementation
 OcclusionQueryPool::OcclusionQueryPool() {}
@@ -25,6 +32,7 @@ OcclusionQueryPool::~OcclusionQueryPool() {}
 void OcclusionQueryPool::destroy(ContextMtl *contextMtl)
 {
     mRenderPassResultsPool = nullptr;
+    mUsedResultsPools.clear();
     for (QueryMtl *allocatedQuery : mAllocatedQueries)
     {
         if (!allocatedQuery)
@@ -48,21 +56,11 @@ angle::Result OcclusionQueryPool::allocateQueryOffset(ContextMtl *contextMtl,
 
     uint32_t currentOffset =
         static_cast<uint32_t>(mAllocatedQueries.size()) * kOcclusionQueryResultSize;
-    if (!mRenderPassResultsPool)
+    if (!mRenderPassResultsPool ||
+        currentOffset + kOcclusionQueryResultSize > mRenderPassResultsPool->size())
     {
-        // First allocation
-        ANGLE_TRY(Buffer::MakeBufferWithResOpt(contextMtl, MTLResourceStorageModePrivate,
-                                               kOcclusionQueryResultSize, nullptr,
-                                               &mRenderPassResultsPool));
-        mRenderPassResultsPool->get().label = @"OcclusionQueryPool";
-    }
-    else if (currentOffset + kOcclusionQueryResultSize > mRenderPassResultsPool->size())
-    {
-        // Double the capacity
-        ANGLE_TRY(Buffer::MakeBufferWithResOpt(contextMtl, MTLResourceStorageModePrivate,
-                                               mRenderPassResultsPool->size() * 2, nullptr,
-                                               &mRenderPassResultsPool));
-        mRenderPassResultsPool->get().label = @"OcclusionQueryPool";
+        ANGLE_TRY(
+            ensureRenderPassResultsPool(contextMtl, currentOffset + kOcclusionQueryResultSize));
     }
 
     if (clearOldValue)
@@ -93,6 +91,32 @@ angle::Result OcclusionQueryPool::allocateQueryOffset(ContextMtl *contextMtl,
     return angle::Result::Continue;
 }
 
+angle::Result OcclusionQueryPool::ensureRenderPassResultsPool(ContextMtl *contextMtl,
+                                                              size_t minSize)
+{
+    // Double the capacity if the current buffer is too small. The visibility buffer is only
+    // attached to the render pass when it ends, so it can still be replaced.
+    size_t size = mRenderPassResultsPool ? mRenderPassResultsPool->size() * 2
+                                         : kInitialRenderPassResultsPoolSize;
+    size        = std::max(size, minSize);
+
+    for (auto ite = mUsedResultsPools.begin(); ite != mUsedResultsPools.end(); ++ite)
+    {
+        if ((*ite)->size() >= size && !(*ite)->isBeingUsedByGPU(contextMtl))
+        {
+            mRenderPassResultsPool = std::move(*ite);
+            mUsedResultsPools.erase(ite);
+            return angle::Result::Continue;
+        }
+    }
+
+    ANGLE_TRY(Buffer::MakeBufferWithResOpt(contextMtl, MTLResourceStorageModePrivate, size,
+                                           nullptr, &mRenderPassResultsPool));
+    mRenderPassResultsPool->get().label = @"OcclusionQueryPool";
+
+    return angle::Result::Continue;
+}
+
 void OcclusionQueryPool::deallocateQueryOffset(ContextMtl *contextMtl, QueryMtl *query)
 {
     if (query->getAllocatedVisibilityOffsets().empty())
@@ -148,6 +172,15 @@ void OcclusionQueryPool::resolveVisibilityResults(ContextMtl *contextMtl)
     }
 
     mAllocatedQueries.clear();
+
+    // The next render pass's visibility results go to another buffer, while this one is being
+    // resolved.
+    if (mUsedResultsPools.size() >= kMaxUsedResultsPools)
+    {
+        mUsedResultsPools.erase(mUsedResultsPools.begin());
+    }
+    mUsedResultsPools.push_back(std::move(mRenderPassResultsPool));
+    mRenderPassResultsPool = nullptr;
 }
 
 }
@@ -393,6 +393,15 @@ class IndexGeneratorUtils final : angle::NonCopyable
     angle::Result generateLineLoopBufferFromElementsArrayCPU(ContextMtl *contextMtl,
                                                              const IndexGenerationParams &params,
                                                              uint32_t *indicesGenerated);
+    angle::Result generateLineLoopLastSegmentFromElementsArrayGPU(
+        ContextMtl *contextMtl,
+        gl::DrawElementsType srcType,
+        uint32_t indexCount,
+        const BufferRef &srcBuffer,
+        uint32_t srcOffset,
+        const BufferRef &dstBuffer,
+        // Must be multiples of kIndexBufferOffsetAlignment
+        uint32_t dstOffset);
     angle::Result generateLineLoopLastSegmentFromElementsArrayCPU(
         ContextMtl *contextMtl,
         const IndexGenerationParams &params);
@@ -404,6 +413,8 @@ class IndexGeneratorUtils final : angle::NonCopyable
 
     IndexConversionPipelineArray mLineLoopFromElemArrayGeneratorPipelineCaches;
     AutoObjCPtr<id<MTLComputePipelineState>> mLineLoopFromArraysGeneratorPipeline;
+
+    IndexConversionPipelineArray mLineLoopLastSegmentFromElemArrayGeneratorPipelineCaches;
 };
 
 // Util class for handling visibility query result
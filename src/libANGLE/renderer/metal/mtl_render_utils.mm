@@ -1818,6 +1818,7 @@ void IndexGeneratorUtils::onDestroy()
     ClearPipelineState2DArray(&mIndexConversionPipelineCaches);
     ClearPipelineState2DArray(&mTriFanFromElemArrayGeneratorPipelineCaches);
     ClearPipelineState2DArray(&mLineLoopFromElemArrayGeneratorPipelineCaches);
+    ClearPipelineState2DArray(&mLineLoopLastSegmentFromElemArrayGeneratorPipelineCaches);
 
     mTriFanFromArraysGeneratorPipeline   = nil;
     mLineLoopFromArraysGeneratorPipeline = nil;
@@ -2257,6 +2258,16 @@ angle::Result IndexGeneratorUtils::generateLineLoopLastSegmentFromElementsArray(
                     "Index offset is too large", GL_INVALID_VALUE);
 
         BufferMtl *bufferMtl = GetImpl(elementBuffer);
+        if (contextMtl->getDisplay()->getFeatures().hasCheapRenderPass.enabled ||
+            !contextMtl->getRenderCommandEncoder())
+        {
+            // Read the indices on GPU so that a buffer written by GPU doesn't need to be synced
+            // to its shadow copy first.
+            return generateLineLoopLastSegmentFromElementsArrayGPU(
+                contextMtl, params.srcType, params.indexCount, bufferMtl->getCurrentBuffer(),
+                static_cast<uint32_t>(srcOffset), params.dstBuffer, params.dstOffset);
+        }
+
         std::pair<uint32_t, uint32_t> firstLast;
         ANGLE_TRY(bufferMtl->getFirstLastIndices(contextMtl, params.srcType,
                                                  static_cast<uint32_t>(srcOffset),
@@ -2271,6 +2282,45 @@ angle::Result IndexGeneratorUtils::generateLineLoopLastSegmentFromElementsArray(
     }
 }
 
+angle::Result IndexGeneratorUtils::generateLineLoopLastSegmentFromElementsArrayGPU(
+    ContextMtl *contextMtl,
+    gl::DrawElementsType srcType,
+    uint32_t indexCount,
+    const BufferRef &srcBuffer,
+    uint32_t srcOffset,
+    const BufferRef &dstBuffer,
+    // Must be multiples of kIndexBufferOffsetAlignment
+    uint32_t dstOffset)
+{
+    ComputeCommandEncoder *cmdEncoder = contextMtl->getComputeCommandEncoder();
+    ASSERT(cmdEncoder);
+
+    AutoObjCPtr<id<MTLComputePipelineState>> pipelineState =
+        getIndicesFromElemArrayGeneratorPipeline(
+            contextMtl, srcType, srcOffset, @"genLineLoopLastSegmentFromElements",
+            &mLineLoopLastSegmentFromElemArrayGeneratorPipelineCaches);
+
+    ASSERT(pipelineState);
+
+    cmdEncoder->setComputePipelineState(pipelineState);
+
+    ASSERT((dstOffset % kIndexBufferOffsetAlignment) == 0);
+    ASSERT(indexCount >= 2);
+
+    IndexConversionUniform uniform;
+    uniform.srcOffset  = srcOffset;
+    uniform.indexCount = indexCount;
+
+    cmdEncoder->setData(uniform, 0);
+    cmdEncoder->setBuffer(srcBuffer, 0, 1);
+    cmdEncoder->setBufferForWrite(dstBuffer, dstOffset, 2);
+
+    // One thread for the last index and one for the first.
+    DispatchCompute(contextMtl, cmdEncoder, pipelineState, 2);
+
+    return angle::Result::Continue;
+}
+
 angle::Result IndexGeneratorUtils::generateLineLoopLastSegmentFromElementsArrayCPU(
     ContextMtl *contextMtl,
     const IndexGenerationParams &params)
@@ -286,6 +286,13 @@ class Buffer final : public Resource, public WrappedObject<id<MTLBuffer>>
                                               const uint8_t *data,
                                               BufferRef *bufferOut);
 
+    // Allocates a shared memory buffer from the given heap. *bufferOut is null if the heap doesn't
+    // have enough space left.
+    static angle::Result MakeBufferFromHeap(ContextMtl *context,
+                                            id<MTLHeap> heap,
+                                            size_t size,
+                                            BufferRef *bufferOut);
+
     angle::Result reset(ContextMtl *context, size_t size, const uint8_t *data);
     angle::Result resetWithSharedMemOpt(ContextMtl *context,
                                         bool forceUseSharedMem,
@@ -313,6 +320,7 @@ class Buffer final : public Resource, public WrappedObject<id<MTLBuffer>>
     void syncContent(ContextMtl *context, mtl::BlitCommandEncoder *encoder);
 
   private:
+    Buffer(id<MTLBuffer> metalBuffer);
     Buffer(ContextMtl *context, bool forceUseSharedMem, size_t size, const uint8_t *data);
     Buffer(ContextMtl *context,
            MTLResourceOptions resourceOptions,
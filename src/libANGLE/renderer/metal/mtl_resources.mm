@@ -732,6 +732,33 @@ angle::Result Buffer::MakeBufferWithResOpt(ContextMtl *context,
     return angle::Result::Continue;
 }
 
+angle::Result Buffer::MakeBufferFromHeap(ContextMtl *context,
+                                         id<MTLHeap> heap,
+                                         size_t size,
+                                         BufferRef *bufferOut)
+{
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        id<MTLBuffer> metalBuffer =
+            [[heap newBufferWithLength:size
+                               options:MTLResourceStorageModeShared] ANGLE_MTL_AUTORELEASE];
+        if (!metalBuffer)
+        {
+            bufferOut->reset();
+            return angle::Result::Continue;
+        }
+
+        bufferOut->reset(new Buffer(metalBuffer));
+    }
+
+    return angle::Result::Continue;
+}
+
+Buffer::Buffer(id<MTLBuffer> metalBuffer)
+{
+    set(metalBuffer);
+}
+
 Buffer::Buffer(ContextMtl *context, bool forceUseSharedMem, size_t size, const uint8_t *data)
 {
     (void)resetWithSharedMemOpt(context, forceUseSharedMem, size, data);
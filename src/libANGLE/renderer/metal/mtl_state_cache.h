@@ -13,7 +13,9 @@
 
 #import <Metal/Metal.h>
 
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "libANGLE/State.h"
 #include "libANGLE/angletypes.h"
@@ -95,6 +97,10 @@ struct alignas(4) SamplerDesc
     // Set default values. All filters are nearest, and addresModes are clamp to edge.
     void reset();
 
+    // Allows the sampler state to be encoded into argument buffers. Its LOD clamps are taken from
+    // |glState|, since they can't be set when encoding.
+    void enableArgumentBuffers(const gl::SamplerState &glState);
+
     bool operator==(const SamplerDesc &rhs) const;
 
     size_t hash() const;
@@ -113,6 +119,12 @@ struct alignas(4) SamplerDesc
 
     // Use uint8_t instead of MTLCompareFunction to compact space
     uint8_t compareFunction : 3;
+
+    bool supportArgumentBuffers : 1;
+
+    // Only used if supportArgumentBuffers is set.
+    float lodMinClamp;
+    float lodMaxClamp;
 };
 
 struct VertexAttributeDesc
@@ -429,6 +441,8 @@ class RenderPipelineCacheSpecializeShaderFactory
                                       const RenderPipelineDesc &renderPipelineDesc) = 0;
 };
 
+struct PrewarmedRenderPipelineStates;
+
 // Render pipeline state cache per shader program.
 class RenderPipelineCache final : angle::NonCopyable
 {
@@ -452,6 +466,19 @@ class RenderPipelineCache final : angle::NonCopyable
     AutoObjCPtr<id<MTLRenderPipelineState>> getRenderPipelineState(ContextMtl *context,
                                                                    const RenderPipelineDesc &desc);
 
+    // Create the render pipeline states of the given descs in the background. The shaders, either
+    // set or specialized, must already be available. getRenderPipelineState() waits for a state
+    // that is still being created instead of creating it again.
+    void prewarmRenderPipelineStates(Context *context,
+                                     const std::vector<RenderPipelineDesc> &descs);
+
+    // Get the descs of every render pipeline state created so far.
+    std::vector<RenderPipelineDesc> getRenderPipelineDescs() const;
+    size_t getRenderPipelineStateCount() const
+    {
+        return mRenderPipelineStates[0].size() + mRenderPipelineStates[1].size();
+    }
+
     void clear();
 
   protected:
@@ -471,6 +498,12 @@ class RenderPipelineCache final : angle::NonCopyable
         Context *context,
         const RenderPipelineDesc &desc,
         bool insertDefaultAttribLayout);
+    AutoObjCObj<MTLRenderPipelineDescriptor> createRenderPipelineDescriptor(
+        Context *context,
+        const RenderPipelineDesc &desc,
+        bool insertDefaultAttribLayout);
+    AutoObjCPtr<id<MTLRenderPipelineState>> takePrewarmedRenderPipelineState(
+        const RenderPipelineDesc &desc);
 
     bool hasDefaultAttribs(const RenderPipelineDesc &desc) const;
 
@@ -478,6 +511,10 @@ class RenderPipelineCache final : angle::NonCopyable
     angle::HashMap<RenderPipelineDesc, AutoObjCPtr<id<MTLRenderPipelineState>>>
         mRenderPipelineStates[2];
 
+    // Shared with the completion handlers of prewarmRenderPipelineStates(), since they may be
+    // called after the cache is cleared.
+    std::shared_ptr<PrewarmedRenderPipelineStates> mPrewarmedStates;
+
     RenderPipelineCacheSpecializeShaderFactory *mSpecializedShaderFactory;
 };
 
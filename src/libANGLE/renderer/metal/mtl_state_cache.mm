@@ -10,6 +10,9 @@
 
 #include "libANGLE/renderer/metal/mtl_state_cache.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
 
 #include "common/debug.h"
@@ -76,6 +79,13 @@ MTLSamplerDescriptor *ToObjC(const SamplerDesc &desc)
     ANGLE_OBJC_CP_PROPERTY(objCDesc, desc, maxAnisotropy);
     ANGLE_OBJC_CP_PROPERTY(objCDesc, desc, compareFunction);
 
+    if (desc.supportArgumentBuffers)
+    {
+        ANGLE_OBJC_CP_PROPERTY(objCDesc, desc, supportArgumentBuffers);
+        ANGLE_OBJC_CP_PROPERTY(objCDesc, desc, lodMinClamp);
+        ANGLE_OBJC_CP_PROPERTY(objCDesc, desc, lodMaxClamp);
+    }
+
     return [objCDesc ANGLE_MTL_AUTORELEASE];
 }
 
@@ -483,6 +493,17 @@ void SamplerDesc::reset()
     maxAnisotropy = 1;
 
     compareFunction = MTLCompareFunctionNever;
+
+    supportArgumentBuffers = false;
+    lodMinClamp            = 0;
+    lodMaxClamp            = 0;
+}
+
+void SamplerDesc::enableArgumentBuffers(const gl::SamplerState &glState)
+{
+    supportArgumentBuffers = true;
+    lodMinClamp            = std::max(glState.getMinLod(), 0.f);
+    lodMaxClamp            = glState.getMaxLod();
 }
 
 bool SamplerDesc::operator==(const SamplerDesc &rhs) const
@@ -495,7 +516,10 @@ bool SamplerDesc::operator==(const SamplerDesc &rhs) const
 
            ANGLE_PROP_EQ(*this, rhs, maxAnisotropy) &&
 
-           ANGLE_PROP_EQ(*this, rhs, compareFunction);
+           ANGLE_PROP_EQ(*this, rhs, compareFunction) &&
+
+           ANGLE_PROP_EQ(*this, rhs, supportArgumentBuffers) &&
+           ANGLE_PROP_EQ(*this, rhs, lodMinClamp) && ANGLE_PROP_EQ(*this, rhs, lodMaxClamp);
 }
 
 size_t SamplerDesc::hash() const
@@ -853,6 +877,20 @@ void RenderPassDesc::convertToMetalDesc(MTLRenderPassDescriptor *objCDesc) const
     }
 }
 
+// Render pipeline states being created in the background, written by Metal's completion handlers.
+struct PrewarmedRenderPipelineStates
+{
+    struct Entry
+    {
+        AutoObjCPtr<id<MTLRenderPipelineState>> state;
+        bool done = false;
+    };
+    angle::HashMap<RenderPipelineDesc, Entry> entries;
+
+    std::condition_variable cv;
+    std::mutex lock;
+};
+
 // RenderPipelineCache implementation
 RenderPipelineCache::RenderPipelineCache() : RenderPipelineCache(nullptr) {}
 
@@ -913,12 +951,115 @@ AutoObjCPtr<id<MTLRenderPipelineState>> RenderPipelineCache::getRenderPipelineSt
     auto ite                       = table.find(desc);
     if (ite == table.end())
     {
+        AutoObjCPtr<id<MTLRenderPipelineState>> prewarmedState =
+            takePrewarmedRenderPipelineState(desc);
+        if (prewarmedState)
+        {
+            return table.insert(std::make_pair(desc, prewarmedState)).first->second;
+        }
+
         return insertRenderPipelineState(context, desc, insertDefaultAttribLayout);
     }
 
     return ite->second;
 }
 
+void RenderPipelineCache::prewarmRenderPipelineStates(Context *context,
+                                                      const std::vector<RenderPipelineDesc> &descs)
+{
+    if (!mPrewarmedStates)
+    {
+        mPrewarmedStates = std::make_shared<PrewarmedRenderPipelineStates>();
+    }
+    std::shared_ptr<PrewarmedRenderPipelineStates> prewarmedStates = mPrewarmedStates;
+
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        id<MTLDevice> metalDevice = context->getMetalDevice();
+        for (const RenderPipelineDesc &desc : descs)
+        {
+            bool insertDefaultAttribLayout = hasDefaultAttribs(desc);
+            if (mRenderPipelineStates[insertDefaultAttribLayout ? 1 : 0].count(desc))
+            {
+                continue;
+            }
+
+            AutoObjCObj<MTLRenderPipelineDescriptor> objCDesc =
+                createRenderPipelineDescriptor(context, desc, insertDefaultAttribLayout);
+            if (!objCDesc)
+            {
+                continue;
+            }
+
+            {
+                std::lock_guard<std::mutex> lg(prewarmedStates->lock);
+                if (!prewarmedStates->entries.emplace(desc, PrewarmedRenderPipelineStates::Entry())
+                         .second)
+                {
+                    continue;
+                }
+            }
+
+            // A failed creation leaves a nil state, the draw using it then creates it again and
+            // reports the error.
+            RenderPipelineDesc key = desc;
+            [metalDevice
+                newRenderPipelineStateWithDescriptor:objCDesc
+                                   completionHandler:^(id<MTLRenderPipelineState> state,
+                                                       NSError *error) {
+                                     std::lock_guard<std::mutex> lg(prewarmedStates->lock);
+
+                                     PrewarmedRenderPipelineStates::Entry &entry =
+                                         prewarmedStates->entries[key];
+                                     entry.state.retainAssign(state);
+                                     entry.done = true;
+                                     prewarmedStates->cv.notify_all();
+                                   }];
+        }
+    }
+}
+
+AutoObjCPtr<id<MTLRenderPipelineState>> RenderPipelineCache::takePrewarmedRenderPipelineState(
+    const RenderPipelineDesc &desc)
+{
+    if (!mPrewarmedStates)
+    {
+        return nil;
+    }
+
+    std::unique_lock<std::mutex> lg(mPrewarmedStates->lock);
+    auto &entries = mPrewarmedStates->entries;
+    if (entries.find(desc) == entries.end())
+    {
+        return nil;
+    }
+
+    // Waiting for the creation already in progress is cheaper than starting another one.
+    mPrewarmedStates->cv.wait(lg, [&entries, &desc] { return entries.find(desc)->second.done; });
+
+    auto ite                                      = entries.find(desc);
+    AutoObjCPtr<id<MTLRenderPipelineState>> state = ite->second.state;
+    entries.erase(ite);
+    return state;
+}
+
+std::vector<RenderPipelineDesc> RenderPipelineCache::getRenderPipelineDescs() const
+{
+    std::vector<RenderPipelineDesc> descs;
+    descs.reserve(getRenderPipelineStateCount());
+    for (const auto &table : mRenderPipelineStates)
+    {
+        for (const auto &ite : table)
+        {
+            if (ite.second)
+            {
+                descs.push_back(ite.first);
+            }
+        }
+    }
+    return descs;
+}
+
 AutoObjCPtr<id<MTLRenderPipelineState>> RenderPipelineCache::insertRenderPipelineState(
     Context *context,
     const RenderPipelineDesc &desc,
@@ -942,6 +1083,34 @@ AutoObjCPtr<id<MTLRenderPipelineState>> RenderPipelineCache::insertRenderPipelin
 }
 
 AutoObjCPtr<id<MTLRenderPipelineState>> RenderPipelineCache::createRenderPipelineState(
+    Context *context,
+    const RenderPipelineDesc &desc,
+    bool insertDefaultAttribLayout)
+{
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        AutoObjCObj<MTLRenderPipelineDescriptor> objCDesc =
+            createRenderPipelineDescriptor(context, desc, insertDefaultAttribLayout);
+        if (!objCDesc)
+        {
+            return nil;
+        }
+
+        // Create pipeline state
+        NSError *err = nil;
+        id<MTLRenderPipelineState> newState =
+            [context->getMetalDevice() newRenderPipelineStateWithDescriptor:objCDesc error:&err];
+        if (err)
+        {
+            context->handleError(err, __FILE__, ANGLE_FUNCTION, __LINE__);
+            return nil;
+        }
+
+        return [newState ANGLE_MTL_AUTORELEASE];
+    }
+}
+
+AutoObjCObj<MTLRenderPipelineDescriptor> RenderPipelineCache::createRenderPipelineDescriptor(
     Context *context,
     const RenderPipelineDesc &originalDesc,
     bool insertDefaultAttribLayout)
@@ -997,8 +1166,6 @@ AutoObjCPtr<id<MTLRenderPipelineState>> RenderPipelineCache::createRenderPipelin
             return nil;
         }
 
-        id<MTLDevice> metalDevice = context->getMetalDevice();
-
         // Convert to Objective-C desc:
         AutoObjCObj<MTLRenderPipelineDescriptor> objCDesc = ToObjC(vertShader, fragShader, desc);
 
@@ -1015,22 +1182,16 @@ AutoObjCPtr<id<MTLRenderPipelineState>> RenderPipelineCache::createRenderPipelin
                          setObject:[defaultAttribLayoutObjCDesc ANGLE_MTL_AUTORELEASE]
                 atIndexedSubscript:kDefaultAttribsBindingIndex];
         }
-        // Create pipeline state
-        NSError *err = nil;
-        id<MTLRenderPipelineState> newState =
-            [metalDevice newRenderPipelineStateWithDescriptor:objCDesc error:&err];
-        if (err)
-        {
-            context->handleError(err, __FILE__, ANGLE_FUNCTION, __LINE__);
-            return nil;
-        }
 
-        return [newState ANGLE_MTL_AUTORELEASE];
+        return objCDesc;
     }
 }
 
 void RenderPipelineCache::recreatePipelineStates(Context *context)
 {
+    // States being prewarmed use the previous shaders.
+    mPrewarmedStates = nullptr;
+
     for (int hasDefaultAttrib = 0; hasDefaultAttrib <= 1; ++hasDefaultAttrib)
     {
         for (auto &ite : mRenderPipelineStates[hasDefaultAttrib])
@@ -1056,6 +1217,7 @@ void RenderPipelineCache::clearPipelineStates()
 {
     mRenderPipelineStates[0].clear();
     mRenderPipelineStates[1].clear();
+    mPrewarmedStates = nullptr;
 }
 
 // StateCache implementation
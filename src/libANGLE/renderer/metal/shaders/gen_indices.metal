@@ -215,4 +215,20 @@ kernel void genLineLoopIndicesFromElements(uint idx [[thread_position_in_grid]],
 
     output[idx] =
         getIndexU32(options.srcOffset, idx % options.indexCount, inputU8, inputU16, inputU32);
+}
+
+// Generate line loop's last segment indices for glDrawElements(): the last index followed by the
+// first one.
+kernel void genLineLoopLastSegmentFromElements(
+    uint idx[[thread_position_in_grid]],
+    constant IndexConversionParams &options[[buffer(0)]],
+    constant uchar *inputU8[[ buffer(1), function_constant(kUseSourceBufferU8) ]],
+    constant ushort *inputU16[[ buffer(1), function_constant(kUseSourceBufferU16) ]],
+    constant uint *inputU32[[ buffer(1), function_constant(kUseSourceBufferU32) ]],
+    device uint *output[[buffer(2)]])
+{
+    ANGLE_KERNEL_GUARD(idx, 2);
+
+    uint elemIdx = idx == 0 ? options.indexCount - 1 : 0;
+    output[idx]  = getIndexU32(options.srcOffset, elemIdx, inputU8, inputU16, inputU32);
 }
\ No newline at end of file
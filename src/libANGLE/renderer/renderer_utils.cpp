@@ -18,11 +18,14 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/Context.inl.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/Format.h"
+#include "libANGLE/trace.h"
 #include "platform/Feature.h"
 
+#include <algorithm>
 #include <string.h>
 
 namespace rx
@@ -140,6 +143,258 @@ void WriteFloatColor(const gl::ColorF &color,
     colorWriteFunction(reinterpret_cast<const uint8_t *>(&color), destPixelData);
 }
 
+// Copies between RGBA8 and BGRA8 make most of the CopyTextureCHROMIUM uploads, so they have
+// dedicated row loops that the compiler can vectorize.  They produce the same results as going
+// through ColorF with PremultiplyAlpha and UnmultiplyAlpha.
+enum class AlphaConversion
+{
+    Copy,
+    Premultiply,
+    Unmultiply,
+};
+
+// The reciprocal of each alpha value, as computed by UnmultiplyAlpha.  Colors with zero alpha are
+// left as they are.
+const std::array<float, 256> &GetUnmultiplyReciprocals()
+{
+    static const std::array<float, 256> reciprocals = [] {
+        std::array<float, 256> table = {};
+        table[0]                     = 1.0f;
+        for (size_t alpha = 1; alpha < table.size(); ++alpha)
+        {
+            table[alpha] = 1.0f / gl::normalizedToFloat(static_cast<uint8_t>(alpha));
+        }
+        return table;
+    }();
+    return reciprocals;
+}
+
+template <AlphaConversion kConversion>
+ANGLE_INLINE uint8_t ConvertColorChannel(uint8_t channel, uint8_t alpha, float invAlpha)
+{
+    if (kConversion == AlphaConversion::Premultiply)
+    {
+        // Rounds like the float computation, as channel * alpha / 255 is never halfway between
+        // two integers.
+        return static_cast<uint8_t>((channel * alpha + 127) / 255);
+    }
+    if (kConversion == AlphaConversion::Unmultiply)
+    {
+        return gl::floatToNormalized<uint8_t>(
+            std::min(1.0f, gl::normalizedToFloat(channel) * invAlpha));
+    }
+    return channel;
+}
+
+template <bool kSwapRedBlue, AlphaConversion kConversion>
+void CopyRowRGBA8(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const std::array<float, 256> &reciprocals = GetUnmultiplyReciprocals();
+
+    for (size_t x = 0; x < width; ++x)
+    {
+        const uint8_t *sourcePixel = source + x * 4;
+        uint8_t *destPixel         = dest + x * 4;
+
+        const uint8_t alpha = sourcePixel[3];
+        const float invAlpha =
+            kConversion == AlphaConversion::Unmultiply ? reciprocals[alpha] : 1.0f;
+
+        const uint8_t first  = ConvertColorChannel<kConversion>(sourcePixel[0], alpha, invAlpha);
+        const uint8_t second = ConvertColorChannel<kConversion>(sourcePixel[1], alpha, invAlpha);
+        const uint8_t third  = ConvertColorChannel<kConversion>(sourcePixel[2], alpha, invAlpha);
+
+        destPixel[0] = kSwapRedBlue ? third : first;
+        destPixel[1] = second;
+        destPixel[2] = kSwapRedBlue ? first : third;
+        destPixel[3] = alpha;
+    }
+}
+
+using CopyRowFunction = void (*)(const uint8_t *source, uint8_t *dest, size_t width);
+
+template <bool kSwapRedBlue>
+CopyRowFunction GetCopyRowRGBA8Function(AlphaConversion conversion)
+{
+    switch (conversion)
+    {
+        case AlphaConversion::Premultiply:
+            return CopyRowRGBA8<kSwapRedBlue, AlphaConversion::Premultiply>;
+        case AlphaConversion::Unmultiply:
+            return CopyRowRGBA8<kSwapRedBlue, AlphaConversion::Unmultiply>;
+        default:
+            return CopyRowRGBA8<kSwapRedBlue, AlphaConversion::Copy>;
+    }
+}
+
+// Returns nullptr unless the copy is between RGBA8 and BGRA8 formats.
+CopyRowFunction GetCopyImageRowFunction(PixelReadFunction pixelReadFunction,
+                                        PixelWriteFunction pixelWriteFunction,
+                                        AlphaConversion conversion)
+{
+    const bool sourceIsRGBA = pixelReadFunction == angle::ReadColor<angle::R8G8B8A8, GLfloat>;
+    const bool sourceIsBGRA = pixelReadFunction == angle::ReadColor<angle::B8G8R8A8, GLfloat>;
+    const bool destIsRGBA   = pixelWriteFunction == angle::WriteColor<angle::R8G8B8A8, GLfloat>;
+    const bool destIsBGRA   = pixelWriteFunction == angle::WriteColor<angle::B8G8R8A8, GLfloat>;
+
+    if (!(sourceIsRGBA || sourceIsBGRA) || !(destIsRGBA || destIsBGRA))
+    {
+        return nullptr;
+    }
+
+    return sourceIsRGBA == destIsRGBA ? GetCopyRowRGBA8Function<false>(conversion)
+                                      : GetCopyRowRGBA8Function<true>(conversion);
+}
+
+// Mip levels are only split into bands of at least this many pixels, below which waking the
+// workers costs more than the work itself.
+constexpr size_t kMinPixelsPerMipTask = 64 * 1024;
+constexpr size_t kMaxMipTasks         = 8;
+
+class GenerateMipTask final : public angle::Closure
+{
+  public:
+    GenerateMipTask(MipGenerationFunction mipGenerationFunction,
+                    size_t sourceWidth,
+                    size_t sourceHeight,
+                    size_t sourceDepth,
+                    const uint8_t *sourceData,
+                    size_t sourceRowPitch,
+                    size_t sourceDepthPitch,
+                    uint8_t *destData,
+                    size_t destRowPitch,
+                    size_t destDepthPitch)
+        : mMipGenerationFunction(mipGenerationFunction),
+          mSourceWidth(sourceWidth),
+          mSourceHeight(sourceHeight),
+          mSourceDepth(sourceDepth),
+          mSourceData(sourceData),
+          mSourceRowPitch(sourceRowPitch),
+          mSourceDepthPitch(sourceDepthPitch),
+          mDestData(destData),
+          mDestRowPitch(destRowPitch),
+          mDestDepthPitch(destDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "GenerateMipTask");
+        mMipGenerationFunction(mSourceWidth, mSourceHeight, mSourceDepth, mSourceData,
+                               mSourceRowPitch, mSourceDepthPitch, mDestData, mDestRowPitch,
+                               mDestDepthPitch);
+    }
+
+  private:
+    MipGenerationFunction mMipGenerationFunction;
+    size_t mSourceWidth;
+    size_t mSourceHeight;
+    size_t mSourceDepth;
+    const uint8_t *mSourceData;
+    size_t mSourceRowPitch;
+    size_t mSourceDepthPitch;
+    uint8_t *mDestData;
+    size_t mDestRowPitch;
+    size_t mDestDepthPitch;
+};
+
+// Readbacks are only split into bands of at least this many pixels.
+constexpr size_t kMinPixelsPerPackTask = 256 * 1024;
+constexpr size_t kMaxPackTasks         = 8;
+
+class PackPixelsTask final : public angle::Closure
+{
+  public:
+    PackPixelsTask(const PackPixelsParams &params,
+                   const angle::Format &sourceFormat,
+                   int inputPitch,
+                   const uint8_t *source,
+                   uint8_t *destination)
+        : mParams(params),
+          mSourceFormat(sourceFormat),
+          mInputPitch(inputPitch),
+          mSource(source),
+          mDestination(destination)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "PackPixelsTask");
+        PackPixels(mParams, mSourceFormat, mInputPitch, mSource, mDestination);
+    }
+
+  private:
+    PackPixelsParams mParams;
+    const angle::Format &mSourceFormat;
+    int mInputPitch;
+    const uint8_t *mSource;
+    uint8_t *mDestination;
+};
+
+// Converts whole rows between the formats most commonly read back, in loops the compiler can
+// vectorize, instead of going through a function pointer per pixel.
+using PixelRowConvertFunction = void (*)(const uint8_t *source, uint8_t *dest, int width);
+
+// RGBA8 to BGRA8 and back swap the same two channels.
+void SwapRedBlueRow(const uint8_t *source, uint8_t *dest, int width)
+{
+    for (int x = 0; x < width; ++x)
+    {
+        dest[x * 4 + 0] = source[x * 4 + 2];
+        dest[x * 4 + 1] = source[x * 4 + 1];
+        dest[x * 4 + 2] = source[x * 4 + 0];
+        dest[x * 4 + 3] = source[x * 4 + 3];
+    }
+}
+
+void RGBAToRGBRow(const uint8_t *source, uint8_t *dest, int width)
+{
+    for (int x = 0; x < width; ++x)
+    {
+        dest[x * 3 + 0] = source[x * 4 + 0];
+        dest[x * 3 + 1] = source[x * 4 + 1];
+        dest[x * 3 + 2] = source[x * 4 + 2];
+    }
+}
+
+void BGRAToRGBRow(const uint8_t *source, uint8_t *dest, int width)
+{
+    for (int x = 0; x < width; ++x)
+    {
+        dest[x * 3 + 0] = source[x * 4 + 2];
+        dest[x * 3 + 1] = source[x * 4 + 1];
+        dest[x * 3 + 2] = source[x * 4 + 0];
+    }
+}
+
+PixelRowConvertFunction GetPixelRowConvertFunction(angle::FormatID sourceFormatID,
+                                                   angle::FormatID destFormatID)
+{
+    if (sourceFormatID == angle::FormatID::R8G8B8A8_UNORM)
+    {
+        if (destFormatID == angle::FormatID::B8G8R8A8_UNORM)
+        {
+            return SwapRedBlueRow;
+        }
+        if (destFormatID == angle::FormatID::R8G8B8_UNORM)
+        {
+            return RGBAToRGBRow;
+        }
+    }
+    else if (sourceFormatID == angle::FormatID::B8G8R8A8_UNORM)
+    {
+        if (destFormatID == angle::FormatID::R8G8B8A8_UNORM)
+        {
+            return SwapRedBlueRow;
+        }
+        if (destFormatID == angle::FormatID::R8G8B8_UNORM)
+        {
+            return BGRAToRGBRow;
+        }
+    }
+
+    return nullptr;
+}
+
 template <int cols, int rows, bool IsColumnMajor>
 inline int GetFlattenedIndex(int col, int row)
 {
@@ -382,6 +637,19 @@ void PackPixels(const PackPixelsParams &params,
         return;
     }
 
+    PixelRowConvertFunction rowConvertFunc =
+        GetPixelRowConvertFunction(sourceFormat.id, params.destFormat->id);
+
+    if (params.rotation == SurfaceRotation::Identity && rowConvertFunc)
+    {
+        for (int y = 0; y < params.area.height; ++y)
+        {
+            rowConvertFunc(source + y * inputPitch, destWithOffset + y * params.outputPitch,
+                           params.area.width);
+        }
+        return;
+    }
+
     PixelCopyFunction fastCopyFunc = sourceFormat.fastCopyFunctions.get(params.destFormat->id);
 
     if (fastCopyFunc)
@@ -430,6 +698,64 @@ void PackPixels(const PackPixelsParams &params,
     }
 }
 
+void PackPixelsInParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                          const PackPixelsParams &params,
+                          const angle::Format &sourceFormat,
+                          int inputPitch,
+                          const uint8_t *source,
+                          uint8_t *destination)
+{
+    const size_t height = static_cast<size_t>(params.area.height);
+    const size_t pixels = static_cast<size_t>(params.area.width) * height;
+
+    // Rotated images are read along the columns of the source, so only unrotated ones are split.
+    const size_t taskCount =
+        std::min({kMaxPackTasks, height, std::max<size_t>(1, pixels / kMinPixelsPerPackTask)});
+    if (taskCount == 1 || params.rotation != SurfaceRotation::Identity || !workerPool ||
+        !workerPool->isAsync())
+    {
+        PackPixels(params, sourceFormat, inputPitch, source, destination);
+        return;
+    }
+
+    const size_t rowsPerTask = (height + taskCount - 1) / taskCount;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+
+    // Each band packs its own rows of the destination.  With reverseRowOrder the first rows of
+    // the destination come from the last rows of the source.
+    auto getBandParams = [&](size_t firstRow, size_t bandHeight, const uint8_t **bandSourceOut) {
+        PackPixelsParams bandParams = params;
+        bandParams.area.height      = static_cast<int>(bandHeight);
+        bandParams.offset += static_cast<ptrdiff_t>(firstRow * params.outputPitch);
+
+        const size_t sourceRow = params.reverseRowOrder ? height - firstRow - bandHeight : firstRow;
+        *bandSourceOut         = source + static_cast<ptrdiff_t>(sourceRow) * inputPitch;
+        return bandParams;
+    };
+
+    // The first band is packed on this thread while the workers handle the rest.
+    for (size_t firstRow = rowsPerTask; firstRow < height; firstRow += rowsPerTask)
+    {
+        const size_t bandHeight = std::min(rowsPerTask, height - firstRow);
+
+        const uint8_t *bandSource   = nullptr;
+        PackPixelsParams bandParams = getBandParams(firstRow, bandHeight, &bandSource);
+
+        auto task = std::make_shared<PackPixelsTask>(bandParams, sourceFormat, inputPitch,
+                                                     bandSource, destination);
+        waitEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(workerPool, task));
+    }
+
+    const uint8_t *bandSource   = nullptr;
+    PackPixelsParams bandParams = getBandParams(0, rowsPerTask, &bandSource);
+    PackPixels(bandParams, sourceFormat, inputPitch, bandSource, destination);
+
+    for (std::shared_ptr<angle::WaitableEvent> &waitEvent : waitEvents)
+    {
+        waitEvent->wait();
+    }
+}
+
 bool FastCopyFunctionMap::has(angle::FormatID formatID) const
 {
     return (get(formatID) != nullptr);
@@ -528,6 +854,31 @@ void CopyImageCHROMIUM(const uint8_t *sourceData,
             break;
     }
 
+    AlphaConversion alphaConversion = AlphaConversion::Copy;
+    if (unpackPremultiplyAlpha != unpackUnmultiplyAlpha)
+    {
+        alphaConversion =
+            unpackPremultiplyAlpha ? AlphaConversion::Premultiply : AlphaConversion::Unmultiply;
+    }
+
+    CopyRowFunction copyRowFunction =
+        GetCopyImageRowFunction(pixelReadFunction, pixelWriteFunction, alphaConversion);
+    if (copyRowFunction != nullptr && clipChannelsFunction == ClipChannelsNoOp &&
+        destComponentType != GL_UNSIGNED_INT)
+    {
+        ASSERT(sourcePixelBytes == 4 && destPixelBytes == 4);
+        for (size_t z = 0; z < depth; z++)
+        {
+            for (size_t y = 0; y < height; y++)
+            {
+                const size_t destY = unpackFlipY ? height - 1 - y : y;
+                copyRowFunction(sourceData + y * sourceRowPitch + z * sourceDepthPitch,
+                                destData + destY * destRowPitch + z * destDepthPitch, width);
+            }
+        }
+        return;
+    }
+
     auto writeFunction = (destComponentType == GL_UNSIGNED_INT) ? WriteUintColor : WriteFloatColor;
 
     for (size_t z = 0; z < depth; z++)
@@ -564,6 +915,58 @@ void CopyImageCHROMIUM(const uint8_t *sourceData,
     }
 }
 
+void GenerateMipInParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                           MipGenerationFunction mipGenerationFunction,
+                           size_t sourceWidth,
+                           size_t sourceHeight,
+                           size_t sourceDepth,
+                           const uint8_t *sourceData,
+                           size_t sourceRowPitch,
+                           size_t sourceDepthPitch,
+                           uint8_t *destData,
+                           size_t destRowPitch,
+                           size_t destDepthPitch)
+{
+    const size_t destWidth  = std::max<size_t>(1, sourceWidth >> 1);
+    const size_t destHeight = std::max<size_t>(1, sourceHeight >> 1);
+    const size_t destDepth  = std::max<size_t>(1, sourceDepth >> 1);
+    const size_t destPixels = destWidth * destHeight * destDepth;
+
+    // Each band of destination rows is generated from twice as many source rows, which keeps the
+    // same filter as generating the whole level at once.  A source of height 1 can't be split.
+    const size_t taskCount =
+        std::min({kMaxMipTasks, destHeight, std::max<size_t>(1, destPixels / kMinPixelsPerMipTask)});
+    if (taskCount == 1 || sourceHeight == 1 || !workerPool || !workerPool->isAsync())
+    {
+        mipGenerationFunction(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                              sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+        return;
+    }
+
+    const size_t rowsPerTask = (destHeight + taskCount - 1) / taskCount;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+
+    // The first band is generated on this thread while the workers handle the rest.
+    for (size_t firstRow = rowsPerTask; firstRow < destHeight; firstRow += rowsPerTask)
+    {
+        const size_t bandHeight = std::min(rowsPerTask, destHeight - firstRow);
+
+        auto task = std::make_shared<GenerateMipTask>(
+            mipGenerationFunction, sourceWidth, bandHeight * 2, sourceDepth,
+            sourceData + firstRow * 2 * sourceRowPitch, sourceRowPitch, sourceDepthPitch,
+            destData + firstRow * destRowPitch, destRowPitch, destDepthPitch);
+        waitEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(workerPool, task));
+    }
+
+    mipGenerationFunction(sourceWidth, rowsPerTask * 2, sourceDepth, sourceData, sourceRowPitch,
+                          sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+
+    for (std::shared_ptr<angle::WaitableEvent> &waitEvent : waitEvents)
+    {
+        waitEvent->wait();
+    }
+}
+
 // IncompleteTextureSet implementation.
 IncompleteTextureSet::IncompleteTextureSet() : mIncompleteTextureBufferAttachment(nullptr) {}
 
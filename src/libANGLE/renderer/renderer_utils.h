@@ -14,6 +14,7 @@
 
 #include <limits>
 #include <map>
+#include <memory>
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/angleutils.h"
@@ -25,6 +26,7 @@ namespace angle
 struct FeatureSetBase;
 struct Format;
 enum class FormatID;
+class WorkerThreadPool;
 }  // namespace angle
 
 namespace gl
@@ -130,6 +132,15 @@ void PackPixels(const PackPixelsParams &params,
                 const uint8_t *source,
                 uint8_t *destination);
 
+// Packs the pixels the same way as PackPixels, but splits the rows between the worker threads
+// and the calling thread when the image is large enough to make that worthwhile.
+void PackPixelsInParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                          const PackPixelsParams &params,
+                          const angle::Format &sourceFormat,
+                          int inputPitch,
+                          const uint8_t *source,
+                          uint8_t *destination);
+
 using InitializeTextureDataFunction = void (*)(size_t width,
                                                size_t height,
                                                size_t depth,
@@ -182,6 +193,21 @@ void CopyImageCHROMIUM(const uint8_t *sourceData,
                        bool unpackPremultiplyAlpha,
                        bool unpackUnmultiplyAlpha);
 
+// Generates the next mip level of an image the same way as |mipGenerationFunction|, but splits
+// the rows of the destination level between the worker threads and the calling thread when the
+// level is large enough to make that worthwhile.
+void GenerateMipInParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                           MipGenerationFunction mipGenerationFunction,
+                           size_t sourceWidth,
+                           size_t sourceHeight,
+                           size_t sourceDepth,
+                           const uint8_t *sourceData,
+                           size_t sourceRowPitch,
+                           size_t sourceDepthPitch,
+                           uint8_t *destData,
+                           size_t destRowPitch,
+                           size_t destDepthPitch);
+
 // Incomplete textures are 1x1 textures filled with black, used when samplers are incomplete.
 // This helper class encapsulates handling incomplete textures. Because the GL back-end
 // can take advantage of the driver's incomplete textures, and because clearing multisample
@@ -218,6 +244,64 @@ class IncompleteTextureSet final : angle::NonCopyable
     gl::Buffer *mIncompleteTextureBufferAttachment;
 };
 
+// Base class for all caches. Provides cache hit and miss counters.
+class CacheStats final : angle::NonCopyable
+{
+  public:
+    CacheStats() { reset(); }
+    ~CacheStats() {}
+
+    ANGLE_INLINE void hit() { mHitCount++; }
+    ANGLE_INLINE void miss() { mMissCount++; }
+    ANGLE_INLINE void evict() { mEvictionCount++; }
+    ANGLE_INLINE void evict(size_t count) { mEvictionCount += count; }
+    ANGLE_INLINE void incrementSize(size_t count) { mSize += count; }
+    ANGLE_INLINE void decrementSize(size_t count)
+    {
+        ASSERT(mSize >= count);
+        mSize -= count;
+    }
+    ANGLE_INLINE void accumulate(const CacheStats &stats)
+    {
+        mHitCount += stats.mHitCount;
+        mMissCount += stats.mMissCount;
+        mEvictionCount += stats.mEvictionCount;
+        mSize += stats.mSize;
+    }
+
+    uint64_t getHitCount() const { return mHitCount; }
+    uint64_t getMissCount() const { return mMissCount; }
+    uint64_t getEvictionCount() const { return mEvictionCount; }
+    // The number of live entries, for caches that track it.
+    uint64_t getSize() const { return mSize; }
+
+    ANGLE_INLINE double getHitRatio() const
+    {
+        if (mHitCount + mMissCount == 0)
+        {
+            return 0;
+        }
+        else
+        {
+            return static_cast<double>(mHitCount) / (mHitCount + mMissCount);
+        }
+    }
+
+    void reset()
+    {
+        mHitCount      = 0;
+        mMissCount     = 0;
+        mEvictionCount = 0;
+        mSize          = 0;
+    }
+
+  private:
+    uint64_t mHitCount;
+    uint64_t mMissCount;
+    uint64_t mEvictionCount;
+    uint64_t mSize;
+};
+
 // Helpers to set a matrix uniform value based on GLSL or HLSL semantics.
 // The return value indicate if the data was updated or not.
 template <int cols, int rows>
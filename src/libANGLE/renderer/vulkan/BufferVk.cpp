@@ -33,9 +33,19 @@ static_assert(gl::isPow2(kBufferSizeGranularity), "use as alignment, must be pow
 // Start with a fairly small buffer size. We can increase this dynamically as we convert more data.
 constexpr size_t kConvertedArrayBufferInitialSize = 1024 * 8;
 
+// Line loop conversions are written by the CPU or copied from the source buffer.
+constexpr VkBufferUsageFlags kLineLoopConversionBufferUsage =
+    VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+constexpr size_t kLineLoopConversionBufferInitialSize = 1024 * 8;
+constexpr size_t kMaxLineLoopConversionBufferCount    = 16;
+
 // Buffers that have a static usage pattern will be allocated in
 // device local memory to speed up access to and from the GPU.
-// Dynamic usage patterns or that are frequently mapped
+// Buffers that the CPU frequently writes to also prefer device local memory.  On UMA devices and
+// discrete GPUs with resizable BAR such memory is host visible too, so these are still written in
+// place while the GPU reads them at full speed.  Host visibility is the only required property,
+// so elsewhere these fall back to host uncached memory.
+// Dynamic usage patterns that read back or are frequently mapped
 // will now request host cached memory to speed up access from the CPU.
 ANGLE_INLINE VkMemoryPropertyFlags GetPreferredMemoryType(gl::BufferBinding target,
                                                           gl::BufferUsage usage)
@@ -46,8 +56,6 @@ ANGLE_INLINE VkMemoryPropertyFlags GetPreferredMemoryType(gl::BufferBinding targ
     constexpr VkMemoryPropertyFlags kHostCachedFlags =
         (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
          VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
-    constexpr VkMemoryPropertyFlags kHostUncachedFlags =
-        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
     if (target == gl::BufferBinding::PixelUnpack)
     {
@@ -64,8 +72,8 @@ ANGLE_INLINE VkMemoryPropertyFlags GetPreferredMemoryType(gl::BufferBinding targ
         case gl::BufferUsage::DynamicDraw:
         case gl::BufferUsage::StreamDraw:
             // For non-static usage where the CPU performs a write-only access, request
-            // a host uncached memory
-            return kHostUncachedFlags;
+            // a device local memory that is also host visible if available
+            return kDeviceLocalFlags;
         case gl::BufferUsage::DynamicCopy:
         case gl::BufferUsage::DynamicRead:
         case gl::BufferUsage::StreamCopy:
@@ -167,7 +175,10 @@ ConversionBuffer::ConversionBuffer(RendererVk *renderer,
                                    size_t initialSize,
                                    size_t alignment,
                                    bool hostVisible)
-    : dirty(true), lastAllocationOffset(0)
+    : dirty(true),
+      dirtyRange(0, std::numeric_limits<VkDeviceSize>::max()),
+      lastAllocationOffset(0),
+      lastAllocationSize(0)
 {
     data.init(renderer, usageFlags, alignment, initialSize, hostVisible,
               vk::DynamicBufferPolicy::OneShotUse);
@@ -197,6 +208,28 @@ BufferVk::VertexConversionBuffer::VertexConversionBuffer(VertexConversionBuffer
 
 BufferVk::VertexConversionBuffer::~VertexConversionBuffer() = default;
 
+// LineLoopConversionBuffer implementation.
+LineLoopConversionBuffer::LineLoopConversionBuffer(RendererVk *renderer,
+                                                   gl::DrawElementsType indexTypeIn,
+                                                   GLsizei indexCountIn,
+                                                   size_t offsetIn,
+                                                   bool primitiveRestartIn)
+    : ConversionBuffer(renderer,
+                       kLineLoopConversionBufferUsage,
+                       kLineLoopConversionBufferInitialSize,
+                       sizeof(uint32_t),
+                       true),
+      indexType(indexTypeIn),
+      indexCount(indexCountIn),
+      offset(offsetIn),
+      primitiveRestart(primitiveRestartIn),
+      lineLoopIndexCount(0)
+{}
+
+LineLoopConversionBuffer::LineLoopConversionBuffer(LineLoopConversionBuffer &&other) = default;
+
+LineLoopConversionBuffer::~LineLoopConversionBuffer() = default;
+
 // BufferVk implementation.
 BufferVk::BufferVk(const gl::BufferState &state)
     : BufferImpl(state), mBuffer(nullptr), mBufferOffset(0)
@@ -230,6 +263,10 @@ void BufferVk::release(ContextVk *contextVk)
     {
         buffer.data.release(renderer);
     }
+    for (ConversionBuffer &buffer : mLineLoopConversionBuffers)
+    {
+        buffer.data.release(renderer);
+    }
 }
 
 angle::Result BufferVk::initializeShadowBuffer(ContextVk *contextVk,
@@ -521,7 +558,8 @@ angle::Result BufferVk::copySubData(const gl::Context *context,
     commandBuffer->copyBuffer(sourceBuffer.getBuffer(), mBuffer->getBuffer(), 1, &copyRegion);
 
     // The new destination buffer data may require a conversion for the next draw, so mark it dirty.
-    onDataChanged();
+    markConversionBuffersDirty(static_cast<VkDeviceSize>(destOffset),
+                               static_cast<VkDeviceSize>(size));
 
     return angle::Result::Continue;
 }
@@ -688,7 +726,8 @@ angle::Result BufferVk::unmapImpl(ContextVk *contextVk)
 
     if (writeOperation)
     {
-        markConversionBuffersDirty();
+        markConversionBuffersDirty(static_cast<VkDeviceSize>(mState.getMapOffset()),
+                                   static_cast<VkDeviceSize>(mState.getMapLength()));
     }
 
     return angle::Result::Continue;
@@ -886,7 +925,7 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
     }
 
     // Update conversions
-    markConversionBuffersDirty();
+    markConversionBuffersDirty(offset, size);
 
     return angle::Result::Continue;
 }
@@ -909,14 +948,73 @@ ConversionBuffer *BufferVk::getVertexConversionBuffer(RendererVk *renderer,
     return &mVertexConversionBuffers.back();
 }
 
+LineLoopConversionBuffer *BufferVk::getLineLoopConversionBuffer(RendererVk *renderer,
+                                                                gl::DrawElementsType indexType,
+                                                                GLsizei indexCount,
+                                                                size_t offset,
+                                                                bool primitiveRestart)
+{
+    for (LineLoopConversionBuffer &buffer : mLineLoopConversionBuffers)
+    {
+        if (buffer.indexType == indexType && buffer.indexCount == indexCount &&
+            buffer.offset == offset && buffer.primitiveRestart == primitiveRestart)
+        {
+            return &buffer;
+        }
+    }
+
+    // Buffers drawn with many different ranges keep streaming the ranges past the limit.
+    if (mLineLoopConversionBuffers.size() >= kMaxLineLoopConversionBufferCount)
+    {
+        return nullptr;
+    }
+
+    mLineLoopConversionBuffers.emplace_back(renderer, indexType, indexCount, offset,
+                                            primitiveRestart);
+    return &mLineLoopConversionBuffers.back();
+}
+
 void BufferVk::markConversionBuffersDirty()
 {
     for (VertexConversionBuffer &buffer : mVertexConversionBuffers)
+    {
+        buffer.dirty      = true;
+        buffer.dirtyRange = RangeDeviceSize(0, std::numeric_limits<VkDeviceSize>::max());
+    }
+    for (LineLoopConversionBuffer &buffer : mLineLoopConversionBuffers)
     {
         buffer.dirty = true;
     }
 }
 
+void BufferVk::markConversionBuffersDirty(VkDeviceSize offset, VkDeviceSize size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    for (VertexConversionBuffer &buffer : mVertexConversionBuffers)
+    {
+        buffer.dirty = true;
+        buffer.dirtyRange.extend(offset);
+        buffer.dirtyRange.extend(offset + size - 1);
+    }
+
+    // Line loop conversions only depend on their own range of indices.
+    for (LineLoopConversionBuffer &buffer : mLineLoopConversionBuffers)
+    {
+        VkDeviceSize indexSize  = static_cast<VkDeviceSize>(buffer.indexCount)
+                                 << gl::GetDrawElementsTypeShift(buffer.indexType);
+        VkDeviceSize indexStart = buffer.offset;
+        VkDeviceSize indexEnd   = indexStart + indexSize;
+        if (offset < indexEnd && indexStart < offset + size)
+        {
+            buffer.dirty = true;
+        }
+    }
+}
+
 void BufferVk::onDataChanged()
 {
     markConversionBuffersDirty();
@@ -19,6 +19,8 @@ namespace rx
 {
 class RendererVk;
 
+using RangeDeviceSize = gl::Range<VkDeviceSize>;
+
 // Conversion buffers hold translated index and vertex data.
 struct ConversionBuffer
 {
@@ -34,13 +36,40 @@ struct ConversionBuffer
     // One state value determines if we need to re-stream vertex data.
     bool dirty;
 
-    // One additional state value keeps the last allocation offset.
+    // The bytes of the source buffer that changed since the last conversion.  When they don't
+    // cover every vertex, only the vertices they overlap are converted again, in place.
+    RangeDeviceSize dirtyRange;
+
+    // Two additional state values keep the last allocation offset and size.
     VkDeviceSize lastAllocationOffset;
+    VkDeviceSize lastAllocationSize;
 
     // The conversion is stored in a dynamic buffer.
     vk::DynamicBuffer data;
 };
 
+// Line loop conversions hold a range of the buffer's indices with the loop closed.
+struct LineLoopConversionBuffer : public ConversionBuffer
+{
+    LineLoopConversionBuffer(RendererVk *renderer,
+                             gl::DrawElementsType indexTypeIn,
+                             GLsizei indexCountIn,
+                             size_t offsetIn,
+                             bool primitiveRestartIn);
+    ~LineLoopConversionBuffer();
+
+    LineLoopConversionBuffer(LineLoopConversionBuffer &&other);
+
+    // The conversion is identified by {index type, index count, offset, primitive restart}.
+    gl::DrawElementsType indexType;
+    GLsizei indexCount;
+    size_t offset;
+    bool primitiveRestart;
+
+    // The number of indices in the converted data.
+    uint32_t lineLoopIndexCount;
+};
+
 class BufferVk : public BufferImpl
 {
   public:
@@ -128,6 +157,13 @@ class BufferVk : public BufferImpl
                                                 size_t offset,
                                                 bool hostVisible);
 
+    // Returns nullptr if the buffer already caches as many line loop conversions as it can.
+    LineLoopConversionBuffer *getLineLoopConversionBuffer(RendererVk *renderer,
+                                                          gl::DrawElementsType indexType,
+                                                          GLsizei indexCount,
+                                                          size_t offset,
+                                                          bool primitiveRestart);
+
   private:
     angle::Result initializeShadowBuffer(ContextVk *contextVk,
                                          gl::BufferBinding target,
@@ -181,6 +217,7 @@ class BufferVk : public BufferImpl
                               size_t offset);
     void release(ContextVk *context);
     void markConversionBuffersDirty();
+    void markConversionBuffersDirty(VkDeviceSize offset, VkDeviceSize size);
 
     angle::Result acquireBufferHelper(ContextVk *contextVk, size_t sizeInBytes);
 
@@ -220,6 +257,10 @@ class BufferVk : public BufferImpl
 
     // A cache of converted vertex data.
     std::vector<VertexConversionBuffer> mVertexConversionBuffers;
+
+    // A cache of line loop index data, so that static line loops are not converted on every
+    // draw.
+    std::vector<LineLoopConversionBuffer> mLineLoopConversionBuffers;
 };
 
 }  // namespace rx
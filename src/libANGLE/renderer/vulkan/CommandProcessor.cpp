@@ -43,6 +43,38 @@ void InitializeSubmitInfo(VkSubmitInfo *submitInfo,
     }
 }
 
+// Appends the timeline semaphore signal to |submitInfo|.  The arrays and |timelineInfoOut| must
+// outlive the submission.
+void AddTimelineSemaphoreSignal(VkSubmitInfo *submitInfo,
+                                const vk::Semaphore &timelineSemaphore,
+                                Serial serial,
+                                std::array<VkSemaphore, 2> *signalSemaphoresOut,
+                                std::array<uint64_t, 2> *signalValuesOut,
+                                VkTimelineSemaphoreSubmitInfoKHR *timelineInfoOut)
+{
+    ASSERT(submitInfo->pNext == nullptr);
+    ASSERT(submitInfo->signalSemaphoreCount <= 1);
+
+    uint32_t signalCount = submitInfo->signalSemaphoreCount;
+    if (signalCount > 0)
+    {
+        // The value is ignored for binary semaphores.
+        (*signalSemaphoresOut)[0] = submitInfo->pSignalSemaphores[0];
+        (*signalValuesOut)[0]     = 0;
+    }
+    (*signalSemaphoresOut)[signalCount] = timelineSemaphore.getHandle();
+    (*signalValuesOut)[signalCount]     = serial.getValue();
+    ++signalCount;
+
+    timelineInfoOut->sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+    timelineInfoOut->signalSemaphoreValueCount = signalCount;
+    timelineInfoOut->pSignalSemaphoreValues    = signalValuesOut->data();
+
+    submitInfo->pNext                = timelineInfoOut;
+    submitInfo->signalSemaphoreCount = signalCount;
+    submitInfo->pSignalSemaphores    = signalSemaphoresOut->data();
+}
+
 bool CommandsHaveValidOrdering(const std::vector<vk::CommandBatch> &commands)
 {
     Serial currentSerial;
@@ -272,6 +304,8 @@ CommandBatch &CommandBatch::operator=(CommandBatch &&other)
     std::swap(commandPool, other.commandPool);
     std::swap(fence, other.fence);
     std::swap(serial, other.serial);
+    std::swap(priority, other.priority);
+    std::swap(secondaryCommandPools, other.secondaryCommandPools);
     return *this;
 }
 
@@ -279,9 +313,101 @@ void CommandBatch::destroy(VkDevice device)
 {
     primaryCommands.destroy(device);
     commandPool.destroy(device);
+    for (CommandPool &secondaryCommandPool : secondaryCommandPools)
+    {
+        secondaryCommandPool.destroy(device);
+    }
+    secondaryCommandPools.clear();
     fence.reset(device);
 }
 
+// RecordSecondaryCommandBufferTask implementation.
+//
+// Records the contents of a CommandBufferHelper into a Vulkan secondary command buffer on a worker
+// thread.  Command pools must be externally synchronized, so each task allocates from its own
+// pool, which is released to the CommandBatch once the secondary is executed in the primary
+// command buffer.  Vulkan errors are saved and reported to the context that flushes the task.
+class RecordSecondaryCommandBufferTask final : public Context, public angle::Closure
+{
+  public:
+    RecordSecondaryCommandBufferTask(RendererVk *renderer,
+                                     CommandBufferHelper *commandBuffer,
+                                     const RenderPass *renderPass)
+        : Context(renderer),
+          mCommandBuffer(commandBuffer),
+          mRenderPass(renderPass),
+          mError({VK_SUCCESS, "", "", 0}),
+          mResult(angle::Result::Continue)
+    {}
+
+    ~RecordSecondaryCommandBufferTask() override
+    {
+        // The secondary command buffer is freed with its pool.
+        mSecondaryCommands.releaseHandle();
+        ASSERT(!mCommandPool.valid());
+    }
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "RecordSecondaryCommandBufferTask::run");
+        mResult = record();
+    }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        mError.errorCode = result;
+        mError.file      = file;
+        mError.function  = function;
+        mError.line      = line;
+    }
+
+    // Must only be called once the task has finished running.
+    angle::Result getResult(Context *context)
+    {
+        if (mError.errorCode != VK_SUCCESS)
+        {
+            context->handleError(mError.errorCode, mError.file, mError.function, mError.line);
+        }
+        return mResult;
+    }
+
+    CommandBufferHelper *getCommandBuffer() const { return mCommandBuffer; }
+    const RenderPass *getRenderPass() const { return mRenderPass; }
+    const PrimaryCommandBuffer &getSecondaryCommands() const { return mSecondaryCommands; }
+    CommandPool &getCommandPool() { return mCommandPool; }
+
+  private:
+    angle::Result record()
+    {
+        VkDevice device = getDevice();
+
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex        = mRenderer->getQueueFamilyIndex();
+        ANGLE_VK_TRY(this, mCommandPool.init(device, poolInfo));
+
+        VkCommandBufferAllocateInfo allocInfo = {};
+        allocInfo.sType                       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool                 = mCommandPool.getHandle();
+        allocInfo.level                       = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+        allocInfo.commandBufferCount          = 1;
+        ANGLE_VK_TRY(this, mSecondaryCommands.init(device, allocInfo));
+
+        return mCommandBuffer->recordToSecondary(this, mRenderPass, &mSecondaryCommands);
+    }
+
+    CommandBufferHelper *mCommandBuffer;
+    const RenderPass *mRenderPass;
+    CommandPool mCommandPool;
+    PrimaryCommandBuffer mSecondaryCommands;
+    Error mError;
+    angle::Result mResult;
+};
+
 // CommandProcessor implementation.
 void CommandProcessor::handleError(VkResult errorCode,
                                    const char *file,
@@ -341,7 +467,13 @@ void CommandProcessor::queueCommand(CommandProcessorTask &&task)
     std::lock_guard<std::mutex> queueLock(mWorkerMutex);
 
     mTasks.emplace(std::move(task));
-    mWorkAvailableCondition.notify_one();
+
+    // The worker thread only waits on the condition while it's idle.  Otherwise it's processing a
+    // batch of tasks and will pick this one up when it's done, so there's no need to signal it.
+    if (mWorkerThreadIdle)
+    {
+        mWorkAvailableCondition.notify_one();
+    }
 }
 
 void CommandProcessor::processTasks(const DeviceQueueMap &queueMap)
@@ -370,28 +502,37 @@ angle::Result CommandProcessor::processTasksImpl(bool *exitThread)
 {
     while (true)
     {
-        std::unique_lock<std::mutex> lock(mWorkerMutex);
-        if (mTasks.empty())
+        // Take all the queued tasks at once, so the mutex is taken once per batch rather than once
+        // per task.  The two queues are swapped to keep their storage.
         {
-            mWorkerThreadIdle = true;
-            mWorkerIdleCondition.notify_all();
-            // Only wake if notified and command queue is not empty
-            mWorkAvailableCondition.wait(lock, [this] { return !mTasks.empty(); });
+            std::unique_lock<std::mutex> lock(mWorkerMutex);
+            if (mTasks.empty())
+            {
+                mWorkerThreadIdle = true;
+                mWorkerIdleCondition.notify_all();
+                // Only wake if notified and command queue is not empty
+                mWorkAvailableCondition.wait(lock, [this] { return !mTasks.empty(); });
+            }
+            mWorkerThreadIdle = false;
+            ASSERT(mProcessingTasks.empty());
+            std::swap(mTasks, mProcessingTasks);
         }
-        mWorkerThreadIdle = false;
-        CommandProcessorTask task(std::move(mTasks.front()));
-        mTasks.pop();
-        lock.unlock();
 
-        ANGLE_TRY(processTask(&task));
-        if (task.getTaskCommand() == CustomTask::Exit)
+        while (!mProcessingTasks.empty())
         {
+            CommandProcessorTask task(std::move(mProcessingTasks.front()));
+            mProcessingTasks.pop();
 
-            *exitThread = true;
-            lock.lock();
-            mWorkerThreadIdle = true;
-            mWorkerIdleCondition.notify_one();
-            return angle::Result::Continue;
+            ANGLE_TRY(processTask(&task));
+            if (task.getTaskCommand() == CustomTask::Exit)
+            {
+                ASSERT(mProcessingTasks.empty());
+                *exitThread = true;
+                std::lock_guard<std::mutex> lock(mWorkerMutex);
+                mWorkerThreadIdle = true;
+                mWorkerIdleCondition.notify_one();
+                return angle::Result::Continue;
+            }
         }
     }
 
@@ -685,6 +826,16 @@ VkResult CommandProcessor::queuePresent(egl::ContextPriority contextPriority,
     return VK_SUCCESS;
 }
 
+angle::Result CommandProcessor::queueBindSparse(Context *context,
+                                                egl::ContextPriority contextPriority,
+                                                const VkBindSparseInfo &bindSparseInfo)
+{
+    // The bind waits on semaphores signaled by submissions that may still be queued to the worker
+    // thread, so those must reach the queue first.
+    ANGLE_TRY(waitForWorkComplete(context));
+    return mCommandQueue.queueBindSparse(context, contextPriority, bindSparseInfo);
+}
+
 angle::Result CommandProcessor::waitForSerialWithUserTimeout(vk::Context *context,
                                                              Serial serial,
                                                              uint64_t timeout,
@@ -742,6 +893,13 @@ void CommandQueue::destroy(Context *context)
 
     RendererVk *renderer = context->getRenderer();
 
+    discardPendingSecondaryCommandBuffers(renderer);
+    for (CommandPool &secondaryCommandPool : mSecondaryCommandPools)
+    {
+        secondaryCommandPool.destroy(renderer->getDevice());
+    }
+    mSecondaryCommandPools.clear();
+
     mLastCompletedQueueSerial = Serial::Infinite();
     (void)clearAllGarbage(renderer);
 
@@ -749,6 +907,11 @@ void CommandQueue::destroy(Context *context)
     mPrimaryCommandPool.destroy(renderer->getDevice());
     mFenceRecycler.destroy(context);
 
+    for (Semaphore &timelineSemaphore : mTimelineSemaphores)
+    {
+        timelineSemaphore.destroy(renderer->getDevice());
+    }
+
     ASSERT(mInFlightCommands.empty() && mGarbageQueue.empty());
 }
 
@@ -762,6 +925,24 @@ angle::Result CommandQueue::init(Context *context, const DeviceQueueMap &queueMa
 
     mQueues = queueMap;
 
+    if (renderer->getFeatures().supportsTimelineSemaphore.enabled)
+    {
+        VkSemaphoreTypeCreateInfoKHR semaphoreTypeInfo = {};
+        semaphoreTypeInfo.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        semaphoreTypeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        semaphoreTypeInfo.initialValue  = 0;
+
+        VkSemaphoreCreateInfo semaphoreInfo = {};
+        semaphoreInfo.sType                 = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext                 = &semaphoreTypeInfo;
+        semaphoreInfo.flags                 = 0;
+
+        for (Semaphore &timelineSemaphore : mTimelineSemaphores)
+        {
+            ANGLE_VK_TRY(context, timelineSemaphore.init(renderer->getDevice(), semaphoreInfo));
+        }
+    }
+
     return angle::Result::Continue;
 }
 
@@ -773,15 +954,37 @@ angle::Result CommandQueue::checkCompletedCommands(Context *context)
 
     int finishedCount = 0;
 
-    for (CommandBatch &batch : mInFlightCommands)
+    if (useTimelineSemaphores())
     {
-        VkResult result = batch.fence.get().getStatus(device);
-        if (result == VK_NOT_READY)
+        // Query each queue's progress once instead of checking every batch.
+        angle::PackedEnumMap<egl::ContextPriority, uint64_t> completedValues;
+        for (egl::ContextPriority priority : angle::AllEnums<egl::ContextPriority>())
         {
-            break;
+            ANGLE_VK_TRY(context, mTimelineSemaphores[priority].getCounterValue(
+                                      device, &completedValues[priority]));
+        }
+
+        for (CommandBatch &batch : mInFlightCommands)
+        {
+            if (batch.serial.getValue() > completedValues[batch.priority])
+            {
+                break;
+            }
+            ++finishedCount;
+        }
+    }
+    else
+    {
+        for (CommandBatch &batch : mInFlightCommands)
+        {
+            VkResult result = batch.fence.get().getStatus(device);
+            if (result == VK_NOT_READY)
+            {
+                break;
+            }
+            ANGLE_VK_TRY(context, result);
+            ++finishedCount;
         }
-        ANGLE_VK_TRY(context, result);
-        ++finishedCount;
     }
 
     if (finishedCount == 0)
@@ -807,6 +1010,11 @@ angle::Result CommandQueue::retireFinishedCommands(Context *context, size_t fini
         mFenceRecycler.resetSharedFence(&batch.fence);
         ANGLE_TRACE_EVENT0("gpu.angle", "command buffer recycling");
         batch.commandPool.destroy(device);
+        for (CommandPool &secondaryCommandPool : batch.secondaryCommandPools)
+        {
+            secondaryCommandPool.destroy(device);
+        }
+        batch.secondaryCommandPools.clear();
         ANGLE_TRY(mPrimaryCommandPool.collect(context, std::move(batch.primaryCommands)));
     }
 
@@ -887,10 +1095,13 @@ void CommandQueue::handleDeviceLost(RendererVk *renderer)
 
     VkDevice device = renderer->getDevice();
 
+    // The recorded command buffers are discarded along with the rest of the pending work.
+    discardPendingSecondaryCommandBuffers(renderer);
+
     for (CommandBatch &batch : mInFlightCommands)
     {
         // On device loss we need to wait for fence to be signaled before destroying it
-        VkResult status = batch.fence.get().wait(device, renderer->getMaxFenceWaitTimeNs());
+        VkResult status = waitForBatch(device, batch, renderer->getMaxFenceWaitTimeNs());
         // If the wait times out, it is probably not possible to recover from lost device
         ASSERT(status == VK_SUCCESS || status == VK_ERROR_DEVICE_LOST);
 
@@ -899,6 +1110,11 @@ void CommandQueue::handleDeviceLost(RendererVk *renderer)
         batch.primaryCommands.destroy(device);
 
         batch.commandPool.destroy(device);
+        for (CommandPool &secondaryCommandPool : batch.secondaryCommandPools)
+        {
+            secondaryCommandPool.destroy(device);
+        }
+        batch.secondaryCommandPools.clear();
         batch.fence.reset(device);
     }
     mInFlightCommands.clear();
@@ -909,6 +1125,19 @@ bool CommandQueue::allInFlightCommandsAreAfterSerial(Serial serial) const
     return mInFlightCommands.empty() || mInFlightCommands[0].serial > serial;
 }
 
+VkResult CommandQueue::waitForBatch(VkDevice device,
+                                    const CommandBatch &batch,
+                                    uint64_t timeout) const
+{
+    if (useTimelineSemaphores())
+    {
+        return mTimelineSemaphores[batch.priority].wait(device, batch.serial.getValue(), timeout);
+    }
+
+    ASSERT(batch.fence.get().valid());
+    return batch.fence.get().wait(device, timeout);
+}
+
 angle::Result CommandQueue::finishToSerial(Context *context, Serial finishSerial, uint64_t timeout)
 {
     if (mInFlightCommands.empty())
@@ -937,7 +1166,7 @@ angle::Result CommandQueue::finishToSerial(Context *context, Serial finishSerial
 
     // Wait for it finish
     VkDevice device = context->getDevice();
-    VkResult status = batch.fence.get().wait(device, timeout);
+    VkResult status = waitForBatch(device, batch, timeout);
 
     ANGLE_VK_TRY(context, status);
 
@@ -966,6 +1195,7 @@ angle::Result CommandQueue::submitFrame(
     Serial submitQueueSerial)
 {
     // Start an empty primary buffer if we have an empty submit.
+    ANGLE_TRY(flushPendingSecondaryCommandBuffers(context));
     ANGLE_TRY(ensurePrimaryCommandBufferValid(context));
     ANGLE_VK_TRY(context, mPrimaryCommands.end());
 
@@ -981,10 +1211,27 @@ angle::Result CommandQueue::submitFrame(
     DeviceScoped<CommandBatch> scopedBatch(device);
     CommandBatch &batch = scopedBatch.get();
 
-    ANGLE_TRY(mFenceRecycler.newSharedFence(context, &batch.fence));
-    batch.serial = submitQueueSerial;
+    batch.serial                = submitQueueSerial;
+    batch.priority              = priority;
+    batch.secondaryCommandPools = std::move(mSecondaryCommandPools);
+    mSecondaryCommandPools.clear();
+
+    std::array<VkSemaphore, 2> signalSemaphores;
+    std::array<uint64_t, 2> signalValues;
+    VkTimelineSemaphoreSubmitInfoKHR timelineInfo = {};
+    const Fence *fence                            = nullptr;
+    if (useTimelineSemaphores())
+    {
+        AddTimelineSemaphoreSignal(&submitInfo, mTimelineSemaphores[priority], batch.serial,
+                                   &signalSemaphores, &signalValues, &timelineInfo);
+    }
+    else
+    {
+        ANGLE_TRY(mFenceRecycler.newSharedFence(context, &batch.fence));
+        fence = &batch.fence.get();
+    }
 
-    ANGLE_TRY(queueSubmit(context, priority, submitInfo, &batch.fence.get(), batch.serial));
+    ANGLE_TRY(queueSubmit(context, priority, submitInfo, fence, batch.serial));
 
     if (!currentGarbage.empty())
     {
@@ -1046,9 +1293,7 @@ angle::Result CommandQueue::waitForSerialWithUserTimeout(vk::Context *context,
 
     ASSERT(serial == mInFlightCommands[batchIndex].serial);
 
-    vk::Fence &fence = mInFlightCommands[batchIndex].fence.get();
-    ASSERT(fence.valid());
-    *result = fence.wait(context->getDevice(), timeout);
+    *result = waitForBatch(context->getDevice(), mInFlightCommands[batchIndex], timeout);
 
     // Don't trigger an error on timeout.
     if (*result != VK_TIMEOUT)
@@ -1080,6 +1325,12 @@ angle::Result CommandQueue::ensurePrimaryCommandBufferValid(Context *context)
 angle::Result CommandQueue::flushOutsideRPCommands(Context *context,
                                                    CommandBufferHelper **outsideRPCommands)
 {
+    if (canRecordInParallel(context, **outsideRPCommands, nullptr))
+    {
+        return recordInParallel(context, nullptr, outsideRPCommands);
+    }
+
+    ANGLE_TRY(flushPendingSecondaryCommandBuffers(context));
     ANGLE_TRY(ensurePrimaryCommandBufferValid(context));
     return (*outsideRPCommands)
         ->flushToPrimary(context->getRenderer()->getFeatures(), &mPrimaryCommands, nullptr);
@@ -1089,11 +1340,133 @@ angle::Result CommandQueue::flushRenderPassCommands(Context *context,
                                                     const RenderPass &renderPass,
                                                     CommandBufferHelper **renderPassCommands)
 {
+    if (canRecordInParallel(context, **renderPassCommands, &renderPass))
+    {
+        return recordInParallel(context, &renderPass, renderPassCommands);
+    }
+
+    ANGLE_TRY(flushPendingSecondaryCommandBuffers(context));
     ANGLE_TRY(ensurePrimaryCommandBufferValid(context));
     return (*renderPassCommands)
         ->flushToPrimary(context->getRenderer()->getFeatures(), &mPrimaryCommands, &renderPass);
 }
 
+bool CommandQueue::canRecordInParallel(Context *context,
+                                       const CommandBufferHelper &commandBuffer,
+                                       const RenderPass *renderPass) const
+{
+    const angle::FeaturesVk &features = context->getRenderer()->getFeatures();
+
+    // The CommandProcessor recycles the command buffer helpers itself once they are flushed.
+    if (!features.parallelCommandBufferRecording.enabled || features.asyncCommandQueue.enabled)
+    {
+        return false;
+    }
+
+    // vkCmdNextSubpass can't be recorded in a secondary command buffer, so render passes with an
+    // unresolve subpass are flushed inline.
+    if (renderPass != nullptr)
+    {
+        const RenderPassDesc &renderPassDesc = commandBuffer.getRenderPassDesc();
+        if (renderPassDesc.getColorUnresolveAttachmentMask().any() ||
+            renderPassDesc.hasDepthStencilUnresolveAttachment())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+angle::Result CommandQueue::recordInParallel(Context *context,
+                                             const RenderPass *renderPass,
+                                             CommandBufferHelper **commandBuffer)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::recordInParallel");
+    RendererVk *renderer = context->getRenderer();
+
+    // Hand the helper over to the worker and give the caller a fresh one to record into.
+    (*commandBuffer)->markClosed();
+    PendingSecondaryCommandBuffer pending;
+    pending.task =
+        std::make_shared<RecordSecondaryCommandBufferTask>(renderer, *commandBuffer, renderPass);
+    pending.waitableEvent =
+        angle::WorkerThreadPool::PostWorkerTask(renderer->getWorkerThreadPool(), pending.task);
+    mPendingSecondaryCommandBuffers.push_back(std::move(pending));
+
+    *commandBuffer = renderer->getCommandBufferHelper(renderPass != nullptr);
+
+    return angle::Result::Continue;
+}
+
+angle::Result CommandQueue::flushPendingSecondaryCommandBuffers(Context *context)
+{
+    if (mPendingSecondaryCommandBuffers.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::flushPendingSecondaryCommandBuffers");
+    RendererVk *renderer = context->getRenderer();
+
+    ANGLE_TRY(ensurePrimaryCommandBufferValid(context));
+
+    // Every task must be waited for and have its pool tracked before an error is returned.
+    waitForPendingSecondaryCommandBuffers();
+    angle::Result result = angle::Result::Continue;
+    for (PendingSecondaryCommandBuffer &pending : mPendingSecondaryCommandBuffers)
+    {
+        RecordSecondaryCommandBufferTask *task = pending.task.get();
+        CommandBufferHelper *commandBuffer     = task->getCommandBuffer();
+
+        if (result == angle::Result::Continue)
+        {
+            result = task->getResult(context);
+        }
+        if (result == angle::Result::Continue)
+        {
+            result = commandBuffer->flushSecondaryToPrimary(renderer->getFeatures(),
+                                                            &mPrimaryCommands,
+                                                            task->getRenderPass(),
+                                                            task->getSecondaryCommands());
+        }
+        else
+        {
+            commandBuffer->reset();
+        }
+
+        renderer->recycleCommandBufferHelper(commandBuffer);
+        if (task->getCommandPool().valid())
+        {
+            mSecondaryCommandPools.push_back(std::move(task->getCommandPool()));
+        }
+    }
+    mPendingSecondaryCommandBuffers.clear();
+
+    return result;
+}
+
+void CommandQueue::waitForPendingSecondaryCommandBuffers()
+{
+    for (PendingSecondaryCommandBuffer &pending : mPendingSecondaryCommandBuffers)
+    {
+        pending.waitableEvent->wait();
+    }
+}
+
+void CommandQueue::discardPendingSecondaryCommandBuffers(RendererVk *renderer)
+{
+    waitForPendingSecondaryCommandBuffers();
+    for (PendingSecondaryCommandBuffer &pending : mPendingSecondaryCommandBuffers)
+    {
+        CommandBufferHelper *commandBuffer = pending.task->getCommandBuffer();
+        commandBuffer->reset();
+        renderer->recycleCommandBufferHelper(commandBuffer);
+        pending.task->getCommandPool().destroy(renderer->getDevice());
+    }
+    mPendingSecondaryCommandBuffers.clear();
+}
+
 angle::Result CommandQueue::queueSubmitOneOff(Context *context,
                                               egl::ContextPriority contextPriority,
                                               VkCommandBuffer commandBufferHandle,
@@ -1142,6 +1515,16 @@ VkResult CommandQueue::queuePresent(egl::ContextPriority contextPriority,
     return vkQueuePresentKHR(mQueues[contextPriority], &presentInfo);
 }
 
+angle::Result CommandQueue::queueBindSparse(Context *context,
+                                            egl::ContextPriority contextPriority,
+                                            const VkBindSparseInfo &bindSparseInfo)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::queueBindSparse");
+    ANGLE_VK_TRY(context,
+                 vkQueueBindSparse(mQueues[contextPriority], 1, &bindSparseInfo, VK_NULL_HANDLE));
+    return angle::Result::Continue;
+}
+
 Serial CommandQueue::getLastSubmittedQueueSerial() const
 {
     return mLastSubmittedQueueSerial;
@@ -17,6 +17,7 @@
 #include <thread>
 
 #include "common/vulkan/vk_headers.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/vulkan/PersistentCommandPool.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 
@@ -173,12 +174,19 @@ struct CommandBatch final : angle::NonCopyable
     PrimaryCommandBuffer primaryCommands;
     // commandPool is for secondary CommandBuffer allocation
     CommandPool commandPool;
+    // Pools that own the secondary command buffers recorded with parallelCommandBufferRecording.
+    std::vector<CommandPool> secondaryCommandPools;
+    // Not used when the supportsTimelineSemaphore feature is enabled.  The batch is complete once
+    // the timeline semaphore of the queue it was submitted to reaches |serial| instead.
     Shared<Fence> fence;
     Serial serial;
+    egl::ContextPriority priority = egl::ContextPriority::Medium;
 };
 
 using DeviceQueueMap = angle::PackedEnumMap<egl::ContextPriority, VkQueue>;
 
+class RecordSecondaryCommandBufferTask;
+
 class CommandQueueInterface : angle::NonCopyable
 {
   public:
@@ -211,6 +219,9 @@ class CommandQueueInterface : angle::NonCopyable
                                             Serial submitQueueSerial)  = 0;
     virtual VkResult queuePresent(egl::ContextPriority contextPriority,
                                   const VkPresentInfoKHR &presentInfo) = 0;
+    virtual angle::Result queueBindSparse(Context *context,
+                                          egl::ContextPriority contextPriority,
+                                          const VkBindSparseInfo &bindSparseInfo) = 0;
 
     virtual angle::Result waitForSerialWithUserTimeout(vk::Context *context,
                                                        Serial serial,
@@ -267,6 +278,9 @@ class CommandQueue final : public CommandQueueInterface
 
     VkResult queuePresent(egl::ContextPriority contextPriority,
                           const VkPresentInfoKHR &presentInfo) override;
+    angle::Result queueBindSparse(Context *context,
+                                  egl::ContextPriority contextPriority,
+                                  const VkBindSparseInfo &bindSparseInfo) override;
 
     angle::Result waitForSerialWithUserTimeout(vk::Context *context,
                                                Serial serial,
@@ -301,6 +315,25 @@ class CommandQueue final : public CommandQueueInterface
 
     bool allInFlightCommandsAreAfterSerial(Serial serial) const;
 
+    bool useTimelineSemaphores() const
+    {
+        return mTimelineSemaphores[egl::ContextPriority::Medium].valid();
+    }
+    VkResult waitForBatch(VkDevice device, const CommandBatch &batch, uint64_t timeout) const;
+
+    // Used with the parallelCommandBufferRecording feature.
+    bool canRecordInParallel(Context *context,
+                             const CommandBufferHelper &commandBuffer,
+                             const RenderPass *renderPass) const;
+    angle::Result recordInParallel(Context *context,
+                                   const RenderPass *renderPass,
+                                   CommandBufferHelper **commandBuffer);
+    // Waits for the pending secondary command buffers and executes them in the primary command
+    // buffer in the order they were flushed.
+    angle::Result flushPendingSecondaryCommandBuffers(Context *context);
+    void waitForPendingSecondaryCommandBuffers();
+    void discardPendingSecondaryCommandBuffers(RendererVk *renderer);
+
     GarbageQueue mGarbageQueue;
     std::vector<CommandBatch> mInFlightCommands;
 
@@ -317,7 +350,20 @@ class CommandQueue final : public CommandQueueInterface
     // Devices queues.
     DeviceQueueMap mQueues;
 
+    // One timeline semaphore per queue, signaled with the serial of each submission.  Signal
+    // values must increase per semaphore, which would not hold across queues for a shared one.
+    angle::PackedEnumMap<egl::ContextPriority, Semaphore> mTimelineSemaphores;
+
     FenceRecycler mFenceRecycler;
+
+    struct PendingSecondaryCommandBuffer
+    {
+        std::shared_ptr<RecordSecondaryCommandBufferTask> task;
+        std::shared_ptr<angle::WaitableEvent> waitableEvent;
+    };
+    std::vector<PendingSecondaryCommandBuffer> mPendingSecondaryCommandBuffers;
+    // Pools of the secondary command buffers executed in mPrimaryCommands.
+    std::vector<CommandPool> mSecondaryCommandPools;
 };
 
 // CommandProcessor is used to dispatch work to the GPU when the asyncCommandQueue feature is
@@ -375,6 +421,9 @@ class CommandProcessor : public Context, public CommandQueueInterface
                                     Serial submitQueueSerial) override;
     VkResult queuePresent(egl::ContextPriority contextPriority,
                           const VkPresentInfoKHR &presentInfo) override;
+    angle::Result queueBindSparse(Context *context,
+                                  egl::ContextPriority contextPriority,
+                                  const VkBindSparseInfo &bindSparseInfo) override;
 
     angle::Result waitForSerialWithUserTimeout(vk::Context *context,
                                                Serial serial,
@@ -420,12 +469,14 @@ class CommandProcessor : public Context, public CommandQueueInterface
     VkResult present(egl::ContextPriority priority, const VkPresentInfoKHR &presentInfo);
 
     std::queue<CommandProcessorTask> mTasks;
+    // The batch of tasks the worker thread is processing, only accessed by that thread.
+    std::queue<CommandProcessorTask> mProcessingTasks;
     mutable std::mutex mWorkerMutex;
     // Signal worker thread when work is available
     std::condition_variable mWorkAvailableCondition;
     // Signal main thread when all work completed
     mutable std::condition_variable mWorkerIdleCondition;
-    // Track worker thread Idle state for assertion purposes
+    // Track worker thread Idle state, which is also when it waits on mWorkAvailableCondition
     bool mWorkerThreadIdle;
     // Command pool to allocate processor thread primary command buffers from
     CommandPool mCommandPool;
@@ -13,10 +13,13 @@
 #include "common/debug.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Context.inl.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/Semaphore.h"
 #include "libANGLE/Surface.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/renderer_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
@@ -140,6 +143,11 @@ constexpr size_t kDefaultValueSize              = sizeof(gl::VertexAttribCurrent
 constexpr size_t kDefaultBufferSize             = kDefaultValueSize * 16;
 constexpr size_t kDriverUniformsAllocatorPageSize = 4 * 1024;
 
+constexpr angle::PackedEnumMap<PipelineType, VkShaderStageFlags> kDriverUniformsShaderStages = {
+    {PipelineType::Graphics, VK_SHADER_STAGE_ALL_GRAPHICS},
+    {PipelineType::Compute, VK_SHADER_STAGE_COMPUTE_BIT},
+};
+
 uint32_t GetCoverageSampleCount(const gl::State &glState, FramebufferVk *drawFramebuffer)
 {
     if (!glState.isSampleCoverageEnabled())
@@ -289,10 +297,13 @@ egl::ContextPriority GetContextPriority(const gl::State &state)
     return egl::FromEGLenum<egl::ContextPriority>(state.getContextPriority());
 }
 
+// |appendSize| and |appendOffset| are false for the binding properties the descriptor set doesn't
+// depend on, so that bindings that differ only in them share the cached descriptor set.
 template <typename MaskT>
 void AppendBufferVectorToDesc(vk::ShaderBuffersDescriptorDesc *desc,
                               const gl::BufferVector &buffers,
                               const MaskT &buffersMask,
+                              bool appendSize,
                               bool appendOffset)
 {
     if (buffersMask.any())
@@ -323,9 +334,12 @@ void AppendBufferVectorToDesc(vk::ShaderBuffersDescriptorDesc *desc,
                 bufferVk->getBufferAndOffset(&bufferOffset).getBufferSerial();
 
             desc->appendBufferSerial(bufferSerial);
-            ASSERT(static_cast<uint64_t>(binding.getSize()) <=
-                   static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()));
-            desc->append32BitValue(static_cast<uint32_t>(binding.getSize()));
+            if (appendSize)
+            {
+                ASSERT(static_cast<uint64_t>(binding.getSize()) <=
+                       static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()));
+                desc->append32BitValue(static_cast<uint32_t>(binding.getSize()));
+            }
             if (appendOffset)
             {
                 ASSERT(static_cast<uint64_t>(binding.getOffset()) <
@@ -337,6 +351,41 @@ void AppendBufferVectorToDesc(vk::ShaderBuffersDescriptorDesc *desc,
 
     desc->append32BitValue(std::numeric_limits<uint32_t>::max());
 }
+
+void AppendImagesToDesc(vk::ShaderBuffersDescriptorDesc *desc,
+                        const gl::State &glState,
+                        const gl::ActiveTextureMask &activeImagesMask,
+                        const gl::ActiveTextureArray<TextureVk *> &activeImages)
+{
+    for (size_t imageUnitIndex : activeImagesMask)
+    {
+        TextureVk *textureVk = activeImages[imageUnitIndex];
+        if (textureVk == nullptr)
+        {
+            desc->append32BitValue(0);
+            continue;
+        }
+
+        const gl::ImageUnit &imageUnit = glState.getImageUnit(imageUnitIndex);
+
+        vk::ImageOrBufferViewSubresourceSerial serial;
+        if (textureVk->getBuffer().get() != nullptr)
+        {
+            serial = textureVk->getBufferViewSerial();
+        }
+        else
+        {
+            serial = textureVk->getStorageImageViewSerial(imageUnit);
+            desc->append32BitValue(ToUnderlying(textureVk->getImage().getCurrentImageLayout()));
+        }
+
+        desc->append32BitValue(serial.viewSerial.getValue());
+        desc->append32BitValue(gl::bitCast<uint32_t>(serial.subresource));
+        desc->append32BitValue(imageUnit.format);
+    }
+
+    desc->append32BitValue(std::numeric_limits<uint32_t>::max());
+}
 }  // anonymous namespace
 
 // Not necessary once upgraded to C++17.
@@ -383,7 +432,7 @@ class ContextVk::ScopedDescriptorSetUpdates final : angle::NonCopyable
 };
 
 ContextVk::DriverUniformsDescriptorSet::DriverUniformsDescriptorSet()
-    : descriptorSet(VK_NULL_HANDLE), dynamicOffset(0)
+    : descriptorSet(VK_NULL_HANDLE), dynamicOffset(0), range(0), pushConstantsData{}
 {}
 
 ContextVk::DriverUniformsDescriptorSet::~DriverUniformsDescriptorSet() = default;
@@ -415,6 +464,7 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
       mComputeDirtyBitHandlers{},
       mRenderPassCommandBuffer(nullptr),
       mCurrentGraphicsPipeline(nullptr),
+      mGraphicsPipelineManifestUpdated(false),
       mCurrentComputePipeline(nullptr),
       mCurrentDrawMode(gl::PrimitiveMode::InvalidEnum),
       mCurrentWindowSurface(nullptr),
@@ -441,6 +491,9 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
       mOutsideRenderPassCommands(nullptr),
       mRenderPassCommands(nullptr),
       mGpuEventsEnabled(false),
+      mGpuTimingEnabled(false),
+      mCurrentGpuFrameTiming(nullptr),
+      mEndGpuFrameTimingOnFlush(false),
       mEGLSyncObjectPendingFlush(false),
       mHasDeferredFlush(false),
       mLastProgramUsesFramebufferFetch(false),
@@ -476,6 +529,10 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
     {
         mNewGraphicsCommandBufferDirtyBits.set(DIRTY_BIT_TRANSFORM_FEEDBACK_BUFFERS);
     }
+    if (getFeatures().supportsExtendedDynamicState.enabled)
+    {
+        mNewGraphicsCommandBufferDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+    }
 
     mNewComputeCommandBufferDirtyBits =
         DirtyBits{DIRTY_BIT_PIPELINE_BINDING, DIRTY_BIT_TEXTURES, DIRTY_BIT_SHADER_RESOURCES,
@@ -518,6 +575,8 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
 
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DESCRIPTOR_SETS] =
         &ContextVk::handleDirtyGraphicsDescriptorSets;
+    mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_STATE] =
+        &ContextVk::handleDirtyGraphicsDynamicState;
 
     mComputeDirtyBitHandlers[DIRTY_BIT_MEMORY_BARRIER] =
         &ContextVk::handleDirtyComputeMemoryBarrier;
@@ -567,6 +626,18 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
     mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_UNIFORM_BUFFER_BINDINGS);
     mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_SHADER_STORAGE_BUFFER_BINDING);
     mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_ATOMIC_COUNTER_BUFFER_BINDING);
+    if (getFeatures().supportsExtendedDynamicState.enabled)
+    {
+        mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_CULL_FACE_ENABLED);
+        mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_CULL_FACE);
+        mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_FRONT_FACE);
+        mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_DEPTH_TEST_ENABLED);
+        mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_DEPTH_FUNC);
+        mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_DEPTH_MASK);
+        mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_STENCIL_TEST_ENABLED);
+        mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_STENCIL_OPS_FRONT);
+        mPipelineDirtyBitsMask.reset(gl::State::DIRTY_BIT_STENCIL_OPS_BACK);
+    }
 
     // Reserve reasonable amount of spaces so that for majority of apps we don't need to grow at all
     mDescriptorBufferInfos.reserve(kDescriptorBufferInfosInitialSize);
@@ -602,6 +673,7 @@ void ContextVk::onDestroy(const gl::Context *context)
     }
 
     mDefaultUniformStorage.release(mRenderer);
+    mMultiDrawIndirectBuffer.release(mRenderer);
     mEmptyBuffer.release(mRenderer);
     mStagingBuffer.release(mRenderer);
 
@@ -625,9 +697,17 @@ void ContextVk::onDestroy(const gl::Context *context)
 
     mUtils.destroy(mRenderer);
 
+    for (std::shared_ptr<angle::WaitableEvent> &event : mPendingGraphicsPipelineCreations)
+    {
+        event->wait();
+    }
+    mPendingGraphicsPipelineCreations.clear();
+
     mRenderPassCache.destroy(mRenderer);
-    mShaderLibrary.destroy(device);
     mGpuEventQueryPool.destroy(device);
+    mInFlightGpuTimingQueries.clear();
+    mCurrentGpuFrameTiming = nullptr;
+    mGpuTimingQueryPool.destroy(device);
     mCommandPool.destroy(device);
 
     ASSERT(mCurrentGarbage.empty());
@@ -671,16 +751,12 @@ angle::Result ContextVk::initialize()
     initIndexTypeMap();
 
     // Init driver uniforms and get the descriptor set layouts.
-    constexpr angle::PackedEnumMap<PipelineType, VkShaderStageFlags> kPipelineStages = {
-        {PipelineType::Graphics, VK_SHADER_STAGE_ALL_GRAPHICS},
-        {PipelineType::Compute, VK_SHADER_STAGE_COMPUTE_BIT},
-    };
     for (PipelineType pipeline : angle::AllEnums<PipelineType>())
     {
         mDriverUniforms[pipeline].init(mRenderer);
 
         vk::DescriptorSetLayoutDesc desc =
-            getDriverUniformsDescriptorSetDesc(kPipelineStages[pipeline]);
+            getDriverUniformsDescriptorSetDesc(kDriverUniformsShaderStages[pipeline]);
         ANGLE_TRY(getDescriptorSetLayoutCache().getDescriptorSetLayout(
             this, desc, &mDriverUniforms[pipeline].descriptorSetLayout));
 
@@ -700,7 +776,7 @@ angle::Result ContextVk::initialize()
                 descriptorPoolSizes.emplace_back(poolSize);
             }
         }
-        if (!descriptorPoolSizes.empty())
+        if (!descriptorPoolSizes.empty() && !getFeatures().supportsPushDescriptor.enabled)
         {
             ANGLE_TRY(mDriverUniformsDescriptorPools[pipeline].init(
                 this, descriptorPoolSizes.data(), descriptorPoolSizes.size(),
@@ -757,6 +833,12 @@ angle::Result ContextVk::initialize()
                                 mRenderer->getDefaultUniformBufferSize(), true,
                                 vk::DynamicBufferPolicy::FrequentSmallAllocations);
 
+    // Indirect commands are made of uint32_t fields and their offset must be a multiple of 4.
+    constexpr size_t kMultiDrawIndirectBufferSize = 16 * 1024;
+    mMultiDrawIndirectBuffer.init(mRenderer, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, sizeof(uint32_t),
+                                  kMultiDrawIndirectBufferSize, true,
+                                  vk::DynamicBufferPolicy::FrequentSmallAllocations);
+
     // Initialize an "empty" buffer for use with default uniform blocks where there are no uniforms,
     // or atomic counter buffer array indices that are unused.
     constexpr VkBufferUsageFlags kEmptyBufferUsage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
@@ -870,6 +952,11 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
     // Update transform feedback offsets on every draw call when emulating transform feedback.  This
     // relies on the fact that no geometry/tessellation, indirect or indexed calls are supported in
     // ES3.1 (and emulation is not done for ES3.2).
+    //
+    // The offsets are computed on the CPU rather than allocated with atomics in the shader, as the
+    // captured vertices must be written in the order they are drawn, which atomics don't
+    // guarantee.  Only the driver uniforms are updated here; the transform feedback descriptor set
+    // stays the same until the buffers or the program change.
     if (getFeatures().emulateTransformFeedback.enabled &&
         mState.isTransformFeedbackActiveUnpaused())
     {
@@ -887,22 +974,109 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
         return angle::Result::Continue;
     }
 
-    // Flush any relevant dirty bits.
-    for (DirtyBits::Iterator dirtyBitIter = dirtyBits.begin(); dirtyBitIter != dirtyBits.end();
-         ++dirtyBitIter)
+    // Flush any relevant dirty bits.  The combinations that are common in steady state have
+    // specialized handlers; the generic loop handles the rest.
+    GraphicsDirtyBitSequenceHandler sequenceHandler = GetGraphicsDirtyBitSequenceHandler(dirtyBits);
+    if (sequenceHandler)
     {
-        ASSERT(mGraphicsDirtyBitHandlers[*dirtyBitIter]);
-        ANGLE_TRY((this->*mGraphicsDirtyBitHandlers[*dirtyBitIter])(&dirtyBitIter, dirtyBitMask));
+        ANGLE_TRY((this->*sequenceHandler)(dirtyBitMask));
+    }
+    else
+    {
+        for (DirtyBits::Iterator dirtyBitIter = dirtyBits.begin(); dirtyBitIter != dirtyBits.end();
+             ++dirtyBitIter)
+        {
+            ASSERT(mGraphicsDirtyBitHandlers[*dirtyBitIter]);
+            ANGLE_TRY(
+                (this->*mGraphicsDirtyBitHandlers[*dirtyBitIter])(&dirtyBitIter, dirtyBitMask));
+        }
     }
 
     mGraphicsDirtyBits &= ~dirtyBitMask;
 
+    if (ANGLE_UNLIKELY(mGraphicsPipelineManifestUpdated))
+    {
+        updateProgramCacheWithGraphicsPipelineManifest(context);
+    }
+
     // Render pass must be always available at this point.
     ASSERT(mRenderPassCommandBuffer);
 
     return angle::Result::Continue;
 }
 
+template <ContextVk::GraphicsDirtyBitHandler... kHandlers>
+angle::Result ContextVk::handleDirtyGraphicsBitSequence(DirtyBits dirtyBitMask)
+{
+    constexpr GraphicsDirtyBitHandler kSequence[] = {kHandlers...};
+
+    // The handlers in a sequence never touch the iterator, it's only passed to match their
+    // signature.
+    DirtyBits::Iterator unusedIterator = DirtyBits().begin();
+    for (GraphicsDirtyBitHandler handler : kSequence)
+    {
+        ANGLE_TRY((this->*handler)(&unusedIterator, dirtyBitMask));
+    }
+
+    return angle::Result::Continue;
+}
+
+// static
+ContextVk::GraphicsDirtyBitSequenceHandler ContextVk::GetGraphicsDirtyBitSequenceHandler(
+    DirtyBits dirtyBits)
+{
+    // The handlers of each sequence must be listed in the order of their dirty bits.
+    switch (dirtyBits.bits())
+    {
+        case DirtyBits{DIRTY_BIT_VERTEX_BUFFERS}.bits():
+            return &ContextVk::handleDirtyGraphicsBitSequence<
+                &ContextVk::handleDirtyGraphicsVertexBuffers>;
+        case DirtyBits{DIRTY_BIT_DESCRIPTOR_SETS}.bits():
+            return &ContextVk::handleDirtyGraphicsBitSequence<
+                &ContextVk::handleDirtyGraphicsDescriptorSets>;
+        case kIndexAndVertexDirtyBits.bits():
+            return &ContextVk::handleDirtyGraphicsBitSequence<
+                &ContextVk::handleDirtyGraphicsVertexBuffers,
+                &ContextVk::handleDirtyGraphicsIndexBuffer>;
+        case kTexturesAndDescSetDirtyBits.bits():
+            return &ContextVk::handleDirtyGraphicsBitSequence<
+                &ContextVk::handleDirtyGraphicsTextures,
+                &ContextVk::handleDirtyGraphicsDescriptorSets>;
+        case kDriverUniformsAndBindingDirtyBits.bits():
+            return &ContextVk::handleDirtyGraphicsBitSequence<
+                &ContextVk::handleDirtyGraphicsDriverUniforms,
+                &ContextVk::handleDirtyGraphicsDriverUniformsBinding>;
+        case kVertexAndDriverUniformsDirtyBits.bits():
+            return &ContextVk::handleDirtyGraphicsBitSequence<
+                &ContextVk::handleDirtyGraphicsVertexBuffers,
+                &ContextVk::handleDirtyGraphicsDriverUniforms,
+                &ContextVk::handleDirtyGraphicsDriverUniformsBinding>;
+        default:
+            return nullptr;
+    }
+}
+
+void ContextVk::updateProgramCacheWithGraphicsPipelineManifest(const gl::Context *context)
+{
+    mGraphicsPipelineManifestUpdated = false;
+
+    // Only programs that are in the program cache record their pipelines.  See
+    // ProgramExecutableVk::getGraphicsPipeline().
+    gl::Program *program          = mState.getProgram();
+    gl::MemoryProgramCache *cache = context->getMemoryProgramCache();
+    if (program == nullptr || cache == nullptr || program->isSeparable())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> cacheLock(context->getProgramCacheMutex());
+    if (cache->updateProgram(context, program) == angle::Result::Stop)
+    {
+        // Not being able to save the pipelines doesn't affect rendering.
+        WARN() << "Failed to update the program cache with the program's graphics pipelines.";
+    }
+}
+
 angle::Result ContextVk::setupIndexedDraw(const gl::Context *context,
                                           gl::PrimitiveMode mode,
                                           GLsizei indexCount,
@@ -1112,7 +1286,8 @@ angle::Result ContextVk::setupDispatch(const gl::Context *context)
         mComputeDirtyBits.set(DIRTY_BIT_DESCRIPTOR_SETS);
     }
 
-    DirtyBits dirtyBits = mComputeDirtyBits;
+    DirtyBits dirtyBits                     = mComputeDirtyBits;
+    const uint32_t writeDescriptorSetsBefore = mPerfCounters.writeDescriptorSets;
 
     // Flush any relevant dirty bits.
     for (size_t dirtyBit : dirtyBits)
@@ -1122,6 +1297,8 @@ angle::Result ContextVk::setupDispatch(const gl::Context *context)
     }
 
     mComputeDirtyBits.reset();
+    mPerfCounters.dispatchWriteDescriptorSets +=
+        mPerfCounters.writeDescriptorSets - writeDescriptorSetsBefore;
 
     return angle::Result::Continue;
 }
@@ -1360,9 +1537,9 @@ angle::Result ContextVk::handleDirtyGraphicsDefaultAttribs(DirtyBits::Iterator *
 angle::Result ContextVk::handleDirtyGraphicsPipelineDesc(DirtyBits::Iterator *dirtyBitsIterator,
                                                          DirtyBits dirtyBitMask)
 {
-    const VkPipeline previousPipeline = mCurrentGraphicsPipeline
-                                            ? mCurrentGraphicsPipeline->getPipeline().getHandle()
-                                            : VK_NULL_HANDLE;
+    // The pipeline handle may not be available yet if it's being created asynchronously, so the
+    // PipelineHelpers are compared instead.  Each PipelineHelper holds a different pipeline.
+    const vk::PipelineHelper *previousPipeline = mCurrentGraphicsPipeline;
 
     ASSERT(mExecutable);
 
@@ -1402,17 +1579,24 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineDesc(DirtyBits::Iterator *di
 
         mGraphicsPipelineTransition.reset();
     }
+
+    // The pipeline may have been evicted from the cache while it was not in use.
+    bool pipelineRecreated = false;
+    if (mCurrentGraphicsPipeline->isEvicted())
+    {
+        ANGLE_TRY(recreateEvictedGraphicsPipeline());
+        pipelineRecreated = true;
+    }
+
     // Update the queue serial for the pipeline object.
     ASSERT(mCurrentGraphicsPipeline && mCurrentGraphicsPipeline->valid());
     // TODO: https://issuetracker.google.com/issues/169788986: Need to change this so that we get
     // the actual serial used when this work is submitted.
     mCurrentGraphicsPipeline->updateSerial(getCurrentQueueSerial());
 
-    const VkPipeline newPipeline = mCurrentGraphicsPipeline->getPipeline().getHandle();
-
     // If there's no change in pipeline, avoid rebinding it later.  If the rebind is due to a new
     // command buffer or UtilsVk, it will happen anyway with DIRTY_BIT_PIPELINE_BINDING.
-    if (newPipeline == previousPipeline)
+    if (mCurrentGraphicsPipeline == previousPipeline && !pipelineRecreated)
     {
         return angle::Result::Continue;
     }
@@ -1437,17 +1621,25 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineDesc(DirtyBits::Iterator *di
 angle::Result ContextVk::handleDirtyGraphicsRenderPass(DirtyBits::Iterator *dirtyBitsIterator,
                                                        DirtyBits dirtyBitMask)
 {
+    gl::Rectangle scissoredRenderArea = mDrawFramebuffer->getRotatedScissoredRenderArea(this);
+    bool renderPassDescChanged        = false;
+
     // If the render pass needs to be recreated, close it using the special mid-dirty-bit-handling
-    // function, so later dirty bits can be set.
+    // function, so later dirty bits can be set.  A render pass that was only set aside because
+    // the draw framebuffer binding changed may be continued instead.
     if (mRenderPassCommands->started())
     {
+        bool resumed = false;
+        ANGLE_TRY(resumeSuspendedRenderPass(scissoredRenderArea, &resumed));
+        if (resumed)
+        {
+            return angle::Result::Continue;
+        }
+
         ANGLE_TRY(flushDirtyGraphicsRenderPass(dirtyBitsIterator,
                                                dirtyBitMask & ~DirtyBits{DIRTY_BIT_RENDER_PASS}));
     }
 
-    gl::Rectangle scissoredRenderArea = mDrawFramebuffer->getRotatedScissoredRenderArea(this);
-    bool renderPassDescChanged        = false;
-
     ANGLE_TRY(startRenderPass(scissoredRenderArea, nullptr, &renderPassDescChanged));
 
     // The render pass desc can change when starting the render pass, for example due to
@@ -1466,8 +1658,71 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineBinding(DirtyBits::Iterator
 {
     ASSERT(mCurrentGraphicsPipeline);
 
+    if (mCurrentGraphicsPipeline->isEvicted())
+    {
+        ANGLE_TRY(recreateEvictedGraphicsPipeline());
+    }
+
+    ANGLE_TRY(mCurrentGraphicsPipeline->waitForCreation(this));
     mRenderPassCommandBuffer->bindGraphicsPipeline(mCurrentGraphicsPipeline->getPipeline());
 
+    // Rebinding the same pipeline in a new command buffer skips handleDirtyGraphicsPipelineDesc,
+    // so the serial is updated here too to keep the pipeline from being evicted while in use.
+    mCurrentGraphicsPipeline->updateSerial(getCurrentQueueSerial());
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::recreateEvictedGraphicsPipeline()
+{
+    ASSERT(mCurrentGraphicsPipeline && mCurrentGraphicsPipeline->isEvicted());
+
+    // The cache finds the evicted entry for the current desc and recreates its pipeline in place.
+    const vk::GraphicsPipelineDesc *descPtr;
+    ANGLE_TRY(mExecutable->getGraphicsPipeline(
+        this, mCurrentDrawMode, *mGraphicsPipelineDesc,
+        mState.getProgramExecutable()->getNonBuiltinAttribLocationsMask(), &descPtr,
+        &mCurrentGraphicsPipeline));
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::handleDirtyGraphicsDynamicState(DirtyBits::Iterator *dirtyBitsIterator,
+                                                         DirtyBits dirtyBitMask)
+{
+    ASSERT(getFeatures().supportsExtendedDynamicState.enabled);
+
+    const gl::State &glState                       = mState;
+    const gl::RasterizerState &rasterState         = glState.getRasterizerState();
+    const gl::DepthStencilState &depthStencilState = glState.getDepthStencilState();
+    const gl::Framebuffer *drawFramebuffer         = glState.getDrawFramebuffer();
+
+    // This mirrors the state GraphicsPipelineDesc would otherwise hold.  Depth and stencil tests
+    // are only enabled if the draw framebuffer has the corresponding aspect, as a depth-only or
+    // stencil-only buffer may be emulated with a depth-stencil buffer.
+    const bool hasDepth   = drawFramebuffer->hasDepth();
+    const bool hasStencil = drawFramebuffer->hasStencil();
+
+    mRenderPassCommandBuffer->setCullModeEXT(gl_vk::GetCullMode(rasterState));
+    mRenderPassCommandBuffer->setFrontFaceEXT(
+        gl_vk::GetFrontFace(rasterState.frontFace, isYFlipEnabledForDrawFBO()));
+    mRenderPassCommandBuffer->setDepthTestEnableEXT(depthStencilState.depthTest && hasDepth);
+    mRenderPassCommandBuffer->setDepthWriteEnableEXT(depthStencilState.depthMask && hasDepth);
+    mRenderPassCommandBuffer->setDepthCompareOpEXT(
+        gl_vk::GetCompareOp(depthStencilState.depthFunc));
+    mRenderPassCommandBuffer->setStencilTestEnableEXT(depthStencilState.stencilTest &&
+                                                      hasStencil);
+    mRenderPassCommandBuffer->setStencilOpEXT(
+        VK_STENCIL_FACE_FRONT_BIT, gl_vk::GetStencilOp(depthStencilState.stencilFail),
+        gl_vk::GetStencilOp(depthStencilState.stencilPassDepthPass),
+        gl_vk::GetStencilOp(depthStencilState.stencilPassDepthFail),
+        gl_vk::GetCompareOp(depthStencilState.stencilFunc));
+    mRenderPassCommandBuffer->setStencilOpEXT(
+        VK_STENCIL_FACE_BACK_BIT, gl_vk::GetStencilOp(depthStencilState.stencilBackFail),
+        gl_vk::GetStencilOp(depthStencilState.stencilBackPassDepthPass),
+        gl_vk::GetStencilOp(depthStencilState.stencilBackPassDepthFail),
+        gl_vk::GetCompareOp(depthStencilState.stencilBackFunc));
+
     return angle::Result::Continue;
 }
 
@@ -1730,9 +1985,15 @@ ANGLE_INLINE angle::Result ContextVk::handleDirtyShaderResourcesImpl(
         return angle::Result::Continue;
     }
 
+    const vk::ShaderBuffersDescriptorDesc *shaderResourcesDesc = &mShaderBuffersDescriptorDesc;
     if (hasImages)
     {
         ANGLE_TRY(updateActiveImages(commandBufferHelper));
+
+        mShaderResourcesDescriptorDesc = mShaderBuffersDescriptorDesc;
+        AppendImagesToDesc(&mShaderResourcesDescriptorDesc, mState,
+                           executable->getActiveImagesMask(), mActiveImages);
+        shaderResourcesDesc = &mShaderResourcesDescriptorDesc;
     }
 
     // Process buffer barriers.
@@ -1816,7 +2077,7 @@ ANGLE_INLINE angle::Result ContextVk::handleDirtyShaderResourcesImpl(
     }
 
     ANGLE_TRY(mExecutable->updateShaderResourcesDescriptorSet(
-        this, mDrawFramebuffer, mShaderBuffersDescriptorDesc, commandBufferHelper));
+        this, mDrawFramebuffer, *shaderResourcesDesc, commandBufferHelper));
 
     // Record usage of storage buffers and images in the command buffer to aid handling of
     // glMemoryBarrier.
@@ -2043,6 +2304,15 @@ void ContextVk::updateOverlayOnPresent()
         mPerfCounters.writeDescriptorSets = 0;
     }
 
+    {
+        gl::RunningGraphWidget *dispatchWriteDescriptorSetCount =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanDispatchWriteDescriptorSetCount);
+        dispatchWriteDescriptorSetCount->add(mPerfCounters.dispatchWriteDescriptorSets);
+        dispatchWriteDescriptorSetCount->next();
+
+        mPerfCounters.dispatchWriteDescriptorSets = 0;
+    }
+
     {
         gl::RunningGraphWidget *descriptorSetAllocationCount =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanDescriptorSetAllocations);
@@ -2071,6 +2341,140 @@ void ContextVk::updateOverlayOnPresent()
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanDynamicBufferAllocations);
         dynamicBufferAllocations->next();
     }
+
+    {
+        gl::RunningGraphWidget *pipelineCacheEvictions =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanPipelineCacheEvictions);
+        pipelineCacheEvictions->add(mPerfCounters.graphicsPipelineEvictions);
+        pipelineCacheEvictions->next();
+
+        mPerfCounters.graphicsPipelineEvictions = 0;
+    }
+
+    {
+        gl::RunningGraphWidget *garbageObjectCount =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanGarbageObjectCount);
+        garbageObjectCount->add(mRenderer->getSharedGarbageObjectCount());
+        garbageObjectCount->next();
+    }
+
+    {
+        gl::RunningGraphWidget *memoryBudgetUsage =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanMemoryBudgetUsage);
+        const VkDeviceSize budget = mRenderer->getMemoryBudget();
+        if (budget > 0)
+        {
+            memoryBudgetUsage->add(static_cast<size_t>(mRenderer->getMemoryUsage() * 100 / budget));
+        }
+        memoryBudgetUsage->next();
+    }
+}
+
+angle::Result ContextVk::updateOverlayGpuTimesOnPresent()
+{
+    if (!mState.getOverlay()->isEnabled())
+    {
+        return angle::Result::Continue;
+    }
+
+    // The overlay is not yet created when the context is initialized, so the GPU timing starts on
+    // the first present.
+    if (!mGpuTimingEnabled)
+    {
+        if (mRenderer->getQueueFamilyProperties().timestampValidBits == 0)
+        {
+            return angle::Result::Continue;
+        }
+
+        ANGLE_TRY(mGpuTimingQueryPool.init(this, VK_QUERY_TYPE_TIMESTAMP,
+                                           vk::kDefaultTimestampQueryPoolSize));
+        mGpuTimingEnabled = true;
+    }
+
+    // The frame's timing ends when the present flushes the commands, after its last render pass.
+    mEndGpuFrameTimingOnFlush = mCurrentGpuFrameTiming != nullptr;
+
+    return checkCompletedGpuTimingQueries();
+}
+
+angle::Result ContextVk::beginGpuTiming(bool isFrame, GpuTimingQuery **timingOut)
+{
+    mInFlightGpuTimingQueries.emplace_back();
+    GpuTimingQuery &timing = mInFlightGpuTimingQueries.back();
+    timing.isFrame         = isFrame;
+    ANGLE_TRY(writeGpuTimingQuery(&timing.begin));
+
+    *timingOut = &timing;
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::writeGpuTimingQuery(vk::QueryHelper *queryOut)
+{
+    ASSERT(mGpuTimingEnabled);
+
+    ANGLE_TRY(mGpuTimingQueryPool.allocateQuery(this, queryOut));
+    queryOut->writeTimestamp(this, &mOutsideRenderPassCommands->getCommandBuffer());
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::checkCompletedGpuTimingQueries()
+{
+    ASSERT(mGpuTimingEnabled);
+
+    const gl::OverlayType *overlay = mState.getOverlay();
+    gl::RunningGraphWidget *renderPassGpuTime =
+        overlay->getRunningGraphWidget(gl::WidgetId::VulkanRenderPassGpuTime);
+    gl::RunningGraphWidget *frameGpuTime =
+        overlay->getRunningGraphWidget(gl::WidgetId::VulkanFrameGpuTime);
+
+    // timestampPeriod gives nanoseconds/cycle.  The widgets show microseconds.
+    const double microsecondsPerCycle =
+        static_cast<double>(getRenderer()->getPhysicalDeviceProperties().limits.timestampPeriod) /
+        1'000.0;
+
+    Serial lastCompletedSerial = getLastCompletedQueueSerial();
+
+    while (!mInFlightGpuTimingQueries.empty())
+    {
+        GpuTimingQuery &timingQuery = mInFlightGpuTimingQueries.front();
+
+        // Stop at the timing that hasn't ended yet, or whose submission hasn't finished.  The end
+        // timestamp is always submitted after the begin timestamp.
+        if (!timingQuery.end.valid() || timingQuery.end.usedInRunningCommands(lastCompletedSerial))
+        {
+            break;
+        }
+
+        vk::QueryResult beginCycles(1);
+        vk::QueryResult endCycles(1);
+        bool beginAvailable = false;
+        bool endAvailable   = false;
+        ANGLE_TRY(timingQuery.begin.getUint64ResultNonBlocking(this, &beginCycles, &beginAvailable));
+        ANGLE_TRY(timingQuery.end.getUint64ResultNonBlocking(this, &endCycles, &endAvailable));
+        if (!beginAvailable || !endAvailable)
+        {
+            break;
+        }
+
+        mGpuTimingQueryPool.freeQuery(this, &timingQuery.begin);
+        mGpuTimingQueryPool.freeQuery(this, &timingQuery.end);
+
+        const uint64_t begin = beginCycles.getResult(vk::QueryResult::kDefaultResultIndex);
+        const uint64_t end   = endCycles.getResult(vk::QueryResult::kDefaultResultIndex);
+        const size_t microseconds =
+            end > begin ? static_cast<size_t>(static_cast<double>(end - begin) *
+                                              microsecondsPerCycle)
+                        : 0;
+
+        gl::RunningGraphWidget *widget = timingQuery.isFrame ? frameGpuTime : renderPassGpuTime;
+        widget->add(microseconds);
+        widget->next();
+
+        mInFlightGpuTimingQueries.pop_front();
+    }
+
+    return angle::Result::Continue;
 }
 
 void ContextVk::addOverlayUsedBuffersCount(vk::CommandBufferHelper *commandBuffer)
@@ -2093,6 +2497,8 @@ void ContextVk::addOverlayUsedBuffersCount(vk::CommandBufferHelper *commandBuffe
 
 angle::Result ContextVk::submitFrame(const vk::Semaphore *signalSemaphore)
 {
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::submitFrame");
+
     if (mCurrentWindowSurface)
     {
         vk::Semaphore waitSemaphore = mCurrentWindowSurface->getAcquireImageSemaphore();
@@ -2800,12 +3206,188 @@ angle::Result ContextVk::drawElementsIndirect(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+bool ContextVk::canMultiDrawIndirect(const gl::Context *context,
+                                     gl::PrimitiveMode mode,
+                                     GLsizei drawcount) const
+{
+    if (!getFeatures().supportsMultiDrawIndirect.enabled || drawcount < 2 ||
+        static_cast<uint32_t>(drawcount) >
+            mRenderer->getPhysicalDeviceProperties().limits.maxDrawIndirectCount)
+    {
+        return false;
+    }
+
+    // Line loops are drawn from converted index buffers, streamed vertex attributes are uploaded
+    // for the vertex range of each draw and transform feedback counts the vertices of each draw.
+    if (mode == gl::PrimitiveMode::LineLoop ||
+        mVertexArray->getStreamingVertexAttribsMask().any() ||
+        mState.isTransformFeedbackActiveUnpaused())
+    {
+        return false;
+    }
+
+    // gl_DrawID, gl_BaseVertex and gl_BaseInstance are emulated with uniforms that are set before
+    // each draw.
+    const gl::Program *program = mState.getLinkedProgram(context);
+    return program == nullptr ||
+           (!program->hasDrawIDUniform() && !program->hasBaseVertexUniform() &&
+            !program->hasBaseInstanceUniform());
+}
+
+bool ContextVk::canMultiDrawElementsIndirect(const gl::Context *context,
+                                             gl::PrimitiveMode mode,
+                                             gl::DrawElementsType type,
+                                             const GLvoid *const *indices,
+                                             GLsizei drawcount) const
+{
+    if (!canMultiDrawIndirect(context, mode, drawcount))
+    {
+        return false;
+    }
+
+    // Indices in client memory and uint8 indices the device doesn't support are converted for
+    // each draw.
+    if (mVertexArray->getState().getElementArrayBuffer() == nullptr ||
+        shouldConvertUint8VkIndexType(type))
+    {
+        return false;
+    }
+
+    // The offsets of the draws into the element array buffer become their first index.
+    const uintptr_t indexSize = gl::GetDrawElementsTypeSize(type);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (reinterpret_cast<uintptr_t>(indices[drawID]) % indexSize != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+angle::Result ContextVk::multiDrawArraysIndirect(const gl::Context *context,
+                                                 gl::PrimitiveMode mode,
+                                                 const GLint *firsts,
+                                                 const GLsizei *counts,
+                                                 const GLsizei *instanceCounts,
+                                                 const GLuint *baseInstances,
+                                                 GLsizei drawcount)
+{
+    uint8_t *commandData       = nullptr;
+    VkDeviceSize commandOffset = 0;
+    ANGLE_TRY(mMultiDrawIndirectBuffer.allocate(this, sizeof(VkDrawIndirectCommand) * drawcount,
+                                                &commandData, nullptr, &commandOffset, nullptr));
+
+    VkDrawIndirectCommand *commands = reinterpret_cast<VkDrawIndirectCommand *>(commandData);
+    uint32_t commandCount           = 0;
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        const GLsizei instanceCount = instanceCounts ? instanceCounts[drawID] : 1;
+        if (context->noopDrawInstanced(mode, counts[drawID], instanceCount))
+        {
+            continue;
+        }
+
+        VkDrawIndirectCommand &command = commands[commandCount++];
+        command.vertexCount            = gl::GetClampedVertexCount<uint32_t>(counts[drawID]);
+        command.instanceCount          = instanceCount;
+        command.firstVertex            = firsts[drawID];
+        command.firstInstance          = baseInstances ? baseInstances[drawID] : 0;
+    }
+
+    if (commandCount == 0)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(mMultiDrawIndirectBuffer.flush(this));
+    vk::BufferHelper *indirectBuffer = mMultiDrawIndirectBuffer.getCurrentBuffer();
+
+    ANGLE_TRY(setupIndirectDraw(context, mode, mNonIndexedDirtyBitsMask, indirectBuffer,
+                                commandOffset));
+    mRenderPassCommandBuffer->drawIndirect(indirectBuffer->getBuffer(), commandOffset,
+                                           commandCount, sizeof(VkDrawIndirectCommand));
+
+    gl::MarkShaderStorageUsage(context);
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::multiDrawElementsIndirect(const gl::Context *context,
+                                                   gl::PrimitiveMode mode,
+                                                   const GLsizei *counts,
+                                                   gl::DrawElementsType type,
+                                                   const GLvoid *const *indices,
+                                                   const GLsizei *instanceCounts,
+                                                   const GLint *baseVertices,
+                                                   const GLuint *baseInstances,
+                                                   GLsizei drawcount)
+{
+    uint8_t *commandData       = nullptr;
+    VkDeviceSize commandOffset = 0;
+    ANGLE_TRY(mMultiDrawIndirectBuffer.allocate(this,
+                                                sizeof(VkDrawIndexedIndirectCommand) * drawcount,
+                                                &commandData, nullptr, &commandOffset, nullptr));
+
+    VkDrawIndexedIndirectCommand *commands =
+        reinterpret_cast<VkDrawIndexedIndirectCommand *>(commandData);
+
+    const GLuint indexShift = gl::GetDrawElementsTypeShift(type);
+    uint32_t commandCount   = 0;
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        const GLsizei instanceCount = instanceCounts ? instanceCounts[drawID] : 1;
+        if (context->noopDrawInstanced(mode, counts[drawID], instanceCount))
+        {
+            continue;
+        }
+
+        const uintptr_t indexOffset = reinterpret_cast<uintptr_t>(indices[drawID]);
+
+        VkDrawIndexedIndirectCommand &command = commands[commandCount++];
+        command.indexCount                    = counts[drawID];
+        command.instanceCount                 = instanceCount;
+        command.firstIndex                    = static_cast<uint32_t>(indexOffset >> indexShift);
+        command.vertexOffset                  = baseVertices ? baseVertices[drawID] : 0;
+        command.firstInstance                 = baseInstances ? baseInstances[drawID] : 0;
+    }
+
+    if (commandCount == 0)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(mMultiDrawIndirectBuffer.flush(this));
+    vk::BufferHelper *indirectBuffer = mMultiDrawIndirectBuffer.getCurrentBuffer();
+
+    // The first indices are relative to the start of the element array buffer.
+    mCurrentIndexBufferOffset = 0;
+    if (mLastIndexBufferOffset != nullptr)
+    {
+        mGraphicsDirtyBits.set(DIRTY_BIT_INDEX_BUFFER);
+        mLastIndexBufferOffset = nullptr;
+    }
+
+    ANGLE_TRY(setupIndexedIndirectDraw(context, mode, type, indirectBuffer, commandOffset));
+    mRenderPassCommandBuffer->drawIndexedIndirect(indirectBuffer->getBuffer(), commandOffset,
+                                                  commandCount,
+                                                  sizeof(VkDrawIndexedIndirectCommand));
+
+    gl::MarkShaderStorageUsage(context);
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::multiDrawArrays(const gl::Context *context,
                                          gl::PrimitiveMode mode,
                                          const GLint *firsts,
                                          const GLsizei *counts,
                                          GLsizei drawcount)
 {
+    if (canMultiDrawIndirect(context, mode, drawcount))
+    {
+        return multiDrawArraysIndirect(context, mode, firsts, counts, nullptr, nullptr, drawcount);
+    }
+
     return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
 }
 
@@ -2816,6 +3398,12 @@ angle::Result ContextVk::multiDrawArraysInstanced(const gl::Context *context,
                                                   const GLsizei *instanceCounts,
                                                   GLsizei drawcount)
 {
+    if (canMultiDrawIndirect(context, mode, drawcount))
+    {
+        return multiDrawArraysIndirect(context, mode, firsts, counts, instanceCounts, nullptr,
+                                       drawcount);
+    }
+
     return rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts, instanceCounts,
                                                drawcount);
 }
@@ -2827,6 +3415,12 @@ angle::Result ContextVk::multiDrawElements(const gl::Context *context,
                                            const GLvoid *const *indices,
                                            GLsizei drawcount)
 {
+    if (canMultiDrawElementsIndirect(context, mode, type, indices, drawcount))
+    {
+        return multiDrawElementsIndirect(context, mode, counts, type, indices, nullptr, nullptr,
+                                         nullptr, drawcount);
+    }
+
     return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
 }
 
@@ -2838,6 +3432,12 @@ angle::Result ContextVk::multiDrawElementsInstanced(const gl::Context *context,
                                                     const GLsizei *instanceCounts,
                                                     GLsizei drawcount)
 {
+    if (canMultiDrawElementsIndirect(context, mode, type, indices, drawcount))
+    {
+        return multiDrawElementsIndirect(context, mode, counts, type, indices, instanceCounts,
+                                         nullptr, nullptr, drawcount);
+    }
+
     return rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
                                                  instanceCounts, drawcount);
 }
@@ -2850,6 +3450,12 @@ angle::Result ContextVk::multiDrawArraysInstancedBaseInstance(const gl::Context
                                                               const GLuint *baseInstances,
                                                               GLsizei drawcount)
 {
+    if (canMultiDrawIndirect(context, mode, drawcount))
+    {
+        return multiDrawArraysIndirect(context, mode, firsts, counts, instanceCounts,
+                                       baseInstances, drawcount);
+    }
+
     return rx::MultiDrawArraysInstancedBaseInstanceGeneral(
         this, context, mode, firsts, counts, instanceCounts, baseInstances, drawcount);
 }
@@ -2865,11 +3471,35 @@ angle::Result ContextVk::multiDrawElementsInstancedBaseVertexBaseInstance(
     const GLuint *baseInstances,
     GLsizei drawcount)
 {
+    if (canMultiDrawElementsIndirect(context, mode, type, indices, drawcount))
+    {
+        return multiDrawElementsIndirect(context, mode, counts, type, indices, instanceCounts,
+                                         baseVertices, baseInstances, drawcount);
+    }
+
     return rx::MultiDrawElementsInstancedBaseVertexBaseInstanceGeneral(
         this, context, mode, counts, type, indices, instanceCounts, baseVertices, baseInstances,
         drawcount);
 }
 
+angle::Result ContextVk::prewarmDrawState(const gl::Context *context, gl::PrimitiveMode mode)
+{
+    ASSERT(mExecutable);
+
+    // The state has been synced by the front-end like for a draw call, so the desc is what the
+    // draw call would use.  The current pipeline only needs to be dropped if the topology changes.
+    if (mode != mCurrentDrawMode)
+    {
+        invalidateCurrentGraphicsPipeline();
+        mCurrentDrawMode = mode;
+        mGraphicsPipelineDesc->updateTopology(&mGraphicsPipelineTransition, mCurrentDrawMode);
+    }
+
+    updateGraphicsPipelineDescWithSpecConstUsageBits(getCurrentProgramSpecConstUsageBits());
+
+    return mExecutable->prewarmGraphicsPipeline(this, mCurrentDrawMode, *mGraphicsPipelineDesc);
+}
+
 void ContextVk::optimizeRenderPassForPresent(VkFramebuffer framebufferHandle)
 {
     if (!mRenderPassCommands->started())
@@ -3152,6 +3782,18 @@ void ContextVk::updateDepthRange(float nearPlane, float farPlane)
     mGraphicsPipelineDesc->updateDepthRange(&mGraphicsPipelineTransition, nearPlane, farPlane);
 }
 
+void ContextVk::updateFrontFace(const gl::State &glState)
+{
+    if (getFeatures().supportsExtendedDynamicState.enabled)
+    {
+        mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+        return;
+    }
+
+    mGraphicsPipelineDesc->updateFrontFace(&mGraphicsPipelineTransition,
+                                           glState.getRasterizerState(), isYFlipEnabledForDrawFBO());
+}
+
 void ContextVk::updateScissor(const gl::State &glState)
 {
     FramebufferVk *framebufferVk = vk::GetImpl(glState.getDrawFramebuffer());
@@ -3282,6 +3924,7 @@ angle::Result ContextVk::syncState(const gl::Context *context,
 {
     const gl::State &glState                       = context->getState();
     const gl::ProgramExecutable *programExecutable = glState.getProgramExecutable();
+    const bool useExtendedDynamicState = getFeatures().supportsExtendedDynamicState.enabled;
 
     if ((dirtyBits & mPipelineDirtyBitsMask).any() &&
         (programExecutable == nullptr || !programExecutable->isCompute()))
@@ -3351,49 +3994,101 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                 break;
             case gl::State::DIRTY_BIT_DEPTH_TEST_ENABLED:
             {
-                mGraphicsPipelineDesc->updateDepthTestEnabled(&mGraphicsPipelineTransition,
-                                                              glState.getDepthStencilState(),
-                                                              glState.getDrawFramebuffer());
+                if (useExtendedDynamicState)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+                }
+                else
+                {
+                    mGraphicsPipelineDesc->updateDepthTestEnabled(&mGraphicsPipelineTransition,
+                                                                  glState.getDepthStencilState(),
+                                                                  glState.getDrawFramebuffer());
+                }
                 ANGLE_TRY(updateRenderPassDepthStencilAccess());
                 break;
             }
             case gl::State::DIRTY_BIT_DEPTH_FUNC:
-                mGraphicsPipelineDesc->updateDepthFunc(&mGraphicsPipelineTransition,
-                                                       glState.getDepthStencilState());
+                if (useExtendedDynamicState)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+                }
+                else
+                {
+                    mGraphicsPipelineDesc->updateDepthFunc(&mGraphicsPipelineTransition,
+                                                           glState.getDepthStencilState());
+                }
                 break;
             case gl::State::DIRTY_BIT_DEPTH_MASK:
             {
-                mGraphicsPipelineDesc->updateDepthWriteEnabled(&mGraphicsPipelineTransition,
-                                                               glState.getDepthStencilState(),
-                                                               glState.getDrawFramebuffer());
+                if (useExtendedDynamicState)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+                }
+                else
+                {
+                    mGraphicsPipelineDesc->updateDepthWriteEnabled(&mGraphicsPipelineTransition,
+                                                                   glState.getDepthStencilState(),
+                                                                   glState.getDrawFramebuffer());
+                }
                 ANGLE_TRY(updateRenderPassDepthStencilAccess());
                 break;
             }
             case gl::State::DIRTY_BIT_STENCIL_TEST_ENABLED:
             {
-                mGraphicsPipelineDesc->updateStencilTestEnabled(&mGraphicsPipelineTransition,
-                                                                glState.getDepthStencilState(),
-                                                                glState.getDrawFramebuffer());
+                if (useExtendedDynamicState)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+                }
+                else
+                {
+                    mGraphicsPipelineDesc->updateStencilTestEnabled(
+                        &mGraphicsPipelineTransition, glState.getDepthStencilState(),
+                        glState.getDrawFramebuffer());
+                }
                 ANGLE_TRY(updateRenderPassDepthStencilAccess());
                 break;
             }
             case gl::State::DIRTY_BIT_STENCIL_FUNCS_FRONT:
+                // The stencil compare op is dynamic with VK_EXT_extended_dynamic_state, but the
+                // reference and compare mask are still part of the pipeline.
                 mGraphicsPipelineDesc->updateStencilFrontFuncs(&mGraphicsPipelineTransition,
                                                                glState.getStencilRef(),
                                                                glState.getDepthStencilState());
+                if (useExtendedDynamicState)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+                }
                 break;
             case gl::State::DIRTY_BIT_STENCIL_FUNCS_BACK:
                 mGraphicsPipelineDesc->updateStencilBackFuncs(&mGraphicsPipelineTransition,
                                                               glState.getStencilBackRef(),
                                                               glState.getDepthStencilState());
+                if (useExtendedDynamicState)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+                }
                 break;
             case gl::State::DIRTY_BIT_STENCIL_OPS_FRONT:
-                mGraphicsPipelineDesc->updateStencilFrontOps(&mGraphicsPipelineTransition,
-                                                             glState.getDepthStencilState());
+                if (useExtendedDynamicState)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+                }
+                else
+                {
+                    mGraphicsPipelineDesc->updateStencilFrontOps(&mGraphicsPipelineTransition,
+                                                                 glState.getDepthStencilState());
+                }
                 break;
             case gl::State::DIRTY_BIT_STENCIL_OPS_BACK:
-                mGraphicsPipelineDesc->updateStencilBackOps(&mGraphicsPipelineTransition,
-                                                            glState.getDepthStencilState());
+                if (useExtendedDynamicState)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+                }
+                else
+                {
+                    mGraphicsPipelineDesc->updateStencilBackOps(&mGraphicsPipelineTransition,
+                                                                glState.getDepthStencilState());
+                }
                 break;
             case gl::State::DIRTY_BIT_STENCIL_WRITEMASK_FRONT:
                 mGraphicsPipelineDesc->updateStencilFrontWriteMask(&mGraphicsPipelineTransition,
@@ -3407,13 +4102,18 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                 break;
             case gl::State::DIRTY_BIT_CULL_FACE_ENABLED:
             case gl::State::DIRTY_BIT_CULL_FACE:
-                mGraphicsPipelineDesc->updateCullMode(&mGraphicsPipelineTransition,
-                                                      glState.getRasterizerState());
+                if (useExtendedDynamicState)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+                }
+                else
+                {
+                    mGraphicsPipelineDesc->updateCullMode(&mGraphicsPipelineTransition,
+                                                          glState.getRasterizerState());
+                }
                 break;
             case gl::State::DIRTY_BIT_FRONT_FACE:
-                mGraphicsPipelineDesc->updateFrontFace(&mGraphicsPipelineTransition,
-                                                       glState.getRasterizerState(),
-                                                       isYFlipEnabledForDrawFBO());
+                updateFrontFace(glState);
                 break;
             case gl::State::DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED:
                 mGraphicsPipelineDesc->updatePolygonOffsetFillEnabled(
@@ -3495,17 +4195,18 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                 updateColorMasks(glState.getBlendStateExt());
                 updateRasterizationSamples(mDrawFramebuffer->getSamples());
 
-                mGraphicsPipelineDesc->updateFrontFace(&mGraphicsPipelineTransition,
-                                                       glState.getRasterizerState(),
-                                                       isYFlipEnabledForDrawFBO());
+                updateFrontFace(glState);
                 updateScissor(glState);
                 const gl::DepthStencilState depthStencilState = glState.getDepthStencilState();
-                mGraphicsPipelineDesc->updateDepthTestEnabled(&mGraphicsPipelineTransition,
-                                                              depthStencilState, drawFramebuffer);
-                mGraphicsPipelineDesc->updateDepthWriteEnabled(&mGraphicsPipelineTransition,
-                                                               depthStencilState, drawFramebuffer);
-                mGraphicsPipelineDesc->updateStencilTestEnabled(&mGraphicsPipelineTransition,
-                                                                depthStencilState, drawFramebuffer);
+                if (!useExtendedDynamicState)
+                {
+                    mGraphicsPipelineDesc->updateDepthTestEnabled(
+                        &mGraphicsPipelineTransition, depthStencilState, drawFramebuffer);
+                    mGraphicsPipelineDesc->updateDepthWriteEnabled(
+                        &mGraphicsPipelineTransition, depthStencilState, drawFramebuffer);
+                    mGraphicsPipelineDesc->updateStencilTestEnabled(
+                        &mGraphicsPipelineTransition, depthStencilState, drawFramebuffer);
+                }
                 mGraphicsPipelineDesc->updateStencilFrontWriteMask(
                     &mGraphicsPipelineTransition, depthStencilState, drawFramebuffer);
                 mGraphicsPipelineDesc->updateStencilBackWriteMask(
@@ -3621,9 +4322,7 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                                            glState.getViewport(), glState.getNearPlane(),
                                            glState.getFarPlane());
                             // Since we are flipping the y coordinate, update front face state
-                            mGraphicsPipelineDesc->updateFrontFace(&mGraphicsPipelineTransition,
-                                                                   glState.getRasterizerState(),
-                                                                   isYFlipEnabledForDrawFBO());
+                            updateFrontFace(glState);
                             updateScissor(glState);
 
                             // Nothing is needed for depth correction for EXT_clip_control.
@@ -3658,6 +4357,16 @@ angle::Result ContextVk::syncState(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+GLint64 ContextVk::getMemoryBudget() const
+{
+    return static_cast<GLint64>(mRenderer->getMemoryBudget());
+}
+
+GLint64 ContextVk::getMemoryUsage() const
+{
+    return static_cast<GLint64>(mRenderer->getMemoryUsage());
+}
+
 GLint ContextVk::getGPUDisjoint()
 {
     // No extension seems to be available to query this information.
@@ -4017,7 +4726,7 @@ angle::Result ContextVk::invalidateCurrentShaderResources()
         mComputeDirtyBits.set(DIRTY_BIT_MEMORY_BARRIER);
     }
 
-    if (hasUniformBuffers || hasStorageBuffers)
+    if (hasUniformBuffers || hasStorageBuffers || hasImages)
     {
         mShaderBuffersDescriptorDesc.reset();
 
@@ -4034,20 +4743,24 @@ angle::Result ContextVk::invalidateCurrentShaderResources()
             executableVk                  = &pipelineVk->getExecutable();
         }
 
+        // Uniform buffer descriptors cover the size of the block rather than the bound range, and
+        // with dynamic descriptors, the offset is given when the descriptor set is bound.  Neither
+        // is part of the key then, so that engines that suballocate one large uniform buffer and
+        // rebind ranges of it per draw don't update any descriptor sets.
         const gl::BufferVector &uniformBuffers = mState.getOffsetBindingPointerUniformBuffers();
         AppendBufferVectorToDesc(&mShaderBuffersDescriptorDesc, uniformBuffers,
-                                 mState.getUniformBuffersMask(),
+                                 mState.getUniformBuffersMask(), false,
                                  !executableVk->usesDynamicUniformBufferDescriptors());
 
         const gl::BufferVector &shaderStorageBuffers =
             mState.getOffsetBindingPointerShaderStorageBuffers();
         AppendBufferVectorToDesc(&mShaderBuffersDescriptorDesc, shaderStorageBuffers,
-                                 mState.getShaderStorageBuffersMask(), true);
+                                 mState.getShaderStorageBuffersMask(), true, true);
 
         const gl::BufferVector &atomicCounterBuffers =
             mState.getOffsetBindingPointerAtomicCounterBuffers();
         AppendBufferVectorToDesc(&mShaderBuffersDescriptorDesc, atomicCounterBuffers,
-                                 mState.getAtomicCounterBuffersMask(), true);
+                                 mState.getAtomicCounterBuffersMask(), true, true);
     }
 
     return angle::Result::Continue;
@@ -4236,6 +4949,12 @@ angle::Result ContextVk::onPauseTransformFeedback()
 void ContextVk::invalidateGraphicsPipelineBinding()
 {
     mGraphicsDirtyBits.set(DIRTY_BIT_PIPELINE_BINDING);
+
+    // UtilsVk overrides the dynamic state along with the pipeline binding.
+    if (getFeatures().supportsExtendedDynamicState.enabled)
+    {
+        mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_STATE);
+    }
 }
 
 void ContextVk::invalidateComputePipelineBinding()
@@ -4243,11 +4962,24 @@ void ContextVk::invalidateComputePipelineBinding()
     mComputeDirtyBits.set(DIRTY_BIT_PIPELINE_BINDING);
 }
 
+bool ContextVk::hasDriverUniformsToBind(const DriverUniformsDescriptorSet &driverUniforms) const
+{
+    if (getFeatures().usePushConstantsForDriverUniforms.enabled)
+    {
+        return driverUniforms.range != 0;
+    }
+    if (getFeatures().supportsPushDescriptor.enabled)
+    {
+        return driverUniforms.dynamicBuffer.getCurrentBuffer() != nullptr;
+    }
+    return driverUniforms.descriptorSet != VK_NULL_HANDLE;
+}
+
 void ContextVk::invalidateGraphicsDescriptorSet(DescriptorSetIndex usedDescriptorSet)
 {
     // UtilsVk currently only uses set 0
     ASSERT(usedDescriptorSet == DescriptorSetIndex::Internal);
-    if (mDriverUniforms[PipelineType::Graphics].descriptorSet != VK_NULL_HANDLE)
+    if (hasDriverUniformsToBind(mDriverUniforms[PipelineType::Graphics]))
     {
         mGraphicsDirtyBits.set(DIRTY_BIT_DRIVER_UNIFORMS_BINDING);
     }
@@ -4257,7 +4989,7 @@ void ContextVk::invalidateComputeDescriptorSet(DescriptorSetIndex usedDescriptor
 {
     // UtilsVk currently only uses set 0
     ASSERT(usedDescriptorSet == DescriptorSetIndex::Internal);
-    if (mDriverUniforms[PipelineType::Compute].descriptorSet != VK_NULL_HANDLE)
+    if (hasDriverUniformsToBind(mDriverUniforms[PipelineType::Compute]))
     {
         mComputeDirtyBits.set(DIRTY_BIT_DRIVER_UNIFORMS_BINDING);
     }
@@ -4651,6 +5383,40 @@ void ContextVk::handleDirtyDriverUniformsBindingImpl(vk::CommandBuffer *commandB
                                                      VkPipelineBindPoint bindPoint,
                                                      DriverUniformsDescriptorSet *driverUniforms)
 {
+    if (getFeatures().usePushConstantsForDriverUniforms.enabled)
+    {
+        PipelineType pipelineType = bindPoint == VK_PIPELINE_BIND_POINT_COMPUTE
+                                        ? PipelineType::Compute
+                                        : PipelineType::Graphics;
+        commandBuffer->pushConstants(mExecutable->getPipelineLayout(),
+                                     kDriverUniformsShaderStages[pipelineType], 0,
+                                     driverUniforms->range,
+                                     driverUniforms->pushConstantsData.data());
+        return;
+    }
+
+    if (getFeatures().supportsPushDescriptor.enabled)
+    {
+        const vk::BufferHelper *buffer = driverUniforms->dynamicBuffer.getCurrentBuffer();
+
+        VkDescriptorBufferInfo bufferInfo = {};
+        bufferInfo.buffer                 = buffer->getBuffer().getHandle();
+        bufferInfo.offset                 = driverUniforms->dynamicOffset;
+        bufferInfo.range                  = driverUniforms->range;
+
+        VkWriteDescriptorSet writeInfo = {};
+        writeInfo.sType                = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writeInfo.dstBinding           = 0;
+        writeInfo.dstArrayElement      = 0;
+        writeInfo.descriptorCount      = 1;
+        writeInfo.descriptorType       = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writeInfo.pBufferInfo          = &bufferInfo;
+
+        commandBuffer->pushDescriptorSet(mExecutable->getPipelineLayout(), bindPoint,
+                                         DescriptorSetIndex::Internal, 1, &writeInfo);
+        return;
+    }
+
     // The descriptor pool that this descriptor set was allocated from needs to be retained when the
     // descriptor set is used in a new command. Since the descriptor pools are specific to each
     // ContextVk, we only need to retain them once to ensure the reference count and Serial are
@@ -4689,6 +5455,14 @@ angle::Result ContextVk::allocateDriverUniforms(size_t driverUniformsSize,
                                                 uint8_t **ptrOut,
                                                 bool *newBufferOut)
 {
+    if (getFeatures().usePushConstantsForDriverUniforms.enabled)
+    {
+        ASSERT(driverUniformsSize <= sizeof(driverUniforms->pushConstantsData));
+        *ptrOut       = reinterpret_cast<uint8_t *>(driverUniforms->pushConstantsData.data());
+        *newBufferOut = false;
+        return angle::Result::Continue;
+    }
+
     // Allocate a new region in the dynamic buffer. The allocate call may put buffer into dynamic
     // buffer's mInflightBuffers. During command submission time, these inflight buffers are added
     // into context's mResourceUseList which will ensure they get tagged with queue serial number
@@ -4707,9 +5481,18 @@ angle::Result ContextVk::updateDriverUniformsDescriptorSet(
     size_t driverUniformsSize,
     DriverUniformsDescriptorSet *driverUniforms)
 {
+    // Push constants are written into the command buffer when they are bound.
+    if (getFeatures().usePushConstantsForDriverUniforms.enabled)
+    {
+        driverUniforms->range = static_cast<uint32_t>(driverUniformsSize);
+        return angle::Result::Continue;
+    }
+
     ANGLE_TRY(driverUniforms->dynamicBuffer.flush(this));
 
-    if (!newBuffer)
+    // Pushed descriptors are written when they are bound, there is no set to update.
+    driverUniforms->range = static_cast<uint32_t>(driverUniformsSize);
+    if (!newBuffer || getFeatures().supportsPushDescriptor.enabled)
     {
         return angle::Result::Continue;
     }
@@ -4765,6 +5548,11 @@ angle::Result ContextVk::updateDriverUniformsDescriptorSet(
     return angle::Result::Continue;
 }
 
+void ContextVk::onGraphicsPipelineCreationPosted(std::shared_ptr<angle::WaitableEvent> event)
+{
+    mPendingGraphicsPipelineCreations.push_back(std::move(event));
+}
+
 void ContextVk::handleError(VkResult errorCode,
                             const char *file,
                             const char *function,
@@ -4966,6 +5754,9 @@ angle::Result ContextVk::updateActiveImages(vk::CommandBufferHelper *commandBuff
             continue;
         }
 
+        // The cached descriptor set that holds the view may be used in later submissions.
+        textureVk->retainImageViews(&mResourceUseList);
+
         vk::ImageHelper *image = &textureVk->getImage();
 
         if (alreadyProcessed.find(image) != alreadyProcessed.end())
@@ -5029,6 +5820,23 @@ angle::Result ContextVk::flushImpl(const vk::Semaphore *signalSemaphore)
 
     ANGLE_TRY(flushCommandsAndEndRenderPass());
 
+    if (mEndGpuFrameTimingOnFlush)
+    {
+        ASSERT(mCurrentGpuFrameTiming);
+        ANGLE_TRY(writeGpuTimingQuery(&mCurrentGpuFrameTiming->end));
+        mCurrentGpuFrameTiming    = nullptr;
+        mEndGpuFrameTimingOnFlush = false;
+    }
+
+    // Forget about the pipeline creation tasks that have already finished.
+    mPendingGraphicsPipelineCreations.erase(
+        std::remove_if(mPendingGraphicsPipelineCreations.begin(),
+                       mPendingGraphicsPipelineCreations.end(),
+                       [](const std::shared_ptr<angle::WaitableEvent> &event) {
+                           return event->isReady();
+                       }),
+        mPendingGraphicsPipelineCreations.end());
+
     if (mIsAnyHostVisibleBufferWritten)
     {
         // Make sure all writes to host-visible buffers are flushed.  We have no way of knowing
@@ -5061,12 +5869,27 @@ angle::Result ContextVk::flushImpl(const vk::Semaphore *signalSemaphore)
         driverUniform.dynamicBuffer.releaseInFlightBuffersToResourceUseList(this);
     }
     mDefaultUniformStorage.releaseInFlightBuffersToResourceUseList(this);
+    mMultiDrawIndirectBuffer.releaseInFlightBuffersToResourceUseList(this);
     mStagingBuffer.releaseInFlightBuffersToResourceUseList(this);
 
     ANGLE_TRY(submitFrame(signalSemaphore));
 
+    mRenderer->updateMemoryBudget();
+    if (mRenderer->isNearMemoryBudget())
+    {
+        trimMemory();
+    }
+    else
+    {
+        mRenderer->getSharedBufferPool().releaseStaleBuffers(
+            mRenderer, mRenderer->getLastCompletedQueueSerial());
+        mRenderer->getSurfaceImagePool().releaseStaleImages(
+            mRenderer, mRenderer->getLastCompletedQueueSerial());
+    }
+
     mPerfCounters.renderPasses                           = 0;
     mPerfCounters.writeDescriptorSets                    = 0;
+    mPerfCounters.dispatchWriteDescriptorSets            = 0;
     mPerfCounters.flushedOutsideRenderPassCommandBuffers = 0;
     mPerfCounters.resolveImageCommands                   = 0;
 
@@ -5085,6 +5908,25 @@ angle::Result ContextVk::flushImpl(const vk::Semaphore *signalSemaphore)
     return angle::Result::Continue;
 }
 
+void ContextVk::trimMemory()
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::trimMemory");
+
+    for (DriverUniformsDescriptorSet &driverUniform : mDriverUniforms)
+    {
+        driverUniform.dynamicBuffer.releaseFreeBuffers(mRenderer);
+    }
+    for (vk::DynamicBuffer &defaultBuffer : mDefaultAttribBuffers)
+    {
+        defaultBuffer.releaseFreeBuffers(mRenderer);
+    }
+    mDefaultUniformStorage.releaseFreeBuffers(mRenderer);
+    mMultiDrawIndirectBuffer.releaseFreeBuffers(mRenderer);
+    mStagingBuffer.releaseFreeBuffers(mRenderer);
+
+    mRenderer->trimMemory();
+}
+
 angle::Result ContextVk::finishImpl()
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::finishImpl");
@@ -5119,6 +5961,37 @@ void ContextVk::addWaitSemaphore(VkSemaphore semaphore, VkPipelineStageFlags sta
     mWaitSemaphoreStageMasks.push_back(stageMask);
 }
 
+angle::Result ContextVk::bindSparseMemory(VkBindSparseInfo *bindSparseInfo)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::bindSparseMemory");
+
+    // The bind is ordered with the submissions through semaphores, so the CPU doesn't wait for
+    // the GPU.
+    vk::Semaphore flushSemaphore;
+    vk::Semaphore bindSemaphore;
+    ANGLE_VK_TRY(this, flushSemaphore.init(getDevice()));
+    ANGLE_VK_TRY(this, bindSemaphore.init(getDevice()));
+
+    ANGLE_TRY(flushImpl(&flushSemaphore));
+
+    const VkSemaphore waitSemaphore   = flushSemaphore.getHandle();
+    const VkSemaphore signalSemaphore = bindSemaphore.getHandle();
+
+    bindSparseInfo->waitSemaphoreCount   = 1;
+    bindSparseInfo->pWaitSemaphores      = &waitSemaphore;
+    bindSparseInfo->signalSemaphoreCount = 1;
+    bindSparseInfo->pSignalSemaphores    = &signalSemaphore;
+    ANGLE_TRY(mRenderer->queueBindSparse(this, mContextPriority, *bindSparseInfo));
+
+    addWaitSemaphore(signalSemaphore, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+    // Both semaphores are done with once the next submission, which waits on the bind, finishes.
+    addGarbage(&flushSemaphore);
+    addGarbage(&bindSemaphore);
+
+    return angle::Result::Continue;
+}
+
 const vk::CommandPool &ContextVk::getCommandPool() const
 {
     return mCommandPool;
@@ -5282,10 +6155,56 @@ vk::DescriptorSetLayoutDesc ContextVk::getDriverUniformsDescriptorSetDesc(
     VkShaderStageFlags shaderStages) const
 {
     vk::DescriptorSetLayoutDesc desc;
-    desc.update(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1, shaderStages, nullptr);
+    if (getFeatures().usePushConstantsForDriverUniforms.enabled)
+    {
+        // The driver uniforms are push constants, the set is left empty.
+    }
+    else if (getFeatures().supportsPushDescriptor.enabled)
+    {
+        // Dynamic descriptors can't be pushed, the offset is written in the descriptor instead.
+        desc.update(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, shaderStages, nullptr);
+        desc.setCreateFlags(VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR);
+    }
+    else
+    {
+        desc.update(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1, shaderStages, nullptr);
+    }
     return desc;
 }
 
+void ContextVk::addDriverUniformsPushConstantRanges(
+    PipelineType pipelineType,
+    vk::PipelineLayoutDesc *pipelineLayoutDesc) const
+{
+    if (!getFeatures().usePushConstantsForDriverUniforms.enabled)
+    {
+        return;
+    }
+
+    static_assert(sizeof(GraphicsDriverUniformsExtended) <= kMaxDriverUniformsSize,
+                  "Driver uniforms don't fit in push constants");
+
+    if (pipelineType == PipelineType::Compute)
+    {
+        pipelineLayoutDesc->updatePushConstantRange(
+            gl::ShaderType::Compute, 0, static_cast<uint32_t>(sizeof(ComputeDriverUniforms)));
+        return;
+    }
+
+    // Every graphics stage gets the same range whether or not the program has it, so that the
+    // pipeline layouts of all programs are compatible for push constants, which are otherwise
+    // disturbed by switching between programs.
+    uint32_t driverUniformsSize = sizeof(GraphicsDriverUniforms);
+    if (getFeatures().forceDriverUniformOverSpecConst.enabled)
+    {
+        driverUniformsSize = sizeof(GraphicsDriverUniformsExtended);
+    }
+    for (gl::ShaderType shaderType : gl::kAllGraphicsShaderTypes)
+    {
+        pipelineLayoutDesc->updatePushConstantRange(shaderType, 0, driverUniformsSize);
+    }
+}
+
 bool ContextVk::shouldEmulateSeamfulCubeMapSampling() const
 {
     // Only allow seamful cube map sampling in non-webgl ES2.
@@ -5345,9 +6264,26 @@ angle::Result ContextVk::startRenderPass(gl::Rectangle renderArea,
                                          vk::CommandBuffer **commandBufferOut,
                                          bool *renderPassDescChangedOut)
 {
-    ANGLE_TRY(mDrawFramebuffer->startNewRenderPass(this, renderArea, &mRenderPassCommandBuffer,
-                                                   renderPassDescChangedOut));
+    bool resumed = false;
+    ANGLE_TRY(resumeSuspendedRenderPass(renderArea, &resumed));
 
+    if (!resumed)
+    {
+        ANGLE_TRY(mDrawFramebuffer->startNewRenderPass(this, renderArea, &mRenderPassCommandBuffer,
+                                                       renderPassDescChangedOut));
+        ANGLE_TRY(onRenderPassStarted());
+    }
+
+    if (commandBufferOut)
+    {
+        *commandBufferOut = mRenderPassCommandBuffer;
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::onRenderPassStarted()
+{
     // Make sure the render pass is not restarted if it is started by UtilsVk (as opposed to
     // setupDraw(), which clears this bit automatically).
     mGraphicsDirtyBits.reset(DIRTY_BIT_RENDER_PASS);
@@ -5362,9 +6298,24 @@ angle::Result ContextVk::startRenderPass(gl::Rectangle renderArea,
 
     mDrawFramebuffer->updateRenderPassReadOnlyDepthMode(this, mRenderPassCommands);
 
-    if (commandBufferOut)
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::resumeSuspendedRenderPass(const gl::Rectangle &renderArea,
+                                                   bool *resumedOut)
+{
+    *resumedOut = false;
+
+    if (!getFeatures().resumeRenderPassOnFramebufferRebind.enabled || !hasSuspendedRenderPass())
     {
-        *commandBufferOut = mRenderPassCommandBuffer;
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(mDrawFramebuffer->resumeRenderPass(this, renderArea, resumedOut));
+    if (*resumedOut)
+    {
+        ASSERT(hasStartedRenderPass());
+        ANGLE_TRY(onRenderPassStarted());
     }
 
     return angle::Result::Continue;
@@ -5418,6 +6369,8 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassImpl()
         return angle::Result::Continue;
     }
 
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::flushCommandsAndEndRenderPassImpl");
+
     mCurrentTransformFeedbackBuffers.clear();
 
     // Reset serials for XFB if active.
@@ -5443,6 +6396,19 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassImpl()
         ANGLE_TRY(flushOutsideRenderPassCommands());
     }
 
+    // Time the render pass for the overlay.  The first render pass of the frame also starts the
+    // frame's timing.
+    GpuTimingQuery *renderPassTiming = nullptr;
+    if (mGpuTimingEnabled)
+    {
+        if (mCurrentGpuFrameTiming == nullptr)
+        {
+            ANGLE_TRY(beginGpuTiming(true, &mCurrentGpuFrameTiming));
+        }
+        ANGLE_TRY(beginGpuTiming(false, &renderPassTiming));
+        ANGLE_TRY(flushOutsideRenderPassCommands());
+    }
+
     addOverlayUsedBuffersCount(mRenderPassCommands);
 
     pauseTransformFeedbackIfActiveUnpaused();
@@ -5460,6 +6426,12 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassImpl()
 
     ANGLE_TRY(mRenderer->flushRenderPassCommands(this, *renderPass, &mRenderPassCommands));
 
+    if (renderPassTiming != nullptr)
+    {
+        ANGLE_TRY(writeGpuTimingQuery(&renderPassTiming->end));
+        ANGLE_TRY(flushOutsideRenderPassCommands());
+    }
+
     if (mGpuEventsEnabled)
     {
         EventName eventName = GetTraceEventName("RP", mPerfCounters.renderPasses);
@@ -5592,6 +6564,8 @@ angle::Result ContextVk::flushOutsideRenderPassCommands()
         return angle::Result::Continue;
     }
 
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::flushOutsideRenderPassCommands");
+
     addOverlayUsedBuffersCount(mOutsideRenderPassCommands);
 
     if (vk::CommandBufferHelper::kEnableCommandStreamDiagnostics)
@@ -5842,12 +6816,19 @@ angle::Result ContextVk::onResourceAccess(const vk::CommandBufferAccess &access)
 {
     ANGLE_TRY(flushCommandBuffersIfNecessary(access));
 
+    // The layout transitions of all the images are recorded with a single vkCmdPipelineBarrier.
+    vk::CommandBuffer *commandBuffer = &mOutsideRenderPassCommands->getCommandBuffer();
+    vk::PipelineBarrier imageBarrier;
+
     for (const vk::CommandBufferImageAccess &imageAccess : access.getReadImages())
     {
         ASSERT(!IsRenderPassStartedAndUsesImage(*mRenderPassCommands, *imageAccess.image));
 
-        imageAccess.image->recordReadBarrier(this, imageAccess.aspectFlags, imageAccess.imageLayout,
-                                             &mOutsideRenderPassCommands->getCommandBuffer());
+        if (imageAccess.image->isReadBarrierNecessary(imageAccess.imageLayout))
+        {
+            imageAccess.image->updateLayoutAndBarrier(this, imageAccess.aspectFlags,
+                                                      imageAccess.imageLayout, &imageBarrier);
+        }
         imageAccess.image->retain(&mResourceUseList);
     }
 
@@ -5855,15 +6836,28 @@ angle::Result ContextVk::onResourceAccess(const vk::CommandBufferAccess &access)
     {
         ASSERT(!IsRenderPassStartedAndUsesImage(*mRenderPassCommands, *imageWrite.access.image));
 
-        imageWrite.access.image->recordWriteBarrier(
-            this, imageWrite.access.aspectFlags, imageWrite.access.imageLayout,
-            &mOutsideRenderPassCommands->getCommandBuffer());
+        // The barriers of one call are not ordered against each other, so an image that is also
+        // read needs its previous transition to be recorded first.
+        for (const vk::CommandBufferImageAccess &imageAccess : access.getReadImages())
+        {
+            if (imageAccess.image == imageWrite.access.image)
+            {
+                imageBarrier.execute(commandBuffer);
+                break;
+            }
+        }
+
+        imageWrite.access.image->updateLayoutAndBarrier(this, imageWrite.access.aspectFlags,
+                                                        imageWrite.access.imageLayout,
+                                                        &imageBarrier);
         imageWrite.access.image->retain(&mResourceUseList);
         imageWrite.access.image->onWrite(imageWrite.levelStart, imageWrite.levelCount,
                                          imageWrite.layerStart, imageWrite.layerCount,
                                          imageWrite.access.aspectFlags);
     }
 
+    imageBarrier.execute(commandBuffer);
+
     for (const vk::CommandBufferBufferAccess &bufferAccess : access.getReadBuffers())
     {
         ASSERT(!mRenderPassCommands->usesBufferForWrite(*bufferAccess.buffer));
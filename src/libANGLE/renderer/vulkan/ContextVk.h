@@ -11,6 +11,7 @@
 #define LIBANGLE_RENDERER_VULKAN_CONTEXTVK_H_
 
 #include <condition_variable>
+#include <deque>
 
 #include "common/PackedEnums.h"
 #include "common/vulkan/vk_headers.h"
@@ -37,6 +38,9 @@ class ShareGroupVk;
 static constexpr uint32_t kMaxGpuEventNameLen = 32;
 using EventName                               = std::array<char, kMaxGpuEventNameLen>;
 
+// The size of the largest driver uniforms, which every device supports as push constants.
+static constexpr uint32_t kMaxDriverUniformsSize = 128;
+
 enum class PipelineType
 {
     Graphics = 0,
@@ -180,6 +184,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                                                    const GLuint *baseInstances,
                                                                    GLsizei drawcount) override;
 
+    // GL_ANGLE_prewarm_draw_state
+    angle::Result prewarmDrawState(const gl::Context *context, gl::PrimitiveMode mode) override;
+
     // ShareGroup
     ShareGroupVk *getShareGroupVk() { return mShareGroupVk; }
     PipelineLayoutCache &getPipelineLayoutCache()
@@ -389,6 +396,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     void addWaitSemaphore(VkSemaphore semaphore, VkPipelineStageFlags stageMask);
 
+    // Binds sparse memory after the commands recorded so far, and before the ones recorded next.
+    // The semaphores of |bindSparseInfo| are filled in.
+    angle::Result bindSparseMemory(VkBindSparseInfo *bindSparseInfo);
+
     const vk::CommandPool &getCommandPool() const;
 
     Serial getCurrentQueueSerial() const { return mRenderer->getCurrentQueueSerial(); }
@@ -418,7 +429,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                        const vk::AttachmentOpsArray &ops,
                                        vk::RenderPass **renderPassOut);
 
-    vk::ShaderLibrary &getShaderLibrary() { return mShaderLibrary; }
+    vk::ShaderLibrary &getShaderLibrary() { return mRenderer->getShaderLibrary(); }
     UtilsVk &getUtils() { return mUtils; }
 
     angle::Result getTimestamp(uint64_t *timestampOut);
@@ -439,6 +450,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     vk::DescriptorSetLayoutDesc getDriverUniformsDescriptorSetDesc(
         VkShaderStageFlags shaderStages) const;
+    void addDriverUniformsPushConstantRanges(PipelineType pipelineType,
+                                             vk::PipelineLayoutDesc *pipelineLayoutDesc) const;
 
     void updateScissor(const gl::State &glState);
 
@@ -530,6 +543,13 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                mRenderPassCommands->getFramebufferHandle() == framebuffer->getHandle();
     }
 
+    // Returns true if a render pass is open, but was set aside when the draw framebuffer binding
+    // changed.  See restoreFinishedRenderPass().
+    bool hasSuspendedRenderPass() const
+    {
+        return mRenderPassCommandBuffer == nullptr && mRenderPassCommands->started();
+    }
+
     bool hasStartedRenderPassWithCommands() const
     {
         return hasStartedRenderPass() && !mRenderPassCommands->getCommandBuffer().empty();
@@ -547,6 +567,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     uint32_t getCurrentSubpassIndex() const;
 
     egl::ContextPriority getContextPriority() const override { return mContextPriority; }
+
+    GLint64 getMemoryBudget() const override;
+    GLint64 getMemoryUsage() const override;
     angle::Result startRenderPass(gl::Rectangle renderArea,
                                   vk::CommandBuffer **commandBufferOut,
                                   bool *renderPassDescChangedOut);
@@ -582,6 +605,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     void syncObjectPerfCounters();
     void updateOverlayOnPresent();
+    angle::Result updateOverlayGpuTimesOnPresent();
     void addOverlayUsedBuffersCount(vk::CommandBufferHelper *commandBuffer);
 
     // DescriptorSet writes
@@ -614,6 +638,15 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // handleDirtyGraphicsPipeline(), and ProgramPipelineVk::link().
     void resetCurrentGraphicsPipeline() { mCurrentGraphicsPipeline = nullptr; }
 
+    // With the asyncGraphicsPipelineCreation feature, pipelines created for this context may
+    // reference its compatible render passes.  These are waited on before the render pass cache is
+    // destroyed.
+    void onGraphicsPipelineCreationPosted(std::shared_ptr<angle::WaitableEvent> event);
+
+    // With the preCreateRecordedGraphicsPipelines feature, the current program's binary is saved
+    // to the program cache again after the draw call that created a new pipeline for it.
+    void onGraphicsPipelineManifestUpdated() { mGraphicsPipelineManifestUpdated = true; }
+
     void onProgramExecutableReset(ProgramExecutableVk *executableVk);
 
   private:
@@ -635,9 +668,6 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         // Dirty bits that must be processed after the render pass is started.  Their handlers
         // record commands.
         DIRTY_BIT_EVENT_LOG,
-        // Pipeline needs to rebind because a new command buffer has been allocated, or UtilsVk has
-        // changed the binding.  The pipeline itself doesn't need to be recreated.
-        DIRTY_BIT_PIPELINE_BINDING,
         DIRTY_BIT_TEXTURES,
         DIRTY_BIT_VERTEX_BUFFERS,
         DIRTY_BIT_INDEX_BUFFER,
@@ -646,8 +676,17 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         // Shader resources excluding textures, which are handled separately.
         DIRTY_BIT_SHADER_RESOURCES,
         DIRTY_BIT_TRANSFORM_FEEDBACK_BUFFERS,
-        DIRTY_BIT_TRANSFORM_FEEDBACK_RESUME,
         DIRTY_BIT_DESCRIPTOR_SETS,
+        // State that is set on the command buffer with VK_EXT_extended_dynamic_state instead of
+        // being part of the pipeline.
+        DIRTY_BIT_DYNAMIC_STATE,
+        // Pipeline needs to rebind because a new command buffer has been allocated, or UtilsVk has
+        // changed the binding.  The pipeline itself doesn't need to be recreated.  This is handled
+        // as late as possible, as it's where a pipeline being created on a worker thread is waited
+        // on.  It must be before DIRTY_BIT_TRANSFORM_FEEDBACK_RESUME, as pipelines cannot be bound
+        // while transform feedback is active.
+        DIRTY_BIT_PIPELINE_BINDING,
+        DIRTY_BIT_TRANSFORM_FEEDBACK_RESUME,
         DIRTY_BIT_FRAMEBUFFER_FETCH_BARRIER,
         DIRTY_BIT_MAX,
     };
@@ -658,11 +697,19 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         ContextVk::*)(DirtyBits::Iterator *dirtyBitsIterator, DirtyBits dirtyBitMask);
     using ComputeDirtyBitHandler = angle::Result (ContextVk::*)();
 
+    using GraphicsDirtyBitSequenceHandler = angle::Result (ContextVk::*)(DirtyBits dirtyBitMask);
+
     struct DriverUniformsDescriptorSet
     {
         vk::DynamicBuffer dynamicBuffer;
         VkDescriptorSet descriptorSet;
         uint32_t dynamicOffset;
+        // The size of the driver uniforms, which is the range of the pushed descriptor when
+        // supportsPushDescriptor is enabled.  No descriptor set is allocated in that case.
+        uint32_t range;
+        // The driver uniforms when usePushConstantsForDriverUniforms is enabled, pushed into the
+        // command buffer when they are bound instead of being written to dynamicBuffer.
+        std::array<uint32_t, kMaxDriverUniformsSize / sizeof(uint32_t)> pushConstantsData;
         vk::BindingPointer<vk::DescriptorSetLayout> descriptorSetLayout;
         vk::RefCountedDescriptorPoolBinding descriptorPoolBinding;
         DriverUniformsDescriptorSetCache descriptorSetCache;
@@ -707,6 +754,15 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         double cpuTimestampS;
     };
 
+    // A pair of timestamps around a render pass or a frame, shown by the GPU time overlay widgets
+    // once their results are available.
+    struct GpuTimingQuery final
+    {
+        vk::QueryHelper begin;
+        vk::QueryHelper end;
+        bool isFrame;
+    };
+
     class ScopedDescriptorSetUpdates;
 
     angle::Result setupDraw(const gl::Context *context,
@@ -758,12 +814,42 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                     uint32_t *numIndicesOut);
     angle::Result setupDispatch(const gl::Context *context);
 
+    // Multi-draw calls are issued as a single indirect draw when none of their draws has to be set
+    // up on its own.  Otherwise they are drawn one by one by the MultiDraw*General functions.
+    bool canMultiDrawIndirect(const gl::Context *context,
+                              gl::PrimitiveMode mode,
+                              GLsizei drawcount) const;
+    bool canMultiDrawElementsIndirect(const gl::Context *context,
+                                      gl::PrimitiveMode mode,
+                                      gl::DrawElementsType type,
+                                      const GLvoid *const *indices,
+                                      GLsizei drawcount) const;
+    // |instanceCounts| and |baseInstances| may be null, in which case the draws have one instance
+    // and a base instance of 0.  Same for |baseVertices| with a base vertex of 0.
+    angle::Result multiDrawArraysIndirect(const gl::Context *context,
+                                          gl::PrimitiveMode mode,
+                                          const GLint *firsts,
+                                          const GLsizei *counts,
+                                          const GLsizei *instanceCounts,
+                                          const GLuint *baseInstances,
+                                          GLsizei drawcount);
+    angle::Result multiDrawElementsIndirect(const gl::Context *context,
+                                            gl::PrimitiveMode mode,
+                                            const GLsizei *counts,
+                                            gl::DrawElementsType type,
+                                            const GLvoid *const *indices,
+                                            const GLsizei *instanceCounts,
+                                            const GLint *baseVertices,
+                                            const GLuint *baseInstances,
+                                            GLsizei drawcount);
+
     gl::Rectangle getCorrectedViewport(const gl::Rectangle &viewport) const;
     void updateViewport(FramebufferVk *framebufferVk,
                         const gl::Rectangle &viewport,
                         float nearPlane,
                         float farPlane);
     void updateDepthRange(float nearPlane, float farPlane);
+    void updateFrontFace(const gl::State &glState);
     void updateFlipViewportDrawFramebuffer(const gl::State &glState);
     void updateFlipViewportReadFramebuffer(const gl::State &glState);
     void updateSurfaceRotationDrawFramebuffer(const gl::State &glState);
@@ -802,8 +888,11 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                                   DirtyBits dirtyBitMask);
     angle::Result handleDirtyGraphicsRenderPass(DirtyBits::Iterator *dirtyBitsIterator,
                                                 DirtyBits dirtyBitMask);
+    angle::Result handleDirtyGraphicsDynamicState(DirtyBits::Iterator *dirtyBitsIterator,
+                                                  DirtyBits dirtyBitMask);
     angle::Result handleDirtyGraphicsPipelineBinding(DirtyBits::Iterator *dirtyBitsIterator,
                                                      DirtyBits dirtyBitMask);
+    angle::Result recreateEvictedGraphicsPipeline();
     angle::Result handleDirtyGraphicsTextures(DirtyBits::Iterator *dirtyBitsIterator,
                                               DirtyBits dirtyBitMask);
     angle::Result handleDirtyGraphicsVertexBuffers(DirtyBits::Iterator *dirtyBitsIterator,
@@ -829,6 +918,14 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     angle::Result handleDirtyGraphicsDescriptorSets(DirtyBits::Iterator *dirtyBitsIterator,
                                                     DirtyBits dirtyBitMask);
 
+    // Handles a combination of dirty bits that is common in steady state by calling the given
+    // handlers in order, avoiding the generic loop over the dirty bits.  Only handlers that don't
+    // modify the dirty bits iterator can be used.
+    template <GraphicsDirtyBitHandler... kHandlers>
+    angle::Result handleDirtyGraphicsBitSequence(DirtyBits dirtyBitMask);
+    // Returns the specialized handler for |dirtyBits|, or nullptr if the combination has none.
+    static GraphicsDirtyBitSequenceHandler GetGraphicsDirtyBitSequenceHandler(DirtyBits dirtyBits);
+
     // Handlers for compute pipeline dirty bits.
     angle::Result handleDirtyComputeMemoryBarrier();
     angle::Result handleDirtyComputeEventLog();
@@ -846,6 +943,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     angle::Result handleDirtyEventLogImpl(vk::CommandBuffer *commandBuffer);
     angle::Result handleDirtyTexturesImpl(vk::CommandBufferHelper *commandBufferHelper);
     angle::Result handleDirtyShaderResourcesImpl(vk::CommandBufferHelper *commandBufferHelper);
+    bool hasDriverUniformsToBind(const DriverUniformsDescriptorSet &driverUniforms) const;
     void handleDirtyDriverUniformsBindingImpl(vk::CommandBuffer *commandBuffer,
                                               VkPipelineBindPoint bindPoint,
                                               DriverUniformsDescriptorSet *driverUniforms);
@@ -867,10 +965,15 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                     char phase,
                                     const EventName &name);
     angle::Result checkCompletedGpuEvents();
+    angle::Result beginGpuTiming(bool isFrame, GpuTimingQuery **timingOut);
+    angle::Result writeGpuTimingQuery(vk::QueryHelper *queryOut);
+    angle::Result checkCompletedGpuTimingQueries();
     void flushGpuEvents(double nextSyncGpuTimestampS, double nextSyncCpuTimestampS);
     void handleDeviceLost();
     bool shouldEmulateSeamfulCubeMapSampling() const;
     void clearAllGarbage();
+    // Releases the buffers kept for reuse when the device is close to its memory budget.
+    void trimMemory();
     bool hasRecordedCommands();
     void dumpCommandStreamDiagnostics();
     angle::Result flushOutsideRenderPassCommands();
@@ -884,6 +987,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     void flushDescriptorSetUpdates();
 
     void onRenderPassFinished();
+    angle::Result onRenderPassStarted();
+    // Continues the suspended render pass if it can be used for the current draw framebuffer.  See
+    // the resumeRenderPassOnFramebufferRebind feature.
+    angle::Result resumeSuspendedRenderPass(const gl::Rectangle &renderArea, bool *resumedOut);
 
     void initIndexTypeMap();
 
@@ -932,12 +1039,16 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     ContextVkPerfCounters getAndResetObjectPerfCounters();
 
+    void updateProgramCacheWithGraphicsPipelineManifest(const gl::Context *context);
+
     std::array<GraphicsDirtyBitHandler, DIRTY_BIT_MAX> mGraphicsDirtyBitHandlers;
     std::array<ComputeDirtyBitHandler, DIRTY_BIT_MAX> mComputeDirtyBitHandlers;
 
     vk::CommandBuffer *mRenderPassCommandBuffer;
 
     vk::PipelineHelper *mCurrentGraphicsPipeline;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mPendingGraphicsPipelineCreations;
+    bool mGraphicsPipelineManifestUpdated;
     vk::PipelineAndSerial *mCurrentComputePipeline;
     gl::PrimitiveMode mCurrentDrawMode;
 
@@ -984,6 +1095,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                                               DIRTY_BIT_DESCRIPTOR_SETS};
     static constexpr DirtyBits kDriverUniformsAndBindingDirtyBits{
         DIRTY_BIT_DRIVER_UNIFORMS, DIRTY_BIT_DRIVER_UNIFORMS_BINDING};
+    static constexpr DirtyBits kVertexAndDriverUniformsDirtyBits{
+        DIRTY_BIT_VERTEX_BUFFERS, DIRTY_BIT_DRIVER_UNIFORMS, DIRTY_BIT_DRIVER_UNIFORMS_BINDING};
 
     // Cached back-end objects.
     VertexArrayVk *mVertexArray;
@@ -1039,6 +1152,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     vk::TextureDescriptorDesc mActiveTexturesDesc;
 
     vk::ShaderBuffersDescriptorDesc mShaderBuffersDescriptorDesc;
+    // The above, followed by the views of the active images, for programs that use images.  The
+    // views are only known once the images are updated, so they are added when the shader
+    // resources are.
+    vk::ShaderBuffersDescriptorDesc mShaderResourcesDescriptorDesc;
 
     gl::ActiveTextureArray<TextureVk *> mActiveImages;
 
@@ -1061,8 +1178,6 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                             gl::IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS>
         mCurrentTransformFeedbackBuffers;
 
-    // Internal shader library.
-    vk::ShaderLibrary mShaderLibrary;
     UtilsVk mUtils;
 
     bool mGpuEventsEnabled;
@@ -1073,6 +1188,16 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // A list of gpu events since the last clock sync.
     std::vector<GpuEvent> mGpuEvents;
 
+    // Render pass and frame GPU times for the overlay.  Enabled on the first present with the
+    // overlay, if timestamps are supported.  The frame is timed from the start of its first render
+    // pass to its present.  The queries are kept in a deque so that the current frame's timing can
+    // be referenced while the timings of its render passes are added after it.
+    bool mGpuTimingEnabled;
+    vk::DynamicQueryPool mGpuTimingQueryPool;
+    std::deque<GpuTimingQuery> mInFlightGpuTimingQueries;
+    GpuTimingQuery *mCurrentGpuFrameTiming;
+    bool mEndGpuFrameTimingOnFlush;
+
     // Track SyncHelper object been added into secondary command buffer that has not been flushed to
     // vulkan.
     bool mEGLSyncObjectPendingFlush;
@@ -1121,6 +1246,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // Storage for default uniforms of ProgramVks and ProgramPipelineVks.
     vk::DynamicBuffer mDefaultUniformStorage;
 
+    // Storage for the indirect commands of multi-draw calls.
+    vk::DynamicBuffer mMultiDrawIndirectBuffer;
+
     // All staging buffer support is provided by a DynamicBuffer.
     vk::DynamicBuffer mStagingBuffer;
 
@@ -303,6 +303,13 @@ egl::Error DisplayVk::getEGLError(EGLint errorCode)
     return egl::Error(errorCode, 0, std::move(errorString));
 }
 
+void DisplayVk::initializeFrontendFeatures(angle::FrontendFeatures *features) const
+{
+    // The pipeline cache compression task only touches the blob cache, which is thread-safe, so
+    // syncPipelineCacheVk doesn't need to stall the frame to compress and store the cache.
+    ANGLE_FEATURE_CONDITION(features, enableCompressingPipelineCacheInThreadPool, true);
+}
+
 void DisplayVk::populateFeatureList(angle::FeatureList *features)
 {
     mRenderer->getFeatures().populateFeatureList(features);
@@ -143,6 +143,7 @@ class DisplayVk : public DisplayImpl, public vk::Context
     // TODO(jmadill): Remove this once refactor is done. http://anglebug.com/3041
     egl::Error getEGLError(EGLint errorCode);
 
+    void initializeFrontendFeatures(angle::FrontendFeatures *features) const override;
     void populateFeatureList(angle::FeatureList *features) override;
 
     ShareGroupImpl *createShareGroup() override;
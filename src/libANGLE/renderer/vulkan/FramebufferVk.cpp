@@ -727,6 +727,11 @@ angle::Result FramebufferVk::readPixels(const gl::Context *context,
     // Flush any deferred clears.
     ANGLE_TRY(flushDeferredClears(contextVk));
 
+    if (format == GL_DEPTH_COMPONENT || format == GL_STENCIL_INDEX_OES)
+    {
+        ANGLE_TRY(ensureDepthStencilCopyable(contextVk));
+    }
+
     GLuint outputSkipBytes = 0;
     PackPixelsParams params;
     ANGLE_TRY(vk::ImageHelper::GetReadPixelsParams(contextVk, pack, packBuffer, format, type, area,
@@ -905,6 +910,12 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
     const bool blitDepthBuffer   = (mask & GL_DEPTH_BUFFER_BIT) != 0;
     const bool blitStencilBuffer = (mask & GL_STENCIL_BUFFER_BIT) != 0;
 
+    if (blitDepthBuffer || blitStencilBuffer)
+    {
+        ANGLE_TRY(srcFramebufferVk->ensureDepthStencilCopyable(contextVk));
+        ANGLE_TRY(ensureDepthStencilCopyable(contextVk));
+    }
+
     // If a framebuffer contains a mixture of multisampled and multisampled-render-to-texture
     // attachments, this function could be simultaneously doing a blit on one attachment and resolve
     // on another.  For the most part, this means resolve semantics apply.  However, as the resolve
@@ -1088,6 +1099,14 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
     bool disableFlippingBlitWithCommand =
         contextVk->getRenderer()->getFeatures().disableFlippingBlitWithCommand.enabled;
 
+    // A 180 degree pre-rotation is a flip in both axes, which Vulkan's builtin blit can perform
+    // by reversing the source area.  The 90 and 270 degree rotations transpose the image, which
+    // the builtin blit cannot express, so those are left to the shader path.
+    const bool isRotated180            = rotation == SurfaceRotation::Rotated180Degrees;
+    const bool canRotateWithBlit       = rotation == SurfaceRotation::Identity || isRotated180;
+    const bool blitFlips               = !noFlip || isRotated180;
+    const gl::Rectangle blitSourceArea = sourceArea.flip(isRotated180, isRotated180);
+
     UtilsVk::BlitResolveParameters commonParams;
     commonParams.srcOffset[0]           = sourceArea.x;
     commonParams.srcOffset[1]           = sourceArea.y;
@@ -1119,13 +1138,13 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
         // be hard to guarantee the image stretching remains perfect.  That also allows us not to
         // have to transform back the dest clipping to source.
         //
-        // Non-identity pre-rotation cases do not use Vulkan's builtin blit.
+        // Pre-rotation cases other than 180 degrees do not use Vulkan's builtin blit.
         //
         // For simplicity, we either blit all render targets with a Vulkan command, or none.
         bool canBlitWithCommand = !isColorResolve && noClip &&
-                                  (noFlip || !disableFlippingBlitWithCommand) &&
+                                  (!blitFlips || !disableFlippingBlitWithCommand) &&
                                   HasSrcBlitFeature(renderer, readRenderTarget) &&
-                                  (rotation == SurfaceRotation::Identity);
+                                  canRotateWithBlit;
         // If we need to reinterpret the colorspace then the blit must be done through a shader
         bool reinterpretsColorspace =
             mCurrentFramebufferDesc.getWriteControlMode() != gl::SrgbWriteControlMode::Default;
@@ -1154,7 +1173,7 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
             for (size_t colorIndexGL : mState.getEnabledDrawBuffers())
             {
                 RenderTargetVk *drawRenderTarget = mRenderTargetCache.getColors()[colorIndexGL];
-                ANGLE_TRY(blitWithCommand(contextVk, sourceArea, destArea, readRenderTarget,
+                ANGLE_TRY(blitWithCommand(contextVk, blitSourceArea, destArea, readRenderTarget,
                                           drawRenderTarget, filter, true, false, false, flipX,
                                           flipY));
             }
@@ -1220,12 +1239,12 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
         // Multisampled images are not allowed to have mips.
         ASSERT(!isDepthStencilResolve || readRenderTarget->getLevelIndex() == gl::LevelIndex(0));
 
-        // Similarly, only blit if there's been no clipping or rotating.
+        // Similarly, only blit if there's been no clipping or transposing rotation.
         bool canBlitWithCommand = !isDepthStencilResolve && noClip &&
-                                  (noFlip || !disableFlippingBlitWithCommand) &&
+                                  (!blitFlips || !disableFlippingBlitWithCommand) &&
                                   HasSrcBlitFeature(renderer, readRenderTarget) &&
                                   HasDstBlitFeature(renderer, drawRenderTarget) &&
-                                  (rotation == SurfaceRotation::Identity);
+                                  canRotateWithBlit;
         bool areChannelsBlitCompatible =
             AreSrcAndDstDepthStencilChannelsBlitCompatible(readRenderTarget, drawRenderTarget);
 
@@ -1234,7 +1253,7 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
 
         if (canBlitWithCommand && areChannelsBlitCompatible)
         {
-            ANGLE_TRY(blitWithCommand(contextVk, sourceArea, destArea, readRenderTarget,
+            ANGLE_TRY(blitWithCommand(contextVk, blitSourceArea, destArea, readRenderTarget,
                                       drawRenderTarget, filter, false, blitDepthBuffer,
                                       blitStencilBuffer, flipX, flipY));
         }
@@ -1684,6 +1703,25 @@ angle::Result FramebufferVk::updateDepthStencilAttachment(const gl::Context *con
     return angle::Result::Continue;
 }
 
+angle::Result FramebufferVk::ensureDepthStencilCopyable(ContextVk *contextVk)
+{
+    // Only the depth/stencil image of window surfaces may be transient (other than the implicit
+    // multisampled images of multisampled-render-to-texture attachments, which are never copied).
+    if (mBackbuffer == nullptr || getDepthStencilRenderTarget() == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+
+    bool recreated = false;
+    ANGLE_TRY(mBackbuffer->ensureDepthStencilCopyable(contextVk, &recreated));
+    if (recreated)
+    {
+        updateDepthStencilAttachmentSerial(contextVk);
+    }
+
+    return angle::Result::Continue;
+}
+
 void FramebufferVk::updateDepthStencilAttachmentSerial(ContextVk *contextVk)
 {
     RenderTargetVk *depthStencilRT = getDepthStencilRenderTarget();
@@ -2362,6 +2400,96 @@ angle::Result FramebufferVk::getSamplePosition(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result FramebufferVk::resumeRenderPass(ContextVk *contextVk,
+                                              const gl::Rectangle &scissoredRenderArea,
+                                              bool *resumedOut)
+{
+    ASSERT(contextVk->hasSuspendedRenderPass());
+    *resumedOut = false;
+
+    vk::Framebuffer *framebuffer = nullptr;
+    ANGLE_TRY(getFramebuffer(contextVk, &framebuffer, nullptr));
+
+    vk::CommandBufferHelper &renderPassCommands = contextVk->getStartedRenderPassCommands();
+
+    // The render pass must have been started for this very framebuffer.  Render passes with an
+    // unresolve subpass or with transform feedback are not resumed, as startNewRenderPass() and
+    // ContextVk set up their state when they start.
+    const bool hasUnresolve = mRenderPassDesc.getColorUnresolveAttachmentMask().any() ||
+                              mRenderPassDesc.hasDepthUnresolveAttachment() ||
+                              mRenderPassDesc.hasStencilUnresolveAttachment();
+    if (renderPassCommands.getFramebufferHandle() != framebuffer->getHandle() ||
+        !(renderPassCommands.getRenderPassDesc() == mRenderPassDesc) || hasUnresolve ||
+        renderPassCommands.isTransformFeedbackStarted())
+    {
+        return angle::Result::Continue;
+    }
+
+    // Deferred clears can only be turned into loadOps if nothing is drawn in the render pass yet.
+    // Otherwise, let startNewRenderPass() close the render pass and start a new one with them.
+    if (mDeferredClears.any())
+    {
+        if (!renderPassCommands.getCommandBuffer().empty() ||
+            renderPassCommands.hasInvalidatedAttachments())
+        {
+            return angle::Result::Continue;
+        }
+
+        vk::PackedAttachmentIndex colorIndexVk(0);
+        for (size_t colorIndexGL : mState.getColorAttachmentsMask())
+        {
+            if (mDeferredClears.test(colorIndexGL))
+            {
+                renderPassCommands.updateRenderPassColorClear(colorIndexVk,
+                                                              mDeferredClears[colorIndexGL]);
+                mDeferredClears.reset(colorIndexGL);
+            }
+            ++colorIndexVk;
+        }
+
+        RenderTargetVk *depthStencilRenderTarget = getDepthStencilRenderTarget();
+        if (depthStencilRenderTarget &&
+            (mDeferredClears.testDepth() || mDeferredClears.testStencil()))
+        {
+            // Like in startNewRenderPass(), aspects the user didn't ask for are left DONT_CARE.
+            const angle::Format &intendedFormat =
+                depthStencilRenderTarget->getImageFormat().intendedFormat();
+
+            VkImageAspectFlags clearAspectFlags = 0;
+            VkClearValue clearValue             = {};
+
+            if (mDeferredClears.testDepth() && intendedFormat.depthBits > 0)
+            {
+                clearAspectFlags |= VK_IMAGE_ASPECT_DEPTH_BIT;
+                clearValue.depthStencil.depth = mDeferredClears.getDepthValue();
+            }
+            if (mDeferredClears.testStencil() && intendedFormat.stencilBits > 0)
+            {
+                clearAspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
+                clearValue.depthStencil.stencil = mDeferredClears.getStencilValue();
+            }
+
+            if (clearAspectFlags != 0)
+            {
+                renderPassCommands.updateRenderPassDepthStencilClear(clearAspectFlags, clearValue);
+            }
+
+            mDeferredClears.reset(vk::kUnpackedDepthIndex);
+            mDeferredClears.reset(vk::kUnpackedStencilIndex);
+        }
+        ASSERT(mDeferredClears.empty());
+
+        // The clears apply to the whole framebuffer.
+        renderPassCommands.growRenderArea(contextVk, getRotatedCompleteRenderArea(contextVk));
+    }
+
+    renderPassCommands.growRenderArea(contextVk, scissoredRenderArea);
+    contextVk->restoreFinishedRenderPass(framebuffer);
+
+    *resumedOut = true;
+    return angle::Result::Continue;
+}
+
 angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
                                                 const gl::Rectangle &scissoredRenderArea,
                                                 vk::CommandBuffer **commandBufferOut,
@@ -140,6 +140,11 @@ class FramebufferVk : public FramebufferImpl
                                      const gl::Rectangle &scissoredRenderArea,
                                      vk::CommandBuffer **commandBufferOut,
                                      bool *renderPassDescChangedOut);
+    // Continues the render pass that was set aside when the draw framebuffer binding changed, if
+    // it was started for this framebuffer.  Deferred clears are turned into its loadOps.
+    angle::Result resumeRenderPass(ContextVk *contextVk,
+                                   const gl::Rectangle &scissoredRenderArea,
+                                   bool *resumedOut);
 
     GLint getSamples() const;
 
@@ -218,6 +223,7 @@ class FramebufferVk : public FramebufferImpl
     angle::Result updateColorAttachment(const gl::Context *context, uint32_t colorIndex);
     angle::Result updateDepthStencilAttachment(const gl::Context *context);
     void updateDepthStencilAttachmentSerial(ContextVk *contextVk);
+    angle::Result ensureDepthStencilCopyable(ContextVk *contextVk);
     angle::Result flushColorAttachmentUpdates(const gl::Context *context,
                                               bool deferClears,
                                               uint32_t colorIndex);
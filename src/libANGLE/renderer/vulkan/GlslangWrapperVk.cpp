@@ -23,6 +23,7 @@ GlslangSourceOptions GlslangWrapperVk::CreateSourceOptions(const angle::Features
     options.supportsTransformFeedbackEmulation = features.emulateTransformFeedback.enabled;
     options.enableTransformFeedbackEmulation   = options.supportsTransformFeedbackEmulation;
     options.emulateBresenhamLines              = features.basicGLLineRasterization.enabled;
+    options.usePushConstantsForDriverUniforms  = features.usePushConstantsForDriverUniforms.enabled;
 
     return options;
 }
@@ -69,6 +69,11 @@ angle::Result OverlayVk::init(const gl::Context *context, bool *successOut)
 
     mRefreshCulledWidgets = true;
 
+    mTextWidgetsData.resize(mState.getTextWidgetsBufferSize());
+    mGraphWidgetsData.resize(mState.getGraphWidgetsBufferSize());
+    mNewTextWidgetsData.resize(mState.getTextWidgetsBufferSize());
+    mNewGraphWidgetsData.resize(mState.getGraphWidgetsBufferSize());
+
     ANGLE_TRY(contextVk->flushImpl(nullptr));
     *successOut = true;
     return angle::Result::Continue;
@@ -84,6 +89,9 @@ void OverlayVk::onDestroy(const gl::Context *context)
 
     mFontImage.destroy(renderer);
     mFontImageView.destroy(device);
+
+    mTextWidgetsBuffer.destroy(renderer);
+    mGraphWidgetsBuffer.destroy(renderer);
 }
 
 angle::Result OverlayVk::createFont(ContextVk *contextVk)
@@ -246,35 +254,14 @@ angle::Result OverlayVk::onPresent(ContextVk *contextVk,
         mRefreshCulledWidgets = false;
     }
 
-    vk::RendererScoped<vk::BufferHelper> textDataBuffer(renderer);
-    vk::RendererScoped<vk::BufferHelper> graphDataBuffer(renderer);
-
-    VkBufferCreateInfo textBufferCreateInfo = {};
-    textBufferCreateInfo.sType              = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    textBufferCreateInfo.size               = mState.getTextWidgetsBufferSize();
-    textBufferCreateInfo.usage              = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
-    textBufferCreateInfo.sharingMode        = VK_SHARING_MODE_EXCLUSIVE;
-
-    VkBufferCreateInfo graphBufferCreateInfo = textBufferCreateInfo;
-    graphBufferCreateInfo.size               = mState.getGraphWidgetsBufferSize();
-
-    ANGLE_TRY(textDataBuffer.get().init(contextVk, textBufferCreateInfo,
-                                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
-    ANGLE_TRY(graphDataBuffer.get().init(contextVk, graphBufferCreateInfo,
-                                         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
-
-    uint8_t *textData;
-    uint8_t *graphData;
-    ANGLE_TRY(textDataBuffer.get().map(contextVk, &textData));
-    ANGLE_TRY(graphDataBuffer.get().map(contextVk, &graphData));
-
     gl::Extents presentImageExtents(mPresentImageExtent.width, mPresentImageExtent.height, 1);
-    mState.fillWidgetData(presentImageExtents, textData, graphData);
+    mState.fillWidgetData(presentImageExtents, mNewTextWidgetsData.data(),
+                          mNewGraphWidgetsData.data());
 
-    ANGLE_TRY(textDataBuffer.get().flush(renderer, 0, textDataBuffer.get().getSize()));
-    ANGLE_TRY(graphDataBuffer.get().flush(renderer, 0, graphDataBuffer.get().getSize()));
-    textDataBuffer.get().unmap(renderer);
-    graphDataBuffer.get().unmap(renderer);
+    ANGLE_TRY(updateWidgetsBuffer(contextVk, &mNewTextWidgetsData, &mTextWidgetsData,
+                                  &mTextWidgetsBuffer));
+    ANGLE_TRY(updateWidgetsBuffer(contextVk, &mNewGraphWidgetsData, &mGraphWidgetsData,
+                                  &mGraphWidgetsBuffer));
 
     UtilsVk::OverlayDrawParameters params;
     params.subgroupSize[0] = mSubgroupSize[0];
@@ -282,8 +269,42 @@ angle::Result OverlayVk::onPresent(ContextVk *contextVk,
     params.rotateXY        = is90DegreeRotation;
 
     return contextVk->getUtils().drawOverlay(
-        contextVk, &textDataBuffer.get(), &graphDataBuffer.get(), &mFontImage, &mFontImageView,
+        contextVk, &mTextWidgetsBuffer, &mGraphWidgetsBuffer, &mFontImage, &mFontImageView,
         &mCulledWidgets, &mCulledWidgetsView, imageToPresent, imageToPresentView, params);
 }
 
+angle::Result OverlayVk::updateWidgetsBuffer(ContextVk *contextVk,
+                                             std::vector<uint8_t> *newData,
+                                             std::vector<uint8_t> *data,
+                                             vk::BufferHelper *buffer)
+{
+    if (buffer->valid() && *newData == *data)
+    {
+        return angle::Result::Continue;
+    }
+
+    RendererVk *renderer = contextVk->getRenderer();
+
+    // The previous buffer may still be in use by the GPU, so it's replaced instead of overwritten.
+    buffer->release(renderer);
+
+    VkBufferCreateInfo bufferCreateInfo = {};
+    bufferCreateInfo.sType              = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferCreateInfo.size               = newData->size();
+    bufferCreateInfo.usage              = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    bufferCreateInfo.sharingMode        = VK_SHARING_MODE_EXCLUSIVE;
+
+    ANGLE_TRY(buffer->init(contextVk, bufferCreateInfo, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
+
+    uint8_t *bufferData;
+    ANGLE_TRY(buffer->map(contextVk, &bufferData));
+    memcpy(bufferData, newData->data(), newData->size());
+
+    ANGLE_TRY(buffer->flush(renderer, 0, buffer->getSize()));
+    buffer->unmap(renderer);
+
+    std::swap(*data, *newData);
+    return angle::Result::Continue;
+}
+
 }  // namespace rx
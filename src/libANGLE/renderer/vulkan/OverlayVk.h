@@ -38,6 +38,10 @@ class OverlayVk : public OverlayImpl
   private:
     angle::Result createFont(ContextVk *contextVk);
     angle::Result cullWidgets(ContextVk *contextVk);
+    angle::Result updateWidgetsBuffer(ContextVk *contextVk,
+                                      std::vector<uint8_t> *newData,
+                                      std::vector<uint8_t> *data,
+                                      vk::BufferHelper *buffer);
 
     bool mSupportsSubgroupBallot;
     bool mSupportsSubgroupArithmetic;
@@ -54,6 +58,17 @@ class OverlayVk : public OverlayImpl
 
     vk::ImageHelper mCulledWidgets;
     vk::ImageView mCulledWidgetsView;
+
+    // The text and graph widget data last uploaded, and the buffers they are uploaded to.  Most
+    // widgets change rarely (PerSecond widgets once a second, for example), so the buffers are
+    // only replaced when the data filled for a frame differs.  The new data is filled in the
+    // |mNew*| vectors, which are kept around to avoid reallocating them every frame.
+    std::vector<uint8_t> mTextWidgetsData;
+    std::vector<uint8_t> mGraphWidgetsData;
+    std::vector<uint8_t> mNewTextWidgetsData;
+    std::vector<uint8_t> mNewGraphWidgetsData;
+    vk::BufferHelper mTextWidgetsBuffer;
+    vk::BufferHelper mGraphWidgetsBuffer;
 };
 
 }  // namespace rx
@@ -60,6 +60,31 @@ void SaveShaderInterfaceVariableXfbInfo(const ShaderInterfaceVariableXfbInfo &xf
     }
 }
 
+void SaveShaderInterfaceVariableInfo(const std::string &name,
+                                     const ShaderInterfaceVariableInfo &info,
+                                     gl::BinaryOutputStream *stream)
+{
+    stream->writeString(name);
+    stream->writeInt(info.descriptorSet);
+    stream->writeInt(info.binding);
+    stream->writeInt(info.location);
+    stream->writeInt(info.component);
+    stream->writeInt(info.index);
+    // PackedEnumBitSet uses uint8_t
+    stream->writeInt(info.activeStages.bits());
+    SaveShaderInterfaceVariableXfbInfo(info.xfb, stream);
+    stream->writeInt(info.fieldXfb.size());
+    for (const ShaderInterfaceVariableXfbInfo &xfb : info.fieldXfb)
+    {
+        SaveShaderInterfaceVariableXfbInfo(xfb, stream);
+    }
+    stream->writeBool(info.useRelaxedPrecision);
+    stream->writeBool(info.varyingIsInput);
+    stream->writeBool(info.varyingIsOutput);
+    stream->writeInt(info.attributeComponentCount);
+    stream->writeInt(info.attributeLocationCount);
+}
+
 bool ValidateTransformedSpirV(const gl::ShaderBitSet &linkedShaderStages,
                               const ShaderInterfaceVariableInfoMap &variableInfoMap,
                               const gl::ShaderMap<angle::spirv::Blob> &spirvBlobs)
@@ -117,6 +142,41 @@ DescriptorSetIndex CacheTypeToDescriptorSetIndex(VulkanCacheType cacheType)
             return DescriptorSetIndex::InvalidEnum;
     }
 }
+
+void InitTextureImageInfo(ContextVk *contextVk,
+                          const vk::TextureUnit &unit,
+                          bool texelFetchStaticUse,
+                          bool emulateSeamfulCubeMapSampling,
+                          VkDescriptorImageInfo *imageInfoOut)
+{
+    TextureVk *textureVk                   = unit.texture;
+    const vk::SamplerHelper &samplerHelper = *unit.sampler;
+
+    vk::ImageHelper &image = textureVk->getImage();
+
+    imageInfoOut->sampler     = samplerHelper.get().getHandle();
+    imageInfoOut->imageLayout = image.getCurrentLayout();
+
+    if (emulateSeamfulCubeMapSampling)
+    {
+        // If emulating seamful cubemapping, use the fetch image view.  This is basically the same
+        // image view as read, except it's a 2DArray view for cube maps.
+        const vk::ImageView &imageView = textureVk->getFetchImageViewAndRecordUse(
+            contextVk, unit.srgbDecode, texelFetchStaticUse);
+        imageInfoOut->imageView = imageView.getHandle();
+    }
+    else
+    {
+        const vk::ImageView &imageView = textureVk->getReadImageViewAndRecordUse(
+            contextVk, unit.srgbDecode, texelFetchStaticUse);
+        imageInfoOut->imageView = imageView.getHandle();
+    }
+
+    if (image.hasImmutableSampler())
+    {
+        imageInfoOut->sampler = textureVk->getSampler().get().getHandle();
+    }
+}
 }  // namespace
 
 DefaultUniformBlock::DefaultUniformBlock() = default;
@@ -186,32 +246,75 @@ void ShaderInfo::save(gl::BinaryOutputStream *stream)
     }
 }
 
-// ProgramInfo implementation.
-ProgramInfo::ProgramInfo() {}
+ProgramTransformOptions GetShaderModuleTransformOptions(gl::ShaderType shaderType,
+                                                        bool isLastPreFragmentStage,
+                                                        ProgramTransformOptions optionBits)
+{
+    // Line raster emulation is purely a specialization constant.  Pre-rotation and depth correction
+    // only transform the position output of the last pre-fragment stage, and the early fragment
+    // tests optimization only applies to the fragment shader.  Surface rotation is otherwise also
+    // read through a specialization constant, e.g. by dFdx/dFdy in the fragment shader.
+    ProgramTransformOptions moduleOptionBits = {};
+    if (isLastPreFragmentStage)
+    {
+        moduleOptionBits.surfaceRotation       = optionBits.surfaceRotation;
+        moduleOptionBits.enableDepthCorrection = optionBits.enableDepthCorrection;
+    }
+    if (shaderType == gl::ShaderType::Fragment)
+    {
+        moduleOptionBits.removeEarlyFragmentTestsOptimization =
+            optionBits.removeEarlyFragmentTestsOptimization;
+    }
+    return moduleOptionBits;
+}
 
-ProgramInfo::~ProgramInfo() = default;
+void GetShaderInterfaceKey(gl::ShaderType shaderType,
+                           const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                           std::string *keyOut)
+{
+    // The map is unordered, so the variables are sorted by name to make the key only depend on
+    // the contents.
+    using NameAndInfo = std::pair<const std::string, ShaderInterfaceVariableInfo>;
+    std::vector<const NameAndInfo *> variables;
+    variables.reserve(variableInfoMap.variableCount(shaderType));
+    for (const NameAndInfo &it : variableInfoMap.getIterator(shaderType))
+    {
+        variables.push_back(&it);
+    }
+    std::sort(variables.begin(), variables.end(),
+              [](const NameAndInfo *a, const NameAndInfo *b) { return a->first < b->first; });
+
+    gl::BinaryOutputStream stream;
+    for (const NameAndInfo *variable : variables)
+    {
+        SaveShaderInterfaceVariableInfo(variable->first, variable->second, &stream);
+    }
+
+    const uint8_t *data = static_cast<const uint8_t *>(stream.data());
+    keyOut->append(data, data + stream.length());
+}
 
-angle::Result ProgramInfo::initProgram(ContextVk *contextVk,
-                                       const gl::ShaderType shaderType,
-                                       bool isLastPreFragmentStage,
-                                       bool isTransformFeedbackProgram,
-                                       const ShaderInfo &shaderInfo,
-                                       ProgramTransformOptions optionBits,
-                                       const ShaderInterfaceVariableInfoMap &variableInfoMap)
+angle::Result TransformShaderSpirV(vk::Context *context,
+                                   const gl::ShaderType shaderType,
+                                   bool isLastPreFragmentStage,
+                                   bool isTransformFeedbackProgram,
+                                   const ShaderInfo &shaderInfo,
+                                   ProgramTransformOptions optionBits,
+                                   const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                   angle::spirv::Blob *transformedSpirvBlobOut)
 {
+    RendererVk *renderer                                        = context->getRenderer();
     const gl::ShaderMap<angle::spirv::Blob> &originalSpirvBlobs = shaderInfo.getSpirvBlobs();
     const angle::spirv::Blob &originalSpirvBlob                 = originalSpirvBlobs[shaderType];
-    gl::ShaderMap<angle::spirv::Blob> transformedSpirvBlobs;
-    angle::spirv::Blob &transformedSpirvBlob = transformedSpirvBlobs[shaderType];
 
     GlslangSpirvOptions options;
     options.shaderType = shaderType;
     options.removeEarlyFragmentTestsOptimization =
         shaderType == gl::ShaderType::Fragment && optionBits.removeEarlyFragmentTestsOptimization;
-    options.removeDebugInfo             = !contextVk->getRenderer()->getEnableValidationLayers();
+    options.removeDebugInfo             = !renderer->getEnableValidationLayers();
     options.isTransformFeedbackStage    = isLastPreFragmentStage && isTransformFeedbackProgram;
-    options.isTransformFeedbackEmulated = contextVk->getFeatures().emulateTransformFeedback.enabled;
-    options.negativeViewportSupported   = contextVk->getFeatures().supportsNegativeViewport.enabled;
+    options.isTransformFeedbackEmulated = renderer->getFeatures().emulateTransformFeedback.enabled;
+    options.negativeViewportSupported   = renderer->getFeatures().supportsNegativeViewport.enabled;
 
     if (isLastPreFragmentStage)
     {
@@ -219,20 +322,51 @@ angle::Result ProgramInfo::initProgram(ContextVk *contextVk,
         options.transformPositionToVulkanClipSpace = optionBits.enableDepthCorrection;
     }
 
-    ANGLE_TRY(GlslangWrapperVk::TransformSpirV(options, variableInfoMap, originalSpirvBlob,
-                                               &transformedSpirvBlob));
-    ANGLE_TRY(vk::InitShaderAndSerial(contextVk, &mShaders[shaderType].get(),
-                                      transformedSpirvBlob.data(),
-                                      transformedSpirvBlob.size() * sizeof(uint32_t)));
+    return GlslangWrapperVk::TransformSpirV(options, variableInfoMap, originalSpirvBlob,
+                                            transformedSpirvBlobOut);
+}
+
+// ProgramInfo implementation.
+ProgramInfo::ProgramInfo() {}
+
+ProgramInfo::~ProgramInfo() = default;
+
+angle::Result ProgramInfo::initShader(vk::Context *context,
+                                      const gl::ShaderType shaderType,
+                                      bool isLastPreFragmentStage,
+                                      bool isTransformFeedbackProgram,
+                                      const ShaderInfo &shaderInfo,
+                                      ProgramTransformOptions optionBits,
+                                      const ShaderInterfaceVariableInfoMap &variableInfoMap)
+{
+    angle::spirv::Blob transformedSpirvBlob;
+    ANGLE_TRY(TransformShaderSpirV(context, shaderType, isLastPreFragmentStage,
+                                   isTransformFeedbackProgram, shaderInfo, optionBits,
+                                   variableInfoMap, &transformedSpirvBlob));
+    return initShaderModule(context, shaderType, transformedSpirvBlob);
+}
+
+angle::Result ProgramInfo::initShaderModule(vk::Context *context,
+                                            const gl::ShaderType shaderType,
+                                            const angle::spirv::Blob &transformedSpirvBlob)
+{
+    return vk::InitShaderAndSerial(context, &mShaders[shaderType].get(),
+                                   transformedSpirvBlob.data(),
+                                   transformedSpirvBlob.size() * sizeof(uint32_t));
+}
+
+void ProgramInfo::finalizeShader(const gl::ShaderType shaderType,
+                                 ProgramTransformOptions optionBits,
+                                 ProgramInfo *shaderOwner)
+{
+    ASSERT(shaderOwner->hasShader(shaderType));
 
-    mProgramHelper.setShader(shaderType, &mShaders[shaderType]);
+    mProgramHelper.setShader(shaderType, &shaderOwner->mShaders[shaderType]);
 
     mProgramHelper.setSpecializationConstant(sh::vk::SpecializationConstantId::LineRasterEmulation,
                                              optionBits.enableLineRasterEmulation);
     mProgramHelper.setSpecializationConstant(sh::vk::SpecializationConstantId::SurfaceRotation,
                                              optionBits.surfaceRotation);
-
-    return angle::Result::Continue;
 }
 
 void ProgramInfo::release(ContextVk *contextVk)
@@ -249,6 +383,7 @@ ProgramExecutableVk::ProgramExecutableVk()
     : mEmptyDescriptorSets{},
       mNumDefaultUniformDescriptors(0),
       mUniformBufferDescriptorType(VK_DESCRIPTOR_TYPE_MAX_ENUM),
+      mTexturesDescriptorUpdateTemplateInitialized(false),
       mProgram(nullptr),
       mProgramPipeline(nullptr),
       mPerfCounters{},
@@ -272,6 +407,8 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
     mEmptyDescriptorSets.fill(VK_NULL_HANDLE);
     mNumDefaultUniformDescriptors = 0;
     mTransformOptions             = {};
+    mGraphicsPipelineManifest.clear();
+    mPrewarmCreationEvents.clear();
 
     for (vk::RefCountedDescriptorPoolBinding &binding : mDescriptorPoolBindings)
     {
@@ -288,10 +425,16 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
     mUniformsAndXfbDescriptorsCache.destroy(rendererVk);
     mShaderBufferDescriptorsCache.destroy(rendererVk);
 
+    mTexturesDescriptorUpdateTemplate.destroy(rendererVk->getDevice());
+    mTexturesDescriptorUpdateTemplateInitialized = false;
+    mTexturesDescriptorUpdateEntries.clear();
+    mTexturesDescriptorUpdateData.clear();
+
     // Initialize with a unique BufferSerial
     vk::ResourceSerialFactory &factory = rendererVk->getResourceSerialFactory();
     mCurrentDefaultUniformBufferSerial = factory.generateBufferSerial();
 
+    // The graphics ProgramInfos share shader modules, so they are all released together.
     for (ProgramInfo &programInfo : mGraphicsProgramInfos)
     {
         programInfo.release(contextVk);
@@ -335,6 +478,14 @@ std::unique_ptr<rx::LinkEvent> ProgramExecutableVk::load(gl::BinaryInputStream *
         }
     }
 
+    mGraphicsPipelineManifest.resize(stream->readInt<size_t>());
+    for (GraphicsPipelineManifestEntry &entry : mGraphicsPipelineManifest)
+    {
+        entry.transformOptions =
+            gl::bitCast<ProgramTransformOptions, uint8_t>(stream->readInt<uint8_t>());
+        stream->readBytes(reinterpret_cast<unsigned char *>(&entry.desc), sizeof(entry.desc));
+    }
+
     return std::make_unique<LinkEventDone>(angle::Result::Continue);
 }
 
@@ -345,30 +496,17 @@ void ProgramExecutableVk::save(gl::BinaryOutputStream *stream)
         stream->writeInt(mVariableInfoMap.variableCount(shaderType));
         for (const auto &it : mVariableInfoMap.getIterator(shaderType))
         {
-            const std::string &name                 = it.first;
-            const ShaderInterfaceVariableInfo &info = it.second;
-
-            stream->writeString(name);
-            stream->writeInt(info.descriptorSet);
-            stream->writeInt(info.binding);
-            stream->writeInt(info.location);
-            stream->writeInt(info.component);
-            stream->writeInt(info.index);
-            // PackedEnumBitSet uses uint8_t
-            stream->writeInt(info.activeStages.bits());
-            SaveShaderInterfaceVariableXfbInfo(info.xfb, stream);
-            stream->writeInt(info.fieldXfb.size());
-            for (const ShaderInterfaceVariableXfbInfo &xfb : info.fieldXfb)
-            {
-                SaveShaderInterfaceVariableXfbInfo(xfb, stream);
-            }
-            stream->writeBool(info.useRelaxedPrecision);
-            stream->writeBool(info.varyingIsInput);
-            stream->writeBool(info.varyingIsOutput);
-            stream->writeInt(info.attributeComponentCount);
-            stream->writeInt(info.attributeLocationCount);
+            SaveShaderInterfaceVariableInfo(it.first, it.second, stream);
         }
     }
+
+    stream->writeInt(mGraphicsPipelineManifest.size());
+    for (const GraphicsPipelineManifestEntry &entry : mGraphicsPipelineManifest)
+    {
+        stream->writeInt(gl::bitCast<uint8_t, ProgramTransformOptions>(entry.transformOptions));
+        stream->writeBytes(reinterpret_cast<const unsigned char *>(&entry.desc),
+                           sizeof(entry.desc));
+    }
 }
 
 void ProgramExecutableVk::clearVariableInfoMap()
@@ -772,17 +910,12 @@ void ProgramExecutableVk::updateEarlyFragmentTestsOptimization(ContextVk *contex
     }
 }
 
-angle::Result ProgramExecutableVk::getGraphicsPipeline(
-    ContextVk *contextVk,
-    gl::PrimitiveMode mode,
-    const vk::GraphicsPipelineDesc &desc,
-    const gl::AttributesMask &activeAttribLocations,
-    const vk::GraphicsPipelineDesc **descPtrOut,
-    vk::PipelineHelper **pipelineOut)
+angle::Result ProgramExecutableVk::initGraphicsProgramInfo(ContextVk *contextVk,
+                                                           gl::PrimitiveMode mode,
+                                                           const vk::GraphicsPipelineDesc &desc,
+                                                           ProgramInfo **programInfoOut)
 {
     const gl::State &glState                  = contextVk->getState();
-    RendererVk *renderer                      = contextVk->getRenderer();
-    vk::PipelineCache *pipelineCache          = nullptr;
     const gl::ProgramExecutable *glExecutable = glState.getProgramExecutable();
     ASSERT(glExecutable && !glExecutable->isCompute());
 
@@ -800,9 +933,12 @@ angle::Result ProgramExecutableVk::getGraphicsPipeline(
         ProgramVk *programVk = getShaderProgram(glState, shaderType);
         if (programVk)
         {
+            const bool isLastPreFragmentStage = shaderType == lastPreFragmentStage;
+            ProgramInfo &shaderOwner =
+                getGraphicsShaderOwner(shaderType, isLastPreFragmentStage, mTransformOptions);
             ANGLE_TRY(programVk->initGraphicsShaderProgram(
-                contextVk, shaderType, shaderType == lastPreFragmentStage, mTransformOptions,
-                &programInfo, mVariableInfoMap));
+                contextVk, shaderType, isLastPreFragmentStage, mTransformOptions, &programInfo,
+                &shaderOwner, mVariableInfoMap));
         }
     }
 
@@ -819,11 +955,163 @@ angle::Result ProgramExecutableVk::getGraphicsPipeline(
     shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::DrawableHeight,
                                              dimensions.height);
 
+    *programInfoOut = &programInfo;
+    return angle::Result::Continue;
+}
+
+angle::Result ProgramExecutableVk::getGraphicsPipeline(
+    ContextVk *contextVk,
+    gl::PrimitiveMode mode,
+    const vk::GraphicsPipelineDesc &desc,
+    const gl::AttributesMask &activeAttribLocations,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut)
+{
+    const gl::State &glState         = contextVk->getState();
+    RendererVk *renderer             = contextVk->getRenderer();
+    vk::PipelineCache *pipelineCache = nullptr;
+
+    ProgramInfo *programInfo = nullptr;
+    ANGLE_TRY(initGraphicsProgramInfo(contextVk, mode, desc, &programInfo));
+
     ANGLE_TRY(renderer->getPipelineCache(&pipelineCache));
-    return shaderProgram->getGraphicsPipeline(
+    ANGLE_TRY(programInfo->getShaderProgram()->getGraphicsPipeline(
         contextVk, &contextVk->getRenderPassCache(), *pipelineCache, getPipelineLayout(), desc,
         activeAttribLocations, glState.getProgramExecutable()->getAttributesTypeMask(), descPtrOut,
-        pipelineOut);
+        pipelineOut));
+
+    // Pipelines that were never used have no serial yet.  Record them so they can be created
+    // in advance the next time this program is loaded from the program cache.
+    if (contextVk->getFeatures().preCreateRecordedGraphicsPipelines.enabled && mProgram &&
+        !(*pipelineOut)->getSerial().valid())
+    {
+        recordGraphicsPipeline(contextVk, desc);
+    }
+
+    return angle::Result::Continue;
+}
+
+void ProgramExecutableVk::recordGraphicsPipeline(ContextVk *contextVk,
+                                                 const vk::GraphicsPipelineDesc &desc)
+{
+    // Keeps the program binary from growing unbounded for programs drawn with many states.
+    constexpr size_t kMaxGraphicsPipelineManifestSize = 32;
+    if (mGraphicsPipelineManifest.size() >= kMaxGraphicsPipelineManifestSize)
+    {
+        return;
+    }
+
+    const uint8_t transformOptions =
+        gl::bitCast<uint8_t, ProgramTransformOptions>(mTransformOptions);
+    for (const GraphicsPipelineManifestEntry &entry : mGraphicsPipelineManifest)
+    {
+        if (gl::bitCast<uint8_t, ProgramTransformOptions>(entry.transformOptions) ==
+                transformOptions &&
+            entry.desc == desc)
+        {
+            return;
+        }
+    }
+
+    mGraphicsPipelineManifest.push_back({mTransformOptions, desc});
+    contextVk->onGraphicsPipelineManifestUpdated();
+}
+
+angle::Result ProgramExecutableVk::warmUpGraphicsPipelines(ContextVk *contextVk)
+{
+    if (mGraphicsPipelineManifest.empty() ||
+        !contextVk->getFeatures().preCreateRecordedGraphicsPipelines.enabled)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "ProgramExecutableVk::warmUpGraphicsPipelines");
+    ASSERT(mProgram);
+
+    const gl::ProgramExecutable &glExecutable = getGlExecutable();
+    const gl::ShaderBitSet linkedShaderStages = glExecutable.getLinkedShaderStages();
+    const gl::ShaderType lastPreFragmentStage = gl::GetLastPreFragmentStage(linkedShaderStages);
+
+    vk::PipelineCache *pipelineCache = nullptr;
+    ANGLE_TRY(contextVk->getRenderer()->getPipelineCache(&pipelineCache));
+
+    for (const GraphicsPipelineManifestEntry &entry : mGraphicsPipelineManifest)
+    {
+        ProgramInfo &programInfo = getGraphicsProgramInfo(entry.transformOptions);
+        for (const gl::ShaderType shaderType : linkedShaderStages)
+        {
+            const bool isLastPreFragmentStage = shaderType == lastPreFragmentStage;
+            ProgramInfo &shaderOwner =
+                getGraphicsShaderOwner(shaderType, isLastPreFragmentStage, entry.transformOptions);
+            ANGLE_TRY(mProgram->initGraphicsShaderProgram(
+                contextVk, shaderType, isLastPreFragmentStage, entry.transformOptions, &programInfo,
+                &shaderOwner, mVariableInfoMap));
+        }
+
+        vk::ShaderProgramHelper *shaderProgram = programInfo.getShaderProgram();
+        const vk::PackedExtent &dimensions     = entry.desc.getDrawableSize();
+        shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::DrawableWidth,
+                                                 dimensions.width);
+        shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::DrawableHeight,
+                                                 dimensions.height);
+
+        vk::PipelineHelper *pipeline = nullptr;
+        ANGLE_TRY(shaderProgram->warmUpGraphicsPipeline(
+            contextVk, &contextVk->getRenderPassCache(), *pipelineCache, getPipelineLayout(),
+            entry.desc, glExecutable.getNonBuiltinAttribLocationsMask(),
+            glExecutable.getAttributesTypeMask(), &pipeline));
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result ProgramExecutableVk::prewarmGraphicsPipeline(ContextVk *contextVk,
+                                                           gl::PrimitiveMode mode,
+                                                           const vk::GraphicsPipelineDesc &desc)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ProgramExecutableVk::prewarmGraphicsPipeline");
+
+    const gl::ProgramExecutable *glExecutable = contextVk->getState().getProgramExecutable();
+    vk::PipelineCache *pipelineCache          = nullptr;
+
+    ProgramInfo *programInfo = nullptr;
+    ANGLE_TRY(initGraphicsProgramInfo(contextVk, mode, desc, &programInfo));
+
+    ANGLE_TRY(contextVk->getRenderer()->getPipelineCache(&pipelineCache));
+    vk::PipelineHelper *pipeline = nullptr;
+    ANGLE_TRY(programInfo->getShaderProgram()->warmUpGraphicsPipeline(
+        contextVk, &contextVk->getRenderPassCache(), *pipelineCache, getPipelineLayout(), desc,
+        glExecutable->getNonBuiltinAttribLocationsMask(), glExecutable->getAttributesTypeMask(),
+        &pipeline));
+
+    // Forget the pipelines that were created since the last call, so the list doesn't grow with
+    // the number of declared states.
+    mPrewarmCreationEvents.erase(
+        std::remove_if(mPrewarmCreationEvents.begin(), mPrewarmCreationEvents.end(),
+                       [](const std::shared_ptr<angle::WaitableEvent> &event) {
+                           return event->isReady();
+                       }),
+        mPrewarmCreationEvents.end());
+    if (pipeline->getCreationEvent())
+    {
+        mPrewarmCreationEvents.push_back(pipeline->getCreationEvent());
+    }
+
+    // Like the pipelines that are drawn with, the declared ones are saved in the program binary.
+    if (contextVk->getFeatures().preCreateRecordedGraphicsPipelines.enabled && mProgram &&
+        !pipeline->getSerial().valid())
+    {
+        recordGraphicsPipeline(contextVk, desc);
+    }
+
+    return angle::Result::Continue;
+}
+
+bool ProgramExecutableVk::isPrewarmComplete() const
+{
+    return std::all_of(
+        mPrewarmCreationEvents.begin(), mPrewarmCreationEvents.end(),
+        [](const std::shared_ptr<angle::WaitableEvent> &event) { return event->isReady(); });
 }
 
 angle::Result ProgramExecutableVk::getComputePipeline(ContextVk *contextVk,
@@ -1038,6 +1326,9 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
     pipelineLayoutDesc.updateDescriptorSetLayout(DescriptorSetIndex::Texture, texturesSetDesc);
     pipelineLayoutDesc.updateDescriptorSetLayout(DescriptorSetIndex::Internal,
                                                  driverUniformsSetDesc);
+    contextVk->addDriverUniformsPushConstantRanges(
+        glExecutable.isCompute() ? PipelineType::Compute : PipelineType::Graphics,
+        &pipelineLayoutDesc);
 
     ANGLE_TRY(contextVk->getPipelineLayoutCache().getPipelineLayout(
         contextVk, pipelineLayoutDesc, mDescriptorSetLayouts, &mPipelineLayout));
@@ -1330,14 +1621,17 @@ angle::Result ProgramExecutableVk::updateAtomicCounterBuffersDescriptorSet(
 angle::Result ProgramExecutableVk::updateImagesDescriptorSet(
     ContextVk *contextVk,
     const gl::ProgramExecutable &executable,
-    const gl::ShaderType shaderType)
+    const gl::ShaderType shaderType,
+    const vk::ShaderBuffersDescriptorDesc &shaderResourcesDesc,
+    bool cacheHit)
 {
     const gl::State &glState                           = contextVk->getState();
     RendererVk *renderer                               = contextVk->getRenderer();
     const std::vector<gl::ImageBinding> &imageBindings = executable.getImageBindings();
     const std::vector<gl::LinkedUniform> &uniforms     = executable.getUniforms();
 
-    if (imageBindings.empty())
+    // The key of the cached descriptor set includes the image views.
+    if (imageBindings.empty() || cacheHit)
     {
         return angle::Result::Continue;
     }
@@ -1359,7 +1653,8 @@ angle::Result ProgramExecutableVk::updateImagesDescriptorSet(
         }
 
         VkDescriptorSet descriptorSet;
-        ANGLE_TRY(getOrAllocateShaderResourcesDescriptorSet(contextVk, nullptr, &descriptorSet));
+        ANGLE_TRY(getOrAllocateShaderResourcesDescriptorSet(contextVk, &shaderResourcesDesc,
+                                                            &descriptorSet));
 
         std::string mappedImageName = GlslangGetMappedSamplerName(imageUniform.name);
 
@@ -1462,7 +1757,8 @@ angle::Result ProgramExecutableVk::updateShaderResourcesDescriptorSet(
     mEmptyDescriptorSets[DescriptorSetIndex::ShaderResource] = VK_NULL_HANDLE;
     mDynamicShaderBufferDescriptorOffsets.clear();
 
-    if (!executable->hasImages() && !executable->usesFramebufferFetch())
+    // The input attachments aren't part of the key, so their descriptor sets are not cached.
+    if (!executable->usesFramebufferFetch())
     {
         VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
         if (mShaderBufferDescriptorsCache.get(shaderBuffersDesc, &descriptorSet))
@@ -1493,7 +1789,8 @@ angle::Result ProgramExecutableVk::updateShaderResourcesDescriptorSet(
                                              kStorageBufferDescriptorType, cacheHit));
         ANGLE_TRY(updateAtomicCounterBuffersDescriptorSet(contextVk, *programState, shaderType,
                                                           shaderBuffersDesc, cacheHit));
-        ANGLE_TRY(updateImagesDescriptorSet(contextVk, programState->getExecutable(), shaderType));
+        ANGLE_TRY(updateImagesDescriptorSet(contextVk, programState->getExecutable(), shaderType,
+                                            shaderBuffersDesc, cacheHit));
         ANGLE_TRY(updateInputAttachmentDescriptorSet(programState->getExecutable(), shaderType,
                                                      contextVk, framebufferVk));
     }
@@ -1616,6 +1913,163 @@ void ProgramExecutableVk::updateTransformFeedbackDescriptorSetImpl(
                                              mDescriptorSets[DescriptorSetIndex::UniformsAndXfb]);
 }
 
+angle::Result ProgramExecutableVk::allocateTexturesDescriptorSet(
+    ContextVk *contextVk,
+    const vk::TextureDescriptorDesc &texturesDesc,
+    VkDescriptorSet *descriptorSetOut)
+{
+    bool newPoolAllocated;
+    ANGLE_TRY(
+        allocateDescriptorSetAndGetInfo(contextVk, DescriptorSetIndex::Texture, &newPoolAllocated));
+
+    // Clear descriptor set cache. It may no longer be valid.
+    if (newPoolAllocated)
+    {
+        mTextureDescriptorsCache.destroy(contextVk->getRenderer());
+    }
+
+    *descriptorSetOut = mDescriptorSets[DescriptorSetIndex::Texture];
+    mTextureDescriptorsCache.insert(texturesDesc, *descriptorSetOut);
+
+    return angle::Result::Continue;
+}
+
+angle::Result ProgramExecutableVk::initTexturesDescriptorUpdateTemplate(ContextVk *contextVk)
+{
+    ASSERT(!mTexturesDescriptorUpdateTemplateInitialized);
+    mTexturesDescriptorUpdateTemplateInitialized = true;
+
+    const gl::ProgramExecutable *executable = contextVk->getState().getProgramExecutable();
+    ASSERT(executable);
+
+    gl::ShaderMap<const gl::ProgramState *> programStates;
+    fillProgramStateMap(contextVk, &programStates);
+
+    std::vector<VkDescriptorUpdateTemplateEntry> templateEntries;
+    uint32_t descriptorCount = 0;
+
+    for (const gl::ShaderType shaderType : executable->getLinkedShaderStages())
+    {
+        angle::HashMap<std::string, uint32_t> mappedSamplerNameToArrayOffset;
+        const gl::ProgramState *programState = programStates[shaderType];
+        ASSERT(programState);
+        for (uint32_t textureIndex = 0; textureIndex < programState->getSamplerBindings().size();
+             ++textureIndex)
+        {
+            const gl::SamplerBinding &samplerBinding =
+                programState->getSamplerBindings()[textureIndex];
+            uint32_t uniformIndex = programState->getUniformIndexFromSamplerIndex(textureIndex);
+            const gl::LinkedUniform &samplerUniform = programState->getUniforms()[uniformIndex];
+            std::string mappedSamplerName = GlslangGetMappedSamplerName(samplerUniform.name);
+
+            if (!samplerUniform.isActive(shaderType))
+            {
+                continue;
+            }
+
+            uint32_t arraySize   = static_cast<uint32_t>(samplerBinding.boundTextureUnits.size());
+            uint32_t arrayOffset = mappedSamplerNameToArrayOffset[mappedSamplerName];
+            mappedSamplerNameToArrayOffset[mappedSamplerName] += arraySize;
+
+            const ShaderInterfaceVariableInfo &info =
+                mVariableInfoMap.get(shaderType, mappedSamplerName);
+
+            // Samplers that are active in multiple stages share the same binding.
+            bool isDuplicate = std::any_of(
+                templateEntries.begin(), templateEntries.end(),
+                [&info, arrayOffset](const VkDescriptorUpdateTemplateEntry &entry) {
+                    return entry.dstBinding == info.binding && entry.dstArrayElement == arrayOffset;
+                });
+            if (isDuplicate)
+            {
+                continue;
+            }
+
+            VkDescriptorUpdateTemplateEntry templateEntry = {};
+            templateEntry.dstBinding                      = info.binding;
+            templateEntry.dstArrayElement                 = arrayOffset;
+            templateEntry.descriptorCount                 = arraySize;
+            templateEntry.descriptorType = samplerBinding.textureType == gl::TextureType::Buffer
+                                               ? VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER
+                                               : VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            templateEntry.offset = descriptorCount * sizeof(TextureDescriptorData);
+            templateEntry.stride = sizeof(TextureDescriptorData);
+            templateEntries.push_back(templateEntry);
+
+            mTexturesDescriptorUpdateEntries.push_back({shaderType, textureIndex});
+            descriptorCount += arraySize;
+        }
+    }
+
+    // All of the sampler uniforms may be inactive.
+    if (templateEntries.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    mTexturesDescriptorUpdateData.resize(descriptorCount);
+
+    VkDescriptorUpdateTemplateCreateInfo createInfo = {};
+    createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    createInfo.descriptorUpdateEntryCount = static_cast<uint32_t>(templateEntries.size());
+    createInfo.pDescriptorUpdateEntries   = templateEntries.data();
+    createInfo.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    createInfo.descriptorSetLayout =
+        mDescriptorSetLayouts[DescriptorSetIndex::Texture].get().getHandle();
+
+    ANGLE_VK_TRY(contextVk,
+                 mTexturesDescriptorUpdateTemplate.init(contextVk->getDevice(), createInfo));
+
+    return angle::Result::Continue;
+}
+
+angle::Result ProgramExecutableVk::updateTexturesDescriptorSetWithTemplate(
+    ContextVk *contextVk,
+    VkDescriptorSet descriptorSet)
+{
+    const gl::ActiveTextureArray<vk::TextureUnit> &activeTextures = contextVk->getActiveTextures();
+    bool emulateSeamfulCubeMapSampling = contextVk->emulateSeamfulCubeMapSampling();
+
+    gl::ShaderMap<const gl::ProgramState *> programStates;
+    fillProgramStateMap(contextVk, &programStates);
+
+    size_t dataIndex = 0;
+    for (const TextureDescriptorUpdateEntry &entry : mTexturesDescriptorUpdateEntries)
+    {
+        const gl::ProgramState *programState = programStates[entry.shaderType];
+        const gl::SamplerBinding &samplerBinding =
+            programState->getSamplerBindings()[entry.textureIndex];
+        uint32_t uniformIndex = programState->getUniformIndexFromSamplerIndex(entry.textureIndex);
+        const gl::LinkedUniform &samplerUniform = programState->getUniforms()[uniformIndex];
+
+        for (GLuint textureUnit : samplerBinding.boundTextureUnits)
+        {
+            const vk::TextureUnit &unit = activeTextures[textureUnit];
+            TextureDescriptorData &data = mTexturesDescriptorUpdateData[dataIndex++];
+
+            // Texture buffers use buffer views, so they are especially handled.
+            if (samplerBinding.textureType == gl::TextureType::Buffer)
+            {
+                const vk::BufferView *view = nullptr;
+                ANGLE_TRY(
+                    unit.texture->getBufferViewAndRecordUse(contextVk, nullptr, false, &view));
+                data.bufferView = view->getHandle();
+            }
+            else
+            {
+                InitTextureImageInfo(contextVk, unit, samplerUniform.texelFetchStaticUse,
+                                     emulateSeamfulCubeMapSampling, &data.imageInfo);
+            }
+        }
+    }
+    ASSERT(dataIndex == mTexturesDescriptorUpdateData.size());
+
+    mTexturesDescriptorUpdateTemplate.updateDescriptorSet(contextVk->getDevice(), descriptorSet,
+                                                          mTexturesDescriptorUpdateData.data());
+
+    return angle::Result::Continue;
+}
+
 angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
     ContextVk *contextVk,
     const vk::TextureDescriptorDesc &texturesDesc)
@@ -1639,6 +2093,22 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
         return angle::Result::Continue;
     }
 
+    if (contextVk->getFeatures().supportsDescriptorUpdateTemplate.enabled)
+    {
+        if (!mTexturesDescriptorUpdateTemplateInitialized)
+        {
+            ANGLE_TRY(initTexturesDescriptorUpdateTemplate(contextVk));
+        }
+
+        if (!mTexturesDescriptorUpdateTemplate.valid())
+        {
+            return angle::Result::Continue;
+        }
+
+        ANGLE_TRY(allocateTexturesDescriptorSet(contextVk, texturesDesc, &descriptorSet));
+        return updateTexturesDescriptorSetWithTemplate(contextVk, descriptorSet);
+    }
+
     const gl::ActiveTextureArray<vk::TextureUnit> &activeTextures = contextVk->getActiveTextures();
     bool emulateSeamfulCubeMapSampling = contextVk->emulateSeamfulCubeMapSampling();
 
@@ -1668,18 +2138,7 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
             // sampler uniforms are inactive.
             if (descriptorSet == VK_NULL_HANDLE)
             {
-                bool newPoolAllocated;
-                ANGLE_TRY(allocateDescriptorSetAndGetInfo(contextVk, DescriptorSetIndex::Texture,
-                                                          &newPoolAllocated));
-
-                // Clear descriptor set cache. It may no longer be valid.
-                if (newPoolAllocated)
-                {
-                    mTextureDescriptorsCache.destroy(contextVk->getRenderer());
-                }
-
-                descriptorSet = mDescriptorSets[DescriptorSetIndex::Texture];
-                mTextureDescriptorsCache.insert(texturesDesc, descriptorSet);
+                ANGLE_TRY(allocateTexturesDescriptorSet(contextVk, texturesDesc, &descriptorSet));
             }
             ASSERT(descriptorSet != VK_NULL_HANDLE);
 
@@ -1729,34 +2188,9 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
             {
                 GLuint textureUnit          = samplerBinding.boundTextureUnits[arrayElement];
                 const vk::TextureUnit &unit = activeTextures[textureUnit];
-                TextureVk *textureVk        = unit.texture;
-                const vk::SamplerHelper &samplerHelper = *unit.sampler;
-
-                vk::ImageHelper &image = textureVk->getImage();
-
-                imageInfos[arrayElement].sampler     = samplerHelper.get().getHandle();
-                imageInfos[arrayElement].imageLayout = image.getCurrentLayout();
+                InitTextureImageInfo(contextVk, unit, samplerUniform.texelFetchStaticUse,
+                                     emulateSeamfulCubeMapSampling, &imageInfos[arrayElement]);
 
-                if (emulateSeamfulCubeMapSampling)
-                {
-                    // If emulating seamful cubemapping, use the fetch image view.  This is
-                    // basically the same image view as read, except it's a 2DArray view for
-                    // cube maps.
-                    const vk::ImageView &imageView = textureVk->getFetchImageViewAndRecordUse(
-                        contextVk, unit.srgbDecode, samplerUniform.texelFetchStaticUse);
-                    imageInfos[arrayElement].imageView = imageView.getHandle();
-                }
-                else
-                {
-                    const vk::ImageView &imageView = textureVk->getReadImageViewAndRecordUse(
-                        contextVk, unit.srgbDecode, samplerUniform.texelFetchStaticUse);
-                    imageInfos[arrayElement].imageView = imageView.getHandle();
-                }
-
-                if (textureVk->getImage().hasImmutableSampler())
-                {
-                    imageInfos[arrayElement].sampler = textureVk->getSampler().get().getHandle();
-                }
                 const std::string samplerName = GlslangGetMappedSamplerName(samplerUniform.name);
                 const ShaderInterfaceVariableInfo &info =
                     mVariableInfoMap.get(shaderType, samplerName);
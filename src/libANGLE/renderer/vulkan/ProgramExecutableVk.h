@@ -59,19 +59,55 @@ struct ProgramTransformOptions final
 static_assert(sizeof(ProgramTransformOptions) == 1, "Size check failed");
 static_assert(static_cast<int>(SurfaceRotation::EnumCount) <= 8, "Size check failed");
 
+// Returns the subset of |optionBits| that changes the SPIR-V of |shaderType|.  The remaining
+// options are only applied through specialization constants, so the permutations that differ in
+// them alone share the shader module of that stage.
+ProgramTransformOptions GetShaderModuleTransformOptions(gl::ShaderType shaderType,
+                                                        bool isLastPreFragmentStage,
+                                                        ProgramTransformOptions optionBits);
+
+// Appends the interface of |shaderType| in |variableInfoMap| to |keyOut|, independently of the
+// order the variables were added in.  The SPIR-V of that stage is transformed with nothing else
+// from the map, so the key identifies the transformation.
+void GetShaderInterfaceKey(gl::ShaderType shaderType,
+                           const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                           std::string *keyOut);
+
+angle::Result TransformShaderSpirV(vk::Context *context,
+                                   const gl::ShaderType shaderType,
+                                   bool isLastPreFragmentStage,
+                                   bool isTransformFeedbackProgram,
+                                   const ShaderInfo &shaderInfo,
+                                   ProgramTransformOptions optionBits,
+                                   const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                   angle::spirv::Blob *transformedSpirvBlobOut);
+
 class ProgramInfo final : angle::NonCopyable
 {
   public:
     ProgramInfo();
     ~ProgramInfo();
 
-    angle::Result initProgram(ContextVk *contextVk,
-                              const gl::ShaderType shaderType,
-                              bool isLastPreFragmentStage,
-                              bool isTransformFeedbackProgram,
-                              const ShaderInfo &shaderInfo,
-                              ProgramTransformOptions optionBits,
-                              const ShaderInterfaceVariableInfoMap &variableInfoMap);
+    // initShader() transforms the SPIR-V and creates the shader module, and only touches state
+    // that belongs to |shaderType|, so it can be called from a worker thread for each stage
+    // concurrently.  finalizeShader() must then be called on the context thread to attach the
+    // shader to the program.  The shader module is owned by the ProgramInfo of the same executable
+    // selected by GetShaderModuleTransformOptions(), which may be another one than the program's.
+    angle::Result initShader(vk::Context *context,
+                             const gl::ShaderType shaderType,
+                             bool isLastPreFragmentStage,
+                             bool isTransformFeedbackProgram,
+                             const ShaderInfo &shaderInfo,
+                             ProgramTransformOptions optionBits,
+                             const ShaderInterfaceVariableInfoMap &variableInfoMap);
+    // Creates the shader module of |shaderType| from SPIR-V that is already transformed.
+    angle::Result initShaderModule(vk::Context *context,
+                                   const gl::ShaderType shaderType,
+                                   const angle::spirv::Blob &transformedSpirvBlob);
+    void finalizeShader(const gl::ShaderType shaderType,
+                        ProgramTransformOptions optionBits,
+                        ProgramInfo *shaderOwner);
+
     void release(ContextVk *contextVk);
 
     ANGLE_INLINE bool valid(const gl::ShaderType shaderType) const
@@ -79,6 +115,12 @@ class ProgramInfo final : angle::NonCopyable
         return mProgramHelper.valid(shaderType);
     }
 
+    // Whether this ProgramInfo owns the shader module of |shaderType|.
+    ANGLE_INLINE bool hasShader(const gl::ShaderType shaderType) const
+    {
+        return mShaders[shaderType].get().valid();
+    }
+
     vk::ShaderProgramHelper *getShaderProgram() { return &mProgramHelper; }
 
   private:
@@ -135,6 +177,13 @@ class ProgramExecutableVk
         uint8_t index = gl::bitCast<uint8_t, ProgramTransformOptions>(option);
         return mGraphicsProgramInfos[index];
     }
+    ProgramInfo &getGraphicsShaderOwner(gl::ShaderType shaderType,
+                                        bool isLastPreFragmentStage,
+                                        ProgramTransformOptions option)
+    {
+        return getGraphicsProgramInfo(
+            GetShaderModuleTransformOptions(shaderType, isLastPreFragmentStage, option));
+    }
     ProgramInfo &getComputeProgramInfo() { return mComputeProgramInfo; }
     vk::BufferSerial getCurrentDefaultUniformBufferSerial() const
     {
@@ -150,6 +199,17 @@ class ProgramExecutableVk
 
     angle::Result getComputePipeline(ContextVk *contextVk, vk::PipelineAndSerial **pipelineOut);
 
+    // Used with the preCreateRecordedGraphicsPipelines feature.  Starts creating the graphics
+    // pipelines recorded in the program binary this executable was loaded from.
+    angle::Result warmUpGraphicsPipelines(ContextVk *contextVk);
+
+    // GL_ANGLE_prewarm_draw_state.  Starts creating the graphics pipeline a draw call with |desc|
+    // would use, and tells whether all the pipelines started so are created.
+    angle::Result prewarmGraphicsPipeline(ContextVk *contextVk,
+                                          gl::PrimitiveMode mode,
+                                          const vk::GraphicsPipelineDesc &desc);
+    bool isPrewarmComplete() const;
+
     const vk::PipelineLayout &getPipelineLayout() const { return mPipelineLayout.get(); }
     angle::Result createPipelineLayout(const gl::Context *glContext,
                                        gl::ActiveTextureArray<vk::TextureUnit> *activeTextures);
@@ -250,15 +310,30 @@ class ProgramExecutableVk
         const gl::ShaderType shaderType,
         const vk::ShaderBuffersDescriptorDesc &shaderBuffersDesc,
         bool cacheHit);
-    angle::Result updateImagesDescriptorSet(ContextVk *contextVk,
-                                            const gl::ProgramExecutable &executable,
-                                            const gl::ShaderType shaderType);
+    angle::Result updateImagesDescriptorSet(
+        ContextVk *contextVk,
+        const gl::ProgramExecutable &executable,
+        const gl::ShaderType shaderType,
+        const vk::ShaderBuffersDescriptorDesc &shaderResourcesDesc,
+        bool cacheHit);
+    angle::Result allocateTexturesDescriptorSet(ContextVk *contextVk,
+                                                const vk::TextureDescriptorDesc &texturesDesc,
+                                                VkDescriptorSet *descriptorSetOut);
+    angle::Result initTexturesDescriptorUpdateTemplate(ContextVk *contextVk);
+    angle::Result updateTexturesDescriptorSetWithTemplate(ContextVk *contextVk,
+                                                          VkDescriptorSet descriptorSet);
     angle::Result initDynamicDescriptorPools(ContextVk *contextVk,
                                              vk::DescriptorSetLayoutDesc &descriptorSetLayoutDesc,
                                              DescriptorSetIndex descriptorSetIndex,
                                              VkDescriptorSetLayout descriptorSetLayout);
 
     void outputCumulativePerfCounters();
+    void recordGraphicsPipeline(ContextVk *contextVk, const vk::GraphicsPipelineDesc &desc);
+    // Selects the ProgramInfo a draw call with |desc| uses and initializes its shaders.
+    angle::Result initGraphicsProgramInfo(ContextVk *contextVk,
+                                          gl::PrimitiveMode mode,
+                                          const vk::GraphicsPipelineDesc &desc,
+                                          ProgramInfo **programInfoOut);
 
     // Descriptor sets for uniform blocks and textures for this program.
     vk::DescriptorSetArray<VkDescriptorSet> mDescriptorSets;
@@ -303,6 +378,39 @@ class ProgramExecutableVk
 
     ProgramTransformOptions mTransformOptions;
 
+    // Used with the preCreateRecordedGraphicsPipelines feature.  The graphics pipelines created
+    // for this program, saved in the program binary and created again when it's loaded.  The
+    // GraphicsPipelineDesc includes the RenderPassDesc of the compatible render pass.
+    struct GraphicsPipelineManifestEntry
+    {
+        ProgramTransformOptions transformOptions;
+        vk::GraphicsPipelineDesc desc;
+    };
+    std::vector<GraphicsPipelineManifestEntry> mGraphicsPipelineManifest;
+
+    // The creation events of the pipelines started by prewarmGraphicsPipeline() that were not
+    // found finished yet.
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mPrewarmCreationEvents;
+
+    // Used with the supportsDescriptorUpdateTemplate feature.  The template writes every active
+    // sampler of the texture descriptor set in one call, reading the descriptors from
+    // mTexturesDescriptorUpdateData in the order of mTexturesDescriptorUpdateEntries.  It is
+    // created the first time the texture descriptor set is updated.
+    union TextureDescriptorData
+    {
+        VkDescriptorImageInfo imageInfo;
+        VkBufferView bufferView;
+    };
+    struct TextureDescriptorUpdateEntry
+    {
+        gl::ShaderType shaderType;
+        uint32_t textureIndex;
+    };
+    bool mTexturesDescriptorUpdateTemplateInitialized;
+    vk::DescriptorUpdateTemplate mTexturesDescriptorUpdateTemplate;
+    std::vector<TextureDescriptorUpdateEntry> mTexturesDescriptorUpdateEntries;
+    std::vector<TextureDescriptorData> mTexturesDescriptorUpdateData;
+
     ProgramVk *mProgram;
     ProgramPipelineVk *mProgramPipeline;
 
@@ -13,6 +13,7 @@
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/ProgramLinkedResources.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/renderer_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
@@ -24,6 +25,9 @@ namespace rx
 
 namespace
 {
+// Bounds the SPIR-V kept for programs combined with many different neighbors.
+constexpr size_t kMaxPipelineSpirvCacheSize = 256;
+
 // Identical to Std140 encoder in all aspects, except it ignores opaque uniform types.
 class VulkanDefaultBlockEncoder : public sh::Std140BlockEncoder
 {
@@ -70,8 +74,10 @@ void InitDefaultUniformBlock(const std::vector<sh::ShaderVariable> &uniforms,
     return;
 }
 
+// Returns false if the data being written is already in the block. Apps that respecify all their
+// uniforms before every draw would otherwise have the whole block uploaded again on each draw.
 template <typename T>
-void UpdateDefaultUniformBlock(GLsizei count,
+bool UpdateDefaultUniformBlock(GLsizei count,
                                uint32_t arrayIndex,
                                int componentCount,
                                const T *v,
@@ -79,6 +85,7 @@ void UpdateDefaultUniformBlock(GLsizei count,
                                angle::MemoryBuffer *uniformData)
 {
     const int elementSize = sizeof(T) * componentCount;
+    bool changed          = false;
 
     uint8_t *dst = uniformData->data() + layoutInfo.offset;
     if (layoutInfo.arrayStride == 0 || layoutInfo.arrayStride == elementSize)
@@ -86,7 +93,11 @@ void UpdateDefaultUniformBlock(GLsizei count,
         uint32_t arrayOffset = arrayIndex * layoutInfo.arrayStride;
         uint8_t *writePtr    = dst + arrayOffset;
         ASSERT(writePtr + (elementSize * count) <= uniformData->data() + uniformData->size());
-        memcpy(writePtr, v, elementSize * count);
+        if (memcmp(writePtr, v, elementSize * count) != 0)
+        {
+            memcpy(writePtr, v, elementSize * count);
+            changed = true;
+        }
     }
     else
     {
@@ -99,9 +110,15 @@ void UpdateDefaultUniformBlock(GLsizei count,
             uint8_t *writePtr     = dst + arrayOffset;
             const T *readPtr      = v + (readIndex * componentCount);
             ASSERT(writePtr + elementSize <= uniformData->data() + uniformData->size());
-            memcpy(writePtr, readPtr, elementSize);
+            if (memcmp(writePtr, readPtr, elementSize) != 0)
+            {
+                memcpy(writePtr, readPtr, elementSize);
+                changed = true;
+            }
         }
     }
+
+    return changed;
 }
 
 template <typename T>
@@ -137,6 +154,150 @@ class Std140BlockLayoutEncoderFactory : public gl::CustomBlockLayoutEncoderFacto
 };
 }  // anonymous namespace
 
+// Transforms the SPIR-V of a single shader stage and creates its shader module.  The task may run
+// on a worker thread, so it acts as its own vk::Context and saves any Vulkan error until the link
+// is resolved on the context thread.
+class ProgramVk::LinkTaskVk final : public vk::Context, public angle::Closure
+{
+  public:
+    LinkTaskVk(RendererVk *renderer,
+               ProgramInfo *shaderOwner,
+               gl::ShaderType shaderType,
+               bool isLastPreFragmentStage,
+               bool isTransformFeedbackProgram,
+               const ShaderInfo &shaderInfo,
+               ProgramTransformOptions optionBits,
+               const ShaderInterfaceVariableInfoMap &variableInfoMap)
+        : vk::Context(renderer),
+          mShaderOwner(shaderOwner),
+          mShaderType(shaderType),
+          mIsLastPreFragmentStage(isLastPreFragmentStage),
+          mIsTransformFeedbackProgram(isTransformFeedbackProgram),
+          mShaderInfo(shaderInfo),
+          mOptionBits(optionBits),
+          mVariableInfoMap(variableInfoMap),
+          mError({VK_SUCCESS, "", "", 0}),
+          mResult(angle::Result::Continue)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ProgramVk::LinkTaskVk::run");
+        mResult = mShaderOwner->initShader(this, mShaderType, mIsLastPreFragmentStage,
+                                           mIsTransformFeedbackProgram, mShaderInfo, mOptionBits,
+                                           mVariableInfoMap);
+    }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        mError.errorCode = result;
+        mError.file      = file;
+        mError.function  = function;
+        mError.line      = line;
+    }
+
+    // Must only be called once the task has finished running.
+    angle::Result getResult(ContextVk *contextVk)
+    {
+        if (mError.errorCode != VK_SUCCESS)
+        {
+            contextVk->handleError(mError.errorCode, mError.file, mError.function, mError.line);
+        }
+        return mResult;
+    }
+
+    gl::ShaderType getShaderType() const { return mShaderType; }
+    ProgramInfo *getShaderOwner() const { return mShaderOwner; }
+
+  private:
+    ProgramInfo *mShaderOwner;
+    gl::ShaderType mShaderType;
+    bool mIsLastPreFragmentStage;
+    bool mIsTransformFeedbackProgram;
+    const ShaderInfo &mShaderInfo;
+    ProgramTransformOptions mOptionBits;
+    const ShaderInterfaceVariableInfoMap &mVariableInfoMap;
+
+    vk::Error mError;
+    angle::Result mResult;
+};
+
+// The LinkEvent implementation for linking a program.  Each linked stage is transformed and
+// turned into a shader module in parallel on the worker thread pool.  Once done, the graphics
+// pipelines recorded in the program binary, if any, start being created.
+class ProgramVk::LinkEventVk final : public LinkEvent
+{
+  public:
+    LinkEventVk(std::shared_ptr<angle::WorkerThreadPool> workerPool,
+                ProgramExecutableVk *executable,
+                ProgramInfo *programInfo,
+                ProgramTransformOptions optionBits,
+                std::vector<std::shared_ptr<LinkTaskVk>> &&linkTasks)
+        : mExecutable(executable),
+          mProgramInfo(programInfo),
+          mOptionBits(optionBits),
+          mLinkTasks(std::move(linkTasks))
+    {
+        for (const std::shared_ptr<LinkTaskVk> &linkTask : mLinkTasks)
+        {
+            mWaitEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(workerPool, linkTask));
+        }
+    }
+
+    angle::Result wait(const gl::Context *context) override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ProgramVk::LinkEventVk::wait");
+        ContextVk *contextVk = vk::GetImpl(context);
+
+        for (std::shared_ptr<angle::WaitableEvent> &waitEvent : mWaitEvents)
+        {
+            waitEvent->wait();
+        }
+
+        angle::Result result = angle::Result::Continue;
+        for (const std::shared_ptr<LinkTaskVk> &linkTask : mLinkTasks)
+        {
+            if (linkTask->getResult(contextVk) != angle::Result::Continue)
+            {
+                result = angle::Result::Stop;
+            }
+        }
+        ANGLE_TRY(result);
+
+        // Attaching the shaders to the program is not thread-safe, so it's done here once all
+        // tasks are finished.
+        for (const std::shared_ptr<LinkTaskVk> &linkTask : mLinkTasks)
+        {
+            mProgramInfo->finalizeShader(linkTask->getShaderType(), mOptionBits,
+                                         linkTask->getShaderOwner());
+        }
+
+        return mExecutable->warmUpGraphicsPipelines(contextVk);
+    }
+
+    bool isLinking() override
+    {
+        for (std::shared_ptr<angle::WaitableEvent> &waitEvent : mWaitEvents)
+        {
+            if (!waitEvent->isReady())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+  private:
+    ProgramExecutableVk *mExecutable;
+    ProgramInfo *mProgramInfo;
+    ProgramTransformOptions mOptionBits;
+    std::vector<std::shared_ptr<LinkTaskVk>> mLinkTasks;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mWaitEvents;
+};
+
 // ProgramVk implementation.
 ProgramVk::ProgramVk(const gl::ProgramState &state) : ProgramImpl(state)
 {
@@ -157,6 +318,7 @@ void ProgramVk::reset(ContextVk *contextVk)
     mOriginalShaderInfo.release(contextVk);
 
     GlslangWrapperVk::ResetGlslangProgramInterfaceInfo(&mGlslangProgramInterfaceInfo);
+    mPipelineSpirvCache.clear();
 
     mExecutable.reset(contextVk);
 }
@@ -200,7 +362,12 @@ std::unique_ptr<rx::LinkEvent> ProgramVk::load(const gl::Context *context,
     }
 
     status = mExecutable.createPipelineLayout(context, nullptr);
-    return std::make_unique<LinkEventDone>(status);
+    if (status != angle::Result::Continue)
+    {
+        return std::make_unique<LinkEventDone>(status);
+    }
+
+    return createShadersInParallel(context);
 }
 
 void ProgramVk::save(const gl::Context *context, gl::BinaryOutputStream *stream)
@@ -292,10 +459,95 @@ std::unique_ptr<LinkEvent> ProgramVk::link(const gl::Context *context,
         mExecutable.resolvePrecisionMismatch(mergedVaryings);
     }
 
-    // TODO(jie.a.chen@intel.com): Parallelize linking.
-    // http://crbug.com/849576
     status = mExecutable.createPipelineLayout(context, nullptr);
-    return std::make_unique<LinkEventDone>(status);
+    if (status != angle::Result::Continue)
+    {
+        return std::make_unique<LinkEventDone>(status);
+    }
+
+    return createShadersInParallel(context);
+}
+
+std::unique_ptr<LinkEvent> ProgramVk::createShadersInParallel(const gl::Context *context)
+{
+    // Separable programs are drawn through the ProgramPipelineVk's executable, so the shaders
+    // created here would be unused.
+    if (mState.isSeparable())
+    {
+        return std::make_unique<LinkEventDone>(angle::Result::Continue);
+    }
+
+    ContextVk *contextVk = vk::GetImpl(context);
+
+    const gl::ShaderBitSet linkedShaderStages = mState.getExecutable().getLinkedShaderStages();
+    const gl::ShaderType lastPreFragmentStage = gl::GetLastPreFragmentStage(linkedShaderStages);
+    const bool isTransformFeedbackProgram = !mState.getLinkedTransformFeedbackVaryings().empty();
+
+    // Create the shaders for the transform options most likely to be used at draw time, i.e. no
+    // line raster emulation, no pre-rotation and the default GL clip space depth range.
+    ProgramTransformOptions optionBits = {};
+    ProgramInfo *programInfo           = &mExecutable.getComputeProgramInfo();
+    if (!mState.getExecutable().isCompute())
+    {
+        optionBits.enableDepthCorrection = !context->getState().isClipControlDepthZeroToOne();
+        programInfo                      = &mExecutable.getGraphicsProgramInfo(optionBits);
+    }
+
+    // Each shader module is created in the ProgramInfo that owns it, which may be another one than
+    // |programInfo| for the stages that are not affected by all transform options.
+    std::vector<std::shared_ptr<LinkTaskVk>> linkTasks;
+    for (const gl::ShaderType shaderType : linkedShaderStages)
+    {
+        const bool isLastPreFragmentStage = shaderType == lastPreFragmentStage;
+        const ProgramTransformOptions moduleOptionBits =
+            GetShaderModuleTransformOptions(shaderType, isLastPreFragmentStage, optionBits);
+        ProgramInfo *shaderOwner = programInfo;
+        if (!mState.getExecutable().isCompute())
+        {
+            shaderOwner = &mExecutable.getGraphicsProgramInfo(moduleOptionBits);
+        }
+        linkTasks.push_back(std::make_shared<LinkTaskVk>(
+            contextVk->getRenderer(), shaderOwner, shaderType, isLastPreFragmentStage,
+            isTransformFeedbackProgram, mOriginalShaderInfo, moduleOptionBits,
+            mExecutable.mVariableInfoMap));
+    }
+
+    return std::make_unique<LinkEventVk>(context->getWorkerThreadPool(), &mExecutable, programInfo,
+                                         optionBits, std::move(linkTasks));
+}
+
+angle::Result ProgramVk::initPipelineShader(ContextVk *contextVk,
+                                            const gl::ShaderType shaderType,
+                                            bool isLastPreFragmentStage,
+                                            bool isTransformFeedbackProgram,
+                                            ProgramTransformOptions moduleOptionBits,
+                                            ProgramInfo *shaderOwner,
+                                            const ShaderInterfaceVariableInfoMap &variableInfoMap)
+{
+    std::string key;
+    key.push_back(static_cast<char>(shaderType));
+    key.push_back(static_cast<char>(isLastPreFragmentStage));
+    key.push_back(
+        static_cast<char>(gl::bitCast<uint8_t, ProgramTransformOptions>(moduleOptionBits)));
+    GetShaderInterfaceKey(shaderType, variableInfoMap, &key);
+
+    auto iter = mPipelineSpirvCache.find(key);
+    if (iter != mPipelineSpirvCache.end())
+    {
+        return shaderOwner->initShaderModule(contextVk, shaderType, iter->second);
+    }
+
+    angle::spirv::Blob transformedSpirvBlob;
+    ANGLE_TRY(TransformShaderSpirV(contextVk, shaderType, isLastPreFragmentStage,
+                                   isTransformFeedbackProgram, mOriginalShaderInfo,
+                                   moduleOptionBits, variableInfoMap, &transformedSpirvBlob));
+    ANGLE_TRY(shaderOwner->initShaderModule(contextVk, shaderType, transformedSpirvBlob));
+
+    if (mPipelineSpirvCache.size() < kMaxPipelineSpirvCacheSize)
+    {
+        mPipelineSpirvCache.emplace(std::move(key), std::move(transformedSpirvBlob));
+    }
+    return angle::Result::Continue;
 }
 
 void ProgramVk::linkResources(const gl::ProgramLinkedResources &resources)
@@ -440,9 +692,11 @@ void ProgramVk::setUniformImpl(GLint location, GLsizei count, const T *v, GLenum
             }
 
             const GLint componentCount = linkedUniform.typeInfo->componentCount;
-            UpdateDefaultUniformBlock(count, locationInfo.arrayIndex, componentCount, v, layoutInfo,
-                                      &uniformBlock.uniformData);
-            mDefaultUniformBlocksDirty.set(shaderType);
+            if (UpdateDefaultUniformBlock(count, locationInfo.arrayIndex, componentCount, v,
+                                          layoutInfo, &uniformBlock.uniformData))
+            {
+                mDefaultUniformBlocksDirty.set(shaderType);
+            }
         }
     }
     else
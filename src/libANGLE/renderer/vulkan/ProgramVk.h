@@ -127,6 +127,8 @@ class ProgramVk : public ProgramImpl
     const ProgramExecutableVk &getExecutable() const { return mExecutable; }
     ProgramExecutableVk &getExecutable() { return mExecutable; }
 
+    bool isPrewarmComplete() const override { return mExecutable.isPrewarmComplete(); }
+
     gl::ShaderMap<DefaultUniformBlock> &getDefaultUniformBlocks() { return mDefaultUniformBlocks; }
     size_t getDefaultUniformAlignedSize(ContextVk *contextVk, const gl::ShaderType shaderType) const
     {
@@ -146,10 +148,11 @@ class ProgramVk : public ProgramImpl
         bool isLastPreFragmentStage,
         ProgramTransformOptions optionBits,
         ProgramInfo *programInfo,
+        ProgramInfo *shaderOwner,
         const ShaderInterfaceVariableInfoMap &variableInfoMap)
     {
         return initProgram(contextVk, shaderType, isLastPreFragmentStage, optionBits, programInfo,
-                           variableInfoMap);
+                           shaderOwner, variableInfoMap);
     }
 
     ANGLE_INLINE angle::Result initComputeProgram(
@@ -159,7 +162,7 @@ class ProgramVk : public ProgramImpl
     {
         ProgramTransformOptions optionBits = {};
         return initProgram(contextVk, gl::ShaderType::Compute, false, optionBits, programInfo,
-                           variableInfoMap);
+                           programInfo, variableInfoMap);
     }
 
     const GlslangProgramInterfaceInfo &getGlslangProgramInterfaceInfo()
@@ -168,6 +171,9 @@ class ProgramVk : public ProgramImpl
     }
 
   private:
+    class LinkTaskVk;
+    class LinkEventVk;
+
     template <int cols, int rows>
     void setUniformMatrixfv(GLint location,
                             GLsizei count,
@@ -188,25 +194,55 @@ class ProgramVk : public ProgramImpl
     template <typename T>
     void setUniformImpl(GLint location, GLsizei count, const T *v, GLenum entryPointType);
     void linkResources(const gl::ProgramLinkedResources &resources);
+    std::unique_ptr<LinkEvent> createShadersInParallel(const gl::Context *context);
+    angle::Result initPipelineShader(ContextVk *contextVk,
+                                     const gl::ShaderType shaderType,
+                                     bool isLastPreFragmentStage,
+                                     bool isTransformFeedbackProgram,
+                                     ProgramTransformOptions moduleOptionBits,
+                                     ProgramInfo *shaderOwner,
+                                     const ShaderInterfaceVariableInfoMap &variableInfoMap);
 
     ANGLE_INLINE angle::Result initProgram(ContextVk *contextVk,
                                            const gl::ShaderType shaderType,
                                            bool isLastPreFragmentStage,
                                            ProgramTransformOptions optionBits,
                                            ProgramInfo *programInfo,
+                                           ProgramInfo *shaderOwner,
                                            const ShaderInterfaceVariableInfoMap &variableInfoMap)
     {
         ASSERT(mOriginalShaderInfo.valid());
 
         // Create the program pipeline.  This is done lazily and once per combination of
+        // specialization constants.  The SPIR-V is only transformed and turned into a shader
+        // module once per |shaderOwner|, which is shared by all combinations that only differ in
         // specialization constants.
         if (!programInfo->valid(shaderType))
         {
-            const bool isTransformFeedbackProgram =
-                !mState.getLinkedTransformFeedbackVaryings().empty();
-            ANGLE_TRY(programInfo->initProgram(contextVk, shaderType, isLastPreFragmentStage,
-                                               isTransformFeedbackProgram, mOriginalShaderInfo,
-                                               optionBits, variableInfoMap));
+            if (!shaderOwner->hasShader(shaderType))
+            {
+                const bool isTransformFeedbackProgram =
+                    !mState.getLinkedTransformFeedbackVaryings().empty();
+                const ProgramTransformOptions moduleOptionBits =
+                    GetShaderModuleTransformOptions(shaderType, isLastPreFragmentStage, optionBits);
+
+                // Any other interface than the program's own is that of a program pipeline the
+                // program is used in.
+                if (&variableInfoMap == &mExecutable.mVariableInfoMap)
+                {
+                    ANGLE_TRY(shaderOwner->initShader(contextVk, shaderType, isLastPreFragmentStage,
+                                                      isTransformFeedbackProgram,
+                                                      mOriginalShaderInfo, moduleOptionBits,
+                                                      variableInfoMap));
+                }
+                else
+                {
+                    ANGLE_TRY(initPipelineShader(contextVk, shaderType, isLastPreFragmentStage,
+                                                 isTransformFeedbackProgram, moduleOptionBits,
+                                                 shaderOwner, variableInfoMap));
+                }
+            }
+            programInfo->finalizeShader(shaderType, optionBits, shaderOwner);
         }
         ASSERT(programInfo->valid(shaderType));
 
@@ -221,6 +257,12 @@ class ProgramVk : public ProgramImpl
 
     GlslangProgramInterfaceInfo mGlslangProgramInterfaceInfo;
 
+    // The SPIR-V of the stages of this separable program, transformed for the interfaces of the
+    // program pipelines it was used in.  Pipelines that combine the program with previously seen
+    // neighbors don't transform it again.  Keyed by the stage, the options that change its shader
+    // module and its interface.
+    angle::HashMap<std::string, angle::spirv::Blob> mPipelineSpirvCache;
+
     ProgramExecutableVk mExecutable;
 };
 
@@ -204,11 +204,33 @@ void QueryVk::onRenderPassEnd(ContextVk *contextVk)
 
 angle::Result QueryVk::accumulateStashedQueryResult(ContextVk *contextVk, vk::QueryResult *result)
 {
-    for (vk::Shared<vk::QueryHelper> &query : mStashedQueryHelpers)
+    // The queries of consecutive render passes are usually allocated one after the other from the
+    // same pool, so their results are read in runs rather than one call per query.
+    size_t stashedIndex = 0;
+    while (stashedIndex < mStashedQueryHelpers.size())
     {
+        vk::QueryHelper &firstQuery = mStashedQueryHelpers[stashedIndex].get();
+
+        uint32_t runLength = 1;
+        while (stashedIndex + runLength < mStashedQueryHelpers.size() &&
+               mStashedQueryHelpers[stashedIndex + runLength - 1].get().isFollowedBy(
+                   mStashedQueryHelpers[stashedIndex + runLength].get()))
+        {
+            ++runLength;
+        }
+
         vk::QueryResult v(getQueryResultCount());
-        ANGLE_TRY(query.get().getUint64Result(contextVk, &v));
+        if (runLength == 1)
+        {
+            ANGLE_TRY(firstQuery.getUint64Result(contextVk, &v));
+        }
+        else
+        {
+            ANGLE_TRY(firstQuery.getAccumulatedUint64Result(contextVk, runLength, &v));
+        }
         *result += v;
+
+        stashedIndex += runLength;
     }
     releaseStashedQueries(contextVk);
     return angle::Result::Continue;
@@ -15,6 +15,7 @@
 #include <EGL/eglext.h>
 
 #include "common/debug.h"
+#include "common/hash_utils.h"
 #include "common/platform.h"
 #include "common/system_utils.h"
 #include "common/vulkan/vk_google_filtering_precision.h"
@@ -22,6 +23,7 @@
 #include "gpu_info_util/SystemInfo.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/driver_utils.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/vulkan/CompilerVk.h"
@@ -64,6 +66,22 @@ constexpr uint32_t kPreferredDefaultUniformBufferSize = 64 * 1024u;
 
 // Update the pipeline cache every this many swaps.
 constexpr uint32_t kPipelineCacheVkUpdatePeriod = 60;
+// Past this fraction of the budget of the device-local heaps, the memory kept around for reuse is
+// trimmed.
+constexpr double kMemoryBudgetTrimThreshold = 0.9;
+
+// Glslang's initialization state is global, and is warmed up off the thread of the display that
+// initializes it.
+std::mutex gGlslangMutex;
+
+#if defined(ANGLE_SHARED_LIBVULKAN)
+// volk's function pointers are global.  While there is a single device they are loaded from it,
+// which skips the loader's dispatch.  With several devices, which may be used from different
+// threads at the same time, they are left as the loader's trampolines, which dispatch on the
+// handle they are called with.
+std::mutex gVolkMutex;
+std::atomic<uint32_t> gVolkDeviceCount(0);
+#endif  // defined(ANGLE_SHARED_LIBVULKAN)
 // Per the Vulkan specification, as long as Vulkan 1.1+ is returned by vkEnumerateInstanceVersion,
 // ANGLE must indicate the highest version of Vulkan functionality that it uses.  The Vulkan
 // validation layers will issue messages for any core functionality that requires a higher version.
@@ -479,7 +497,9 @@ void ComputePipelineCacheVkChunkKey(VkPhysicalDeviceProperties physicalDevicePro
                                     const uint8_t chunkIndex,
                                     egl::BlobCache::Key *hashOut)
 {
-    std::ostringstream hashStream("ANGLE Pipeline Cache: ", std::ios_base::ate);
+    // The chunks of a pipeline cache are compressed separately.  The key is different from when
+    // the whole pipeline cache was compressed at once so old entries aren't mistaken for chunks.
+    std::ostringstream hashStream("ANGLE Pipeline Cache Chunk: ", std::ios_base::ate);
     // Add the pipeline cache UUID to make sure the blob cache always gives a compatible pipeline
     // cache.  It's not particularly necessary to write it as a hex number as done here, so long as
     // there is no '\0' in the result.
@@ -499,66 +519,71 @@ void ComputePipelineCacheVkChunkKey(VkPhysicalDeviceProperties physicalDevicePro
                                hashString.length(), hashOut->data());
 }
 
+// The pipeline cache is split into chunks of kPipelineCacheChunkSize bytes, each compressed and
+// stored in the blob cache separately, so that only the chunks that changed since the last sync
+// need to be stored again.  kPipelineCacheChunkSize leaves room for the compression overhead so
+// that a compressed chunk fits in a blob even if the data doesn't compress.  There is no function
+// to query the blob size limit in android.
+constexpr size_t kMaxBlobCacheSize       = 64 * 1024;
+constexpr size_t kBlobHeaderSize         = sizeof(uint8_t);
+constexpr size_t kPipelineCacheChunkSize = 60 * 1024;
+
 bool CompressAndStorePipelineCacheVk(VkPhysicalDeviceProperties physicalDeviceProperties,
                                      DisplayVk *displayVk,
-                                     ContextVk *contextVk,
                                      const std::vector<uint8_t> &cacheData,
-                                     const size_t maxTotalSize)
+                                     std::vector<size_t> *chunkHashes)
 {
-    // Though the pipeline cache will be compressed and divided into several chunks to store in blob
-    // cache, the largest total size of blob cache is only 2M in android now, so there is no use to
-    // handle big pipeline cache when android will reject it finally.
-    if (cacheData.size() >= maxTotalSize)
-    {
-        // TODO: handle the big pipeline cache. http://anglebug.com/4722
-        ANGLE_PERF_WARNING(contextVk->getDebug(), GL_DEBUG_SEVERITY_LOW,
-                           "Skip syncing pipeline cache data when it's larger than maxTotalSize.");
-        return false;
-    }
-
-    // To make it possible to store more pipeline cache data, compress the whole pipelineCache.
-    angle::MemoryBuffer compressedData;
+    // Store {numChunks, chunkCompressedData} in keyData, numChunks is used to validate the data.
+    const size_t numChunks = UnsignedCeilDivide(static_cast<unsigned int>(cacheData.size()),
+                                                static_cast<unsigned int>(kPipelineCacheChunkSize));
+    ASSERT(numChunks <= UINT8_MAX);
 
-    if (!egl::CompressBlobCacheData(cacheData.size(), cacheData.data(), &compressedData))
+    // Every chunk has the number of chunks in its header, so they all need to be stored again if
+    // that changes.
+    const bool storeAllChunks = chunkHashes->size() != numChunks;
+    if (storeAllChunks)
     {
-        return false;
+        chunkHashes->assign(numChunks, 0);
     }
 
-    // If the size of compressedData is larger than (kMaxBlobCacheSize - sizeof(numChunks)),
-    // the pipelineCache still can't be stored in blob cache. Divide the large compressed
-    // pipelineCache into several parts to store seperately. There is no function to
-    // query the limit size in android.
-    constexpr size_t kMaxBlobCacheSize = 64 * 1024;
-
-    // Store {numChunks, chunkCompressedData} in keyData, numChunks is used to validate the data.
-    // For example, if the compressed size is 68841 bytes(67k), divide into {2,34421 bytes} and
-    // {2,34420 bytes}.
-    constexpr size_t kBlobHeaderSize = sizeof(uint8_t);
-    size_t compressedOffset          = 0;
-
-    const size_t numChunks = UnsignedCeilDivide(static_cast<unsigned int>(compressedData.size()),
-                                                kMaxBlobCacheSize - kBlobHeaderSize);
-    size_t chunkSize       = UnsignedCeilDivide(static_cast<unsigned int>(compressedData.size()),
-                                          static_cast<unsigned int>(numChunks));
-
     for (size_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
     {
-        if (chunkIndex == numChunks - 1)
+        const size_t chunkOffset = chunkIndex * kPipelineCacheChunkSize;
+        const size_t chunkSize = std::min(kPipelineCacheChunkSize, cacheData.size() - chunkOffset);
+        const uint8_t *chunkData = cacheData.data() + chunkOffset;
+
+        // The last chunk is where the cache usually grows, and its size may not be a multiple of 4
+        // as needed by ComputeGenericHash, so it's always stored.
+        if (chunkIndex < numChunks - 1)
+        {
+            const size_t chunkHash = angle::ComputeGenericHash(chunkData, chunkSize);
+            if (!storeAllChunks && chunkHash == (*chunkHashes)[chunkIndex])
+            {
+                continue;
+            }
+            (*chunkHashes)[chunkIndex] = chunkHash;
+        }
+
+        // To make it possible to store more pipeline cache data, compress each chunk.
+        angle::MemoryBuffer compressedData;
+        if (!egl::CompressBlobCacheData(displayVk->getBlobCache()->getCodec(), chunkSize,
+                                        chunkData, &compressedData) ||
+            compressedData.size() > kMaxBlobCacheSize - kBlobHeaderSize)
         {
-            chunkSize = compressedData.size() - compressedOffset;
+            // Make sure every chunk is stored the next time.
+            chunkHashes->clear();
+            return false;
         }
 
         angle::MemoryBuffer keyData;
-        if (!keyData.resize(kBlobHeaderSize + chunkSize))
+        if (!keyData.resize(kBlobHeaderSize + compressedData.size()))
         {
+            chunkHashes->clear();
             return false;
         }
 
-        ASSERT(numChunks <= UINT8_MAX);
         keyData.data()[0] = static_cast<uint8_t>(numChunks);
-        memcpy(keyData.data() + kBlobHeaderSize, compressedData.data() + compressedOffset,
-               chunkSize);
-        compressedOffset += chunkSize;
+        memcpy(keyData.data() + kBlobHeaderSize, compressedData.data(), compressedData.size());
 
         // Create unique hash key.
         egl::BlobCache::Key chunkCacheHash;
@@ -573,32 +598,32 @@ bool CompressAndStorePipelineCacheVk(VkPhysicalDeviceProperties physicalDevicePr
 class CompressAndStorePipelineCacheTask : public angle::Closure
 {
   public:
-    CompressAndStorePipelineCacheTask(DisplayVk *displayVk,
-                                      ContextVk *contextVk,
+    CompressAndStorePipelineCacheTask(VkPhysicalDeviceProperties physicalDeviceProperties,
+                                      DisplayVk *displayVk,
                                       std::vector<uint8_t> &&cacheData,
-                                      size_t kMaxTotalSize)
-        : mDisplayVk(displayVk),
-          mContextVk(contextVk),
+                                      std::vector<size_t> *chunkHashes)
+        : mPhysicalDeviceProperties(physicalDeviceProperties),
+          mDisplayVk(displayVk),
           mCacheData(std::move(cacheData)),
-          mMaxTotalSize(kMaxTotalSize),
+          mChunkHashes(chunkHashes),
           mResult(true)
     {}
 
     void operator()() override
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "CompressAndStorePipelineCacheVk");
-        mResult = CompressAndStorePipelineCacheVk(
-            mContextVk->getRenderer()->getPhysicalDeviceProperties(), mDisplayVk, mContextVk,
-            mCacheData, mMaxTotalSize);
+        mResult = CompressAndStorePipelineCacheVk(mPhysicalDeviceProperties, mDisplayVk,
+                                                  mCacheData, mChunkHashes);
     }
 
     bool getResult() { return mResult; }
 
   private:
+    VkPhysicalDeviceProperties mPhysicalDeviceProperties;
     DisplayVk *mDisplayVk;
-    ContextVk *mContextVk;
     std::vector<uint8_t> mCacheData;
-    size_t mMaxTotalSize;
+    // Owned by the RendererVk, which doesn't access it until the task is finished.
+    std::vector<size_t> *mChunkHashes;
     bool mResult;
 };
 
@@ -625,11 +650,9 @@ angle::Result GetAndDecompressPipelineCacheVk(VkPhysicalDeviceProperties physica
     egl::BlobCache::Key chunkCacheHash;
     ComputePipelineCacheVkChunkKey(physicalDeviceProperties, 0, &chunkCacheHash);
     egl::BlobCache::Value keyData;
-    size_t keySize                   = 0;
-    constexpr size_t kBlobHeaderSize = sizeof(uint8_t);
+    size_t keySize = 0;
 
-    if (!displayVk->getBlobCache()->get(displayVk->getScratchBuffer(), chunkCacheHash, &keyData,
-                                        &keySize) ||
+    if (!displayVk->getBlobCache()->get(chunkCacheHash, &keyData, &keySize) ||
         keyData.size() < kBlobHeaderSize)
     {
         // Nothing in the cache.
@@ -637,23 +660,17 @@ angle::Result GetAndDecompressPipelineCacheVk(VkPhysicalDeviceProperties physica
     }
 
     // Get the number of chunks.
-    size_t numChunks      = keyData.data()[0];
-    size_t chunkSize      = keySize - kBlobHeaderSize;
-    size_t compressedSize = 0;
+    size_t numChunks        = keyData.data()[0];
+    size_t uncompressedSize = 0;
 
-    // Allocate enough memory.
-    angle::MemoryBuffer compressedData;
-    ANGLE_VK_CHECK(displayVk, compressedData.resize(chunkSize * numChunks),
-                   VK_ERROR_INITIALIZATION_FAILED);
-
-    // To combine the parts of the pipelineCache data.
+    // Each chunk is decompressed separately, then they are combined.
+    std::vector<angle::MemoryBuffer> chunks(numChunks);
     for (size_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
     {
         // Get the unique key by chunkIndex.
         ComputePipelineCacheVkChunkKey(physicalDeviceProperties, chunkIndex, &chunkCacheHash);
 
-        if (!displayVk->getBlobCache()->get(displayVk->getScratchBuffer(), chunkCacheHash, &keyData,
-                                            &keySize) ||
+        if (!displayVk->getBlobCache()->get(chunkCacheHash, &keyData, &keySize) ||
             keyData.size() < kBlobHeaderSize)
         {
             // Can't find every part of the cache data.
@@ -662,25 +679,30 @@ angle::Result GetAndDecompressPipelineCacheVk(VkPhysicalDeviceProperties physica
         }
 
         size_t checkNumber = keyData.data()[0];
-        chunkSize          = keySize - kBlobHeaderSize;
-
-        if (checkNumber != numChunks || compressedData.size() < (compressedSize + chunkSize))
+        if (checkNumber != numChunks)
         {
-            // Validate the number value and enough space to store.
+            // Validate the number value.
             WARN() << "Pipeline cache chunk header corrupted: checkNumber = " << checkNumber
-                   << ", numChunks = " << numChunks
-                   << ", compressedData.size() = " << compressedData.size()
-                   << ", (compressedSize + chunkSize) = " << (compressedSize + chunkSize);
+                   << ", numChunks = " << numChunks;
             return angle::Result::Continue;
         }
-        memcpy(compressedData.data() + compressedSize, keyData.data() + kBlobHeaderSize, chunkSize);
-        compressedSize += chunkSize;
+
+        ANGLE_VK_CHECK(displayVk,
+                       egl::DecompressBlobCacheData(keyData.data() + kBlobHeaderSize,
+                                                    keySize - kBlobHeaderSize, &chunks[chunkIndex]),
+                       VK_ERROR_INITIALIZATION_FAILED);
+        uncompressedSize += chunks[chunkIndex].size();
     }
 
-    ANGLE_VK_CHECK(
-        displayVk,
-        egl::DecompressBlobCacheData(compressedData.data(), compressedSize, uncompressedData),
-        VK_ERROR_INITIALIZATION_FAILED);
+    ANGLE_VK_CHECK(displayVk, uncompressedData->resize(uncompressedSize),
+                   VK_ERROR_INITIALIZATION_FAILED);
+
+    size_t uncompressedOffset = 0;
+    for (const angle::MemoryBuffer &chunk : chunks)
+    {
+        memcpy(uncompressedData->data() + uncompressedOffset, chunk.data(), chunk.size());
+        uncompressedOffset += chunk.size();
+    }
 
     *success = true;
     return angle::Result::Continue;
@@ -689,6 +711,52 @@ angle::Result GetAndDecompressPipelineCacheVk(VkPhysicalDeviceProperties physica
 // Environment variable (and associated Android property) to enable Vulkan debug-utils markers
 constexpr char kEnableDebugMarkersVarName[]      = "ANGLE_ENABLE_DEBUG_MARKERS";
 constexpr char kEnableDebugMarkersPropertyName[] = "debug.angle.markers";
+
+// Maximum number of live VkPipelines in each graphics pipeline cache.  0 means no limit.
+constexpr char kGraphicsPipelineCacheLimitVarName[]      = "ANGLE_VK_GRAPHICS_PIPELINE_CACHE_LIMIT";
+constexpr char kGraphicsPipelineCacheLimitPropertyName[] = "debug.angle.vk.pipeline_cache_limit";
+
+// Maximum number of frames the CPU may submit ahead of the GPU before eglSwapBuffers waits.  0
+// means the default of the window surface.
+constexpr char kMaxFramesInFlightVarName[]      = "ANGLE_VK_MAX_FRAMES_IN_FLIGHT";
+constexpr char kMaxFramesInFlightPropertyName[] = "debug.angle.vk.max_frames_in_flight";
+
+// Finds a queue family that only supports transfers (and possibly sparse binding), and whose image
+// copies are not restricted to a coarser granularity than a texel.  Returns
+// std::numeric_limits<uint32_t>::max() if there is none.
+uint32_t FindTransferOnlyQueueFamily(const std::vector<VkQueueFamilyProperties> &queueFamilies)
+{
+    constexpr VkQueueFlags kGraphicsAndCompute = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT;
+    for (uint32_t familyIndex = 0; familyIndex < queueFamilies.size(); ++familyIndex)
+    {
+        const VkQueueFamilyProperties &queueInfo = queueFamilies[familyIndex];
+        const VkExtent3D &granularity            = queueInfo.minImageTransferGranularity;
+        if ((queueInfo.queueFlags & VK_QUEUE_TRANSFER_BIT) != 0 &&
+            (queueInfo.queueFlags & kGraphicsAndCompute) == 0 && queueInfo.queueCount > 0 &&
+            granularity.width == 1 && granularity.height == 1 && granularity.depth == 1)
+        {
+            return familyIndex;
+        }
+    }
+    return std::numeric_limits<uint32_t>::max();
+}
+
+// Sparse memory is bound on the queue that the contexts submit to, which is picked among the
+// graphics and compute queue families after the features are initialized.
+bool GraphicsQueueFamiliesSupportSparseBinding(
+    const std::vector<VkQueueFamilyProperties> &queueFamilies)
+{
+    constexpr VkQueueFlags kGraphicsAndCompute = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT;
+    for (const VkQueueFamilyProperties &queueInfo : queueFamilies)
+    {
+        if ((queueInfo.queueFlags & kGraphicsAndCompute) == kGraphicsAndCompute &&
+            (queueInfo.queueFlags & VK_QUEUE_SPARSE_BINDING_BIT) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
 }  // namespace
 
 // RendererVk implementation.
@@ -704,12 +772,21 @@ RendererVk::RendererVk()
       mDebugReportCallback(VK_NULL_HANDLE),
       mPhysicalDevice(VK_NULL_HANDLE),
       mCurrentQueueFamilyIndex(std::numeric_limits<uint32_t>::max()),
+      mTransferQueueFamilyIndex(std::numeric_limits<uint32_t>::max()),
+      mTransferQueue(VK_NULL_HANDLE),
       mMaxVertexAttribDivisor(1),
       mMaxVertexAttribStride(0),
       mMinImportedHostPointerAlignment(1),
       mDefaultUniformBufferSize(kPreferredDefaultUniformBufferSize),
+      mGraphicsPipelineCacheLimit(0),
+      mMaxFramesInFlight(0),
       mDevice(VK_NULL_HANDLE),
       mDeviceLost(false),
+      mSharedGarbageObjectCount(0),
+      mGarbageCleanupThreadExit(false),
+      mMemoryBudgetFrameIndex(0),
+      mMemoryBudget(0),
+      mMemoryUsage(0),
       mPipelineCacheVkUpdateTimeout(kPipelineCacheVkUpdatePeriod),
       mPipelineCacheDirty(false),
       mPipelineCacheInitialized(false),
@@ -731,6 +808,8 @@ RendererVk::~RendererVk()
     mAllocator.release();
     mPipelineCache.release();
     ASSERT(!hasSharedGarbage());
+    ASSERT(!mGarbageCleanupThread.joinable());
+    ASSERT(!mGlslangInitThread.joinable());
 }
 
 bool RendererVk::hasSharedGarbage()
@@ -739,6 +818,12 @@ bool RendererVk::hasSharedGarbage()
     return !mSharedGarbage.empty();
 }
 
+size_t RendererVk::getSharedGarbageObjectCount()
+{
+    std::lock_guard<std::mutex> lock(mGarbageMutex);
+    return mSharedGarbageObjectCount;
+}
+
 void RendererVk::releaseSharedResources(vk::ResourceUseList *resourceList)
 {
     // resource list may access same resources referenced by garbage collection so need to protect
@@ -749,6 +834,16 @@ void RendererVk::releaseSharedResources(vk::ResourceUseList *resourceList)
 
 void RendererVk::onDestroy(vk::Context *context)
 {
+    if (mGarbageCleanupThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mGarbageMutex);
+            mGarbageCleanupThreadExit = true;
+        }
+        mGarbageCleanupCondition.notify_one();
+        mGarbageCleanupThread.join();
+    }
+
     {
         std::lock_guard<std::mutex> lock(mCommandQueueMutex);
         if (mFeatures.asyncCommandQueue.enabled)
@@ -772,9 +867,28 @@ void RendererVk::onDestroy(vk::Context *context)
 
     mOneOffCommandPool.destroy(mDevice);
 
+    if (mTransferQueue != VK_NULL_HANDLE)
+    {
+        vkQueueWaitIdle(mTransferQueue);
+    }
+    for (PendingTransferCommands &pending : mPendingTransferCommands)
+    {
+        pending.commandBuffer.releaseHandle();
+        pending.fence.destroy(mDevice);
+    }
+    mPendingTransferCommands.clear();
+    mTransferCommandPool.destroy(mDevice);
+
+    // All pipeline creation tasks are waited on by the contexts and programs that posted them,
+    // and command buffer recording tasks by the command queue.
+    mWorkerThreadPool.reset();
+
     mPipelineCache.destroy(mDevice);
     mSamplerCache.destroy(this);
     mYuvConversionCache.destroy(this);
+    mShaderLibrary.destroy(mDevice);
+    mSharedBufferPool.destroy(this);
+    mSurfaceImagePool.destroy(this);
 
     for (vk::CommandBufferHelper *commandBufferHelper : mCommandBufferHelperFreeList)
     {
@@ -784,12 +898,20 @@ void RendererVk::onDestroy(vk::Context *context)
 
     mAllocator.destroy();
 
-    sh::FinalizeGlslang();
+    ensureGlslangInitialized();
+    {
+        std::lock_guard<std::mutex> lock(gGlslangMutex);
+        sh::FinalizeGlslang();
+    }
 
     if (mDevice)
     {
         vkDestroyDevice(mDevice, nullptr);
         mDevice = VK_NULL_HANDLE;
+#if defined(ANGLE_SHARED_LIBVULKAN)
+        std::lock_guard<std::mutex> lock(gVolkMutex);
+        gVolkDeviceCount.fetch_sub(1, std::memory_order_relaxed);
+#endif  // defined(ANGLE_SHARED_LIBVULKAN)
     }
 
     if (mDebugUtilsMessenger)
@@ -1029,8 +1151,11 @@ angle::Result RendererVk::initialize(DisplayVk *displayVk,
 
     ANGLE_VK_TRY(displayVk, vkCreateInstance(&instanceInfo, nullptr, &mInstance));
 #if defined(ANGLE_SHARED_LIBVULKAN)
-    // Load volk if we are linking dynamically
-    volkLoadInstance(mInstance);
+    {
+        // Load volk if we are linking dynamically
+        std::lock_guard<std::mutex> lock(gVolkMutex);
+        volkLoadInstance(mInstance);
+    }
 #endif  // defined(ANGLE_SHARED_LIBVULKAN)
 
     if (mEnableDebugUtils)
@@ -1093,12 +1218,32 @@ angle::Result RendererVk::initialize(DisplayVk *displayVk,
     ANGLE_VK_TRY(displayVk, vkEnumeratePhysicalDevices(mInstance, &physicalDeviceCount, nullptr));
     ANGLE_VK_CHECK(displayVk, physicalDeviceCount > 0, VK_ERROR_INITIALIZATION_FAILED);
 
-    // TODO(jmadill): Handle multiple physical devices. For now, use the first device.
+    // EGL_ANGLE_platform_angle_device_id selects the device; the displays that select different
+    // ones each have a renderer of their own.
+    const uint32_t preferredVendorID =
+        static_cast<uint32_t>(attribs.get(EGL_PLATFORM_ANGLE_DEVICE_ID_HIGH_ANGLE, 0));
+    const uint32_t preferredDeviceID =
+        static_cast<uint32_t>(attribs.get(EGL_PLATFORM_ANGLE_DEVICE_ID_LOW_ANGLE, 0));
+    const uint32_t preferredDeviceIndex =
+        static_cast<uint32_t>(attribs.get(EGL_PLATFORM_ANGLE_DEVICE_INDEX_ANGLE, 0));
+
     std::vector<VkPhysicalDevice> physicalDevices(physicalDeviceCount);
     ANGLE_VK_TRY(displayVk, vkEnumeratePhysicalDevices(mInstance, &physicalDeviceCount,
                                                        physicalDevices.data()));
-    ChoosePhysicalDevice(physicalDevices, mEnabledICD, &mPhysicalDevice,
-                         &mPhysicalDeviceProperties);
+    if (preferredVendorID != 0 || preferredDeviceID != 0 || preferredDeviceIndex != 0)
+    {
+        // Silently rendering on another GPU than the one selected would defeat the selection.
+        ANGLE_VK_CHECK(displayVk,
+                       SelectPhysicalDevice(physicalDevices, preferredVendorID, preferredDeviceID,
+                                            preferredDeviceIndex, &mPhysicalDevice,
+                                            &mPhysicalDeviceProperties),
+                       VK_ERROR_INITIALIZATION_FAILED);
+    }
+    else
+    {
+        ChoosePhysicalDevice(physicalDevices, mEnabledICD, &mPhysicalDevice,
+                             &mPhysicalDeviceProperties);
+    }
 
     mGarbageCollectionFlushThreshold =
         static_cast<uint32_t>(mPhysicalDeviceProperties.limits.maxMemoryAllocationCount *
@@ -1155,15 +1300,19 @@ angle::Result RendererVk::initialize(DisplayVk *displayVk,
     // Create VMA allocator
     ANGLE_VK_TRY(displayVk,
                  mAllocator.init(mPhysicalDevice, mDevice, mInstance, applicationInfo.apiVersion,
-                                 preferredLargeHeapBlockSize));
+                                 preferredLargeHeapBlockSize,
+                                 mFeatures.supportsMemoryBudget.enabled));
 
     // Store the physical device memory properties so we can find the right memory pools.
     mMemoryProperties.init(mPhysicalDevice);
 
-    {
+    // Warm glslang up in parallel with the rest of initialization and whatever the application
+    // does before it compiles its first shader.
+    mGlslangInitThread = std::thread([]() {
         ANGLE_TRACE_EVENT0("gpu.angle,startup", "GlslangWarmup");
+        std::lock_guard<std::mutex> lock(gGlslangMutex);
         sh::InitializeGlslang();
-    }
+    });
 
     // Initialize the format table.
     mFormatTable.initialize(this, &mNativeTextureCaps, &mNativeCaps.compressedTextureFormats);
@@ -1199,6 +1348,18 @@ void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &devic
     mIndexTypeUint8Features       = {};
     mIndexTypeUint8Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT;
 
+    mExtendedDynamicStateFeatures = {};
+    mExtendedDynamicStateFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+
+    mTimelineSemaphoreFeatures = {};
+    mTimelineSemaphoreFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+
+    mSynchronization2Features = {};
+    mSynchronization2Features.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+
     mSubgroupProperties       = {};
     mSubgroupProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
 
@@ -1278,6 +1439,24 @@ void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &devic
         vk::AddToPNextChain(&deviceFeatures, &mIndexTypeUint8Features);
     }
 
+    // Query extended dynamic state features
+    if (ExtensionFound(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(&deviceFeatures, &mExtendedDynamicStateFeatures);
+    }
+
+    // Query timeline semaphore features
+    if (ExtensionFound(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(&deviceFeatures, &mTimelineSemaphoreFeatures);
+    }
+
+    // Query synchronization2 features
+    if (ExtensionFound(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(&deviceFeatures, &mSynchronization2Features);
+    }
+
     // Query memory report features
     if (ExtensionFound(VK_EXT_DEVICE_MEMORY_REPORT_EXTENSION_NAME, deviceExtensionNames))
     {
@@ -1357,6 +1536,9 @@ void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &devic
     mVertexAttributeDivisorProperties.pNext          = nullptr;
     mTransformFeedbackFeatures.pNext                 = nullptr;
     mIndexTypeUint8Features.pNext                    = nullptr;
+    mExtendedDynamicStateFeatures.pNext              = nullptr;
+    mTimelineSemaphoreFeatures.pNext                 = nullptr;
+    mSynchronization2Features.pNext                  = nullptr;
     mSubgroupProperties.pNext                        = nullptr;
     mExternalMemoryHostProperties.pNext              = nullptr;
     mShaderFloat16Int8Features.pNext                 = nullptr;
@@ -1461,12 +1643,45 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     queueCreateInfo.queueCount              = queueCount;
     queueCreateInfo.pQueuePriorities        = queuePriorities;
 
+    std::array<VkDeviceQueueCreateInfo, 2> queueCreateInfos = {queueCreateInfo, {}};
+    uint32_t queueCreateInfoCount                            = 1;
+
     // Query extensions and their features.
     queryDeviceExtensionFeatures(deviceExtensionNames);
 
     // Initialize features and workarounds.
     initFeatures(displayVk, deviceExtensionNames);
 
+    if (mFeatures.asyncGraphicsPipelineCreation.enabled ||
+        mFeatures.parallelCommandBufferRecording.enabled ||
+        mFeatures.preCreateRecordedGraphicsPipelines.enabled ||
+        mFeatures.parallelCompressedTextureDecode.enabled)
+    {
+        mWorkerThreadPool = angle::WorkerThreadPool::Create(true);
+    }
+
+    if (mFeatures.asyncGarbageCleanup.enabled)
+    {
+        mGarbageCleanupThread = std::thread(&RendererVk::garbageCleanupThreadLoop, this);
+    }
+
+    // Create a queue in a transfer-only family, if any, for transferQueueUploads.
+    if (mFeatures.transferQueueUploads.enabled)
+    {
+        mTransferQueueFamilyIndex = FindTransferOnlyQueueFamily(mQueueFamilyProperties);
+        if (mTransferQueueFamilyIndex != std::numeric_limits<uint32_t>::max())
+        {
+            VkDeviceQueueCreateInfo &transferQueueCreateInfo = queueCreateInfos[1];
+
+            transferQueueCreateInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            transferQueueCreateInfo.flags            = 0;
+            transferQueueCreateInfo.queueFamilyIndex = mTransferQueueFamilyIndex;
+            transferQueueCreateInfo.queueCount       = 1;
+            transferQueueCreateInfo.pQueuePriorities = &queuePriorities[kQueueIndexMedium];
+            queueCreateInfoCount                     = 2;
+        }
+    }
+
     // Enable VK_EXT_depth_clip_enable, if supported
     if (ExtensionFound(VK_EXT_DEPTH_CLIP_ENABLE_EXTENSION_NAME, deviceExtensionNames))
     {
@@ -1659,6 +1874,13 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     enabledFeatures.features.tessellationShader = mPhysicalDeviceFeatures.tessellationShader;
     // Used to support EXT_blend_func_extended
     enabledFeatures.features.dualSrcBlend = mPhysicalDeviceFeatures.dualSrcBlend;
+    // Used to issue multi-draw calls as a single indirect draw
+    enabledFeatures.features.multiDrawIndirect = getFeatures().supportsMultiDrawIndirect.enabled;
+    enabledFeatures.features.drawIndirectFirstInstance =
+        getFeatures().supportsMultiDrawIndirect.enabled;
+    // Used to support EXT_sparse_texture
+    enabledFeatures.features.sparseBinding = getFeatures().supportsSparseTexture.enabled;
+    enabledFeatures.features.sparseResidencyImage2D = getFeatures().supportsSparseTexture.enabled;
 
     if (!vk::CommandBuffer::ExecutesInline())
     {
@@ -1706,6 +1928,29 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         vk::AddToPNextChain(&createInfo, &mIndexTypeUint8Features);
     }
 
+    if (getFeatures().supportsExtendedDynamicState.enabled)
+    {
+        enabledDeviceExtensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+        vk::AddToPNextChain(&createInfo, &mExtendedDynamicStateFeatures);
+    }
+
+    if (getFeatures().supportsTimelineSemaphore.enabled)
+    {
+        enabledDeviceExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+        vk::AddToPNextChain(&createInfo, &mTimelineSemaphoreFeatures);
+    }
+
+    if (getFeatures().supportsSynchronization2.enabled)
+    {
+        enabledDeviceExtensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+        vk::AddToPNextChain(&createInfo, &mSynchronization2Features);
+    }
+
+    if (getFeatures().supportsPushDescriptor.enabled)
+    {
+        enabledDeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    }
+
     if (getFeatures().supportsDepthStencilResolve.enabled)
     {
         enabledDeviceExtensions.push_back(VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME);
@@ -1759,6 +2004,16 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
 #endif  // !defined(ANGLE_SHARED_LIBVULKAN)
     }
 
+    if (getFeatures().supportsDescriptorUpdateTemplate.enabled)
+    {
+        enabledDeviceExtensions.push_back(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME);
+    }
+
+    if (getFeatures().supportsMemoryBudget.enabled)
+    {
+        enabledDeviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    }
+
     if (getFeatures().supportsYUVSamplerConversion.enabled)
     {
         enabledDeviceExtensions.push_back(VK_KHR_SAMPLER_YCBCR_CONVERSION_EXTENSION_NAME);
@@ -1773,8 +2028,8 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
 
     createInfo.sType                 = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
     createInfo.flags                 = 0;
-    createInfo.queueCreateInfoCount  = 1;
-    createInfo.pQueueCreateInfos     = &queueCreateInfo;
+    createInfo.queueCreateInfoCount  = queueCreateInfoCount;
+    createInfo.pQueueCreateInfos     = queueCreateInfos.data();
     createInfo.enabledLayerCount     = static_cast<uint32_t>(enabledDeviceLayerNames.size());
     createInfo.ppEnabledLayerNames   = enabledDeviceLayerNames.data();
     createInfo.enabledExtensionCount = static_cast<uint32_t>(enabledDeviceExtensions.size());
@@ -1786,8 +2041,19 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
 
     ANGLE_VK_TRY(displayVk, vkCreateDevice(mPhysicalDevice, &createInfo, nullptr, &mDevice));
 #if defined(ANGLE_SHARED_LIBVULKAN)
-    // Load volk if we are loading dynamically
-    volkLoadDevice(mDevice);
+    {
+        // Load volk if we are loading dynamically.  volkLoadInstance replaces the functions of
+        // another device with the trampolines.
+        std::lock_guard<std::mutex> lock(gVolkMutex);
+        if (gVolkDeviceCount.fetch_add(1, std::memory_order_relaxed) == 0)
+        {
+            volkLoadDevice(mDevice);
+        }
+        else
+        {
+            volkLoadInstance(mInstance);
+        }
+    }
 #endif  // defined(ANGLE_SHARED_LIBVULKAN)
 
     mCurrentQueueFamilyIndex = queueFamilyIndex;
@@ -1828,6 +2094,17 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         ANGLE_TRY(mCommandQueue.init(displayVk, queueMap));
     }
 
+    if (hasTransferQueue())
+    {
+        vkGetDeviceQueue(mDevice, mTransferQueueFamilyIndex, 0, &mTransferQueue);
+
+        VkCommandPoolCreateInfo poolCreateInfo = {};
+        poolCreateInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolCreateInfo.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        poolCreateInfo.queueFamilyIndex        = mTransferQueueFamilyIndex;
+        ANGLE_VK_TRY(displayVk, mTransferCommandPool.init(mDevice, poolCreateInfo));
+    }
+
 #if !defined(ANGLE_SHARED_LIBVULKAN)
     if (hasGetMemoryRequirements2KHR)
     {
@@ -1841,6 +2118,26 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     {
         InitTransformFeedbackEXTFunctions(mDevice);
     }
+    if (getFeatures().supportsExtendedDynamicState.enabled)
+    {
+        InitExtendedDynamicStateEXTFunctions(mDevice);
+    }
+    if (getFeatures().supportsTimelineSemaphore.enabled)
+    {
+        InitTimelineSemaphoreKHRFunctions(mDevice);
+    }
+    if (getFeatures().supportsSynchronization2.enabled)
+    {
+        InitSynchronization2KHRFunctions(mDevice);
+    }
+    if (getFeatures().supportsPushDescriptor.enabled)
+    {
+        InitPushDescriptorKHRFunctions(mDevice);
+    }
+    if (getFeatures().supportsDescriptorUpdateTemplate.enabled)
+    {
+        InitDescriptorUpdateTemplateKHRFunctions(mDevice);
+    }
     if (getFeatures().supportsYUVSamplerConversion.enabled)
     {
         InitSamplerYcbcrKHRFunctions(mDevice);
@@ -1859,11 +2156,31 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     mDefaultUniformBufferSize = std::min(
         mDefaultUniformBufferSize, getPhysicalDeviceProperties().limits.maxUniformBufferRange);
 
-    // Initialize the vulkan pipeline cache.
-    bool success = false;
+    std::string graphicsPipelineCacheLimit = angle::GetEnvironmentVarOrAndroidProperty(
+        kGraphicsPipelineCacheLimitVarName, kGraphicsPipelineCacheLimitPropertyName);
+    if (!graphicsPipelineCacheLimit.empty())
+    {
+        mGraphicsPipelineCacheLimit =
+            static_cast<uint32_t>(std::strtoul(graphicsPipelineCacheLimit.c_str(), nullptr, 10));
+    }
+
+    std::string maxFramesInFlight = angle::GetEnvironmentVarOrAndroidProperty(
+        kMaxFramesInFlightVarName, kMaxFramesInFlightPropertyName);
+    if (!maxFramesInFlight.empty())
+    {
+        mMaxFramesInFlight =
+            static_cast<uint32_t>(std::strtoul(maxFramesInFlight.c_str(), nullptr, 10));
+    }
+
+    // Create an empty pipeline cache.  The blob cache is only looked up when the pipeline cache is
+    // first used, see getPipelineCache(), since the application may not have set its blob cache
+    // callbacks yet, and applications that only query EGL never need it.
     {
         std::lock_guard<std::mutex> lock(mPipelineCacheMutex);
-        ANGLE_TRY(initPipelineCache(displayVk, &mPipelineCache, &success));
+
+        VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
+        pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        ANGLE_VK_TRY(displayVk, mPipelineCache.init(mDevice, pipelineCacheCreateInfo));
     }
 
     // Track the set of supported pipeline stages.  This is used when issuing image layout
@@ -2173,6 +2490,7 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     ANGLE_FEATURE_CONDITION(&mFeatures, extraCopyBufferRegion, IsWindows() && isIntel);
 
     ANGLE_FEATURE_CONDITION(&mFeatures, forceCPUPathForCubeMapCopy, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, forceCPUPathForGenerateMipmap, false);
 
     // Work around incorrect NVIDIA point size range clamping.
     // http://anglebug.com/2970#c10
@@ -2292,6 +2610,36 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsIndexTypeUint8,
                             mIndexTypeUint8Features.indexTypeUint8 == VK_TRUE);
 
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsExtendedDynamicState,
+                            mExtendedDynamicStateFeatures.extendedDynamicState == VK_TRUE);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsTimelineSemaphore,
+                            mTimelineSemaphoreFeatures.timelineSemaphore == VK_TRUE);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsSynchronization2,
+                            mSynchronization2Features.synchronization2 == VK_TRUE);
+
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsPushDescriptor,
+        ExtensionFound(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, deviceExtensionNames));
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsMultiDrawIndirect,
+                            mPhysicalDeviceFeatures.multiDrawIndirect == VK_TRUE &&
+                                mPhysicalDeviceFeatures.drawIndirectFirstInstance == VK_TRUE);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsSparseTexture,
+                            mPhysicalDeviceFeatures.sparseBinding == VK_TRUE &&
+                                mPhysicalDeviceFeatures.sparseResidencyImage2D == VK_TRUE &&
+                                GraphicsQueueFamiliesSupportSparseBinding(mQueueFamilyProperties));
+
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsDescriptorUpdateTemplate,
+        ExtensionFound(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME, deviceExtensionNames));
+
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsMemoryBudget,
+        ExtensionFound(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, deviceExtensionNames));
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsDepthStencilResolve,
                             mFeatures.supportsRenderpass2.enabled &&
                                 mDepthStencilResolveProperties.supportedDepthResolveModes != 0);
@@ -2367,6 +2715,19 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
                             isQualcomm && mPhysicalDeviceProperties.driverVersion <
                                               kPixel4DriverWithWorkingSpecConstSupport);
 
+    // The programs' driver uniforms descriptor set is left empty and unbound with push constants,
+    // which bindEmptyForUnusedDescriptorSets can't account for.
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, usePushConstantsForDriverUniforms,
+        mPhysicalDeviceProperties.limits.maxPushConstantsSize >= kMaxDriverUniformsSize &&
+            !mFeatures.bindEmptyForUnusedDescriptorSets.enabled);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, lazilyAllocateDiscardedDepthStencil, isARM);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, reuseStreamedClientVertexData, true);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, poolOffscreenSurfaceImages, true);
+
     // The compute shader used to generate mipmaps uses a 256-wide workgroup.  This path is only
     // enabled on devices that meet this minimum requirement.  Furthermore,
     // VK_IMAGE_USAGE_STORAGE_BIT is detrimental to performance on many platforms, on which this
@@ -2428,6 +2789,7 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     ANGLE_FEATURE_CONDITION(&mFeatures, forceNearestMipFiltering, false);
 
     ANGLE_FEATURE_CONDITION(&mFeatures, compressVertexData, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, transcodeEtcToBc, false);
 
     ANGLE_FEATURE_CONDITION(
         &mFeatures, preferDrawClearOverVkCmdClearAttachments,
@@ -2453,12 +2815,34 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     // improves 7%.
     ANGLE_FEATURE_CONDITION(&mFeatures, preferSubmitAtFBOBoundary, isARM);
 
+    // Disabled by default until the benefit is measured on more devices.
+    ANGLE_FEATURE_CONDITION(&mFeatures, asyncGraphicsPipelineCreation, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, parallelCommandBufferRecording, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, preCreateRecordedGraphicsPipelines, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, shareDynamicBufferAllocations, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, parallelCompressedTextureDecode, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, expandTextureChannelsOnGpu, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, transferQueueUploads, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, resumeRenderPassOnFramebufferRebind, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, acquireSwapchainImageAfterPresent, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, asyncGarbageCleanup, false);
+
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
     platform->overrideFeaturesVk(platform, &mFeatures);
 
     ApplyFeatureOverrides(&mFeatures, displayVk->getState());
 }
 
+void RendererVk::ensureGlslangInitialized()
+{
+    std::lock_guard<std::mutex> lock(mGlslangInitMutex);
+    if (mGlslangInitThread.joinable())
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::ensureGlslangInitialized");
+        mGlslangInitThread.join();
+    }
+}
+
 angle::Result RendererVk::initPipelineCache(DisplayVk *display,
                                             vk::PipelineCache *pipelineCache,
                                             bool *success)
@@ -2492,7 +2876,7 @@ angle::Result RendererVk::getPipelineCache(vk::PipelineCache **pipelineCache)
         return angle::Result::Continue;
     }
 
-    // We should now recreate the pipeline cache with the blob cache pipeline data.
+    // Load the blob cache pipeline data into the pipeline cache that was created empty.
     vk::PipelineCache pCache;
     bool success = false;
     ANGLE_TRY(initPipelineCache(vk::GetImpl(mDisplay), &pCache, &success));
@@ -2616,29 +3000,43 @@ angle::Result RendererVk::syncPipelineCacheVk(DisplayVk *displayVk, const gl::Co
                pipelineCacheData.size() - pipelineCacheSize);
     }
 
-    if (context->getFrontendFeatures().enableCompressingPipelineCacheInThreadPool.enabled)
+    // Though the pipeline cache will be compressed and divided into several chunks to store in blob
+    // cache, the largest total size of blob cache is only 2M in android now, so there is no use to
+    // handle big pipeline cache when android will reject it finally.
+    //
+    // The function zlib_internal::GzipCompressHelper() can compress 10M pipeline cache data into
+    // about 2M.  If enableCompressingPipelineCacheInThreadPool is disabled, the compression is
+    // done on this thread, so to avoid the risk of a long stall, the limit is 64k instead.
+    const bool compressInThreadPool =
+        context->getFrontendFeatures().enableCompressingPipelineCacheInThreadPool.enabled;
+    const size_t maxTotalSize = compressInThreadPool ? 10 * 1024 * 1024 : 64 * 1024;
+    if (pipelineCacheData.size() >= maxTotalSize)
     {
-        // The function zlib_internal::GzipCompressHelper() can compress 10M pipeline cache data
-        // into about 2M, to save the time of compression, set kMaxTotalSize to 10M.
-        constexpr size_t kMaxTotalSize = 10 * 1024 * 1024;
+        // TODO: handle the big pipeline cache. http://anglebug.com/4722
+        ANGLE_PERF_WARNING(contextVk->getDebug(), GL_DEBUG_SEVERITY_LOW,
+                           "Skip syncing pipeline cache data when it's larger than maxTotalSize.");
+        return angle::Result::Continue;
+    }
 
-        // Create task to compress.
+    if (compressInThreadPool)
+    {
+        // Create task to compress.  Only the chunks that changed since the last sync are
+        // compressed and stored.
         auto compressAndStorePipelineCacheTask =
             std::make_shared<CompressAndStorePipelineCacheTask>(
-                displayVk, contextVk, std::move(pipelineCacheData), kMaxTotalSize);
+                mPhysicalDeviceProperties, displayVk, std::move(pipelineCacheData),
+                &mPipelineCacheChunkHashes);
         mCompressEvent = std::make_shared<WaitableCompressEventImpl>(
             angle::WorkerThreadPool::PostWorkerTask(context->getWorkerThreadPool(),
-                                                    compressAndStorePipelineCacheTask),
+                                                    compressAndStorePipelineCacheTask,
+                                                    angle::WorkerTaskPriority::Low),
             compressAndStorePipelineCacheTask);
         mPipelineCacheDirty = false;
     }
     else
     {
-        // If enableCompressingPipelineCacheInThreadPool is diabled, to avoid the risk, set
-        // kMaxTotalSize to 64k.
-        constexpr size_t kMaxTotalSize = 64 * 1024;
-        bool compressResult            = CompressAndStorePipelineCacheVk(
-            mPhysicalDeviceProperties, displayVk, contextVk, pipelineCacheData, kMaxTotalSize);
+        bool compressResult = CompressAndStorePipelineCacheVk(
+            mPhysicalDeviceProperties, displayVk, pipelineCacheData, &mPipelineCacheChunkHashes);
 
         if (compressResult)
         {
@@ -2699,6 +3097,46 @@ void RendererVk::outputVmaStatString()
     mAllocator.freeStatsString(statsString);
 }
 
+void RendererVk::updateMemoryBudget()
+{
+    mAllocator.setCurrentFrameIndex(++mMemoryBudgetFrameIndex);
+
+    VkDeviceSize heapBudgets[VK_MAX_MEMORY_HEAPS];
+    VkDeviceSize heapUsages[VK_MAX_MEMORY_HEAPS];
+    mAllocator.getHeapBudgets(heapBudgets, heapUsages);
+
+    VkDeviceSize budget = 0;
+    VkDeviceSize usage  = 0;
+    for (uint32_t heapIndex = 0; heapIndex < mMemoryProperties.getMemoryHeapCount(); ++heapIndex)
+    {
+        if (mMemoryProperties.isDeviceLocalHeap(heapIndex))
+        {
+            budget += heapBudgets[heapIndex];
+            usage += heapUsages[heapIndex];
+        }
+    }
+
+    mMemoryBudget = budget;
+    mMemoryUsage  = usage;
+}
+
+bool RendererVk::isNearMemoryBudget() const
+{
+    const VkDeviceSize budget = mMemoryBudget;
+    return mFeatures.supportsMemoryBudget.enabled && budget > 0 &&
+           static_cast<double>(mMemoryUsage) >
+               static_cast<double>(budget) * kMemoryBudgetTrimThreshold;
+}
+
+void RendererVk::trimMemory()
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::trimMemory");
+
+    mSharedBufferPool.releaseBuffers(this);
+    mSurfaceImagePool.releaseImages(this);
+    cleanupCompletedCommandsGarbage();
+}
+
 angle::Result RendererVk::queueSubmitOneOff(vk::Context *context,
                                             vk::PrimaryCommandBuffer &&primary,
                                             egl::ContextPriority priority,
@@ -2797,12 +3235,24 @@ angle::Result RendererVk::cleanupGarbage(Serial lastCompletedQueueSerial)
 {
     std::lock_guard<std::mutex> lock(mGarbageMutex);
 
+    if (mGarbageCleanupThread.joinable())
+    {
+        if (lastCompletedQueueSerial > mGarbageCleanupSerial)
+        {
+            mGarbageCleanupSerial = lastCompletedQueueSerial;
+            mGarbageCleanupCondition.notify_one();
+        }
+        return angle::Result::Continue;
+    }
+
     for (auto garbageIter = mSharedGarbage.begin(); garbageIter != mSharedGarbage.end();)
     {
         // Possibly 'counter' should be always zero when we add the object to garbage.
         vk::SharedGarbage &garbage = *garbageIter;
+        const size_t objectCount   = garbage.getObjectCount();
         if (garbage.destroyIfComplete(this, lastCompletedQueueSerial))
         {
+            mSharedGarbageObjectCount -= objectCount;
             garbageIter = mSharedGarbage.erase(garbageIter);
         }
         else
@@ -2814,6 +3264,60 @@ angle::Result RendererVk::cleanupGarbage(Serial lastCompletedQueueSerial)
     return angle::Result::Continue;
 }
 
+void RendererVk::garbageCleanupThreadLoop()
+{
+    std::vector<vk::GarbageObject> completedGarbage;
+    Serial cleanedSerial;
+
+    std::unique_lock<std::mutex> lock(mGarbageMutex);
+    while (true)
+    {
+        mGarbageCleanupCondition.wait(lock, [this, &cleanedSerial] {
+            return mGarbageCleanupThreadExit || mGarbageCleanupSerial > cleanedSerial;
+        });
+        if (mGarbageCleanupThreadExit)
+        {
+            break;
+        }
+        cleanedSerial = mGarbageCleanupSerial;
+
+        // The resource uses are released under the lock, the objects are destroyed in one batch
+        // without it so that new garbage can be collected in the meantime.
+        for (auto garbageIter = mSharedGarbage.begin(); garbageIter != mSharedGarbage.end();)
+        {
+            if (garbageIter->releaseIfComplete(cleanedSerial, &completedGarbage))
+            {
+                garbageIter = mSharedGarbage.erase(garbageIter);
+            }
+            else
+            {
+                garbageIter++;
+            }
+        }
+
+        if (completedGarbage.empty())
+        {
+            continue;
+        }
+
+        lock.unlock();
+        destroyCompletedGarbage(&completedGarbage);
+        lock.lock();
+
+        mSharedGarbageObjectCount -= completedGarbage.size();
+        completedGarbage.clear();
+    }
+}
+
+void RendererVk::destroyCompletedGarbage(std::vector<vk::GarbageObject> *garbage)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::destroyCompletedGarbage");
+    for (vk::GarbageObject &object : *garbage)
+    {
+        object.destroy(this);
+    }
+}
+
 void RendererVk::cleanupCompletedCommandsGarbage()
 {
     (void)cleanupGarbage(getLastCompletedQueueSerial());
@@ -2887,6 +3391,18 @@ void RendererVk::setGlobalDebugAnnotator()
 void RendererVk::reloadVolkIfNeeded() const
 {
 #if defined(ANGLE_SHARED_LIBVULKAN)
+    // With several devices, the trampolines are loaded for all of them.
+    if (gVolkDeviceCount.load(std::memory_order_relaxed) > 1)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(gVolkMutex);
+    if (gVolkDeviceCount.load(std::memory_order_relaxed) > 1)
+    {
+        return;
+    }
+
     if ((mInstance != VK_NULL_HANDLE) && (volkGetLoadedInstance() != mInstance))
     {
         volkLoadInstance(mInstance);
@@ -2937,6 +3453,89 @@ angle::Result RendererVk::getCommandBufferOneOff(vk::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result RendererVk::getTransferCommandBuffer(vk::Context *context,
+                                                   vk::PrimaryCommandBuffer *commandBufferOut)
+{
+    ASSERT(hasTransferQueue());
+
+    {
+        std::lock_guard<std::mutex> lock(mTransferQueueMutex);
+
+        if (!mPendingTransferCommands.empty() &&
+            mPendingTransferCommands.front().fence.getStatus(mDevice) == VK_SUCCESS)
+        {
+            *commandBufferOut = std::move(mPendingTransferCommands.front().commandBuffer);
+            mPendingTransferCommands.front().fence.destroy(mDevice);
+            mPendingTransferCommands.pop_front();
+            ANGLE_VK_TRY(context, commandBufferOut->reset());
+        }
+        else
+        {
+            VkCommandBufferAllocateInfo allocInfo = {};
+            allocInfo.sType                       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocInfo.commandBufferCount          = 1;
+            allocInfo.commandPool                 = mTransferCommandPool.getHandle();
+
+            ANGLE_VK_TRY(context, commandBufferOut->init(mDevice, allocInfo));
+        }
+    }
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    beginInfo.pInheritanceInfo         = nullptr;
+    ANGLE_VK_TRY(context, commandBufferOut->begin(beginInfo));
+
+    return angle::Result::Continue;
+}
+
+angle::Result RendererVk::submitTransferCommandBuffer(vk::Context *context,
+                                                      vk::PrimaryCommandBuffer &&commandBuffer,
+                                                      const vk::Semaphore &signalSemaphore)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::submitTransferCommandBuffer");
+    ASSERT(hasTransferQueue());
+
+    ANGLE_VK_TRY(context, commandBuffer.end());
+
+    VkFenceCreateInfo fenceInfo = {};
+    fenceInfo.sType             = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    fenceInfo.flags             = 0;
+
+    vk::Fence fence;
+    ANGLE_VK_TRY(context, fence.init(mDevice, fenceInfo));
+
+    VkSubmitInfo submitInfo         = {};
+    submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount   = 1;
+    submitInfo.pCommandBuffers      = commandBuffer.ptr();
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.pSignalSemaphores    = signalSemaphore.ptr();
+
+    std::lock_guard<std::mutex> lock(mTransferQueueMutex);
+
+    VkResult result = vkQueueSubmit(mTransferQueue, 1, &submitInfo, fence.getHandle());
+    if (result != VK_SUCCESS)
+    {
+        fence.destroy(mDevice);
+        commandBuffer.destroy(mDevice, mTransferCommandPool);
+        ANGLE_VK_TRY(context, result);
+    }
+
+    mPendingTransferCommands.push_back({std::move(fence), std::move(commandBuffer)});
+
+    return angle::Result::Continue;
+}
+
+void RendererVk::waitForTransferQueueIdle()
+{
+    ASSERT(hasTransferQueue());
+
+    std::lock_guard<std::mutex> lock(mTransferQueueMutex);
+    vkQueueWaitIdle(mTransferQueue);
+}
+
 angle::Result RendererVk::submitFrame(vk::Context *context,
                                       egl::ContextPriority contextPriority,
                                       std::vector<VkSemaphore> &&waitSemaphores,
@@ -3108,11 +3707,25 @@ VkResult RendererVk::queuePresent(vk::Context *context,
     if (getFeatures().logMemoryReportStats.enabled)
     {
         mMemoryReport.logMemoryReportStats();
+        mMemoryReport.recordMemoryHistograms();
     }
 
     return result;
 }
 
+angle::Result RendererVk::queueBindSparse(vk::Context *context,
+                                          egl::ContextPriority priority,
+                                          const VkBindSparseInfo &bindSparseInfo)
+{
+    std::lock_guard<std::mutex> lock(mCommandQueueMutex);
+
+    if (mFeatures.asyncCommandQueue.enabled)
+    {
+        return mCommandProcessor.queueBindSparse(context, priority, bindSparseInfo);
+    }
+    return mCommandQueue.queueBindSparse(context, priority, bindSparseInfo);
+}
+
 vk::CommandBufferHelper *RendererVk::getCommandBufferHelper(bool hasRenderPass)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::getCommandBufferHelper");
@@ -3154,7 +3767,8 @@ void RendererVk::logCacheStats() const
     INFO() << "Vulkan object cache hit ratios: ";
     for (const CacheStats &stats : mVulkanCacheStats)
     {
-        INFO() << "    CacheType " << cacheType++ << ": " << stats.getHitRatio();
+        INFO() << "    CacheType " << cacheType++ << ": " << stats.getHitRatio()
+               << ", live entries: " << stats.getSize();
     }
 }
 
@@ -3267,4 +3881,15 @@ void vk::MemoryReport::logMemoryReportStats() const
                << " (max=" << std::setw(10) << importedMemoryMax << ")";
     }
 }
+
+void vk::MemoryReport::recordMemoryHistograms() const
+{
+    std::lock_guard<std::mutex> lock(mMemoryReportMutex);
+
+    constexpr VkDeviceSize kOneKiloByte = 1024;
+    ANGLE_HISTOGRAM_MEMORY_KB("GPU.ANGLE.VulkanAllocatedMemoryKB",
+                              static_cast<int>(mCurrentTotalAllocatedMemory / kOneKiloByte));
+    ANGLE_HISTOGRAM_MEMORY_KB("GPU.ANGLE.VulkanImportedMemoryKB",
+                              static_cast<int>(mCurrentTotalImportedMemory / kOneKiloByte));
+}
 }  // namespace rx
@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_RENDERERVK_H_
 #define LIBANGLE_RENDERER_VULKAN_RENDERERVK_H_
 
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <memory>
@@ -60,6 +61,8 @@ class MemoryReport final : angle::NonCopyable
     MemoryReport();
     void processCallback(const VkDeviceMemoryReportCallbackDataEXT &callbackData, bool logCallback);
     void logMemoryReportStats() const;
+    // Reports the current totals as memory histograms through the platform methods.
+    void recordMemoryHistograms() const;
 
   private:
     struct MemorySizes
@@ -131,6 +134,8 @@ class RendererVk : angle::NonCopyable
     void notifyDeviceLost();
     bool isDeviceLost() const;
     bool hasSharedGarbage();
+    // The number of garbage objects that are not destroyed yet, for the overlay.
+    size_t getSharedGarbageObjectCount();
     void releaseSharedResources(vk::ResourceUseList *resourceList);
 
     std::string getVendorString() const;
@@ -168,6 +173,12 @@ class RendererVk : angle::NonCopyable
     const gl::Limitations &getNativeLimitations() const;
 
     uint32_t getQueueFamilyIndex() const { return mCurrentQueueFamilyIndex; }
+    // The transfer-only queue family used with transferQueueUploads, if the device has one.
+    bool hasTransferQueue() const
+    {
+        return mTransferQueueFamilyIndex != std::numeric_limits<uint32_t>::max();
+    }
+    uint32_t getTransferQueueFamilyIndex() const { return mTransferQueueFamilyIndex; }
     const VkQueueFamilyProperties &getQueueFamilyProperties() const
     {
         return mQueueFamilyProperties[mCurrentQueueFamilyIndex];
@@ -197,6 +208,16 @@ class RendererVk : angle::NonCopyable
         return mMinImportedHostPointerAlignment;
     }
     uint32_t getDefaultUniformBufferSize() const { return mDefaultUniformBufferSize; }
+    // The maximum number of pipelines each GraphicsPipelineCache keeps alive, or 0 if unlimited.
+    uint32_t getGraphicsPipelineCacheLimit() const { return mGraphicsPipelineCacheLimit; }
+    // The number of frames a window surface lets the CPU get ahead of the GPU, or 0 for the
+    // surface's default.
+    uint32_t getMaxFramesInFlight() const { return mMaxFramesInFlight; }
+
+    // Buffers retired by dynamic buffers, available for reuse by other dynamic buffers with
+    // shareDynamicBufferAllocations.
+    vk::SharedBufferPool &getSharedBufferPool() { return mSharedBufferPool; }
+    vk::SurfaceImagePool &getSurfaceImagePool() { return mSurfaceImagePool; }
 
     bool isMockICDEnabled() const { return mEnabledICD == angle::vk::ICD::Mock; }
 
@@ -225,6 +246,17 @@ class RendererVk : angle::NonCopyable
                                          vk::PrimaryCommandBuffer *commandBufferOut);
 
     // Fire off a single command buffer immediately with default priority.
+    // Allocates and begins a command buffer for the transfer queue.  It must be submitted with
+    // submitTransferCommandBuffer.
+    angle::Result getTransferCommandBuffer(vk::Context *context,
+                                           vk::PrimaryCommandBuffer *commandBufferOut);
+    // Submits the command buffer to the transfer queue, signaling the semaphore when done.  The
+    // command buffer is reclaimed once its execution finishes.
+    angle::Result submitTransferCommandBuffer(vk::Context *context,
+                                              vk::PrimaryCommandBuffer &&commandBuffer,
+                                              const vk::Semaphore &signalSemaphore);
+    void waitForTransferQueueIdle();
+
     // Command buffer must be allocated with getCommandBufferOneOff and is reclaimed.
     angle::Result queueSubmitOneOff(vk::Context *context,
                                     vk::PrimaryCommandBuffer &&primary,
@@ -256,11 +288,23 @@ class RendererVk : angle::NonCopyable
         if (!sharedGarbage.empty())
         {
             std::lock_guard<std::mutex> lock(mGarbageMutex);
+            mSharedGarbageObjectCount += sharedGarbage.size();
             mSharedGarbage.emplace_back(std::move(use), std::move(sharedGarbage));
         }
     }
 
     angle::Result getPipelineCache(vk::PipelineCache **pipelineCache);
+
+    // Waits for glslang to be warmed up, which is started during initialization.  Must be called
+    // before the first shader compilation.
+    void ensureGlslangInitialized();
+
+    // Only available with the features that use worker threads, see initializeDevice().
+    std::shared_ptr<angle::WorkerThreadPool> getWorkerThreadPool() const
+    {
+        ASSERT(mWorkerThreadPool);
+        return mWorkerThreadPool;
+    }
     void onNewGraphicsPipeline()
     {
         std::lock_guard<std::mutex> lock(mPipelineCacheMutex);
@@ -322,6 +366,7 @@ class RendererVk : angle::NonCopyable
     bool angleDebuggerMode() const { return mAngleDebuggerMode; }
 
     SamplerCache &getSamplerCache() { return mSamplerCache; }
+    vk::ShaderLibrary &getShaderLibrary() { return mShaderLibrary; }
     SamplerYcbcrConversionCache &getYuvConversionCache() { return mYuvConversionCache; }
     vk::ActiveHandleCounter &getActiveHandleCounts() { return mActiveHandleCounts; }
 
@@ -333,10 +378,22 @@ class RendererVk : angle::NonCopyable
 
     void outputVmaStatString();
 
+    // The budget and usage of the device-local heaps, in bytes, as of the last
+    // updateMemoryBudget().  Called after every submission.
+    void updateMemoryBudget();
+    VkDeviceSize getMemoryBudget() const { return mMemoryBudget; }
+    VkDeviceSize getMemoryUsage() const { return mMemoryUsage; }
+    bool isNearMemoryBudget() const;
+
+    // Releases the memory the renderer keeps around for reuse, once the GPU is done with it.
+    void trimMemory();
+
     bool haveSameFormatFeatureBits(angle::FormatID formatID1, angle::FormatID formatID2) const;
 
     angle::Result cleanupGarbage(Serial lastCompletedQueueSerial);
     void cleanupCompletedCommandsGarbage();
+    void garbageCleanupThreadLoop();
+    void destroyCompletedGarbage(std::vector<vk::GarbageObject> *garbage);
 
     angle::Result submitFrame(vk::Context *context,
                               egl::ContextPriority contextPriority,
@@ -366,6 +423,12 @@ class RendererVk : angle::NonCopyable
                           egl::ContextPriority priority,
                           const VkPresentInfoKHR &presentInfo);
 
+    // Binds sparse image memory on the queue that the context submits to.  Ordering with the
+    // context's submissions is left to the semaphores of |bindSparseInfo|.
+    angle::Result queueBindSparse(vk::Context *context,
+                                  egl::ContextPriority priority,
+                                  const VkBindSparseInfo &bindSparseInfo);
+
     vk::CommandBufferHelper *getCommandBufferHelper(bool hasRenderPass);
     void recycleCommandBufferHelper(vk::CommandBufferHelper *commandBuffer);
 
@@ -381,6 +444,8 @@ class RendererVk : angle::NonCopyable
     {
         mVulkanCacheStats[cache].accumulate(stats);
     }
+    // Image views are cached by each ImageViewHelper, which update these stats directly.
+    CacheStats *getImageViewCacheStats() { return &mVulkanCacheStats[VulkanCacheType::ImageView]; }
     // Log cache stats for all caches
     void logCacheStats() const;
 
@@ -438,6 +503,9 @@ class RendererVk : angle::NonCopyable
     VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT mVertexAttributeDivisorProperties;
     VkPhysicalDeviceTransformFeedbackFeaturesEXT mTransformFeedbackFeatures;
     VkPhysicalDeviceIndexTypeUint8FeaturesEXT mIndexTypeUint8Features;
+    VkPhysicalDeviceExtendedDynamicStateFeaturesEXT mExtendedDynamicStateFeatures;
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR mTimelineSemaphoreFeatures;
+    VkPhysicalDeviceSynchronization2FeaturesKHR mSynchronization2Features;
     VkPhysicalDeviceSubgroupProperties mSubgroupProperties;
     VkPhysicalDeviceDeviceMemoryReportFeaturesEXT mMemoryReportFeatures;
     VkDeviceDeviceMemoryReportCreateInfoEXT mMemoryReportCallback;
@@ -453,21 +521,42 @@ class RendererVk : angle::NonCopyable
     std::vector<VkQueueFamilyProperties> mQueueFamilyProperties;
     angle::PackedEnumMap<egl::ContextPriority, egl::ContextPriority> mPriorities;
     uint32_t mCurrentQueueFamilyIndex;
+    uint32_t mTransferQueueFamilyIndex;
     uint32_t mMaxVertexAttribDivisor;
     VkDeviceSize mMaxVertexAttribStride;
     VkDeviceSize mMinImportedHostPointerAlignment;
     uint32_t mDefaultUniformBufferSize;
+    uint32_t mGraphicsPipelineCacheLimit;
+    uint32_t mMaxFramesInFlight;
     VkDevice mDevice;
     AtomicSerialFactory mShaderSerialFactory;
 
     bool mDeviceLost;
 
+    // Warms glslang up during initialization, joined by ensureGlslangInitialized().
+    std::mutex mGlslangInitMutex;
+    std::thread mGlslangInitThread;
+
     std::mutex mGarbageMutex;
     vk::SharedGarbageList mSharedGarbage;
+    size_t mSharedGarbageObjectCount;
+
+    // With asyncGarbageCleanup, cleanupGarbage() only records the completed serial and wakes up
+    // this thread, which destroys the garbage that serial completes outside of mGarbageMutex.
+    std::thread mGarbageCleanupThread;
+    std::condition_variable mGarbageCleanupCondition;
+    Serial mGarbageCleanupSerial;
+    bool mGarbageCleanupThreadExit;
 
     vk::MemoryProperties mMemoryProperties;
     vk::FormatTable mFormatTable;
 
+    // The allocator only refreshes its budget from VK_EXT_memory_budget when the frame index
+    // changes.
+    std::atomic<uint32_t> mMemoryBudgetFrameIndex;
+    std::atomic<VkDeviceSize> mMemoryBudget;
+    std::atomic<VkDeviceSize> mMemoryUsage;
+
     // All access to the pipeline cache is done through EGL objects so it is thread safe to not use
     // a lock.
     std::mutex mPipelineCacheMutex;
@@ -500,6 +589,18 @@ class RendererVk : angle::NonCopyable
     };
     std::deque<PendingOneOffCommands> mPendingOneOffCommands;
 
+    // Used for uploads with transferQueueUploads.  Submissions to the transfer queue are tracked
+    // with fences as they are not part of the queue serial timeline.
+    std::mutex mTransferQueueMutex;
+    VkQueue mTransferQueue;
+    vk::CommandPool mTransferCommandPool;
+    struct PendingTransferCommands
+    {
+        vk::Fence fence;
+        vk::PrimaryCommandBuffer commandBuffer;
+    };
+    std::deque<PendingTransferCommands> mPendingTransferCommands;
+
     std::mutex mCommandQueueMutex;
     vk::CommandQueue mCommandQueue;
 
@@ -513,6 +614,9 @@ class RendererVk : angle::NonCopyable
     vk::Allocator mAllocator;
     SamplerCache mSamplerCache;
     SamplerYcbcrConversionCache mYuvConversionCache;
+
+    // Internal shader library, shared by the contexts as its shaders don't depend on their state.
+    vk::ShaderLibrary mShaderLibrary;
     vk::ActiveHandleCounter mActiveHandleCounts;
 
     // Tracks resource serials.
@@ -538,6 +642,17 @@ class RendererVk : angle::NonCopyable
 
     // Use thread pool to compress cache data.
     std::shared_ptr<rx::WaitableCompressEvent> mCompressEvent;
+    // The hash of each chunk of the pipeline cache last stored in the blob cache.  Used by the
+    // compression task while mCompressEvent is not ready.
+    std::vector<size_t> mPipelineCacheChunkHashes;
+
+    vk::SharedBufferPool mSharedBufferPool;
+    vk::SurfaceImagePool mSurfaceImagePool;
+
+    // Worker threads used to create graphics pipelines with asyncGraphicsPipelineCreation and
+    // to record secondary command buffers with parallelCommandBufferRecording.  Also used to
+    // decode compressed textures with parallelCompressedTextureDecode.
+    std::shared_ptr<angle::WorkerThreadPool> mWorkerThreadPool;
 };
 
 }  // namespace rx
@@ -95,6 +95,23 @@ bool SharedGarbage::destroyIfComplete(RendererVk *renderer, Serial completedSeri
     return true;
 }
 
+bool SharedGarbage::releaseIfComplete(Serial completedSerial,
+                                      std::vector<GarbageObject> *garbageOut)
+{
+    if (mLifetime.isCurrentlyInUse(completedSerial))
+        return false;
+
+    for (GarbageObject &object : mGarbage)
+    {
+        garbageOut->emplace_back(std::move(object));
+    }
+    mGarbage.clear();
+
+    mLifetime.release();
+
+    return true;
+}
+
 // ResourceUseList implementation.
 ResourceUseList::ResourceUseList()
 {
@@ -124,6 +124,12 @@ class SharedGarbage
 
     bool destroyIfComplete(RendererVk *renderer, Serial completedSerial);
 
+    // Like destroyIfComplete, but the garbage objects are moved to |garbageOut| to be destroyed
+    // by the caller.
+    bool releaseIfComplete(Serial completedSerial, std::vector<GarbageObject> *garbageOut);
+
+    size_t getObjectCount() const { return mGarbage.size(); }
+
   private:
     SharedResourceUse mLifetime;
     std::vector<GarbageObject> mGarbage;
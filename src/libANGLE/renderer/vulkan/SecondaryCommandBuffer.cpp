@@ -40,6 +40,8 @@ const char *GetCommandString(CommandID id)
             return "BindGraphicsPipeline";
         case CommandID::BindIndexBuffer:
             return "BindIndexBuffer";
+        case CommandID::BindIndexBufferOffset:
+            return "BindIndexBufferOffset";
         case CommandID::BindTransformFeedbackBuffers:
             return "BindTransformFeedbackBuffers";
         case CommandID::BindVertexBuffers:
@@ -108,16 +110,32 @@ const char *GetCommandString(CommandID id)
             return "PipelineBarrier";
         case CommandID::PushConstants:
             return "PushConstants";
+        case CommandID::PushDescriptorSet:
+            return "PushDescriptorSet";
         case CommandID::ResetEvent:
             return "ResetEvent";
         case CommandID::ResetQueryPool:
             return "ResetQueryPool";
         case CommandID::ResolveImage:
             return "ResolveImage";
+        case CommandID::SetCullMode:
+            return "SetCullMode";
+        case CommandID::SetDepthCompareOp:
+            return "SetDepthCompareOp";
+        case CommandID::SetDepthTestEnable:
+            return "SetDepthTestEnable";
+        case CommandID::SetDepthWriteEnable:
+            return "SetDepthWriteEnable";
         case CommandID::SetEvent:
             return "SetEvent";
+        case CommandID::SetFrontFace:
+            return "SetFrontFace";
         case CommandID::SetScissor:
             return "SetScissor";
+        case CommandID::SetStencilOp:
+            return "SetStencilOp";
+        case CommandID::SetStencilTestEnable:
+            return "SetStencilTestEnable";
         case CommandID::WaitEvents:
             return "WaitEvents";
         case CommandID::WriteTimestamp:
@@ -140,6 +158,11 @@ ANGLE_INLINE const CommandHeader *NextCommand(const CommandHeader *command)
 void SecondaryCommandBuffer::executeCommands(VkCommandBuffer cmdBuffer)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "SecondaryCommandBuffer::executeCommands");
+
+    // The index buffer that BindIndexBufferOffset rebinds.
+    VkBuffer indexBuffer  = VK_NULL_HANDLE;
+    VkIndexType indexType = VK_INDEX_TYPE_UINT16;
+
     for (const CommandHeader *command : mCommands)
     {
         for (const CommandHeader *currentCommand                      = command;
@@ -215,6 +238,16 @@ void SecondaryCommandBuffer::executeCommands(VkCommandBuffer cmdBuffer)
                         getParamPtr<BindIndexBufferParams>(currentCommand);
                     vkCmdBindIndexBuffer(cmdBuffer, params->buffer, params->offset,
                                          params->indexType);
+                    indexBuffer = params->buffer;
+                    indexType   = params->indexType;
+                    break;
+                }
+                case CommandID::BindIndexBufferOffset:
+                {
+                    const BindIndexBufferOffsetParams *params =
+                        getParamPtr<BindIndexBufferOffsetParams>(currentCommand);
+                    ASSERT(indexBuffer != VK_NULL_HANDLE);
+                    vkCmdBindIndexBuffer(cmdBuffer, indexBuffer, params->offset, indexType);
                     break;
                 }
                 case CommandID::BindTransformFeedbackBuffers:
@@ -355,7 +388,8 @@ void SecondaryCommandBuffer::executeCommands(VkCommandBuffer cmdBuffer)
                 {
                     const DrawIndexedIndirectParams *params =
                         getParamPtr<DrawIndexedIndirectParams>(currentCommand);
-                    vkCmdDrawIndexedIndirect(cmdBuffer, params->buffer, params->offset, 1, 0);
+                    vkCmdDrawIndexedIndirect(cmdBuffer, params->buffer, params->offset,
+                                             params->drawCount, params->stride);
                     break;
                 }
                 case CommandID::DrawIndexedInstanced:
@@ -387,7 +421,8 @@ void SecondaryCommandBuffer::executeCommands(VkCommandBuffer cmdBuffer)
                 {
                     const DrawIndirectParams *params =
                         getParamPtr<DrawIndirectParams>(currentCommand);
-                    vkCmdDrawIndirect(cmdBuffer, params->buffer, params->offset, 1, 0);
+                    vkCmdDrawIndirect(cmdBuffer, params->buffer, params->offset, params->drawCount,
+                                      params->stride);
                     break;
                 }
                 case CommandID::DrawInstanced:
@@ -512,6 +547,28 @@ void SecondaryCommandBuffer::executeCommands(VkCommandBuffer cmdBuffer)
                                        params->size, data);
                     break;
                 }
+                case CommandID::PushDescriptorSet:
+                {
+                    const PushDescriptorSetParams *params =
+                        getParamPtr<PushDescriptorSetParams>(currentCommand);
+                    const VkWriteDescriptorSet *storedWrites =
+                        Offset<VkWriteDescriptorSet>(params, sizeof(PushDescriptorSetParams));
+                    const VkDescriptorBufferInfo *bufferInfos = Offset<VkDescriptorBufferInfo>(
+                        storedWrites, params->descriptorWriteCount * sizeof(VkWriteDescriptorSet));
+
+                    std::array<VkWriteDescriptorSet, kMaxPushDescriptorSetWrites> writes;
+                    for (uint32_t writeIndex = 0; writeIndex < params->descriptorWriteCount;
+                         ++writeIndex)
+                    {
+                        writes[writeIndex]             = storedWrites[writeIndex];
+                        writes[writeIndex].pBufferInfo = bufferInfos;
+                        bufferInfos += storedWrites[writeIndex].descriptorCount;
+                    }
+                    vkCmdPushDescriptorSetKHR(cmdBuffer, params->pipelineBindPoint,
+                                              params->layout, params->set,
+                                              params->descriptorWriteCount, writes.data());
+                    break;
+                }
                 case CommandID::ResetEvent:
                 {
                     const ResetEventParams *params = getParamPtr<ResetEventParams>(currentCommand);
@@ -535,18 +592,68 @@ void SecondaryCommandBuffer::executeCommands(VkCommandBuffer cmdBuffer)
                                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &params->region);
                     break;
                 }
+                case CommandID::SetCullMode:
+                {
+                    const SetCullModeParams *params =
+                        getParamPtr<SetCullModeParams>(currentCommand);
+                    vkCmdSetCullModeEXT(cmdBuffer, params->cullMode);
+                    break;
+                }
+                case CommandID::SetDepthCompareOp:
+                {
+                    const SetDepthCompareOpParams *params =
+                        getParamPtr<SetDepthCompareOpParams>(currentCommand);
+                    vkCmdSetDepthCompareOpEXT(cmdBuffer, params->depthCompareOp);
+                    break;
+                }
+                case CommandID::SetDepthTestEnable:
+                {
+                    const SetDepthTestEnableParams *params =
+                        getParamPtr<SetDepthTestEnableParams>(currentCommand);
+                    vkCmdSetDepthTestEnableEXT(cmdBuffer, params->depthTestEnable);
+                    break;
+                }
+                case CommandID::SetDepthWriteEnable:
+                {
+                    const SetDepthWriteEnableParams *params =
+                        getParamPtr<SetDepthWriteEnableParams>(currentCommand);
+                    vkCmdSetDepthWriteEnableEXT(cmdBuffer, params->depthWriteEnable);
+                    break;
+                }
                 case CommandID::SetEvent:
                 {
                     const SetEventParams *params = getParamPtr<SetEventParams>(currentCommand);
                     vkCmdSetEvent(cmdBuffer, params->event, params->stageMask);
                     break;
                 }
+                case CommandID::SetFrontFace:
+                {
+                    const SetFrontFaceParams *params =
+                        getParamPtr<SetFrontFaceParams>(currentCommand);
+                    vkCmdSetFrontFaceEXT(cmdBuffer, params->frontFace);
+                    break;
+                }
                 case CommandID::SetScissor:
                 {
                     const SetScissorParams *params = getParamPtr<SetScissorParams>(currentCommand);
                     vkCmdSetScissor(cmdBuffer, 0, 1, &params->scissor);
                     break;
                 }
+                case CommandID::SetStencilOp:
+                {
+                    const SetStencilOpParams *params =
+                        getParamPtr<SetStencilOpParams>(currentCommand);
+                    vkCmdSetStencilOpEXT(cmdBuffer, params->faceMask, params->failOp,
+                                         params->passOp, params->depthFailOp, params->compareOp);
+                    break;
+                }
+                case CommandID::SetStencilTestEnable:
+                {
+                    const SetStencilTestEnableParams *params =
+                        getParamPtr<SetStencilTestEnableParams>(currentCommand);
+                    vkCmdSetStencilTestEnableEXT(cmdBuffer, params->stencilTestEnable);
+                    break;
+                }
                 case CommandID::WaitEvents:
                 {
                     const WaitEventsParams *params = getParamPtr<WaitEventsParams>(currentCommand);
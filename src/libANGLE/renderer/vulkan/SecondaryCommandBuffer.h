@@ -38,6 +38,7 @@ enum class CommandID : uint16_t
     BindDescriptorSets,
     BindGraphicsPipeline,
     BindIndexBuffer,
+    BindIndexBufferOffset,
     BindTransformFeedbackBuffers,
     BindVertexBuffers,
     BlitImage,
@@ -72,11 +73,19 @@ enum class CommandID : uint16_t
     NextSubpass,
     PipelineBarrier,
     PushConstants,
+    PushDescriptorSet,
     ResetEvent,
     ResetQueryPool,
     ResolveImage,
+    SetCullMode,
+    SetDepthCompareOp,
+    SetDepthTestEnable,
+    SetDepthWriteEnable,
     SetEvent,
+    SetFrontFace,
     SetScissor,
+    SetStencilOp,
+    SetStencilTestEnable,
     WaitEvents,
     WriteTimestamp,
 };
@@ -120,6 +129,14 @@ struct BindIndexBufferParams
 };
 VERIFY_4_BYTE_ALIGNMENT(BindIndexBufferParams)
 
+// Rebinds the index buffer and index type of the previous BindIndexBuffer at a new offset, which
+// is how draws from different ranges of the same index buffer are recorded.
+struct BindIndexBufferOffsetParams
+{
+    uint32_t offset;
+};
+VERIFY_4_BYTE_ALIGNMENT(BindIndexBufferOffsetParams)
+
 struct BindPipelineParams
 {
     VkPipeline pipeline;
@@ -259,6 +276,8 @@ struct DrawIndexedIndirectParams
 {
     VkBuffer buffer;
     VkDeviceSize offset;
+    uint32_t drawCount;
+    uint32_t stride;
 };
 VERIFY_4_BYTE_ALIGNMENT(DrawIndexedIndirectParams)
 
@@ -291,6 +310,8 @@ struct DrawIndirectParams
 {
     VkBuffer buffer;
     VkDeviceSize offset;
+    uint32_t drawCount;
+    uint32_t stride;
 };
 VERIFY_4_BYTE_ALIGNMENT(DrawIndirectParams)
 
@@ -385,6 +406,19 @@ struct PushConstantsParams
 };
 VERIFY_4_BYTE_ALIGNMENT(PushConstantsParams)
 
+// The writes of a pushed descriptor set are copied to the stack when the command is executed.
+constexpr size_t kMaxPushDescriptorSetWrites = 4;
+
+struct PushDescriptorSetParams
+{
+    VkPipelineLayout layout;
+    VkPipelineBindPoint pipelineBindPoint;
+    uint32_t set;
+    uint32_t descriptorWriteCount;
+    uint32_t bufferInfoCount;
+};
+VERIFY_4_BYTE_ALIGNMENT(PushDescriptorSetParams)
+
 struct ResetEventParams
 {
     VkEvent event;
@@ -408,6 +442,30 @@ struct ResolveImageParams
 };
 VERIFY_4_BYTE_ALIGNMENT(ResolveImageParams)
 
+struct SetCullModeParams
+{
+    VkCullModeFlags cullMode;
+};
+VERIFY_4_BYTE_ALIGNMENT(SetCullModeParams)
+
+struct SetDepthCompareOpParams
+{
+    VkCompareOp depthCompareOp;
+};
+VERIFY_4_BYTE_ALIGNMENT(SetDepthCompareOpParams)
+
+struct SetDepthTestEnableParams
+{
+    VkBool32 depthTestEnable;
+};
+VERIFY_4_BYTE_ALIGNMENT(SetDepthTestEnableParams)
+
+struct SetDepthWriteEnableParams
+{
+    VkBool32 depthWriteEnable;
+};
+VERIFY_4_BYTE_ALIGNMENT(SetDepthWriteEnableParams)
+
 struct SetEventParams
 {
     VkEvent event;
@@ -415,12 +473,34 @@ struct SetEventParams
 };
 VERIFY_4_BYTE_ALIGNMENT(SetEventParams)
 
+struct SetFrontFaceParams
+{
+    VkFrontFace frontFace;
+};
+VERIFY_4_BYTE_ALIGNMENT(SetFrontFaceParams)
+
 struct SetScissorParams
 {
     VkRect2D scissor;
 };
 VERIFY_4_BYTE_ALIGNMENT(SetScissorParams)
 
+struct SetStencilOpParams
+{
+    VkStencilFaceFlags faceMask;
+    VkStencilOp failOp;
+    VkStencilOp passOp;
+    VkStencilOp depthFailOp;
+    VkCompareOp compareOp;
+};
+VERIFY_4_BYTE_ALIGNMENT(SetStencilOpParams)
+
+struct SetStencilTestEnableParams
+{
+    VkBool32 stencilTestEnable;
+};
+VERIFY_4_BYTE_ALIGNMENT(SetStencilTestEnableParams)
+
 struct WaitEventsParams
 {
     uint32_t eventCount;
@@ -630,6 +710,13 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                        uint32_t size,
                        const void *data);
 
+    // Only buffer descriptors can be pushed through the secondary command buffer.
+    void pushDescriptorSet(const PipelineLayout &layout,
+                           VkPipelineBindPoint pipelineBindPoint,
+                           DescriptorSetIndex set,
+                           uint32_t descriptorWriteCount,
+                           const VkWriteDescriptorSet *descriptorWrites);
+
     void resetEvent(VkEvent event, VkPipelineStageFlags stageMask);
 
     // Store up resetQueryPool command and prepend to commands when executing
@@ -648,6 +735,19 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 
     void setScissor(uint32_t firstScissor, uint32_t scissorCount, const VkRect2D *scissors);
 
+    // VK_EXT_extended_dynamic_state
+    void setCullModeEXT(VkCullModeFlags cullMode);
+    void setFrontFaceEXT(VkFrontFace frontFace);
+    void setDepthTestEnableEXT(VkBool32 depthTestEnable);
+    void setDepthWriteEnableEXT(VkBool32 depthWriteEnable);
+    void setDepthCompareOpEXT(VkCompareOp depthCompareOp);
+    void setStencilTestEnableEXT(VkBool32 stencilTestEnable);
+    void setStencilOpEXT(VkStencilFaceFlags faceMask,
+                         VkStencilOp failOp,
+                         VkStencilOp passOp,
+                         VkStencilOp depthFailOp,
+                         VkCompareOp compareOp);
+
     void waitEvents(uint32_t eventCount,
                     const VkEvent *events,
                     VkPipelineStageFlags srcStageMask,
@@ -686,7 +786,8 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     {
         ASSERT(allocator);
         ASSERT(mCommands.empty());
-        mAllocator = allocator;
+        mAllocator       = allocator;
+        mLastIndexBuffer = VK_NULL_HANDLE;
         allocateNewBlock();
         // Set first command to Invalid to start
         reinterpret_cast<CommandHeader *>(mCurrentWritePointer)->id = CommandID::Invalid;
@@ -808,6 +909,11 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     // Flag to indicate that commandBuffer is open for new commands. Initially open.
     bool mIsOpen;
 
+    // The last index buffer bound in this command buffer, so that rebinding it at a different
+    // offset can be recorded as a BindIndexBufferOffset.
+    VkBuffer mLastIndexBuffer;
+    VkIndexType mLastIndexType;
+
     std::vector<CommandHeader *> mCommands;
 
     // Allocator used by this class. If non-null then the class is valid.
@@ -818,7 +924,12 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 };
 
 ANGLE_INLINE SecondaryCommandBuffer::SecondaryCommandBuffer()
-    : mIsOpen(true), mAllocator(nullptr), mCurrentWritePointer(nullptr), mCurrentBytesRemaining(0)
+    : mIsOpen(true),
+      mLastIndexBuffer(VK_NULL_HANDLE),
+      mLastIndexType(VK_INDEX_TYPE_UINT16),
+      mAllocator(nullptr),
+      mCurrentWritePointer(nullptr),
+      mCurrentBytesRemaining(0)
 {}
 
 ANGLE_INLINE SecondaryCommandBuffer::~SecondaryCommandBuffer() {}
@@ -907,11 +1018,23 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindIndexBuffer(const Buffer &buffer,
                                                           VkDeviceSize offset,
                                                           VkIndexType indexType)
 {
+    if (buffer.getHandle() == mLastIndexBuffer && indexType == mLastIndexType &&
+        offset <= std::numeric_limits<uint32_t>::max())
+    {
+        BindIndexBufferOffsetParams *paramStruct =
+            initCommand<BindIndexBufferOffsetParams>(CommandID::BindIndexBufferOffset);
+        paramStruct->offset = static_cast<uint32_t>(offset);
+        return;
+    }
+
     BindIndexBufferParams *paramStruct =
         initCommand<BindIndexBufferParams>(CommandID::BindIndexBuffer);
     paramStruct->buffer    = buffer.getHandle();
     paramStruct->offset    = offset;
     paramStruct->indexType = indexType;
+
+    mLastIndexBuffer = buffer.getHandle();
+    mLastIndexType   = indexType;
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::bindTransformFeedbackBuffers(uint32_t bindingCount,
@@ -1138,9 +1261,10 @@ ANGLE_INLINE void SecondaryCommandBuffer::drawIndexedIndirect(const Buffer &buff
 {
     DrawIndexedIndirectParams *paramStruct =
         initCommand<DrawIndexedIndirectParams>(CommandID::DrawIndexedIndirect);
-    paramStruct->buffer = buffer.getHandle();
-    paramStruct->offset = offset;
-    ASSERT(drawCount == 1);
+    paramStruct->buffer    = buffer.getHandle();
+    paramStruct->offset    = offset;
+    paramStruct->drawCount = drawCount;
+    paramStruct->stride    = stride;
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::drawIndexedInstanced(uint32_t indexCount,
@@ -1189,10 +1313,8 @@ ANGLE_INLINE void SecondaryCommandBuffer::drawIndirect(const Buffer &buffer,
     DrawIndirectParams *paramStruct = initCommand<DrawIndirectParams>(CommandID::DrawIndirect);
     paramStruct->buffer             = buffer.getHandle();
     paramStruct->offset             = offset;
-
-    // OpenGL ES doesn't have a way to specify a drawCount or stride, throw assert if something
-    // changes.
-    ASSERT(drawCount == 1);
+    paramStruct->drawCount          = drawCount;
+    paramStruct->stride             = stride;
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::drawInstanced(uint32_t vertexCount,
@@ -1341,6 +1463,42 @@ ANGLE_INLINE void SecondaryCommandBuffer::pushConstants(const PipelineLayout &la
     storePointerParameter(writePtr, data, static_cast<size_t>(size));
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::pushDescriptorSet(
+    const PipelineLayout &layout,
+    VkPipelineBindPoint pipelineBindPoint,
+    DescriptorSetIndex set,
+    uint32_t descriptorWriteCount,
+    const VkWriteDescriptorSet *descriptorWrites)
+{
+    ASSERT(descriptorWriteCount <= kMaxPushDescriptorSetWrites);
+    uint32_t bufferInfoCount = 0;
+    for (uint32_t writeIndex = 0; writeIndex < descriptorWriteCount; ++writeIndex)
+    {
+        ASSERT(descriptorWrites[writeIndex].pBufferInfo != nullptr);
+        bufferInfoCount += descriptorWrites[writeIndex].descriptorCount;
+    }
+
+    size_t writeSize      = descriptorWriteCount * sizeof(VkWriteDescriptorSet);
+    size_t bufferInfoSize = bufferInfoCount * sizeof(VkDescriptorBufferInfo);
+    uint8_t *writePtr;
+    PushDescriptorSetParams *paramStruct = initCommand<PushDescriptorSetParams>(
+        CommandID::PushDescriptorSet, writeSize + bufferInfoSize, &writePtr);
+    paramStruct->layout               = layout.getHandle();
+    paramStruct->pipelineBindPoint    = pipelineBindPoint;
+    paramStruct->set                  = ToUnderlying(set);
+    paramStruct->descriptorWriteCount = descriptorWriteCount;
+    paramStruct->bufferInfoCount      = bufferInfoCount;
+    // Copy variable sized data.  The buffer infos are stored after the writes, which are
+    // re-pointed to them when the command is executed.
+    writePtr = storePointerParameter(writePtr, descriptorWrites, writeSize);
+    for (uint32_t writeIndex = 0; writeIndex < descriptorWriteCount; ++writeIndex)
+    {
+        writePtr = storePointerParameter(
+            writePtr, descriptorWrites[writeIndex].pBufferInfo,
+            descriptorWrites[writeIndex].descriptorCount * sizeof(VkDescriptorBufferInfo));
+    }
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::resetEvent(VkEvent event, VkPipelineStageFlags stageMask)
 {
     ResetEventParams *paramStruct = initCommand<ResetEventParams>(CommandID::ResetEvent);
@@ -1394,6 +1552,60 @@ ANGLE_INLINE void SecondaryCommandBuffer::setScissor(uint32_t firstScissor,
     paramStruct->scissor          = scissors[0];
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::setCullModeEXT(VkCullModeFlags cullMode)
+{
+    SetCullModeParams *paramStruct = initCommand<SetCullModeParams>(CommandID::SetCullMode);
+    paramStruct->cullMode          = cullMode;
+}
+
+ANGLE_INLINE void SecondaryCommandBuffer::setFrontFaceEXT(VkFrontFace frontFace)
+{
+    SetFrontFaceParams *paramStruct = initCommand<SetFrontFaceParams>(CommandID::SetFrontFace);
+    paramStruct->frontFace          = frontFace;
+}
+
+ANGLE_INLINE void SecondaryCommandBuffer::setDepthTestEnableEXT(VkBool32 depthTestEnable)
+{
+    SetDepthTestEnableParams *paramStruct =
+        initCommand<SetDepthTestEnableParams>(CommandID::SetDepthTestEnable);
+    paramStruct->depthTestEnable = depthTestEnable;
+}
+
+ANGLE_INLINE void SecondaryCommandBuffer::setDepthWriteEnableEXT(VkBool32 depthWriteEnable)
+{
+    SetDepthWriteEnableParams *paramStruct =
+        initCommand<SetDepthWriteEnableParams>(CommandID::SetDepthWriteEnable);
+    paramStruct->depthWriteEnable = depthWriteEnable;
+}
+
+ANGLE_INLINE void SecondaryCommandBuffer::setDepthCompareOpEXT(VkCompareOp depthCompareOp)
+{
+    SetDepthCompareOpParams *paramStruct =
+        initCommand<SetDepthCompareOpParams>(CommandID::SetDepthCompareOp);
+    paramStruct->depthCompareOp = depthCompareOp;
+}
+
+ANGLE_INLINE void SecondaryCommandBuffer::setStencilTestEnableEXT(VkBool32 stencilTestEnable)
+{
+    SetStencilTestEnableParams *paramStruct =
+        initCommand<SetStencilTestEnableParams>(CommandID::SetStencilTestEnable);
+    paramStruct->stencilTestEnable = stencilTestEnable;
+}
+
+ANGLE_INLINE void SecondaryCommandBuffer::setStencilOpEXT(VkStencilFaceFlags faceMask,
+                                                          VkStencilOp failOp,
+                                                          VkStencilOp passOp,
+                                                          VkStencilOp depthFailOp,
+                                                          VkCompareOp compareOp)
+{
+    SetStencilOpParams *paramStruct = initCommand<SetStencilOpParams>(CommandID::SetStencilOp);
+    paramStruct->faceMask           = faceMask;
+    paramStruct->failOp             = failOp;
+    paramStruct->passOp             = passOp;
+    paramStruct->depthFailOp        = depthFailOp;
+    paramStruct->compareOp          = compareOp;
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::waitEvents(
     uint32_t eventCount,
     const VkEvent *events,
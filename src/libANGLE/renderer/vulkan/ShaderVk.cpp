@@ -28,6 +28,7 @@ std::shared_ptr<WaitableCompileEvent> ShaderVk::compile(const gl::Context *conte
     ShCompileOptions compileOptions = 0;
 
     ContextVk *contextVk = vk::GetImpl(context);
+    contextVk->getRenderer()->ensureGlslangInitialized();
 
     bool isWebGL = context->getExtensions().webglCompatibility;
 
@@ -82,6 +83,11 @@ std::shared_ptr<WaitableCompileEvent> ShaderVk::compile(const gl::Context *conte
         compileOptions |= SH_USE_SPECIALIZATION_CONSTANT;
     }
 
+    if (contextVk->getFeatures().usePushConstantsForDriverUniforms.enabled)
+    {
+        compileOptions |= SH_USE_PUSH_CONSTANTS_FOR_DRIVER_UNIFORMS;
+    }
+
     if (contextVk->getFeatures().enablePreRotateSurfaces.enabled ||
         contextVk->getFeatures().emulatedPrerotation90.enabled ||
         contextVk->getFeatures().emulatedPrerotation180.enabled ||
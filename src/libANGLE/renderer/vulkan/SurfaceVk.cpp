@@ -110,11 +110,29 @@ constexpr VkSurfaceTransformFlagsKHR k90DegreeRotationVariants =
     VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_90_BIT_KHR |
     VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_270_BIT_KHR;
 
+// The number of consecutive frames at the end of which the contents of the depth/stencil image
+// must have been discarded before it is made transient.
+constexpr uint32_t kDiscardedDepthStencilFrameThreshold = 16;
+
 bool Is90DegreeRotation(VkSurfaceTransformFlagsKHR transform)
 {
     return ((transform & k90DegreeRotationVariants) != 0);
 }
 
+VkImageUsageFlags GetOffscreenImageUsage(const vk::Format &vkFormat)
+{
+    const angle::Format &textureFormat = vkFormat.actualImageFormat();
+    bool isDepthOrStencilFormat = textureFormat.depthBits > 0 || textureFormat.stencilBits > 0;
+    return isDepthOrStencilFormat ? kSurfaceVkDepthStencilImageUsageFlags
+                                  : kSurfaceVkColorImageUsageFlags;
+}
+
+VkExtent3D GetOffscreenImageExtents(EGLint width, EGLint height)
+{
+    return {std::max(static_cast<uint32_t>(width), 1u), std::max(static_cast<uint32_t>(height), 1u),
+            1u};
+}
+
 angle::Result InitImageHelper(DisplayVk *displayVk,
                               EGLint width,
                               EGLint height,
@@ -123,13 +141,8 @@ angle::Result InitImageHelper(DisplayVk *displayVk,
                               bool isRobustResourceInitEnabled,
                               vk::ImageHelper *imageHelper)
 {
-    const angle::Format &textureFormat = vkFormat.actualImageFormat();
-    bool isDepthOrStencilFormat   = textureFormat.depthBits > 0 || textureFormat.stencilBits > 0;
-    const VkImageUsageFlags usage = isDepthOrStencilFormat ? kSurfaceVkDepthStencilImageUsageFlags
-                                                           : kSurfaceVkColorImageUsageFlags;
-
-    VkExtent3D extents = {std::max(static_cast<uint32_t>(width), 1u),
-                          std::max(static_cast<uint32_t>(height), 1u), 1u};
+    const VkImageUsageFlags usage = GetOffscreenImageUsage(vkFormat);
+    const VkExtent3D extents      = GetOffscreenImageExtents(width, height);
 
     ANGLE_TRY(imageHelper->initExternal(displayVk, gl::TextureType::_2D, extents, vkFormat, samples,
                                         usage, vk::kVkImageCreateFlagsNone,
@@ -178,9 +191,11 @@ void SurfaceVk::onSubjectStateChange(angle::SubjectIndex index, angle::SubjectMe
 }
 
 OffscreenSurfaceVk::AttachmentImage::AttachmentImage(SurfaceVk *surfaceVk)
-    : imageObserverBinding(surfaceVk, kAnySurfaceImageSubjectIndex)
+    : image(std::make_unique<vk::ImageHelper>()),
+      imageObserverBinding(surfaceVk, kAnySurfaceImageSubjectIndex),
+      isPoolable(false)
 {
-    imageObserverBinding.bind(&image);
+    imageObserverBinding.bind(image.get());
 }
 
 OffscreenSurfaceVk::AttachmentImage::~AttachmentImage() = default;
@@ -192,12 +207,31 @@ angle::Result OffscreenSurfaceVk::AttachmentImage::initialize(DisplayVk *display
                                                               GLint samples,
                                                               bool isRobustResourceInitEnabled)
 {
-    ANGLE_TRY(InitImageHelper(displayVk, width, height, vkFormat, samples,
-                              isRobustResourceInitEnabled, &image));
+    RendererVk *renderer = displayVk->getRenderer();
+
+    // Reuse the image of a destroyed surface if one matches.  Its contents are as undefined as
+    // those of a new image, so it's only cleared if robust resource init requires it.
+    if (renderer->getFeatures().poolOffscreenSurfaceImages.enabled)
+    {
+        std::unique_ptr<vk::ImageHelper> pooledImage = renderer->getSurfaceImagePool().acquireImage(
+            GetOffscreenImageExtents(width, height), vkFormat, samples,
+            GetOffscreenImageUsage(vkFormat));
+        if (pooledImage)
+        {
+            pooledImage->resetForReuse(displayVk, isRobustResourceInitEnabled);
+            setImage(std::move(pooledImage));
+        }
+    }
 
-    RendererVk *renderer        = displayVk->getRenderer();
-    VkMemoryPropertyFlags flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-    ANGLE_TRY(image.initMemory(displayVk, renderer->getMemoryProperties(), flags));
+    if (!image->valid())
+    {
+        ANGLE_TRY(InitImageHelper(displayVk, width, height, vkFormat, samples,
+                                  isRobustResourceInitEnabled, image.get()));
+
+        VkMemoryPropertyFlags flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        ANGLE_TRY(image->initMemory(displayVk, renderer->getMemoryProperties(), flags));
+    }
+    isPoolable = true;
 
     imageViews.init(renderer);
 
@@ -217,7 +251,7 @@ angle::Result OffscreenSurfaceVk::AttachmentImage::initializeWithExternalMemory(
     ASSERT(renderer->getFeatures().supportsExternalMemoryHost.enabled);
 
     ANGLE_TRY(InitImageHelper(displayVk, width, height, vkFormat, samples,
-                              isRobustResourceInitEnabled, &image));
+                              isRobustResourceInitEnabled, image.get()));
 
     VkImportMemoryHostPointerInfoEXT importMemoryHostPointerInfo = {};
     importMemoryHostPointerInfo.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
@@ -227,10 +261,10 @@ angle::Result OffscreenSurfaceVk::AttachmentImage::initializeWithExternalMemory(
     importMemoryHostPointerInfo.pHostPointer = buffer;
 
     VkMemoryRequirements externalMemoryRequirements;
-    image.getImage().getMemoryRequirements(renderer->getDevice(), &externalMemoryRequirements);
+    image->getImage().getMemoryRequirements(renderer->getDevice(), &externalMemoryRequirements);
 
     VkMemoryPropertyFlags flags = 0;
-    ANGLE_TRY(image.initExternalMemory(
+    ANGLE_TRY(image->initExternalMemory(
         displayVk, renderer->getMemoryProperties(), externalMemoryRequirements, nullptr,
         &importMemoryHostPointerInfo, VK_QUEUE_FAMILY_EXTERNAL, flags));
 
@@ -244,9 +278,25 @@ void OffscreenSurfaceVk::AttachmentImage::destroy(const egl::Display *display)
     DisplayVk *displayVk = vk::GetImpl(display);
     RendererVk *renderer = displayVk->getRenderer();
     // Front end must ensure all usage has been submitted.
-    image.releaseImage(renderer);
-    image.releaseStagingBuffer(renderer);
+    image->releaseStagingBuffer(renderer);
+    if (isPoolable && image->valid() && renderer->getFeatures().poolOffscreenSurfaceImages.enabled)
+    {
+        renderer->getSurfaceImagePool().addImage(renderer, std::move(image));
+        setImage(std::make_unique<vk::ImageHelper>());
+    }
+    else
+    {
+        image->releaseImage(renderer);
+    }
     imageViews.release(renderer);
+    isPoolable = false;
+}
+
+void OffscreenSurfaceVk::AttachmentImage::setImage(std::unique_ptr<vk::ImageHelper> &&newImage)
+{
+    // Move the binding first, as the previous image may not outlive its observers.
+    imageObserverBinding.bind(newImage.get());
+    image = std::move(newImage);
 }
 
 OffscreenSurfaceVk::OffscreenSurfaceVk(const egl::SurfaceState &surfaceState, RendererVk *renderer)
@@ -256,9 +306,9 @@ OffscreenSurfaceVk::OffscreenSurfaceVk(const egl::SurfaceState &surfaceState, Re
       mColorAttachment(this),
       mDepthStencilAttachment(this)
 {
-    mColorRenderTarget.init(&mColorAttachment.image, &mColorAttachment.imageViews, nullptr, nullptr,
-                            gl::LevelIndex(0), 0, 1, RenderTargetTransience::Default);
-    mDepthStencilRenderTarget.init(&mDepthStencilAttachment.image,
+    mColorRenderTarget.init(mColorAttachment.image.get(), &mColorAttachment.imageViews, nullptr,
+                            nullptr, gl::LevelIndex(0), 0, 1, RenderTargetTransience::Default);
+    mDepthStencilRenderTarget.init(mDepthStencilAttachment.image.get(),
                                    &mDepthStencilAttachment.imageViews, nullptr, nullptr,
                                    gl::LevelIndex(0), 0, 1, RenderTargetTransience::Default);
 }
@@ -289,7 +339,7 @@ angle::Result OffscreenSurfaceVk::initializeImpl(DisplayVk *displayVk)
         ANGLE_TRY(mColorAttachment.initialize(displayVk, mWidth, mHeight,
                                               renderer->getFormat(config->renderTargetFormat),
                                               samples, robustInit));
-        mColorRenderTarget.init(&mColorAttachment.image, &mColorAttachment.imageViews, nullptr,
+        mColorRenderTarget.init(mColorAttachment.image.get(), &mColorAttachment.imageViews, nullptr,
                                 nullptr, gl::LevelIndex(0), 0, 1, RenderTargetTransience::Default);
     }
 
@@ -298,7 +348,7 @@ angle::Result OffscreenSurfaceVk::initializeImpl(DisplayVk *displayVk)
         ANGLE_TRY(mDepthStencilAttachment.initialize(
             displayVk, mWidth, mHeight, renderer->getFormat(config->depthStencilFormat), samples,
             robustInit));
-        mDepthStencilRenderTarget.init(&mDepthStencilAttachment.image,
+        mDepthStencilRenderTarget.init(mDepthStencilAttachment.image.get(),
                                        &mDepthStencilAttachment.imageViews, nullptr, nullptr,
                                        gl::LevelIndex(0), 0, 1, RenderTargetTransience::Default);
     }
@@ -394,23 +444,23 @@ angle::Result OffscreenSurfaceVk::initializeContents(const gl::Context *context,
 {
     ContextVk *contextVk = vk::GetImpl(context);
 
-    if (mColorAttachment.image.valid())
+    if (mColorAttachment.image->valid())
     {
-        mColorAttachment.image.stageRobustResourceClear(imageIndex);
-        ANGLE_TRY(mColorAttachment.image.flushAllStagedUpdates(contextVk));
+        mColorAttachment.image->stageRobustResourceClear(imageIndex);
+        ANGLE_TRY(mColorAttachment.image->flushAllStagedUpdates(contextVk));
     }
 
-    if (mDepthStencilAttachment.image.valid())
+    if (mDepthStencilAttachment.image->valid())
     {
-        mDepthStencilAttachment.image.stageRobustResourceClear(imageIndex);
-        ANGLE_TRY(mDepthStencilAttachment.image.flushAllStagedUpdates(contextVk));
+        mDepthStencilAttachment.image->stageRobustResourceClear(imageIndex);
+        ANGLE_TRY(mDepthStencilAttachment.image->flushAllStagedUpdates(contextVk));
     }
     return angle::Result::Continue;
 }
 
 vk::ImageHelper *OffscreenSurfaceVk::getColorAttachmentImage()
 {
-    return &mColorAttachment.image;
+    return mColorAttachment.image.get();
 }
 
 namespace impl
@@ -482,6 +532,9 @@ WindowSurfaceVk::WindowSurfaceVk(const egl::SurfaceState &surfaceState, EGLNativ
       mCurrentSwapHistoryIndex(0),
       mCurrentSwapchainImageIndex(0),
       mDepthStencilImageBinding(this, kAnySurfaceImageSubjectIndex),
+      mDiscardedDepthStencilFrameCount(0),
+      mIsDepthStencilTransient(false),
+      mIsDepthStencilTransienceDisallowed(false),
       mColorImageMSBinding(this, kAnySurfaceImageSubjectIndex),
       mNeedToAcquireNextSwapchainImage(false),
       mFrameCount(1)
@@ -1070,25 +1123,123 @@ angle::Result WindowSurfaceVk::createSwapChain(vk::Context *context,
     // Initialize depth/stencil if requested.
     if (mState.config->depthStencilFormat != GL_NONE)
     {
-        const vk::Format &dsFormat = renderer->getFormat(mState.config->depthStencilFormat);
+        ANGLE_TRY(initDepthStencilImage(context, vkExtents, samples, robustInit));
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result WindowSurfaceVk::initDepthStencilImage(vk::Context *context,
+                                                     const VkExtent3D &extents,
+                                                     GLint samples,
+                                                     bool robustInit)
+{
+    RendererVk *renderer       = context->getRenderer();
+    const vk::Format &dsFormat = renderer->getFormat(mState.config->depthStencilFormat);
+
+    // A transient image can only be used as an attachment.
+    VkImageUsageFlags dsUsage           = kSurfaceVkDepthStencilImageUsageFlags;
+    VkMemoryPropertyFlags dsMemoryFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    if (mIsDepthStencilTransient)
+    {
+        dsUsage = VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT |
+                  VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+        dsMemoryFlags |= VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+    }
+
+    ANGLE_TRY(mDepthStencilImage.init(context, gl::TextureType::_2D, extents, dsFormat, samples,
+                                      dsUsage, gl::LevelIndex(0), 1, 1, robustInit));
+    ANGLE_TRY(mDepthStencilImage.initMemory(context, renderer->getMemoryProperties(),
+                                            dsMemoryFlags));
+
+    mDepthStencilRenderTarget.init(&mDepthStencilImage, &mDepthStencilImageViews, nullptr, nullptr,
+                                   gl::LevelIndex(0), 0, 1, RenderTargetTransience::Default);
+
+    // We will need to pass depth/stencil image views to the RenderTargetVk in the future.
 
-        const VkImageUsageFlags dsUsage = kSurfaceVkDepthStencilImageUsageFlags;
+    return angle::Result::Continue;
+}
 
-        ANGLE_TRY(mDepthStencilImage.init(context, gl::TextureType::_2D, vkExtents, dsFormat,
-                                          samples, dsUsage, gl::LevelIndex(0), 1, 1, robustInit));
-        ANGLE_TRY(mDepthStencilImage.initMemory(context, renderer->getMemoryProperties(),
-                                                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+angle::Result WindowSurfaceVk::recreateDepthStencilImage(ContextVk *contextVk, bool isTransient)
+{
+    RendererVk *renderer     = contextVk->getRenderer();
+    const VkExtent3D extents = mDepthStencilImage.getExtents();
+    const GLint samples      = mDepthStencilImage.getSamples();
 
-        mDepthStencilRenderTarget.init(&mDepthStencilImage, &mDepthStencilImageViews, nullptr,
-                                       nullptr, gl::LevelIndex(0), 0, 1,
-                                       RenderTargetTransience::Default);
+    mDepthStencilImage.releaseImageFromShareContexts(renderer, contextVk);
+    mDepthStencilImage.releaseStagingBuffer(renderer);
+    mDepthStencilImageViews.release(renderer);
 
-        // We will need to pass depth/stencil image views to the RenderTargetVk in the future.
+    // The framebuffers are recreated with the new image view when next used.
+    if (mFramebufferMS.valid())
+    {
+        contextVk->addGarbage(&mFramebufferMS);
+    }
+    for (impl::SwapchainImage &swapchainImage : mSwapchainImages)
+    {
+        if (swapchainImage.framebuffer.valid())
+        {
+            contextVk->addGarbage(&swapchainImage.framebuffer);
+        }
     }
 
+    mIsDepthStencilTransient = isTransient;
+    ANGLE_TRY(initDepthStencilImage(contextVk, extents, samples,
+                                    mState.isRobustResourceInitEnabled()));
+
+    // Let the default framebuffer pick up the new image.
+    onStateChange(angle::SubjectMessage::SubjectChanged);
+
     return angle::Result::Continue;
 }
 
+angle::Result WindowSurfaceVk::updateDepthStencilTransience(ContextVk *contextVk)
+{
+    // Robust resource initialization clears the image outside of render passes.
+    if (!mDepthStencilImage.valid() || mIsDepthStencilTransient ||
+        mIsDepthStencilTransienceDisallowed ||
+        !contextVk->getFeatures().lazilyAllocateDiscardedDepthStencil.enabled ||
+        !contextVk->getRenderer()->getMemoryProperties().hasLazilyAllocatedMemory() ||
+        mState.isRobustResourceInitEnabled())
+    {
+        return angle::Result::Continue;
+    }
+
+    // The contents are no longer defined if the last render pass of the frame didn't store them,
+    // which is the case if they were invalidated.
+    const bool isDiscarded =
+        !mDepthStencilImage.hasSubresourceDefinedContent(gl::LevelIndex(0), 0, 1) &&
+        !mDepthStencilImage.hasSubresourceDefinedStencilContent(gl::LevelIndex(0), 0, 1);
+    mDiscardedDepthStencilFrameCount = isDiscarded ? mDiscardedDepthStencilFrameCount + 1 : 0;
+
+    if (mDiscardedDepthStencilFrameCount < kDiscardedDepthStencilFrameThreshold)
+    {
+        return angle::Result::Continue;
+    }
+
+    return recreateDepthStencilImage(contextVk, true);
+}
+
+angle::Result WindowSurfaceVk::ensureDepthStencilCopyable(ContextVk *contextVk, bool *recreatedOut)
+{
+    *recreatedOut = false;
+    if (!mIsDepthStencilTransient)
+    {
+        return angle::Result::Continue;
+    }
+
+    // The contents of the transient image can't be copied out, so they are lost.  This only
+    // happens if the application starts reading the depth/stencil buffer after discarding its
+    // contents for many frames, after which it's never made transient again.
+    ANGLE_PERF_WARNING(contextVk->getDebug(), GL_DEBUG_SEVERITY_HIGH,
+                       "Copying transient depth/stencil buffer of the window surface, which loses "
+                       "its contents");
+    mIsDepthStencilTransienceDisallowed = true;
+    *recreatedOut                       = true;
+
+    return recreateDepthStencilImage(contextVk, false);
+}
+
 bool WindowSurfaceVk::isMultiSampled() const
 {
     return mColorImageMS.valid();
@@ -1210,9 +1361,9 @@ void WindowSurfaceVk::destroySwapChainImages(DisplayVk *displayVk)
     VkDevice device      = displayVk->getDevice();
 
     mDepthStencilImage.destroy(renderer);
-    mDepthStencilImageViews.destroy(device);
+    mDepthStencilImageViews.destroy(renderer);
     mColorImageMS.destroy(renderer);
-    mColorImageMSViews.destroy(device);
+    mColorImageMSViews.destroy(renderer);
     mFramebufferMS.destroy(device);
 
     for (SwapchainImage &swapchainImage : mSwapchainImages)
@@ -1220,7 +1371,7 @@ void WindowSurfaceVk::destroySwapChainImages(DisplayVk *displayVk)
         // We don't own the swapchain image handles, so we just remove our reference to it.
         swapchainImage.image.resetImageWeakReference();
         swapchainImage.image.destroy(renderer);
-        swapchainImage.imageViews.destroy(device);
+        swapchainImage.imageViews.destroy(renderer);
         swapchainImage.framebuffer.destroy(device);
 
         for (ImagePresentHistory &presentHistory : swapchainImage.presentHistory)
@@ -1301,16 +1452,27 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
     ANGLE_TRACE_EVENT0("gpu.angle", "WindowSurfaceVk::present");
     RendererVk *renderer = contextVk->getRenderer();
 
-    // Throttle the submissions to avoid getting too far ahead of the GPU.
+    // Throttle the submissions to avoid getting too far ahead of the GPU.  By default, this waits
+    // for the submission of kSwapHistorySize swaps ago.  The renderer may ask for fewer frames in
+    // flight, which waits for a more recent swap instead.  Waiting for an older swap is not
+    // possible, as the present semaphores are recycled based on this wait.
     Serial *swapSerial = &mSwapHistory[mCurrentSwapHistoryIndex];
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "WindowSurfaceVk::present: Throttle CPU");
-        ANGLE_TRY(renderer->finishToSerial(contextVk, *swapSerial));
+        size_t framesInFlight = mSwapHistory.size();
+        if (renderer->getMaxFramesInFlight() != 0)
+        {
+            framesInFlight = std::min<size_t>(renderer->getMaxFramesInFlight(), framesInFlight);
+        }
+        const size_t throttleIndex =
+            (mCurrentSwapHistoryIndex + mSwapHistory.size() - framesInFlight) % mSwapHistory.size();
+        ANGLE_TRY(renderer->finishToSerial(contextVk, mSwapHistory[throttleIndex]));
     }
 
     SwapchainImage &image               = mSwapchainImages[mCurrentSwapchainImageIndex];
     vk::Framebuffer &currentFramebuffer = mSwapchainImages[mCurrentSwapchainImageIndex].framebuffer;
     updateOverlay(contextVk);
+    ANGLE_TRY(contextVk->updateOverlayGpuTimesOnPresent());
     bool overlayHasWidget = overlayHasEnabledWidget(contextVk);
 
     // Make sure deferred clears are applied, if any.
@@ -1470,11 +1632,20 @@ angle::Result WindowSurfaceVk::swapImpl(const gl::Context *context,
 
     bool presentOutOfDate = false;
     ANGLE_TRY(present(contextVk, rects, n_rects, pNextChain, &presentOutOfDate));
+    ANGLE_TRY(updateDepthStencilTransience(contextVk));
 
     if (!presentOutOfDate)
     {
         // Defer acquiring the next swapchain image since the swapchain is not out-of-date.
         deferAcquireNextImage(context);
+
+        // Unless the image should be acquired right away, so that vkAcquireNextImageKHR blocks
+        // here and not in the middle of the next frame.  The framebuffer is still notified of the
+        // new image by deferAcquireNextImage() above.
+        if (contextVk->getFeatures().acquireSwapchainImageAfterPresent.enabled)
+        {
+            ANGLE_TRY(doDeferredAcquireNextImage(context, false));
+        }
     }
     else
     {
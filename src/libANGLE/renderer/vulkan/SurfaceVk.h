@@ -100,9 +100,17 @@ class OffscreenSurfaceVk : public SurfaceVk
 
         void destroy(const egl::Display *display);
 
-        vk::ImageHelper image;
+        // Allocated on the heap so that the image can be handed over to and taken back from the
+        // renderer's SurfaceImagePool.  Never null.
+        std::unique_ptr<vk::ImageHelper> image;
         vk::ImageViewHelper imageViews;
         angle::ObserverBinding imageObserverBinding;
+        // Whether the image was allocated by the surface, as opposed to imported, and can be
+        // returned to the pool.
+        bool isPoolable;
+
+      private:
+        void setImage(std::unique_ptr<vk::ImageHelper> &&newImage);
     };
 
     virtual angle::Result initializeImpl(DisplayVk *displayVk);
@@ -246,6 +254,10 @@ class WindowSurfaceVk : public SurfaceVk
 
     egl::Error getBufferAge(const gl::Context *context, EGLint *age) override;
 
+    // Called before the depth/stencil image is copied to or from, which it can't be if it's
+    // transient.  In that case, it is recreated as a regular image, and |recreatedOut| is set.
+    angle::Result ensureDepthStencilCopyable(ContextVk *contextVk, bool *recreatedOut);
+
   protected:
     angle::Result swapImpl(const gl::Context *context,
                            const EGLint *rects,
@@ -271,6 +283,14 @@ class WindowSurfaceVk : public SurfaceVk
     angle::Result resizeSwapchainImages(vk::Context *context, uint32_t imageCount);
     void releaseSwapchainImages(ContextVk *contextVk);
     void destroySwapChainImages(DisplayVk *displayVk);
+    angle::Result initDepthStencilImage(vk::Context *context,
+                                        const VkExtent3D &extents,
+                                        GLint samples,
+                                        bool robustInit);
+    angle::Result recreateDepthStencilImage(ContextVk *contextVk, bool isTransient);
+    // Makes the depth/stencil image transient once its contents have been discarded at the end of
+    // enough consecutive frames.
+    angle::Result updateDepthStencilTransience(ContextVk *contextVk);
     // This method calls vkAcquireNextImageKHR() to acquire the next swapchain image.  It is called
     // when the swapchain is initially created and when present() finds the swapchain out of date.
     // Otherwise, it is scheduled to be called later by deferAcquireNextImage().
@@ -310,7 +330,8 @@ class WindowSurfaceVk : public SurfaceVk
     VkCompositeAlphaFlagBitsKHR mCompositeAlpha;
 
     // A circular buffer that stores the serial of the submission fence of the context on every
-    // swap. The CPU is throttled by waiting for the 2nd previous serial to finish.
+    // swap. The CPU is throttled by waiting for the 2nd previous serial to finish, or a more recent
+    // one if RendererVk::getMaxFramesInFlight() says so.
     std::array<Serial, impl::kSwapHistorySize> mSwapHistory;
     size_t mCurrentSwapHistoryIndex;
 
@@ -335,6 +356,14 @@ class WindowSurfaceVk : public SurfaceVk
     vk::ImageViewHelper mDepthStencilImageViews;
     angle::ObserverBinding mDepthStencilImageBinding;
 
+    // With lazilyAllocateDiscardedDepthStencil, the depth/stencil image is made transient and
+    // allocated from lazily allocated memory when the application keeps discarding its contents,
+    // so that tiling GPUs never back it with memory.  It is made regular again, permanently, if it
+    // has to be copied to or from.
+    uint32_t mDiscardedDepthStencilFrameCount;
+    bool mIsDepthStencilTransient;
+    bool mIsDepthStencilTransienceDisallowed;
+
     // Multisample color image, view and framebuffer, if multisampling enabled.
     vk::ImageHelper mColorImageMS;
     vk::ImageViewHelper mColorImageMSViews;
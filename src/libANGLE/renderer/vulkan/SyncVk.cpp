@@ -204,7 +204,9 @@ angle::Result SyncHelper::getStatus(Context *context, bool *signaled) const
     return angle::Result::Continue;
 }
 
-SyncHelperNativeFence::SyncHelperNativeFence() : mNativeFenceFd(kInvalidFenceFd) {}
+SyncHelperNativeFence::SyncHelperNativeFence()
+    : mNativeFenceFd(kInvalidFenceFd), mPriority(egl::ContextPriority::Medium)
+{}
 
 SyncHelperNativeFence::~SyncHelperNativeFence()
 {
@@ -240,7 +242,31 @@ angle::Result SyncHelperNativeFence::initializeWithFd(ContextVk *contextVk, int
         return angle::Result::Continue;
     }
 
-    RendererVk *renderer = contextVk->getRenderer();
+    // invalid FD provided by application - create one with fence.
+    /*
+      Spec: "When a fence sync object is created or when an EGL native fence sync
+      object is created with the EGL_SYNC_NATIVE_FENCE_FD_ANDROID attribute set to
+      EGL_NO_NATIVE_FENCE_FD_ANDROID, eglCreateSyncKHR also inserts a fence command
+      into the command stream of the bound client API's current context and associates it
+      with the newly created sync object.
+    */
+    // The sync object is signaled by the serial of the flush of the current pending set of
+    // commands.  Waits and status queries use that serial; the native fence is only created and
+    // exported once the FD is requested, see exportNativeFenceFd().
+    retain(&contextVk->getResourceUseList());
+    ANGLE_TRY(contextVk->flushImpl(nullptr));
+    ASSERT(isRendererSubmission());
+
+    mPriority = contextVk->getPriority();
+
+    return angle::Result::Continue;
+}
+
+angle::Result SyncHelperNativeFence::exportNativeFenceFd(Context *context)
+{
+    ASSERT(isRendererSubmission() && mNativeFenceFd == kInvalidFenceFd);
+
+    RendererVk *renderer = context->getRenderer();
     VkDevice device      = renderer->getDevice();
 
     DeviceScoped<vk::Fence> fence(device);
@@ -257,36 +283,29 @@ angle::Result SyncHelperNativeFence::initializeWithFd(ContextVk *contextVk, int
     fenceCreateInfo.pNext             = &exportCreateInfo;
 
     // Initialize/create a VkFence handle
-    ANGLE_VK_TRY(contextVk, fence.get().init(device, fenceCreateInfo));
-
-    // invalid FD provided by application - create one with fence.
-    /*
-      Spec: "When a fence sync object is created or when an EGL native fence sync
-      object is created with the EGL_SYNC_NATIVE_FENCE_FD_ANDROID attribute set to
-      EGL_NO_NATIVE_FENCE_FD_ANDROID, eglCreateSyncKHR also inserts a fence command
-      into the command stream of the bound client API's current context and associates it
-      with the newly created sync object.
-    */
-    // Flush first because the fence comes after current pending set of commands.
-    ANGLE_TRY(contextVk->flushImpl(nullptr));
+    ANGLE_VK_TRY(context, fence.get().init(device, fenceCreateInfo));
 
-    retain(&contextVk->getResourceUseList());
-
-    Serial serialOut;
+    // The fence is submitted to the same queue after the sync object's submission, so it signals
+    // no earlier than the sync object.
+    //
     // exportFd is exporting VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT_KHR type handle which
     // obeys copy semantics. This means that the fence must already be signaled or the work to
     // signal it is in the graphics pipeline at the time we export the fd. Thus we need to
     // EnsureSubmitted here.
-    ANGLE_TRY(renderer->queueSubmitOneOff(contextVk, vk::PrimaryCommandBuffer(),
-                                          contextVk->getPriority(), &fence.get(),
-                                          vk::SubmitPolicy::EnsureSubmitted, &serialOut));
+    Serial serialOut;
+    ANGLE_TRY(renderer->queueSubmitOneOff(context, vk::PrimaryCommandBuffer(), mPriority,
+                                          &fence.get(), vk::SubmitPolicy::EnsureSubmitted,
+                                          &serialOut));
 
     VkFenceGetFdInfoKHR fenceGetFdInfo = {};
     fenceGetFdInfo.sType               = VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR;
     fenceGetFdInfo.fence               = fence.get().getHandle();
     fenceGetFdInfo.handleType          = VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT_KHR;
-    ANGLE_VK_TRY(contextVk, fence.get().exportFd(device, fenceGetFdInfo, &mNativeFenceFd));
+    ANGLE_VK_TRY(context, fence.get().exportFd(device, fenceGetFdInfo, &mNativeFenceFd));
 
+    // The fence is garbage collected along with the sync object, so it must be kept until the
+    // one-off submission is finished too.
+    mUse.updateSerialOneOff(serialOut);
     mFenceWithFd = fence.release();
 
     return angle::Result::Continue;
@@ -322,7 +341,7 @@ angle::Result SyncHelperNativeFence::clientWait(Context *context,
     }
 
     VkResult status = VK_SUCCESS;
-    if (mUse.valid())
+    if (isRendererSubmission())
     {
         // We have a valid serial to wait on
         ANGLE_TRY(
@@ -335,7 +354,7 @@ angle::Result SyncHelperNativeFence::clientWait(Context *context,
         status = SyncWaitFd(mNativeFenceFd, timeout);
         if (status != VK_TIMEOUT)
         {
-            ANGLE_VK_TRY(contextVk, status);
+            ANGLE_VK_TRY(context, status);
         }
     }
 
@@ -348,6 +367,36 @@ angle::Result SyncHelperNativeFence::serverWait(ContextVk *contextVk)
     RendererVk *renderer = contextVk->getRenderer();
     VkDevice device      = renderer->getDevice();
 
+    if (isRendererSubmission())
+    {
+        if (!isCurrentlyInUse(renderer->getLastCompletedQueueSerial()))
+        {
+            return angle::Result::Continue;
+        }
+
+        // The sync object's submission is already on the queue that this context submits to, and
+        // a pipeline barrier orders against everything earlier in submission order, including the
+        // earlier submissions to the queue.  No semaphore, flush or FD is needed.
+        if (mPriority == contextVk->getPriority())
+        {
+            VkMemoryBarrier memoryBarrier = {};
+            memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memoryBarrier.srcAccessMask   = VK_ACCESS_MEMORY_WRITE_BIT;
+            memoryBarrier.dstAccessMask   = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+            vk::CommandBuffer *commandBuffer;
+            ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer({}, &commandBuffer));
+            commandBuffer->memoryBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, &memoryBarrier);
+            return angle::Result::Continue;
+        }
+
+        if (mNativeFenceFd == kInvalidFenceFd)
+        {
+            ANGLE_TRY(exportNativeFenceFd(contextVk));
+        }
+    }
+
     DeviceScoped<Semaphore> waitSemaphore(device);
     // Wait semaphore for next vkQueueSubmit().
     // Create a Semaphore with imported fenceFd.
@@ -361,8 +410,12 @@ angle::Result SyncHelperNativeFence::serverWait(ContextVk *contextVk)
     importFdInfo.fd                         = dup(mNativeFenceFd);
     ANGLE_VK_TRY(contextVk, waitSemaphore.get().importFd(device, importFdInfo));
 
-    // Flush current work, block after current pending commands.
-    ANGLE_TRY(contextVk->flushImpl(nullptr));
+    // An application provided FD may depend on work that this context hasn't submitted yet, so
+    // flush the current work and only block the commands after it.
+    if (!isRendererSubmission())
+    {
+        ANGLE_TRY(contextVk->flushImpl(nullptr));
+    }
 
     // Add semaphore to next submit job.
     contextVk->addWaitSemaphore(waitSemaphore.get().getHandle(),
@@ -374,7 +427,7 @@ angle::Result SyncHelperNativeFence::serverWait(ContextVk *contextVk)
 angle::Result SyncHelperNativeFence::getStatus(Context *context, bool *signaled) const
 {
     // We've got a serial, check if the serial is still in use
-    if (mUse.valid())
+    if (isRendererSubmission())
     {
         *signaled = !isCurrentlyInUse(context->getRenderer()->getLastCompletedQueueSerial());
         return angle::Result::Continue;
@@ -390,8 +443,13 @@ angle::Result SyncHelperNativeFence::getStatus(Context *context, bool *signaled)
     return angle::Result::Continue;
 }
 
-angle::Result SyncHelperNativeFence::dupNativeFenceFD(Context *context, int *fdOut) const
+angle::Result SyncHelperNativeFence::dupNativeFenceFD(Context *context, int *fdOut)
 {
+    if (isRendererSubmission() && mNativeFenceFd == kInvalidFenceFd)
+    {
+        ANGLE_TRY(exportNativeFenceFd(context));
+    }
+
     if (!mFenceWithFd.valid() || mNativeFenceFd == kInvalidFenceFd)
     {
         return angle::Result::Stop;
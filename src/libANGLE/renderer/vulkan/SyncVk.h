@@ -46,7 +46,7 @@ class SyncHelper : public vk::Resource
                                      VkResult *outResult);
     virtual angle::Result serverWait(ContextVk *contextVk);
     virtual angle::Result getStatus(Context *context, bool *signaled) const;
-    virtual angle::Result dupNativeFenceFD(Context *context, int *fdOut) const
+    virtual angle::Result dupNativeFenceFD(Context *context, int *fdOut)
     {
         return angle::Result::Stop;
     }
@@ -74,11 +74,21 @@ class SyncHelperNativeFence : public SyncHelper
                              VkResult *outResult) override;
     angle::Result serverWait(ContextVk *contextVk) override;
     angle::Result getStatus(Context *context, bool *signaled) const override;
-    angle::Result dupNativeFenceFD(Context *context, int *fdOut) const override;
+    angle::Result dupNativeFenceFD(Context *context, int *fdOut) override;
 
   private:
+    // True if the sync object was created by a submission of this renderer, rather than imported
+    // from an application provided FD.
+    bool isRendererSubmission() const { return mUse.getSerial().valid(); }
+
+    // Submits a fence after the sync object's submission and exports its FD.  Only done when the
+    // FD is needed, since it requires waiting for the submission to reach the queue.
+    angle::Result exportNativeFenceFd(Context *context);
+
     vk::Fence mFenceWithFd;
     int mNativeFenceFd;
+    // The priority of the queue that the sync object's submission went to.
+    egl::ContextPriority mPriority;
 };
 
 }  // namespace vk
@@ -525,6 +525,14 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
     {
         ANGLE_TRY(ensureImageInitialized(contextVk, ImageMipLevels::EnabledLevels));
     }
+    else if (contextVk->getFeatures().transferQueueUploads.enabled && !mRedefinedLevels.any() &&
+             mImage->canFlushStagedUpdatesOnTransferQueue(contextVk))
+    {
+        // Start large uploads to a texture that hasn't been used yet right away on the transfer
+        // queue, so they overlap with rendering instead of being done when the texture is first
+        // used.
+        ANGLE_TRY(mImage->flushStagedUpdatesOnTransferQueue(contextVk));
+    }
 
     return angle::Result::Continue;
 }
@@ -969,6 +977,9 @@ angle::Result TextureVk::copySubImageImplWithTransfer(ContextVk *contextVk,
     // If destination is valid, copy the source directly into it.
     if (mImage->valid() && !shouldUpdateBeStaged(level) && !isSelfCopy)
     {
+        removeStagedUpdatesOverwrittenByCopy(contextVk, level, baseLayer, layerCount,
+                                             destOffsetModified, extents, isDest3D);
+
         // Make sure any updates to the image are already flushed.
         ANGLE_TRY(ensureImageInitialized(contextVk, ImageMipLevels::EnabledLevels));
 
@@ -1134,6 +1145,9 @@ angle::Result TextureVk::copySubImageImplWithDraw(ContextVk *contextVk,
     // If destination is valid, copy the source directly into it.
     if (mImage->valid() && !shouldUpdateBeStaged(level) && !isSelfCopy)
     {
+        removeStagedUpdatesOverwrittenByCopy(contextVk, level, baseLayer, layerCount, destOffset,
+                                             extents, isDest3D);
+
         // Make sure any updates to the image are already flushed.
         ANGLE_TRY(ensureImageInitialized(contextVk, ImageMipLevels::EnabledLevels));
 
@@ -1211,6 +1225,30 @@ angle::Result TextureVk::copySubImageImplWithDraw(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+void TextureVk::removeStagedUpdatesOverwrittenByCopy(ContextVk *contextVk,
+                                                     gl::LevelIndex level,
+                                                     uint32_t baseLayer,
+                                                     uint32_t layerCount,
+                                                     const gl::Offset &destOffset,
+                                                     const gl::Extents &extents,
+                                                     bool isDest3D)
+{
+    // The slices of 3D images are not tracked as layers by the staged updates.
+    if (isDest3D)
+    {
+        return;
+    }
+
+    const gl::Extents levelExtents = mImage->getLevelExtents2D(mImage->toVkLevel(level));
+    if (destOffset.x != 0 || destOffset.y != 0 || extents.width != levelExtents.width ||
+        extents.height != levelExtents.height)
+    {
+        return;
+    }
+
+    mImage->removeStagedUpdatesWithinLayers(contextVk, level, baseLayer, layerCount);
+}
+
 angle::Result TextureVk::setStorage(const gl::Context *context,
                                     gl::TextureType type,
                                     size_t levels,
@@ -1258,6 +1296,23 @@ angle::Result TextureVk::setStorageMultisample(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+GLuint TextureVk::getSparseLevelCount() const
+{
+    // Immutable textures are allocated from level 0, so Vulkan and GL levels are the same.
+    return mImage->getSparseMipTailFirstLevel().get();
+}
+
+angle::Result TextureVk::setPageCommitment(const gl::Context *context,
+                                           GLint level,
+                                           const gl::Box &area,
+                                           bool commit)
+{
+    ContextVk *contextVk = vk::GetImpl(context);
+    ASSERT(isSparse() && mImage->isSparse());
+
+    return mImage->commitSparsePages(contextVk, gl::LevelIndex(level), area, commit);
+}
+
 angle::Result TextureVk::setStorageExternalMemory(const gl::Context *context,
                                                   gl::TextureType type,
                                                   size_t levels,
@@ -1426,6 +1481,14 @@ void TextureVk::initImageUsageFlags(ContextVk *contextVk, const vk::Format &form
         mImageUsageFlags |=
             VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
     }
+
+    // Respecifying a sparse texture would lose the memory bound to its pages, so it's created with
+    // the storage usage that binding it as an image would otherwise add.
+    if (isSparse() && renderer->hasImageFormatFeatureBits(format.actualImageFormatID,
+                                                          VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT))
+    {
+        mImageUsageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
+    }
 }
 
 angle::Result TextureVk::ensureImageAllocated(ContextVk *contextVk, const vk::Format &format)
@@ -1831,6 +1894,11 @@ angle::Result TextureVk::generateMipmap(const gl::Context *context)
     vk::LevelIndex maxLevel  = mImage->toVkLevel(gl::LevelIndex(mState.getMipmapMaxLevel()));
     ASSERT(maxLevel != vk::LevelIndex(0));
 
+    if (renderer->getFeatures().forceCPUPathForGenerateMipmap.enabled)
+    {
+        return generateMipmapsWithCPU(context);
+    }
+
     // If it's possible to generate mipmap in compute, that would give the best possible
     // performance on some hardware.
     if (CanGenerateMipmapWithCompute(renderer, mImage->getType(), mImage->getFormat(),
@@ -1904,6 +1972,14 @@ angle::Result TextureVk::updateBaseMaxLevels(ContextVk *contextVk,
         // actual number of mip levels
         ASSERT(maxLevelChanged);
     }
+    else if (baseLevel >= mImage->getFirstAllocatedLevel() &&
+             maxLevel <= mImage->getLastAllocatedLevel() && !mRedefinedLevels.any())
+    {
+        // The new base and max levels are a subset of the allocated levels, none of which is
+        // incompatibly redefined.  Like with immutable textures, the image views are offset to
+        // the new base level instead of recreating the image and copying the levels back.  This
+        // is typical of apps that stream in the mips of a texture one at a time.
+    }
     else
     {
         respecifyImage = true;
@@ -2446,23 +2522,38 @@ angle::Result TextureVk::syncState(const gl::Context *context,
             mImage->getLevelCount() < getMipLevelCount(ImageMipLevels::EnabledLevels);
     }
 
-    // If generating mipmaps and the image needs to be recreated (not full-mip already, or changed
-    // usage flags), make sure it's recreated.
+    // If generating mipmaps and the image needs to be recreated (not full-mip already, not
+    // starting at the base level, or changed usage flags), make sure it's recreated.
     if (isGenerateMipmap && mImage->valid() &&
         (oldUsageFlags != mImageUsageFlags ||
          (!mState.getImmutableFormat() &&
-          mImage->getLevelCount() != getMipLevelCount(ImageMipLevels::FullMipChain))))
+          (mImage->getLevelCount() != getMipLevelCount(ImageMipLevels::FullMipChain) ||
+           mImage->getFirstAllocatedLevel() != gl::LevelIndex(mState.getEffectiveBaseLevel())))))
     {
         ASSERT(mOwnsImage);
         // Immutable texture is not expected to reach here. The usage flag change should have
         // been handled earlier and level count change should not need to reallocate
         ASSERT(!mState.getImmutableFormat());
 
-        // Flush staged updates to the base level of the image.  Note that updates to the rest of
-        // the levels have already been discarded through the |removeStagedUpdates| call above.
-        ANGLE_TRY(flushImageStagedUpdates(contextVk));
-
-        mImage->stageSelfAsSubresourceUpdates(contextVk, 1, {});
+        // If the base level is about to be entirely overwritten by a staged update, typically
+        // because the application uploaded it right before generating mipmaps, there is nothing
+        // in the image worth preserving.  The upload is then done directly to the new image,
+        // instead of through the old image and back to a buffer.
+        if (!mImage->hasStagedUpdateCoveringLevel(gl::LevelIndex(mState.getEffectiveBaseLevel())))
+        {
+            // Flush staged updates to the base level of the image.  Note that updates to the rest
+            // of the levels have already been discarded through the |removeStagedUpdates| call
+            // above.
+            ANGLE_TRY(flushImageStagedUpdates(contextVk));
+
+            // The base level may not be the first level of the image if it was moved within the
+            // allocated levels.  Only the base level is preserved.
+            vk::LevelIndex baseLevelVk =
+                mImage->toVkLevel(gl::LevelIndex(mState.getEffectiveBaseLevel()));
+            gl::TexLevelMask skipLevelsMask(angle::Bit<uint32_t>(baseLevelVk.get()) - 1);
+            mImage->stageSelfAsSubresourceUpdates(contextVk, baseLevelVk.get() + 1,
+                                                  skipLevelsMask);
+        }
 
         // Release views and render targets created for the old image.
         releaseImage(contextVk);
@@ -2724,6 +2815,15 @@ angle::Result TextureVk::initImage(ContextVk *contextVk,
     gl_vk::GetExtentsAndLayerCount(mState.getType(), firstLevelExtents, &vkExtent, &layerCount);
     GLint samples = mState.getBaseLevelDesc().samples ? mState.getBaseLevelDesc().samples : 1;
 
+    // Sparse textures are also created mutable for the same reason as their storage usage, see
+    // initImageUsageFlags().
+    if (isSparse())
+    {
+        mImageCreateFlags |= VK_IMAGE_CREATE_SPARSE_BINDING_BIT |
+                             VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT |
+                             VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
+    }
+
     bool imageFormatListEnabled = false;
     ANGLE_TRY(mImage->initExternal(
         contextVk, mState.getType(), vkExtent, format, samples, mImageUsageFlags, mImageCreateFlags,
@@ -2732,9 +2832,15 @@ angle::Result TextureVk::initImage(ContextVk *contextVk,
 
     mRequiresMutableStorage = (mImageCreateFlags & VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT) != 0;
 
-    const VkMemoryPropertyFlags flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-
-    ANGLE_TRY(mImage->initMemory(contextVk, renderer->getMemoryProperties(), flags));
+    if (isSparse())
+    {
+        ANGLE_TRY(mImage->initSparseMemory(contextVk));
+    }
+    else
+    {
+        const VkMemoryPropertyFlags flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        ANGLE_TRY(mImage->initMemory(contextVk, renderer->getMemoryProperties(), flags));
+    }
 
     const uint32_t viewLevelCount =
         mState.getImmutableFormat() ? getMipLevelCount(ImageMipLevels::EnabledLevels) : levelCount;
@@ -2889,9 +2995,11 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
             mipLevelExtents, gl::Offset(), &destData, contextVk->getStagingBuffer()));
 
         // Generate the mipmap into that new buffer
-        sourceFormat.mipGenerationFunction(
-            previousLevelWidth, previousLevelHeight, previousLevelDepth, previousLevelData,
-            previousLevelRowPitch, previousLevelDepthPitch, destData, destRowPitch, destDepthPitch);
+        GenerateMipInParallel(contextVk->getRenderer()->getWorkerThreadPool(),
+                              sourceFormat.mipGenerationFunction, previousLevelWidth,
+                              previousLevelHeight, previousLevelDepth, previousLevelData,
+                              previousLevelRowPitch, previousLevelDepthPitch, destData,
+                              destRowPitch, destDepthPitch);
 
         // Swap for the next iteration
         previousLevelWidth      = mipWidth;
@@ -3001,6 +3109,27 @@ vk::ImageOrBufferViewSubresourceSerial TextureVk::getBufferViewSerial() const
     return mBufferViews.getSerial();
 }
 
+vk::ImageOrBufferViewSubresourceSerial TextureVk::getStorageImageViewSerial(
+    const gl::ImageUnit &binding) const
+{
+    gl::LevelIndex nativeLevelGL =
+        getNativeImageLevel(gl::LevelIndex(static_cast<uint32_t>(binding.level)));
+
+    if (binding.layered != GL_TRUE)
+    {
+        uint32_t nativeLayer = getNativeImageLayer(static_cast<uint32_t>(binding.layer));
+        return getImageViews().getSubresourceSerial(nativeLevelGL, 1, nativeLayer,
+                                                    vk::LayerMode::Single,
+                                                    vk::SrgbDecodeMode::SkipDecode,
+                                                    gl::SrgbOverride::Default);
+    }
+
+    uint32_t nativeLayer = getNativeImageLayer(0);
+    return getImageViews().getSubresourceSerial(nativeLevelGL, 1, nativeLayer, vk::LayerMode::All,
+                                                vk::SrgbDecodeMode::SkipDecode,
+                                                gl::SrgbOverride::Default);
+}
+
 angle::Result TextureVk::refreshImageViews(ContextVk *contextVk)
 {
     // We use a special layer count here to handle EGLImages. They might only be
@@ -185,6 +185,12 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
     angle::Result initializeContents(const gl::Context *context,
                                      const gl::ImageIndex &imageIndex) override;
 
+    GLuint getSparseLevelCount() const override;
+    angle::Result setPageCommitment(const gl::Context *context,
+                                    GLint level,
+                                    const gl::Box &area,
+                                    bool commit) override;
+
     const vk::ImageHelper &getImage() const
     {
         ASSERT(mImage && mImage->valid());
@@ -242,6 +248,9 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
     vk::ImageOrBufferViewSubresourceSerial getImageViewSubresourceSerial(
         const gl::SamplerState &samplerState) const;
     vk::ImageOrBufferViewSubresourceSerial getBufferViewSerial() const;
+    // Identifies the view getStorageImageView() returns for |binding|, apart from its format.
+    vk::ImageOrBufferViewSubresourceSerial getStorageImageViewSerial(
+        const gl::ImageUnit &binding) const;
 
     void overrideStagingBufferSizeForTesting(size_t initialSizeForTesting)
     {
@@ -274,6 +283,9 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
     angle::Result ensureMutable(ContextVk *contextVk);
 
   private:
+    // TEXTURE_SPARSE_EXT only applies to the storage that's specified with TexStorage.
+    bool isSparse() const { return mState.getImmutableFormat() && mState.isSparse(); }
+
     // Transform an image index from the frontend into one that can be used on the backing
     // ImageHelper, taking into account mipmap or cube face offsets
     gl::ImageIndex getNativeImageIndex(const gl::ImageIndex &inputImageIndex) const;
@@ -407,6 +419,16 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
                                            const vk::ImageView *srcView,
                                            SurfaceRotation srcFramebufferRotation);
 
+    // Drops the staged updates to the destination of a copy that overwrites the whole level, such
+    // as the robust resource initialization clear of a texture that is first filled by a copy.
+    void removeStagedUpdatesOverwrittenByCopy(ContextVk *contextVk,
+                                              gl::LevelIndex level,
+                                              uint32_t baseLayer,
+                                              uint32_t layerCount,
+                                              const gl::Offset &destOffset,
+                                              const gl::Extents &extents,
+                                              bool isDest3D);
+
     angle::Result initImage(ContextVk *contextVk,
                             const vk::Format &format,
                             const bool sized,
@@ -1488,8 +1488,13 @@ angle::Result UtilsVk::setupProgram(ContextVk *contextVk,
         ANGLE_TRY(program->getGraphicsPipeline(
             contextVk, &contextVk->getRenderPassCache(), *pipelineCache, pipelineLayout.get(),
             *pipelineDesc, gl::AttributesMask(), gl::ComponentTypeMask(), &descPtr, &helper));
+        ANGLE_TRY(helper->waitForCreation(contextVk));
         helper->updateSerial(serial);
         commandBuffer->bindGraphicsPipeline(helper->getPipeline());
+        if (renderer->getFeatures().supportsExtendedDynamicState.enabled)
+        {
+            pipelineDesc->recordExtendedDynamicState(commandBuffer);
+        }
 
         contextVk->invalidateGraphicsPipelineBinding();
     }
@@ -1499,6 +1504,18 @@ angle::Result UtilsVk::setupProgram(ContextVk *contextVk,
         commandBuffer->bindDescriptorSets(pipelineLayout.get(), pipelineBindPoint,
                                           DescriptorSetIndex::Internal, 1, &descriptorSet, 0,
                                           nullptr);
+    }
+
+    if (pushConstants)
+    {
+        commandBuffer->pushConstants(pipelineLayout.get(), pushConstantsShaderStage, 0,
+                                     static_cast<uint32_t>(pushConstantsSize), pushConstants);
+    }
+
+    // Either one disturbs the driver uniforms of the context, which are bound again on the next
+    // draw or dispatch.
+    if (descriptorSet != VK_NULL_HANDLE || pushConstants)
+    {
         if (isCompute)
         {
             contextVk->invalidateComputeDescriptorSet(DescriptorSetIndex::Internal);
@@ -1509,12 +1526,6 @@ angle::Result UtilsVk::setupProgram(ContextVk *contextVk,
         }
     }
 
-    if (pushConstants)
-    {
-        commandBuffer->pushConstants(pipelineLayout.get(), pushConstantsShaderStage, 0,
-                                     static_cast<uint32_t>(pushConstantsSize), pushConstants);
-    }
-
     return angle::Result::Continue;
 }
 
@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 
 #include "common/debug.h"
+#include "common/hash_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
@@ -28,6 +29,9 @@ constexpr size_t kDynamicVertexDataSize   = 1024 * 1024;
 constexpr size_t kDynamicIndexDataSize    = 1024 * 8;
 constexpr size_t kDynamicIndirectDataSize = sizeof(VkDrawIndexedIndirectCommand) * 8;
 
+// Bounds the linear search of the streamed client vertex data for a match.
+constexpr size_t kMaxStreamedVertexDataCacheSize = 32;
+
 ANGLE_INLINE bool BindingIsAligned(const gl::VertexBinding &binding,
                                    const angle::Format &angleFormat,
                                    unsigned int attribSize,
@@ -133,6 +137,40 @@ size_t GetVertexCount(BufferVk *srcBuffer, const gl::VertexBinding &binding, uin
 
     return numVertices;
 }
+
+// Returns the vertices whose source bytes overlap the dirty range of the source buffer, as the
+// half-open range [*firstVertexOut, *endVertexOut).
+void GetDirtyVertexRange(const RangeDeviceSize &dirtyRange,
+                         size_t srcOffset,
+                         size_t srcStride,
+                         size_t srcFormatSize,
+                         size_t numVertices,
+                         size_t *firstVertexOut,
+                         size_t *endVertexOut)
+{
+    // Vertex i reads srcFormatSize bytes from srcOffset + i * srcStride.
+    const VkDeviceSize firstDirtyByte = dirtyRange.low();
+    const VkDeviceSize endDirtyByte   = dirtyRange.high();
+
+    size_t firstVertex = 0;
+    if (firstDirtyByte >= srcOffset + srcFormatSize)
+    {
+        firstVertex =
+            static_cast<size_t>((firstDirtyByte - srcOffset - srcFormatSize) / srcStride) + 1;
+    }
+
+    size_t endVertex = 0;
+    if (endDirtyByte > srcOffset)
+    {
+        const VkDeviceSize dirtyBytes = endDirtyByte - srcOffset;
+        const VkDeviceSize dirtyStrides =
+            dirtyBytes / srcStride + (dirtyBytes % srcStride == 0 ? 0 : 1);
+        endVertex = static_cast<size_t>(std::min<VkDeviceSize>(dirtyStrides, numVertices));
+    }
+
+    *firstVertexOut = std::min(firstVertex, endVertex);
+    *endVertexOut   = endVertex;
+}
 }  // anonymous namespace
 
 VertexArrayVk::VertexArrayVk(ContextVk *contextVk, const gl::VertexArrayState &state)
@@ -143,6 +181,7 @@ VertexArrayVk::VertexArrayVk(ContextVk *contextVk, const gl::VertexArrayState &s
       mCurrentArrayBuffers{},
       mCurrentElementArrayBufferOffset(0),
       mCurrentElementArrayBuffer(nullptr),
+      mStreamedVertexDataCacheBuffer(nullptr),
       mLineLoopHelper(contextVk->getRenderer()),
       mDirtyLineLoopTranslation(true)
 {
@@ -398,24 +437,51 @@ angle::Result VertexArrayVk::convertVertexBufferGPU(ContextVk *contextVk,
 
     ASSERT(GetVertexInputAlignment(vertexFormat, compressed) <= vk::kVertexBufferAlignment);
 
-    // Allocate buffer for results
-    conversion->data.releaseInFlightBuffers(contextVk);
-    ANGLE_TRY(conversion->data.allocate(contextVk, numVertices * destFormatSize, nullptr, nullptr,
-                                        &conversion->lastAllocationOffset, nullptr));
+    const size_t srcOffset      = binding.getOffset() + relativeOffset;
+    const size_t conversionSize = numVertices * destFormatSize;
+
+    // The previous conversion can be patched in place if only some of its vertices changed.  The
+    // shader writes whole 4-byte words, so the converted vertices must not share one.
+    size_t firstVertex = 0;
+    size_t endVertex   = numVertices;
+    if (conversion->lastAllocationSize == conversionSize && destFormatSize % 4 == 0 &&
+        binding.getStride() > 0)
+    {
+        GetDirtyVertexRange(conversion->dirtyRange, srcOffset, binding.getStride(), srcFormatSize,
+                            numVertices, &firstVertex, &endVertex);
+    }
 
     ASSERT(conversion->dirty);
     conversion->dirty = false;
+    conversion->dirtyRange.invalidate();
+
+    if (firstVertex == endVertex)
+    {
+        return angle::Result::Continue;
+    }
+
+    // Converting every vertex goes to a new allocation, so it doesn't wait for the draws that use
+    // the previous conversion.
+    if (endVertex - firstVertex == numVertices)
+    {
+        conversion->data.releaseInFlightBuffers(contextVk);
+        ANGLE_TRY(conversion->data.allocate(contextVk, conversionSize, nullptr, nullptr,
+                                            &conversion->lastAllocationOffset, nullptr));
+        conversion->lastAllocationSize = conversionSize;
+    }
 
     VkDeviceSize srcBufferOffset      = 0;
     vk::BufferHelper *srcBufferHelper = &srcBuffer->getBufferAndOffset(&srcBufferOffset);
 
     UtilsVk::ConvertVertexParameters params;
-    params.vertexCount = numVertices;
+    params.vertexCount = endVertex - firstVertex;
     params.srcFormat   = &srcFormat;
     params.destFormat  = &destFormat;
     params.srcStride   = binding.getStride();
-    params.srcOffset  = binding.getOffset() + relativeOffset + static_cast<size_t>(srcBufferOffset);
-    params.destOffset = static_cast<size_t>(conversion->lastAllocationOffset);
+    params.srcOffset =
+        srcOffset + firstVertex * binding.getStride() + static_cast<size_t>(srcBufferOffset);
+    params.destOffset =
+        static_cast<size_t>(conversion->lastAllocationOffset) + firstVertex * destFormatSize;
 
     ANGLE_TRY(contextVk->getUtils().convertVertexBuffer(
         contextVk, conversion->data.getCurrentBuffer(), srcBufferHelper, params));
@@ -456,8 +522,11 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
         &mCurrentArrayBuffers[attribIndex], &conversion->lastAllocationOffset, 1));
     ANGLE_TRY(srcBuffer->unmapImpl(contextVk));
 
+    // The GPU may still be reading the previous conversion, so it is never patched in place.
     ASSERT(conversion->dirty);
     conversion->dirty = false;
+    conversion->dirtyRange.invalidate();
+    conversion->lastAllocationSize = numVertices * dstFormatSize;
 
     return angle::Result::Continue;
 }
@@ -782,6 +851,14 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
     RendererVk *renderer = contextVk->getRenderer();
     mDynamicVertexData.releaseInFlightBuffers(contextVk);
 
+    // The streamed data is only reused until the next submission, which usually ends the frame.
+    const bool reuseStreamedData = contextVk->getFeatures().reuseStreamedClientVertexData.enabled;
+    if (reuseStreamedData && mStreamedVertexDataCacheSerial != contextVk->getCurrentQueueSerial())
+    {
+        mStreamedVertexDataCache.clear();
+        mStreamedVertexDataCacheSerial = contextVk->getCurrentQueueSerial();
+    }
+
     const auto &attribs  = mState.getVertexAttributes();
     const auto &bindings = mState.getVertexBindings();
 
@@ -830,6 +907,7 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                 {
                     ANGLE_TRY(bufferVk->unmapImpl(contextVk));
                 }
+                updateStreamedVertexDataCacheBuffer(mCurrentArrayBuffers[attribIndex]);
             }
             else
             {
@@ -842,6 +920,7 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                                            vertexFormat.vertexLoadFunction,
                                            &mCurrentArrayBuffers[attribIndex],
                                            &mCurrentArrayBufferOffsets[attribIndex], 1));
+                updateStreamedVertexDataCacheBuffer(mCurrentArrayBuffers[attribIndex]);
             }
         }
         else
@@ -854,10 +933,50 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
             src += startVertex * binding.getStride();
             size_t destOffset = startVertex * stride;
 
-            ANGLE_TRY(StreamVertexData(
-                contextVk, &mDynamicVertexData, src, bytesToAllocate, destOffset, vertexCount,
-                binding.getStride(), stride, vertexFormat.vertexLoadFunction,
-                &mCurrentArrayBuffers[attribIndex], &mCurrentArrayBufferOffsets[attribIndex], 1));
+            // Look for the same client data streamed by a previous draw.  The pointer, range and
+            // format identify the region it was streamed to, and the hash of the data that it
+            // hasn't been modified since.
+            ASSERT(vertexCount > 0);
+            const size_t sourceSize =
+                (vertexCount - 1) * binding.getStride() + attrib.format->pixelBytes;
+            uint64_t sourceHash       = 0;
+            bool isStreamedDataReused = false;
+            if (reuseStreamedData)
+            {
+                sourceHash = angle::ComputeContentHash(src, sourceSize);
+                for (const StreamedVertexData &streamedData : mStreamedVertexDataCache)
+                {
+                    if (streamedData.source == src && streamedData.sourceSize == sourceSize &&
+                        streamedData.sourceHash == sourceHash &&
+                        streamedData.sourceStride == binding.getStride() &&
+                        streamedData.formatID == attrib.format->id &&
+                        streamedData.startVertex == startVertex)
+                    {
+                        mCurrentArrayBuffers[attribIndex]       = mStreamedVertexDataCacheBuffer;
+                        mCurrentArrayBufferOffsets[attribIndex] = streamedData.bufferOffset;
+                        isStreamedDataReused                    = true;
+                        break;
+                    }
+                }
+            }
+
+            if (!isStreamedDataReused)
+            {
+                ANGLE_TRY(StreamVertexData(contextVk, &mDynamicVertexData, src, bytesToAllocate,
+                                           destOffset, vertexCount, binding.getStride(), stride,
+                                           vertexFormat.vertexLoadFunction,
+                                           &mCurrentArrayBuffers[attribIndex],
+                                           &mCurrentArrayBufferOffsets[attribIndex], 1));
+                updateStreamedVertexDataCacheBuffer(mCurrentArrayBuffers[attribIndex]);
+
+                if (reuseStreamedData &&
+                    mStreamedVertexDataCache.size() < kMaxStreamedVertexDataCacheSize)
+                {
+                    mStreamedVertexDataCache.push_back(
+                        {src, sourceSize, sourceHash, binding.getStride(), attrib.format->id,
+                         startVertex, mCurrentArrayBufferOffsets[attribIndex]});
+                }
+            }
         }
 
         mCurrentArrayBufferHandles[attribIndex] =
@@ -867,6 +986,17 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+void VertexArrayVk::updateStreamedVertexDataCacheBuffer(vk::BufferHelper *buffer)
+{
+    // The cached regions are only valid in the current buffer of mDynamicVertexData; the previous
+    // ones are recycled once the GPU is done with them.
+    if (buffer != mStreamedVertexDataCacheBuffer)
+    {
+        mStreamedVertexDataCache.clear();
+        mStreamedVertexDataCacheBuffer = buffer;
+    }
+}
+
 angle::Result VertexArrayVk::handleLineLoop(ContextVk *contextVk,
                                             GLint firstVertex,
                                             GLsizei vertexOrIndexCount,
@@ -135,6 +135,8 @@ class VertexArrayVk : public VertexArrayImpl
                                   size_t attribIndex,
                                   bool bufferOnly);
 
+    void updateStreamedVertexDataCacheBuffer(vk::BufferHelper *buffer);
+
     gl::AttribArray<VkBuffer> mCurrentArrayBufferHandles;
     gl::AttribArray<VkDeviceSize> mCurrentArrayBufferOffsets;
     // The offset into the buffer to the first attrib
@@ -147,6 +149,23 @@ class VertexArrayVk : public VertexArrayImpl
     vk::BufferHelper *mCurrentElementArrayBuffer;
 
     vk::DynamicBuffer mDynamicVertexData;
+
+    // Client vertex data streamed into the current buffer of mDynamicVertexData since the last
+    // submission.  Draws of the same unchanged client data reuse the region it was streamed to.
+    struct StreamedVertexData
+    {
+        const uint8_t *source;
+        size_t sourceSize;
+        uint64_t sourceHash;
+        GLuint sourceStride;
+        angle::FormatID formatID;
+        GLint startVertex;
+        VkDeviceSize bufferOffset;
+    };
+    std::vector<StreamedVertexData> mStreamedVertexDataCache;
+    vk::BufferHelper *mStreamedVertexDataCacheBuffer;
+    Serial mStreamedVertexDataCacheSerial;
+
     vk::DynamicBuffer mDynamicIndexData;
     vk::DynamicBuffer mTranslatedByteIndexData;
     vk::DynamicBuffer mTranslatedByteIndirectData;
@@ -12,6 +12,7 @@
 
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/android/AHBFunctions.h"
+#include "libANGLE/renderer/vulkan/android/HardwareBufferImageSiblingVkAndroid.h"
 
 namespace rx
 {
@@ -21,6 +22,7 @@ class DisplayVkAndroid : public DisplayVk
     DisplayVkAndroid(const egl::DisplayState &state);
 
     egl::Error initialize(egl::Display *display) override;
+    void terminate() override;
 
     bool isValidNativeWindow(EGLNativeWindowType window) const override;
 
@@ -43,11 +45,16 @@ class DisplayVkAndroid : public DisplayVk
     const char *getWSIExtension() const override;
 
     const AHBFunctions &getAHBFunctions() const { return mAHBFunctions; }
+    HardwareBufferImportCache *getHardwareBufferImportCache()
+    {
+        return &mHardwareBufferImportCache;
+    }
 
   private:
     void enableRecordableIfSupported(egl::Config *config);
 
     AHBFunctions mAHBFunctions;
+    HardwareBufferImportCache mHardwareBufferImportCache;
 };
 
 }  // namespace rx
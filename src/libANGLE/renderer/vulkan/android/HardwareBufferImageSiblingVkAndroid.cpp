@@ -8,6 +8,8 @@
 
 #include "libANGLE/renderer/vulkan/android/HardwareBufferImageSiblingVkAndroid.h"
 
+#include <algorithm>
+
 #include "common/android_util.h"
 
 #include "libANGLE/Display.h"
@@ -21,6 +23,9 @@ namespace rx
 
 namespace
 {
+// Enough for the buffer queues of a few video or camera streams.
+constexpr size_t kMaxIdleHardwareBufferImports = 16;
+
 VkImageTiling AhbDescUsageToVkImageTiling(const AHardwareBuffer_Desc &ahbDescription)
 {
     // A note about the choice of OPTIMAL here.
@@ -77,11 +82,9 @@ VkImageTiling AhbDescUsageToVkImageTiling(const AHardwareBuffer_Desc &ahbDescrip
 HardwareBufferImageSiblingVkAndroid::HardwareBufferImageSiblingVkAndroid(EGLClientBuffer buffer)
     : mBuffer(buffer),
       mFormat(GL_NONE),
-      mRenderable(false),
-      mTextureable(false),
-      mYUV(false),
       mSamples(0),
-      mImage(nullptr)
+      mImportCache(nullptr),
+      mImport(nullptr)
 {}
 
 HardwareBufferImageSiblingVkAndroid::~HardwareBufferImageSiblingVkAndroid() {}
@@ -179,26 +182,101 @@ VkImageUsageFlags AhbDescUsageToVkImageUsage(const AHardwareBuffer_Desc &ahbDesc
     return usage;
 }
 
-angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk)
+HardwareBufferImportCache::HardwareBufferImportCache() = default;
+
+HardwareBufferImportCache::~HardwareBufferImportCache()
 {
-    const AHBFunctions &functions = static_cast<DisplayVkAndroid *>(displayVk)->getAHBFunctions();
-    ANGLE_VK_CHECK(displayVk, functions.valid(), VK_ERROR_INITIALIZATION_FAILED);
+    ASSERT(mImports.empty());
+}
 
-    RendererVk *renderer = displayVk->getRenderer();
+void HardwareBufferImportCache::destroy(RendererVk *renderer)
+{
+    // The image siblings have all been destroyed by now.
+    while (!mIdleBuffers.empty())
+    {
+        evict(renderer, mIdleBuffers.front());
+    }
+    ASSERT(mImports.empty());
+}
 
-    struct ANativeWindowBuffer *windowBuffer =
-        angle::android::ClientBufferToANativeWindowBuffer(mBuffer);
+angle::Result HardwareBufferImportCache::acquire(DisplayVk *displayVk,
+                                                 AHardwareBuffer *buffer,
+                                                 const AHardwareBuffer_Desc &description,
+                                                 GLenum internalFormat,
+                                                 const gl::Extents &size,
+                                                 ImportedHardwareBuffer **importOut)
+{
+    auto iter = mImports.find(buffer);
+    if (iter != mImports.end())
+    {
+        ImportedHardwareBuffer *import = iter->second.get();
+        if (import->useCount == 0)
+        {
+            mIdleBuffers.erase(std::find(mIdleBuffers.begin(), mIdleBuffers.end(), buffer));
 
-    int pixelFormat = 0;
-    angle::android::GetANativeWindowBufferProperties(windowBuffer, &mSize.width, &mSize.height,
-                                                     &mSize.depth, &pixelFormat);
-    GLenum internalFormat = angle::android::NativePixelFormatToGLInternalFormat(pixelFormat);
-    mFormat               = gl::Format(internalFormat);
+            // The producer of the buffer has likely written to it since the import was last used.
+            import->image.resetToExternalQueueFamily(VK_QUEUE_FAMILY_FOREIGN_EXT);
+        }
 
-    struct AHardwareBuffer *hardwareBuffer =
-        angle::android::ANativeWindowBufferToAHardwareBuffer(windowBuffer);
+        import->useCount++;
+        *importOut = import;
+        return angle::Result::Continue;
+    }
+
+    std::unique_ptr<ImportedHardwareBuffer> import = std::make_unique<ImportedHardwareBuffer>();
+    import->buffer                                 = buffer;
+    if (importBuffer(displayVk, description, internalFormat, size, import.get()) ==
+        angle::Result::Stop)
+    {
+        import->image.releaseImage(displayVk->getRenderer());
+        return angle::Result::Stop;
+    }
+
+    import->useCount = 1;
+    *importOut       = import.get();
+    mImports.emplace(buffer, std::move(import));
+    return angle::Result::Continue;
+}
+
+void HardwareBufferImportCache::release(RendererVk *renderer, ImportedHardwareBuffer *import)
+{
+    ASSERT(import->useCount > 0);
+    if (--import->useCount > 0)
+    {
+        return;
+    }
+
+    import->image.releaseStagingBuffer(renderer);
+
+    mIdleBuffers.push_back(import->buffer);
+    if (mIdleBuffers.size() > kMaxIdleHardwareBufferImports)
+    {
+        evict(renderer, mIdleBuffers.front());
+    }
+}
+
+void HardwareBufferImportCache::evict(RendererVk *renderer, AHardwareBuffer *buffer)
+{
+    auto iter = mImports.find(buffer);
+    ASSERT(iter != mImports.end() && iter->second->useCount == 0);
+
+    mIdleBuffers.erase(std::find(mIdleBuffers.begin(), mIdleBuffers.end(), buffer));
+
+    // TODO: We need to handle the case that EGLImage used in two context that aren't shared.
+    // https://issuetracker.google.com/169868803
+    iter->second->image.releaseImage(renderer);
+    mImports.erase(iter);
+}
+
+angle::Result HardwareBufferImportCache::importBuffer(DisplayVk *displayVk,
+                                                      const AHardwareBuffer_Desc &description,
+                                                      GLenum internalFormat,
+                                                      const gl::Extents &size,
+                                                      ImportedHardwareBuffer *import)
+{
+    RendererVk *renderer            = displayVk->getRenderer();
+    AHardwareBuffer *hardwareBuffer = import->buffer;
 
-    functions.acquire(hardwareBuffer);
     VkAndroidHardwareBufferFormatPropertiesANDROID bufferFormatProperties;
     bufferFormatProperties.sType =
         VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID;
@@ -221,13 +299,11 @@ angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk
     const angle::Format &imageFormat   = vkFormat.actualImageFormat();
     bool isDepthOrStencilFormat        = imageFormat.hasDepthOrStencilBits();
 
-    // Query AHB description and do the following -
+    // Use the AHB description to do the following -
     // 1. Derive VkImageTiling mode based on AHB usage flags
     // 2. Map AHB usage flags to VkImageUsageFlags
-    AHardwareBuffer_Desc ahbDescription;
-    functions.describe(hardwareBuffer, &ahbDescription);
-    VkImageTiling imageTilingMode = AhbDescUsageToVkImageTiling(ahbDescription);
-    VkImageUsageFlags usage = AhbDescUsageToVkImageUsage(ahbDescription, isDepthOrStencilFormat);
+    VkImageTiling imageTilingMode = AhbDescUsageToVkImageTiling(description);
+    VkImageUsageFlags usage       = AhbDescUsageToVkImageUsage(description, isDepthOrStencilFormat);
 
     if (bufferFormatProperties.format == VK_FORMAT_UNDEFINED)
     {
@@ -251,15 +327,15 @@ angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk
         VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID;
 
     VkExtent3D vkExtents;
-    gl_vk::GetExtent(mSize, &vkExtents);
+    gl_vk::GetExtent(size, &vkExtents);
 
-    mImage = new vk::ImageHelper();
+    vk::ImageHelper *image = &import->image;
 
     // disable robust init for this external image.
     bool robustInitEnabled = false;
 
-    mImage->setTilingMode(imageTilingMode);
-    ANGLE_TRY(mImage->initExternal(
+    image->setTilingMode(imageTilingMode);
+    ANGLE_TRY(image->initExternal(
         displayVk, gl::TextureType::_2D, vkExtents,
         bufferFormatProperties.format == VK_FORMAT_UNDEFINED ? externalVkFormat : vkFormat, 1,
         usage, vk::kVkImageCreateFlagsNone, vk::ImageLayout::ExternalPreInitialized,
@@ -272,7 +348,7 @@ angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk
     VkMemoryDedicatedAllocateInfo dedicatedAllocInfo = {};
     dedicatedAllocInfo.sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
     dedicatedAllocInfo.pNext  = &importHardwareBufferInfo;
-    dedicatedAllocInfo.image  = mImage->getImage().getHandle();
+    dedicatedAllocInfo.image  = image->getImage().getHandle();
     dedicatedAllocInfo.buffer = VK_NULL_HANDLE;
 
     VkMemoryRequirements externalMemoryRequirements = {};
@@ -300,34 +376,65 @@ angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk
         yuvConversionInfo.chromaFilter  = VK_FILTER_NEAREST;
         yuvConversionInfo.components    = bufferFormatProperties.samplerYcbcrConversionComponents;
 
-        ANGLE_TRY(mImage->initExternalMemory(
+        // The conversion itself comes from the renderer's SamplerYcbcrConversionCache, which is
+        // keyed by the external format and so shared with other buffers of the same format.
+        ANGLE_TRY(image->initExternalMemory(
             displayVk, renderer->getMemoryProperties(), externalMemoryRequirements,
             &yuvConversionInfo, &dedicatedAllocInfo, VK_QUEUE_FAMILY_FOREIGN_EXT, flags));
 
-        mYUV = true;
+        import->yuv = true;
     }
     else
     {
-        ANGLE_TRY(mImage->initExternalMemory(
-            displayVk, renderer->getMemoryProperties(), externalMemoryRequirements, nullptr,
-            &dedicatedAllocInfo, VK_QUEUE_FAMILY_FOREIGN_EXT, flags));
+        ANGLE_TRY(image->initExternalMemory(displayVk, renderer->getMemoryProperties(),
+                                            externalMemoryRequirements, nullptr,
+                                            &dedicatedAllocInfo, VK_QUEUE_FAMILY_FOREIGN_EXT,
+                                            flags));
     }
 
     constexpr uint32_t kColorRenderableRequiredBits        = VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT;
     constexpr uint32_t kDepthStencilRenderableRequiredBits = VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT;
-    mRenderable = renderer->hasImageFormatFeatureBits(vkFormat.actualImageFormatID,
-                                                      kColorRenderableRequiredBits) ||
-                  renderer->hasImageFormatFeatureBits(vkFormat.actualImageFormatID,
-                                                      kDepthStencilRenderableRequiredBits);
+    import->renderable = renderer->hasImageFormatFeatureBits(vkFormat.actualImageFormatID,
+                                                             kColorRenderableRequiredBits) ||
+                         renderer->hasImageFormatFeatureBits(vkFormat.actualImageFormatID,
+                                                             kDepthStencilRenderableRequiredBits);
 
     constexpr uint32_t kTextureableRequiredBits =
         VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
-    mTextureable =
+    import->textureable =
         renderer->hasImageFormatFeatureBits(vkFormat.actualImageFormatID, kTextureableRequiredBits);
 
     return angle::Result::Continue;
 }
 
+angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk)
+{
+    DisplayVkAndroid *displayVkAndroid = static_cast<DisplayVkAndroid *>(displayVk);
+    const AHBFunctions &functions      = displayVkAndroid->getAHBFunctions();
+    ANGLE_VK_CHECK(displayVk, functions.valid(), VK_ERROR_INITIALIZATION_FAILED);
+
+    struct ANativeWindowBuffer *windowBuffer =
+        angle::android::ClientBufferToANativeWindowBuffer(mBuffer);
+
+    int pixelFormat = 0;
+    angle::android::GetANativeWindowBufferProperties(windowBuffer, &mSize.width, &mSize.height,
+                                                     &mSize.depth, &pixelFormat);
+    GLenum internalFormat = angle::android::NativePixelFormatToGLInternalFormat(pixelFormat);
+    mFormat               = gl::Format(internalFormat);
+
+    struct AHardwareBuffer *hardwareBuffer =
+        angle::android::ANativeWindowBufferToAHardwareBuffer(windowBuffer);
+
+    functions.acquire(hardwareBuffer);
+
+    AHardwareBuffer_Desc ahbDescription;
+    functions.describe(hardwareBuffer, &ahbDescription);
+
+    mImportCache = displayVkAndroid->getHardwareBufferImportCache();
+    return mImportCache->acquire(displayVk, hardwareBuffer, ahbDescription, internalFormat, mSize,
+                                 &mImport);
+}
+
 void HardwareBufferImageSiblingVkAndroid::onDestroy(const egl::Display *display)
 {
     const AHBFunctions &functions = GetImplAs<DisplayVkAndroid>(display)->getAHBFunctions();
@@ -336,7 +443,7 @@ void HardwareBufferImageSiblingVkAndroid::onDestroy(const egl::Display *display)
     functions.release(angle::android::ANativeWindowBufferToAHardwareBuffer(
         angle::android::ClientBufferToANativeWindowBuffer(mBuffer)));
 
-    ASSERT(mImage == nullptr);
+    ASSERT(mImport == nullptr);
 }
 
 gl::Format HardwareBufferImageSiblingVkAndroid::getFormat() const
@@ -346,17 +453,17 @@ gl::Format HardwareBufferImageSiblingVkAndroid::getFormat() const
 
 bool HardwareBufferImageSiblingVkAndroid::isRenderable(const gl::Context *context) const
 {
-    return mRenderable;
+    return mImport->renderable;
 }
 
 bool HardwareBufferImageSiblingVkAndroid::isTexturable(const gl::Context *context) const
 {
-    return mTextureable;
+    return mImport->textureable;
 }
 
 bool HardwareBufferImageSiblingVkAndroid::isYUV() const
 {
-    return mYUV;
+    return mImport->yuv;
 }
 
 gl::Extents HardwareBufferImageSiblingVkAndroid::getSize() const
@@ -372,18 +479,15 @@ size_t HardwareBufferImageSiblingVkAndroid::getSamples() const
 // ExternalImageSiblingVk interface
 vk::ImageHelper *HardwareBufferImageSiblingVkAndroid::getImage() const
 {
-    return mImage;
+    return mImport != nullptr ? &mImport->image : nullptr;
 }
 
 void HardwareBufferImageSiblingVkAndroid::release(RendererVk *renderer)
 {
-    if (mImage != nullptr)
+    if (mImport != nullptr)
     {
-        // TODO: We need to handle the case that EGLImage used in two context that aren't shared.
-        // https://issuetracker.google.com/169868803
-        mImage->releaseImage(renderer);
-        mImage->releaseStagingBuffer(renderer);
-        SafeDelete(mImage);
+        mImportCache->release(renderer, mImport);
+        mImport = nullptr;
     }
 }
 
@@ -10,11 +10,64 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_ANDROID_HARDWAREBUFFERIMAGESIBLINGVKANDROID_H_
 #define LIBANGLE_RENDERER_VULKAN_ANDROID_HARDWAREBUFFERIMAGESIBLINGVKANDROID_H_
 
+#include <deque>
+#include <unordered_map>
+
+#include <android/hardware_buffer.h>
+
 #include "libANGLE/renderer/vulkan/ImageVk.h"
 
 namespace rx
 {
 
+// The Vulkan image that an AHardwareBuffer is imported as, shared by all the EGL images created
+// from that buffer.
+struct ImportedHardwareBuffer
+{
+    AHardwareBuffer *buffer = nullptr;
+    vk::ImageHelper image;
+
+    bool renderable  = false;
+    bool textureable = false;
+    bool yuv         = false;
+
+    // The number of image siblings that are using the import.
+    uint32_t useCount = 0;
+};
+
+// Video and camera pipelines create EGL images from the same few AHardwareBuffers every frame.
+// Their imports are kept by the display while they're in use, and the most recently used ones
+// are kept for a while after that.  The imported memory holds a reference to the buffer, so a
+// buffer can't be freed and its address reused while its import is cached.
+class HardwareBufferImportCache final : angle::NonCopyable
+{
+  public:
+    HardwareBufferImportCache();
+    ~HardwareBufferImportCache();
+
+    void destroy(RendererVk *renderer);
+
+    angle::Result acquire(DisplayVk *displayVk,
+                          AHardwareBuffer *buffer,
+                          const AHardwareBuffer_Desc &description,
+                          GLenum internalFormat,
+                          const gl::Extents &size,
+                          ImportedHardwareBuffer **importOut);
+    void release(RendererVk *renderer, ImportedHardwareBuffer *import);
+
+  private:
+    angle::Result importBuffer(DisplayVk *displayVk,
+                               const AHardwareBuffer_Desc &description,
+                               GLenum internalFormat,
+                               const gl::Extents &size,
+                               ImportedHardwareBuffer *import);
+    void evict(RendererVk *renderer, AHardwareBuffer *buffer);
+
+    std::unordered_map<AHardwareBuffer *, std::unique_ptr<ImportedHardwareBuffer>> mImports;
+    // The buffers whose imports aren't used by any image sibling, least recently used first.
+    std::deque<AHardwareBuffer *> mIdleBuffers;
+};
+
 class HardwareBufferImageSiblingVkAndroid : public ExternalImageSiblingVk
 {
   public:
@@ -46,12 +99,10 @@ class HardwareBufferImageSiblingVkAndroid : public ExternalImageSiblingVk
     gl::Extents mSize;
     gl::Format mFormat;
 
-    bool mRenderable;
-    bool mTextureable;
-    bool mYUV;
     size_t mSamples;
 
-    vk::ImageHelper *mImage;
+    HardwareBufferImportCache *mImportCache;
+    ImportedHardwareBuffer *mImport;
 };
 
 }  // namespace rx
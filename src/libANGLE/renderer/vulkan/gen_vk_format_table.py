@@ -93,7 +93,7 @@ image_struct_template = "{{{image}, {image_initializer}}}"
 
 image_fallback_template = """{{
 static constexpr ImageFormatInitInfo kInfo[] = {{{image_list}}};
-initImageFallback(renderer, kInfo, ArraySize(kInfo));
+initImageFallback(renderer, kInfo, ArraySize(kInfo), {image_compressed_offset});
 }}"""
 
 buffer_basic_template = """actualBufferFormatID = {buffer};
@@ -204,7 +204,8 @@ def gen_format_case(angle, internal_format, vk_json_data):
     elif len(images) > 1:
         args.update(
             image_template=image_fallback_template,
-            image_list=", ".join(image_struct_template.format(**image_args(i)) for i in images))
+            image_list=", ".join(image_struct_template.format(**image_args(i)) for i in images),
+            image_compressed_offset=images_compressed_offset)
 
     buffers, buffers_compressed_offset = get_formats(angle, "buffer")
     if len(buffers) == 1:
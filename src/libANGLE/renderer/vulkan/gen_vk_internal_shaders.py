@@ -75,7 +75,7 @@ angle::Result GetShader(Context *context,
         return angle::Result::Continue;
     }}
 
-    // Create shader lazily. Access will need to be locked for multi-threading.
+    // Create shader lazily.  The library is shared by all contexts, so the caller holds its lock.
     const CompressedShaderBlob &compressedShaderCode = compressedShaderBlobs[shaderFlags];
     ASSERT(compressedShaderCode.code != nullptr);
 
@@ -129,6 +129,8 @@ template_shader_library_h = u"""// GENERATED FILE - DO NOT EDIT.
 #ifndef LIBANGLE_RENDERER_VULKAN_VK_INTERNAL_SHADERS_AUTOGEN_H_
 #define LIBANGLE_RENDERER_VULKAN_VK_INTERNAL_SHADERS_AUTOGEN_H_
 
+#include <mutex>
+
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
 namespace rx
@@ -151,6 +153,8 @@ class ShaderLibrary final : angle::NonCopyable
     {shader_get_functions_h}
 
   private:
+    std::mutex mMutex;
+
     {shader_tables_h}
 }};
 }}  // namespace vk
@@ -661,6 +665,7 @@ def get_get_function_cpp(shader_and_variation):
 
     definition = 'angle::Result ShaderLibrary::%s' % function_name
     definition += '(Context *context, uint32_t shaderFlags, RefCounted<ShaderAndSerial> **shaderOut)\n{\n'
+    definition += 'std::lock_guard<std::mutex> lock(mMutex);\n'
     definition += 'return GetShader(context, %s, %s, ArraySize(%s), shaderFlags, shaderOut);\n}\n' % (
         member_table_name, constant_table_name, constant_table_name)
 
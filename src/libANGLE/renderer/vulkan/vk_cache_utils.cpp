@@ -14,6 +14,7 @@
 #include "common/vulkan/vk_google_filtering_precision.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/VertexAttribute.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/FramebufferVk.h"
 #include "libANGLE/renderer/vulkan/ProgramVk.h"
@@ -22,6 +23,7 @@
 #include "libANGLE/renderer/vulkan/vk_format_utils.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 
+#include <algorithm>
 #include <type_traits>
 
 namespace rx
@@ -1714,7 +1716,7 @@ void GraphicsPipelineDesc::initDefaults(const ContextVk *contextVk)
 }
 
 angle::Result GraphicsPipelineDesc::initializePipeline(
-    ContextVk *contextVk,
+    Context *context,
     const PipelineCache &pipelineCacheVk,
     const RenderPass &compatibleRenderPass,
     const PipelineLayout &pipelineLayout,
@@ -1728,6 +1730,8 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     const SpecializationConstants &specConsts,
     Pipeline *pipelineOut) const
 {
+    RendererVk *renderer = context->getRenderer();
+
     angle::FixedVector<VkPipelineShaderStageCreateInfo, 5> shaderStages;
     VkPipelineVertexInputStateCreateInfo vertexInputState     = {};
     VkPipelineInputAssemblyStateCreateInfo inputAssemblyState = {};
@@ -1834,7 +1838,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
 
         // Get the corresponding VkFormat for the attrib's format.
         angle::FormatID formatID         = static_cast<angle::FormatID>(packedAttrib.format);
-        const Format &format             = contextVk->getRenderer()->getFormat(formatID);
+        const Format &format             = renderer->getFormat(formatID);
         const angle::Format &angleFormat = format.intendedFormat();
         VkFormat vkFormat                = format.actualBufferVkFormat(packedAttrib.compressed);
 
@@ -1954,7 +1958,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     if (rasterAndMS.bits.rasterizationSamples <= 1 &&
         !rasterAndMS.bits.rasterizationDiscardEnable && !rasterAndMS.bits.alphaToCoverageEnable &&
         !rasterAndMS.bits.alphaToOneEnable && !rasterAndMS.bits.sampleShadingEnable &&
-        contextVk->getFeatures().bresenhamLineRasterization.enabled)
+        renderer->getFeatures().bresenhamLineRasterization.enabled)
     {
         rasterLineState.lineRasterizationMode = VK_LINE_RASTERIZATION_MODE_BRESENHAM_EXT;
         *pNextPtr                             = &rasterLineState;
@@ -1965,7 +1969,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     provokingVertexState.sType =
         VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT;
     // Always set provoking vertex mode to last if available.
-    if (contextVk->getFeatures().provokingVertex.enabled)
+    if (renderer->getFeatures().provokingVertex.enabled)
     {
         provokingVertexState.provokingVertexMode = VK_PROVOKING_VERTEX_MODE_LAST_VERTEX_EXT;
         *pNextPtr                                = &provokingVertexState;
@@ -1979,7 +1983,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     VkPipelineRasterizationDepthClipStateCreateInfoEXT depthClipState = {};
     depthClipState.sType =
         VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT;
-    if (contextVk->getFeatures().depthClamping.enabled)
+    if (renderer->getFeatures().depthClamping.enabled)
     {
         depthClipState.depthClipEnable = VK_TRUE;
         *pNextPtr                      = &depthClipState;
@@ -1988,7 +1992,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
 
     VkPipelineRasterizationStateStreamCreateInfoEXT rasterStreamState = {};
     rasterStreamState.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT;
-    if (contextVk->getFeatures().supportsTransformFeedbackExtension.enabled)
+    if (renderer->getFeatures().supportsTransformFeedbackExtension.enabled)
     {
         rasterStreamState.rasterizationStream = 0;
         rasterState.pNext                     = &rasterLineState;
@@ -2068,8 +2072,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
             // From OpenGL ES clients, this means disabling blending for integer formats.
             if (!angle::Format::Get(mRenderPassDesc[colorIndexGL]).isInt())
             {
-                ASSERT(!contextVk->getRenderer()
-                            ->getFormat(mRenderPassDesc[colorIndexGL])
+                ASSERT(!renderer->getFormat(mRenderPassDesc[colorIndexGL])
                             .actualImageFormat()
                             .isInt());
                 state.blendEnable = VK_TRUE;
@@ -2081,11 +2084,21 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     }
 
     // Dynamic state
-    angle::FixedVector<VkDynamicState, 1> dynamicStateList;
+    angle::FixedVector<VkDynamicState, 8> dynamicStateList;
     if (IsScissorStateDynamic(mScissor))
     {
         dynamicStateList.push_back(VK_DYNAMIC_STATE_SCISSOR);
     }
+    if (renderer->getFeatures().supportsExtendedDynamicState.enabled)
+    {
+        dynamicStateList.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);
+        dynamicStateList.push_back(VK_DYNAMIC_STATE_FRONT_FACE_EXT);
+        dynamicStateList.push_back(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT);
+        dynamicStateList.push_back(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT);
+        dynamicStateList.push_back(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT);
+        dynamicStateList.push_back(VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT);
+        dynamicStateList.push_back(VK_DYNAMIC_STATE_STENCIL_OP_EXT);
+    }
 
     VkPipelineDynamicStateCreateInfo dynamicState = {};
     dynamicState.sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
@@ -2126,11 +2139,39 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     createInfo.basePipelineHandle  = VK_NULL_HANDLE;
     createInfo.basePipelineIndex   = 0;
 
-    ANGLE_VK_TRY(contextVk,
-                 pipelineOut->initGraphics(contextVk->getDevice(), createInfo, pipelineCacheVk));
+    ANGLE_VK_TRY(context,
+                 pipelineOut->initGraphics(context->getDevice(), createInfo, pipelineCacheVk));
     return angle::Result::Continue;
 }
 
+void GraphicsPipelineDesc::recordExtendedDynamicState(CommandBuffer *commandBuffer) const
+{
+    const PackedRasterizationAndMultisampleStateInfo &rasterAndMS =
+        mRasterizationAndMultisampleStateInfo;
+
+    commandBuffer->setCullModeEXT(static_cast<VkCullModeFlags>(rasterAndMS.bits.cullMode));
+    commandBuffer->setFrontFaceEXT(static_cast<VkFrontFace>(rasterAndMS.bits.frontFace));
+    commandBuffer->setDepthTestEnableEXT(
+        static_cast<VkBool32>(mDepthStencilStateInfo.enable.depthTest));
+    commandBuffer->setDepthWriteEnableEXT(
+        static_cast<VkBool32>(mDepthStencilStateInfo.enable.depthWrite));
+    commandBuffer->setDepthCompareOpEXT(static_cast<VkCompareOp>(
+        mDepthStencilStateInfo.depthCompareOpAndSurfaceRotation.depthCompareOp));
+    commandBuffer->setStencilTestEnableEXT(
+        static_cast<VkBool32>(mDepthStencilStateInfo.enable.stencilTest));
+
+    const StencilOps &front = mDepthStencilStateInfo.front.ops;
+    const StencilOps &back  = mDepthStencilStateInfo.back.ops;
+    commandBuffer->setStencilOpEXT(
+        VK_STENCIL_FACE_FRONT_BIT, static_cast<VkStencilOp>(front.fail),
+        static_cast<VkStencilOp>(front.pass), static_cast<VkStencilOp>(front.depthFail),
+        static_cast<VkCompareOp>(front.compare));
+    commandBuffer->setStencilOpEXT(
+        VK_STENCIL_FACE_BACK_BIT, static_cast<VkStencilOp>(back.fail),
+        static_cast<VkStencilOp>(back.pass), static_cast<VkStencilOp>(back.depthFail),
+        static_cast<VkCompareOp>(back.compare));
+}
+
 void GraphicsPipelineDesc::updateVertexInput(GraphicsPipelineTransitionBits *transition,
                                              uint32_t attribIndex,
                                              GLuint stride,
@@ -2801,7 +2842,8 @@ bool operator==(const AttachmentOpsArray &lhs, const AttachmentOpsArray &rhs)
 }
 
 // DescriptorSetLayoutDesc implementation.
-DescriptorSetLayoutDesc::DescriptorSetLayoutDesc() : mPackedDescriptorSetLayout{} {}
+DescriptorSetLayoutDesc::DescriptorSetLayoutDesc() : mPackedDescriptorSetLayout{}, mCreateFlags(0)
+{}
 
 DescriptorSetLayoutDesc::~DescriptorSetLayoutDesc() = default;
 
@@ -2812,13 +2854,14 @@ DescriptorSetLayoutDesc &DescriptorSetLayoutDesc::operator=(const DescriptorSetL
 
 size_t DescriptorSetLayoutDesc::hash() const
 {
-    return angle::ComputeGenericHash(mPackedDescriptorSetLayout);
+    return angle::ComputeGenericHash(mPackedDescriptorSetLayout) ^ mCreateFlags;
 }
 
 bool DescriptorSetLayoutDesc::operator==(const DescriptorSetLayoutDesc &other) const
 {
-    return (memcmp(&mPackedDescriptorSetLayout, &other.mPackedDescriptorSetLayout,
-                   sizeof(mPackedDescriptorSetLayout)) == 0);
+    return mCreateFlags == other.mCreateFlags &&
+           memcmp(&mPackedDescriptorSetLayout, &other.mPackedDescriptorSetLayout,
+                  sizeof(mPackedDescriptorSetLayout)) == 0;
 }
 
 void DescriptorSetLayoutDesc::update(uint32_t bindingIndex,
@@ -2917,8 +2960,6 @@ void PipelineLayoutDesc::updatePushConstantRange(gl::ShaderType shaderType,
                                                  uint32_t offset,
                                                  uint32_t size)
 {
-    ASSERT(shaderType == gl::ShaderType::Vertex || shaderType == gl::ShaderType::Fragment ||
-           shaderType == gl::ShaderType::Geometry || shaderType == gl::ShaderType::Compute);
     PackedPushConstantRange &packed = mPushConstantRanges[shaderType];
     packed.offset                   = offset;
     packed.size                     = size;
@@ -2931,13 +2972,162 @@ const PushConstantRangeArray<PackedPushConstantRange> &PipelineLayoutDesc::getPu
 }
 
 // PipelineHelper implementation.
+// Creates a graphics pipeline on a worker thread.  The desc, shader modules, render pass and
+// pipeline layout are owned by the caches and the program, and are guaranteed to outlive the task
+// because the PipelineHelper waits for it before it's destroyed.  Vulkan errors are saved and
+// reported to the context that waits for the pipeline.
+class CreateGraphicsPipelineTask final : public Context, public angle::Closure
+{
+  public:
+    CreateGraphicsPipelineTask(RendererVk *renderer,
+                               const PipelineCache &pipelineCacheVk,
+                               const RenderPass &compatibleRenderPass,
+                               const PipelineLayout &pipelineLayout,
+                               const gl::AttributesMask &activeAttribLocationsMask,
+                               const gl::ComponentTypeMask &programAttribsTypeMask,
+                               const ShaderModule *vertexModule,
+                               const ShaderModule *fragmentModule,
+                               const ShaderModule *geometryModule,
+                               const ShaderModule *tessControlModule,
+                               const ShaderModule *tessEvaluationModule,
+                               const SpecializationConstants &specConsts,
+                               const GraphicsPipelineDesc &desc)
+        : Context(renderer),
+          mPipelineCacheVk(pipelineCacheVk),
+          mCompatibleRenderPass(compatibleRenderPass),
+          mPipelineLayout(pipelineLayout),
+          mActiveAttribLocationsMask(activeAttribLocationsMask),
+          mProgramAttribsTypeMask(programAttribsTypeMask),
+          mVertexModule(vertexModule),
+          mFragmentModule(fragmentModule),
+          mGeometryModule(geometryModule),
+          mTessControlModule(tessControlModule),
+          mTessEvaluationModule(tessEvaluationModule),
+          mSpecConsts(specConsts),
+          mDesc(desc),
+          mError({VK_SUCCESS, "", "", 0}),
+          mResult(angle::Result::Continue)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "CreateGraphicsPipelineTask::run");
+        mResult = mDesc.initializePipeline(
+            this, mPipelineCacheVk, mCompatibleRenderPass, mPipelineLayout,
+            mActiveAttribLocationsMask, mProgramAttribsTypeMask, mVertexModule, mFragmentModule,
+            mGeometryModule, mTessControlModule, mTessEvaluationModule, mSpecConsts, &mPipeline);
+    }
+
+    // A draw call that waits for the pipeline doesn't need to wait for a worker thread to be free.
+    bool canRunOnWaitingThread() const override { return true; }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        mError.errorCode = result;
+        mError.file      = file;
+        mError.function  = function;
+        mError.line      = line;
+    }
+
+    // Must only be called once the task has finished running.
+    angle::Result getResult(Context *context)
+    {
+        if (mError.errorCode != VK_SUCCESS)
+        {
+            context->handleError(mError.errorCode, mError.file, mError.function, mError.line);
+        }
+        return mResult;
+    }
+
+    Pipeline &getPipeline() { return mPipeline; }
+
+  private:
+    const PipelineCache &mPipelineCacheVk;
+    const RenderPass &mCompatibleRenderPass;
+    const PipelineLayout &mPipelineLayout;
+    gl::AttributesMask mActiveAttribLocationsMask;
+    gl::ComponentTypeMask mProgramAttribsTypeMask;
+    const ShaderModule *mVertexModule;
+    const ShaderModule *mFragmentModule;
+    const ShaderModule *mGeometryModule;
+    const ShaderModule *mTessControlModule;
+    const ShaderModule *mTessEvaluationModule;
+    SpecializationConstants mSpecConsts;
+    const GraphicsPipelineDesc &mDesc;
+
+    Pipeline mPipeline;
+    Error mError;
+    angle::Result mResult;
+};
+
 PipelineHelper::PipelineHelper() = default;
 
 PipelineHelper::~PipelineHelper() = default;
 
 void PipelineHelper::destroy(VkDevice device)
 {
+    finishPendingCreation();
+    mPipeline.destroy(device);
+}
+
+void PipelineHelper::setCreationTask(std::shared_ptr<CreateGraphicsPipelineTask> &&task,
+                                     std::shared_ptr<angle::WaitableEvent> &&event)
+{
+    ASSERT(!mPipeline.valid() && !isCreationPending());
+    mCreationTask  = std::move(task);
+    mCreationEvent = std::move(event);
+    mEvicted       = false;
+}
+
+void PipelineHelper::setPipeline(Pipeline &&pipeline)
+{
+    ASSERT(!mPipeline.valid() && !isCreationPending());
+    mPipeline = std::move(pipeline);
+    mEvicted  = false;
+}
+
+void PipelineHelper::evict(VkDevice device)
+{
+    ASSERT(!isCreationPending());
     mPipeline.destroy(device);
+    mEvicted = true;
+}
+
+angle::Result PipelineHelper::waitForCreation(Context *context)
+{
+    if (!isCreationPending())
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "PipelineHelper::waitForCreation");
+    mCreationEvent->wait();
+
+    // On failure, the task is kept around so the error is reported again if the pipeline is used
+    // by a later draw call.
+    ANGLE_TRY(mCreationTask->getResult(context));
+
+    mPipeline = std::move(mCreationTask->getPipeline());
+    mCreationTask.reset();
+    mCreationEvent.reset();
+
+    return angle::Result::Continue;
+}
+
+void PipelineHelper::finishPendingCreation()
+{
+    if (!isCreationPending())
+    {
+        return;
+    }
+
+    mCreationEvent->wait();
+    mPipeline = std::move(mCreationTask->getPipeline());
+    mCreationTask.reset();
+    mCreationEvent.reset();
 }
 
 void PipelineHelper::addTransition(GraphicsPipelineTransitionBits bits,
@@ -3569,6 +3759,7 @@ void GraphicsPipelineCache::destroy(RendererVk *rendererVk)
     }
 
     mPayload.clear();
+    mLivePipelineCount = 0;
 }
 
 void GraphicsPipelineCache::release(ContextVk *context)
@@ -3576,10 +3767,12 @@ void GraphicsPipelineCache::release(ContextVk *context)
     for (auto &item : mPayload)
     {
         vk::PipelineHelper &pipeline = item.second;
+        pipeline.finishPendingCreation();
         context->addGarbage(&pipeline.getPipeline());
     }
 
     mPayload.clear();
+    mLivePipelineCount = 0;
 }
 
 angle::Result GraphicsPipelineCache::insertPipeline(
@@ -3599,26 +3792,183 @@ angle::Result GraphicsPipelineCache::insertPipeline(
     const vk::GraphicsPipelineDesc **descPtrOut,
     vk::PipelineHelper **pipelineOut)
 {
-    vk::Pipeline newPipeline;
+    // The Serial will be updated outside of this query.
+    auto insertedItem                   = mPayload.emplace(desc, vk::Pipeline());
+    const vk::GraphicsPipelineDesc &key = insertedItem.first->first;
+    vk::PipelineHelper *pipeline        = &insertedItem.first->second;
+
+    if (createPipeline(contextVk, pipelineCacheVk, compatibleRenderPass, pipelineLayout,
+                       activeAttribLocationsMask, programAttribsTypeMask, vertexModule,
+                       fragmentModule, geometryModule, tessControlModule, tessEvaluationModule,
+                       specConsts, key, pipeline) == angle::Result::Stop)
+    {
+        mPayload.erase(insertedItem.first);
+        return angle::Result::Stop;
+    }
+
+    *descPtrOut  = &key;
+    *pipelineOut = pipeline;
 
+    return angle::Result::Continue;
+}
+
+angle::Result GraphicsPipelineCache::createPipeline(
+    ContextVk *contextVk,
+    const vk::PipelineCache &pipelineCacheVk,
+    const vk::RenderPass &compatibleRenderPass,
+    const vk::PipelineLayout &pipelineLayout,
+    const gl::AttributesMask &activeAttribLocationsMask,
+    const gl::ComponentTypeMask &programAttribsTypeMask,
+    const vk::ShaderModule *vertexModule,
+    const vk::ShaderModule *fragmentModule,
+    const vk::ShaderModule *geometryModule,
+    const vk::ShaderModule *tessControlModule,
+    const vk::ShaderModule *tessEvaluationModule,
+    const vk::SpecializationConstants &specConsts,
+    const vk::GraphicsPipelineDesc &desc,
+    vk::PipelineHelper *pipeline)
+{
     // This "if" is left here for the benefit of VulkanPipelineCachePerfTest.
-    if (contextVk != nullptr)
+    if (contextVk == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+
+    contextVk->getRenderer()->onNewGraphicsPipeline();
+
+    if (contextVk->getFeatures().asyncGraphicsPipelineCreation.enabled)
+    {
+        createPipelineAsync(contextVk, pipelineCacheVk, compatibleRenderPass, pipelineLayout,
+                            activeAttribLocationsMask, programAttribsTypeMask, vertexModule,
+                            fragmentModule, geometryModule, tessControlModule,
+                            tessEvaluationModule, specConsts, desc, pipeline);
+    }
+    else
     {
-        contextVk->getRenderer()->onNewGraphicsPipeline();
+        vk::Pipeline newPipeline;
         ANGLE_TRY(desc.initializePipeline(
             contextVk, pipelineCacheVk, compatibleRenderPass, pipelineLayout,
             activeAttribLocationsMask, programAttribsTypeMask, vertexModule, fragmentModule,
             geometryModule, tessControlModule, tessEvaluationModule, specConsts, &newPipeline));
+        pipeline->setPipeline(std::move(newPipeline));
     }
 
-    // The Serial will be updated outside of this query.
-    auto insertedItem = mPayload.emplace(desc, std::move(newPipeline));
-    *descPtrOut       = &insertedItem.first->first;
-    *pipelineOut      = &insertedItem.first->second;
+    ++mLivePipelineCount;
+    evictPipelines(contextVk, pipeline);
 
     return angle::Result::Continue;
 }
 
+void GraphicsPipelineCache::createPipelineAsync(
+    ContextVk *contextVk,
+    const vk::PipelineCache &pipelineCacheVk,
+    const vk::RenderPass &compatibleRenderPass,
+    const vk::PipelineLayout &pipelineLayout,
+    const gl::AttributesMask &activeAttribLocationsMask,
+    const gl::ComponentTypeMask &programAttribsTypeMask,
+    const vk::ShaderModule *vertexModule,
+    const vk::ShaderModule *fragmentModule,
+    const vk::ShaderModule *geometryModule,
+    const vk::ShaderModule *tessControlModule,
+    const vk::ShaderModule *tessEvaluationModule,
+    const vk::SpecializationConstants &specConsts,
+    const vk::GraphicsPipelineDesc &desc,
+    vk::PipelineHelper *pipeline)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+
+    // The map's key is used by the task, as it doesn't move until the entry is erased, which
+    // doesn't happen before the task is finished.
+    auto task = std::make_shared<vk::CreateGraphicsPipelineTask>(
+        renderer, pipelineCacheVk, compatibleRenderPass, pipelineLayout, activeAttribLocationsMask,
+        programAttribsTypeMask, vertexModule, fragmentModule, geometryModule, tessControlModule,
+        tessEvaluationModule, specConsts, desc);
+    std::shared_ptr<angle::WaitableEvent> event = angle::WorkerThreadPool::PostWorkerTask(
+        renderer->getWorkerThreadPool(), task, angle::WorkerTaskPriority::High);
+
+    // The compatible render pass belongs to the context, so the context must wait for the task if
+    // it's destroyed first.
+    contextVk->onGraphicsPipelineCreationPosted(event);
+    pipeline->setCreationTask(std::move(task), std::move(event));
+}
+
+void GraphicsPipelineCache::warmUpPipeline(ContextVk *contextVk,
+                                           const vk::PipelineCache &pipelineCacheVk,
+                                           const vk::RenderPass &compatibleRenderPass,
+                                           const vk::PipelineLayout &pipelineLayout,
+                                           const gl::AttributesMask &activeAttribLocationsMask,
+                                           const gl::ComponentTypeMask &programAttribsTypeMask,
+                                           const vk::ShaderModule *vertexModule,
+                                           const vk::ShaderModule *fragmentModule,
+                                           const vk::ShaderModule *geometryModule,
+                                           const vk::ShaderModule *tessControlModule,
+                                           const vk::ShaderModule *tessEvaluationModule,
+                                           const vk::SpecializationConstants &specConsts,
+                                           const vk::GraphicsPipelineDesc &desc,
+                                           vk::PipelineHelper **pipelineOut)
+{
+    auto item = mPayload.find(desc);
+    if (item != mPayload.end())
+    {
+        *pipelineOut = &item->second;
+        return;
+    }
+
+    auto insertedItem            = mPayload.emplace(desc, vk::Pipeline());
+    vk::PipelineHelper *pipeline = &insertedItem.first->second;
+    *pipelineOut                 = pipeline;
+
+    contextVk->getRenderer()->onNewGraphicsPipeline();
+    createPipelineAsync(contextVk, pipelineCacheVk, compatibleRenderPass, pipelineLayout,
+                        activeAttribLocationsMask, programAttribsTypeMask, vertexModule,
+                        fragmentModule, geometryModule, tessControlModule, tessEvaluationModule,
+                        specConsts, insertedItem.first->first, pipeline);
+
+    ++mLivePipelineCount;
+    evictPipelines(contextVk, pipeline);
+}
+
+void GraphicsPipelineCache::evictPipelines(ContextVk *contextVk,
+                                           const vk::PipelineHelper *newPipeline)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+    size_t limit         = renderer->getGraphicsPipelineCacheLimit();
+    if (limit == 0 || mLivePipelineCount <= limit)
+    {
+        return;
+    }
+
+    // Only pipelines that the GPU has finished using can be destroyed right away.  Evict a quarter
+    // of the cache at a time so that the candidates are not looked for on every new pipeline.
+    Serial lastCompletedSerial = renderer->getLastCompletedQueueSerial();
+    std::vector<vk::PipelineHelper *> candidates;
+    for (auto &item : mPayload)
+    {
+        vk::PipelineHelper *pipeline = &item.second;
+        if (pipeline != newPipeline && !pipeline->isEvicted() && !pipeline->isCreationPending() &&
+            pipeline->getSerial() <= lastCompletedSerial)
+        {
+            candidates.push_back(pipeline);
+        }
+    }
+
+    size_t evictCount = std::min(mLivePipelineCount - (limit - limit / 4), candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + evictCount, candidates.end(),
+                      [](const vk::PipelineHelper *a, const vk::PipelineHelper *b) {
+                          return a->getSerial() < b->getSerial();
+                      });
+
+    VkDevice device = renderer->getDevice();
+    for (size_t index = 0; index < evictCount; ++index)
+    {
+        candidates[index]->evict(device);
+        mCacheStats.evict();
+    }
+
+    mLivePipelineCount -= evictCount;
+    contextVk->getPerfCounters().graphicsPipelineEvictions += static_cast<uint32_t>(evictCount);
+}
+
 void GraphicsPipelineCache::populate(const vk::GraphicsPipelineDesc &desc, vk::Pipeline &&pipeline)
 {
     auto item = mPayload.find(desc);
@@ -3628,6 +3978,7 @@ void GraphicsPipelineCache::populate(const vk::GraphicsPipelineDesc &desc, vk::P
     }
 
     mPayload.emplace(desc, std::move(pipeline));
+    ++mLivePipelineCount;
 }
 
 // DescriptorSetLayoutCache implementation.
@@ -3676,7 +4027,7 @@ angle::Result DescriptorSetLayoutCache::getDescriptorSetLayout(
 
     VkDescriptorSetLayoutCreateInfo createInfo = {};
     createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    createInfo.flags        = 0;
+    createInfo.flags        = desc.getCreateFlags();
     createInfo.bindingCount = static_cast<uint32_t>(bindingVector.size());
     createInfo.pBindings    = bindingVector.data();
 
@@ -13,8 +13,14 @@
 
 #include "common/Color.h"
 #include "common/FixedVector.h"
+#include "libANGLE/renderer/renderer_utils.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
+namespace angle
+{
+class WaitableEvent;
+}  // namespace angle
+
 namespace rx
 {
 
@@ -590,7 +596,7 @@ class GraphicsPipelineDesc final
         return reinterpret_cast<const T *>(this);
     }
 
-    angle::Result initializePipeline(ContextVk *contextVk,
+    angle::Result initializePipeline(Context *context,
                                      const PipelineCache &pipelineCacheVk,
                                      const RenderPass &compatibleRenderPass,
                                      const PipelineLayout &pipelineLayout,
@@ -604,6 +610,11 @@ class GraphicsPipelineDesc final
                                      const SpecializationConstants &specConsts,
                                      Pipeline *pipelineOut) const;
 
+    // With VK_EXT_extended_dynamic_state, cull mode, front face and the depth/stencil test state
+    // are not part of the pipeline.  ContextVk sets these from the GL state and leaves them at
+    // their defaults in the desc, while UtilsVk uses this to set the values from its desc.
+    void recordExtendedDynamicState(CommandBuffer *commandBuffer) const;
+
     // Vertex input state. For ES 3.1 this should be separated into binding and attribute.
     void updateVertexInput(GraphicsPipelineTransitionBits *transition,
                            uint32_t attribIndex,
@@ -792,6 +803,9 @@ class DescriptorSetLayoutDesc final
                 VkShaderStageFlags stages,
                 const Sampler *immutableSampler);
 
+    void setCreateFlags(VkDescriptorSetLayoutCreateFlags flags) { mCreateFlags = flags; }
+    VkDescriptorSetLayoutCreateFlags getCreateFlags() const { return mCreateFlags; }
+
     void unpackBindings(DescriptorSetLayoutBindingVector *bindings,
                         std::vector<VkSampler> *immutableSamplers) const;
 
@@ -814,6 +828,9 @@ class DescriptorSetLayoutDesc final
     // This is a compact representation of a descriptor set layout.
     std::array<PackedDescriptorSetBinding, kMaxDescriptorSetLayoutBindings>
         mPackedDescriptorSetLayout;
+
+    // VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR for the layouts of pushed sets.
+    VkDescriptorSetLayoutCreateFlags mCreateFlags;
 };
 
 // The following are for caching descriptor set layouts. Limited to max four descriptor set layouts.
@@ -935,6 +952,7 @@ static_assert(sizeof(SamplerDesc) == 32, "Unexpected SamplerDesc size");
 // Disable warnings about struct padding.
 ANGLE_DISABLE_STRUCT_PADDING_WARNINGS
 
+class CreateGraphicsPipelineTask;
 class PipelineHelper;
 
 struct GraphicsPipelineTransition
@@ -1000,9 +1018,34 @@ class PipelineHelper final : angle::NonCopyable
     void destroy(VkDevice device);
 
     void updateSerial(Serial serial) { mSerial = serial; }
-    bool valid() const { return mPipeline.valid(); }
+    // A pipeline whose creation is still pending is considered valid.  Its handle is available
+    // after waitForCreation() is called.
+    // Evicted pipelines are still valid cache entries; they are recreated on lookup.
+    bool valid() const { return mPipeline.valid() || isCreationPending() || mEvicted; }
     Serial getSerial() const { return mSerial; }
-    Pipeline &getPipeline() { return mPipeline; }
+    Pipeline &getPipeline()
+    {
+        ASSERT(!isCreationPending());
+        return mPipeline;
+    }
+
+    // Used with the asyncGraphicsPipelineCreation feature, where the pipeline is created on a
+    // worker thread.
+    void setCreationTask(std::shared_ptr<CreateGraphicsPipelineTask> &&task,
+                         std::shared_ptr<angle::WaitableEvent> &&event);
+    bool isCreationPending() const { return mCreationTask != nullptr; }
+    // Null unless the creation is pending.  Signaled once the worker thread is done with it.
+    const std::shared_ptr<angle::WaitableEvent> &getCreationEvent() const { return mCreationEvent; }
+    void setPipeline(Pipeline &&pipeline);
+
+    // Used by GraphicsPipelineCache to destroy the pipeline of an unused entry.  Evicted pipelines
+    // keep their transitions and are recreated the next time they are looked up.
+    void evict(VkDevice device);
+    bool isEvicted() const { return mEvicted; }
+    angle::Result waitForCreation(Context *context);
+    // Waits for any pending creation task and takes ownership of the pipeline it created, ignoring
+    // errors.  Used before the pipeline is released.
+    void finishPendingCreation();
 
     ANGLE_INLINE bool findTransition(GraphicsPipelineTransitionBits bits,
                                      const GraphicsPipelineDesc &desc,
@@ -1029,6 +1072,10 @@ class PipelineHelper final : angle::NonCopyable
     std::vector<GraphicsPipelineTransition> mTransitions;
     Serial mSerial;
     Pipeline mPipeline;
+    bool mEvicted = false;
+
+    std::shared_ptr<CreateGraphicsPipelineTask> mCreationTask;
+    std::shared_ptr<angle::WaitableEvent> mCreationEvent;
 };
 
 ANGLE_INLINE PipelineHelper::PipelineHelper(Pipeline &&pipeline) : mPipeline(std::move(pipeline)) {}
@@ -1396,50 +1443,10 @@ enum class VulkanCacheType
     UniformsAndXfbDescriptors,
     ShaderBuffersDescriptors,
     Framebuffer,
+    ImageView,
     EnumCount
 };
 
-// Base class for all caches. Provides cache hit and miss counters.
-class CacheStats final : angle::NonCopyable
-{
-  public:
-    CacheStats() { reset(); }
-    ~CacheStats() {}
-
-    ANGLE_INLINE void hit() { mHitCount++; }
-    ANGLE_INLINE void miss() { mMissCount++; }
-    ANGLE_INLINE void accumulate(const CacheStats &stats)
-    {
-        mHitCount += stats.mHitCount;
-        mMissCount += stats.mMissCount;
-    }
-
-    uint64_t getHitCount() const { return mHitCount; }
-    uint64_t getMissCount() const { return mMissCount; }
-
-    ANGLE_INLINE double getHitRatio() const
-    {
-        if (mHitCount + mMissCount == 0)
-        {
-            return 0;
-        }
-        else
-        {
-            return static_cast<double>(mHitCount) / (mHitCount + mMissCount);
-        }
-    }
-
-    void reset()
-    {
-        mHitCount  = 0;
-        mMissCount = 0;
-    }
-
-  private:
-    uint64_t mHitCount;
-    uint64_t mMissCount;
-};
-
 template <VulkanCacheType CacheType>
 class HasCacheStats : angle::NonCopyable
 {
@@ -1513,7 +1520,10 @@ class RenderPassCache final : angle::NonCopyable
     CacheStats mRenderPassWithOpsCacheStats;
 };
 
-// TODO(jmadill): Add cache trimming/eviction.
+// When the number of pipelines exceeds RendererVk::getGraphicsPipelineCacheLimit(), the least
+// recently used pipelines that are no longer in use by the GPU are evicted.  Only the VkPipeline is
+// destroyed; the PipelineHelper stays in the cache so pointers to it and transitions to it remain
+// valid, and the pipeline is recreated the next time it's looked up.
 class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::GraphicsPipeline>
 {
   public:
@@ -1525,6 +1535,24 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
 
     void populate(const vk::GraphicsPipelineDesc &desc, vk::Pipeline &&pipeline);
 
+    // Starts creating the pipeline on a worker thread, unless it's already in the cache.  Used to
+    // create the pipelines recorded in a program binary or declared with
+    // GL_ANGLE_prewarm_draw_state before they are first drawn with.
+    void warmUpPipeline(ContextVk *contextVk,
+                        const vk::PipelineCache &pipelineCacheVk,
+                        const vk::RenderPass &compatibleRenderPass,
+                        const vk::PipelineLayout &pipelineLayout,
+                        const gl::AttributesMask &activeAttribLocationsMask,
+                        const gl::ComponentTypeMask &programAttribsTypeMask,
+                        const vk::ShaderModule *vertexModule,
+                        const vk::ShaderModule *fragmentModule,
+                        const vk::ShaderModule *geometryModule,
+                        const vk::ShaderModule *tessControlModule,
+                        const vk::ShaderModule *tessEvaluationModule,
+                        const vk::SpecializationConstants &specConsts,
+                        const vk::GraphicsPipelineDesc &desc,
+                        vk::PipelineHelper **pipelineOut);
+
     ANGLE_INLINE angle::Result getPipeline(ContextVk *contextVk,
                                            const vk::PipelineCache &pipelineCacheVk,
                                            const vk::RenderPass &compatibleRenderPass,
@@ -1546,8 +1574,17 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
         {
             *descPtrOut  = &item->first;
             *pipelineOut = &item->second;
-            mCacheStats.hit();
-            return angle::Result::Continue;
+            if (!item->second.isEvicted())
+            {
+                mCacheStats.hit();
+                return angle::Result::Continue;
+            }
+
+            mCacheStats.miss();
+            return createPipeline(contextVk, pipelineCacheVk, compatibleRenderPass, pipelineLayout,
+                                  activeAttribLocationsMask, programAttribsTypeMask, vertexModule,
+                                  fragmentModule, geometryModule, tessControlModule,
+                                  tessEvaluationModule, specConsts, item->first, &item->second);
         }
 
         mCacheStats.miss();
@@ -1574,7 +1611,42 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
                                  const vk::GraphicsPipelineDesc **descPtrOut,
                                  vk::PipelineHelper **pipelineOut);
 
+    // Creates the pipeline of |pipeline|, whose key in mPayload is |desc|.
+    angle::Result createPipeline(ContextVk *contextVk,
+                                 const vk::PipelineCache &pipelineCacheVk,
+                                 const vk::RenderPass &compatibleRenderPass,
+                                 const vk::PipelineLayout &pipelineLayout,
+                                 const gl::AttributesMask &activeAttribLocationsMask,
+                                 const gl::ComponentTypeMask &programAttribsTypeMask,
+                                 const vk::ShaderModule *vertexModule,
+                                 const vk::ShaderModule *fragmentModule,
+                                 const vk::ShaderModule *geometryModule,
+                                 const vk::ShaderModule *tessControlModule,
+                                 const vk::ShaderModule *tessEvaluationModule,
+                                 const vk::SpecializationConstants &specConsts,
+                                 const vk::GraphicsPipelineDesc &desc,
+                                 vk::PipelineHelper *pipeline);
+
+    void createPipelineAsync(ContextVk *contextVk,
+                             const vk::PipelineCache &pipelineCacheVk,
+                             const vk::RenderPass &compatibleRenderPass,
+                             const vk::PipelineLayout &pipelineLayout,
+                             const gl::AttributesMask &activeAttribLocationsMask,
+                             const gl::ComponentTypeMask &programAttribsTypeMask,
+                             const vk::ShaderModule *vertexModule,
+                             const vk::ShaderModule *fragmentModule,
+                             const vk::ShaderModule *geometryModule,
+                             const vk::ShaderModule *tessControlModule,
+                             const vk::ShaderModule *tessEvaluationModule,
+                             const vk::SpecializationConstants &specConsts,
+                             const vk::GraphicsPipelineDesc &desc,
+                             vk::PipelineHelper *pipeline);
+
+    void evictPipelines(ContextVk *contextVk, const vk::PipelineHelper *newPipeline);
+
     std::unordered_map<vk::GraphicsPipelineDesc, vk::PipelineHelper> mPayload;
+    // The number of pipelines in mPayload that are not evicted.
+    size_t mLivePipelineCount = 0;
 };
 
 class DescriptorSetLayoutCache final : angle::NonCopyable
@@ -443,6 +443,9 @@ void RendererVk::ensureCapsInitialized() const
     // We support getting image data for Textures and Renderbuffers.
     mNativeExtensions.getImageANGLE = true;
 
+    // Pipelines can be created ahead of the draw calls that need them.
+    mNativeExtensions.prewarmDrawStateANGLE = true;
+
     // Implemented in the translator
     mNativeExtensions.shaderNonConstGlobalInitializersEXT = true;
 
@@ -925,6 +928,18 @@ void RendererVk::ensureCapsInitialized() const
             LimitToInt(limitsVk.minTexelBufferOffsetAlignment);
     }
 
+    // GL_EXT_sparse_texture.  Only 2D and 2D array textures have virtual page sizes, through the
+    // sparseResidencyImage2D feature.  The mip tail of array textures is bound per layer, so
+    // sparseTextureFullArrayCubeMipmaps doesn't need sparseResidencyAliased or a single mip tail.
+    if (mFeatures.supportsSparseTexture.enabled)
+    {
+        mNativeExtensions.sparseTextureEXT            = true;
+        mNativeCaps.maxSparseTextureSize              = mNativeCaps.max2DTextureSize;
+        mNativeCaps.maxSparse3DTextureSize            = mNativeCaps.max3DTextureSize;
+        mNativeCaps.maxSparseArrayTextureLayers       = mNativeCaps.maxArrayTextureLayers;
+        mNativeCaps.sparseTextureFullArrayCubeMipmaps = true;
+    }
+
     // Atomic image operations in the vertex and fragment shaders require the
     // vertexPipelineStoresAndAtomics and fragmentStoresAndAtomics Vulkan features respectively.
     // If either of these features is not present, the number of image uniforms for that stage is
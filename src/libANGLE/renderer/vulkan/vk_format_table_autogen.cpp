@@ -731,7 +731,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::D24_UNORM_S8_UINT, nullptr},
                     {angle::FormatID::D32_FLOAT_S8X24_UINT, nullptr},
                     {angle::FormatID::D24_UNORM_S8_UINT, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 3);
             }
             actualBufferFormatID         = angle::FormatID::D24_UNORM_S8_UINT;
             vkBufferFormatIsPacked       = false;
@@ -746,7 +746,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::D24_UNORM_X8_UINT, nullptr},
                     {angle::FormatID::D24_UNORM_S8_UINT, nullptr},
                     {angle::FormatID::D32_FLOAT_S8X24_UINT, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 3);
             }
             actualBufferFormatID         = angle::FormatID::D24_UNORM_X8_UINT;
             vkBufferFormatIsPacked       = true;
@@ -771,7 +771,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::D32_FLOAT_S8X24_UINT, nullptr},
                     {angle::FormatID::D24_UNORM_S8_UINT, nullptr},
                     {angle::FormatID::D32_FLOAT_S8X24_UINT, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 3);
             }
             actualBufferFormatID         = angle::FormatID::D32_FLOAT_S8X24_UINT;
             vkBufferFormatIsPacked       = false;
@@ -785,7 +785,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::D24_UNORM_S8_UINT, nullptr},
                     {angle::FormatID::D32_FLOAT, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::NONE;
             vkBufferFormatIsPacked       = false;
@@ -799,8 +799,9 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::EAC_R11G11_SNORM_BLOCK, nullptr},
                     {angle::FormatID::R16G16_SNORM, nullptr},
-                    {angle::FormatID::R16G16_FLOAT, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                    {angle::FormatID::R16G16_FLOAT, nullptr},
+                    {angle::FormatID::BC5_RG_SNORM_BLOCK, nullptr}};
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 3);
             }
             actualBufferFormatID         = angle::FormatID::EAC_R11G11_SNORM_BLOCK;
             vkBufferFormatIsPacked       = false;
@@ -814,8 +815,9 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::EAC_R11G11_UNORM_BLOCK, nullptr},
                     {angle::FormatID::R16G16_UNORM, nullptr},
-                    {angle::FormatID::R16G16_FLOAT, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                    {angle::FormatID::R16G16_FLOAT, nullptr},
+                    {angle::FormatID::BC5_RG_UNORM_BLOCK, nullptr}};
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 3);
             }
             actualBufferFormatID         = angle::FormatID::EAC_R11G11_UNORM_BLOCK;
             vkBufferFormatIsPacked       = false;
@@ -829,8 +831,9 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::EAC_R11_SNORM_BLOCK, nullptr},
                     {angle::FormatID::R16_SNORM, nullptr},
-                    {angle::FormatID::R16_FLOAT, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                    {angle::FormatID::R16_FLOAT, nullptr},
+                    {angle::FormatID::BC4_RED_SNORM_BLOCK, nullptr}};
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 3);
             }
             actualBufferFormatID         = angle::FormatID::EAC_R11_SNORM_BLOCK;
             vkBufferFormatIsPacked       = false;
@@ -844,8 +847,9 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::EAC_R11_UNORM_BLOCK, nullptr},
                     {angle::FormatID::R16_UNORM, nullptr},
-                    {angle::FormatID::R16_FLOAT, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                    {angle::FormatID::R16_FLOAT, nullptr},
+                    {angle::FormatID::BC4_RED_UNORM_BLOCK, nullptr}};
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 3);
             }
             actualBufferFormatID         = angle::FormatID::EAC_R11_UNORM_BLOCK;
             vkBufferFormatIsPacked       = false;
@@ -864,7 +868,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::ETC2_R8G8B8_UNORM_BLOCK, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM,
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0xFF>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::NONE;
             vkBufferFormatIsPacked       = false;
@@ -878,7 +882,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::ETC2_R8G8B8A1_SRGB_BLOCK, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM_SRGB, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::ETC2_R8G8B8A1_SRGB_BLOCK;
             vkBufferFormatIsPacked       = false;
@@ -894,7 +898,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0xFF>},
                     {angle::FormatID::R8G8B8A8_UNORM,
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0xFF>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::ETC2_R8G8B8A1_UNORM_BLOCK;
             vkBufferFormatIsPacked       = false;
@@ -907,8 +911,9 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::ETC2_R8G8B8A8_SRGB_BLOCK, nullptr},
-                    {angle::FormatID::R8G8B8A8_UNORM_SRGB, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                    {angle::FormatID::R8G8B8A8_UNORM_SRGB, nullptr},
+                    {angle::FormatID::BC3_RGBA_UNORM_SRGB_BLOCK, nullptr}};
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::ETC2_R8G8B8A8_SRGB_BLOCK;
             vkBufferFormatIsPacked       = false;
@@ -921,8 +926,9 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
             {
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::ETC2_R8G8B8A8_UNORM_BLOCK, nullptr},
-                    {angle::FormatID::R8G8B8A8_UNORM, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                    {angle::FormatID::R8G8B8A8_UNORM, nullptr},
+                    {angle::FormatID::BC3_RGBA_UNORM_BLOCK, nullptr}};
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::ETC2_R8G8B8A8_UNORM_BLOCK;
             vkBufferFormatIsPacked       = false;
@@ -937,7 +943,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::ETC2_R8G8B8_SRGB_BLOCK, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM_SRGB,
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0xFF>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::ETC2_R8G8B8_SRGB_BLOCK;
             vkBufferFormatIsPacked       = false;
@@ -952,7 +958,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::ETC2_R8G8B8_UNORM_BLOCK, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM,
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0xFF>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::ETC2_R8G8B8_UNORM_BLOCK;
             vkBufferFormatIsPacked       = false;
@@ -1253,7 +1259,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::R16G16B16_FLOAT, nullptr},
                     {angle::FormatID::R16G16B16A16_FLOAT,
                      Initialize4ComponentData<GLhalf, 0x0000, 0x0000, 0x0000, gl::Float16One>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             {
                 static constexpr BufferFormatInitInfo kInfo[] = {
@@ -1272,7 +1278,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::R16G16B16_SINT, nullptr},
                     {angle::FormatID::R16G16B16A16_SINT,
                      Initialize4ComponentData<GLshort, 0x0000, 0x0000, 0x0000, 0x0001>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             {
                 static constexpr BufferFormatInitInfo kInfo[] = {
@@ -1327,7 +1333,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::R16G16B16_UINT, nullptr},
                     {angle::FormatID::R16G16B16A16_UINT,
                      Initialize4ComponentData<GLushort, 0x0000, 0x0000, 0x0000, 0x0001>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             {
                 static constexpr BufferFormatInitInfo kInfo[] = {
@@ -1635,7 +1641,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::R32G32B32A32_FLOAT,
                      Initialize4ComponentData<GLfloat, 0x00000000, 0x00000000, 0x00000000,
                                               gl::Float32One>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             {
                 static constexpr BufferFormatInitInfo kInfo[] = {
@@ -1657,7 +1663,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::R32G32B32A32_SINT,
                      Initialize4ComponentData<GLint, 0x00000000, 0x00000000, 0x00000000,
                                               0x00000001>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::R32G32B32_SINT;
             vkBufferFormatIsPacked       = false;
@@ -1691,7 +1697,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::R32G32B32A32_UINT,
                      Initialize4ComponentData<GLuint, 0x00000000, 0x00000000, 0x00000000,
                                               0x00000001>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::R32G32B32_UINT;
             vkBufferFormatIsPacked       = false;
@@ -1881,7 +1887,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::R4G4B4A4_UNORM, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::R4G4B4A4_UNORM;
             vkBufferFormatIsPacked       = true;
@@ -1895,7 +1901,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                 static constexpr ImageFormatInitInfo kInfo[] = {
                     {angle::FormatID::R5G5B5A1_UNORM, nullptr},
                     {angle::FormatID::A1R5G5B5_UNORM, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::R5G5B5A1_UNORM;
             vkBufferFormatIsPacked       = true;
@@ -2006,7 +2012,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::R8G8B8_SINT, nullptr},
                     {angle::FormatID::R8G8B8A8_SINT,
                      Initialize4ComponentData<GLbyte, 0x00, 0x00, 0x00, 0x01>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             {
                 static constexpr BufferFormatInitInfo kInfo[] = {
@@ -2025,7 +2031,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::R8G8B8_SNORM, nullptr},
                     {angle::FormatID::R8G8B8A8_SNORM,
                      Initialize4ComponentData<GLbyte, 0x00, 0x00, 0x00, 0x7F>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             {
                 static constexpr BufferFormatInitInfo kInfo[] = {
@@ -2060,7 +2066,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::R8G8B8_UINT, nullptr},
                     {angle::FormatID::R8G8B8A8_UINT,
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0x01>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             {
                 static constexpr BufferFormatInitInfo kInfo[] = {
@@ -2090,7 +2096,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::R8G8B8_UNORM_SRGB, nullptr},
                     {angle::FormatID::R8G8B8A8_UNORM_SRGB,
                      Initialize4ComponentData<GLubyte, 0x00, 0x00, 0x00, 0xFF>}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 2);
             }
             actualBufferFormatID         = angle::FormatID::R8G8B8_UNORM_SRGB;
             vkBufferFormatIsPacked       = false;
@@ -2288,7 +2294,7 @@ void Format::initialize(RendererVk *renderer, const angle::Format &angleFormat)
                     {angle::FormatID::D24_UNORM_S8_UINT, nullptr},
                     {angle::FormatID::D32_FLOAT_S8X24_UINT, nullptr},
                     {angle::FormatID::S8_UINT, nullptr}};
-                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+                initImageFallback(renderer, kInfo, ArraySize(kInfo), 4);
             }
             actualBufferFormatID         = angle::FormatID::S8_UINT;
             vkBufferFormatIsPacked       = false;
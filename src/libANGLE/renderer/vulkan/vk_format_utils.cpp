@@ -62,6 +62,44 @@ void FillTextureFormatCaps(RendererVk *renderer,
                                    &outTextureCaps->sampleCounts);
         }
     }
+
+    // Sparse textures are only supported for color formats, with a single page size that's the
+    // granularity of the image's color aspect.
+    if (renderer->getFeatures().supportsSparseTexture.enabled && outTextureCaps->texturable &&
+        !hasDepthAttachmentFeatureBit && !angle::Format::Get(formatID).isBlock)
+    {
+        VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+                                  VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        if (hasColorAttachmentFeatureBit)
+        {
+            usage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        }
+
+        const VkPhysicalDevice physicalDevice = renderer->getPhysicalDevice();
+        const VkFormat vkFormat               = vk::GetVkFormatFromFormatID(formatID);
+
+        uint32_t propertyCount = 0;
+        vkGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, vkFormat, VK_IMAGE_TYPE_2D,
+                                                       VK_SAMPLE_COUNT_1_BIT, usage,
+                                                       VK_IMAGE_TILING_OPTIMAL, &propertyCount,
+                                                       nullptr);
+        std::vector<VkSparseImageFormatProperties> properties(propertyCount);
+        vkGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, vkFormat, VK_IMAGE_TYPE_2D,
+                                                       VK_SAMPLE_COUNT_1_BIT, usage,
+                                                       VK_IMAGE_TILING_OPTIMAL, &propertyCount,
+                                                       properties.data());
+
+        for (const VkSparseImageFormatProperties &property : properties)
+        {
+            if ((property.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) != 0 &&
+                (property.flags & VK_SPARSE_IMAGE_FORMAT_NONSTANDARD_BLOCK_SIZE_BIT) == 0)
+            {
+                outTextureCaps->sparsePageSize =
+                    gl::Extents(static_cast<int>(property.imageGranularity.width),
+                                static_cast<int>(property.imageGranularity.height), 1);
+            }
+        }
+    }
 }
 
 bool HasFullBufferFormatSupport(RendererVk *renderer, angle::FormatID formatID)
@@ -136,7 +174,10 @@ Format::Format()
       vkFormatIsUnsigned(false)
 {}
 
-void Format::initImageFallback(RendererVk *renderer, const ImageFormatInitInfo *info, int numInfo)
+void Format::initImageFallback(RendererVk *renderer,
+                               const ImageFormatInitInfo *info,
+                               int numInfo,
+                               int compressedStartIndex)
 {
     size_t skip                 = renderer->getFeatures().forceFallbackFormat.enabled ? 1 : 0;
     SupportTest testFunction    = HasFullTextureFormatSupport;
@@ -156,7 +197,22 @@ void Format::initImageFallback(RendererVk *renderer, const ImageFormatInitInfo *
         // Compressed textures also need to perform this check.
         testFunction = HasNonRenderableTextureFormatSupport;
     }
-    int i = FindSupportedFormat(renderer, info, skip, static_cast<uint32_t>(numInfo), testFunction);
+    int i = FindSupportedFormat(renderer, info, skip, compressedStartIndex, testFunction);
+
+    // If the intended format is emulated, a compressed fallback is preferred over decompressing
+    // the data when transcoding is enabled.
+    if (i > 0 && renderer->getFeatures().transcodeEtcToBc.enabled)
+    {
+        for (int compressedIndex = compressedStartIndex; compressedIndex < numInfo;
+             ++compressedIndex)
+        {
+            if (HasNonRenderableTextureFormatSupport(renderer, info[compressedIndex].format))
+            {
+                i = compressedIndex;
+                break;
+            }
+        }
+    }
 
     actualImageFormatID      = info[i].format;
     imageInitializerFunction = info[i].initializer;
@@ -119,7 +119,10 @@ struct Format final : private angle::NonCopyable
     void initialize(RendererVk *renderer, const angle::Format &angleFormat);
 
     // These are used in the format table init.
-    void initImageFallback(RendererVk *renderer, const ImageFormatInitInfo *info, int numInfo);
+    void initImageFallback(RendererVk *renderer,
+                           const ImageFormatInitInfo *info,
+                           int numInfo,
+                           int compressedStartIndex);
     void initBufferFallback(RendererVk *renderer,
                             const BufferFormatInitInfo *fallbackInfo,
                             int numInfo,
@@ -606,36 +606,15 @@ void DestroyImageViews(ImageViewVector *imageViewVector, VkDevice device)
     imageViewVector->clear();
 }
 
-ImageView *GetLevelImageView(ImageViewVector *imageViews, LevelIndex levelVk, uint32_t levelCount)
+// Packs the descriptor of a cached draw or storage view.  Layers past the 20 bits of the key are
+// not addressable by the GL anyway.
+uint32_t GetCachedImageViewKey(uint32_t kind,
+                               LayerMode layerMode,
+                               LevelIndex levelVk,
+                               uint32_t layer)
 {
-    // Lazily allocate the storage for image views. We allocate the full level count because we
-    // don't want to trigger any std::vector reallocations. Reallocations could invalidate our
-    // view pointers.
-    if (imageViews->empty())
-    {
-        imageViews->resize(levelCount);
-    }
-    ASSERT(imageViews->size() > levelVk.get());
-
-    return &(*imageViews)[levelVk.get()];
-}
-
-ImageView *GetLevelLayerImageView(LayerLevelImageViewVector *imageViews,
-                                  LevelIndex levelVk,
-                                  uint32_t layer,
-                                  uint32_t levelCount,
-                                  uint32_t layerCount)
-{
-    // Lazily allocate the storage for image views. We allocate the full layer count because we
-    // don't want to trigger any std::vector reallocations. Reallocations could invalidate our
-    // view pointers.
-    if (imageViews->empty())
-    {
-        imageViews->resize(layerCount);
-    }
-    ASSERT(imageViews->size() > layer);
-
-    return GetLevelImageView(&(*imageViews)[layer], levelVk, levelCount);
+    ASSERT(kind < (1u << 2) && levelVk.get() < (1u << 6) && layer < (1u << 20));
+    return kind | (layerMode == LayerMode::Single ? 1u << 2 : 0) | levelVk.get() << 3 | layer << 9;
 }
 
 // Special rules apply to VkBufferImageCopy with depth/stencil. The components are tightly packed
@@ -754,9 +733,8 @@ bool CanCopyWithTransformForReadPixels(const PackPixelsParams &packPixelsParams,
     // Only allow copies to PBOs with identical format.
     const bool isSameFormatCopy = *readFormat == *packPixelsParams.destFormat;
 
-    // Disallow any transformation.
-    const bool needsTransformation =
-        packPixelsParams.rotation != SurfaceRotation::Identity || packPixelsParams.reverseRowOrder;
+    // Disallow rotation.  Reversing the row order is done by copying each row separately.
+    const bool needsTransformation = packPixelsParams.rotation != SurfaceRotation::Identity;
 
     // Disallow copies when the output pitch cannot be correctly specified in Vulkan.
     const bool isPitchMultipleOfTexelSize =
@@ -766,13 +744,92 @@ bool CanCopyWithTransformForReadPixels(const PackPixelsParams &packPixelsParams,
            isPitchMultipleOfTexelSize;
 }
 
-void ReleaseBufferListToRenderer(RendererVk *renderer, BufferHelperPointerVector *buffers)
+// Whether a format conversion needed by ReadPixels to a PBO can be done with a blit to a staging
+// image in the destination format, which is then copied to the PBO.
+bool CanBlitForReadPixels(RendererVk *renderer,
+                          const PackPixelsParams &packPixelsParams,
+                          const vk::Format *imageFormat,
+                          VkImageAspectFlagBits copyAspectFlags)
 {
-    for (std::unique_ptr<BufferHelper> &toFree : *buffers)
+    const angle::Format &srcFormat  = imageFormat->actualImageFormat();
+    const angle::Format &destFormat = *packPixelsParams.destFormat;
+    const vk::Format &destVkFormat  = renderer->getFormat(destFormat.id);
+
+    // Blits between integer formats, or between sRGB and linear formats, don't preserve the
+    // values glReadPixels is expected to return.
+    const bool isCompatibleConversion = copyAspectFlags == VK_IMAGE_ASPECT_COLOR_BIT &&
+                                        !srcFormat.isInt() && !destFormat.isInt() &&
+                                        srcFormat.isSRGB == destFormat.isSRGB;
+
+    const bool isDestFormatNative = destVkFormat.valid() && !destVkFormat.hasEmulatedImageFormat();
+
+    return !imageFormat->hasEmulatedImageFormat() && isCompatibleConversion &&
+           isDestFormatNative && packPixelsParams.rotation == SurfaceRotation::Identity &&
+           packPixelsParams.outputPitch % destFormat.pixelBytes == 0 &&
+           renderer->hasImageFormatFeatureBits(srcFormat.id, VK_FORMAT_FEATURE_BLIT_SRC_BIT) &&
+           renderer->hasImageFormatFeatureBits(destFormat.id, VK_FORMAT_FEATURE_BLIT_DST_BIT |
+                                                                  VK_FORMAT_FEATURE_TRANSFER_SRC_BIT);
+}
+
+// Copies an area of the image to a PBO whose format matches the image's.  If the rows need to be
+// reversed, each row is a separate region.
+angle::Result CopyImageToPackBuffer(ContextVk *contextVk,
+                                    const PackPixelsParams &packPixelsParams,
+                                    ImageHelper *src,
+                                    VkImageAspectFlags copyAspectFlags,
+                                    const VkOffset3D &srcOffset,
+                                    const VkExtent3D &srcExtent,
+                                    const VkImageSubresourceLayers &srcSubresource,
+                                    bool reverseRowOrder,
+                                    const angle::Format &readFormat,
+                                    void *pixels)
+{
+    VkDeviceSize packBufferOffset = 0;
+    BufferHelper &packBuffer =
+        GetImpl(packPixelsParams.packBuffer)->getBufferAndOffset(&packBufferOffset);
+
+    CommandBufferAccess copyAccess;
+    copyAccess.onBufferTransferWrite(&packBuffer);
+    copyAccess.onImageTransferRead(copyAspectFlags, src);
+
+    CommandBuffer *copyCommandBuffer;
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(copyAccess, &copyCommandBuffer));
+
+    ASSERT(packPixelsParams.outputPitch % readFormat.pixelBytes == 0);
+
+    VkBufferImageCopy region = {};
+    region.bufferImageHeight = srcExtent.height;
+    region.bufferOffset =
+        packBufferOffset + packPixelsParams.offset + reinterpret_cast<ptrdiff_t>(pixels);
+    region.bufferRowLength  = packPixelsParams.outputPitch / readFormat.pixelBytes;
+    region.imageExtent      = srcExtent;
+    region.imageOffset      = srcOffset;
+    region.imageSubresource = srcSubresource;
+
+    if (!reverseRowOrder)
     {
-        toFree->release(renderer);
+        copyCommandBuffer->copyImageToBuffer(src->getImage(), src->getCurrentLayout(),
+                                             packBuffer.getBuffer().getHandle(), 1, &region);
+        return angle::Result::Continue;
     }
-    buffers->clear();
+
+    // The last row of the area goes first in the PBO.
+    std::vector<VkBufferImageCopy> rowRegions(srcExtent.height, region);
+    for (uint32_t row = 0; row < srcExtent.height; ++row)
+    {
+        VkBufferImageCopy &rowRegion = rowRegions[row];
+        rowRegion.bufferOffset +=
+            static_cast<VkDeviceSize>(srcExtent.height - 1 - row) * packPixelsParams.outputPitch;
+        rowRegion.bufferImageHeight  = 1;
+        rowRegion.imageExtent.height = 1;
+        rowRegion.imageOffset.y += row;
+    }
+
+    copyCommandBuffer->copyImageToBuffer(src->getImage(), src->getCurrentLayout(),
+                                         packBuffer.getBuffer().getHandle(),
+                                         static_cast<uint32_t>(rowRegions.size()),
+                                         rowRegions.data());
+    return angle::Result::Continue;
 }
 
 void DestroyBufferList(RendererVk *renderer, BufferHelperPointerVector *buffers)
@@ -800,6 +857,174 @@ bool ShouldReleaseFreeBuffer(const vk::BufferHelper &buffer,
 
     return sizeMismatch || releaseByPolicy;
 }
+
+// The maximum total size of the buffers kept in the SharedBufferPool.  Larger buffers are not
+// pooled at all, as they are rarely reused.
+constexpr VkDeviceSize kMaxSharedBufferPoolSize = 16 * 1024 * 1024;
+constexpr VkDeviceSize kMaxSharedBufferSize     = kMaxSharedBufferPoolSize / 8;
+// Buffers that stay in the SharedBufferPool for this many submissions are released.
+constexpr uint64_t kSharedBufferStaleSerialCount = 1024;
+
+// The maximum total size of the images kept in the SurfaceImagePool.  Surfaces that create and
+// destroy many offscreen surfaces are mostly using small ones, so larger images are not pooled.
+constexpr VkDeviceSize kMaxSurfaceImagePoolSize   = 32 * 1024 * 1024;
+constexpr VkDeviceSize kMaxPooledSurfaceImageSize = kMaxSurfaceImagePoolSize / 4;
+// Images that stay in the SurfaceImagePool for this many submissions are released.
+constexpr uint64_t kSurfaceImageStaleSerialCount = 256;
+
+// Compressed images are decoded in bands of at least this many block rows per worker thread.
+constexpr size_t kMinBlockRowsPerDecodeTask = 16;
+constexpr size_t kMaxDecodeTasks            = 8;
+
+// Uploads smaller than this are not worth the extra submission and semaphore on the transfer
+// queue.
+constexpr VkDeviceSize kMinTransferQueueUploadTexelCount = 256 * 256;
+
+// Uploads smaller than this are cheaper to expand on the CPU than with a compute dispatch.
+constexpr size_t kMinGpuChannelExpansionTexelCount = 256 * 256;
+
+// The level in the key of the mip tail of a sparse image's layer.
+constexpr uint64_t kSparseMipTailLevel = 0xFF;
+
+// Runs a load function over a band of rows of the image on a worker thread.
+class LoadImageTask : public angle::Closure
+{
+  public:
+    LoadImageTask(LoadImageFunction loadFunction,
+                  size_t width,
+                  size_t height,
+                  size_t depth,
+                  const uint8_t *input,
+                  size_t inputRowPitch,
+                  size_t inputDepthPitch,
+                  uint8_t *output,
+                  size_t outputRowPitch,
+                  size_t outputDepthPitch)
+        : mLoadFunction(loadFunction),
+          mWidth(width),
+          mHeight(height),
+          mDepth(depth),
+          mInput(input),
+          mInputRowPitch(inputRowPitch),
+          mInputDepthPitch(inputDepthPitch),
+          mOutput(output),
+          mOutputRowPitch(outputRowPitch),
+          mOutputDepthPitch(outputDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "LoadImageTask");
+        mLoadFunction(mWidth, mHeight, mDepth, mInput, mInputRowPitch, mInputDepthPitch, mOutput,
+                      mOutputRowPitch, mOutputDepthPitch);
+    }
+
+  private:
+    LoadImageFunction mLoadFunction;
+    size_t mWidth;
+    size_t mHeight;
+    size_t mDepth;
+    const uint8_t *mInput;
+    size_t mInputRowPitch;
+    size_t mInputDepthPitch;
+    uint8_t *mOutput;
+    size_t mOutputRowPitch;
+    size_t mOutputDepthPitch;
+};
+
+// Decodes a compressed image to an uncompressed format, splitting the rows of blocks between the
+// worker threads and the calling thread.  Every band is a whole number of block rows, so the
+// load function sees the same block layout it would if it decoded the whole image.
+void LoadCompressedImageInParallel(ContextVk *contextVk,
+                                   LoadImageFunction loadFunction,
+                                   const gl::InternalFormat &formatInfo,
+                                   const gl::Extents &glExtents,
+                                   const uint8_t *input,
+                                   size_t inputRowPitch,
+                                   size_t inputDepthPitch,
+                                   uint8_t *output,
+                                   size_t outputRowPitch,
+                                   size_t outputDepthPitch)
+{
+    const size_t width       = glExtents.width;
+    const size_t height      = glExtents.height;
+    const size_t depth       = glExtents.depth;
+    const size_t blockHeight = formatInfo.compressedBlockHeight;
+    const size_t blockRows   = (height + blockHeight - 1) / blockHeight;
+    const size_t taskCount =
+        std::min(kMaxDecodeTasks, std::max<size_t>(1, blockRows / kMinBlockRowsPerDecodeTask));
+
+    if (taskCount == 1)
+    {
+        loadFunction(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch);
+        return;
+    }
+
+    const size_t blockRowsPerTask = (blockRows + taskCount - 1) / taskCount;
+
+    std::shared_ptr<angle::WorkerThreadPool> workerPool =
+        contextVk->getRenderer()->getWorkerThreadPool();
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+
+    // The first band is decoded on this thread while the workers handle the rest.
+    for (size_t firstBlockRow = blockRowsPerTask; firstBlockRow < blockRows;
+         firstBlockRow += blockRowsPerTask)
+    {
+        const size_t firstRow   = firstBlockRow * blockHeight;
+        const size_t bandHeight = std::min(blockRowsPerTask * blockHeight, height - firstRow);
+
+        auto task = std::make_shared<LoadImageTask>(
+            loadFunction, width, bandHeight, depth, input + firstBlockRow * inputRowPitch,
+            inputRowPitch, inputDepthPitch, output + firstRow * outputRowPitch, outputRowPitch,
+            outputDepthPitch);
+        waitEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(workerPool, task));
+    }
+
+    loadFunction(width, blockRowsPerTask * blockHeight, depth, input, inputRowPitch,
+                 inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+
+    for (std::shared_ptr<angle::WaitableEvent> &waitEvent : waitEvents)
+    {
+        waitEvent->wait();
+    }
+}
+
+// Whether an upload can be staged as-is and have the alpha channel of the image format added by
+// the vertex conversion shader.  That's the case when the image format is the format of the data
+// plus an alpha channel of the same width, like RGBA8 for RGB8, and the data is tightly packed.
+bool CanExpandChannelsOnGpu(ContextVk *contextVk,
+                            const angle::Format &srcFormat,
+                            const angle::Format &destFormat,
+                            const gl::InternalFormat &formatInfo,
+                            GLenum type,
+                            const gl::Extents &glExtents,
+                            GLuint inputRowPitch,
+                            GLuint inputDepthPitch)
+{
+    // The expanded data must be converted before the staged updates are flushed on the graphics
+    // queue, so this can't be combined with uploads on the transfer queue.
+    const angle::FeaturesVk &features = contextVk->getFeatures();
+    if (!features.expandTextureChannelsOnGpu.enabled || features.transferQueueUploads.enabled)
+    {
+        return false;
+    }
+
+    if (srcFormat.isBlock || destFormat.isBlock || srcFormat.channelCount != 3 ||
+        destFormat.channelCount != 4 || srcFormat.redBits != destFormat.redBits ||
+        srcFormat.alphaBits != 0 || srcFormat.pixelBytes * 4 != destFormat.pixelBytes * 3 ||
+        formatInfo.computePixelBytes(type) != srcFormat.pixelBytes)
+    {
+        return false;
+    }
+
+    const size_t texelCount =
+        static_cast<size_t>(glExtents.width) * glExtents.height * glExtents.depth;
+    const GLuint packedRowPitch = glExtents.width * srcFormat.pixelBytes;
+
+    return texelCount >= kMinGpuChannelExpansionTexelCount && inputRowPitch == packedRowPitch &&
+           (glExtents.depth == 1 || inputDepthPitch == packedRowPitch * glExtents.height);
+}
 }  // anonymous namespace
 
 // This is an arbitrary max. We can change this later if necessary.
@@ -1267,7 +1492,32 @@ void CommandBufferHelper::executeBarriers(const angle::FeaturesVk &features,
         return;
     }
 
-    if (features.preferAggregateBarrierCalls.enabled)
+    if (features.supportsSynchronization2.enabled)
+    {
+        // Each barrier keeps its own stages, so they can all be issued at once without making
+        // unrelated stages wait on each other.
+        mMemoryBarriers2.clear();
+        mImageMemoryBarriers2.clear();
+        for (PipelineStage pipelineStage : mask)
+        {
+            PipelineBarrier &barrier = mPipelineBarriers[pipelineStage];
+            barrier.appendSynchronization2Barriers(&mMemoryBarriers2, &mImageMemoryBarriers2);
+            barrier.reset();
+        }
+
+        if (!mMemoryBarriers2.empty() || !mImageMemoryBarriers2.empty())
+        {
+            VkDependencyInfoKHR dependencyInfo = {};
+            dependencyInfo.sType               = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+            dependencyInfo.memoryBarrierCount  = static_cast<uint32_t>(mMemoryBarriers2.size());
+            dependencyInfo.pMemoryBarriers     = mMemoryBarriers2.data();
+            dependencyInfo.imageMemoryBarrierCount =
+                static_cast<uint32_t>(mImageMemoryBarriers2.size());
+            dependencyInfo.pImageMemoryBarriers = mImageMemoryBarriers2.data();
+            primary->pipelineBarrier2(dependencyInfo);
+        }
+    }
+    else if (features.preferAggregateBarrierCalls.enabled)
     {
         PipelineStagesMask::Iterator iter = mask.begin();
         PipelineBarrier &barrier          = mPipelineBarriers[*iter];
@@ -1693,16 +1943,8 @@ angle::Result CommandBufferHelper::flushToPrimary(const angle::FeaturesVk &featu
     {
         ASSERT(renderPass != nullptr);
 
-        VkRenderPassBeginInfo beginInfo    = {};
-        beginInfo.sType                    = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        beginInfo.renderPass               = renderPass->getHandle();
-        beginInfo.framebuffer              = mFramebuffer.getHandle();
-        beginInfo.renderArea.offset.x      = static_cast<uint32_t>(mRenderArea.x);
-        beginInfo.renderArea.offset.y      = static_cast<uint32_t>(mRenderArea.y);
-        beginInfo.renderArea.extent.width  = static_cast<uint32_t>(mRenderArea.width);
-        beginInfo.renderArea.extent.height = static_cast<uint32_t>(mRenderArea.height);
-        beginInfo.clearValueCount = static_cast<uint32_t>(mRenderPassDesc.attachmentCount());
-        beginInfo.pClearValues    = mClearValues.data();
+        VkRenderPassBeginInfo beginInfo = {};
+        initRenderPassBeginInfo(*renderPass, &beginInfo);
 
         // Run commands inside the RenderPass.
         primary->beginRenderPass(beginInfo, VK_SUBPASS_CONTENTS_INLINE);
@@ -1720,6 +1962,87 @@ angle::Result CommandBufferHelper::flushToPrimary(const angle::FeaturesVk &featu
     return angle::Result::Continue;
 }
 
+angle::Result CommandBufferHelper::recordToSecondary(Context *context,
+                                                     const RenderPass *renderPass,
+                                                     PrimaryCommandBuffer *secondary)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandBufferHelper::recordToSecondary");
+    ASSERT(!empty());
+
+    VkCommandBufferInheritanceInfo inheritanceInfo = {};
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    beginInfo.pInheritanceInfo         = &inheritanceInfo;
+
+    if (mIsRenderPassCommandBuffer)
+    {
+        // Render passes with multiple subpasses record vkCmdNextSubpass, which is not allowed in
+        // secondary command buffers.
+        ASSERT(renderPass != nullptr);
+        ASSERT(!mRenderPassDesc.getColorUnresolveAttachmentMask().any() &&
+               !mRenderPassDesc.hasDepthStencilUnresolveAttachment());
+
+        inheritanceInfo.renderPass  = renderPass->getHandle();
+        inheritanceInfo.subpass     = 0;
+        inheritanceInfo.framebuffer = mFramebuffer.getHandle();
+        beginInfo.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    }
+
+    ANGLE_VK_TRY(context, secondary->begin(beginInfo));
+    mCommandBuffer.executeCommands(secondary->getHandle());
+    ANGLE_VK_TRY(context, secondary->end());
+
+    return angle::Result::Continue;
+}
+
+angle::Result CommandBufferHelper::flushSecondaryToPrimary(const angle::FeaturesVk &features,
+                                                           PrimaryCommandBuffer *primary,
+                                                           const RenderPass *renderPass,
+                                                           const PrimaryCommandBuffer &secondary)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandBufferHelper::flushSecondaryToPrimary");
+    ASSERT(!empty());
+
+    executeBarriers(features, primary);
+
+    if (mIsRenderPassCommandBuffer)
+    {
+        ASSERT(renderPass != nullptr);
+
+        VkRenderPassBeginInfo beginInfo = {};
+        initRenderPassBeginInfo(*renderPass, &beginInfo);
+
+        primary->beginRenderPass(beginInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+        primary->executeCommands(1, &secondary);
+        primary->endRenderPass();
+    }
+    else
+    {
+        primary->executeCommands(1, &secondary);
+    }
+
+    reset();
+
+    return angle::Result::Continue;
+}
+
+void CommandBufferHelper::initRenderPassBeginInfo(const RenderPass &renderPass,
+                                                  VkRenderPassBeginInfo *beginInfoOut) const
+{
+    beginInfoOut->sType                    = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    beginInfoOut->renderPass               = renderPass.getHandle();
+    beginInfoOut->framebuffer              = mFramebuffer.getHandle();
+    beginInfoOut->renderArea.offset.x      = static_cast<uint32_t>(mRenderArea.x);
+    beginInfoOut->renderArea.offset.y      = static_cast<uint32_t>(mRenderArea.y);
+    beginInfoOut->renderArea.extent.width  = static_cast<uint32_t>(mRenderArea.width);
+    beginInfoOut->renderArea.extent.height = static_cast<uint32_t>(mRenderArea.height);
+    beginInfoOut->clearValueCount = static_cast<uint32_t>(mRenderPassDesc.attachmentCount());
+    beginInfoOut->pClearValues    = mClearValues.data();
+}
+
 void CommandBufferHelper::updateRenderPassForResolve(ContextVk *contextVk,
                                                      Framebuffer *newFramebuffer,
                                                      const RenderPassDesc &renderPassDesc)
@@ -1843,6 +2166,27 @@ void CommandBufferHelper::pauseTransformFeedback()
                                         mTransformFeedbackCounterBuffers.data());
 }
 
+bool CommandBufferHelper::hasInvalidatedAttachments() const
+{
+    ASSERT(mIsRenderPassCommandBuffer);
+
+    if (mDepthCmdSizeInvalidated != kInfiniteCmdSize ||
+        mStencilCmdSizeInvalidated != kInfiniteCmdSize)
+    {
+        return true;
+    }
+
+    for (PackedAttachmentIndex index = kAttachmentIndexZero; index < mColorImagesCount; ++index)
+    {
+        if (mAttachmentOps[index].isInvalidated)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void CommandBufferHelper::updateRenderPassColorClear(PackedAttachmentIndex colorIndexVk,
                                                      const VkClearValue &clearValue)
 {
@@ -1977,6 +2321,20 @@ DynamicBuffer::~DynamicBuffer()
 
 angle::Result DynamicBuffer::allocateNewBuffer(ContextVk *contextVk)
 {
+    ASSERT(!mBuffer);
+
+    // Reuse a buffer retired by another dynamic buffer if possible.
+    RendererVk *renderer = contextVk->getRenderer();
+    if (renderer->getFeatures().shareDynamicBufferAllocations.enabled)
+    {
+        mBuffer = renderer->getSharedBufferPool().acquireBuffer(
+            mUsage, mMemoryPropertyFlags, mSize, contextVk->getLastCompletedQueueSerial());
+        if (mBuffer)
+        {
+            return angle::Result::Continue;
+        }
+    }
+
     // Gather statistics
     const gl::OverlayType *overlay = contextVk->getOverlay();
     if (overlay->isEnabled())
@@ -1987,7 +2345,6 @@ angle::Result DynamicBuffer::allocateNewBuffer(ContextVk *contextVk)
     }
 
     // Allocate the buffer
-    ASSERT(!mBuffer);
     mBuffer = std::make_unique<BufferHelper>();
 
     VkBufferCreateInfo createInfo    = {};
@@ -2002,6 +2359,28 @@ angle::Result DynamicBuffer::allocateNewBuffer(ContextVk *contextVk)
     return mBuffer->init(contextVk, createInfo, mMemoryPropertyFlags);
 }
 
+void DynamicBuffer::releaseBuffer(RendererVk *renderer, std::unique_ptr<BufferHelper> &&buffer)
+{
+    if (renderer->getFeatures().shareDynamicBufferAllocations.enabled)
+    {
+        renderer->getSharedBufferPool().addBuffer(renderer, mUsage, mMemoryPropertyFlags,
+                                                  std::move(buffer));
+    }
+    else
+    {
+        buffer->release(renderer);
+    }
+}
+
+void DynamicBuffer::releaseBufferList(RendererVk *renderer, BufferHelperPointerVector *buffers)
+{
+    for (std::unique_ptr<BufferHelper> &toFree : *buffers)
+    {
+        releaseBuffer(renderer, std::move(toFree));
+    }
+    buffers->clear();
+}
+
 bool DynamicBuffer::allocateFromCurrentBuffer(size_t sizeInBytes,
                                               uint8_t **ptrOut,
                                               VkDeviceSize *offsetOut)
@@ -2061,7 +2440,7 @@ angle::Result DynamicBuffer::allocateWithAlignment(ContextVk *contextVk,
             mSize = std::max(mInitialSize, sizeToAllocate);
 
             // Clear the free list since the free buffers are now too small.
-            ReleaseBufferListToRenderer(contextVk->getRenderer(), &mBufferFreeList);
+            releaseBufferList(contextVk->getRenderer(), &mBufferFreeList);
         }
 
         // The front of the free list should be the oldest. Thus if it is in use the rest of the
@@ -2145,12 +2524,12 @@ void DynamicBuffer::release(RendererVk *renderer)
 {
     reset();
 
-    ReleaseBufferListToRenderer(renderer, &mInFlightBuffers);
-    ReleaseBufferListToRenderer(renderer, &mBufferFreeList);
+    releaseBufferList(renderer, &mInFlightBuffers);
+    releaseBufferList(renderer, &mBufferFreeList);
 
     if (mBuffer)
     {
-        mBuffer->release(renderer);
+        releaseBuffer(renderer, std::move(mBuffer));
         mBuffer.reset(nullptr);
     }
 }
@@ -2164,7 +2543,7 @@ void DynamicBuffer::releaseInFlightBuffersToResourceUseList(ContextVk *contextVk
 
         if (ShouldReleaseFreeBuffer(*bufferHelper, mSize, mPolicy, mBufferFreeList.size()))
         {
-            bufferHelper->release(contextVk->getRenderer());
+            releaseBuffer(contextVk->getRenderer(), std::move(bufferHelper));
         }
         else
         {
@@ -2181,7 +2560,7 @@ void DynamicBuffer::releaseInFlightBuffers(ContextVk *contextVk)
     {
         if (ShouldReleaseFreeBuffer(*toRelease, mSize, mPolicy, mBufferFreeList.size()))
         {
-            toRelease->release(contextVk->getRenderer());
+            releaseBuffer(contextVk->getRenderer(), std::move(toRelease));
         }
         else
         {
@@ -2208,6 +2587,15 @@ void DynamicBuffer::destroy(RendererVk *renderer)
     }
 }
 
+void DynamicBuffer::releaseFreeBuffers(RendererVk *renderer)
+{
+    for (std::unique_ptr<BufferHelper> &toFree : mBufferFreeList)
+    {
+        toFree->release(renderer);
+    }
+    mBufferFreeList.clear();
+}
+
 void DynamicBuffer::requireAlignment(RendererVk *renderer, size_t alignment)
 {
     ASSERT(alignment > 0);
@@ -2268,6 +2656,116 @@ void DynamicBuffer::reset()
     mLastFlushOrInvalidateOffset = 0;
 }
 
+// SharedBufferPool implementation.
+SharedBufferPool::SharedBufferPool() : mTotalSize(0) {}
+
+SharedBufferPool::~SharedBufferPool()
+{
+    ASSERT(mBuffers.empty());
+}
+
+void SharedBufferPool::destroy(RendererVk *renderer)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (PooledBuffer &pooled : mBuffers)
+    {
+        pooled.buffer->destroy(renderer);
+    }
+    mBuffers.clear();
+    mTotalSize = 0;
+}
+
+std::unique_ptr<BufferHelper> SharedBufferPool::acquireBuffer(
+    VkBufferUsageFlags usage,
+    VkMemoryPropertyFlags memoryPropertyFlags,
+    size_t size,
+    Serial lastCompletedSerial)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (auto iter = mBuffers.begin(); iter != mBuffers.end(); ++iter)
+    {
+        BufferHelper *buffer = iter->buffer.get();
+        if (iter->usage != usage || iter->memoryPropertyFlags != memoryPropertyFlags ||
+            buffer->getSize() != size || buffer->isCurrentlyInUse(lastCompletedSerial))
+        {
+            continue;
+        }
+
+        std::unique_ptr<BufferHelper> acquired = std::move(iter->buffer);
+        mTotalSize -= acquired->getSize();
+        mBuffers.erase(iter);
+        return acquired;
+    }
+
+    return nullptr;
+}
+
+void SharedBufferPool::addBuffer(RendererVk *renderer,
+                                 VkBufferUsageFlags usage,
+                                 VkMemoryPropertyFlags memoryPropertyFlags,
+                                 std::unique_ptr<BufferHelper> &&buffer)
+{
+    ASSERT(buffer && buffer->valid());
+
+    const VkDeviceSize size = buffer->getSize();
+    if (size > kMaxSharedBufferSize)
+    {
+        buffer->release(renderer);
+        return;
+    }
+
+    buffer->unmap(renderer);
+
+    const Serial addedSerial = renderer->getCurrentQueueSerial();
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    while (mTotalSize + size > kMaxSharedBufferPoolSize)
+    {
+        ASSERT(!mBuffers.empty());
+        mTotalSize -= mBuffers.front().buffer->getSize();
+        mBuffers.front().buffer->release(renderer);
+        mBuffers.pop_front();
+    }
+
+    mBuffers.push_back({usage, memoryPropertyFlags, std::move(buffer), addedSerial});
+    mTotalSize += size;
+}
+
+void SharedBufferPool::releaseBuffers(RendererVk *renderer)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (PooledBuffer &pooled : mBuffers)
+    {
+        pooled.buffer->release(renderer);
+    }
+    mBuffers.clear();
+    mTotalSize = 0;
+}
+
+void SharedBufferPool::releaseStaleBuffers(RendererVk *renderer, Serial lastCompletedSerial)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    // The buffers are ordered by when they were added, so the stale ones are at the front.
+    while (!mBuffers.empty())
+    {
+        PooledBuffer &oldest = mBuffers.front();
+        if (oldest.addedSerial.getValue() + kSharedBufferStaleSerialCount >=
+            lastCompletedSerial.getValue())
+        {
+            break;
+        }
+
+        mTotalSize -= oldest.buffer->getSize();
+        oldest.buffer->release(renderer);
+        mBuffers.pop_front();
+    }
+}
+
 // DynamicShadowBuffer implementation.
 DynamicShadowBuffer::DynamicShadowBuffer() : mInitialSize(0), mSize(0) {}
 
@@ -2332,7 +2830,7 @@ void DynamicShadowBuffer::reset()
 }
 
 // DescriptorPoolHelper implementation.
-DescriptorPoolHelper::DescriptorPoolHelper() : mFreeDescriptorSets(0) {}
+DescriptorPoolHelper::DescriptorPoolHelper() : mMaxDescriptorSets(0), mFreeDescriptorSets(0) {}
 
 DescriptorPoolHelper::~DescriptorPoolHelper() = default;
 
@@ -2348,6 +2846,16 @@ angle::Result DescriptorPoolHelper::init(ContextVk *contextVk,
     if (mDescriptorPool.valid())
     {
         ASSERT(!isCurrentlyInUse(contextVk->getLastCompletedQueueSerial()));
+
+        // Once the pools have stopped growing, recycling one only needs to free all of its sets
+        // at once, which leaves it ready for linear allocation.
+        if (maxSets == mMaxDescriptorSets)
+        {
+            ANGLE_VK_TRY(contextVk, mDescriptorPool.reset(contextVk->getDevice()));
+            mFreeDescriptorSets = maxSets;
+            return angle::Result::Continue;
+        }
+
         mDescriptorPool.destroy(contextVk->getDevice());
     }
 
@@ -2366,6 +2874,7 @@ angle::Result DescriptorPoolHelper::init(ContextVk *contextVk,
     descriptorPoolInfo.poolSizeCount              = static_cast<uint32_t>(poolSizes.size());
     descriptorPoolInfo.pPoolSizes                 = poolSizes.data();
 
+    mMaxDescriptorSets  = maxSets;
     mFreeDescriptorSets = maxSets;
 
     ANGLE_VK_TRY(contextVk, mDescriptorPool.init(contextVk->getDevice(), descriptorPoolInfo));
@@ -2894,6 +3403,46 @@ angle::Result QueryHelper::getUint64Result(ContextVk *contextVk, QueryResult *re
     return angle::Result::Continue;
 }
 
+bool QueryHelper::isFollowedBy(const QueryHelper &other) const
+{
+    return valid() && other.valid() && mDynamicQueryPool == other.mDynamicQueryPool &&
+           mQueryPoolIndex == other.mQueryPoolIndex && other.mQuery == mQuery + 1 &&
+           hasSubmittedCommands() && other.hasSubmittedCommands();
+}
+
+angle::Result QueryHelper::getAccumulatedUint64Result(ContextVk *contextVk,
+                                                      uint32_t queryCount,
+                                                      QueryResult *resultOut)
+{
+    ASSERT(valid() && hasSubmittedCommands());
+
+    constexpr uint32_t kMaxQueriesPerRead = 16;
+    constexpr VkQueryResultFlags kFlags   = VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT;
+
+    const size_t stride          = resultOut->getDataSize();
+    const uint32_t intsPerResult = static_cast<uint32_t>(stride / sizeof(uint64_t));
+    std::array<uint64_t, kMaxQueriesPerRead * 2> results;
+    ASSERT(intsPerResult <= 2);
+
+    VkDevice device = contextVk->getDevice();
+    for (uint32_t firstQuery = 0; firstQuery < queryCount; firstQuery += kMaxQueriesPerRead)
+    {
+        uint32_t readCount = std::min(queryCount - firstQuery, kMaxQueriesPerRead);
+        ANGLE_VK_TRY(contextVk, getQueryPool().getResults(device, mQuery + firstQuery, readCount,
+                                                          readCount * stride, results.data(),
+                                                          stride, kFlags));
+
+        for (uint32_t queryIndex = 0; queryIndex < readCount; ++queryIndex)
+        {
+            QueryResult queryResult(intsPerResult);
+            std::copy_n(&results[queryIndex * intsPerResult], intsPerResult,
+                        queryResult.getPointerToResults());
+            *resultOut += queryResult;
+        }
+    }
+    return angle::Result::Continue;
+}
+
 // DynamicSemaphorePool implementation
 DynamicSemaphorePool::DynamicSemaphorePool() = default;
 
@@ -3058,55 +3607,84 @@ angle::Result LineLoopHelper::getIndexBufferForElementArrayBuffer(ContextVk *con
                                                                   VkDeviceSize *bufferOffsetOut,
                                                                   uint32_t *indexCountOut)
 {
-    if (glIndexType == gl::DrawElementsType::UnsignedByte ||
-        contextVk->getState().isPrimitiveRestartEnabled())
+    const bool primitiveRestart = contextVk->getState().isPrimitiveRestartEnabled();
+
+    // The loops of element array buffers are converted once and reused until the indices change.
+    // If the buffer caches too many loops already, they are converted into the shared buffer.
+    LineLoopConversionBuffer *conversion = elementArrayBufferVk->getLineLoopConversionBuffer(
+        contextVk->getRenderer(), glIndexType, indexCount, static_cast<size_t>(elementArrayOffset),
+        primitiveRestart);
+    if (conversion != nullptr && !conversion->dirty)
+    {
+        *bufferOut       = conversion->data.getCurrentBuffer();
+        *bufferOffsetOut = conversion->lastAllocationOffset;
+        *indexCountOut   = conversion->lineLoopIndexCount;
+        return angle::Result::Continue;
+    }
+
+    DynamicBuffer *dynamicIndexBuffer =
+        conversion != nullptr ? &conversion->data : &mDynamicIndexBuffer;
+    dynamicIndexBuffer->releaseInFlightBuffers(contextVk);
+
+    if (glIndexType == gl::DrawElementsType::UnsignedByte || primitiveRestart)
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "LineLoopHelper::getIndexBufferForElementArrayBuffer");
 
         void *srcDataMapping = nullptr;
         ANGLE_TRY(elementArrayBufferVk->mapImpl(contextVk, &srcDataMapping));
-        ANGLE_TRY(streamIndices(contextVk, glIndexType, indexCount,
-                                static_cast<const uint8_t *>(srcDataMapping) + elementArrayOffset,
-                                bufferOut, bufferOffsetOut, indexCountOut));
+        ANGLE_TRY(streamIndicesImpl(
+            contextVk, dynamicIndexBuffer, glIndexType, indexCount,
+            static_cast<const uint8_t *>(srcDataMapping) + elementArrayOffset, bufferOut,
+            bufferOffsetOut, indexCountOut));
         ANGLE_TRY(elementArrayBufferVk->unmapImpl(contextVk));
-        return angle::Result::Continue;
     }
+    else
+    {
+        *indexCountOut = indexCount + 1;
 
-    *indexCountOut = indexCount + 1;
+        uint32_t *indices    = nullptr;
+        size_t unitSize      = contextVk->getVkIndexTypeSize(glIndexType);
+        size_t allocateBytes = unitSize * (indexCount + 1) + 1;
 
-    uint32_t *indices    = nullptr;
-    size_t unitSize      = contextVk->getVkIndexTypeSize(glIndexType);
-    size_t allocateBytes = unitSize * (indexCount + 1) + 1;
+        ANGLE_TRY(dynamicIndexBuffer->allocate(contextVk, allocateBytes,
+                                               reinterpret_cast<uint8_t **>(&indices), nullptr,
+                                               bufferOffsetOut, nullptr));
+        *bufferOut = dynamicIndexBuffer->getCurrentBuffer();
 
-    mDynamicIndexBuffer.releaseInFlightBuffers(contextVk);
-    ANGLE_TRY(mDynamicIndexBuffer.allocate(contextVk, allocateBytes,
-                                           reinterpret_cast<uint8_t **>(&indices), nullptr,
-                                           bufferOffsetOut, nullptr));
-    *bufferOut = mDynamicIndexBuffer.getCurrentBuffer();
+        VkDeviceSize sourceBufferOffset = 0;
+        BufferHelper *sourceBuffer =
+            &elementArrayBufferVk->getBufferAndOffset(&sourceBufferOffset);
 
-    VkDeviceSize sourceBufferOffset = 0;
-    BufferHelper *sourceBuffer = &elementArrayBufferVk->getBufferAndOffset(&sourceBufferOffset);
+        VkDeviceSize sourceOffset =
+            static_cast<VkDeviceSize>(elementArrayOffset) + sourceBufferOffset;
+        uint64_t unitCount                         = static_cast<VkDeviceSize>(indexCount);
+        angle::FixedVector<VkBufferCopy, 3> copies = {
+            {sourceOffset, *bufferOffsetOut, unitCount * unitSize},
+            {sourceOffset, *bufferOffsetOut + unitCount * unitSize, unitSize},
+        };
+        if (contextVk->getRenderer()->getFeatures().extraCopyBufferRegion.enabled)
+            copies.push_back({sourceOffset, *bufferOffsetOut + (unitCount + 1) * unitSize, 1});
 
-    VkDeviceSize sourceOffset = static_cast<VkDeviceSize>(elementArrayOffset) + sourceBufferOffset;
-    uint64_t unitCount        = static_cast<VkDeviceSize>(indexCount);
-    angle::FixedVector<VkBufferCopy, 3> copies = {
-        {sourceOffset, *bufferOffsetOut, unitCount * unitSize},
-        {sourceOffset, *bufferOffsetOut + unitCount * unitSize, unitSize},
-    };
-    if (contextVk->getRenderer()->getFeatures().extraCopyBufferRegion.enabled)
-        copies.push_back({sourceOffset, *bufferOffsetOut + (unitCount + 1) * unitSize, 1});
+        vk::CommandBufferAccess access;
+        access.onBufferTransferWrite(*bufferOut);
+        access.onBufferTransferRead(sourceBuffer);
 
-    vk::CommandBufferAccess access;
-    access.onBufferTransferWrite(*bufferOut);
-    access.onBufferTransferRead(sourceBuffer);
+        vk::CommandBuffer *commandBuffer;
+        ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
 
-    vk::CommandBuffer *commandBuffer;
-    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
+        commandBuffer->copyBuffer(sourceBuffer->getBuffer(), (*bufferOut)->getBuffer(),
+                                  static_cast<uint32_t>(copies.size()), copies.data());
 
-    commandBuffer->copyBuffer(sourceBuffer->getBuffer(), (*bufferOut)->getBuffer(),
-                              static_cast<uint32_t>(copies.size()), copies.data());
+        ANGLE_TRY(dynamicIndexBuffer->flush(contextVk));
+    }
+
+    if (conversion != nullptr)
+    {
+        conversion->dirty                = false;
+        conversion->lastAllocationOffset = *bufferOffsetOut;
+        conversion->lineLoopIndexCount   = *indexCountOut;
+    }
 
-    ANGLE_TRY(mDynamicIndexBuffer.flush(contextVk));
     return angle::Result::Continue;
 }
 
@@ -3118,7 +3696,20 @@ angle::Result LineLoopHelper::streamIndices(ContextVk *contextVk,
                                             VkDeviceSize *bufferOffsetOut,
                                             uint32_t *indexCountOut)
 {
-    size_t unitSize = contextVk->getVkIndexTypeSize(glIndexType);
+    return streamIndicesImpl(contextVk, &mDynamicIndexBuffer, glIndexType, indexCount, srcPtr,
+                             bufferOut, bufferOffsetOut, indexCountOut);
+}
+
+angle::Result LineLoopHelper::streamIndicesImpl(ContextVk *contextVk,
+                                                DynamicBuffer *dynamicIndexBuffer,
+                                                gl::DrawElementsType glIndexType,
+                                                GLsizei indexCount,
+                                                const uint8_t *srcPtr,
+                                                BufferHelper **bufferOut,
+                                                VkDeviceSize *bufferOffsetOut,
+                                                uint32_t *indexCountOut)
+{
+    size_t unitSize = contextVk->getVkIndexTypeSize(glIndexType);
 
     uint8_t *indices = nullptr;
 
@@ -3129,10 +3720,10 @@ angle::Result LineLoopHelper::streamIndices(ContextVk *contextVk,
     }
     *indexCountOut       = numOutIndices;
     size_t allocateBytes = unitSize * numOutIndices;
-    ANGLE_TRY(mDynamicIndexBuffer.allocate(contextVk, allocateBytes,
+    ANGLE_TRY(dynamicIndexBuffer->allocate(contextVk, allocateBytes,
                                            reinterpret_cast<uint8_t **>(&indices), nullptr,
                                            bufferOffsetOut, nullptr));
-    *bufferOut = mDynamicIndexBuffer.getCurrentBuffer();
+    *bufferOut = dynamicIndexBuffer->getCurrentBuffer();
 
     if (contextVk->getState().isPrimitiveRestartEnabled())
     {
@@ -3160,7 +3751,7 @@ angle::Result LineLoopHelper::streamIndices(ContextVk *contextVk,
         }
     }
 
-    ANGLE_TRY(mDynamicIndexBuffer.flush(contextVk));
+    ANGLE_TRY(dynamicIndexBuffer->flush(contextVk));
     return angle::Result::Continue;
 }
 
@@ -3286,6 +3877,45 @@ PipelineStage GetPipelineStage(gl::ShaderType stage)
 }
 
 // PipelineBarrier implementation.
+void PipelineBarrier::appendSynchronization2Barriers(
+    std::vector<VkMemoryBarrier2KHR> *memoryBarriersOut,
+    std::vector<VkImageMemoryBarrier2KHR> *imageMemoryBarriersOut) const
+{
+    // Unlike with vkCmdPipelineBarrier, an execution dependency without access masks has to be
+    // kept as a memory barrier.
+    if (mMemoryBarrierSrcStageMask != 0 || mMemoryBarrierDstAccess != 0)
+    {
+        VkMemoryBarrier2KHR memoryBarrier = {};
+        memoryBarrier.sType               = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+        memoryBarrier.srcStageMask        = mMemoryBarrierSrcStageMask;
+        memoryBarrier.srcAccessMask       = mMemoryBarrierSrcAccess;
+        memoryBarrier.dstStageMask        = mMemoryBarrierDstStageMask;
+        memoryBarrier.dstAccessMask       = mMemoryBarrierDstAccess;
+        memoryBarriersOut->push_back(memoryBarrier);
+    }
+
+    ASSERT(mImageMemoryBarriers.size() == mImageMemoryBarrierStageMasks.size());
+    for (size_t barrierIndex = 0; barrierIndex < mImageMemoryBarriers.size(); ++barrierIndex)
+    {
+        const VkImageMemoryBarrier &barrier = mImageMemoryBarriers[barrierIndex];
+        const StageMasks &stageMasks        = mImageMemoryBarrierStageMasks[barrierIndex];
+
+        VkImageMemoryBarrier2KHR imageMemoryBarrier = {};
+        imageMemoryBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+        imageMemoryBarrier.srcStageMask        = stageMasks.srcStageMask;
+        imageMemoryBarrier.srcAccessMask       = barrier.srcAccessMask;
+        imageMemoryBarrier.dstStageMask        = stageMasks.dstStageMask;
+        imageMemoryBarrier.dstAccessMask       = barrier.dstAccessMask;
+        imageMemoryBarrier.oldLayout           = barrier.oldLayout;
+        imageMemoryBarrier.newLayout           = barrier.newLayout;
+        imageMemoryBarrier.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+        imageMemoryBarrier.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+        imageMemoryBarrier.image               = barrier.image;
+        imageMemoryBarrier.subresourceRange    = barrier.subresourceRange;
+        imageMemoryBarriersOut->push_back(imageMemoryBarrier);
+    }
+}
+
 void PipelineBarrier::addDiagnosticsString(std::ostringstream &out) const
 {
     if (mMemoryBarrierSrcAccess != 0 || mMemoryBarrierDstAccess != 0)
@@ -3748,6 +4378,11 @@ ImageHelper::ImageHelper(ImageHelper &&other)
       mLevelCount(other.mLevelCount),
       mStagingBuffer(std::move(other.mStagingBuffer)),
       mSubresourceUpdates(std::move(other.mSubresourceUpdates)),
+      mTransferQueueUploadSemaphore(std::move(other.mTransferQueueUploadSemaphore)),
+      mTransferQueueUploadBuffers(std::move(other.mTransferQueueUploadBuffers)),
+      mSparsePageMemoryRequirements(other.mSparsePageMemoryRequirements),
+      mSparseMemoryRequirements(other.mSparseMemoryRequirements),
+      mSparsePages(std::move(other.mSparsePages)),
       mCurrentSingleClearValue(std::move(other.mCurrentSingleClearValue)),
       mContentDefined(std::move(other.mContentDefined)),
       mStencilContentDefined(std::move(other.mStencilContentDefined))
@@ -3779,6 +4414,8 @@ void ImageHelper::resetCachedProperties()
     mLayerCount                  = 0;
     mLevelCount                  = 0;
     mExternalFormat              = 0;
+    mSparsePageMemoryRequirements = {};
+    mSparseMemoryRequirements     = {};
     mCurrentSingleClearValue.reset();
     mRenderPassUsageFlags.reset();
 
@@ -4019,6 +4656,25 @@ angle::Result ImageHelper::initExternal(Context *context,
 
 void ImageHelper::releaseImage(RendererVk *renderer)
 {
+    waitForTransferQueueUpload(renderer);
+
+    // The memory of the committed pages of a sparse image is freed along with the image.
+    if (!mSparsePages.empty())
+    {
+        std::vector<GarbageObject> sparseGarbage;
+        for (auto &page : mSparsePages)
+        {
+            sparseGarbage.emplace_back(GarbageObject::Get(&page.second));
+        }
+        mSparsePages.clear();
+
+        SharedResourceUse sparseUse;
+        sparseUse.set(mUse);
+        renderer->collectGarbage(std::move(sparseUse), std::move(sparseGarbage));
+    }
+    mSparsePageMemoryRequirements = {};
+    mSparseMemoryRequirements     = {};
+
     renderer->collectGarbageAndReinit(&mUse, &mImage, &mDeviceMemory);
     mImageSerial = kInvalidImageSerial;
 
@@ -4039,10 +4695,21 @@ void ImageHelper::releaseImageFromShareContexts(RendererVk *renderer, ContextVk
     releaseImage(renderer);
 }
 
+void ImageHelper::resetForReuse(Context *context, bool isRobustResourceInitEnabled)
+{
+    ASSERT(valid() && mSubresourceUpdates.empty());
+
+    mImageSerial = context->getRenderer()->getResourceSerialFactory().generateImageSerial();
+    setEntireContentUndefined();
+    stageClearIfEmulatedFormat(isRobustResourceInitEnabled);
+}
+
 void ImageHelper::releaseStagingBuffer(RendererVk *renderer)
 {
     ASSERT(validateSubresourceUpdateImageRefsConsistent());
 
+    waitForTransferQueueUpload(renderer);
+
     // Remove updates that never made it to the texture.
     for (std::vector<SubresourceUpdate> &levelUpdates : mSubresourceUpdates)
     {
@@ -4191,6 +4858,33 @@ angle::Result ImageHelper::initMemory(Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result ImageHelper::initSparseMemory(Context *context)
+{
+    VkDevice device = context->getDevice();
+
+    // The alignment is the size of a page in bytes.
+    mImage.getMemoryRequirements(device, &mSparsePageMemoryRequirements);
+    mSparsePageMemoryRequirements.size = mSparsePageMemoryRequirements.alignment;
+
+    uint32_t requirementCount = 0;
+    vkGetImageSparseMemoryRequirements(device, mImage.getHandle(), &requirementCount, nullptr);
+    std::vector<VkSparseImageMemoryRequirements> requirements(requirementCount);
+    vkGetImageSparseMemoryRequirements(device, mImage.getHandle(), &requirementCount,
+                                       requirements.data());
+
+    for (const VkSparseImageMemoryRequirements &aspectRequirements : requirements)
+    {
+        if (aspectRequirements.formatProperties.aspectMask == VK_IMAGE_ASPECT_COLOR_BIT)
+        {
+            mSparseMemoryRequirements = aspectRequirements;
+        }
+    }
+    ANGLE_VK_CHECK(context, isSparse(), VK_ERROR_FORMAT_NOT_SUPPORTED);
+
+    mCurrentQueueFamilyIndex = context->getRenderer()->getQueueFamilyIndex();
+    return angle::Result::Continue;
+}
+
 angle::Result ImageHelper::initExternalMemory(
     Context *context,
     const MemoryProperties &memoryProperties,
@@ -4371,8 +5065,17 @@ void ImageHelper::destroy(RendererVk *renderer)
 {
     VkDevice device = renderer->getDevice();
 
+    waitForTransferQueueUpload(renderer);
+
     mImage.destroy(device);
     mDeviceMemory.destroy(device);
+    for (auto &page : mSparsePages)
+    {
+        page.second.destroy(renderer->getAllocator());
+    }
+    mSparsePages.clear();
+    mSparsePageMemoryRequirements = {};
+    mSparseMemoryRequirements     = {};
     mStagingBuffer.destroy(renderer);
     mCurrentLayout = ImageLayout::Undefined;
     mImageType     = VK_IMAGE_TYPE_2D;
@@ -4382,6 +5085,181 @@ void ImageHelper::destroy(RendererVk *renderer)
     setEntireContentUndefined();
 }
 
+LevelIndex ImageHelper::getSparseMipTailFirstLevel() const
+{
+    ASSERT(isSparse());
+    return LevelIndex(std::min(mSparseMemoryRequirements.imageMipTailFirstLod, mLevelCount));
+}
+
+angle::Result ImageHelper::commitSparsePages(ContextVk *contextVk,
+                                             gl::LevelIndex levelGL,
+                                             const gl::Box &area,
+                                             bool commit)
+{
+    ASSERT(isSparse());
+
+    const VkSparseImageFormatProperties &formatProperties =
+        mSparseMemoryRequirements.formatProperties;
+    const VkExtent3D &granularity = formatProperties.imageGranularity;
+    const LevelIndex levelVk      = toVkLevel(levelGL);
+
+    std::vector<VkSparseImageMemoryBind> imageBinds;
+    std::vector<VkSparseMemoryBind> mipTailBinds;
+    std::vector<Allocation> decommitted;
+
+    if (levelVk < getSparseMipTailFirstLevel())
+    {
+        // The pages are aligned to the granularity, except for the last ones of each row and
+        // column, which stop at the edges of the level.
+        const gl::Extents levelExtents = getLevelExtents(levelVk);
+        const uint32_t firstPageX      = static_cast<uint32_t>(area.x) / granularity.width;
+        const uint32_t firstPageY      = static_cast<uint32_t>(area.y) / granularity.height;
+        const uint32_t lastPageX =
+            UnsignedCeilDivide(static_cast<uint32_t>(area.x + area.width), granularity.width);
+        const uint32_t lastPageY =
+            UnsignedCeilDivide(static_cast<uint32_t>(area.y + area.height), granularity.height);
+
+        for (uint32_t layer = area.z; layer < static_cast<uint32_t>(area.z + area.depth); ++layer)
+        {
+            for (uint32_t pageY = firstPageY; pageY < lastPageY; ++pageY)
+            {
+                for (uint32_t pageX = firstPageX; pageX < lastPageX; ++pageX)
+                {
+                    const uint32_t x = pageX * granularity.width;
+                    const uint32_t y = pageY * granularity.height;
+
+                    VkSparseImageMemoryBind bind = {};
+                    bind.subresource.aspectMask  = VK_IMAGE_ASPECT_COLOR_BIT;
+                    bind.subresource.mipLevel    = levelVk.get();
+                    bind.subresource.arrayLayer  = layer;
+                    bind.offset.x                = static_cast<int32_t>(x);
+                    bind.offset.y                = static_cast<int32_t>(y);
+                    bind.extent.width  = std::min(granularity.width, levelExtents.width - x);
+                    bind.extent.height = std::min(granularity.height, levelExtents.height - y);
+                    bind.extent.depth  = 1;
+
+                    const uint64_t pageKey = (static_cast<uint64_t>(levelVk.get()) << 56) |
+                                             (static_cast<uint64_t>(layer) << 40) |
+                                             (static_cast<uint64_t>(pageY) << 20) | pageX;
+                    bool needsBind         = false;
+                    ANGLE_TRY(updateSparsePage(contextVk, pageKey,
+                                               mSparsePageMemoryRequirements.size, commit,
+                                               &decommitted, &bind.memory, &bind.memoryOffset,
+                                               &needsBind));
+                    if (needsBind)
+                    {
+                        imageBinds.push_back(bind);
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        // Committing any level of the mip tail commits all of it, for the layers that |area|
+        // selects unless all the layers share a single mip tail.
+        const bool singleMipTail =
+            (formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0;
+        const uint32_t firstLayer = singleMipTail ? 0 : area.z;
+        const uint32_t layerEnd   = singleMipTail ? 1 : area.z + area.depth;
+
+        for (uint32_t layer = firstLayer; layer < layerEnd; ++layer)
+        {
+            VkSparseMemoryBind bind = {};
+            bind.resourceOffset     = mSparseMemoryRequirements.imageMipTailOffset +
+                                  mSparseMemoryRequirements.imageMipTailStride * layer;
+            bind.size = mSparseMemoryRequirements.imageMipTailSize;
+
+            const uint64_t mipTailKey = (static_cast<uint64_t>(kSparseMipTailLevel) << 56) |
+                                        (static_cast<uint64_t>(layer) << 40);
+            bool needsBind            = false;
+            ANGLE_TRY(updateSparsePage(contextVk, mipTailKey, bind.size, commit, &decommitted,
+                                       &bind.memory, &bind.memoryOffset, &needsBind));
+            if (needsBind)
+            {
+                mipTailBinds.push_back(bind);
+            }
+        }
+    }
+
+    if (imageBinds.empty() && mipTailBinds.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    VkSparseImageMemoryBindInfo imageBindInfo = {};
+    imageBindInfo.image                       = mImage.getHandle();
+    imageBindInfo.bindCount                   = static_cast<uint32_t>(imageBinds.size());
+    imageBindInfo.pBinds                      = imageBinds.data();
+
+    VkSparseImageOpaqueMemoryBindInfo mipTailBindInfo = {};
+    mipTailBindInfo.image                             = mImage.getHandle();
+    mipTailBindInfo.bindCount                         = static_cast<uint32_t>(mipTailBinds.size());
+    mipTailBindInfo.pBinds                            = mipTailBinds.data();
+
+    VkBindSparseInfo bindSparseInfo = {};
+    bindSparseInfo.sType            = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+    if (!imageBinds.empty())
+    {
+        bindSparseInfo.imageBindCount = 1;
+        bindSparseInfo.pImageBinds    = &imageBindInfo;
+    }
+    if (!mipTailBinds.empty())
+    {
+        bindSparseInfo.imageOpaqueBindCount = 1;
+        bindSparseInfo.pImageOpaqueBinds    = &mipTailBindInfo;
+    }
+
+    ANGLE_TRY(contextVk->bindSparseMemory(&bindSparseInfo));
+
+    // The decommitted memory may still be used by the commands submitted before the bind.
+    for (Allocation &allocation : decommitted)
+    {
+        contextVk->addGarbage(&allocation);
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result ImageHelper::updateSparsePage(Context *context,
+                                            uint64_t pageKey,
+                                            VkDeviceSize size,
+                                            bool commit,
+                                            std::vector<Allocation> *decommittedOut,
+                                            VkDeviceMemory *memoryOut,
+                                            VkDeviceSize *memoryOffsetOut,
+                                            bool *bindOut)
+{
+    auto iter        = mSparsePages.find(pageKey);
+    bool committed   = iter != mSparsePages.end();
+    *bindOut         = committed != commit;
+    *memoryOut       = VK_NULL_HANDLE;
+    *memoryOffsetOut = 0;
+
+    if (!*bindOut)
+    {
+        return angle::Result::Continue;
+    }
+
+    if (!commit)
+    {
+        decommittedOut->push_back(std::move(iter->second));
+        mSparsePages.erase(iter);
+        return angle::Result::Continue;
+    }
+
+    VkMemoryRequirements memoryRequirements = mSparsePageMemoryRequirements;
+    memoryRequirements.size                 = size;
+
+    Allocation allocation;
+    ANGLE_VK_TRY(context, context->getRenderer()->getAllocator().allocateMemory(
+                              memoryRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                              &allocation, memoryOut, memoryOffsetOut));
+    mSparsePages.emplace(pageKey, std::move(allocation));
+
+    return angle::Result::Continue;
+}
+
 void ImageHelper::init2DWeakReference(Context *context,
                                       VkImage handle,
                                       const gl::Extents &glExtents,
@@ -4692,6 +5570,13 @@ bool ImageHelper::isReleasedToExternal() const
 #endif
 }
 
+void ImageHelper::resetToExternalQueueFamily(uint32_t externalQueueFamilyIndex)
+{
+    ASSERT(valid());
+    mCurrentQueueFamilyIndex = externalQueueFamilyIndex;
+    setEntireContentDefined();
+}
+
 void ImageHelper::setFirstAllocatedLevel(gl::LevelIndex firstLevel)
 {
     ASSERT(!valid());
@@ -5189,6 +6074,41 @@ void ImageHelper::removeSingleSubresourceStagedUpdates(ContextVk *contextVk,
     }
 }
 
+void ImageHelper::removeStagedUpdatesWithinLayers(ContextVk *contextVk,
+                                                  gl::LevelIndex levelIndexGL,
+                                                  uint32_t layerIndex,
+                                                  uint32_t layerCount)
+{
+    mCurrentSingleClearValue.reset();
+
+    std::vector<SubresourceUpdate> *levelUpdates = getLevelUpdates(levelIndexGL);
+    if (levelUpdates == nullptr)
+    {
+        return;
+    }
+
+    // Unlike removeSingleSubresourceStagedUpdates, updates that also touch other layers, such as
+    // a clear of the whole level, are kept.
+    for (size_t index = 0; index < levelUpdates->size();)
+    {
+        auto update = levelUpdates->begin() + index;
+
+        uint32_t updateBaseLayer, updateLayerCount;
+        update->getDestSubresource(mLayerCount, &updateBaseLayer, &updateLayerCount);
+
+        if (updateBaseLayer >= layerIndex &&
+            updateBaseLayer + updateLayerCount <= layerIndex + layerCount)
+        {
+            update->release(contextVk->getRenderer());
+            levelUpdates->erase(update);
+        }
+        else
+        {
+            index++;
+        }
+    }
+}
+
 void ImageHelper::removeStagedUpdates(Context *context,
                                       gl::LevelIndex levelGLStart,
                                       gl::LevelIndex levelGLEnd)
@@ -5324,6 +6244,29 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
         }
     }
 
+    const uint8_t *source = pixels + static_cast<ptrdiff_t>(inputSkipBytes);
+
+    // Large uploads that only lack the alpha channel are copied to the staging buffer unchanged,
+    // and expanded into the allocation the image is copied from by a compute shader.
+    const angle::Format &intendedFormat = vkFormat.intendedFormat();
+    BufferHelper *unconvertedBuffer     = nullptr;
+    VkDeviceSize unconvertedOffset      = 0;
+    if (stagingBufferOverride == nullptr && stencilAllocationSize == 0 &&
+        CanExpandChannelsOnGpu(contextVk, intendedFormat, storageFormat, formatInfo, type,
+                               glExtents, inputRowPitch, inputDepthPitch))
+    {
+        const size_t unconvertedSize =
+            static_cast<size_t>(inputRowPitch) * glExtents.height * glExtents.depth;
+        uint8_t *unconvertedPointer = nullptr;
+        ANGLE_TRY(mStagingBuffer.allocateWithAlignment(
+            contextVk, unconvertedSize, mStagingBuffer.getAlignment(), &unconvertedPointer,
+            nullptr, &unconvertedOffset, nullptr));
+        unconvertedBuffer = mStagingBuffer.getCurrentBuffer();
+
+        memcpy(unconvertedPointer, source, unconvertedSize);
+        ANGLE_TRY(mStagingBuffer.flush(contextVk));
+    }
+
     VkBuffer bufferHandle = VK_NULL_HANDLE;
 
     uint8_t *stagingPointer    = nullptr;
@@ -5336,11 +6279,37 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
                                                    nullptr));
     BufferHelper *currentBuffer = stagingBuffer->getCurrentBuffer();
 
-    const uint8_t *source = pixels + static_cast<ptrdiff_t>(inputSkipBytes);
+    if (unconvertedBuffer != nullptr)
+    {
+        ASSERT(stagingOffset % 4 == 0);
 
-    loadFunctionInfo.loadFunction(glExtents.width, glExtents.height, glExtents.depth, source,
-                                  inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch,
-                                  outputDepthPitch);
+        UtilsVk::ConvertVertexParameters params;
+        params.vertexCount =
+            static_cast<size_t>(glExtents.width) * glExtents.height * glExtents.depth;
+        params.srcFormat  = &intendedFormat;
+        params.destFormat = &storageFormat;
+        params.srcStride  = intendedFormat.pixelBytes;
+        params.srcOffset  = static_cast<size_t>(unconvertedOffset);
+        params.destOffset = static_cast<size_t>(stagingOffset);
+
+        ANGLE_TRY(contextVk->getUtils().convertVertexBuffer(contextVk, currentBuffer,
+                                                             unconvertedBuffer, params));
+    }
+    // Decoding compressed data that the device doesn't support natively is slow enough to be
+    // worth spreading over the worker threads.
+    else if (contextVk->getFeatures().parallelCompressedTextureDecode.enabled &&
+        formatInfo.compressed && !storageFormat.isBlock)
+    {
+        LoadCompressedImageInParallel(contextVk, loadFunctionInfo.loadFunction, formatInfo,
+                                      glExtents, source, inputRowPitch, inputDepthPitch,
+                                      stagingPointer, outputRowPitch, outputDepthPitch);
+    }
+    else
+    {
+        loadFunctionInfo.loadFunction(glExtents.width, glExtents.height, glExtents.depth, source,
+                                      inputRowPitch, inputDepthPitch, stagingPointer,
+                                      outputRowPitch, outputDepthPitch);
+    }
 
     VkBufferImageCopy copy         = {};
     VkImageAspectFlags aspectFlags = GetFormatAspectFlags(vkFormat.actualImageFormat());
@@ -6027,6 +6996,11 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
                                               uint32_t layerEnd,
                                               gl::TexLevelMask skipLevelsMask)
 {
+    if (hasPendingTransferQueueUpload())
+    {
+        ANGLE_TRY(acquireFromTransferQueue(contextVk));
+    }
+
     if (!hasStagedUpdatesInLevels(levelGLStart, levelGLEnd))
     {
         return angle::Result::Continue;
@@ -6237,6 +7211,175 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+bool ImageHelper::canFlushStagedUpdatesOnTransferQueue(ContextVk *contextVk) const
+{
+    RendererVk *renderer = contextVk->getRenderer();
+
+    // The image must not have been used by the graphics queue yet.  Its contents are then
+    // undefined and don't need a queue family ownership transfer to the transfer queue.  The
+    // memory of sparse images is bound on the graphics queue, which the transfer queue doesn't
+    // wait on.
+    if (!renderer->hasTransferQueue() || !valid() || hasPendingTransferQueueUpload() ||
+        mCurrentLayout != ImageLayout::Undefined ||
+        mCurrentQueueFamilyIndex != renderer->getQueueFamilyIndex() ||
+        getAspectFlags() != VK_IMAGE_ASPECT_COLOR_BIT || isSparse())
+    {
+        return false;
+    }
+
+    // Only buffer copies to the allocated levels can be done on the transfer queue.
+    VkDeviceSize texelCount = 0;
+    for (size_t levelIndex = 0; levelIndex < mSubresourceUpdates.size(); ++levelIndex)
+    {
+        const std::vector<SubresourceUpdate> &levelUpdates = mSubresourceUpdates[levelIndex];
+        if (levelUpdates.empty())
+        {
+            continue;
+        }
+
+        const gl::LevelIndex levelGL(static_cast<GLint>(levelIndex));
+        if (levelGL < mFirstAllocatedLevel || levelGL > getLastAllocatedLevel())
+        {
+            return false;
+        }
+
+        for (const SubresourceUpdate &update : levelUpdates)
+        {
+            if (update.updateSource != UpdateSource::Buffer)
+            {
+                return false;
+            }
+
+            const VkBufferImageCopy &copyRegion = update.data.buffer.copyRegion;
+            texelCount += static_cast<VkDeviceSize>(copyRegion.imageExtent.width) *
+                          copyRegion.imageExtent.height * copyRegion.imageExtent.depth *
+                          copyRegion.imageSubresource.layerCount;
+        }
+    }
+
+    return texelCount >= kMinTransferQueueUploadTexelCount;
+}
+
+angle::Result ImageHelper::flushStagedUpdatesOnTransferQueue(ContextVk *contextVk)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::flushStagedUpdatesOnTransferQueue");
+    ASSERT(canFlushStagedUpdatesOnTransferQueue(contextVk));
+
+    RendererVk *renderer                    = contextVk->getRenderer();
+    const uint32_t transferQueueFamilyIndex = renderer->getTransferQueueFamilyIndex();
+    const VkImageAspectFlags aspectFlags    = getAspectFlags();
+
+    removeSupersededUpdates(contextVk, {});
+
+    ANGLE_TRY(mStagingBuffer.flush(contextVk));
+
+    PrimaryCommandBuffer commandBuffer;
+    ANGLE_TRY(renderer->getTransferCommandBuffer(contextVk, &commandBuffer));
+
+    // The contents are undefined, so the transfer queue can start using the image without it
+    // being released by the graphics queue.
+    mCurrentQueueFamilyIndex = transferQueueFamilyIndex;
+    barrierImpl(contextVk, aspectFlags, ImageLayout::TransferDst, transferQueueFamilyIndex,
+                &commandBuffer);
+
+    for (size_t levelIndex = 0; levelIndex < mSubresourceUpdates.size(); ++levelIndex)
+    {
+        const gl::LevelIndex updateMipLevelGL(static_cast<GLint>(levelIndex));
+        const LevelIndex updateMipLevelVk = toVkLevel(updateMipLevelGL);
+
+        for (SubresourceUpdate &update : mSubresourceUpdates[levelIndex])
+        {
+            ASSERT(update.updateSource == UpdateSource::Buffer);
+
+            uint32_t updateBaseLayer, updateLayerCount;
+            update.getDestSubresource(mLayerCount, &updateBaseLayer, &updateLayerCount);
+
+            BufferUpdate &bufferUpdate                        = update.data.buffer;
+            bufferUpdate.copyRegion.imageSubresource.mipLevel = updateMipLevelVk.get();
+
+            BufferHelper *currentBuffer = bufferUpdate.bufferHelper;
+            ASSERT(currentBuffer && currentBuffer->valid());
+
+            commandBuffer.copyBufferToImage(currentBuffer->getBuffer().getHandle(), mImage,
+                                            getCurrentLayout(), 1, &bufferUpdate.copyRegion);
+            onWrite(updateMipLevelGL, 1, updateBaseLayer, updateLayerCount,
+                    bufferUpdate.copyRegion.imageSubresource.aspectMask);
+
+            if (std::find(mTransferQueueUploadBuffers.begin(), mTransferQueueUploadBuffers.end(),
+                          currentBuffer) == mTransferQueueUploadBuffers.end())
+            {
+                mTransferQueueUploadBuffers.push_back(currentBuffer);
+            }
+
+            update.release(renderer);
+        }
+    }
+    mSubresourceUpdates.clear();
+
+    // Release the image to the graphics queue.  The matching acquire is done in
+    // acquireFromTransferQueue.
+    VkImageMemoryBarrier releaseBarrier = {};
+    initImageMemoryBarrierStruct(aspectFlags, ImageLayout::TransferDst,
+                                 renderer->getQueueFamilyIndex(), &releaseBarrier);
+    releaseBarrier.dstAccessMask = 0;
+    commandBuffer.imageBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                               releaseBarrier);
+
+    ANGLE_VK_TRY(contextVk, mTransferQueueUploadSemaphore.init(renderer->getDevice()));
+    return renderer->submitTransferCommandBuffer(contextVk, std::move(commandBuffer),
+                                                 mTransferQueueUploadSemaphore);
+}
+
+angle::Result ImageHelper::acquireFromTransferQueue(ContextVk *contextVk)
+{
+    ASSERT(hasPendingTransferQueueUpload());
+    ASSERT(mCurrentQueueFamilyIndex == contextVk->getRenderer()->getTransferQueueFamilyIndex());
+
+    // The acquire barrier and every later use of the image are at or after the transfer stage, so
+    // that's where the next submission waits for the upload.
+    contextVk->addWaitSemaphore(mTransferQueueUploadSemaphore.getHandle(),
+                                VK_PIPELINE_STAGE_TRANSFER_BIT);
+    contextVk->addGarbage(&mTransferQueueUploadSemaphore);
+
+    CommandBufferAccess access;
+    CommandBuffer *commandBuffer;
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
+
+    changeLayoutAndQueue(contextVk, getAspectFlags(), ImageLayout::TransferDst,
+                         contextVk->getRenderer()->getQueueFamilyIndex(), commandBuffer);
+    retain(&contextVk->getResourceUseList());
+
+    // The staging buffers can be released once the submission that waits for the upload is done.
+    for (BufferHelper *buffer : mTransferQueueUploadBuffers)
+    {
+        buffer->retain(&contextVk->getResourceUseList());
+    }
+    mTransferQueueUploadBuffers.clear();
+
+    if (mSubresourceUpdates.empty())
+    {
+        mStagingBuffer.releaseInFlightBuffers(contextVk);
+        mStagingBuffer.release(contextVk->getRenderer());
+    }
+
+    return angle::Result::Continue;
+}
+
+void ImageHelper::waitForTransferQueueUpload(RendererVk *renderer)
+{
+    if (!hasPendingTransferQueueUpload())
+    {
+        return;
+    }
+
+    // This only happens if the image is deleted or respecified before ever being used, so a full
+    // wait is acceptable.
+    renderer->waitForTransferQueueIdle();
+    mTransferQueueUploadSemaphore.destroy(renderer->getDevice());
+    mTransferQueueUploadBuffers.clear();
+    mCurrentQueueFamilyIndex = renderer->getQueueFamilyIndex();
+}
+
 angle::Result ImageHelper::flushAllStagedUpdates(ContextVk *contextVk)
 {
     return flushStagedUpdates(contextVk, mFirstAllocatedLevel, mFirstAllocatedLevel + mLevelCount,
@@ -6274,6 +7417,50 @@ bool ImageHelper::hasStagedUpdatesForSubresource(gl::LevelIndex levelGL,
     return false;
 }
 
+bool ImageHelper::hasStagedUpdateCoveringLevel(gl::LevelIndex levelGL) const
+{
+    const std::vector<SubresourceUpdate> *levelUpdates = getLevelUpdates(levelGL);
+    if (levelUpdates == nullptr)
+    {
+        return false;
+    }
+
+    const gl::Extents levelExtents = getLevelExtents(toVkLevel(levelGL));
+
+    for (const SubresourceUpdate &update : *levelUpdates)
+    {
+        uint32_t updateBaseLayer, updateLayerCount;
+        update.getDestSubresource(mLayerCount, &updateBaseLayer, &updateLayerCount);
+
+        if (updateBaseLayer != 0 || updateLayerCount < mLayerCount ||
+            update.getDestAspectFlags() != getAspectFlags())
+        {
+            continue;
+        }
+
+        // Clear updates always clear the whole subresource.
+        gl::Box updateBox(gl::kOffsetZero, levelExtents);
+
+        if (update.updateSource == UpdateSource::Buffer)
+        {
+            updateBox = gl::Box(update.data.buffer.copyRegion.imageOffset,
+                                update.data.buffer.copyRegion.imageExtent);
+        }
+        else if (update.updateSource == UpdateSource::Image)
+        {
+            updateBox = gl::Box(update.data.image.copyRegion.dstOffset,
+                                update.data.image.copyRegion.extent);
+        }
+
+        if (updateBox.coversSameExtent(levelExtents))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 gl::LevelIndex ImageHelper::getLastAllocatedLevel() const
 {
     return mFirstAllocatedLevel + mLevelCount - 1;
@@ -6281,7 +7468,10 @@ gl::LevelIndex ImageHelper::getLastAllocatedLevel() const
 
 bool ImageHelper::hasStagedUpdatesInAllocatedLevels() const
 {
-    return hasStagedUpdatesInLevels(mFirstAllocatedLevel, getLastAllocatedLevel() + 1);
+    // An upload on the transfer queue still needs to be acquired by the graphics queue through
+    // flushStagedUpdates.
+    return hasPendingTransferQueueUpload() ||
+           hasStagedUpdatesInLevels(mFirstAllocatedLevel, getLastAllocatedLevel() + 1);
 }
 
 bool ImageHelper::hasStagedUpdatesInLevels(gl::LevelIndex levelStart, gl::LevelIndex levelEnd) const
@@ -6758,35 +7948,65 @@ angle::Result ImageHelper::readPixels(ContextVk *contextVk,
         srcSubresource.mipLevel       = 0;
     }
 
-    // If PBO and if possible, copy directly on the GPU.
+    // If PBO and if possible, copy directly on the GPU.  The copy is tracked by the PBO's
+    // BufferHelper, so the CPU only waits for it if the PBO is mapped.
     if (packPixelsParams.packBuffer &&
         CanCopyWithTransformForReadPixels(packPixelsParams, mFormat, readFormat))
     {
-        VkDeviceSize packBufferOffset = 0;
-        BufferHelper &packBuffer =
-            GetImpl(packPixelsParams.packBuffer)->getBufferAndOffset(&packBufferOffset);
-
-        CommandBufferAccess copyAccess;
-        copyAccess.onBufferTransferWrite(&packBuffer);
-        copyAccess.onImageTransferRead(copyAspectFlags, src);
-
-        CommandBuffer *copyCommandBuffer;
-        ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(copyAccess, &copyCommandBuffer));
-
-        ASSERT(packPixelsParams.outputPitch % readFormat->pixelBytes == 0);
+        return CopyImageToPackBuffer(contextVk, packPixelsParams, src, copyAspectFlags, srcOffset,
+                                     srcExtent, srcSubresource, packPixelsParams.reverseRowOrder,
+                                     *readFormat, pixels);
+    }
 
-        VkBufferImageCopy region = {};
-        region.bufferImageHeight = srcExtent.height;
-        region.bufferOffset =
-            packBufferOffset + packPixelsParams.offset + reinterpret_cast<ptrdiff_t>(pixels);
-        region.bufferRowLength  = packPixelsParams.outputPitch / readFormat->pixelBytes;
-        region.imageExtent      = srcExtent;
-        region.imageOffset      = srcOffset;
-        region.imageSubresource = srcSubresource;
+    // If a format conversion is needed, blit to a staging image in the PBO's format first, so the
+    // read still doesn't require a CPU wait.
+    if (packPixelsParams.packBuffer &&
+        CanBlitForReadPixels(renderer, packPixelsParams, mFormat, copyAspectFlags))
+    {
+        const angle::Format &destFormat = *packPixelsParams.destFormat;
 
-        copyCommandBuffer->copyImageToBuffer(src->getImage(), src->getCurrentLayout(),
-                                             packBuffer.getBuffer().getHandle(), 1, &region);
-        return angle::Result::Continue;
+        RendererScoped<ImageHelper> convertedImage(renderer);
+        ANGLE_TRY(convertedImage.get().init2DStaging(
+            contextVk, renderer->getMemoryProperties(), gl::Extents(area.width, area.height, 1),
+            renderer->getFormat(destFormat.id),
+            VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT, 1));
+        convertedImage.get().retain(&contextVk->getResourceUseList());
+
+        CommandBufferAccess blitAccess;
+        blitAccess.onImageTransferRead(layoutChangeAspectFlags, src);
+        blitAccess.onImageTransferWrite(gl::LevelIndex(0), 1, 0, 1, VK_IMAGE_ASPECT_COLOR_BIT,
+                                        &convertedImage.get());
+
+        CommandBuffer *blitCommandBuffer;
+        ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(blitAccess, &blitCommandBuffer));
+
+        // Flipping the source offsets of the blit reverses the row order.
+        const int32_t srcTop    = srcOffset.y;
+        const int32_t srcBottom = srcOffset.y + area.height;
+        const bool reverseRows  = packPixelsParams.reverseRowOrder;
+
+        VkImageBlit blitRegion               = {};
+        blitRegion.srcSubresource            = srcSubresource;
+        blitRegion.srcOffsets[0]             = {srcOffset.x, reverseRows ? srcBottom : srcTop,
+                                    srcOffset.z};
+        blitRegion.srcOffsets[1]             = {srcOffset.x + area.width,
+                                    reverseRows ? srcTop : srcBottom, srcOffset.z + 1};
+        blitRegion.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        blitRegion.dstSubresource.mipLevel   = 0;
+        blitRegion.dstSubresource.baseArrayLayer = 0;
+        blitRegion.dstSubresource.layerCount     = 1;
+        blitRegion.dstOffsets[0]                 = {0, 0, 0};
+        blitRegion.dstOffsets[1]                 = {area.width, area.height, 1};
+
+        blitCommandBuffer->blitImage(src->getImage(), src->getCurrentLayout(),
+                                     convertedImage.get().getImage(),
+                                     convertedImage.get().getCurrentLayout(), 1, &blitRegion,
+                                     VK_FILTER_NEAREST);
+
+        VkImageSubresourceLayers convertedSubresource = blitRegion.dstSubresource;
+        return CopyImageToPackBuffer(contextVk, packPixelsParams, &convertedImage.get(),
+                                     VK_IMAGE_ASPECT_COLOR_BIT, {0, 0, 0}, srcExtent,
+                                     convertedSubresource, false, destFormat, pixels);
     }
 
     VkBuffer bufferHandle      = VK_NULL_HANDLE;
@@ -6832,14 +8052,16 @@ angle::Result ImageHelper::readPixels(ContextVk *contextVk,
         void *mapPtr           = nullptr;
         ANGLE_TRY(packBufferVk->mapImpl(contextVk, &mapPtr));
         uint8_t *dest = static_cast<uint8_t *>(mapPtr) + reinterpret_cast<ptrdiff_t>(pixels);
-        PackPixels(packPixelsParams, *readFormat, area.width * readFormat->pixelBytes,
-                   readPixelBuffer, static_cast<uint8_t *>(dest));
+        PackPixelsInParallel(contextVk->getRenderer()->getWorkerThreadPool(), packPixelsParams,
+                             *readFormat, area.width * readFormat->pixelBytes, readPixelBuffer,
+                             static_cast<uint8_t *>(dest));
         ANGLE_TRY(packBufferVk->unmapImpl(contextVk));
     }
     else
     {
-        PackPixels(packPixelsParams, *readFormat, area.width * readFormat->pixelBytes,
-                   readPixelBuffer, static_cast<uint8_t *>(pixels));
+        PackPixelsInParallel(contextVk->getRenderer()->getWorkerThreadPool(), packPixelsParams,
+                             *readFormat, area.width * readFormat->pixelBytes, readPixelBuffer,
+                             static_cast<uint8_t *>(pixels));
     }
 
     return angle::Result::Continue;
@@ -7035,6 +8257,114 @@ void ImageHelper::prependSubresourceUpdate(gl::LevelIndex level, SubresourceUpda
     onStateChange(angle::SubjectMessage::SubjectChanged);
 }
 
+// SurfaceImagePool implementation.
+SurfaceImagePool::SurfaceImagePool() : mTotalSize(0) {}
+
+SurfaceImagePool::~SurfaceImagePool()
+{
+    ASSERT(mImages.empty());
+}
+
+void SurfaceImagePool::destroy(RendererVk *renderer)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (PooledImage &pooled : mImages)
+    {
+        pooled.image->destroy(renderer);
+    }
+    mImages.clear();
+    mTotalSize = 0;
+}
+
+std::unique_ptr<ImageHelper> SurfaceImagePool::acquireImage(const VkExtent3D &extents,
+                                                            const Format &format,
+                                                            GLint samples,
+                                                            VkImageUsageFlags usage)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    // Prefer the most recently added images, which are the most likely to still be cached.
+    for (auto iter = mImages.rbegin(); iter != mImages.rend(); ++iter)
+    {
+        const ImageHelper *image = iter->image.get();
+        if (image->getExtents().width != extents.width ||
+            image->getExtents().height != extents.height || &image->getFormat() != &format ||
+            image->getSamples() != samples || image->getUsage() != usage)
+        {
+            continue;
+        }
+
+        std::unique_ptr<ImageHelper> acquired = std::move(iter->image);
+        mTotalSize -= iter->size;
+        mImages.erase(std::next(iter).base());
+        return acquired;
+    }
+
+    return nullptr;
+}
+
+void SurfaceImagePool::addImage(RendererVk *renderer, std::unique_ptr<ImageHelper> &&image)
+{
+    ASSERT(image && image->valid());
+
+    VkMemoryRequirements memoryRequirements;
+    image->getImage().getMemoryRequirements(renderer->getDevice(), &memoryRequirements);
+    const VkDeviceSize size = memoryRequirements.size;
+    if (size > kMaxPooledSurfaceImageSize)
+    {
+        image->releaseImage(renderer);
+        return;
+    }
+
+    const Serial addedSerial = renderer->getCurrentQueueSerial();
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    while (mTotalSize + size > kMaxSurfaceImagePoolSize)
+    {
+        ASSERT(!mImages.empty());
+        mTotalSize -= mImages.front().size;
+        mImages.front().image->releaseImage(renderer);
+        mImages.pop_front();
+    }
+
+    mImages.push_back({std::move(image), size, addedSerial});
+    mTotalSize += size;
+}
+
+void SurfaceImagePool::releaseImages(RendererVk *renderer)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (PooledImage &pooled : mImages)
+    {
+        pooled.image->releaseImage(renderer);
+    }
+    mImages.clear();
+    mTotalSize = 0;
+}
+
+void SurfaceImagePool::releaseStaleImages(RendererVk *renderer, Serial lastCompletedSerial)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    // The images are ordered by when they were added, so the stale ones are at the front.
+    while (!mImages.empty())
+    {
+        PooledImage &oldest = mImages.front();
+        if (oldest.addedSerial.getValue() + kSurfaceImageStaleSerialCount >=
+            lastCompletedSerial.getValue())
+        {
+            break;
+        }
+
+        mTotalSize -= oldest.size;
+        oldest.image->releaseImage(renderer);
+        mImages.pop_front();
+    }
+}
+
 // FramebufferHelper implementation.
 FramebufferHelper::FramebufferHelper() = default;
 
@@ -7065,7 +8395,9 @@ void FramebufferHelper::release(ContextVk *contextVk)
 }
 
 // ImageViewHelper implementation.
-ImageViewHelper::ImageViewHelper() : mCurrentMaxLevel(0), mLinearColorspace(true) {}
+ImageViewHelper::ImageViewHelper()
+    : mCurrentMaxLevel(0), mLinearColorspace(true), mCachedImageViewUseCount(0)
+{}
 
 ImageViewHelper::ImageViewHelper(ImageViewHelper &&other) : Resource(std::move(other))
 {
@@ -7081,12 +8413,8 @@ ImageViewHelper::ImageViewHelper(ImageViewHelper &&other) : Resource(std::move(o
     std::swap(mLinearColorspace, other.mLinearColorspace);
 
     std::swap(mPerLevelStencilReadImageViews, other.mPerLevelStencilReadImageViews);
-    std::swap(mLevelDrawImageViews, other.mLevelDrawImageViews);
-    std::swap(mLayerLevelDrawImageViews, other.mLayerLevelDrawImageViews);
-    std::swap(mLevelDrawImageViewsLinear, other.mLevelDrawImageViewsLinear);
-    std::swap(mLayerLevelDrawImageViewsLinear, other.mLayerLevelDrawImageViewsLinear);
-    std::swap(mLevelStorageImageViews, other.mLevelStorageImageViews);
-    std::swap(mLayerLevelStorageImageViews, other.mLayerLevelStorageImageViews);
+    std::swap(mCachedImageViews, other.mCachedImageViews);
+    std::swap(mCachedImageViewUseCount, other.mCachedImageViewUseCount);
     std::swap(mImageViewSerial, other.mImageViewSerial);
 }
 
@@ -7115,45 +8443,17 @@ void ImageViewHelper::release(RendererVk *renderer)
     ReleaseImageViews(&mPerLevelSRGBCopyImageViews, &garbage);
     ReleaseImageViews(&mPerLevelStencilReadImageViews, &garbage);
 
-    // Release the draw views
-    ReleaseImageViews(&mLevelDrawImageViews, &garbage);
-    ReleaseImageViews(&mLevelDrawImageViewsLinear, &garbage);
-    for (ImageViewVector &layerViews : mLayerLevelDrawImageViews)
-    {
-        for (ImageView &imageView : layerViews)
-        {
-            if (imageView.valid())
-            {
-                garbage.emplace_back(GetGarbage(&imageView));
-            }
-        }
-    }
-    mLayerLevelDrawImageViews.clear();
-    for (ImageViewVector &layerViews : mLayerLevelDrawImageViewsLinear)
-    {
-        for (ImageView &imageView : layerViews)
-        {
-            if (imageView.valid())
-            {
-                garbage.emplace_back(GetGarbage(&imageView));
-            }
-        }
-    }
-
-    // Release the storage views
-    ReleaseImageViews(&mLevelStorageImageViews, &garbage);
-    for (ImageViewVector &layerViews : mLayerLevelStorageImageViews)
+    // Release the draw and storage views
+    for (auto &cachedView : mCachedImageViews)
     {
-        for (ImageView &imageView : layerViews)
+        ImageView &imageView = cachedView.second.view;
+        if (imageView.valid())
         {
-            if (imageView.valid())
-            {
-                garbage.emplace_back(GetGarbage(&imageView));
-            }
+            garbage.emplace_back(GetGarbage(&imageView));
         }
     }
-    mLayerLevelDrawImageViewsLinear.clear();
-    mLayerLevelStorageImageViews.clear();
+    renderer->getImageViewCacheStats()->decrementSize(mCachedImageViews.size());
+    mCachedImageViews.clear();
 
     if (!garbage.empty())
     {
@@ -7167,8 +8467,10 @@ void ImageViewHelper::release(RendererVk *renderer)
     mImageViewSerial = renderer->getResourceSerialFactory().generateImageOrBufferViewSerial();
 }
 
-void ImageViewHelper::destroy(VkDevice device)
+void ImageViewHelper::destroy(RendererVk *renderer)
 {
+    VkDevice device = renderer->getDevice();
+
     mCurrentMaxLevel = LevelIndex(0);
 
     // Release the read views
@@ -7180,36 +8482,13 @@ void ImageViewHelper::destroy(VkDevice device)
     DestroyImageViews(&mPerLevelSRGBCopyImageViews, device);
     DestroyImageViews(&mPerLevelStencilReadImageViews, device);
 
-    // Release the draw views
-    DestroyImageViews(&mLevelDrawImageViews, device);
-    DestroyImageViews(&mLevelDrawImageViewsLinear, device);
-    for (ImageViewVector &layerViews : mLayerLevelDrawImageViews)
+    // Release the draw and storage views
+    for (auto &cachedView : mCachedImageViews)
     {
-        for (ImageView &imageView : layerViews)
-        {
-            imageView.destroy(device);
-        }
-    }
-    mLayerLevelDrawImageViews.clear();
-    for (ImageViewVector &layerViews : mLayerLevelDrawImageViewsLinear)
-    {
-        for (ImageView &imageView : layerViews)
-        {
-            imageView.destroy(device);
-        }
+        cachedView.second.view.destroy(device);
     }
-
-    // Release the storage views
-    DestroyImageViews(&mLevelStorageImageViews, device);
-    for (ImageViewVector &layerViews : mLayerLevelStorageImageViews)
-    {
-        for (ImageView &imageView : layerViews)
-        {
-            imageView.destroy(device);
-        }
-    }
-    mLayerLevelDrawImageViewsLinear.clear();
-    mLayerLevelStorageImageViews.clear();
+    renderer->getImageViewCacheStats()->decrementSize(mCachedImageViews.size());
+    mCachedImageViews.clear();
 
     mImageViewSerial = kInvalidImageOrBufferViewSerial;
 }
@@ -7413,10 +8692,12 @@ angle::Result ImageViewHelper::getLevelStorageImageView(ContextVk *contextVk,
 {
     ASSERT(mImageViewSerial.valid());
 
+    RendererVk *renderer = contextVk->getRenderer();
+    trimImageViewCache(renderer);
     retain(&contextVk->getResourceUseList());
 
     ImageView *imageView =
-        GetLevelImageView(&mLevelStorageImageViews, levelVk, image.getLevelCount());
+        getCachedImageView(renderer, CachedViewKind::Storage, LayerMode::All, levelVk, 0);
 
     *imageViewOut = imageView;
     if (imageView->valid())
@@ -7442,11 +8723,12 @@ angle::Result ImageViewHelper::getLevelLayerStorageImageView(ContextVk *contextV
     ASSERT(mImageViewSerial.valid());
     ASSERT(!image.getFormat().actualImageFormat().isBlock);
 
+    RendererVk *renderer = contextVk->getRenderer();
+    trimImageViewCache(renderer);
     retain(&contextVk->getResourceUseList());
 
     ImageView *imageView =
-        GetLevelLayerImageView(&mLayerLevelStorageImageViews, levelVk, layer, image.getLevelCount(),
-                               GetImageLayerCountForView(image));
+        getCachedImageView(renderer, CachedViewKind::Storage, LayerMode::Single, levelVk, layer);
     *imageViewOut = imageView;
 
     if (imageView->valid())
@@ -7470,11 +8752,13 @@ angle::Result ImageViewHelper::getLevelDrawImageView(ContextVk *contextVk,
     ASSERT(mImageViewSerial.valid());
     ASSERT(!image.getFormat().actualImageFormat().isBlock);
 
+    RendererVk *renderer = contextVk->getRenderer();
+    trimImageViewCache(renderer);
     retain(&contextVk->getResourceUseList());
 
-    // Lazily allocate the storage for image views
-    ImageView *imageView = GetLevelImageView(&mLevelDrawImageViews, levelVk, image.getLevelCount());
-    *imageViewOut        = imageView;
+    ImageView *imageView =
+        getCachedImageView(renderer, CachedViewKind::Draw, LayerMode::All, levelVk, 0);
+    *imageViewOut = imageView;
 
     if (imageView->valid())
     {
@@ -7502,16 +8786,15 @@ angle::Result ImageViewHelper::getLevelLayerDrawImageView(ContextVk *contextVk,
     ASSERT(mImageViewSerial.valid());
     ASSERT(!image.getFormat().actualImageFormat().isBlock);
 
+    RendererVk *renderer = contextVk->getRenderer();
+    trimImageViewCache(renderer);
     retain(&contextVk->getResourceUseList());
 
-    LayerLevelImageViewVector &imageViews = (mode == gl::SrgbWriteControlMode::Linear)
-                                                ? mLayerLevelDrawImageViewsLinear
-                                                : mLayerLevelDrawImageViews;
-
-    // Lazily allocate the storage for image views
-    ImageView *imageView = GetLevelLayerImageView(
-        &imageViews, levelVk, layer, image.getLevelCount(), GetImageLayerCountForView(image));
-    *imageViewOut = imageView;
+    const CachedViewKind kind = (mode == gl::SrgbWriteControlMode::Linear)
+                                    ? CachedViewKind::DrawLinear
+                                    : CachedViewKind::Draw;
+    ImageView *imageView = getCachedImageView(renderer, kind, LayerMode::Single, levelVk, layer);
+    *imageViewOut        = imageView;
 
     if (imageView->valid())
     {
@@ -7526,6 +8809,79 @@ angle::Result ImageViewHelper::getLevelLayerDrawImageView(ContextVk *contextVk,
                                     imageView, levelVk, 1, layer, 1, mode);
 }
 
+ImageView *ImageViewHelper::getCachedImageView(RendererVk *renderer,
+                                               CachedViewKind kind,
+                                               LayerMode layerMode,
+                                               LevelIndex levelVk,
+                                               uint32_t layer)
+{
+    const uint32_t key =
+        GetCachedImageViewKey(static_cast<uint32_t>(kind), layerMode, levelVk, layer);
+    CacheStats *stats = renderer->getImageViewCacheStats();
+
+    auto iter = mCachedImageViews.find(key);
+    if (iter == mCachedImageViews.end())
+    {
+        stats->miss();
+        stats->incrementSize(1);
+        iter = mCachedImageViews.emplace(key, CachedImageView()).first;
+    }
+    else
+    {
+        stats->hit();
+    }
+
+    iter->second.lastUse = ++mCachedImageViewUseCount;
+    return &iter->second.view;
+}
+
+void ImageViewHelper::trimImageViewCache(RendererVk *renderer)
+{
+    // Enough for every layer of a cube map at every level, in both colorspaces.
+    constexpr size_t kMaxCachedImageViews = 2 * 6 * gl::IMPLEMENTATION_MAX_TEXTURE_LEVELS;
+
+    if (mCachedImageViews.size() <= kMaxCachedImageViews ||
+        isCurrentlyInUse(renderer->getLastCompletedQueueSerial()))
+    {
+        return;
+    }
+
+    // Keep the most recently used half.
+    std::vector<uint64_t> lastUses;
+    lastUses.reserve(mCachedImageViews.size());
+    for (const auto &cachedView : mCachedImageViews)
+    {
+        lastUses.push_back(cachedView.second.lastUse);
+    }
+    auto threshold = lastUses.begin() + (lastUses.size() - kMaxCachedImageViews / 2);
+    std::nth_element(lastUses.begin(), threshold, lastUses.end());
+    const uint64_t oldestKeptUse = *threshold;
+
+    VkDevice device         = renderer->getDevice();
+    size_t evictedViewCount = 0;
+    for (auto iter = mCachedImageViews.begin(); iter != mCachedImageViews.end();)
+    {
+        if (iter->second.lastUse < oldestKeptUse)
+        {
+            iter->second.view.destroy(device);
+            iter = mCachedImageViews.erase(iter);
+            ++evictedViewCount;
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    CacheStats *stats = renderer->getImageViewCacheStats();
+    stats->evict(evictedViewCount);
+    stats->decrementSize(evictedViewCount);
+
+    // Framebuffers and descriptor sets are cached by view serial and may still refer to the
+    // destroyed views.
+    mImageViewSerial = renderer->getResourceSerialFactory().generateImageOrBufferViewSerial();
+}
+
 ImageOrBufferViewSubresourceSerial ImageViewHelper::getSubresourceSerial(
     gl::LevelIndex levelGL,
     uint32_t levelCount,
@@ -7728,6 +9084,31 @@ void ShaderProgramHelper::setSpecializationConstant(sh::vk::SpecializationConsta
     }
 }
 
+angle::Result ShaderProgramHelper::warmUpGraphicsPipeline(
+    ContextVk *contextVk,
+    RenderPassCache *renderPassCache,
+    const PipelineCache &pipelineCache,
+    const PipelineLayout &pipelineLayout,
+    const GraphicsPipelineDesc &pipelineDesc,
+    const gl::AttributesMask &activeAttribLocationsMask,
+    const gl::ComponentTypeMask &programAttribsTypeMask,
+    PipelineHelper **pipelineOut)
+{
+    RenderPass *compatibleRenderPass = nullptr;
+    ANGLE_TRY(renderPassCache->getCompatibleRenderPass(contextVk, pipelineDesc.getRenderPassDesc(),
+                                                       &compatibleRenderPass));
+
+    mGraphicsPipelines.warmUpPipeline(
+        contextVk, pipelineCache, *compatibleRenderPass, pipelineLayout, activeAttribLocationsMask,
+        programAttribsTypeMask, getShaderModule(gl::ShaderType::Vertex),
+        getShaderModule(gl::ShaderType::Fragment), getShaderModule(gl::ShaderType::Geometry),
+        getShaderModule(gl::ShaderType::TessControl),
+        getShaderModule(gl::ShaderType::TessEvaluation), mSpecializationConstants, pipelineDesc,
+        pipelineOut);
+
+    return angle::Result::Continue;
+}
+
 angle::Result ShaderProgramHelper::getComputePipeline(Context *context,
                                                       const PipelineLayout &pipelineLayout,
                                                       PipelineAndSerial **pipelineOut)
@@ -7796,6 +9177,7 @@ void CommandBufferAccess::onImageRead(VkImageAspectFlags aspectFlags,
                                       ImageHelper *image)
 {
     ASSERT(!image->isReleasedToExternal());
+    ASSERT(!image->hasPendingTransferQueueUpload());
     ASSERT(image->getImageSerial().valid());
     mReadImages.emplace_back(image, aspectFlags, imageLayout);
 }
@@ -7809,6 +9191,7 @@ void CommandBufferAccess::onImageWrite(gl::LevelIndex levelStart,
                                        ImageHelper *image)
 {
     ASSERT(!image->isReleasedToExternal());
+    ASSERT(!image->hasPendingTransferQueueUpload());
     ASSERT(image->getImageSerial().valid());
     mWriteImages.emplace_back(CommandBufferImageAccess{image, aspectFlags, imageLayout}, levelStart,
                               levelCount, layerStart, layerCount);
@@ -9,6 +9,10 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_VK_HELPERS_H_
 #define LIBANGLE_RENDERER_VULKAN_VK_HELPERS_H_
 
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
 #include "common/MemoryBuffer.h"
 #include "libANGLE/renderer/vulkan/ResourceVk.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
@@ -32,8 +36,11 @@ constexpr size_t kVertexBufferAlignment   = 4;
 constexpr size_t kIndexBufferAlignment    = 4;
 constexpr size_t kIndirectBufferAlignment = 4;
 
-constexpr VkBufferUsageFlags kStagingBufferFlags =
-    VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+// Staging buffers are also storage buffers, so texture uploads can be converted in them with
+// compute shaders.
+constexpr VkBufferUsageFlags kStagingBufferFlags = VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+                                                   VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                                                   VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 constexpr size_t kStagingBufferSize = 1024 * 16;
 
 constexpr VkImageCreateFlags kVkImageCreateFlagsNone = 0;
@@ -144,6 +151,10 @@ class DynamicBuffer : angle::NonCopyable
     // This frees resources immediately.
     void destroy(RendererVk *renderer);
 
+    // Releases the buffers kept for reuse to the renderer garbage instead of the shared buffer
+    // pool, to give their memory back under memory pressure.
+    void releaseFreeBuffers(RendererVk *renderer);
+
     BufferHelper *getCurrentBuffer() const { return mBuffer.get(); }
 
     // **Accumulate** an alignment requirement.  A dynamic buffer is used as the staging buffer for
@@ -166,6 +177,8 @@ class DynamicBuffer : angle::NonCopyable
   private:
     void reset();
     angle::Result allocateNewBuffer(ContextVk *contextVk);
+    void releaseBuffer(RendererVk *renderer, std::unique_ptr<BufferHelper> &&buffer);
+    void releaseBufferList(RendererVk *renderer, BufferHelperPointerVector *buffers);
 
     VkBufferUsageFlags mUsage;
     bool mHostVisible;
@@ -182,6 +195,54 @@ class DynamicBuffer : angle::NonCopyable
     BufferHelperPointerVector mBufferFreeList;
 };
 
+// Holds the buffers that dynamic buffers no longer need, so that other dynamic buffers created
+// with the same usage, memory properties and size can reuse them once the GPU is done with them.
+// Owned by the renderer and shared by all contexts, so access is synchronized.  Used with the
+// shareDynamicBufferAllocations feature.
+class SharedBufferPool final : angle::NonCopyable
+{
+  public:
+    SharedBufferPool();
+    ~SharedBufferPool();
+
+    void destroy(RendererVk *renderer);
+
+    // Takes a matching buffer out of the pool, or returns nullptr if none is free.
+    std::unique_ptr<BufferHelper> acquireBuffer(VkBufferUsageFlags usage,
+                                                VkMemoryPropertyFlags memoryPropertyFlags,
+                                                size_t size,
+                                                Serial lastCompletedSerial);
+
+    // Adds a buffer to the pool.  The buffer may still be in use by the GPU.  The oldest buffers
+    // are released to the renderer garbage when the pool grows past its limit.
+    void addBuffer(RendererVk *renderer,
+                   VkBufferUsageFlags usage,
+                   VkMemoryPropertyFlags memoryPropertyFlags,
+                   std::unique_ptr<BufferHelper> &&buffer);
+
+    // Releases all the buffers in the pool to the renderer garbage.
+    void releaseBuffers(RendererVk *renderer);
+
+    // Releases the buffers that nothing reused for many submissions, so that long-running
+    // contexts don't keep pinning the memory blocks they were suballocated from.
+    void releaseStaleBuffers(RendererVk *renderer, Serial lastCompletedSerial);
+
+  private:
+    struct PooledBuffer
+    {
+        VkBufferUsageFlags usage;
+        VkMemoryPropertyFlags memoryPropertyFlags;
+        std::unique_ptr<BufferHelper> buffer;
+        // The queue serial when the buffer was added to the pool.
+        Serial addedSerial;
+    };
+
+    std::mutex mMutex;
+    // Ordered from the least to the most recently added.
+    std::deque<PooledBuffer> mBuffers;
+    VkDeviceSize mTotalSize;
+};
+
 // Based off of the DynamicBuffer class, DynamicShadowBuffer provides
 // a similar conceptually infinitely long buffer that will only be written
 // to and read by the CPU. This can be used to provide CPU cached copies of
@@ -280,6 +341,7 @@ class DescriptorPoolHelper : public Resource
                                VkDescriptorSet *descriptorSetsOut);
 
   private:
+    uint32_t mMaxDescriptorSets;
     uint32_t mFreeDescriptorSets;
     DescriptorPool mDescriptorPool;
 };
@@ -498,6 +560,15 @@ class QueryHelper final : public Resource
                                              bool *availableOut);
     angle::Result getUint64Result(ContextVk *contextVk, QueryResult *resultOut);
 
+    // Whether |other| is the next query in the same pool, so that the results of both can be read
+    // with a single call.
+    bool isFollowedBy(const QueryHelper &other) const;
+    // Waits for and sums the results of this query and the |queryCount - 1| ones following it in
+    // the pool.
+    angle::Result getAccumulatedUint64Result(ContextVk *contextVk,
+                                             uint32_t queryCount,
+                                             QueryResult *resultOut);
+
   private:
     friend class DynamicQueryPool;
     const QueryPool &getQueryPool() const
@@ -633,6 +704,15 @@ class LineLoopHelper final : angle::NonCopyable
     static void Draw(uint32_t count, uint32_t baseVertex, CommandBuffer *commandBuffer);
 
   private:
+    angle::Result streamIndicesImpl(ContextVk *contextVk,
+                                    DynamicBuffer *dynamicIndexBuffer,
+                                    gl::DrawElementsType glIndexType,
+                                    GLsizei indexCount,
+                                    const uint8_t *srcPtr,
+                                    BufferHelper **bufferOut,
+                                    VkDeviceSize *bufferOffsetOut,
+                                    uint32_t *indexCountOut);
+
     DynamicBuffer mDynamicIndexBuffer;
     DynamicBuffer mDynamicIndirectBuffer;
 };
@@ -679,13 +759,17 @@ class PipelineBarrier : angle::NonCopyable
           mDstStageMask(0),
           mMemoryBarrierSrcAccess(0),
           mMemoryBarrierDstAccess(0),
+          mMemoryBarrierSrcStageMask(0),
+          mMemoryBarrierDstStageMask(0),
           mImageMemoryBarriers()
     {}
     ~PipelineBarrier() = default;
 
     bool isEmpty() const { return mImageMemoryBarriers.empty() && mMemoryBarrierDstAccess == 0; }
 
-    void execute(PrimaryCommandBuffer *primary)
+    // Also used to record the barriers of a single command in the outside render pass commands.
+    template <typename CommandBufferT>
+    void execute(CommandBufferT *commandBuffer)
     {
         if (isEmpty())
         {
@@ -702,7 +786,7 @@ class PipelineBarrier : angle::NonCopyable
             memoryBarrier.dstAccessMask = mMemoryBarrierDstAccess;
             memoryBarrierCount++;
         }
-        primary->pipelineBarrier(
+        commandBuffer->pipelineBarrier(
             mSrcStageMask, mDstStageMask, 0, memoryBarrierCount, &memoryBarrier, 0, nullptr,
             static_cast<uint32_t>(mImageMemoryBarriers.size()), mImageMemoryBarriers.data());
 
@@ -743,8 +827,13 @@ class PipelineBarrier : angle::NonCopyable
         mDstStageMask |= other->mDstStageMask;
         mMemoryBarrierSrcAccess |= other->mMemoryBarrierSrcAccess;
         mMemoryBarrierDstAccess |= other->mMemoryBarrierDstAccess;
+        mMemoryBarrierSrcStageMask |= other->mMemoryBarrierSrcStageMask;
+        mMemoryBarrierDstStageMask |= other->mMemoryBarrierDstStageMask;
         mImageMemoryBarriers.insert(mImageMemoryBarriers.end(), other->mImageMemoryBarriers.begin(),
                                     other->mImageMemoryBarriers.end());
+        mImageMemoryBarrierStageMasks.insert(mImageMemoryBarrierStageMasks.end(),
+                                             other->mImageMemoryBarrierStageMasks.begin(),
+                                             other->mImageMemoryBarrierStageMasks.end());
         other->reset();
     }
 
@@ -757,6 +846,8 @@ class PipelineBarrier : angle::NonCopyable
         mDstStageMask |= dstStageMask;
         mMemoryBarrierSrcAccess |= srcAccess;
         mMemoryBarrierDstAccess |= dstAccess;
+        mMemoryBarrierSrcStageMask |= srcStageMask;
+        mMemoryBarrierDstStageMask |= dstStageMask;
     }
 
     void mergeImageBarrier(VkPipelineStageFlags srcStageMask,
@@ -767,25 +858,45 @@ class PipelineBarrier : angle::NonCopyable
         mSrcStageMask |= srcStageMask;
         mDstStageMask |= dstStageMask;
         mImageMemoryBarriers.push_back(imageMemoryBarrier);
+        mImageMemoryBarrierStageMasks.push_back({srcStageMask, dstStageMask});
     }
 
     void reset()
     {
         mSrcStageMask           = 0;
         mDstStageMask           = 0;
-        mMemoryBarrierSrcAccess = 0;
-        mMemoryBarrierDstAccess = 0;
+        mMemoryBarrierSrcAccess    = 0;
+        mMemoryBarrierDstAccess    = 0;
+        mMemoryBarrierSrcStageMask = 0;
+        mMemoryBarrierDstStageMask = 0;
         mImageMemoryBarriers.clear();
+        mImageMemoryBarrierStageMasks.clear();
     }
 
+    // For VK_KHR_synchronization2, appends the memory barrier and each image barrier with their
+    // own stage masks rather than the union of all of them.
+    void appendSynchronization2Barriers(
+        std::vector<VkMemoryBarrier2KHR> *memoryBarriersOut,
+        std::vector<VkImageMemoryBarrier2KHR> *imageMemoryBarriersOut) const;
+
     void addDiagnosticsString(std::ostringstream &out) const;
 
   private:
+    struct StageMasks
+    {
+        VkPipelineStageFlags srcStageMask;
+        VkPipelineStageFlags dstStageMask;
+    };
+
     VkPipelineStageFlags mSrcStageMask;
     VkPipelineStageFlags mDstStageMask;
     VkFlags mMemoryBarrierSrcAccess;
     VkFlags mMemoryBarrierDstAccess;
+    VkPipelineStageFlags mMemoryBarrierSrcStageMask;
+    VkPipelineStageFlags mMemoryBarrierDstStageMask;
     std::vector<VkImageMemoryBarrier> mImageMemoryBarriers;
+    // The stage masks of each image barrier, used by the synchronization2 path.
+    std::vector<StageMasks> mImageMemoryBarrierStageMasks;
 };
 using PipelineBarrierArray = angle::PackedEnumMap<PipelineStage, PipelineBarrier>;
 
@@ -1057,6 +1168,17 @@ class CommandBufferHelper : angle::NonCopyable
                                  PrimaryCommandBuffer *primary,
                                  const RenderPass *renderPass);
 
+    // Used by the parallelCommandBufferRecording feature.  recordToSecondary may be called on a
+    // worker thread to record the commands into a Vulkan secondary command buffer, after which
+    // flushSecondaryToPrimary adds the barriers and executes the secondary in |primary|.
+    angle::Result recordToSecondary(Context *context,
+                                    const RenderPass *renderPass,
+                                    PrimaryCommandBuffer *secondary);
+    angle::Result flushSecondaryToPrimary(const angle::FeaturesVk &features,
+                                          PrimaryCommandBuffer *primary,
+                                          const RenderPass *renderPass,
+                                          const PrimaryCommandBuffer &secondary);
+
     void executeBarriers(const angle::FeaturesVk &features, PrimaryCommandBuffer *primary);
 
     void setHasRenderPass(bool hasRenderPass) { mIsRenderPassCommandBuffer = hasRenderPass; }
@@ -1131,6 +1253,10 @@ class CommandBufferHelper : angle::NonCopyable
                std::min(cmdCountDisabled, mCommandBuffer.getCommandSize()) == cmdCountInvalidated;
     }
 
+    // Whether any attachment of the render pass has been invalidated.  Clears cannot be turned
+    // into loadOps of such a render pass, as the attachment may not be stored.
+    bool hasInvalidatedAttachments() const;
+
     void updateRenderPassColorClear(PackedAttachmentIndex colorIndex,
                                     const VkClearValue &colorClearValue);
     void updateRenderPassDepthStencilClear(VkImageAspectFlags aspectFlags,
@@ -1209,6 +1335,8 @@ class CommandBufferHelper : angle::NonCopyable
     void setImageOptimizeForPresent(ImageHelper *image) { mImageOptimizeForPresent = image; }
 
   private:
+    void initRenderPassBeginInfo(const RenderPass &renderPass,
+                                 VkRenderPassBeginInfo *beginInfoOut) const;
     bool onDepthStencilAccess(ResourceAccess access,
                               uint32_t *cmdCountInvalidated,
                               uint32_t *cmdCountDisabled);
@@ -1239,6 +1367,9 @@ class CommandBufferHelper : angle::NonCopyable
     // General state (non-renderPass related)
     PipelineBarrierArray mPipelineBarriers;
     PipelineStagesMask mPipelineBarrierMask;
+    // Scratch space of executeBarriers for VK_KHR_synchronization2.
+    std::vector<VkMemoryBarrier2KHR> mMemoryBarriers2;
+    std::vector<VkImageMemoryBarrier2KHR> mImageMemoryBarriers2;
     CommandBuffer mCommandBuffer;
 
     // RenderPass state
@@ -1463,6 +1594,10 @@ class ImageHelper final : public Resource, public angle::Subject
         const void *extraAllocationInfo,
         uint32_t currentQueueFamilyIndex,
         VkMemoryPropertyFlags flags);
+    // Sparse images, created with VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT, have no memory of their
+    // own.  Memory is bound to their pages when the pages are committed, and is freed when they
+    // are decommitted or the image is released.
+    angle::Result initSparseMemory(Context *context);
     angle::Result initLayerImageView(Context *context,
                                      gl::TextureType textureType,
                                      VkImageAspectFlags aspectMask,
@@ -1539,6 +1674,9 @@ class ImageHelper final : public Resource, public angle::Subject
     // accessing to it.
     void releaseImageFromShareContexts(RendererVk *renderer, ContextVk *contextVk);
     void releaseStagingBuffer(RendererVk *renderer);
+    // Prepares an image that its previous owner released the staging buffer of for reuse by a new
+    // owner.  The image gets a new serial and undefined contents, as if it was just initialized.
+    void resetForReuse(Context *context, bool isRobustResourceInitEnabled);
 
     bool valid() const { return mImage.valid(); }
 
@@ -1560,6 +1698,17 @@ class ImageHelper final : public Resource, public angle::Subject
     const Image &getImage() const { return mImage; }
     const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
 
+    bool isSparse() const { return mSparseMemoryRequirements.formatProperties.aspectMask != 0; }
+    // The levels starting at this one are in the mip tail, which is committed as a whole.
+    LevelIndex getSparseMipTailFirstLevel() const;
+    // Binds memory to the pages of |levelGL| that |area| covers, or unbinds it.  |area| is aligned
+    // to the page size, except where it reaches the edges of the level.  The depth of |area|
+    // selects layers.
+    angle::Result commitSparsePages(ContextVk *contextVk,
+                                    gl::LevelIndex levelGL,
+                                    const gl::Box &area,
+                                    bool commit);
+
     void setTilingMode(VkImageTiling tilingMode) { mTilingMode = tilingMode; }
     VkImageTiling getTilingMode() const { return mTilingMode; }
     VkImageUsageFlags getUsage() const { return mUsage; }
@@ -1641,6 +1790,12 @@ class ImageHelper final : public Resource, public angle::Subject
                                               gl::LevelIndex levelIndexGL,
                                               uint32_t layerIndex,
                                               uint32_t layerCount);
+    // Removes the staged updates to a level that only touch the given layers, for when all of
+    // those layers are about to be overwritten.
+    void removeStagedUpdatesWithinLayers(ContextVk *contextVk,
+                                         gl::LevelIndex levelIndexGL,
+                                         uint32_t layerIndex,
+                                         uint32_t layerCount);
     void removeStagedUpdates(Context *context,
                              gl::LevelIndex levelGLStart,
                              gl::LevelIndex levelGLEnd);
@@ -1747,8 +1902,18 @@ class ImageHelper final : public Resource, public angle::Subject
     bool hasStagedUpdatesForSubresource(gl::LevelIndex levelGL,
                                         uint32_t layer,
                                         uint32_t layerCount) const;
+    // Whether a staged update overwrites the whole level, in every layer and aspect of the image,
+    // in which case the current contents of that level are irrelevant.
+    bool hasStagedUpdateCoveringLevel(gl::LevelIndex levelGL) const;
     bool hasStagedUpdatesInAllocatedLevels() const;
 
+    // With transferQueueUploads, large uploads to an image that has not been used yet are done on
+    // the transfer queue.  The image is then acquired by the graphics queue the next time its
+    // staged updates are flushed, i.e. right before it is used.
+    bool canFlushStagedUpdatesOnTransferQueue(ContextVk *contextVk) const;
+    angle::Result flushStagedUpdatesOnTransferQueue(ContextVk *contextVk);
+    bool hasPendingTransferQueueUpload() const { return mTransferQueueUploadSemaphore.valid(); }
+
     void recordWriteBarrier(Context *context,
                             VkImageAspectFlags aspectMask,
                             ImageLayout newLayout,
@@ -1807,6 +1972,10 @@ class ImageHelper final : public Resource, public angle::Subject
     // Returns true if the image is owned by an external API or instance.
     bool isReleasedToExternal() const;
 
+    // Used when an imported image is handed out again, after its external owner may have written
+    // to it.  Its next use acquires it from the external queue family, in its last known layout.
+    void resetToExternalQueueFamily(uint32_t externalQueueFamilyIndex);
+
     gl::LevelIndex getFirstAllocatedLevel() const { return mFirstAllocatedLevel; }
     void setFirstAllocatedLevel(gl::LevelIndex firstLevel);
     gl::LevelIndex getLastAllocatedLevel() const;
@@ -1976,6 +2145,12 @@ class ImageHelper final : public Resource, public angle::Subject
     // channels.
     void stageClearIfEmulatedFormat(bool isRobustResourceInitEnabled);
 
+    // Makes the graphics queue wait for the upload done by flushStagedUpdatesOnTransferQueue and
+    // take ownership of the image.
+    angle::Result acquireFromTransferQueue(ContextVk *contextVk);
+    // Used when the image is released before it's acquired by the graphics queue.
+    void waitForTransferQueueUpload(RendererVk *renderer);
+
     void clearColor(const VkClearColorValue &color,
                     LevelIndex baseMipLevelVk,
                     uint32_t levelCount,
@@ -2007,6 +2182,17 @@ class ImageHelper final : public Resource, public angle::Subject
     bool validateSubresourceUpdateImageRefsConsistent() const;
 
     void resetCachedProperties();
+
+    // Allocates the memory of a sparse page when it's committed, or moves it to |decommittedOut|
+    // when it's decommitted.  *bindOut is false if the page is already in the requested state.
+    angle::Result updateSparsePage(Context *context,
+                                   uint64_t pageKey,
+                                   VkDeviceSize size,
+                                   bool commit,
+                                   std::vector<Allocation> *decommittedOut,
+                                   VkDeviceMemory *memoryOut,
+                                   VkDeviceSize *memoryOffsetOut,
+                                   bool *bindOut);
     void setEntireContentDefined();
     void setEntireContentUndefined();
     void setContentDefined(LevelIndex levelStart,
@@ -2092,6 +2278,18 @@ class ImageHelper final : public Resource, public angle::Subject
     DynamicBuffer mStagingBuffer;
     std::vector<std::vector<SubresourceUpdate>> mSubresourceUpdates;
 
+    // Signaled when the upload done on the transfer queue finishes.  Valid until the image is
+    // acquired by the graphics queue.  The staging buffers read by the upload are kept in
+    // mStagingBuffer until then.
+    Semaphore mTransferQueueUploadSemaphore;
+    std::vector<BufferHelper *> mTransferQueueUploadBuffers;
+
+    // Sparse residency.  The memory of each committed page, keyed by its level, layer and
+    // position, or by its layer for the mip tail.
+    VkMemoryRequirements mSparsePageMemoryRequirements;
+    VkSparseImageMemoryRequirements mSparseMemoryRequirements;
+    std::unordered_map<uint64_t, Allocation> mSparsePages;
+
     // Optimization for repeated clear with the same value. If this pointer is not null, the entire
     // image it has been cleared to the specified clear value. If another clear call is made with
     // the exact same clear value, we will detect and skip the clear call.
@@ -2103,11 +2301,61 @@ class ImageHelper final : public Resource, public angle::Subject
     gl::TexLevelArray<LevelContentDefinedMask> mStencilContentDefined;
 };
 
+// Holds the images of destroyed offscreen surfaces, so that offscreen surfaces created later with
+// the same size, format and sample count can reuse them instead of allocating and binding new
+// memory.  Owned by the renderer and shared by all contexts, so access is synchronized.  Used with
+// the poolOffscreenSurfaceImages feature.
+class SurfaceImagePool final : angle::NonCopyable
+{
+  public:
+    SurfaceImagePool();
+    ~SurfaceImagePool();
+
+    void destroy(RendererVk *renderer);
+
+    // Takes a matching image out of the pool, or returns nullptr if none is pooled.  The image may
+    // still be in use by the GPU, which is fine as its layout is tracked like any other image's.
+    std::unique_ptr<ImageHelper> acquireImage(const VkExtent3D &extents,
+                                              const Format &format,
+                                              GLint samples,
+                                              VkImageUsageFlags usage);
+
+    // Adds an image without staged updates to the pool.  The oldest images are released to the
+    // renderer garbage when the pool grows past its limit.
+    void addImage(RendererVk *renderer, std::unique_ptr<ImageHelper> &&image);
+
+    // Releases all the images in the pool to the renderer garbage.
+    void releaseImages(RendererVk *renderer);
+
+    // Releases the images that no surface reused for many submissions.
+    void releaseStaleImages(RendererVk *renderer, Serial lastCompletedSerial);
+
+  private:
+    struct PooledImage
+    {
+        std::unique_ptr<ImageHelper> image;
+        VkDeviceSize size;
+        // The queue serial when the image was added to the pool.
+        Serial addedSerial;
+    };
+
+    std::mutex mMutex;
+    // Ordered from the least to the most recently added.
+    std::deque<PooledImage> mImages;
+    VkDeviceSize mTotalSize;
+};
+
 // A vector of image views, such as one per level or one per layer.
 using ImageViewVector = std::vector<ImageView>;
 
-// A vector of vector of image views.  Primary index is layer, secondary index is level.
-using LayerLevelImageViewVector = std::vector<ImageViewVector>;
+// The draw and storage views of an image, keyed by a packed descriptor of the view.  The views are
+// handed out by pointer, so std::unordered_map is used for its stable element addresses.
+struct CachedImageView
+{
+    ImageView view;
+    uint64_t lastUse = 0;
+};
+using ImageViewCache = std::unordered_map<uint32_t, CachedImageView>;
 
 // Address mode for layers: only possible to access either 1 layer or all layers.
 enum LayerMode
@@ -2132,7 +2380,7 @@ class ImageViewHelper final : public Resource
 
     void init(RendererVk *renderer);
     void release(RendererVk *renderer);
-    void destroy(VkDevice device);
+    void destroy(RendererVk *renderer);
 
     const ImageView &getLinearReadImageView() const
     {
@@ -2274,6 +2522,25 @@ class ImageViewHelper final : public Resource
         gl::SrgbOverride srgbOverrideMode) const;
 
   private:
+    enum class CachedViewKind : uint32_t
+    {
+        Draw,
+        DrawLinear,
+        Storage,
+    };
+
+    // Returns the cached view, which is invalid if it hasn't been created yet.
+    ImageView *getCachedImageView(RendererVk *renderer,
+                                  CachedViewKind kind,
+                                  LayerMode layerMode,
+                                  LevelIndex levelVk,
+                                  uint32_t layer);
+
+    // Destroys the least recently used draw and storage views when there are too many of them.
+    // This is only done when the GPU is done with the image views, which also guarantees that no
+    // view returned earlier is still referenced.
+    void trimImageViewCache(RendererVk *renderer);
+
     ImageView &getReadImageView()
     {
         return mLinearColorspace ? getReadViewImpl(mPerLevelLinearReadImageViews)
@@ -2353,16 +2620,10 @@ class ImageViewHelper final : public Resource
 
     bool mLinearColorspace;
 
-    // Draw views
-    ImageViewVector mLevelDrawImageViews;
-    LayerLevelImageViewVector mLayerLevelDrawImageViews;
-
-    ImageViewVector mLevelDrawImageViewsLinear;
-    LayerLevelImageViewVector mLayerLevelDrawImageViewsLinear;
-
-    // Storage views
-    ImageViewVector mLevelStorageImageViews;
-    LayerLevelImageViewVector mLayerLevelStorageImageViews;
+    // Draw and storage views, created on first use.  mCachedImageViewUseCount orders their uses
+    // for trimming.
+    ImageViewCache mCachedImageViews;
+    uint64_t mCachedImageViewUseCount;
 
     // Serial for the image view set. getSubresourceSerial combines it with subresource info.
     ImageOrBufferViewSerial mImageViewSerial;
@@ -2468,33 +2729,35 @@ class ShaderProgramHelper : angle::NonCopyable
         ANGLE_TRY(renderPassCache->getCompatibleRenderPass(
             contextVk, pipelineDesc.getRenderPassDesc(), &compatibleRenderPass));
 
-        ShaderModule *vertexShader   = &mShaders[gl::ShaderType::Vertex].get().get();
-        ShaderModule *fragmentShader = mShaders[gl::ShaderType::Fragment].valid()
-                                           ? &mShaders[gl::ShaderType::Fragment].get().get()
-                                           : nullptr;
-        ShaderModule *geometryShader = mShaders[gl::ShaderType::Geometry].valid()
-                                           ? &mShaders[gl::ShaderType::Geometry].get().get()
-                                           : nullptr;
-        ShaderModule *tessControlShader = mShaders[gl::ShaderType::TessControl].valid()
-                                              ? &mShaders[gl::ShaderType::TessControl].get().get()
-                                              : nullptr;
-        ShaderModule *tessEvaluationShader =
-            mShaders[gl::ShaderType::TessEvaluation].valid()
-                ? &mShaders[gl::ShaderType::TessEvaluation].get().get()
-                : nullptr;
-
         return mGraphicsPipelines.getPipeline(
             contextVk, pipelineCache, *compatibleRenderPass, pipelineLayout,
-            activeAttribLocationsMask, programAttribsTypeMask, vertexShader, fragmentShader,
-            geometryShader, tessControlShader, tessEvaluationShader, mSpecializationConstants,
+            activeAttribLocationsMask, programAttribsTypeMask,
+            getShaderModule(gl::ShaderType::Vertex), getShaderModule(gl::ShaderType::Fragment),
+            getShaderModule(gl::ShaderType::Geometry), getShaderModule(gl::ShaderType::TessControl),
+            getShaderModule(gl::ShaderType::TessEvaluation), mSpecializationConstants,
             pipelineDesc, descPtrOut, pipelineOut);
     }
 
+    // Starts creating the pipeline on a worker thread if it's not already in the cache.
+    angle::Result warmUpGraphicsPipeline(ContextVk *contextVk,
+                                         RenderPassCache *renderPassCache,
+                                         const PipelineCache &pipelineCache,
+                                         const PipelineLayout &pipelineLayout,
+                                         const GraphicsPipelineDesc &pipelineDesc,
+                                         const gl::AttributesMask &activeAttribLocationsMask,
+                                         const gl::ComponentTypeMask &programAttribsTypeMask,
+                                         PipelineHelper **pipelineOut);
+
     angle::Result getComputePipeline(Context *context,
                                      const PipelineLayout &pipelineLayout,
                                      PipelineAndSerial **pipelineOut);
 
   private:
+    ShaderModule *getShaderModule(gl::ShaderType shaderType)
+    {
+        return mShaders[shaderType].valid() ? &mShaders[shaderType].get().get() : nullptr;
+    }
+
     gl::ShaderMap<BindingPointer<ShaderAndSerial>> mShaders;
     GraphicsPipelineCache mGraphicsPipelines;
 
@@ -363,7 +363,7 @@ angle::Result GetShader(Context *context,
         return angle::Result::Continue;
     }
 
-    // Create shader lazily. Access will need to be locked for multi-threading.
+    // Create shader lazily.  The library is shared by all contexts, so the caller holds its lock.
     const CompressedShaderBlob &compressedShaderCode = compressedShaderBlobs[shaderFlags];
     ASSERT(compressedShaderCode.code != nullptr);
 
@@ -446,6 +446,7 @@ angle::Result ShaderLibrary::getBlitResolve_frag(Context *context,
                                                  uint32_t shaderFlags,
                                                  RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mBlitResolve_frag_shaders, kBlitResolve_frag_shaders,
                      ArraySize(kBlitResolve_frag_shaders), shaderFlags, shaderOut);
 }
@@ -455,6 +456,7 @@ angle::Result ShaderLibrary::getBlitResolveStencilNoExport_comp(
     uint32_t shaderFlags,
     RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mBlitResolveStencilNoExport_comp_shaders,
                      kBlitResolveStencilNoExport_comp_shaders,
                      ArraySize(kBlitResolveStencilNoExport_comp_shaders), shaderFlags, shaderOut);
@@ -464,6 +466,7 @@ angle::Result ShaderLibrary::getConvertIndex_comp(Context *context,
                                                   uint32_t shaderFlags,
                                                   RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mConvertIndex_comp_shaders, kConvertIndex_comp_shaders,
                      ArraySize(kConvertIndex_comp_shaders), shaderFlags, shaderOut);
 }
@@ -473,6 +476,7 @@ angle::Result ShaderLibrary::getConvertIndexIndirectLineLoop_comp(
     uint32_t shaderFlags,
     RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mConvertIndexIndirectLineLoop_comp_shaders,
                      kConvertIndexIndirectLineLoop_comp_shaders,
                      ArraySize(kConvertIndexIndirectLineLoop_comp_shaders), shaderFlags, shaderOut);
@@ -483,6 +487,7 @@ angle::Result ShaderLibrary::getConvertIndirectLineLoop_comp(
     uint32_t shaderFlags,
     RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mConvertIndirectLineLoop_comp_shaders,
                      kConvertIndirectLineLoop_comp_shaders,
                      ArraySize(kConvertIndirectLineLoop_comp_shaders), shaderFlags, shaderOut);
@@ -492,6 +497,7 @@ angle::Result ShaderLibrary::getConvertVertex_comp(Context *context,
                                                    uint32_t shaderFlags,
                                                    RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mConvertVertex_comp_shaders, kConvertVertex_comp_shaders,
                      ArraySize(kConvertVertex_comp_shaders), shaderFlags, shaderOut);
 }
@@ -500,6 +506,7 @@ angle::Result ShaderLibrary::getFullScreenQuad_vert(Context *context,
                                                     uint32_t shaderFlags,
                                                     RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mFullScreenQuad_vert_shaders, kFullScreenQuad_vert_shaders,
                      ArraySize(kFullScreenQuad_vert_shaders), shaderFlags, shaderOut);
 }
@@ -508,6 +515,7 @@ angle::Result ShaderLibrary::getGenerateMipmap_comp(Context *context,
                                                     uint32_t shaderFlags,
                                                     RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mGenerateMipmap_comp_shaders, kGenerateMipmap_comp_shaders,
                      ArraySize(kGenerateMipmap_comp_shaders), shaderFlags, shaderOut);
 }
@@ -516,6 +524,7 @@ angle::Result ShaderLibrary::getImageClear_frag(Context *context,
                                                 uint32_t shaderFlags,
                                                 RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mImageClear_frag_shaders, kImageClear_frag_shaders,
                      ArraySize(kImageClear_frag_shaders), shaderFlags, shaderOut);
 }
@@ -524,6 +533,7 @@ angle::Result ShaderLibrary::getImageCopy_frag(Context *context,
                                                uint32_t shaderFlags,
                                                RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mImageCopy_frag_shaders, kImageCopy_frag_shaders,
                      ArraySize(kImageCopy_frag_shaders), shaderFlags, shaderOut);
 }
@@ -532,6 +542,7 @@ angle::Result ShaderLibrary::getOverlayCull_comp(Context *context,
                                                  uint32_t shaderFlags,
                                                  RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mOverlayCull_comp_shaders, kOverlayCull_comp_shaders,
                      ArraySize(kOverlayCull_comp_shaders), shaderFlags, shaderOut);
 }
@@ -540,6 +551,7 @@ angle::Result ShaderLibrary::getOverlayDraw_comp(Context *context,
                                                  uint32_t shaderFlags,
                                                  RefCounted<ShaderAndSerial> **shaderOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return GetShader(context, mOverlayDraw_comp_shaders, kOverlayDraw_comp_shaders,
                      ArraySize(kOverlayDraw_comp_shaders), shaderFlags, shaderOut);
 }
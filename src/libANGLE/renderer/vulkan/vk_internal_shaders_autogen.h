@@ -11,6 +11,8 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_VK_INTERNAL_SHADERS_AUTOGEN_H_
 #define LIBANGLE_RENDERER_VULKAN_VK_INTERNAL_SHADERS_AUTOGEN_H_
 
+#include <mutex>
+
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
 namespace rx
@@ -236,6 +238,8 @@ class ShaderLibrary final : angle::NonCopyable
                                       RefCounted<ShaderAndSerial> **shaderOut);
 
   private:
+    std::mutex mMutex;
+
     RefCounted<ShaderAndSerial>
         mBlitResolve_frag_shaders[InternalShader::BlitResolve_frag::kArrayLen];
     RefCounted<ShaderAndSerial> mBlitResolveStencilNoExport_comp_shaders
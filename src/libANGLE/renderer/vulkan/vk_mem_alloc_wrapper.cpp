@@ -18,6 +18,7 @@ VkResult InitAllocator(VkPhysicalDevice physicalDevice,
                        VkInstance instance,
                        uint32_t apiVersion,
                        VkDeviceSize preferredLargeHeapBlockSize,
+                       bool useMemoryBudget,
                        VmaAllocator *pAllocator)
 {
     VmaVulkanFunctions funcs                  = {};
@@ -63,6 +64,10 @@ VkResult InitAllocator(VkPhysicalDevice physicalDevice,
     allocatorInfo.pVulkanFunctions            = &funcs;
     allocatorInfo.vulkanApiVersion            = apiVersion;
     allocatorInfo.preferredLargeHeapBlockSize = preferredLargeHeapBlockSize;
+    if (useMemoryBudget)
+    {
+        allocatorInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
 
     return vmaCreateAllocator(&allocatorInfo, pAllocator);
 }
@@ -100,6 +105,25 @@ VkResult CreateBuffer(VmaAllocator allocator,
     return result;
 }
 
+VkResult AllocateMemory(VmaAllocator allocator,
+                        const VkMemoryRequirements *pMemoryRequirements,
+                        VkMemoryPropertyFlags requiredFlags,
+                        VmaAllocation *pAllocation,
+                        VkDeviceMemory *pDeviceMemoryOut,
+                        VkDeviceSize *pOffsetOut)
+{
+    VmaAllocationCreateInfo allocationCreateInfo = {};
+    allocationCreateInfo.requiredFlags           = requiredFlags;
+    VmaAllocationInfo allocationInfo             = {};
+
+    VkResult result = vmaAllocateMemory(allocator, pMemoryRequirements, &allocationCreateInfo,
+                                        pAllocation, &allocationInfo);
+    *pDeviceMemoryOut = allocationInfo.deviceMemory;
+    *pOffsetOut       = allocationInfo.offset;
+
+    return result;
+}
+
 VkResult FindMemoryTypeIndexForBufferInfo(VmaAllocator allocator,
                                           const VkBufferCreateInfo *pBufferCreateInfo,
                                           VkMemoryPropertyFlags requiredFlags,
@@ -158,4 +182,21 @@ void FreeStatsString(VmaAllocator allocator, char *statsString)
 {
     vmaFreeStatsString(allocator, statsString);
 }
+
+void SetCurrentFrameIndex(VmaAllocator allocator, uint32_t frameIndex)
+{
+    vmaSetCurrentFrameIndex(allocator, frameIndex);
+}
+
+void GetHeapBudgets(VmaAllocator allocator, VkDeviceSize *pBudgets, VkDeviceSize *pUsages)
+{
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS] = {};
+    vmaGetBudget(allocator, budgets);
+
+    for (uint32_t heapIndex = 0; heapIndex < VK_MAX_MEMORY_HEAPS; ++heapIndex)
+    {
+        pBudgets[heapIndex] = budgets[heapIndex].budget;
+        pUsages[heapIndex]  = budgets[heapIndex].usage;
+    }
+}
 }  // namespace vma
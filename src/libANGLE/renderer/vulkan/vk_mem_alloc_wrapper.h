@@ -22,6 +22,7 @@ VkResult InitAllocator(VkPhysicalDevice physicalDevice,
                        VkInstance instance,
                        uint32_t apiVersion,
                        VkDeviceSize preferredLargeHeapBlockSize,
+                       bool useMemoryBudget,
                        VmaAllocator *pAllocator);
 
 void DestroyAllocator(VmaAllocator allocator);
@@ -37,6 +38,13 @@ VkResult CreateBuffer(VmaAllocator allocator,
                       VkBuffer *pBuffer,
                       VmaAllocation *pAllocation);
 
+VkResult AllocateMemory(VmaAllocator allocator,
+                        const VkMemoryRequirements *pMemoryRequirements,
+                        VkMemoryPropertyFlags requiredFlags,
+                        VmaAllocation *pAllocation,
+                        VkDeviceMemory *pDeviceMemoryOut,
+                        VkDeviceSize *pOffsetOut);
+
 VkResult FindMemoryTypeIndexForBufferInfo(VmaAllocator allocator,
                                           const VkBufferCreateInfo *pBufferCreateInfo,
                                           VkMemoryPropertyFlags requiredFlags,
@@ -65,6 +73,11 @@ void InvalidateAllocation(VmaAllocator allocator,
 void BuildStatsString(VmaAllocator allocator, char **statsString, VkBool32 detailedMap);
 void FreeStatsString(VmaAllocator allocator, char *statsString);
 
+void SetCurrentFrameIndex(VmaAllocator allocator, uint32_t frameIndex);
+
+// pBudgets and pUsages have VK_MAX_MEMORY_HEAPS entries, one per memory heap.
+void GetHeapBudgets(VmaAllocator allocator, VkDeviceSize *pBudgets, VkDeviceSize *pUsages);
+
 }  // namespace vma
 
 #endif  // LIBANGLE_RENDERER_VULKAN_VK_MEM_ALLOC_WRAPPER_H_
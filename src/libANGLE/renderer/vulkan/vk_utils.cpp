@@ -703,6 +703,10 @@ void GarbageObject::destroy(RendererVk *renderer)
         case HandleType::DescriptorSetLayout:
             vkDestroyDescriptorSetLayout(device, (VkDescriptorSetLayout)mHandle, nullptr);
             break;
+        case HandleType::DescriptorUpdateTemplate:
+            vkDestroyDescriptorUpdateTemplateKHR(device, (VkDescriptorUpdateTemplate)mHandle,
+                                                 nullptr);
+            break;
         case HandleType::Sampler:
             vkDestroySampler(device, (VkSampler)mHandle, nullptr);
             break;
@@ -846,6 +850,15 @@ PFN_vkCmdBeginQueryIndexedEXT vkCmdBeginQueryIndexedEXT                       =
 PFN_vkCmdEndQueryIndexedEXT vkCmdEndQueryIndexedEXT                           = nullptr;
 PFN_vkCmdDrawIndirectByteCountEXT vkCmdDrawIndirectByteCountEXT               = nullptr;
 
+// VK_EXT_extended_dynamic_state
+PFN_vkCmdSetCullModeEXT vkCmdSetCullModeEXT                   = nullptr;
+PFN_vkCmdSetFrontFaceEXT vkCmdSetFrontFaceEXT                 = nullptr;
+PFN_vkCmdSetDepthTestEnableEXT vkCmdSetDepthTestEnableEXT     = nullptr;
+PFN_vkCmdSetDepthWriteEnableEXT vkCmdSetDepthWriteEnableEXT   = nullptr;
+PFN_vkCmdSetDepthCompareOpEXT vkCmdSetDepthCompareOpEXT       = nullptr;
+PFN_vkCmdSetStencilTestEnableEXT vkCmdSetStencilTestEnableEXT = nullptr;
+PFN_vkCmdSetStencilOpEXT vkCmdSetStencilOpEXT                 = nullptr;
+
 // VK_KHR_get_memory_requirements2
 PFN_vkGetBufferMemoryRequirements2KHR vkGetBufferMemoryRequirements2KHR = nullptr;
 PFN_vkGetImageMemoryRequirements2KHR vkGetImageMemoryRequirements2KHR   = nullptr;
@@ -873,6 +886,21 @@ PFN_vkDestroySamplerYcbcrConversionKHR vkDestroySamplerYcbcrConversionKHR = null
 // VK_KHR_create_renderpass2
 PFN_vkCreateRenderPass2KHR vkCreateRenderPass2KHR = nullptr;
 
+// VK_KHR_timeline_semaphore
+PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValueKHR = nullptr;
+PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR                     = nullptr;
+
+// VK_KHR_synchronization2
+PFN_vkCmdPipelineBarrier2KHR vkCmdPipelineBarrier2KHR = nullptr;
+
+// VK_KHR_push_descriptor
+PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR = nullptr;
+
+// VK_KHR_descriptor_update_template
+PFN_vkCreateDescriptorUpdateTemplateKHR vkCreateDescriptorUpdateTemplateKHR   = nullptr;
+PFN_vkDestroyDescriptorUpdateTemplateKHR vkDestroyDescriptorUpdateTemplateKHR = nullptr;
+PFN_vkUpdateDescriptorSetWithTemplateKHR vkUpdateDescriptorSetWithTemplateKHR = nullptr;
+
 #    if defined(ANGLE_PLATFORM_FUCHSIA)
 // VK_FUCHSIA_imagepipe_surface
 PFN_vkCreateImagePipeSurfaceFUCHSIA vkCreateImagePipeSurfaceFUCHSIA = nullptr;
@@ -934,6 +962,17 @@ void InitTransformFeedbackEXTFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkCmdDrawIndirectByteCountEXT);
 }
 
+void InitExtendedDynamicStateEXTFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCmdSetCullModeEXT);
+    GET_DEVICE_FUNC(vkCmdSetFrontFaceEXT);
+    GET_DEVICE_FUNC(vkCmdSetDepthTestEnableEXT);
+    GET_DEVICE_FUNC(vkCmdSetDepthWriteEnableEXT);
+    GET_DEVICE_FUNC(vkCmdSetDepthCompareOpEXT);
+    GET_DEVICE_FUNC(vkCmdSetStencilTestEnableEXT);
+    GET_DEVICE_FUNC(vkCmdSetStencilOpEXT);
+}
+
 // VK_KHR_sampler_ycbcr_conversion
 void InitSamplerYcbcrKHRFunctions(VkDevice device)
 {
@@ -947,6 +986,33 @@ void InitRenderPass2KHRFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkCreateRenderPass2KHR);
 }
 
+// VK_KHR_timeline_semaphore
+void InitTimelineSemaphoreKHRFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetSemaphoreCounterValueKHR);
+    GET_DEVICE_FUNC(vkWaitSemaphoresKHR);
+}
+
+// VK_KHR_synchronization2
+void InitSynchronization2KHRFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCmdPipelineBarrier2KHR);
+}
+
+// VK_KHR_push_descriptor
+void InitPushDescriptorKHRFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCmdPushDescriptorSetKHR);
+}
+
+// VK_KHR_descriptor_update_template
+void InitDescriptorUpdateTemplateKHRFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCreateDescriptorUpdateTemplateKHR);
+    GET_DEVICE_FUNC(vkDestroyDescriptorUpdateTemplateKHR);
+    GET_DEVICE_FUNC(vkUpdateDescriptorSetWithTemplateKHR);
+}
+
 #    if defined(ANGLE_PLATFORM_FUCHSIA)
 void InitImagePipeSurfaceFUCHSIAFunctions(VkInstance instance)
 {
@@ -1247,6 +1313,32 @@ VkCompareOp GetCompareOp(const GLenum compareFunc)
     }
 }
 
+VkStencilOp GetStencilOp(const GLenum stencilOp)
+{
+    switch (stencilOp)
+    {
+        case GL_KEEP:
+            return VK_STENCIL_OP_KEEP;
+        case GL_ZERO:
+            return VK_STENCIL_OP_ZERO;
+        case GL_REPLACE:
+            return VK_STENCIL_OP_REPLACE;
+        case GL_INCR:
+            return VK_STENCIL_OP_INCREMENT_AND_CLAMP;
+        case GL_DECR:
+            return VK_STENCIL_OP_DECREMENT_AND_CLAMP;
+        case GL_INCR_WRAP:
+            return VK_STENCIL_OP_INCREMENT_AND_WRAP;
+        case GL_DECR_WRAP:
+            return VK_STENCIL_OP_DECREMENT_AND_WRAP;
+        case GL_INVERT:
+            return VK_STENCIL_OP_INVERT;
+        default:
+            UNREACHABLE();
+            return VK_STENCIL_OP_KEEP;
+    }
+}
+
 void GetOffset(const gl::Offset &glOffset, VkOffset3D *vkOffset)
 {
     vkOffset->x = glOffset.x;
@@ -352,6 +352,13 @@ class MemoryProperties final : angle::NonCopyable
         return mMemoryProperties.memoryHeaps[heapIndex].size;
     }
 
+    uint32_t getMemoryHeapCount() const { return mMemoryProperties.memoryHeapCount; }
+    bool isDeviceLocalHeap(uint32_t heapIndex) const
+    {
+        return (mMemoryProperties.memoryHeaps[heapIndex].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) !=
+               0;
+    }
+
   private:
     VkPhysicalDeviceMemoryProperties mMemoryProperties;
 };
@@ -864,6 +871,8 @@ struct PerfCounters
     uint32_t primaryBuffers;
     uint32_t renderPasses;
     uint32_t writeDescriptorSets;
+    // The part of writeDescriptorSets made to set up dispatches.
+    uint32_t dispatchWriteDescriptorSets;
     uint32_t flushedOutsideRenderPassCommandBuffers;
     uint32_t resolveImageCommands;
     uint32_t depthClears;
@@ -882,6 +891,7 @@ struct PerfCounters
     uint32_t descriptorSetAllocations;
     uint32_t shaderBuffersDescriptorSetCacheHits;
     uint32_t shaderBuffersDescriptorSetCacheMisses;
+    uint32_t graphicsPipelineEvictions;
 };
 
 // A Vulkan image level index.
@@ -894,8 +904,13 @@ void InitDebugUtilsEXTFunctions(VkInstance instance);
 void InitDebugReportEXTFunctions(VkInstance instance);
 void InitGetPhysicalDeviceProperties2KHRFunctions(VkInstance instance);
 void InitTransformFeedbackEXTFunctions(VkDevice device);
+void InitExtendedDynamicStateEXTFunctions(VkDevice device);
 void InitSamplerYcbcrKHRFunctions(VkDevice device);
 void InitRenderPass2KHRFunctions(VkDevice device);
+void InitTimelineSemaphoreKHRFunctions(VkDevice device);
+void InitSynchronization2KHRFunctions(VkDevice device);
+void InitPushDescriptorKHRFunctions(VkDevice device);
+void InitDescriptorUpdateTemplateKHRFunctions(VkDevice device);
 
 #    if defined(ANGLE_PLATFORM_FUCHSIA)
 // VK_FUCHSIA_imagepipe_surface
@@ -950,6 +965,7 @@ VkFrontFace GetFrontFace(GLenum frontFace, bool invertCullFace);
 VkSampleCountFlagBits GetSamples(GLint sampleCount);
 VkComponentSwizzle GetSwizzle(const GLenum swizzle);
 VkCompareOp GetCompareOp(const GLenum compareFunc);
+VkStencilOp GetStencilOp(const GLenum stencilOp);
 
 constexpr gl::ShaderMap<VkShaderStageFlagBits> kShaderStageMap = {
     {gl::ShaderType::Vertex, VK_SHADER_STAGE_VERTEX_BIT},
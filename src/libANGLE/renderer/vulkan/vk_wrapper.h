@@ -36,6 +36,7 @@ namespace vk
     FUNC(CommandPool)              \
     FUNC(DescriptorPool)           \
     FUNC(DescriptorSetLayout)      \
+    FUNC(DescriptorUpdateTemplate) \
     FUNC(DeviceMemory)             \
     FUNC(Event)                    \
     FUNC(Fence)                    \
@@ -336,11 +337,19 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                          uint32_t imageMemoryBarrierCount,
                          const VkImageMemoryBarrier *imageMemoryBarriers);
 
+    // VK_KHR_synchronization2
+    void pipelineBarrier2(const VkDependencyInfoKHR &dependencyInfo);
+
     void pushConstants(const PipelineLayout &layout,
                        VkShaderStageFlags flag,
                        uint32_t offset,
                        uint32_t size,
                        const void *data);
+    void pushDescriptorSet(const PipelineLayout &layout,
+                           VkPipelineBindPoint pipelineBindPoint,
+                           uint32_t set,
+                           uint32_t descriptorWriteCount,
+                           const VkWriteDescriptorSet *descriptorWrites);
 
     void setEvent(VkEvent event, VkPipelineStageFlags stageMask);
     void setScissor(uint32_t firstScissor, uint32_t scissorCount, const VkRect2D *scissors);
@@ -383,6 +392,19 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                                          const VkDeviceSize *offsets,
                                          const VkDeviceSize *sizes);
 
+    // VK_EXT_extended_dynamic_state
+    void setCullModeEXT(VkCullModeFlags cullMode);
+    void setFrontFaceEXT(VkFrontFace frontFace);
+    void setDepthTestEnableEXT(VkBool32 depthTestEnable);
+    void setDepthWriteEnableEXT(VkBool32 depthWriteEnable);
+    void setDepthCompareOpEXT(VkCompareOp depthCompareOp);
+    void setStencilTestEnableEXT(VkBool32 stencilTestEnable);
+    void setStencilOpEXT(VkStencilFaceFlags faceMask,
+                         VkStencilOp failOp,
+                         VkStencilOp passOp,
+                         VkStencilOp depthFailOp,
+                         VkCompareOp compareOp);
+
     // VK_EXT_debug_utils
     void beginDebugUtilsLabelEXT(const VkDebugUtilsLabelEXT &labelInfo);
     void endDebugUtilsLabelEXT();
@@ -434,6 +456,10 @@ class Semaphore final : public WrappedObject<Semaphore, VkSemaphore>
     VkResult init(VkDevice device);
     VkResult init(VkDevice device, const VkSemaphoreCreateInfo &createInfo);
     VkResult importFd(VkDevice device, const VkImportSemaphoreFdInfoKHR &importFdInfo) const;
+
+    // VK_KHR_timeline_semaphore
+    VkResult getCounterValue(VkDevice device, uint64_t *valueOut) const;
+    VkResult wait(VkDevice device, uint64_t value, uint64_t timeout) const;
 };
 
 class Framebuffer final : public WrappedObject<Framebuffer, VkFramebuffer>
@@ -475,7 +501,8 @@ class Allocator : public WrappedObject<Allocator, VmaAllocator>
                   VkDevice device,
                   VkInstance instance,
                   uint32_t apiVersion,
-                  VkDeviceSize preferredLargeHeapBlockSize);
+                  VkDeviceSize preferredLargeHeapBlockSize,
+                  bool useMemoryBudget);
 
     // Initializes the buffer handle and memory allocation.
     VkResult createBuffer(const VkBufferCreateInfo &bufferCreateInfo,
@@ -486,6 +513,13 @@ class Allocator : public WrappedObject<Allocator, VmaAllocator>
                           Buffer *bufferOut,
                           Allocation *allocationOut) const;
 
+    // Allocates memory that isn't bound to a resource, such as the pages of a sparse image.
+    VkResult allocateMemory(const VkMemoryRequirements &memoryRequirements,
+                            VkMemoryPropertyFlags requiredFlags,
+                            Allocation *allocationOut,
+                            VkDeviceMemory *deviceMemoryOut,
+                            VkDeviceSize *offsetOut) const;
+
     void getMemoryTypeProperties(uint32_t memoryTypeIndex, VkMemoryPropertyFlags *flagsOut) const;
     VkResult findMemoryTypeIndexForBufferInfo(const VkBufferCreateInfo &bufferCreateInfo,
                                               VkMemoryPropertyFlags requiredFlags,
@@ -495,6 +529,11 @@ class Allocator : public WrappedObject<Allocator, VmaAllocator>
 
     void buildStatsString(char **statsString, VkBool32 detailedMap);
     void freeStatsString(char *statsString);
+
+    // Without VK_EXT_memory_budget, the budgets and usages are estimated from the heap sizes and
+    // the allocations made through the allocator.
+    void setCurrentFrameIndex(uint32_t frameIndex) const;
+    void getHeapBudgets(VkDeviceSize *budgetsOut, VkDeviceSize *usagesOut) const;
 };
 
 class Allocation final : public WrappedObject<Allocation, VmaAllocation>
@@ -593,6 +632,20 @@ class DescriptorSetLayout final : public WrappedObject<DescriptorSetLayout, VkDe
     VkResult init(VkDevice device, const VkDescriptorSetLayoutCreateInfo &createInfo);
 };
 
+class DescriptorUpdateTemplate final
+    : public WrappedObject<DescriptorUpdateTemplate, VkDescriptorUpdateTemplate>
+{
+  public:
+    DescriptorUpdateTemplate() = default;
+    void destroy(VkDevice device);
+
+    VkResult init(VkDevice device, const VkDescriptorUpdateTemplateCreateInfo &createInfo);
+
+    void updateDescriptorSet(VkDevice device,
+                             VkDescriptorSet descriptorSet,
+                             const void *data) const;
+};
+
 class DescriptorPool final : public WrappedObject<DescriptorPool, VkDescriptorPool>
 {
   public:
@@ -607,6 +660,7 @@ class DescriptorPool final : public WrappedObject<DescriptorPool, VkDescriptorPo
     VkResult freeDescriptorSets(VkDevice device,
                                 uint32_t descriptorSetCount,
                                 const VkDescriptorSet *descriptorSets);
+    VkResult reset(VkDevice device);
 };
 
 class Sampler final : public WrappedObject<Sampler, VkSampler>
@@ -782,6 +836,13 @@ ANGLE_INLINE void CommandBuffer::pipelineBarrier(VkPipelineStageFlags srcStageMa
                          imageMemoryBarrierCount, imageMemoryBarriers);
 }
 
+ANGLE_INLINE void CommandBuffer::pipelineBarrier2(const VkDependencyInfoKHR &dependencyInfo)
+{
+    ASSERT(valid());
+    ASSERT(vkCmdPipelineBarrier2KHR);
+    vkCmdPipelineBarrier2KHR(mHandle, &dependencyInfo);
+}
+
 ANGLE_INLINE void CommandBuffer::executionBarrier(VkPipelineStageFlags stageMask)
 {
     ASSERT(valid());
@@ -968,6 +1029,17 @@ ANGLE_INLINE void CommandBuffer::pushConstants(const PipelineLayout &layout,
     vkCmdPushConstants(mHandle, layout.getHandle(), flag, 0, size, data);
 }
 
+ANGLE_INLINE void CommandBuffer::pushDescriptorSet(const PipelineLayout &layout,
+                                                   VkPipelineBindPoint pipelineBindPoint,
+                                                   uint32_t set,
+                                                   uint32_t descriptorWriteCount,
+                                                   const VkWriteDescriptorSet *descriptorWrites)
+{
+    ASSERT(valid() && layout.valid());
+    vkCmdPushDescriptorSetKHR(mHandle, pipelineBindPoint, layout.getHandle(), set,
+                              descriptorWriteCount, descriptorWrites);
+}
+
 ANGLE_INLINE void CommandBuffer::setEvent(VkEvent event, VkPipelineStageFlags stageMask)
 {
     ASSERT(valid() && event != VK_NULL_HANDLE);
@@ -1219,6 +1291,59 @@ ANGLE_INLINE void CommandBuffer::bindTransformFeedbackBuffersEXT(uint32_t firstB
                                          sizes);
 }
 
+ANGLE_INLINE void CommandBuffer::setCullModeEXT(VkCullModeFlags cullMode)
+{
+    ASSERT(valid());
+    ASSERT(vkCmdSetCullModeEXT);
+    vkCmdSetCullModeEXT(mHandle, cullMode);
+}
+
+ANGLE_INLINE void CommandBuffer::setFrontFaceEXT(VkFrontFace frontFace)
+{
+    ASSERT(valid());
+    ASSERT(vkCmdSetFrontFaceEXT);
+    vkCmdSetFrontFaceEXT(mHandle, frontFace);
+}
+
+ANGLE_INLINE void CommandBuffer::setDepthTestEnableEXT(VkBool32 depthTestEnable)
+{
+    ASSERT(valid());
+    ASSERT(vkCmdSetDepthTestEnableEXT);
+    vkCmdSetDepthTestEnableEXT(mHandle, depthTestEnable);
+}
+
+ANGLE_INLINE void CommandBuffer::setDepthWriteEnableEXT(VkBool32 depthWriteEnable)
+{
+    ASSERT(valid());
+    ASSERT(vkCmdSetDepthWriteEnableEXT);
+    vkCmdSetDepthWriteEnableEXT(mHandle, depthWriteEnable);
+}
+
+ANGLE_INLINE void CommandBuffer::setDepthCompareOpEXT(VkCompareOp depthCompareOp)
+{
+    ASSERT(valid());
+    ASSERT(vkCmdSetDepthCompareOpEXT);
+    vkCmdSetDepthCompareOpEXT(mHandle, depthCompareOp);
+}
+
+ANGLE_INLINE void CommandBuffer::setStencilTestEnableEXT(VkBool32 stencilTestEnable)
+{
+    ASSERT(valid());
+    ASSERT(vkCmdSetStencilTestEnableEXT);
+    vkCmdSetStencilTestEnableEXT(mHandle, stencilTestEnable);
+}
+
+ANGLE_INLINE void CommandBuffer::setStencilOpEXT(VkStencilFaceFlags faceMask,
+                                                 VkStencilOp failOp,
+                                                 VkStencilOp passOp,
+                                                 VkStencilOp depthFailOp,
+                                                 VkCompareOp compareOp)
+{
+    ASSERT(valid());
+    ASSERT(vkCmdSetStencilOpEXT);
+    vkCmdSetStencilOpEXT(mHandle, faceMask, failOp, passOp, depthFailOp, compareOp);
+}
+
 ANGLE_INLINE void CommandBuffer::beginDebugUtilsLabelEXT(const VkDebugUtilsLabelEXT &labelInfo)
 {
     ASSERT(valid());
@@ -1340,7 +1465,7 @@ ANGLE_INLINE VkResult Semaphore::init(VkDevice device)
 
 ANGLE_INLINE VkResult Semaphore::init(VkDevice device, const VkSemaphoreCreateInfo &createInfo)
 {
-    ASSERT(valid());
+    ASSERT(!valid());
     return vkCreateSemaphore(device, &createInfo, nullptr, &mHandle);
 }
 
@@ -1351,6 +1476,27 @@ ANGLE_INLINE VkResult Semaphore::importFd(VkDevice device,
     return vkImportSemaphoreFdKHR(device, &importFdInfo);
 }
 
+ANGLE_INLINE VkResult Semaphore::getCounterValue(VkDevice device, uint64_t *valueOut) const
+{
+    ASSERT(valid());
+    ASSERT(vkGetSemaphoreCounterValueKHR);
+    return vkGetSemaphoreCounterValueKHR(device, mHandle, valueOut);
+}
+
+ANGLE_INLINE VkResult Semaphore::wait(VkDevice device, uint64_t value, uint64_t timeout) const
+{
+    ASSERT(valid());
+    ASSERT(vkWaitSemaphoresKHR);
+
+    VkSemaphoreWaitInfoKHR waitInfo = {};
+    waitInfo.sType                  = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+    waitInfo.semaphoreCount         = 1;
+    waitInfo.pSemaphores            = &mHandle;
+    waitInfo.pValues                = &value;
+
+    return vkWaitSemaphoresKHR(device, &waitInfo, timeout);
+}
+
 // Framebuffer implementation.
 ANGLE_INLINE void Framebuffer::destroy(VkDevice device)
 {
@@ -1429,11 +1575,12 @@ ANGLE_INLINE VkResult Allocator::init(VkPhysicalDevice physicalDevice,
                                       VkDevice device,
                                       VkInstance instance,
                                       uint32_t apiVersion,
-                                      VkDeviceSize preferredLargeHeapBlockSize)
+                                      VkDeviceSize preferredLargeHeapBlockSize,
+                                      bool useMemoryBudget)
 {
     ASSERT(!valid());
     return vma::InitAllocator(physicalDevice, device, instance, apiVersion,
-                              preferredLargeHeapBlockSize, &mHandle);
+                              preferredLargeHeapBlockSize, useMemoryBudget, &mHandle);
 }
 
 ANGLE_INLINE VkResult Allocator::createBuffer(const VkBufferCreateInfo &bufferCreateInfo,
@@ -1452,6 +1599,18 @@ ANGLE_INLINE VkResult Allocator::createBuffer(const VkBufferCreateInfo &bufferCr
                              &allocationOut->mHandle);
 }
 
+ANGLE_INLINE VkResult Allocator::allocateMemory(const VkMemoryRequirements &memoryRequirements,
+                                                VkMemoryPropertyFlags requiredFlags,
+                                                Allocation *allocationOut,
+                                                VkDeviceMemory *deviceMemoryOut,
+                                                VkDeviceSize *offsetOut) const
+{
+    ASSERT(valid());
+    ASSERT(allocationOut && !allocationOut->valid());
+    return vma::AllocateMemory(mHandle, &memoryRequirements, requiredFlags,
+                               &allocationOut->mHandle, deviceMemoryOut, offsetOut);
+}
+
 ANGLE_INLINE void Allocator::getMemoryTypeProperties(uint32_t memoryTypeIndex,
                                                      VkMemoryPropertyFlags *flagsOut) const
 {
@@ -1484,6 +1643,18 @@ ANGLE_INLINE void Allocator::freeStatsString(char *statsString)
     vma::FreeStatsString(mHandle, statsString);
 }
 
+ANGLE_INLINE void Allocator::setCurrentFrameIndex(uint32_t frameIndex) const
+{
+    ASSERT(valid());
+    vma::SetCurrentFrameIndex(mHandle, frameIndex);
+}
+
+ANGLE_INLINE void Allocator::getHeapBudgets(VkDeviceSize *budgetsOut, VkDeviceSize *usagesOut) const
+{
+    ASSERT(valid());
+    vma::GetHeapBudgets(mHandle, budgetsOut, usagesOut);
+}
+
 // Allocation implementation.
 ANGLE_INLINE void Allocation::destroy(const Allocator &allocator)
 {
@@ -1711,6 +1882,32 @@ ANGLE_INLINE VkResult DescriptorSetLayout::init(VkDevice device,
     return vkCreateDescriptorSetLayout(device, &createInfo, nullptr, &mHandle);
 }
 
+// DescriptorUpdateTemplate implementation.
+ANGLE_INLINE void DescriptorUpdateTemplate::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        vkDestroyDescriptorUpdateTemplateKHR(device, mHandle, nullptr);
+        mHandle = VK_NULL_HANDLE;
+    }
+}
+
+ANGLE_INLINE VkResult
+DescriptorUpdateTemplate::init(VkDevice device,
+                               const VkDescriptorUpdateTemplateCreateInfo &createInfo)
+{
+    ASSERT(!valid());
+    return vkCreateDescriptorUpdateTemplateKHR(device, &createInfo, nullptr, &mHandle);
+}
+
+ANGLE_INLINE void DescriptorUpdateTemplate::updateDescriptorSet(VkDevice device,
+                                                                VkDescriptorSet descriptorSet,
+                                                                const void *data) const
+{
+    ASSERT(valid());
+    vkUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, mHandle, data);
+}
+
 // DescriptorPool implementation.
 ANGLE_INLINE void DescriptorPool::destroy(VkDevice device)
 {
@@ -1746,6 +1943,12 @@ ANGLE_INLINE VkResult DescriptorPool::freeDescriptorSets(VkDevice device,
     return vkFreeDescriptorSets(device, mHandle, descriptorSetCount, descriptorSets);
 }
 
+ANGLE_INLINE VkResult DescriptorPool::reset(VkDevice device)
+{
+    ASSERT(valid());
+    return vkResetDescriptorPool(device, mHandle, 0);
+}
+
 // Sampler implementation.
 ANGLE_INLINE void Sampler::destroy(VkDevice device)
 {
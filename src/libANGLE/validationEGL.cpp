@@ -724,6 +724,23 @@ bool ValidateGetPlatformDisplayCommon(const ValidationContext *val,
                 case EGL_PLATFORM_ANGLE_D3D_LUID_LOW_ANGLE:
                     luidSpecified = true;
                     break;
+                case EGL_PLATFORM_ANGLE_DEVICE_ID_HIGH_ANGLE:
+                case EGL_PLATFORM_ANGLE_DEVICE_ID_LOW_ANGLE:
+                case EGL_PLATFORM_ANGLE_DEVICE_INDEX_ANGLE:
+                    if (!clientExtensions.platformANGLEDeviceId)
+                    {
+                        val->setError(EGL_BAD_ATTRIBUTE,
+                                      "EGL_ANGLE_platform_angle_device_id is not supported");
+                        return false;
+                    }
+                    if (value < 0 ||
+                        static_cast<uint64_t>(value) > std::numeric_limits<uint32_t>::max())
+                    {
+                        val->setError(EGL_BAD_ATTRIBUTE,
+                                      "Device ids and indices must be 32-bit unsigned values");
+                        return false;
+                    }
+                    break;
                 case EGL_PLATFORM_ANGLE_DEVICE_CONTEXT_VOLATILE_EAGL_ANGLE:
                     // The property does not have an effect if it's not active, so do not check
                     // for non-support.
@@ -5381,18 +5398,31 @@ bool ValidateQueryStringiANGLE(const ValidationContext *val,
         case EGL_FEATURE_BUG_ANGLE:
         case EGL_FEATURE_STATUS_ANGLE:
         case EGL_FEATURE_CONDITION_ANGLE:
+            if (static_cast<size_t>(index) >= display->getFeatures().size())
+            {
+                val->setError(EGL_BAD_PARAMETER, "index is too big.");
+                return false;
+            }
+            break;
+        case EGL_HISTOGRAMS_ANGLE:
+        case EGL_HISTOGRAMS_AND_RESET_ANGLE:
+            if (!Display::GetClientExtensions().histogramQueryANGLE)
+            {
+                val->setError(EGL_BAD_PARAMETER,
+                              "EGL_ANGLE_histogram_query extension is not available.");
+                return false;
+            }
+            if (index != 0)
+            {
+                val->setError(EGL_BAD_PARAMETER, "index must be 0.");
+                return false;
+            }
             break;
         default:
             val->setError(EGL_BAD_PARAMETER, "name is not valid.");
             return false;
     }
 
-    if (static_cast<size_t>(index) >= display->getFeatures().size())
-    {
-        val->setError(EGL_BAD_PARAMETER, "index is too big.");
-        return false;
-    }
-
     return true;
 }
 
@@ -596,6 +596,67 @@ ANGLE_INLINE const char *ValidateProgramDrawStates(const State &state,
 
     return nullptr;
 }
+
+// GL_EXT_sparse_texture queries accept any sized texture format and the texture targets of the
+// extension.
+bool ValidateGetSparseInternalFormativ(const Context *context,
+                                       GLenum target,
+                                       GLenum internalformat,
+                                       GLenum pname,
+                                       GLsizei bufSize,
+                                       GLsizei *numParams)
+{
+    if (!context->getExtensions().sparseTextureEXT)
+    {
+        context->validationError(GL_INVALID_ENUM, kEnumNotSupported);
+        return false;
+    }
+
+    const TextureType type = FromGLenum<TextureType>(target);
+    bool validTarget       = false;
+    switch (type)
+    {
+        case TextureType::_2D:
+        case TextureType::_2DArray:
+        case TextureType::_3D:
+        case TextureType::CubeMap:
+        case TextureType::CubeMapArray:
+            validTarget = ValidTextureTarget(context, type);
+            break;
+        default:
+            break;
+    }
+    if (!validTarget)
+    {
+        context->validationError(GL_INVALID_ENUM, kInvalidTarget);
+        return false;
+    }
+
+    const InternalFormat &formatInfo = GetSizedInternalFormatInfo(internalformat);
+    if (!formatInfo.sized ||
+        !formatInfo.textureSupport(context->getClientVersion(), context->getExtensions()))
+    {
+        context->validationError(GL_INVALID_ENUM, kInvalidFormat);
+        return false;
+    }
+
+    if (bufSize < 0)
+    {
+        context->validationError(GL_INVALID_VALUE, kInsufficientBufferSize);
+        return false;
+    }
+
+    if (numParams)
+    {
+        const GLuint pageSizeCount =
+            context->getTextureCaps().get(internalformat).getSparsePageSizeCount(type);
+        const GLsizei maxWriteParams =
+            pname == GL_NUM_VIRTUAL_PAGE_SIZES_EXT ? 1 : static_cast<GLsizei>(pageSizeCount);
+        *numParams = std::min(bufSize, maxWriteParams);
+    }
+
+    return true;
+}
 }  // anonymous namespace
 
 void SetRobustLengthParam(const GLsizei *length, GLsizei value)
@@ -5490,6 +5551,18 @@ bool ValidateGetProgramivBase(const Context *context,
                 return false;
             }
             break;
+        case GL_PREWARM_COMPLETION_STATUS_ANGLE:
+            if (!context->getExtensions().prewarmDrawStateANGLE)
+            {
+                context->validationError(GL_INVALID_ENUM, kEnumNotSupported);
+                return false;
+            }
+            if (!programObject->isLinked())
+            {
+                context->validationError(GL_INVALID_OPERATION, kProgramNotLinked);
+                return false;
+            }
+            break;
         case GL_TESS_CONTROL_OUTPUT_VERTICES_EXT:
         case GL_TESS_GEN_MODE_EXT:
         case GL_TESS_GEN_SPACING_EXT:
@@ -6513,6 +6586,16 @@ bool ValidateGetTexParameterBase(const Context *context,
             }
             break;
 
+        case GL_TEXTURE_SPARSE_EXT:
+        case GL_VIRTUAL_PAGE_SIZE_INDEX_EXT:
+        case GL_NUM_SPARSE_LEVELS_EXT:
+            if (!context->getExtensions().sparseTextureEXT)
+            {
+                context->validationError(GL_INVALID_ENUM, kEnumNotSupported);
+                return false;
+            }
+            break;
+
         default:
             context->validationError(GL_INVALID_ENUM, kEnumNotSupported);
             return false;
@@ -7218,6 +7301,25 @@ bool ValidateTexParameterBase(const Context *context,
 
             break;
 
+        case GL_TEXTURE_SPARSE_EXT:
+        case GL_VIRTUAL_PAGE_SIZE_INDEX_EXT:
+            if (!context->getExtensions().sparseTextureEXT)
+            {
+                context->validationError(GL_INVALID_ENUM, kEnumNotSupported);
+                return false;
+            }
+            if (context->getTextureByType(target)->getImmutableFormat())
+            {
+                context->validationError(GL_INVALID_OPERATION, kTextureIsImmutable);
+                return false;
+            }
+            if (pname == GL_VIRTUAL_PAGE_SIZE_INDEX_EXT && ConvertToGLint(params[0]) < 0)
+            {
+                context->validationError(GL_INVALID_VALUE, kNegativeParam);
+                return false;
+            }
+            break;
+
         default:
             context->validationError(GL_INVALID_ENUM, kEnumNotSupported);
             return false;
@@ -7536,6 +7638,18 @@ bool ValidateGetInternalFormativBase(const Context *context,
         return false;
     }
 
+    switch (pname)
+    {
+        case GL_NUM_VIRTUAL_PAGE_SIZES_EXT:
+        case GL_VIRTUAL_PAGE_SIZE_X_EXT:
+        case GL_VIRTUAL_PAGE_SIZE_Y_EXT:
+        case GL_VIRTUAL_PAGE_SIZE_Z_EXT:
+            return ValidateGetSparseInternalFormativ(context, target, internalformat, pname,
+                                                     bufSize, numParams);
+        default:
+            break;
+    }
+
     const TextureCaps &formatCaps = context->getTextureCaps().get(internalformat);
     if (!formatCaps.renderbuffer)
     {
@@ -7828,9 +7942,9 @@ bool ValidateSampleMaskiBase(const Context *context, GLuint maskNumber, GLbitfie
 void RecordDrawAttribsError(const Context *context)
 {
     // An overflow can happen when adding the offset. Check against a special constant.
-    if (context->getStateCache().getNonInstancedVertexElementLimit() ==
+    if (context->getStateCache().getNonInstancedVertexElementLimit(context) ==
             VertexAttribute::kIntegerOverflow ||
-        context->getStateCache().getInstancedVertexElementLimit() ==
+        context->getStateCache().getInstancedVertexElementLimit(context) ==
             VertexAttribute::kIntegerOverflow)
     {
         context->validationError(GL_INVALID_OPERATION, kIntegerOverflow);
@@ -360,6 +360,12 @@ const char *ValidateDrawElementsStates(const Context *context);
 
 ANGLE_INLINE bool ValidateDrawBase(const Context *context, PrimitiveMode mode)
 {
+    // Fast path: the draw states and this mode were validated and nothing they depend on changed.
+    if (ANGLE_LIKELY(context->getStateCache().isDrawModeValidated(mode)))
+    {
+        return true;
+    }
+
     intptr_t drawStatesError = context->getStateCache().getBasicDrawStatesError(context);
     if (drawStatesError)
     {
@@ -784,7 +790,7 @@ void RecordDrawAttribsError(const Context *context);
 
 ANGLE_INLINE bool ValidateDrawAttribs(const Context *context, int64_t maxVertex)
 {
-    if (maxVertex > context->getStateCache().getNonInstancedVertexElementLimit())
+    if (maxVertex > context->getStateCache().getNonInstancedVertexElementLimit(context))
     {
         RecordDrawAttribsError(context);
         return false;
@@ -823,7 +829,7 @@ ANGLE_INLINE bool ValidateDrawInstancedAttribs(const Context *context, GLint pri
         return true;
     }
 
-    if ((primcount - 1) > context->getStateCache().getInstancedVertexElementLimit())
+    if ((primcount - 1) > context->getStateCache().getInstancedVertexElementLimit(context))
     {
         RecordDrawAttribsError(context);
         return false;
@@ -880,6 +886,12 @@ ANGLE_INLINE bool ValidateDrawElementsBase(const Context *context,
                                            PrimitiveMode mode,
                                            DrawElementsType type)
 {
+    // Fast path: see ValidateDrawBase.
+    if (ANGLE_LIKELY(context->getStateCache().isDrawElementsTypeValidated(type)))
+    {
+        return true;
+    }
+
     if (!context->getStateCache().isValidDrawElementsType(type))
     {
         if (type == DrawElementsType::UnsignedInt)
@@ -3904,6 +3904,7 @@ bool ValidateGetString(const Context *context, GLenum name)
             break;
 
         case GL_SERIALIZED_CONTEXT_STRING_ANGLE:
+        case GL_SERIALIZED_CONTEXT_HASHES_STRING_ANGLE:
             if (!context->getExtensions().getSerializedContextStringANGLE)
             {
                 context->validationError(GL_INVALID_ENUM, kInvalidName);
@@ -5978,6 +5979,24 @@ bool ValidateMultiDrawElementsANGLE(const Context *context,
     return true;
 }
 
+bool ValidatePrewarmDrawStateANGLE(const Context *context, PrimitiveMode modePacked)
+{
+    if (!context->getExtensions().prewarmDrawStateANGLE)
+    {
+        context->validationError(GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    // The pipelines are tracked by the program, so one must be installed with glUseProgram.
+    if (context->getState().getProgram() == nullptr)
+    {
+        context->validationError(GL_INVALID_OPERATION, kProgramNotBound);
+        return false;
+    }
+
+    return ValidateDrawBase(context, modePacked);
+}
+
 bool ValidateProvokingVertexANGLE(const Context *context, ProvokingVertexConvention modePacked)
 {
     if (!context->getExtensions().provokingVertex)
@@ -1354,6 +1354,30 @@ bool ValidateES3TexStorageParametersBase(const Context *context,
         }
     }
 
+    if (texture->isSparse())
+    {
+        const TextureCaps &formatCaps = context->getTextureCaps().get(internalformat);
+        if (texture->getVirtualPageSizeIndex() >= formatCaps.getSparsePageSizeCount(target))
+        {
+            context->validationError(GL_INVALID_OPERATION, kSparseTextureNoPageSize);
+            return false;
+        }
+
+        if (width > caps.maxSparseTextureSize || height > caps.maxSparseTextureSize ||
+            (target == TextureType::_2DArray && depth > caps.maxSparseArrayTextureLayers))
+        {
+            context->validationError(GL_INVALID_VALUE, kResourceMaxTextureSize);
+            return false;
+        }
+
+        const Extents &pageSize = formatCaps.sparsePageSize;
+        if (width % pageSize.width != 0 || height % pageSize.height != 0)
+        {
+            context->validationError(GL_INVALID_VALUE, kSparseTextureSizeNotPageAligned);
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -1254,6 +1254,79 @@ bool ValidateFramebufferFetchBarrierEXT(const Context *context)
     return true;
 }
 
+bool ValidateTexPageCommitmentEXT(const Context *context,
+                                  TextureType targetPacked,
+                                  GLint level,
+                                  GLint xoffset,
+                                  GLint yoffset,
+                                  GLint zoffset,
+                                  GLsizei width,
+                                  GLsizei height,
+                                  GLsizei depth,
+                                  GLboolean commit)
+{
+    if (!context->getExtensions().sparseTextureEXT)
+    {
+        context->validationError(GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    if (!ValidTextureTarget(context, targetPacked) || targetPacked == TextureType::Buffer)
+    {
+        context->validationError(GL_INVALID_ENUM, kInvalidTextureTarget);
+        return false;
+    }
+
+    const Texture *texture = context->getTextureByType(targetPacked);
+    if (texture == nullptr || !texture->getImmutableFormat() || !texture->isSparse())
+    {
+        context->validationError(GL_INVALID_OPERATION, kTextureIsNotSparse);
+        return false;
+    }
+
+    if (level < 0 || static_cast<GLuint>(level) >= texture->getImmutableLevels())
+    {
+        context->validationError(GL_INVALID_VALUE, kInvalidMipLevel);
+        return false;
+    }
+
+    if (xoffset < 0 || yoffset < 0 || zoffset < 0)
+    {
+        context->validationError(GL_INVALID_VALUE, kNegativeOffset);
+        return false;
+    }
+
+    if (width < 0 || height < 0 || depth < 0)
+    {
+        context->validationError(GL_INVALID_VALUE, kNegativeSize);
+        return false;
+    }
+
+    // Sparse textures are only ever 2D or 2D arrays, whose layers are the depth of the region.
+    const TextureTarget target = NonCubeTextureTypeToTarget(targetPacked);
+    const Extents &levelSize   = texture->getExtents(target, level);
+    if (width > levelSize.width - xoffset || height > levelSize.height - yoffset ||
+        depth > levelSize.depth - zoffset)
+    {
+        context->validationError(GL_INVALID_VALUE, kOffsetOverflow);
+        return false;
+    }
+
+    // Regions must be made of whole pages, except where they reach the edge of the level.  Pages
+    // are one layer deep.
+    const GLenum internalFormat = texture->getFormat(target, level).info->sizedInternalFormat;
+    const Extents &pageSize     = context->getTextureCaps().get(internalFormat).sparsePageSize;
+    if (xoffset % pageSize.width != 0 || yoffset % pageSize.height != 0 ||
+        (width % pageSize.width != 0 && xoffset + width != levelSize.width) ||
+        (height % pageSize.height != 0 && yoffset + height != levelSize.height))
+    {
+        context->validationError(GL_INVALID_VALUE, kSparseTextureNotPageAligned);
+        return false;
+    }
+
+    return true;
+}
+
 bool ValidatePatchParameteriEXT(const Context *context, GLenum pname, GLint value)
 {
     if (!context->getExtensions().tessellationShaderEXT)
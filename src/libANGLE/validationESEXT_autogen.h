@@ -219,6 +219,9 @@ bool ValidateMultiDrawElementsInstancedANGLE(const Context *context,
                                              const GLsizei *instanceCounts,
                                              GLsizei drawcount);
 
+// GL_ANGLE_prewarm_draw_state
+bool ValidatePrewarmDrawStateANGLE(const Context *context, PrimitiveMode modePacked);
+
 // GL_ANGLE_program_binary
 
 // GL_ANGLE_provoking_vertex
@@ -1335,6 +1338,18 @@ bool ValidateFramebufferFetchBarrierEXT(const Context *context);
 
 // GL_EXT_shader_io_blocks
 
+// GL_EXT_sparse_texture
+bool ValidateTexPageCommitmentEXT(const Context *context,
+                                  TextureType targetPacked,
+                                  GLint level,
+                                  GLint xoffset,
+                                  GLint yoffset,
+                                  GLint zoffset,
+                                  GLsizei width,
+                                  GLsizei height,
+                                  GLsizei depth,
+                                  GLboolean commit);
+
 // GL_EXT_tessellation_shader
 bool ValidatePatchParameteriEXT(const Context *context, GLenum pname, GLint value);
 
@@ -40,6 +40,7 @@ void GL_APIENTRY GL_Accum(GLenum op, GLfloat value)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateAccum(context, op, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->accum(op, value);
@@ -64,6 +65,7 @@ void GL_APIENTRY GL_AlphaFunc(GLenum func, GLfloat ref)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateAlphaFunc(context, funcPacked, ref));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->alphaFunc(funcPacked, ref);
@@ -86,6 +88,7 @@ void GL_APIENTRY GL_Begin(GLenum mode)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBegin(context, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->begin(mode);
@@ -118,6 +121,7 @@ void GL_APIENTRY GL_Bitmap(GLsizei width,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBitmap(context, width, height, xorig, yorig, xmove, ymove, bitmap));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
@@ -143,6 +147,7 @@ void GL_APIENTRY GL_BlendFunc(GLenum sfactor, GLenum dfactor)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunc(context, sfactor, dfactor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFunc(sfactor, dfactor);
@@ -164,6 +169,7 @@ void GL_APIENTRY GL_CallList(GLuint list)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCallList(context, list));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->callList(list);
@@ -187,6 +193,7 @@ void GL_APIENTRY GL_CallLists(GLsizei n, GLenum type, const void *lists)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCallLists(context, n, type, lists));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->callLists(n, type, lists);
@@ -209,6 +216,7 @@ void GL_APIENTRY GL_Clear(GLbitfield mask)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClear(context, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clear(mask);
@@ -232,6 +240,7 @@ void GL_APIENTRY GL_ClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearAccum(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearAccum(red, green, blue, alpha);
@@ -255,6 +264,7 @@ void GL_APIENTRY GL_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearColor(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearColor(red, green, blue, alpha);
@@ -276,6 +286,7 @@ void GL_APIENTRY GL_ClearDepth(GLdouble depth)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepth(context, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearDepth(depth);
@@ -297,6 +308,7 @@ void GL_APIENTRY GL_ClearIndex(GLfloat c)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearIndex(context, c));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearIndex(c);
@@ -318,6 +330,7 @@ void GL_APIENTRY GL_ClearStencil(GLint s)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearStencil(context, s));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearStencil(s);
@@ -341,6 +354,7 @@ void GL_APIENTRY GL_ClipPlane(GLenum plane, const GLdouble *equation)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClipPlane(context, plane, equation));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clipPlane(plane, equation);
@@ -364,6 +378,7 @@ void GL_APIENTRY GL_Color3b(GLbyte red, GLbyte green, GLbyte blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3b(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3b(red, green, blue);
@@ -385,6 +400,7 @@ void GL_APIENTRY GL_Color3bv(const GLbyte *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor3bv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3bv(v);
@@ -408,6 +424,7 @@ void GL_APIENTRY GL_Color3d(GLdouble red, GLdouble green, GLdouble blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3d(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3d(red, green, blue);
@@ -429,6 +446,7 @@ void GL_APIENTRY GL_Color3dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor3dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3dv(v);
@@ -452,6 +470,7 @@ void GL_APIENTRY GL_Color3f(GLfloat red, GLfloat green, GLfloat blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3f(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3f(red, green, blue);
@@ -473,6 +492,7 @@ void GL_APIENTRY GL_Color3fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor3fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3fv(v);
@@ -496,6 +516,7 @@ void GL_APIENTRY GL_Color3i(GLint red, GLint green, GLint blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3i(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3i(red, green, blue);
@@ -517,6 +538,7 @@ void GL_APIENTRY GL_Color3iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor3iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3iv(v);
@@ -540,6 +562,7 @@ void GL_APIENTRY GL_Color3s(GLshort red, GLshort green, GLshort blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3s(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3s(red, green, blue);
@@ -561,6 +584,7 @@ void GL_APIENTRY GL_Color3sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor3sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3sv(v);
@@ -584,6 +608,7 @@ void GL_APIENTRY GL_Color3ub(GLubyte red, GLubyte green, GLubyte blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3ub(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3ub(red, green, blue);
@@ -605,6 +630,7 @@ void GL_APIENTRY GL_Color3ubv(const GLubyte *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor3ubv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3ubv(v);
@@ -628,6 +654,7 @@ void GL_APIENTRY GL_Color3ui(GLuint red, GLuint green, GLuint blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3ui(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3ui(red, green, blue);
@@ -649,6 +676,7 @@ void GL_APIENTRY GL_Color3uiv(const GLuint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor3uiv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3uiv(v);
@@ -672,6 +700,7 @@ void GL_APIENTRY GL_Color3us(GLushort red, GLushort green, GLushort blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3us(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3us(red, green, blue);
@@ -693,6 +722,7 @@ void GL_APIENTRY GL_Color3usv(const GLushort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor3usv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color3usv(v);
@@ -716,6 +746,7 @@ void GL_APIENTRY GL_Color4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4b(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4b(red, green, blue, alpha);
@@ -737,6 +768,7 @@ void GL_APIENTRY GL_Color4bv(const GLbyte *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor4bv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4bv(v);
@@ -760,6 +792,7 @@ void GL_APIENTRY GL_Color4d(GLdouble red, GLdouble green, GLdouble blue, GLdoubl
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4d(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4d(red, green, blue, alpha);
@@ -781,6 +814,7 @@ void GL_APIENTRY GL_Color4dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor4dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4dv(v);
@@ -804,6 +838,7 @@ void GL_APIENTRY GL_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4f(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4f(red, green, blue, alpha);
@@ -825,6 +860,7 @@ void GL_APIENTRY GL_Color4fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor4fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4fv(v);
@@ -848,6 +884,7 @@ void GL_APIENTRY GL_Color4i(GLint red, GLint green, GLint blue, GLint alpha)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4i(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4i(red, green, blue, alpha);
@@ -869,6 +906,7 @@ void GL_APIENTRY GL_Color4iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor4iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4iv(v);
@@ -892,6 +930,7 @@ void GL_APIENTRY GL_Color4s(GLshort red, GLshort green, GLshort blue, GLshort al
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4s(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4s(red, green, blue, alpha);
@@ -913,6 +952,7 @@ void GL_APIENTRY GL_Color4sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor4sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4sv(v);
@@ -936,6 +976,7 @@ void GL_APIENTRY GL_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte a
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4ub(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4ub(red, green, blue, alpha);
@@ -957,6 +998,7 @@ void GL_APIENTRY GL_Color4ubv(const GLubyte *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor4ubv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4ubv(v);
@@ -980,6 +1022,7 @@ void GL_APIENTRY GL_Color4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4ui(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4ui(red, green, blue, alpha);
@@ -1001,6 +1044,7 @@ void GL_APIENTRY GL_Color4uiv(const GLuint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor4uiv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4uiv(v);
@@ -1024,6 +1068,7 @@ void GL_APIENTRY GL_Color4us(GLushort red, GLushort green, GLushort blue, GLusho
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4us(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4us(red, green, blue, alpha);
@@ -1045,6 +1090,7 @@ void GL_APIENTRY GL_Color4usv(const GLushort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColor4usv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4usv(v);
@@ -1069,6 +1115,7 @@ void GL_APIENTRY GL_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMask(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorMask(red, green, blue, alpha);
@@ -1093,6 +1140,7 @@ void GL_APIENTRY GL_ColorMaterial(GLenum face, GLenum mode)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaterial(context, face, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorMaterial(face, mode);
@@ -1116,6 +1164,7 @@ void GL_APIENTRY GL_CopyPixels(GLint x, GLint y, GLsizei width, GLsizei height,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCopyPixels(context, x, y, width, height, type));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyPixels(x, y, width, height, type);
@@ -1139,6 +1188,7 @@ void GL_APIENTRY GL_CullFace(GLenum mode)
         CullFaceMode modePacked                               = PackParam<CullFaceMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCullFace(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->cullFace(modePacked);
@@ -1160,6 +1210,7 @@ void GL_APIENTRY GL_DeleteLists(GLuint list, GLsizei range)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDeleteLists(context, list, range));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteLists(list, range);
@@ -1182,6 +1233,7 @@ void GL_APIENTRY GL_DepthFunc(GLenum func)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthFunc(context, func));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthFunc(func);
@@ -1203,6 +1255,7 @@ void GL_APIENTRY GL_DepthMask(GLboolean flag)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthMask(context, flag));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthMask(flag);
@@ -1224,6 +1277,7 @@ void GL_APIENTRY GL_DepthRange(GLdouble n, GLdouble f)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRange(context, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthRange(n, f);
@@ -1246,6 +1300,7 @@ void GL_APIENTRY GL_Disable(GLenum cap)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisable(context, cap));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disable(cap);
@@ -1268,6 +1323,7 @@ void GL_APIENTRY GL_DrawBuffer(GLenum buf)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawBuffer(context, buf));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawBuffer(buf);
@@ -1295,6 +1351,7 @@ GL_DrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const v
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawPixels(context, width, height, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawPixels(width, height, format, type, pixels);
@@ -1316,6 +1373,7 @@ void GL_APIENTRY GL_EdgeFlag(GLboolean flag)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEdgeFlag(context, flag));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->edgeFlag(flag);
@@ -1338,6 +1396,7 @@ void GL_APIENTRY GL_EdgeFlagv(const GLboolean *flag)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEdgeFlagv(context, flag));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->edgeFlagv(flag);
@@ -1360,6 +1419,7 @@ void GL_APIENTRY GL_Enable(GLenum cap)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnable(context, cap));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enable(cap);
@@ -1381,6 +1441,7 @@ void GL_APIENTRY GL_End()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnd(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->end();
@@ -1402,6 +1463,7 @@ void GL_APIENTRY GL_EndList()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndList(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->endList();
@@ -1423,6 +1485,7 @@ void GL_APIENTRY GL_EvalCoord1d(GLdouble u)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord1d(context, u));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalCoord1d(u);
@@ -1445,6 +1508,7 @@ void GL_APIENTRY GL_EvalCoord1dv(const GLdouble *u)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord1dv(context, u));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalCoord1dv(u);
@@ -1466,6 +1530,7 @@ void GL_APIENTRY GL_EvalCoord1f(GLfloat u)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord1f(context, u));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalCoord1f(u);
@@ -1488,6 +1553,7 @@ void GL_APIENTRY GL_EvalCoord1fv(const GLfloat *u)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord1fv(context, u));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalCoord1fv(u);
@@ -1509,6 +1575,7 @@ void GL_APIENTRY GL_EvalCoord2d(GLdouble u, GLdouble v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord2d(context, u, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalCoord2d(u, v);
@@ -1531,6 +1598,7 @@ void GL_APIENTRY GL_EvalCoord2dv(const GLdouble *u)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord2dv(context, u));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalCoord2dv(u);
@@ -1552,6 +1620,7 @@ void GL_APIENTRY GL_EvalCoord2f(GLfloat u, GLfloat v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord2f(context, u, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalCoord2f(u, v);
@@ -1574,6 +1643,7 @@ void GL_APIENTRY GL_EvalCoord2fv(const GLfloat *u)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord2fv(context, u));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalCoord2fv(u);
@@ -1596,6 +1666,7 @@ void GL_APIENTRY GL_EvalMesh1(GLenum mode, GLint i1, GLint i2)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalMesh1(context, mode, i1, i2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalMesh1(mode, i1, i2);
@@ -1619,6 +1690,7 @@ void GL_APIENTRY GL_EvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEvalMesh2(context, mode, i1, i2, j1, j2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalMesh2(mode, i1, i2, j1, j2);
@@ -1640,6 +1712,7 @@ void GL_APIENTRY GL_EvalPoint1(GLint i)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalPoint1(context, i));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalPoint1(i);
@@ -1661,6 +1734,7 @@ void GL_APIENTRY GL_EvalPoint2(GLint i, GLint j)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalPoint2(context, i, j));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->evalPoint2(i, j);
@@ -1685,6 +1759,7 @@ void GL_APIENTRY GL_FeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFeedbackBuffer(context, size, type, buffer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->feedbackBuffer(size, type, buffer);
@@ -1706,6 +1781,7 @@ void GL_APIENTRY GL_Finish()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFinish(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->finish();
@@ -1727,6 +1803,7 @@ void GL_APIENTRY GL_Flush()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFlush(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->flush();
@@ -1749,6 +1826,7 @@ void GL_APIENTRY GL_Fogf(GLenum pname, GLfloat param)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogf(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogf(pname, param);
@@ -1771,6 +1849,7 @@ void GL_APIENTRY GL_Fogfv(GLenum pname, const GLfloat *params)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogfv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogfv(pname, params);
@@ -1793,6 +1872,7 @@ void GL_APIENTRY GL_Fogi(GLenum pname, GLint param)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogi(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogi(pname, param);
@@ -1815,6 +1895,7 @@ void GL_APIENTRY GL_Fogiv(GLenum pname, const GLint *params)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogiv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogiv(pname, params);
@@ -1837,6 +1918,7 @@ void GL_APIENTRY GL_FrontFace(GLenum mode)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFrontFace(context, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->frontFace(mode);
@@ -1866,6 +1948,7 @@ void GL_APIENTRY GL_Frustum(GLdouble left,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFrustum(context, left, right, bottom, top, zNear, zFar));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->frustum(left, right, bottom, top, zNear, zFar);
@@ -1888,6 +1971,7 @@ GLuint GL_APIENTRY GL_GenLists(GLsizei range)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGenLists(context, range));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->genLists(range);
@@ -1916,6 +2000,7 @@ void GL_APIENTRY GL_GetBooleanv(GLenum pname, GLboolean *data)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetBooleanv(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBooleanv(pname, data);
@@ -1939,6 +2024,7 @@ void GL_APIENTRY GL_GetClipPlane(GLenum plane, GLdouble *equation)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetClipPlane(context, plane, equation));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getClipPlane(plane, equation);
@@ -1961,6 +2047,7 @@ void GL_APIENTRY GL_GetDoublev(GLenum pname, GLdouble *data)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetDoublev(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getDoublev(pname, data);
@@ -1983,6 +2070,7 @@ GLenum GL_APIENTRY GL_GetError()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetError(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getError();
@@ -2011,6 +2099,7 @@ void GL_APIENTRY GL_GetFloatv(GLenum pname, GLfloat *data)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetFloatv(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFloatv(pname, data);
@@ -2033,6 +2122,7 @@ void GL_APIENTRY GL_GetIntegerv(GLenum pname, GLint *data)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetIntegerv(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getIntegerv(pname, data);
@@ -2058,6 +2148,7 @@ void GL_APIENTRY GL_GetLightfv(GLenum light, GLenum pname, GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetLightfv(context, light, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getLightfv(light, pnamePacked, params);
@@ -2082,6 +2173,7 @@ void GL_APIENTRY GL_GetLightiv(GLenum light, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetLightiv(context, light, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getLightiv(light, pname, params);
@@ -2106,6 +2198,7 @@ void GL_APIENTRY GL_GetMapdv(GLenum target, GLenum query, GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetMapdv(context, target, query, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMapdv(target, query, v);
@@ -2130,6 +2223,7 @@ void GL_APIENTRY GL_GetMapfv(GLenum target, GLenum query, GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetMapfv(context, target, query, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMapfv(target, query, v);
@@ -2154,6 +2248,7 @@ void GL_APIENTRY GL_GetMapiv(GLenum target, GLenum query, GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetMapiv(context, target, query, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMapiv(target, query, v);
@@ -2180,6 +2275,7 @@ void GL_APIENTRY GL_GetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetMaterialfv(context, face, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMaterialfv(face, pnamePacked, params);
@@ -2205,6 +2301,7 @@ void GL_APIENTRY GL_GetMaterialiv(GLenum face, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetMaterialiv(context, face, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMaterialiv(face, pname, params);
@@ -2228,6 +2325,7 @@ void GL_APIENTRY GL_GetPixelMapfv(GLenum map, GLfloat *values)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetPixelMapfv(context, map, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getPixelMapfv(map, values);
@@ -2251,6 +2349,7 @@ void GL_APIENTRY GL_GetPixelMapuiv(GLenum map, GLuint *values)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetPixelMapuiv(context, map, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getPixelMapuiv(map, values);
@@ -2274,6 +2373,7 @@ void GL_APIENTRY GL_GetPixelMapusv(GLenum map, GLushort *values)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetPixelMapusv(context, map, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getPixelMapusv(map, values);
@@ -2296,6 +2396,7 @@ void GL_APIENTRY GL_GetPolygonStipple(GLubyte *mask)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetPolygonStipple(context, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getPolygonStipple(mask);
@@ -2319,6 +2420,7 @@ const GLubyte *GL_APIENTRY GL_GetString(GLenum name)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetString(context, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getString(name);
@@ -2352,6 +2454,7 @@ void GL_APIENTRY GL_GetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexEnvfv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexEnvfv(targetPacked, pnamePacked, params);
@@ -2379,6 +2482,7 @@ void GL_APIENTRY GL_GetTexEnviv(GLenum target, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexEnviv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexEnviv(targetPacked, pnamePacked, params);
@@ -2404,6 +2508,7 @@ void GL_APIENTRY GL_GetTexGendv(GLenum coord, GLenum pname, GLdouble *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetTexGendv(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexGendv(coord, pname, params);
@@ -2429,6 +2534,7 @@ void GL_APIENTRY GL_GetTexGenfv(GLenum coord, GLenum pname, GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetTexGenfv(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexGenfv(coord, pname, params);
@@ -2454,6 +2560,7 @@ void GL_APIENTRY GL_GetTexGeniv(GLenum coord, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetTexGeniv(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexGeniv(coord, pname, params);
@@ -2484,6 +2591,7 @@ GL_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pix
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexImage(context, targetPacked, level, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexImage(targetPacked, level, format, type, pixels);
@@ -2514,6 +2622,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfv(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexLevelParameterfv(context, targetPacked, level, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameterfv(targetPacked, level, pname, params);
@@ -2542,6 +2651,7 @@ void GL_APIENTRY GL_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pn
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexLevelParameteriv(context, targetPacked, level, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameteriv(targetPacked, level, pname, params);
@@ -2569,6 +2679,7 @@ void GL_APIENTRY GL_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *para
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterfv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterfv(targetPacked, pname, params);
@@ -2595,6 +2706,7 @@ void GL_APIENTRY GL_GetTexParameteriv(GLenum target, GLenum pname, GLint *params
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameteriv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameteriv(targetPacked, pname, params);
@@ -2618,6 +2730,7 @@ void GL_APIENTRY GL_Hint(GLenum target, GLenum mode)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateHint(context, target, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->hint(target, mode);
@@ -2639,6 +2752,7 @@ void GL_APIENTRY GL_IndexMask(GLuint mask)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexMask(context, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexMask(mask);
@@ -2660,6 +2774,7 @@ void GL_APIENTRY GL_Indexd(GLdouble c)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexd(context, c));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexd(c);
@@ -2681,6 +2796,7 @@ void GL_APIENTRY GL_Indexdv(const GLdouble *c)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexdv(context, c));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexdv(c);
@@ -2702,6 +2818,7 @@ void GL_APIENTRY GL_Indexf(GLfloat c)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexf(context, c));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexf(c);
@@ -2723,6 +2840,7 @@ void GL_APIENTRY GL_Indexfv(const GLfloat *c)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexfv(context, c));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexfv(c);
@@ -2744,6 +2862,7 @@ void GL_APIENTRY GL_Indexi(GLint c)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexi(context, c));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexi(c);
@@ -2765,6 +2884,7 @@ void GL_APIENTRY GL_Indexiv(const GLint *c)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexiv(context, c));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexiv(c);
@@ -2786,6 +2906,7 @@ void GL_APIENTRY GL_Indexs(GLshort c)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexs(context, c));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexs(c);
@@ -2807,6 +2928,7 @@ void GL_APIENTRY GL_Indexsv(const GLshort *c)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexsv(context, c));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexsv(c);
@@ -2828,6 +2950,7 @@ void GL_APIENTRY GL_InitNames()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateInitNames(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->initNames();
@@ -2851,6 +2974,7 @@ GLboolean GL_APIENTRY GL_IsEnabled(GLenum cap)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsEnabled(context, cap));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isEnabled(cap);
@@ -2879,6 +3003,7 @@ GLboolean GL_APIENTRY GL_IsList(GLuint list)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsList(context, list));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isList(list);
@@ -2908,6 +3033,7 @@ void GL_APIENTRY GL_LightModelf(GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelf(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModelf(pname, param);
@@ -2931,6 +3057,7 @@ void GL_APIENTRY GL_LightModelfv(GLenum pname, const GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelfv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModelfv(pname, params);
@@ -2954,6 +3081,7 @@ void GL_APIENTRY GL_LightModeli(GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModeli(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModeli(pname, param);
@@ -2977,6 +3105,7 @@ void GL_APIENTRY GL_LightModeliv(GLenum pname, const GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModeliv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModeliv(pname, params);
@@ -3002,6 +3131,7 @@ void GL_APIENTRY GL_Lightf(GLenum light, GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightf(context, light, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightf(light, pnamePacked, param);
@@ -3027,6 +3157,7 @@ void GL_APIENTRY GL_Lightfv(GLenum light, GLenum pname, const GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightfv(context, light, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightfv(light, pnamePacked, params);
@@ -3051,6 +3182,7 @@ void GL_APIENTRY GL_Lighti(GLenum light, GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLighti(context, light, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lighti(light, pname, param);
@@ -3075,6 +3207,7 @@ void GL_APIENTRY GL_Lightiv(GLenum light, GLenum pname, const GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightiv(context, light, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightiv(light, pname, params);
@@ -3098,6 +3231,7 @@ void GL_APIENTRY GL_LineStipple(GLint factor, GLushort pattern)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLineStipple(context, factor, pattern));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lineStipple(factor, pattern);
@@ -3119,6 +3253,7 @@ void GL_APIENTRY GL_LineWidth(GLfloat width)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLineWidth(context, width));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lineWidth(width);
@@ -3140,6 +3275,7 @@ void GL_APIENTRY GL_ListBase(GLuint base)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateListBase(context, base));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->listBase(base);
@@ -3161,6 +3297,7 @@ void GL_APIENTRY GL_LoadIdentity()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadIdentity(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadIdentity();
@@ -3183,6 +3320,7 @@ void GL_APIENTRY GL_LoadMatrixd(const GLdouble *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadMatrixd(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadMatrixd(m);
@@ -3205,6 +3343,7 @@ void GL_APIENTRY GL_LoadMatrixf(const GLfloat *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadMatrixf(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadMatrixf(m);
@@ -3226,6 +3365,7 @@ void GL_APIENTRY GL_LoadName(GLuint name)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadName(context, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadName(name);
@@ -3249,6 +3389,7 @@ void GL_APIENTRY GL_LogicOp(GLenum opcode)
         LogicalOperation opcodePacked                         = PackParam<LogicalOperation>(opcode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLogicOp(context, opcodePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->logicOp(opcodePacked);
@@ -3276,6 +3417,7 @@ GL_Map1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, con
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMap1d(context, target, u1, u2, stride, order, points));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->map1d(target, u1, u2, stride, order, points);
@@ -3303,6 +3445,7 @@ GL_Map1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMap1f(context, target, u1, u2, stride, order, points));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->map1f(target, u1, u2, stride, order, points);
@@ -3339,6 +3482,7 @@ void GL_APIENTRY GL_Map2d(GLenum target,
         bool isCallValid =
             (context->skipValidation() || ValidateMap2d(context, target, u1, u2, ustride, uorder,
                                                         v1, v2, vstride, vorder, points));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->map2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
@@ -3376,6 +3520,7 @@ void GL_APIENTRY GL_Map2f(GLenum target,
         bool isCallValid =
             (context->skipValidation() || ValidateMap2f(context, target, u1, u2, ustride, uorder,
                                                         v1, v2, vstride, vorder, points));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->map2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
@@ -3399,6 +3544,7 @@ void GL_APIENTRY GL_MapGrid1d(GLint un, GLdouble u1, GLdouble u2)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMapGrid1d(context, un, u1, u2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->mapGrid1d(un, u1, u2);
@@ -3421,6 +3567,7 @@ void GL_APIENTRY GL_MapGrid1f(GLint un, GLfloat u1, GLfloat u2)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMapGrid1f(context, un, u1, u2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->mapGrid1f(un, u1, u2);
@@ -3446,6 +3593,7 @@ GL_MapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMapGrid2d(context, un, u1, u2, vn, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->mapGrid2d(un, u1, u2, vn, v1, v2);
@@ -3470,6 +3618,7 @@ void GL_APIENTRY GL_MapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloa
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMapGrid2f(context, un, u1, u2, vn, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->mapGrid2f(un, u1, u2, vn, v1, v2);
@@ -3495,6 +3644,7 @@ void GL_APIENTRY GL_Materialf(GLenum face, GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaterialf(context, face, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materialf(face, pnamePacked, param);
@@ -3520,6 +3670,7 @@ void GL_APIENTRY GL_Materialfv(GLenum face, GLenum pname, const GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaterialfv(context, face, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materialfv(face, pnamePacked, params);
@@ -3544,6 +3695,7 @@ void GL_APIENTRY GL_Materiali(GLenum face, GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMateriali(context, face, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materiali(face, pname, param);
@@ -3568,6 +3720,7 @@ void GL_APIENTRY GL_Materialiv(GLenum face, GLenum pname, const GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaterialiv(context, face, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materialiv(face, pname, params);
@@ -3591,6 +3744,7 @@ void GL_APIENTRY GL_MatrixMode(GLenum mode)
         MatrixType modePacked                                 = PackParam<MatrixType>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMatrixMode(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->matrixMode(modePacked);
@@ -3613,6 +3767,7 @@ void GL_APIENTRY GL_MultMatrixd(const GLdouble *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMultMatrixd(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multMatrixd(m);
@@ -3635,6 +3790,7 @@ void GL_APIENTRY GL_MultMatrixf(const GLfloat *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMultMatrixf(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multMatrixf(m);
@@ -3657,6 +3813,7 @@ void GL_APIENTRY GL_NewList(GLuint list, GLenum mode)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNewList(context, list, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->newList(list, mode);
@@ -3678,6 +3835,7 @@ void GL_APIENTRY GL_Normal3b(GLbyte nx, GLbyte ny, GLbyte nz)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3b(context, nx, ny, nz));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3b(nx, ny, nz);
@@ -3699,6 +3857,7 @@ void GL_APIENTRY GL_Normal3bv(const GLbyte *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3bv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3bv(v);
@@ -3720,6 +3879,7 @@ void GL_APIENTRY GL_Normal3d(GLdouble nx, GLdouble ny, GLdouble nz)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3d(context, nx, ny, nz));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3d(nx, ny, nz);
@@ -3741,6 +3901,7 @@ void GL_APIENTRY GL_Normal3dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3dv(v);
@@ -3762,6 +3923,7 @@ void GL_APIENTRY GL_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3f(context, nx, ny, nz));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3f(nx, ny, nz);
@@ -3783,6 +3945,7 @@ void GL_APIENTRY GL_Normal3fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3fv(v);
@@ -3804,6 +3967,7 @@ void GL_APIENTRY GL_Normal3i(GLint nx, GLint ny, GLint nz)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3i(context, nx, ny, nz));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3i(nx, ny, nz);
@@ -3825,6 +3989,7 @@ void GL_APIENTRY GL_Normal3iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3iv(v);
@@ -3846,6 +4011,7 @@ void GL_APIENTRY GL_Normal3s(GLshort nx, GLshort ny, GLshort nz)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3s(context, nx, ny, nz));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3s(nx, ny, nz);
@@ -3867,6 +4033,7 @@ void GL_APIENTRY GL_Normal3sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3sv(v);
@@ -3896,6 +4063,7 @@ void GL_APIENTRY GL_Ortho(GLdouble left,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateOrtho(context, left, right, bottom, top, zNear, zFar));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->ortho(left, right, bottom, top, zNear, zFar);
@@ -3917,6 +4085,7 @@ void GL_APIENTRY GL_PassThrough(GLfloat token)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePassThrough(context, token));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->passThrough(token);
@@ -3940,6 +4109,7 @@ void GL_APIENTRY GL_PixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelMapfv(context, map, mapsize, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pixelMapfv(map, mapsize, values);
@@ -3964,6 +4134,7 @@ void GL_APIENTRY GL_PixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelMapuiv(context, map, mapsize, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pixelMapuiv(map, mapsize, values);
@@ -3988,6 +4159,7 @@ void GL_APIENTRY GL_PixelMapusv(GLenum map, GLsizei mapsize, const GLushort *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelMapusv(context, map, mapsize, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pixelMapusv(map, mapsize, values);
@@ -4011,6 +4183,7 @@ void GL_APIENTRY GL_PixelStoref(GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelStoref(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pixelStoref(pname, param);
@@ -4034,6 +4207,7 @@ void GL_APIENTRY GL_PixelStorei(GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelStorei(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pixelStorei(pname, param);
@@ -4057,6 +4231,7 @@ void GL_APIENTRY GL_PixelTransferf(GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelTransferf(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pixelTransferf(pname, param);
@@ -4080,6 +4255,7 @@ void GL_APIENTRY GL_PixelTransferi(GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelTransferi(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pixelTransferi(pname, param);
@@ -4103,6 +4279,7 @@ void GL_APIENTRY GL_PixelZoom(GLfloat xfactor, GLfloat yfactor)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelZoom(context, xfactor, yfactor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pixelZoom(xfactor, yfactor);
@@ -4124,6 +4301,7 @@ void GL_APIENTRY GL_PointSize(GLfloat size)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePointSize(context, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointSize(size);
@@ -4147,6 +4325,7 @@ void GL_APIENTRY GL_PolygonMode(GLenum face, GLenum mode)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePolygonMode(context, face, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->polygonMode(face, mode);
@@ -4169,6 +4348,7 @@ void GL_APIENTRY GL_PolygonStipple(const GLubyte *mask)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePolygonStipple(context, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->polygonStipple(mask);
@@ -4190,6 +4370,7 @@ void GL_APIENTRY GL_PopAttrib()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopAttrib(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popAttrib();
@@ -4211,6 +4392,7 @@ void GL_APIENTRY GL_PopMatrix()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopMatrix(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popMatrix();
@@ -4232,6 +4414,7 @@ void GL_APIENTRY GL_PopName()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopName(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popName();
@@ -4254,6 +4437,7 @@ void GL_APIENTRY GL_PushAttrib(GLbitfield mask)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushAttrib(context, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushAttrib(mask);
@@ -4275,6 +4459,7 @@ void GL_APIENTRY GL_PushMatrix()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushMatrix(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushMatrix();
@@ -4296,6 +4481,7 @@ void GL_APIENTRY GL_PushName(GLuint name)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushName(context, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushName(name);
@@ -4317,6 +4503,7 @@ void GL_APIENTRY GL_RasterPos2d(GLdouble x, GLdouble y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2d(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos2d(x, y);
@@ -4339,6 +4526,7 @@ void GL_APIENTRY GL_RasterPos2dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos2dv(v);
@@ -4360,6 +4548,7 @@ void GL_APIENTRY GL_RasterPos2f(GLfloat x, GLfloat y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2f(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos2f(x, y);
@@ -4382,6 +4571,7 @@ void GL_APIENTRY GL_RasterPos2fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos2fv(v);
@@ -4403,6 +4593,7 @@ void GL_APIENTRY GL_RasterPos2i(GLint x, GLint y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2i(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos2i(x, y);
@@ -4425,6 +4616,7 @@ void GL_APIENTRY GL_RasterPos2iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos2iv(v);
@@ -4446,6 +4638,7 @@ void GL_APIENTRY GL_RasterPos2s(GLshort x, GLshort y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2s(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos2s(x, y);
@@ -4468,6 +4661,7 @@ void GL_APIENTRY GL_RasterPos2sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos2sv(v);
@@ -4489,6 +4683,7 @@ void GL_APIENTRY GL_RasterPos3d(GLdouble x, GLdouble y, GLdouble z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3d(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos3d(x, y, z);
@@ -4511,6 +4706,7 @@ void GL_APIENTRY GL_RasterPos3dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos3dv(v);
@@ -4532,6 +4728,7 @@ void GL_APIENTRY GL_RasterPos3f(GLfloat x, GLfloat y, GLfloat z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3f(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos3f(x, y, z);
@@ -4554,6 +4751,7 @@ void GL_APIENTRY GL_RasterPos3fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos3fv(v);
@@ -4575,6 +4773,7 @@ void GL_APIENTRY GL_RasterPos3i(GLint x, GLint y, GLint z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3i(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos3i(x, y, z);
@@ -4597,6 +4796,7 @@ void GL_APIENTRY GL_RasterPos3iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos3iv(v);
@@ -4618,6 +4818,7 @@ void GL_APIENTRY GL_RasterPos3s(GLshort x, GLshort y, GLshort z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3s(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos3s(x, y, z);
@@ -4640,6 +4841,7 @@ void GL_APIENTRY GL_RasterPos3sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos3sv(v);
@@ -4662,6 +4864,7 @@ void GL_APIENTRY GL_RasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4d(context, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos4d(x, y, z, w);
@@ -4684,6 +4887,7 @@ void GL_APIENTRY GL_RasterPos4dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos4dv(v);
@@ -4706,6 +4910,7 @@ void GL_APIENTRY GL_RasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4f(context, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos4f(x, y, z, w);
@@ -4728,6 +4933,7 @@ void GL_APIENTRY GL_RasterPos4fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos4fv(v);
@@ -4750,6 +4956,7 @@ void GL_APIENTRY GL_RasterPos4i(GLint x, GLint y, GLint z, GLint w)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4i(context, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos4i(x, y, z, w);
@@ -4772,6 +4979,7 @@ void GL_APIENTRY GL_RasterPos4iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos4iv(v);
@@ -4794,6 +5002,7 @@ void GL_APIENTRY GL_RasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4s(context, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos4s(x, y, z, w);
@@ -4816,6 +5025,7 @@ void GL_APIENTRY GL_RasterPos4sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rasterPos4sv(v);
@@ -4838,6 +5048,7 @@ void GL_APIENTRY GL_ReadBuffer(GLenum src)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateReadBuffer(context, src));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readBuffer(src);
@@ -4870,6 +5081,7 @@ void GL_APIENTRY GL_ReadPixels(GLint x,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateReadPixels(context, x, y, width, height, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readPixels(x, y, width, height, format, type, pixels);
@@ -4892,6 +5104,7 @@ void GL_APIENTRY GL_Rectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRectd(context, x1, y1, x2, y2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rectd(x1, y1, x2, y2);
@@ -4914,6 +5127,7 @@ void GL_APIENTRY GL_Rectdv(const GLdouble *v1, const GLdouble *v2)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRectdv(context, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rectdv(v1, v2);
@@ -4936,6 +5150,7 @@ void GL_APIENTRY GL_Rectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRectf(context, x1, y1, x2, y2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rectf(x1, y1, x2, y2);
@@ -4958,6 +5173,7 @@ void GL_APIENTRY GL_Rectfv(const GLfloat *v1, const GLfloat *v2)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRectfv(context, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rectfv(v1, v2);
@@ -4980,6 +5196,7 @@ void GL_APIENTRY GL_Recti(GLint x1, GLint y1, GLint x2, GLint y2)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRecti(context, x1, y1, x2, y2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->recti(x1, y1, x2, y2);
@@ -5002,6 +5219,7 @@ void GL_APIENTRY GL_Rectiv(const GLint *v1, const GLint *v2)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRectiv(context, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rectiv(v1, v2);
@@ -5024,6 +5242,7 @@ void GL_APIENTRY GL_Rects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRects(context, x1, y1, x2, y2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rects(x1, y1, x2, y2);
@@ -5046,6 +5265,7 @@ void GL_APIENTRY GL_Rectsv(const GLshort *v1, const GLshort *v2)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRectsv(context, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rectsv(v1, v2);
@@ -5069,6 +5289,7 @@ GLint GL_APIENTRY GL_RenderMode(GLenum mode)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRenderMode(context, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->renderMode(mode);
@@ -5097,6 +5318,7 @@ void GL_APIENTRY GL_Rotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotated(context, angle, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rotated(angle, x, y, z);
@@ -5119,6 +5341,7 @@ void GL_APIENTRY GL_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotatef(context, angle, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rotatef(angle, x, y, z);
@@ -5140,6 +5363,7 @@ void GL_APIENTRY GL_Scaled(GLdouble x, GLdouble y, GLdouble z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScaled(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scaled(x, y, z);
@@ -5161,6 +5385,7 @@ void GL_APIENTRY GL_Scalef(GLfloat x, GLfloat y, GLfloat z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScalef(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scalef(x, y, z);
@@ -5184,6 +5409,7 @@ void GL_APIENTRY GL_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateScissor(context, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scissor(x, y, width, height);
@@ -5207,6 +5433,7 @@ void GL_APIENTRY GL_SelectBuffer(GLsizei size, GLuint *buffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSelectBuffer(context, size, buffer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->selectBuffer(size, buffer);
@@ -5230,6 +5457,7 @@ void GL_APIENTRY GL_ShadeModel(GLenum mode)
         ShadingModel modePacked                               = PackParam<ShadingModel>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateShadeModel(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->shadeModel(modePacked);
@@ -5253,6 +5481,7 @@ void GL_APIENTRY GL_StencilFunc(GLenum func, GLint ref, GLuint mask)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilFunc(context, func, ref, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilFunc(func, ref, mask);
@@ -5274,6 +5503,7 @@ void GL_APIENTRY GL_StencilMask(GLuint mask)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateStencilMask(context, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilMask(mask);
@@ -5299,6 +5529,7 @@ void GL_APIENTRY GL_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilOp(context, fail, zfail, zpass));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilOp(fail, zfail, zpass);
@@ -5320,6 +5551,7 @@ void GL_APIENTRY GL_TexCoord1d(GLdouble s)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1d(context, s));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord1d(s);
@@ -5342,6 +5574,7 @@ void GL_APIENTRY GL_TexCoord1dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord1dv(v);
@@ -5363,6 +5596,7 @@ void GL_APIENTRY GL_TexCoord1f(GLfloat s)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1f(context, s));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord1f(s);
@@ -5385,6 +5619,7 @@ void GL_APIENTRY GL_TexCoord1fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord1fv(v);
@@ -5406,6 +5641,7 @@ void GL_APIENTRY GL_TexCoord1i(GLint s)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1i(context, s));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord1i(s);
@@ -5428,6 +5664,7 @@ void GL_APIENTRY GL_TexCoord1iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord1iv(v);
@@ -5449,6 +5686,7 @@ void GL_APIENTRY GL_TexCoord1s(GLshort s)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1s(context, s));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord1s(s);
@@ -5471,6 +5709,7 @@ void GL_APIENTRY GL_TexCoord1sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord1sv(v);
@@ -5492,6 +5731,7 @@ void GL_APIENTRY GL_TexCoord2d(GLdouble s, GLdouble t)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2d(context, s, t));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord2d(s, t);
@@ -5514,6 +5754,7 @@ void GL_APIENTRY GL_TexCoord2dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord2dv(v);
@@ -5535,6 +5776,7 @@ void GL_APIENTRY GL_TexCoord2f(GLfloat s, GLfloat t)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2f(context, s, t));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord2f(s, t);
@@ -5557,6 +5799,7 @@ void GL_APIENTRY GL_TexCoord2fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord2fv(v);
@@ -5578,6 +5821,7 @@ void GL_APIENTRY GL_TexCoord2i(GLint s, GLint t)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2i(context, s, t));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord2i(s, t);
@@ -5600,6 +5844,7 @@ void GL_APIENTRY GL_TexCoord2iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord2iv(v);
@@ -5621,6 +5866,7 @@ void GL_APIENTRY GL_TexCoord2s(GLshort s, GLshort t)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2s(context, s, t));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord2s(s, t);
@@ -5643,6 +5889,7 @@ void GL_APIENTRY GL_TexCoord2sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord2sv(v);
@@ -5664,6 +5911,7 @@ void GL_APIENTRY GL_TexCoord3d(GLdouble s, GLdouble t, GLdouble r)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3d(context, s, t, r));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord3d(s, t, r);
@@ -5686,6 +5934,7 @@ void GL_APIENTRY GL_TexCoord3dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord3dv(v);
@@ -5707,6 +5956,7 @@ void GL_APIENTRY GL_TexCoord3f(GLfloat s, GLfloat t, GLfloat r)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3f(context, s, t, r));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord3f(s, t, r);
@@ -5729,6 +5979,7 @@ void GL_APIENTRY GL_TexCoord3fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord3fv(v);
@@ -5750,6 +6001,7 @@ void GL_APIENTRY GL_TexCoord3i(GLint s, GLint t, GLint r)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3i(context, s, t, r));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord3i(s, t, r);
@@ -5772,6 +6024,7 @@ void GL_APIENTRY GL_TexCoord3iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord3iv(v);
@@ -5793,6 +6046,7 @@ void GL_APIENTRY GL_TexCoord3s(GLshort s, GLshort t, GLshort r)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3s(context, s, t, r));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord3s(s, t, r);
@@ -5815,6 +6069,7 @@ void GL_APIENTRY GL_TexCoord3sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord3sv(v);
@@ -5837,6 +6092,7 @@ void GL_APIENTRY GL_TexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4d(context, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord4d(s, t, r, q);
@@ -5859,6 +6115,7 @@ void GL_APIENTRY GL_TexCoord4dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord4dv(v);
@@ -5881,6 +6138,7 @@ void GL_APIENTRY GL_TexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4f(context, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord4f(s, t, r, q);
@@ -5903,6 +6161,7 @@ void GL_APIENTRY GL_TexCoord4fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord4fv(v);
@@ -5925,6 +6184,7 @@ void GL_APIENTRY GL_TexCoord4i(GLint s, GLint t, GLint r, GLint q)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4i(context, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord4i(s, t, r, q);
@@ -5947,6 +6207,7 @@ void GL_APIENTRY GL_TexCoord4iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord4iv(v);
@@ -5969,6 +6230,7 @@ void GL_APIENTRY GL_TexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4s(context, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord4s(s, t, r, q);
@@ -5991,6 +6253,7 @@ void GL_APIENTRY GL_TexCoord4sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoord4sv(v);
@@ -6017,6 +6280,7 @@ void GL_APIENTRY GL_TexEnvf(GLenum target, GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvf(context, targetPacked, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvf(targetPacked, pnamePacked, param);
@@ -6043,6 +6307,7 @@ void GL_APIENTRY GL_TexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvfv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvfv(targetPacked, pnamePacked, params);
@@ -6069,6 +6334,7 @@ void GL_APIENTRY GL_TexEnvi(GLenum target, GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvi(context, targetPacked, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvi(targetPacked, pnamePacked, param);
@@ -6095,6 +6361,7 @@ void GL_APIENTRY GL_TexEnviv(GLenum target, GLenum pname, const GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnviv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnviv(targetPacked, pnamePacked, params);
@@ -6119,6 +6386,7 @@ void GL_APIENTRY GL_TexGend(GLenum coord, GLenum pname, GLdouble param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGend(context, coord, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGend(coord, pname, param);
@@ -6143,6 +6411,7 @@ void GL_APIENTRY GL_TexGendv(GLenum coord, GLenum pname, const GLdouble *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGendv(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGendv(coord, pname, params);
@@ -6167,6 +6436,7 @@ void GL_APIENTRY GL_TexGenf(GLenum coord, GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenf(context, coord, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGenf(coord, pname, param);
@@ -6191,6 +6461,7 @@ void GL_APIENTRY GL_TexGenfv(GLenum coord, GLenum pname, const GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenfv(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGenfv(coord, pname, params);
@@ -6215,6 +6486,7 @@ void GL_APIENTRY GL_TexGeni(GLenum coord, GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGeni(context, coord, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGeni(coord, pname, param);
@@ -6239,6 +6511,7 @@ void GL_APIENTRY GL_TexGeniv(GLenum coord, GLenum pname, const GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGeniv(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGeniv(coord, pname, params);
@@ -6274,6 +6547,7 @@ void GL_APIENTRY GL_TexImage1D(GLenum target,
         bool isCallValid =
             (context->skipValidation() || ValidateTexImage1D(context, target, level, internalformat,
                                                              width, border, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage1D(target, level, internalformat, width, border, format, type, pixels);
@@ -6312,6 +6586,7 @@ void GL_APIENTRY GL_TexImage2D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexImage2D(context, targetPacked, level, internalformat, width,
                                                height, border, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage2D(targetPacked, level, internalformat, width, height, border, format,
@@ -6339,6 +6614,7 @@ void GL_APIENTRY GL_TexParameterf(GLenum target, GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterf(context, targetPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterf(targetPacked, pname, param);
@@ -6365,6 +6641,7 @@ void GL_APIENTRY GL_TexParameterfv(GLenum target, GLenum pname, const GLfloat *p
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterfv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterfv(targetPacked, pname, params);
@@ -6390,6 +6667,7 @@ void GL_APIENTRY GL_TexParameteri(GLenum target, GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameteri(context, targetPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameteri(targetPacked, pname, param);
@@ -6416,6 +6694,7 @@ void GL_APIENTRY GL_TexParameteriv(GLenum target, GLenum pname, const GLint *par
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameteriv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameteriv(targetPacked, pname, params);
@@ -6437,6 +6716,7 @@ void GL_APIENTRY GL_Translated(GLdouble x, GLdouble y, GLdouble z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslated(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->translated(x, y, z);
@@ -6458,6 +6738,7 @@ void GL_APIENTRY GL_Translatef(GLfloat x, GLfloat y, GLfloat z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslatef(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->translatef(x, y, z);
@@ -6479,6 +6760,7 @@ void GL_APIENTRY GL_Vertex2d(GLdouble x, GLdouble y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2d(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex2d(x, y);
@@ -6500,6 +6782,7 @@ void GL_APIENTRY GL_Vertex2dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex2dv(v);
@@ -6521,6 +6804,7 @@ void GL_APIENTRY GL_Vertex2f(GLfloat x, GLfloat y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2f(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex2f(x, y);
@@ -6542,6 +6826,7 @@ void GL_APIENTRY GL_Vertex2fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex2fv(v);
@@ -6563,6 +6848,7 @@ void GL_APIENTRY GL_Vertex2i(GLint x, GLint y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2i(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex2i(x, y);
@@ -6584,6 +6870,7 @@ void GL_APIENTRY GL_Vertex2iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex2iv(v);
@@ -6605,6 +6892,7 @@ void GL_APIENTRY GL_Vertex2s(GLshort x, GLshort y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2s(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex2s(x, y);
@@ -6626,6 +6914,7 @@ void GL_APIENTRY GL_Vertex2sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex2sv(v);
@@ -6647,6 +6936,7 @@ void GL_APIENTRY GL_Vertex3d(GLdouble x, GLdouble y, GLdouble z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3d(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex3d(x, y, z);
@@ -6668,6 +6958,7 @@ void GL_APIENTRY GL_Vertex3dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex3dv(v);
@@ -6689,6 +6980,7 @@ void GL_APIENTRY GL_Vertex3f(GLfloat x, GLfloat y, GLfloat z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3f(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex3f(x, y, z);
@@ -6710,6 +7002,7 @@ void GL_APIENTRY GL_Vertex3fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex3fv(v);
@@ -6731,6 +7024,7 @@ void GL_APIENTRY GL_Vertex3i(GLint x, GLint y, GLint z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3i(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex3i(x, y, z);
@@ -6752,6 +7046,7 @@ void GL_APIENTRY GL_Vertex3iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex3iv(v);
@@ -6773,6 +7068,7 @@ void GL_APIENTRY GL_Vertex3s(GLshort x, GLshort y, GLshort z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3s(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex3s(x, y, z);
@@ -6794,6 +7090,7 @@ void GL_APIENTRY GL_Vertex3sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex3sv(v);
@@ -6816,6 +7113,7 @@ void GL_APIENTRY GL_Vertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4d(context, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex4d(x, y, z, w);
@@ -6837,6 +7135,7 @@ void GL_APIENTRY GL_Vertex4dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex4dv(v);
@@ -6859,6 +7158,7 @@ void GL_APIENTRY GL_Vertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4f(context, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex4f(x, y, z, w);
@@ -6880,6 +7180,7 @@ void GL_APIENTRY GL_Vertex4fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex4fv(v);
@@ -6902,6 +7203,7 @@ void GL_APIENTRY GL_Vertex4i(GLint x, GLint y, GLint z, GLint w)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4i(context, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex4i(x, y, z, w);
@@ -6923,6 +7225,7 @@ void GL_APIENTRY GL_Vertex4iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex4iv(v);
@@ -6945,6 +7248,7 @@ void GL_APIENTRY GL_Vertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4s(context, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex4s(x, y, z, w);
@@ -6966,6 +7270,7 @@ void GL_APIENTRY GL_Vertex4sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertex4sv(v);
@@ -6989,6 +7294,7 @@ void GL_APIENTRY GL_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateViewport(context, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->viewport(x, y, width, height);
@@ -7017,6 +7323,7 @@ GLboolean GL_APIENTRY GL_AreTexturesResident(GLsizei n,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateAreTexturesResident(context, n, textures, residences));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->areTexturesResident(n, textures, residences);
@@ -7046,6 +7353,7 @@ void GL_APIENTRY GL_ArrayElement(GLint i)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateArrayElement(context, i));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->arrayElement(i);
@@ -7071,6 +7379,7 @@ void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindTexture(context, targetPacked, texturePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindTexture(targetPacked, texturePacked);
@@ -7097,6 +7406,7 @@ void GL_APIENTRY GL_ColorPointer(GLint size, GLenum type, GLsizei stride, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColorPointer(context, size, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorPointer(size, typePacked, stride, pointer);
@@ -7130,6 +7440,7 @@ void GL_APIENTRY GL_CopyTexImage1D(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCopyTexImage1D(context, target, level, internalformat, x, y, width, border));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexImage1D(target, level, internalformat, x, y, width, border);
@@ -7166,6 +7477,7 @@ void GL_APIENTRY GL_CopyTexImage2D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTexImage2D(context, targetPacked, level, internalformat, x,
                                                    y, width, height, border));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexImage2D(targetPacked, level, internalformat, x, y, width, height,
@@ -7195,6 +7507,7 @@ GL_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCopyTexSubImage1D(context, target, level, xoffset, x, y, width));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexSubImage1D(target, level, xoffset, x, y, width);
@@ -7230,6 +7543,7 @@ void GL_APIENTRY GL_CopyTexSubImage2D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTexSubImage2D(context, targetPacked, level, xoffset,
                                                       yoffset, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexSubImage2D(targetPacked, level, xoffset, yoffset, x, y, width, height);
@@ -7255,6 +7569,7 @@ void GL_APIENTRY GL_DeleteTextures(GLsizei n, const GLuint *textures)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteTextures(context, n, texturesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteTextures(n, texturesPacked);
@@ -7279,6 +7594,7 @@ void GL_APIENTRY GL_DisableClientState(GLenum array)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableClientState(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disableClientState(arrayPacked);
@@ -7299,10 +7615,16 @@ void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
 
     if (context)
     {
-        PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
+        PrimitiveMode modePacked = PackParam<PrimitiveMode>(mode);
+        if (context->isRecordingDeferredCommands() &&
+            context->recordDrawArrays(modePacked, first, count))
+        {
+            return;
+        }
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawArrays(context, modePacked, first, count));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArrays(modePacked, first, count);
@@ -7325,11 +7647,17 @@ void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const
 
     if (context)
     {
-        PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
-        DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
+        PrimitiveMode modePacked    = PackParam<PrimitiveMode>(mode);
+        DrawElementsType typePacked = PackParam<DrawElementsType>(type);
+        if (context->isRecordingDeferredCommands() &&
+            context->recordDrawElements(modePacked, count, typePacked, indices))
+        {
+            return;
+        }
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElements(context, modePacked, count, typePacked, indices));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElements(modePacked, count, typePacked, indices);
@@ -7353,6 +7681,7 @@ void GL_APIENTRY GL_EdgeFlagPointer(GLsizei stride, const void *pointer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEdgeFlagPointer(context, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->edgeFlagPointer(stride, pointer);
@@ -7377,6 +7706,7 @@ void GL_APIENTRY GL_EnableClientState(GLenum array)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableClientState(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enableClientState(arrayPacked);
@@ -7401,6 +7731,7 @@ void GL_APIENTRY GL_GenTextures(GLsizei n, GLuint *textures)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenTextures(context, n, texturesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genTextures(n, texturesPacked);
@@ -7424,6 +7755,7 @@ void GL_APIENTRY GL_GetPointerv(GLenum pname, void **params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetPointerv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getPointerv(pname, params);
@@ -7448,6 +7780,7 @@ void GL_APIENTRY GL_IndexPointer(GLenum type, GLsizei stride, const void *pointe
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIndexPointer(context, type, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexPointer(type, stride, pointer);
@@ -7469,6 +7802,7 @@ void GL_APIENTRY GL_Indexub(GLubyte c)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexub(context, c));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexub(c);
@@ -7490,6 +7824,7 @@ void GL_APIENTRY GL_Indexubv(const GLubyte *c)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexubv(context, c));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->indexubv(c);
@@ -7514,6 +7849,7 @@ void GL_APIENTRY GL_InterleavedArrays(GLenum format, GLsizei stride, const void
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInterleavedArrays(context, format, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->interleavedArrays(format, stride, pointer);
@@ -7537,6 +7873,7 @@ GLboolean GL_APIENTRY GL_IsTexture(GLuint texture)
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsTexture(context, texturePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isTexture(texturePacked);
@@ -7568,6 +7905,7 @@ void GL_APIENTRY GL_NormalPointer(GLenum type, GLsizei stride, const void *point
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormalPointer(context, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normalPointer(typePacked, stride, pointer);
@@ -7591,6 +7929,7 @@ void GL_APIENTRY GL_PolygonOffset(GLfloat factor, GLfloat units)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePolygonOffset(context, factor, units));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->polygonOffset(factor, units);
@@ -7612,6 +7951,7 @@ void GL_APIENTRY GL_PopClientAttrib()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopClientAttrib(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popClientAttrib();
@@ -7636,6 +7976,7 @@ void GL_APIENTRY GL_PrioritizeTextures(GLsizei n, const GLuint *textures, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePrioritizeTextures(context, n, textures, priorities));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->prioritizeTextures(n, textures, priorities);
@@ -7658,6 +7999,7 @@ void GL_APIENTRY GL_PushClientAttrib(GLbitfield mask)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushClientAttrib(context, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushClientAttrib(mask);
@@ -7684,6 +8026,7 @@ void GL_APIENTRY GL_TexCoordPointer(GLint size, GLenum type, GLsizei stride, con
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoordPointer(context, size, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoordPointer(size, typePacked, stride, pointer);
@@ -7718,6 +8061,7 @@ void GL_APIENTRY GL_TexSubImage1D(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexSubImage1D(context, target, level, xoffset, width, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage1D(target, level, xoffset, width, format, type, pixels);
@@ -7756,6 +8100,7 @@ void GL_APIENTRY GL_TexSubImage2D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexSubImage2D(context, targetPacked, level, xoffset, yoffset,
                                                   width, height, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage2D(targetPacked, level, xoffset, yoffset, width, height, format,
@@ -7784,6 +8129,7 @@ void GL_APIENTRY GL_VertexPointer(GLint size, GLenum type, GLsizei stride, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexPointer(context, size, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexPointer(size, typePacked, stride, pointer);
@@ -7821,6 +8167,7 @@ void GL_APIENTRY GL_CopyTexSubImage3D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTexSubImage3D(context, targetPacked, level, xoffset,
                                                       yoffset, zoffset, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, x, y, width,
@@ -7857,6 +8204,7 @@ void GL_APIENTRY GL_DrawRangeElements(GLenum mode,
         bool isCallValid =
             (context->skipValidation() || ValidateDrawRangeElements(context, modePacked, start, end,
                                                                     count, typePacked, indices));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawRangeElements(modePacked, start, end, count, typePacked, indices);
@@ -7896,6 +8244,7 @@ void GL_APIENTRY GL_TexImage3D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexImage3D(context, targetPacked, level, internalformat, width,
                                                height, depth, border, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage3D(targetPacked, level, internalformat, width, height, depth, border,
@@ -7938,6 +8287,7 @@ void GL_APIENTRY GL_TexSubImage3D(GLenum target,
             (context->skipValidation() ||
              ValidateTexSubImage3D(context, targetPacked, level, xoffset, yoffset, zoffset, width,
                                    height, depth, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, width, height,
@@ -7963,6 +8313,7 @@ void GL_APIENTRY GL_ActiveTexture(GLenum texture)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateActiveTexture(context, texture));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->activeTexture(texture);
@@ -7986,6 +8337,7 @@ void GL_APIENTRY GL_ClientActiveTexture(GLenum texture)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClientActiveTexture(context, texture));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clientActiveTexture(texture);
@@ -8020,6 +8372,7 @@ void GL_APIENTRY GL_CompressedTexImage1D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCompressedTexImage1D(context, target, level, internalformat,
                                                          width, border, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage1D(target, level, internalformat, width, border, imageSize,
@@ -8059,6 +8412,7 @@ void GL_APIENTRY GL_CompressedTexImage2D(GLenum target,
             (context->skipValidation() ||
              ValidateCompressedTexImage2D(context, targetPacked, level, internalformat, width,
                                           height, border, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage2D(targetPacked, level, internalformat, width, height,
@@ -8099,6 +8453,7 @@ void GL_APIENTRY GL_CompressedTexImage3D(GLenum target,
             (context->skipValidation() ||
              ValidateCompressedTexImage3D(context, targetPacked, level, internalformat, width,
                                           height, depth, border, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage3D(targetPacked, level, internalformat, width, height, depth,
@@ -8134,6 +8489,7 @@ void GL_APIENTRY GL_CompressedTexSubImage1D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCompressedTexSubImage1D(context, target, level, xoffset, width,
                                                             format, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage1D(target, level, xoffset, width, format, imageSize,
@@ -8174,6 +8530,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2D(GLenum target,
             (context->skipValidation() ||
              ValidateCompressedTexSubImage2D(context, targetPacked, level, xoffset, yoffset, width,
                                              height, format, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage2D(targetPacked, level, xoffset, yoffset, width, height,
@@ -8216,6 +8573,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3D(GLenum target,
                             ValidateCompressedTexSubImage3D(context, targetPacked, level, xoffset,
                                                             yoffset, zoffset, width, height, depth,
                                                             format, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, width,
@@ -8242,6 +8600,7 @@ void GL_APIENTRY GL_GetCompressedTexImage(GLenum target, GLint level, void *img)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetCompressedTexImage(context, target, level, img));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getCompressedTexImage(target, level, img);
@@ -8264,6 +8623,7 @@ void GL_APIENTRY GL_LoadTransposeMatrixd(const GLdouble *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadTransposeMatrixd(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadTransposeMatrixd(m);
@@ -8286,6 +8646,7 @@ void GL_APIENTRY GL_LoadTransposeMatrixf(const GLfloat *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadTransposeMatrixf(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadTransposeMatrixf(m);
@@ -8308,6 +8669,7 @@ void GL_APIENTRY GL_MultTransposeMatrixd(const GLdouble *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMultTransposeMatrixd(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multTransposeMatrixd(m);
@@ -8330,6 +8692,7 @@ void GL_APIENTRY GL_MultTransposeMatrixf(const GLfloat *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMultTransposeMatrixf(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multTransposeMatrixf(m);
@@ -8353,6 +8716,7 @@ void GL_APIENTRY GL_MultiTexCoord1d(GLenum target, GLdouble s)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1d(context, target, s));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord1d(target, s);
@@ -8376,6 +8740,7 @@ void GL_APIENTRY GL_MultiTexCoord1dv(GLenum target, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1dv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord1dv(target, v);
@@ -8399,6 +8764,7 @@ void GL_APIENTRY GL_MultiTexCoord1f(GLenum target, GLfloat s)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1f(context, target, s));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord1f(target, s);
@@ -8422,6 +8788,7 @@ void GL_APIENTRY GL_MultiTexCoord1fv(GLenum target, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1fv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord1fv(target, v);
@@ -8445,6 +8812,7 @@ void GL_APIENTRY GL_MultiTexCoord1i(GLenum target, GLint s)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1i(context, target, s));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord1i(target, s);
@@ -8468,6 +8836,7 @@ void GL_APIENTRY GL_MultiTexCoord1iv(GLenum target, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1iv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord1iv(target, v);
@@ -8491,6 +8860,7 @@ void GL_APIENTRY GL_MultiTexCoord1s(GLenum target, GLshort s)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1s(context, target, s));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord1s(target, s);
@@ -8514,6 +8884,7 @@ void GL_APIENTRY GL_MultiTexCoord1sv(GLenum target, const GLshort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1sv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord1sv(target, v);
@@ -8537,6 +8908,7 @@ void GL_APIENTRY GL_MultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2d(context, target, s, t));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord2d(target, s, t);
@@ -8560,6 +8932,7 @@ void GL_APIENTRY GL_MultiTexCoord2dv(GLenum target, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2dv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord2dv(target, v);
@@ -8583,6 +8956,7 @@ void GL_APIENTRY GL_MultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2f(context, target, s, t));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord2f(target, s, t);
@@ -8606,6 +8980,7 @@ void GL_APIENTRY GL_MultiTexCoord2fv(GLenum target, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2fv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord2fv(target, v);
@@ -8629,6 +9004,7 @@ void GL_APIENTRY GL_MultiTexCoord2i(GLenum target, GLint s, GLint t)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2i(context, target, s, t));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord2i(target, s, t);
@@ -8652,6 +9028,7 @@ void GL_APIENTRY GL_MultiTexCoord2iv(GLenum target, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2iv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord2iv(target, v);
@@ -8675,6 +9052,7 @@ void GL_APIENTRY GL_MultiTexCoord2s(GLenum target, GLshort s, GLshort t)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2s(context, target, s, t));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord2s(target, s, t);
@@ -8698,6 +9076,7 @@ void GL_APIENTRY GL_MultiTexCoord2sv(GLenum target, const GLshort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2sv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord2sv(target, v);
@@ -8721,6 +9100,7 @@ void GL_APIENTRY GL_MultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdou
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3d(context, target, s, t, r));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord3d(target, s, t, r);
@@ -8744,6 +9124,7 @@ void GL_APIENTRY GL_MultiTexCoord3dv(GLenum target, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3dv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord3dv(target, v);
@@ -8767,6 +9148,7 @@ void GL_APIENTRY GL_MultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3f(context, target, s, t, r));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord3f(target, s, t, r);
@@ -8790,6 +9172,7 @@ void GL_APIENTRY GL_MultiTexCoord3fv(GLenum target, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3fv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord3fv(target, v);
@@ -8813,6 +9196,7 @@ void GL_APIENTRY GL_MultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3i(context, target, s, t, r));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord3i(target, s, t, r);
@@ -8836,6 +9220,7 @@ void GL_APIENTRY GL_MultiTexCoord3iv(GLenum target, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3iv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord3iv(target, v);
@@ -8859,6 +9244,7 @@ void GL_APIENTRY GL_MultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3s(context, target, s, t, r));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord3s(target, s, t, r);
@@ -8882,6 +9268,7 @@ void GL_APIENTRY GL_MultiTexCoord3sv(GLenum target, const GLshort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3sv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord3sv(target, v);
@@ -8905,6 +9292,7 @@ void GL_APIENTRY GL_MultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdou
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4d(context, target, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4d(target, s, t, r, q);
@@ -8928,6 +9316,7 @@ void GL_APIENTRY GL_MultiTexCoord4dv(GLenum target, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4dv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4dv(target, v);
@@ -8951,6 +9340,7 @@ void GL_APIENTRY GL_MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4f(context, target, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4f(target, s, t, r, q);
@@ -8974,6 +9364,7 @@ void GL_APIENTRY GL_MultiTexCoord4fv(GLenum target, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4fv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4fv(target, v);
@@ -8997,6 +9388,7 @@ void GL_APIENTRY GL_MultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4i(context, target, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4i(target, s, t, r, q);
@@ -9020,6 +9412,7 @@ void GL_APIENTRY GL_MultiTexCoord4iv(GLenum target, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4iv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4iv(target, v);
@@ -9043,6 +9436,7 @@ void GL_APIENTRY GL_MultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4s(context, target, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4s(target, s, t, r, q);
@@ -9066,6 +9460,7 @@ void GL_APIENTRY GL_MultiTexCoord4sv(GLenum target, const GLshort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4sv(context, target, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4sv(target, v);
@@ -9089,6 +9484,7 @@ void GL_APIENTRY GL_SampleCoverage(GLfloat value, GLboolean invert)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleCoverage(context, value, invert));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->sampleCoverage(value, invert);
@@ -9113,6 +9509,7 @@ void GL_APIENTRY GL_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendColor(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendColor(red, green, blue, alpha);
@@ -9135,6 +9532,7 @@ void GL_APIENTRY GL_BlendEquation(GLenum mode)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBlendEquation(context, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquation(mode);
@@ -9166,6 +9564,7 @@ void GL_APIENTRY GL_BlendFuncSeparate(GLenum sfactorRGB,
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFuncSeparate(context, sfactorRGB, dfactorRGB,
                                                                     sfactorAlpha, dfactorAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
@@ -9191,6 +9590,7 @@ void GL_APIENTRY GL_FogCoordPointer(GLenum type, GLsizei stride, const void *poi
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFogCoordPointer(context, type, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogCoordPointer(type, stride, pointer);
@@ -9212,6 +9612,7 @@ void GL_APIENTRY GL_FogCoordd(GLdouble coord)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogCoordd(context, coord));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogCoordd(coord);
@@ -9234,6 +9635,7 @@ void GL_APIENTRY GL_FogCoorddv(const GLdouble *coord)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogCoorddv(context, coord));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogCoorddv(coord);
@@ -9255,6 +9657,7 @@ void GL_APIENTRY GL_FogCoordf(GLfloat coord)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogCoordf(context, coord));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogCoordf(coord);
@@ -9277,6 +9680,7 @@ void GL_APIENTRY GL_FogCoordfv(const GLfloat *coord)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogCoordfv(context, coord));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogCoordfv(coord);
@@ -9307,6 +9711,7 @@ void GL_APIENTRY GL_MultiDrawArrays(GLenum mode,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiDrawArrays(context, modePacked, first, count, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawArrays(modePacked, first, count, drawcount);
@@ -9340,6 +9745,7 @@ void GL_APIENTRY GL_MultiDrawElements(GLenum mode,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiDrawElements(context, modePacked, count, typePacked, indices, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElements(modePacked, count, typePacked, indices, drawcount);
@@ -9365,6 +9771,7 @@ void GL_APIENTRY GL_PointParameterf(GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameterf(context, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameterf(pnamePacked, param);
@@ -9389,6 +9796,7 @@ void GL_APIENTRY GL_PointParameterfv(GLenum pname, const GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameterfv(context, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameterfv(pnamePacked, params);
@@ -9412,6 +9820,7 @@ void GL_APIENTRY GL_PointParameteri(GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameteri(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameteri(pname, param);
@@ -9435,6 +9844,7 @@ void GL_APIENTRY GL_PointParameteriv(GLenum pname, const GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameteriv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameteriv(pname, params);
@@ -9458,6 +9868,7 @@ void GL_APIENTRY GL_SecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3b(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3b(red, green, blue);
@@ -9480,6 +9891,7 @@ void GL_APIENTRY GL_SecondaryColor3bv(const GLbyte *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateSecondaryColor3bv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3bv(v);
@@ -9503,6 +9915,7 @@ void GL_APIENTRY GL_SecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3d(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3d(red, green, blue);
@@ -9525,6 +9938,7 @@ void GL_APIENTRY GL_SecondaryColor3dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateSecondaryColor3dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3dv(v);
@@ -9548,6 +9962,7 @@ void GL_APIENTRY GL_SecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3f(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3f(red, green, blue);
@@ -9570,6 +9985,7 @@ void GL_APIENTRY GL_SecondaryColor3fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateSecondaryColor3fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3fv(v);
@@ -9593,6 +10009,7 @@ void GL_APIENTRY GL_SecondaryColor3i(GLint red, GLint green, GLint blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3i(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3i(red, green, blue);
@@ -9615,6 +10032,7 @@ void GL_APIENTRY GL_SecondaryColor3iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateSecondaryColor3iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3iv(v);
@@ -9638,6 +10056,7 @@ void GL_APIENTRY GL_SecondaryColor3s(GLshort red, GLshort green, GLshort blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3s(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3s(red, green, blue);
@@ -9660,6 +10079,7 @@ void GL_APIENTRY GL_SecondaryColor3sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateSecondaryColor3sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3sv(v);
@@ -9683,6 +10103,7 @@ void GL_APIENTRY GL_SecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3ub(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3ub(red, green, blue);
@@ -9705,6 +10126,7 @@ void GL_APIENTRY GL_SecondaryColor3ubv(const GLubyte *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateSecondaryColor3ubv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3ubv(v);
@@ -9728,6 +10150,7 @@ void GL_APIENTRY GL_SecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3ui(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3ui(red, green, blue);
@@ -9750,6 +10173,7 @@ void GL_APIENTRY GL_SecondaryColor3uiv(const GLuint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateSecondaryColor3uiv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3uiv(v);
@@ -9773,6 +10197,7 @@ void GL_APIENTRY GL_SecondaryColor3us(GLushort red, GLushort green, GLushort blu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3us(context, red, green, blue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3us(red, green, blue);
@@ -9795,6 +10220,7 @@ void GL_APIENTRY GL_SecondaryColor3usv(const GLushort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateSecondaryColor3usv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColor3usv(v);
@@ -9823,6 +10249,7 @@ void GL_APIENTRY GL_SecondaryColorPointer(GLint size,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSecondaryColorPointer(context, size, type, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColorPointer(size, type, stride, pointer);
@@ -9844,6 +10271,7 @@ void GL_APIENTRY GL_WindowPos2d(GLdouble x, GLdouble y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2d(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos2d(x, y);
@@ -9866,6 +10294,7 @@ void GL_APIENTRY GL_WindowPos2dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos2dv(v);
@@ -9887,6 +10316,7 @@ void GL_APIENTRY GL_WindowPos2f(GLfloat x, GLfloat y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2f(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos2f(x, y);
@@ -9909,6 +10339,7 @@ void GL_APIENTRY GL_WindowPos2fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos2fv(v);
@@ -9930,6 +10361,7 @@ void GL_APIENTRY GL_WindowPos2i(GLint x, GLint y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2i(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos2i(x, y);
@@ -9952,6 +10384,7 @@ void GL_APIENTRY GL_WindowPos2iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos2iv(v);
@@ -9973,6 +10406,7 @@ void GL_APIENTRY GL_WindowPos2s(GLshort x, GLshort y)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2s(context, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos2s(x, y);
@@ -9995,6 +10429,7 @@ void GL_APIENTRY GL_WindowPos2sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos2sv(v);
@@ -10016,6 +10451,7 @@ void GL_APIENTRY GL_WindowPos3d(GLdouble x, GLdouble y, GLdouble z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3d(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos3d(x, y, z);
@@ -10038,6 +10474,7 @@ void GL_APIENTRY GL_WindowPos3dv(const GLdouble *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3dv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos3dv(v);
@@ -10059,6 +10496,7 @@ void GL_APIENTRY GL_WindowPos3f(GLfloat x, GLfloat y, GLfloat z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3f(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos3f(x, y, z);
@@ -10081,6 +10519,7 @@ void GL_APIENTRY GL_WindowPos3fv(const GLfloat *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3fv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos3fv(v);
@@ -10102,6 +10541,7 @@ void GL_APIENTRY GL_WindowPos3i(GLint x, GLint y, GLint z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3i(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos3i(x, y, z);
@@ -10124,6 +10564,7 @@ void GL_APIENTRY GL_WindowPos3iv(const GLint *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3iv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos3iv(v);
@@ -10145,6 +10586,7 @@ void GL_APIENTRY GL_WindowPos3s(GLshort x, GLshort y, GLshort z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3s(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos3s(x, y, z);
@@ -10167,6 +10609,7 @@ void GL_APIENTRY GL_WindowPos3sv(const GLshort *v)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3sv(context, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->windowPos3sv(v);
@@ -10193,6 +10636,7 @@ void GL_APIENTRY GL_BeginQuery(GLenum target, GLuint id)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBeginQuery(context, targetPacked, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->beginQuery(targetPacked, idPacked);
@@ -10218,6 +10662,7 @@ void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindBuffer(context, targetPacked, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindBuffer(targetPacked, bufferPacked);
@@ -10246,6 +10691,7 @@ void GL_APIENTRY GL_BufferData(GLenum target, GLsizeiptr size, const void *data,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferData(context, targetPacked, size, data, usagePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferData(targetPacked, size, data, usagePacked);
@@ -10273,6 +10719,7 @@ void GL_APIENTRY GL_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr siz
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferSubData(context, targetPacked, offset, size, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferSubData(targetPacked, offset, size, data);
@@ -10297,6 +10744,7 @@ void GL_APIENTRY GL_DeleteBuffers(GLsizei n, const GLuint *buffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteBuffers(context, n, buffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteBuffers(n, buffersPacked);
@@ -10321,6 +10769,7 @@ void GL_APIENTRY GL_DeleteQueries(GLsizei n, const GLuint *ids)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteQueries(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteQueries(n, idsPacked);
@@ -10344,6 +10793,7 @@ void GL_APIENTRY GL_EndQuery(GLenum target)
         QueryType targetPacked                                = PackParam<QueryType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndQuery(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->endQuery(targetPacked);
@@ -10368,6 +10818,7 @@ void GL_APIENTRY GL_GenBuffers(GLsizei n, GLuint *buffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenBuffers(context, n, buffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genBuffers(n, buffersPacked);
@@ -10391,6 +10842,7 @@ void GL_APIENTRY GL_GenQueries(GLsizei n, GLuint *ids)
         QueryID *idsPacked                                    = PackParam<QueryID *>(ids);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGenQueries(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genQueries(n, idsPacked);
@@ -10417,6 +10869,7 @@ void GL_APIENTRY GL_GetBufferParameteriv(GLenum target, GLenum pname, GLint *par
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferParameteriv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferParameteriv(targetPacked, pname, params);
@@ -10443,6 +10896,7 @@ void GL_APIENTRY GL_GetBufferPointerv(GLenum target, GLenum pname, void **params
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferPointerv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferPointerv(targetPacked, pname, params);
@@ -10469,6 +10923,7 @@ void GL_APIENTRY GL_GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferSubData(context, target, offset, size, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferSubData(target, offset, size, data);
@@ -10494,6 +10949,7 @@ void GL_APIENTRY GL_GetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjectiv(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectiv(idPacked, pname, params);
@@ -10517,6 +10973,7 @@ void GL_APIENTRY GL_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjectuiv(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectuiv(idPacked, pname, params);
@@ -10543,6 +11000,7 @@ void GL_APIENTRY GL_GetQueryiv(GLenum target, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetQueryiv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryiv(targetPacked, pname, params);
@@ -10566,6 +11024,7 @@ GLboolean GL_APIENTRY GL_IsBuffer(GLuint buffer)
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsBuffer(context, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isBuffer(bufferPacked);
@@ -10595,6 +11054,7 @@ GLboolean GL_APIENTRY GL_IsQuery(GLuint id)
         QueryID idPacked                                      = PackParam<QueryID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsQuery(context, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isQuery(idPacked);
@@ -10627,6 +11087,7 @@ void *GL_APIENTRY GL_MapBuffer(GLenum target, GLenum access)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMapBuffer(context, targetPacked, access));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->mapBuffer(targetPacked, access);
@@ -10658,6 +11119,7 @@ GLboolean GL_APIENTRY GL_UnmapBuffer(GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUnmapBuffer(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->unmapBuffer(targetPacked);
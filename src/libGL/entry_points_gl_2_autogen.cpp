@@ -43,6 +43,7 @@ void GL_APIENTRY GL_AttachShader(GLuint program, GLuint shader)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateAttachShader(context, programPacked, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->attachShader(programPacked, shaderPacked);
@@ -68,6 +69,7 @@ void GL_APIENTRY GL_BindAttribLocation(GLuint program, GLuint index, const GLcha
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindAttribLocation(context, programPacked, index, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindAttribLocation(programPacked, index, name);
@@ -92,6 +94,7 @@ void GL_APIENTRY GL_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparate(context, modeRGB, modeAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationSeparate(modeRGB, modeAlpha);
@@ -115,6 +118,7 @@ void GL_APIENTRY GL_CompileShader(GLuint shader)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCompileShader(context, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compileShader(shaderPacked);
@@ -137,6 +141,7 @@ GLuint GL_APIENTRY GL_CreateProgram()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCreateProgram(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->createProgram();
@@ -167,6 +172,7 @@ GLuint GL_APIENTRY GL_CreateShader(GLenum type)
         ShaderType typePacked                                 = PackParam<ShaderType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCreateShader(context, typePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->createShader(typePacked);
@@ -196,6 +202,7 @@ void GL_APIENTRY GL_DeleteProgram(GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteProgram(programPacked);
@@ -219,6 +226,7 @@ void GL_APIENTRY GL_DeleteShader(GLuint shader)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteShader(context, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteShader(shaderPacked);
@@ -244,6 +252,7 @@ void GL_APIENTRY GL_DetachShader(GLuint program, GLuint shader)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDetachShader(context, programPacked, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->detachShader(programPacked, shaderPacked);
@@ -266,6 +275,7 @@ void GL_APIENTRY GL_DisableVertexAttribArray(GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableVertexAttribArray(context, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disableVertexAttribArray(index);
@@ -288,6 +298,7 @@ void GL_APIENTRY GL_DrawBuffers(GLsizei n, const GLenum *bufs)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawBuffers(context, n, bufs));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawBuffers(n, bufs);
@@ -310,6 +321,7 @@ void GL_APIENTRY GL_EnableVertexAttribArray(GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableVertexAttribArray(context, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enableVertexAttribArray(index);
@@ -344,6 +356,7 @@ void GL_APIENTRY GL_GetActiveAttrib(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveAttrib(context, programPacked, index, bufSize, length,
                                                     size, type, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveAttrib(programPacked, index, bufSize, length, size, type, name);
@@ -379,6 +392,7 @@ void GL_APIENTRY GL_GetActiveUniform(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveUniform(context, programPacked, index, bufSize, length,
                                                      size, type, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniform(programPacked, index, bufSize, length, size, type, name);
@@ -411,6 +425,7 @@ void GL_APIENTRY GL_GetAttachedShaders(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetAttachedShaders(context, programPacked, maxCount, count, shadersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getAttachedShaders(programPacked, maxCount, count, shadersPacked);
@@ -437,6 +452,7 @@ GLint GL_APIENTRY GL_GetAttribLocation(GLuint program, const GLchar *name)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetAttribLocation(context, programPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getAttribLocation(programPacked, name);
@@ -473,6 +489,7 @@ void GL_APIENTRY GL_GetProgramInfoLog(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramInfoLog(context, programPacked, bufSize, length, infoLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramInfoLog(programPacked, bufSize, length, infoLog);
@@ -499,6 +516,7 @@ void GL_APIENTRY GL_GetProgramiv(GLuint program, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramiv(context, programPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramiv(programPacked, pname, params);
@@ -527,6 +545,7 @@ void GL_APIENTRY GL_GetShaderInfoLog(GLuint shader,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetShaderInfoLog(context, shaderPacked, bufSize, length, infoLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderInfoLog(shaderPacked, bufSize, length, infoLog);
@@ -555,6 +574,7 @@ void GL_APIENTRY GL_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *len
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetShaderSource(context, shaderPacked, bufSize, length, source));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderSource(shaderPacked, bufSize, length, source);
@@ -580,6 +600,7 @@ void GL_APIENTRY GL_GetShaderiv(GLuint shader, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetShaderiv(context, shaderPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderiv(shaderPacked, pname, params);
@@ -603,6 +624,7 @@ GLint GL_APIENTRY GL_GetUniformLocation(GLuint program, const GLchar *name)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetUniformLocation(context, programPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getUniformLocation(programPacked, name);
@@ -635,6 +657,7 @@ void GL_APIENTRY GL_GetUniformfv(GLuint program, GLint location, GLfloat *params
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformfv(context, programPacked, locationPacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformfv(programPacked, locationPacked, params);
@@ -661,6 +684,7 @@ void GL_APIENTRY GL_GetUniformiv(GLuint program, GLint location, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformiv(context, programPacked, locationPacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformiv(programPacked, locationPacked, params);
@@ -685,6 +709,7 @@ void GL_APIENTRY GL_GetVertexAttribPointerv(GLuint index, GLenum pname, void **p
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetVertexAttribPointerv(context, index, pname, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribPointerv(index, pname, pointer);
@@ -709,6 +734,7 @@ void GL_APIENTRY GL_GetVertexAttribdv(GLuint index, GLenum pname, GLdouble *para
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetVertexAttribdv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribdv(index, pname, params);
@@ -733,6 +759,7 @@ void GL_APIENTRY GL_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *param
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetVertexAttribfv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribfv(index, pname, params);
@@ -757,6 +784,7 @@ void GL_APIENTRY GL_GetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetVertexAttribiv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribiv(index, pname, params);
@@ -780,6 +808,7 @@ GLboolean GL_APIENTRY GL_IsProgram(GLuint program)
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isProgram(programPacked);
@@ -809,6 +838,7 @@ GLboolean GL_APIENTRY GL_IsShader(GLuint shader)
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsShader(context, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isShader(shaderPacked);
@@ -838,6 +868,7 @@ void GL_APIENTRY GL_LinkProgram(GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLinkProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->linkProgram(programPacked);
@@ -867,6 +898,7 @@ void GL_APIENTRY GL_ShaderSource(GLuint shader,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateShaderSource(context, shaderPacked, count, string, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->shaderSource(shaderPacked, count, string, length);
@@ -891,6 +923,7 @@ void GL_APIENTRY GL_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilFuncSeparate(context, face, func, ref, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilFuncSeparate(face, func, ref, mask);
@@ -914,6 +947,7 @@ void GL_APIENTRY GL_StencilMaskSeparate(GLenum face, GLuint mask)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilMaskSeparate(context, face, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilMaskSeparate(face, mask);
@@ -941,6 +975,7 @@ void GL_APIENTRY GL_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilOpSeparate(context, face, sfail, dpfail, dppass));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilOpSeparate(face, sfail, dpfail, dppass);
@@ -964,6 +999,7 @@ void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform1f(context, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1f(locationPacked, v0);
@@ -989,6 +1025,7 @@ void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform1fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1fv(locationPacked, count, value);
@@ -1012,6 +1049,7 @@ void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform1i(context, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1i(locationPacked, v0);
@@ -1037,6 +1075,7 @@ void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform1iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1iv(locationPacked, count, value);
@@ -1061,6 +1100,7 @@ void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2f(context, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2f(locationPacked, v0, v1);
@@ -1086,6 +1126,7 @@ void GL_APIENTRY GL_Uniform2fv(GLint location, GLsizei count, const GLfloat *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform2fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2fv(locationPacked, count, value);
@@ -1110,6 +1151,7 @@ void GL_APIENTRY GL_Uniform2i(GLint location, GLint v0, GLint v1)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2i(context, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2i(locationPacked, v0, v1);
@@ -1135,6 +1177,7 @@ void GL_APIENTRY GL_Uniform2iv(GLint location, GLsizei count, const GLint *value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform2iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2iv(locationPacked, count, value);
@@ -1159,6 +1202,7 @@ void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3f(context, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3f(locationPacked, v0, v1, v2);
@@ -1184,6 +1228,7 @@ void GL_APIENTRY GL_Uniform3fv(GLint location, GLsizei count, const GLfloat *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform3fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3fv(locationPacked, count, value);
@@ -1208,6 +1253,7 @@ void GL_APIENTRY GL_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3i(context, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3i(locationPacked, v0, v1, v2);
@@ -1233,6 +1279,7 @@ void GL_APIENTRY GL_Uniform3iv(GLint location, GLsizei count, const GLint *value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform3iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3iv(locationPacked, count, value);
@@ -1257,6 +1304,7 @@ void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4f(context, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4f(locationPacked, v0, v1, v2, v3);
@@ -1282,6 +1330,7 @@ void GL_APIENTRY GL_Uniform4fv(GLint location, GLsizei count, const GLfloat *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4fv(locationPacked, count, value);
@@ -1306,6 +1355,7 @@ void GL_APIENTRY GL_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4i(context, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4i(locationPacked, v0, v1, v2, v3);
@@ -1331,6 +1381,7 @@ void GL_APIENTRY GL_Uniform4iv(GLint location, GLsizei count, const GLint *value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4iv(locationPacked, count, value);
@@ -1360,6 +1411,7 @@ void GL_APIENTRY GL_UniformMatrix2fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix2fv(locationPacked, count, transpose, value);
@@ -1390,6 +1442,7 @@ void GL_APIENTRY GL_UniformMatrix3fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix3fv(locationPacked, count, transpose, value);
@@ -1420,6 +1473,7 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix4fv(locationPacked, count, transpose, value);
@@ -1444,6 +1498,7 @@ void GL_APIENTRY GL_UseProgram(GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUseProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->useProgram(programPacked);
@@ -1467,6 +1522,7 @@ void GL_APIENTRY GL_ValidateProgram(GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateValidateProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->validateProgram(programPacked);
@@ -1488,6 +1544,7 @@ void GL_APIENTRY GL_VertexAttrib1d(GLuint index, GLdouble x)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexAttrib1d(context, index, x));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib1d(index, x);
@@ -1511,6 +1568,7 @@ void GL_APIENTRY GL_VertexAttrib1dv(GLuint index, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib1dv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib1dv(index, v);
@@ -1532,6 +1590,7 @@ void GL_APIENTRY GL_VertexAttrib1f(GLuint index, GLfloat x)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexAttrib1f(context, index, x));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib1f(index, x);
@@ -1555,6 +1614,7 @@ void GL_APIENTRY GL_VertexAttrib1fv(GLuint index, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib1fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib1fv(index, v);
@@ -1576,6 +1636,7 @@ void GL_APIENTRY GL_VertexAttrib1s(GLuint index, GLshort x)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexAttrib1s(context, index, x));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib1s(index, x);
@@ -1599,6 +1660,7 @@ void GL_APIENTRY GL_VertexAttrib1sv(GLuint index, const GLshort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib1sv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib1sv(index, v);
@@ -1622,6 +1684,7 @@ void GL_APIENTRY GL_VertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2d(context, index, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib2d(index, x, y);
@@ -1645,6 +1708,7 @@ void GL_APIENTRY GL_VertexAttrib2dv(GLuint index, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2dv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib2dv(index, v);
@@ -1668,6 +1732,7 @@ void GL_APIENTRY GL_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2f(context, index, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib2f(index, x, y);
@@ -1691,6 +1756,7 @@ void GL_APIENTRY GL_VertexAttrib2fv(GLuint index, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib2fv(index, v);
@@ -1714,6 +1780,7 @@ void GL_APIENTRY GL_VertexAttrib2s(GLuint index, GLshort x, GLshort y)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2s(context, index, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib2s(index, x, y);
@@ -1737,6 +1804,7 @@ void GL_APIENTRY GL_VertexAttrib2sv(GLuint index, const GLshort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2sv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib2sv(index, v);
@@ -1760,6 +1828,7 @@ void GL_APIENTRY GL_VertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdoubl
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3d(context, index, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib3d(index, x, y, z);
@@ -1783,6 +1852,7 @@ void GL_APIENTRY GL_VertexAttrib3dv(GLuint index, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3dv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib3dv(index, v);
@@ -1806,6 +1876,7 @@ void GL_APIENTRY GL_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3f(context, index, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib3f(index, x, y, z);
@@ -1829,6 +1900,7 @@ void GL_APIENTRY GL_VertexAttrib3fv(GLuint index, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib3fv(index, v);
@@ -1852,6 +1924,7 @@ void GL_APIENTRY GL_VertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3s(context, index, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib3s(index, x, y, z);
@@ -1875,6 +1948,7 @@ void GL_APIENTRY GL_VertexAttrib3sv(GLuint index, const GLshort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3sv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib3sv(index, v);
@@ -1898,6 +1972,7 @@ void GL_APIENTRY GL_VertexAttrib4Nbv(GLuint index, const GLbyte *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4Nbv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4Nbv(index, v);
@@ -1921,6 +1996,7 @@ void GL_APIENTRY GL_VertexAttrib4Niv(GLuint index, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4Niv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4Niv(index, v);
@@ -1944,6 +2020,7 @@ void GL_APIENTRY GL_VertexAttrib4Nsv(GLuint index, const GLshort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4Nsv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4Nsv(index, v);
@@ -1967,6 +2044,7 @@ void GL_APIENTRY GL_VertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4Nub(context, index, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4Nub(index, x, y, z, w);
@@ -1990,6 +2068,7 @@ void GL_APIENTRY GL_VertexAttrib4Nubv(GLuint index, const GLubyte *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4Nubv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4Nubv(index, v);
@@ -2013,6 +2092,7 @@ void GL_APIENTRY GL_VertexAttrib4Nuiv(GLuint index, const GLuint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4Nuiv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4Nuiv(index, v);
@@ -2036,6 +2116,7 @@ void GL_APIENTRY GL_VertexAttrib4Nusv(GLuint index, const GLushort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4Nusv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4Nusv(index, v);
@@ -2059,6 +2140,7 @@ void GL_APIENTRY GL_VertexAttrib4bv(GLuint index, const GLbyte *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4bv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4bv(index, v);
@@ -2082,6 +2164,7 @@ void GL_APIENTRY GL_VertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdoubl
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4d(context, index, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4d(index, x, y, z, w);
@@ -2105,6 +2188,7 @@ void GL_APIENTRY GL_VertexAttrib4dv(GLuint index, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4dv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4dv(index, v);
@@ -2128,6 +2212,7 @@ void GL_APIENTRY GL_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4f(context, index, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4f(index, x, y, z, w);
@@ -2151,6 +2236,7 @@ void GL_APIENTRY GL_VertexAttrib4fv(GLuint index, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4fv(index, v);
@@ -2174,6 +2260,7 @@ void GL_APIENTRY GL_VertexAttrib4iv(GLuint index, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4iv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4iv(index, v);
@@ -2197,6 +2284,7 @@ void GL_APIENTRY GL_VertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4s(context, index, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4s(index, x, y, z, w);
@@ -2220,6 +2308,7 @@ void GL_APIENTRY GL_VertexAttrib4sv(GLuint index, const GLshort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4sv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4sv(index, v);
@@ -2243,6 +2332,7 @@ void GL_APIENTRY GL_VertexAttrib4ubv(GLuint index, const GLubyte *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4ubv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4ubv(index, v);
@@ -2266,6 +2356,7 @@ void GL_APIENTRY GL_VertexAttrib4uiv(GLuint index, const GLuint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4uiv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4uiv(index, v);
@@ -2289,6 +2380,7 @@ void GL_APIENTRY GL_VertexAttrib4usv(GLuint index, const GLushort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4usv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4usv(index, v);
@@ -2322,6 +2414,7 @@ void GL_APIENTRY GL_VertexAttribPointer(GLuint index,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribPointer(context, index, size, typePacked,
                                                         normalized, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribPointer(index, size, typePacked, normalized, stride, pointer);
@@ -2353,6 +2446,7 @@ void GL_APIENTRY GL_UniformMatrix2x3fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2x3fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix2x3fv(locationPacked, count, transpose, value);
@@ -2383,6 +2477,7 @@ void GL_APIENTRY GL_UniformMatrix2x4fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2x4fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix2x4fv(locationPacked, count, transpose, value);
@@ -2413,6 +2508,7 @@ void GL_APIENTRY GL_UniformMatrix3x2fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3x2fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix3x2fv(locationPacked, count, transpose, value);
@@ -2443,6 +2539,7 @@ void GL_APIENTRY GL_UniformMatrix3x4fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3x4fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix3x4fv(locationPacked, count, transpose, value);
@@ -2473,6 +2570,7 @@ void GL_APIENTRY GL_UniformMatrix4x2fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4x2fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix4x2fv(locationPacked, count, transpose, value);
@@ -2503,6 +2601,7 @@ void GL_APIENTRY GL_UniformMatrix4x3fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4x3fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix4x3fv(locationPacked, count, transpose, value);
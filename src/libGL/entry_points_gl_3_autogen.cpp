@@ -41,6 +41,7 @@ void GL_APIENTRY GL_BeginConditionalRender(GLuint id, GLenum mode)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBeginConditionalRender(context, id, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->beginConditionalRender(id, mode);
@@ -65,6 +66,7 @@ void GL_APIENTRY GL_BeginTransformFeedback(GLenum primitiveMode)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBeginTransformFeedback(context, primitiveModePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->beginTransformFeedback(primitiveModePacked);
@@ -90,6 +92,7 @@ void GL_APIENTRY GL_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindBufferBase(context, targetPacked, index, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindBufferBase(targetPacked, index, bufferPacked);
@@ -119,6 +122,7 @@ GL_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindBufferRange(context, targetPacked, index, bufferPacked, offset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindBufferRange(targetPacked, index, bufferPacked, offset, size);
@@ -145,6 +149,7 @@ void GL_APIENTRY GL_BindFragDataLocation(GLuint program, GLuint color, const GLc
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindFragDataLocation(context, programPacked, color, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindFragDataLocation(programPacked, color, name);
@@ -169,6 +174,7 @@ void GL_APIENTRY GL_BindFramebuffer(GLenum target, GLuint framebuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindFramebuffer(context, target, framebufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindFramebuffer(target, framebufferPacked);
@@ -193,6 +199,7 @@ void GL_APIENTRY GL_BindRenderbuffer(GLenum target, GLuint renderbuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindRenderbuffer(context, target, renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindRenderbuffer(target, renderbufferPacked);
@@ -216,6 +223,7 @@ void GL_APIENTRY GL_BindVertexArray(GLuint array)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindVertexArray(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindVertexArray(arrayPacked);
@@ -253,6 +261,7 @@ void GL_APIENTRY GL_BlitFramebuffer(GLint srcX0,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlitFramebuffer(context, srcX0, srcY0, srcX1, srcY1, dstX0,
                                                     dstY0, dstX1, dstY1, mask, filter));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask,
@@ -279,6 +288,7 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatus(GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCheckFramebufferStatus(context, target));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->checkFramebufferStatus(target);
@@ -310,6 +320,7 @@ void GL_APIENTRY GL_ClampColor(GLenum target, GLenum clamp)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClampColor(context, target, clamp));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clampColor(target, clamp);
@@ -334,6 +345,7 @@ void GL_APIENTRY GL_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferfi(context, buffer, drawbuffer, depth, stencil));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearBufferfi(buffer, drawbuffer, depth, stencil);
@@ -358,6 +370,7 @@ void GL_APIENTRY GL_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferfv(context, buffer, drawbuffer, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearBufferfv(buffer, drawbuffer, value);
@@ -382,6 +395,7 @@ void GL_APIENTRY GL_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferiv(context, buffer, drawbuffer, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearBufferiv(buffer, drawbuffer, value);
@@ -406,6 +420,7 @@ void GL_APIENTRY GL_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferuiv(context, buffer, drawbuffer, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearBufferuiv(buffer, drawbuffer, value);
@@ -430,6 +445,7 @@ void GL_APIENTRY GL_ColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaski(context, index, r, g, b, a));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorMaski(index, r, g, b, a);
@@ -454,6 +470,7 @@ void GL_APIENTRY GL_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteFramebuffers(context, n, framebuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteFramebuffers(n, framebuffersPacked);
@@ -479,6 +496,7 @@ void GL_APIENTRY GL_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteRenderbuffers(context, n, renderbuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteRenderbuffers(n, renderbuffersPacked);
@@ -503,6 +521,7 @@ void GL_APIENTRY GL_DeleteVertexArrays(GLsizei n, const GLuint *arrays)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteVertexArrays(context, n, arraysPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteVertexArrays(n, arraysPacked);
@@ -525,6 +544,7 @@ void GL_APIENTRY GL_Disablei(GLenum target, GLuint index)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisablei(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disablei(target, index);
@@ -547,6 +567,7 @@ void GL_APIENTRY GL_Enablei(GLenum target, GLuint index)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnablei(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enablei(target, index);
@@ -568,6 +589,7 @@ void GL_APIENTRY GL_EndConditionalRender()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndConditionalRender(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->endConditionalRender();
@@ -589,6 +611,7 @@ void GL_APIENTRY GL_EndTransformFeedback()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndTransformFeedback(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->endTransformFeedback();
@@ -615,6 +638,7 @@ void GL_APIENTRY GL_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsiz
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFlushMappedBufferRange(context, targetPacked, offset, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->flushMappedBufferRange(targetPacked, offset, length);
@@ -647,6 +671,7 @@ void GL_APIENTRY GL_FramebufferRenderbuffer(GLenum target,
             (context->skipValidation() ||
              ValidateFramebufferRenderbuffer(context, target, attachment, renderbuffertarget,
                                              renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferRenderbuffer(target, attachment, renderbuffertarget,
@@ -682,6 +707,7 @@ void GL_APIENTRY GL_FramebufferTexture1D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferTexture1D(context, target, attachment,
                                                          textargetPacked, texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture1D(target, attachment, textargetPacked, texturePacked,
@@ -717,6 +743,7 @@ void GL_APIENTRY GL_FramebufferTexture2D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferTexture2D(context, target, attachment,
                                                          textargetPacked, texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture2D(target, attachment, textargetPacked, texturePacked,
@@ -755,6 +782,7 @@ void GL_APIENTRY GL_FramebufferTexture3D(GLenum target,
             (context->skipValidation() ||
              ValidateFramebufferTexture3D(context, target, attachment, textargetPacked,
                                           texturePacked, level, zoffset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture3D(target, attachment, textargetPacked, texturePacked, level,
@@ -788,6 +816,7 @@ void GL_APIENTRY GL_FramebufferTextureLayer(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferTextureLayer(context, target, attachment,
                                                             texturePacked, level, layer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTextureLayer(target, attachment, texturePacked, level, layer);
@@ -813,6 +842,7 @@ void GL_APIENTRY GL_GenFramebuffers(GLsizei n, GLuint *framebuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenFramebuffers(context, n, framebuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genFramebuffers(n, framebuffersPacked);
@@ -837,6 +867,7 @@ void GL_APIENTRY GL_GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGenRenderbuffers(context, n, renderbuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genRenderbuffers(n, renderbuffersPacked);
@@ -861,6 +892,7 @@ void GL_APIENTRY GL_GenVertexArrays(GLsizei n, GLuint *arrays)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenVertexArrays(context, n, arraysPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genVertexArrays(n, arraysPacked);
@@ -885,6 +917,7 @@ void GL_APIENTRY GL_GenerateMipmap(GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenerateMipmap(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->generateMipmap(targetPacked);
@@ -909,6 +942,7 @@ void GL_APIENTRY GL_GetBooleani_v(GLenum target, GLuint index, GLboolean *data)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetBooleani_v(context, target, index, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBooleani_v(target, index, data);
@@ -934,6 +968,7 @@ GLint GL_APIENTRY GL_GetFragDataLocation(GLuint program, const GLchar *name)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFragDataLocation(context, programPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getFragDataLocation(programPacked, name);
@@ -971,6 +1006,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameteriv(GLenum target,
         bool isCallValid =
             (context->skipValidation() || ValidateGetFramebufferAttachmentParameteriv(
                                               context, target, attachment, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFramebufferAttachmentParameteriv(target, attachment, pname, params);
@@ -996,6 +1032,7 @@ void GL_APIENTRY GL_GetIntegeri_v(GLenum target, GLuint index, GLint *data)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetIntegeri_v(context, target, index, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getIntegeri_v(target, index, data);
@@ -1021,6 +1058,7 @@ void GL_APIENTRY GL_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetRenderbufferParameteriv(context, target, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getRenderbufferParameteriv(target, pname, params);
@@ -1044,6 +1082,7 @@ const GLubyte *GL_APIENTRY GL_GetStringi(GLenum name, GLuint index)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetStringi(context, name, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getStringi(name, index);
@@ -1076,6 +1115,7 @@ void GL_APIENTRY GL_GetTexParameterIiv(GLenum target, GLenum pname, GLint *param
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIiv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIiv(targetPacked, pname, params);
@@ -1102,6 +1142,7 @@ void GL_APIENTRY GL_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint *par
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIuiv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIuiv(targetPacked, pname, params);
@@ -1136,6 +1177,7 @@ void GL_APIENTRY GL_GetTransformFeedbackVarying(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTransformFeedbackVarying(context, programPacked, index,
                                                                 bufSize, length, size, type, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTransformFeedbackVarying(programPacked, index, bufSize, length, size, type,
@@ -1164,6 +1206,7 @@ void GL_APIENTRY GL_GetUniformuiv(GLuint program, GLint location, GLuint *params
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformuiv(context, programPacked, locationPacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformuiv(programPacked, locationPacked, params);
@@ -1188,6 +1231,7 @@ void GL_APIENTRY GL_GetVertexAttribIiv(GLuint index, GLenum pname, GLint *params
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetVertexAttribIiv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribIiv(index, pname, params);
@@ -1212,6 +1256,7 @@ void GL_APIENTRY GL_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *para
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetVertexAttribIuiv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribIuiv(index, pname, params);
@@ -1236,6 +1281,7 @@ GLboolean GL_APIENTRY GL_IsEnabledi(GLenum target, GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsEnabledi(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isEnabledi(target, index);
@@ -1266,6 +1312,7 @@ GLboolean GL_APIENTRY GL_IsFramebuffer(GLuint framebuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsFramebuffer(context, framebufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isFramebuffer(framebufferPacked);
@@ -1296,6 +1343,7 @@ GLboolean GL_APIENTRY GL_IsRenderbuffer(GLuint renderbuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsRenderbuffer(context, renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isRenderbuffer(renderbufferPacked);
@@ -1326,6 +1374,7 @@ GLboolean GL_APIENTRY GL_IsVertexArray(GLuint array)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsVertexArray(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isVertexArray(arrayPacked);
@@ -1363,6 +1412,7 @@ void *GL_APIENTRY GL_MapBufferRange(GLenum target,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMapBufferRange(context, targetPacked, offset, length, access));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->mapBufferRange(targetPacked, offset, length, access);
@@ -1399,6 +1449,7 @@ void GL_APIENTRY GL_RenderbufferStorage(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRenderbufferStorage(context, target, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->renderbufferStorage(target, internalformat, width, height);
@@ -1430,6 +1481,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisample(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisample(context, target, samples,
                                                                    internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->renderbufferStorageMultisample(target, samples, internalformat, width, height);
@@ -1457,6 +1509,7 @@ void GL_APIENTRY GL_TexParameterIiv(GLenum target, GLenum pname, const GLint *pa
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIiv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIiv(targetPacked, pname, params);
@@ -1483,6 +1536,7 @@ void GL_APIENTRY GL_TexParameterIuiv(GLenum target, GLenum pname, const GLuint *
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIuiv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIuiv(targetPacked, pname, params);
@@ -1513,6 +1567,7 @@ void GL_APIENTRY GL_TransformFeedbackVaryings(GLuint program,
         bool isCallValid =
             (context->skipValidation() || ValidateTransformFeedbackVaryings(
                                               context, programPacked, count, varyings, bufferMode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->transformFeedbackVaryings(programPacked, count, varyings, bufferMode);
@@ -1538,6 +1593,7 @@ void GL_APIENTRY GL_Uniform1ui(GLint location, GLuint v0)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform1ui(context, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1ui(locationPacked, v0);
@@ -1563,6 +1619,7 @@ void GL_APIENTRY GL_Uniform1uiv(GLint location, GLsizei count, const GLuint *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform1uiv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1uiv(locationPacked, count, value);
@@ -1587,6 +1644,7 @@ void GL_APIENTRY GL_Uniform2ui(GLint location, GLuint v0, GLuint v1)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2ui(context, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2ui(locationPacked, v0, v1);
@@ -1612,6 +1670,7 @@ void GL_APIENTRY GL_Uniform2uiv(GLint location, GLsizei count, const GLuint *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform2uiv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2uiv(locationPacked, count, value);
@@ -1636,6 +1695,7 @@ void GL_APIENTRY GL_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3ui(context, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3ui(locationPacked, v0, v1, v2);
@@ -1661,6 +1721,7 @@ void GL_APIENTRY GL_Uniform3uiv(GLint location, GLsizei count, const GLuint *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform3uiv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3uiv(locationPacked, count, value);
@@ -1685,6 +1746,7 @@ void GL_APIENTRY GL_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4ui(context, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4ui(locationPacked, v0, v1, v2, v3);
@@ -1710,6 +1772,7 @@ void GL_APIENTRY GL_Uniform4uiv(GLint location, GLsizei count, const GLuint *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4uiv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4uiv(locationPacked, count, value);
@@ -1732,6 +1795,7 @@ void GL_APIENTRY GL_VertexAttribI1i(GLuint index, GLint x)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI1i(context, index, x));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI1i(index, x);
@@ -1755,6 +1819,7 @@ void GL_APIENTRY GL_VertexAttribI1iv(GLuint index, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI1iv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI1iv(index, v);
@@ -1777,6 +1842,7 @@ void GL_APIENTRY GL_VertexAttribI1ui(GLuint index, GLuint x)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI1ui(context, index, x));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI1ui(index, x);
@@ -1800,6 +1866,7 @@ void GL_APIENTRY GL_VertexAttribI1uiv(GLuint index, const GLuint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI1uiv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI1uiv(index, v);
@@ -1823,6 +1890,7 @@ void GL_APIENTRY GL_VertexAttribI2i(GLuint index, GLint x, GLint y)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI2i(context, index, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI2i(index, x, y);
@@ -1846,6 +1914,7 @@ void GL_APIENTRY GL_VertexAttribI2iv(GLuint index, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI2iv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI2iv(index, v);
@@ -1869,6 +1938,7 @@ void GL_APIENTRY GL_VertexAttribI2ui(GLuint index, GLuint x, GLuint y)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI2ui(context, index, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI2ui(index, x, y);
@@ -1892,6 +1962,7 @@ void GL_APIENTRY GL_VertexAttribI2uiv(GLuint index, const GLuint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI2uiv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI2uiv(index, v);
@@ -1915,6 +1986,7 @@ void GL_APIENTRY GL_VertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI3i(context, index, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI3i(index, x, y, z);
@@ -1938,6 +2010,7 @@ void GL_APIENTRY GL_VertexAttribI3iv(GLuint index, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI3iv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI3iv(index, v);
@@ -1961,6 +2034,7 @@ void GL_APIENTRY GL_VertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI3ui(context, index, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI3ui(index, x, y, z);
@@ -1984,6 +2058,7 @@ void GL_APIENTRY GL_VertexAttribI3uiv(GLuint index, const GLuint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI3uiv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI3uiv(index, v);
@@ -2007,6 +2082,7 @@ void GL_APIENTRY GL_VertexAttribI4bv(GLuint index, const GLbyte *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4bv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4bv(index, v);
@@ -2030,6 +2106,7 @@ void GL_APIENTRY GL_VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLi
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4i(context, index, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4i(index, x, y, z, w);
@@ -2053,6 +2130,7 @@ void GL_APIENTRY GL_VertexAttribI4iv(GLuint index, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4iv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4iv(index, v);
@@ -2076,6 +2154,7 @@ void GL_APIENTRY GL_VertexAttribI4sv(GLuint index, const GLshort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4sv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4sv(index, v);
@@ -2099,6 +2178,7 @@ void GL_APIENTRY GL_VertexAttribI4ubv(GLuint index, const GLubyte *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4ubv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4ubv(index, v);
@@ -2122,6 +2202,7 @@ void GL_APIENTRY GL_VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4ui(context, index, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4ui(index, x, y, z, w);
@@ -2145,6 +2226,7 @@ void GL_APIENTRY GL_VertexAttribI4uiv(GLuint index, const GLuint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4uiv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4uiv(index, v);
@@ -2168,6 +2250,7 @@ void GL_APIENTRY GL_VertexAttribI4usv(GLuint index, const GLushort *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4usv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4usv(index, v);
@@ -2197,6 +2280,7 @@ GL_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, c
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribIPointer(context, index, size, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribIPointer(index, size, typePacked, stride, pointer);
@@ -2234,6 +2318,7 @@ void GL_APIENTRY GL_CopyBufferSubData(GLenum readTarget,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyBufferSubData(context, readTargetPacked, writeTargetPacked,
                                                       readOffset, writeOffset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyBufferSubData(readTargetPacked, writeTargetPacked, readOffset, writeOffset,
@@ -2260,11 +2345,17 @@ void GL_APIENTRY GL_DrawArraysInstanced(GLenum mode,
 
     if (context)
     {
-        PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
+        PrimitiveMode modePacked = PackParam<PrimitiveMode>(mode);
+        if (context->isRecordingDeferredCommands() &&
+            context->recordDrawArraysInstanced(modePacked, first, count, instancecount))
+        {
+            return;
+        }
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawArraysInstanced(context, modePacked, first, count, instancecount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArraysInstanced(modePacked, first, count, instancecount);
@@ -2293,12 +2384,19 @@ void GL_APIENTRY GL_DrawElementsInstanced(GLenum mode,
 
     if (context)
     {
-        PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
-        DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
+        PrimitiveMode modePacked    = PackParam<PrimitiveMode>(mode);
+        DrawElementsType typePacked = PackParam<DrawElementsType>(type);
+        if (context->isRecordingDeferredCommands() &&
+            context->recordDrawElementsInstanced(modePacked, count, typePacked, indices,
+                                                 instancecount))
+        {
+            return;
+        }
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsInstanced(context, modePacked, count, typePacked,
                                                           indices, instancecount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstanced(modePacked, count, typePacked, indices, instancecount);
@@ -2335,6 +2433,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockName(GLuint program,
             (context->skipValidation() ||
              ValidateGetActiveUniformBlockName(context, programPacked, uniformBlockIndexPacked,
                                                bufSize, length, uniformBlockName));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniformBlockName(programPacked, uniformBlockIndexPacked, bufSize,
@@ -2369,6 +2468,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockiv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveUniformBlockiv(
                                 context, programPacked, uniformBlockIndexPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniformBlockiv(programPacked, uniformBlockIndexPacked, pname, params);
@@ -2401,6 +2501,7 @@ void GL_APIENTRY GL_GetActiveUniformName(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveUniformName(context, programPacked, uniformIndex,
                                                          bufSize, length, uniformName));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniformName(programPacked, uniformIndex, bufSize, length,
@@ -2435,6 +2536,7 @@ void GL_APIENTRY GL_GetActiveUniformsiv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveUniformsiv(context, programPacked, uniformCount,
                                                         uniformIndices, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniformsiv(programPacked, uniformCount, uniformIndices, pname,
@@ -2463,6 +2565,7 @@ GLuint GL_APIENTRY GL_GetUniformBlockIndex(GLuint program, const GLchar *uniform
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformBlockIndex(context, programPacked, uniformBlockName));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getUniformBlockIndex(programPacked, uniformBlockName);
@@ -2501,6 +2604,7 @@ void GL_APIENTRY GL_GetUniformIndices(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformIndices(context, programPacked, uniformCount,
                                                       uniformNames, uniformIndices));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformIndices(programPacked, uniformCount, uniformNames, uniformIndices);
@@ -2524,6 +2628,7 @@ void GL_APIENTRY GL_PrimitiveRestartIndex(GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePrimitiveRestartIndex(context, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->primitiveRestartIndex(index);
@@ -2550,6 +2655,7 @@ void GL_APIENTRY GL_TexBuffer(GLenum target, GLenum internalformat, GLuint buffe
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexBuffer(context, targetPacked, internalformat, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBuffer(targetPacked, internalformat, bufferPacked);
@@ -2580,6 +2686,7 @@ void GL_APIENTRY GL_UniformBlockBinding(GLuint program,
             (context->skipValidation() ||
              ValidateUniformBlockBinding(context, programPacked, uniformBlockIndexPacked,
                                          uniformBlockBinding));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformBlockBinding(programPacked, uniformBlockIndexPacked,
@@ -2609,6 +2716,7 @@ GLenum GL_APIENTRY GL_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 tim
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClientWaitSync(context, sync, flags, timeout));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->clientWaitSync(sync, flags, timeout);
@@ -2637,6 +2745,7 @@ void GL_APIENTRY GL_DeleteSync(GLsync sync)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDeleteSync(context, sync));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteSync(sync);
@@ -2670,6 +2779,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertex(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsBaseVertex(context, modePacked, count, typePacked,
                                                            indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsBaseVertex(modePacked, count, typePacked, indices, basevertex);
@@ -2706,6 +2816,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertex(GLenum mode,
         bool isCallValid = (context->skipValidation() || ValidateDrawElementsInstancedBaseVertex(
                                                              context, modePacked, count, typePacked,
                                                              indices, instancecount, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstancedBaseVertex(modePacked, count, typePacked, indices,
@@ -2743,6 +2854,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertex(GLenum mode,
         bool isCallValid = (context->skipValidation() || ValidateDrawRangeElementsBaseVertex(
                                                              context, modePacked, start, end, count,
                                                              typePacked, indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawRangeElementsBaseVertex(modePacked, start, end, count, typePacked, indices,
@@ -2770,6 +2882,7 @@ GLsync GL_APIENTRY GL_FenceSync(GLenum condition, GLbitfield flags)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFenceSync(context, condition, flags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->fenceSync(condition, flags);
@@ -2806,6 +2919,7 @@ void GL_APIENTRY GL_FramebufferTexture(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateFramebufferTexture(context, target, attachment, texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture(target, attachment, texturePacked, level);
@@ -2833,6 +2947,7 @@ void GL_APIENTRY GL_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferParameteri64v(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferParameteri64v(targetPacked, pname, params);
@@ -2857,6 +2972,7 @@ void GL_APIENTRY GL_GetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetInteger64i_v(context, target, index, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInteger64i_v(target, index, data);
@@ -2880,6 +2996,7 @@ void GL_APIENTRY GL_GetInteger64v(GLenum pname, GLint64 *data)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetInteger64v(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInteger64v(pname, data);
@@ -2904,6 +3021,7 @@ void GL_APIENTRY GL_GetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetMultisamplefv(context, pname, index, val));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMultisamplefv(pname, index, val);
@@ -2931,6 +3049,7 @@ GL_GetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSynciv(context, sync, pname, bufSize, length, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSynciv(sync, pname, bufSize, length, values);
@@ -2952,6 +3071,7 @@ GLboolean GL_APIENTRY GL_IsSync(GLsync sync)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsSync(context, sync));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isSync(sync);
@@ -2993,6 +3113,7 @@ void GL_APIENTRY GL_MultiDrawElementsBaseVertex(GLenum mode,
         bool isCallValid = (context->skipValidation() || ValidateMultiDrawElementsBaseVertex(
                                                              context, modePacked, count, typePacked,
                                                              indices, drawcount, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElementsBaseVertex(modePacked, count, typePacked, indices, drawcount,
@@ -3019,6 +3140,7 @@ void GL_APIENTRY GL_ProvokingVertex(GLenum mode)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateProvokingVertex(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->provokingVertex(modePacked);
@@ -3042,6 +3164,7 @@ void GL_APIENTRY GL_SampleMaski(GLuint maskNumber, GLbitfield mask)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleMaski(context, maskNumber, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->sampleMaski(maskNumber, mask);
@@ -3075,6 +3198,7 @@ void GL_APIENTRY GL_TexImage2DMultisample(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexImage2DMultisample(context, target, samples, internalformat,
                                                           width, height, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage2DMultisample(target, samples, internalformat, width, height,
@@ -3112,6 +3236,7 @@ void GL_APIENTRY GL_TexImage3DMultisample(GLenum target,
             (context->skipValidation() ||
              ValidateTexImage3DMultisample(context, target, samples, internalformat, width, height,
                                            depth, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage3DMultisample(target, samples, internalformat, width, height, depth,
@@ -3139,6 +3264,7 @@ void GL_APIENTRY GL_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateWaitSync(context, sync, flags, timeout));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->waitSync(sync, flags, timeout);
@@ -3169,6 +3295,7 @@ void GL_APIENTRY GL_BindFragDataLocationIndexed(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindFragDataLocationIndexed(context, programPacked, colorNumber, index, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindFragDataLocationIndexed(programPacked, colorNumber, index, name);
@@ -3194,6 +3321,7 @@ void GL_APIENTRY GL_BindSampler(GLuint unit, GLuint sampler)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindSampler(context, unit, samplerPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindSampler(unit, samplerPacked);
@@ -3216,6 +3344,7 @@ void GL_APIENTRY GL_ColorP3ui(GLenum type, GLuint color)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColorP3ui(context, type, color));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorP3ui(type, color);
@@ -3238,6 +3367,7 @@ void GL_APIENTRY GL_ColorP3uiv(GLenum type, const GLuint *color)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColorP3uiv(context, type, color));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorP3uiv(type, color);
@@ -3260,6 +3390,7 @@ void GL_APIENTRY GL_ColorP4ui(GLenum type, GLuint color)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColorP4ui(context, type, color));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorP4ui(type, color);
@@ -3282,6 +3413,7 @@ void GL_APIENTRY GL_ColorP4uiv(GLenum type, const GLuint *color)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColorP4uiv(context, type, color));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorP4uiv(type, color);
@@ -3306,6 +3438,7 @@ void GL_APIENTRY GL_DeleteSamplers(GLsizei count, const GLuint *samplers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteSamplers(context, count, samplersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteSamplers(count, samplersPacked);
@@ -3330,6 +3463,7 @@ void GL_APIENTRY GL_GenSamplers(GLsizei count, GLuint *samplers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenSamplers(context, count, samplersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genSamplers(count, samplersPacked);
@@ -3355,6 +3489,7 @@ GLint GL_APIENTRY GL_GetFragDataIndex(GLuint program, const GLchar *name)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetFragDataIndex(context, programPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getFragDataIndex(programPacked, name);
@@ -3386,6 +3521,7 @@ void GL_APIENTRY GL_GetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjecti64v(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjecti64v(idPacked, pname, params);
@@ -3409,6 +3545,7 @@ void GL_APIENTRY GL_GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *param
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjectui64v(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectui64v(idPacked, pname, params);
@@ -3434,6 +3571,7 @@ void GL_APIENTRY GL_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterIiv(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIiv(samplerPacked, pname, params);
@@ -3459,6 +3597,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterIuiv(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIuiv(samplerPacked, pname, params);
@@ -3484,6 +3623,7 @@ void GL_APIENTRY GL_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterfv(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterfv(samplerPacked, pname, params);
@@ -3509,6 +3649,7 @@ void GL_APIENTRY GL_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *p
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameteriv(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameteriv(samplerPacked, pname, params);
@@ -3532,6 +3673,7 @@ GLboolean GL_APIENTRY GL_IsSampler(GLuint sampler)
         SamplerID samplerPacked                               = PackParam<SamplerID>(sampler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsSampler(context, samplerPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isSampler(samplerPacked);
@@ -3562,6 +3704,7 @@ void GL_APIENTRY GL_MultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP1ui(context, texture, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoordP1ui(texture, type, coords);
@@ -3587,6 +3730,7 @@ void GL_APIENTRY GL_MultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP1uiv(context, texture, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoordP1uiv(texture, type, coords);
@@ -3611,6 +3755,7 @@ void GL_APIENTRY GL_MultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP2ui(context, texture, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoordP2ui(texture, type, coords);
@@ -3636,6 +3781,7 @@ void GL_APIENTRY GL_MultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP2uiv(context, texture, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoordP2uiv(texture, type, coords);
@@ -3660,6 +3806,7 @@ void GL_APIENTRY GL_MultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP3ui(context, texture, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoordP3ui(texture, type, coords);
@@ -3685,6 +3832,7 @@ void GL_APIENTRY GL_MultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP3uiv(context, texture, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoordP3uiv(texture, type, coords);
@@ -3709,6 +3857,7 @@ void GL_APIENTRY GL_MultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP4ui(context, texture, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoordP4ui(texture, type, coords);
@@ -3734,6 +3883,7 @@ void GL_APIENTRY GL_MultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP4uiv(context, texture, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoordP4uiv(texture, type, coords);
@@ -3756,6 +3906,7 @@ void GL_APIENTRY GL_NormalP3ui(GLenum type, GLuint coords)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormalP3ui(context, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normalP3ui(type, coords);
@@ -3779,6 +3930,7 @@ void GL_APIENTRY GL_NormalP3uiv(GLenum type, const GLuint *coords)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateNormalP3uiv(context, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normalP3uiv(type, coords);
@@ -3804,6 +3956,7 @@ void GL_APIENTRY GL_QueryCounter(GLuint id, GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateQueryCounter(context, idPacked, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->queryCounter(idPacked, targetPacked);
@@ -3829,6 +3982,7 @@ void GL_APIENTRY GL_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIiv(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIiv(samplerPacked, pname, param);
@@ -3854,6 +4008,7 @@ void GL_APIENTRY GL_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIuiv(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIuiv(samplerPacked, pname, param);
@@ -3878,6 +4033,7 @@ void GL_APIENTRY GL_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat para
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterf(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterf(samplerPacked, pname, param);
@@ -3903,6 +4059,7 @@ void GL_APIENTRY GL_SamplerParameterfv(GLuint sampler, GLenum pname, const GLflo
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterfv(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterfv(samplerPacked, pname, param);
@@ -3927,6 +4084,7 @@ void GL_APIENTRY GL_SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameteri(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameteri(samplerPacked, pname, param);
@@ -3952,6 +4110,7 @@ void GL_APIENTRY GL_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameteriv(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameteriv(samplerPacked, pname, param);
@@ -3975,6 +4134,7 @@ void GL_APIENTRY GL_SecondaryColorP3ui(GLenum type, GLuint color)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColorP3ui(context, type, color));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColorP3ui(type, color);
@@ -3998,6 +4158,7 @@ void GL_APIENTRY GL_SecondaryColorP3uiv(GLenum type, const GLuint *color)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColorP3uiv(context, type, color));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->secondaryColorP3uiv(type, color);
@@ -4021,6 +4182,7 @@ void GL_APIENTRY GL_TexCoordP1ui(GLenum type, GLuint coords)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP1ui(context, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoordP1ui(type, coords);
@@ -4044,6 +4206,7 @@ void GL_APIENTRY GL_TexCoordP1uiv(GLenum type, const GLuint *coords)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP1uiv(context, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoordP1uiv(type, coords);
@@ -4067,6 +4230,7 @@ void GL_APIENTRY GL_TexCoordP2ui(GLenum type, GLuint coords)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP2ui(context, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoordP2ui(type, coords);
@@ -4090,6 +4254,7 @@ void GL_APIENTRY GL_TexCoordP2uiv(GLenum type, const GLuint *coords)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP2uiv(context, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoordP2uiv(type, coords);
@@ -4113,6 +4278,7 @@ void GL_APIENTRY GL_TexCoordP3ui(GLenum type, GLuint coords)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP3ui(context, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoordP3ui(type, coords);
@@ -4136,6 +4302,7 @@ void GL_APIENTRY GL_TexCoordP3uiv(GLenum type, const GLuint *coords)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP3uiv(context, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoordP3uiv(type, coords);
@@ -4159,6 +4326,7 @@ void GL_APIENTRY GL_TexCoordP4ui(GLenum type, GLuint coords)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP4ui(context, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoordP4ui(type, coords);
@@ -4182,6 +4350,7 @@ void GL_APIENTRY GL_TexCoordP4uiv(GLenum type, const GLuint *coords)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP4uiv(context, type, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoordP4uiv(type, coords);
@@ -4205,6 +4374,7 @@ void GL_APIENTRY GL_VertexAttribDivisor(GLuint index, GLuint divisor)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribDivisor(context, index, divisor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribDivisor(index, divisor);
@@ -4230,6 +4400,7 @@ void GL_APIENTRY GL_VertexAttribP1ui(GLuint index, GLenum type, GLboolean normal
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP1ui(context, index, type, normalized, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribP1ui(index, type, normalized, value);
@@ -4258,6 +4429,7 @@ void GL_APIENTRY GL_VertexAttribP1uiv(GLuint index,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP1uiv(context, index, type, normalized, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribP1uiv(index, type, normalized, value);
@@ -4283,6 +4455,7 @@ void GL_APIENTRY GL_VertexAttribP2ui(GLuint index, GLenum type, GLboolean normal
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP2ui(context, index, type, normalized, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribP2ui(index, type, normalized, value);
@@ -4311,6 +4484,7 @@ void GL_APIENTRY GL_VertexAttribP2uiv(GLuint index,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP2uiv(context, index, type, normalized, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribP2uiv(index, type, normalized, value);
@@ -4336,6 +4510,7 @@ void GL_APIENTRY GL_VertexAttribP3ui(GLuint index, GLenum type, GLboolean normal
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP3ui(context, index, type, normalized, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribP3ui(index, type, normalized, value);
@@ -4364,6 +4539,7 @@ void GL_APIENTRY GL_VertexAttribP3uiv(GLuint index,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP3uiv(context, index, type, normalized, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribP3uiv(index, type, normalized, value);
@@ -4389,6 +4565,7 @@ void GL_APIENTRY GL_VertexAttribP4ui(GLuint index, GLenum type, GLboolean normal
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP4ui(context, index, type, normalized, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribP4ui(index, type, normalized, value);
@@ -4417,6 +4594,7 @@ void GL_APIENTRY GL_VertexAttribP4uiv(GLuint index,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP4uiv(context, index, type, normalized, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribP4uiv(index, type, normalized, value);
@@ -4439,6 +4617,7 @@ void GL_APIENTRY GL_VertexP2ui(GLenum type, GLuint value)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexP2ui(context, type, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexP2ui(type, value);
@@ -4461,6 +4640,7 @@ void GL_APIENTRY GL_VertexP2uiv(GLenum type, const GLuint *value)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexP2uiv(context, type, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexP2uiv(type, value);
@@ -4483,6 +4663,7 @@ void GL_APIENTRY GL_VertexP3ui(GLenum type, GLuint value)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexP3ui(context, type, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexP3ui(type, value);
@@ -4505,6 +4686,7 @@ void GL_APIENTRY GL_VertexP3uiv(GLenum type, const GLuint *value)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexP3uiv(context, type, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexP3uiv(type, value);
@@ -4527,6 +4709,7 @@ void GL_APIENTRY GL_VertexP4ui(GLenum type, GLuint value)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexP4ui(context, type, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexP4ui(type, value);
@@ -4549,6 +4732,7 @@ void GL_APIENTRY GL_VertexP4uiv(GLenum type, const GLuint *value)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexP4uiv(context, type, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexP4uiv(type, value);
@@ -42,6 +42,7 @@ void GL_APIENTRY GL_BeginQueryIndexed(GLenum target, GLuint index, GLuint id)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBeginQueryIndexed(context, target, index, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->beginQueryIndexed(target, index, idPacked);
@@ -66,6 +67,7 @@ void GL_APIENTRY GL_BindTransformFeedback(GLenum target, GLuint id)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindTransformFeedback(context, target, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindTransformFeedback(target, idPacked);
@@ -90,6 +92,7 @@ void GL_APIENTRY GL_BlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum mo
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparatei(context, buf, modeRGB, modeAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationSeparatei(buf, modeRGB, modeAlpha);
@@ -113,6 +116,7 @@ void GL_APIENTRY GL_BlendEquationi(GLuint buf, GLenum mode)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationi(context, buf, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationi(buf, mode);
@@ -142,6 +146,7 @@ GL_BlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendFuncSeparatei(context, buf, srcRGB, dstRGB, srcAlpha, dstAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
@@ -167,6 +172,7 @@ void GL_APIENTRY GL_BlendFunci(GLuint buf, GLenum src, GLenum dst)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunci(context, buf, src, dst));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFunci(buf, src, dst);
@@ -191,6 +197,7 @@ void GL_APIENTRY GL_DeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteTransformFeedbacks(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteTransformFeedbacks(n, idsPacked);
@@ -215,6 +222,7 @@ void GL_APIENTRY GL_DrawArraysIndirect(GLenum mode, const void *indirect)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawArraysIndirect(context, modePacked, indirect));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArraysIndirect(modePacked, indirect);
@@ -243,6 +251,7 @@ void GL_APIENTRY GL_DrawElementsIndirect(GLenum mode, GLenum type, const void *i
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawElementsIndirect(context, modePacked, typePacked, indirect));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsIndirect(modePacked, typePacked, indirect);
@@ -267,6 +276,7 @@ void GL_APIENTRY GL_DrawTransformFeedback(GLenum mode, GLuint id)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTransformFeedback(context, mode, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTransformFeedback(mode, idPacked);
@@ -291,6 +301,7 @@ void GL_APIENTRY GL_DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint s
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawTransformFeedbackStream(context, mode, idPacked, stream));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTransformFeedbackStream(mode, idPacked, stream);
@@ -314,6 +325,7 @@ void GL_APIENTRY GL_EndQueryIndexed(GLenum target, GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEndQueryIndexed(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->endQueryIndexed(target, index);
@@ -338,6 +350,7 @@ void GL_APIENTRY GL_GenTransformFeedbacks(GLsizei n, GLuint *ids)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenTransformFeedbacks(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genTransformFeedbacks(n, idsPacked);
@@ -371,6 +384,7 @@ void GL_APIENTRY GL_GetActiveSubroutineName(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveSubroutineName(context, programPacked, shadertype,
                                                             index, bufsize, length, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveSubroutineName(programPacked, shadertype, index, bufsize, length,
@@ -406,6 +420,7 @@ void GL_APIENTRY GL_GetActiveSubroutineUniformName(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveSubroutineUniformName(
                                 context, programPacked, shadertype, index, bufsize, length, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveSubroutineUniformName(programPacked, shadertype, index, bufsize,
@@ -440,6 +455,7 @@ void GL_APIENTRY GL_GetActiveSubroutineUniformiv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveSubroutineUniformiv(context, programPacked, shadertype,
                                                                  index, pname, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveSubroutineUniformiv(programPacked, shadertype, index, pname, values);
@@ -471,6 +487,7 @@ void GL_APIENTRY GL_GetProgramStageiv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramStageiv(context, programPacked, shadertype, pname, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramStageiv(programPacked, shadertype, pname, values);
@@ -497,6 +514,7 @@ void GL_APIENTRY GL_GetQueryIndexediv(GLenum target, GLuint index, GLenum pname,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryIndexediv(context, target, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryIndexediv(target, index, pname, params);
@@ -523,6 +541,7 @@ GLuint GL_APIENTRY GL_GetSubroutineIndex(GLuint program, GLenum shadertype, cons
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSubroutineIndex(context, programPacked, shadertype, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getSubroutineIndex(programPacked, shadertype, name);
@@ -559,6 +578,7 @@ GLint GL_APIENTRY GL_GetSubroutineUniformLocation(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSubroutineUniformLocation(context, programPacked, shadertype, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getSubroutineUniformLocation(programPacked, shadertype, name);
@@ -592,6 +612,7 @@ void GL_APIENTRY GL_GetUniformSubroutineuiv(GLenum shadertype, GLint location, G
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformSubroutineuiv(context, shadertype, location, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformSubroutineuiv(shadertype, location, params);
@@ -618,6 +639,7 @@ void GL_APIENTRY GL_GetUniformdv(GLuint program, GLint location, GLdouble *param
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformdv(context, programPacked, locationPacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformdv(programPacked, locationPacked, params);
@@ -642,6 +664,7 @@ GLboolean GL_APIENTRY GL_IsTransformFeedback(GLuint id)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsTransformFeedback(context, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isTransformFeedback(idPacked);
@@ -670,6 +693,7 @@ void GL_APIENTRY GL_MinSampleShading(GLfloat value)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMinSampleShading(context, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->minSampleShading(value);
@@ -693,6 +717,7 @@ void GL_APIENTRY GL_PatchParameterfv(GLenum pname, const GLfloat *values)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePatchParameterfv(context, pname, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->patchParameterfv(pname, values);
@@ -716,6 +741,7 @@ void GL_APIENTRY GL_PatchParameteri(GLenum pname, GLint value)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePatchParameteri(context, pname, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->patchParameteri(pname, value);
@@ -737,6 +763,7 @@ void GL_APIENTRY GL_PauseTransformFeedback()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePauseTransformFeedback(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pauseTransformFeedback();
@@ -758,6 +785,7 @@ void GL_APIENTRY GL_ResumeTransformFeedback()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateResumeTransformFeedback(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->resumeTransformFeedback();
@@ -781,6 +809,7 @@ void GL_APIENTRY GL_Uniform1d(GLint location, GLdouble x)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform1d(context, locationPacked, x));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1d(locationPacked, x);
@@ -806,6 +835,7 @@ void GL_APIENTRY GL_Uniform1dv(GLint location, GLsizei count, const GLdouble *va
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform1dv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1dv(locationPacked, count, value);
@@ -830,6 +860,7 @@ void GL_APIENTRY GL_Uniform2d(GLint location, GLdouble x, GLdouble y)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2d(context, locationPacked, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2d(locationPacked, x, y);
@@ -855,6 +886,7 @@ void GL_APIENTRY GL_Uniform2dv(GLint location, GLsizei count, const GLdouble *va
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform2dv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2dv(locationPacked, count, value);
@@ -879,6 +911,7 @@ void GL_APIENTRY GL_Uniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3d(context, locationPacked, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3d(locationPacked, x, y, z);
@@ -904,6 +937,7 @@ void GL_APIENTRY GL_Uniform3dv(GLint location, GLsizei count, const GLdouble *va
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform3dv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3dv(locationPacked, count, value);
@@ -928,6 +962,7 @@ void GL_APIENTRY GL_Uniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform4d(context, locationPacked, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4d(locationPacked, x, y, z, w);
@@ -953,6 +988,7 @@ void GL_APIENTRY GL_Uniform4dv(GLint location, GLsizei count, const GLdouble *va
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4dv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4dv(locationPacked, count, value);
@@ -982,6 +1018,7 @@ void GL_APIENTRY GL_UniformMatrix2dv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2dv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix2dv(locationPacked, count, transpose, value);
@@ -1012,6 +1049,7 @@ void GL_APIENTRY GL_UniformMatrix2x3dv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2x3dv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix2x3dv(locationPacked, count, transpose, value);
@@ -1042,6 +1080,7 @@ void GL_APIENTRY GL_UniformMatrix2x4dv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2x4dv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix2x4dv(locationPacked, count, transpose, value);
@@ -1072,6 +1111,7 @@ void GL_APIENTRY GL_UniformMatrix3dv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3dv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix3dv(locationPacked, count, transpose, value);
@@ -1102,6 +1142,7 @@ void GL_APIENTRY GL_UniformMatrix3x2dv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3x2dv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix3x2dv(locationPacked, count, transpose, value);
@@ -1132,6 +1173,7 @@ void GL_APIENTRY GL_UniformMatrix3x4dv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3x4dv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix3x4dv(locationPacked, count, transpose, value);
@@ -1162,6 +1204,7 @@ void GL_APIENTRY GL_UniformMatrix4dv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4dv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix4dv(locationPacked, count, transpose, value);
@@ -1192,6 +1235,7 @@ void GL_APIENTRY GL_UniformMatrix4x2dv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4x2dv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix4x2dv(locationPacked, count, transpose, value);
@@ -1222,6 +1266,7 @@ void GL_APIENTRY GL_UniformMatrix4x3dv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4x3dv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix4x3dv(locationPacked, count, transpose, value);
@@ -1247,6 +1292,7 @@ void GL_APIENTRY GL_UniformSubroutinesuiv(GLenum shadertype, GLsizei count, cons
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniformSubroutinesuiv(context, shadertype, count, indices));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformSubroutinesuiv(shadertype, count, indices);
@@ -1273,6 +1319,7 @@ void GL_APIENTRY GL_ActiveShaderProgram(GLuint pipeline, GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateActiveShaderProgram(context, pipelinePacked, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->activeShaderProgram(pipelinePacked, programPacked);
@@ -1296,6 +1343,7 @@ void GL_APIENTRY GL_BindProgramPipeline(GLuint pipeline)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindProgramPipeline(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindProgramPipeline(pipelinePacked);
@@ -1317,6 +1365,7 @@ void GL_APIENTRY GL_ClearDepthf(GLfloat d)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepthf(context, d));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearDepthf(d);
@@ -1343,6 +1392,7 @@ GLuint GL_APIENTRY GL_CreateShaderProgramv(GLenum type, GLsizei count, const GLc
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCreateShaderProgramv(context, typePacked, count, strings));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->createShaderProgramv(typePacked, count, strings);
@@ -1375,6 +1425,7 @@ void GL_APIENTRY GL_DeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteProgramPipelines(context, n, pipelinesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteProgramPipelines(n, pipelinesPacked);
@@ -1399,6 +1450,7 @@ void GL_APIENTRY GL_DepthRangeArrayv(GLuint first, GLsizei count, const GLdouble
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDepthRangeArrayv(context, first, count, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthRangeArrayv(first, count, v);
@@ -1422,6 +1474,7 @@ void GL_APIENTRY GL_DepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDepthRangeIndexed(context, index, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthRangeIndexed(index, n, f);
@@ -1443,6 +1496,7 @@ void GL_APIENTRY GL_DepthRangef(GLfloat n, GLfloat f)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRangef(context, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthRangef(n, f);
@@ -1467,6 +1521,7 @@ void GL_APIENTRY GL_GenProgramPipelines(GLsizei n, GLuint *pipelines)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenProgramPipelines(context, n, pipelinesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genProgramPipelines(n, pipelinesPacked);
@@ -1491,6 +1546,7 @@ void GL_APIENTRY GL_GetDoublei_v(GLenum target, GLuint index, GLdouble *data)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetDoublei_v(context, target, index, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getDoublei_v(target, index, data);
@@ -1514,6 +1570,7 @@ void GL_APIENTRY GL_GetFloati_v(GLenum target, GLuint index, GLfloat *data)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetFloati_v(context, target, index, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFloati_v(target, index, data);
@@ -1546,6 +1603,7 @@ void GL_APIENTRY GL_GetProgramBinary(GLuint program,
         bool isCallValid =
             (context->skipValidation() || ValidateGetProgramBinary(context, programPacked, bufSize,
                                                                    length, binaryFormat, binary));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramBinary(programPacked, bufSize, length, binaryFormat, binary);
@@ -1577,6 +1635,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLog(GLuint pipeline,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramPipelineInfoLog(context, pipelinePacked, bufSize, length, infoLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramPipelineInfoLog(pipelinePacked, bufSize, length, infoLog);
@@ -1603,6 +1662,7 @@ void GL_APIENTRY GL_GetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *p
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramPipelineiv(context, pipelinePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramPipelineiv(pipelinePacked, pname, params);
@@ -1634,6 +1694,7 @@ void GL_APIENTRY GL_GetShaderPrecisionFormat(GLenum shadertype,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetShaderPrecisionFormat(context, shadertype, precisiontype,
                                                              range, precision));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
@@ -1659,6 +1720,7 @@ void GL_APIENTRY GL_GetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *par
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetVertexAttribLdv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribLdv(index, pname, params);
@@ -1683,6 +1745,7 @@ GLboolean GL_APIENTRY GL_IsProgramPipeline(GLuint pipeline)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsProgramPipeline(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isProgramPipeline(pipelinePacked);
@@ -1720,6 +1783,7 @@ void GL_APIENTRY GL_ProgramBinary(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramBinary(context, programPacked, binaryFormat, binary, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programBinary(programPacked, binaryFormat, binary, length);
@@ -1745,6 +1809,7 @@ void GL_APIENTRY GL_ProgramParameteri(GLuint program, GLenum pname, GLint value)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramParameteri(context, programPacked, pname, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programParameteri(programPacked, pname, value);
@@ -1770,6 +1835,7 @@ void GL_APIENTRY GL_ProgramUniform1d(GLuint program, GLint location, GLdouble v0
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform1d(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1d(programPacked, locationPacked, v0);
@@ -1800,6 +1866,7 @@ void GL_APIENTRY GL_ProgramUniform1dv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1dv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1dv(programPacked, locationPacked, count, value);
@@ -1826,6 +1893,7 @@ void GL_APIENTRY GL_ProgramUniform1f(GLuint program, GLint location, GLfloat v0)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform1f(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1f(programPacked, locationPacked, v0);
@@ -1856,6 +1924,7 @@ void GL_APIENTRY GL_ProgramUniform1fv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1fv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1fv(programPacked, locationPacked, count, value);
@@ -1882,6 +1951,7 @@ void GL_APIENTRY GL_ProgramUniform1i(GLuint program, GLint location, GLint v0)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform1i(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1i(programPacked, locationPacked, v0);
@@ -1912,6 +1982,7 @@ void GL_APIENTRY GL_ProgramUniform1iv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1iv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1iv(programPacked, locationPacked, count, value);
@@ -1938,6 +2009,7 @@ void GL_APIENTRY GL_ProgramUniform1ui(GLuint program, GLint location, GLuint v0)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform1ui(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1ui(programPacked, locationPacked, v0);
@@ -1968,6 +2040,7 @@ void GL_APIENTRY GL_ProgramUniform1uiv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1uiv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1uiv(programPacked, locationPacked, count, value);
@@ -1996,6 +2069,7 @@ void GL_APIENTRY GL_ProgramUniform2d(GLuint program, GLint location, GLdouble v0
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2d(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2d(programPacked, locationPacked, v0, v1);
@@ -2027,6 +2101,7 @@ void GL_APIENTRY GL_ProgramUniform2dv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2dv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2dv(programPacked, locationPacked, count, value);
@@ -2055,6 +2130,7 @@ void GL_APIENTRY GL_ProgramUniform2f(GLuint program, GLint location, GLfloat v0,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2f(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2f(programPacked, locationPacked, v0, v1);
@@ -2086,6 +2162,7 @@ void GL_APIENTRY GL_ProgramUniform2fv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2fv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2fv(programPacked, locationPacked, count, value);
@@ -2114,6 +2191,7 @@ void GL_APIENTRY GL_ProgramUniform2i(GLuint program, GLint location, GLint v0, G
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2i(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2i(programPacked, locationPacked, v0, v1);
@@ -2145,6 +2223,7 @@ void GL_APIENTRY GL_ProgramUniform2iv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2iv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2iv(programPacked, locationPacked, count, value);
@@ -2173,6 +2252,7 @@ void GL_APIENTRY GL_ProgramUniform2ui(GLuint program, GLint location, GLuint v0,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2ui(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2ui(programPacked, locationPacked, v0, v1);
@@ -2204,6 +2284,7 @@ void GL_APIENTRY GL_ProgramUniform2uiv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2uiv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2uiv(programPacked, locationPacked, count, value);
@@ -2233,6 +2314,7 @@ GL_ProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GL
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3d(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3d(programPacked, locationPacked, v0, v1, v2);
@@ -2264,6 +2346,7 @@ void GL_APIENTRY GL_ProgramUniform3dv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3dv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3dv(programPacked, locationPacked, count, value);
@@ -2293,6 +2376,7 @@ GL_ProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfl
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3f(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3f(programPacked, locationPacked, v0, v1, v2);
@@ -2324,6 +2408,7 @@ void GL_APIENTRY GL_ProgramUniform3fv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3fv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3fv(programPacked, locationPacked, count, value);
@@ -2352,6 +2437,7 @@ void GL_APIENTRY GL_ProgramUniform3i(GLuint program, GLint location, GLint v0, G
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3i(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3i(programPacked, locationPacked, v0, v1, v2);
@@ -2383,6 +2469,7 @@ void GL_APIENTRY GL_ProgramUniform3iv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3iv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3iv(programPacked, locationPacked, count, value);
@@ -2412,6 +2499,7 @@ GL_ProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuin
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3ui(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3ui(programPacked, locationPacked, v0, v1, v2);
@@ -2443,6 +2531,7 @@ void GL_APIENTRY GL_ProgramUniform3uiv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3uiv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3uiv(programPacked, locationPacked, count, value);
@@ -2476,6 +2565,7 @@ void GL_APIENTRY GL_ProgramUniform4d(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4d(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4d(programPacked, locationPacked, v0, v1, v2, v3);
@@ -2507,6 +2597,7 @@ void GL_APIENTRY GL_ProgramUniform4dv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4dv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4dv(programPacked, locationPacked, count, value);
@@ -2536,6 +2627,7 @@ GL_ProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfl
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4f(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4f(programPacked, locationPacked, v0, v1, v2, v3);
@@ -2567,6 +2659,7 @@ void GL_APIENTRY GL_ProgramUniform4fv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4fv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4fv(programPacked, locationPacked, count, value);
@@ -2596,6 +2689,7 @@ GL_ProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4i(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4i(programPacked, locationPacked, v0, v1, v2, v3);
@@ -2627,6 +2721,7 @@ void GL_APIENTRY GL_ProgramUniform4iv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4iv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4iv(programPacked, locationPacked, count, value);
@@ -2656,6 +2751,7 @@ GL_ProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuin
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4ui(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4ui(programPacked, locationPacked, v0, v1, v2, v3);
@@ -2687,6 +2783,7 @@ void GL_APIENTRY GL_ProgramUniform4uiv(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4uiv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4uiv(programPacked, locationPacked, count, value);
@@ -2720,6 +2817,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2dv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2dv(context, programPacked, locationPacked,
                                                             count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2dv(programPacked, locationPacked, count, transpose,
@@ -2754,6 +2852,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2fv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2fv(context, programPacked, locationPacked,
                                                             count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2fv(programPacked, locationPacked, count, transpose,
@@ -2788,6 +2887,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3dv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x3dv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2x3dv(programPacked, locationPacked, count, transpose,
@@ -2822,6 +2922,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3fv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x3fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2x3fv(programPacked, locationPacked, count, transpose,
@@ -2856,6 +2957,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4dv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x4dv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2x4dv(programPacked, locationPacked, count, transpose,
@@ -2890,6 +2992,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4fv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x4fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2x4fv(programPacked, locationPacked, count, transpose,
@@ -2924,6 +3027,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3dv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3dv(context, programPacked, locationPacked,
                                                             count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3dv(programPacked, locationPacked, count, transpose,
@@ -2958,6 +3062,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3fv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3fv(context, programPacked, locationPacked,
                                                             count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3fv(programPacked, locationPacked, count, transpose,
@@ -2992,6 +3097,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2dv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x2dv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3x2dv(programPacked, locationPacked, count, transpose,
@@ -3026,6 +3132,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2fv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x2fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3x2fv(programPacked, locationPacked, count, transpose,
@@ -3060,6 +3167,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4dv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x4dv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3x4dv(programPacked, locationPacked, count, transpose,
@@ -3094,6 +3202,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4fv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x4fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3x4fv(programPacked, locationPacked, count, transpose,
@@ -3128,6 +3237,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4dv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4dv(context, programPacked, locationPacked,
                                                             count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4dv(programPacked, locationPacked, count, transpose,
@@ -3162,6 +3272,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4fv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4fv(context, programPacked, locationPacked,
                                                             count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4fv(programPacked, locationPacked, count, transpose,
@@ -3196,6 +3307,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2dv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x2dv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4x2dv(programPacked, locationPacked, count, transpose,
@@ -3230,6 +3342,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2fv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x2fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4x2fv(programPacked, locationPacked, count, transpose,
@@ -3264,6 +3377,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3dv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x3dv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4x3dv(programPacked, locationPacked, count, transpose,
@@ -3298,6 +3412,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x3fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4x3fv(programPacked, locationPacked, count, transpose,
@@ -3321,6 +3436,7 @@ void GL_APIENTRY GL_ReleaseShaderCompiler()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateReleaseShaderCompiler(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->releaseShaderCompiler();
@@ -3344,6 +3460,7 @@ void GL_APIENTRY GL_ScissorArrayv(GLuint first, GLsizei count, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateScissorArrayv(context, first, count, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scissorArrayv(first, count, v);
@@ -3369,6 +3486,7 @@ GL_ScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateScissorIndexed(context, index, left, bottom, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scissorIndexed(index, left, bottom, width, height);
@@ -3392,6 +3510,7 @@ void GL_APIENTRY GL_ScissorIndexedv(GLuint index, const GLint *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateScissorIndexedv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scissorIndexedv(index, v);
@@ -3424,6 +3543,7 @@ void GL_APIENTRY GL_ShaderBinary(GLsizei count,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateShaderBinary(context, count, shadersPacked, binaryformat, binary, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->shaderBinary(count, shadersPacked, binaryformat, binary, length);
@@ -3452,6 +3572,7 @@ void GL_APIENTRY GL_UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUseProgramStages(context, pipelinePacked, stages, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->useProgramStages(pipelinePacked, stages, programPacked);
@@ -3477,6 +3598,7 @@ void GL_APIENTRY GL_ValidateProgramPipeline(GLuint pipeline)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateValidateProgramPipeline(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->validateProgramPipeline(pipelinePacked);
@@ -3499,6 +3621,7 @@ void GL_APIENTRY GL_VertexAttribL1d(GLuint index, GLdouble x)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL1d(context, index, x));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribL1d(index, x);
@@ -3522,6 +3645,7 @@ void GL_APIENTRY GL_VertexAttribL1dv(GLuint index, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL1dv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribL1dv(index, v);
@@ -3545,6 +3669,7 @@ void GL_APIENTRY GL_VertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL2d(context, index, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribL2d(index, x, y);
@@ -3568,6 +3693,7 @@ void GL_APIENTRY GL_VertexAttribL2dv(GLuint index, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL2dv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribL2dv(index, v);
@@ -3591,6 +3717,7 @@ void GL_APIENTRY GL_VertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdoub
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL3d(context, index, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribL3d(index, x, y, z);
@@ -3614,6 +3741,7 @@ void GL_APIENTRY GL_VertexAttribL3dv(GLuint index, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL3dv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribL3dv(index, v);
@@ -3637,6 +3765,7 @@ void GL_APIENTRY GL_VertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdoub
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL4d(context, index, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribL4d(index, x, y, z, w);
@@ -3660,6 +3789,7 @@ void GL_APIENTRY GL_VertexAttribL4dv(GLuint index, const GLdouble *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL4dv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribL4dv(index, v);
@@ -3688,6 +3818,7 @@ GL_VertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, c
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribLPointer(context, index, size, type, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribLPointer(index, size, type, stride, pointer);
@@ -3712,6 +3843,7 @@ void GL_APIENTRY GL_ViewportArrayv(GLuint first, GLsizei count, const GLfloat *v
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateViewportArrayv(context, first, count, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->viewportArrayv(first, count, v);
@@ -3735,6 +3867,7 @@ void GL_APIENTRY GL_ViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateViewportIndexedf(context, index, x, y, w, h));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->viewportIndexedf(index, x, y, w, h);
@@ -3758,6 +3891,7 @@ void GL_APIENTRY GL_ViewportIndexedfv(GLuint index, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateViewportIndexedfv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->viewportIndexedfv(index, v);
@@ -3794,6 +3928,7 @@ void GL_APIENTRY GL_BindImageTexture(GLuint unit,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindImageTexture(context, unit, texturePacked, level, layered,
                                                      layer, access, format));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindImageTexture(unit, texturePacked, level, layered, layer, access, format);
@@ -3826,6 +3961,7 @@ void GL_APIENTRY GL_DrawArraysInstancedBaseInstance(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawArraysInstancedBaseInstance(
                                 context, modePacked, first, count, instancecount, baseinstance));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArraysInstancedBaseInstance(modePacked, first, count, instancecount,
@@ -3861,6 +3997,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseInstance(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsInstancedBaseInstance(
                                 context, mode, count, type, indices, instancecount, baseinstance));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstancedBaseInstance(mode, count, type, indices, instancecount,
@@ -3900,6 +4037,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexBaseInstance(GLenum mode,
             (context->skipValidation() || ValidateDrawElementsInstancedBaseVertexBaseInstance(
                                               context, modePacked, count, typePacked, indices,
                                               instancecount, basevertex, baseinstance));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstancedBaseVertexBaseInstance(
@@ -3928,6 +4066,7 @@ void GL_APIENTRY GL_DrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsiz
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawTransformFeedbackInstanced(context, mode, idPacked, instancecount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTransformFeedbackInstanced(mode, idPacked, instancecount);
@@ -3958,6 +4097,7 @@ void GL_APIENTRY GL_DrawTransformFeedbackStreamInstanced(GLenum mode,
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTransformFeedbackStreamInstanced(
                                               context, mode, idPacked, stream, instancecount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTransformFeedbackStreamInstanced(mode, idPacked, stream, instancecount);
@@ -3989,6 +4129,7 @@ void GL_APIENTRY GL_GetActiveAtomicCounterBufferiv(GLuint program,
         bool isCallValid =
             (context->skipValidation() || ValidateGetActiveAtomicCounterBufferiv(
                                               context, programPacked, bufferIndex, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveAtomicCounterBufferiv(programPacked, bufferIndex, pname, params);
@@ -4022,6 +4163,7 @@ void GL_APIENTRY GL_GetInternalformativ(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetInternalformativ(context, target, internalformat, pname, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInternalformativ(target, internalformat, pname, bufSize, params);
@@ -4045,6 +4187,7 @@ void GL_APIENTRY GL_MemoryBarrier(GLbitfield barriers)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMemoryBarrier(context, barriers));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->memoryBarrier(barriers);
@@ -4073,6 +4216,7 @@ void GL_APIENTRY GL_TexStorage1D(GLenum target,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexStorage1D(context, target, levels, internalformat, width));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage1D(target, levels, internalformat, width);
@@ -4101,6 +4245,7 @@ GL_TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei wi
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexStorage2D(context, targetPacked, levels, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage2D(targetPacked, levels, internalformat, width, height);
@@ -4135,6 +4280,7 @@ void GL_APIENTRY GL_TexStorage3D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexStorage3D(context, targetPacked, levels, internalformat,
                                                  width, height, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage3D(targetPacked, levels, internalformat, width, height, depth);
@@ -4166,6 +4312,7 @@ void GL_APIENTRY GL_BindVertexBuffer(GLuint bindingindex,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindVertexBuffer(context, bindingindex, bufferPacked, offset, stride));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindVertexBuffer(bindingindex, bufferPacked, offset, stride);
@@ -4200,6 +4347,7 @@ void GL_APIENTRY GL_ClearBufferData(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateClearBufferData(context, target, internalformat, format, type, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearBufferData(target, internalformat, format, type, data);
@@ -4237,6 +4385,7 @@ void GL_APIENTRY GL_ClearBufferSubData(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferSubData(context, target, internalformat, offset,
                                                        size, format, type, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearBufferSubData(target, internalformat, offset, size, format, type, data);
@@ -4283,6 +4432,7 @@ void GL_APIENTRY GL_CopyImageSubData(GLuint srcName,
                             ValidateCopyImageSubData(context, srcName, srcTarget, srcLevel, srcX,
                                                      srcY, srcZ, dstName, dstTarget, dstLevel, dstX,
                                                      dstY, dstZ, srcWidth, srcHeight, srcDepth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName,
@@ -4311,6 +4461,7 @@ void GL_APIENTRY GL_DebugMessageCallback(GLDEBUGPROC callback, const void *userP
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDebugMessageCallback(context, callback, userParam));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageCallback(callback, userParam);
@@ -4345,6 +4496,7 @@ void GL_APIENTRY GL_DebugMessageControl(GLenum source,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDebugMessageControl(context, source, type, severity, count, ids, enabled));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageControl(source, type, severity, count, ids, enabled);
@@ -4379,6 +4531,7 @@ void GL_APIENTRY GL_DebugMessageInsert(GLenum source,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDebugMessageInsert(context, source, type, id, severity, length, buf));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageInsert(source, type, id, severity, length, buf);
@@ -4405,6 +4558,7 @@ void GL_APIENTRY GL_DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GL
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDispatchCompute(context, num_groups_x, num_groups_y, num_groups_z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->dispatchCompute(num_groups_x, num_groups_y, num_groups_z);
@@ -4429,6 +4583,7 @@ void GL_APIENTRY GL_DispatchComputeIndirect(GLintptr indirect)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDispatchComputeIndirect(context, indirect));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->dispatchComputeIndirect(indirect);
@@ -4453,6 +4608,7 @@ void GL_APIENTRY GL_FramebufferParameteri(GLenum target, GLenum pname, GLint par
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferParameteri(context, target, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferParameteri(target, pname, param);
@@ -4489,6 +4645,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLog(GLuint count,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetDebugMessageLog(context, count, bufSize, sources, types, ids,
                                                        severities, lengths, messageLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getDebugMessageLog(count, bufSize, sources, types, ids,
@@ -4523,6 +4680,7 @@ void GL_APIENTRY GL_GetFramebufferParameteriv(GLenum target, GLenum pname, GLint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFramebufferParameteriv(context, target, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFramebufferParameteriv(target, pname, params);
@@ -4555,6 +4713,7 @@ void GL_APIENTRY GL_GetInternalformati64v(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetInternalformati64v(context, target, internalformat, pname,
                                                           bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInternalformati64v(target, internalformat, pname, bufSize, params);
@@ -4584,6 +4743,7 @@ GL_GetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *leng
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetObjectLabel(context, identifier, name, bufSize, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getObjectLabel(identifier, name, bufSize, length, label);
@@ -4613,6 +4773,7 @@ void GL_APIENTRY GL_GetObjectPtrLabel(const void *ptr,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetObjectPtrLabel(context, ptr, bufSize, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getObjectPtrLabel(ptr, bufSize, length, label);
@@ -4644,6 +4805,7 @@ void GL_APIENTRY GL_GetProgramInterfaceiv(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramInterfaceiv(context, programPacked, programInterface,
                                                           pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramInterfaceiv(programPacked, programInterface, pname, params);
@@ -4675,6 +4837,7 @@ GLuint GL_APIENTRY GL_GetProgramResourceIndex(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramResourceIndex(context, programPacked, programInterface, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getProgramResourceIndex(programPacked, programInterface, name);
@@ -4713,6 +4876,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocation(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramResourceLocation(context, programPacked, programInterface, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue =
@@ -4753,6 +4917,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocationIndex(GLuint program,
         bool isCallValid =
             (context->skipValidation() || ValidateGetProgramResourceLocationIndex(
                                               context, programPacked, programInterface, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue =
@@ -4797,6 +4962,7 @@ void GL_APIENTRY GL_GetProgramResourceName(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramResourceName(context, programPacked, programInterface,
                                                            index, bufSize, length, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramResourceName(programPacked, programInterface, index, bufSize, length,
@@ -4835,6 +5001,7 @@ void GL_APIENTRY GL_GetProgramResourceiv(GLuint program,
             (context->skipValidation() ||
              ValidateGetProgramResourceiv(context, programPacked, programInterface, index,
                                           propCount, props, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramResourceiv(programPacked, programInterface, index, propCount, props,
@@ -4860,6 +5027,7 @@ void GL_APIENTRY GL_InvalidateBufferData(GLuint buffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateInvalidateBufferData(context, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateBufferData(bufferPacked);
@@ -4885,6 +5053,7 @@ void GL_APIENTRY GL_InvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsi
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInvalidateBufferSubData(context, bufferPacked, offset, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateBufferSubData(bufferPacked, offset, length);
@@ -4913,6 +5082,7 @@ void GL_APIENTRY GL_InvalidateFramebuffer(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateInvalidateFramebuffer(context, target, numAttachments, attachments));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateFramebuffer(target, numAttachments, attachments);
@@ -4947,6 +5117,7 @@ void GL_APIENTRY GL_InvalidateSubFramebuffer(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInvalidateSubFramebuffer(context, target, numAttachments,
                                                              attachments, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateSubFramebuffer(target, numAttachments, attachments, x, y, width,
@@ -4973,6 +5144,7 @@ void GL_APIENTRY GL_InvalidateTexImage(GLuint texture, GLint level)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInvalidateTexImage(context, texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateTexImage(texturePacked, level);
@@ -5007,6 +5179,7 @@ void GL_APIENTRY GL_InvalidateTexSubImage(GLuint texture,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInvalidateTexSubImage(context, texturePacked, level, xoffset,
                                                           yoffset, zoffset, width, height, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateTexSubImage(texturePacked, level, xoffset, yoffset, zoffset, width,
@@ -5038,6 +5211,7 @@ void GL_APIENTRY GL_MultiDrawArraysIndirect(GLenum mode,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiDrawArraysIndirect(context, mode, indirect, drawcount, stride));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawArraysIndirect(mode, indirect, drawcount, stride);
@@ -5071,6 +5245,7 @@ void GL_APIENTRY GL_MultiDrawElementsIndirect(GLenum mode,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiDrawElementsIndirect(context, mode, type, indirect, drawcount, stride));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
@@ -5097,6 +5272,7 @@ void GL_APIENTRY GL_ObjectLabel(GLenum identifier, GLuint name, GLsizei length,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateObjectLabel(context, identifier, name, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->objectLabel(identifier, name, length, label);
@@ -5121,6 +5297,7 @@ void GL_APIENTRY GL_ObjectPtrLabel(const void *ptr, GLsizei length, const GLchar
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateObjectPtrLabel(context, ptr, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->objectPtrLabel(ptr, length, label);
@@ -5142,6 +5319,7 @@ void GL_APIENTRY GL_PopDebugGroup()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopDebugGroup(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popDebugGroup();
@@ -5167,6 +5345,7 @@ void GL_APIENTRY GL_PushDebugGroup(GLenum source, GLuint id, GLsizei length, con
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePushDebugGroup(context, source, id, length, message));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushDebugGroup(source, id, length, message);
@@ -5195,6 +5374,7 @@ void GL_APIENTRY GL_ShaderStorageBlockBinding(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateShaderStorageBlockBinding(
                                 context, programPacked, storageBlockIndex, storageBlockBinding));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->shaderStorageBlockBinding(programPacked, storageBlockIndex,
@@ -5230,6 +5410,7 @@ void GL_APIENTRY GL_TexBufferRange(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexBufferRange(context, targetPacked, internalformat,
                                                    bufferPacked, offset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBufferRange(targetPacked, internalformat, bufferPacked, offset, size);
@@ -5266,6 +5447,7 @@ void GL_APIENTRY GL_TexStorage2DMultisample(GLenum target,
             (context->skipValidation() ||
              ValidateTexStorage2DMultisample(context, targetPacked, samples, internalformat, width,
                                              height, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage2DMultisample(targetPacked, samples, internalformat, width, height,
@@ -5304,6 +5486,7 @@ void GL_APIENTRY GL_TexStorage3DMultisample(GLenum target,
             (context->skipValidation() ||
              ValidateTexStorage3DMultisample(context, targetPacked, samples, internalformat, width,
                                              height, depth, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage3DMultisample(targetPacked, samples, internalformat, width, height,
@@ -5343,6 +5526,7 @@ void GL_APIENTRY GL_TextureView(GLuint texture,
             (context->skipValidation() ||
              ValidateTextureView(context, texturePacked, target, origtexture, internalformat,
                                  minlevel, numlevels, minlayer, numlayers));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureView(texturePacked, target, origtexture, internalformat, minlevel,
@@ -5368,6 +5552,7 @@ void GL_APIENTRY GL_VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribBinding(context, attribindex, bindingindex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribBinding(attribindex, bindingindex);
@@ -5400,6 +5585,7 @@ void GL_APIENTRY GL_VertexAttribFormat(GLuint attribindex,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribFormat(context, attribindex, size, typePacked,
                                                        normalized, relativeoffset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribFormat(attribindex, size, typePacked, normalized, relativeoffset);
@@ -5430,6 +5616,7 @@ void GL_APIENTRY GL_VertexAttribIFormat(GLuint attribindex,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribIFormat(context, attribindex, size, typePacked, relativeoffset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribIFormat(attribindex, size, typePacked, relativeoffset);
@@ -5459,6 +5646,7 @@ void GL_APIENTRY GL_VertexAttribLFormat(GLuint attribindex,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribLFormat(context, attribindex, size, type, relativeoffset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribLFormat(attribindex, size, type, relativeoffset);
@@ -5483,6 +5671,7 @@ void GL_APIENTRY GL_VertexBindingDivisor(GLuint bindingindex, GLuint divisor)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexBindingDivisor(context, bindingindex, divisor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexBindingDivisor(bindingindex, divisor);
@@ -5513,6 +5702,7 @@ void GL_APIENTRY GL_BindBuffersBase(GLenum target,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindBuffersBase(context, target, first, count, buffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindBuffersBase(target, first, count, buffersPacked);
@@ -5546,6 +5736,7 @@ void GL_APIENTRY GL_BindBuffersRange(GLenum target,
         bool isCallValid =
             (context->skipValidation() || ValidateBindBuffersRange(context, target, first, count,
                                                                    buffersPacked, offsets, sizes));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindBuffersRange(target, first, count, buffersPacked, offsets, sizes);
@@ -5571,6 +5762,7 @@ void GL_APIENTRY GL_BindImageTextures(GLuint first, GLsizei count, const GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindImageTextures(context, first, count, textures));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindImageTextures(first, count, textures);
@@ -5595,6 +5787,7 @@ void GL_APIENTRY GL_BindSamplers(GLuint first, GLsizei count, const GLuint *samp
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindSamplers(context, first, count, samplers));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindSamplers(first, count, samplers);
@@ -5619,6 +5812,7 @@ void GL_APIENTRY GL_BindTextures(GLuint first, GLsizei count, const GLuint *text
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindTextures(context, first, count, textures));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindTextures(first, count, textures);
@@ -5650,6 +5844,7 @@ void GL_APIENTRY GL_BindVertexBuffers(GLuint first,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindVertexBuffers(context, first, count, buffersPacked, offsets, strides));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindVertexBuffers(first, count, buffersPacked, offsets, strides);
@@ -5681,6 +5876,7 @@ void GL_APIENTRY GL_BufferStorage(GLenum target,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferStorage(context, targetPacked, size, data, flags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferStorage(targetPacked, size, data, flags);
@@ -5710,6 +5906,7 @@ GL_ClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const
         bool isCallValid =
             (context->skipValidation() ||
              ValidateClearTexImage(context, texturePacked, level, format, type, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearTexImage(texturePacked, level, format, type, data);
@@ -5751,6 +5948,7 @@ void GL_APIENTRY GL_ClearTexSubImage(GLuint texture,
             (context->skipValidation() ||
              ValidateClearTexSubImage(context, texturePacked, level, xoffset, yoffset, zoffset,
                                       width, height, depth, format, type, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearTexSubImage(texturePacked, level, xoffset, yoffset, zoffset, width,
@@ -5778,6 +5976,7 @@ void GL_APIENTRY GL_BindTextureUnit(GLuint unit, GLuint texture)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindTextureUnit(context, unit, texturePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindTextureUnit(unit, texturePacked);
@@ -5819,6 +6018,7 @@ void GL_APIENTRY GL_BlitNamedFramebuffer(GLuint readFramebuffer,
             (context->skipValidation() ||
              ValidateBlitNamedFramebuffer(context, readFramebuffer, drawFramebuffer, srcX0, srcY0,
                                           srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1,
@@ -5846,6 +6046,7 @@ GLenum GL_APIENTRY GL_CheckNamedFramebufferStatus(GLuint framebuffer, GLenum tar
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCheckNamedFramebufferStatus(
                                                              context, framebufferPacked, target));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->checkNamedFramebufferStatus(framebufferPacked, target);
@@ -5888,6 +6089,7 @@ void GL_APIENTRY GL_ClearNamedBufferData(GLuint buffer,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearNamedBufferData(context, bufferPacked, internalformat,
                                                          format, type, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearNamedBufferData(bufferPacked, internalformat, format, type, data);
@@ -5925,6 +6127,7 @@ void GL_APIENTRY GL_ClearNamedBufferSubData(GLuint buffer,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearNamedBufferSubData(context, bufferPacked, internalformat,
                                                             offset, size, format, type, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearNamedBufferSubData(bufferPacked, internalformat, offset, size, format,
@@ -5958,6 +6161,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferfi(GLuint framebuffer,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearNamedFramebufferfi(context, framebufferPacked, buffer,
                                                             drawbuffer, depth, stencil));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearNamedFramebufferfi(framebufferPacked, buffer, drawbuffer, depth, stencil);
@@ -5989,6 +6193,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferfv(GLuint framebuffer,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearNamedFramebufferfv(context, framebufferPacked, buffer,
                                                             drawbuffer, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearNamedFramebufferfv(framebufferPacked, buffer, drawbuffer, value);
@@ -6020,6 +6225,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferiv(GLuint framebuffer,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearNamedFramebufferiv(context, framebufferPacked, buffer,
                                                             drawbuffer, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearNamedFramebufferiv(framebufferPacked, buffer, drawbuffer, value);
@@ -6051,6 +6257,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferuiv(GLuint framebuffer,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearNamedFramebufferuiv(context, framebufferPacked, buffer,
                                                              drawbuffer, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearNamedFramebufferuiv(framebufferPacked, buffer, drawbuffer, value);
@@ -6076,6 +6283,7 @@ void GL_APIENTRY GL_ClipControl(GLenum origin, GLenum depth)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClipControl(context, origin, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clipControl(origin, depth);
@@ -6110,6 +6318,7 @@ void GL_APIENTRY GL_CompressedTextureSubImage1D(GLuint texture,
         bool isCallValid = (context->skipValidation() || ValidateCompressedTextureSubImage1D(
                                                              context, texturePacked, level, xoffset,
                                                              width, format, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTextureSubImage1D(texturePacked, level, xoffset, width, format,
@@ -6149,6 +6358,7 @@ void GL_APIENTRY GL_CompressedTextureSubImage2D(GLuint texture,
             (context->skipValidation() ||
              ValidateCompressedTextureSubImage2D(context, texturePacked, level, xoffset, yoffset,
                                                  width, height, format, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTextureSubImage2D(texturePacked, level, xoffset, yoffset, width,
@@ -6190,6 +6400,7 @@ void GL_APIENTRY GL_CompressedTextureSubImage3D(GLuint texture,
                             ValidateCompressedTextureSubImage3D(
                                 context, texturePacked, level, xoffset, yoffset, zoffset, width,
                                 height, depth, format, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTextureSubImage3D(texturePacked, level, xoffset, yoffset, zoffset,
@@ -6223,6 +6434,7 @@ void GL_APIENTRY GL_CopyNamedBufferSubData(GLuint readBuffer,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyNamedBufferSubData(context, readBuffer, writeBuffer,
                                                            readOffset, writeOffset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
@@ -6255,6 +6467,7 @@ void GL_APIENTRY GL_CopyTextureSubImage1D(GLuint texture,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCopyTextureSubImage1D(context, texturePacked, level, xoffset, x, y, width));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTextureSubImage1D(texturePacked, level, xoffset, x, y, width);
@@ -6290,6 +6503,7 @@ void GL_APIENTRY GL_CopyTextureSubImage2D(GLuint texture,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTextureSubImage2D(context, texturePacked, level, xoffset,
                                                           yoffset, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTextureSubImage2D(texturePacked, level, xoffset, yoffset, x, y, width,
@@ -6327,6 +6541,7 @@ void GL_APIENTRY GL_CopyTextureSubImage3D(GLuint texture,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTextureSubImage3D(context, texturePacked, level, xoffset,
                                                           yoffset, zoffset, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTextureSubImage3D(texturePacked, level, xoffset, yoffset, zoffset, x, y,
@@ -6353,6 +6568,7 @@ void GL_APIENTRY GL_CreateBuffers(GLsizei n, GLuint *buffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCreateBuffers(context, n, buffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->createBuffers(n, buffersPacked);
@@ -6376,6 +6592,7 @@ void GL_APIENTRY GL_CreateFramebuffers(GLsizei n, GLuint *framebuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCreateFramebuffers(context, n, framebuffers));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->createFramebuffers(n, framebuffers);
@@ -6399,6 +6616,7 @@ void GL_APIENTRY GL_CreateProgramPipelines(GLsizei n, GLuint *pipelines)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCreateProgramPipelines(context, n, pipelines));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->createProgramPipelines(n, pipelines);
@@ -6422,6 +6640,7 @@ void GL_APIENTRY GL_CreateQueries(GLenum target, GLsizei n, GLuint *ids)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCreateQueries(context, target, n, ids));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->createQueries(target, n, ids);
@@ -6446,6 +6665,7 @@ void GL_APIENTRY GL_CreateRenderbuffers(GLsizei n, GLuint *renderbuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCreateRenderbuffers(context, n, renderbuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->createRenderbuffers(n, renderbuffersPacked);
@@ -6469,6 +6689,7 @@ void GL_APIENTRY GL_CreateSamplers(GLsizei n, GLuint *samplers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCreateSamplers(context, n, samplers));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->createSamplers(n, samplers);
@@ -6493,6 +6714,7 @@ void GL_APIENTRY GL_CreateTextures(GLenum target, GLsizei n, GLuint *textures)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCreateTextures(context, target, n, textures));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->createTextures(target, n, textures);
@@ -6516,6 +6738,7 @@ void GL_APIENTRY GL_CreateTransformFeedbacks(GLsizei n, GLuint *ids)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCreateTransformFeedbacks(context, n, ids));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->createTransformFeedbacks(n, ids);
@@ -6540,6 +6763,7 @@ void GL_APIENTRY GL_CreateVertexArrays(GLsizei n, GLuint *arrays)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCreateVertexArrays(context, n, arraysPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->createVertexArrays(n, arraysPacked);
@@ -6564,6 +6788,7 @@ void GL_APIENTRY GL_DisableVertexArrayAttrib(GLuint vaobj, GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDisableVertexArrayAttrib(context, vaobjPacked, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disableVertexArrayAttrib(vaobjPacked, index);
@@ -6588,6 +6813,7 @@ void GL_APIENTRY GL_EnableVertexArrayAttrib(GLuint vaobj, GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEnableVertexArrayAttrib(context, vaobjPacked, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enableVertexArrayAttrib(vaobjPacked, index);
@@ -6614,6 +6840,7 @@ void GL_APIENTRY GL_FlushMappedNamedBufferRange(GLuint buffer, GLintptr offset,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateFlushMappedNamedBufferRange(context, bufferPacked, offset, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->flushMappedNamedBufferRange(bufferPacked, offset, length);
@@ -6638,6 +6865,7 @@ void GL_APIENTRY GL_GenerateTextureMipmap(GLuint texture)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenerateTextureMipmap(context, texturePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->generateTextureMipmap(texturePacked);
@@ -6667,6 +6895,7 @@ void GL_APIENTRY GL_GetCompressedTextureImage(GLuint texture,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetCompressedTextureImage(context, texturePacked, level, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getCompressedTextureImage(texturePacked, level, bufSize, pixels);
@@ -6706,6 +6935,7 @@ void GL_APIENTRY GL_GetCompressedTextureSubImage(GLuint texture,
             (context->skipValidation() ||
              ValidateGetCompressedTextureSubImage(context, texturePacked, level, xoffset, yoffset,
                                                   zoffset, width, height, depth, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getCompressedTextureSubImage(texturePacked, level, xoffset, yoffset, zoffset,
@@ -6730,6 +6960,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatus()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetGraphicsResetStatus(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getGraphicsResetStatus();
@@ -6762,6 +6993,7 @@ void GL_APIENTRY GL_GetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLi
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetNamedBufferParameteri64v(
                                                              context, bufferPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getNamedBufferParameteri64v(bufferPacked, pname, params);
@@ -6788,6 +7020,7 @@ void GL_APIENTRY GL_GetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetNamedBufferParameteriv(
                                                              context, bufferPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getNamedBufferParameteriv(bufferPacked, pname, params);
@@ -6813,6 +7046,7 @@ void GL_APIENTRY GL_GetNamedBufferPointerv(GLuint buffer, GLenum pname, void **p
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetNamedBufferPointerv(context, bufferPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getNamedBufferPointerv(bufferPacked, pname, params);
@@ -6843,6 +7077,7 @@ void GL_APIENTRY GL_GetNamedBufferSubData(GLuint buffer,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetNamedBufferSubData(context, bufferPacked, offset, size, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getNamedBufferSubData(bufferPacked, offset, size, data);
@@ -6875,6 +7110,7 @@ void GL_APIENTRY GL_GetNamedFramebufferAttachmentParameteriv(GLuint framebuffer,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetNamedFramebufferAttachmentParameteriv(
                                 context, framebufferPacked, attachment, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getNamedFramebufferAttachmentParameteriv(framebufferPacked, attachment, pname,
@@ -6904,6 +7140,7 @@ void GL_APIENTRY GL_GetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pn
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetNamedFramebufferParameteriv(context, framebufferPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getNamedFramebufferParameteriv(framebufferPacked, pname, param);
@@ -6934,6 +7171,7 @@ void GL_APIENTRY GL_GetNamedRenderbufferParameteriv(GLuint renderbuffer,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetNamedRenderbufferParameteriv(context, renderbufferPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getNamedRenderbufferParameteriv(renderbufferPacked, pname, params);
@@ -6965,6 +7203,7 @@ void GL_APIENTRY GL_GetQueryBufferObjecti64v(GLuint id,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetQueryBufferObjecti64v(context, id, bufferPacked, pname, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryBufferObjecti64v(id, bufferPacked, pname, offset);
@@ -6993,6 +7232,7 @@ void GL_APIENTRY GL_GetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pnam
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetQueryBufferObjectiv(context, id, bufferPacked, pname, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryBufferObjectiv(id, bufferPacked, pname, offset);
@@ -7024,6 +7264,7 @@ void GL_APIENTRY GL_GetQueryBufferObjectui64v(GLuint id,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetQueryBufferObjectui64v(context, id, bufferPacked, pname, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryBufferObjectui64v(id, bufferPacked, pname, offset);
@@ -7052,6 +7293,7 @@ void GL_APIENTRY GL_GetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pna
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetQueryBufferObjectuiv(context, id, bufferPacked, pname, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryBufferObjectuiv(id, bufferPacked, pname, offset);
@@ -7086,6 +7328,7 @@ void GL_APIENTRY GL_GetTextureImage(GLuint texture,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTextureImage(context, texturePacked, level, format, type, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTextureImage(texturePacked, level, format, type, bufSize, pixels);
@@ -7117,6 +7360,7 @@ void GL_APIENTRY GL_GetTextureLevelParameterfv(GLuint texture,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTextureLevelParameterfv(context, texturePacked, level, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTextureLevelParameterfv(texturePacked, level, pname, params);
@@ -7148,6 +7392,7 @@ void GL_APIENTRY GL_GetTextureLevelParameteriv(GLuint texture,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTextureLevelParameteriv(context, texturePacked, level, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTextureLevelParameteriv(texturePacked, level, pname, params);
@@ -7174,6 +7419,7 @@ void GL_APIENTRY GL_GetTextureParameterIiv(GLuint texture, GLenum pname, GLint *
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTextureParameterIiv(context, texturePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTextureParameterIiv(texturePacked, pname, params);
@@ -7199,6 +7445,7 @@ void GL_APIENTRY GL_GetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTextureParameterIuiv(context, texturePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTextureParameterIuiv(texturePacked, pname, params);
@@ -7224,6 +7471,7 @@ void GL_APIENTRY GL_GetTextureParameterfv(GLuint texture, GLenum pname, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTextureParameterfv(context, texturePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTextureParameterfv(texturePacked, pname, params);
@@ -7249,6 +7497,7 @@ void GL_APIENTRY GL_GetTextureParameteriv(GLuint texture, GLenum pname, GLint *p
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTextureParameteriv(context, texturePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTextureParameteriv(texturePacked, pname, params);
@@ -7292,6 +7541,7 @@ void GL_APIENTRY GL_GetTextureSubImage(GLuint texture,
             (context->skipValidation() ||
              ValidateGetTextureSubImage(context, texturePacked, level, xoffset, yoffset, zoffset,
                                         width, height, depth, format, type, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTextureSubImage(texturePacked, level, xoffset, yoffset, zoffset, width,
@@ -7321,6 +7571,7 @@ void GL_APIENTRY GL_GetTransformFeedbacki64_v(GLuint xfb,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTransformFeedbacki64_v(context, xfb, pname, index, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTransformFeedbacki64_v(xfb, pname, index, param);
@@ -7345,6 +7596,7 @@ void GL_APIENTRY GL_GetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint ind
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTransformFeedbacki_v(context, xfb, pname, index, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTransformFeedbacki_v(xfb, pname, index, param);
@@ -7369,6 +7621,7 @@ void GL_APIENTRY GL_GetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *para
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTransformFeedbackiv(context, xfb, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTransformFeedbackiv(xfb, pname, param);
@@ -7399,6 +7652,7 @@ void GL_APIENTRY GL_GetVertexArrayIndexed64iv(GLuint vaobj,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetVertexArrayIndexed64iv(context, vaobjPacked, index, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexArrayIndexed64iv(vaobjPacked, index, pname, param);
@@ -7427,6 +7681,7 @@ void GL_APIENTRY GL_GetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum p
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetVertexArrayIndexediv(context, vaobjPacked, index, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexArrayIndexediv(vaobjPacked, index, pname, param);
@@ -7453,6 +7708,7 @@ void GL_APIENTRY GL_GetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetVertexArrayiv(context, vaobjPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexArrayiv(vaobjPacked, pname, param);
@@ -7481,6 +7737,7 @@ GL_GetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, vo
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnColorTable(context, target, format, type, bufSize, table));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnColorTable(target, format, type, bufSize, table);
@@ -7506,6 +7763,7 @@ void GL_APIENTRY GL_GetnCompressedTexImage(GLenum target, GLint lod, GLsizei buf
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnCompressedTexImage(context, target, lod, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnCompressedTexImage(target, lod, bufSize, pixels);
@@ -7535,6 +7793,7 @@ GL_GetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufS
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnConvolutionFilter(context, target, format, type, bufSize, image));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnConvolutionFilter(target, format, type, bufSize, image);
@@ -7569,6 +7828,7 @@ void GL_APIENTRY GL_GetnHistogram(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnHistogram(context, target, reset, format, type, bufSize, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnHistogram(target, reset, format, type, bufSize, values);
@@ -7595,6 +7855,7 @@ void GL_APIENTRY GL_GetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdo
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetnMapdv(context, target, query, bufSize, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnMapdv(target, query, bufSize, v);
@@ -7620,6 +7881,7 @@ void GL_APIENTRY GL_GetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfl
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetnMapfv(context, target, query, bufSize, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnMapfv(target, query, bufSize, v);
@@ -7645,6 +7907,7 @@ void GL_APIENTRY GL_GetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetnMapiv(context, target, query, bufSize, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnMapiv(target, query, bufSize, v);
@@ -7678,6 +7941,7 @@ void GL_APIENTRY GL_GetnMinmax(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnMinmax(context, target, reset, format, type, bufSize, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnMinmax(target, reset, format, type, bufSize, values);
@@ -7703,6 +7967,7 @@ void GL_APIENTRY GL_GetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetnPixelMapfv(context, map, bufSize, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnPixelMapfv(map, bufSize, values);
@@ -7727,6 +7992,7 @@ void GL_APIENTRY GL_GetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetnPixelMapuiv(context, map, bufSize, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnPixelMapuiv(map, bufSize, values);
@@ -7751,6 +8017,7 @@ void GL_APIENTRY GL_GetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetnPixelMapusv(context, map, bufSize, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnPixelMapusv(map, bufSize, values);
@@ -7774,6 +8041,7 @@ void GL_APIENTRY GL_GetnPolygonStipple(GLsizei bufSize, GLubyte *pattern)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetnPolygonStipple(context, bufSize, pattern));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnPolygonStipple(bufSize, pattern);
@@ -7810,6 +8078,7 @@ void GL_APIENTRY GL_GetnSeparableFilter(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnSeparableFilter(context, target, format, type, rowBufSize,
                                                         row, columnBufSize, column, span));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize,
@@ -7845,6 +8114,7 @@ void GL_APIENTRY GL_GetnTexImage(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnTexImage(context, target, level, format, type, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnTexImage(target, level, format, type, bufSize, pixels);
@@ -7873,6 +8143,7 @@ void GL_APIENTRY GL_GetnUniformdv(GLuint program, GLint location, GLsizei bufSiz
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnUniformdv(context, programPacked, locationPacked, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformdv(programPacked, locationPacked, bufSize, params);
@@ -7901,6 +8172,7 @@ void GL_APIENTRY GL_GetnUniformfv(GLuint program, GLint location, GLsizei bufSiz
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnUniformfv(context, programPacked, locationPacked, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformfv(programPacked, locationPacked, bufSize, params);
@@ -7929,6 +8201,7 @@ void GL_APIENTRY GL_GetnUniformiv(GLuint program, GLint location, GLsizei bufSiz
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnUniformiv(context, programPacked, locationPacked, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformiv(programPacked, locationPacked, bufSize, params);
@@ -7957,6 +8230,7 @@ void GL_APIENTRY GL_GetnUniformuiv(GLuint program, GLint location, GLsizei bufSi
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnUniformuiv(context, programPacked, locationPacked, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformuiv(programPacked, locationPacked, bufSize, params);
@@ -7986,6 +8260,7 @@ void GL_APIENTRY GL_InvalidateNamedFramebufferData(GLuint framebuffer,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInvalidateNamedFramebufferData(context, framebufferPacked,
                                                                    numAttachments, attachments));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateNamedFramebufferData(framebufferPacked, numAttachments, attachments);
@@ -8021,6 +8296,7 @@ void GL_APIENTRY GL_InvalidateNamedFramebufferSubData(GLuint framebuffer,
             (context->skipValidation() ||
              ValidateInvalidateNamedFramebufferSubData(context, framebufferPacked, numAttachments,
                                                        attachments, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateNamedFramebufferSubData(framebufferPacked, numAttachments,
@@ -8048,6 +8324,7 @@ void *GL_APIENTRY GL_MapNamedBuffer(GLuint buffer, GLenum access)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMapNamedBuffer(context, bufferPacked, access));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->mapNamedBuffer(bufferPacked, access);
@@ -8085,6 +8362,7 @@ void *GL_APIENTRY GL_MapNamedBufferRange(GLuint buffer,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMapNamedBufferRange(context, bufferPacked, offset, length, access));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->mapNamedBufferRange(bufferPacked, offset, length, access);
@@ -8115,6 +8393,7 @@ void GL_APIENTRY GL_MemoryBarrierByRegion(GLbitfield barriers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMemoryBarrierByRegion(context, barriers));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->memoryBarrierByRegion(barriers);
@@ -8141,6 +8420,7 @@ void GL_APIENTRY GL_NamedBufferData(GLuint buffer, GLsizeiptr size, const void *
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedBufferData(context, bufferPacked, size, data, usage));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedBufferData(bufferPacked, size, data, usage);
@@ -8170,6 +8450,7 @@ void GL_APIENTRY GL_NamedBufferStorage(GLuint buffer,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedBufferStorage(context, bufferPacked, size, data, flags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedBufferStorage(bufferPacked, size, data, flags);
@@ -8199,6 +8480,7 @@ void GL_APIENTRY GL_NamedBufferSubData(GLuint buffer,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedBufferSubData(context, bufferPacked, offset, size, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedBufferSubData(bufferPacked, offset, size, data);
@@ -8223,6 +8505,7 @@ void GL_APIENTRY GL_NamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedFramebufferDrawBuffer(context, framebufferPacked, buf));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedFramebufferDrawBuffer(framebufferPacked, buf);
@@ -8248,6 +8531,7 @@ void GL_APIENTRY GL_NamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, c
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNamedFramebufferDrawBuffers(
                                                              context, framebufferPacked, n, bufs));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedFramebufferDrawBuffers(framebufferPacked, n, bufs);
@@ -8275,6 +8559,7 @@ void GL_APIENTRY GL_NamedFramebufferParameteri(GLuint framebuffer, GLenum pname,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateNamedFramebufferParameteri(context, framebufferPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedFramebufferParameteri(framebufferPacked, pname, param);
@@ -8300,6 +8585,7 @@ void GL_APIENTRY GL_NamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedFramebufferReadBuffer(context, framebufferPacked, src));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedFramebufferReadBuffer(framebufferPacked, src);
@@ -8333,6 +8619,7 @@ void GL_APIENTRY GL_NamedFramebufferRenderbuffer(GLuint framebuffer,
             (context->skipValidation() ||
              ValidateNamedFramebufferRenderbuffer(context, framebufferPacked, attachment,
                                                   renderbuffertarget, renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedFramebufferRenderbuffer(framebufferPacked, attachment, renderbuffertarget,
@@ -8366,6 +8653,7 @@ void GL_APIENTRY GL_NamedFramebufferTexture(GLuint framebuffer,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedFramebufferTexture(context, framebufferPacked, attachment,
                                                             texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedFramebufferTexture(framebufferPacked, attachment, texturePacked, level);
@@ -8399,6 +8687,7 @@ void GL_APIENTRY GL_NamedFramebufferTextureLayer(GLuint framebuffer,
         bool isCallValid = (context->skipValidation() || ValidateNamedFramebufferTextureLayer(
                                                              context, framebufferPacked, attachment,
                                                              texturePacked, level, layer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedFramebufferTextureLayer(framebufferPacked, attachment, texturePacked,
@@ -8431,6 +8720,7 @@ void GL_APIENTRY GL_NamedRenderbufferStorage(GLuint renderbuffer,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedRenderbufferStorage(context, renderbufferPacked,
                                                              internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedRenderbufferStorage(renderbufferPacked, internalformat, width, height);
@@ -8465,6 +8755,7 @@ void GL_APIENTRY GL_NamedRenderbufferStorageMultisample(GLuint renderbuffer,
             (context->skipValidation() ||
              ValidateNamedRenderbufferStorageMultisample(context, renderbufferPacked, samples,
                                                          internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedRenderbufferStorageMultisample(renderbufferPacked, samples,
@@ -8501,6 +8792,7 @@ void GL_APIENTRY GL_ReadnPixels(GLint x,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateReadnPixels(context, x, y, width, height, format, type, bufSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readnPixels(x, y, width, height, format, type, bufSize, data);
@@ -8523,6 +8815,7 @@ void GL_APIENTRY GL_TextureBarrier()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTextureBarrier(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureBarrier();
@@ -8550,6 +8843,7 @@ void GL_APIENTRY GL_TextureBuffer(GLuint texture, GLenum internalformat, GLuint
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureBuffer(context, texturePacked, internalformat, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureBuffer(texturePacked, internalformat, bufferPacked);
@@ -8584,6 +8878,7 @@ void GL_APIENTRY GL_TextureBufferRange(GLuint texture,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureBufferRange(context, texturePacked, internalformat,
                                                        bufferPacked, offset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureBufferRange(texturePacked, internalformat, bufferPacked, offset, size);
@@ -8610,6 +8905,7 @@ void GL_APIENTRY GL_TextureParameterIiv(GLuint texture, GLenum pname, const GLin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureParameterIiv(context, texturePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureParameterIiv(texturePacked, pname, params);
@@ -8635,6 +8931,7 @@ void GL_APIENTRY GL_TextureParameterIuiv(GLuint texture, GLenum pname, const GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureParameterIuiv(context, texturePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureParameterIuiv(texturePacked, pname, params);
@@ -8659,6 +8956,7 @@ void GL_APIENTRY GL_TextureParameterf(GLuint texture, GLenum pname, GLfloat para
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureParameterf(context, texturePacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureParameterf(texturePacked, pname, param);
@@ -8684,6 +8982,7 @@ void GL_APIENTRY GL_TextureParameterfv(GLuint texture, GLenum pname, const GLflo
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureParameterfv(context, texturePacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureParameterfv(texturePacked, pname, param);
@@ -8708,6 +9007,7 @@ void GL_APIENTRY GL_TextureParameteri(GLuint texture, GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureParameteri(context, texturePacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureParameteri(texturePacked, pname, param);
@@ -8733,6 +9033,7 @@ void GL_APIENTRY GL_TextureParameteriv(GLuint texture, GLenum pname, const GLint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureParameteriv(context, texturePacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureParameteriv(texturePacked, pname, param);
@@ -8762,6 +9063,7 @@ void GL_APIENTRY GL_TextureStorage1D(GLuint texture,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureStorage1D(context, texturePacked, levels, internalformat, width));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureStorage1D(texturePacked, levels, internalformat, width);
@@ -8794,6 +9096,7 @@ void GL_APIENTRY GL_TextureStorage2D(GLuint texture,
         bool isCallValid =
             (context->skipValidation() || ValidateTextureStorage2D(context, texturePacked, levels,
                                                                    internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureStorage2D(texturePacked, levels, internalformat, width, height);
@@ -8830,6 +9133,7 @@ void GL_APIENTRY GL_TextureStorage2DMultisample(GLuint texture,
             (context->skipValidation() ||
              ValidateTextureStorage2DMultisample(context, texturePacked, samples, internalformat,
                                                  width, height, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureStorage2DMultisample(texturePacked, samples, internalformat, width,
@@ -8865,6 +9169,7 @@ void GL_APIENTRY GL_TextureStorage3D(GLuint texture,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureStorage3D(context, texturePacked, levels, internalformat,
                                                      width, height, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureStorage3D(texturePacked, levels, internalformat, width, height, depth);
@@ -8902,6 +9207,7 @@ void GL_APIENTRY GL_TextureStorage3DMultisample(GLuint texture,
             (context->skipValidation() ||
              ValidateTextureStorage3DMultisample(context, texturePacked, samples, internalformat,
                                                  width, height, depth, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureStorage3DMultisample(texturePacked, samples, internalformat, width,
@@ -8939,6 +9245,7 @@ void GL_APIENTRY GL_TextureSubImage1D(GLuint texture,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureSubImage1D(context, texturePacked, level, xoffset, width,
                                                       format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureSubImage1D(texturePacked, level, xoffset, width, format, type, pixels);
@@ -8978,6 +9285,7 @@ void GL_APIENTRY GL_TextureSubImage2D(GLuint texture,
             (context->skipValidation() ||
              ValidateTextureSubImage2D(context, texturePacked, level, xoffset, yoffset, width,
                                        height, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureSubImage2D(texturePacked, level, xoffset, yoffset, width, height,
@@ -9020,6 +9328,7 @@ void GL_APIENTRY GL_TextureSubImage3D(GLuint texture,
             (context->skipValidation() ||
              ValidateTextureSubImage3D(context, texturePacked, level, xoffset, yoffset, zoffset,
                                        width, height, depth, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->textureSubImage3D(texturePacked, level, xoffset, yoffset, zoffset, width,
@@ -9046,6 +9355,7 @@ void GL_APIENTRY GL_TransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTransformFeedbackBufferBase(context, xfb, index, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->transformFeedbackBufferBase(xfb, index, bufferPacked);
@@ -9077,6 +9387,7 @@ void GL_APIENTRY GL_TransformFeedbackBufferRange(GLuint xfb,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTransformFeedbackBufferRange(context, xfb, index, bufferPacked, offset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->transformFeedbackBufferRange(xfb, index, bufferPacked, offset, size);
@@ -9102,6 +9413,7 @@ GLboolean GL_APIENTRY GL_UnmapNamedBuffer(GLuint buffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUnmapNamedBuffer(context, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->unmapNamedBuffer(bufferPacked);
@@ -9134,6 +9446,7 @@ void GL_APIENTRY GL_VertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, G
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexArrayAttribBinding(context, vaobjPacked, attribindex, bindingindex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexArrayAttribBinding(vaobjPacked, attribindex, bindingindex);
@@ -9169,6 +9482,7 @@ void GL_APIENTRY GL_VertexArrayAttribFormat(GLuint vaobj,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayAttribFormat(context, vaobjPacked, attribindex, size,
                                                             type, normalized, relativeoffset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexArrayAttribFormat(vaobjPacked, attribindex, size, type, normalized,
@@ -9202,6 +9516,7 @@ void GL_APIENTRY GL_VertexArrayAttribIFormat(GLuint vaobj,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayAttribIFormat(context, vaobjPacked, attribindex,
                                                              size, type, relativeoffset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexArrayAttribIFormat(vaobjPacked, attribindex, size, type, relativeoffset);
@@ -9234,6 +9549,7 @@ void GL_APIENTRY GL_VertexArrayAttribLFormat(GLuint vaobj,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayAttribLFormat(context, vaobjPacked, attribindex,
                                                              size, type, relativeoffset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexArrayAttribLFormat(vaobjPacked, attribindex, size, type, relativeoffset);
@@ -9261,6 +9577,7 @@ void GL_APIENTRY GL_VertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexArrayBindingDivisor(context, vaobjPacked, bindingindex, divisor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexArrayBindingDivisor(vaobjPacked, bindingindex, divisor);
@@ -9287,6 +9604,7 @@ void GL_APIENTRY GL_VertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayElementBuffer(context, vaobjPacked, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexArrayElementBuffer(vaobjPacked, bufferPacked);
@@ -9319,6 +9637,7 @@ void GL_APIENTRY GL_VertexArrayVertexBuffer(GLuint vaobj,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayVertexBuffer(context, vaobjPacked, bindingindex,
                                                             bufferPacked, offset, stride));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexArrayVertexBuffer(vaobjPacked, bindingindex, bufferPacked, offset,
@@ -9355,6 +9674,7 @@ void GL_APIENTRY GL_VertexArrayVertexBuffers(GLuint vaobj,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayVertexBuffers(context, vaobjPacked, first, count,
                                                              buffersPacked, offsets, strides));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexArrayVertexBuffers(vaobjPacked, first, count, buffersPacked, offsets,
@@ -9389,6 +9709,7 @@ void GL_APIENTRY GL_MultiDrawArraysIndirectCount(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiDrawArraysIndirectCount(context, mode, indirect, drawcount,
                                                                  maxdrawcount, stride));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
@@ -9423,6 +9744,7 @@ void GL_APIENTRY GL_MultiDrawElementsIndirectCount(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiDrawElementsIndirectCount(
                                 context, mode, type, indirect, drawcount, maxdrawcount, stride));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount,
@@ -9448,6 +9770,7 @@ void GL_APIENTRY GL_PolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat cl
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePolygonOffsetClamp(context, factor, units, clamp));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->polygonOffsetClamp(factor, units, clamp);
@@ -9481,6 +9804,7 @@ void GL_APIENTRY GL_SpecializeShader(GLuint shader,
             (context->skipValidation() ||
              ValidateSpecializeShader(context, shader, pEntryPoint, numSpecializationConstants,
                                       pConstantIndex, pConstantValue));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->specializeShader(shader, pEntryPoint, numSpecializationConstants,
@@ -46,6 +46,7 @@ EGLImageKHR CreateImageKHR(Thread *thread,
 {
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglCreateImageKHR",
                          GetDisplayIfValid(display), EGL_NO_IMAGE);
+    ScopedShareGroupLock shareGroupLock(context);
     Image *image = nullptr;
     ANGLE_EGL_TRY_RETURN(thread, display->createImage(context, target, buffer, attributes, &image),
                          "", GetDisplayIfValid(display), EGL_NO_IMAGE);
@@ -756,6 +757,7 @@ void ReleaseHighPowerGPUANGLE(Thread *thread, Display *display, gl::Context *con
 {
     ANGLE_EGL_TRY(thread, display->prepareForCall(), "eglReleaseHighPowerGPUANGLE",
                   GetDisplayIfValid(display));
+    ScopedShareGroupLock shareGroupLock(context);
     ANGLE_EGL_TRY(thread, context->releaseHighPowerGPU(), "eglReleaseHighPowerGPUANGLE",
                   GetDisplayIfValid(display));
 
@@ -766,6 +768,7 @@ void ReacquireHighPowerGPUANGLE(Thread *thread, Display *display, gl::Context *c
 {
     ANGLE_EGL_TRY(thread, display->prepareForCall(), "eglReacquireHighPowerGPUANGLE",
                   GetDisplayIfValid(display));
+    ScopedShareGroupLock shareGroupLock(context);
     ANGLE_EGL_TRY(thread, context->reacquireHighPowerGPU(), "eglReacquireHighPowerGPUANGLE",
                   GetDisplayIfValid(display));
 
@@ -125,6 +125,7 @@ EGLContext CreateContext(Thread *thread,
 {
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglCreateContext",
                          GetDisplayIfValid(display), EGL_NO_CONTEXT);
+    ScopedShareGroupLock shareGroupLock(sharedGLContext);
     gl::Context *context = nullptr;
     ANGLE_EGL_TRY_RETURN(thread,
                          display->createContext(configuration, sharedGLContext, thread->getAPI(),
@@ -144,6 +145,7 @@ EGLImage CreateImage(Thread *thread,
 {
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglCreateImage",
                          GetDisplayIfValid(display), EGL_FALSE);
+    ScopedShareGroupLock shareGroupLock(context);
 
     Image *image = nullptr;
     Error error  = display->createImage(context, target, buffer, attributes, &image);
@@ -278,6 +280,7 @@ EGLBoolean DestroyContext(Thread *thread, Display *display, gl::Context *context
 
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglDestroyContext",
                          GetDisplayIfValid(display), EGL_FALSE);
+    ScopedShareGroupLock shareGroupLock(context);
 
     gl::Context *contextForThread = thread->getContext();
     bool contextWasCurrent        = context == contextForThread;
@@ -494,6 +497,8 @@ EGLBoolean MakeCurrent(Thread *thread,
 {
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglMakeCurrent",
                          GetDisplayIfValid(display), EGL_FALSE);
+    // The share group of the previous context is locked by the entry point.
+    ScopedShareGroupLock shareGroupLock(context);
     Surface *previousDraw        = thread->getCurrentDrawSurface();
     Surface *previousRead        = thread->getCurrentReadSurface();
     gl::Context *previousContext = thread->getContext();
@@ -527,6 +532,7 @@ EGLBoolean QueryContext(Thread *thread,
 {
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglQueryContext",
                          GetDisplayIfValid(display), EGL_FALSE);
+    ScopedShareGroupLock shareGroupLock(context);
     QueryContextAttrib(context, attribute, value);
 
     thread->setSuccess();
@@ -24,7 +24,7 @@ void EGLAPIENTRY EGL_SetBlobCacheFuncsANDROID(EGLDisplay dpy,
                                               EGLSetBlobFuncANDROID set,
                                               EGLGetBlobFuncANDROID get)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(SetBlobCacheFuncsANDROID,
               "dpy = 0x%016" PRIxPTR ", set = 0x%016" PRIxPTR ", get = 0x%016" PRIxPTR "",
               (uintptr_t)dpy, (uintptr_t)set, (uintptr_t)get);
@@ -42,7 +42,7 @@ void EGLAPIENTRY EGL_SetBlobCacheFuncsANDROID(EGLDisplay dpy,
 // EGL_ANDROID_create_native_client_buffer
 EGLClientBuffer EGLAPIENTRY EGL_CreateNativeClientBufferANDROID(const EGLint *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(CreateNativeClientBufferANDROID, "attrib_list = 0x%016" PRIxPTR "",
               (uintptr_t)attrib_list);
 
@@ -61,7 +61,7 @@ EGLBoolean EGLAPIENTRY EGL_GetCompositorTimingSupportedANDROID(EGLDisplay dpy,
                                                                EGLSurface surface,
                                                                EGLint name)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(GetCompositorTimingSupportedANDROID,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR ", name = %d", (uintptr_t)dpy,
               (uintptr_t)surface, name);
@@ -84,7 +84,7 @@ EGLBoolean EGLAPIENTRY EGL_GetCompositorTimingANDROID(EGLDisplay dpy,
                                                       const EGLint *names,
                                                       EGLnsecsANDROID *values)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(GetCompositorTimingANDROID,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR
               ", numTimestamps = %d, names = 0x%016" PRIxPTR ", values = 0x%016" PRIxPTR "",
@@ -107,7 +107,7 @@ EGLBoolean EGLAPIENTRY EGL_GetNextFrameIdANDROID(EGLDisplay dpy,
                                                  EGLSurface surface,
                                                  EGLuint64KHR *frameId)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(GetNextFrameIdANDROID,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR ", frameId = 0x%016" PRIxPTR "",
               (uintptr_t)dpy, (uintptr_t)surface, (uintptr_t)frameId);
@@ -127,7 +127,7 @@ EGLBoolean EGLAPIENTRY EGL_GetFrameTimestampSupportedANDROID(EGLDisplay dpy,
                                                              EGLSurface surface,
                                                              EGLint timestamp)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(GetFrameTimestampSupportedANDROID,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR ", timestamp = %d",
               (uintptr_t)dpy, (uintptr_t)surface, timestamp);
@@ -151,7 +151,7 @@ EGLBoolean EGLAPIENTRY EGL_GetFrameTimestampsANDROID(EGLDisplay dpy,
                                                      const EGLint *timestamps,
                                                      EGLnsecsANDROID *values)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(GetFrameTimestampsANDROID,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR
               ", frameId = %llu, numTimestamps = %d, timestamps = 0x%016" PRIxPTR
@@ -174,7 +174,7 @@ EGLBoolean EGLAPIENTRY EGL_GetFrameTimestampsANDROID(EGLDisplay dpy,
 // EGL_ANDROID_get_native_client_buffer
 EGLClientBuffer EGLAPIENTRY EGL_GetNativeClientBufferANDROID(const struct AHardwareBuffer *buffer)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(GetNativeClientBufferANDROID, "buffer = 0x%016" PRIxPTR "", (uintptr_t)buffer);
 
     Thread *thread = egl::GetCurrentThread();
@@ -187,7 +187,7 @@ EGLClientBuffer EGLAPIENTRY EGL_GetNativeClientBufferANDROID(const struct AHardw
 // EGL_ANDROID_native_fence_sync
 EGLint EGLAPIENTRY EGL_DupNativeFenceFDANDROID(EGLDisplay dpy, EGLSyncKHR sync)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(DupNativeFenceFDANDROID, "dpy = 0x%016" PRIxPTR ", sync = 0x%016" PRIxPTR "",
               (uintptr_t)dpy, (uintptr_t)sync);
 
@@ -207,7 +207,7 @@ EGLBoolean EGLAPIENTRY EGL_PresentationTimeANDROID(EGLDisplay dpy,
                                                    EGLSurface surface,
                                                    EGLnsecsANDROID time)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(PresentationTimeANDROID,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR ", time = %llu", (uintptr_t)dpy,
               (uintptr_t)surface, static_cast<unsigned long long>(time));
@@ -228,7 +228,7 @@ EGLDeviceEXT EGLAPIENTRY EGL_CreateDeviceANGLE(EGLint device_type,
                                                void *native_device,
                                                const EGLAttrib *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(CreateDeviceANGLE,
               "device_type = %d, native_device = 0x%016" PRIxPTR ", attrib_list = 0x%016" PRIxPTR
               "",
@@ -244,7 +244,7 @@ EGLDeviceEXT EGLAPIENTRY EGL_CreateDeviceANGLE(EGLint device_type,
 
 EGLBoolean EGLAPIENTRY EGL_ReleaseDeviceANGLE(EGLDeviceEXT device)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(ReleaseDeviceANGLE, "device = 0x%016" PRIxPTR "", (uintptr_t)device);
 
     Thread *thread = egl::GetCurrentThread();
@@ -259,7 +259,7 @@ EGLBoolean EGLAPIENTRY EGL_ReleaseDeviceANGLE(EGLDeviceEXT device)
 // EGL_ANGLE_feature_control
 const char *EGLAPIENTRY EGL_QueryStringiANGLE(EGLDisplay dpy, EGLint name, EGLint index)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(QueryStringiANGLE, "dpy = 0x%016" PRIxPTR ", name = %d, index = %d", (uintptr_t)dpy,
               name, index);
 
@@ -277,7 +277,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryDisplayAttribANGLE(EGLDisplay dpy,
                                                    EGLint attribute,
                                                    EGLAttrib *value)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(QueryDisplayAttribANGLE,
               "dpy = 0x%016" PRIxPTR ", attribute = %d, value = 0x%016" PRIxPTR "", (uintptr_t)dpy,
               attribute, (uintptr_t)value);
@@ -295,7 +295,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryDisplayAttribANGLE(EGLDisplay dpy,
 // EGL_ANGLE_power_preference
 void EGLAPIENTRY EGL_ReleaseHighPowerGPUANGLE(EGLDisplay dpy, EGLContext ctx)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(ReleaseHighPowerGPUANGLE, "dpy = 0x%016" PRIxPTR ", ctx = 0x%016" PRIxPTR "",
               (uintptr_t)dpy, (uintptr_t)ctx);
 
@@ -312,7 +312,7 @@ void EGLAPIENTRY EGL_ReleaseHighPowerGPUANGLE(EGLDisplay dpy, EGLContext ctx)
 
 void EGLAPIENTRY EGL_ReacquireHighPowerGPUANGLE(EGLDisplay dpy, EGLContext ctx)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(ReacquireHighPowerGPUANGLE, "dpy = 0x%016" PRIxPTR ", ctx = 0x%016" PRIxPTR "",
               (uintptr_t)dpy, (uintptr_t)ctx);
 
@@ -329,7 +329,7 @@ void EGLAPIENTRY EGL_ReacquireHighPowerGPUANGLE(EGLDisplay dpy, EGLContext ctx)
 
 void EGLAPIENTRY EGL_HandleGPUSwitchANGLE(EGLDisplay dpy)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(HandleGPUSwitchANGLE, "dpy = 0x%016" PRIxPTR "", (uintptr_t)dpy);
 
     Thread *thread = egl::GetCurrentThread();
@@ -344,7 +344,7 @@ void EGLAPIENTRY EGL_HandleGPUSwitchANGLE(EGLDisplay dpy)
 // EGL_ANGLE_program_cache_control
 EGLint EGLAPIENTRY EGL_ProgramCacheGetAttribANGLE(EGLDisplay dpy, EGLenum attrib)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(ProgramCacheGetAttribANGLE, "dpy = 0x%016" PRIxPTR ", attrib = 0x%X", (uintptr_t)dpy,
               attrib);
 
@@ -365,7 +365,7 @@ void EGLAPIENTRY EGL_ProgramCacheQueryANGLE(EGLDisplay dpy,
                                             void *binary,
                                             EGLint *binarysize)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(ProgramCacheQueryANGLE,
               "dpy = 0x%016" PRIxPTR ", index = %d, key = 0x%016" PRIxPTR
               ", keysize = 0x%016" PRIxPTR ", binary = 0x%016" PRIxPTR
@@ -389,7 +389,7 @@ void EGLAPIENTRY EGL_ProgramCachePopulateANGLE(EGLDisplay dpy,
                                                const void *binary,
                                                EGLint binarysize)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(ProgramCachePopulateANGLE,
               "dpy = 0x%016" PRIxPTR ", key = 0x%016" PRIxPTR
               ", keysize = %d, binary = 0x%016" PRIxPTR ", binarysize = %d",
@@ -407,7 +407,7 @@ void EGLAPIENTRY EGL_ProgramCachePopulateANGLE(EGLDisplay dpy,
 
 EGLint EGLAPIENTRY EGL_ProgramCacheResizeANGLE(EGLDisplay dpy, EGLint limit, EGLint mode)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(ProgramCacheResizeANGLE, "dpy = 0x%016" PRIxPTR ", limit = %d, mode = %d",
               (uintptr_t)dpy, limit, mode);
 
@@ -427,7 +427,7 @@ EGLBoolean EGLAPIENTRY EGL_QuerySurfacePointerANGLE(EGLDisplay dpy,
                                                     EGLint attribute,
                                                     void **value)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(QuerySurfacePointerANGLE,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR
               ", attribute = %d, value = 0x%016" PRIxPTR "",
@@ -449,7 +449,7 @@ EGLBoolean EGLAPIENTRY EGL_CreateStreamProducerD3DTextureANGLE(EGLDisplay dpy,
                                                                EGLStreamKHR stream,
                                                                const EGLAttrib *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(CreateStreamProducerD3DTextureANGLE,
               "dpy = 0x%016" PRIxPTR ", stream = 0x%016" PRIxPTR ", attrib_list = 0x%016" PRIxPTR
               "",
@@ -472,7 +472,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamPostD3DTextureANGLE(EGLDisplay dpy,
                                                      void *texture,
                                                      const EGLAttrib *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(StreamPostD3DTextureANGLE,
               "dpy = 0x%016" PRIxPTR ", stream = 0x%016" PRIxPTR ", texture = 0x%016" PRIxPTR
               ", attrib_list = 0x%016" PRIxPTR "",
@@ -495,7 +495,7 @@ EGLBoolean EGLAPIENTRY EGL_SwapBuffersWithFrameTokenANGLE(EGLDisplay dpy,
                                                           EGLSurface surface,
                                                           EGLFrameTokenANGLE frametoken)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(SwapBuffersWithFrameTokenANGLE,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR ", frametoken = 0x%llX",
               (uintptr_t)dpy, (uintptr_t)surface, static_cast<unsigned long long>(frametoken));
@@ -517,7 +517,7 @@ EGLBoolean EGLAPIENTRY EGL_GetMscRateANGLE(EGLDisplay dpy,
                                            EGLint *numerator,
                                            EGLint *denominator)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(GetMscRateANGLE,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR ", numerator = 0x%016" PRIxPTR
               ", denominator = 0x%016" PRIxPTR "",
@@ -541,7 +541,7 @@ EGLBoolean EGLAPIENTRY EGL_GetSyncValuesCHROMIUM(EGLDisplay dpy,
                                                  EGLuint64KHR *msc,
                                                  EGLuint64KHR *sbc)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(GetSyncValuesCHROMIUM,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR ", ust = 0x%016" PRIxPTR
               ", msc = 0x%016" PRIxPTR ", sbc = 0x%016" PRIxPTR "",
@@ -563,7 +563,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryDeviceAttribEXT(EGLDeviceEXT device,
                                                 EGLint attribute,
                                                 EGLAttrib *value)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(QueryDeviceAttribEXT,
               "device = 0x%016" PRIxPTR ", attribute = %d, value = 0x%016" PRIxPTR "",
               (uintptr_t)device, attribute, (uintptr_t)value);
@@ -580,7 +580,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryDeviceAttribEXT(EGLDeviceEXT device,
 
 const char *EGLAPIENTRY EGL_QueryDeviceStringEXT(EGLDeviceEXT device, EGLint name)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(QueryDeviceStringEXT, "device = 0x%016" PRIxPTR ", name = %d", (uintptr_t)device,
               name);
 
@@ -595,7 +595,7 @@ const char *EGLAPIENTRY EGL_QueryDeviceStringEXT(EGLDeviceEXT device, EGLint nam
 
 EGLBoolean EGLAPIENTRY EGL_QueryDisplayAttribEXT(EGLDisplay dpy, EGLint attribute, EGLAttrib *value)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(QueryDisplayAttribEXT,
               "dpy = 0x%016" PRIxPTR ", attribute = %d, value = 0x%016" PRIxPTR "", (uintptr_t)dpy,
               attribute, (uintptr_t)value);
@@ -616,7 +616,7 @@ EGLSurface EGLAPIENTRY EGL_CreatePlatformPixmapSurfaceEXT(EGLDisplay dpy,
                                                           void *native_pixmap,
                                                           const EGLint *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(CreatePlatformPixmapSurfaceEXT,
               "dpy = 0x%016" PRIxPTR ", config = 0x%016" PRIxPTR ", native_pixmap = 0x%016" PRIxPTR
               ", attrib_list = 0x%016" PRIxPTR "",
@@ -640,7 +640,7 @@ EGLSurface EGLAPIENTRY EGL_CreatePlatformWindowSurfaceEXT(EGLDisplay dpy,
                                                           void *native_window,
                                                           const EGLint *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(CreatePlatformWindowSurfaceEXT,
               "dpy = 0x%016" PRIxPTR ", config = 0x%016" PRIxPTR ", native_window = 0x%016" PRIxPTR
               ", attrib_list = 0x%016" PRIxPTR "",
@@ -663,7 +663,7 @@ EGLDisplay EGLAPIENTRY EGL_GetPlatformDisplayEXT(EGLenum platform,
                                                  void *native_display,
                                                  const EGLint *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(GetPlatformDisplayEXT,
               "platform = 0x%X, native_display = 0x%016" PRIxPTR ", attrib_list = 0x%016" PRIxPTR
               "",
@@ -683,7 +683,7 @@ EGLDisplay EGLAPIENTRY EGL_GetPlatformDisplayEXT(EGLenum platform,
 EGLint EGLAPIENTRY EGL_DebugMessageControlKHR(EGLDEBUGPROCKHR callback,
                                               const EGLAttrib *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(DebugMessageControlKHR,
               "callback = 0x%016" PRIxPTR ", attrib_list = 0x%016" PRIxPTR "", (uintptr_t)callback,
               (uintptr_t)attrib_list);
@@ -703,7 +703,7 @@ EGLint EGLAPIENTRY EGL_LabelObjectKHR(EGLDisplay display,
                                       EGLObjectKHR object,
                                       EGLLabelKHR label)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(LabelObjectKHR,
               "display = 0x%016" PRIxPTR ", objectType = 0x%X, object = 0x%016" PRIxPTR
               ", label = 0x%016" PRIxPTR "",
@@ -722,7 +722,7 @@ EGLint EGLAPIENTRY EGL_LabelObjectKHR(EGLDisplay display,
 
 EGLBoolean EGLAPIENTRY EGL_QueryDebugKHR(EGLint attribute, EGLAttrib *value)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(QueryDebugKHR, "attribute = %d, value = 0x%016" PRIxPTR "", attribute,
               (uintptr_t)value);
 
@@ -739,7 +739,7 @@ EGLint EGLAPIENTRY EGL_ClientWaitSyncKHR(EGLDisplay dpy,
                                          EGLint flags,
                                          EGLTimeKHR timeout)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(ClientWaitSyncKHR,
               "dpy = 0x%016" PRIxPTR ", sync = 0x%016" PRIxPTR ", flags = %d, timeout = %llu",
               (uintptr_t)dpy, (uintptr_t)sync, flags, static_cast<unsigned long long>(timeout));
@@ -757,7 +757,7 @@ EGLint EGLAPIENTRY EGL_ClientWaitSyncKHR(EGLDisplay dpy,
 
 EGLSyncKHR EGLAPIENTRY EGL_CreateSyncKHR(EGLDisplay dpy, EGLenum type, const EGLint *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(CreateSyncKHR,
               "dpy = 0x%016" PRIxPTR ", type = 0x%X, attrib_list = 0x%016" PRIxPTR "",
               (uintptr_t)dpy, type, (uintptr_t)attrib_list);
@@ -775,7 +775,7 @@ EGLSyncKHR EGLAPIENTRY EGL_CreateSyncKHR(EGLDisplay dpy, EGLenum type, const EGL
 
 EGLBoolean EGLAPIENTRY EGL_DestroySyncKHR(EGLDisplay dpy, EGLSyncKHR sync)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(DestroySyncKHR, "dpy = 0x%016" PRIxPTR ", sync = 0x%016" PRIxPTR "", (uintptr_t)dpy,
               (uintptr_t)sync);
 
@@ -795,7 +795,7 @@ EGLBoolean EGLAPIENTRY EGL_GetSyncAttribKHR(EGLDisplay dpy,
                                             EGLint attribute,
                                             EGLint *value)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(GetSyncAttribKHR,
               "dpy = 0x%016" PRIxPTR ", sync = 0x%016" PRIxPTR
               ", attribute = %d, value = 0x%016" PRIxPTR "",
@@ -819,7 +819,7 @@ EGLImageKHR EGLAPIENTRY EGL_CreateImageKHR(EGLDisplay dpy,
                                            EGLClientBuffer buffer,
                                            const EGLint *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(CreateImageKHR,
               "dpy = 0x%016" PRIxPTR ", ctx = 0x%016" PRIxPTR
               ", target = 0x%X, buffer = 0x%016" PRIxPTR ", attrib_list = 0x%016" PRIxPTR "",
@@ -839,7 +839,7 @@ EGLImageKHR EGLAPIENTRY EGL_CreateImageKHR(EGLDisplay dpy,
 
 EGLBoolean EGLAPIENTRY EGL_DestroyImageKHR(EGLDisplay dpy, EGLImageKHR image)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(DestroyImageKHR, "dpy = 0x%016" PRIxPTR ", image = 0x%016" PRIxPTR "", (uintptr_t)dpy,
               (uintptr_t)image);
 
@@ -857,7 +857,7 @@ EGLBoolean EGLAPIENTRY EGL_DestroyImageKHR(EGLDisplay dpy, EGLImageKHR image)
 // EGL_KHR_reusable_sync
 EGLBoolean EGLAPIENTRY EGL_SignalSyncKHR(EGLDisplay dpy, EGLSyncKHR sync, EGLenum mode)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(SignalSyncKHR, "dpy = 0x%016" PRIxPTR ", sync = 0x%016" PRIxPTR ", mode = 0x%X",
               (uintptr_t)dpy, (uintptr_t)sync, mode);
 
@@ -883,7 +883,7 @@ EGLBoolean EGLAPIENTRY EGL_SignalSyncKHR(EGLDisplay dpy, EGLSyncKHR sync, EGLenu
 // EGL_KHR_stream
 EGLStreamKHR EGLAPIENTRY EGL_CreateStreamKHR(EGLDisplay dpy, const EGLint *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(CreateStreamKHR, "dpy = 0x%016" PRIxPTR ", attrib_list = 0x%016" PRIxPTR "",
               (uintptr_t)dpy, (uintptr_t)attrib_list);
 
@@ -900,7 +900,7 @@ EGLStreamKHR EGLAPIENTRY EGL_CreateStreamKHR(EGLDisplay dpy, const EGLint *attri
 
 EGLBoolean EGLAPIENTRY EGL_DestroyStreamKHR(EGLDisplay dpy, EGLStreamKHR stream)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(DestroyStreamKHR, "dpy = 0x%016" PRIxPTR ", stream = 0x%016" PRIxPTR "",
               (uintptr_t)dpy, (uintptr_t)stream);
 
@@ -920,7 +920,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryStreamKHR(EGLDisplay dpy,
                                           EGLenum attribute,
                                           EGLint *value)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(QueryStreamKHR,
               "dpy = 0x%016" PRIxPTR ", stream = 0x%016" PRIxPTR
               ", attribute = 0x%X, value = 0x%016" PRIxPTR "",
@@ -942,7 +942,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryStreamu64KHR(EGLDisplay dpy,
                                              EGLenum attribute,
                                              EGLuint64KHR *value)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(QueryStreamu64KHR,
               "dpy = 0x%016" PRIxPTR ", stream = 0x%016" PRIxPTR
               ", attribute = 0x%X, value = 0x%016" PRIxPTR "",
@@ -964,7 +964,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamAttribKHR(EGLDisplay dpy,
                                            EGLenum attribute,
                                            EGLint value)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(StreamAttribKHR,
               "dpy = 0x%016" PRIxPTR ", stream = 0x%016" PRIxPTR ", attribute = 0x%X, value = %d",
               (uintptr_t)dpy, (uintptr_t)stream, attribute, value);
@@ -983,7 +983,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamAttribKHR(EGLDisplay dpy,
 // EGL_KHR_stream_consumer_gltexture
 EGLBoolean EGLAPIENTRY EGL_StreamConsumerAcquireKHR(EGLDisplay dpy, EGLStreamKHR stream)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(StreamConsumerAcquireKHR, "dpy = 0x%016" PRIxPTR ", stream = 0x%016" PRIxPTR "",
               (uintptr_t)dpy, (uintptr_t)stream);
 
@@ -1000,7 +1000,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamConsumerAcquireKHR(EGLDisplay dpy, EGLStreamKHR
 
 EGLBoolean EGLAPIENTRY EGL_StreamConsumerGLTextureExternalKHR(EGLDisplay dpy, EGLStreamKHR stream)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(StreamConsumerGLTextureExternalKHR,
               "dpy = 0x%016" PRIxPTR ", stream = 0x%016" PRIxPTR "", (uintptr_t)dpy,
               (uintptr_t)stream);
@@ -1018,7 +1018,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamConsumerGLTextureExternalKHR(EGLDisplay dpy, EG
 
 EGLBoolean EGLAPIENTRY EGL_StreamConsumerReleaseKHR(EGLDisplay dpy, EGLStreamKHR stream)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(StreamConsumerReleaseKHR, "dpy = 0x%016" PRIxPTR ", stream = 0x%016" PRIxPTR "",
               (uintptr_t)dpy, (uintptr_t)stream);
 
@@ -1039,7 +1039,7 @@ EGLBoolean EGLAPIENTRY EGL_SwapBuffersWithDamageKHR(EGLDisplay dpy,
                                                     const EGLint *rects,
                                                     EGLint n_rects)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(SwapBuffersWithDamageKHR,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR ", rects = 0x%016" PRIxPTR
               ", n_rects = %d",
@@ -1059,7 +1059,7 @@ EGLBoolean EGLAPIENTRY EGL_SwapBuffersWithDamageKHR(EGLDisplay dpy,
 // EGL_KHR_wait_sync
 EGLint EGLAPIENTRY EGL_WaitSyncKHR(EGLDisplay dpy, EGLSyncKHR sync, EGLint flags)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(WaitSyncKHR, "dpy = 0x%016" PRIxPTR ", sync = 0x%016" PRIxPTR ", flags = %d",
               (uintptr_t)dpy, (uintptr_t)sync, flags);
 
@@ -1082,7 +1082,7 @@ EGLBoolean EGLAPIENTRY EGL_PostSubBufferNV(EGLDisplay dpy,
                                            EGLint width,
                                            EGLint height)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(PostSubBufferNV,
               "dpy = 0x%016" PRIxPTR ", surface = 0x%016" PRIxPTR
               ", x = %d, y = %d, width = %d, height = %d",
@@ -1104,7 +1104,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamConsumerGLTextureExternalAttribsNV(EGLDisplay d
                                                                     EGLStreamKHR stream,
                                                                     const EGLAttrib *attrib_list)
 {
-    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_EGL_LOCK();
     EGL_EVENT(StreamConsumerGLTextureExternalAttribsNV,
               "dpy = 0x%016" PRIxPTR ", stream = 0x%016" PRIxPTR ", attrib_list = 0x%016" PRIxPTR
               "",
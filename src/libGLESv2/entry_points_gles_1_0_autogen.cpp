@@ -34,6 +34,7 @@ void GL_APIENTRY GL_AlphaFunc(GLenum func, GLfloat ref)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateAlphaFunc(context, funcPacked, ref));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->alphaFunc(funcPacked, ref);
@@ -58,6 +59,7 @@ void GL_APIENTRY GL_AlphaFuncx(GLenum func, GLfixed ref)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateAlphaFuncx(context, funcPacked, ref));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->alphaFuncx(funcPacked, ref);
@@ -82,6 +84,7 @@ void GL_APIENTRY GL_ClearColorx(GLfixed red, GLfixed green, GLfixed blue, GLfixe
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearColorx(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearColorx(red, green, blue, alpha);
@@ -103,6 +106,7 @@ void GL_APIENTRY GL_ClearDepthx(GLfixed depth)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepthx(context, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearDepthx(depth);
@@ -126,6 +130,7 @@ void GL_APIENTRY GL_ClientActiveTexture(GLenum texture)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClientActiveTexture(context, texture));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clientActiveTexture(texture);
@@ -148,6 +153,7 @@ void GL_APIENTRY GL_ClipPlanef(GLenum p, const GLfloat *eqn)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClipPlanef(context, p, eqn));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clipPlanef(p, eqn);
@@ -171,6 +177,7 @@ void GL_APIENTRY GL_ClipPlanex(GLenum plane, const GLfixed *equation)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClipPlanex(context, plane, equation));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clipPlanex(plane, equation);
@@ -194,6 +201,7 @@ void GL_APIENTRY GL_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4f(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4f(red, green, blue, alpha);
@@ -217,6 +225,7 @@ void GL_APIENTRY GL_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte a
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4ub(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4ub(red, green, blue, alpha);
@@ -240,6 +249,7 @@ void GL_APIENTRY GL_Color4x(GLfixed red, GLfixed green, GLfixed blue, GLfixed al
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4x(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4x(red, green, blue, alpha);
@@ -266,6 +276,7 @@ void GL_APIENTRY GL_ColorPointer(GLint size, GLenum type, GLsizei stride, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColorPointer(context, size, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorPointer(size, typePacked, stride, pointer);
@@ -287,6 +298,7 @@ void GL_APIENTRY GL_DepthRangex(GLfixed n, GLfixed f)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRangex(context, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthRangex(n, f);
@@ -311,6 +323,7 @@ void GL_APIENTRY GL_DisableClientState(GLenum array)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableClientState(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disableClientState(arrayPacked);
@@ -335,6 +348,7 @@ void GL_APIENTRY GL_EnableClientState(GLenum array)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableClientState(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enableClientState(arrayPacked);
@@ -357,6 +371,7 @@ void GL_APIENTRY GL_Fogf(GLenum pname, GLfloat param)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogf(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogf(pname, param);
@@ -379,6 +394,7 @@ void GL_APIENTRY GL_Fogfv(GLenum pname, const GLfloat *params)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogfv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogfv(pname, params);
@@ -401,6 +417,7 @@ void GL_APIENTRY GL_Fogx(GLenum pname, GLfixed param)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogx(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogx(pname, param);
@@ -423,6 +440,7 @@ void GL_APIENTRY GL_Fogxv(GLenum pname, const GLfixed *param)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogxv(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogxv(pname, param);
@@ -446,6 +464,7 @@ void GL_APIENTRY GL_Frustumf(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFrustumf(context, l, r, b, t, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->frustumf(l, r, b, t, n, f);
@@ -470,6 +489,7 @@ void GL_APIENTRY GL_Frustumx(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFrustumx(context, l, r, b, t, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->frustumx(l, r, b, t, n, f);
@@ -493,6 +513,7 @@ void GL_APIENTRY GL_GetClipPlanef(GLenum plane, GLfloat *equation)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetClipPlanef(context, plane, equation));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getClipPlanef(plane, equation);
@@ -516,6 +537,7 @@ void GL_APIENTRY GL_GetClipPlanex(GLenum plane, GLfixed *equation)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetClipPlanex(context, plane, equation));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getClipPlanex(plane, equation);
@@ -538,6 +560,7 @@ void GL_APIENTRY GL_GetFixedv(GLenum pname, GLfixed *params)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetFixedv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFixedv(pname, params);
@@ -563,6 +586,7 @@ void GL_APIENTRY GL_GetLightfv(GLenum light, GLenum pname, GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetLightfv(context, light, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getLightfv(light, pnamePacked, params);
@@ -588,6 +612,7 @@ void GL_APIENTRY GL_GetLightxv(GLenum light, GLenum pname, GLfixed *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetLightxv(context, light, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getLightxv(light, pnamePacked, params);
@@ -614,6 +639,7 @@ void GL_APIENTRY GL_GetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetMaterialfv(context, face, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMaterialfv(face, pnamePacked, params);
@@ -640,6 +666,7 @@ void GL_APIENTRY GL_GetMaterialxv(GLenum face, GLenum pname, GLfixed *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetMaterialxv(context, face, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMaterialxv(face, pnamePacked, params);
@@ -667,6 +694,7 @@ void GL_APIENTRY GL_GetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexEnvfv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexEnvfv(targetPacked, pnamePacked, params);
@@ -694,6 +722,7 @@ void GL_APIENTRY GL_GetTexEnviv(GLenum target, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexEnviv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexEnviv(targetPacked, pnamePacked, params);
@@ -721,6 +750,7 @@ void GL_APIENTRY GL_GetTexEnvxv(GLenum target, GLenum pname, GLfixed *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexEnvxv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexEnvxv(targetPacked, pnamePacked, params);
@@ -747,6 +777,7 @@ void GL_APIENTRY GL_GetTexParameterxv(GLenum target, GLenum pname, GLfixed *para
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterxv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterxv(targetPacked, pname, params);
@@ -770,6 +801,7 @@ void GL_APIENTRY GL_LightModelf(GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelf(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModelf(pname, param);
@@ -793,6 +825,7 @@ void GL_APIENTRY GL_LightModelfv(GLenum pname, const GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelfv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModelfv(pname, params);
@@ -816,6 +849,7 @@ void GL_APIENTRY GL_LightModelx(GLenum pname, GLfixed param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelx(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModelx(pname, param);
@@ -839,6 +873,7 @@ void GL_APIENTRY GL_LightModelxv(GLenum pname, const GLfixed *param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelxv(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModelxv(pname, param);
@@ -864,6 +899,7 @@ void GL_APIENTRY GL_Lightf(GLenum light, GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightf(context, light, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightf(light, pnamePacked, param);
@@ -889,6 +925,7 @@ void GL_APIENTRY GL_Lightfv(GLenum light, GLenum pname, const GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightfv(context, light, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightfv(light, pnamePacked, params);
@@ -914,6 +951,7 @@ void GL_APIENTRY GL_Lightx(GLenum light, GLenum pname, GLfixed param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightx(context, light, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightx(light, pnamePacked, param);
@@ -939,6 +977,7 @@ void GL_APIENTRY GL_Lightxv(GLenum light, GLenum pname, const GLfixed *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightxv(context, light, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightxv(light, pnamePacked, params);
@@ -960,6 +999,7 @@ void GL_APIENTRY GL_LineWidthx(GLfixed width)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLineWidthx(context, width));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lineWidthx(width);
@@ -981,6 +1021,7 @@ void GL_APIENTRY GL_LoadIdentity()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadIdentity(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadIdentity();
@@ -1003,6 +1044,7 @@ void GL_APIENTRY GL_LoadMatrixf(const GLfloat *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadMatrixf(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadMatrixf(m);
@@ -1025,6 +1067,7 @@ void GL_APIENTRY GL_LoadMatrixx(const GLfixed *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadMatrixx(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadMatrixx(m);
@@ -1048,6 +1091,7 @@ void GL_APIENTRY GL_LogicOp(GLenum opcode)
         LogicalOperation opcodePacked                         = PackParam<LogicalOperation>(opcode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLogicOp(context, opcodePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->logicOp(opcodePacked);
@@ -1073,6 +1117,7 @@ void GL_APIENTRY GL_Materialf(GLenum face, GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaterialf(context, face, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materialf(face, pnamePacked, param);
@@ -1098,6 +1143,7 @@ void GL_APIENTRY GL_Materialfv(GLenum face, GLenum pname, const GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaterialfv(context, face, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materialfv(face, pnamePacked, params);
@@ -1123,6 +1169,7 @@ void GL_APIENTRY GL_Materialx(GLenum face, GLenum pname, GLfixed param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaterialx(context, face, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materialx(face, pnamePacked, param);
@@ -1148,6 +1195,7 @@ void GL_APIENTRY GL_Materialxv(GLenum face, GLenum pname, const GLfixed *param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaterialxv(context, face, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materialxv(face, pnamePacked, param);
@@ -1171,6 +1219,7 @@ void GL_APIENTRY GL_MatrixMode(GLenum mode)
         MatrixType modePacked                                 = PackParam<MatrixType>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMatrixMode(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->matrixMode(modePacked);
@@ -1193,6 +1242,7 @@ void GL_APIENTRY GL_MultMatrixf(const GLfloat *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMultMatrixf(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multMatrixf(m);
@@ -1215,6 +1265,7 @@ void GL_APIENTRY GL_MultMatrixx(const GLfixed *m)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMultMatrixx(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multMatrixx(m);
@@ -1238,6 +1289,7 @@ void GL_APIENTRY GL_MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4f(context, target, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4f(target, s, t, r, q);
@@ -1262,6 +1314,7 @@ void GL_APIENTRY GL_MultiTexCoord4x(GLenum texture, GLfixed s, GLfixed t, GLfixe
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4x(context, texture, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4x(texture, s, t, r, q);
@@ -1283,6 +1336,7 @@ void GL_APIENTRY GL_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3f(context, nx, ny, nz));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3f(nx, ny, nz);
@@ -1305,6 +1359,7 @@ void GL_APIENTRY GL_Normal3x(GLfixed nx, GLfixed ny, GLfixed nz)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3x(context, nx, ny, nz));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3x(nx, ny, nz);
@@ -1330,6 +1385,7 @@ void GL_APIENTRY GL_NormalPointer(GLenum type, GLsizei stride, const void *point
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormalPointer(context, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normalPointer(typePacked, stride, pointer);
@@ -1352,6 +1408,7 @@ void GL_APIENTRY GL_Orthof(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateOrthof(context, l, r, b, t, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->orthof(l, r, b, t, n, f);
@@ -1375,6 +1432,7 @@ void GL_APIENTRY GL_Orthox(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateOrthox(context, l, r, b, t, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->orthox(l, r, b, t, n, f);
@@ -1399,6 +1457,7 @@ void GL_APIENTRY GL_PointParameterf(GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameterf(context, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameterf(pnamePacked, param);
@@ -1423,6 +1482,7 @@ void GL_APIENTRY GL_PointParameterfv(GLenum pname, const GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameterfv(context, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameterfv(pnamePacked, params);
@@ -1447,6 +1507,7 @@ void GL_APIENTRY GL_PointParameterx(GLenum pname, GLfixed param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameterx(context, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameterx(pnamePacked, param);
@@ -1471,6 +1532,7 @@ void GL_APIENTRY GL_PointParameterxv(GLenum pname, const GLfixed *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameterxv(context, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameterxv(pnamePacked, params);
@@ -1492,6 +1554,7 @@ void GL_APIENTRY GL_PointSize(GLfloat size)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePointSize(context, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointSize(size);
@@ -1513,6 +1576,7 @@ void GL_APIENTRY GL_PointSizex(GLfixed size)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePointSizex(context, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointSizex(size);
@@ -1536,6 +1600,7 @@ void GL_APIENTRY GL_PolygonOffsetx(GLfixed factor, GLfixed units)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePolygonOffsetx(context, factor, units));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->polygonOffsetx(factor, units);
@@ -1557,6 +1622,7 @@ void GL_APIENTRY GL_PopMatrix()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopMatrix(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popMatrix();
@@ -1578,6 +1644,7 @@ void GL_APIENTRY GL_PushMatrix()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushMatrix(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushMatrix();
@@ -1600,6 +1667,7 @@ void GL_APIENTRY GL_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotatef(context, angle, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rotatef(angle, x, y, z);
@@ -1622,6 +1690,7 @@ void GL_APIENTRY GL_Rotatex(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotatex(context, angle, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rotatex(angle, x, y, z);
@@ -1645,6 +1714,7 @@ void GL_APIENTRY GL_SampleCoveragex(GLclampx value, GLboolean invert)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleCoveragex(context, value, invert));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->sampleCoveragex(value, invert);
@@ -1666,6 +1736,7 @@ void GL_APIENTRY GL_Scalef(GLfloat x, GLfloat y, GLfloat z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScalef(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scalef(x, y, z);
@@ -1687,6 +1758,7 @@ void GL_APIENTRY GL_Scalex(GLfixed x, GLfixed y, GLfixed z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScalex(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scalex(x, y, z);
@@ -1710,6 +1782,7 @@ void GL_APIENTRY GL_ShadeModel(GLenum mode)
         ShadingModel modePacked                               = PackParam<ShadingModel>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateShadeModel(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->shadeModel(modePacked);
@@ -1736,6 +1809,7 @@ void GL_APIENTRY GL_TexCoordPointer(GLint size, GLenum type, GLsizei stride, con
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoordPointer(context, size, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoordPointer(size, typePacked, stride, pointer);
@@ -1762,6 +1836,7 @@ void GL_APIENTRY GL_TexEnvf(GLenum target, GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvf(context, targetPacked, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvf(targetPacked, pnamePacked, param);
@@ -1788,6 +1863,7 @@ void GL_APIENTRY GL_TexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvfv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvfv(targetPacked, pnamePacked, params);
@@ -1814,6 +1890,7 @@ void GL_APIENTRY GL_TexEnvi(GLenum target, GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvi(context, targetPacked, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvi(targetPacked, pnamePacked, param);
@@ -1840,6 +1917,7 @@ void GL_APIENTRY GL_TexEnviv(GLenum target, GLenum pname, const GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnviv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnviv(targetPacked, pnamePacked, params);
@@ -1866,6 +1944,7 @@ void GL_APIENTRY GL_TexEnvx(GLenum target, GLenum pname, GLfixed param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvx(context, targetPacked, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvx(targetPacked, pnamePacked, param);
@@ -1892,6 +1971,7 @@ void GL_APIENTRY GL_TexEnvxv(GLenum target, GLenum pname, const GLfixed *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvxv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvxv(targetPacked, pnamePacked, params);
@@ -1917,6 +1997,7 @@ void GL_APIENTRY GL_TexParameterx(GLenum target, GLenum pname, GLfixed param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterx(context, targetPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterx(targetPacked, pname, param);
@@ -1943,6 +2024,7 @@ void GL_APIENTRY GL_TexParameterxv(GLenum target, GLenum pname, const GLfixed *p
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterxv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterxv(targetPacked, pname, params);
@@ -1964,6 +2046,7 @@ void GL_APIENTRY GL_Translatef(GLfloat x, GLfloat y, GLfloat z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslatef(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->translatef(x, y, z);
@@ -1986,6 +2069,7 @@ void GL_APIENTRY GL_Translatex(GLfixed x, GLfixed y, GLfixed z)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslatex(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->translatex(x, y, z);
@@ -2012,6 +2096,7 @@ void GL_APIENTRY GL_VertexPointer(GLint size, GLenum type, GLsizei stride, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexPointer(context, size, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexPointer(size, typePacked, stride, pointer);
@@ -32,6 +32,7 @@ void GL_APIENTRY GL_ActiveTexture(GLenum texture)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateActiveTexture(context, texture));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->activeTexture(texture);
@@ -57,6 +58,7 @@ void GL_APIENTRY GL_AttachShader(GLuint program, GLuint shader)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateAttachShader(context, programPacked, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->attachShader(programPacked, shaderPacked);
@@ -82,6 +84,7 @@ void GL_APIENTRY GL_BindAttribLocation(GLuint program, GLuint index, const GLcha
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindAttribLocation(context, programPacked, index, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindAttribLocation(programPacked, index, name);
@@ -107,6 +110,7 @@ void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindBuffer(context, targetPacked, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindBuffer(targetPacked, bufferPacked);
@@ -131,6 +135,7 @@ void GL_APIENTRY GL_BindFramebuffer(GLenum target, GLuint framebuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindFramebuffer(context, target, framebufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindFramebuffer(target, framebufferPacked);
@@ -155,6 +160,7 @@ void GL_APIENTRY GL_BindRenderbuffer(GLenum target, GLuint renderbuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindRenderbuffer(context, target, renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindRenderbuffer(target, renderbufferPacked);
@@ -180,6 +186,7 @@ void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindTexture(context, targetPacked, texturePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindTexture(targetPacked, texturePacked);
@@ -203,6 +210,7 @@ void GL_APIENTRY GL_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendColor(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendColor(red, green, blue, alpha);
@@ -225,6 +233,7 @@ void GL_APIENTRY GL_BlendEquation(GLenum mode)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBlendEquation(context, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquation(mode);
@@ -249,6 +258,7 @@ void GL_APIENTRY GL_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparate(context, modeRGB, modeAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationSeparate(modeRGB, modeAlpha);
@@ -273,6 +283,7 @@ void GL_APIENTRY GL_BlendFunc(GLenum sfactor, GLenum dfactor)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunc(context, sfactor, dfactor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFunc(sfactor, dfactor);
@@ -304,6 +315,7 @@ void GL_APIENTRY GL_BlendFuncSeparate(GLenum sfactorRGB,
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFuncSeparate(context, sfactorRGB, dfactorRGB,
                                                                     sfactorAlpha, dfactorAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
@@ -333,6 +345,7 @@ void GL_APIENTRY GL_BufferData(GLenum target, GLsizeiptr size, const void *data,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferData(context, targetPacked, size, data, usagePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferData(targetPacked, size, data, usagePacked);
@@ -360,6 +373,7 @@ void GL_APIENTRY GL_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr siz
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferSubData(context, targetPacked, offset, size, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferSubData(targetPacked, offset, size, data);
@@ -384,6 +398,7 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatus(GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCheckFramebufferStatus(context, target));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->checkFramebufferStatus(target);
@@ -413,6 +428,7 @@ void GL_APIENTRY GL_Clear(GLbitfield mask)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClear(context, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clear(mask);
@@ -436,6 +452,7 @@ void GL_APIENTRY GL_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearColor(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearColor(red, green, blue, alpha);
@@ -457,6 +474,7 @@ void GL_APIENTRY GL_ClearDepthf(GLfloat d)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepthf(context, d));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearDepthf(d);
@@ -478,6 +496,7 @@ void GL_APIENTRY GL_ClearStencil(GLint s)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearStencil(context, s));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearStencil(s);
@@ -502,6 +521,7 @@ void GL_APIENTRY GL_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMask(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorMask(red, green, blue, alpha);
@@ -525,6 +545,7 @@ void GL_APIENTRY GL_CompileShader(GLuint shader)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCompileShader(context, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compileShader(shaderPacked);
@@ -562,6 +583,7 @@ void GL_APIENTRY GL_CompressedTexImage2D(GLenum target,
             (context->skipValidation() ||
              ValidateCompressedTexImage2D(context, targetPacked, level, internalformat, width,
                                           height, border, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage2D(targetPacked, level, internalformat, width, height,
@@ -602,6 +624,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2D(GLenum target,
             (context->skipValidation() ||
              ValidateCompressedTexSubImage2D(context, targetPacked, level, xoffset, yoffset, width,
                                              height, format, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage2D(targetPacked, level, xoffset, yoffset, width, height,
@@ -639,6 +662,7 @@ void GL_APIENTRY GL_CopyTexImage2D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTexImage2D(context, targetPacked, level, internalformat, x,
                                                    y, width, height, border));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexImage2D(targetPacked, level, internalformat, x, y, width, height,
@@ -676,6 +700,7 @@ void GL_APIENTRY GL_CopyTexSubImage2D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTexSubImage2D(context, targetPacked, level, xoffset,
                                                       yoffset, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexSubImage2D(targetPacked, level, xoffset, yoffset, x, y, width, height);
@@ -699,6 +724,7 @@ GLuint GL_APIENTRY GL_CreateProgram()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCreateProgram(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->createProgram();
@@ -729,6 +755,7 @@ GLuint GL_APIENTRY GL_CreateShader(GLenum type)
         ShaderType typePacked                                 = PackParam<ShaderType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCreateShader(context, typePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->createShader(typePacked);
@@ -758,6 +785,7 @@ void GL_APIENTRY GL_CullFace(GLenum mode)
         CullFaceMode modePacked                               = PackParam<CullFaceMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCullFace(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->cullFace(modePacked);
@@ -782,6 +810,7 @@ void GL_APIENTRY GL_DeleteBuffers(GLsizei n, const GLuint *buffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteBuffers(context, n, buffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteBuffers(n, buffersPacked);
@@ -806,6 +835,7 @@ void GL_APIENTRY GL_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteFramebuffers(context, n, framebuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteFramebuffers(n, framebuffersPacked);
@@ -829,6 +859,7 @@ void GL_APIENTRY GL_DeleteProgram(GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteProgram(programPacked);
@@ -854,6 +885,7 @@ void GL_APIENTRY GL_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteRenderbuffers(context, n, renderbuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteRenderbuffers(n, renderbuffersPacked);
@@ -877,6 +909,7 @@ void GL_APIENTRY GL_DeleteShader(GLuint shader)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteShader(context, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteShader(shaderPacked);
@@ -901,6 +934,7 @@ void GL_APIENTRY GL_DeleteTextures(GLsizei n, const GLuint *textures)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteTextures(context, n, texturesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteTextures(n, texturesPacked);
@@ -923,6 +957,7 @@ void GL_APIENTRY GL_DepthFunc(GLenum func)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthFunc(context, func));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthFunc(func);
@@ -944,6 +979,7 @@ void GL_APIENTRY GL_DepthMask(GLboolean flag)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthMask(context, flag));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthMask(flag);
@@ -965,6 +1001,7 @@ void GL_APIENTRY GL_DepthRangef(GLfloat n, GLfloat f)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRangef(context, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthRangef(n, f);
@@ -990,6 +1027,7 @@ void GL_APIENTRY GL_DetachShader(GLuint program, GLuint shader)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDetachShader(context, programPacked, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->detachShader(programPacked, shaderPacked);
@@ -1012,6 +1050,7 @@ void GL_APIENTRY GL_Disable(GLenum cap)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisable(context, cap));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disable(cap);
@@ -1034,6 +1073,7 @@ void GL_APIENTRY GL_DisableVertexAttribArray(GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableVertexAttribArray(context, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disableVertexAttribArray(index);
@@ -1054,10 +1094,16 @@ void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
 
     if (context)
     {
-        PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
+        PrimitiveMode modePacked = PackParam<PrimitiveMode>(mode);
+        if (context->isRecordingDeferredCommands() &&
+            context->recordDrawArrays(modePacked, first, count))
+        {
+            return;
+        }
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawArrays(context, modePacked, first, count));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArrays(modePacked, first, count);
@@ -1080,11 +1126,17 @@ void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const
 
     if (context)
     {
-        PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
-        DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
+        PrimitiveMode modePacked    = PackParam<PrimitiveMode>(mode);
+        DrawElementsType typePacked = PackParam<DrawElementsType>(type);
+        if (context->isRecordingDeferredCommands() &&
+            context->recordDrawElements(modePacked, count, typePacked, indices))
+        {
+            return;
+        }
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElements(context, modePacked, count, typePacked, indices));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElements(modePacked, count, typePacked, indices);
@@ -1107,6 +1159,7 @@ void GL_APIENTRY GL_Enable(GLenum cap)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnable(context, cap));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enable(cap);
@@ -1129,6 +1182,7 @@ void GL_APIENTRY GL_EnableVertexAttribArray(GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableVertexAttribArray(context, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enableVertexAttribArray(index);
@@ -1150,6 +1204,7 @@ void GL_APIENTRY GL_Finish()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFinish(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->finish();
@@ -1171,6 +1226,7 @@ void GL_APIENTRY GL_Flush()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFlush(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->flush();
@@ -1203,6 +1259,7 @@ void GL_APIENTRY GL_FramebufferRenderbuffer(GLenum target,
             (context->skipValidation() ||
              ValidateFramebufferRenderbuffer(context, target, attachment, renderbuffertarget,
                                              renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferRenderbuffer(target, attachment, renderbuffertarget,
@@ -1238,6 +1295,7 @@ void GL_APIENTRY GL_FramebufferTexture2D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferTexture2D(context, target, attachment,
                                                          textargetPacked, texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture2D(target, attachment, textargetPacked, texturePacked,
@@ -1262,6 +1320,7 @@ void GL_APIENTRY GL_FrontFace(GLenum mode)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFrontFace(context, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->frontFace(mode);
@@ -1286,6 +1345,7 @@ void GL_APIENTRY GL_GenBuffers(GLsizei n, GLuint *buffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenBuffers(context, n, buffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genBuffers(n, buffersPacked);
@@ -1310,6 +1370,7 @@ void GL_APIENTRY GL_GenFramebuffers(GLsizei n, GLuint *framebuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenFramebuffers(context, n, framebuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genFramebuffers(n, framebuffersPacked);
@@ -1334,6 +1395,7 @@ void GL_APIENTRY GL_GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGenRenderbuffers(context, n, renderbuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genRenderbuffers(n, renderbuffersPacked);
@@ -1358,6 +1420,7 @@ void GL_APIENTRY GL_GenTextures(GLsizei n, GLuint *textures)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenTextures(context, n, texturesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genTextures(n, texturesPacked);
@@ -1382,6 +1445,7 @@ void GL_APIENTRY GL_GenerateMipmap(GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenerateMipmap(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->generateMipmap(targetPacked);
@@ -1416,6 +1480,7 @@ void GL_APIENTRY GL_GetActiveAttrib(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveAttrib(context, programPacked, index, bufSize, length,
                                                     size, type, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveAttrib(programPacked, index, bufSize, length, size, type, name);
@@ -1451,6 +1516,7 @@ void GL_APIENTRY GL_GetActiveUniform(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveUniform(context, programPacked, index, bufSize, length,
                                                      size, type, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniform(programPacked, index, bufSize, length, size, type, name);
@@ -1483,6 +1549,7 @@ void GL_APIENTRY GL_GetAttachedShaders(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetAttachedShaders(context, programPacked, maxCount, count, shadersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getAttachedShaders(programPacked, maxCount, count, shadersPacked);
@@ -1509,6 +1576,7 @@ GLint GL_APIENTRY GL_GetAttribLocation(GLuint program, const GLchar *name)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetAttribLocation(context, programPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getAttribLocation(programPacked, name);
@@ -1537,6 +1605,7 @@ void GL_APIENTRY GL_GetBooleanv(GLenum pname, GLboolean *data)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetBooleanv(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBooleanv(pname, data);
@@ -1563,6 +1632,7 @@ void GL_APIENTRY GL_GetBufferParameteriv(GLenum target, GLenum pname, GLint *par
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferParameteriv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferParameteriv(targetPacked, pname, params);
@@ -1585,6 +1655,7 @@ GLenum GL_APIENTRY GL_GetError()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetError(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getError();
@@ -1613,6 +1684,7 @@ void GL_APIENTRY GL_GetFloatv(GLenum pname, GLfloat *data)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetFloatv(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFloatv(pname, data);
@@ -1644,6 +1716,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameteriv(GLenum target,
         bool isCallValid =
             (context->skipValidation() || ValidateGetFramebufferAttachmentParameteriv(
                                               context, target, attachment, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFramebufferAttachmentParameteriv(target, attachment, pname, params);
@@ -1667,6 +1740,7 @@ void GL_APIENTRY GL_GetIntegerv(GLenum pname, GLint *data)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetIntegerv(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getIntegerv(pname, data);
@@ -1697,6 +1771,7 @@ void GL_APIENTRY GL_GetProgramInfoLog(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramInfoLog(context, programPacked, bufSize, length, infoLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramInfoLog(programPacked, bufSize, length, infoLog);
@@ -1723,6 +1798,7 @@ void GL_APIENTRY GL_GetProgramiv(GLuint program, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramiv(context, programPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramiv(programPacked, pname, params);
@@ -1746,6 +1822,7 @@ void GL_APIENTRY GL_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetRenderbufferParameteriv(context, target, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getRenderbufferParameteriv(target, pname, params);
@@ -1776,6 +1853,7 @@ void GL_APIENTRY GL_GetShaderInfoLog(GLuint shader,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetShaderInfoLog(context, shaderPacked, bufSize, length, infoLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderInfoLog(shaderPacked, bufSize, length, infoLog);
@@ -1808,6 +1886,7 @@ void GL_APIENTRY GL_GetShaderPrecisionFormat(GLenum shadertype,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetShaderPrecisionFormat(context, shadertype, precisiontype,
                                                              range, precision));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
@@ -1836,6 +1915,7 @@ void GL_APIENTRY GL_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *len
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetShaderSource(context, shaderPacked, bufSize, length, source));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderSource(shaderPacked, bufSize, length, source);
@@ -1861,6 +1941,7 @@ void GL_APIENTRY GL_GetShaderiv(GLuint shader, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetShaderiv(context, shaderPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderiv(shaderPacked, pname, params);
@@ -1882,6 +1963,7 @@ const GLubyte *GL_APIENTRY GL_GetString(GLenum name)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetString(context, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getString(name);
@@ -1914,6 +1996,7 @@ void GL_APIENTRY GL_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *para
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterfv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterfv(targetPacked, pname, params);
@@ -1940,6 +2023,7 @@ void GL_APIENTRY GL_GetTexParameteriv(GLenum target, GLenum pname, GLint *params
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameteriv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameteriv(targetPacked, pname, params);
@@ -1965,6 +2049,7 @@ GLint GL_APIENTRY GL_GetUniformLocation(GLuint program, const GLchar *name)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetUniformLocation(context, programPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getUniformLocation(programPacked, name);
@@ -1997,6 +2082,7 @@ void GL_APIENTRY GL_GetUniformfv(GLuint program, GLint location, GLfloat *params
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformfv(context, programPacked, locationPacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformfv(programPacked, locationPacked, params);
@@ -2023,6 +2109,7 @@ void GL_APIENTRY GL_GetUniformiv(GLuint program, GLint location, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformiv(context, programPacked, locationPacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformiv(programPacked, locationPacked, params);
@@ -2047,6 +2134,7 @@ void GL_APIENTRY GL_GetVertexAttribPointerv(GLuint index, GLenum pname, void **p
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetVertexAttribPointerv(context, index, pname, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribPointerv(index, pname, pointer);
@@ -2071,6 +2159,7 @@ void GL_APIENTRY GL_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *param
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetVertexAttribfv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribfv(index, pname, params);
@@ -2095,6 +2184,7 @@ void GL_APIENTRY GL_GetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetVertexAttribiv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribiv(index, pname, params);
@@ -2118,6 +2208,7 @@ void GL_APIENTRY GL_Hint(GLenum target, GLenum mode)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateHint(context, target, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->hint(target, mode);
@@ -2141,6 +2232,7 @@ GLboolean GL_APIENTRY GL_IsBuffer(GLuint buffer)
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsBuffer(context, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isBuffer(bufferPacked);
@@ -2170,6 +2262,7 @@ GLboolean GL_APIENTRY GL_IsEnabled(GLenum cap)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsEnabled(context, cap));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isEnabled(cap);
@@ -2200,6 +2293,7 @@ GLboolean GL_APIENTRY GL_IsFramebuffer(GLuint framebuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsFramebuffer(context, framebufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isFramebuffer(framebufferPacked);
@@ -2229,6 +2323,7 @@ GLboolean GL_APIENTRY GL_IsProgram(GLuint program)
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isProgram(programPacked);
@@ -2259,6 +2354,7 @@ GLboolean GL_APIENTRY GL_IsRenderbuffer(GLuint renderbuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsRenderbuffer(context, renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isRenderbuffer(renderbufferPacked);
@@ -2288,6 +2384,7 @@ GLboolean GL_APIENTRY GL_IsShader(GLuint shader)
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsShader(context, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isShader(shaderPacked);
@@ -2317,6 +2414,7 @@ GLboolean GL_APIENTRY GL_IsTexture(GLuint texture)
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsTexture(context, texturePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isTexture(texturePacked);
@@ -2344,6 +2442,7 @@ void GL_APIENTRY GL_LineWidth(GLfloat width)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLineWidth(context, width));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lineWidth(width);
@@ -2367,6 +2466,7 @@ void GL_APIENTRY GL_LinkProgram(GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLinkProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->linkProgram(programPacked);
@@ -2390,6 +2490,7 @@ void GL_APIENTRY GL_PixelStorei(GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelStorei(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pixelStorei(pname, param);
@@ -2413,6 +2514,7 @@ void GL_APIENTRY GL_PolygonOffset(GLfloat factor, GLfloat units)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePolygonOffset(context, factor, units));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->polygonOffset(factor, units);
@@ -2445,6 +2547,7 @@ void GL_APIENTRY GL_ReadPixels(GLint x,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateReadPixels(context, x, y, width, height, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readPixels(x, y, width, height, format, type, pixels);
@@ -2466,6 +2569,7 @@ void GL_APIENTRY GL_ReleaseShaderCompiler()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateReleaseShaderCompiler(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->releaseShaderCompiler();
@@ -2495,6 +2599,7 @@ void GL_APIENTRY GL_RenderbufferStorage(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRenderbufferStorage(context, target, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->renderbufferStorage(target, internalformat, width, height);
@@ -2519,6 +2624,7 @@ void GL_APIENTRY GL_SampleCoverage(GLfloat value, GLboolean invert)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleCoverage(context, value, invert));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->sampleCoverage(value, invert);
@@ -2542,6 +2648,7 @@ void GL_APIENTRY GL_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateScissor(context, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scissor(x, y, width, height);
@@ -2574,6 +2681,7 @@ void GL_APIENTRY GL_ShaderBinary(GLsizei count,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateShaderBinary(context, count, shadersPacked, binaryformat, binary, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->shaderBinary(count, shadersPacked, binaryformat, binary, length);
@@ -2604,6 +2712,7 @@ void GL_APIENTRY GL_ShaderSource(GLuint shader,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateShaderSource(context, shaderPacked, count, string, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->shaderSource(shaderPacked, count, string, length);
@@ -2627,6 +2736,7 @@ void GL_APIENTRY GL_StencilFunc(GLenum func, GLint ref, GLuint mask)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilFunc(context, func, ref, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilFunc(func, ref, mask);
@@ -2651,6 +2761,7 @@ void GL_APIENTRY GL_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilFuncSeparate(context, face, func, ref, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilFuncSeparate(face, func, ref, mask);
@@ -2672,6 +2783,7 @@ void GL_APIENTRY GL_StencilMask(GLuint mask)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateStencilMask(context, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilMask(mask);
@@ -2695,6 +2807,7 @@ void GL_APIENTRY GL_StencilMaskSeparate(GLenum face, GLuint mask)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilMaskSeparate(context, face, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilMaskSeparate(face, mask);
@@ -2720,6 +2833,7 @@ void GL_APIENTRY GL_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilOp(context, fail, zfail, zpass));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilOp(fail, zfail, zpass);
@@ -2747,6 +2861,7 @@ void GL_APIENTRY GL_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilOpSeparate(context, face, sfail, dpfail, dppass));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilOpSeparate(face, sfail, dpfail, dppass);
@@ -2784,6 +2899,7 @@ void GL_APIENTRY GL_TexImage2D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexImage2D(context, targetPacked, level, internalformat, width,
                                                height, border, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage2D(targetPacked, level, internalformat, width, height, border, format,
@@ -2811,6 +2927,7 @@ void GL_APIENTRY GL_TexParameterf(GLenum target, GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterf(context, targetPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterf(targetPacked, pname, param);
@@ -2837,6 +2954,7 @@ void GL_APIENTRY GL_TexParameterfv(GLenum target, GLenum pname, const GLfloat *p
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterfv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterfv(targetPacked, pname, params);
@@ -2862,6 +2980,7 @@ void GL_APIENTRY GL_TexParameteri(GLenum target, GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameteri(context, targetPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameteri(targetPacked, pname, param);
@@ -2888,6 +3007,7 @@ void GL_APIENTRY GL_TexParameteriv(GLenum target, GLenum pname, const GLint *par
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameteriv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameteriv(targetPacked, pname, params);
@@ -2925,6 +3045,7 @@ void GL_APIENTRY GL_TexSubImage2D(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexSubImage2D(context, targetPacked, level, xoffset, yoffset,
                                                   width, height, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage2D(targetPacked, level, xoffset, yoffset, width, height, format,
@@ -2950,6 +3071,7 @@ void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform1f(context, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1f(locationPacked, v0);
@@ -2975,6 +3097,7 @@ void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform1fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1fv(locationPacked, count, value);
@@ -2998,6 +3121,7 @@ void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform1i(context, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1i(locationPacked, v0);
@@ -3023,6 +3147,7 @@ void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform1iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1iv(locationPacked, count, value);
@@ -3047,6 +3172,7 @@ void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2f(context, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2f(locationPacked, v0, v1);
@@ -3072,6 +3198,7 @@ void GL_APIENTRY GL_Uniform2fv(GLint location, GLsizei count, const GLfloat *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform2fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2fv(locationPacked, count, value);
@@ -3096,6 +3223,7 @@ void GL_APIENTRY GL_Uniform2i(GLint location, GLint v0, GLint v1)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2i(context, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2i(locationPacked, v0, v1);
@@ -3121,6 +3249,7 @@ void GL_APIENTRY GL_Uniform2iv(GLint location, GLsizei count, const GLint *value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform2iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2iv(locationPacked, count, value);
@@ -3145,6 +3274,7 @@ void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3f(context, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3f(locationPacked, v0, v1, v2);
@@ -3170,6 +3300,7 @@ void GL_APIENTRY GL_Uniform3fv(GLint location, GLsizei count, const GLfloat *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform3fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3fv(locationPacked, count, value);
@@ -3194,6 +3325,7 @@ void GL_APIENTRY GL_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3i(context, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3i(locationPacked, v0, v1, v2);
@@ -3219,6 +3351,7 @@ void GL_APIENTRY GL_Uniform3iv(GLint location, GLsizei count, const GLint *value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform3iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3iv(locationPacked, count, value);
@@ -3243,6 +3376,7 @@ void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4f(context, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4f(locationPacked, v0, v1, v2, v3);
@@ -3268,6 +3402,7 @@ void GL_APIENTRY GL_Uniform4fv(GLint location, GLsizei count, const GLfloat *val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4fv(locationPacked, count, value);
@@ -3292,6 +3427,7 @@ void GL_APIENTRY GL_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4i(context, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4i(locationPacked, v0, v1, v2, v3);
@@ -3317,6 +3453,7 @@ void GL_APIENTRY GL_Uniform4iv(GLint location, GLsizei count, const GLint *value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4iv(locationPacked, count, value);
@@ -3346,6 +3483,7 @@ void GL_APIENTRY GL_UniformMatrix2fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix2fv(locationPacked, count, transpose, value);
@@ -3376,6 +3514,7 @@ void GL_APIENTRY GL_UniformMatrix3fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix3fv(locationPacked, count, transpose, value);
@@ -3406,6 +3545,7 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix4fv(locationPacked, count, transpose, value);
@@ -3430,6 +3570,7 @@ void GL_APIENTRY GL_UseProgram(GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUseProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->useProgram(programPacked);
@@ -3453,6 +3594,7 @@ void GL_APIENTRY GL_ValidateProgram(GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateValidateProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->validateProgram(programPacked);
@@ -3474,6 +3616,7 @@ void GL_APIENTRY GL_VertexAttrib1f(GLuint index, GLfloat x)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexAttrib1f(context, index, x));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib1f(index, x);
@@ -3497,6 +3640,7 @@ void GL_APIENTRY GL_VertexAttrib1fv(GLuint index, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib1fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib1fv(index, v);
@@ -3520,6 +3664,7 @@ void GL_APIENTRY GL_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2f(context, index, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib2f(index, x, y);
@@ -3543,6 +3688,7 @@ void GL_APIENTRY GL_VertexAttrib2fv(GLuint index, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib2fv(index, v);
@@ -3566,6 +3712,7 @@ void GL_APIENTRY GL_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3f(context, index, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib3f(index, x, y, z);
@@ -3589,6 +3736,7 @@ void GL_APIENTRY GL_VertexAttrib3fv(GLuint index, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib3fv(index, v);
@@ -3612,6 +3760,7 @@ void GL_APIENTRY GL_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4f(context, index, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4f(index, x, y, z, w);
@@ -3635,6 +3784,7 @@ void GL_APIENTRY GL_VertexAttrib4fv(GLuint index, const GLfloat *v)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4fv(index, v);
@@ -3668,6 +3818,7 @@ void GL_APIENTRY GL_VertexAttribPointer(GLuint index,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribPointer(context, index, size, typePacked,
                                                         normalized, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribPointer(index, size, typePacked, normalized, stride, pointer);
@@ -3692,6 +3843,7 @@ void GL_APIENTRY GL_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateViewport(context, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->viewport(x, y, width, height);
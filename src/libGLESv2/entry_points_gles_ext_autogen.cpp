@@ -56,6 +56,7 @@ void GL_APIENTRY GL_DrawArraysInstancedBaseInstanceANGLE(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawArraysInstancedBaseInstanceANGLE(
                                 context, modePacked, first, count, instanceCount, baseInstance));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArraysInstancedBaseInstance(modePacked, first, count, instanceCount,
@@ -95,6 +96,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexBaseInstanceANGLE(GLenum mode
             (context->skipValidation() || ValidateDrawElementsInstancedBaseVertexBaseInstanceANGLE(
                                               context, modePacked, count, typePacked, indices,
                                               instanceCounts, baseVertex, baseInstance));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstancedBaseVertexBaseInstance(
@@ -132,6 +134,7 @@ void GL_APIENTRY GL_MultiDrawArraysInstancedBaseInstanceANGLE(GLenum mode,
             (context->skipValidation() ||
              ValidateMultiDrawArraysInstancedBaseInstanceANGLE(
                  context, modePacked, firsts, counts, instanceCounts, baseInstances, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawArraysInstancedBaseInstance(modePacked, firsts, counts,
@@ -174,6 +177,7 @@ GL_MultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(GLenum mode,
                             ValidateMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(
                                 context, modePacked, counts, typePacked, indices, instanceCounts,
                                 baseVertices, baseInstances, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElementsInstancedBaseVertexBaseInstance(
@@ -223,6 +227,7 @@ void GL_APIENTRY GL_CopyTexture3DANGLE(GLuint sourceId,
                                 context, sourceIdPacked, sourceLevel, destTargetPacked,
                                 destIdPacked, destLevel, internalFormat, destType, unpackFlipY,
                                 unpackPremultiplyAlpha, unpackUnmultiplyAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexture3D(sourceIdPacked, sourceLevel, destTargetPacked, destIdPacked,
@@ -280,6 +285,7 @@ void GL_APIENTRY GL_CopySubTexture3DANGLE(GLuint sourceId,
                                            destIdPacked, destLevel, xoffset, yoffset, zoffset, x, y,
                                            z, width, height, depth, unpackFlipY,
                                            unpackPremultiplyAlpha, unpackUnmultiplyAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copySubTexture3D(sourceIdPacked, sourceLevel, destTargetPacked, destIdPacked,
@@ -324,6 +330,7 @@ void GL_APIENTRY GL_BlitFramebufferANGLE(GLint srcX0,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlitFramebufferANGLE(context, srcX0, srcY0, srcX1, srcY1, dstX0,
                                                          dstY0, dstX1, dstY1, mask, filter));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask,
@@ -357,6 +364,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleANGLE(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisampleANGLE(
                                 context, target, samples, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->renderbufferStorageMultisample(target, samples, internalformat, width, height);
@@ -389,6 +397,7 @@ GL_GetTexImageANGLE(GLenum target, GLint level, GLenum format, GLenum type, void
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexImageANGLE(context, targetPacked, level, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexImage(targetPacked, level, format, type, pixels);
@@ -420,6 +429,7 @@ void GL_APIENTRY GL_GetRenderbufferImageANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetRenderbufferImageANGLE(context, target, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getRenderbufferImage(target, format, type, pixels);
@@ -452,6 +462,7 @@ void GL_APIENTRY GL_GetTexLevelParameterivANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexLevelParameterivANGLE(context, targetPacked, level, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameteriv(targetPacked, level, pname, params);
@@ -483,6 +494,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfvANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexLevelParameterfvANGLE(context, targetPacked, level, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameterfv(targetPacked, level, pname, params);
@@ -514,6 +526,7 @@ void GL_APIENTRY GL_DrawArraysInstancedANGLE(GLenum mode,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawArraysInstancedANGLE(context, modePacked, first, count, primcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArraysInstanced(modePacked, first, count, primcount);
@@ -548,6 +561,7 @@ void GL_APIENTRY GL_DrawElementsInstancedANGLE(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsInstancedANGLE(context, modePacked, count,
                                                                typePacked, indices, primcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstanced(modePacked, count, typePacked, indices, primcount);
@@ -572,6 +586,7 @@ void GL_APIENTRY GL_VertexAttribDivisorANGLE(GLuint index, GLuint divisor)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribDivisorANGLE(context, index, divisor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribDivisor(index, divisor);
@@ -614,6 +629,7 @@ void GL_APIENTRY GL_TexStorageMemFlags2DANGLE(GLenum target,
                             ValidateTexStorageMemFlags2DANGLE(
                                 context, targetPacked, levels, internalFormat, width, height,
                                 memoryPacked, offset, createFlags, usageFlags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMemFlags2D(targetPacked, levels, internalFormat, width, height,
@@ -660,6 +676,7 @@ void GL_APIENTRY GL_TexStorageMemFlags2DMultisampleANGLE(GLenum target,
              ValidateTexStorageMemFlags2DMultisampleANGLE(
                  context, targetPacked, samples, internalFormat, width, height,
                  fixedSampleLocations, memoryPacked, offset, createFlags, usageFlags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMemFlags2DMultisample(targetPacked, samples, internalFormat, width,
@@ -706,6 +723,7 @@ void GL_APIENTRY GL_TexStorageMemFlags3DANGLE(GLenum target,
                             ValidateTexStorageMemFlags3DANGLE(
                                 context, targetPacked, levels, internalFormat, width, height, depth,
                                 memoryPacked, offset, createFlags, usageFlags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMemFlags3D(targetPacked, levels, internalFormat, width, height,
@@ -754,6 +772,7 @@ void GL_APIENTRY GL_TexStorageMemFlags3DMultisampleANGLE(GLenum target,
              ValidateTexStorageMemFlags3DMultisampleANGLE(
                  context, targetPacked, samples, internalFormat, width, height, depth,
                  fixedSampleLocations, memoryPacked, offset, createFlags, usageFlags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMemFlags3DMultisample(targetPacked, samples, internalFormat, width,
@@ -790,6 +809,7 @@ void GL_APIENTRY GL_ImportMemoryZirconHandleANGLE(GLuint memory,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateImportMemoryZirconHandleANGLE(context, memoryPacked, size,
                                                                   handleTypePacked, handle));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->importMemoryZirconHandle(memoryPacked, size, handleTypePacked, handle);
@@ -823,6 +843,7 @@ void GL_APIENTRY GL_MultiDrawArraysANGLE(GLenum mode,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiDrawArraysANGLE(context, modePacked, firsts, counts, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawArrays(modePacked, firsts, counts, drawcount);
@@ -856,6 +877,7 @@ void GL_APIENTRY GL_MultiDrawArraysInstancedANGLE(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiDrawArraysInstancedANGLE(
                                 context, modePacked, firsts, counts, instanceCounts, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawArraysInstanced(modePacked, firsts, counts, instanceCounts,
@@ -891,6 +913,7 @@ void GL_APIENTRY GL_MultiDrawElementsANGLE(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiDrawElementsANGLE(context, modePacked, counts, typePacked,
                                                            indices, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElements(modePacked, counts, typePacked, indices, drawcount);
@@ -928,6 +951,7 @@ void GL_APIENTRY GL_MultiDrawElementsInstancedANGLE(GLenum mode,
             (context->skipValidation() ||
              ValidateMultiDrawElementsInstancedANGLE(context, modePacked, counts, typePacked,
                                                      indices, instanceCounts, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElementsInstanced(modePacked, counts, typePacked, indices,
@@ -942,6 +966,32 @@ void GL_APIENTRY GL_MultiDrawElementsInstancedANGLE(GLenum mode,
     }
 }
 
+// GL_ANGLE_prewarm_draw_state
+void GL_APIENTRY GL_PrewarmDrawStateANGLE(GLenum mode)
+{
+    Context *context = GetValidGlobalContext();
+    EVENT(context, GLPrewarmDrawStateANGLE, "context = %d, mode = %s", CID(context),
+          GLenumToString(GLenumGroup::PrimitiveType, mode));
+
+    if (context)
+    {
+        PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
+        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        bool isCallValid =
+            (context->skipValidation() || ValidatePrewarmDrawStateANGLE(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
+        if (isCallValid)
+        {
+            context->prewarmDrawState(modePacked);
+        }
+        ANGLE_CAPTURE(PrewarmDrawStateANGLE, isCallValid, context, modePacked);
+    }
+    else
+    {
+        GenerateContextLostErrorOnCurrentGlobalContext();
+    }
+}
+
 // GL_ANGLE_program_binary
 
 // GL_ANGLE_provoking_vertex
@@ -957,6 +1007,7 @@ void GL_APIENTRY GL_ProvokingVertexANGLE(GLenum mode)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateProvokingVertexANGLE(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->provokingVertex(modePacked);
@@ -981,6 +1032,7 @@ void GL_APIENTRY GL_RequestExtensionANGLE(const GLchar *name)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateRequestExtensionANGLE(context, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->requestExtension(name);
@@ -1004,6 +1056,7 @@ void GL_APIENTRY GL_DisableExtensionANGLE(const GLchar *name)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableExtensionANGLE(context, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disableExtension(name);
@@ -1035,6 +1088,7 @@ void GL_APIENTRY GL_GetBooleanvRobustANGLE(GLenum pname,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetBooleanvRobustANGLE(context, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBooleanvRobust(pname, bufSize, length, params);
@@ -1068,6 +1122,7 @@ void GL_APIENTRY GL_GetBufferParameterivRobustANGLE(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferParameterivRobustANGLE(context, targetPacked, pname,
                                                                     bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferParameterivRobust(targetPacked, pname, bufSize, length, params);
@@ -1098,6 +1153,7 @@ void GL_APIENTRY GL_GetFloatvRobustANGLE(GLenum pname,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFloatvRobustANGLE(context, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFloatvRobust(pname, bufSize, length, params);
@@ -1132,6 +1188,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivRobustANGLE(GLenum target
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFramebufferAttachmentParameterivRobustANGLE(
                                 context, target, attachment, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFramebufferAttachmentParameterivRobust(target, attachment, pname, bufSize,
@@ -1163,6 +1220,7 @@ void GL_APIENTRY GL_GetIntegervRobustANGLE(GLenum pname,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetIntegervRobustANGLE(context, pname, bufSize, length, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getIntegervRobust(pname, bufSize, length, data);
@@ -1195,6 +1253,7 @@ void GL_APIENTRY GL_GetProgramivRobustANGLE(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramivRobustANGLE(context, programPacked, pname, bufSize,
                                                             length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramivRobust(programPacked, pname, bufSize, length, params);
@@ -1226,6 +1285,7 @@ void GL_APIENTRY GL_GetRenderbufferParameterivRobustANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() || ValidateGetRenderbufferParameterivRobustANGLE(
                                               context, target, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getRenderbufferParameterivRobust(target, pname, bufSize, length, params);
@@ -1259,6 +1319,7 @@ void GL_APIENTRY GL_GetShaderivRobustANGLE(GLuint shader,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetShaderivRobustANGLE(context, shaderPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderivRobust(shaderPacked, pname, bufSize, length, params);
@@ -1291,6 +1352,7 @@ void GL_APIENTRY GL_GetTexParameterfvRobustANGLE(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterfvRobustANGLE(context, targetPacked, pname,
                                                                  bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterfvRobust(targetPacked, pname, bufSize, length, params);
@@ -1325,6 +1387,7 @@ void GL_APIENTRY GL_GetTexParameterivRobustANGLE(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterivRobustANGLE(context, targetPacked, pname,
                                                                  bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterivRobust(targetPacked, pname, bufSize, length, params);
@@ -1358,6 +1421,7 @@ void GL_APIENTRY GL_GetUniformfvRobustANGLE(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformfvRobustANGLE(context, programPacked, locationPacked,
                                                             bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformfvRobust(programPacked, locationPacked, bufSize, length, params);
@@ -1391,6 +1455,7 @@ void GL_APIENTRY GL_GetUniformivRobustANGLE(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformivRobustANGLE(context, programPacked, locationPacked,
                                                             bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformivRobust(programPacked, locationPacked, bufSize, length, params);
@@ -1423,6 +1488,7 @@ void GL_APIENTRY GL_GetVertexAttribfvRobustANGLE(GLuint index,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetVertexAttribfvRobustANGLE(context, index, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribfvRobust(index, pname, bufSize, length, params);
@@ -1455,6 +1521,7 @@ void GL_APIENTRY GL_GetVertexAttribivRobustANGLE(GLuint index,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetVertexAttribivRobustANGLE(context, index, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribivRobust(index, pname, bufSize, length, params);
@@ -1487,6 +1554,7 @@ void GL_APIENTRY GL_GetVertexAttribPointervRobustANGLE(GLuint index,
         bool isCallValid =
             (context->skipValidation() || ValidateGetVertexAttribPointervRobustANGLE(
                                               context, index, pname, bufSize, length, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribPointervRobust(index, pname, bufSize, length, pointer);
@@ -1528,6 +1596,7 @@ void GL_APIENTRY GL_ReadPixelsRobustANGLE(GLint x,
             (context->skipValidation() ||
              ValidateReadPixelsRobustANGLE(context, x, y, width, height, format, type, bufSize,
                                            length, columns, rows, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readPixelsRobust(x, y, width, height, format, type, bufSize, length, columns,
@@ -1569,6 +1638,7 @@ void GL_APIENTRY GL_TexImage2DRobustANGLE(GLenum target,
             (context->skipValidation() ||
              ValidateTexImage2DRobustANGLE(context, targetPacked, level, internalformat, width,
                                            height, border, format, type, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage2DRobust(targetPacked, level, internalformat, width, height, border,
@@ -1601,6 +1671,7 @@ void GL_APIENTRY GL_TexParameterfvRobustANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexParameterfvRobustANGLE(context, targetPacked, pname, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterfvRobust(targetPacked, pname, bufSize, params);
@@ -1632,6 +1703,7 @@ void GL_APIENTRY GL_TexParameterivRobustANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexParameterivRobustANGLE(context, targetPacked, pname, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterivRobust(targetPacked, pname, bufSize, params);
@@ -1672,6 +1744,7 @@ void GL_APIENTRY GL_TexSubImage2DRobustANGLE(GLenum target,
             (context->skipValidation() ||
              ValidateTexSubImage2DRobustANGLE(context, targetPacked, level, xoffset, yoffset, width,
                                               height, format, type, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage2DRobust(targetPacked, level, xoffset, yoffset, width, height,
@@ -1715,6 +1788,7 @@ void GL_APIENTRY GL_TexImage3DRobustANGLE(GLenum target,
             (context->skipValidation() ||
              ValidateTexImage3DRobustANGLE(context, targetPacked, level, internalformat, width,
                                            height, depth, border, format, type, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage3DRobust(targetPacked, level, internalformat, width, height, depth,
@@ -1760,6 +1834,7 @@ void GL_APIENTRY GL_TexSubImage3DRobustANGLE(GLenum target,
                             ValidateTexSubImage3DRobustANGLE(context, targetPacked, level, xoffset,
                                                              yoffset, zoffset, width, height, depth,
                                                              format, type, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage3DRobust(targetPacked, level, xoffset, yoffset, zoffset, width,
@@ -1800,6 +1875,7 @@ void GL_APIENTRY GL_CompressedTexImage2DRobustANGLE(GLenum target,
             (context->skipValidation() || ValidateCompressedTexImage2DRobustANGLE(
                                               context, targetPacked, level, internalformat, width,
                                               height, border, imageSize, dataSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage2DRobust(targetPacked, level, internalformat, width, height,
@@ -1841,6 +1917,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2DRobustANGLE(GLenum target,
             (context->skipValidation() || ValidateCompressedTexSubImage2DRobustANGLE(
                                               context, targetPacked, level, xoffset, yoffset, width,
                                               height, format, imageSize, dataSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage2DRobust(targetPacked, level, xoffset, yoffset, width,
@@ -1882,6 +1959,7 @@ void GL_APIENTRY GL_CompressedTexImage3DRobustANGLE(GLenum target,
             (context->skipValidation() || ValidateCompressedTexImage3DRobustANGLE(
                                               context, targetPacked, level, internalformat, width,
                                               height, depth, border, imageSize, dataSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage3DRobust(targetPacked, level, internalformat, width, height,
@@ -1926,6 +2004,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3DRobustANGLE(GLenum target,
                             ValidateCompressedTexSubImage3DRobustANGLE(
                                 context, targetPacked, level, xoffset, yoffset, zoffset, width,
                                 height, depth, format, imageSize, dataSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage3DRobust(targetPacked, level, xoffset, yoffset, zoffset,
@@ -1963,6 +2042,7 @@ void GL_APIENTRY GL_GetQueryivRobustANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetQueryivRobustANGLE(context, targetPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryivRobust(targetPacked, pname, bufSize, length, params);
@@ -1996,6 +2076,7 @@ void GL_APIENTRY GL_GetQueryObjectuivRobustANGLE(GLuint id,
         bool isCallValid =
             (context->skipValidation() || ValidateGetQueryObjectuivRobustANGLE(
                                               context, idPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectuivRobust(idPacked, pname, bufSize, length, params);
@@ -2030,6 +2111,7 @@ void GL_APIENTRY GL_GetBufferPointervRobustANGLE(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferPointervRobustANGLE(context, targetPacked, pname,
                                                                  bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferPointervRobust(targetPacked, pname, bufSize, length, params);
@@ -2062,6 +2144,7 @@ void GL_APIENTRY GL_GetIntegeri_vRobustANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetIntegeri_vRobustANGLE(context, target, index, bufSize, length, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getIntegeri_vRobust(target, index, bufSize, length, data);
@@ -2097,6 +2180,7 @@ void GL_APIENTRY GL_GetInternalformativRobustANGLE(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetInternalformativRobustANGLE(context, target, internalformat,
                                                                    pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInternalformativRobust(target, internalformat, pname, bufSize, length,
@@ -2130,6 +2214,7 @@ void GL_APIENTRY GL_GetVertexAttribIivRobustANGLE(GLuint index,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetVertexAttribIivRobustANGLE(context, index, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribIivRobust(index, pname, bufSize, length, params);
@@ -2162,6 +2247,7 @@ void GL_APIENTRY GL_GetVertexAttribIuivRobustANGLE(GLuint index,
         bool isCallValid =
             (context->skipValidation() || ValidateGetVertexAttribIuivRobustANGLE(
                                               context, index, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribIuivRobust(index, pname, bufSize, length, params);
@@ -2195,6 +2281,7 @@ void GL_APIENTRY GL_GetUniformuivRobustANGLE(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformuivRobustANGLE(context, programPacked, locationPacked,
                                                              bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformuivRobust(programPacked, locationPacked, bufSize, length, params);
@@ -2232,6 +2319,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockivRobustANGLE(GLuint program,
             (context->skipValidation() ||
              ValidateGetActiveUniformBlockivRobustANGLE(
                  context, programPacked, uniformBlockIndexPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniformBlockivRobust(programPacked, uniformBlockIndexPacked, pname,
@@ -2264,6 +2352,7 @@ void GL_APIENTRY GL_GetInteger64vRobustANGLE(GLenum pname,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetInteger64vRobustANGLE(context, pname, bufSize, length, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInteger64vRobust(pname, bufSize, length, data);
@@ -2295,6 +2384,7 @@ void GL_APIENTRY GL_GetInteger64i_vRobustANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetInteger64i_vRobustANGLE(context, target, index, bufSize, length, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInteger64i_vRobust(target, index, bufSize, length, data);
@@ -2329,6 +2419,7 @@ void GL_APIENTRY GL_GetBufferParameteri64vRobustANGLE(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferParameteri64vRobustANGLE(context, targetPacked, pname,
                                                                       bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferParameteri64vRobust(targetPacked, pname, bufSize, length, params);
@@ -2359,6 +2450,7 @@ void GL_APIENTRY GL_SamplerParameterivRobustANGLE(GLuint sampler,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSamplerParameterivRobustANGLE(context, samplerPacked, pname, bufSize, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterivRobust(samplerPacked, pname, bufSize, param);
@@ -2390,6 +2482,7 @@ void GL_APIENTRY GL_SamplerParameterfvRobustANGLE(GLuint sampler,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSamplerParameterfvRobustANGLE(context, samplerPacked, pname, bufSize, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterfvRobust(samplerPacked, pname, bufSize, param);
@@ -2423,6 +2516,7 @@ void GL_APIENTRY GL_GetSamplerParameterivRobustANGLE(GLuint sampler,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterivRobustANGLE(context, samplerPacked, pname,
                                                                      bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterivRobust(samplerPacked, pname, bufSize, length, params);
@@ -2456,6 +2550,7 @@ void GL_APIENTRY GL_GetSamplerParameterfvRobustANGLE(GLuint sampler,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterfvRobustANGLE(context, samplerPacked, pname,
                                                                      bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterfvRobust(samplerPacked, pname, bufSize, length, params);
@@ -2489,6 +2584,7 @@ void GL_APIENTRY GL_GetFramebufferParameterivRobustANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() || ValidateGetFramebufferParameterivRobustANGLE(
                                               context, target, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFramebufferParameterivRobust(target, pname, bufSize, length, params);
@@ -2525,6 +2621,7 @@ void GL_APIENTRY GL_GetProgramInterfaceivRobustANGLE(GLuint program,
             (context->skipValidation() ||
              ValidateGetProgramInterfaceivRobustANGLE(context, programPacked, programInterface,
                                                       pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramInterfaceivRobust(programPacked, programInterface, pname, bufSize,
@@ -2558,6 +2655,7 @@ void GL_APIENTRY GL_GetBooleani_vRobustANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetBooleani_vRobustANGLE(context, target, index, bufSize, length, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBooleani_vRobust(target, index, bufSize, length, data);
@@ -2590,6 +2688,7 @@ void GL_APIENTRY GL_GetMultisamplefvRobustANGLE(GLenum pname,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetMultisamplefvRobustANGLE(context, pname, index, bufSize, length, val));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMultisamplefvRobust(pname, index, bufSize, length, val);
@@ -2625,6 +2724,7 @@ void GL_APIENTRY GL_GetTexLevelParameterivRobustANGLE(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexLevelParameterivRobustANGLE(
                                 context, targetPacked, level, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameterivRobust(targetPacked, level, pname, bufSize, length,
@@ -2661,6 +2761,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfvRobustANGLE(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexLevelParameterfvRobustANGLE(
                                 context, targetPacked, level, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameterfvRobust(targetPacked, level, pname, bufSize, length,
@@ -2693,6 +2794,7 @@ void GL_APIENTRY GL_GetPointervRobustANGLERobustANGLE(GLenum pname,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetPointervRobustANGLERobustANGLE(context, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getPointervRobustANGLERobust(pname, bufSize, length, params);
@@ -2734,6 +2836,7 @@ void GL_APIENTRY GL_ReadnPixelsRobustANGLE(GLint x,
             (context->skipValidation() ||
              ValidateReadnPixelsRobustANGLE(context, x, y, width, height, format, type, bufSize,
                                             length, columns, rows, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readnPixelsRobust(x, y, width, height, format, type, bufSize, length, columns,
@@ -2768,6 +2871,7 @@ void GL_APIENTRY GL_GetnUniformfvRobustANGLE(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnUniformfvRobustANGLE(context, programPacked, locationPacked,
                                                              bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformfvRobust(programPacked, locationPacked, bufSize, length, params);
@@ -2801,6 +2905,7 @@ void GL_APIENTRY GL_GetnUniformivRobustANGLE(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnUniformivRobustANGLE(context, programPacked, locationPacked,
                                                              bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformivRobust(programPacked, locationPacked, bufSize, length, params);
@@ -2834,6 +2939,7 @@ void GL_APIENTRY GL_GetnUniformuivRobustANGLE(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnUniformuivRobustANGLE(
                                 context, programPacked, locationPacked, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformuivRobust(programPacked, locationPacked, bufSize, length, params);
@@ -2865,6 +2971,7 @@ void GL_APIENTRY GL_TexParameterIivRobustANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexParameterIivRobustANGLE(context, targetPacked, pname, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIivRobust(targetPacked, pname, bufSize, params);
@@ -2896,6 +3003,7 @@ void GL_APIENTRY GL_TexParameterIuivRobustANGLE(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexParameterIuivRobustANGLE(context, targetPacked, pname, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIuivRobust(targetPacked, pname, bufSize, params);
@@ -2930,6 +3038,7 @@ void GL_APIENTRY GL_GetTexParameterIivRobustANGLE(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIivRobustANGLE(context, targetPacked, pname,
                                                                   bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIivRobust(targetPacked, pname, bufSize, length, params);
@@ -2964,6 +3073,7 @@ void GL_APIENTRY GL_GetTexParameterIuivRobustANGLE(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIuivRobustANGLE(context, targetPacked, pname,
                                                                    bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIuivRobust(targetPacked, pname, bufSize, length, params);
@@ -2995,6 +3105,7 @@ void GL_APIENTRY GL_SamplerParameterIivRobustANGLE(GLuint sampler,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSamplerParameterIivRobustANGLE(context, samplerPacked, pname, bufSize, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIivRobust(samplerPacked, pname, bufSize, param);
@@ -3026,6 +3137,7 @@ void GL_APIENTRY GL_SamplerParameterIuivRobustANGLE(GLuint sampler,
         bool isCallValid =
             (context->skipValidation() || ValidateSamplerParameterIuivRobustANGLE(
                                               context, samplerPacked, pname, bufSize, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIuivRobust(samplerPacked, pname, bufSize, param);
@@ -3059,6 +3171,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivRobustANGLE(GLuint sampler,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterIivRobustANGLE(context, samplerPacked, pname,
                                                                       bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIivRobust(samplerPacked, pname, bufSize, length, params);
@@ -3092,6 +3205,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivRobustANGLE(GLuint sampler,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterIuivRobustANGLE(
                                 context, samplerPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIuivRobust(samplerPacked, pname, bufSize, length, params);
@@ -3125,6 +3239,7 @@ void GL_APIENTRY GL_GetQueryObjectivRobustANGLE(GLuint id,
         bool isCallValid =
             (context->skipValidation() || ValidateGetQueryObjectivRobustANGLE(
                                               context, idPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectivRobust(idPacked, pname, bufSize, length, params);
@@ -3156,6 +3271,7 @@ void GL_APIENTRY GL_GetQueryObjecti64vRobustANGLE(GLuint id,
         bool isCallValid =
             (context->skipValidation() || ValidateGetQueryObjecti64vRobustANGLE(
                                               context, idPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjecti64vRobust(idPacked, pname, bufSize, length, params);
@@ -3187,6 +3303,7 @@ void GL_APIENTRY GL_GetQueryObjectui64vRobustANGLE(GLuint id,
         bool isCallValid =
             (context->skipValidation() || ValidateGetQueryObjectui64vRobustANGLE(
                                               context, idPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectui64vRobust(idPacked, pname, bufSize, length, params);
@@ -3218,6 +3335,7 @@ void GL_APIENTRY GL_ImportSemaphoreZirconHandleANGLE(GLuint semaphore,
         bool isCallValid =
             (context->skipValidation() || ValidateImportSemaphoreZirconHandleANGLE(
                                               context, semaphorePacked, handleTypePacked, handle));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->importSemaphoreZirconHandle(semaphorePacked, handleTypePacked, handle);
@@ -3257,6 +3375,7 @@ void GL_APIENTRY GL_TexImage2DExternalANGLE(GLenum target,
             (context->skipValidation() ||
              ValidateTexImage2DExternalANGLE(context, targetPacked, level, internalformat, width,
                                              height, border, format, type));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage2DExternal(targetPacked, level, internalformat, width, height, border,
@@ -3283,6 +3402,7 @@ void GL_APIENTRY GL_InvalidateTextureANGLE(GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateInvalidateTextureANGLE(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateTexture(targetPacked);
@@ -3319,6 +3439,7 @@ void GL_APIENTRY GL_TexStorage2DMultisampleANGLE(GLenum target,
             (context->skipValidation() ||
              ValidateTexStorage2DMultisampleANGLE(context, targetPacked, samples, internalformat,
                                                   width, height, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage2DMultisample(targetPacked, samples, internalformat, width, height,
@@ -3345,6 +3466,7 @@ void GL_APIENTRY GL_GetMultisamplefvANGLE(GLenum pname, GLuint index, GLfloat *v
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetMultisamplefvANGLE(context, pname, index, val));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMultisamplefv(pname, index, val);
@@ -3368,6 +3490,7 @@ void GL_APIENTRY GL_SampleMaskiANGLE(GLuint maskNumber, GLbitfield mask)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleMaskiANGLE(context, maskNumber, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->sampleMaski(maskNumber, mask);
@@ -3403,6 +3526,7 @@ void GL_APIENTRY GL_GetTranslatedShaderSourceANGLE(GLuint shader,
         bool isCallValid =
             (context->skipValidation() || ValidateGetTranslatedShaderSourceANGLE(
                                               context, shaderPacked, bufsize, length, source));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTranslatedShaderSource(shaderPacked, bufsize, length, source);
@@ -3432,6 +3556,7 @@ void GL_APIENTRY GL_BindUniformLocationCHROMIUM(GLuint program, GLint location,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindUniformLocationCHROMIUM(context, programPacked, locationPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindUniformLocation(programPacked, locationPacked, name);
@@ -3460,6 +3585,7 @@ void GL_APIENTRY GL_CompressedCopyTextureCHROMIUM(GLuint sourceId, GLuint destId
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCompressedCopyTextureCHROMIUM(context, sourceIdPacked, destIdPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedCopyTexture(sourceIdPacked, destIdPacked);
@@ -3506,6 +3632,7 @@ void GL_APIENTRY GL_CopyTextureCHROMIUM(GLuint sourceId,
                                 context, sourceIdPacked, sourceLevel, destTargetPacked,
                                 destIdPacked, destLevel, internalFormat, destType, unpackFlipY,
                                 unpackPremultiplyAlpha, unpackUnmultiplyAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexture(sourceIdPacked, sourceLevel, destTargetPacked, destIdPacked,
@@ -3558,6 +3685,7 @@ void GL_APIENTRY GL_CopySubTextureCHROMIUM(GLuint sourceId,
                                 context, sourceIdPacked, sourceLevel, destTargetPacked,
                                 destIdPacked, destLevel, xoffset, yoffset, x, y, width, height,
                                 unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copySubTexture(sourceIdPacked, sourceLevel, destTargetPacked, destIdPacked,
@@ -3586,6 +3714,7 @@ void GL_APIENTRY GL_CoverageModulationCHROMIUM(GLenum components)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCoverageModulationCHROMIUM(context, components));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->coverageModulation(components);
@@ -3613,6 +3742,7 @@ void GL_APIENTRY GL_LoseContextCHROMIUM(GLenum current, GLenum other)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateLoseContextCHROMIUM(context, currentPacked, otherPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loseContext(currentPacked, otherPacked);
@@ -3643,6 +3773,7 @@ void GL_APIENTRY GL_BindFragDataLocationEXT(GLuint program, GLuint color, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindFragDataLocationEXT(context, programPacked, color, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindFragDataLocation(programPacked, color, name);
@@ -3672,6 +3803,7 @@ void GL_APIENTRY GL_BindFragDataLocationIndexedEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() || ValidateBindFragDataLocationIndexedEXT(
                                               context, programPacked, colorNumber, index, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindFragDataLocationIndexed(programPacked, colorNumber, index, name);
@@ -3698,6 +3830,7 @@ GLint GL_APIENTRY GL_GetFragDataIndexEXT(GLuint program, const GLchar *name)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFragDataIndexEXT(context, programPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getFragDataIndex(programPacked, name);
@@ -3734,6 +3867,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocationIndexEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() || ValidateGetProgramResourceLocationIndexEXT(
                                               context, programPacked, programInterface, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue =
@@ -3776,6 +3910,7 @@ void GL_APIENTRY GL_BufferStorageEXT(GLenum target,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferStorageEXT(context, targetPacked, size, data, flags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferStorage(targetPacked, size, data, flags);
@@ -3801,6 +3936,7 @@ void GL_APIENTRY GL_ClipControlEXT(GLenum origin, GLenum depth)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClipControlEXT(context, origin, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clipControl(origin, depth);
@@ -3848,6 +3984,7 @@ void GL_APIENTRY GL_CopyImageSubDataEXT(GLuint srcName,
              ValidateCopyImageSubDataEXT(context, srcName, srcTarget, srcLevel, srcX, srcY, srcZ,
                                          dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth,
                                          srcHeight, srcDepth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName,
@@ -3881,6 +4018,7 @@ GL_GetObjectLabelEXT(GLenum type, GLuint object, GLsizei bufSize, GLsizei *lengt
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetObjectLabelEXT(context, type, object, bufSize, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getObjectLabel(type, object, bufSize, length, label);
@@ -3907,6 +4045,7 @@ void GL_APIENTRY GL_LabelObjectEXT(GLenum type, GLuint object, GLsizei length, c
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateLabelObjectEXT(context, type, object, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->labelObject(type, object, length, label);
@@ -3933,6 +4072,7 @@ void GL_APIENTRY GL_InsertEventMarkerEXT(GLsizei length, const GLchar *marker)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateInsertEventMarkerEXT(context, length, marker));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->insertEventMarker(length, marker);
@@ -3956,6 +4096,7 @@ void GL_APIENTRY GL_PopGroupMarkerEXT()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopGroupMarkerEXT(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popGroupMarker();
@@ -3981,6 +4122,7 @@ void GL_APIENTRY GL_PushGroupMarkerEXT(GLsizei length, const GLchar *marker)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePushGroupMarkerEXT(context, length, marker));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushGroupMarker(length, marker);
@@ -4010,6 +4152,7 @@ void GL_APIENTRY GL_DiscardFramebufferEXT(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDiscardFramebufferEXT(context, target, numAttachments, attachments));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->discardFramebuffer(target, numAttachments, attachments);
@@ -4037,6 +4180,7 @@ void GL_APIENTRY GL_BeginQueryEXT(GLenum target, GLuint id)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBeginQueryEXT(context, targetPacked, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->beginQuery(targetPacked, idPacked);
@@ -4061,6 +4205,7 @@ void GL_APIENTRY GL_DeleteQueriesEXT(GLsizei n, const GLuint *ids)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteQueriesEXT(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteQueries(n, idsPacked);
@@ -4085,6 +4230,7 @@ void GL_APIENTRY GL_EndQueryEXT(GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEndQueryEXT(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->endQuery(targetPacked);
@@ -4109,6 +4255,7 @@ void GL_APIENTRY GL_GenQueriesEXT(GLsizei n, GLuint *ids)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenQueriesEXT(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genQueries(n, idsPacked);
@@ -4132,6 +4279,7 @@ void GL_APIENTRY GL_GetInteger64vEXT(GLenum pname, GLint64 *data)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetInteger64vEXT(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInteger64v(pname, data);
@@ -4157,6 +4305,7 @@ void GL_APIENTRY GL_GetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64 *para
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjecti64vEXT(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjecti64v(idPacked, pname, params);
@@ -4180,6 +4329,7 @@ void GL_APIENTRY GL_GetQueryObjectivEXT(GLuint id, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjectivEXT(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectiv(idPacked, pname, params);
@@ -4203,6 +4353,7 @@ void GL_APIENTRY GL_GetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64 *pa
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjectui64vEXT(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectui64v(idPacked, pname, params);
@@ -4228,6 +4379,7 @@ void GL_APIENTRY GL_GetQueryObjectuivEXT(GLuint id, GLenum pname, GLuint *params
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjectuivEXT(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectuiv(idPacked, pname, params);
@@ -4254,6 +4406,7 @@ void GL_APIENTRY GL_GetQueryivEXT(GLenum target, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryivEXT(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryiv(targetPacked, pname, params);
@@ -4277,6 +4430,7 @@ GLboolean GL_APIENTRY GL_IsQueryEXT(GLuint id)
         QueryID idPacked                                      = PackParam<QueryID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsQueryEXT(context, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isQuery(idPacked);
@@ -4308,6 +4462,7 @@ void GL_APIENTRY GL_QueryCounterEXT(GLuint id, GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateQueryCounterEXT(context, idPacked, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->queryCounter(idPacked, targetPacked);
@@ -4331,6 +4486,7 @@ void GL_APIENTRY GL_DrawBuffersEXT(GLsizei n, const GLenum *bufs)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawBuffersEXT(context, n, bufs));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawBuffers(n, bufs);
@@ -4357,6 +4513,7 @@ void GL_APIENTRY GL_BlendEquationSeparateiEXT(GLuint buf, GLenum modeRGB, GLenum
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparateiEXT(context, buf, modeRGB, modeAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationSeparatei(buf, modeRGB, modeAlpha);
@@ -4380,6 +4537,7 @@ void GL_APIENTRY GL_BlendEquationiEXT(GLuint buf, GLenum mode)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationiEXT(context, buf, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationi(buf, mode);
@@ -4409,6 +4567,7 @@ GL_BlendFuncSeparateiEXT(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlp
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendFuncSeparateiEXT(context, buf, srcRGB, dstRGB, srcAlpha, dstAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
@@ -4434,6 +4593,7 @@ void GL_APIENTRY GL_BlendFunciEXT(GLuint buf, GLenum src, GLenum dst)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunciEXT(context, buf, src, dst));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFunci(buf, src, dst);
@@ -4458,6 +4618,7 @@ void GL_APIENTRY GL_ColorMaskiEXT(GLuint index, GLboolean r, GLboolean g, GLbool
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaskiEXT(context, index, r, g, b, a));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorMaski(index, r, g, b, a);
@@ -4481,6 +4642,7 @@ void GL_APIENTRY GL_DisableiEXT(GLenum target, GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableiEXT(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disablei(target, index);
@@ -4504,6 +4666,7 @@ void GL_APIENTRY GL_EnableiEXT(GLenum target, GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableiEXT(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enablei(target, index);
@@ -4528,6 +4691,7 @@ GLboolean GL_APIENTRY GL_IsEnablediEXT(GLenum target, GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsEnablediEXT(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isEnabledi(target, index);
@@ -4568,6 +4732,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertexEXT(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsBaseVertexEXT(context, modePacked, count,
                                                               typePacked, indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsBaseVertex(modePacked, count, typePacked, indices, basevertex);
@@ -4604,6 +4769,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexEXT(GLenum mode,
         bool isCallValid = (context->skipValidation() || ValidateDrawElementsInstancedBaseVertexEXT(
                                                              context, modePacked, count, typePacked,
                                                              indices, instancecount, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstancedBaseVertex(modePacked, count, typePacked, indices,
@@ -4641,6 +4807,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexEXT(GLenum mode,
         bool isCallValid = (context->skipValidation() || ValidateDrawRangeElementsBaseVertexEXT(
                                                              context, modePacked, start, end, count,
                                                              typePacked, indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawRangeElementsBaseVertex(modePacked, start, end, count, typePacked, indices,
@@ -4678,6 +4845,7 @@ void GL_APIENTRY GL_MultiDrawElementsBaseVertexEXT(GLenum mode,
         bool isCallValid = (context->skipValidation() || ValidateMultiDrawElementsBaseVertexEXT(
                                                              context, modePacked, count, typePacked,
                                                              indices, primcount, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElementsBaseVertex(modePacked, count, typePacked, indices, primcount,
@@ -4715,6 +4883,7 @@ void GL_APIENTRY GL_BufferStorageExternalEXT(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferStorageExternalEXT(context, targetPacked, offset, size,
                                                              clientBuffer, flags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferStorageExternal(targetPacked, offset, size, clientBuffer, flags);
@@ -4748,6 +4917,7 @@ void GL_APIENTRY GL_NamedBufferStorageExternalEXT(GLuint buffer,
         bool isCallValid =
             (context->skipValidation() || ValidateNamedBufferStorageExternalEXT(
                                               context, buffer, offset, size, clientBuffer, flags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedBufferStorageExternal(buffer, offset, size, clientBuffer, flags);
@@ -4780,6 +4950,7 @@ void GL_APIENTRY GL_FramebufferTextureEXT(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateFramebufferTextureEXT(context, target, attachment, texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture(target, attachment, texturePacked, level);
@@ -4811,6 +4982,7 @@ void GL_APIENTRY GL_DrawArraysInstancedEXT(GLenum mode,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawArraysInstancedEXT(context, modePacked, start, count, primcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArraysInstanced(modePacked, start, count, primcount);
@@ -4845,6 +5017,7 @@ void GL_APIENTRY GL_DrawElementsInstancedEXT(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsInstancedEXT(context, modePacked, count, typePacked,
                                                              indices, primcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstanced(modePacked, count, typePacked, indices, primcount);
@@ -4869,6 +5042,7 @@ void GL_APIENTRY GL_VertexAttribDivisorEXT(GLuint index, GLuint divisor)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribDivisorEXT(context, index, divisor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribDivisor(index, divisor);
@@ -4897,6 +5071,7 @@ void GL_APIENTRY GL_FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GL
         bool isCallValid =
             (context->skipValidation() ||
              ValidateFlushMappedBufferRangeEXT(context, targetPacked, offset, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->flushMappedBufferRange(targetPacked, offset, length);
@@ -4930,6 +5105,7 @@ void *GL_APIENTRY GL_MapBufferRangeEXT(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMapBufferRangeEXT(context, targetPacked, offset, length, access));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->mapBufferRange(targetPacked, offset, length, access);
@@ -4969,6 +5145,7 @@ void GL_APIENTRY GL_BufferStorageMemEXT(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBufferStorageMemEXT(context, targetPacked, size, memoryPacked, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferStorageMem(targetPacked, size, memoryPacked, offset);
@@ -4995,6 +5172,7 @@ void GL_APIENTRY GL_CreateMemoryObjectsEXT(GLsizei n, GLuint *memoryObjects)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCreateMemoryObjectsEXT(context, n, memoryObjectsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->createMemoryObjects(n, memoryObjectsPacked);
@@ -5021,6 +5199,7 @@ void GL_APIENTRY GL_DeleteMemoryObjectsEXT(GLsizei n, const GLuint *memoryObject
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteMemoryObjectsEXT(context, n, memoryObjectsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteMemoryObjects(n, memoryObjectsPacked);
@@ -5048,6 +5227,7 @@ void GL_APIENTRY GL_GetMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pn
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetMemoryObjectParameterivEXT(context, memoryObjectPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMemoryObjectParameteriv(memoryObjectPacked, pname, params);
@@ -5072,6 +5252,7 @@ void GL_APIENTRY GL_GetUnsignedBytevEXT(GLenum pname, GLubyte *data)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetUnsignedBytevEXT(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUnsignedBytev(pname, data);
@@ -5096,6 +5277,7 @@ void GL_APIENTRY GL_GetUnsignedBytei_vEXT(GLenum target, GLuint index, GLubyte *
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUnsignedBytei_vEXT(context, target, index, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUnsignedBytei_v(target, index, data);
@@ -5121,6 +5303,7 @@ GLboolean GL_APIENTRY GL_IsMemoryObjectEXT(GLuint memoryObject)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsMemoryObjectEXT(context, memoryObjectPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isMemoryObject(memoryObjectPacked);
@@ -5157,6 +5340,7 @@ void GL_APIENTRY GL_MemoryObjectParameterivEXT(GLuint memoryObject,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMemoryObjectParameterivEXT(context, memoryObjectPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->memoryObjectParameteriv(memoryObjectPacked, pname, params);
@@ -5195,6 +5379,7 @@ void GL_APIENTRY GL_TexStorageMem2DEXT(GLenum target,
             (context->skipValidation() ||
              ValidateTexStorageMem2DEXT(context, targetPacked, levels, internalFormat, width,
                                         height, memoryPacked, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMem2D(targetPacked, levels, internalFormat, width, height,
@@ -5235,6 +5420,7 @@ void GL_APIENTRY GL_TexStorageMem2DMultisampleEXT(GLenum target,
             (context->skipValidation() || ValidateTexStorageMem2DMultisampleEXT(
                                               context, targetPacked, samples, internalFormat, width,
                                               height, fixedSampleLocations, memoryPacked, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMem2DMultisample(targetPacked, samples, internalFormat, width,
@@ -5275,6 +5461,7 @@ void GL_APIENTRY GL_TexStorageMem3DEXT(GLenum target,
             (context->skipValidation() ||
              ValidateTexStorageMem3DEXT(context, targetPacked, levels, internalFormat, width,
                                         height, depth, memoryPacked, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMem3D(targetPacked, levels, internalFormat, width, height, depth,
@@ -5316,6 +5503,7 @@ void GL_APIENTRY GL_TexStorageMem3DMultisampleEXT(GLenum target,
                             ValidateTexStorageMem3DMultisampleEXT(
                                 context, targetPacked, samples, internalFormat, width, height,
                                 depth, fixedSampleLocations, memoryPacked, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMem3DMultisample(targetPacked, samples, internalFormat, width,
@@ -5349,6 +5537,7 @@ void GL_APIENTRY GL_ImportMemoryFdEXT(GLuint memory, GLuint64 size, GLenum handl
         bool isCallValid =
             (context->skipValidation() ||
              ValidateImportMemoryFdEXT(context, memoryPacked, size, handleTypePacked, fd));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->importMemoryFd(memoryPacked, size, handleTypePacked, fd);
@@ -5387,6 +5576,7 @@ void GL_APIENTRY GL_FramebufferTexture2DMultisampleEXT(GLenum target,
             (context->skipValidation() ||
              ValidateFramebufferTexture2DMultisampleEXT(
                  context, target, attachment, textargetPacked, texturePacked, level, samples));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture2DMultisample(target, attachment, textargetPacked,
@@ -5419,6 +5609,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleEXT(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisampleEXT(
                                 context, target, samples, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->renderbufferStorageMultisampleEXT(target, samples, internalformat, width,
@@ -5470,6 +5661,7 @@ void GL_APIENTRY GL_PrimitiveBoundingBoxEXT(GLfloat minX,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePrimitiveBoundingBoxEXT(context, minX, minY, minZ, minW, maxX,
                                                             maxY, maxZ, maxW));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->primitiveBoundingBox(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
@@ -5497,6 +5689,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatusEXT()
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetGraphicsResetStatusEXT(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getGraphicsResetStatus();
@@ -5535,6 +5728,7 @@ void GL_APIENTRY GL_GetnUniformfvEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnUniformfvEXT(context, programPacked, locationPacked, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformfv(programPacked, locationPacked, bufSize, params);
@@ -5563,6 +5757,7 @@ void GL_APIENTRY GL_GetnUniformivEXT(GLuint program, GLint location, GLsizei buf
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnUniformivEXT(context, programPacked, locationPacked, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformiv(programPacked, locationPacked, bufSize, params);
@@ -5598,6 +5793,7 @@ void GL_APIENTRY GL_ReadnPixelsEXT(GLint x,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateReadnPixelsEXT(context, x, y, width, height, format, type, bufSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readnPixels(x, y, width, height, format, type, bufSize, data);
@@ -5626,6 +5822,7 @@ void GL_APIENTRY GL_DeleteSemaphoresEXT(GLsizei n, const GLuint *semaphores)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteSemaphoresEXT(context, n, semaphoresPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteSemaphores(n, semaphoresPacked);
@@ -5650,6 +5847,7 @@ void GL_APIENTRY GL_GenSemaphoresEXT(GLsizei n, GLuint *semaphores)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenSemaphoresEXT(context, n, semaphoresPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genSemaphores(n, semaphoresPacked);
@@ -5676,6 +5874,7 @@ void GL_APIENTRY GL_GetSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSemaphoreParameterui64vEXT(context, semaphorePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSemaphoreParameterui64v(semaphorePacked, pname, params);
@@ -5701,6 +5900,7 @@ GLboolean GL_APIENTRY GL_IsSemaphoreEXT(GLuint semaphore)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsSemaphoreEXT(context, semaphorePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isSemaphore(semaphorePacked);
@@ -5735,6 +5935,7 @@ void GL_APIENTRY GL_SemaphoreParameterui64vEXT(GLuint semaphore,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSemaphoreParameterui64vEXT(context, semaphorePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->semaphoreParameterui64v(semaphorePacked, pname, params);
@@ -5772,6 +5973,7 @@ void GL_APIENTRY GL_SignalSemaphoreEXT(GLuint semaphore,
             (context->skipValidation() ||
              ValidateSignalSemaphoreEXT(context, semaphorePacked, numBufferBarriers, buffersPacked,
                                         numTextureBarriers, texturesPacked, dstLayouts));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->signalSemaphore(semaphorePacked, numBufferBarriers, buffersPacked,
@@ -5810,6 +6012,7 @@ void GL_APIENTRY GL_WaitSemaphoreEXT(GLuint semaphore,
             (context->skipValidation() ||
              ValidateWaitSemaphoreEXT(context, semaphorePacked, numBufferBarriers, buffersPacked,
                                       numTextureBarriers, texturesPacked, srcLayouts));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->waitSemaphore(semaphorePacked, numBufferBarriers, buffersPacked,
@@ -5843,6 +6046,7 @@ void GL_APIENTRY GL_ImportSemaphoreFdEXT(GLuint semaphore, GLenum handleType, GL
         bool isCallValid =
             (context->skipValidation() ||
              ValidateImportSemaphoreFdEXT(context, semaphorePacked, handleTypePacked, fd));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->importSemaphoreFd(semaphorePacked, handleTypePacked, fd);
@@ -5870,6 +6074,7 @@ void GL_APIENTRY GL_ActiveShaderProgramEXT(GLuint pipeline, GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateActiveShaderProgramEXT(context, pipelinePacked, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->activeShaderProgram(pipelinePacked, programPacked);
@@ -5893,6 +6098,7 @@ void GL_APIENTRY GL_BindProgramPipelineEXT(GLuint pipeline)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindProgramPipelineEXT(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindProgramPipeline(pipelinePacked);
@@ -5919,6 +6125,7 @@ GLuint GL_APIENTRY GL_CreateShaderProgramvEXT(GLenum type, GLsizei count, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCreateShaderProgramvEXT(context, typePacked, count, strings));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->createShaderProgramv(typePacked, count, strings);
@@ -5952,6 +6159,7 @@ void GL_APIENTRY GL_DeleteProgramPipelinesEXT(GLsizei n, const GLuint *pipelines
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteProgramPipelinesEXT(context, n, pipelinesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteProgramPipelines(n, pipelinesPacked);
@@ -5976,6 +6184,7 @@ void GL_APIENTRY GL_GenProgramPipelinesEXT(GLsizei n, GLuint *pipelines)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGenProgramPipelinesEXT(context, n, pipelinesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genProgramPipelines(n, pipelinesPacked);
@@ -6006,6 +6215,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLogEXT(GLuint pipeline,
         bool isCallValid =
             (context->skipValidation() || ValidateGetProgramPipelineInfoLogEXT(
                                               context, pipelinePacked, bufSize, length, infoLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramPipelineInfoLog(pipelinePacked, bufSize, length, infoLog);
@@ -6033,6 +6243,7 @@ void GL_APIENTRY GL_GetProgramPipelineivEXT(GLuint pipeline, GLenum pname, GLint
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramPipelineivEXT(context, pipelinePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramPipelineiv(pipelinePacked, pname, params);
@@ -6057,6 +6268,7 @@ GLboolean GL_APIENTRY GL_IsProgramPipelineEXT(GLuint pipeline)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsProgramPipelineEXT(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isProgramPipeline(pipelinePacked);
@@ -6088,6 +6300,7 @@ void GL_APIENTRY GL_ProgramParameteriEXT(GLuint program, GLenum pname, GLint val
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramParameteriEXT(context, programPacked, pname, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programParameteri(programPacked, pname, value);
@@ -6114,6 +6327,7 @@ void GL_APIENTRY GL_ProgramUniform1fEXT(GLuint program, GLint location, GLfloat
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1fEXT(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1f(programPacked, locationPacked, v0);
@@ -6144,6 +6358,7 @@ void GL_APIENTRY GL_ProgramUniform1fvEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1fvEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1fv(programPacked, locationPacked, count, value);
@@ -6171,6 +6386,7 @@ void GL_APIENTRY GL_ProgramUniform1iEXT(GLuint program, GLint location, GLint v0
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1iEXT(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1i(programPacked, locationPacked, v0);
@@ -6201,6 +6417,7 @@ void GL_APIENTRY GL_ProgramUniform1ivEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1ivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1iv(programPacked, locationPacked, count, value);
@@ -6228,6 +6445,7 @@ void GL_APIENTRY GL_ProgramUniform1uiEXT(GLuint program, GLint location, GLuint
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1uiEXT(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1ui(programPacked, locationPacked, v0);
@@ -6259,6 +6477,7 @@ void GL_APIENTRY GL_ProgramUniform1uivEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1uivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1uiv(programPacked, locationPacked, count, value);
@@ -6287,6 +6506,7 @@ void GL_APIENTRY GL_ProgramUniform2fEXT(GLuint program, GLint location, GLfloat
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2fEXT(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2f(programPacked, locationPacked, v0, v1);
@@ -6318,6 +6538,7 @@ void GL_APIENTRY GL_ProgramUniform2fvEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2fvEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2fv(programPacked, locationPacked, count, value);
@@ -6346,6 +6567,7 @@ void GL_APIENTRY GL_ProgramUniform2iEXT(GLuint program, GLint location, GLint v0
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2iEXT(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2i(programPacked, locationPacked, v0, v1);
@@ -6377,6 +6599,7 @@ void GL_APIENTRY GL_ProgramUniform2ivEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2ivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2iv(programPacked, locationPacked, count, value);
@@ -6405,6 +6628,7 @@ void GL_APIENTRY GL_ProgramUniform2uiEXT(GLuint program, GLint location, GLuint
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2uiEXT(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2ui(programPacked, locationPacked, v0, v1);
@@ -6436,6 +6660,7 @@ void GL_APIENTRY GL_ProgramUniform2uivEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2uivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2uiv(programPacked, locationPacked, count, value);
@@ -6465,6 +6690,7 @@ GL_ProgramUniform3fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, G
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3fEXT(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3f(programPacked, locationPacked, v0, v1, v2);
@@ -6496,6 +6722,7 @@ void GL_APIENTRY GL_ProgramUniform3fvEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3fvEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3fv(programPacked, locationPacked, count, value);
@@ -6525,6 +6752,7 @@ GL_ProgramUniform3iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3iEXT(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3i(programPacked, locationPacked, v0, v1, v2);
@@ -6556,6 +6784,7 @@ void GL_APIENTRY GL_ProgramUniform3ivEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3ivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3iv(programPacked, locationPacked, count, value);
@@ -6585,6 +6814,7 @@ GL_ProgramUniform3uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GL
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3uiEXT(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3ui(programPacked, locationPacked, v0, v1, v2);
@@ -6616,6 +6846,7 @@ void GL_APIENTRY GL_ProgramUniform3uivEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3uivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3uiv(programPacked, locationPacked, count, value);
@@ -6649,6 +6880,7 @@ void GL_APIENTRY GL_ProgramUniform4fEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4fEXT(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4f(programPacked, locationPacked, v0, v1, v2, v3);
@@ -6680,6 +6912,7 @@ void GL_APIENTRY GL_ProgramUniform4fvEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4fvEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4fv(programPacked, locationPacked, count, value);
@@ -6709,6 +6942,7 @@ GL_ProgramUniform4iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4iEXT(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4i(programPacked, locationPacked, v0, v1, v2, v3);
@@ -6740,6 +6974,7 @@ void GL_APIENTRY GL_ProgramUniform4ivEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4ivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4iv(programPacked, locationPacked, count, value);
@@ -6769,6 +7004,7 @@ GL_ProgramUniform4uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GL
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4uiEXT(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4ui(programPacked, locationPacked, v0, v1, v2, v3);
@@ -6800,6 +7036,7 @@ void GL_APIENTRY GL_ProgramUniform4uivEXT(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4uivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4uiv(programPacked, locationPacked, count, value);
@@ -6833,6 +7070,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2fvEXT(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2fv(programPacked, locationPacked, count, transpose,
@@ -6867,6 +7105,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3fvEXT(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x3fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2x3fv(programPacked, locationPacked, count, transpose,
@@ -6901,6 +7140,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4fvEXT(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x4fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2x4fv(programPacked, locationPacked, count, transpose,
@@ -6935,6 +7175,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3fvEXT(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3fv(programPacked, locationPacked, count, transpose,
@@ -6969,6 +7210,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2fvEXT(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x2fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3x2fv(programPacked, locationPacked, count, transpose,
@@ -7003,6 +7245,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4fvEXT(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x4fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3x4fv(programPacked, locationPacked, count, transpose,
@@ -7037,6 +7280,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4fvEXT(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4fv(programPacked, locationPacked, count, transpose,
@@ -7071,6 +7315,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2fvEXT(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x2fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4x2fv(programPacked, locationPacked, count, transpose,
@@ -7105,6 +7350,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fvEXT(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x3fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4x3fv(programPacked, locationPacked, count, transpose,
@@ -7134,6 +7380,7 @@ void GL_APIENTRY GL_UseProgramStagesEXT(GLuint pipeline, GLbitfield stages, GLui
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUseProgramStagesEXT(context, pipelinePacked, stages, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->useProgramStages(pipelinePacked, stages, programPacked);
@@ -7159,6 +7406,7 @@ void GL_APIENTRY GL_ValidateProgramPipelineEXT(GLuint pipeline)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateValidateProgramPipelineEXT(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->validateProgramPipeline(pipelinePacked);
@@ -7182,6 +7430,7 @@ void GL_APIENTRY GL_FramebufferFetchBarrierEXT()
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFramebufferFetchBarrierEXT(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferFetchBarrier();
@@ -7196,6 +7445,47 @@ void GL_APIENTRY GL_FramebufferFetchBarrierEXT()
 
 // GL_EXT_shader_io_blocks
 
+// GL_EXT_sparse_texture
+void GL_APIENTRY GL_TexPageCommitmentEXT(GLenum target,
+                                         GLint level,
+                                         GLint xoffset,
+                                         GLint yoffset,
+                                         GLint zoffset,
+                                         GLsizei width,
+                                         GLsizei height,
+                                         GLsizei depth,
+                                         GLboolean commit)
+{
+    Context *context = GetValidGlobalContext();
+    EVENT(context, GLTexPageCommitmentEXT,
+          "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, zoffset = %d, "
+          "width = %d, height = %d, depth = %d, commit = %s",
+          CID(context), GLenumToString(GLenumGroup::DefaultGroup, target), level, xoffset, yoffset,
+          zoffset, width, height, depth, GLbooleanToString(commit));
+
+    if (context)
+    {
+        TextureType targetPacked                              = PackParam<TextureType>(target);
+        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        bool isCallValid =
+            (context->skipValidation() ||
+             ValidateTexPageCommitmentEXT(context, targetPacked, level, xoffset, yoffset, zoffset,
+                                          width, height, depth, commit));
+        ANGLE_PROFILE_VALIDATION_END();
+        if (isCallValid)
+        {
+            context->texPageCommitment(targetPacked, level, xoffset, yoffset, zoffset, width,
+                                       height, depth, commit);
+        }
+        ANGLE_CAPTURE(TexPageCommitmentEXT, isCallValid, context, targetPacked, level, xoffset,
+                      yoffset, zoffset, width, height, depth, commit);
+    }
+    else
+    {
+        GenerateContextLostErrorOnCurrentGlobalContext();
+    }
+}
+
 // GL_EXT_tessellation_shader
 void GL_APIENTRY GL_PatchParameteriEXT(GLenum pname, GLint value)
 {
@@ -7208,6 +7498,7 @@ void GL_APIENTRY GL_PatchParameteriEXT(GLenum pname, GLint value)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePatchParameteriEXT(context, pname, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->patchParameteri(pname, value);
@@ -7235,6 +7526,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivEXT(GLuint sampler, GLenum pname, GLin
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSamplerParameterIivEXT(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIiv(samplerPacked, pname, params);
@@ -7262,6 +7554,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivEXT(GLuint sampler, GLenum pname, GLu
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSamplerParameterIuivEXT(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIuiv(samplerPacked, pname, params);
@@ -7289,6 +7582,7 @@ void GL_APIENTRY GL_GetTexParameterIivEXT(GLenum target, GLenum pname, GLint *pa
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIivEXT(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIiv(targetPacked, pname, params);
@@ -7315,6 +7609,7 @@ void GL_APIENTRY GL_GetTexParameterIuivEXT(GLenum target, GLenum pname, GLuint *
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIuivEXT(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIuiv(targetPacked, pname, params);
@@ -7340,6 +7635,7 @@ void GL_APIENTRY GL_SamplerParameterIivEXT(GLuint sampler, GLenum pname, const G
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIivEXT(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIiv(samplerPacked, pname, param);
@@ -7365,6 +7661,7 @@ void GL_APIENTRY GL_SamplerParameterIuivEXT(GLuint sampler, GLenum pname, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIuivEXT(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIuiv(samplerPacked, pname, param);
@@ -7391,6 +7688,7 @@ void GL_APIENTRY GL_TexParameterIivEXT(GLenum target, GLenum pname, const GLint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIivEXT(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIiv(targetPacked, pname, params);
@@ -7417,6 +7715,7 @@ void GL_APIENTRY GL_TexParameterIuivEXT(GLenum target, GLenum pname, const GLuin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIuivEXT(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIuiv(targetPacked, pname, params);
@@ -7445,6 +7744,7 @@ void GL_APIENTRY GL_TexBufferEXT(GLenum target, GLenum internalformat, GLuint bu
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexBufferEXT(context, targetPacked, internalformat, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBuffer(targetPacked, internalformat, bufferPacked);
@@ -7479,6 +7779,7 @@ void GL_APIENTRY GL_TexBufferRangeEXT(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexBufferRangeEXT(context, targetPacked, internalformat,
                                                       bufferPacked, offset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBufferRange(targetPacked, internalformat, bufferPacked, offset, size);
@@ -7530,6 +7831,7 @@ void GL_APIENTRY GL_TexStorage1DEXT(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexStorage1DEXT(context, target, levels, internalformat, width));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage1D(target, levels, internalformat, width);
@@ -7561,6 +7863,7 @@ void GL_APIENTRY GL_TexStorage2DEXT(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexStorage2DEXT(context, targetPacked, levels, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage2D(targetPacked, levels, internalformat, width, height);
@@ -7595,6 +7898,7 @@ void GL_APIENTRY GL_TexStorage3DEXT(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexStorage3DEXT(context, targetPacked, levels, internalformat,
                                                     width, height, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage3D(targetPacked, levels, internalformat, width, height, depth);
@@ -7618,6 +7922,7 @@ void GL_APIENTRY GL_BlendBarrierKHR()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBlendBarrierKHR(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendBarrier();
@@ -7643,6 +7948,7 @@ void GL_APIENTRY GL_DebugMessageCallbackKHR(GLDEBUGPROCKHR callback, const void
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDebugMessageCallbackKHR(context, callback, userParam));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageCallback(callback, userParam);
@@ -7677,6 +7983,7 @@ void GL_APIENTRY GL_DebugMessageControlKHR(GLenum source,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDebugMessageControlKHR(context, source, type, severity, count, ids, enabled));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageControl(source, type, severity, count, ids, enabled);
@@ -7711,6 +8018,7 @@ void GL_APIENTRY GL_DebugMessageInsertKHR(GLenum source,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDebugMessageInsertKHR(context, source, type, id, severity, length, buf));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageInsert(source, type, id, severity, length, buf);
@@ -7748,6 +8056,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLogKHR(GLuint count,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetDebugMessageLogKHR(context, count, bufSize, sources, types,
                                                           ids, severities, lengths, messageLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getDebugMessageLog(count, bufSize, sources, types, ids,
@@ -7788,6 +8097,7 @@ void GL_APIENTRY GL_GetObjectLabelKHR(GLenum identifier,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetObjectLabelKHR(context, identifier, name, bufSize, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getObjectLabel(identifier, name, bufSize, length, label);
@@ -7817,6 +8127,7 @@ void GL_APIENTRY GL_GetObjectPtrLabelKHR(const void *ptr,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetObjectPtrLabelKHR(context, ptr, bufSize, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getObjectPtrLabel(ptr, bufSize, length, label);
@@ -7840,6 +8151,7 @@ void GL_APIENTRY GL_GetPointervKHR(GLenum pname, void **params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetPointervKHR(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getPointerv(pname, params);
@@ -7868,6 +8180,7 @@ void GL_APIENTRY GL_ObjectLabelKHR(GLenum identifier,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateObjectLabelKHR(context, identifier, name, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->objectLabel(identifier, name, length, label);
@@ -7892,6 +8205,7 @@ void GL_APIENTRY GL_ObjectPtrLabelKHR(const void *ptr, GLsizei length, const GLc
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateObjectPtrLabelKHR(context, ptr, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->objectPtrLabel(ptr, length, label);
@@ -7913,6 +8227,7 @@ void GL_APIENTRY GL_PopDebugGroupKHR()
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopDebugGroupKHR(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popDebugGroup();
@@ -7941,6 +8256,7 @@ void GL_APIENTRY GL_PushDebugGroupKHR(GLenum source,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePushDebugGroupKHR(context, source, id, length, message));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushDebugGroup(source, id, length, message);
@@ -7964,6 +8280,7 @@ void GL_APIENTRY GL_MaxShaderCompilerThreadsKHR(GLuint count)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaxShaderCompilerThreadsKHR(context, count));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->maxShaderCompilerThreads(count);
@@ -7989,6 +8306,7 @@ void GL_APIENTRY GL_DeleteFencesNV(GLsizei n, const GLuint *fences)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteFencesNV(context, n, fencesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteFencesNV(n, fencesPacked);
@@ -8012,6 +8330,7 @@ void GL_APIENTRY GL_FinishFenceNV(GLuint fence)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFinishFenceNV(context, fencePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->finishFenceNV(fencePacked);
@@ -8036,6 +8355,7 @@ void GL_APIENTRY GL_GenFencesNV(GLsizei n, GLuint *fences)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenFencesNV(context, n, fencesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genFencesNV(n, fencesPacked);
@@ -8061,6 +8381,7 @@ void GL_APIENTRY GL_GetFenceivNV(GLuint fence, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFenceivNV(context, fencePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFenceivNV(fencePacked, pname, params);
@@ -8084,6 +8405,7 @@ GLboolean GL_APIENTRY GL_IsFenceNV(GLuint fence)
         FenceNVID fencePacked                                 = PackParam<FenceNVID>(fence);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsFenceNV(context, fencePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isFenceNV(fencePacked);
@@ -8114,6 +8436,7 @@ void GL_APIENTRY GL_SetFenceNV(GLuint fence, GLenum condition)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSetFenceNV(context, fencePacked, condition));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->setFenceNV(fencePacked, condition);
@@ -8137,6 +8460,7 @@ GLboolean GL_APIENTRY GL_TestFenceNV(GLuint fence)
         FenceNVID fencePacked                                 = PackParam<FenceNVID>(fence);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTestFenceNV(context, fencePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->testFenceNV(fencePacked);
@@ -8181,6 +8505,7 @@ void GL_APIENTRY GL_BlitFramebufferNV(GLint srcX0,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlitFramebufferNV(context, srcX0, srcY0, srcX1, srcY1, dstX0,
                                                       dstY0, dstX1, dstY1, mask, filter));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blitFramebufferNV(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask,
@@ -8208,6 +8533,7 @@ void GL_APIENTRY GL_EGLImageTargetRenderbufferStorageOES(GLenum target, GLeglIma
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEGLImageTargetRenderbufferStorageOES(context, target, image));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->eGLImageTargetRenderbufferStorage(target, image);
@@ -8233,6 +8559,7 @@ void GL_APIENTRY GL_EGLImageTargetTexture2DOES(GLenum target, GLeglImageOES imag
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEGLImageTargetTexture2DOES(context, targetPacked, image));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->eGLImageTargetTexture2D(targetPacked, image);
@@ -8282,6 +8609,7 @@ void GL_APIENTRY GL_CopyImageSubDataOES(GLuint srcName,
              ValidateCopyImageSubDataOES(context, srcName, srcTarget, srcLevel, srcX, srcY, srcZ,
                                          dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth,
                                          srcHeight, srcDepth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName,
@@ -8314,6 +8642,7 @@ void GL_APIENTRY GL_BlendEquationSeparateiOES(GLuint buf, GLenum modeRGB, GLenum
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparateiOES(context, buf, modeRGB, modeAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationSeparatei(buf, modeRGB, modeAlpha);
@@ -8337,6 +8666,7 @@ void GL_APIENTRY GL_BlendEquationiOES(GLuint buf, GLenum mode)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationiOES(context, buf, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationi(buf, mode);
@@ -8366,6 +8696,7 @@ GL_BlendFuncSeparateiOES(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlp
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendFuncSeparateiOES(context, buf, srcRGB, dstRGB, srcAlpha, dstAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
@@ -8391,6 +8722,7 @@ void GL_APIENTRY GL_BlendFunciOES(GLuint buf, GLenum src, GLenum dst)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunciOES(context, buf, src, dst));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFunci(buf, src, dst);
@@ -8415,6 +8747,7 @@ void GL_APIENTRY GL_ColorMaskiOES(GLuint index, GLboolean r, GLboolean g, GLbool
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaskiOES(context, index, r, g, b, a));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorMaski(index, r, g, b, a);
@@ -8438,6 +8771,7 @@ void GL_APIENTRY GL_DisableiOES(GLenum target, GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableiOES(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disablei(target, index);
@@ -8461,6 +8795,7 @@ void GL_APIENTRY GL_EnableiOES(GLenum target, GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableiOES(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enablei(target, index);
@@ -8485,6 +8820,7 @@ GLboolean GL_APIENTRY GL_IsEnablediOES(GLenum target, GLuint index)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsEnablediOES(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isEnabledi(target, index);
@@ -8525,6 +8861,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertexOES(GLenum mode,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsBaseVertexOES(context, modePacked, count,
                                                               typePacked, indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsBaseVertex(modePacked, count, typePacked, indices, basevertex);
@@ -8561,6 +8898,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexOES(GLenum mode,
         bool isCallValid = (context->skipValidation() || ValidateDrawElementsInstancedBaseVertexOES(
                                                              context, modePacked, count, typePacked,
                                                              indices, instancecount, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstancedBaseVertex(modePacked, count, typePacked, indices,
@@ -8598,6 +8936,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexOES(GLenum mode,
         bool isCallValid = (context->skipValidation() || ValidateDrawRangeElementsBaseVertexOES(
                                                              context, modePacked, start, end, count,
                                                              typePacked, indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawRangeElementsBaseVertex(modePacked, start, end, count, typePacked, indices,
@@ -8626,6 +8965,7 @@ void GL_APIENTRY GL_DrawTexfOES(GLfloat x, GLfloat y, GLfloat z, GLfloat width,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexfOES(context, x, y, z, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexf(x, y, z, width, height);
@@ -8648,6 +8988,7 @@ void GL_APIENTRY GL_DrawTexfvOES(const GLfloat *coords)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawTexfvOES(context, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexfv(coords);
@@ -8671,6 +9012,7 @@ void GL_APIENTRY GL_DrawTexiOES(GLint x, GLint y, GLint z, GLint width, GLint he
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexiOES(context, x, y, z, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexi(x, y, z, width, height);
@@ -8693,6 +9035,7 @@ void GL_APIENTRY GL_DrawTexivOES(const GLint *coords)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawTexivOES(context, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexiv(coords);
@@ -8716,6 +9059,7 @@ void GL_APIENTRY GL_DrawTexsOES(GLshort x, GLshort y, GLshort z, GLshort width,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexsOES(context, x, y, z, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexs(x, y, z, width, height);
@@ -8738,6 +9082,7 @@ void GL_APIENTRY GL_DrawTexsvOES(const GLshort *coords)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawTexsvOES(context, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexsv(coords);
@@ -8762,6 +9107,7 @@ void GL_APIENTRY GL_DrawTexxOES(GLfixed x, GLfixed y, GLfixed z, GLfixed width,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexxOES(context, x, y, z, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexx(x, y, z, width, height);
@@ -8784,6 +9130,7 @@ void GL_APIENTRY GL_DrawTexxvOES(const GLfixed *coords)
     {
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawTexxvOES(context, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexxv(coords);
@@ -8809,6 +9156,7 @@ void GL_APIENTRY GL_BindFramebufferOES(GLenum target, GLuint framebuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindFramebufferOES(context, target, framebufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindFramebuffer(target, framebufferPacked);
@@ -8833,6 +9181,7 @@ void GL_APIENTRY GL_BindRenderbufferOES(GLenum target, GLuint renderbuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindRenderbufferOES(context, target, renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindRenderbuffer(target, renderbufferPacked);
@@ -8857,6 +9206,7 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatusOES(GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCheckFramebufferStatusOES(context, target));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->checkFramebufferStatus(target);
@@ -8890,6 +9240,7 @@ void GL_APIENTRY GL_DeleteFramebuffersOES(GLsizei n, const GLuint *framebuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteFramebuffersOES(context, n, framebuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteFramebuffers(n, framebuffersPacked);
@@ -8916,6 +9267,7 @@ void GL_APIENTRY GL_DeleteRenderbuffersOES(GLsizei n, const GLuint *renderbuffer
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteRenderbuffersOES(context, n, renderbuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteRenderbuffers(n, renderbuffersPacked);
@@ -8948,6 +9300,7 @@ void GL_APIENTRY GL_FramebufferRenderbufferOES(GLenum target,
             (context->skipValidation() ||
              ValidateFramebufferRenderbufferOES(context, target, attachment, renderbuffertarget,
                                                 renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferRenderbuffer(target, attachment, renderbuffertarget,
@@ -8983,6 +9336,7 @@ void GL_APIENTRY GL_FramebufferTexture2DOES(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferTexture2DOES(context, target, attachment,
                                                             textargetPacked, texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture2D(target, attachment, textargetPacked, texturePacked,
@@ -9009,6 +9363,7 @@ void GL_APIENTRY GL_GenFramebuffersOES(GLsizei n, GLuint *framebuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGenFramebuffersOES(context, n, framebuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genFramebuffers(n, framebuffersPacked);
@@ -9033,6 +9388,7 @@ void GL_APIENTRY GL_GenRenderbuffersOES(GLsizei n, GLuint *renderbuffers)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGenRenderbuffersOES(context, n, renderbuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genRenderbuffers(n, renderbuffersPacked);
@@ -9057,6 +9413,7 @@ void GL_APIENTRY GL_GenerateMipmapOES(GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenerateMipmapOES(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->generateMipmap(targetPacked);
@@ -9088,6 +9445,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivOES(GLenum target,
         bool isCallValid =
             (context->skipValidation() || ValidateGetFramebufferAttachmentParameterivOES(
                                               context, target, attachment, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFramebufferAttachmentParameteriv(target, attachment, pname, params);
@@ -9114,6 +9472,7 @@ void GL_APIENTRY GL_GetRenderbufferParameterivOES(GLenum target, GLenum pname, G
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetRenderbufferParameterivOES(context, target, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getRenderbufferParameteriv(target, pname, params);
@@ -9138,6 +9497,7 @@ GLboolean GL_APIENTRY GL_IsFramebufferOES(GLuint framebuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsFramebufferOES(context, framebufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isFramebuffer(framebufferPacked);
@@ -9169,6 +9529,7 @@ GLboolean GL_APIENTRY GL_IsRenderbufferOES(GLuint renderbuffer)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsRenderbufferOES(context, renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isRenderbuffer(renderbufferPacked);
@@ -9205,6 +9566,7 @@ void GL_APIENTRY GL_RenderbufferStorageOES(GLenum target,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRenderbufferStorageOES(context, target, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->renderbufferStorage(target, internalformat, width, height);
@@ -9239,6 +9601,7 @@ void GL_APIENTRY GL_GetProgramBinaryOES(GLuint program,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramBinaryOES(context, programPacked, bufSize, length,
                                                         binaryFormat, binary));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramBinary(programPacked, bufSize, length, binaryFormat, binary);
@@ -9270,6 +9633,7 @@ void GL_APIENTRY GL_ProgramBinaryOES(GLuint program,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramBinaryOES(context, programPacked, binaryFormat, binary, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programBinary(programPacked, binaryFormat, binary, length);
@@ -9298,6 +9662,7 @@ void GL_APIENTRY GL_GetBufferPointervOES(GLenum target, GLenum pname, void **par
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferPointervOES(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferPointerv(targetPacked, pname, params);
@@ -9324,6 +9689,7 @@ void *GL_APIENTRY GL_MapBufferOES(GLenum target, GLenum access)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMapBufferOES(context, targetPacked, access));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->mapBuffer(targetPacked, access);
@@ -9355,6 +9721,7 @@ GLboolean GL_APIENTRY GL_UnmapBufferOES(GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUnmapBufferOES(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->unmapBuffer(targetPacked);
@@ -9385,6 +9752,7 @@ void GL_APIENTRY GL_CurrentPaletteMatrixOES(GLuint matrixpaletteindex)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCurrentPaletteMatrixOES(context, matrixpaletteindex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->currentPaletteMatrix(matrixpaletteindex);
@@ -9407,6 +9775,7 @@ void GL_APIENTRY GL_LoadPaletteFromModelViewMatrixOES()
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLoadPaletteFromModelViewMatrixOES(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadPaletteFromModelViewMatrix();
@@ -9435,6 +9804,7 @@ void GL_APIENTRY GL_MatrixIndexPointerOES(GLint size,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMatrixIndexPointerOES(context, size, type, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->matrixIndexPointer(size, type, stride, pointer);
@@ -9460,6 +9830,7 @@ void GL_APIENTRY GL_WeightPointerOES(GLint size, GLenum type, GLsizei stride, co
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWeightPointerOES(context, size, type, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->weightPointer(size, type, stride, pointer);
@@ -9486,6 +9857,7 @@ void GL_APIENTRY GL_PointSizePointerOES(GLenum type, GLsizei stride, const void
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePointSizePointerOES(context, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointSizePointer(typePacked, stride, pointer);
@@ -9512,6 +9884,7 @@ GLbitfield GL_APIENTRY GL_QueryMatrixxOES(GLfixed *mantissa, GLint *exponent)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateQueryMatrixxOES(context, mantissa, exponent));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->queryMatrixx(mantissa, exponent);
@@ -9541,6 +9914,7 @@ void GL_APIENTRY GL_MinSampleShadingOES(GLfloat value)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMinSampleShadingOES(context, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->minSampleShading(value);
@@ -9582,6 +9956,7 @@ void GL_APIENTRY GL_CompressedTexImage3DOES(GLenum target,
             (context->skipValidation() ||
              ValidateCompressedTexImage3DOES(context, targetPacked, level, internalformat, width,
                                              height, depth, border, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage3D(targetPacked, level, internalformat, width, height, depth,
@@ -9624,6 +9999,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3DOES(GLenum target,
                             ValidateCompressedTexSubImage3DOES(
                                 context, targetPacked, level, xoffset, yoffset, zoffset, width,
                                 height, depth, format, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, width,
@@ -9662,6 +10038,7 @@ void GL_APIENTRY GL_CopyTexSubImage3DOES(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTexSubImage3DOES(context, targetPacked, level, xoffset,
                                                          yoffset, zoffset, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, x, y, width,
@@ -9700,6 +10077,7 @@ void GL_APIENTRY GL_FramebufferTexture3DOES(GLenum target,
             (context->skipValidation() ||
              ValidateFramebufferTexture3DOES(context, target, attachment, textargetPacked,
                                              texturePacked, level, zoffset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture3D(target, attachment, textargetPacked, texturePacked, level,
@@ -9742,6 +10120,7 @@ void GL_APIENTRY GL_TexImage3DOES(GLenum target,
             (context->skipValidation() ||
              ValidateTexImage3DOES(context, targetPacked, level, internalformat, width, height,
                                    depth, border, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage3D(targetPacked, level, internalformat, width, height, depth, border,
@@ -9784,6 +10163,7 @@ void GL_APIENTRY GL_TexSubImage3DOES(GLenum target,
             (context->skipValidation() ||
              ValidateTexSubImage3DOES(context, targetPacked, level, xoffset, yoffset, zoffset,
                                       width, height, depth, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, width, height,
@@ -9813,6 +10193,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivOES(GLuint sampler, GLenum pname, GLin
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSamplerParameterIivOES(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIiv(samplerPacked, pname, params);
@@ -9840,6 +10221,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivOES(GLuint sampler, GLenum pname, GLu
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSamplerParameterIuivOES(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIuiv(samplerPacked, pname, params);
@@ -9867,6 +10249,7 @@ void GL_APIENTRY GL_GetTexParameterIivOES(GLenum target, GLenum pname, GLint *pa
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIivOES(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIiv(targetPacked, pname, params);
@@ -9893,6 +10276,7 @@ void GL_APIENTRY GL_GetTexParameterIuivOES(GLenum target, GLenum pname, GLuint *
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIuivOES(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIuiv(targetPacked, pname, params);
@@ -9918,6 +10302,7 @@ void GL_APIENTRY GL_SamplerParameterIivOES(GLuint sampler, GLenum pname, const G
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIivOES(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIiv(samplerPacked, pname, param);
@@ -9943,6 +10328,7 @@ void GL_APIENTRY GL_SamplerParameterIuivOES(GLuint sampler, GLenum pname, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIuivOES(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIuiv(samplerPacked, pname, param);
@@ -9969,6 +10355,7 @@ void GL_APIENTRY GL_TexParameterIivOES(GLenum target, GLenum pname, const GLint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIivOES(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIiv(targetPacked, pname, params);
@@ -9995,6 +10382,7 @@ void GL_APIENTRY GL_TexParameterIuivOES(GLenum target, GLenum pname, const GLuin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIuivOES(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIuiv(targetPacked, pname, params);
@@ -10023,6 +10411,7 @@ void GL_APIENTRY GL_TexBufferOES(GLenum target, GLenum internalformat, GLuint bu
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexBufferOES(context, targetPacked, internalformat, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBuffer(targetPacked, internalformat, bufferPacked);
@@ -10057,6 +10446,7 @@ void GL_APIENTRY GL_TexBufferRangeOES(GLenum target,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexBufferRangeOES(context, targetPacked, internalformat,
                                                       bufferPacked, offset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBufferRange(targetPacked, internalformat, bufferPacked, offset, size);
@@ -10084,6 +10474,7 @@ void GL_APIENTRY GL_GetTexGenfvOES(GLenum coord, GLenum pname, GLfloat *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetTexGenfvOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexGenfv(coord, pname, params);
@@ -10109,6 +10500,7 @@ void GL_APIENTRY GL_GetTexGenivOES(GLenum coord, GLenum pname, GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetTexGenivOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexGeniv(coord, pname, params);
@@ -10134,6 +10526,7 @@ void GL_APIENTRY GL_GetTexGenxvOES(GLenum coord, GLenum pname, GLfixed *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetTexGenxvOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexGenxv(coord, pname, params);
@@ -10158,6 +10551,7 @@ void GL_APIENTRY GL_TexGenfOES(GLenum coord, GLenum pname, GLfloat param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenfOES(context, coord, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGenf(coord, pname, param);
@@ -10183,6 +10577,7 @@ void GL_APIENTRY GL_TexGenfvOES(GLenum coord, GLenum pname, const GLfloat *param
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenfvOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGenfv(coord, pname, params);
@@ -10207,6 +10602,7 @@ void GL_APIENTRY GL_TexGeniOES(GLenum coord, GLenum pname, GLint param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGeniOES(context, coord, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGeni(coord, pname, param);
@@ -10232,6 +10628,7 @@ void GL_APIENTRY GL_TexGenivOES(GLenum coord, GLenum pname, const GLint *params)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenivOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGeniv(coord, pname, params);
@@ -10256,6 +10653,7 @@ void GL_APIENTRY GL_TexGenxOES(GLenum coord, GLenum pname, GLfixed param)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenxOES(context, coord, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGenx(coord, pname, param);
@@ -10281,6 +10679,7 @@ void GL_APIENTRY GL_TexGenxvOES(GLenum coord, GLenum pname, const GLfixed *param
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenxvOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGenxv(coord, pname, params);
@@ -10324,6 +10723,7 @@ void GL_APIENTRY GL_TexStorage3DMultisampleOES(GLenum target,
             (context->skipValidation() ||
              ValidateTexStorage3DMultisampleOES(context, targetPacked, samples, internalformat,
                                                 width, height, depth, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage3DMultisample(targetPacked, samples, internalformat, width, height,
@@ -10350,6 +10750,7 @@ void GL_APIENTRY GL_BindVertexArrayOES(GLuint array)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindVertexArrayOES(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindVertexArray(arrayPacked);
@@ -10374,6 +10775,7 @@ void GL_APIENTRY GL_DeleteVertexArraysOES(GLsizei n, const GLuint *arrays)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteVertexArraysOES(context, n, arraysPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteVertexArrays(n, arraysPacked);
@@ -10398,6 +10800,7 @@ void GL_APIENTRY GL_GenVertexArraysOES(GLsizei n, GLuint *arrays)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenVertexArraysOES(context, n, arraysPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genVertexArrays(n, arraysPacked);
@@ -10422,6 +10825,7 @@ GLboolean GL_APIENTRY GL_IsVertexArrayOES(GLuint array)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsVertexArrayOES(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isVertexArray(arrayPacked);
@@ -10464,6 +10868,7 @@ void GL_APIENTRY GL_FramebufferTextureMultiviewOVR(GLenum target,
             (context->skipValidation() ||
              ValidateFramebufferTextureMultiviewOVR(context, target, attachment, texturePacked,
                                                     level, baseViewIndex, numViews));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTextureMultiview(target, attachment, texturePacked, level,
@@ -10497,6 +10902,7 @@ void GL_APIENTRY GL_ActiveShaderProgramContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateActiveShaderProgram(context, pipelinePacked, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->activeShaderProgram(pipelinePacked, programPacked);
@@ -10525,6 +10931,7 @@ void GL_APIENTRY GL_ActiveShaderProgramEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateActiveShaderProgramEXT(context, pipelinePacked, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->activeShaderProgram(pipelinePacked, programPacked);
@@ -10548,6 +10955,7 @@ void GL_APIENTRY GL_ActiveTextureContextANGLE(GLeglContext ctx, GLenum texture)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateActiveTexture(context, texture));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->activeTexture(texture);
@@ -10573,6 +10981,7 @@ void GL_APIENTRY GL_AlphaFuncContextANGLE(GLeglContext ctx, GLenum func, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateAlphaFunc(context, funcPacked, ref));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->alphaFunc(funcPacked, ref);
@@ -10598,6 +11007,7 @@ void GL_APIENTRY GL_AlphaFuncxContextANGLE(GLeglContext ctx, GLenum func, GLfixe
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateAlphaFuncx(context, funcPacked, ref));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->alphaFuncx(funcPacked, ref);
@@ -10624,6 +11034,7 @@ void GL_APIENTRY GL_AttachShaderContextANGLE(GLeglContext ctx, GLuint program, G
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateAttachShader(context, programPacked, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->attachShader(programPacked, shaderPacked);
@@ -10650,6 +11061,7 @@ void GL_APIENTRY GL_BeginQueryContextANGLE(GLeglContext ctx, GLenum target, GLui
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBeginQuery(context, targetPacked, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->beginQuery(targetPacked, idPacked);
@@ -10676,6 +11088,7 @@ void GL_APIENTRY GL_BeginQueryEXTContextANGLE(GLeglContext ctx, GLenum target, G
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBeginQueryEXT(context, targetPacked, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->beginQuery(targetPacked, idPacked);
@@ -10701,6 +11114,7 @@ void GL_APIENTRY GL_BeginTransformFeedbackContextANGLE(GLeglContext ctx, GLenum
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBeginTransformFeedback(context, primitiveModePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->beginTransformFeedback(primitiveModePacked);
@@ -10730,6 +11144,7 @@ void GL_APIENTRY GL_BindAttribLocationContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindAttribLocation(context, programPacked, index, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindAttribLocation(programPacked, index, name);
@@ -10756,6 +11171,7 @@ void GL_APIENTRY GL_BindBufferContextANGLE(GLeglContext ctx, GLenum target, GLui
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindBuffer(context, targetPacked, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindBuffer(targetPacked, bufferPacked);
@@ -10785,6 +11201,7 @@ void GL_APIENTRY GL_BindBufferBaseContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindBufferBase(context, targetPacked, index, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindBufferBase(targetPacked, index, bufferPacked);
@@ -10819,6 +11236,7 @@ void GL_APIENTRY GL_BindBufferRangeContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindBufferRange(context, targetPacked, index, bufferPacked, offset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindBufferRange(targetPacked, index, bufferPacked, offset, size);
@@ -10849,6 +11267,7 @@ void GL_APIENTRY GL_BindFragDataLocationEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindFragDataLocationEXT(context, programPacked, color, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindFragDataLocation(programPacked, color, name);
@@ -10880,6 +11299,7 @@ void GL_APIENTRY GL_BindFragDataLocationIndexedEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateBindFragDataLocationIndexedEXT(
                                               context, programPacked, colorNumber, index, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindFragDataLocationIndexed(programPacked, colorNumber, index, name);
@@ -10906,6 +11326,7 @@ void GL_APIENTRY GL_BindFramebufferContextANGLE(GLeglContext ctx, GLenum target,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindFramebuffer(context, target, framebufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindFramebuffer(target, framebufferPacked);
@@ -10933,6 +11354,7 @@ void GL_APIENTRY GL_BindFramebufferOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindFramebufferOES(context, target, framebufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindFramebuffer(target, framebufferPacked);
@@ -10970,6 +11392,7 @@ void GL_APIENTRY GL_BindImageTextureContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindImageTexture(context, unit, texturePacked, level, layered,
                                                      layer, access, format));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindImageTexture(unit, texturePacked, level, layered, layer, access, format);
@@ -10995,6 +11418,7 @@ void GL_APIENTRY GL_BindProgramPipelineContextANGLE(GLeglContext ctx, GLuint pip
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindProgramPipeline(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindProgramPipeline(pipelinePacked);
@@ -11019,6 +11443,7 @@ void GL_APIENTRY GL_BindProgramPipelineEXTContextANGLE(GLeglContext ctx, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindProgramPipelineEXT(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindProgramPipeline(pipelinePacked);
@@ -11046,6 +11471,7 @@ void GL_APIENTRY GL_BindRenderbufferContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindRenderbuffer(context, target, renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindRenderbuffer(target, renderbufferPacked);
@@ -11073,6 +11499,7 @@ void GL_APIENTRY GL_BindRenderbufferOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindRenderbufferOES(context, target, renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindRenderbuffer(target, renderbufferPacked);
@@ -11098,6 +11525,7 @@ void GL_APIENTRY GL_BindSamplerContextANGLE(GLeglContext ctx, GLuint unit, GLuin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindSampler(context, unit, samplerPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindSampler(unit, samplerPacked);
@@ -11124,6 +11552,7 @@ void GL_APIENTRY GL_BindTextureContextANGLE(GLeglContext ctx, GLenum target, GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindTexture(context, targetPacked, texturePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindTexture(targetPacked, texturePacked);
@@ -11149,6 +11578,7 @@ void GL_APIENTRY GL_BindTransformFeedbackContextANGLE(GLeglContext ctx, GLenum t
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindTransformFeedback(context, target, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindTransformFeedback(target, idPacked);
@@ -11173,6 +11603,7 @@ void GL_APIENTRY GL_BindVertexArrayContextANGLE(GLeglContext ctx, GLuint array)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindVertexArray(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindVertexArray(arrayPacked);
@@ -11197,6 +11628,7 @@ void GL_APIENTRY GL_BindVertexArrayOESContextANGLE(GLeglContext ctx, GLuint arra
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBindVertexArrayOES(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindVertexArray(arrayPacked);
@@ -11228,6 +11660,7 @@ void GL_APIENTRY GL_BindVertexBufferContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindVertexBuffer(context, bindingindex, bufferPacked, offset, stride));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindVertexBuffer(bindingindex, bufferPacked, offset, stride);
@@ -11251,6 +11684,7 @@ void GL_APIENTRY GL_BlendBarrierContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBlendBarrier(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendBarrier();
@@ -11273,6 +11707,7 @@ void GL_APIENTRY GL_BlendBarrierKHRContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBlendBarrierKHR(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendBarrier();
@@ -11298,6 +11733,7 @@ GL_BlendColorContextANGLE(GLeglContext ctx, GLfloat red, GLfloat green, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendColor(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendColor(red, green, blue, alpha);
@@ -11321,6 +11757,7 @@ void GL_APIENTRY GL_BlendEquationContextANGLE(GLeglContext ctx, GLenum mode)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBlendEquation(context, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquation(mode);
@@ -11348,6 +11785,7 @@ void GL_APIENTRY GL_BlendEquationSeparateContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparate(context, modeRGB, modeAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationSeparate(modeRGB, modeAlpha);
@@ -11376,6 +11814,7 @@ void GL_APIENTRY GL_BlendEquationSeparateiContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparatei(context, buf, modeRGB, modeAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationSeparatei(buf, modeRGB, modeAlpha);
@@ -11405,6 +11844,7 @@ void GL_APIENTRY GL_BlendEquationSeparateiEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparateiEXT(context, buf, modeRGB, modeAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationSeparatei(buf, modeRGB, modeAlpha);
@@ -11434,6 +11874,7 @@ void GL_APIENTRY GL_BlendEquationSeparateiOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparateiOES(context, buf, modeRGB, modeAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationSeparatei(buf, modeRGB, modeAlpha);
@@ -11458,6 +11899,7 @@ void GL_APIENTRY GL_BlendEquationiContextANGLE(GLeglContext ctx, GLuint buf, GLe
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationi(context, buf, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationi(buf, mode);
@@ -11482,6 +11924,7 @@ void GL_APIENTRY GL_BlendEquationiEXTContextANGLE(GLeglContext ctx, GLuint buf,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationiEXT(context, buf, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationi(buf, mode);
@@ -11506,6 +11949,7 @@ void GL_APIENTRY GL_BlendEquationiOESContextANGLE(GLeglContext ctx, GLuint buf,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationiOES(context, buf, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendEquationi(buf, mode);
@@ -11531,6 +11975,7 @@ void GL_APIENTRY GL_BlendFuncContextANGLE(GLeglContext ctx, GLenum sfactor, GLen
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunc(context, sfactor, dfactor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFunc(sfactor, dfactor);
@@ -11564,6 +12009,7 @@ void GL_APIENTRY GL_BlendFuncSeparateContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFuncSeparate(context, sfactorRGB, dfactorRGB,
                                                                     sfactorAlpha, dfactorAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
@@ -11599,6 +12045,7 @@ void GL_APIENTRY GL_BlendFuncSeparateiContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendFuncSeparatei(context, buf, srcRGB, dstRGB, srcAlpha, dstAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
@@ -11634,6 +12081,7 @@ void GL_APIENTRY GL_BlendFuncSeparateiEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendFuncSeparateiEXT(context, buf, srcRGB, dstRGB, srcAlpha, dstAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
@@ -11669,6 +12117,7 @@ void GL_APIENTRY GL_BlendFuncSeparateiOESContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendFuncSeparateiOES(context, buf, srcRGB, dstRGB, srcAlpha, dstAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
@@ -11695,6 +12144,7 @@ void GL_APIENTRY GL_BlendFunciContextANGLE(GLeglContext ctx, GLuint buf, GLenum
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunci(context, buf, src, dst));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFunci(buf, src, dst);
@@ -11720,6 +12170,7 @@ void GL_APIENTRY GL_BlendFunciEXTContextANGLE(GLeglContext ctx, GLuint buf, GLen
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunciEXT(context, buf, src, dst));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFunci(buf, src, dst);
@@ -11745,6 +12196,7 @@ void GL_APIENTRY GL_BlendFunciOESContextANGLE(GLeglContext ctx, GLuint buf, GLen
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunciOES(context, buf, src, dst));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blendFunci(buf, src, dst);
@@ -11784,6 +12236,7 @@ void GL_APIENTRY GL_BlitFramebufferContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlitFramebuffer(context, srcX0, srcY0, srcX1, srcY1, dstX0,
                                                     dstY0, dstX1, dstY1, mask, filter));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask,
@@ -11825,6 +12278,7 @@ void GL_APIENTRY GL_BlitFramebufferANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlitFramebufferANGLE(context, srcX0, srcY0, srcX1, srcY1, dstX0,
                                                          dstY0, dstX1, dstY1, mask, filter));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask,
@@ -11866,6 +12320,7 @@ void GL_APIENTRY GL_BlitFramebufferNVContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlitFramebufferNV(context, srcX0, srcY0, srcX1, srcY1, dstX0,
                                                       dstY0, dstX1, dstY1, mask, filter));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->blitFramebufferNV(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask,
@@ -11901,6 +12356,7 @@ void GL_APIENTRY GL_BufferDataContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferData(context, targetPacked, size, data, usagePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferData(targetPacked, size, data, usagePacked);
@@ -11933,6 +12389,7 @@ void GL_APIENTRY GL_BufferStorageEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferStorageEXT(context, targetPacked, size, data, flags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferStorage(targetPacked, size, data, flags);
@@ -11969,6 +12426,7 @@ void GL_APIENTRY GL_BufferStorageExternalEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferStorageExternalEXT(context, targetPacked, offset, size,
                                                              clientBuffer, flags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferStorageExternal(targetPacked, offset, size, clientBuffer, flags);
@@ -12003,6 +12461,7 @@ void GL_APIENTRY GL_BufferStorageMemEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBufferStorageMemEXT(context, targetPacked, size, memoryPacked, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferStorageMem(targetPacked, size, memoryPacked, offset);
@@ -12036,6 +12495,7 @@ void GL_APIENTRY GL_BufferSubDataContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferSubData(context, targetPacked, offset, size, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bufferSubData(targetPacked, offset, size, data);
@@ -12061,6 +12521,7 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatusContextANGLE(GLeglContext ctx, GLenu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCheckFramebufferStatus(context, target));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->checkFramebufferStatus(target);
@@ -12093,6 +12554,7 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatusOESContextANGLE(GLeglContext ctx, GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCheckFramebufferStatusOES(context, target));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->checkFramebufferStatus(target);
@@ -12124,6 +12586,7 @@ void GL_APIENTRY GL_ClearContextANGLE(GLeglContext ctx, GLbitfield mask)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClear(context, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clear(mask);
@@ -12153,6 +12616,7 @@ void GL_APIENTRY GL_ClearBufferfiContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferfi(context, buffer, drawbuffer, depth, stencil));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearBufferfi(buffer, drawbuffer, depth, stencil);
@@ -12181,6 +12645,7 @@ void GL_APIENTRY GL_ClearBufferfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferfv(context, buffer, drawbuffer, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearBufferfv(buffer, drawbuffer, value);
@@ -12209,6 +12674,7 @@ void GL_APIENTRY GL_ClearBufferivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferiv(context, buffer, drawbuffer, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearBufferiv(buffer, drawbuffer, value);
@@ -12237,6 +12703,7 @@ void GL_APIENTRY GL_ClearBufferuivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferuiv(context, buffer, drawbuffer, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearBufferuiv(buffer, drawbuffer, value);
@@ -12262,6 +12729,7 @@ GL_ClearColorContextANGLE(GLeglContext ctx, GLfloat red, GLfloat green, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearColor(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearColor(red, green, blue, alpha);
@@ -12291,6 +12759,7 @@ void GL_APIENTRY GL_ClearColorxContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearColorx(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearColorx(red, green, blue, alpha);
@@ -12313,6 +12782,7 @@ void GL_APIENTRY GL_ClearDepthfContextANGLE(GLeglContext ctx, GLfloat d)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepthf(context, d));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearDepthf(d);
@@ -12335,6 +12805,7 @@ void GL_APIENTRY GL_ClearDepthxContextANGLE(GLeglContext ctx, GLfixed depth)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepthx(context, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearDepthx(depth);
@@ -12357,6 +12828,7 @@ void GL_APIENTRY GL_ClearStencilContextANGLE(GLeglContext ctx, GLint s)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearStencil(context, s));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clearStencil(s);
@@ -12381,6 +12853,7 @@ void GL_APIENTRY GL_ClientActiveTextureContextANGLE(GLeglContext ctx, GLenum tex
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClientActiveTexture(context, texture));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clientActiveTexture(texture);
@@ -12411,6 +12884,7 @@ GLenum GL_APIENTRY GL_ClientWaitSyncContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClientWaitSync(context, sync, flags, timeout));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->clientWaitSync(sync, flags, timeout);
@@ -12442,6 +12916,7 @@ void GL_APIENTRY GL_ClipControlEXTContextANGLE(GLeglContext ctx, GLenum origin,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClipControlEXT(context, origin, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clipControl(origin, depth);
@@ -12465,6 +12940,7 @@ void GL_APIENTRY GL_ClipPlanefContextANGLE(GLeglContext ctx, GLenum p, const GLf
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClipPlanef(context, p, eqn));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clipPlanef(p, eqn);
@@ -12489,6 +12965,7 @@ void GL_APIENTRY GL_ClipPlanexContextANGLE(GLeglContext ctx, GLenum plane, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClipPlanex(context, plane, equation));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->clipPlanex(plane, equation);
@@ -12514,6 +12991,7 @@ GL_Color4fContextANGLE(GLeglContext ctx, GLfloat red, GLfloat green, GLfloat blu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4f(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4f(red, green, blue, alpha);
@@ -12539,6 +13017,7 @@ GL_Color4ubContextANGLE(GLeglContext ctx, GLubyte red, GLubyte green, GLubyte bl
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4ub(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4ub(red, green, blue, alpha);
@@ -12564,6 +13043,7 @@ GL_Color4xContextANGLE(GLeglContext ctx, GLfixed red, GLfixed green, GLfixed blu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4x(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->color4x(red, green, blue, alpha);
@@ -12593,6 +13073,7 @@ void GL_APIENTRY GL_ColorMaskContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMask(context, red, green, blue, alpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorMask(red, green, blue, alpha);
@@ -12623,6 +13104,7 @@ void GL_APIENTRY GL_ColorMaskiContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaski(context, index, r, g, b, a));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorMaski(index, r, g, b, a);
@@ -12653,6 +13135,7 @@ void GL_APIENTRY GL_ColorMaskiEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaskiEXT(context, index, r, g, b, a));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorMaski(index, r, g, b, a);
@@ -12683,6 +13166,7 @@ void GL_APIENTRY GL_ColorMaskiOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaskiOES(context, index, r, g, b, a));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorMaski(index, r, g, b, a);
@@ -12714,6 +13198,7 @@ void GL_APIENTRY GL_ColorPointerContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColorPointer(context, size, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->colorPointer(size, typePacked, stride, pointer);
@@ -12738,6 +13223,7 @@ void GL_APIENTRY GL_CompileShaderContextANGLE(GLeglContext ctx, GLuint shader)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCompileShader(context, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compileShader(shaderPacked);
@@ -12777,6 +13263,7 @@ void GL_APIENTRY GL_CompressedTexImage2DContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateCompressedTexImage2D(context, targetPacked, level, internalformat, width,
                                           height, border, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage2D(targetPacked, level, internalformat, width, height,
@@ -12819,6 +13306,7 @@ void GL_APIENTRY GL_CompressedTexImage3DContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateCompressedTexImage3D(context, targetPacked, level, internalformat, width,
                                           height, depth, border, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage3D(targetPacked, level, internalformat, width, height, depth,
@@ -12861,6 +13349,7 @@ void GL_APIENTRY GL_CompressedTexImage3DOESContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateCompressedTexImage3DOES(context, targetPacked, level, internalformat, width,
                                              height, depth, border, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage3D(targetPacked, level, internalformat, width, height, depth,
@@ -12903,6 +13392,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2DContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateCompressedTexSubImage2D(context, targetPacked, level, xoffset, yoffset, width,
                                              height, format, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage2D(targetPacked, level, xoffset, yoffset, width, height,
@@ -12947,6 +13437,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3DContextANGLE(GLeglContext ctx,
                             ValidateCompressedTexSubImage3D(context, targetPacked, level, xoffset,
                                                             yoffset, zoffset, width, height, depth,
                                                             format, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, width,
@@ -12991,6 +13482,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3DOESContextANGLE(GLeglContext ctx,
                             ValidateCompressedTexSubImage3DOES(
                                 context, targetPacked, level, xoffset, yoffset, zoffset, width,
                                 height, depth, format, imageSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, width,
@@ -13030,6 +13522,7 @@ void GL_APIENTRY GL_CopyBufferSubDataContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyBufferSubData(context, readTargetPacked, writeTargetPacked,
                                                       readOffset, writeOffset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyBufferSubData(readTargetPacked, writeTargetPacked, readOffset, writeOffset,
@@ -13079,6 +13572,7 @@ void GL_APIENTRY GL_CopyImageSubDataContextANGLE(GLeglContext ctx,
                             ValidateCopyImageSubData(context, srcName, srcTarget, srcLevel, srcX,
                                                      srcY, srcZ, dstName, dstTarget, dstLevel, dstX,
                                                      dstY, dstZ, srcWidth, srcHeight, srcDepth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName,
@@ -13131,6 +13625,7 @@ void GL_APIENTRY GL_CopyImageSubDataEXTContextANGLE(GLeglContext ctx,
              ValidateCopyImageSubDataEXT(context, srcName, srcTarget, srcLevel, srcX, srcY, srcZ,
                                          dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth,
                                          srcHeight, srcDepth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName,
@@ -13183,6 +13678,7 @@ void GL_APIENTRY GL_CopyImageSubDataOESContextANGLE(GLeglContext ctx,
              ValidateCopyImageSubDataOES(context, srcName, srcTarget, srcLevel, srcX, srcY, srcZ,
                                          dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth,
                                          srcHeight, srcDepth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName,
@@ -13224,6 +13720,7 @@ void GL_APIENTRY GL_CopyTexImage2DContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTexImage2D(context, targetPacked, level, internalformat, x,
                                                    y, width, height, border));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexImage2D(targetPacked, level, internalformat, x, y, width, height,
@@ -13263,6 +13760,7 @@ void GL_APIENTRY GL_CopyTexSubImage2DContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTexSubImage2D(context, targetPacked, level, xoffset,
                                                       yoffset, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexSubImage2D(targetPacked, level, xoffset, yoffset, x, y, width, height);
@@ -13302,6 +13800,7 @@ void GL_APIENTRY GL_CopyTexSubImage3DContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTexSubImage3D(context, targetPacked, level, xoffset,
                                                       yoffset, zoffset, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, x, y, width,
@@ -13342,6 +13841,7 @@ void GL_APIENTRY GL_CopyTexSubImage3DOESContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTexSubImage3DOES(context, targetPacked, level, xoffset,
                                                          yoffset, zoffset, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, x, y, width,
@@ -13372,6 +13872,7 @@ void GL_APIENTRY GL_CreateMemoryObjectsEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCreateMemoryObjectsEXT(context, n, memoryObjectsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->createMemoryObjects(n, memoryObjectsPacked);
@@ -13395,6 +13896,7 @@ GLuint GL_APIENTRY GL_CreateProgramContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCreateProgram(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->createProgram();
@@ -13426,6 +13928,7 @@ GLuint GL_APIENTRY GL_CreateShaderContextANGLE(GLeglContext ctx, GLenum type)
         ShaderType typePacked                                 = PackParam<ShaderType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCreateShader(context, typePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->createShader(typePacked);
@@ -13462,6 +13965,7 @@ GLuint GL_APIENTRY GL_CreateShaderProgramvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCreateShaderProgramv(context, typePacked, count, strings));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->createShaderProgramv(typePacked, count, strings);
@@ -13500,6 +14004,7 @@ GLuint GL_APIENTRY GL_CreateShaderProgramvEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCreateShaderProgramvEXT(context, typePacked, count, strings));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->createShaderProgramv(typePacked, count, strings);
@@ -13532,6 +14037,7 @@ void GL_APIENTRY GL_CullFaceContextANGLE(GLeglContext ctx, GLenum mode)
         CullFaceMode modePacked                               = PackParam<CullFaceMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCullFace(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->cullFace(modePacked);
@@ -13556,6 +14062,7 @@ void GL_APIENTRY GL_CurrentPaletteMatrixOESContextANGLE(GLeglContext ctx, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCurrentPaletteMatrixOES(context, matrixpaletteindex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->currentPaletteMatrix(matrixpaletteindex);
@@ -13583,6 +14090,7 @@ void GL_APIENTRY GL_DebugMessageCallbackContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDebugMessageCallback(context, callback, userParam));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageCallback(callback, userParam);
@@ -13610,6 +14118,7 @@ void GL_APIENTRY GL_DebugMessageCallbackKHRContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDebugMessageCallbackKHR(context, callback, userParam));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageCallback(callback, userParam);
@@ -13646,6 +14155,7 @@ void GL_APIENTRY GL_DebugMessageControlContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDebugMessageControl(context, source, type, severity, count, ids, enabled));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageControl(source, type, severity, count, ids, enabled);
@@ -13683,6 +14193,7 @@ void GL_APIENTRY GL_DebugMessageControlKHRContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDebugMessageControlKHR(context, source, type, severity, count, ids, enabled));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageControl(source, type, severity, count, ids, enabled);
@@ -13719,6 +14230,7 @@ void GL_APIENTRY GL_DebugMessageInsertContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDebugMessageInsert(context, source, type, id, severity, length, buf));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageInsert(source, type, id, severity, length, buf);
@@ -13755,6 +14267,7 @@ void GL_APIENTRY GL_DebugMessageInsertKHRContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDebugMessageInsertKHR(context, source, type, id, severity, length, buf));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->debugMessageInsert(source, type, id, severity, length, buf);
@@ -13781,6 +14294,7 @@ void GL_APIENTRY GL_DeleteBuffersContextANGLE(GLeglContext ctx, GLsizei n, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteBuffers(context, n, buffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteBuffers(n, buffersPacked);
@@ -13806,6 +14320,7 @@ void GL_APIENTRY GL_DeleteFencesNVContextANGLE(GLeglContext ctx, GLsizei n, cons
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteFencesNV(context, n, fencesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteFencesNV(n, fencesPacked);
@@ -13833,6 +14348,7 @@ void GL_APIENTRY GL_DeleteFramebuffersContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteFramebuffers(context, n, framebuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteFramebuffers(n, framebuffersPacked);
@@ -13861,6 +14377,7 @@ void GL_APIENTRY GL_DeleteFramebuffersOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteFramebuffersOES(context, n, framebuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteFramebuffers(n, framebuffersPacked);
@@ -13890,6 +14407,7 @@ void GL_APIENTRY GL_DeleteMemoryObjectsEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteMemoryObjectsEXT(context, n, memoryObjectsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteMemoryObjects(n, memoryObjectsPacked);
@@ -13914,6 +14432,7 @@ void GL_APIENTRY GL_DeleteProgramContextANGLE(GLeglContext ctx, GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteProgram(programPacked);
@@ -13941,6 +14460,7 @@ void GL_APIENTRY GL_DeleteProgramPipelinesContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteProgramPipelines(context, n, pipelinesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteProgramPipelines(n, pipelinesPacked);
@@ -13969,6 +14489,7 @@ void GL_APIENTRY GL_DeleteProgramPipelinesEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteProgramPipelinesEXT(context, n, pipelinesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteProgramPipelines(n, pipelinesPacked);
@@ -13994,6 +14515,7 @@ void GL_APIENTRY GL_DeleteQueriesContextANGLE(GLeglContext ctx, GLsizei n, const
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteQueries(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteQueries(n, idsPacked);
@@ -14019,6 +14541,7 @@ void GL_APIENTRY GL_DeleteQueriesEXTContextANGLE(GLeglContext ctx, GLsizei n, co
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteQueriesEXT(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteQueries(n, idsPacked);
@@ -14047,6 +14570,7 @@ void GL_APIENTRY GL_DeleteRenderbuffersContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteRenderbuffers(context, n, renderbuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteRenderbuffers(n, renderbuffersPacked);
@@ -14076,6 +14600,7 @@ void GL_APIENTRY GL_DeleteRenderbuffersOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteRenderbuffersOES(context, n, renderbuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteRenderbuffers(n, renderbuffersPacked);
@@ -14103,6 +14628,7 @@ void GL_APIENTRY GL_DeleteSamplersContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteSamplers(context, count, samplersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteSamplers(count, samplersPacked);
@@ -14130,6 +14656,7 @@ void GL_APIENTRY GL_DeleteSemaphoresEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteSemaphoresEXT(context, n, semaphoresPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteSemaphores(n, semaphoresPacked);
@@ -14154,6 +14681,7 @@ void GL_APIENTRY GL_DeleteShaderContextANGLE(GLeglContext ctx, GLuint shader)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteShader(context, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteShader(shaderPacked);
@@ -14177,6 +14705,7 @@ void GL_APIENTRY GL_DeleteSyncContextANGLE(GLeglContext ctx, GLsync sync)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDeleteSync(context, sync));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteSync(sync);
@@ -14202,6 +14731,7 @@ void GL_APIENTRY GL_DeleteTexturesContextANGLE(GLeglContext ctx, GLsizei n, cons
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteTextures(context, n, texturesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteTextures(n, texturesPacked);
@@ -14229,6 +14759,7 @@ void GL_APIENTRY GL_DeleteTransformFeedbacksContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteTransformFeedbacks(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteTransformFeedbacks(n, idsPacked);
@@ -14256,6 +14787,7 @@ void GL_APIENTRY GL_DeleteVertexArraysContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteVertexArrays(context, n, arraysPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteVertexArrays(n, arraysPacked);
@@ -14283,6 +14815,7 @@ void GL_APIENTRY GL_DeleteVertexArraysOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDeleteVertexArraysOES(context, n, arraysPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->deleteVertexArrays(n, arraysPacked);
@@ -14306,6 +14839,7 @@ void GL_APIENTRY GL_DepthFuncContextANGLE(GLeglContext ctx, GLenum func)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthFunc(context, func));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthFunc(func);
@@ -14328,6 +14862,7 @@ void GL_APIENTRY GL_DepthMaskContextANGLE(GLeglContext ctx, GLboolean flag)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthMask(context, flag));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthMask(flag);
@@ -14350,6 +14885,7 @@ void GL_APIENTRY GL_DepthRangefContextANGLE(GLeglContext ctx, GLfloat n, GLfloat
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRangef(context, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthRangef(n, f);
@@ -14372,6 +14908,7 @@ void GL_APIENTRY GL_DepthRangexContextANGLE(GLeglContext ctx, GLfixed n, GLfixed
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRangex(context, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->depthRangex(n, f);
@@ -14398,6 +14935,7 @@ void GL_APIENTRY GL_DetachShaderContextANGLE(GLeglContext ctx, GLuint program, G
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDetachShader(context, programPacked, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->detachShader(programPacked, shaderPacked);
@@ -14421,6 +14959,7 @@ void GL_APIENTRY GL_DisableContextANGLE(GLeglContext ctx, GLenum cap)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisable(context, cap));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disable(cap);
@@ -14446,6 +14985,7 @@ void GL_APIENTRY GL_DisableClientStateContextANGLE(GLeglContext ctx, GLenum arra
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableClientState(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disableClientState(arrayPacked);
@@ -14469,6 +15009,7 @@ void GL_APIENTRY GL_DisableVertexAttribArrayContextANGLE(GLeglContext ctx, GLuin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableVertexAttribArray(context, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disableVertexAttribArray(index);
@@ -14492,6 +15033,7 @@ void GL_APIENTRY GL_DisableiContextANGLE(GLeglContext ctx, GLenum target, GLuint
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisablei(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disablei(target, index);
@@ -14516,6 +15058,7 @@ void GL_APIENTRY GL_DisableiEXTContextANGLE(GLeglContext ctx, GLenum target, GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableiEXT(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disablei(target, index);
@@ -14540,6 +15083,7 @@ void GL_APIENTRY GL_DisableiOESContextANGLE(GLeglContext ctx, GLenum target, GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableiOES(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disablei(target, index);
@@ -14570,6 +15114,7 @@ void GL_APIENTRY GL_DiscardFramebufferEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDiscardFramebufferEXT(context, target, numAttachments, attachments));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->discardFramebuffer(target, numAttachments, attachments);
@@ -14600,6 +15145,7 @@ void GL_APIENTRY GL_DispatchComputeContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDispatchCompute(context, num_groups_x, num_groups_y, num_groups_z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->dispatchCompute(num_groups_x, num_groups_y, num_groups_z);
@@ -14625,6 +15171,7 @@ void GL_APIENTRY GL_DispatchComputeIndirectContextANGLE(GLeglContext ctx, GLintp
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDispatchComputeIndirect(context, indirect));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->dispatchComputeIndirect(indirect);
@@ -14653,6 +15200,7 @@ void GL_APIENTRY GL_DrawArraysContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawArrays(context, modePacked, first, count));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArrays(modePacked, first, count);
@@ -14680,6 +15228,7 @@ void GL_APIENTRY GL_DrawArraysIndirectContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawArraysIndirect(context, modePacked, indirect));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArraysIndirect(modePacked, indirect);
@@ -14711,6 +15260,7 @@ void GL_APIENTRY GL_DrawArraysInstancedContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawArraysInstanced(context, modePacked, first, count, instancecount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArraysInstanced(modePacked, first, count, instancecount);
@@ -14743,6 +15293,7 @@ void GL_APIENTRY GL_DrawArraysInstancedANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawArraysInstancedANGLE(context, modePacked, first, count, primcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArraysInstanced(modePacked, first, count, primcount);
@@ -14775,6 +15326,7 @@ void GL_APIENTRY GL_DrawArraysInstancedEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawArraysInstancedEXT(context, modePacked, start, count, primcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArraysInstanced(modePacked, start, count, primcount);
@@ -14799,6 +15351,7 @@ void GL_APIENTRY GL_DrawBuffersContextANGLE(GLeglContext ctx, GLsizei n, const G
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawBuffers(context, n, bufs));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawBuffers(n, bufs);
@@ -14822,6 +15375,7 @@ void GL_APIENTRY GL_DrawBuffersEXTContextANGLE(GLeglContext ctx, GLsizei n, cons
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawBuffersEXT(context, n, bufs));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawBuffers(n, bufs);
@@ -14854,6 +15408,7 @@ void GL_APIENTRY GL_DrawElementsContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElements(context, modePacked, count, typePacked, indices));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElements(modePacked, count, typePacked, indices);
@@ -14889,6 +15444,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertexContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsBaseVertex(context, modePacked, count, typePacked,
                                                            indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsBaseVertex(modePacked, count, typePacked, indices, basevertex);
@@ -14925,6 +15481,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertexEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsBaseVertexEXT(context, modePacked, count,
                                                               typePacked, indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsBaseVertex(modePacked, count, typePacked, indices, basevertex);
@@ -14961,6 +15518,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertexOESContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsBaseVertexOES(context, modePacked, count,
                                                               typePacked, indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsBaseVertex(modePacked, count, typePacked, indices, basevertex);
@@ -14994,6 +15552,7 @@ void GL_APIENTRY GL_DrawElementsIndirectContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawElementsIndirect(context, modePacked, typePacked, indirect));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsIndirect(modePacked, typePacked, indirect);
@@ -15029,6 +15588,7 @@ void GL_APIENTRY GL_DrawElementsInstancedContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsInstanced(context, modePacked, count, typePacked,
                                                           indices, instancecount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstanced(modePacked, count, typePacked, indices, instancecount);
@@ -15065,6 +15625,7 @@ void GL_APIENTRY GL_DrawElementsInstancedANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsInstancedANGLE(context, modePacked, count,
                                                                typePacked, indices, primcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstanced(modePacked, count, typePacked, indices, primcount);
@@ -15103,6 +15664,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexContextANGLE(GLeglContext ctx
         bool isCallValid = (context->skipValidation() || ValidateDrawElementsInstancedBaseVertex(
                                                              context, modePacked, count, typePacked,
                                                              indices, instancecount, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstancedBaseVertex(modePacked, count, typePacked, indices,
@@ -15142,6 +15704,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexEXTContextANGLE(GLeglContext
         bool isCallValid = (context->skipValidation() || ValidateDrawElementsInstancedBaseVertexEXT(
                                                              context, modePacked, count, typePacked,
                                                              indices, instancecount, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstancedBaseVertex(modePacked, count, typePacked, indices,
@@ -15181,6 +15744,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexOESContextANGLE(GLeglContext
         bool isCallValid = (context->skipValidation() || ValidateDrawElementsInstancedBaseVertexOES(
                                                              context, modePacked, count, typePacked,
                                                              indices, instancecount, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstancedBaseVertex(modePacked, count, typePacked, indices,
@@ -15218,6 +15782,7 @@ void GL_APIENTRY GL_DrawElementsInstancedEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsInstancedEXT(context, modePacked, count, typePacked,
                                                              indices, primcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstanced(modePacked, count, typePacked, indices, primcount);
@@ -15255,6 +15820,7 @@ void GL_APIENTRY GL_DrawRangeElementsContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateDrawRangeElements(context, modePacked, start, end,
                                                                     count, typePacked, indices));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawRangeElements(modePacked, start, end, count, typePacked, indices);
@@ -15293,6 +15859,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexContextANGLE(GLeglContext ctx,
         bool isCallValid = (context->skipValidation() || ValidateDrawRangeElementsBaseVertex(
                                                              context, modePacked, start, end, count,
                                                              typePacked, indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawRangeElementsBaseVertex(modePacked, start, end, count, typePacked, indices,
@@ -15332,6 +15899,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexEXTContextANGLE(GLeglContext ctx,
         bool isCallValid = (context->skipValidation() || ValidateDrawRangeElementsBaseVertexEXT(
                                                              context, modePacked, start, end, count,
                                                              typePacked, indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawRangeElementsBaseVertex(modePacked, start, end, count, typePacked, indices,
@@ -15371,6 +15939,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexOESContextANGLE(GLeglContext ctx,
         bool isCallValid = (context->skipValidation() || ValidateDrawRangeElementsBaseVertexOES(
                                                              context, modePacked, start, end, count,
                                                              typePacked, indices, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawRangeElementsBaseVertex(modePacked, start, end, count, typePacked, indices,
@@ -15402,6 +15971,7 @@ void GL_APIENTRY GL_DrawTexfOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexfOES(context, x, y, z, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexf(x, y, z, width, height);
@@ -15425,6 +15995,7 @@ void GL_APIENTRY GL_DrawTexfvOESContextANGLE(GLeglContext ctx, const GLfloat *co
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawTexfvOES(context, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexfv(coords);
@@ -15450,6 +16021,7 @@ GL_DrawTexiOESContextANGLE(GLeglContext ctx, GLint x, GLint y, GLint z, GLint wi
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexiOES(context, x, y, z, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexi(x, y, z, width, height);
@@ -15473,6 +16045,7 @@ void GL_APIENTRY GL_DrawTexivOESContextANGLE(GLeglContext ctx, const GLint *coor
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawTexivOES(context, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexiv(coords);
@@ -15502,6 +16075,7 @@ void GL_APIENTRY GL_DrawTexsOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexsOES(context, x, y, z, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexs(x, y, z, width, height);
@@ -15525,6 +16099,7 @@ void GL_APIENTRY GL_DrawTexsvOESContextANGLE(GLeglContext ctx, const GLshort *co
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawTexsvOES(context, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexsv(coords);
@@ -15555,6 +16130,7 @@ void GL_APIENTRY GL_DrawTexxOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexxOES(context, x, y, z, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexx(x, y, z, width, height);
@@ -15578,6 +16154,7 @@ void GL_APIENTRY GL_DrawTexxvOESContextANGLE(GLeglContext ctx, const GLfixed *co
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawTexxvOES(context, coords));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawTexxv(coords);
@@ -15605,6 +16182,7 @@ void GL_APIENTRY GL_EGLImageTargetRenderbufferStorageOESContextANGLE(GLeglContex
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEGLImageTargetRenderbufferStorageOES(context, target, image));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->eGLImageTargetRenderbufferStorage(target, image);
@@ -15633,6 +16211,7 @@ void GL_APIENTRY GL_EGLImageTargetTexture2DOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEGLImageTargetTexture2DOES(context, targetPacked, image));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->eGLImageTargetTexture2D(targetPacked, image);
@@ -15656,6 +16235,7 @@ void GL_APIENTRY GL_EnableContextANGLE(GLeglContext ctx, GLenum cap)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnable(context, cap));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enable(cap);
@@ -15681,6 +16261,7 @@ void GL_APIENTRY GL_EnableClientStateContextANGLE(GLeglContext ctx, GLenum array
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableClientState(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enableClientState(arrayPacked);
@@ -15704,6 +16285,7 @@ void GL_APIENTRY GL_EnableVertexAttribArrayContextANGLE(GLeglContext ctx, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableVertexAttribArray(context, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enableVertexAttribArray(index);
@@ -15727,6 +16309,7 @@ void GL_APIENTRY GL_EnableiContextANGLE(GLeglContext ctx, GLenum target, GLuint
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnablei(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enablei(target, index);
@@ -15751,6 +16334,7 @@ void GL_APIENTRY GL_EnableiEXTContextANGLE(GLeglContext ctx, GLenum target, GLui
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableiEXT(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enablei(target, index);
@@ -15775,6 +16359,7 @@ void GL_APIENTRY GL_EnableiOESContextANGLE(GLeglContext ctx, GLenum target, GLui
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableiOES(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->enablei(target, index);
@@ -15799,6 +16384,7 @@ void GL_APIENTRY GL_EndQueryContextANGLE(GLeglContext ctx, GLenum target)
         QueryType targetPacked                                = PackParam<QueryType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndQuery(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->endQuery(targetPacked);
@@ -15824,6 +16410,7 @@ void GL_APIENTRY GL_EndQueryEXTContextANGLE(GLeglContext ctx, GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEndQueryEXT(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->endQuery(targetPacked);
@@ -15846,6 +16433,7 @@ void GL_APIENTRY GL_EndTransformFeedbackContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndTransformFeedback(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->endTransformFeedback();
@@ -15872,6 +16460,7 @@ GLsync GL_APIENTRY GL_FenceSyncContextANGLE(GLeglContext ctx, GLenum condition,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFenceSync(context, condition, flags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->fenceSync(condition, flags);
@@ -15900,6 +16489,7 @@ void GL_APIENTRY GL_FinishContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFinish(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->finish();
@@ -15924,6 +16514,7 @@ void GL_APIENTRY GL_FinishFenceNVContextANGLE(GLeglContext ctx, GLuint fence)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFinishFenceNV(context, fencePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->finishFenceNV(fencePacked);
@@ -15946,6 +16537,7 @@ void GL_APIENTRY GL_FlushContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFlush(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->flush();
@@ -15976,6 +16568,7 @@ void GL_APIENTRY GL_FlushMappedBufferRangeContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFlushMappedBufferRange(context, targetPacked, offset, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->flushMappedBufferRange(targetPacked, offset, length);
@@ -16007,6 +16600,7 @@ void GL_APIENTRY GL_FlushMappedBufferRangeEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateFlushMappedBufferRangeEXT(context, targetPacked, offset, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->flushMappedBufferRange(targetPacked, offset, length);
@@ -16031,6 +16625,7 @@ void GL_APIENTRY GL_FogfContextANGLE(GLeglContext ctx, GLenum pname, GLfloat par
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogf(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogf(pname, param);
@@ -16054,6 +16649,7 @@ void GL_APIENTRY GL_FogfvContextANGLE(GLeglContext ctx, GLenum pname, const GLfl
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogfv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogfv(pname, params);
@@ -16077,6 +16673,7 @@ void GL_APIENTRY GL_FogxContextANGLE(GLeglContext ctx, GLenum pname, GLfixed par
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogx(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogx(pname, param);
@@ -16100,6 +16697,7 @@ void GL_APIENTRY GL_FogxvContextANGLE(GLeglContext ctx, GLenum pname, const GLfi
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogxv(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->fogxv(pname, param);
@@ -16123,6 +16721,7 @@ void GL_APIENTRY GL_FramebufferFetchBarrierEXTContextANGLE(GLeglContext ctx)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFramebufferFetchBarrierEXT(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferFetchBarrier();
@@ -16151,6 +16750,7 @@ void GL_APIENTRY GL_FramebufferParameteriContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferParameteri(context, target, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferParameteri(target, pname, param);
@@ -16185,6 +16785,7 @@ void GL_APIENTRY GL_FramebufferRenderbufferContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateFramebufferRenderbuffer(context, target, attachment, renderbuffertarget,
                                              renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferRenderbuffer(target, attachment, renderbuffertarget,
@@ -16221,6 +16822,7 @@ void GL_APIENTRY GL_FramebufferRenderbufferOESContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateFramebufferRenderbufferOES(context, target, attachment, renderbuffertarget,
                                                 renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferRenderbuffer(target, attachment, renderbuffertarget,
@@ -16255,6 +16857,7 @@ void GL_APIENTRY GL_FramebufferTextureContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateFramebufferTexture(context, target, attachment, texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture(target, attachment, texturePacked, level);
@@ -16291,6 +16894,7 @@ void GL_APIENTRY GL_FramebufferTexture2DContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferTexture2D(context, target, attachment,
                                                          textargetPacked, texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture2D(target, attachment, textargetPacked, texturePacked,
@@ -16331,6 +16935,7 @@ void GL_APIENTRY GL_FramebufferTexture2DMultisampleEXTContextANGLE(GLeglContext
             (context->skipValidation() ||
              ValidateFramebufferTexture2DMultisampleEXT(
                  context, target, attachment, textargetPacked, texturePacked, level, samples));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture2DMultisample(target, attachment, textargetPacked,
@@ -16368,6 +16973,7 @@ void GL_APIENTRY GL_FramebufferTexture2DOESContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferTexture2DOES(context, target, attachment,
                                                             textargetPacked, texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture2D(target, attachment, textargetPacked, texturePacked,
@@ -16408,6 +17014,7 @@ void GL_APIENTRY GL_FramebufferTexture3DOESContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateFramebufferTexture3DOES(context, target, attachment, textargetPacked,
                                              texturePacked, level, zoffset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture3D(target, attachment, textargetPacked, texturePacked, level,
@@ -16442,6 +17049,7 @@ void GL_APIENTRY GL_FramebufferTextureEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateFramebufferTextureEXT(context, target, attachment, texturePacked, level));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTexture(target, attachment, texturePacked, level);
@@ -16476,6 +17084,7 @@ void GL_APIENTRY GL_FramebufferTextureLayerContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferTextureLayer(context, target, attachment,
                                                             texturePacked, level, layer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTextureLayer(target, attachment, texturePacked, level, layer);
@@ -16514,6 +17123,7 @@ void GL_APIENTRY GL_FramebufferTextureMultiviewOVRContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateFramebufferTextureMultiviewOVR(context, target, attachment, texturePacked,
                                                     level, baseViewIndex, numViews));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->framebufferTextureMultiview(target, attachment, texturePacked, level,
@@ -16539,6 +17149,7 @@ void GL_APIENTRY GL_FrontFaceContextANGLE(GLeglContext ctx, GLenum mode)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFrontFace(context, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->frontFace(mode);
@@ -16569,6 +17180,7 @@ void GL_APIENTRY GL_FrustumfContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFrustumf(context, l, r, b, t, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->frustumf(l, r, b, t, n, f);
@@ -16600,6 +17212,7 @@ void GL_APIENTRY GL_FrustumxContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFrustumx(context, l, r, b, t, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->frustumx(l, r, b, t, n, f);
@@ -16625,6 +17238,7 @@ void GL_APIENTRY GL_GenBuffersContextANGLE(GLeglContext ctx, GLsizei n, GLuint *
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenBuffers(context, n, buffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genBuffers(n, buffersPacked);
@@ -16650,6 +17264,7 @@ void GL_APIENTRY GL_GenFencesNVContextANGLE(GLeglContext ctx, GLsizei n, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenFencesNV(context, n, fencesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genFencesNV(n, fencesPacked);
@@ -16675,6 +17290,7 @@ void GL_APIENTRY GL_GenFramebuffersContextANGLE(GLeglContext ctx, GLsizei n, GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenFramebuffers(context, n, framebuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genFramebuffers(n, framebuffersPacked);
@@ -16702,6 +17318,7 @@ void GL_APIENTRY GL_GenFramebuffersOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGenFramebuffersOES(context, n, framebuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genFramebuffers(n, framebuffersPacked);
@@ -16727,6 +17344,7 @@ void GL_APIENTRY GL_GenProgramPipelinesContextANGLE(GLeglContext ctx, GLsizei n,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenProgramPipelines(context, n, pipelinesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genProgramPipelines(n, pipelinesPacked);
@@ -16754,6 +17372,7 @@ void GL_APIENTRY GL_GenProgramPipelinesEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGenProgramPipelinesEXT(context, n, pipelinesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genProgramPipelines(n, pipelinesPacked);
@@ -16778,6 +17397,7 @@ void GL_APIENTRY GL_GenQueriesContextANGLE(GLeglContext ctx, GLsizei n, GLuint *
         QueryID *idsPacked                                    = PackParam<QueryID *>(ids);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGenQueries(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genQueries(n, idsPacked);
@@ -16803,6 +17423,7 @@ void GL_APIENTRY GL_GenQueriesEXTContextANGLE(GLeglContext ctx, GLsizei n, GLuin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenQueriesEXT(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genQueries(n, idsPacked);
@@ -16828,6 +17449,7 @@ void GL_APIENTRY GL_GenRenderbuffersContextANGLE(GLeglContext ctx, GLsizei n, GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGenRenderbuffers(context, n, renderbuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genRenderbuffers(n, renderbuffersPacked);
@@ -16855,6 +17477,7 @@ void GL_APIENTRY GL_GenRenderbuffersOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGenRenderbuffersOES(context, n, renderbuffersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genRenderbuffers(n, renderbuffersPacked);
@@ -16880,6 +17503,7 @@ void GL_APIENTRY GL_GenSamplersContextANGLE(GLeglContext ctx, GLsizei count, GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenSamplers(context, count, samplersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genSamplers(count, samplersPacked);
@@ -16905,6 +17529,7 @@ void GL_APIENTRY GL_GenSemaphoresEXTContextANGLE(GLeglContext ctx, GLsizei n, GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenSemaphoresEXT(context, n, semaphoresPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genSemaphores(n, semaphoresPacked);
@@ -16930,6 +17555,7 @@ void GL_APIENTRY GL_GenTexturesContextANGLE(GLeglContext ctx, GLsizei n, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenTextures(context, n, texturesPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genTextures(n, texturesPacked);
@@ -16955,6 +17581,7 @@ void GL_APIENTRY GL_GenTransformFeedbacksContextANGLE(GLeglContext ctx, GLsizei
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenTransformFeedbacks(context, n, idsPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genTransformFeedbacks(n, idsPacked);
@@ -16980,6 +17607,7 @@ void GL_APIENTRY GL_GenVertexArraysContextANGLE(GLeglContext ctx, GLsizei n, GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenVertexArrays(context, n, arraysPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genVertexArrays(n, arraysPacked);
@@ -17005,6 +17633,7 @@ void GL_APIENTRY GL_GenVertexArraysOESContextANGLE(GLeglContext ctx, GLsizei n,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenVertexArraysOES(context, n, arraysPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->genVertexArrays(n, arraysPacked);
@@ -17030,6 +17659,7 @@ void GL_APIENTRY GL_GenerateMipmapContextANGLE(GLeglContext ctx, GLenum target)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenerateMipmap(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->generateMipmap(targetPacked);
@@ -17055,6 +17685,7 @@ void GL_APIENTRY GL_GenerateMipmapOESContextANGLE(GLeglContext ctx, GLenum targe
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGenerateMipmapOES(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->generateMipmap(targetPacked);
@@ -17091,6 +17722,7 @@ void GL_APIENTRY GL_GetActiveAttribContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveAttrib(context, programPacked, index, bufSize, length,
                                                     size, type, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveAttrib(programPacked, index, bufSize, length, size, type, name);
@@ -17128,6 +17760,7 @@ void GL_APIENTRY GL_GetActiveUniformContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveUniform(context, programPacked, index, bufSize, length,
                                                      size, type, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniform(programPacked, index, bufSize, length, size, type, name);
@@ -17166,6 +17799,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockNameContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateGetActiveUniformBlockName(context, programPacked, uniformBlockIndexPacked,
                                                bufSize, length, uniformBlockName));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniformBlockName(programPacked, uniformBlockIndexPacked, bufSize,
@@ -17202,6 +17836,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockivContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveUniformBlockiv(
                                 context, programPacked, uniformBlockIndexPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniformBlockiv(programPacked, uniformBlockIndexPacked, pname, params);
@@ -17237,6 +17872,7 @@ void GL_APIENTRY GL_GetActiveUniformsivContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveUniformsiv(context, programPacked, uniformCount,
                                                         uniformIndices, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniformsiv(programPacked, uniformCount, uniformIndices, pname,
@@ -17272,6 +17908,7 @@ void GL_APIENTRY GL_GetAttachedShadersContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetAttachedShaders(context, programPacked, maxCount, count, shadersPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getAttachedShaders(programPacked, maxCount, count, shadersPacked);
@@ -17301,6 +17938,7 @@ GLint GL_APIENTRY GL_GetAttribLocationContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetAttribLocation(context, programPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getAttribLocation(programPacked, name);
@@ -17335,6 +17973,7 @@ void GL_APIENTRY GL_GetBooleani_vContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetBooleani_v(context, target, index, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBooleani_v(target, index, data);
@@ -17358,6 +17997,7 @@ void GL_APIENTRY GL_GetBooleanvContextANGLE(GLeglContext ctx, GLenum pname, GLbo
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetBooleanv(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBooleanv(pname, data);
@@ -17388,6 +18028,7 @@ void GL_APIENTRY GL_GetBufferParameteri64vContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferParameteri64v(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferParameteri64v(targetPacked, pname, params);
@@ -17418,6 +18059,7 @@ void GL_APIENTRY GL_GetBufferParameterivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferParameteriv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferParameteriv(targetPacked, pname, params);
@@ -17448,6 +18090,7 @@ void GL_APIENTRY GL_GetBufferPointervContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferPointerv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferPointerv(targetPacked, pname, params);
@@ -17478,6 +18121,7 @@ void GL_APIENTRY GL_GetBufferPointervOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferPointervOES(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferPointerv(targetPacked, pname, params);
@@ -17502,6 +18146,7 @@ void GL_APIENTRY GL_GetClipPlanefContextANGLE(GLeglContext ctx, GLenum plane, GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetClipPlanef(context, plane, equation));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getClipPlanef(plane, equation);
@@ -17526,6 +18171,7 @@ void GL_APIENTRY GL_GetClipPlanexContextANGLE(GLeglContext ctx, GLenum plane, GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetClipPlanex(context, plane, equation));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getClipPlanex(plane, equation);
@@ -17564,6 +18210,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLogContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetDebugMessageLog(context, count, bufSize, sources, types, ids,
                                                        severities, lengths, messageLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getDebugMessageLog(count, bufSize, sources, types, ids,
@@ -17610,6 +18257,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLogKHRContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetDebugMessageLogKHR(context, count, bufSize, sources, types,
                                                           ids, severities, lengths, messageLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getDebugMessageLog(count, bufSize, sources, types, ids,
@@ -17642,6 +18290,7 @@ GLenum GL_APIENTRY GL_GetErrorContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetError(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getError();
@@ -17677,6 +18326,7 @@ void GL_APIENTRY GL_GetFenceivNVContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFenceivNV(context, fencePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFenceivNV(fencePacked, pname, params);
@@ -17700,6 +18350,7 @@ void GL_APIENTRY GL_GetFixedvContextANGLE(GLeglContext ctx, GLenum pname, GLfixe
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetFixedv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFixedv(pname, params);
@@ -17723,6 +18374,7 @@ void GL_APIENTRY GL_GetFloatvContextANGLE(GLeglContext ctx, GLenum pname, GLfloa
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetFloatv(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFloatv(pname, data);
@@ -17751,6 +18403,7 @@ GLint GL_APIENTRY GL_GetFragDataIndexEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFragDataIndexEXT(context, programPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getFragDataIndex(programPacked, name);
@@ -17785,6 +18438,7 @@ GLint GL_APIENTRY GL_GetFragDataLocationContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFragDataLocation(context, programPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getFragDataLocation(programPacked, name);
@@ -17824,6 +18478,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivContextANGLE(GLeglContext
         bool isCallValid =
             (context->skipValidation() || ValidateGetFramebufferAttachmentParameteriv(
                                               context, target, attachment, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFramebufferAttachmentParameteriv(target, attachment, pname, params);
@@ -17858,6 +18513,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivOESContextANGLE(GLeglCont
         bool isCallValid =
             (context->skipValidation() || ValidateGetFramebufferAttachmentParameterivOES(
                                               context, target, attachment, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFramebufferAttachmentParameteriv(target, attachment, pname, params);
@@ -17889,6 +18545,7 @@ void GL_APIENTRY GL_GetFramebufferParameterivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFramebufferParameteriv(context, target, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFramebufferParameteriv(target, pname, params);
@@ -17912,6 +18569,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatusContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetGraphicsResetStatus(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getGraphicsResetStatus();
@@ -17943,6 +18601,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatusEXTContextANGLE(GLeglContext ctx)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetGraphicsResetStatusEXT(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getGraphicsResetStatus();
@@ -17979,6 +18638,7 @@ void GL_APIENTRY GL_GetInteger64i_vContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetInteger64i_v(context, target, index, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInteger64i_v(target, index, data);
@@ -18003,6 +18663,7 @@ void GL_APIENTRY GL_GetInteger64vContextANGLE(GLeglContext ctx, GLenum pname, GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetInteger64v(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInteger64v(pname, data);
@@ -18027,6 +18688,7 @@ void GL_APIENTRY GL_GetInteger64vEXTContextANGLE(GLeglContext ctx, GLenum pname,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetInteger64vEXT(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInteger64v(pname, data);
@@ -18055,6 +18717,7 @@ void GL_APIENTRY GL_GetIntegeri_vContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetIntegeri_v(context, target, index, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getIntegeri_v(target, index, data);
@@ -18078,6 +18741,7 @@ void GL_APIENTRY GL_GetIntegervContextANGLE(GLeglContext ctx, GLenum pname, GLin
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetIntegerv(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getIntegerv(pname, data);
@@ -18112,6 +18776,7 @@ void GL_APIENTRY GL_GetInternalformativContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetInternalformativ(context, target, internalformat, pname, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInternalformativ(target, internalformat, pname, bufSize, params);
@@ -18142,6 +18807,7 @@ void GL_APIENTRY GL_GetLightfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetLightfv(context, light, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getLightfv(light, pnamePacked, params);
@@ -18171,6 +18837,7 @@ void GL_APIENTRY GL_GetLightxvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetLightxv(context, light, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getLightxv(light, pnamePacked, params);
@@ -18201,6 +18868,7 @@ void GL_APIENTRY GL_GetMaterialfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetMaterialfv(context, face, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMaterialfv(face, pnamePacked, params);
@@ -18231,6 +18899,7 @@ void GL_APIENTRY GL_GetMaterialxvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetMaterialxv(context, face, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMaterialxv(face, pnamePacked, params);
@@ -18262,6 +18931,7 @@ void GL_APIENTRY GL_GetMemoryObjectParameterivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetMemoryObjectParameterivEXT(context, memoryObjectPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMemoryObjectParameteriv(memoryObjectPacked, pname, params);
@@ -18291,6 +18961,7 @@ void GL_APIENTRY GL_GetMultisamplefvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetMultisamplefv(context, pname, index, val));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMultisamplefv(pname, index, val);
@@ -18324,6 +18995,7 @@ void GL_APIENTRY GL_GetObjectLabelContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetObjectLabel(context, identifier, name, bufSize, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getObjectLabel(identifier, name, bufSize, length, label);
@@ -18358,6 +19030,7 @@ void GL_APIENTRY GL_GetObjectLabelEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetObjectLabelEXT(context, type, object, bufSize, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getObjectLabel(type, object, bufSize, length, label);
@@ -18392,6 +19065,7 @@ void GL_APIENTRY GL_GetObjectLabelKHRContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetObjectLabelKHR(context, identifier, name, bufSize, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getObjectLabel(identifier, name, bufSize, length, label);
@@ -18423,6 +19097,7 @@ void GL_APIENTRY GL_GetObjectPtrLabelContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetObjectPtrLabel(context, ptr, bufSize, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getObjectPtrLabel(ptr, bufSize, length, label);
@@ -18453,6 +19128,7 @@ void GL_APIENTRY GL_GetObjectPtrLabelKHRContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetObjectPtrLabelKHR(context, ptr, bufSize, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getObjectPtrLabel(ptr, bufSize, length, label);
@@ -18477,6 +19153,7 @@ void GL_APIENTRY GL_GetPointervContextANGLE(GLeglContext ctx, GLenum pname, void
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetPointerv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getPointerv(pname, params);
@@ -18501,6 +19178,7 @@ void GL_APIENTRY GL_GetPointervKHRContextANGLE(GLeglContext ctx, GLenum pname, v
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetPointervKHR(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getPointerv(pname, params);
@@ -18535,6 +19213,7 @@ void GL_APIENTRY GL_GetProgramBinaryContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateGetProgramBinary(context, programPacked, bufSize,
                                                                    length, binaryFormat, binary));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramBinary(programPacked, bufSize, length, binaryFormat, binary);
@@ -18570,6 +19249,7 @@ void GL_APIENTRY GL_GetProgramBinaryOESContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramBinaryOES(context, programPacked, bufSize, length,
                                                         binaryFormat, binary));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramBinary(programPacked, bufSize, length, binaryFormat, binary);
@@ -18603,6 +19283,7 @@ void GL_APIENTRY GL_GetProgramInfoLogContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramInfoLog(context, programPacked, bufSize, length, infoLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramInfoLog(programPacked, bufSize, length, infoLog);
@@ -18637,6 +19318,7 @@ void GL_APIENTRY GL_GetProgramInterfaceivContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramInterfaceiv(context, programPacked, programInterface,
                                                           pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramInterfaceiv(programPacked, programInterface, pname, params);
@@ -18670,6 +19352,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLogContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramPipelineInfoLog(context, pipelinePacked, bufSize, length, infoLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramPipelineInfoLog(pipelinePacked, bufSize, length, infoLog);
@@ -18703,6 +19386,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLogEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateGetProgramPipelineInfoLogEXT(
                                               context, pipelinePacked, bufSize, length, infoLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramPipelineInfoLog(pipelinePacked, bufSize, length, infoLog);
@@ -18733,6 +19417,7 @@ void GL_APIENTRY GL_GetProgramPipelineivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramPipelineiv(context, pipelinePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramPipelineiv(pipelinePacked, pname, params);
@@ -18763,6 +19448,7 @@ void GL_APIENTRY GL_GetProgramPipelineivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramPipelineivEXT(context, pipelinePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramPipelineiv(pipelinePacked, pname, params);
@@ -18795,6 +19481,7 @@ GLuint GL_APIENTRY GL_GetProgramResourceIndexContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramResourceIndex(context, programPacked, programInterface, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getProgramResourceIndex(programPacked, programInterface, name);
@@ -18835,6 +19522,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocationContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramResourceLocation(context, programPacked, programInterface, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue =
@@ -18877,6 +19565,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocationIndexEXTContextANGLE(GLeglContext
         bool isCallValid =
             (context->skipValidation() || ValidateGetProgramResourceLocationIndexEXT(
                                               context, programPacked, programInterface, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue =
@@ -18923,6 +19612,7 @@ void GL_APIENTRY GL_GetProgramResourceNameContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramResourceName(context, programPacked, programInterface,
                                                            index, bufSize, length, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramResourceName(programPacked, programInterface, index, bufSize, length,
@@ -18963,6 +19653,7 @@ void GL_APIENTRY GL_GetProgramResourceivContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateGetProgramResourceiv(context, programPacked, programInterface, index,
                                           propCount, props, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramResourceiv(programPacked, programInterface, index, propCount, props,
@@ -18994,6 +19685,7 @@ void GL_APIENTRY GL_GetProgramivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramiv(context, programPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramiv(programPacked, pname, params);
@@ -19021,6 +19713,7 @@ void GL_APIENTRY GL_GetQueryObjecti64vEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjecti64vEXT(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjecti64v(idPacked, pname, params);
@@ -19048,6 +19741,7 @@ void GL_APIENTRY GL_GetQueryObjectivEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjectivEXT(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectiv(idPacked, pname, params);
@@ -19075,6 +19769,7 @@ void GL_APIENTRY GL_GetQueryObjectui64vEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjectui64vEXT(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectui64v(idPacked, pname, params);
@@ -19104,6 +19799,7 @@ void GL_APIENTRY GL_GetQueryObjectuivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjectuiv(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectuiv(idPacked, pname, params);
@@ -19133,6 +19829,7 @@ void GL_APIENTRY GL_GetQueryObjectuivEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjectuivEXT(context, idPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectuiv(idPacked, pname, params);
@@ -19163,6 +19860,7 @@ void GL_APIENTRY GL_GetQueryivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetQueryiv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryiv(targetPacked, pname, params);
@@ -19193,6 +19891,7 @@ void GL_APIENTRY GL_GetQueryivEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryivEXT(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryiv(targetPacked, pname, params);
@@ -19222,6 +19921,7 @@ void GL_APIENTRY GL_GetRenderbufferParameterivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetRenderbufferParameteriv(context, target, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getRenderbufferParameteriv(target, pname, params);
@@ -19251,6 +19951,7 @@ void GL_APIENTRY GL_GetRenderbufferParameterivOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetRenderbufferParameterivOES(context, target, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getRenderbufferParameteriv(target, pname, params);
@@ -19280,6 +19981,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterIiv(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIiv(samplerPacked, pname, params);
@@ -19310,6 +20012,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSamplerParameterIivEXT(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIiv(samplerPacked, pname, params);
@@ -19341,6 +20044,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivOESContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSamplerParameterIivOES(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIiv(samplerPacked, pname, params);
@@ -19371,6 +20075,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterIuiv(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIuiv(samplerPacked, pname, params);
@@ -19401,6 +20106,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSamplerParameterIuivEXT(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIuiv(samplerPacked, pname, params);
@@ -19432,6 +20138,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivOESContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSamplerParameterIuivOES(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIuiv(samplerPacked, pname, params);
@@ -19462,6 +20169,7 @@ void GL_APIENTRY GL_GetSamplerParameterfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterfv(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterfv(samplerPacked, pname, params);
@@ -19491,6 +20199,7 @@ void GL_APIENTRY GL_GetSamplerParameterivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameteriv(context, samplerPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameteriv(samplerPacked, pname, params);
@@ -19521,6 +20230,7 @@ void GL_APIENTRY GL_GetSemaphoreParameterui64vEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSemaphoreParameterui64vEXT(context, semaphorePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSemaphoreParameterui64v(semaphorePacked, pname, params);
@@ -19554,6 +20264,7 @@ void GL_APIENTRY GL_GetShaderInfoLogContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetShaderInfoLog(context, shaderPacked, bufSize, length, infoLog));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderInfoLog(shaderPacked, bufSize, length, infoLog);
@@ -19588,6 +20299,7 @@ void GL_APIENTRY GL_GetShaderPrecisionFormatContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetShaderPrecisionFormat(context, shadertype, precisiontype,
                                                              range, precision));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
@@ -19621,6 +20333,7 @@ void GL_APIENTRY GL_GetShaderSourceContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetShaderSource(context, shaderPacked, bufSize, length, source));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderSource(shaderPacked, bufSize, length, source);
@@ -19650,6 +20363,7 @@ void GL_APIENTRY GL_GetShaderivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetShaderiv(context, shaderPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderiv(shaderPacked, pname, params);
@@ -19672,6 +20386,7 @@ const GLubyte *GL_APIENTRY GL_GetStringContextANGLE(GLeglContext ctx, GLenum nam
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetString(context, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getString(name);
@@ -19702,6 +20417,7 @@ const GLubyte *GL_APIENTRY GL_GetStringiContextANGLE(GLeglContext ctx, GLenum na
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateGetStringi(context, name, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getStringi(name, index);
@@ -19740,6 +20456,7 @@ void GL_APIENTRY GL_GetSyncivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSynciv(context, sync, pname, bufSize, length, values));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSynciv(sync, pname, bufSize, length, values);
@@ -19769,6 +20486,7 @@ void GL_APIENTRY GL_GetTexEnvfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexEnvfv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexEnvfv(targetPacked, pnamePacked, params);
@@ -19800,6 +20518,7 @@ void GL_APIENTRY GL_GetTexEnvivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexEnviv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexEnviv(targetPacked, pnamePacked, params);
@@ -19831,6 +20550,7 @@ void GL_APIENTRY GL_GetTexEnvxvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexEnvxv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexEnvxv(targetPacked, pnamePacked, params);
@@ -19860,6 +20580,7 @@ void GL_APIENTRY GL_GetTexGenfvOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetTexGenfvOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexGenfv(coord, pname, params);
@@ -19889,6 +20610,7 @@ void GL_APIENTRY GL_GetTexGenivOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetTexGenivOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexGeniv(coord, pname, params);
@@ -19918,6 +20640,7 @@ void GL_APIENTRY GL_GetTexGenxvOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetTexGenxvOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexGenxv(coord, pname, params);
@@ -19950,6 +20673,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexLevelParameterfv(context, targetPacked, level, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameterfv(targetPacked, level, pname, params);
@@ -19983,6 +20707,7 @@ void GL_APIENTRY GL_GetTexLevelParameterivContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexLevelParameteriv(context, targetPacked, level, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameteriv(targetPacked, level, pname, params);
@@ -20014,6 +20739,7 @@ void GL_APIENTRY GL_GetTexParameterIivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIiv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIiv(targetPacked, pname, params);
@@ -20044,6 +20770,7 @@ void GL_APIENTRY GL_GetTexParameterIivEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIivEXT(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIiv(targetPacked, pname, params);
@@ -20074,6 +20801,7 @@ void GL_APIENTRY GL_GetTexParameterIivOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIivOES(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIiv(targetPacked, pname, params);
@@ -20104,6 +20832,7 @@ void GL_APIENTRY GL_GetTexParameterIuivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIuiv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIuiv(targetPacked, pname, params);
@@ -20134,6 +20863,7 @@ void GL_APIENTRY GL_GetTexParameterIuivEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIuivEXT(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIuiv(targetPacked, pname, params);
@@ -20164,6 +20894,7 @@ void GL_APIENTRY GL_GetTexParameterIuivOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIuivOES(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIuiv(targetPacked, pname, params);
@@ -20194,6 +20925,7 @@ void GL_APIENTRY GL_GetTexParameterfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterfv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterfv(targetPacked, pname, params);
@@ -20224,6 +20956,7 @@ void GL_APIENTRY GL_GetTexParameterivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameteriv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameteriv(targetPacked, pname, params);
@@ -20254,6 +20987,7 @@ void GL_APIENTRY GL_GetTexParameterxvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterxv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterxv(targetPacked, pname, params);
@@ -20290,6 +21024,7 @@ void GL_APIENTRY GL_GetTransformFeedbackVaryingContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTransformFeedbackVarying(context, programPacked, index,
                                                                 bufSize, length, size, type, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTransformFeedbackVarying(programPacked, index, bufSize, length, size, type,
@@ -20324,6 +21059,7 @@ void GL_APIENTRY GL_GetTranslatedShaderSourceANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateGetTranslatedShaderSourceANGLE(
                                               context, shaderPacked, bufsize, length, source));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTranslatedShaderSource(shaderPacked, bufsize, length, source);
@@ -20354,6 +21090,7 @@ GLuint GL_APIENTRY GL_GetUniformBlockIndexContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformBlockIndex(context, programPacked, uniformBlockName));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getUniformBlockIndex(programPacked, uniformBlockName);
@@ -20394,6 +21131,7 @@ void GL_APIENTRY GL_GetUniformIndicesContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformIndices(context, programPacked, uniformCount,
                                                       uniformNames, uniformIndices));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformIndices(programPacked, uniformCount, uniformNames, uniformIndices);
@@ -20423,6 +21161,7 @@ GLint GL_APIENTRY GL_GetUniformLocationContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetUniformLocation(context, programPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->getUniformLocation(programPacked, name);
@@ -20459,6 +21198,7 @@ void GL_APIENTRY GL_GetUniformfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformfv(context, programPacked, locationPacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformfv(programPacked, locationPacked, params);
@@ -20489,6 +21229,7 @@ void GL_APIENTRY GL_GetUniformivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformiv(context, programPacked, locationPacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformiv(programPacked, locationPacked, params);
@@ -20519,6 +21260,7 @@ void GL_APIENTRY GL_GetUniformuivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformuiv(context, programPacked, locationPacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformuiv(programPacked, locationPacked, params);
@@ -20543,6 +21285,7 @@ void GL_APIENTRY GL_GetUnsignedBytevEXTContextANGLE(GLeglContext ctx, GLenum pna
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetUnsignedBytevEXT(context, pname, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUnsignedBytev(pname, data);
@@ -20571,6 +21314,7 @@ void GL_APIENTRY GL_GetUnsignedBytei_vEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUnsignedBytei_vEXT(context, target, index, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUnsignedBytei_v(target, index, data);
@@ -20599,6 +21343,7 @@ void GL_APIENTRY GL_GetVertexAttribIivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetVertexAttribIiv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribIiv(index, pname, params);
@@ -20627,6 +21372,7 @@ void GL_APIENTRY GL_GetVertexAttribIuivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetVertexAttribIuiv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribIuiv(index, pname, params);
@@ -20655,6 +21401,7 @@ void GL_APIENTRY GL_GetVertexAttribPointervContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetVertexAttribPointerv(context, index, pname, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribPointerv(index, pname, pointer);
@@ -20683,6 +21430,7 @@ void GL_APIENTRY GL_GetVertexAttribfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetVertexAttribfv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribfv(index, pname, params);
@@ -20711,6 +21459,7 @@ void GL_APIENTRY GL_GetVertexAttribivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetVertexAttribiv(context, index, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribiv(index, pname, params);
@@ -20743,6 +21492,7 @@ void GL_APIENTRY GL_GetnUniformfvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnUniformfv(context, programPacked, locationPacked, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformfv(programPacked, locationPacked, bufSize, params);
@@ -20776,6 +21526,7 @@ void GL_APIENTRY GL_GetnUniformfvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnUniformfvEXT(context, programPacked, locationPacked, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformfv(programPacked, locationPacked, bufSize, params);
@@ -20809,6 +21560,7 @@ void GL_APIENTRY GL_GetnUniformivContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnUniformiv(context, programPacked, locationPacked, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformiv(programPacked, locationPacked, bufSize, params);
@@ -20842,6 +21594,7 @@ void GL_APIENTRY GL_GetnUniformivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnUniformivEXT(context, programPacked, locationPacked, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformiv(programPacked, locationPacked, bufSize, params);
@@ -20875,6 +21628,7 @@ void GL_APIENTRY GL_GetnUniformuivContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnUniformuiv(context, programPacked, locationPacked, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformuiv(programPacked, locationPacked, bufSize, params);
@@ -20900,6 +21654,7 @@ void GL_APIENTRY GL_HintContextANGLE(GLeglContext ctx, GLenum target, GLenum mod
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateHint(context, target, mode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->hint(target, mode);
@@ -20933,6 +21688,7 @@ void GL_APIENTRY GL_ImportMemoryFdEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateImportMemoryFdEXT(context, memoryPacked, size, handleTypePacked, fd));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->importMemoryFd(memoryPacked, size, handleTypePacked, fd);
@@ -20964,6 +21720,7 @@ void GL_APIENTRY GL_ImportSemaphoreFdEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateImportSemaphoreFdEXT(context, semaphorePacked, handleTypePacked, fd));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->importSemaphoreFd(semaphorePacked, handleTypePacked, fd);
@@ -20993,6 +21750,7 @@ void GL_APIENTRY GL_InsertEventMarkerEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateInsertEventMarkerEXT(context, length, marker));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->insertEventMarker(length, marker);
@@ -21023,6 +21781,7 @@ void GL_APIENTRY GL_InvalidateFramebufferContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateInvalidateFramebuffer(context, target, numAttachments, attachments));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateFramebuffer(target, numAttachments, attachments);
@@ -21059,6 +21818,7 @@ void GL_APIENTRY GL_InvalidateSubFramebufferContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInvalidateSubFramebuffer(context, target, numAttachments,
                                                              attachments, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateSubFramebuffer(target, numAttachments, attachments, x, y, width,
@@ -21085,6 +21845,7 @@ GLboolean GL_APIENTRY GL_IsBufferContextANGLE(GLeglContext ctx, GLuint buffer)
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsBuffer(context, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isBuffer(bufferPacked);
@@ -21115,6 +21876,7 @@ GLboolean GL_APIENTRY GL_IsEnabledContextANGLE(GLeglContext ctx, GLenum cap)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsEnabled(context, cap));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isEnabled(cap);
@@ -21146,6 +21908,7 @@ GLboolean GL_APIENTRY GL_IsEnablediContextANGLE(GLeglContext ctx, GLenum target,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsEnabledi(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isEnabledi(target, index);
@@ -21177,6 +21940,7 @@ GLboolean GL_APIENTRY GL_IsEnablediEXTContextANGLE(GLeglContext ctx, GLenum targ
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsEnablediEXT(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isEnabledi(target, index);
@@ -21208,6 +21972,7 @@ GLboolean GL_APIENTRY GL_IsEnablediOESContextANGLE(GLeglContext ctx, GLenum targ
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsEnablediOES(context, target, index));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isEnabledi(target, index);
@@ -21238,6 +22003,7 @@ GLboolean GL_APIENTRY GL_IsFenceNVContextANGLE(GLeglContext ctx, GLuint fence)
         FenceNVID fencePacked                                 = PackParam<FenceNVID>(fence);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsFenceNV(context, fencePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isFenceNV(fencePacked);
@@ -21269,6 +22035,7 @@ GLboolean GL_APIENTRY GL_IsFramebufferContextANGLE(GLeglContext ctx, GLuint fram
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsFramebuffer(context, framebufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isFramebuffer(framebufferPacked);
@@ -21300,6 +22067,7 @@ GLboolean GL_APIENTRY GL_IsFramebufferOESContextANGLE(GLeglContext ctx, GLuint f
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsFramebufferOES(context, framebufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isFramebuffer(framebufferPacked);
@@ -21332,6 +22100,7 @@ GLboolean GL_APIENTRY GL_IsMemoryObjectEXTContextANGLE(GLeglContext ctx, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsMemoryObjectEXT(context, memoryObjectPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isMemoryObject(memoryObjectPacked);
@@ -21363,6 +22132,7 @@ GLboolean GL_APIENTRY GL_IsProgramContextANGLE(GLeglContext ctx, GLuint program)
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isProgram(programPacked);
@@ -21394,6 +22164,7 @@ GLboolean GL_APIENTRY GL_IsProgramPipelineContextANGLE(GLeglContext ctx, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsProgramPipeline(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isProgramPipeline(pipelinePacked);
@@ -21426,6 +22197,7 @@ GLboolean GL_APIENTRY GL_IsProgramPipelineEXTContextANGLE(GLeglContext ctx, GLui
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsProgramPipelineEXT(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isProgramPipeline(pipelinePacked);
@@ -21457,6 +22229,7 @@ GLboolean GL_APIENTRY GL_IsQueryContextANGLE(GLeglContext ctx, GLuint id)
         QueryID idPacked                                      = PackParam<QueryID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsQuery(context, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isQuery(idPacked);
@@ -21487,6 +22260,7 @@ GLboolean GL_APIENTRY GL_IsQueryEXTContextANGLE(GLeglContext ctx, GLuint id)
         QueryID idPacked                                      = PackParam<QueryID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsQueryEXT(context, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isQuery(idPacked);
@@ -21518,6 +22292,7 @@ GLboolean GL_APIENTRY GL_IsRenderbufferContextANGLE(GLeglContext ctx, GLuint ren
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsRenderbuffer(context, renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isRenderbuffer(renderbufferPacked);
@@ -21550,6 +22325,7 @@ GLboolean GL_APIENTRY GL_IsRenderbufferOESContextANGLE(GLeglContext ctx, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsRenderbufferOES(context, renderbufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isRenderbuffer(renderbufferPacked);
@@ -21582,6 +22358,7 @@ GLboolean GL_APIENTRY GL_IsSemaphoreEXTContextANGLE(GLeglContext ctx, GLuint sem
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsSemaphoreEXT(context, semaphorePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isSemaphore(semaphorePacked);
@@ -21612,6 +22389,7 @@ GLboolean GL_APIENTRY GL_IsSamplerContextANGLE(GLeglContext ctx, GLuint sampler)
         SamplerID samplerPacked                               = PackParam<SamplerID>(sampler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsSampler(context, samplerPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isSampler(samplerPacked);
@@ -21642,6 +22420,7 @@ GLboolean GL_APIENTRY GL_IsShaderContextANGLE(GLeglContext ctx, GLuint shader)
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsShader(context, shaderPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isShader(shaderPacked);
@@ -21672,6 +22451,7 @@ GLboolean GL_APIENTRY GL_IsSyncContextANGLE(GLeglContext ctx, GLsync sync)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsSync(context, sync));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isSync(sync);
@@ -21702,6 +22482,7 @@ GLboolean GL_APIENTRY GL_IsTextureContextANGLE(GLeglContext ctx, GLuint texture)
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIsTexture(context, texturePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isTexture(texturePacked);
@@ -21733,6 +22514,7 @@ GLboolean GL_APIENTRY GL_IsTransformFeedbackContextANGLE(GLeglContext ctx, GLuin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsTransformFeedback(context, idPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isTransformFeedback(idPacked);
@@ -21765,6 +22547,7 @@ GLboolean GL_APIENTRY GL_IsVertexArrayContextANGLE(GLeglContext ctx, GLuint arra
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsVertexArray(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isVertexArray(arrayPacked);
@@ -21796,6 +22579,7 @@ GLboolean GL_APIENTRY GL_IsVertexArrayOESContextANGLE(GLeglContext ctx, GLuint a
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIsVertexArrayOES(context, arrayPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->isVertexArray(arrayPacked);
@@ -21832,6 +22616,7 @@ void GL_APIENTRY GL_LabelObjectEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateLabelObjectEXT(context, type, object, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->labelObject(type, object, length, label);
@@ -21856,6 +22641,7 @@ void GL_APIENTRY GL_LightModelfContextANGLE(GLeglContext ctx, GLenum pname, GLfl
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelf(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModelf(pname, param);
@@ -21880,6 +22666,7 @@ void GL_APIENTRY GL_LightModelfvContextANGLE(GLeglContext ctx, GLenum pname, con
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelfv(context, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModelfv(pname, params);
@@ -21904,6 +22691,7 @@ void GL_APIENTRY GL_LightModelxContextANGLE(GLeglContext ctx, GLenum pname, GLfi
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelx(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModelx(pname, param);
@@ -21928,6 +22716,7 @@ void GL_APIENTRY GL_LightModelxvContextANGLE(GLeglContext ctx, GLenum pname, con
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelxv(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightModelxv(pname, param);
@@ -21954,6 +22743,7 @@ void GL_APIENTRY GL_LightfContextANGLE(GLeglContext ctx, GLenum light, GLenum pn
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightf(context, light, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightf(light, pnamePacked, param);
@@ -21983,6 +22773,7 @@ void GL_APIENTRY GL_LightfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightfv(context, light, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightfv(light, pnamePacked, params);
@@ -22009,6 +22800,7 @@ void GL_APIENTRY GL_LightxContextANGLE(GLeglContext ctx, GLenum light, GLenum pn
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightx(context, light, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightx(light, pnamePacked, param);
@@ -22038,6 +22830,7 @@ void GL_APIENTRY GL_LightxvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightxv(context, light, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lightxv(light, pnamePacked, params);
@@ -22060,6 +22853,7 @@ void GL_APIENTRY GL_LineWidthContextANGLE(GLeglContext ctx, GLfloat width)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLineWidth(context, width));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lineWidth(width);
@@ -22082,6 +22876,7 @@ void GL_APIENTRY GL_LineWidthxContextANGLE(GLeglContext ctx, GLfixed width)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLineWidthx(context, width));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->lineWidthx(width);
@@ -22106,6 +22901,7 @@ void GL_APIENTRY GL_LinkProgramContextANGLE(GLeglContext ctx, GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLinkProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->linkProgram(programPacked);
@@ -22128,6 +22924,7 @@ void GL_APIENTRY GL_LoadIdentityContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadIdentity(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadIdentity();
@@ -22151,6 +22948,7 @@ void GL_APIENTRY GL_LoadMatrixfContextANGLE(GLeglContext ctx, const GLfloat *m)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadMatrixf(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadMatrixf(m);
@@ -22174,6 +22972,7 @@ void GL_APIENTRY GL_LoadMatrixxContextANGLE(GLeglContext ctx, const GLfixed *m)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadMatrixx(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadMatrixx(m);
@@ -22197,6 +22996,7 @@ void GL_APIENTRY GL_LoadPaletteFromModelViewMatrixOESContextANGLE(GLeglContext c
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLoadPaletteFromModelViewMatrixOES(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loadPaletteFromModelViewMatrix();
@@ -22221,6 +23021,7 @@ void GL_APIENTRY GL_LogicOpContextANGLE(GLeglContext ctx, GLenum opcode)
         LogicalOperation opcodePacked                         = PackParam<LogicalOperation>(opcode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLogicOp(context, opcodePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->logicOp(opcodePacked);
@@ -22248,6 +23049,7 @@ void *GL_APIENTRY GL_MapBufferOESContextANGLE(GLeglContext ctx, GLenum target, G
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMapBufferOES(context, targetPacked, access));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->mapBuffer(targetPacked, access);
@@ -22287,6 +23089,7 @@ void *GL_APIENTRY GL_MapBufferRangeContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMapBufferRange(context, targetPacked, offset, length, access));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->mapBufferRange(targetPacked, offset, length, access);
@@ -22328,6 +23131,7 @@ void *GL_APIENTRY GL_MapBufferRangeEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMapBufferRangeEXT(context, targetPacked, offset, length, access));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->mapBufferRange(targetPacked, offset, length, access);
@@ -22364,6 +23168,7 @@ void GL_APIENTRY GL_MaterialfContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaterialf(context, face, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materialf(face, pnamePacked, param);
@@ -22393,6 +23198,7 @@ void GL_APIENTRY GL_MaterialfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaterialfv(context, face, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materialfv(face, pnamePacked, params);
@@ -22422,6 +23228,7 @@ void GL_APIENTRY GL_MaterialxContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaterialx(context, face, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materialx(face, pnamePacked, param);
@@ -22451,6 +23258,7 @@ void GL_APIENTRY GL_MaterialxvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaterialxv(context, face, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->materialxv(face, pnamePacked, param);
@@ -22481,6 +23289,7 @@ void GL_APIENTRY GL_MatrixIndexPointerOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMatrixIndexPointerOES(context, size, type, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->matrixIndexPointer(size, type, stride, pointer);
@@ -22505,6 +23314,7 @@ void GL_APIENTRY GL_MatrixModeContextANGLE(GLeglContext ctx, GLenum mode)
         MatrixType modePacked                                 = PackParam<MatrixType>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMatrixMode(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->matrixMode(modePacked);
@@ -22528,6 +23338,7 @@ void GL_APIENTRY GL_MaxShaderCompilerThreadsKHRContextANGLE(GLeglContext ctx, GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaxShaderCompilerThreadsKHR(context, count));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->maxShaderCompilerThreads(count);
@@ -22551,6 +23362,7 @@ void GL_APIENTRY GL_MemoryBarrierContextANGLE(GLeglContext ctx, GLbitfield barri
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMemoryBarrier(context, barriers));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->memoryBarrier(barriers);
@@ -22575,6 +23387,7 @@ void GL_APIENTRY GL_MemoryBarrierByRegionContextANGLE(GLeglContext ctx, GLbitfie
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMemoryBarrierByRegion(context, barriers));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->memoryBarrierByRegion(barriers);
@@ -22606,6 +23419,7 @@ void GL_APIENTRY GL_MemoryObjectParameterivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMemoryObjectParameterivEXT(context, memoryObjectPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->memoryObjectParameteriv(memoryObjectPacked, pname, params);
@@ -22629,6 +23443,7 @@ void GL_APIENTRY GL_MinSampleShadingContextANGLE(GLeglContext ctx, GLfloat value
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMinSampleShading(context, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->minSampleShading(value);
@@ -22652,6 +23467,7 @@ void GL_APIENTRY GL_MinSampleShadingOESContextANGLE(GLeglContext ctx, GLfloat va
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMinSampleShadingOES(context, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->minSampleShading(value);
@@ -22675,6 +23491,7 @@ void GL_APIENTRY GL_MultMatrixfContextANGLE(GLeglContext ctx, const GLfloat *m)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMultMatrixf(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multMatrixf(m);
@@ -22698,6 +23515,7 @@ void GL_APIENTRY GL_MultMatrixxContextANGLE(GLeglContext ctx, const GLfixed *m)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMultMatrixx(context, m));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multMatrixx(m);
@@ -22735,6 +23553,7 @@ void GL_APIENTRY GL_MultiDrawElementsBaseVertexEXTContextANGLE(GLeglContext ctx,
         bool isCallValid = (context->skipValidation() || ValidateMultiDrawElementsBaseVertexEXT(
                                                              context, modePacked, count, typePacked,
                                                              indices, primcount, basevertex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElementsBaseVertex(modePacked, count, typePacked, indices, primcount,
@@ -22766,6 +23585,7 @@ void GL_APIENTRY GL_MultiTexCoord4fContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4f(context, target, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4f(target, s, t, r, q);
@@ -22796,6 +23616,7 @@ void GL_APIENTRY GL_MultiTexCoord4xContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4x(context, texture, s, t, r, q));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiTexCoord4x(texture, s, t, r, q);
@@ -22830,6 +23651,7 @@ void GL_APIENTRY GL_NamedBufferStorageExternalEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateNamedBufferStorageExternalEXT(
                                               context, buffer, offset, size, clientBuffer, flags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->namedBufferStorageExternal(buffer, offset, size, clientBuffer, flags);
@@ -22853,6 +23675,7 @@ void GL_APIENTRY GL_Normal3fContextANGLE(GLeglContext ctx, GLfloat nx, GLfloat n
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3f(context, nx, ny, nz));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3f(nx, ny, nz);
@@ -22876,6 +23699,7 @@ void GL_APIENTRY GL_Normal3xContextANGLE(GLeglContext ctx, GLfixed nx, GLfixed n
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3x(context, nx, ny, nz));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normal3x(nx, ny, nz);
@@ -22905,6 +23729,7 @@ void GL_APIENTRY GL_NormalPointerContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormalPointer(context, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->normalPointer(typePacked, stride, pointer);
@@ -22935,6 +23760,7 @@ void GL_APIENTRY GL_ObjectLabelContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateObjectLabel(context, identifier, name, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->objectLabel(identifier, name, length, label);
@@ -22965,6 +23791,7 @@ void GL_APIENTRY GL_ObjectLabelKHRContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateObjectLabelKHR(context, identifier, name, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->objectLabel(identifier, name, length, label);
@@ -22993,6 +23820,7 @@ void GL_APIENTRY GL_ObjectPtrLabelContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateObjectPtrLabel(context, ptr, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->objectPtrLabel(ptr, length, label);
@@ -23021,6 +23849,7 @@ void GL_APIENTRY GL_ObjectPtrLabelKHRContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateObjectPtrLabelKHR(context, ptr, length, label));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->objectPtrLabel(ptr, length, label);
@@ -23050,6 +23879,7 @@ void GL_APIENTRY GL_OrthofContextANGLE(GLeglContext ctx,
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateOrthof(context, l, r, b, t, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->orthof(l, r, b, t, n, f);
@@ -23080,6 +23910,7 @@ void GL_APIENTRY GL_OrthoxContextANGLE(GLeglContext ctx,
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateOrthox(context, l, r, b, t, n, f));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->orthox(l, r, b, t, n, f);
@@ -23104,6 +23935,7 @@ void GL_APIENTRY GL_PatchParameteriContextANGLE(GLeglContext ctx, GLenum pname,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePatchParameteri(context, pname, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->patchParameteri(pname, value);
@@ -23128,6 +23960,7 @@ void GL_APIENTRY GL_PatchParameteriEXTContextANGLE(GLeglContext ctx, GLenum pnam
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePatchParameteriEXT(context, pname, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->patchParameteri(pname, value);
@@ -23150,6 +23983,7 @@ void GL_APIENTRY GL_PauseTransformFeedbackContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePauseTransformFeedback(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pauseTransformFeedback();
@@ -23174,6 +24008,7 @@ void GL_APIENTRY GL_PixelStoreiContextANGLE(GLeglContext ctx, GLenum pname, GLin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelStorei(context, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pixelStorei(pname, param);
@@ -23199,6 +24034,7 @@ void GL_APIENTRY GL_PointParameterfContextANGLE(GLeglContext ctx, GLenum pname,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameterf(context, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameterf(pnamePacked, param);
@@ -23226,6 +24062,7 @@ void GL_APIENTRY GL_PointParameterfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameterfv(context, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameterfv(pnamePacked, params);
@@ -23251,6 +24088,7 @@ void GL_APIENTRY GL_PointParameterxContextANGLE(GLeglContext ctx, GLenum pname,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameterx(context, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameterx(pnamePacked, param);
@@ -23278,6 +24116,7 @@ void GL_APIENTRY GL_PointParameterxvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameterxv(context, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointParameterxv(pnamePacked, params);
@@ -23300,6 +24139,7 @@ void GL_APIENTRY GL_PointSizeContextANGLE(GLeglContext ctx, GLfloat size)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePointSize(context, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointSize(size);
@@ -23329,6 +24169,7 @@ void GL_APIENTRY GL_PointSizePointerOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePointSizePointerOES(context, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointSizePointer(typePacked, stride, pointer);
@@ -23351,6 +24192,7 @@ void GL_APIENTRY GL_PointSizexContextANGLE(GLeglContext ctx, GLfixed size)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePointSizex(context, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pointSizex(size);
@@ -23375,6 +24217,7 @@ void GL_APIENTRY GL_PolygonOffsetContextANGLE(GLeglContext ctx, GLfloat factor,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePolygonOffset(context, factor, units));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->polygonOffset(factor, units);
@@ -23399,6 +24242,7 @@ void GL_APIENTRY GL_PolygonOffsetxContextANGLE(GLeglContext ctx, GLfixed factor,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePolygonOffsetx(context, factor, units));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->polygonOffsetx(factor, units);
@@ -23421,6 +24265,7 @@ void GL_APIENTRY GL_PopDebugGroupContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopDebugGroup(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popDebugGroup();
@@ -23443,6 +24288,7 @@ void GL_APIENTRY GL_PopDebugGroupKHRContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopDebugGroupKHR(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popDebugGroup();
@@ -23467,6 +24313,7 @@ void GL_APIENTRY GL_PopGroupMarkerEXTContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopGroupMarkerEXT(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popGroupMarker();
@@ -23489,6 +24336,7 @@ void GL_APIENTRY GL_PopMatrixContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopMatrix(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->popMatrix();
@@ -23524,6 +24372,7 @@ void GL_APIENTRY GL_PrimitiveBoundingBoxContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePrimitiveBoundingBox(context, minX, minY, minZ, minW, maxX, maxY, maxZ, maxW));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->primitiveBoundingBox(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
@@ -23560,6 +24409,7 @@ void GL_APIENTRY GL_PrimitiveBoundingBoxEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePrimitiveBoundingBoxEXT(context, minX, minY, minZ, minW, maxX,
                                                             maxY, maxZ, maxW));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->primitiveBoundingBox(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
@@ -23593,6 +24443,7 @@ void GL_APIENTRY GL_ProgramBinaryContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramBinary(context, programPacked, binaryFormat, binary, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programBinary(programPacked, binaryFormat, binary, length);
@@ -23626,6 +24477,7 @@ void GL_APIENTRY GL_ProgramBinaryOESContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramBinaryOES(context, programPacked, binaryFormat, binary, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programBinary(programPacked, binaryFormat, binary, length);
@@ -23655,6 +24507,7 @@ void GL_APIENTRY GL_ProgramParameteriContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramParameteri(context, programPacked, pname, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programParameteri(programPacked, pname, value);
@@ -23683,6 +24536,7 @@ void GL_APIENTRY GL_ProgramParameteriEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramParameteriEXT(context, programPacked, pname, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programParameteri(programPacked, pname, value);
@@ -23712,6 +24566,7 @@ void GL_APIENTRY GL_ProgramUniform1fContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform1f(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1f(programPacked, locationPacked, v0);
@@ -23742,6 +24597,7 @@ void GL_APIENTRY GL_ProgramUniform1fEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1fEXT(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1f(programPacked, locationPacked, v0);
@@ -23774,6 +24630,7 @@ void GL_APIENTRY GL_ProgramUniform1fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1fv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1fv(programPacked, locationPacked, count, value);
@@ -23807,6 +24664,7 @@ void GL_APIENTRY GL_ProgramUniform1fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1fvEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1fv(programPacked, locationPacked, count, value);
@@ -23837,6 +24695,7 @@ void GL_APIENTRY GL_ProgramUniform1iContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform1i(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1i(programPacked, locationPacked, v0);
@@ -23867,6 +24726,7 @@ void GL_APIENTRY GL_ProgramUniform1iEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1iEXT(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1i(programPacked, locationPacked, v0);
@@ -23899,6 +24759,7 @@ void GL_APIENTRY GL_ProgramUniform1ivContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1iv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1iv(programPacked, locationPacked, count, value);
@@ -23932,6 +24793,7 @@ void GL_APIENTRY GL_ProgramUniform1ivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1ivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1iv(programPacked, locationPacked, count, value);
@@ -23962,6 +24824,7 @@ void GL_APIENTRY GL_ProgramUniform1uiContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform1ui(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1ui(programPacked, locationPacked, v0);
@@ -23992,6 +24855,7 @@ void GL_APIENTRY GL_ProgramUniform1uiEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1uiEXT(context, programPacked, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1ui(programPacked, locationPacked, v0);
@@ -24025,6 +24889,7 @@ void GL_APIENTRY GL_ProgramUniform1uivContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1uiv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1uiv(programPacked, locationPacked, count, value);
@@ -24058,6 +24923,7 @@ void GL_APIENTRY GL_ProgramUniform1uivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1uivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform1uiv(programPacked, locationPacked, count, value);
@@ -24091,6 +24957,7 @@ void GL_APIENTRY GL_ProgramUniform2fContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2f(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2f(programPacked, locationPacked, v0, v1);
@@ -24124,6 +24991,7 @@ void GL_APIENTRY GL_ProgramUniform2fEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2fEXT(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2f(programPacked, locationPacked, v0, v1);
@@ -24157,6 +25025,7 @@ void GL_APIENTRY GL_ProgramUniform2fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2fv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2fv(programPacked, locationPacked, count, value);
@@ -24190,6 +25059,7 @@ void GL_APIENTRY GL_ProgramUniform2fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2fvEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2fv(programPacked, locationPacked, count, value);
@@ -24223,6 +25093,7 @@ void GL_APIENTRY GL_ProgramUniform2iContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2i(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2i(programPacked, locationPacked, v0, v1);
@@ -24256,6 +25127,7 @@ void GL_APIENTRY GL_ProgramUniform2iEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2iEXT(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2i(programPacked, locationPacked, v0, v1);
@@ -24289,6 +25161,7 @@ void GL_APIENTRY GL_ProgramUniform2ivContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2iv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2iv(programPacked, locationPacked, count, value);
@@ -24322,6 +25195,7 @@ void GL_APIENTRY GL_ProgramUniform2ivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2ivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2iv(programPacked, locationPacked, count, value);
@@ -24355,6 +25229,7 @@ void GL_APIENTRY GL_ProgramUniform2uiContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2ui(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2ui(programPacked, locationPacked, v0, v1);
@@ -24388,6 +25263,7 @@ void GL_APIENTRY GL_ProgramUniform2uiEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2uiEXT(context, programPacked, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2ui(programPacked, locationPacked, v0, v1);
@@ -24421,6 +25297,7 @@ void GL_APIENTRY GL_ProgramUniform2uivContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2uiv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2uiv(programPacked, locationPacked, count, value);
@@ -24454,6 +25331,7 @@ void GL_APIENTRY GL_ProgramUniform2uivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2uivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform2uiv(programPacked, locationPacked, count, value);
@@ -24488,6 +25366,7 @@ void GL_APIENTRY GL_ProgramUniform3fContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3f(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3f(programPacked, locationPacked, v0, v1, v2);
@@ -24522,6 +25401,7 @@ void GL_APIENTRY GL_ProgramUniform3fEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3fEXT(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3f(programPacked, locationPacked, v0, v1, v2);
@@ -24555,6 +25435,7 @@ void GL_APIENTRY GL_ProgramUniform3fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3fv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3fv(programPacked, locationPacked, count, value);
@@ -24588,6 +25469,7 @@ void GL_APIENTRY GL_ProgramUniform3fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3fvEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3fv(programPacked, locationPacked, count, value);
@@ -24622,6 +25504,7 @@ void GL_APIENTRY GL_ProgramUniform3iContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3i(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3i(programPacked, locationPacked, v0, v1, v2);
@@ -24656,6 +25539,7 @@ void GL_APIENTRY GL_ProgramUniform3iEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3iEXT(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3i(programPacked, locationPacked, v0, v1, v2);
@@ -24689,6 +25573,7 @@ void GL_APIENTRY GL_ProgramUniform3ivContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3iv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3iv(programPacked, locationPacked, count, value);
@@ -24722,6 +25607,7 @@ void GL_APIENTRY GL_ProgramUniform3ivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3ivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3iv(programPacked, locationPacked, count, value);
@@ -24756,6 +25642,7 @@ void GL_APIENTRY GL_ProgramUniform3uiContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3ui(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3ui(programPacked, locationPacked, v0, v1, v2);
@@ -24790,6 +25677,7 @@ void GL_APIENTRY GL_ProgramUniform3uiEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3uiEXT(context, programPacked, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3ui(programPacked, locationPacked, v0, v1, v2);
@@ -24823,6 +25711,7 @@ void GL_APIENTRY GL_ProgramUniform3uivContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3uiv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3uiv(programPacked, locationPacked, count, value);
@@ -24856,6 +25745,7 @@ void GL_APIENTRY GL_ProgramUniform3uivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3uivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform3uiv(programPacked, locationPacked, count, value);
@@ -24891,6 +25781,7 @@ void GL_APIENTRY GL_ProgramUniform4fContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4f(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4f(programPacked, locationPacked, v0, v1, v2, v3);
@@ -24926,6 +25817,7 @@ void GL_APIENTRY GL_ProgramUniform4fEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4fEXT(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4f(programPacked, locationPacked, v0, v1, v2, v3);
@@ -24959,6 +25851,7 @@ void GL_APIENTRY GL_ProgramUniform4fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4fv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4fv(programPacked, locationPacked, count, value);
@@ -24992,6 +25885,7 @@ void GL_APIENTRY GL_ProgramUniform4fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4fvEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4fv(programPacked, locationPacked, count, value);
@@ -25027,6 +25921,7 @@ void GL_APIENTRY GL_ProgramUniform4iContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4i(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4i(programPacked, locationPacked, v0, v1, v2, v3);
@@ -25062,6 +25957,7 @@ void GL_APIENTRY GL_ProgramUniform4iEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4iEXT(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4i(programPacked, locationPacked, v0, v1, v2, v3);
@@ -25095,6 +25991,7 @@ void GL_APIENTRY GL_ProgramUniform4ivContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4iv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4iv(programPacked, locationPacked, count, value);
@@ -25128,6 +26025,7 @@ void GL_APIENTRY GL_ProgramUniform4ivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4ivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4iv(programPacked, locationPacked, count, value);
@@ -25163,6 +26061,7 @@ void GL_APIENTRY GL_ProgramUniform4uiContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4ui(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4ui(programPacked, locationPacked, v0, v1, v2, v3);
@@ -25198,6 +26097,7 @@ void GL_APIENTRY GL_ProgramUniform4uiEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4uiEXT(context, programPacked, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4ui(programPacked, locationPacked, v0, v1, v2, v3);
@@ -25231,6 +26131,7 @@ void GL_APIENTRY GL_ProgramUniform4uivContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4uiv(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4uiv(programPacked, locationPacked, count, value);
@@ -25264,6 +26165,7 @@ void GL_APIENTRY GL_ProgramUniform4uivEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4uivEXT(context, programPacked, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniform4uiv(programPacked, locationPacked, count, value);
@@ -25299,6 +26201,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2fvContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2fv(context, programPacked, locationPacked,
                                                             count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2fv(programPacked, locationPacked, count, transpose,
@@ -25335,6 +26238,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2fv(programPacked, locationPacked, count, transpose,
@@ -25371,6 +26275,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3fvContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x3fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2x3fv(programPacked, locationPacked, count, transpose,
@@ -25407,6 +26312,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x3fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2x3fv(programPacked, locationPacked, count, transpose,
@@ -25443,6 +26349,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4fvContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x4fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2x4fv(programPacked, locationPacked, count, transpose,
@@ -25479,6 +26386,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x4fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix2x4fv(programPacked, locationPacked, count, transpose,
@@ -25515,6 +26423,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3fvContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3fv(context, programPacked, locationPacked,
                                                             count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3fv(programPacked, locationPacked, count, transpose,
@@ -25551,6 +26460,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3fv(programPacked, locationPacked, count, transpose,
@@ -25587,6 +26497,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2fvContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x2fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3x2fv(programPacked, locationPacked, count, transpose,
@@ -25623,6 +26534,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x2fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3x2fv(programPacked, locationPacked, count, transpose,
@@ -25659,6 +26571,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4fvContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x4fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3x4fv(programPacked, locationPacked, count, transpose,
@@ -25695,6 +26608,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x4fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix3x4fv(programPacked, locationPacked, count, transpose,
@@ -25731,6 +26645,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4fvContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4fv(context, programPacked, locationPacked,
                                                             count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4fv(programPacked, locationPacked, count, transpose,
@@ -25767,6 +26682,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4fv(programPacked, locationPacked, count, transpose,
@@ -25803,6 +26719,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2fvContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x2fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4x2fv(programPacked, locationPacked, count, transpose,
@@ -25839,6 +26756,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x2fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4x2fv(programPacked, locationPacked, count, transpose,
@@ -25875,6 +26793,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fvContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x3fv(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4x3fv(programPacked, locationPacked, count, transpose,
@@ -25911,6 +26830,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fvEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x3fvEXT(
                                 context, programPacked, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->programUniformMatrix4x3fv(programPacked, locationPacked, count, transpose,
@@ -25943,6 +26863,7 @@ void GL_APIENTRY GL_PushDebugGroupContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePushDebugGroup(context, source, id, length, message));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushDebugGroup(source, id, length, message);
@@ -25973,6 +26894,7 @@ void GL_APIENTRY GL_PushDebugGroupKHRContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePushDebugGroupKHR(context, source, id, length, message));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushDebugGroup(source, id, length, message);
@@ -26001,6 +26923,7 @@ void GL_APIENTRY GL_PushGroupMarkerEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePushGroupMarkerEXT(context, length, marker));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushGroupMarker(length, marker);
@@ -26023,6 +26946,7 @@ void GL_APIENTRY GL_PushMatrixContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushMatrix(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->pushMatrix();
@@ -26049,6 +26973,7 @@ void GL_APIENTRY GL_QueryCounterEXTContextANGLE(GLeglContext ctx, GLuint id, GLe
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateQueryCounterEXT(context, idPacked, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->queryCounter(idPacked, targetPacked);
@@ -26077,6 +27002,7 @@ GLbitfield GL_APIENTRY GL_QueryMatrixxOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateQueryMatrixxOES(context, mantissa, exponent));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->queryMatrixx(mantissa, exponent);
@@ -26106,6 +27032,7 @@ void GL_APIENTRY GL_ReadBufferContextANGLE(GLeglContext ctx, GLenum src)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateReadBuffer(context, src));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readBuffer(src);
@@ -26140,6 +27067,7 @@ void GL_APIENTRY GL_ReadPixelsContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateReadPixels(context, x, y, width, height, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readPixels(x, y, width, height, format, type, pixels);
@@ -26176,6 +27104,7 @@ void GL_APIENTRY GL_ReadnPixelsContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateReadnPixels(context, x, y, width, height, format, type, bufSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readnPixels(x, y, width, height, format, type, bufSize, data);
@@ -26213,6 +27142,7 @@ void GL_APIENTRY GL_ReadnPixelsEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateReadnPixelsEXT(context, x, y, width, height, format, type, bufSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readnPixels(x, y, width, height, format, type, bufSize, data);
@@ -26236,6 +27166,7 @@ void GL_APIENTRY GL_ReleaseShaderCompilerContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateReleaseShaderCompiler(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->releaseShaderCompiler();
@@ -26267,6 +27198,7 @@ void GL_APIENTRY GL_RenderbufferStorageContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRenderbufferStorage(context, target, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->renderbufferStorage(target, internalformat, width, height);
@@ -26300,6 +27232,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisample(context, target, samples,
                                                                    internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->renderbufferStorageMultisample(target, samples, internalformat, width, height);
@@ -26333,6 +27266,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleANGLEContextANGLE(GLeglContext
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisampleANGLE(
                                 context, target, samples, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->renderbufferStorageMultisample(target, samples, internalformat, width, height);
@@ -26366,6 +27300,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleEXTContextANGLE(GLeglContext c
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisampleEXT(
                                 context, target, samples, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->renderbufferStorageMultisampleEXT(target, samples, internalformat, width,
@@ -26399,6 +27334,7 @@ void GL_APIENTRY GL_RenderbufferStorageOESContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRenderbufferStorageOES(context, target, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->renderbufferStorage(target, internalformat, width, height);
@@ -26422,6 +27358,7 @@ void GL_APIENTRY GL_ResumeTransformFeedbackContextANGLE(GLeglContext ctx)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateResumeTransformFeedback(context));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->resumeTransformFeedback();
@@ -26446,6 +27383,7 @@ GL_RotatefContextANGLE(GLeglContext ctx, GLfloat angle, GLfloat x, GLfloat y, GL
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotatef(context, angle, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rotatef(angle, x, y, z);
@@ -26470,6 +27408,7 @@ GL_RotatexContextANGLE(GLeglContext ctx, GLfixed angle, GLfixed x, GLfixed y, GL
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotatex(context, angle, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->rotatex(angle, x, y, z);
@@ -26494,6 +27433,7 @@ void GL_APIENTRY GL_SampleCoverageContextANGLE(GLeglContext ctx, GLfloat value,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleCoverage(context, value, invert));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->sampleCoverage(value, invert);
@@ -26518,6 +27458,7 @@ void GL_APIENTRY GL_SampleCoveragexContextANGLE(GLeglContext ctx, GLclampx value
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleCoveragex(context, value, invert));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->sampleCoveragex(value, invert);
@@ -26542,6 +27483,7 @@ void GL_APIENTRY GL_SampleMaskiContextANGLE(GLeglContext ctx, GLuint maskNumber,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleMaski(context, maskNumber, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->sampleMaski(maskNumber, mask);
@@ -26571,6 +27513,7 @@ void GL_APIENTRY GL_SamplerParameterIivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIiv(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIiv(samplerPacked, pname, param);
@@ -26600,6 +27543,7 @@ void GL_APIENTRY GL_SamplerParameterIivEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIivEXT(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIiv(samplerPacked, pname, param);
@@ -26629,6 +27573,7 @@ void GL_APIENTRY GL_SamplerParameterIivOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIivOES(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIiv(samplerPacked, pname, param);
@@ -26658,6 +27603,7 @@ void GL_APIENTRY GL_SamplerParameterIuivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIuiv(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIuiv(samplerPacked, pname, param);
@@ -26687,6 +27633,7 @@ void GL_APIENTRY GL_SamplerParameterIuivEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIuivEXT(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIuiv(samplerPacked, pname, param);
@@ -26716,6 +27663,7 @@ void GL_APIENTRY GL_SamplerParameterIuivOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterIuivOES(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIuiv(samplerPacked, pname, param);
@@ -26744,6 +27692,7 @@ void GL_APIENTRY GL_SamplerParameterfContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterf(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterf(samplerPacked, pname, param);
@@ -26773,6 +27722,7 @@ void GL_APIENTRY GL_SamplerParameterfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameterfv(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterfv(samplerPacked, pname, param);
@@ -26801,6 +27751,7 @@ void GL_APIENTRY GL_SamplerParameteriContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameteri(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameteri(samplerPacked, pname, param);
@@ -26830,6 +27781,7 @@ void GL_APIENTRY GL_SamplerParameterivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSamplerParameteriv(context, samplerPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameteriv(samplerPacked, pname, param);
@@ -26852,6 +27804,7 @@ void GL_APIENTRY GL_ScalefContextANGLE(GLeglContext ctx, GLfloat x, GLfloat y, G
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScalef(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scalef(x, y, z);
@@ -26874,6 +27827,7 @@ void GL_APIENTRY GL_ScalexContextANGLE(GLeglContext ctx, GLfixed x, GLfixed y, G
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScalex(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scalex(x, y, z);
@@ -26899,6 +27853,7 @@ GL_ScissorContextANGLE(GLeglContext ctx, GLint x, GLint y, GLsizei width, GLsize
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateScissor(context, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->scissor(x, y, width, height);
@@ -26929,6 +27884,7 @@ void GL_APIENTRY GL_SemaphoreParameterui64vEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSemaphoreParameterui64vEXT(context, semaphorePacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->semaphoreParameterui64v(semaphorePacked, pname, params);
@@ -26955,6 +27911,7 @@ void GL_APIENTRY GL_SetFenceNVContextANGLE(GLeglContext ctx, GLuint fence, GLenu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSetFenceNV(context, fencePacked, condition));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->setFenceNV(fencePacked, condition);
@@ -26979,6 +27936,7 @@ void GL_APIENTRY GL_ShadeModelContextANGLE(GLeglContext ctx, GLenum mode)
         ShadingModel modePacked                               = PackParam<ShadingModel>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateShadeModel(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->shadeModel(modePacked);
@@ -27013,6 +27971,7 @@ void GL_APIENTRY GL_ShaderBinaryContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateShaderBinary(context, count, shadersPacked, binaryformat, binary, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->shaderBinary(count, shadersPacked, binaryformat, binary, length);
@@ -27045,6 +28004,7 @@ void GL_APIENTRY GL_ShaderSourceContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateShaderSource(context, shaderPacked, count, string, length));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->shaderSource(shaderPacked, count, string, length);
@@ -27083,6 +28043,7 @@ void GL_APIENTRY GL_SignalSemaphoreEXTContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateSignalSemaphoreEXT(context, semaphorePacked, numBufferBarriers, buffersPacked,
                                         numTextureBarriers, texturesPacked, dstLayouts));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->signalSemaphore(semaphorePacked, numBufferBarriers, buffersPacked,
@@ -27109,6 +28070,7 @@ void GL_APIENTRY GL_StencilFuncContextANGLE(GLeglContext ctx, GLenum func, GLint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilFunc(context, func, ref, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilFunc(func, ref, mask);
@@ -27138,6 +28100,7 @@ void GL_APIENTRY GL_StencilFuncSeparateContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilFuncSeparate(context, face, func, ref, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilFuncSeparate(face, func, ref, mask);
@@ -27160,6 +28123,7 @@ void GL_APIENTRY GL_StencilMaskContextANGLE(GLeglContext ctx, GLuint mask)
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateStencilMask(context, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilMask(mask);
@@ -27184,6 +28148,7 @@ void GL_APIENTRY GL_StencilMaskSeparateContextANGLE(GLeglContext ctx, GLenum fac
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilMaskSeparate(context, face, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilMaskSeparate(face, mask);
@@ -27210,6 +28175,7 @@ void GL_APIENTRY GL_StencilOpContextANGLE(GLeglContext ctx, GLenum fail, GLenum
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilOp(context, fail, zfail, zpass));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilOp(fail, zfail, zpass);
@@ -27242,6 +28208,7 @@ void GL_APIENTRY GL_StencilOpSeparateContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilOpSeparate(context, face, sfail, dpfail, dppass));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->stencilOpSeparate(face, sfail, dpfail, dppass);
@@ -27266,6 +28233,7 @@ GLboolean GL_APIENTRY GL_TestFenceNVContextANGLE(GLeglContext ctx, GLuint fence)
         FenceNVID fencePacked                                 = PackParam<FenceNVID>(fence);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTestFenceNV(context, fencePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->testFenceNV(fencePacked);
@@ -27302,6 +28270,7 @@ void GL_APIENTRY GL_TexBufferContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexBuffer(context, targetPacked, internalformat, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBuffer(targetPacked, internalformat, bufferPacked);
@@ -27333,6 +28302,7 @@ void GL_APIENTRY GL_TexBufferEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexBufferEXT(context, targetPacked, internalformat, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBuffer(targetPacked, internalformat, bufferPacked);
@@ -27365,6 +28335,7 @@ void GL_APIENTRY GL_TexBufferOESContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexBufferOES(context, targetPacked, internalformat, bufferPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBuffer(targetPacked, internalformat, bufferPacked);
@@ -27401,6 +28372,7 @@ void GL_APIENTRY GL_TexBufferRangeContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexBufferRange(context, targetPacked, internalformat,
                                                    bufferPacked, offset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBufferRange(targetPacked, internalformat, bufferPacked, offset, size);
@@ -27437,6 +28409,7 @@ void GL_APIENTRY GL_TexBufferRangeEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexBufferRangeEXT(context, targetPacked, internalformat,
                                                       bufferPacked, offset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBufferRange(targetPacked, internalformat, bufferPacked, offset, size);
@@ -27473,6 +28446,7 @@ void GL_APIENTRY GL_TexBufferRangeOESContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexBufferRangeOES(context, targetPacked, internalformat,
                                                       bufferPacked, offset, size));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texBufferRange(targetPacked, internalformat, bufferPacked, offset, size);
@@ -27505,6 +28479,7 @@ void GL_APIENTRY GL_TexCoordPointerContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoordPointer(context, size, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texCoordPointer(size, typePacked, stride, pointer);
@@ -27535,6 +28510,7 @@ void GL_APIENTRY GL_TexEnvfContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvf(context, targetPacked, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvf(targetPacked, pnamePacked, param);
@@ -27565,6 +28541,7 @@ void GL_APIENTRY GL_TexEnvfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvfv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvfv(targetPacked, pnamePacked, params);
@@ -27592,6 +28569,7 @@ void GL_APIENTRY GL_TexEnviContextANGLE(GLeglContext ctx, GLenum target, GLenum
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvi(context, targetPacked, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvi(targetPacked, pnamePacked, param);
@@ -27622,6 +28600,7 @@ void GL_APIENTRY GL_TexEnvivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnviv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnviv(targetPacked, pnamePacked, params);
@@ -27652,6 +28631,7 @@ void GL_APIENTRY GL_TexEnvxContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvx(context, targetPacked, pnamePacked, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvx(targetPacked, pnamePacked, param);
@@ -27682,6 +28662,7 @@ void GL_APIENTRY GL_TexEnvxvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexEnvxv(context, targetPacked, pnamePacked, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texEnvxv(targetPacked, pnamePacked, params);
@@ -27710,6 +28691,7 @@ void GL_APIENTRY GL_TexGenfOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenfOES(context, coord, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGenf(coord, pname, param);
@@ -27739,6 +28721,7 @@ void GL_APIENTRY GL_TexGenfvOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenfvOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGenfv(coord, pname, params);
@@ -27767,6 +28750,7 @@ void GL_APIENTRY GL_TexGeniOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGeniOES(context, coord, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGeni(coord, pname, param);
@@ -27796,6 +28780,7 @@ void GL_APIENTRY GL_TexGenivOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenivOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGeniv(coord, pname, params);
@@ -27824,6 +28809,7 @@ void GL_APIENTRY GL_TexGenxOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenxOES(context, coord, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGenx(coord, pname, param);
@@ -27853,6 +28839,7 @@ void GL_APIENTRY GL_TexGenxvOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenxvOES(context, coord, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texGenxv(coord, pname, params);
@@ -27892,6 +28879,7 @@ void GL_APIENTRY GL_TexImage2DContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexImage2D(context, targetPacked, level, internalformat, width,
                                                height, border, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage2D(targetPacked, level, internalformat, width, height, border, format,
@@ -27934,6 +28922,7 @@ void GL_APIENTRY GL_TexImage3DContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexImage3D(context, targetPacked, level, internalformat, width,
                                                height, depth, border, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage3D(targetPacked, level, internalformat, width, height, depth, border,
@@ -27978,6 +28967,7 @@ void GL_APIENTRY GL_TexImage3DOESContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexImage3DOES(context, targetPacked, level, internalformat, width, height,
                                    depth, border, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage3D(targetPacked, level, internalformat, width, height, depth, border,
@@ -27992,6 +28982,48 @@ void GL_APIENTRY GL_TexImage3DOESContextANGLE(GLeglContext ctx,
     }
 }
 
+void GL_APIENTRY GL_TexPageCommitmentEXTContextANGLE(GLeglContext ctx,
+                                                     GLenum target,
+                                                     GLint level,
+                                                     GLint xoffset,
+                                                     GLint yoffset,
+                                                     GLint zoffset,
+                                                     GLsizei width,
+                                                     GLsizei height,
+                                                     GLsizei depth,
+                                                     GLboolean commit)
+{
+    Context *context = static_cast<gl::Context *>(ctx);
+    EVENT(context, GLTexPageCommitmentEXT,
+          "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, zoffset = %d, "
+          "width = %d, height = %d, depth = %d, commit = %s",
+          CID(context), GLenumToString(GLenumGroup::DefaultGroup, target), level, xoffset, yoffset,
+          zoffset, width, height, depth, GLbooleanToString(commit));
+
+    if (context && !context->isContextLost())
+    {
+        ASSERT(context == GetValidGlobalContext());
+        TextureType targetPacked                              = PackParam<TextureType>(target);
+        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        bool isCallValid =
+            (context->skipValidation() ||
+             ValidateTexPageCommitmentEXT(context, targetPacked, level, xoffset, yoffset, zoffset,
+                                          width, height, depth, commit));
+        ANGLE_PROFILE_VALIDATION_END();
+        if (isCallValid)
+        {
+            context->texPageCommitment(targetPacked, level, xoffset, yoffset, zoffset, width,
+                                       height, depth, commit);
+        }
+        ANGLE_CAPTURE(TexPageCommitmentEXT, isCallValid, context, targetPacked, level, xoffset,
+                      yoffset, zoffset, width, height, depth, commit);
+    }
+    else
+    {
+        GenerateContextLostErrorOnContext(context);
+    }
+}
+
 void GL_APIENTRY GL_TexParameterIivContextANGLE(GLeglContext ctx,
                                                 GLenum target,
                                                 GLenum pname,
@@ -28010,6 +29042,7 @@ void GL_APIENTRY GL_TexParameterIivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIiv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIiv(targetPacked, pname, params);
@@ -28040,6 +29073,7 @@ void GL_APIENTRY GL_TexParameterIivEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIivEXT(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIiv(targetPacked, pname, params);
@@ -28070,6 +29104,7 @@ void GL_APIENTRY GL_TexParameterIivOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIivOES(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIiv(targetPacked, pname, params);
@@ -28100,6 +29135,7 @@ void GL_APIENTRY GL_TexParameterIuivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIuiv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIuiv(targetPacked, pname, params);
@@ -28130,6 +29166,7 @@ void GL_APIENTRY GL_TexParameterIuivEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIuivEXT(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIuiv(targetPacked, pname, params);
@@ -28160,6 +29197,7 @@ void GL_APIENTRY GL_TexParameterIuivOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterIuivOES(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIuiv(targetPacked, pname, params);
@@ -28189,6 +29227,7 @@ void GL_APIENTRY GL_TexParameterfContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterf(context, targetPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterf(targetPacked, pname, param);
@@ -28219,6 +29258,7 @@ void GL_APIENTRY GL_TexParameterfvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterfv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterfv(targetPacked, pname, params);
@@ -28248,6 +29288,7 @@ void GL_APIENTRY GL_TexParameteriContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameteri(context, targetPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameteri(targetPacked, pname, param);
@@ -28278,6 +29319,7 @@ void GL_APIENTRY GL_TexParameterivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameteriv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameteriv(targetPacked, pname, params);
@@ -28307,6 +29349,7 @@ void GL_APIENTRY GL_TexParameterxContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterx(context, targetPacked, pname, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterx(targetPacked, pname, param);
@@ -28337,6 +29380,7 @@ void GL_APIENTRY GL_TexParameterxvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterxv(context, targetPacked, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterxv(targetPacked, pname, params);
@@ -28368,6 +29412,7 @@ void GL_APIENTRY GL_TexStorage1DEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexStorage1DEXT(context, target, levels, internalformat, width));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage1D(target, levels, internalformat, width);
@@ -28401,6 +29446,7 @@ void GL_APIENTRY GL_TexStorage2DContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexStorage2D(context, targetPacked, levels, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage2D(targetPacked, levels, internalformat, width, height);
@@ -28435,6 +29481,7 @@ void GL_APIENTRY GL_TexStorage2DEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexStorage2DEXT(context, targetPacked, levels, internalformat, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage2D(targetPacked, levels, internalformat, width, height);
@@ -28473,6 +29520,7 @@ void GL_APIENTRY GL_TexStorage2DMultisampleContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexStorage2DMultisample(context, targetPacked, samples, internalformat, width,
                                              height, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage2DMultisample(targetPacked, samples, internalformat, width, height,
@@ -28510,6 +29558,7 @@ void GL_APIENTRY GL_TexStorage3DContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexStorage3D(context, targetPacked, levels, internalformat,
                                                  width, height, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage3D(targetPacked, levels, internalformat, width, height, depth);
@@ -28546,6 +29595,7 @@ void GL_APIENTRY GL_TexStorage3DEXTContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexStorage3DEXT(context, targetPacked, levels, internalformat,
                                                     width, height, depth));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage3D(targetPacked, levels, internalformat, width, height, depth);
@@ -28585,6 +29635,7 @@ void GL_APIENTRY GL_TexStorage3DMultisampleContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexStorage3DMultisample(context, targetPacked, samples, internalformat, width,
                                              height, depth, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage3DMultisample(targetPacked, samples, internalformat, width, height,
@@ -28625,6 +29676,7 @@ void GL_APIENTRY GL_TexStorage3DMultisampleOESContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexStorage3DMultisampleOES(context, targetPacked, samples, internalformat,
                                                 width, height, depth, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage3DMultisample(targetPacked, samples, internalformat, width, height,
@@ -28666,6 +29718,7 @@ void GL_APIENTRY GL_TexStorageMem2DEXTContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexStorageMem2DEXT(context, targetPacked, levels, internalFormat, width,
                                         height, memoryPacked, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMem2D(targetPacked, levels, internalFormat, width, height,
@@ -28708,6 +29761,7 @@ void GL_APIENTRY GL_TexStorageMem2DMultisampleEXTContextANGLE(GLeglContext ctx,
             (context->skipValidation() || ValidateTexStorageMem2DMultisampleEXT(
                                               context, targetPacked, samples, internalFormat, width,
                                               height, fixedSampleLocations, memoryPacked, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMem2DMultisample(targetPacked, samples, internalFormat, width,
@@ -28750,6 +29804,7 @@ void GL_APIENTRY GL_TexStorageMem3DEXTContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexStorageMem3DEXT(context, targetPacked, levels, internalFormat, width,
                                         height, depth, memoryPacked, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMem3D(targetPacked, levels, internalFormat, width, height, depth,
@@ -28793,6 +29848,7 @@ void GL_APIENTRY GL_TexStorageMem3DMultisampleEXTContextANGLE(GLeglContext ctx,
                             ValidateTexStorageMem3DMultisampleEXT(
                                 context, targetPacked, samples, internalFormat, width, height,
                                 depth, fixedSampleLocations, memoryPacked, offset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMem3DMultisample(targetPacked, samples, internalFormat, width,
@@ -28836,6 +29892,7 @@ void GL_APIENTRY GL_TexSubImage2DContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexSubImage2D(context, targetPacked, level, xoffset, yoffset,
                                                   width, height, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage2D(targetPacked, level, xoffset, yoffset, width, height, format,
@@ -28880,6 +29937,7 @@ void GL_APIENTRY GL_TexSubImage3DContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexSubImage3D(context, targetPacked, level, xoffset, yoffset, zoffset, width,
                                    height, depth, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, width, height,
@@ -28924,6 +29982,7 @@ void GL_APIENTRY GL_TexSubImage3DOESContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexSubImage3DOES(context, targetPacked, level, xoffset, yoffset, zoffset,
                                       width, height, depth, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, width, height,
@@ -28958,6 +30017,7 @@ void GL_APIENTRY GL_TransformFeedbackVaryingsContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateTransformFeedbackVaryings(
                                               context, programPacked, count, varyings, bufferMode));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->transformFeedbackVaryings(programPacked, count, varyings, bufferMode);
@@ -28981,6 +30041,7 @@ void GL_APIENTRY GL_TranslatefContextANGLE(GLeglContext ctx, GLfloat x, GLfloat
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslatef(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->translatef(x, y, z);
@@ -29004,6 +30065,7 @@ void GL_APIENTRY GL_TranslatexContextANGLE(GLeglContext ctx, GLfixed x, GLfixed
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslatex(context, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->translatex(x, y, z);
@@ -29028,6 +30090,7 @@ void GL_APIENTRY GL_Uniform1fContextANGLE(GLeglContext ctx, GLint location, GLfl
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform1f(context, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1f(locationPacked, v0);
@@ -29057,6 +30120,7 @@ void GL_APIENTRY GL_Uniform1fvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform1fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1fv(locationPacked, count, value);
@@ -29081,6 +30145,7 @@ void GL_APIENTRY GL_Uniform1iContextANGLE(GLeglContext ctx, GLint location, GLin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform1i(context, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1i(locationPacked, v0);
@@ -29110,6 +30175,7 @@ void GL_APIENTRY GL_Uniform1ivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform1iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1iv(locationPacked, count, value);
@@ -29135,6 +30201,7 @@ void GL_APIENTRY GL_Uniform1uiContextANGLE(GLeglContext ctx, GLint location, GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform1ui(context, locationPacked, v0));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1ui(locationPacked, v0);
@@ -29164,6 +30231,7 @@ void GL_APIENTRY GL_Uniform1uivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform1uiv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform1uiv(locationPacked, count, value);
@@ -29189,6 +30257,7 @@ void GL_APIENTRY GL_Uniform2fContextANGLE(GLeglContext ctx, GLint location, GLfl
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2f(context, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2f(locationPacked, v0, v1);
@@ -29218,6 +30287,7 @@ void GL_APIENTRY GL_Uniform2fvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform2fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2fv(locationPacked, count, value);
@@ -29243,6 +30313,7 @@ void GL_APIENTRY GL_Uniform2iContextANGLE(GLeglContext ctx, GLint location, GLin
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2i(context, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2i(locationPacked, v0, v1);
@@ -29272,6 +30343,7 @@ void GL_APIENTRY GL_Uniform2ivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform2iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2iv(locationPacked, count, value);
@@ -29297,6 +30369,7 @@ void GL_APIENTRY GL_Uniform2uiContextANGLE(GLeglContext ctx, GLint location, GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2ui(context, locationPacked, v0, v1));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2ui(locationPacked, v0, v1);
@@ -29326,6 +30399,7 @@ void GL_APIENTRY GL_Uniform2uivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform2uiv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform2uiv(locationPacked, count, value);
@@ -29352,6 +30426,7 @@ GL_Uniform3fContextANGLE(GLeglContext ctx, GLint location, GLfloat v0, GLfloat v
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3f(context, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3f(locationPacked, v0, v1, v2);
@@ -29381,6 +30456,7 @@ void GL_APIENTRY GL_Uniform3fvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform3fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3fv(locationPacked, count, value);
@@ -29407,6 +30483,7 @@ GL_Uniform3iContextANGLE(GLeglContext ctx, GLint location, GLint v0, GLint v1, G
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3i(context, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3i(locationPacked, v0, v1, v2);
@@ -29436,6 +30513,7 @@ void GL_APIENTRY GL_Uniform3ivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform3iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3iv(locationPacked, count, value);
@@ -29462,6 +30540,7 @@ GL_Uniform3uiContextANGLE(GLeglContext ctx, GLint location, GLuint v0, GLuint v1
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3ui(context, locationPacked, v0, v1, v2));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3ui(locationPacked, v0, v1, v2);
@@ -29491,6 +30570,7 @@ void GL_APIENTRY GL_Uniform3uivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform3uiv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform3uiv(locationPacked, count, value);
@@ -29521,6 +30601,7 @@ void GL_APIENTRY GL_Uniform4fContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4f(context, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4f(locationPacked, v0, v1, v2, v3);
@@ -29550,6 +30631,7 @@ void GL_APIENTRY GL_Uniform4fvContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4fv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4fv(locationPacked, count, value);
@@ -29576,6 +30658,7 @@ GL_Uniform4iContextANGLE(GLeglContext ctx, GLint location, GLint v0, GLint v1, G
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4i(context, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4i(locationPacked, v0, v1, v2, v3);
@@ -29605,6 +30688,7 @@ void GL_APIENTRY GL_Uniform4ivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4iv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4iv(locationPacked, count, value);
@@ -29635,6 +30719,7 @@ void GL_APIENTRY GL_Uniform4uiContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4ui(context, locationPacked, v0, v1, v2, v3));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4ui(locationPacked, v0, v1, v2, v3);
@@ -29664,6 +30749,7 @@ void GL_APIENTRY GL_Uniform4uivContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4uiv(context, locationPacked, count, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniform4uiv(locationPacked, count, value);
@@ -29696,6 +30782,7 @@ void GL_APIENTRY GL_UniformBlockBindingContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateUniformBlockBinding(context, programPacked, uniformBlockIndexPacked,
                                          uniformBlockBinding));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformBlockBinding(programPacked, uniformBlockIndexPacked,
@@ -29729,6 +30816,7 @@ void GL_APIENTRY GL_UniformMatrix2fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix2fv(locationPacked, count, transpose, value);
@@ -29761,6 +30849,7 @@ void GL_APIENTRY GL_UniformMatrix2x3fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2x3fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix2x3fv(locationPacked, count, transpose, value);
@@ -29793,6 +30882,7 @@ void GL_APIENTRY GL_UniformMatrix2x4fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2x4fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix2x4fv(locationPacked, count, transpose, value);
@@ -29825,6 +30915,7 @@ void GL_APIENTRY GL_UniformMatrix3fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix3fv(locationPacked, count, transpose, value);
@@ -29857,6 +30948,7 @@ void GL_APIENTRY GL_UniformMatrix3x2fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3x2fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix3x2fv(locationPacked, count, transpose, value);
@@ -29889,6 +30981,7 @@ void GL_APIENTRY GL_UniformMatrix3x4fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3x4fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix3x4fv(locationPacked, count, transpose, value);
@@ -29921,6 +31014,7 @@ void GL_APIENTRY GL_UniformMatrix4fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix4fv(locationPacked, count, transpose, value);
@@ -29953,6 +31047,7 @@ void GL_APIENTRY GL_UniformMatrix4x2fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4x2fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix4x2fv(locationPacked, count, transpose, value);
@@ -29985,6 +31080,7 @@ void GL_APIENTRY GL_UniformMatrix4x3fvContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4x3fv(context, locationPacked, count, transpose, value));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->uniformMatrix4x3fv(locationPacked, count, transpose, value);
@@ -30012,6 +31108,7 @@ GLboolean GL_APIENTRY GL_UnmapBufferContextANGLE(GLeglContext ctx, GLenum target
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUnmapBuffer(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->unmapBuffer(targetPacked);
@@ -30044,6 +31141,7 @@ GLboolean GL_APIENTRY GL_UnmapBufferOESContextANGLE(GLeglContext ctx, GLenum tar
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUnmapBufferOES(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             returnValue = context->unmapBuffer(targetPacked);
@@ -30074,6 +31172,7 @@ void GL_APIENTRY GL_UseProgramContextANGLE(GLeglContext ctx, GLuint program)
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUseProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->useProgram(programPacked);
@@ -30105,6 +31204,7 @@ void GL_APIENTRY GL_UseProgramStagesContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUseProgramStages(context, pipelinePacked, stages, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->useProgramStages(pipelinePacked, stages, programPacked);
@@ -30137,6 +31237,7 @@ void GL_APIENTRY GL_UseProgramStagesEXTContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUseProgramStagesEXT(context, pipelinePacked, stages, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->useProgramStages(pipelinePacked, stages, programPacked);
@@ -30162,6 +31263,7 @@ void GL_APIENTRY GL_ValidateProgramContextANGLE(GLeglContext ctx, GLuint program
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateValidateProgram(context, programPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->validateProgram(programPacked);
@@ -30187,6 +31289,7 @@ void GL_APIENTRY GL_ValidateProgramPipelineContextANGLE(GLeglContext ctx, GLuint
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateValidateProgramPipeline(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->validateProgramPipeline(pipelinePacked);
@@ -30212,6 +31315,7 @@ void GL_APIENTRY GL_ValidateProgramPipelineEXTContextANGLE(GLeglContext ctx, GLu
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateValidateProgramPipelineEXT(context, pipelinePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->validateProgramPipeline(pipelinePacked);
@@ -30234,6 +31338,7 @@ void GL_APIENTRY GL_VertexAttrib1fContextANGLE(GLeglContext ctx, GLuint index, G
         ASSERT(context == GetValidGlobalContext());
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexAttrib1f(context, index, x));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib1f(index, x);
@@ -30258,6 +31363,7 @@ void GL_APIENTRY GL_VertexAttrib1fvContextANGLE(GLeglContext ctx, GLuint index,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib1fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib1fv(index, v);
@@ -30282,6 +31388,7 @@ void GL_APIENTRY GL_VertexAttrib2fContextANGLE(GLeglContext ctx, GLuint index, G
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2f(context, index, x, y));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib2f(index, x, y);
@@ -30306,6 +31413,7 @@ void GL_APIENTRY GL_VertexAttrib2fvContextANGLE(GLeglContext ctx, GLuint index,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib2fv(index, v);
@@ -30331,6 +31439,7 @@ GL_VertexAttrib3fContextANGLE(GLeglContext ctx, GLuint index, GLfloat x, GLfloat
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3f(context, index, x, y, z));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib3f(index, x, y, z);
@@ -30355,6 +31464,7 @@ void GL_APIENTRY GL_VertexAttrib3fvContextANGLE(GLeglContext ctx, GLuint index,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib3fv(index, v);
@@ -30384,6 +31494,7 @@ void GL_APIENTRY GL_VertexAttrib4fContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4f(context, index, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4f(index, x, y, z, w);
@@ -30408,6 +31519,7 @@ void GL_APIENTRY GL_VertexAttrib4fvContextANGLE(GLeglContext ctx, GLuint index,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4fv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttrib4fv(index, v);
@@ -30434,6 +31546,7 @@ void GL_APIENTRY GL_VertexAttribBindingContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribBinding(context, attribindex, bindingindex));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribBinding(attribindex, bindingindex);
@@ -30458,6 +31571,7 @@ void GL_APIENTRY GL_VertexAttribDivisorContextANGLE(GLeglContext ctx, GLuint ind
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribDivisor(context, index, divisor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribDivisor(index, divisor);
@@ -30484,6 +31598,7 @@ void GL_APIENTRY GL_VertexAttribDivisorANGLEContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribDivisorANGLE(context, index, divisor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribDivisor(index, divisor);
@@ -30510,6 +31625,7 @@ void GL_APIENTRY GL_VertexAttribDivisorEXTContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribDivisorEXT(context, index, divisor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribDivisor(index, divisor);
@@ -30544,6 +31660,7 @@ void GL_APIENTRY GL_VertexAttribFormatContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribFormat(context, attribindex, size, typePacked,
                                                        normalized, relativeoffset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribFormat(attribindex, size, typePacked, normalized, relativeoffset);
@@ -30570,6 +31687,7 @@ GL_VertexAttribI4iContextANGLE(GLeglContext ctx, GLuint index, GLint x, GLint y,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4i(context, index, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4i(index, x, y, z, w);
@@ -30594,6 +31712,7 @@ void GL_APIENTRY GL_VertexAttribI4ivContextANGLE(GLeglContext ctx, GLuint index,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4iv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4iv(index, v);
@@ -30623,6 +31742,7 @@ void GL_APIENTRY GL_VertexAttribI4uiContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4ui(context, index, x, y, z, w));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4ui(index, x, y, z, w);
@@ -30647,6 +31767,7 @@ void GL_APIENTRY GL_VertexAttribI4uivContextANGLE(GLeglContext ctx, GLuint index
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4uiv(context, index, v));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribI4uiv(index, v);
@@ -30678,6 +31799,7 @@ void GL_APIENTRY GL_VertexAttribIFormatContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribIFormat(context, attribindex, size, typePacked, relativeoffset));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribIFormat(attribindex, size, typePacked, relativeoffset);
@@ -30713,6 +31835,7 @@ void GL_APIENTRY GL_VertexAttribIPointerContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribIPointer(context, index, size, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribIPointer(index, size, typePacked, stride, pointer);
@@ -30749,6 +31872,7 @@ void GL_APIENTRY GL_VertexAttribPointerContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribPointer(context, index, size, typePacked,
                                                         normalized, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexAttribPointer(index, size, typePacked, normalized, stride, pointer);
@@ -30776,6 +31900,7 @@ void GL_APIENTRY GL_VertexBindingDivisorContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexBindingDivisor(context, bindingindex, divisor));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexBindingDivisor(bindingindex, divisor);
@@ -30807,6 +31932,7 @@ void GL_APIENTRY GL_VertexPointerContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexPointer(context, size, typePacked, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->vertexPointer(size, typePacked, stride, pointer);
@@ -30832,6 +31958,7 @@ GL_ViewportContextANGLE(GLeglContext ctx, GLint x, GLint y, GLsizei width, GLsiz
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateViewport(context, x, y, width, height));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->viewport(x, y, width, height);
@@ -30870,6 +31997,7 @@ void GL_APIENTRY GL_WaitSemaphoreEXTContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateWaitSemaphoreEXT(context, semaphorePacked, numBufferBarriers, buffersPacked,
                                       numTextureBarriers, texturesPacked, srcLayouts));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->waitSemaphore(semaphorePacked, numBufferBarriers, buffersPacked,
@@ -30901,6 +32029,7 @@ void GL_APIENTRY GL_WaitSyncContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateWaitSync(context, sync, flags, timeout));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->waitSync(sync, flags, timeout);
@@ -30931,6 +32060,7 @@ void GL_APIENTRY GL_WeightPointerOESContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWeightPointerOES(context, size, type, stride, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->weightPointer(size, type, stride, pointer);
@@ -30962,6 +32092,7 @@ void GL_APIENTRY GL_BindUniformLocationCHROMIUMContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindUniformLocationCHROMIUM(context, programPacked, locationPacked, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->bindUniformLocation(programPacked, locationPacked, name);
@@ -30987,6 +32118,7 @@ void GL_APIENTRY GL_CoverageModulationCHROMIUMContextANGLE(GLeglContext ctx, GLe
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCoverageModulationCHROMIUM(context, components));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->coverageModulation(components);
@@ -31033,6 +32165,7 @@ void GL_APIENTRY GL_CopyTextureCHROMIUMContextANGLE(GLeglContext ctx,
                                 context, sourceIdPacked, sourceLevel, destTargetPacked,
                                 destIdPacked, destLevel, internalFormat, destType, unpackFlipY,
                                 unpackPremultiplyAlpha, unpackUnmultiplyAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexture(sourceIdPacked, sourceLevel, destTargetPacked, destIdPacked,
@@ -31087,6 +32220,7 @@ void GL_APIENTRY GL_CopySubTextureCHROMIUMContextANGLE(GLeglContext ctx,
                                 context, sourceIdPacked, sourceLevel, destTargetPacked,
                                 destIdPacked, destLevel, xoffset, yoffset, x, y, width, height,
                                 unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copySubTexture(sourceIdPacked, sourceLevel, destTargetPacked, destIdPacked,
@@ -31120,6 +32254,7 @@ void GL_APIENTRY GL_CompressedCopyTextureCHROMIUMContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCompressedCopyTextureCHROMIUM(context, sourceIdPacked, destIdPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedCopyTexture(sourceIdPacked, destIdPacked);
@@ -31145,6 +32280,7 @@ void GL_APIENTRY GL_RequestExtensionANGLEContextANGLE(GLeglContext ctx, const GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateRequestExtensionANGLE(context, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->requestExtension(name);
@@ -31169,6 +32305,7 @@ void GL_APIENTRY GL_DisableExtensionANGLEContextANGLE(GLeglContext ctx, const GL
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableExtensionANGLE(context, name));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->disableExtension(name);
@@ -31201,6 +32338,7 @@ void GL_APIENTRY GL_GetBooleanvRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetBooleanvRobustANGLE(context, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBooleanvRobust(pname, bufSize, length, params);
@@ -31236,6 +32374,7 @@ void GL_APIENTRY GL_GetBufferParameterivRobustANGLEContextANGLE(GLeglContext ctx
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferParameterivRobustANGLE(context, targetPacked, pname,
                                                                     bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferParameterivRobust(targetPacked, pname, bufSize, length, params);
@@ -31268,6 +32407,7 @@ void GL_APIENTRY GL_GetFloatvRobustANGLEContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFloatvRobustANGLE(context, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFloatvRobust(pname, bufSize, length, params);
@@ -31304,6 +32444,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivRobustANGLEContextANGLE(G
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetFramebufferAttachmentParameterivRobustANGLE(
                                 context, target, attachment, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFramebufferAttachmentParameterivRobust(target, attachment, pname, bufSize,
@@ -31337,6 +32478,7 @@ void GL_APIENTRY GL_GetIntegervRobustANGLEContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetIntegervRobustANGLE(context, pname, bufSize, length, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getIntegervRobust(pname, bufSize, length, data);
@@ -31371,6 +32513,7 @@ void GL_APIENTRY GL_GetProgramivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramivRobustANGLE(context, programPacked, pname, bufSize,
                                                             length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramivRobust(programPacked, pname, bufSize, length, params);
@@ -31404,6 +32547,7 @@ void GL_APIENTRY GL_GetRenderbufferParameterivRobustANGLEContextANGLE(GLeglConte
         bool isCallValid =
             (context->skipValidation() || ValidateGetRenderbufferParameterivRobustANGLE(
                                               context, target, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getRenderbufferParameterivRobust(target, pname, bufSize, length, params);
@@ -31439,6 +32583,7 @@ void GL_APIENTRY GL_GetShaderivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetShaderivRobustANGLE(context, shaderPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getShaderivRobust(shaderPacked, pname, bufSize, length, params);
@@ -31473,6 +32618,7 @@ void GL_APIENTRY GL_GetTexParameterfvRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterfvRobustANGLE(context, targetPacked, pname,
                                                                  bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterfvRobust(targetPacked, pname, bufSize, length, params);
@@ -31509,6 +32655,7 @@ void GL_APIENTRY GL_GetTexParameterivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterivRobustANGLE(context, targetPacked, pname,
                                                                  bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterivRobust(targetPacked, pname, bufSize, length, params);
@@ -31544,6 +32691,7 @@ void GL_APIENTRY GL_GetUniformfvRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformfvRobustANGLE(context, programPacked, locationPacked,
                                                             bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformfvRobust(programPacked, locationPacked, bufSize, length, params);
@@ -31579,6 +32727,7 @@ void GL_APIENTRY GL_GetUniformivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformivRobustANGLE(context, programPacked, locationPacked,
                                                             bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformivRobust(programPacked, locationPacked, bufSize, length, params);
@@ -31613,6 +32762,7 @@ void GL_APIENTRY GL_GetVertexAttribfvRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetVertexAttribfvRobustANGLE(context, index, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribfvRobust(index, pname, bufSize, length, params);
@@ -31647,6 +32797,7 @@ void GL_APIENTRY GL_GetVertexAttribivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetVertexAttribivRobustANGLE(context, index, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribivRobust(index, pname, bufSize, length, params);
@@ -31681,6 +32832,7 @@ void GL_APIENTRY GL_GetVertexAttribPointervRobustANGLEContextANGLE(GLeglContext
         bool isCallValid =
             (context->skipValidation() || ValidateGetVertexAttribPointervRobustANGLE(
                                               context, index, pname, bufSize, length, pointer));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribPointervRobust(index, pname, bufSize, length, pointer);
@@ -31724,6 +32876,7 @@ void GL_APIENTRY GL_ReadPixelsRobustANGLEContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateReadPixelsRobustANGLE(context, x, y, width, height, format, type, bufSize,
                                            length, columns, rows, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readPixelsRobust(x, y, width, height, format, type, bufSize, length, columns,
@@ -31767,6 +32920,7 @@ void GL_APIENTRY GL_TexImage2DRobustANGLEContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexImage2DRobustANGLE(context, targetPacked, level, internalformat, width,
                                            height, border, format, type, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage2DRobust(targetPacked, level, internalformat, width, height, border,
@@ -31801,6 +32955,7 @@ void GL_APIENTRY GL_TexParameterfvRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexParameterfvRobustANGLE(context, targetPacked, pname, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterfvRobust(targetPacked, pname, bufSize, params);
@@ -31834,6 +32989,7 @@ void GL_APIENTRY GL_TexParameterivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexParameterivRobustANGLE(context, targetPacked, pname, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterivRobust(targetPacked, pname, bufSize, params);
@@ -31876,6 +33032,7 @@ void GL_APIENTRY GL_TexSubImage2DRobustANGLEContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexSubImage2DRobustANGLE(context, targetPacked, level, xoffset, yoffset, width,
                                               height, format, type, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage2DRobust(targetPacked, level, xoffset, yoffset, width, height,
@@ -31921,6 +33078,7 @@ void GL_APIENTRY GL_TexImage3DRobustANGLEContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexImage3DRobustANGLE(context, targetPacked, level, internalformat, width,
                                            height, depth, border, format, type, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage3DRobust(targetPacked, level, internalformat, width, height, depth,
@@ -31968,6 +33126,7 @@ void GL_APIENTRY GL_TexSubImage3DRobustANGLEContextANGLE(GLeglContext ctx,
                             ValidateTexSubImage3DRobustANGLE(context, targetPacked, level, xoffset,
                                                              yoffset, zoffset, width, height, depth,
                                                              format, type, bufSize, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texSubImage3DRobust(targetPacked, level, xoffset, yoffset, zoffset, width,
@@ -32010,6 +33169,7 @@ void GL_APIENTRY GL_CompressedTexImage2DRobustANGLEContextANGLE(GLeglContext ctx
             (context->skipValidation() || ValidateCompressedTexImage2DRobustANGLE(
                                               context, targetPacked, level, internalformat, width,
                                               height, border, imageSize, dataSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage2DRobust(targetPacked, level, internalformat, width, height,
@@ -32053,6 +33213,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2DRobustANGLEContextANGLE(GLeglContext
             (context->skipValidation() || ValidateCompressedTexSubImage2DRobustANGLE(
                                               context, targetPacked, level, xoffset, yoffset, width,
                                               height, format, imageSize, dataSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage2DRobust(targetPacked, level, xoffset, yoffset, width,
@@ -32096,6 +33257,7 @@ void GL_APIENTRY GL_CompressedTexImage3DRobustANGLEContextANGLE(GLeglContext ctx
             (context->skipValidation() || ValidateCompressedTexImage3DRobustANGLE(
                                               context, targetPacked, level, internalformat, width,
                                               height, depth, border, imageSize, dataSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexImage3DRobust(targetPacked, level, internalformat, width, height,
@@ -32142,6 +33304,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3DRobustANGLEContextANGLE(GLeglContext
                             ValidateCompressedTexSubImage3DRobustANGLE(
                                 context, targetPacked, level, xoffset, yoffset, zoffset, width,
                                 height, depth, format, imageSize, dataSize, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->compressedTexSubImage3DRobust(targetPacked, level, xoffset, yoffset, zoffset,
@@ -32181,6 +33344,7 @@ void GL_APIENTRY GL_GetQueryivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetQueryivRobustANGLE(context, targetPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryivRobust(targetPacked, pname, bufSize, length, params);
@@ -32216,6 +33380,7 @@ void GL_APIENTRY GL_GetQueryObjectuivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateGetQueryObjectuivRobustANGLE(
                                               context, idPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectuivRobust(idPacked, pname, bufSize, length, params);
@@ -32252,6 +33417,7 @@ void GL_APIENTRY GL_GetBufferPointervRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferPointervRobustANGLE(context, targetPacked, pname,
                                                                  bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferPointervRobust(targetPacked, pname, bufSize, length, params);
@@ -32286,6 +33452,7 @@ void GL_APIENTRY GL_GetIntegeri_vRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetIntegeri_vRobustANGLE(context, target, index, bufSize, length, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getIntegeri_vRobust(target, index, bufSize, length, data);
@@ -32323,6 +33490,7 @@ void GL_APIENTRY GL_GetInternalformativRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetInternalformativRobustANGLE(context, target, internalformat,
                                                                    pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInternalformativRobust(target, internalformat, pname, bufSize, length,
@@ -32358,6 +33526,7 @@ void GL_APIENTRY GL_GetVertexAttribIivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetVertexAttribIivRobustANGLE(context, index, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribIivRobust(index, pname, bufSize, length, params);
@@ -32392,6 +33561,7 @@ void GL_APIENTRY GL_GetVertexAttribIuivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateGetVertexAttribIuivRobustANGLE(
                                               context, index, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getVertexAttribIuivRobust(index, pname, bufSize, length, params);
@@ -32427,6 +33597,7 @@ void GL_APIENTRY GL_GetUniformuivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformuivRobustANGLE(context, programPacked, locationPacked,
                                                              bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getUniformuivRobust(programPacked, locationPacked, bufSize, length, params);
@@ -32466,6 +33637,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockivRobustANGLEContextANGLE(GLeglContext
             (context->skipValidation() ||
              ValidateGetActiveUniformBlockivRobustANGLE(
                  context, programPacked, uniformBlockIndexPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getActiveUniformBlockivRobust(programPacked, uniformBlockIndexPacked, pname,
@@ -32500,6 +33672,7 @@ void GL_APIENTRY GL_GetInteger64vRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetInteger64vRobustANGLE(context, pname, bufSize, length, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInteger64vRobust(pname, bufSize, length, data);
@@ -32533,6 +33706,7 @@ void GL_APIENTRY GL_GetInteger64i_vRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetInteger64i_vRobustANGLE(context, target, index, bufSize, length, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getInteger64i_vRobust(target, index, bufSize, length, data);
@@ -32569,6 +33743,7 @@ void GL_APIENTRY GL_GetBufferParameteri64vRobustANGLEContextANGLE(GLeglContext c
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferParameteri64vRobustANGLE(context, targetPacked, pname,
                                                                       bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBufferParameteri64vRobust(targetPacked, pname, bufSize, length, params);
@@ -32601,6 +33776,7 @@ void GL_APIENTRY GL_SamplerParameterivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSamplerParameterivRobustANGLE(context, samplerPacked, pname, bufSize, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterivRobust(samplerPacked, pname, bufSize, param);
@@ -32634,6 +33810,7 @@ void GL_APIENTRY GL_SamplerParameterfvRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSamplerParameterfvRobustANGLE(context, samplerPacked, pname, bufSize, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterfvRobust(samplerPacked, pname, bufSize, param);
@@ -32669,6 +33846,7 @@ void GL_APIENTRY GL_GetSamplerParameterivRobustANGLEContextANGLE(GLeglContext ct
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterivRobustANGLE(context, samplerPacked, pname,
                                                                      bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterivRobust(samplerPacked, pname, bufSize, length, params);
@@ -32704,6 +33882,7 @@ void GL_APIENTRY GL_GetSamplerParameterfvRobustANGLEContextANGLE(GLeglContext ct
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterfvRobustANGLE(context, samplerPacked, pname,
                                                                      bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterfvRobust(samplerPacked, pname, bufSize, length, params);
@@ -32739,6 +33918,7 @@ void GL_APIENTRY GL_GetFramebufferParameterivRobustANGLEContextANGLE(GLeglContex
         bool isCallValid =
             (context->skipValidation() || ValidateGetFramebufferParameterivRobustANGLE(
                                               context, target, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getFramebufferParameterivRobust(target, pname, bufSize, length, params);
@@ -32777,6 +33957,7 @@ void GL_APIENTRY GL_GetProgramInterfaceivRobustANGLEContextANGLE(GLeglContext ct
             (context->skipValidation() ||
              ValidateGetProgramInterfaceivRobustANGLE(context, programPacked, programInterface,
                                                       pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getProgramInterfaceivRobust(programPacked, programInterface, pname, bufSize,
@@ -32812,6 +33993,7 @@ void GL_APIENTRY GL_GetBooleani_vRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetBooleani_vRobustANGLE(context, target, index, bufSize, length, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getBooleani_vRobust(target, index, bufSize, length, data);
@@ -32846,6 +34028,7 @@ void GL_APIENTRY GL_GetMultisamplefvRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetMultisamplefvRobustANGLE(context, pname, index, bufSize, length, val));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMultisamplefvRobust(pname, index, bufSize, length, val);
@@ -32883,6 +34066,7 @@ void GL_APIENTRY GL_GetTexLevelParameterivRobustANGLEContextANGLE(GLeglContext c
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexLevelParameterivRobustANGLE(
                                 context, targetPacked, level, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameterivRobust(targetPacked, level, pname, bufSize, length,
@@ -32921,6 +34105,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfvRobustANGLEContextANGLE(GLeglContext c
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexLevelParameterfvRobustANGLE(
                                 context, targetPacked, level, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameterfvRobust(targetPacked, level, pname, bufSize, length,
@@ -32955,6 +34140,7 @@ void GL_APIENTRY GL_GetPointervRobustANGLERobustANGLEContextANGLE(GLeglContext c
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetPointervRobustANGLERobustANGLE(context, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getPointervRobustANGLERobust(pname, bufSize, length, params);
@@ -32998,6 +34184,7 @@ void GL_APIENTRY GL_ReadnPixelsRobustANGLEContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateReadnPixelsRobustANGLE(context, x, y, width, height, format, type, bufSize,
                                             length, columns, rows, data));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->readnPixelsRobust(x, y, width, height, format, type, bufSize, length, columns,
@@ -33034,6 +34221,7 @@ void GL_APIENTRY GL_GetnUniformfvRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnUniformfvRobustANGLE(context, programPacked, locationPacked,
                                                              bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformfvRobust(programPacked, locationPacked, bufSize, length, params);
@@ -33069,6 +34257,7 @@ void GL_APIENTRY GL_GetnUniformivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnUniformivRobustANGLE(context, programPacked, locationPacked,
                                                              bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformivRobust(programPacked, locationPacked, bufSize, length, params);
@@ -33104,6 +34293,7 @@ void GL_APIENTRY GL_GetnUniformuivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnUniformuivRobustANGLE(
                                 context, programPacked, locationPacked, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getnUniformuivRobust(programPacked, locationPacked, bufSize, length, params);
@@ -33137,6 +34327,7 @@ void GL_APIENTRY GL_TexParameterIivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexParameterIivRobustANGLE(context, targetPacked, pname, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIivRobust(targetPacked, pname, bufSize, params);
@@ -33170,6 +34361,7 @@ void GL_APIENTRY GL_TexParameterIuivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexParameterIuivRobustANGLE(context, targetPacked, pname, bufSize, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texParameterIuivRobust(targetPacked, pname, bufSize, params);
@@ -33206,6 +34398,7 @@ void GL_APIENTRY GL_GetTexParameterIivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIivRobustANGLE(context, targetPacked, pname,
                                                                   bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIivRobust(targetPacked, pname, bufSize, length, params);
@@ -33242,6 +34435,7 @@ void GL_APIENTRY GL_GetTexParameterIuivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexParameterIuivRobustANGLE(context, targetPacked, pname,
                                                                    bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexParameterIuivRobust(targetPacked, pname, bufSize, length, params);
@@ -33275,6 +34469,7 @@ void GL_APIENTRY GL_SamplerParameterIivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSamplerParameterIivRobustANGLE(context, samplerPacked, pname, bufSize, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIivRobust(samplerPacked, pname, bufSize, param);
@@ -33308,6 +34503,7 @@ void GL_APIENTRY GL_SamplerParameterIuivRobustANGLEContextANGLE(GLeglContext ctx
         bool isCallValid =
             (context->skipValidation() || ValidateSamplerParameterIuivRobustANGLE(
                                               context, samplerPacked, pname, bufSize, param));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->samplerParameterIuivRobust(samplerPacked, pname, bufSize, param);
@@ -33343,6 +34539,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivRobustANGLEContextANGLE(GLeglContext c
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterIivRobustANGLE(context, samplerPacked, pname,
                                                                       bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIivRobust(samplerPacked, pname, bufSize, length, params);
@@ -33378,6 +34575,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivRobustANGLEContextANGLE(GLeglContext
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSamplerParameterIuivRobustANGLE(
                                 context, samplerPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getSamplerParameterIuivRobust(samplerPacked, pname, bufSize, length, params);
@@ -33413,6 +34611,7 @@ void GL_APIENTRY GL_GetQueryObjectivRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateGetQueryObjectivRobustANGLE(
                                               context, idPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectivRobust(idPacked, pname, bufSize, length, params);
@@ -33446,6 +34645,7 @@ void GL_APIENTRY GL_GetQueryObjecti64vRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateGetQueryObjecti64vRobustANGLE(
                                               context, idPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjecti64vRobust(idPacked, pname, bufSize, length, params);
@@ -33479,6 +34679,7 @@ void GL_APIENTRY GL_GetQueryObjectui64vRobustANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() || ValidateGetQueryObjectui64vRobustANGLE(
                                               context, idPacked, pname, bufSize, length, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getQueryObjectui64vRobust(idPacked, pname, bufSize, length, params);
@@ -33526,6 +34727,7 @@ void GL_APIENTRY GL_CopyTexture3DANGLEContextANGLE(GLeglContext ctx,
                                 context, sourceIdPacked, sourceLevel, destTargetPacked,
                                 destIdPacked, destLevel, internalFormat, destType, unpackFlipY,
                                 unpackPremultiplyAlpha, unpackUnmultiplyAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copyTexture3D(sourceIdPacked, sourceLevel, destTargetPacked, destIdPacked,
@@ -33585,6 +34787,7 @@ void GL_APIENTRY GL_CopySubTexture3DANGLEContextANGLE(GLeglContext ctx,
                                            destIdPacked, destLevel, xoffset, yoffset, zoffset, x, y,
                                            z, width, height, depth, unpackFlipY,
                                            unpackPremultiplyAlpha, unpackUnmultiplyAlpha));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->copySubTexture3D(sourceIdPacked, sourceLevel, destTargetPacked, destIdPacked,
@@ -33628,6 +34831,7 @@ void GL_APIENTRY GL_TexStorage2DMultisampleANGLEContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexStorage2DMultisampleANGLE(context, targetPacked, samples, internalformat,
                                                   width, height, fixedsamplelocations));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorage2DMultisample(targetPacked, samples, internalformat, width, height,
@@ -33662,6 +34866,7 @@ void GL_APIENTRY GL_GetTexLevelParameterivANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexLevelParameterivANGLE(context, targetPacked, level, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameteriv(targetPacked, level, pname, params);
@@ -33695,6 +34900,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfvANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexLevelParameterfvANGLE(context, targetPacked, level, pname, params));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexLevelParameterfv(targetPacked, level, pname, params);
@@ -33729,6 +34935,7 @@ void GL_APIENTRY GL_MultiDrawArraysANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiDrawArraysANGLE(context, modePacked, firsts, counts, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawArrays(modePacked, firsts, counts, drawcount);
@@ -33764,6 +34971,7 @@ void GL_APIENTRY GL_MultiDrawArraysInstancedANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiDrawArraysInstancedANGLE(
                                 context, modePacked, firsts, counts, instanceCounts, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawArraysInstanced(modePacked, firsts, counts, instanceCounts,
@@ -33801,6 +35009,7 @@ void GL_APIENTRY GL_MultiDrawElementsANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiDrawElementsANGLE(context, modePacked, counts, typePacked,
                                                            indices, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElements(modePacked, counts, typePacked, indices, drawcount);
@@ -33840,6 +35049,7 @@ void GL_APIENTRY GL_MultiDrawElementsInstancedANGLEContextANGLE(GLeglContext ctx
             (context->skipValidation() ||
              ValidateMultiDrawElementsInstancedANGLE(context, modePacked, counts, typePacked,
                                                      indices, instanceCounts, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElementsInstanced(modePacked, counts, typePacked, indices,
@@ -33875,6 +35085,7 @@ void GL_APIENTRY GL_DrawArraysInstancedBaseInstanceANGLEContextANGLE(GLeglContex
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawArraysInstancedBaseInstanceANGLE(
                                 context, modePacked, first, count, instanceCount, baseInstance));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawArraysInstancedBaseInstance(modePacked, first, count, instanceCount,
@@ -33917,6 +35128,7 @@ GL_DrawElementsInstancedBaseVertexBaseInstanceANGLEContextANGLE(GLeglContext ctx
             (context->skipValidation() || ValidateDrawElementsInstancedBaseVertexBaseInstanceANGLE(
                                               context, modePacked, count, typePacked, indices,
                                               instanceCounts, baseVertex, baseInstance));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->drawElementsInstancedBaseVertexBaseInstance(
@@ -33957,6 +35169,7 @@ GL_MultiDrawArraysInstancedBaseInstanceANGLEContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateMultiDrawArraysInstancedBaseInstanceANGLE(
                  context, modePacked, firsts, counts, instanceCounts, baseInstances, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawArraysInstancedBaseInstance(modePacked, firsts, counts,
@@ -34001,6 +35214,7 @@ GL_MultiDrawElementsInstancedBaseVertexBaseInstanceANGLEContextANGLE(GLeglContex
                             ValidateMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(
                                 context, modePacked, counts, typePacked, indices, instanceCounts,
                                 baseVertices, baseInstances, drawcount));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->multiDrawElementsInstancedBaseVertexBaseInstance(
@@ -34033,6 +35247,7 @@ void GL_APIENTRY GL_GetMultisamplefvANGLEContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetMultisamplefvANGLE(context, pname, index, val));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getMultisamplefv(pname, index, val);
@@ -34059,6 +35274,7 @@ void GL_APIENTRY GL_SampleMaskiANGLEContextANGLE(GLeglContext ctx,
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleMaskiANGLE(context, maskNumber, mask));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->sampleMaski(maskNumber, mask);
@@ -34084,6 +35300,7 @@ void GL_APIENTRY GL_ProvokingVertexANGLEContextANGLE(GLeglContext ctx, GLenum mo
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateProvokingVertexANGLE(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->provokingVertex(modePacked);
@@ -34111,6 +35328,7 @@ void GL_APIENTRY GL_LoseContextCHROMIUMContextANGLE(GLeglContext ctx, GLenum cur
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateLoseContextCHROMIUM(context, currentPacked, otherPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->loseContext(currentPacked, otherPacked);
@@ -34150,6 +35368,7 @@ void GL_APIENTRY GL_TexImage2DExternalANGLEContextANGLE(GLeglContext ctx,
             (context->skipValidation() ||
              ValidateTexImage2DExternalANGLE(context, targetPacked, level, internalformat, width,
                                              height, border, format, type));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texImage2DExternal(targetPacked, level, internalformat, width, height, border,
@@ -34177,6 +35396,7 @@ void GL_APIENTRY GL_InvalidateTextureANGLEContextANGLE(GLeglContext ctx, GLenum
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateInvalidateTextureANGLE(context, targetPacked));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->invalidateTexture(targetPacked);
@@ -34212,6 +35432,7 @@ void GL_APIENTRY GL_GetTexImageANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexImageANGLE(context, targetPacked, level, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getTexImage(targetPacked, level, format, type, pixels);
@@ -34245,6 +35466,7 @@ void GL_APIENTRY GL_GetRenderbufferImageANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetRenderbufferImageANGLE(context, target, format, type, pixels));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->getRenderbufferImage(target, format, type, pixels);
@@ -34289,6 +35511,7 @@ void GL_APIENTRY GL_TexStorageMemFlags2DANGLEContextANGLE(GLeglContext ctx,
                             ValidateTexStorageMemFlags2DANGLE(
                                 context, targetPacked, levels, internalFormat, width, height,
                                 memoryPacked, offset, createFlags, usageFlags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMemFlags2D(targetPacked, levels, internalFormat, width, height,
@@ -34337,6 +35560,7 @@ void GL_APIENTRY GL_TexStorageMemFlags2DMultisampleANGLEContextANGLE(GLeglContex
              ValidateTexStorageMemFlags2DMultisampleANGLE(
                  context, targetPacked, samples, internalFormat, width, height,
                  fixedSampleLocations, memoryPacked, offset, createFlags, usageFlags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMemFlags2DMultisample(targetPacked, samples, internalFormat, width,
@@ -34385,6 +35609,7 @@ void GL_APIENTRY GL_TexStorageMemFlags3DANGLEContextANGLE(GLeglContext ctx,
                             ValidateTexStorageMemFlags3DANGLE(
                                 context, targetPacked, levels, internalFormat, width, height, depth,
                                 memoryPacked, offset, createFlags, usageFlags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMemFlags3D(targetPacked, levels, internalFormat, width, height,
@@ -34435,6 +35660,7 @@ void GL_APIENTRY GL_TexStorageMemFlags3DMultisampleANGLEContextANGLE(GLeglContex
              ValidateTexStorageMemFlags3DMultisampleANGLE(
                  context, targetPacked, samples, internalFormat, width, height, depth,
                  fixedSampleLocations, memoryPacked, offset, createFlags, usageFlags));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->texStorageMemFlags3DMultisample(targetPacked, samples, internalFormat, width,
@@ -34472,6 +35698,7 @@ void GL_APIENTRY GL_ImportMemoryZirconHandleANGLEContextANGLE(GLeglContext ctx,
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateImportMemoryZirconHandleANGLE(context, memoryPacked, size,
                                                                   handleTypePacked, handle));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->importMemoryZirconHandle(memoryPacked, size, handleTypePacked, handle);
@@ -34504,6 +35731,7 @@ void GL_APIENTRY GL_ImportSemaphoreZirconHandleANGLEContextANGLE(GLeglContext ct
         bool isCallValid =
             (context->skipValidation() || ValidateImportSemaphoreZirconHandleANGLE(
                                               context, semaphorePacked, handleTypePacked, handle));
+        ANGLE_PROFILE_VALIDATION_END();
         if (isCallValid)
         {
             context->importSemaphoreZirconHandle(semaphorePacked, handleTypePacked, handle);
@@ -34517,4 +35745,30 @@ void GL_APIENTRY GL_ImportSemaphoreZirconHandleANGLEContextANGLE(GLeglContext ct
     }
 }
 
+void GL_APIENTRY GL_PrewarmDrawStateANGLEContextANGLE(GLeglContext ctx, GLenum mode)
+{
+    Context *context = static_cast<gl::Context *>(ctx);
+    EVENT(context, GLPrewarmDrawStateANGLE, "context = %d, mode = %s", CID(context),
+          GLenumToString(GLenumGroup::PrimitiveType, mode));
+
+    if (context && !context->isContextLost())
+    {
+        ASSERT(context == GetValidGlobalContext());
+        PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
+        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        bool isCallValid =
+            (context->skipValidation() || ValidatePrewarmDrawStateANGLE(context, modePacked));
+        ANGLE_PROFILE_VALIDATION_END();
+        if (isCallValid)
+        {
+            context->prewarmDrawState(modePacked);
+        }
+        ANGLE_CAPTURE(PrewarmDrawStateANGLE, isCallValid, context, modePacked);
+    }
+    else
+    {
+        GenerateContextLostErrorOnContext(context);
+    }
+}
+
 }  // extern "C"
@@ -201,6 +201,9 @@ ANGLE_EXPORT void GL_APIENTRY GL_MultiDrawElementsInstancedANGLE(GLenum mode,
                                                                  const GLsizei *instanceCounts,
                                                                  GLsizei drawcount);
 
+// GL_ANGLE_prewarm_draw_state
+ANGLE_EXPORT void GL_APIENTRY GL_PrewarmDrawStateANGLE(GLenum mode);
+
 // GL_ANGLE_program_binary
 
 // GL_ANGLE_provoking_vertex
@@ -1095,6 +1098,17 @@ ANGLE_EXPORT void GL_APIENTRY GL_FramebufferFetchBarrierEXT();
 
 // GL_EXT_shader_io_blocks
 
+// GL_EXT_sparse_texture
+ANGLE_EXPORT void GL_APIENTRY GL_TexPageCommitmentEXT(GLenum target,
+                                                      GLint level,
+                                                      GLint xoffset,
+                                                      GLint yoffset,
+                                                      GLint zoffset,
+                                                      GLsizei width,
+                                                      GLsizei height,
+                                                      GLsizei depth,
+                                                      GLboolean commit);
+
 // GL_EXT_tessellation_shader
 ANGLE_EXPORT void GL_APIENTRY GL_PatchParameteriEXT(GLenum pname, GLint value);
 
@@ -3927,6 +3941,16 @@ ANGLE_EXPORT void GL_APIENTRY GL_TexImage3DOESContextANGLE(GLeglContext ctx,
                                                            GLenum format,
                                                            GLenum type,
                                                            const void *pixels);
+ANGLE_EXPORT void GL_APIENTRY GL_TexPageCommitmentEXTContextANGLE(GLeglContext ctx,
+                                                                  GLenum target,
+                                                                  GLint level,
+                                                                  GLint xoffset,
+                                                                  GLint yoffset,
+                                                                  GLint zoffset,
+                                                                  GLsizei width,
+                                                                  GLsizei height,
+                                                                  GLsizei depth,
+                                                                  GLboolean commit);
 ANGLE_EXPORT void GL_APIENTRY GL_TexParameterIivContextANGLE(GLeglContext ctx,
                                                              GLenum target,
                                                              GLenum pname,
@@ -5044,6 +5068,7 @@ ANGLE_EXPORT void GL_APIENTRY GL_ImportSemaphoreZirconHandleANGLEContextANGLE(GL
                                                                               GLuint semaphore,
                                                                               GLenum handleType,
                                                                               GLuint handle);
+ANGLE_EXPORT void GL_APIENTRY GL_PrewarmDrawStateANGLEContextANGLE(GLeglContext ctx, GLenum mode);
 }  // extern "C"
 
 #endif  // LIBGLESV2_ENTRY_POINTS_GLES_EXT_AUTOGEN_H_
@@ -28,6 +28,7 @@ static_assert(std::is_trivially_destructible<decltype(g_Mutex)>::value,
 ANGLE_REQUIRE_CONSTANT_INIT gl::Context *g_LastContext(nullptr);
 static_assert(std::is_trivially_destructible<decltype(g_LastContext)>::value,
               "global last context is not trivially destructible");
+ANGLE_REQUIRE_CONSTANT_INIT gl::ContextID g_LastContextID = {0};
 
 void SetContextToAndroidOpenGLTLSSlot(gl::Context *value)
 {
@@ -84,7 +85,19 @@ gl::Context *GetGlobalLastContext()
 
 void SetGlobalLastContext(gl::Context *context)
 {
-    g_LastContext = context;
+    g_LastContext   = context;
+    g_LastContextID = context ? context->id() : gl::ContextID{0};
+}
+
+gl::Context *GetGlobalLastContextIfValid(const Display *display)
+{
+    // The last context may have been destroyed since, and another one created at its address.
+    if (g_LastContext == nullptr || !display->isValidContext(g_LastContext) ||
+        g_LastContext->id() != g_LastContextID)
+    {
+        return nullptr;
+    }
+    return g_LastContext;
 }
 
 Thread *GetCurrentThread()
@@ -104,6 +117,35 @@ void SetContextCurrent(Thread *thread, gl::Context *context)
 #endif
 }
 
+ScopedShareGroupLock::ScopedShareGroupLock(const gl::Context *context)
+{
+    if (context != nullptr)
+    {
+        mMutex = context->getShareGroup()->getMutex();
+        mMutex->lock();
+    }
+}
+
+ScopedShareGroupLock::~ScopedShareGroupLock()
+{
+    if (mMutex)
+    {
+        mMutex->unlock();
+    }
+}
+
+ScopedEGLLock::ScopedEGLLock()
+    : mGlobalMutexLock(GetGlobalMutex()), mShareGroupLock(GetCurrentThread()->getContext())
+{
+    // EGL calls can observe the results of GL calls (eglSwapBuffers, eglCreateSync, ...), so run
+    // the draws recorded on the current context first.
+    gl::Context *context = GetCurrentThread()->getContext();
+    if (ANGLE_UNLIKELY(context && context->hasDeferredCommands()))
+    {
+        context->flushDeferredCommands();
+    }
+}
+
 }  // namespace egl
 
 namespace gl
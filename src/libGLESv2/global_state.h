@@ -11,13 +11,17 @@
 
 #include "libANGLE/Context.h"
 #include "libANGLE/Debug.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/Thread.h"
 #include "libANGLE/features.h"
 
+#include <memory>
 #include <mutex>
 
 namespace angle
 {
+// The share group mutexes are of the same type, so that GetContextLock can return a lock on
+// either.
 using GlobalMutex = std::recursive_mutex;
 
 //  - TLS_SLOT_OPENGL and TLS_SLOT_OPENGL_API: These two aren't used by bionic
@@ -94,14 +98,44 @@ extern thread_local Thread *gCurrentThread;
 angle::GlobalMutex &GetGlobalMutex();
 gl::Context *GetGlobalLastContext();
 void SetGlobalLastContext(gl::Context *context);
+// Returns the last context if it's still a valid context of |display|, nullptr otherwise.
+gl::Context *GetGlobalLastContextIfValid(const Display *display);
 Thread *GetCurrentThread();
 Debug *GetDebug();
 void SetContextCurrent(Thread *thread, gl::Context *context);
+
+// Locks the share group of |context| during an EGL call, which already holds the global mutex.
+// GL calls on a shared context only lock its share group, so EGL calls that operate on a context
+// lock its share group as well.  EGL calls always lock the global mutex first, so only one thread
+// at a time can hold more than one share group lock.
+class ScopedShareGroupLock final : angle::NonCopyable
+{
+  public:
+    explicit ScopedShareGroupLock(const gl::Context *context);
+    ~ScopedShareGroupLock();
+
+  private:
+    std::shared_ptr<angle::GlobalMutex> mMutex;
+};
+
+// The lock held by EGL entry points: the global mutex, and the share group of the calling thread's
+// current context, which most EGL calls can operate on.
+class ScopedEGLLock final : angle::NonCopyable
+{
+  public:
+    ScopedEGLLock();
+
+  private:
+    std::lock_guard<angle::GlobalMutex> mGlobalMutexLock;
+    ScopedShareGroupLock mShareGroupLock;
+};
 }  // namespace egl
 
 #define ANGLE_SCOPED_GLOBAL_LOCK() \
     std::lock_guard<angle::GlobalMutex> globalMutexLock(egl::GetGlobalMutex())
 
+#define ANGLE_SCOPED_EGL_LOCK() egl::ScopedEGLLock eglLock
+
 namespace gl
 {
 ANGLE_INLINE Context *GetGlobalContext()
@@ -142,12 +176,20 @@ void GenerateContextLostErrorOnCurrentGlobalContext();
 
 #if defined(ANGLE_FORCE_CONTEXT_CHECK_EVERY_CALL)
 // TODO(b/177574181): This should be handled in a backend-specific way.
-// if previous context different from current context, dirty all state
+// if previous context different from current context, dirty the state that may differ
 static ANGLE_INLINE void DirtyContextIfNeeded(Context *context)
 {
     if (context && context != egl::GetGlobalLastContext())
     {
-        context->dirtyAllState();
+        Context *lastContext = egl::GetGlobalLastContextIfValid(context->getDisplay());
+        if (lastContext)
+        {
+            context->dirtyStateDifferingFrom(lastContext);
+        }
+        else
+        {
+            context->dirtyAllState();
+        }
         SetGlobalLastContext(context);
     }
 }
@@ -160,10 +202,23 @@ ANGLE_INLINE std::unique_lock<angle::GlobalMutex> GetContextLock(Context *contex
     auto lock = std::unique_lock<angle::GlobalMutex>(egl::GetGlobalMutex());
 
     DirtyContextIfNeeded(context);
+    ANGLE_PROFILE_VALIDATION_BEGIN();
     return lock;
 #else
-    return context->isShared() ? std::unique_lock<angle::GlobalMutex>(egl::GetGlobalMutex())
-                               : std::unique_lock<angle::GlobalMutex>();
+    // Contexts of different share groups don't touch each other's state, so only the calls on the
+    // contexts of one share group need to be serialized.
+    std::unique_lock<angle::GlobalMutex> lock =
+        context->isShared()
+            ? std::unique_lock<angle::GlobalMutex>(*context->getShareGroup()->getMutex())
+            : std::unique_lock<angle::GlobalMutex>();
+
+    // Every call that isn't recorded runs the recorded draws first to keep the call order.
+    if (ANGLE_UNLIKELY(context->hasDeferredCommands()))
+    {
+        context->flushDeferredCommands();
+    }
+    ANGLE_PROFILE_VALIDATION_BEGIN();
+    return lock;
 #endif
 }
 
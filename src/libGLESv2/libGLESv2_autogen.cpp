@@ -2991,6 +2991,12 @@ void GL_APIENTRY glMultiDrawElementsInstancedANGLE(GLenum mode,
                                               drawcount);
 }
 
+// GL_ANGLE_prewarm_draw_state
+void GL_APIENTRY glPrewarmDrawStateANGLE(GLenum mode)
+{
+    return GL_PrewarmDrawStateANGLE(mode);
+}
+
 // GL_ANGLE_program_binary
 
 // GL_ANGLE_provoking_vertex
@@ -4631,6 +4637,21 @@ void GL_APIENTRY glFramebufferFetchBarrierEXT()
 
 // GL_EXT_shader_io_blocks
 
+// GL_EXT_sparse_texture
+void GL_APIENTRY glTexPageCommitmentEXT(GLenum target,
+                                        GLint level,
+                                        GLint xoffset,
+                                        GLint yoffset,
+                                        GLint zoffset,
+                                        GLsizei width,
+                                        GLsizei height,
+                                        GLsizei depth,
+                                        GLboolean commit)
+{
+    return GL_TexPageCommitmentEXT(target, level, xoffset, yoffset, zoffset, width, height, depth,
+                                   commit);
+}
+
 // GL_EXT_tessellation_shader
 void GL_APIENTRY glPatchParameteriEXT(GLenum pname, GLint value)
 {
@@ -10018,6 +10039,21 @@ void GL_APIENTRY glTexImage3DOESContextANGLE(GLeglContext ctx,
                                         border, format, type, pixels);
 }
 
+void GL_APIENTRY glTexPageCommitmentEXTContextANGLE(GLeglContext ctx,
+                                                    GLenum target,
+                                                    GLint level,
+                                                    GLint xoffset,
+                                                    GLint yoffset,
+                                                    GLint zoffset,
+                                                    GLsizei width,
+                                                    GLsizei height,
+                                                    GLsizei depth,
+                                                    GLboolean commit)
+{
+    return GL_TexPageCommitmentEXTContextANGLE(ctx, target, level, xoffset, yoffset, zoffset, width,
+                                               height, depth, commit);
+}
+
 void GL_APIENTRY glTexParameterIivContextANGLE(GLeglContext ctx,
                                                GLenum target,
                                                GLenum pname,
@@ -11927,4 +11963,9 @@ void GL_APIENTRY glImportSemaphoreZirconHandleANGLEContextANGLE(GLeglContext ctx
     return GL_ImportSemaphoreZirconHandleANGLEContextANGLE(ctx, semaphore, handleType, handle);
 }
 
+void GL_APIENTRY glPrewarmDrawStateANGLEContextANGLE(GLeglContext ctx, GLenum mode)
+{
+    return GL_PrewarmDrawStateANGLEContextANGLE(ctx, mode);
+}
+
 }  // extern "C"
@@ -1223,6 +1223,8 @@ const ProcEntry g_procTable[] = {
     {"glPopGroupMarkerEXTContextANGLE", P(GL_PopGroupMarkerEXTContextANGLE)},
     {"glPopMatrix", P(GL_PopMatrix)},
     {"glPopMatrixContextANGLE", P(GL_PopMatrixContextANGLE)},
+    {"glPrewarmDrawStateANGLE", P(GL_PrewarmDrawStateANGLE)},
+    {"glPrewarmDrawStateANGLEContextANGLE", P(GL_PrewarmDrawStateANGLEContextANGLE)},
     {"glPrimitiveBoundingBox", P(GL_PrimitiveBoundingBox)},
     {"glPrimitiveBoundingBoxContextANGLE", P(GL_PrimitiveBoundingBoxContextANGLE)},
     {"glPrimitiveBoundingBoxEXT", P(GL_PrimitiveBoundingBoxEXT)},
@@ -1538,6 +1540,8 @@ const ProcEntry g_procTable[] = {
     {"glTexImage3DOESContextANGLE", P(GL_TexImage3DOESContextANGLE)},
     {"glTexImage3DRobustANGLE", P(GL_TexImage3DRobustANGLE)},
     {"glTexImage3DRobustANGLEContextANGLE", P(GL_TexImage3DRobustANGLEContextANGLE)},
+    {"glTexPageCommitmentEXT", P(GL_TexPageCommitmentEXT)},
+    {"glTexPageCommitmentEXTContextANGLE", P(GL_TexPageCommitmentEXTContextANGLE)},
     {"glTexParameterIiv", P(GL_TexParameterIiv)},
     {"glTexParameterIivContextANGLE", P(GL_TexParameterIivContextANGLE)},
     {"glTexParameterIivEXT", P(GL_TexParameterIivEXT)},
@@ -1761,5 +1765,5 @@ const ProcEntry g_procTable[] = {
     {"glWeightPointerOES", P(GL_WeightPointerOES)},
     {"glWeightPointerOESContextANGLE", P(GL_WeightPointerOESContextANGLE)}};
 
-const size_t g_numProcs = 1663;
+const size_t g_numProcs = 1667;
 }  // namespace egl
@@ -508,7 +508,7 @@ class TestBatch():
         # set the static environment variables that do not change throughout the script run
         env = os.environ.copy()
         env['ANGLE_CAPTURE_FRAME_END'] = '{}'.format(self.CAPTURE_FRAME_END)
-        env['ANGLE_CAPTURE_SERIALIZE_STATE'] = '1'
+        env['ANGLE_CAPTURE_SERIALIZE_STATE'] = 'hashes' if args.serialize_state_hashes else '1'
         env['ANGLE_CAPTURE_ENABLED'] = '1'
 
         info('Setting ANGLE_CAPTURE_OUT_DIR to %s' % self.trace_folder_path)
@@ -1042,6 +1042,11 @@ if __name__ == "__main__":
         help='Maximum number of test processes. Default is %d.' % DEFAULT_MAX_JOBS)
     parser.add_argument('--depot-tools-path', default=None, help='Path to depot tools')
     parser.add_argument('--xvfb', action='store_true', help='Run with xvfb.')
+    parser.add_argument(
+        '--serialize-state-hashes',
+        action='store_true',
+        help='Capture the hashes of the context objects instead of the full context state. '
+        'Off by default.')
     args = parser.parse_args()
     if platform == "win32":
         args.test_suite += ".exe"
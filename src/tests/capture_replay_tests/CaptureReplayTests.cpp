@@ -19,8 +19,10 @@
 #include <functional>
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <utility>
 
@@ -32,6 +34,33 @@
 
 constexpr char kResultTag[] = "*RESULT";
 
+// The first line of the GL_SERIALIZED_CONTEXT_HASHES_STRING_ANGLE string, which traces captured
+// with ANGLE_CAPTURE_SERIALIZE_STATE=hashes hold instead of the full serialized state.
+constexpr char kSerializedContextHashesHeader[] = "SerializedContextHashes";
+
+namespace
+{
+bool IsSerializedContextHashes(const char *serializedContextState)
+{
+    return strncmp(serializedContextState, kSerializedContextHashesHeader,
+                   strlen(kSerializedContextHashesHeader)) == 0;
+}
+
+// Maps the name of every object of a serialized context hashes string to its hash.
+std::map<std::string, std::string> ParseSerializedContextHashes(const char *hashesString)
+{
+    std::map<std::string, std::string> hashes;
+    std::istringstream lines(hashesString);
+    std::string name;
+    std::string hash;
+    while (lines >> name >> hash)
+    {
+        hashes[name] = hash;
+    }
+    return hashes;
+}
+}  // anonymous namespace
+
 class CaptureReplayTests
 {
   public:
@@ -149,9 +178,22 @@ class CaptureReplayTests
         {
             mTraceLibrary->replayFrame(frame);
 
-            const GLubyte *bytes = glGetString(GL_SERIALIZED_CONTEXT_STRING_ANGLE);
+            const char *capturedState = mTraceLibrary->getSerializedContextState(frame);
+            const bool compareHashes  = IsSerializedContextHashes(capturedState);
+
+            const GLubyte *bytes = glGetString(compareHashes
+                                                   ? GL_SERIALIZED_CONTEXT_HASHES_STRING_ANGLE
+                                                   : GL_SERIALIZED_CONTEXT_STRING_ANGLE);
             bool isEqual =
                 compareSerializedContexts(testIndex, frame, reinterpret_cast<const char *>(bytes));
+            if (!isEqual && compareHashes)
+            {
+                // Only the hashes were captured, so name the objects that differ and write the
+                // full replayed state, before the swap changes it, for them to be looked at.
+                printDifferingObjects(testTraceInfo, frame, reinterpret_cast<const char *>(bytes),
+                                      capturedState);
+                bytes = glGetString(GL_SERIALIZED_CONTEXT_STRING_ANGLE);
+            }
             // Swap always to allow RenderDoc/other tools to capture frames.
             swap();
             if (!isEqual)
@@ -162,10 +204,11 @@ class CaptureReplayTests
                 debugReplay << reinterpret_cast<const char *>(bytes) << "\n";
 
                 std::ostringstream captureName;
-                captureName << testTraceInfo.testName << "_ContextCaptured" << frame << ".json";
+                captureName << testTraceInfo.testName << "_ContextCaptured" << frame
+                            << (compareHashes ? ".txt" : ".json");
                 std::ofstream debugCapture(captureName.str());
 
-                debugCapture << mTraceLibrary->getSerializedContextState(frame) << "\n";
+                debugCapture << capturedState << "\n";
 
                 cleanupTest();
                 return -1;
@@ -195,6 +238,40 @@ class CaptureReplayTests
                        mTraceLibrary->getSerializedContextState(frame));
     }
 
+    void printDifferingObjects(const TestTraceInfo &testTraceInfo,
+                               uint32_t frame,
+                               const char *replayHashesString,
+                               const char *captureHashesString)
+    {
+        std::map<std::string, std::string> replayHashes =
+            ParseSerializedContextHashes(replayHashesString);
+        std::map<std::string, std::string> captureHashes =
+            ParseSerializedContextHashes(captureHashesString);
+
+        for (const auto &nameAndHash : captureHashes)
+        {
+            auto replayHash = replayHashes.find(nameAndHash.first);
+            if (replayHash == replayHashes.end())
+            {
+                std::cout << testTraceInfo.testName << " frame " << frame << ": "
+                          << nameAndHash.first << " is missing from the replay\n";
+            }
+            else if (replayHash->second != nameAndHash.second)
+            {
+                std::cout << testTraceInfo.testName << " frame " << frame << ": "
+                          << nameAndHash.first << " differs\n";
+            }
+        }
+        for (const auto &nameAndHash : replayHashes)
+        {
+            if (captureHashes.count(nameAndHash.first) == 0)
+            {
+                std::cout << testTraceInfo.testName << " frame " << frame << ": "
+                          << nameAndHash.first << " is missing from the capture\n";
+            }
+        }
+    }
+
     std::string mStartingDirectory;
     OSWindow *mOSWindow   = nullptr;
     EGLWindow *mEGLWindow = nullptr;
@@ -177,6 +177,40 @@ TEST_F(DebugShaderPrecisionTest, NonSquareMatrixRoundingFunctionsDefinedES3)
     ASSERT_TRUE(foundInHLSLCode("float4x3 angle_frl(float4x3"));
 }
 
+// Test that ESSL 1.00 shaders round to mediump with exp2 and log2, and don't use the float bit
+// encoding functions that only ESSL 3.00 and GLSL 3.30 have.
+TEST_F(DebugShaderPrecisionTest, RoundingWithoutBitOperationsES2)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "void main() {\n"
+        "   gl_FragColor = vec4(u);\n"
+        "}\n";
+    compile(shaderString);
+    ASSERT_TRUE(foundInAllGLSLCode("exp2(exponent)"));
+    ASSERT_TRUE(notFoundInCode("floatBitsToUint"));
+    ASSERT_TRUE(foundInHLSLCode("asuint(v)"));
+}
+
+// Test that ESSL 3.00 shaders round to mediump by masking the bits of the floats.
+TEST_F(DebugShaderPrecisionTest, RoundingWithBitOperationsES3)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "   my_FragColor = vec4(u);\n"
+        "}\n";
+    compile(shaderString);
+    ASSERT_TRUE(foundInESSLCode("highp uint bits = floatBitsToUint(x);"));
+    ASSERT_TRUE(foundInESSLCode("highp uvec4 bits = floatBitsToUint(v);"));
+    ASSERT_TRUE(foundInESSLCode("uintBitsToFloat(bits & 0xffffe000u)"));
+    ASSERT_TRUE(foundInHLSLCode("asfloat(bits & 0xffffe000u)"));
+}
+
 TEST_F(DebugShaderPrecisionTest, PragmaDisablesEmulation)
 {
     const std::string &shaderString =
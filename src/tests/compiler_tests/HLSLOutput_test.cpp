@@ -135,6 +135,51 @@ TEST_F(HLSLOutputTest, VectorDynamicIndexing)
     compile(shaderString);
 }
 
+// Test that the helper functions for dynamic indexing select the field with a binary search
+// instead of comparing the index against every field.
+TEST_F(HLSLOutputTest, VectorDynamicIndexingUsesBinarySearch)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        out vec4 outColor;
+        uniform int i;
+        void main()
+        {
+            vec4 foo = vec4(0.0, 0.0, 0.0, 1.0);
+            foo[i] = foo[i + 1];
+            outColor = foo;
+        })";
+    compile(shaderString);
+    EXPECT_TRUE(notFoundInCode("switch"));
+    // Both the read and the write helper compare against the middle index, and then against one
+    // index on either side.
+    EXPECT_TRUE(foundInCode("(index < 2)", 2));
+    EXPECT_TRUE(foundInCode("(index < 1)", 2));
+    EXPECT_TRUE(foundInCode("(index < 3)", 2));
+}
+
+// Test dynamic indexing of a matrix column, which is written and read.
+TEST_F(HLSLOutputTest, MatrixDynamicIndexing)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        out vec4 outColor;
+        uniform int i;
+        uniform mat3 m;
+        void main()
+        {
+            mat3 foo = m;
+            foo[i] += foo[i - 1];
+            outColor = vec4(foo[i], 1.0);
+        })";
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("dyn_index_mat3x3("));
+    EXPECT_TRUE(foundInCode("dyn_index_write_mat3x3("));
+    EXPECT_TRUE(notFoundInCode("switch"));
+}
+
 // Test returning an array from a user-defined function. This makes sure that function symbols are
 // changed consistently when the user-defined function is changed to have an array out parameter.
 TEST_F(HLSLOutputTest, ArrayReturnValue)
@@ -256,3 +301,51 @@ void main()
     compile(shaderString);
     EXPECT_FALSE(foundInCode("map_instances"));
 }
+
+// Test that a uniform block with a large array of a matrix type that std140 pads is translated to a
+// StructuredBuffer of the padded matrix, the elements of which are truncated back when accessed.
+TEST_F(HLSLOutputTest, PaddedMatrixArrayInStructuredBuffer)
+{
+    constexpr char shaderString[] = R"(#version 300 es
+precision highp float;
+out vec4 my_FragColor;
+
+layout(std140) uniform BoneBlock
+{
+    mat3 bones[64];
+};
+
+void main()
+{
+    int index = int(gl_FragCoord.x);
+    my_FragColor = vec4(bones[index][1], 1.0);
+})";
+
+    compile(shaderString, SH_ALLOW_TRANSLATE_UNIFORM_BLOCK_TO_STRUCTUREDBUFFER);
+    EXPECT_TRUE(foundInCode("row_major float3x4 _bones;"));
+    EXPECT_TRUE(foundInCode("StructuredBuffer <pack_BoneBlock>"));
+    EXPECT_TRUE(foundInCode("((float3x3)_bones["));
+}
+
+// Test that a padded row-major matrix array is translated to a StructuredBuffer as well.
+TEST_F(HLSLOutputTest, PaddedRowMajorMatrixArrayInStructuredBuffer)
+{
+    constexpr char shaderString[] = R"(#version 300 es
+precision highp float;
+out vec4 my_FragColor;
+
+layout(std140, row_major) uniform BoneBlock
+{
+    mat2x3 bones[64];
+};
+
+void main()
+{
+    int index = int(gl_FragCoord.x);
+    my_FragColor = vec4(bones[index][1], 1.0);
+})";
+
+    compile(shaderString, SH_ALLOW_TRANSLATE_UNIFORM_BLOCK_TO_STRUCTUREDBUFFER);
+    EXPECT_TRUE(foundInCode("column_major float4x3 _bones;"));
+    EXPECT_TRUE(foundInCode("((float2x3)_bones["));
+}
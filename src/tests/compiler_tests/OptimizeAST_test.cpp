@@ -0,0 +1,207 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeAST_test.cpp:
+//   Tests for the optional AST optimizations enabled by SH_OPTIMIZE_AST.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+class OptimizeASTTest : public MatchOutputCodeTest
+{
+  public:
+    OptimizeASTTest() : MatchOutputCodeTest(GL_FRAGMENT_SHADER, SH_OPTIMIZE_AST, SH_ESSL_OUTPUT) {}
+};
+
+// Test that a local variable initialized with a constant and never written is replaced with the
+// constant.
+TEST_F(OptimizeASTTest, ConstantLocalIsPropagated)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform vec4 u;
+        void main()
+        {
+            float myScale = 2.0;
+            gl_FragColor = u * myScale;
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("myScale"));
+}
+
+// Test that constant locals are not propagated without SH_OPTIMIZE_AST.
+TEST_F(OptimizeASTTest, ConstantLocalIsKeptWithoutOption)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform vec4 u;
+        void main()
+        {
+            float myScale = 2.0;
+            gl_FragColor = u * myScale;
+        })";
+    compile(shaderString, 0);
+
+    ASSERT_TRUE(foundInCode("myScale"));
+}
+
+// Test that a local variable that is written after its initialization is not propagated.
+TEST_F(OptimizeASTTest, WrittenLocalIsNotPropagated)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform vec4 u;
+        void main()
+        {
+            float myScale = 2.0;
+            if (u.x > 0.0)
+            {
+                myScale = u.y;
+            }
+            gl_FragColor = u * myScale;
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("myScale"));
+}
+
+// Test that a local variable passed as an out parameter is not propagated.
+TEST_F(OptimizeASTTest, OutParameterIsNotPropagated)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform vec4 u;
+        void getScale(out float scale)
+        {
+            scale = u.x;
+        }
+        void main()
+        {
+            float myScale = 2.0;
+            getScale(myScale);
+            gl_FragColor = u * myScale;
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("myScale"));
+}
+
+// Test that a branch made constant by propagation is pruned, keeping the taken block.
+TEST_F(OptimizeASTTest, ConstantBranchIsPruned)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform vec4 u;
+        void main()
+        {
+            bool myUseRed = false;
+            if (myUseRed)
+            {
+                gl_FragColor = vec4(0.25);
+            }
+            else
+            {
+                gl_FragColor = u;
+            }
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("myUseRed"));
+    ASSERT_TRUE(notFoundInCode("0.25"));
+    ASSERT_TRUE(foundInCode("gl_FragColor = _uu"));
+}
+
+// Test that statements after a return are pruned.
+TEST_F(OptimizeASTTest, StatementAfterReturnIsPruned)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform vec4 u;
+        void main()
+        {
+            if (u.x > 0.0)
+            {
+                gl_FragColor = u;
+                return;
+                gl_FragColor = vec4(0.25);
+            }
+            gl_FragColor = vec4(0.75);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("0.25"));
+    ASSERT_TRUE(foundInCode("0.75"));
+}
+
+// Test that the cases that follow a break in a switch statement are kept.
+TEST_F(OptimizeASTTest, CaseAfterBreakIsKept)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform int u;
+        out vec4 color;
+        void main()
+        {
+            switch (u)
+            {
+                case 0:
+                    color = vec4(0.25);
+                    break;
+                case 1:
+                    color = vec4(0.75);
+                    break;
+            }
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("0.25"));
+    ASSERT_TRUE(foundInCode("0.75"));
+}
+
+// Test that stores to a local variable that is never read are removed along with the variable.
+TEST_F(OptimizeASTTest, DeadStoresAreRemoved)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform vec4 u;
+        void main()
+        {
+            vec4 myUnread;
+            myUnread = u;
+            myUnread.x += 1.0;
+            gl_FragColor = u;
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("myUnread"));
+}
+
+// Test that a store with side effects to a local variable that is never read is kept.
+TEST_F(OptimizeASTTest, StoreWithSideEffectsIsKept)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform vec4 u;
+        vec4 sideEffect()
+        {
+            gl_FragColor = u;
+            return u;
+        }
+        void main()
+        {
+            vec4 myUnread;
+            myUnread = sideEffect();
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("sideEffect()"));
+}
@@ -101,6 +101,25 @@ TEST_F(ShCompileComputeTest, ComputeShaderString)
     testCompile(shaderStrings, 1, true);
 }
 
+// Test that SH_LOG_PASS_TIMINGS writes the time spent in the translator passes to the info log.
+TEST_F(ShCompileTest, LogPassTimings)
+{
+    const char *shaderString =
+        "precision mediump float;\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(0.0);\n"
+        "}";
+
+    EXPECT_TRUE(sh::Compile(mCompiler, &shaderString, 1, SH_OBJECT_CODE | SH_LOG_PASS_TIMINGS));
+    const std::string &compileLog = sh::GetInfoLog(mCompiler);
+    EXPECT_NE(std::string::npos, compileLog.find("Pass timings:")) << compileLog;
+    EXPECT_NE(std::string::npos, compileLog.find("PruneNoOps: ")) << compileLog;
+    EXPECT_NE(std::string::npos, compileLog.find("translate: ")) << compileLog;
+
+    EXPECT_TRUE(sh::Compile(mCompiler, &shaderString, 1, SH_OBJECT_CODE));
+    EXPECT_EQ(std::string::npos, sh::GetInfoLog(mCompiler).find("Pass timings:"));
+}
+
 // Test calling sh::Compile with more than one shader source string.
 TEST_F(ShCompileTest, MultipleShaderStrings)
 {
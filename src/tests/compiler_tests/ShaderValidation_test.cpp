@@ -5024,6 +5024,34 @@ TEST_F(VertexShaderValidationTest, UseLocationOnVertexOutES31)
     }
 }
 
+// Test that the validation of varying locations and of fragment outputs, which run in the same
+// traversal, both report their errors.
+TEST_F(FragmentShaderValidationTest, ConflictingVaryingAndOutputLocationsInES31)
+{
+    const std::string &shaderString =
+        "#version 310 es\n"
+        "precision mediump float;\n"
+        "layout (location = 0) in vec4 v_color1;\n"
+        "layout (location = 0) in vec4 v_color2;\n"
+        "layout (location = 0) out vec4 o_color1;\n"
+        "layout (location = 0) out vec4 o_color2;\n"
+        "void main()\n"
+        "{\n"
+        "    o_color1 = v_color1;\n"
+        "    o_color2 = v_color2;\n"
+        "}\n";
+
+    if (compile(shaderString))
+    {
+        FAIL() << "Shader compilation succeeded, expecting failure:\n" << mInfoLog;
+    }
+    EXPECT_NE(std::string::npos, mInfoLog.find("'v_color2' conflicting location with 'v_color1'"))
+        << mInfoLog;
+    EXPECT_NE(std::string::npos,
+              mInfoLog.find("conflicting output locations with previously defined output"))
+        << mInfoLog;
+}
+
 // Test that it isn't allowed to use 'location' layout qualifier on GLSL ES 3.0 fragment shader
 // inputs.
 TEST_F(FragmentShaderValidationTest, UseLocationOnFragmentInES30)
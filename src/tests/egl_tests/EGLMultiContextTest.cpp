@@ -232,6 +232,44 @@ void main()
         eglDestroyContext(dpy, ctx[t]);
     }
 }
+
+// Test that the shader compilers left behind by destroyed contexts are only reused by contexts of
+// the same client version.
+TEST_P(EGLMultiContextTest, CompilersOfDestroyedContexts)
+{
+    EGLWindow *window = getEGLWindow();
+    EGLDisplay dpy    = window->getDisplay();
+    EGLConfig config  = window->getConfig();
+
+    EGLint pbufferAttributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE, EGL_NONE};
+    EGLSurface surface         = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+    EXPECT_EGL_SUCCESS();
+
+    constexpr char kVS[] = R"(#version 300 es
+void main()
+{
+    gl_Position = vec4(0);
+})";
+
+    for (EGLint clientVersion : {3, 2, 3, 2})
+    {
+        const EGLint contextAttributes[] = {EGL_CONTEXT_MAJOR_VERSION, clientVersion, EGL_NONE};
+        EGLContext context = eglCreateContext(dpy, config, EGL_NO_CONTEXT, contextAttributes);
+        ASSERT_NE(EGL_NO_CONTEXT, context);
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surface, surface, context));
+
+        // ESSL 3.00 shaders are only accepted by ES 3 contexts.
+        GLuint shader = CompileShader(GL_VERTEX_SHADER, kVS);
+        EXPECT_EQ(clientVersion >= 3, shader != 0u);
+        glDeleteShader(shader);
+        EXPECT_GL_NO_ERROR();
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+        EXPECT_EGL_TRUE(eglDestroyContext(dpy, context));
+    }
+
+    eglDestroySurface(dpy, surface);
+}
 }  // anonymous namespace
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLMultiContextTest);
@@ -267,3 +267,76 @@ ANGLE_INSTANTIATE_TEST(EGLProgramCacheControlTest,
                        ES2_D3D11(),
                        ES2_OPENGL(),
                        ES2_VULKAN());
+
+class EGLProgramCacheControlTranslatedShadersTest : public EGLProgramCacheControlTest
+{};
+
+// Tests that compiled shaders are stored next to the program, and that compiling the same sources
+// again loads them from the cache.
+TEST_P(EGLProgramCacheControlTranslatedShadersTest, CompileSameSourceTwice)
+{
+    ANGLE_SKIP_TEST_IF(!extensionAvailable() || !programBinaryAvailable());
+
+    constexpr char kVS[] =
+        "attribute vec4 position; varying vec4 color; uniform vec4 u;\n"
+        "void main() { gl_Position = position; color = u; }";
+    constexpr char kFS[] =
+        "precision mediump float; varying vec4 color;\n"
+        "void main() { gl_FragColor = color; }";
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    // The program and both of its shaders miss the cache.
+    {
+        ANGLE_GL_PROGRAM(program, kVS, kFS);
+        glUseProgram(program);
+        glUniform4f(glGetUniformLocation(program, "u"), 1.0f, 0.0f, 0.0f, 1.0f);
+        drawQuad(program, "position", 0.5f);
+        EXPECT_GL_NO_ERROR();
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    }
+
+    EXPECT_EQ(3, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_SIZE_ANGLE));
+
+    // Compiling the same sources hits the cache, and the reflection data is restored.
+    GLShader vs(GL_VERTEX_SHADER);
+    GLShader fs(GL_FRAGMENT_SHADER);
+    const char *vsSource = kVS;
+    const char *fsSource = kFS;
+    glShaderSource(vs, 1, &vsSource, nullptr);
+    glShaderSource(fs, 1, &fsSource, nullptr);
+    glCompileShader(vs);
+    glCompileShader(fs);
+
+    GLint compileStatus = 0;
+    glGetShaderiv(vs, GL_COMPILE_STATUS, &compileStatus);
+    EXPECT_GL_TRUE(compileStatus);
+    glGetShaderiv(fs, GL_COMPILE_STATUS, &compileStatus);
+    EXPECT_GL_TRUE(compileStatus);
+
+    EXPECT_EQ(3, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_SIZE_ANGLE));
+
+    // Link a different program from the cached shaders so the program cache doesn't hide them.
+    GLProgram program;
+    program.makeEmpty();
+    glBindAttribLocation(program, 1, "position");
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+    ASSERT_GL_NO_ERROR();
+
+    GLint linkStatus = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    ASSERT_GL_TRUE(linkStatus);
+    EXPECT_EQ(1, glGetAttribLocation(program, "position"));
+
+    glUseProgram(program);
+    glUniform4f(glGetUniformLocation(program, "u"), 0.0f, 1.0f, 0.0f, 1.0f);
+    drawQuad(program, "position", 0.5f);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLProgramCacheControlTranslatedShadersTest);
+ANGLE_INSTANTIATE_TEST(EGLProgramCacheControlTranslatedShadersTest,
+                       WithCacheTranslatedShaders(ES2_VULKAN()));
@@ -1298,6 +1298,60 @@ TEST_P(EGLSurfaceTest, RobustResourceInitAndEmulatedAlpha)
         eglSwapBuffers(mDisplay, mWindowSurface);
     }
 }
+
+// Verify that a pbuffer created right after destroying one of the same size and format is
+// initialized by robust resource init, rather than showing the contents of the destroyed one.
+TEST_P(EGLSurfaceTest, RecreatedPbufferWithRobustResourceInit)
+{
+    initializeDisplay();
+    ASSERT_NE(mDisplay, EGL_NO_DISPLAY);
+
+    ANGLE_SKIP_TEST_IF(
+        !IsEGLDisplayExtensionEnabled(mDisplay, "EGL_ANGLE_robust_resource_initialization"));
+
+    constexpr EGLint kConfigAttributes[] = {EGL_RED_SIZE,     8,
+                                            EGL_GREEN_SIZE,   8,
+                                            EGL_BLUE_SIZE,    8,
+                                            EGL_ALPHA_SIZE,   8,
+                                            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                                            EGL_NONE};
+    ANGLE_SKIP_TEST_IF(EGLWindow::FindEGLConfig(mDisplay, kConfigAttributes, &mConfig) ==
+                       EGL_FALSE);
+
+    initializeSingleContext(&mContext);
+    ASSERT_NE(mContext, EGL_NO_CONTEXT);
+
+    constexpr EGLint kPbufferAttributes[] = {EGL_WIDTH,
+                                             16,
+                                             EGL_HEIGHT,
+                                             16,
+                                             EGL_ROBUST_RESOURCE_INITIALIZATION_ANGLE,
+                                             EGL_TRUE,
+                                             EGL_NONE};
+
+    // Fill a pbuffer with red and destroy it.
+    EGLSurface firstPbuffer = eglCreatePbufferSurface(mDisplay, mConfig, kPbufferAttributes);
+    ASSERT_EGL_SUCCESS();
+    ASSERT_NE(EGL_NO_SURFACE, firstPbuffer);
+
+    EXPECT_EGL_TRUE(eglMakeCurrent(mDisplay, firstPbuffer, firstPbuffer, mContext));
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    EXPECT_EGL_TRUE(eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, mContext));
+    EXPECT_EGL_TRUE(eglDestroySurface(mDisplay, firstPbuffer));
+
+    // A new pbuffer of the same size may reuse the memory of the destroyed one.
+    mPbufferSurface = eglCreatePbufferSurface(mDisplay, mConfig, kPbufferAttributes);
+    ASSERT_EGL_SUCCESS();
+    ASSERT_NE(EGL_NO_SURFACE, mPbufferSurface);
+
+    EXPECT_EGL_TRUE(eglMakeCurrent(mDisplay, mPbufferSurface, mPbufferSurface, mContext));
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::transparentBlack);
+    EXPECT_PIXEL_COLOR_EQ(15, 15, GLColor::transparentBlack);
+    ASSERT_GL_NO_ERROR();
+}
 }  // anonymous namespace
 
 ANGLE_INSTANTIATE_TEST(EGLSurfaceTest,
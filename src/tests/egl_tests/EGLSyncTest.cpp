@@ -423,6 +423,58 @@ TEST_P(EGLSyncTest, AndroidNativeFence_WaitSync)
     EXPECT_EGL_TRUE(eglDestroySyncKHR(display, syncWithGeneratedFD));
 }
 
+// Verify WaitSync with EGL_ANDROID_native_fence_sync on a sync object of another context, without
+// its FD ever being duplicated, and that the FD can still be duplicated afterwards.
+TEST_P(EGLSyncTest, AndroidNativeFence_WaitSyncAcrossContexts)
+{
+    ANGLE_SKIP_TEST_IF(!hasFenceSyncExtension());
+    ANGLE_SKIP_TEST_IF(!hasWaitSyncExtension() || !hasGLSyncExtension());
+    ANGLE_SKIP_TEST_IF(!hasAndroidNativeFenceSyncExtension());
+
+    EGLint value       = 0;
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    EGLSurface surface = getEGLWindow()->getSurface();
+
+    // Create work to do
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    EGLSyncKHR sync = eglCreateSyncKHR(display, EGL_SYNC_NATIVE_FENCE_ANDROID, nullptr);
+    EXPECT_NE(sync, EGL_NO_SYNC_KHR);
+
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+
+    EGLContext context2 = getEGLWindow()->createContext(EGL_NO_CONTEXT);
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, surface, surface, context2));
+
+    // The second context's work waits for the first context's.
+    EXPECT_EGL_TRUE(eglWaitSyncKHR(display, sync, 0));
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    EXPECT_EQ(EGL_CONDITION_SATISFIED,
+              eglClientWaitSyncKHR(display, sync, EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, 1000000000));
+    EXPECT_EGL_TRUE(eglGetSyncAttribKHR(display, sync, EGL_SYNC_STATUS_KHR, &value));
+    EXPECT_EQ(value, EGL_SIGNALED_KHR);
+
+    // The FD can be requested after waiting.  Can return -1 (when signaled) or valid FD.
+    int fd = eglDupNativeFenceFDANDROID(display, sync);
+    EXPECT_EGL_SUCCESS();
+    if (fd > EGL_NO_NATIVE_FENCE_FD_ANDROID)
+    {
+        close(fd);
+    }
+
+    // Reset to default context and surface.
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, surface, surface, getEGLWindow()->getContext()));
+
+    // Clean up created objects.
+    EXPECT_EGL_TRUE(eglDestroySyncKHR(display, sync));
+    EXPECT_EGL_TRUE(eglDestroyContext(display, context2));
+}
+
 // Verify EGL_ANDROID_native_fence_sync
 // Simulate passing FDs across processes by passing across Contexts.
 TEST_P(EGLSyncTest, AndroidNativeFence_withFences)
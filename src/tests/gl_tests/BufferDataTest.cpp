@@ -913,6 +913,47 @@ void main()
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::cyan);
 }
 
+// Ensures that mapping part of a buffer with GL_MAP_INVALIDATE_BUFFER_BIT writes to the right
+// offset and keeps the size of the buffer.
+TEST_P(BufferDataTestES3, MapInvalidateBufferSubRange)
+{
+    constexpr size_t kBufferSize = 64;
+    constexpr size_t kMapOffset  = 16;
+    constexpr size_t kMapSize    = 32;
+
+    std::vector<uint8_t> initialData(kBufferSize, 0);
+    std::vector<uint8_t> updateData(kMapSize);
+    for (size_t i = 0; i < kMapSize; ++i)
+    {
+        updateData[i] = static_cast<uint8_t>(i + 1);
+    }
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, kBufferSize, initialData.data(), GL_DYNAMIC_DRAW);
+
+    void *mappedBuffer = glMapBufferRange(GL_ARRAY_BUFFER, kMapOffset, kMapSize,
+                                          GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    ASSERT_NE(nullptr, mappedBuffer);
+    memcpy(mappedBuffer, updateData.data(), kMapSize);
+    EXPECT_GL_TRUE(glUnmapBuffer(GL_ARRAY_BUFFER));
+    EXPECT_GL_NO_ERROR();
+
+    GLint bufferSize = 0;
+    glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &bufferSize);
+    EXPECT_EQ(static_cast<GLint>(kBufferSize), bufferSize);
+
+    const uint8_t *readBuffer = static_cast<const uint8_t *>(
+        glMapBufferRange(GL_ARRAY_BUFFER, kMapOffset, kMapSize, GL_MAP_READ_BIT));
+    ASSERT_NE(nullptr, readBuffer);
+    for (size_t i = 0; i < kMapSize; ++i)
+    {
+        EXPECT_EQ(updateData[i], readBuffer[i]);
+    }
+    EXPECT_GL_TRUE(glUnmapBuffer(GL_ARRAY_BUFFER));
+    EXPECT_GL_NO_ERROR();
+}
+
 class BufferStorageTestES3 : public BufferDataTest
 {};
 
@@ -892,6 +892,42 @@ TEST_P(CopyTextureTest, CopySubTextureOffset)
     EXPECT_GL_NO_ERROR();
 }
 
+// Test that flipping a CopySubTexture between textures of the same format only flips the copied
+// region
+TEST_P(CopyTextureTest, CopySubTextureOffsetFlipY)
+{
+    if (!checkExtensions())
+    {
+        return;
+    }
+
+    GLColor rgbaPixels[2 * 2] = {GLColor::red, GLColor::green, GLColor::blue, GLColor::black};
+    glBindTexture(GL_TEXTURE_2D, mTextures[0]);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgbaPixels);
+
+    std::vector<GLColor> transparentPixels(4 * 4, GLColor::transparentBlack);
+    glBindTexture(GL_TEXTURE_2D, mTextures[1]);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                 transparentPixels.data());
+
+    // Check that FB is complete.
+    EXPECT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    glCopySubTextureCHROMIUM(mTextures[0], 0, GL_TEXTURE_2D, mTextures[1], 0, 2, 2, 0, 0, 2, 2,
+                             true, false, false);
+    EXPECT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(2, 2, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(3, 2, GLColor::black);
+    EXPECT_PIXEL_COLOR_EQ(2, 3, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(3, 3, GLColor::green);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::transparentBlack);
+    EXPECT_PIXEL_COLOR_EQ(1, 3, GLColor::transparentBlack);
+    EXPECT_PIXEL_COLOR_EQ(3, 1, GLColor::transparentBlack);
+    EXPECT_GL_NO_ERROR();
+}
+
 // Test every combination of copy [sub]texture parameters:
 // source: ALPHA, RGB, RGBA, LUMINANCE, LUMINANCE_ALPHA, BGRA_EXT
 // destination: RGB, RGBA, BGRA_EXT
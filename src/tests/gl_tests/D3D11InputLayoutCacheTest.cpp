@@ -72,6 +72,7 @@ TEST_P(D3D11InputLayoutCacheTest, StressTest)
 
     // Clamp the cache size to something tiny
     inputLayoutCache->setCacheSize(4);
+    uint64_t evictionCount = inputLayoutCache->getCacheStats().getEvictionCount();
 
     GLint maxAttribs = 0;
     context->getIntegerv(GL_MAX_VERTEX_ATTRIBS, &maxAttribs);
@@ -115,6 +116,9 @@ TEST_P(D3D11InputLayoutCacheTest, StressTest)
         }
     }
 
+    // The thrashing should show up in the cache stats.
+    EXPECT_GT(inputLayoutCache->getCacheStats().getEvictionCount(), evictionCount);
+
     for (GLuint program : programs)
     {
         glDeleteProgram(program);
@@ -1827,6 +1827,51 @@ TEST_P(ImageTest, SourceAHBTarget2DEarlyDelete)
     eglDestroyImageKHR(window->getDisplay(), image);
 }
 
+// Testing that an EGL image recreated from the same AHB sees the data written to the AHB after the
+// previous EGL image was destroyed.
+TEST_P(ImageTest, SourceAHBTarget2DRecreateAfterWrite)
+{
+    ANGLE_SKIP_TEST_IF(!IsAndroid());
+
+    EGLWindow *window = getEGLWindow();
+
+    ANGLE_SKIP_TEST_IF(!hasOESExt() || !hasBaseExt() || !has2DTextureExt());
+    ANGLE_SKIP_TEST_IF(!hasAndroidImageNativeBufferExt() || !hasAndroidHardwareBufferSupport());
+
+    GLubyte firstData[4]  = {7, 51, 197, 231};
+    GLubyte secondData[4] = {231, 197, 51, 7};
+
+    AHardwareBuffer *source;
+    EGLImageKHR image;
+    createEGLImageAndroidHardwareBufferSource(1, 1, 1, AHARDWAREBUFFER_FORMAT_R8G8B8A8_UNORM,
+                                              kDefaultAttribs, {{firstData, 4}}, &source, &image);
+
+    GLuint target;
+    createEGLImageTargetTexture2D(image, &target);
+    verifyResults2D(target, firstData);
+
+    glDeleteTextures(1, &target);
+    eglDestroyImageKHR(window->getDisplay(), image);
+    glFinish();
+
+#if defined(ANGLE_AHARDWARE_BUFFER_SUPPORT)
+    writeAHBData(source, 1, 1, 1, false, {{secondData, 4}});
+#endif
+
+    image = eglCreateImageKHR(window->getDisplay(), EGL_NO_CONTEXT, EGL_NATIVE_BUFFER_ANDROID,
+                              angle::android::AHardwareBufferToClientBuffer(source),
+                              kDefaultAttribs);
+    ASSERT_EGL_SUCCESS();
+
+    createEGLImageTargetTexture2D(image, &target);
+    verifyResults2D(target, secondData);
+
+    // Clean up
+    glDeleteTextures(1, &target);
+    eglDestroyImageKHR(window->getDisplay(), image);
+    destroyAndroidHardwareBuffer(source);
+}
+
 // Testing source AHB EGL image, target 2D texture
 TEST_P(ImageTest, SourceAHBTarget2D)
 {
@@ -428,6 +428,36 @@ TEST_P(IndexBufferOffsetTest, DrawWithDifferentCountsSameOffset)
     EXPECT_GL_NO_ERROR();
 }
 
+// Test drawing with UInt8 indices at an offset that were only written in GPU memory, and so may be
+// translated without reading them back.
+TEST_P(IndexBufferOffsetTestES3, UInt8IndexCopiedOnGPU)
+{
+    GLubyte indexData[] = {99, 0, 1, 2, 1, 2, 3};
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    GLBuffer sourceBuffer;
+    glBindBuffer(GL_COPY_READ_BUFFER, sourceBuffer);
+    glBufferData(GL_COPY_READ_BUFFER, sizeof(indexData), indexData, GL_STATIC_DRAW);
+
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indexData), nullptr, GL_STATIC_DRAW);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_ELEMENT_ARRAY_BUFFER, 0, 0, sizeof(indexData));
+
+    glUseProgram(mProgram);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glVertexAttribPointer(mPositionAttributeLocation, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(mPositionAttributeLocation);
+
+    glUniform4f(mColorUniformLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, reinterpret_cast<void *>(1));
+
+    EXPECT_PIXEL_COLOR_EQ(0, getWindowHeight() / 4, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, getWindowHeight() - 1, GLColor::red);
+
+    EXPECT_GL_NO_ERROR();
+}
+
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(IndexBufferOffsetTest);
 
 ANGLE_INSTANTIATE_TEST_ES3(IndexBufferOffsetTestES3);
@@ -219,6 +219,37 @@ TEST_P(LineLoopTest, LineLoopUIntIndexBuffer)
     runTest(GL_UNSIGNED_INT, buf, reinterpret_cast<const void *>(sizeof(GLuint)));
 }
 
+// Test that a line loop drawn from an index buffer picks up changes to its indices.
+TEST_P(LineLoopTest, LineLoopUShortIndexBufferUpdatedBetweenDraws)
+{
+    // Disable D3D11 SDK Layers warnings checks, see ANGLE issue 667 for details
+    ignoreD3D11SDKLayersWarnings();
+
+    static const GLushort degenerateIndices[] = {0, 1, 2, 3, 4, 0};
+    static const GLushort indices[]           = {0, 7, 6, 9, 8, 0};
+    static const GLfloat positions[]          = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+                                                 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+
+    GLBuffer buf;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(degenerateIndices), degenerateIndices,
+                 GL_STATIC_DRAW);
+
+    // Draw the same range of the buffer before its indices are updated.
+    glUseProgram(mProgram);
+    glEnableVertexAttribArray(mPositionLocation);
+    glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, positions);
+    glDrawElements(GL_LINE_LOOP, 4, GL_UNSIGNED_SHORT,
+                   reinterpret_cast<const void *>(sizeof(GLushort)));
+    ASSERT_GL_NO_ERROR();
+
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(indices), indices);
+
+    // Draw twice, so the second draw can reuse the converted loop of the first.
+    runTest(GL_UNSIGNED_SHORT, buf, reinterpret_cast<const void *>(sizeof(GLushort)));
+    runTest(GL_UNSIGNED_SHORT, buf, reinterpret_cast<const void *>(sizeof(GLushort)));
+}
+
 class LineLoopTestES3 : public LineLoopTest
 {};
 
@@ -305,6 +336,26 @@ TEST_P(LineLoopTestES3, UseAsUBOThenUpdateThenLineLoopUIntIndexBuffer)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
 }
 
+// Test line loop elements that are only written on the GPU, by a buffer copy.
+TEST_P(LineLoopTestES3, LineLoopUByteIndexBufferWrittenByCopy)
+{
+    // Disable D3D11 SDK Layers warnings checks, see ANGLE issue 667 for details
+    ignoreD3D11SDKLayersWarnings();
+
+    static const GLubyte indices[] = {0, 7, 6, 9, 8, 0, 0, 0};
+
+    GLBuffer sourceBuf;
+    glBindBuffer(GL_COPY_READ_BUFFER, sourceBuf);
+    glBufferData(GL_COPY_READ_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+    GLBuffer buf;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), nullptr, GL_STATIC_DRAW);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_ELEMENT_ARRAY_BUFFER, 0, 0, sizeof(indices));
+
+    runTest(GL_UNSIGNED_BYTE, buf, reinterpret_cast<const void *>(sizeof(GLubyte)));
+}
+
 // Tests an edge case with a very large line loop element count.
 // Disabled because it is slow and triggers an internal error.
 TEST_P(LineLoopTest, DISABLED_DrawArraysWithLargeCount)
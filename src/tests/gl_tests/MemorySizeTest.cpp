@@ -130,6 +130,37 @@ TEST_P(MemorySizeTest, BasicUsageRenderbuffer)
     EXPECT_GT(result, 0);
 }
 
+// Test the memory budget queries.  The usage is only bounded by the budget when there is one.
+TEST_P(MemorySizeTest, MemoryBudget)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_memory_size"));
+    ANGLE_SKIP_TEST_IF(getClientMajorVersion() < 3);
+
+    GLint64 budget = -1;
+    glGetInteger64v(GL_MEMORY_BUDGET_ANGLE, &budget);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_GE(budget, 0);
+
+    GLint64 usage = -1;
+    glGetInteger64v(GL_MEMORY_USAGE_ANGLE, &usage);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_GE(usage, 0);
+
+    // The budget is updated when commands are submitted.
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 256, 256);
+    glFinish();
+
+    glGetInteger64v(GL_MEMORY_BUDGET_ANGLE, &budget);
+    glGetInteger64v(GL_MEMORY_USAGE_ANGLE, &usage);
+    EXPECT_GL_NO_ERROR();
+    if (budget > 0)
+    {
+        EXPECT_GT(usage, 0);
+    }
+}
+
 // No errors specific to GL_ANGLE_memory_size to test for.
 
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these
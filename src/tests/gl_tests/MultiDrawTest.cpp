@@ -489,6 +489,26 @@ TEST_P(MultiDrawTest, MultiDrawElements)
     CheckDrawResult();
 }
 
+// Tests that glMultiDrawElementsANGLE draws from its own offsets into an index buffer that a
+// previous draw used with a different offset
+TEST_P(MultiDrawTest, MultiDrawElementsAfterDrawElementsWithOffset)
+{
+    ANGLE_SKIP_TEST_IF(!requestExtensions());
+    SetupBuffers();
+    SetupProgram();
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glEnableVertexAttribArray(mPositionLoc);
+    glVertexAttribPointer(mPositionLoc, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT,
+                   reinterpret_cast<GLvoid *>(static_cast<uintptr_t>(3 * sizeof(GLushort))));
+
+    DoDrawElements();
+    EXPECT_GL_NO_ERROR();
+    CheckDrawResult();
+}
+
 // Check that glMultiDraw*Instanced without instancing support results in GL_INVALID_OPERATION
 TEST_P(MultiDrawNoInstancingSupportTest, InvalidOperation)
 {
@@ -338,6 +338,93 @@ TEST_P(MultithreadingTest, MultiContextDraw)
     runMultithreadedGLTest(testBody, 4);
 }
 
+// Test that threads can draw at the same time with shared contexts of separate share groups, which
+// only lock their own share group.  Each share group is used by two threads.
+TEST_P(MultithreadingTest, MultiShareGroupDraw)
+{
+    ANGLE_SKIP_TEST_IF(!platformSupportsMultithreading());
+
+    ANGLE_SKIP_TEST_IF(isSwiftshader());
+
+    constexpr size_t kShareGroupCount     = 4;
+    constexpr size_t kThreadCount         = kShareGroupCount * 2;
+    constexpr size_t kIterationsPerThread = 32;
+    constexpr size_t kDrawsPerIteration   = 100;
+    constexpr EGLint kPBufferSize         = 64;
+
+    EGLWindow *window = getEGLWindow();
+    EGLDisplay dpy    = window->getDisplay();
+    EGLConfig config  = window->getConfig();
+
+    std::array<EGLContext, kThreadCount> contexts;
+    std::array<EGLSurface, kThreadCount> surfaces;
+    for (size_t threadIdx = 0; threadIdx < kThreadCount; threadIdx++)
+    {
+        // Every odd context shares with the one before it.
+        EGLContext shareContext = threadIdx % 2 == 0 ? EGL_NO_CONTEXT : contexts[threadIdx - 1];
+        contexts[threadIdx]     = window->createContext(shareContext);
+        ASSERT_NE(EGL_NO_CONTEXT, contexts[threadIdx]);
+
+        EGLint pbufferAttributes[] = {EGL_WIDTH, kPBufferSize, EGL_HEIGHT, kPBufferSize, EGL_NONE};
+        surfaces[threadIdx]        = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+        ASSERT_EGL_SUCCESS();
+    }
+
+    std::array<std::thread, kThreadCount> threads;
+    for (size_t threadIdx = 0; threadIdx < kThreadCount; threadIdx++)
+    {
+        threads[threadIdx] = std::thread([&, threadIdx]() {
+            EXPECT_EGL_TRUE(
+                eglMakeCurrent(dpy, surfaces[threadIdx], surfaces[threadIdx], contexts[threadIdx]));
+
+            ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(),
+                             essl1_shaders::fs::UniformColor());
+            glUseProgram(program);
+
+            GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+
+            auto quadVertices = GetQuadVertices();
+
+            GLBuffer vertexBuffer;
+            glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 3 * 6, quadVertices.data(),
+                         GL_STATIC_DRAW);
+
+            GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+            glEnableVertexAttribArray(positionLocation);
+            glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, 0);
+
+            for (size_t iteration = 0; iteration < kIterationsPerThread; iteration++)
+            {
+                const GLColor color(static_cast<GLubyte>(threadIdx % 255),
+                                    static_cast<GLubyte>(iteration % 255), 0, 255);
+                const angle::Vector4 floatColor = color.toNormalizedVector();
+                glUniform4fv(colorLocation, 1, floatColor.data());
+
+                for (size_t draw = 0; draw < kDrawsPerIteration; draw++)
+                {
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+                }
+
+                EXPECT_PIXEL_COLOR_EQ(0, 0, color);
+            }
+
+            EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t threadIdx = 0; threadIdx < kThreadCount; threadIdx++)
+    {
+        EXPECT_EGL_TRUE(eglDestroySurface(dpy, surfaces[threadIdx]));
+        EXPECT_EGL_TRUE(eglDestroyContext(dpy, contexts[threadIdx]));
+    }
+}
+
 // Test that multiple threads can draw and read back pixels correctly.
 // Using eglSwapBuffers stresses race conditions around use of QueueSerials.
 TEST_P(MultithreadingTest, MultiContextDrawWithSwapBuffers)
@@ -0,0 +1,129 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// PrewarmDrawStateTest.cpp : Tests of the GL_ANGLE_prewarm_draw_state extension.
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+#include "util/test_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kPollInterval = 10;
+
+class PrewarmDrawStateTest : public ANGLETest
+{
+  protected:
+    PrewarmDrawStateTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    bool ensurePrewarmDrawStateExtensionAvailable()
+    {
+        if (IsGLExtensionRequestable("GL_ANGLE_prewarm_draw_state"))
+        {
+            glRequestExtensionANGLE("GL_ANGLE_prewarm_draw_state");
+        }
+
+        return IsGLExtensionEnabled("GL_ANGLE_prewarm_draw_state");
+    }
+
+    void waitForPrewarmComplete(GLuint program)
+    {
+        GLint status = GL_FALSE;
+        while (true)
+        {
+            glGetProgramiv(program, GL_PREWARM_COMPLETION_STATUS_ANGLE, &status);
+            ASSERT_GL_NO_ERROR();
+            if (status == GL_TRUE)
+            {
+                break;
+            }
+            angle::Sleep(kPollInterval);
+        }
+    }
+};
+
+// Test that prewarming the state of a draw call and then making the draw call renders correctly.
+TEST_P(PrewarmDrawStateTest, PrewarmThenDraw)
+{
+    ANGLE_SKIP_TEST_IF(!ensurePrewarmDrawStateExtensionAvailable());
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    glUseProgram(program);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ZERO);
+
+    glPrewarmDrawStateANGLE(GL_TRIANGLES);
+    EXPECT_GL_NO_ERROR();
+
+    waitForPrewarmComplete(program);
+
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+}
+
+// Test that prewarming with a different primitive mode than the following draw calls is harmless.
+TEST_P(PrewarmDrawStateTest, PrewarmOtherModeThenDraw)
+{
+    ANGLE_SKIP_TEST_IF(!ensurePrewarmDrawStateExtensionAvailable());
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    glUseProgram(program);
+
+    glPrewarmDrawStateANGLE(GL_LINES);
+    glPrewarmDrawStateANGLE(GL_POINTS);
+    EXPECT_GL_NO_ERROR();
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+
+    waitForPrewarmComplete(program);
+}
+
+// Test the errors of glPrewarmDrawStateANGLE and of the completion query.
+TEST_P(PrewarmDrawStateTest, Errors)
+{
+    ANGLE_SKIP_TEST_IF(!ensurePrewarmDrawStateExtensionAvailable());
+
+    // No program installed.
+    glUseProgram(0);
+    glPrewarmDrawStateANGLE(GL_TRIANGLES);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    glUseProgram(program);
+
+    // Invalid primitive mode.
+    glPrewarmDrawStateANGLE(GL_RGBA);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    // The completion of a program that isn't linked can't be queried.
+    GLProgram unlinkedProgram;
+    GLint status = GL_FALSE;
+    glGetProgramiv(unlinkedProgram, GL_PREWARM_COMPLETION_STATUS_ANGLE, &status);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // A program that was never prewarmed is complete.
+    glGetProgramiv(program, GL_PREWARM_COMPLETION_STATUS_ANGLE, &status);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_EQ(GL_TRUE, status);
+}
+
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(PrewarmDrawStateTest);
+}  // namespace
@@ -1011,6 +1011,76 @@ TEST_P(ProgramBinaryES31Test, ImageTextureBinding)
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that buffer variables can be queried from a program loaded from a binary, and that the
+// binary of such a program can be read back before they are queried.
+TEST_P(ProgramBinaryES31Test, BufferVariableQueries)
+{
+    // We can't run the test if no program binary formats are supported.
+    GLint binaryFormatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+    ANGLE_SKIP_TEST_IF(binaryFormatCount == 0);
+
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x=1, local_size_y=1, local_size_z=1) in;
+layout(std430, binding = 0) buffer Block
+{
+    uint first;
+    uint second[2];
+} instance;
+void main()
+{
+    instance.second[1] = instance.first + instance.second[0];
+})";
+
+    ANGLE_GL_COMPUTE_PROGRAM(program, kCS);
+
+    auto getBinary = [](GLuint programIn, GLenum *binaryFormatOut) {
+        GLint programLength = 0;
+        glGetProgramiv(programIn, GL_PROGRAM_BINARY_LENGTH, &programLength);
+
+        GLsizei readLength = 0;
+        std::vector<uint8_t> binary(programLength);
+        glGetProgramBinary(programIn, programLength, &readLength, binaryFormatOut, binary.data());
+        EXPECT_EQ(static_cast<GLsizei>(programLength), readLength);
+        return binary;
+    };
+
+    GLenum binaryFormat        = GL_NONE;
+    std::vector<uint8_t> first = getBinary(program, &binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    ANGLE_GL_BINARY_ES3_PROGRAM(loadedProgram, first, binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    // Round-trip the binary once more without querying any buffer variable.
+    std::vector<uint8_t> second = getBinary(loadedProgram, &binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    ANGLE_GL_BINARY_ES3_PROGRAM(reloadedProgram, second, binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    GLint bufferVariableCount = 0;
+    glGetProgramInterfaceiv(reloadedProgram, GL_BUFFER_VARIABLE, GL_ACTIVE_RESOURCES,
+                            &bufferVariableCount);
+    EXPECT_EQ(2, bufferVariableCount);
+
+    GLuint index = glGetProgramResourceIndex(reloadedProgram, GL_BUFFER_VARIABLE, "Block.second");
+    EXPECT_NE(GL_INVALID_INDEX, index);
+
+    GLchar name[32] = {};
+    glGetProgramResourceName(reloadedProgram, GL_BUFFER_VARIABLE, index, sizeof(name), nullptr,
+                             name);
+    EXPECT_STREQ("Block.second[0]", name);
+
+    const GLenum kProps[] = {GL_ARRAY_SIZE, GL_OFFSET};
+    GLint values[2]       = {};
+    glGetProgramResourceiv(reloadedProgram, GL_BUFFER_VARIABLE, index, 2, kProps, 2, nullptr,
+                           values);
+    EXPECT_EQ(2, values[0]);
+    EXPECT_EQ(4, values[1]);
+    ASSERT_GL_NO_ERROR();
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ProgramBinaryES31Test);
 ANGLE_INSTANTIATE_TEST_ES31(ProgramBinaryES31Test);
 
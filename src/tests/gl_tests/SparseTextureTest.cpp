@@ -0,0 +1,156 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// SparseTextureTest.cpp : Tests of the GL_EXT_sparse_texture extension.
+
+#include "test_utils/ANGLETest.h"
+
+#include "test_utils/gl_raii.h"
+
+namespace angle
+{
+
+class SparseTextureTest : public ANGLETest
+{
+  protected:
+    SparseTextureTest()
+    {
+        setWindowWidth(1);
+        setWindowHeight(1);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    // Returns false if RGBA8 has no virtual page size for 2D textures.
+    bool getPageSize(GLint *pageWidthOut, GLint *pageHeightOut)
+    {
+        GLint pageSizeCount = 0;
+        glGetInternalformativ(GL_TEXTURE_2D, GL_RGBA8, GL_NUM_VIRTUAL_PAGE_SIZES_EXT, 1,
+                              &pageSizeCount);
+        if (pageSizeCount == 0)
+        {
+            return false;
+        }
+
+        glGetInternalformativ(GL_TEXTURE_2D, GL_RGBA8, GL_VIRTUAL_PAGE_SIZE_X_EXT, 1,
+                              pageWidthOut);
+        glGetInternalformativ(GL_TEXTURE_2D, GL_RGBA8, GL_VIRTUAL_PAGE_SIZE_Y_EXT, 1,
+                              pageHeightOut);
+        return true;
+    }
+};
+
+// Sparse textures can only be made sparse before their storage is specified.
+TEST_P(SparseTextureTest, SparseOnlyBeforeStorage)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_EXT_sparse_texture"));
+
+    GLint pageWidth  = 0;
+    GLint pageHeight = 0;
+    ANGLE_SKIP_TEST_IF(!getPageSize(&pageWidth, &pageHeight));
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SPARSE_EXT, GL_TRUE);
+    EXPECT_GL_NO_ERROR();
+
+    GLint sparse = GL_FALSE;
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SPARSE_EXT, &sparse);
+    EXPECT_EQ(GL_TRUE, sparse);
+
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, pageWidth, pageHeight);
+    EXPECT_GL_NO_ERROR();
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SPARSE_EXT, GL_FALSE);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+}
+
+// Committed regions must be aligned to the page size, and the texture must be sparse.
+TEST_P(SparseTextureTest, PageCommitmentValidation)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_EXT_sparse_texture"));
+
+    GLint pageWidth  = 0;
+    GLint pageHeight = 0;
+    ANGLE_SKIP_TEST_IF(!getPageSize(&pageWidth, &pageHeight));
+
+    GLTexture denseTexture;
+    glBindTexture(GL_TEXTURE_2D, denseTexture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, pageWidth, pageHeight);
+    glTexPageCommitmentEXT(GL_TEXTURE_2D, 0, 0, 0, 0, pageWidth, pageHeight, 1, GL_TRUE);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    GLTexture sparseTexture;
+    glBindTexture(GL_TEXTURE_2D, sparseTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SPARSE_EXT, GL_TRUE);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, pageWidth * 2, pageHeight * 2);
+    EXPECT_GL_NO_ERROR();
+
+    // Not aligned to a page.
+    glTexPageCommitmentEXT(GL_TEXTURE_2D, 0, 1, 0, 0, pageWidth, pageHeight, 1, GL_TRUE);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    // Out of the level.
+    glTexPageCommitmentEXT(GL_TEXTURE_2D, 0, pageWidth, 0, 0, pageWidth * 2, pageHeight, 1,
+                           GL_TRUE);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glTexPageCommitmentEXT(GL_TEXTURE_2D, 0, pageWidth, pageHeight, 0, pageWidth, pageHeight, 1,
+                           GL_TRUE);
+    EXPECT_GL_NO_ERROR();
+
+    // Storage must be a multiple of the page size.
+    GLTexture unalignedTexture;
+    glBindTexture(GL_TEXTURE_2D, unalignedTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SPARSE_EXT, GL_TRUE);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, pageWidth + 1, pageHeight);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+}
+
+// Data written to committed pages is read back, and stays there while other pages are committed
+// and decommitted.
+TEST_P(SparseTextureTest, CommittedPagesKeepData)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_EXT_sparse_texture"));
+
+    GLint pageWidth  = 0;
+    GLint pageHeight = 0;
+    ANGLE_SKIP_TEST_IF(!getPageSize(&pageWidth, &pageHeight));
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SPARSE_EXT, GL_TRUE);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, pageWidth * 2, pageHeight);
+
+    GLint sparseLevels = -1;
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_NUM_SPARSE_LEVELS_EXT, &sparseLevels);
+    EXPECT_GE(sparseLevels, 0);
+    EXPECT_LE(sparseLevels, 1);
+
+    glTexPageCommitmentEXT(GL_TEXTURE_2D, 0, 0, 0, 0, pageWidth, pageHeight, 1, GL_TRUE);
+
+    std::vector<GLColor> data(pageWidth * pageHeight, GLColor::green);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, pageWidth, pageHeight, GL_RGBA, GL_UNSIGNED_BYTE,
+                    data.data());
+
+    glTexPageCommitmentEXT(GL_TEXTURE_2D, 0, pageWidth, 0, 0, pageWidth, pageHeight, 1, GL_TRUE);
+    glTexPageCommitmentEXT(GL_TEXTURE_2D, 0, pageWidth, 0, 0, pageWidth, pageHeight, 1, GL_FALSE);
+    EXPECT_GL_NO_ERROR();
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(pageWidth - 1, pageHeight - 1, GLColor::green);
+}
+
+ANGLE_INSTANTIATE_TEST_ES31(SparseTextureTest);
+
+}  // namespace angle
@@ -2640,6 +2640,23 @@ TEST_P(SimpleStateChangeTest, CopyTexSubImageOnTextureBoundToFrambuffer)
     updateTextureBoundToFramebufferHelper(updateFunc);
 }
 
+// Tests that repeated TexSubImage updates between two draws are all flushed before rendering, even
+// though the framebuffer merges their notifications.
+TEST_P(SimpleStateChangeTest, RepeatedTexSubImageOnTextureBoundToFrambuffer)
+{
+    // http://anglebug.com/4092
+    ANGLE_SKIP_TEST_IF(IsAndroid() && IsOpenGLES());
+    auto updateFunc = [](GLenum textureBinding, GLTexture *tex, GLint x, GLint y,
+                         const GLColor &color) {
+        glBindTexture(textureBinding, *tex);
+        glTexSubImage2D(textureBinding, 0, x, y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                        GLColor::magenta.data());
+        glTexSubImage2D(textureBinding, 0, x, y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, color.data());
+    };
+
+    updateTextureBoundToFramebufferHelper(updateFunc);
+}
+
 // Tests that the read framebuffer doesn't affect what the draw call thinks the attachments are
 // (which is what the draw framebuffer dictates) when a command is issued with the GL_FRAMEBUFFER
 // target.
@@ -3870,6 +3887,60 @@ void main()
     EXPECT_PIXEL_RECT_EQ(kHalfSize, kHalfSize, kHalfSize, kHalfSize, GLColor::yellow);
 }
 
+// Tests that the completeness of a texture follows the samplers it is alternately used with, and
+// changes to the texture between them.
+TEST_P(SimpleStateChangeTestES3, AlternateSamplersWithDifferentCompleteness)
+{
+    // The nearest sampler leaves the single-level texture complete.
+    GLSampler nearestSampler;
+    glSamplerParameteri(nearestSampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glSamplerParameteri(nearestSampler, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    // The mipmapped sampler makes it incomplete until it has its mips.
+    GLSampler mipmapSampler;
+    glSamplerParameteri(mipmapSampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glSamplerParameteri(mipmapSampler, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    constexpr GLsizei kSize = 2;
+    std::vector<GLColor> pixels(kSize * kSize, GLColor::green);
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kSize, kSize, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                 pixels.data());
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, essl1_shaders::Texture2DUniform()), 0);
+
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        glBindSampler(0, nearestSampler);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+        glBindSampler(0, mipmapSampler);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::black);
+
+        glBindSampler(0, 0);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::black);
+    }
+
+    // Once the mips are generated, the texture is complete with any of the samplers.
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    glBindSampler(0, mipmapSampler);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    glBindSampler(0, nearestSampler);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Tests different samplers can be used with same texture obj on different tex units.
 TEST_P(SimpleStateChangeTestES3, MultipleSamplersWithSingleTextureObject)
 {
@@ -4925,6 +4996,56 @@ TEST_P(ValidationStateChangeTest, MapBufferAndDraw)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
 }
 
+// Tests that respecifying a vertex buffer with a different size several times between draws is
+// reflected in the draw validation.
+TEST_P(ValidationStateChangeTest, ResizeBufferBetweenDraws)
+{
+    ANGLE_GL_PROGRAM(program, kColorVS, kColorFS);
+
+    glUseProgram(program);
+    GLint positionLoc = glGetAttribLocation(program, "position");
+    ASSERT_NE(-1, positionLoc);
+    GLint colorLoc = glGetAttribLocation(program, "color");
+    ASSERT_NE(-1, colorLoc);
+
+    const std::array<Vector3, 6> &quadVertices = GetQuadVertices();
+    const size_t posBufferSize                 = quadVertices.size() * sizeof(Vector3);
+
+    GLBuffer posBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, posBuffer);
+    glBufferData(GL_ARRAY_BUFFER, posBufferSize, quadVertices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(positionLoc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLoc);
+
+    std::vector<GLColor> colorVertices(6, GLColor::blue);
+
+    GLBuffer colorBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, colorBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(GLColor) * 6, colorVertices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(colorLoc, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, nullptr);
+    glEnableVertexAttribArray(colorLoc);
+    ASSERT_GL_NO_ERROR();
+
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        // Shrink the buffer a couple of times before drawing. Should fail.
+        glBufferData(GL_ARRAY_BUFFER, sizeof(GLColor) * 4, colorVertices.data(), GL_STATIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(GLColor) * 3, colorVertices.data(), GL_STATIC_DRAW);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        EXPECT_GL_ERROR(GL_INVALID_OPERATION) << "draw with small buffer should fail.";
+
+        // A draw that fits in the small buffer. Should succeed.
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        ASSERT_GL_NO_ERROR();
+
+        // Grow it back. Should succeed.
+        glBufferData(GL_ARRAY_BUFFER, sizeof(GLColor) * 6, colorVertices.data(), GL_STATIC_DRAW);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        ASSERT_GL_NO_ERROR();
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+    }
+}
+
 // Tests that mapping an immutable and persistent buffer after calling glVertexAttribPointer()
 // allows rendering to succeed.
 TEST_P(ValidationStateChangeTest, MapImmutablePersistentBufferAndDraw)
@@ -5756,6 +5877,62 @@ TEST_P(ValidationStateChangeTest, TransformFeedbackDrawModes)
     EXPECT_GL_NO_ERROR() << "Line rendering should succeed";
 }
 
+// Tests that a validated indexed draw is revalidated when transform feedback becomes active.
+TEST_P(ValidationStateChangeTest, DrawElementsAfterTransformFeedbackChange)
+{
+    // EXT_geometry_shader allows transform feedback with all draw commands.
+    ANGLE_SKIP_TEST_IF(IsGLExtensionEnabled("GL_EXT_geometry_shader"));
+
+    std::vector<std::string> tfVaryings = {"gl_Position"};
+    ANGLE_GL_PROGRAM_TRANSFORM_FEEDBACK(program, essl3_shaders::vs::Simple(),
+                                        essl3_shaders::fs::Red(), tfVaryings,
+                                        GL_INTERLEAVED_ATTRIBS);
+    glUseProgram(program);
+
+    std::array<Vector3, 4> quadVertices = GetIndexedQuadVertices();
+    GLBuffer arrayBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, arrayBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices.data(), GL_STATIC_DRAW);
+
+    GLint positionLoc = glGetAttribLocation(program, essl3_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLoc);
+    glVertexAttribPointer(positionLoc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLoc);
+
+    std::array<GLushort, 6> quadIndices = GetQuadIndices();
+    GLBuffer indexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(quadIndices), quadIndices.data(), GL_STATIC_DRAW);
+
+    GLTransformFeedback transformFeedback;
+    glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, transformFeedback);
+    GLBuffer transformFeedbackBuffer;
+    glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, transformFeedbackBuffer);
+    glBufferData(GL_TRANSFORM_FEEDBACK_BUFFER, 1024, nullptr, GL_STREAM_DRAW);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, transformFeedbackBuffer);
+
+    // Draw twice so that the second draw goes through the cached validation.
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    EXPECT_GL_NO_ERROR() << "Indexed rendering should succeed";
+
+    glBeginTransformFeedback(GL_TRIANGLES);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION) << "Indexed rendering with active XFB should fail";
+
+    glPauseTransformFeedback();
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    EXPECT_GL_NO_ERROR() << "Indexed rendering with paused XFB should succeed";
+
+    glResumeTransformFeedback();
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION) << "Indexed rendering with resumed XFB should fail";
+
+    glEndTransformFeedback();
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    EXPECT_GL_NO_ERROR() << "Indexed rendering after ending XFB should succeed";
+}
+
 // Tests a valid rendering setup with two textures. Followed by a draw with conflicting samplers.
 TEST_P(ValidationStateChangeTest, TextureConflict)
 {
@@ -6672,7 +6849,7 @@ ANGLE_INSTANTIATE_TEST_ES3(StateChangeTestES3);
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(StateChangeRenderTestES3);
 ANGLE_INSTANTIATE_TEST_ES3(StateChangeRenderTestES3);
 
-ANGLE_INSTANTIATE_TEST_ES2(SimpleStateChangeTest);
+ANGLE_INSTANTIATE_TEST_ES2_AND(SimpleStateChangeTest, WithRecordDeferredCommands(ES2_VULKAN()));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SimpleStateChangeTestES3);
 ANGLE_INSTANTIATE_TEST_ES3(SimpleStateChangeTestES3);
@@ -6690,7 +6867,8 @@ GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SimpleStateChangeTestComputeES31PP
 ANGLE_INSTANTIATE_TEST_ES31(SimpleStateChangeTestComputeES31PPO);
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ValidationStateChangeTest);
-ANGLE_INSTANTIATE_TEST_ES3(ValidationStateChangeTest);
+ANGLE_INSTANTIATE_TEST_ES3_AND(ValidationStateChangeTest,
+                               WithRecordDeferredCommands(ES3_VULKAN()));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(WebGL2ValidationStateChangeTest);
 ANGLE_INSTANTIATE_TEST_ES3(WebGL2ValidationStateChangeTest);
@@ -722,6 +722,121 @@ TEST_P(VertexAttributeTest, MixedUsingBufferAndClientMemoryPointer)
     runTest(normalizedData);
 }
 
+// Verify that the client memory data of many draws with large offsets is streamed correctly, even
+// when it doesn't fit in the streaming buffer at once.
+TEST_P(VertexAttributeTest, ClientMemoryDrawsWithLargeOffsets)
+{
+    constexpr char kVS[] = R"(attribute vec2 position;
+attribute vec4 color;
+varying vec4 vColor;
+void main()
+{
+    gl_Position = vec4(position, 0, 1);
+    vColor = color;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec4 vColor;
+void main()
+{
+    gl_FragColor = vColor;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, "position");
+    GLint colorLocation    = glGetAttribLocation(program, "color");
+    ASSERT_NE(-1, positionLocation);
+    ASSERT_NE(-1, colorLocation);
+
+    // Each draw covers one column of the framebuffer with its own color.
+    constexpr GLsizei kColumnCount       = 16;
+    constexpr GLsizei kVerticesPerColumn = 4096;
+    std::vector<GLfloat> positions(kColumnCount * kVerticesPerColumn * 2, 0.0f);
+    std::vector<GLColor> colors(kColumnCount * kVerticesPerColumn, GLColor::black);
+    std::vector<GLColor> columnColors;
+
+    for (GLsizei column = 0; column < kColumnCount; ++column)
+    {
+        const GLfloat left  = -1.0f + 2.0f * column / kColumnCount;
+        const GLfloat right = -1.0f + 2.0f * (column + 1) / kColumnCount;
+        const std::array<GLfloat, 12> quad = {
+            {left, -1.0f, right, -1.0f, left, 1.0f, left, 1.0f, right, -1.0f, right, 1.0f}};
+
+        const GLsizei first = column * kVerticesPerColumn;
+        std::copy(quad.begin(), quad.end(), positions.begin() + first * 2);
+
+        columnColors.emplace_back(static_cast<GLubyte>(column * 16),
+                                  static_cast<GLubyte>(255 - column * 16), 0, 255);
+        std::fill(colors.begin() + first, colors.begin() + first + 6, columnColors.back());
+    }
+
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, positions.data());
+    glEnableVertexAttribArray(positionLocation);
+    glVertexAttribPointer(colorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, colors.data());
+    glEnableVertexAttribArray(colorLocation);
+
+    // Alternate between non-indexed draws and draws with client memory indices.
+    for (GLsizei column = 0; column < kColumnCount; ++column)
+    {
+        const GLsizei first = column * kVerticesPerColumn;
+        if (column % 2 == 0)
+        {
+            glDrawArrays(GL_TRIANGLES, first, 6);
+        }
+        else
+        {
+            std::array<GLushort, 6> indices;
+            for (size_t index = 0; index < indices.size(); ++index)
+            {
+                indices[index] = static_cast<GLushort>(first + index);
+            }
+            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, indices.data());
+        }
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (GLsizei column = 0; column < kColumnCount; ++column)
+    {
+        EXPECT_PIXEL_COLOR_EQ((2 * column + 1) * getWindowWidth() / (2 * kColumnCount),
+                              getWindowHeight() / 2, columnColors[column]);
+    }
+}
+
+// Verify that draws from the same client memory pointer use the data it holds at the time of each
+// draw, when it's both unchanged and modified between draws without a readback in between.
+TEST_P(VertexAttributeTest, ClientMemoryModifiedBetweenDraws)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+
+    // A quad that covers the left half of the framebuffer.
+    std::array<GLfloat, 12> positions = {
+        {-1.0f, -1.0f, 0.0f, -1.0f, 0.0f, 1.0f, -1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 1.0f}};
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, positions.data());
+    glEnableVertexAttribArray(positionLocation);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    // Move the quad to the right half of the framebuffer.
+    for (size_t index = 0; index < positions.size(); index += 2)
+    {
+        positions[index] += 1.0f;
+    }
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 4, getWindowHeight() / 2, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(3 * getWindowWidth() / 4, getWindowHeight() / 2, GLColor::red);
+}
+
 // Verify signed unnormalized INT_10_10_10_2 vertex type
 TEST_P(VertexAttributeTest, SignedPacked1010102ExtensionUnnormalized)
 {
@@ -1310,6 +1425,56 @@ TEST_P(VertexAttributeTest, DrawArraysWithBufferOffset)
     EXPECT_GL_NO_ERROR();
 }
 
+// Verify that updating some of the vertices of a buffer is reflected in the next draw, including
+// when the vertex data needs a format conversion.
+TEST_P(VertexAttributeTest, DrawArraysAfterPartialBufferUpdate)
+{
+    initBasicProgram();
+    glUseProgram(mProgram);
+
+    std::array<GLshort, kVertexCount> inputData;
+    std::array<GLfloat, kVertexCount> expectedData;
+    for (size_t count = 0; count < kVertexCount; ++count)
+    {
+        inputData[count]    = static_cast<GLshort>(count);
+        expectedData[count] = static_cast<GLfloat>(count);
+    }
+
+    GLBuffer quadBuffer;
+    InitQuadVertexBuffer(&quadBuffer);
+
+    GLint positionLocation = glGetAttribLocation(mProgram, "position");
+    ASSERT_NE(-1, positionLocation);
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(inputData), inputData.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(mTestAttrib, 1, GL_SHORT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(mTestAttrib);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glVertexAttribPointer(mExpectedAttrib, 1, GL_FLOAT, GL_FALSE, 0, expectedData.data());
+    glEnableVertexAttribArray(mExpectedAttrib);
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    checkPixels();
+
+    // Update the third and fourth vertices only.
+    constexpr std::array<GLshort, 2> kUpdatedData = {{20, 30}};
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferSubData(GL_ARRAY_BUFFER, 2 * sizeof(GLshort), sizeof(kUpdatedData),
+                    kUpdatedData.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    expectedData[2] = 20.0f;
+    expectedData[3] = 30.0f;
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    checkPixels();
+
+    EXPECT_GL_NO_ERROR();
+}
+
 // Verify that using an unaligned offset doesn't mess up the draw.
 TEST_P(VertexAttributeTest, DrawArraysWithUnalignedBufferOffset)
 {
@@ -3043,6 +3043,49 @@ void main()
     EXPECT_EQ(descriptorSetAllocationsAfter, 0u);
 }
 
+// Tests that alternating between images bound to a compute program hits the descriptor set cache.
+TEST_P(VulkanPerformanceCounterTest_ES31, ChangingImagesHitsDescriptorSetCache)
+{
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x=1, local_size_y=1) in;
+layout(r32f, binding = 0) writeonly uniform highp image2D outImage;
+void main()
+{
+    imageStore(outImage, ivec2(gl_GlobalInvocationID.xy), vec4(1.0));
+})";
+
+    ANGLE_GL_COMPUTE_PROGRAM(program, kCS);
+    glUseProgram(program);
+
+    GLTexture textureA;
+    glBindTexture(GL_TEXTURE_2D, textureA);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32F, 1, 1);
+
+    GLTexture textureB;
+    glBindTexture(GL_TEXTURE_2D, textureB);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32F, 1, 1);
+    ASSERT_GL_NO_ERROR();
+
+    // Step 1: Dispatch with both images, so that their descriptor sets are cached.
+    glBindImageTexture(0, textureA, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+    glDispatchCompute(1, 1, 1);
+    glBindImageTexture(0, textureB, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+    glDispatchCompute(1, 1, 1);
+    ASSERT_GL_NO_ERROR();
+
+    uint32_t expectedWriteDescriptorSetCount = hackANGLE().writeDescriptorSets;
+
+    // Step 2: Dispatch with both images again and verify we hit the cache.
+    glBindImageTexture(0, textureA, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+    glDispatchCompute(1, 1, 1);
+    glBindImageTexture(0, textureB, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+    glDispatchCompute(1, 1, 1);
+    ASSERT_GL_NO_ERROR();
+
+    uint32_t actualWriteDescriptorSetCount = hackANGLE().writeDescriptorSets;
+    EXPECT_EQ(expectedWriteDescriptorSetCount, actualWriteDescriptorSetCount);
+}
+
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest, ES3_VULKAN());
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_ES31, ES31_VULKAN());
 
@@ -80,6 +80,41 @@ TEST_P(BasicDrawTest, EnableDisableTexture)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
 }
 
+// Checks that state set while texturing is enabled is still used once texturing is disabled.
+TEST_P(BasicDrawTest, MatrixAppliesAcrossEnableDisableTexture)
+{
+    GLTexture tex;
+    glBindTexture(GL_TEXTURE_2D, tex);
+
+    GLubyte texture[] = {
+        0x00,
+        0xff,
+        0x00,
+    };
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, texture);
+
+    drawRedQuad();
+
+    // Move the quad out of the viewport while texturing is enabled.
+    glEnable(GL_TEXTURE_2D);
+    glMatrixMode(GL_MODELVIEW);
+    glTranslatef(4.0f, 0.0f, 0.0f);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::black);
+
+    glDisable(GL_TEXTURE_2D);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::black);
+
+    glLoadIdentity();
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_GL_NO_ERROR();
+}
+
 // Check that glClearColorx, glClearDepthx, glLineWidthx, glPolygonOffsetx can work.
 TEST_P(BasicDrawTest, DepthTest)
 {
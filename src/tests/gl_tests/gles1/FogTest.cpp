@@ -130,4 +130,36 @@ TEST_P(FogTest, Set)
     EXPECT_EQ(0.4f, fogValue[3]);
 }
 
+// Checks that dense fog covers what's drawn, and that a change of fog color between draws is used.
+TEST_P(FogTest, FogColorChangeBetweenDraws)
+{
+    const GLfloat kPositions[] = {
+        -1.0f, -1.0f, -0.5f, 1.0f, -1.0f, -0.5f, -1.0f, 1.0f, -0.5f,
+        -1.0f, 1.0f,  -0.5f, 1.0f, -1.0f, -0.5f, 1.0f,  1.0f, -0.5f,
+    };
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, kPositions);
+    glColor4f(1.0f, 0.0f, 0.0f, 1.0f);
+
+    glEnable(GL_FOG);
+    glFogf(GL_FOG_MODE, GL_EXP);
+    glFogf(GL_FOG_DENSITY, 100.0f);
+
+    const GLColor32F kGreen(0.0f, 1.0f, 0.0f, 1.0f);
+    glFogfv(GL_FOG_COLOR, &kGreen.R);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    const GLColor32F kBlue(0.0f, 0.0f, 1.0f, 1.0f);
+    glFogfv(GL_FOG_COLOR, &kBlue.R);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+
+    glDisable(GL_FOG);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_GL_NO_ERROR();
+}
+
 ANGLE_INSTANTIATE_TEST_ES1(FogTest);
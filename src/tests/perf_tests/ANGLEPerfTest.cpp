@@ -21,6 +21,7 @@
 #include "util/shader_utils.h"
 #include "util/test_utils.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <fstream>
@@ -46,6 +47,13 @@ constexpr double kMilliSecondsPerSecond       = 1e3;
 constexpr double kMicroSecondsPerSecond       = 1e6;
 constexpr double kNanoSecondsPerSecond        = 1e9;
 
+// Enough for the steps of a trial of most tests without reallocating while measuring.
+constexpr size_t kInitialStepSampleBufferSize = 20000;
+
+// Steps slower than this many times the median are reported with verbose logging.
+constexpr double kSlowStepMedianFactor = 2.0;
+constexpr size_t kMaxReportedSlowSteps = 10;
+
 struct TraceCategory
 {
     unsigned char enabled;
@@ -59,12 +67,48 @@ constexpr TraceCategory gTraceCategories[2] = {
 
 void EmptyPlatformMethod(angle::PlatformMethods *, const char *) {}
 
+double SecondsToUnits(double seconds, const std::string &units)
+{
+    if (units == "ms")
+    {
+        return seconds * kMilliSecondsPerSecond;
+    }
+    else if (units == "us")
+    {
+        return seconds * kMicroSecondsPerSecond;
+    }
+    else
+    {
+        return seconds * kNanoSecondsPerSecond;
+    }
+}
+
+// Nearest-rank percentile of sorted samples.
+double GetPercentile(const std::vector<double> &sortedSamples, double percentile)
+{
+    ASSERT(!sortedSamples.empty());
+    size_t rank = static_cast<size_t>(
+        std::ceil(percentile / 100.0 * static_cast<double>(sortedSamples.size())));
+    return sortedSamples[std::max<size_t>(rank, 1) - 1];
+}
+
 void CustomLogError(angle::PlatformMethods *platform, const char *errorMessage)
 {
     auto *angleRenderTest = static_cast<ANGLERenderTest *>(platform->context);
     angleRenderTest->onErrorMessage(errorMessage);
 }
 
+void HistogramCustomCounts(angle::PlatformMethods *platform,
+                           const char *name,
+                           int sample,
+                           int min,
+                           int max,
+                           int bucketCount)
+{
+    auto *angleRenderTest = static_cast<ANGLERenderTest *>(platform->context);
+    angleRenderTest->onHistogramSample(name, sample);
+}
+
 void OverrideWorkaroundsD3D(angle::PlatformMethods *platform, angle::FeaturesD3D *featuresD3D)
 {
     auto *angleRenderTest = static_cast<ANGLERenderTest *>(platform->context);
@@ -257,6 +301,9 @@ ANGLEPerfTest::ANGLEPerfTest(const std::string &name,
     mReporter->RegisterFyiMetric(".trial_steps", "count");
     mReporter->RegisterFyiMetric(".total_steps", "count");
     mReporter->RegisterFyiMetric(".steps_to_run", "count");
+    mReporter->RegisterFyiMetric(".memory_rss", "sizeInBytes");
+
+    mStepSamples.reserve(kInitialStepSampleBufferSize);
 }
 
 ANGLEPerfTest::~ANGLEPerfTest() {}
@@ -282,6 +329,18 @@ void ANGLEPerfTest::run()
         printf("Test Trials: %d\n", static_cast<int>(numTrials));
     }
 
+    if (gCPUProfileDir && numTrials > 0)
+    {
+        if (SamplingProfiler::IsSupported())
+        {
+            mProfiler = std::make_unique<SamplingProfiler>();
+        }
+        else
+        {
+            printf("CPU profiling is not supported on this platform.\n");
+        }
+    }
+
     for (uint32_t trial = 0; trial < numTrials; ++trial)
     {
         doRunLoop(gMaxTrialTimeSeconds, mStepsToRun, RunLoopPolicy::RunContinuously);
@@ -328,6 +387,23 @@ void ANGLEPerfTest::run()
         }
         printf("Coefficient of variation: %.2lf%%\n", coefficientOfVariation * 100.0);
     }
+
+    if (mProfiler)
+    {
+        std::stringstream profilePath;
+        profilePath << gCPUProfileDir << GetPathSeparator() << mName << mBackend << "_" << mStory
+                    << ".collapsed";
+        if (mProfiler->writeCollapsedStacks(profilePath.str()))
+        {
+            printf("Saved %zu CPU profile samples: '%s'\n", mProfiler->getSampleCount(),
+                   profilePath.str().c_str());
+        }
+        else
+        {
+            printf("Failed to write the CPU profile: '%s'\n", profilePath.str().c_str());
+        }
+        mProfiler.reset();
+    }
 }
 
 void ANGLEPerfTest::doRunLoop(double maxRunTime, int maxStepsToRun, RunLoopPolicy runPolicy)
@@ -335,11 +411,21 @@ void ANGLEPerfTest::doRunLoop(double maxRunTime, int maxStepsToRun, RunLoopPolic
     mTrialNumStepsPerformed = 0;
     mRunning                = true;
     mGPUTimeNs              = 0;
+    mStepSamples.clear();
+    mGPUTimeSamplesSeconds.clear();
     mTimer.start();
     startTest();
 
+    if (mProfiler && !mProfiler->start())
+    {
+        printf("Failed to start the CPU profiler.\n");
+        mProfiler.reset();
+    }
+
+    double stepStartTime = mTimer.getElapsedTime();
     while (mRunning)
     {
+        uint32_t stepFrame = getStepFrame();
         step();
 
         if (runPolicy == RunLoopPolicy::FinishEveryStep)
@@ -349,13 +435,17 @@ void ANGLEPerfTest::doRunLoop(double maxRunTime, int maxStepsToRun, RunLoopPolic
 
         if (mRunning)
         {
+            double stepEndTime = mTimer.getElapsedTime();
+            mStepSamples.push_back({stepEndTime - stepStartTime, stepFrame});
+            stepStartTime = stepEndTime;
+
             mTrialNumStepsPerformed++;
             mTotalNumStepsPerformed++;
             if (gMaxStepsPerformed > 0 && mTotalNumStepsPerformed >= gMaxStepsPerformed)
             {
                 mRunning = false;
             }
-            else if (mTimer.getElapsedTime() > maxRunTime)
+            else if (stepEndTime > maxRunTime)
             {
                 mRunning = false;
             }
@@ -365,6 +455,12 @@ void ANGLEPerfTest::doRunLoop(double maxRunTime, int maxStepsToRun, RunLoopPolic
             }
         }
     }
+
+    if (mProfiler)
+    {
+        mProfiler->stop();
+    }
+
     finishTest();
     mTimer.stop();
     computeGPUTime();
@@ -411,19 +507,36 @@ double ANGLEPerfTest::printResults()
             units = metricInfo.units;
         }
 
-        if (units == "ms")
+        retValue = SecondsToUnits(secondsPerIteration, units);
+        mReporter->AddResult(clockNames[i], retValue);
+    }
+
+    // Means hide hitches, so the distribution of the step times is reported too.
+    if (!gCalibration)
+    {
+        std::vector<double> stepTimesSeconds;
+        stepTimesSeconds.reserve(mStepSamples.size());
+        for (const StepSample &sample : mStepSamples)
         {
-            retValue = secondsPerIteration * kMilliSecondsPerSecond;
+            stepTimesSeconds.push_back(sample.timeSeconds);
         }
-        else if (units == "us")
+
+        std::vector<double> *samplesSeconds[2] = {
+            &stepTimesSeconds,
+            &mGPUTimeSamplesSeconds,
+        };
+
+        for (size_t i = 0; i < clocksToOutput; ++i)
         {
-            retValue = secondsPerIteration * kMicroSecondsPerSecond;
+            perf_test::MetricInfo metricInfo;
+            mReporter->GetMetricInfo(clockNames[i], &metricInfo);
+            printDistribution(clockNames[i], metricInfo.units, samplesSeconds[i]);
         }
-        else
+
+        if (gVerboseLogging)
         {
-            retValue = secondsPerIteration * kNanoSecondsPerSecond;
+            printSlowestSteps();
         }
-        mReporter->AddResult(clockNames[i], retValue);
     }
 
     if (gVerboseLogging)
@@ -441,6 +554,7 @@ double ANGLEPerfTest::printResults()
     {
         mReporter->AddResult(".trial_steps", static_cast<size_t>(mTrialNumStepsPerformed));
         mReporter->AddResult(".total_steps", static_cast<size_t>(mTotalNumStepsPerformed));
+        printMemoryResults();
     }
 
     // Output histogram JSON set format if enabled.
@@ -451,6 +565,104 @@ double ANGLEPerfTest::printResults()
     return retValue;
 }
 
+void ANGLEPerfTest::printDistribution(const char *clockName,
+                                      const std::string &units,
+                                      std::vector<double> *samplesSeconds)
+{
+    if (samplesSeconds->empty())
+    {
+        return;
+    }
+
+    std::sort(samplesSeconds->begin(), samplesSeconds->end());
+
+    double mean = 0;
+    for (double sample : *samplesSeconds)
+    {
+        mean += sample;
+    }
+    mean /= static_cast<double>(samplesSeconds->size());
+
+    double variance = 0;
+    for (double sample : *samplesSeconds)
+    {
+        double difference = sample - mean;
+        variance += difference * difference;
+    }
+    variance /= static_cast<double>(samplesSeconds->size());
+
+    const std::pair<const char *, double> percentiles[3] = {
+        {"_p50", 50.0},
+        {"_p90", 90.0},
+        {"_p99", 99.0},
+    };
+
+    const double iterationsPerStep = static_cast<double>(mIterationsPerStep);
+    for (const std::pair<const char *, double> &percentile : percentiles)
+    {
+        const std::string metric = std::string(clockName) + percentile.first;
+        double secondsPerIteration =
+            GetPercentile(*samplesSeconds, percentile.second) / iterationsPerStep;
+
+        perf_test::MetricInfo metricInfo;
+        if (!mReporter->GetMetricInfo(metric, &metricInfo))
+        {
+            mReporter->RegisterFyiMetric(metric, units);
+        }
+        mReporter->AddResult(metric, SecondsToUnits(secondsPerIteration, units));
+
+        // Also output to the histogram JSON set, which is what the dashboards read.
+        TestSuite::GetInstance()->addHistogramSample(
+            mName + mBackend + metric, mStory, secondsPerIteration * kMilliSecondsPerSecond,
+            "msBestFitFormat");
+    }
+
+    const std::string stdDevMetric = std::string(clockName) + "_stddev";
+    perf_test::MetricInfo metricInfo;
+    if (!mReporter->GetMetricInfo(stdDevMetric, &metricInfo))
+    {
+        mReporter->RegisterFyiMetric(stdDevMetric, units);
+    }
+    mReporter->AddResult(stdDevMetric,
+                         SecondsToUnits(std::sqrt(variance) / iterationsPerStep, units));
+}
+
+void ANGLEPerfTest::printSlowestSteps() const
+{
+    if (mStepSamples.empty())
+    {
+        return;
+    }
+
+    std::vector<StepSample> sortedSamples = mStepSamples;
+    std::sort(sortedSamples.begin(), sortedSamples.end(),
+              [](const StepSample &a, const StepSample &b) {
+                  return a.timeSeconds > b.timeSeconds;
+              });
+
+    const double medianSeconds = sortedSamples[sortedSamples.size() / 2].timeSeconds;
+    for (size_t index = 0; index < std::min(sortedSamples.size(), kMaxReportedSlowSteps); ++index)
+    {
+        const StepSample &sample = sortedSamples[index];
+        if (sample.timeSeconds < medianSeconds * kSlowStepMedianFactor)
+        {
+            break;
+        }
+
+        printf("Slow step: frame %u took %.3lf ms (%.1lfx the median).\n", sample.frame,
+               sample.timeSeconds * kMilliSecondsPerSecond, sample.timeSeconds / medianSeconds);
+    }
+}
+
+void ANGLEPerfTest::printMemoryResults()
+{
+    uint64_t residentBytes = GetProcessResidentMemoryBytes();
+    if (residentBytes > 0)
+    {
+        mReporter->AddResult(".memory_rss", static_cast<size_t>(residentBytes));
+    }
+}
+
 double ANGLEPerfTest::normalizedTime(size_t value) const
 {
     return static_cast<double>(value) / static_cast<double>(mTrialNumStepsPerformed);
@@ -668,6 +880,7 @@ void ANGLERenderTest::SetUp()
     mPlatformMethods.getTraceCategoryEnabledFlag = GetPerfTraceCategoryEnabled;
     mPlatformMethods.updateTraceEventDuration    = UpdateTraceEventDuration;
     mPlatformMethods.monotonicallyIncreasingTime = MonotonicallyIncreasingTime;
+    mPlatformMethods.histogramCustomCounts       = HistogramCustomCounts;
     mPlatformMethods.context                     = this;
 
     if (!mOSWindow->initialize(mName, mTestParams.windowWidth, mTestParams.windowHeight))
@@ -681,6 +894,11 @@ void ANGLERenderTest::SetUp()
     EGLPlatformParameters withMethods = mTestParams.eglParameters;
     withMethods.platformMethods       = &mPlatformMethods;
 
+    if (gDiscardDrawCalls)
+    {
+        withMethods.discardDrawCallsFeature = EGL_TRUE;
+    }
+
     // Request a common framebuffer config
     mConfigParams.redBits     = 8;
     mConfigParams.greenBits   = 8;
@@ -906,6 +1124,8 @@ void ANGLERenderTest::computeGPUTime()
             glDeleteQueriesEXT(1, &sample.beginQuery);
             glDeleteQueriesEXT(1, &sample.endQuery);
             mGPUTimeNs += endGLTimeNs - beginGLTimeNs;
+            mGPUTimeSamplesSeconds.push_back(static_cast<double>(endGLTimeNs - beginGLTimeNs) *
+                                             1e-9);
         }
 
         mTimestampQueries.clear();
@@ -973,6 +1193,60 @@ void ANGLERenderTest::onErrorMessage(const char *errorMessage)
     FAIL() << "Failing test because of unexpected error:\n" << errorMessage << "\n";
 }
 
+void ANGLERenderTest::onHistogramSample(const char *name, int sample)
+{
+    // Memory histograms are named like "GPU.ANGLE.VulkanAllocatedMemoryKB".
+    constexpr char kPrefix[]       = "GPU.ANGLE.";
+    constexpr size_t kPrefixLength = sizeof(kPrefix) - 1;
+    constexpr size_t kSuffixLength = 2;
+
+    std::string metric = name;
+    if (metric.size() <= kSuffixLength)
+    {
+        return;
+    }
+
+    const std::string suffix = metric.substr(metric.size() - kSuffixLength);
+    uint64_t bytesPerUnit    = 0;
+    if (suffix == "KB")
+    {
+        bytesPerUnit = 1024;
+    }
+    else if (suffix == "MB")
+    {
+        bytesPerUnit = 1024 * 1024;
+    }
+    else
+    {
+        return;
+    }
+
+    metric.resize(metric.size() - kSuffixLength);
+    if (metric.compare(0, kPrefixLength, kPrefix) == 0)
+    {
+        metric = metric.substr(kPrefixLength);
+    }
+
+    std::lock_guard<std::mutex> lock(mHistogramMutex);
+    mMemoryHistogramBytes["." + metric] = static_cast<uint64_t>(std::max(sample, 0)) * bytesPerUnit;
+}
+
+void ANGLERenderTest::printMemoryResults()
+{
+    ANGLEPerfTest::printMemoryResults();
+
+    std::lock_guard<std::mutex> lock(mHistogramMutex);
+    for (const auto &histogram : mMemoryHistogramBytes)
+    {
+        perf_test::MetricInfo metricInfo;
+        if (!mReporter->GetMetricInfo(histogram.first, &metricInfo))
+        {
+            mReporter->RegisterFyiMetric(histogram.first, "sizeInBytes");
+        }
+        mReporter->AddResult(histogram.first, static_cast<size_t>(histogram.second));
+    }
+}
+
 uint32_t ANGLERenderTest::getCurrentThreadSerial()
 {
     std::thread::id id = std::this_thread::get_id();
@@ -12,12 +12,14 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
+#include "SamplingProfiler.h"
 #include "platform/PlatformMethods.h"
 #include "test_utils/angle_test_configs.h"
 #include "test_utils/angle_test_instantiate.h"
@@ -105,10 +107,24 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
     // Overriden in trace perf tests.
     virtual void saveScreenshot(const std::string &screenshotName) {}
     virtual void computeGPUTime() {}
+    // The frame that the next step draws, used to attribute slow steps.
+    virtual uint32_t getStepFrame() const { return static_cast<uint32_t>(mTrialNumStepsPerformed); }
 
     double printResults();
+    // Reports the memory used at the end of a trial.
+    virtual void printMemoryResults();
+    void printDistribution(const char *clockName,
+                           const std::string &units,
+                           std::vector<double> *samplesSeconds);
+    void printSlowestSteps() const;
     void calibrateStepsToRun(RunLoopPolicy policy);
 
+    struct StepSample
+    {
+        double timeSeconds;
+        uint32_t frame;
+    };
+
     std::string mName;
     std::string mBackend;
     std::string mStory;
@@ -122,6 +138,14 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
     int mIterationsPerStep;
     bool mRunning;
     std::vector<double> mTestTrialResults;
+
+    // Wall time of each step of the last trial.
+    std::vector<StepSample> mStepSamples;
+    // GPU time of each timer query pair of the last trial.
+    std::vector<double> mGPUTimeSamplesSeconds;
+
+    // Samples the measured steps of all trials when CPU profiling is enabled.
+    std::unique_ptr<angle::SamplingProfiler> mProfiler;
 };
 
 enum class SurfaceType
@@ -170,6 +194,7 @@ class ANGLERenderTest : public ANGLEPerfTest
 
     virtual void overrideWorkaroundsD3D(angle::FeaturesD3D *featuresD3D) {}
     void onErrorMessage(const char *errorMessage);
+    void onHistogramSample(const char *name, int sample);
 
     uint32_t getCurrentThreadSerial();
     std::mutex &getTraceEventMutex() { return mTraceEventMutex; }
@@ -200,6 +225,7 @@ class ANGLERenderTest : public ANGLEPerfTest
     void startTest() override;
     void finishTest() override;
     void computeGPUTime() override;
+    void printMemoryResults() override;
 
     bool areExtensionPrerequisitesFulfilled() const;
 
@@ -227,6 +253,10 @@ class ANGLERenderTest : public ANGLEPerfTest
 
     std::vector<std::thread::id> mThreadIDs;
     std::mutex mTraceEventMutex;
+
+    // The last sample of each memory histogram reported by ANGLE, in bytes.
+    std::map<std::string, uint64_t> mMemoryHistogramBytes;
+    std::mutex mHistogramMutex;
 };
 
 // Mixins.
@@ -19,6 +19,8 @@ int gMaxStepsPerformed         = 0;
 bool gEnableTrace              = false;
 const char *gTraceFile         = "ANGLETrace.json";
 const char *gScreenShotDir     = nullptr;
+const char *gCPUProfileDir     = nullptr;
+const char *gShaderCorpusDir   = nullptr;
 bool gVerboseLogging           = false;
 double gCalibrationTimeSeconds = 1.0;
 double gMaxTrialTimeSeconds    = 10.0;
@@ -27,6 +29,8 @@ bool gNoFinish                 = false;
 bool gEnableAllTraceTests      = false;
 bool gRetraceMode              = false;
 bool gMinimizeGPUWork          = false;
+bool gDiscardDrawCalls         = false;
+int gTraceLoopFrames           = 0;
 
 // Default to three warmup loops. There's no science to this. More than two loops was experimentally
 // helpful on a Windows NVIDIA setup when testing with Vulkan and native trace tests.
@@ -106,6 +110,16 @@ void ANGLEProcessPerfTestArgs(int *argc, char **argv)
             gScreenShotDir = argv[argIndex + 1];
             argIndex++;
         }
+        else if (strcmp("--cpu-profile-dir", argv[argIndex]) == 0 && argIndex < *argc - 1)
+        {
+            gCPUProfileDir = argv[argIndex + 1];
+            argIndex++;
+        }
+        else if (strcmp("--shader-corpus-dir", argv[argIndex]) == 0 && argIndex < *argc - 1)
+        {
+            gShaderCorpusDir = argv[argIndex + 1];
+            argIndex++;
+        }
         else if (strcmp("--verbose-logging", argv[argIndex]) == 0 ||
                  strcmp("--verbose", argv[argIndex]) == 0 || strcmp("-v", argv[argIndex]) == 0)
         {
@@ -159,6 +173,16 @@ void ANGLEProcessPerfTestArgs(int *argc, char **argv)
         {
             gMinimizeGPUWork = true;
         }
+        else if (strcmp("--discard-draw-calls", argv[argIndex]) == 0)
+        {
+            gDiscardDrawCalls = true;
+        }
+        else if (strcmp("--trace-loop-frames", argv[argIndex]) == 0 && argIndex < *argc - 1)
+        {
+            gTraceLoopFrames = ReadIntArgument(argv[argIndex + 1]);
+            // Skip an additional argument.
+            argIndex++;
+        }
         else
         {
             argv[argcOutCount++] = argv[argIndex];
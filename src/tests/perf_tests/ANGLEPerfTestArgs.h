@@ -20,6 +20,8 @@ extern int gMaxStepsPerformed;
 extern bool gEnableTrace;
 extern const char *gTraceFile;
 extern const char *gScreenShotDir;
+extern const char *gCPUProfileDir;
+extern const char *gShaderCorpusDir;
 extern bool gVerboseLogging;
 extern int gWarmupLoops;
 extern double gCalibrationTimeSeconds;
@@ -29,6 +31,8 @@ extern bool gNoFinish;
 extern bool gEnableAllTraceTests;
 extern bool gRetraceMode;
 extern bool gMinimizeGPUWork;
+extern bool gDiscardDrawCalls;
+extern int gTraceLoopFrames;
 
 inline bool OneFrame()
 {
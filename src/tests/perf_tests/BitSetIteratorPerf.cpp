@@ -60,4 +60,50 @@ TYPED_TEST(BitSetIteratorPerfTest, Run)
     this->run();
 }
 
+// Iterates over a few scattered bits, like the dirty bits and active texture units masks usually
+// have set.
+template <typename T>
+class BitSetIteratorSparsePerfTest : public ANGLEPerfTest
+{
+  public:
+    BitSetIteratorSparsePerfTest();
+
+    void step() override;
+
+    T mBits;
+};
+
+template <typename T>
+BitSetIteratorSparsePerfTest<T>::BitSetIteratorSparsePerfTest()
+    : ANGLEPerfTest("BitSetIteratorSparsePerf", "", "_run", 1)
+{}
+
+template <typename T>
+void BitSetIteratorSparsePerfTest<T>::step()
+{
+    for (size_t bit = 3; bit < mBits.size(); bit += 37)
+    {
+        mBits.set(bit);
+    }
+
+    for (size_t bit : mBits)
+    {
+        ANGLE_UNUSED_VARIABLE(bit);
+    }
+
+    ASSERT(mBits.any());
+    mBits.reset();
+}
+
+using SparseTestTypes = Types<angle::BitSet64<64>,
+                              angle::BitSet<96>,
+                              angle::BitSetArray<192>,
+                              angle::BitSetArray<512>>;
+TYPED_TEST_SUITE(BitSetIteratorSparsePerfTest, SparseTestTypes);
+
+TYPED_TEST(BitSetIteratorSparsePerfTest, Run)
+{
+    this->run();
+}
+
 }  // anonymous namespace
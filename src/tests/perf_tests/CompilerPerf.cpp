@@ -8,9 +8,16 @@
 //   compiles the same shader repeatedly. There are different variations of the tests using
 //   different shaders.
 //
+// PoolAllocatorPerfTest:
+//   Performance test for the pool allocator the translator allocates from, with and without the
+//   thread page cache. Every step mimics the compiles of a translator that is created for them
+//   and destroyed afterwards.
+//
 
 #include "ANGLEPerfTest.h"
 
+#include <random>
+
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
@@ -162,6 +169,165 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// This shader is intended to stress the preprocessor, like shaders that are concatenated from a
+// large prelude of configuration macros.
+const char *kMacroHeavyESSL300FragSource = R"(#version 300 es
+#define PRECISION highp
+#define FLOAT_TYPE PRECISION float
+#define VEC2_TYPE PRECISION vec2
+#define VEC3_TYPE PRECISION vec3
+#define VEC4_TYPE PRECISION vec4
+#define VEC2 vec2
+#define VEC3 vec3
+#define VEC4 vec4
+#define ZERO 0.0
+#define ONE 1.0
+#define TWO (ONE + ONE)
+#define HALF (ONE / TWO)
+#define QUARTER (HALF * HALF)
+#define PI 3.14159265359
+#define TWO_PI (TWO * PI)
+#define HALF_PI (HALF * PI)
+#define EPSILON 1e-5
+#define NUM_LIGHTS 4
+#define NUM_SAMPLES 8
+#define NUM_CASCADES 3
+#define LIGHT_COLOR_0 VEC3(ONE, HALF, QUARTER)
+#define LIGHT_COLOR_1 VEC3(QUARTER, ONE, HALF)
+#define LIGHT_COLOR_2 VEC3(HALF, QUARTER, ONE)
+#define LIGHT_COLOR_3 VEC3(ONE, ONE, HALF)
+#define AMBIENT_COLOR VEC3(QUARTER * QUARTER, QUARTER * QUARTER, QUARTER)
+#define FOG_COLOR VEC3(HALF, HALF, HALF + QUARTER)
+#define FOG_DENSITY (QUARTER * QUARTER)
+#define SPECULAR_POWER (TWO * TWO * TWO * TWO)
+#define SHADOW_BIAS (EPSILON * TWO)
+#define CASCADE_SPLIT_0 (QUARTER * QUARTER)
+#define CASCADE_SPLIT_1 QUARTER
+#define CASCADE_SPLIT_2 ONE
+#define EXPOSURE (ONE + HALF)
+#define GAMMA 2.2
+#define INV_GAMMA (ONE / GAMMA)
+#define SATURATE(x) clamp(x, ZERO, ONE)
+#define SQUARE(x) ((x) * (x))
+#define LUMINANCE(c) dot(c, VEC3(0.2126, 0.7152, 0.0722))
+#define ATTENUATION(d) (ONE / (ONE + FOG_DENSITY * SQUARE(d)))
+#define LAMBERT(n, l) SATURATE(dot(n, l))
+#define BLINN(n, h) pow(SATURATE(dot(n, h)), SPECULAR_POWER)
+#define TONEMAP(c) (VEC3(ONE) - exp(-(c) * EXPOSURE))
+#define TO_SRGB(c) pow(c, VEC3(INV_GAMMA))
+#define ENABLE_FOG 1
+#define ENABLE_SHADOWS 1
+#define ENABLE_SPECULAR 1
+#define ENABLE_TONEMAPPING 1
+#if ENABLE_SHADOWS && NUM_CASCADES > 2
+#define SHADOW_SAMPLES NUM_SAMPLES
+#else
+#define SHADOW_SAMPLES 1
+#endif
+precision FLOAT_TYPE;
+in VEC3_TYPE vNormal;
+in VEC3_TYPE vPosition;
+in VEC2_TYPE vTexCoord;
+uniform VEC3_TYPE uLightPositions[NUM_LIGHTS];
+uniform VEC3_TYPE uCameraPosition;
+uniform VEC4_TYPE uShadowCoords[NUM_CASCADES];
+uniform PRECISION sampler2D uAlbedo;
+uniform PRECISION sampler2D uShadowMap;
+out VEC4_TYPE outColor;
+FLOAT_TYPE shadowFactor(VEC4_TYPE coord, FLOAT_TYPE split)
+{
+    FLOAT_TYPE shadow = ZERO;
+#if ENABLE_SHADOWS
+    for (int i = 0; i < SHADOW_SAMPLES; ++i)
+    {
+        FLOAT_TYPE angle = TWO_PI * float(i) / float(SHADOW_SAMPLES);
+        VEC2_TYPE offset = VEC2(cos(angle), sin(angle)) * EPSILON * split;
+        FLOAT_TYPE depth = texture(uShadowMap, coord.xy + offset).r;
+        shadow += depth + SHADOW_BIAS < coord.z ? ZERO : ONE;
+    }
+    shadow /= float(SHADOW_SAMPLES);
+#else
+    shadow = ONE;
+#endif
+    return shadow;
+}
+VEC3_TYPE lightColor(int i)
+{
+    if (i == 0) return LIGHT_COLOR_0;
+    if (i == 1) return LIGHT_COLOR_1;
+    if (i == 2) return LIGHT_COLOR_2;
+    return LIGHT_COLOR_3;
+}
+void main()
+{
+    VEC3_TYPE albedo = texture(uAlbedo, vTexCoord).rgb;
+    VEC3_TYPE normal = normalize(vNormal);
+    VEC3_TYPE toCamera = normalize(uCameraPosition - vPosition);
+    FLOAT_TYPE shadow = ONE;
+    FLOAT_TYPE depth = length(uCameraPosition - vPosition);
+    if (depth < CASCADE_SPLIT_0 * 100.0)
+        shadow = shadowFactor(uShadowCoords[0], CASCADE_SPLIT_0);
+    else if (depth < CASCADE_SPLIT_1 * 100.0)
+        shadow = shadowFactor(uShadowCoords[1], CASCADE_SPLIT_1);
+    else
+        shadow = shadowFactor(uShadowCoords[2], CASCADE_SPLIT_2);
+    VEC3_TYPE color = AMBIENT_COLOR * albedo;
+    for (int i = 0; i < NUM_LIGHTS; ++i)
+    {
+        VEC3_TYPE toLight = uLightPositions[i] - vPosition;
+        FLOAT_TYPE distance = length(toLight);
+        toLight /= distance;
+        VEC3_TYPE halfVector = normalize(toLight + toCamera);
+        VEC3_TYPE radiance = lightColor(i) * ATTENUATION(distance);
+        color += albedo * radiance * LAMBERT(normal, toLight) * shadow;
+#if ENABLE_SPECULAR
+        color += radiance * BLINN(normal, halfVector) * shadow * HALF;
+#endif
+    }
+#if ENABLE_FOG
+    FLOAT_TYPE fog = SATURATE(exp(-FOG_DENSITY * SQUARE(depth)));
+    color = mix(FOG_COLOR, color, fog);
+#endif
+#if ENABLE_TONEMAPPING
+    color = TONEMAP(color);
+#endif
+    color = TO_SRGB(color);
+    outColor = VEC4(color, SATURATE(LUMINANCE(color) + HALF_PI * EPSILON));
+})";
+
+const char *kMacroHeavyESSL300Id = "MacroHeavyESSL300";
+
+// This shader dynamically indexes vectors and matrices, like skinning shaders that select the
+// influences of the bones of a vertex with a loop index.
+const char *kDynamicIndexingESSL300FragSource = R"(#version 300 es
+precision highp float;
+uniform mat4 uBones[32];
+uniform mat3 uNormalBones[32];
+uniform int uInfluenceCount;
+in vec4 vPosition;
+in vec3 vNormal;
+flat in ivec4 vBoneIndices;
+in vec4 vBoneWeights;
+out vec4 outColor;
+void main()
+{
+    vec4 position = vec4(0.0);
+    vec3 normal = vec3(0.0);
+    vec4 weights = vBoneWeights;
+    for (int i = 0; i < uInfluenceCount; ++i)
+    {
+        mat4 bone = uBones[vBoneIndices[i]];
+        mat3 normalBone = uNormalBones[vBoneIndices[i]];
+        normalBone[i] *= weights[i];
+        position += bone * vPosition * weights[i];
+        normal += normalBone * vNormal;
+        weights[i] = bone[i][i];
+    }
+    outColor = vec4(normalize(normal), 1.0) * position.w + weights;
+})";
+
+const char *kDynamicIndexingESSL300Id = "DynamicIndexingESSL300";
+
 constexpr int kNumIterationsPerStep = 4;
 
 struct CompilerParameters
@@ -257,6 +423,7 @@ class CompilerPerfTest : public ANGLEPerfTest,
 
   private:
     const char *mTestShader;
+    size_t mTranslatedSize;
 
     ShBuiltInResources mResources;
     angle::PoolAllocator mAllocator;
@@ -264,7 +431,8 @@ class CompilerPerfTest : public ANGLEPerfTest,
 };
 
 CompilerPerfTest::CompilerPerfTest()
-    : ANGLEPerfTest("CompilerPerf", "", GetParam().testId, kNumIterationsPerStep)
+    : ANGLEPerfTest("CompilerPerf", "", GetParam().testId, kNumIterationsPerStep),
+      mTranslatedSize(0)
 {}
 
 void CompilerPerfTest::SetUp()
@@ -290,6 +458,10 @@ void CompilerPerfTest::SetUp()
 
 void CompilerPerfTest::TearDown()
 {
+    // The size of the translated shader, to track what the AST transformations add to it.
+    mReporter->RegisterFyiMetric(".translated_size", "sizeInBytes");
+    mReporter->AddResult(".translated_size", mTranslatedSize);
+
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
@@ -320,6 +492,7 @@ void CompilerPerfTest::step()
     {
         mTranslator->compile(shaderStrings, 1, compileOptions);
     }
+    mTranslatedSize = static_cast<size_t>(mTranslator->getInfoSink().obj.size());
 }
 
 TEST_P(CompilerPerfTest, Run)
@@ -333,15 +506,89 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kMacroHeavyESSL300FragSource, kMacroHeavyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT,
+                           kDynamicIndexingESSL300FragSource,
+                           kDynamicIndexingESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
                            kRealWorldESSL100FragSource,
                            kRealWorldESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           kMacroHeavyESSL300FragSource,
+                           kMacroHeavyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           kDynamicIndexingESSL300FragSource,
+                           kDynamicIndexingESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kMacroHeavyESSL300FragSource, kMacroHeavyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           kDynamicIndexingESSL300FragSource,
+                           kDynamicIndexingESSL300Id));
+
+// Roughly the number and sizes of the allocations made by compiling a real world shader.
+constexpr size_t kPoolAllocationCount   = 20000;
+constexpr size_t kMaxPoolAllocationSize = 128;
+
+class PoolAllocatorPerfTest : public ANGLEPerfTest, public ::testing::WithParamInterface<bool>
+{
+  public:
+    PoolAllocatorPerfTest();
+
+    void step() override;
+
+  private:
+    std::vector<size_t> mAllocationSizes;
+};
+
+PoolAllocatorPerfTest::PoolAllocatorPerfTest()
+    : ANGLEPerfTest("PoolAllocatorPerf",
+                    "",
+                    GetParam() ? "_thread_page_cache" : "_default",
+                    kNumIterationsPerStep)
+{
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<size_t> sizeDistribution(1, kMaxPoolAllocationSize);
+
+    mAllocationSizes.resize(kPoolAllocationCount);
+    for (size_t &size : mAllocationSizes)
+    {
+        size = sizeDistribution(generator);
+    }
+}
+
+void PoolAllocatorPerfTest::step()
+{
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        // Like the allocator of a translator made for a single compile.
+        angle::PoolAllocator allocator;
+        if (GetParam())
+        {
+            allocator.enableThreadPageCache();
+        }
+        allocator.push();
+
+        for (size_t size : mAllocationSizes)
+        {
+            char *allocation = static_cast<char *>(allocator.allocate(size));
+            allocation[0]    = 0;
+        }
+
+        allocator.popAll();
+    }
+}
+
+TEST_P(PoolAllocatorPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(, PoolAllocatorPerfTest, ::testing::Values(false, true));
 
 }  // anonymous namespace
@@ -0,0 +1,133 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CopyImagePerf:
+//   Performance test for the CPU image copies used by CopyTextureCHROMIUM.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+
+#include "image_util/copyimage.h"
+#include "libANGLE/renderer/renderer_utils.h"
+
+namespace
+{
+constexpr size_t kImageWidth     = 1024;
+constexpr size_t kImageHeight    = 1024;
+constexpr size_t kPixelBytes     = 4;
+constexpr int kIterationsPerStep = 2;
+
+// Reads RGBA8 through a function of its own, which keeps the copy on the per-pixel path.
+void ReadRGBA8PerPixel(const uint8_t *source, uint8_t *dest)
+{
+    angle::ReadColor<angle::R8G8B8A8, GLfloat>(source, dest);
+}
+
+struct CopyImagePerfParams
+{
+    rx::PixelReadFunction readFunction;
+    rx::PixelWriteFunction writeFunction;
+    std::string story;
+    bool flipY;
+    bool premultiplyAlpha;
+    bool unmultiplyAlpha;
+};
+
+std::ostream &operator<<(std::ostream &stream, const CopyImagePerfParams &params)
+{
+    stream << params.story.substr(1);
+    return stream;
+}
+
+class CopyImagePerfTest : public ANGLEPerfTest,
+                          public ::testing::WithParamInterface<CopyImagePerfParams>
+{
+  public:
+    CopyImagePerfTest();
+
+    void step() override;
+
+  private:
+    std::vector<uint8_t> mSource;
+    std::vector<uint8_t> mDest;
+};
+
+CopyImagePerfTest::CopyImagePerfTest()
+    : ANGLEPerfTest("CopyImagePerf", "", GetParam().story, kIterationsPerStep),
+      mSource(kImageWidth * kImageHeight * kPixelBytes),
+      mDest(kImageWidth * kImageHeight * kPixelBytes)
+{
+    std::mt19937 generator(0);
+    for (uint8_t &byte : mSource)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+}
+
+void CopyImagePerfTest::step()
+{
+    const CopyImagePerfParams &params = GetParam();
+    constexpr size_t kRowPitch        = kImageWidth * kPixelBytes;
+
+    for (int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        rx::CopyImageCHROMIUM(mSource.data(), kRowPitch, kPixelBytes, 0, params.readFunction,
+                              mDest.data(), kRowPitch, kPixelBytes, 0, params.writeFunction,
+                              GL_RGBA, GL_UNSIGNED_NORMALIZED, kImageWidth, kImageHeight, 1,
+                              params.flipY, params.premultiplyAlpha, params.unmultiplyAlpha);
+    }
+}
+
+CopyImagePerfParams CopyParams(bool perPixel,
+                               bool swizzle,
+                               bool flipY,
+                               bool premultiplyAlpha,
+                               bool unmultiplyAlpha)
+{
+    CopyImagePerfParams params;
+    params.readFunction = perPixel ? ReadRGBA8PerPixel : angle::ReadColor<angle::R8G8B8A8, GLfloat>;
+    params.writeFunction = swizzle ? angle::WriteColor<angle::B8G8R8A8, GLfloat>
+                                   : angle::WriteColor<angle::R8G8B8A8, GLfloat>;
+    params.flipY            = flipY;
+    params.premultiplyAlpha = premultiplyAlpha;
+    params.unmultiplyAlpha  = unmultiplyAlpha;
+
+    std::stringstream story;
+    story << (perPixel ? "_per_pixel" : "_rows") << (swizzle ? "_rgba8_to_bgra8" : "_rgba8");
+    if (flipY)
+    {
+        story << "_flip_y";
+    }
+    if (premultiplyAlpha)
+    {
+        story << "_premultiply";
+    }
+    if (unmultiplyAlpha)
+    {
+        story << "_unmultiply";
+    }
+    params.story = story.str();
+    return params;
+}
+
+TEST_P(CopyImagePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         CopyImagePerfTest,
+                         ::testing::Values(CopyParams(true, false, false, false, false),
+                                           CopyParams(false, false, false, false, false),
+                                           CopyParams(true, true, true, false, false),
+                                           CopyParams(false, true, true, false, false),
+                                           CopyParams(true, false, false, true, false),
+                                           CopyParams(false, false, false, true, false),
+                                           CopyParams(true, true, false, false, true),
+                                           CopyParams(false, true, false, false, true)));
+
+}  // anonymous namespace
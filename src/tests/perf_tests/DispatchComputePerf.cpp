@@ -29,6 +29,8 @@ struct DispatchComputePerfParams final : public RenderTestParams
     unsigned int localSizeY    = 16;
     unsigned int textureWidth  = 32;
     unsigned int textureHeight = 32;
+    // Ping-pong between the two textures, changing the bindings and a uniform per dispatch.
+    bool chained               = false;
 };
 
 std::string DispatchComputePerfParams::story() const
@@ -40,6 +42,10 @@ std::string DispatchComputePerfParams::story() const
     {
         storyStr << "_null";
     }
+    if (chained)
+    {
+        storyStr << "_chained";
+    }
     return storyStr.str();
 }
 
@@ -68,6 +74,7 @@ class DispatchComputePerfBenchmark : public ANGLERenderTest,
     GLuint mWriteTexture = 0;
     GLuint mDispatchX    = 0;
     GLuint mDispatchY    = 0;
+    GLint mScaleLocation = -1;
 };
 
 DispatchComputePerfBenchmark::DispatchComputePerfBenchmark()
@@ -85,6 +92,8 @@ void DispatchComputePerfBenchmark::initializeBenchmark()
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, mReadTexture);
     glUniform1i(glGetUniformLocation(mProgram, "readTexture"), 0);
+    mScaleLocation = glGetUniformLocation(mProgram, "scale");
+    glUniform1f(mScaleLocation, 1.0f);
     glBindImageTexture(4, mWriteTexture, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
 
     mDispatchX = params.textureWidth / params.localSizeX;
@@ -100,12 +109,13 @@ void DispatchComputePerfBenchmark::initComputeShader()
 layout(local_size_x=LOCAL_SIZE_X, local_size_y=LOCAL_SIZE_Y) in;
 precision highp float;
 uniform sampler2D readTexture;
+uniform float scale;
 layout(r32f, binding = 4) writeonly uniform highp image2D  outImage;
 
 void main() {
     float sum = 0.;
     sum += texelFetch(readTexture, ivec2(gl_GlobalInvocationID.xy), 0).r;
-    imageStore(outImage, ivec2(gl_GlobalInvocationID.xy), vec4(sum));
+    imageStore(outImage, ivec2(gl_GlobalInvocationID.xy), vec4(sum * scale));
 })";
 
     mProgram = CompileComputeProgram(kCS, false);
@@ -122,8 +132,10 @@ void DispatchComputePerfBenchmark::initTextures()
 
     glGenTextures(1, &mReadTexture);
     glBindTexture(GL_TEXTURE_2D, mReadTexture);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, params.textureWidth, params.textureHeight, 0, GL_RED,
-                 GL_FLOAT, textureInputData.data());
+    // Immutable, so that the chained dispatches can also bind it as an image.
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32F, params.textureWidth, params.textureHeight);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, params.textureWidth, params.textureHeight, GL_RED,
+                    GL_FLOAT, textureInputData.data());
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
@@ -134,6 +146,8 @@ void DispatchComputePerfBenchmark::initTextures()
     glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32F, params.textureWidth, params.textureHeight);
     glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, params.textureWidth, params.textureHeight, GL_RED,
                     GL_FLOAT, textureOutputData.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     ASSERT_GL_NO_ERROR();
 }
 
@@ -149,8 +163,18 @@ void DispatchComputePerfBenchmark::drawBenchmark()
     const auto &params = GetParam();
     for (unsigned int it = 0; it < params.iterationsPerStep; it++)
     {
+        if (params.chained)
+        {
+            // Each dispatch reads what the previous one wrote.
+            const bool swapped  = (it % 2) != 0;
+            GLuint readTexture  = swapped ? mWriteTexture : mReadTexture;
+            GLuint writeTexture = swapped ? mReadTexture : mWriteTexture;
+            glBindTexture(GL_TEXTURE_2D, readTexture);
+            glBindImageTexture(4, writeTexture, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+            glUniform1f(mScaleLocation, swapped ? 0.5f : 2.0f);
+        }
         glDispatchCompute(mDispatchX, mDispatchY, 1);
-        glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+        glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
     }
     ASSERT_GL_NO_ERROR();
 }
@@ -163,6 +187,20 @@ DispatchComputePerfParams DispatchComputePerfOpenGLOrGLESParams(bool useNullDevi
     return params;
 }
 
+DispatchComputePerfParams DispatchComputePerfVulkanParams(bool useNullDevice)
+{
+    DispatchComputePerfParams params;
+    params.eglParameters =
+        useNullDevice ? angle::egl_platform::VULKAN_NULL() : angle::egl_platform::VULKAN();
+    return params;
+}
+
+DispatchComputePerfParams Chained(DispatchComputePerfParams params)
+{
+    params.chained = true;
+    return params;
+}
+
 TEST_P(DispatchComputePerfBenchmark, Run)
 {
     run();
@@ -171,6 +209,10 @@ TEST_P(DispatchComputePerfBenchmark, Run)
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DispatchComputePerfBenchmark);
 ANGLE_INSTANTIATE_TEST(DispatchComputePerfBenchmark,
                        DispatchComputePerfOpenGLOrGLESParams(true),
-                       DispatchComputePerfOpenGLOrGLESParams(false));
+                       DispatchComputePerfOpenGLOrGLESParams(false),
+                       DispatchComputePerfVulkanParams(true),
+                       DispatchComputePerfVulkanParams(false),
+                       Chained(DispatchComputePerfOpenGLOrGLESParams(false)),
+                       Chained(DispatchComputePerfVulkanParams(false)));
 
 }  // namespace
@@ -74,6 +74,11 @@ std::string DrawArraysPerfParams::story() const
             break;
     }
 
+    if (eglParameters.recordDeferredCommandsFeature == EGL_TRUE)
+    {
+        strstr << "_record_deferred_commands";
+    }
+
     return strstr.str();
 }
 
@@ -553,6 +558,23 @@ std::vector<P> gTestsWithRenderer =
 std::vector<P> gTestsWithDevice =
     CombineWithFuncs(gTestsWithRenderer, {Passthrough<P>, Offscreen<P>, NullDevice<P>});
 
-ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTestsWithDevice);
+// Adds a variant that records the draw calls, for the tests where nothing flushes them per draw.
+std::vector<P> AddRecordDeferredCommands(const std::vector<P> &in)
+{
+    std::vector<P> out = in;
+    for (P params : in)
+    {
+        if (params.stateChange == StateChange::NoChange)
+        {
+            params.eglParameters.recordDeferredCommandsFeature = EGL_TRUE;
+            out.push_back(params);
+        }
+    }
+    return out;
+}
+
+std::vector<P> gTests = AddRecordDeferredCommands(gTestsWithDevice);
+
+ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTests);
 
 }  // anonymous namespace
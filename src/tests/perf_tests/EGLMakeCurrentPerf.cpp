@@ -13,6 +13,7 @@
 #include "platform/PlatformMethods.h"
 #include "test_utils/angle_test_configs.h"
 #include "test_utils/angle_test_instantiate.h"
+#include "util/shader_utils.h"
 
 #define ITERATIONS 20
 
@@ -24,13 +25,15 @@ class EGLMakeCurrentPerfTest : public ANGLEPerfTest,
                                public WithParamInterface<angle::PlatformParameters>
 {
   public:
-    EGLMakeCurrentPerfTest();
+    EGLMakeCurrentPerfTest() : EGLMakeCurrentPerfTest("_run") {}
 
     void step() override;
     void SetUp() override;
     void TearDown() override;
 
-  private:
+  protected:
+    explicit EGLMakeCurrentPerfTest(const char *story);
+
     OSWindow *mOSWindow;
     EGLDisplay mDisplay;
     EGLSurface mSurface;
@@ -39,8 +42,8 @@ class EGLMakeCurrentPerfTest : public ANGLEPerfTest,
     std::unique_ptr<angle::Library> mEGLLibrary;
 };
 
-EGLMakeCurrentPerfTest::EGLMakeCurrentPerfTest()
-    : ANGLEPerfTest("EGLMakeCurrent", "", "_run", ITERATIONS),
+EGLMakeCurrentPerfTest::EGLMakeCurrentPerfTest(const char *story)
+    : ANGLEPerfTest("EGLMakeCurrent", "", story, ITERATIONS),
       mOSWindow(nullptr),
       mDisplay(EGL_NO_DISPLAY),
       mSurface(EGL_NO_SURFACE),
@@ -76,6 +79,7 @@ EGLMakeCurrentPerfTest::EGLMakeCurrentPerfTest()
     else
     {
         angle::LoadEGL(getProc);
+        angle::LoadGLES(getProc);
 
         if (!eglGetPlatformDisplayEXT)
         {
@@ -111,9 +115,11 @@ void EGLMakeCurrentPerfTest::SetUp()
 
     ASSERT_TRUE(eglChooseConfig(mDisplay, configAttrs, &mConfig, 1, &numConfigs));
 
-    mContexts[0] = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, nullptr);
+    EGLint contextAttrs[] = {EGL_CONTEXT_CLIENT_VERSION, GetParam().majorVersion, EGL_NONE};
+
+    mContexts[0] = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, contextAttrs);
     ASSERT_NE(EGL_NO_CONTEXT, mContexts[0]);
-    mContexts[1] = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, nullptr);
+    mContexts[1] = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, contextAttrs);
     ASSERT_NE(EGL_NO_CONTEXT, mContexts[1]);
 
     mSurface = eglCreateWindowSurface(mDisplay, mConfig, mOSWindow->getNativeWindow(), nullptr);
@@ -140,12 +146,100 @@ void EGLMakeCurrentPerfTest::step()
     }
 }
 
+// Switches between two contexts that each have a program sampling several textures, and draws
+// once after every switch.  This measures the cost of syncing the state of the new context.
+class EGLMakeCurrentWithTexturesPerfTest : public EGLMakeCurrentPerfTest
+{
+  public:
+    EGLMakeCurrentWithTexturesPerfTest() : EGLMakeCurrentPerfTest("_draw_with_textures") {}
+
+    void step() override;
+    void SetUp() override;
+
+  private:
+    static constexpr GLint kTextureCount = 8;
+
+    void initializeContextResources();
+};
+
+void EGLMakeCurrentWithTexturesPerfTest::SetUp()
+{
+    EGLMakeCurrentPerfTest::SetUp();
+
+    for (EGLContext context : mContexts)
+    {
+        ASSERT_TRUE(eglMakeCurrent(mDisplay, mSurface, mSurface, context));
+        initializeContextResources();
+    }
+}
+
+void EGLMakeCurrentWithTexturesPerfTest::initializeContextResources()
+{
+    constexpr char kVS[] = R"(attribute vec4 a_position;
+void main()
+{
+    gl_Position = a_position;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+uniform sampler2D s_textures[8];
+void main()
+{
+    vec4 color = vec4(0);
+    for (int i = 0; i < 8; ++i)
+    {
+        color += texture2D(s_textures[i], vec2(0));
+    }
+    gl_FragColor = color;
+})";
+
+    GLuint program = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, program);
+    glUseProgram(program);
+
+    for (GLint textureIndex = 0; textureIndex < kTextureCount; ++textureIndex)
+    {
+        GLuint texture;
+        glGenTextures(1, &texture);
+        glActiveTexture(GL_TEXTURE0 + textureIndex);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+        std::string samplerName = "s_textures[" + std::to_string(textureIndex) + "]";
+        glUniform1i(glGetUniformLocation(program, samplerName.c_str()), textureIndex);
+    }
+
+    // Give the contexts different state, so that switching between them really changes it.
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+
+    ASSERT_EQ(static_cast<GLenum>(GL_NO_ERROR), glGetError());
+}
+
+void EGLMakeCurrentWithTexturesPerfTest::step()
+{
+    int mCurrContext = 0;
+    for (int x = 0; x < ITERATIONS; x++)
+    {
+        mCurrContext = (mCurrContext + 1) % mContexts.size();
+        eglMakeCurrent(mDisplay, mSurface, mSurface, mContexts[mCurrContext]);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+}
+
 TEST_P(EGLMakeCurrentPerfTest, Run)
 {
     run();
 }
 
+TEST_P(EGLMakeCurrentWithTexturesPerfTest, Run)
+{
+    run();
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLMakeCurrentPerfTest);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLMakeCurrentWithTexturesPerfTest);
 // We want to run this test on GL(ES) and Vulkan everywhere except Android
 #if !defined(ANGLE_PLATFORM_ANDROID)
 ANGLE_INSTANTIATE_TEST(EGLMakeCurrentPerfTest,
@@ -154,6 +248,11 @@ ANGLE_INSTANTIATE_TEST(EGLMakeCurrentPerfTest,
                        angle::ES2_OPENGL(),
                        angle::ES2_OPENGLES(),
                        angle::ES2_VULKAN());
+ANGLE_INSTANTIATE_TEST(EGLMakeCurrentWithTexturesPerfTest,
+                       angle::ES2_D3D11(),
+                       angle::ES2_OPENGL(),
+                       angle::ES2_OPENGLES(),
+                       angle::ES2_VULKAN());
 #endif
 
 }  // namespace
@@ -68,6 +68,11 @@ std::string GenerateMipmapParams::story() const
         strstr << "_rgb";
     }
 
+    if (eglParameters.forceCPUPathForGenerateMipmapFeature == EGL_TRUE)
+    {
+        strstr << "_cpu_" << textureWidth << "x" << textureHeight;
+    }
+
     return strstr.str();
 }
 
@@ -118,6 +123,15 @@ class GenerateMipmapWithRedefineBenchmark : public GenerateMipmapBenchmarkBase
     void drawBenchmark() override;
 };
 
+class GenerateMipmapAfterUploadBenchmark : public GenerateMipmapBenchmarkBase
+{
+  public:
+    GenerateMipmapAfterUploadBenchmark() : GenerateMipmapBenchmarkBase("GenerateMipmapAfterUpload")
+    {}
+
+    void drawBenchmark() override;
+};
+
 GenerateMipmapBenchmarkBase::GenerateMipmapBenchmarkBase(const char *benchmarkName)
     : ANGLERenderTest(benchmarkName, GetParam())
 {
@@ -277,6 +291,48 @@ void GenerateMipmapWithRedefineBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void GenerateMipmapAfterUploadBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    // Create a new texture every time, and use it without mipmaps first, so the base level has to
+    // be moved to a new image with the full mip chain every time.
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glTexImage2D(GL_TEXTURE_2D, 0, params.internalFormat, params.textureWidth, params.textureHeight,
+                 0, params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+
+    // Perform a draw so the image is created.
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+
+    startGpuTimer();
+
+    // Do a single iteration, otherwise the cost of moving the base level is amortized.
+    ASSERT_EQ(params.iterationsPerStep, 1u);
+
+    // Upload the whole base level and generate mipmaps right after, without using the texture in
+    // between.
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, params.textureWidth, params.textureHeight,
+                    params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    // Perform a draw just so the texture data is flushed.  With the position attributes not
+    // set, a constant default value is used, resulting in a very cheap draw.
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
 GenerateMipmapParams D3D11Params(bool webglCompat, bool singleIteration)
 {
     GenerateMipmapParams params;
@@ -323,6 +379,18 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     return params;
 }
 
+// Generates the mipmaps on the CPU, as done for formats the device can't filter.  A larger base
+// level is used to show the effect of splitting each level between the worker threads.
+GenerateMipmapParams VulkanCPUParams(bool singleIteration, GLsizei textureSize)
+{
+    GenerateMipmapParams params = VulkanParams(false, singleIteration, false);
+
+    params.eglParameters.forceCPUPathForGenerateMipmapFeature = EGL_TRUE;
+    params.textureWidth                                       = textureSize;
+    params.textureHeight                                      = textureSize;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(GenerateMipmapBenchmark, Run)
@@ -335,6 +403,11 @@ TEST_P(GenerateMipmapWithRedefineBenchmark, Run)
     run();
 }
 
+TEST_P(GenerateMipmapAfterUploadBenchmark, Run)
+{
+    run();
+}
+
 using namespace params;
 
 ANGLE_INSTANTIATE_TEST(GenerateMipmapBenchmark,
@@ -345,7 +418,9 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapBenchmark,
                        VulkanParams(false, false, false),
                        VulkanParams(true, false, false),
                        VulkanParams(false, false, true),
-                       VulkanParams(true, false, true));
+                       VulkanParams(true, false, true),
+                       VulkanCPUParams(false, 1024),
+                       VulkanCPUParams(false, 4096));
 
 ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        D3D11Params(false, true),
@@ -355,4 +430,13 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        VulkanParams(false, true, false),
                        VulkanParams(true, true, false),
                        VulkanParams(false, true, true),
-                       VulkanParams(true, true, true));
+                       VulkanParams(true, true, true),
+                       VulkanCPUParams(true, 1024),
+                       VulkanCPUParams(true, 4096));
+
+ANGLE_INSTANTIATE_TEST(GenerateMipmapAfterUploadBenchmark,
+                       D3D11Params(false, true),
+                       OpenGLOrGLESParams(false, true),
+                       VulkanParams(false, true, false),
+                       VulkanParams(false, true, true),
+                       VulkanCPUParams(true, 1024));
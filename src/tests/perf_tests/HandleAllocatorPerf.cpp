@@ -0,0 +1,77 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HandleAllocatorPerf:
+//   Performance test for gl::HandleAllocator under high churn, with and without recycling of
+//   released handles.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <random>
+
+#include "libANGLE/HandleAllocator.h"
+
+namespace
+{
+constexpr size_t kHandleCount    = 4096;
+constexpr int kIterationsPerStep = 10;
+
+class HandleAllocatorPerfTest : public ANGLEPerfTest, public ::testing::WithParamInterface<bool>
+{
+  public:
+    HandleAllocatorPerfTest();
+
+    void step() override;
+
+  private:
+    gl::HandleAllocator mAllocator;
+    std::vector<GLuint> mHandles;
+};
+
+HandleAllocatorPerfTest::HandleAllocatorPerfTest()
+    : ANGLEPerfTest("HandleAllocatorPerf",
+                    "",
+                    GetParam() ? "_recycle" : "_lowest_first",
+                    kIterationsPerStep)
+{
+    mAllocator.setRecycleReleasedHandles(GetParam());
+
+    mHandles.resize(kHandleCount);
+    for (GLuint &handle : mHandles)
+    {
+        handle = mAllocator.allocate();
+    }
+
+    // Release the handles in an arbitrary order, like an application deleting objects whose
+    // lifetimes are unrelated.
+    std::mt19937 generator(0);
+    std::shuffle(mHandles.begin(), mHandles.end(), generator);
+}
+
+void HandleAllocatorPerfTest::step()
+{
+    for (int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        for (GLuint handle : mHandles)
+        {
+            mAllocator.release(handle);
+        }
+
+        for (GLuint &handle : mHandles)
+        {
+            handle = mAllocator.allocate();
+        }
+    }
+}
+
+TEST_P(HandleAllocatorPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(, HandleAllocatorPerfTest, ::testing::Values(false, true));
+}  // anonymous namespace
@@ -0,0 +1,125 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangePerf:
+//   Performance test for computing the range of client and buffer indices.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <gmock/gmock.h>
+
+#include <random>
+
+#include "common/utilities.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr size_t kIndexCount        = 30000;
+constexpr int kIterationsPerStep    = 10;
+constexpr unsigned int kRestartRate = 16;
+
+template <typename T>
+struct IndexTypeInfo;
+
+template <>
+struct IndexTypeInfo<GLubyte>
+{
+    static constexpr gl::DrawElementsType kType = gl::DrawElementsType::UnsignedByte;
+    static constexpr const char *kStory         = "_uint8";
+};
+
+template <>
+struct IndexTypeInfo<GLushort>
+{
+    static constexpr gl::DrawElementsType kType = gl::DrawElementsType::UnsignedShort;
+    static constexpr const char *kStory         = "_uint16";
+};
+
+template <>
+struct IndexTypeInfo<GLuint>
+{
+    static constexpr gl::DrawElementsType kType = gl::DrawElementsType::UnsignedInt;
+    static constexpr const char *kStory         = "_uint32";
+};
+
+template <typename T, bool kPrimitiveRestartEnabled>
+struct IndexRangeParams
+{
+    using IndexType = T;
+    static constexpr bool kPrimitiveRestart = kPrimitiveRestartEnabled;
+};
+
+template <typename Params>
+std::string GetStory()
+{
+    std::string story = IndexTypeInfo<typename Params::IndexType>::kStory;
+    if (Params::kPrimitiveRestart)
+    {
+        story += "_primitive_restart";
+    }
+    return story;
+}
+
+template <typename Params>
+class IndexRangePerfTest : public ANGLEPerfTest
+{
+  public:
+    using IndexType = typename Params::IndexType;
+
+    IndexRangePerfTest();
+
+    void step() override;
+
+  private:
+    std::vector<IndexType> mIndices;
+};
+
+template <typename Params>
+IndexRangePerfTest<Params>::IndexRangePerfTest()
+    : ANGLEPerfTest("IndexRangePerf", "", GetStory<Params>(), kIterationsPerStep),
+      mIndices(kIndexCount)
+{
+    // Scatter some restart indices among the others, similar to a triangle strip mesh.
+    std::mt19937 generator(0);
+    for (IndexType &index : mIndices)
+    {
+        index = static_cast<IndexType>(generator() % std::numeric_limits<IndexType>::max());
+        if (generator() % kRestartRate == 0)
+        {
+            index = static_cast<IndexType>(
+                gl::GetPrimitiveRestartIndex(IndexTypeInfo<IndexType>::kType));
+        }
+    }
+}
+
+template <typename Params>
+void IndexRangePerfTest<Params>::step()
+{
+    for (int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        gl::IndexRange range =
+            gl::ComputeIndexRange(IndexTypeInfo<IndexType>::kType, mIndices.data(),
+                                  mIndices.size(), Params::kPrimitiveRestart);
+        ANGLE_UNUSED_VARIABLE(range);
+    }
+}
+
+using TestTypes = Types<IndexRangeParams<GLubyte, false>,
+                        IndexRangeParams<GLubyte, true>,
+                        IndexRangeParams<GLushort, false>,
+                        IndexRangeParams<GLushort, true>,
+                        IndexRangeParams<GLuint, false>,
+                        IndexRangeParams<GLuint, true>>;
+TYPED_TEST_SUITE(IndexRangePerfTest, TestTypes);
+
+TYPED_TEST(IndexRangePerfTest, Run)
+{
+    this->run();
+}
+
+}  // anonymous namespace
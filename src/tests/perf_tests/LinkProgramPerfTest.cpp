@@ -10,7 +10,11 @@
 #include "ANGLEPerfTest.h"
 
 #include <array>
+#include <iostream>
 
+#include "ANGLEPerfTestArgs.h"
+#include "common/string_utils.h"
+#include "common/system_utils.h"
 #include "common/vector_utils.h"
 #include "util/shader_utils.h"
 
@@ -23,6 +27,7 @@ enum class TaskOption
 {
     CompileOnly,
     CompileAndLink,
+    CompileLinkAndDraw,
 
     Unspecified
 };
@@ -62,6 +67,10 @@ struct LinkProgramParams final : public RenderTestParams
         {
             strstr << "_compile_and_link";
         }
+        else if (taskOption == TaskOption::CompileLinkAndDraw)
+        {
+            strstr << "_compile_link_and_draw";
+        }
 
         if (threadOption == ThreadOption::SingleThread)
         {
@@ -172,6 +181,163 @@ void LinkProgramBenchmark::drawBenchmark()
     glDeleteProgram(program);
 }
 
+// Doesn't query the compile status, which would wait for a parallel compile to finish.
+GLuint StartCompileShader(GLenum type, const std::string &source)
+{
+    GLuint shader         = glCreateShader(type);
+    const char *sourceStr = source.c_str();
+    glShaderSource(shader, 1, &sourceStr, nullptr);
+    glCompileShader(shader);
+    return shader;
+}
+
+// Compiles and links every program of the corpus in --shader-corpus-dir each step.  The directory
+// has a programs.txt file listing one program name per line, and the shaders of each program in
+// <name>.vert and <name>.frag.
+//
+// All shaders are compiled before any is queried, and all programs are linked before any is
+// queried, so that the compile and link work can run in parallel when it's not disabled.  The
+// stages are measured by the task options: compiling includes the translation, linking includes
+// the back-end's shader transformation (e.g. SPIR-V), and drawing once with every program
+// includes the pipeline creation.
+class LinkProgramCorpusBenchmark : public ANGLERenderTest,
+                                   public ::testing::WithParamInterface<LinkProgramParams>
+{
+  public:
+    LinkProgramCorpusBenchmark();
+
+    void initializeBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    struct ProgramSources
+    {
+        std::string name;
+        std::string vertexShader;
+        std::string fragmentShader;
+    };
+
+    bool loadCorpus();
+
+    std::vector<ProgramSources> mCorpus;
+    bool mFailuresReported = false;
+};
+
+LinkProgramCorpusBenchmark::LinkProgramCorpusBenchmark()
+    : ANGLERenderTest("LinkProgramCorpus", GetParam())
+{
+    if (gShaderCorpusDir == nullptr)
+    {
+        mSkipTest = true;
+    }
+}
+
+bool LinkProgramCorpusBenchmark::loadCorpus()
+{
+    const std::string corpusDir = std::string(gShaderCorpusDir) + GetPathSeparator();
+
+    std::string programList;
+    if (!ReadFileToString(corpusDir + "programs.txt", &programList))
+    {
+        std::cerr << "Failed to read " << corpusDir << "programs.txt" << std::endl;
+        return false;
+    }
+
+    for (const std::string &name :
+         SplitString(programList, "\r\n", TRIM_WHITESPACE, SPLIT_WANT_NONEMPTY))
+    {
+        ProgramSources program;
+        program.name = name;
+        if (!ReadFileToString(corpusDir + name + ".vert", &program.vertexShader) ||
+            !ReadFileToString(corpusDir + name + ".frag", &program.fragmentShader))
+        {
+            std::cerr << "Failed to read the shaders of " << name << std::endl;
+            return false;
+        }
+        mCorpus.push_back(std::move(program));
+    }
+
+    return !mCorpus.empty();
+}
+
+void LinkProgramCorpusBenchmark::initializeBenchmark()
+{
+    if (GetParam().threadOption == ThreadOption::SingleThread)
+    {
+        glMaxShaderCompilerThreadsKHR(0);
+    }
+
+    ASSERT_TRUE(loadCorpus());
+}
+
+void LinkProgramCorpusBenchmark::drawBenchmark()
+{
+    const TaskOption taskOption = GetParam().taskOption;
+
+    std::vector<GLuint> shaders;
+    shaders.reserve(mCorpus.size() * 2);
+    for (const ProgramSources &program : mCorpus)
+    {
+        shaders.push_back(StartCompileShader(GL_VERTEX_SHADER, program.vertexShader));
+        shaders.push_back(StartCompileShader(GL_FRAGMENT_SHADER, program.fragmentShader));
+    }
+
+    size_t failureCount = 0;
+    std::vector<GLuint> programs;
+    if (taskOption == TaskOption::CompileOnly)
+    {
+        for (GLuint shader : shaders)
+        {
+            GLint compileStatus = GL_FALSE;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &compileStatus);
+            failureCount += compileStatus == GL_TRUE ? 0 : 1;
+        }
+    }
+    else
+    {
+        programs.reserve(mCorpus.size());
+        for (size_t programIndex = 0; programIndex < mCorpus.size(); ++programIndex)
+        {
+            GLuint program = glCreateProgram();
+            glAttachShader(program, shaders[programIndex * 2]);
+            glAttachShader(program, shaders[programIndex * 2 + 1]);
+            glLinkProgram(program);
+            programs.push_back(program);
+        }
+
+        for (GLuint program : programs)
+        {
+            GLint linkStatus = GL_FALSE;
+            glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+            if (linkStatus != GL_TRUE)
+            {
+                failureCount++;
+            }
+            else if (taskOption == TaskOption::CompileLinkAndDraw)
+            {
+                glUseProgram(program);
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            }
+        }
+    }
+
+    for (GLuint shader : shaders)
+    {
+        glDeleteShader(shader);
+    }
+    for (GLuint program : programs)
+    {
+        glDeleteProgram(program);
+    }
+
+    if (failureCount > 0 && !mFailuresReported)
+    {
+        std::cout << failureCount << " shaders or programs of the corpus failed to compile or link."
+                  << std::endl;
+        mFailuresReported = true;
+    }
+}
+
 using namespace egl_platform;
 
 LinkProgramParams LinkProgramD3D11Params(TaskOption taskOption, ThreadOption threadOption)
@@ -195,11 +361,46 @@ LinkProgramParams LinkProgramVulkanParams(TaskOption taskOption, ThreadOption th
     return params;
 }
 
+LinkProgramParams LinkProgramCorpusParams(const EGLPlatformParameters &eglParameters,
+                                          TaskOption taskOption,
+                                          ThreadOption threadOption)
+{
+    // Captured shaders are commonly ES 3.0 shaders.
+    LinkProgramParams params(taskOption, threadOption);
+    params.majorVersion  = 3;
+    params.eglParameters = eglParameters;
+    return params;
+}
+
+std::vector<LinkProgramParams> LinkProgramCorpusAllParams()
+{
+    std::vector<LinkProgramParams> allParams;
+    for (const EGLPlatformParameters &eglParameters : {D3D11(), OPENGL_OR_GLES(), VULKAN()})
+    {
+        for (TaskOption taskOption : {TaskOption::CompileOnly, TaskOption::CompileAndLink,
+                                      TaskOption::CompileLinkAndDraw})
+        {
+            for (ThreadOption threadOption :
+                 {ThreadOption::MultiThread, ThreadOption::SingleThread})
+            {
+                allParams.push_back(
+                    LinkProgramCorpusParams(eglParameters, taskOption, threadOption));
+            }
+        }
+    }
+    return allParams;
+}
+
 TEST_P(LinkProgramBenchmark, Run)
 {
     run();
 }
 
+TEST_P(LinkProgramCorpusBenchmark, Run)
+{
+    run();
+}
+
 ANGLE_INSTANTIATE_TEST(
     LinkProgramBenchmark,
     LinkProgramD3D11Params(TaskOption::CompileOnly, ThreadOption::MultiThread),
@@ -215,4 +416,6 @@ ANGLE_INSTANTIATE_TEST(
     LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread));
 
+ANGLE_INSTANTIATE_TEST_ARRAY(LinkProgramCorpusBenchmark, LinkProgramCorpusAllParams());
+
 }  // anonymous namespace
@@ -0,0 +1,362 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MultiDevicePerf:
+//   Performance tests for rendering on several GPUs from one process, with one display per GPU
+//   selected through EGL_ANGLE_platform_angle_device_id, and one thread per display.  The displays
+//   are surfaceless, as with the headless Vulkan display.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "DrawCallPerfParams.h"
+#include "test_utils/angle_test_instantiate.h"
+#include "util/EGLWindow.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kDrawsPerDevicePerStep = 20;
+constexpr GLsizei kFramebufferSize            = 512;
+
+constexpr char kVS[] = R"(attribute vec2 a_position;
+void main()
+{
+    gl_Position = vec4(a_position, 0, 1);
+})";
+
+// Enough ALU work per pixel that the draws are bound by the GPU.
+constexpr char kFS[] = R"(precision highp float;
+uniform vec4 u_color;
+void main()
+{
+    vec4 color = u_color;
+    for (int i = 0; i < 32; ++i)
+    {
+        color = fract(color * 1.618 + gl_FragCoord.xyxy * 0.001);
+    }
+    gl_FragColor = color;
+})";
+
+constexpr GLfloat kFullscreenTriangle[] = {-1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f};
+
+struct MultiDeviceParams final : public RenderTestParams
+{
+    MultiDeviceParams()
+    {
+        majorVersion      = 2;
+        minorVersion      = 0;
+        windowWidth       = 64;
+        windowHeight      = 64;
+        deviceCount       = 1;
+        iterationsPerStep = kDrawsPerDevicePerStep;
+    }
+
+    std::string story() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::story() << "_" << deviceCount << "_devices";
+        return strstr.str();
+    }
+
+    unsigned int deviceCount;
+};
+
+std::ostream &operator<<(std::ostream &os, const MultiDeviceParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+// Every step draws one batch on each device, in parallel, and waits for all devices to finish
+// it.  The reported time is per draw of all devices together, so it goes down with the device
+// count as long as the devices don't contend on anything in ANGLE.
+class MultiDeviceBenchmark : public ANGLERenderTest,
+                             public ::testing::WithParamInterface<MultiDeviceParams>
+{
+  public:
+    MultiDeviceBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    struct Worker
+    {
+        std::thread thread;
+        EGLDisplay display = EGL_NO_DISPLAY;
+        EGLContext context = EGL_NO_CONTEXT;
+        GLuint program     = 0;
+        GLuint buffer      = 0;
+        GLuint texture     = 0;
+        GLuint framebuffer = 0;
+    };
+
+    EGLWindow *getEGLWindow() { return static_cast<EGLWindow *>(getGLWindow()); }
+
+    bool initializeDisplay(uint32_t deviceIndex, Worker *worker);
+    void workerMain(size_t workerIndex);
+    bool initializeWorker(Worker *worker);
+    void destroyWorker(Worker *worker);
+    void drawWorkerBatch(const Worker &worker);
+
+    std::vector<Worker> mWorkers;
+
+    std::mutex mMutex;
+    std::condition_variable mStartCondition;
+    std::condition_variable mFinishCondition;
+    uint64_t mBatchSerial       = 0;
+    size_t mFinishedWorkerCount = 0;
+    bool mWorkerFailed          = false;
+    bool mExit                  = false;
+};
+
+MultiDeviceBenchmark::MultiDeviceBenchmark() : ANGLERenderTest("MultiDevice", GetParam())
+{
+    // Only the draws of the worker threads are measured.
+    disableTestHarnessSwap();
+
+    if (GetParam().driver != GLESDriverType::AngleEGL)
+    {
+        mSkipTest = true;
+    }
+}
+
+void MultiDeviceBenchmark::initializeBenchmark()
+{
+    const MultiDeviceParams &params = GetParam();
+
+    if (!IsEGLClientExtensionEnabled("EGL_ANGLE_platform_angle_device_id"))
+    {
+        printf("Test skipped: EGL_ANGLE_platform_angle_device_id is not supported.\n");
+        mSkipTest = true;
+        return;
+    }
+
+    mWorkers.resize(params.deviceCount);
+    for (uint32_t deviceIndex = 0; deviceIndex < params.deviceCount; ++deviceIndex)
+    {
+        if (!initializeDisplay(deviceIndex, &mWorkers[deviceIndex]))
+        {
+            printf("Test skipped: Device %u is not available.\n", deviceIndex);
+            mSkipTest = true;
+            return;
+        }
+    }
+
+    for (size_t workerIndex = 0; workerIndex < mWorkers.size(); ++workerIndex)
+    {
+        mWorkers[workerIndex].thread =
+            std::thread(&MultiDeviceBenchmark::workerMain, this, workerIndex);
+    }
+
+    // Wait for the workers to initialize their resources.
+    std::unique_lock<std::mutex> lock(mMutex);
+    mFinishCondition.wait(lock, [this]() { return mFinishedWorkerCount == mWorkers.size(); });
+    ASSERT_FALSE(mWorkerFailed);
+}
+
+bool MultiDeviceBenchmark::initializeDisplay(uint32_t deviceIndex, Worker *worker)
+{
+    const EGLAttrib displayAttributes[] = {EGL_PLATFORM_ANGLE_TYPE_ANGLE,
+                                           EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE,
+                                           EGL_PLATFORM_ANGLE_DEVICE_INDEX_ANGLE,
+                                           static_cast<EGLAttrib>(deviceIndex),
+                                           EGL_NONE};
+
+    worker->display = eglGetPlatformDisplay(EGL_PLATFORM_ANGLE_ANGLE,
+                                            reinterpret_cast<void *>(EGL_DEFAULT_DISPLAY),
+                                            displayAttributes);
+    if (worker->display == EGL_NO_DISPLAY ||
+        eglInitialize(worker->display, nullptr, nullptr) != EGL_TRUE)
+    {
+        return false;
+    }
+
+    // Each worker renders to its own framebuffer without a surface.
+    if (!IsEGLDisplayExtensionEnabled(worker->display, "EGL_KHR_surfaceless_context"))
+    {
+        return false;
+    }
+
+    const EGLint configAttributes[] = {EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT, EGL_NONE};
+    EGLConfig config                = nullptr;
+    EGLint configCount              = 0;
+    if (eglChooseConfig(worker->display, configAttributes, &config, 1, &configCount) != EGL_TRUE ||
+        configCount == 0)
+    {
+        return false;
+    }
+
+    const EGLint contextAttributes[] = {EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE};
+    worker->context = eglCreateContext(worker->display, config, EGL_NO_CONTEXT, contextAttributes);
+    return worker->context != EGL_NO_CONTEXT;
+}
+
+void MultiDeviceBenchmark::destroyBenchmark()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExit = true;
+    }
+    mStartCondition.notify_all();
+
+    for (Worker &worker : mWorkers)
+    {
+        if (worker.thread.joinable())
+        {
+            worker.thread.join();
+        }
+        if (worker.context != EGL_NO_CONTEXT)
+        {
+            eglDestroyContext(worker.display, worker.context);
+        }
+        // The display of the first device may be the test harness's.
+        if (worker.display != EGL_NO_DISPLAY && worker.display != getEGLWindow()->getDisplay())
+        {
+            eglTerminate(worker.display);
+        }
+    }
+    mWorkers.clear();
+}
+
+void MultiDeviceBenchmark::drawBenchmark()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mFinishedWorkerCount = 0;
+    mBatchSerial++;
+    mStartCondition.notify_all();
+    mFinishCondition.wait(lock, [this]() { return mFinishedWorkerCount == mWorkers.size(); });
+}
+
+void MultiDeviceBenchmark::workerMain(size_t workerIndex)
+{
+    Worker &worker = mWorkers[workerIndex];
+
+    bool initialized =
+        eglMakeCurrent(worker.display, EGL_NO_SURFACE, EGL_NO_SURFACE, worker.context) &&
+        initializeWorker(&worker);
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mWorkerFailed = mWorkerFailed || !initialized;
+        mFinishedWorkerCount++;
+    }
+    mFinishCondition.notify_all();
+
+    uint64_t batchSerial = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mStartCondition.wait(
+                lock, [this, batchSerial]() { return mExit || mBatchSerial != batchSerial; });
+            if (mExit)
+            {
+                break;
+            }
+            batchSerial = mBatchSerial;
+        }
+
+        if (initialized)
+        {
+            drawWorkerBatch(worker);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mFinishedWorkerCount++;
+        }
+        mFinishCondition.notify_all();
+    }
+
+    destroyWorker(&worker);
+    eglMakeCurrent(worker.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglReleaseThread();
+}
+
+bool MultiDeviceBenchmark::initializeWorker(Worker *worker)
+{
+    worker->program = CompileProgram(kVS, kFS);
+    if (worker->program == 0)
+    {
+        return false;
+    }
+    glUseProgram(worker->program);
+    glUniform4f(glGetUniformLocation(worker->program, "u_color"), 0.0f, 1.0f, 0.0f, 1.0f);
+
+    glGenBuffers(1, &worker->buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, worker->buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kFullscreenTriangle), kFullscreenTriangle,
+                 GL_STATIC_DRAW);
+
+    GLint positionLocation = glGetAttribLocation(worker->program, "a_position");
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    glGenTextures(1, &worker->texture);
+    glBindTexture(GL_TEXTURE_2D, worker->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kFramebufferSize, kFramebufferSize, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, nullptr);
+
+    glGenFramebuffers(1, &worker->framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, worker->framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, worker->texture,
+                           0);
+    glViewport(0, 0, kFramebufferSize, kFramebufferSize);
+
+    return glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE &&
+           glGetError() == GL_NO_ERROR;
+}
+
+void MultiDeviceBenchmark::destroyWorker(Worker *worker)
+{
+    glDeleteFramebuffers(1, &worker->framebuffer);
+    glDeleteTextures(1, &worker->texture);
+    glDeleteBuffers(1, &worker->buffer);
+    glDeleteProgram(worker->program);
+}
+
+void MultiDeviceBenchmark::drawWorkerBatch(const Worker &worker)
+{
+    for (unsigned int drawIndex = 0; drawIndex < kDrawsPerDevicePerStep; ++drawIndex)
+    {
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    // Wait for the GPU, so that the step time is the throughput of the devices.
+    glFinish();
+}
+
+MultiDeviceParams CombineDeviceCount(const MultiDeviceParams &in, unsigned int deviceCount)
+{
+    MultiDeviceParams out = in;
+    out.deviceCount       = deviceCount;
+    out.iterationsPerStep = deviceCount * kDrawsPerDevicePerStep;
+    return out;
+}
+
+TEST_P(MultiDeviceBenchmark, Run)
+{
+    run();
+}
+
+using namespace params;
+using P = MultiDeviceParams;
+
+std::vector<P> gWithRenderer = {Vulkan<P>(P())};
+std::vector<P> gWithDeviceCount =
+    CombineWithValues(gWithRenderer, {1u, 2u, 4u}, CombineDeviceCount);
+
+ANGLE_INSTANTIATE_TEST_ARRAY(MultiDeviceBenchmark, gWithDeviceCount);
+
+}  // anonymous namespace
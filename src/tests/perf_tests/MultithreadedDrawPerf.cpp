@@ -0,0 +1,427 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MultithreadedDrawPerf:
+//   Performance tests for draw calls and buffer updates issued concurrently from several threads,
+//   each with its own context.  Used to measure how ANGLE's locking scales with the thread count.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "DrawCallPerfParams.h"
+#include "test_utils/angle_test_instantiate.h"
+#include "util/EGLWindow.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kDrawsPerThreadPerStep = 50;
+constexpr GLsizei kFramebufferSize            = 16;
+
+// The single thread baseline that the scaling efficiency is relative to.
+constexpr double kBaselineTimeSeconds = 0.5;
+constexpr int kBaselineWarmupBatches  = 10;
+
+constexpr char kVS[] = R"(attribute vec2 a_position;
+void main()
+{
+    gl_Position = vec4(a_position, 0, 1);
+})";
+
+constexpr char kFS[] = R"(precision mediump float;
+uniform vec4 u_color;
+void main()
+{
+    gl_FragColor = u_color;
+})";
+
+constexpr GLfloat kTriangle[] = {-1.0f, -1.0f, 1.0f, -1.0f, 0.0f, 1.0f};
+
+struct MultithreadedDrawParams final : public RenderTestParams
+{
+    MultithreadedDrawParams()
+    {
+        majorVersion      = 2;
+        minorVersion      = 0;
+        windowWidth       = 64;
+        windowHeight      = 64;
+        threadCount       = 1;
+        sharedContexts    = false;
+        iterationsPerStep = kDrawsPerThreadPerStep;
+    }
+
+    std::string story() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::story() << "_" << threadCount << "_threads";
+        if (sharedContexts)
+        {
+            strstr << "_shared";
+        }
+        return strstr.str();
+    }
+
+    unsigned int threadCount;
+    bool sharedContexts;
+};
+
+std::ostream &operator<<(std::ostream &os, const MultithreadedDrawParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+// The main thread only dispatches batches of draws to the worker threads and waits for them.
+// Each step is one batch of every thread, so the reported time is per draw of all threads
+// together.
+class MultithreadedDrawBenchmark : public ANGLERenderTest,
+                                   public ::testing::WithParamInterface<MultithreadedDrawParams>
+{
+  public:
+    MultithreadedDrawBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+    void reportScalingEfficiency();
+
+  private:
+    struct Worker
+    {
+        std::thread thread;
+        EGLContext context = EGL_NO_CONTEXT;
+        GLuint program     = 0;
+        GLuint buffer      = 0;
+        GLuint texture     = 0;
+        GLuint framebuffer = 0;
+    };
+
+    EGLWindow *getEGLWindow() { return static_cast<EGLWindow *>(getGLWindow()); }
+
+    void workerMain(size_t workerIndex);
+    bool initializeWorker(Worker *worker);
+    void destroyWorker(Worker *worker);
+    void drawWorkerBatch(const Worker &worker);
+
+    // Runs one batch on each of the first |workerCount| workers and waits for them.
+    void runBatch(size_t workerCount);
+    void measureBaseline();
+
+    // Created on the main context.  Only used when the contexts are shared.
+    GLuint mSharedProgram = 0;
+
+    std::vector<Worker> mWorkers;
+
+    std::mutex mMutex;
+    std::condition_variable mStartCondition;
+    std::condition_variable mFinishCondition;
+    uint64_t mBatchSerial       = 0;
+    size_t mActiveWorkerCount   = 0;
+    size_t mFinishedWorkerCount = 0;
+    bool mWorkerFailed          = false;
+    bool mExit                  = false;
+
+    double mBaselineDrawsPerSecond = 0;
+};
+
+MultithreadedDrawBenchmark::MultithreadedDrawBenchmark()
+    : ANGLERenderTest("MultithreadedDraw", GetParam())
+{
+    // Only the draws of the worker threads are measured.
+    disableTestHarnessSwap();
+
+    if (GetParam().driver != GLESDriverType::AngleEGL)
+    {
+        mSkipTest = true;
+    }
+}
+
+void MultithreadedDrawBenchmark::initializeBenchmark()
+{
+    const MultithreadedDrawParams &params = GetParam();
+    EGLWindow *window                     = getEGLWindow();
+
+    // Each worker renders to its own framebuffer without a surface.
+    if (!IsEGLDisplayExtensionEnabled(window->getDisplay(), "EGL_KHR_surfaceless_context"))
+    {
+        printf("Test skipped: EGL_KHR_surfaceless_context is not supported.\n");
+        mSkipTest = true;
+        return;
+    }
+
+    if (params.sharedContexts)
+    {
+        mSharedProgram = CompileProgram(kVS, kFS);
+        ASSERT_NE(0u, mSharedProgram);
+        glUseProgram(mSharedProgram);
+        glUniform4f(glGetUniformLocation(mSharedProgram, "u_color"), 0.0f, 1.0f, 0.0f, 1.0f);
+        glFinish();
+    }
+
+    mWorkers.resize(params.threadCount);
+    for (Worker &worker : mWorkers)
+    {
+        worker.context =
+            window->createContext(params.sharedContexts ? window->getContext() : EGL_NO_CONTEXT);
+        ASSERT_NE(EGL_NO_CONTEXT, worker.context);
+    }
+
+    for (size_t workerIndex = 0; workerIndex < mWorkers.size(); ++workerIndex)
+    {
+        mWorkers[workerIndex].thread =
+            std::thread(&MultithreadedDrawBenchmark::workerMain, this, workerIndex);
+    }
+
+    // Wait for the workers to initialize their resources.
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mFinishCondition.wait(lock, [this]() { return mFinishedWorkerCount == mWorkers.size(); });
+        ASSERT_FALSE(mWorkerFailed);
+    }
+
+    measureBaseline();
+}
+
+void MultithreadedDrawBenchmark::destroyBenchmark()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExit = true;
+    }
+    mStartCondition.notify_all();
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    for (Worker &worker : mWorkers)
+    {
+        if (worker.thread.joinable())
+        {
+            worker.thread.join();
+        }
+        if (worker.context != EGL_NO_CONTEXT)
+        {
+            eglDestroyContext(display, worker.context);
+        }
+    }
+    mWorkers.clear();
+
+    glDeleteProgram(mSharedProgram);
+}
+
+void MultithreadedDrawBenchmark::drawBenchmark()
+{
+    runBatch(mWorkers.size());
+}
+
+void MultithreadedDrawBenchmark::runBatch(size_t workerCount)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mActiveWorkerCount   = workerCount;
+    mFinishedWorkerCount = 0;
+    mBatchSerial++;
+    mStartCondition.notify_all();
+    mFinishCondition.wait(lock,
+                          [this, workerCount]() { return mFinishedWorkerCount == workerCount; });
+}
+
+void MultithreadedDrawBenchmark::measureBaseline()
+{
+    for (int batch = 0; batch < kBaselineWarmupBatches; ++batch)
+    {
+        runBatch(1);
+    }
+
+    Timer timer;
+    timer.start();
+    uint64_t batchCount = 0;
+    while (timer.getElapsedTime() < kBaselineTimeSeconds)
+    {
+        runBatch(1);
+        batchCount++;
+    }
+    timer.stop();
+
+    mBaselineDrawsPerSecond =
+        static_cast<double>(batchCount * kDrawsPerThreadPerStep) / timer.getElapsedTime();
+}
+
+void MultithreadedDrawBenchmark::reportScalingEfficiency()
+{
+    if (mSkipTest || mBaselineDrawsPerSecond == 0 || getNumStepsPerformed() == 0)
+    {
+        return;
+    }
+
+    // The draws per second of all threads, compared to what the threads would achieve if each
+    // was as fast as a single thread alone.
+    const double threadCount = static_cast<double>(mWorkers.size());
+    const double drawsPerSecond =
+        static_cast<double>(getNumStepsPerformed()) * threadCount * kDrawsPerThreadPerStep /
+        mTimer.getElapsedTime();
+    const double efficiency = drawsPerSecond / (mBaselineDrawsPerSecond * threadCount);
+
+    mReporter->RegisterFyiMetric(".scaling_efficiency", "unitless");
+    mReporter->AddResult(".scaling_efficiency", efficiency);
+
+    if (gVerboseLogging)
+    {
+        printf("Draws per second: %.0lf (single thread: %.0lf). Scaling efficiency: %.2lf%%\n",
+               drawsPerSecond, mBaselineDrawsPerSecond, efficiency * 100.0);
+    }
+}
+
+void MultithreadedDrawBenchmark::workerMain(size_t workerIndex)
+{
+    Worker &worker     = mWorkers[workerIndex];
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    bool initialized = eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, worker.context) &&
+                       initializeWorker(&worker);
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mWorkerFailed = mWorkerFailed || !initialized;
+        mFinishedWorkerCount++;
+    }
+    mFinishCondition.notify_all();
+
+    uint64_t batchSerial = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mStartCondition.wait(lock, [this, workerIndex, batchSerial]() {
+                return mExit || (mBatchSerial != batchSerial && workerIndex < mActiveWorkerCount);
+            });
+            if (mExit)
+            {
+                break;
+            }
+            batchSerial = mBatchSerial;
+        }
+
+        if (initialized)
+        {
+            drawWorkerBatch(worker);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mFinishedWorkerCount++;
+        }
+        mFinishCondition.notify_all();
+    }
+
+    destroyWorker(&worker);
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglReleaseThread();
+}
+
+bool MultithreadedDrawBenchmark::initializeWorker(Worker *worker)
+{
+    if (mSharedProgram != 0)
+    {
+        worker->program = mSharedProgram;
+        glUseProgram(worker->program);
+    }
+    else
+    {
+        worker->program = CompileProgram(kVS, kFS);
+        if (worker->program == 0)
+        {
+            return false;
+        }
+        glUseProgram(worker->program);
+        glUniform4f(glGetUniformLocation(worker->program, "u_color"), 0.0f, 1.0f, 0.0f, 1.0f);
+    }
+
+    // Buffers are created per worker in both variants, so that the updates don't need to be
+    // synchronized across threads.
+    glGenBuffers(1, &worker->buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, worker->buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kTriangle), kTriangle, GL_DYNAMIC_DRAW);
+
+    GLint positionLocation = glGetAttribLocation(worker->program, "a_position");
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    glGenTextures(1, &worker->texture);
+    glBindTexture(GL_TEXTURE_2D, worker->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kFramebufferSize, kFramebufferSize, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, nullptr);
+
+    glGenFramebuffers(1, &worker->framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, worker->framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, worker->texture,
+                           0);
+    glViewport(0, 0, kFramebufferSize, kFramebufferSize);
+
+    return glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE &&
+           glGetError() == GL_NO_ERROR;
+}
+
+void MultithreadedDrawBenchmark::destroyWorker(Worker *worker)
+{
+    glDeleteFramebuffers(1, &worker->framebuffer);
+    glDeleteTextures(1, &worker->texture);
+    glDeleteBuffers(1, &worker->buffer);
+    if (worker->program != mSharedProgram)
+    {
+        glDeleteProgram(worker->program);
+    }
+}
+
+void MultithreadedDrawBenchmark::drawWorkerBatch(const Worker &worker)
+{
+    for (unsigned int drawIndex = 0; drawIndex < kDrawsPerThreadPerStep; ++drawIndex)
+    {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(kTriangle), kTriangle);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    glFlush();
+}
+
+MultithreadedDrawParams CombineThreadCount(const MultithreadedDrawParams &in,
+                                           unsigned int threadCount)
+{
+    MultithreadedDrawParams out = in;
+    out.threadCount             = threadCount;
+    out.iterationsPerStep       = threadCount * kDrawsPerThreadPerStep;
+    return out;
+}
+
+MultithreadedDrawParams CombineSharedContexts(const MultithreadedDrawParams &in,
+                                              bool sharedContexts)
+{
+    MultithreadedDrawParams out = in;
+    out.sharedContexts          = sharedContexts;
+    return out;
+}
+
+TEST_P(MultithreadedDrawBenchmark, Run)
+{
+    run();
+    reportScalingEfficiency();
+}
+
+using namespace params;
+using P = MultithreadedDrawParams;
+
+std::vector<P> gWithRenderer = CombineWithFuncs({P()}, {D3D11<P>, GL<P>, Vulkan<P>});
+std::vector<P> gWithThreadCount =
+    CombineWithValues(gWithRenderer, {1u, 2u, 4u, 8u}, CombineThreadCount);
+std::vector<P> gWithSharing =
+    CombineWithValues(gWithThreadCount, {false, true}, CombineSharedContexts);
+
+ANGLE_INSTANTIATE_TEST_ARRAY(MultithreadedDrawBenchmark, gWithSharing);
+
+}  // anonymous namespace
@@ -87,6 +87,7 @@ struct MultiviewPerfParams final : public RenderTestParams
         windowHeight       = workloadIn.second;
         multiviewOption    = multiviewOptionIn;
         numViews           = 2;
+        numLayers          = numViews;
         multiviewExtension = multiviewExtensionIn;
     }
 
@@ -123,11 +124,17 @@ struct MultiviewPerfParams final : public RenderTestParams
         }
         name += "_" + ext;
         name += "_" + ToString(numViews) + "_views";
+        if (numLayers != numViews)
+        {
+            name += "_" + ToString(numLayers) + "_layers";
+        }
         return name;
     }
 
     MultiviewOption multiviewOption;
     int numViews;
+    // Layers of the texture arrays, the views are the first numViews of them.
+    int numLayers;
     angle::ExtensionName multiviewExtension;
 };
 
@@ -249,12 +256,12 @@ void MultiviewBenchmark::initializeBenchmark()
         {
             // Multiview texture arrays
             glBindTexture(GL_TEXTURE_2D_ARRAY, mColorTexture);
-            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, params->windowWidth,
-                         params->windowHeight, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, params->windowWidth,
+                           params->windowHeight, params->numLayers);
 
             glBindTexture(GL_TEXTURE_2D_ARRAY, mDepthTexture);
-            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT32F, params->windowWidth,
-                         params->windowHeight, 2, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+            glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_DEPTH_COMPONENT32F, params->windowWidth,
+                           params->windowHeight, params->numLayers);
 
             glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
             glFramebufferTextureMultiviewOVR(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, mColorTexture, 0,
@@ -563,6 +570,19 @@ MultiviewPerfParams SelectViewInVertexShader(const EGLPlatformParameters &eglPar
                                MultiviewOption::InstancedMultiviewVertexShader,
                                multiviewExtensionIn);
 }
+
+// Only some layers of the texture arrays are attached, so clears can't simply clear the whole
+// layered framebuffer.
+MultiviewPerfParams SelectViewInVertexShaderPartialLayers(
+    const EGLPlatformParameters &eglParameters,
+    const MultiviewPerfWorkload &workload,
+    ExtensionName multiviewExtensionIn)
+{
+    MultiviewPerfParams params =
+        SelectViewInVertexShader(eglParameters, workload, multiviewExtensionIn);
+    params.numLayers = params.numViews + 2;
+    return params;
+}
 }  // namespace
 
 TEST_P(MultiviewCPUBoundBenchmark, Run)
@@ -585,7 +605,13 @@ ANGLE_INSTANTIATE_TEST(
     SelectViewInVertexShader(egl_platform::OPENGL_OR_GLES(),
                              SmallWorkload(),
                              ExtensionName::multiview2),
-    SelectViewInVertexShader(egl_platform::D3D11(), SmallWorkload(), ExtensionName::multiview2));
+    SelectViewInVertexShader(egl_platform::D3D11(), SmallWorkload(), ExtensionName::multiview2),
+    SelectViewInVertexShaderPartialLayers(egl_platform::OPENGL_OR_GLES(),
+                                          SmallWorkload(),
+                                          ExtensionName::multiview),
+    SelectViewInVertexShaderPartialLayers(egl_platform::OPENGL_OR_GLES(),
+                                          SmallWorkload(),
+                                          ExtensionName::multiview2));
 
 TEST_P(MultiviewGPUBoundBenchmark, Run)
 {
@@ -607,6 +633,12 @@ ANGLE_INSTANTIATE_TEST(
     SelectViewInVertexShader(egl_platform::OPENGL_OR_GLES(),
                              BigWorkload(),
                              ExtensionName::multiview2),
-    SelectViewInVertexShader(egl_platform::D3D11(), BigWorkload(), ExtensionName::multiview2));
+    SelectViewInVertexShader(egl_platform::D3D11(), BigWorkload(), ExtensionName::multiview2),
+    SelectViewInVertexShaderPartialLayers(egl_platform::OPENGL_OR_GLES(),
+                                          BigWorkload(),
+                                          ExtensionName::multiview),
+    SelectViewInVertexShaderPartialLayers(egl_platform::OPENGL_OR_GLES(),
+                                          BigWorkload(),
+                                          ExtensionName::multiview2));
 
 }  // anonymous namespace
@@ -0,0 +1,237 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SamplingProfiler.cpp:
+//   Implements the CPU sampling profiler with a profiling timer signal.
+//
+
+#include "SamplingProfiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+
+#include "common/debug.h"
+#include "common/platform.h"
+
+#if defined(ANGLE_PLATFORM_LINUX)
+#    include <cxxabi.h>
+#    include <dlfcn.h>
+#    include <errno.h>
+#    include <execinfo.h>
+#    include <signal.h>
+#    include <string.h>
+#    include <sys/time.h>
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+
+namespace angle
+{
+namespace
+{
+#if defined(ANGLE_PLATFORM_LINUX)
+constexpr size_t kMaxFramesPerSample = 48;
+constexpr long kSamplingIntervalUs   = 1000;
+
+// 30 seconds of CPU time at 1kHz.  Later samples are dropped.
+constexpr size_t kMaxSamples = 30000;
+
+// The signal handler and the signal trampoline.
+constexpr size_t kSkippedFrames = 2;
+
+// The sample storage of the running profiler, which the signal handler can't reach otherwise.
+void **gFrames       = nullptr;
+size_t *gFrameCounts = nullptr;
+std::atomic<size_t> gSampleCount(0);
+
+void OnProfilingSignal(int signal, siginfo_t *info, void *context)
+{
+    int savedErrno = errno;
+
+    size_t sampleIndex = gSampleCount.fetch_add(1, std::memory_order_relaxed);
+    if (sampleIndex < kMaxSamples)
+    {
+        int frameCount = backtrace(&gFrames[sampleIndex * kMaxFramesPerSample],
+                                   static_cast<int>(kMaxFramesPerSample));
+        gFrameCounts[sampleIndex] = static_cast<size_t>(frameCount);
+    }
+
+    errno = savedErrno;
+}
+
+std::string GetFunctionName(void *address)
+{
+    char buffer[64];
+
+    Dl_info info = {};
+    if (dladdr(address, &info) == 0)
+    {
+        snprintf(buffer, sizeof(buffer), "0x%" PRIxPTR, reinterpret_cast<uintptr_t>(address));
+        return buffer;
+    }
+
+    if (info.dli_sname != nullptr)
+    {
+        int status      = 0;
+        char *demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        std::string name(status == 0 ? demangled : info.dli_sname);
+        free(demangled);
+        return name;
+    }
+
+    // Functions that aren't exported only resolve to their module.
+    const char *moduleName = info.dli_fname != nullptr ? strrchr(info.dli_fname, '/') : nullptr;
+    moduleName = moduleName != nullptr ? moduleName + 1 : (info.dli_fname ? info.dli_fname : "?");
+    snprintf(buffer, sizeof(buffer), "%s+0x%" PRIxPTR, moduleName,
+             reinterpret_cast<uintptr_t>(address) - reinterpret_cast<uintptr_t>(info.dli_fbase));
+    return buffer;
+}
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+}  // anonymous namespace
+
+SamplingProfiler::SamplingProfiler() : mRunning(false) {}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    if (mRunning)
+    {
+        stop();
+    }
+}
+
+// static
+bool SamplingProfiler::IsSupported()
+{
+#if defined(ANGLE_PLATFORM_LINUX)
+    return true;
+#else
+    return false;
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+}
+
+bool SamplingProfiler::start()
+{
+    ASSERT(!mRunning);
+
+#if defined(ANGLE_PLATFORM_LINUX)
+    ASSERT(gFrames == nullptr || gFrames == mFrames.data());
+
+    if (mFrames.empty())
+    {
+        mFrames.resize(kMaxSamples * kMaxFramesPerSample, nullptr);
+        mFrameCounts.resize(kMaxSamples, 0);
+        gSampleCount = 0;
+    }
+    gFrames      = mFrames.data();
+    gFrameCounts = mFrameCounts.data();
+
+    // backtrace() loads libgcc the first time it is called, which isn't safe in a signal handler.
+    void *frame = nullptr;
+    backtrace(&frame, 1);
+
+    struct sigaction action = {};
+    action.sa_sigaction     = OnProfilingSignal;
+    action.sa_flags         = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, nullptr) != 0)
+    {
+        return false;
+    }
+
+    itimerval timer           = {};
+    timer.it_interval.tv_usec = kSamplingIntervalUs;
+    timer.it_value.tv_usec    = kSamplingIntervalUs;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0)
+    {
+        signal(SIGPROF, SIG_IGN);
+        return false;
+    }
+
+    mRunning = true;
+    return true;
+#else
+    return false;
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+}
+
+void SamplingProfiler::stop()
+{
+    ASSERT(mRunning);
+
+#if defined(ANGLE_PLATFORM_LINUX)
+    itimerval timer = {};
+    setitimer(ITIMER_PROF, &timer, nullptr);
+
+    // Ignoring the signal also discards one that is still pending.
+    signal(SIGPROF, SIG_IGN);
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+
+    mRunning = false;
+}
+
+size_t SamplingProfiler::getSampleCount() const
+{
+#if defined(ANGLE_PLATFORM_LINUX)
+    return mFrames.empty() ? 0 : std::min(gSampleCount.load(), kMaxSamples);
+#else
+    return 0;
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+}
+
+bool SamplingProfiler::writeCollapsedStacks(const std::string &path) const
+{
+    ASSERT(!mRunning);
+
+    std::map<void *, std::string> functionNames;
+    std::map<std::string, size_t> stackCounts;
+
+#if defined(ANGLE_PLATFORM_LINUX)
+    for (size_t sampleIndex = 0; sampleIndex < getSampleCount(); ++sampleIndex)
+    {
+        void *const *frames = &mFrames[sampleIndex * kMaxFramesPerSample];
+
+        std::string stack;
+        for (size_t frameIndex = mFrameCounts[sampleIndex]; frameIndex > kSkippedFrames;
+             --frameIndex)
+        {
+            void *address = frames[frameIndex - 1];
+
+            auto iter = functionNames.find(address);
+            if (iter == functionNames.end())
+            {
+                iter = functionNames.emplace(address, GetFunctionName(address)).first;
+            }
+
+            if (!stack.empty())
+            {
+                stack += ';';
+            }
+            stack += iter->second;
+        }
+
+        if (!stack.empty())
+        {
+            stackCounts[stack]++;
+        }
+    }
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+
+    FILE *fp = fopen(path.c_str(), "w");
+    if (!fp)
+    {
+        return false;
+    }
+
+    for (const auto &stackCount : stackCounts)
+    {
+        fprintf(fp, "%s %zu\n", stackCount.first.c_str(), stackCount.second);
+    }
+
+    fclose(fp);
+    return true;
+}
+}  // namespace angle
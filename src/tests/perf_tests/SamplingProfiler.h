@@ -0,0 +1,48 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SamplingProfiler.h:
+//   A CPU sampling profiler for the perf tests that writes its results as collapsed stacks, the
+//   input format of flame graph tools.
+//
+
+#ifndef PERF_TESTS_SAMPLING_PROFILER_H_
+#define PERF_TESTS_SAMPLING_PROFILER_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+// The process is sampled when it's using the CPU, on whichever thread is running.  Only one
+// profiler can be running at a time.  Only implemented on Linux.
+class SamplingProfiler final : angle::NonCopyable
+{
+  public:
+    SamplingProfiler();
+    ~SamplingProfiler();
+
+    static bool IsSupported();
+
+    // Samples are accumulated over all the start() and stop() pairs.
+    bool start();
+    void stop();
+
+    size_t getSampleCount() const;
+
+    // One line per unique stack, from the outermost function in, followed by its sample count.
+    bool writeCollapsedStacks(const std::string &path) const;
+
+  private:
+    bool mRunning;
+    std::vector<void *> mFrames;
+    std::vector<size_t> mFrameCounts;
+};
+}  // namespace angle
+
+#endif  // PERF_TESTS_SAMPLING_PROFILER_H_
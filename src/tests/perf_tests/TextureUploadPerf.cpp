@@ -32,6 +32,10 @@ struct TextureUploadParams final : public RenderTestParams
         baseSize     = 1024;
         subImageSize = 64;
 
+        internalFormat = GL_RGBA8;
+        format         = GL_RGBA;
+        type           = GL_UNSIGNED_BYTE;
+
         webgl = false;
     }
 
@@ -40,6 +44,13 @@ struct TextureUploadParams final : public RenderTestParams
     GLsizei baseSize;
     GLsizei subImageSize;
 
+    // The format of the sub image uploads.  Anything other than RGBA8 exercises a CPU conversion
+    // of the data before it's uploaded.
+    GLenum internalFormat;
+    GLenum format;
+    GLenum type;
+    std::string formatStory;
+
     bool webgl;
 };
 
@@ -53,7 +64,7 @@ std::string TextureUploadParams::story() const
 {
     std::stringstream strstr;
 
-    strstr << RenderTestParams::story();
+    strstr << RenderTestParams::story() << formatStory;
 
     if (webgl)
     {
@@ -95,10 +106,63 @@ class TextureUploadSubImageBenchmark : public TextureUploadBenchmarkBase
         TextureUploadBenchmarkBase::initializeBenchmark();
 
         const auto &params = GetParam();
-        glTexStorage2DEXT(GL_TEXTURE_2D, 1, GL_RGBA8, params.baseSize, params.baseSize);
+        glTexStorage2DEXT(GL_TEXTURE_2D, 1, params.internalFormat, params.baseSize,
+                          params.baseSize);
+    }
+
+    void drawBenchmark() override;
+};
+
+// Uploads several sub images into a texture attached to the bound framebuffer between draws.
+// Every upload notifies the framebuffer, which merges the repeated notifications before they
+// reach the context.
+class TextureUploadSubImageToAttachmentBenchmark : public TextureUploadBenchmarkBase
+{
+  public:
+    TextureUploadSubImageToAttachmentBenchmark()
+        : TextureUploadBenchmarkBase("TexSubImageToAttachment")
+    {
+        addExtensionPrerequisite("GL_EXT_texture_storage");
+    }
+
+    void initializeBenchmark() override
+    {
+        TextureUploadBenchmarkBase::initializeBenchmark();
+
+        const auto &params = GetParam();
+        glTexStorage2DEXT(GL_TEXTURE_2D, 1, GL_RGBA8, 1, 1);
+
+        glGenTextures(1, &mRenderTarget);
+        glBindTexture(GL_TEXTURE_2D, mRenderTarget);
+        glTexStorage2DEXT(GL_TEXTURE_2D, 1, params.internalFormat, params.baseSize,
+                          params.baseSize);
+
+        glGenFramebuffers(1, &mFramebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mRenderTarget,
+                               0);
+        glViewport(0, 0, params.baseSize, params.baseSize);
+
+        // Keep sampling the 1x1 texture so the draws don't form a feedback loop.
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void destroyBenchmark() override
+    {
+        glDeleteFramebuffers(1, &mFramebuffer);
+        glDeleteTextures(1, &mRenderTarget);
+        TextureUploadBenchmarkBase::destroyBenchmark();
     }
 
     void drawBenchmark() override;
+
+  private:
+    static constexpr unsigned int kSubImagesPerDraw = 8;
+
+    GLuint mRenderTarget = 0;
+    GLuint mFramebuffer  = 0;
 };
 
 class TextureUploadFullMipBenchmark : public TextureUploadBenchmarkBase
@@ -256,7 +320,7 @@ void TextureUploadSubImageBenchmark::drawBenchmark()
     {
         glTexSubImage2D(GL_TEXTURE_2D, 0, rand() % (params.baseSize - params.subImageSize),
                         rand() % (params.baseSize - params.subImageSize), params.subImageSize,
-                        params.subImageSize, GL_RGBA, GL_UNSIGNED_BYTE, mTextureData.data());
+                        params.subImageSize, params.format, params.type, mTextureData.data());
 
         // Perform a draw just so the texture data is flushed.  With the position attributes not
         // set, a constant default value is used, resulting in a very cheap draw.
@@ -267,6 +331,30 @@ void TextureUploadSubImageBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadSubImageToAttachmentBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    startGpuTimer();
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        glBindTexture(GL_TEXTURE_2D, mRenderTarget);
+        for (unsigned int subImage = 0; subImage < kSubImagesPerDraw; ++subImage)
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, rand() % (params.baseSize - params.subImageSize),
+                            rand() % (params.baseSize - params.subImageSize),
+                            params.subImageSize, params.subImageSize, params.format, params.type,
+                            mTextureData.data());
+        }
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void TextureUploadFullMipBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
@@ -355,6 +443,23 @@ TextureUploadParams VulkanParams(bool webglCompat)
     return params;
 }
 
+TextureUploadParams VulkanFormatParams(GLenum internalFormat,
+                                       GLenum format,
+                                       GLenum type,
+                                       const char *formatStory)
+{
+    TextureUploadParams params;
+    params.eglParameters  = egl_platform::VULKAN();
+    params.majorVersion   = 3;
+    params.minorVersion   = 0;
+    params.webgl          = false;
+    params.internalFormat = internalFormat;
+    params.format         = format;
+    params.type           = type;
+    params.formatStory    = formatStory;
+    return params;
+}
+
 TextureUploadParams VulkanPBOParams(GLsizei baseSize, GLsizei subImageSize)
 {
     TextureUploadParams params;
@@ -386,6 +491,11 @@ TEST_P(TextureUploadSubImageBenchmark, Run)
     run();
 }
 
+TEST_P(TextureUploadSubImageToAttachmentBenchmark, Run)
+{
+    run();
+}
+
 TEST_P(TextureUploadFullMipBenchmark, Run)
 {
     run();
@@ -410,7 +520,23 @@ ANGLE_INSTANTIATE_TEST(TextureUploadSubImageBenchmark,
                        OpenGLOrGLESParams(true),
                        VulkanParams(false),
                        NullDevice(VulkanParams(false)),
-                       VulkanParams(true));
+                       VulkanParams(true),
+                       VulkanFormatParams(GL_LUMINANCE8_EXT,
+                                          GL_LUMINANCE,
+                                          GL_UNSIGNED_BYTE,
+                                          "_luminance"),
+                       VulkanFormatParams(GL_LUMINANCE8_ALPHA8_EXT,
+                                          GL_LUMINANCE_ALPHA,
+                                          GL_UNSIGNED_BYTE,
+                                          "_luminance_alpha"),
+                       VulkanFormatParams(GL_ALPHA8_EXT, GL_ALPHA, GL_UNSIGNED_BYTE, "_alpha"),
+                       VulkanFormatParams(GL_RGB16F, GL_RGB, GL_FLOAT, "_rgb32f_to_rgb16f"),
+                       VulkanFormatParams(GL_RGBA16F, GL_RGBA, GL_FLOAT, "_rgba32f_to_rgba16f"));
+
+ANGLE_INSTANTIATE_TEST(TextureUploadSubImageToAttachmentBenchmark,
+                       OpenGLOrGLESParams(false),
+                       VulkanParams(false),
+                       NullDevice(VulkanParams(false)));
 
 ANGLE_INSTANTIATE_TEST(TextureUploadFullMipBenchmark,
                        D3D11Params(false),
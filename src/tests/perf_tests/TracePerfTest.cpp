@@ -20,6 +20,7 @@
 
 #include "restricted_traces/restricted_traces_autogen.h"
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <sstream>
@@ -100,11 +101,12 @@ class TracePerfTest : public ANGLERenderTest, public ::testing::WithParamInterfa
 
     double getHostTimeFromGLTime(GLint64 glTime);
 
+    uint32_t getStepFrame() const override { return mCurrentFrame; }
+
     int getStepAlignment() const override
     {
-        // Align step counts to the number of frames in a trace.
-        const TraceInfo &traceInfo = GetTraceInfo(GetParam().testID);
-        return static_cast<int>(traceInfo.endFrame - traceInfo.startFrame + 1);
+        // Align step counts to the number of frames in a loop of the trace.
+        return static_cast<int>(mEndFrame - mStartFrame + 1);
     }
 
   private:
@@ -994,6 +996,11 @@ void TracePerfTest::initializeBenchmark()
 
     mStartFrame = traceInfo.startFrame;
     mEndFrame   = traceInfo.endFrame;
+    if (gTraceLoopFrames > 0)
+    {
+        // Frames can only be replayed after the ones before them, so the loop can't start later.
+        mEndFrame = std::min(mEndFrame, mStartFrame + gTraceLoopFrames - 1);
+    }
     mTraceLibrary->setBinaryDataDecompressCallback(DecompressBinaryData);
 
     std::string relativeTestDataDir = std::string("src/tests/restricted_traces/") + traceInfo.name;
@@ -1068,7 +1075,7 @@ void TracePerfTest::initializeBenchmark()
 
     glFinish();
 
-    ASSERT_TRUE(mEndFrame > mStartFrame);
+    ASSERT_TRUE(mEndFrame >= mStartFrame);
 
     getWindow()->ignoreSizeEvents();
     getWindow()->setVisible(true);
@@ -35,6 +35,8 @@ enum DataMode
 enum DataType
 {
     VEC4,
+    // A single vec4 array per shader, each element set with its own glUniform4fv call.
+    VEC4_ARRAY,
     MAT3x3,
     MAT3x4,
     MAT4x4,
@@ -93,6 +95,10 @@ std::string UniformsParams::story() const
     {
         strstr << "_" << (numVertexUniforms + numFragmentUniforms) << "_vec4";
     }
+    else if (dataType == DataType::VEC4_ARRAY)
+    {
+        strstr << "_" << (numVertexUniforms + numFragmentUniforms) << "_vec4_array";
+    }
     else if (dataType == DataType::MAT3x3)
     {
         strstr << "_" << (numVertexUniforms + numFragmentUniforms) << "_mat3x3";
@@ -145,6 +151,8 @@ class UniformsBenchmark : public ANGLERenderTest,
 
     using MatrixData = std::array<std::vector<Matrix4>, 2>;
     MatrixData mMatrixData;
+
+    std::vector<GLfloat> mVectorData;
 };
 
 std::vector<Matrix4> GenMatrixData(size_t count, int parity)
@@ -247,6 +255,15 @@ void UniformsBenchmark::initializeBenchmark()
             mMatrixData[1] = GenMatrixData(count, 1);
         }
     }
+    else if (params.dataType == DataType::VEC4_ARRAY)
+    {
+        size_t count = params.numVertexUniforms + params.numFragmentUniforms;
+        for (size_t index = 0; index < count; ++index)
+        {
+            GLfloat value = static_cast<GLfloat>(index);
+            mVectorData.insert(mVectorData.end(), {value, value, value, value});
+        }
+    }
 
     GLint attribLocation = glGetAttribLocation(mPrograms[0], "pos");
     ASSERT_NE(-1, attribLocation);
@@ -263,6 +280,18 @@ std::string GetUniformLocationName(size_t idx, bool vertexShader)
     return strstr.str();
 }
 
+std::string GetUniformArrayName(bool vertexShader)
+{
+    return vertexShader ? "vs_u" : "fs_u";
+}
+
+std::string GetUniformArrayElementName(size_t idx, bool vertexShader)
+{
+    std::stringstream strstr;
+    strstr << GetUniformArrayName(vertexShader) << "[" << idx << "]";
+    return strstr.str();
+}
+
 void UniformsBenchmark::initShaders()
 {
     const auto &params = GetParam();
@@ -273,6 +302,7 @@ void UniformsBenchmark::initShaders()
     switch (params.dataType)
     {
         case DataType::VEC4:
+        case DataType::VEC4_ARRAY:
             typeString               = "vec4";
             uniformOperationTemplate = kUniformVarPlaceHolder;
             break;
@@ -299,9 +329,25 @@ void UniformsBenchmark::initShaders()
     vstrstr << "precision mediump float;\n";
     vstrstr << "in vec4 pos;\n";
 
-    for (size_t i = 0; i < params.numVertexUniforms; i++)
+    const bool isArray = params.dataType == DataType::VEC4_ARRAY;
+
+    auto getUniformName = [isArray](size_t idx, bool vertexShader) {
+        return isArray ? GetUniformArrayElementName(idx, vertexShader)
+                       : GetUniformLocationName(idx, vertexShader);
+    };
+
+    if (isArray)
+    {
+        vstrstr << "uniform " << typeString << " " << GetUniformArrayName(true) << "["
+                << params.numVertexUniforms << "];\n";
+    }
+    else
     {
-        vstrstr << "uniform " << typeString << " " << GetUniformLocationName(i, true) << ";\n";
+        for (size_t i = 0; i < params.numVertexUniforms; i++)
+        {
+            vstrstr << "uniform " << typeString << " " << GetUniformLocationName(i, true)
+                    << ";\n";
+        }
     }
 
     vstrstr << "void main()\n"
@@ -312,8 +358,7 @@ void UniformsBenchmark::initShaders()
         std::string uniformOperation = uniformOperationTemplate;
         std::size_t pos              = uniformOperation.find(kUniformVarPlaceHolder);
         ASSERT(pos != std::string::npos);
-        uniformOperation.replace(pos, kUniformVarPlaceHolder.size(),
-                                 GetUniformLocationName(i, true));
+        uniformOperation.replace(pos, kUniformVarPlaceHolder.size(), getUniformName(i, true));
         vstrstr << "    gl_Position += ";
         vstrstr << uniformOperation;
         vstrstr << ";\n";
@@ -325,9 +370,18 @@ void UniformsBenchmark::initShaders()
     fstrstr << "precision mediump float;\n";
     fstrstr << "out vec4 fragColor;\n";
 
-    for (size_t i = 0; i < params.numFragmentUniforms; i++)
+    if (isArray)
     {
-        fstrstr << "uniform " << typeString << " " << GetUniformLocationName(i, false) << ";\n";
+        fstrstr << "uniform " << typeString << " " << GetUniformArrayName(false) << "["
+                << params.numFragmentUniforms << "];\n";
+    }
+    else
+    {
+        for (size_t i = 0; i < params.numFragmentUniforms; i++)
+        {
+            fstrstr << "uniform " << typeString << " " << GetUniformLocationName(i, false)
+                    << ";\n";
+        }
     }
     fstrstr << "void main()\n"
                "{\n"
@@ -337,8 +391,7 @@ void UniformsBenchmark::initShaders()
         std::string uniformOperation = uniformOperationTemplate;
         std::size_t pos              = uniformOperation.find(kUniformVarPlaceHolder);
         ASSERT(pos != std::string::npos);
-        uniformOperation.replace(pos, kUniformVarPlaceHolder.size(),
-                                 GetUniformLocationName(i, false));
+        uniformOperation.replace(pos, kUniformVarPlaceHolder.size(), getUniformName(i, false));
         fstrstr << "    fragColor += ";
         fstrstr << uniformOperation;
         fstrstr << ";\n";
@@ -352,7 +405,7 @@ void UniformsBenchmark::initShaders()
 
     for (size_t i = 0; i < params.numVertexUniforms; ++i)
     {
-        std::string name = GetUniformLocationName(i, true);
+        std::string name = getUniformName(i, true);
         GLint location   = glGetUniformLocation(mPrograms[0], name.c_str());
         ASSERT_NE(-1, location);
         ASSERT_EQ(location, glGetUniformLocation(mPrograms[1], name.c_str()));
@@ -360,7 +413,7 @@ void UniformsBenchmark::initShaders()
     }
     for (size_t i = 0; i < params.numFragmentUniforms; ++i)
     {
-        std::string name = GetUniformLocationName(i, false);
+        std::string name = getUniformName(i, false);
         GLint location   = glGetUniformLocation(mPrograms[0], name.c_str());
         ASSERT_NE(-1, location);
         ASSERT_EQ(location, glGetUniformLocation(mPrograms[1], name.c_str()));
@@ -461,6 +514,16 @@ void UniformsBenchmark::drawBenchmark()
             }
             break;
         }
+        case DataType::VEC4_ARRAY:
+        {
+            auto setFunc = [this](const std::vector<GLuint> &locations,
+                                  const MatrixData &matrixData, size_t uniform, size_t frameIndex) {
+                glUniform4fv(locations[uniform], 1, &mVectorData[uniform * 4]);
+            };
+
+            drawLoop<false>(setFunc);
+            break;
+        }
         default:
             UNREACHABLE();
     }
@@ -481,6 +544,15 @@ UniformsParams VectorUniforms(const EGLPlatformParameters &egl,
     return params;
 }
 
+UniformsParams VectorArrayUniforms(const EGLPlatformParameters &egl)
+{
+    UniformsParams params;
+    params.eglParameters = egl;
+    params.dataType      = DataType::VEC4_ARRAY;
+    params.dataMode      = DataMode::UPDATE;
+    return params;
+}
+
 UniformsParams MatrixUniforms(const EGLPlatformParameters &egl,
                               DataMode dataMode,
                               DataType dataType,
@@ -529,4 +601,8 @@ ANGLE_INSTANTIATE_TEST(
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::UPDATE, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
-    VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE));
+    VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE),
+    VectorArrayUniforms(D3D11()),
+    VectorArrayUniforms(OPENGL_OR_GLES()),
+    VectorArrayUniforms(VULKAN()),
+    VectorArrayUniforms(VULKAN_NULL()));
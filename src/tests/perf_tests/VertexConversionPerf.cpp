@@ -0,0 +1,166 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VertexConversionPerf:
+//   Performance test for the CPU vertex format conversions used when a format is emulated.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+
+#include "libANGLE/renderer/copyvertex.h"
+
+namespace
+{
+constexpr size_t kVertexCount    = 10000;
+constexpr int kIterationsPerStep = 10;
+
+struct VertexConversionPerfParams
+{
+    rx::VertexCopyFunction copyFunction;
+    std::string story;
+    size_t inputStride;
+    size_t outputVertexSize;
+};
+
+std::ostream &operator<<(std::ostream &stream, const VertexConversionPerfParams &params)
+{
+    stream << params.story.substr(1);
+    return stream;
+}
+
+class VertexConversionPerfTest : public ANGLEPerfTest,
+                                 public ::testing::WithParamInterface<VertexConversionPerfParams>
+{
+  public:
+    VertexConversionPerfTest();
+
+    void step() override;
+
+  private:
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+VertexConversionPerfTest::VertexConversionPerfTest()
+    : ANGLEPerfTest("VertexConversionPerf", "", GetParam().story, kIterationsPerStep),
+      mInput(GetParam().inputStride * kVertexCount),
+      mOutput(GetParam().outputVertexSize * kVertexCount)
+{
+    std::mt19937 generator(0);
+    for (uint8_t &byte : mInput)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+}
+
+void VertexConversionPerfTest::step()
+{
+    const VertexConversionPerfParams &params = GetParam();
+
+    for (int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        params.copyFunction(mInput.data(), params.inputStride, kVertexCount, mOutput.data());
+    }
+}
+
+VertexConversionPerfParams Byte3NormToFloat4Params()
+{
+    VertexConversionPerfParams params;
+    params.copyFunction     = rx::CopyToFloatVertexData<GLbyte, 3, 4, true, false>;
+    params.story            = "_byte3_norm_to_float4";
+    params.inputStride      = 3;
+    params.outputVertexSize = 4 * sizeof(float);
+    return params;
+}
+
+VertexConversionPerfParams UnsignedByte3NormToFloat3Params()
+{
+    VertexConversionPerfParams params;
+    params.copyFunction     = rx::CopyToFloatVertexData<GLubyte, 3, 3, true, false>;
+    params.story            = "_ubyte3_norm_to_float3";
+    params.inputStride      = 3;
+    params.outputVertexSize = 3 * sizeof(float);
+    return params;
+}
+
+VertexConversionPerfParams Short3NormToFloat3Params()
+{
+    VertexConversionPerfParams params;
+    params.copyFunction     = rx::CopyToFloatVertexData<GLshort, 3, 3, true, false>;
+    params.story            = "_short3_norm_to_float3";
+    params.inputStride      = 3 * sizeof(GLshort);
+    params.outputVertexSize = 3 * sizeof(float);
+    return params;
+}
+
+VertexConversionPerfParams UnsignedShort2NormToFloat2Params()
+{
+    VertexConversionPerfParams params;
+    params.copyFunction     = rx::CopyToFloatVertexData<GLushort, 2, 2, true, false>;
+    params.story            = "_ushort2_norm_to_float2";
+    params.inputStride      = 2 * sizeof(GLushort);
+    params.outputVertexSize = 2 * sizeof(float);
+    return params;
+}
+
+VertexConversionPerfParams Short4ToFloat4Params()
+{
+    VertexConversionPerfParams params;
+    params.copyFunction     = rx::CopyToFloatVertexData<GLshort, 4, 4, false, false>;
+    params.story            = "_short4_to_float4";
+    params.inputStride      = 4 * sizeof(GLshort);
+    params.outputVertexSize = 4 * sizeof(float);
+    return params;
+}
+
+VertexConversionPerfParams Int3NormToFloat3Params()
+{
+    VertexConversionPerfParams params;
+    params.copyFunction     = rx::CopyToFloatVertexData<GLint, 3, 3, true, false>;
+    params.story            = "_int3_norm_to_float3";
+    params.inputStride      = 3 * sizeof(GLint);
+    params.outputVertexSize = 3 * sizeof(float);
+    return params;
+}
+
+VertexConversionPerfParams Fixed3ToFloat3Params()
+{
+    VertexConversionPerfParams params;
+    params.copyFunction     = rx::Copy32FixedTo32FVertexData<3, 3>;
+    params.story            = "_fixed3_to_float3";
+    params.inputStride      = 3 * sizeof(GLfixed);
+    params.outputVertexSize = 3 * sizeof(float);
+    return params;
+}
+
+VertexConversionPerfParams Short3ToHalf4Params()
+{
+    VertexConversionPerfParams params;
+    params.copyFunction     = rx::CopyToFloatVertexData<GLshort, 3, 4, false, true>;
+    params.story            = "_short3_to_half4";
+    params.inputStride      = 3 * sizeof(GLshort);
+    params.outputVertexSize = 4 * sizeof(GLhalf);
+    return params;
+}
+
+TEST_P(VertexConversionPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         VertexConversionPerfTest,
+                         ::testing::Values(Byte3NormToFloat4Params(),
+                                           UnsignedByte3NormToFloat3Params(),
+                                           Short3NormToFloat3Params(),
+                                           UnsignedShort2NormToFloat2Params(),
+                                           Short4ToFloat4Params(),
+                                           Int3NormToFloat3Params(),
+                                           Fixed3ToFloat3Params(),
+                                           Short3ToHalf4Params()));
+
+}  // anonymous namespace
@@ -871,6 +871,69 @@ TEST_F(DefineTest, UndefRedefine)
     preprocess(input, expected);
 }
 
+// Test that the expansion of an object-like macro follows the redefinitions of the macros in it.
+TEST_F(DefineTest, ObjRedefineNested)
+{
+    const char *input =
+        "#define foo bar\n"
+        "#define bar 1\n"
+        "foo\n"
+        "#undef bar\n"
+        "#define bar 2\n"
+        "foo foo\n"
+        "#undef bar\n"
+        "foo\n";
+    const char *expected =
+        "\n"
+        "\n"
+        "1\n"
+        "\n"
+        "\n"
+        "2 2\n"
+        "\n"
+        "bar\n";
+
+    preprocess(input, expected);
+}
+
+// Test that an object-like macro that expands to the name of a function-like macro is only
+// expanded further if the name is followed by a left parenthesis.
+TEST_F(DefineTest, ObjExpandingToFuncName)
+{
+    const char *input =
+        "#define foo(x) [x]\n"
+        "#define bar foo\n"
+        "bar(1) bar\n"
+        "bar (2)\n";
+    const char *expected =
+        "\n"
+        "\n"
+        "[1] foo\n"
+        "[2]\n";
+
+    preprocess(input, expected);
+}
+
+// Test that the macros in the expansion of an object-like macro are not expanded again, no matter
+// how many times the macro is used.
+TEST_F(DefineTest, ObjRecursiveRepeated)
+{
+    const char *input =
+        "#define foo bar foo\n"
+        "#define bar foo baz\n"
+        "foo foo\n"
+        "foo\n"
+        "  bar\n";
+    const char *expected =
+        "\n"
+        "\n"
+        "foo baz foo foo baz foo\n"
+        "foo baz foo\n"
+        " bar foo baz\n";
+
+    preprocess(input, expected);
+}
+
 // Example from C99 standard section 6.10.3.5 Scope of macro definitions
 TEST_F(DefineTest, C99Example)
 {
@@ -488,6 +488,7 @@ ANGLE_TRACE_LOADER_EXPORT PFNGLMULTIDRAWARRAYSINSTANCEDANGLEPROC t_glMultiDrawAr
 ANGLE_TRACE_LOADER_EXPORT PFNGLMULTIDRAWELEMENTSANGLEPROC t_glMultiDrawElementsANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLMULTIDRAWELEMENTSINSTANCEDANGLEPROC
     t_glMultiDrawElementsInstancedANGLE;
+ANGLE_TRACE_LOADER_EXPORT PFNGLPREWARMDRAWSTATEANGLEPROC t_glPrewarmDrawStateANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLPROVOKINGVERTEXANGLEPROC t_glProvokingVertexANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLDISABLEEXTENSIONANGLEPROC t_glDisableExtensionANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLREQUESTEXTENSIONANGLEPROC t_glRequestExtensionANGLE;
@@ -721,6 +722,7 @@ ANGLE_TRACE_LOADER_EXPORT PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC t_glProgramUnifo
 ANGLE_TRACE_LOADER_EXPORT PFNGLUSEPROGRAMSTAGESEXTPROC t_glUseProgramStagesEXT;
 ANGLE_TRACE_LOADER_EXPORT PFNGLVALIDATEPROGRAMPIPELINEEXTPROC t_glValidateProgramPipelineEXT;
 ANGLE_TRACE_LOADER_EXPORT PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC t_glFramebufferFetchBarrierEXT;
+ANGLE_TRACE_LOADER_EXPORT PFNGLTEXPAGECOMMITMENTEXTPROC t_glTexPageCommitmentEXT;
 ANGLE_TRACE_LOADER_EXPORT PFNGLPATCHPARAMETERIEXTPROC t_glPatchParameteriEXT;
 ANGLE_TRACE_LOADER_EXPORT PFNGLGETSAMPLERPARAMETERIIVEXTPROC t_glGetSamplerParameterIivEXT;
 ANGLE_TRACE_LOADER_EXPORT PFNGLGETSAMPLERPARAMETERIUIVEXTPROC t_glGetSamplerParameterIuivEXT;
@@ -1457,6 +1459,8 @@ ANGLE_TRACE_LOADER_EXPORT PFNGLMULTIDRAWELEMENTSANGLECONTEXTANGLEPROC
     t_glMultiDrawElementsANGLEContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLMULTIDRAWELEMENTSINSTANCEDANGLECONTEXTANGLEPROC
     t_glMultiDrawElementsInstancedANGLEContextANGLE;
+ANGLE_TRACE_LOADER_EXPORT PFNGLPREWARMDRAWSTATEANGLECONTEXTANGLEPROC
+    t_glPrewarmDrawStateANGLEContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLPROVOKINGVERTEXANGLECONTEXTANGLEPROC
     t_glProvokingVertexANGLEContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLDISABLEEXTENSIONANGLECONTEXTANGLEPROC
@@ -1825,6 +1829,8 @@ ANGLE_TRACE_LOADER_EXPORT PFNGLVALIDATEPROGRAMPIPELINEEXTCONTEXTANGLEPROC
     t_glValidateProgramPipelineEXTContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLFRAMEBUFFERFETCHBARRIEREXTCONTEXTANGLEPROC
     t_glFramebufferFetchBarrierEXTContextANGLE;
+ANGLE_TRACE_LOADER_EXPORT PFNGLTEXPAGECOMMITMENTEXTCONTEXTANGLEPROC
+    t_glTexPageCommitmentEXTContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLPATCHPARAMETERIEXTCONTEXTANGLEPROC
     t_glPatchParameteriEXTContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLGETSAMPLERPARAMETERIIVEXTCONTEXTANGLEPROC
@@ -2692,6 +2698,8 @@ void LoadGLES(LoadProc loadProc)
     t_glMultiDrawElementsInstancedANGLE =
         reinterpret_cast<PFNGLMULTIDRAWELEMENTSINSTANCEDANGLEPROC>(
             loadProc("glMultiDrawElementsInstancedANGLE"));
+    t_glPrewarmDrawStateANGLE =
+        reinterpret_cast<PFNGLPREWARMDRAWSTATEANGLEPROC>(loadProc("glPrewarmDrawStateANGLE"));
     t_glProvokingVertexANGLE =
         reinterpret_cast<PFNGLPROVOKINGVERTEXANGLEPROC>(loadProc("glProvokingVertexANGLE"));
     t_glDisableExtensionANGLE =
@@ -3099,6 +3107,8 @@ void LoadGLES(LoadProc loadProc)
         loadProc("glValidateProgramPipelineEXT"));
     t_glFramebufferFetchBarrierEXT = reinterpret_cast<PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC>(
         loadProc("glFramebufferFetchBarrierEXT"));
+    t_glTexPageCommitmentEXT =
+        reinterpret_cast<PFNGLTEXPAGECOMMITMENTEXTPROC>(loadProc("glTexPageCommitmentEXT"));
     t_glPatchParameteriEXT =
         reinterpret_cast<PFNGLPATCHPARAMETERIEXTPROC>(loadProc("glPatchParameteriEXT"));
     t_glGetSamplerParameterIivEXT = reinterpret_cast<PFNGLGETSAMPLERPARAMETERIIVEXTPROC>(
@@ -4347,6 +4357,9 @@ void LoadGLES(LoadProc loadProc)
     t_glMultiDrawElementsInstancedANGLEContextANGLE =
         reinterpret_cast<PFNGLMULTIDRAWELEMENTSINSTANCEDANGLECONTEXTANGLEPROC>(
             loadProc("glMultiDrawElementsInstancedANGLEContextANGLE"));
+    t_glPrewarmDrawStateANGLEContextANGLE =
+        reinterpret_cast<PFNGLPREWARMDRAWSTATEANGLECONTEXTANGLEPROC>(
+            loadProc("glPrewarmDrawStateANGLEContextANGLE"));
     t_glProvokingVertexANGLEContextANGLE =
         reinterpret_cast<PFNGLPROVOKINGVERTEXANGLECONTEXTANGLEPROC>(
             loadProc("glProvokingVertexANGLEContextANGLE"));
@@ -4910,6 +4923,9 @@ void LoadGLES(LoadProc loadProc)
     t_glFramebufferFetchBarrierEXTContextANGLE =
         reinterpret_cast<PFNGLFRAMEBUFFERFETCHBARRIEREXTCONTEXTANGLEPROC>(
             loadProc("glFramebufferFetchBarrierEXTContextANGLE"));
+    t_glTexPageCommitmentEXTContextANGLE =
+        reinterpret_cast<PFNGLTEXPAGECOMMITMENTEXTCONTEXTANGLEPROC>(
+            loadProc("glTexPageCommitmentEXTContextANGLE"));
     t_glPatchParameteriEXTContextANGLE = reinterpret_cast<PFNGLPATCHPARAMETERIEXTCONTEXTANGLEPROC>(
         loadProc("glPatchParameteriEXTContextANGLE"));
     t_glGetSamplerParameterIivEXTContextANGLE =
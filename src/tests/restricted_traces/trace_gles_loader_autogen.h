@@ -487,6 +487,7 @@
 #define glMultiDrawArraysInstancedANGLE t_glMultiDrawArraysInstancedANGLE
 #define glMultiDrawElementsANGLE t_glMultiDrawElementsANGLE
 #define glMultiDrawElementsInstancedANGLE t_glMultiDrawElementsInstancedANGLE
+#define glPrewarmDrawStateANGLE t_glPrewarmDrawStateANGLE
 #define glProvokingVertexANGLE t_glProvokingVertexANGLE
 #define glDisableExtensionANGLE t_glDisableExtensionANGLE
 #define glRequestExtensionANGLE t_glRequestExtensionANGLE
@@ -687,6 +688,7 @@
 #define glUseProgramStagesEXT t_glUseProgramStagesEXT
 #define glValidateProgramPipelineEXT t_glValidateProgramPipelineEXT
 #define glFramebufferFetchBarrierEXT t_glFramebufferFetchBarrierEXT
+#define glTexPageCommitmentEXT t_glTexPageCommitmentEXT
 #define glPatchParameteriEXT t_glPatchParameteriEXT
 #define glGetSamplerParameterIivEXT t_glGetSamplerParameterIivEXT
 #define glGetSamplerParameterIuivEXT t_glGetSamplerParameterIuivEXT
@@ -1279,6 +1281,7 @@
 #define glMultiDrawElementsANGLEContextANGLE t_glMultiDrawElementsANGLEContextANGLE
 #define glMultiDrawElementsInstancedANGLEContextANGLE \
     t_glMultiDrawElementsInstancedANGLEContextANGLE
+#define glPrewarmDrawStateANGLEContextANGLE t_glPrewarmDrawStateANGLEContextANGLE
 #define glProvokingVertexANGLEContextANGLE t_glProvokingVertexANGLEContextANGLE
 #define glDisableExtensionANGLEContextANGLE t_glDisableExtensionANGLEContextANGLE
 #define glRequestExtensionANGLEContextANGLE t_glRequestExtensionANGLEContextANGLE
@@ -1503,6 +1506,7 @@
 #define glUseProgramStagesEXTContextANGLE t_glUseProgramStagesEXTContextANGLE
 #define glValidateProgramPipelineEXTContextANGLE t_glValidateProgramPipelineEXTContextANGLE
 #define glFramebufferFetchBarrierEXTContextANGLE t_glFramebufferFetchBarrierEXTContextANGLE
+#define glTexPageCommitmentEXTContextANGLE t_glTexPageCommitmentEXTContextANGLE
 #define glPatchParameteriEXTContextANGLE t_glPatchParameteriEXTContextANGLE
 #define glGetSamplerParameterIivEXTContextANGLE t_glGetSamplerParameterIivEXTContextANGLE
 #define glGetSamplerParameterIuivEXTContextANGLE t_glGetSamplerParameterIuivEXTContextANGLE
@@ -2106,6 +2110,7 @@ ANGLE_TRACE_LOADER_EXPORT extern PFNGLMULTIDRAWARRAYSINSTANCEDANGLEPROC
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLMULTIDRAWELEMENTSANGLEPROC t_glMultiDrawElementsANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLMULTIDRAWELEMENTSINSTANCEDANGLEPROC
     t_glMultiDrawElementsInstancedANGLE;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLPREWARMDRAWSTATEANGLEPROC t_glPrewarmDrawStateANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLPROVOKINGVERTEXANGLEPROC t_glProvokingVertexANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLDISABLEEXTENSIONANGLEPROC t_glDisableExtensionANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLREQUESTEXTENSIONANGLEPROC t_glRequestExtensionANGLE;
@@ -2368,6 +2373,7 @@ ANGLE_TRACE_LOADER_EXPORT extern PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLUSEPROGRAMSTAGESEXTPROC t_glUseProgramStagesEXT;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLVALIDATEPROGRAMPIPELINEEXTPROC t_glValidateProgramPipelineEXT;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC t_glFramebufferFetchBarrierEXT;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLTEXPAGECOMMITMENTEXTPROC t_glTexPageCommitmentEXT;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLPATCHPARAMETERIEXTPROC t_glPatchParameteriEXT;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLGETSAMPLERPARAMETERIIVEXTPROC t_glGetSamplerParameterIivEXT;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLGETSAMPLERPARAMETERIUIVEXTPROC t_glGetSamplerParameterIuivEXT;
@@ -3193,6 +3199,8 @@ ANGLE_TRACE_LOADER_EXPORT extern PFNGLMULTIDRAWELEMENTSANGLECONTEXTANGLEPROC
     t_glMultiDrawElementsANGLEContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLMULTIDRAWELEMENTSINSTANCEDANGLECONTEXTANGLEPROC
     t_glMultiDrawElementsInstancedANGLEContextANGLE;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLPREWARMDRAWSTATEANGLECONTEXTANGLEPROC
+    t_glPrewarmDrawStateANGLEContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLPROVOKINGVERTEXANGLECONTEXTANGLEPROC
     t_glProvokingVertexANGLEContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLDISABLEEXTENSIONANGLECONTEXTANGLEPROC
@@ -3576,6 +3584,8 @@ ANGLE_TRACE_LOADER_EXPORT extern PFNGLVALIDATEPROGRAMPIPELINEEXTCONTEXTANGLEPROC
     t_glValidateProgramPipelineEXTContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLFRAMEBUFFERFETCHBARRIEREXTCONTEXTANGLEPROC
     t_glFramebufferFetchBarrierEXTContextANGLE;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLTEXPAGECOMMITMENTEXTCONTEXTANGLEPROC
+    t_glTexPageCommitmentEXTContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLPATCHPARAMETERIEXTCONTEXTANGLEPROC
     t_glPatchParameteriEXTContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLGETSAMPLERPARAMETERIIVEXTCONTEXTANGLEPROC
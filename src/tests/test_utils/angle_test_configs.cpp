@@ -273,6 +273,21 @@ std::ostream &operator<<(std::ostream &stream, const PlatformParameters &pp)
         stream << "_EmulatedVAOs";
     }
 
+    if (pp.eglParameters.forceCPUPathForGenerateMipmapFeature == EGL_TRUE)
+    {
+        stream << "_ForceCPUGenerateMipmap";
+    }
+
+    if (pp.eglParameters.recordDeferredCommandsFeature == EGL_TRUE)
+    {
+        stream << "_RecordDeferredCommands";
+    }
+
+    if (pp.eglParameters.cacheTranslatedShadersFeature == EGL_TRUE)
+    {
+        stream << "_CacheTranslatedShaders";
+    }
+
     return stream;
 }
 
@@ -245,6 +245,20 @@ inline PlatformParameters WithNoGenMultipleMipsPerPass(const PlatformParameters
     return re;
 }
 
+inline PlatformParameters WithRecordDeferredCommands(const PlatformParameters &params)
+{
+    PlatformParameters re                          = params;
+    re.eglParameters.recordDeferredCommandsFeature = EGL_TRUE;
+    return re;
+}
+
+inline PlatformParameters WithCacheTranslatedShaders(const PlatformParameters &params)
+{
+    PlatformParameters re                          = params;
+    re.eglParameters.cacheTranslatedShadersFeature = EGL_TRUE;
+    return re;
+}
+
 inline PlatformParameters WithMetalMemoryBarrierAndCheapRenderPass(const PlatformParameters &params,
                                                                    bool hasBarrier,
                                                                    bool cheapRenderPass)
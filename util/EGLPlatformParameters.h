@@ -64,7 +64,9 @@ struct EGLPlatformParameters
                         shaderStencilOutputFeature, genMultipleMipsPerPassFeature, platformMethods,
                         robustness, emulatedPrerotation, asyncCommandQueueFeatureVulkan,
                         hasExplicitMemBarrierFeatureMtl, hasCheapRenderPassFeatureMtl,
-                        forceBufferGPUStorageFeatureMtl, supportsVulkanViewportFlip, emulatedVAOs);
+                        forceBufferGPUStorageFeatureMtl, supportsVulkanViewportFlip, emulatedVAOs,
+                        forceCPUPathForGenerateMipmapFeature, recordDeferredCommandsFeature,
+                        cacheTranslatedShadersFeature, discardDrawCallsFeature);
     }
 
     EGLint renderer                               = EGL_PLATFORM_ANGLE_TYPE_DEFAULT_ANGLE;
@@ -87,6 +89,10 @@ struct EGLPlatformParameters
     EGLint forceBufferGPUStorageFeatureMtl        = EGL_DONT_CARE;
     EGLint supportsVulkanViewportFlip             = EGL_DONT_CARE;
     EGLint emulatedVAOs                           = EGL_DONT_CARE;
+    EGLint forceCPUPathForGenerateMipmapFeature   = EGL_DONT_CARE;
+    EGLint recordDeferredCommandsFeature          = EGL_DONT_CARE;
+    EGLint cacheTranslatedShadersFeature          = EGL_DONT_CARE;
+    EGLint discardDrawCallsFeature                = EGL_DONT_CARE;
     angle::PlatformMethods *platformMethods       = nullptr;
 };
 
@@ -273,6 +273,26 @@ bool EGLWindow::initializeDisplay(OSWindow *osWindow,
         enabledFeatureOverrides.push_back("sync_vertex_arrays_to_default");
     }
 
+    if (params.forceCPUPathForGenerateMipmapFeature == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("forceCPUPathForGenerateMipmap");
+    }
+
+    if (params.recordDeferredCommandsFeature == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("record_deferred_commands");
+    }
+
+    if (params.cacheTranslatedShadersFeature == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("cache_translated_shaders");
+    }
+
+    if (params.discardDrawCallsFeature == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("discard_draw_calls");
+    }
+
     const bool hasFeatureControlANGLE =
         strstr(extensionString, "EGL_ANGLE_feature_control") != nullptr;
 
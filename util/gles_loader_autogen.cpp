@@ -485,6 +485,7 @@ ANGLE_UTIL_EXPORT PFNGLMULTIDRAWARRAYSANGLEPROC l_glMultiDrawArraysANGLE;
 ANGLE_UTIL_EXPORT PFNGLMULTIDRAWARRAYSINSTANCEDANGLEPROC l_glMultiDrawArraysInstancedANGLE;
 ANGLE_UTIL_EXPORT PFNGLMULTIDRAWELEMENTSANGLEPROC l_glMultiDrawElementsANGLE;
 ANGLE_UTIL_EXPORT PFNGLMULTIDRAWELEMENTSINSTANCEDANGLEPROC l_glMultiDrawElementsInstancedANGLE;
+ANGLE_UTIL_EXPORT PFNGLPREWARMDRAWSTATEANGLEPROC l_glPrewarmDrawStateANGLE;
 ANGLE_UTIL_EXPORT PFNGLPROVOKINGVERTEXANGLEPROC l_glProvokingVertexANGLE;
 ANGLE_UTIL_EXPORT PFNGLDISABLEEXTENSIONANGLEPROC l_glDisableExtensionANGLE;
 ANGLE_UTIL_EXPORT PFNGLREQUESTEXTENSIONANGLEPROC l_glRequestExtensionANGLE;
@@ -695,6 +696,7 @@ ANGLE_UTIL_EXPORT PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC l_glProgramUniformMatrix
 ANGLE_UTIL_EXPORT PFNGLUSEPROGRAMSTAGESEXTPROC l_glUseProgramStagesEXT;
 ANGLE_UTIL_EXPORT PFNGLVALIDATEPROGRAMPIPELINEEXTPROC l_glValidateProgramPipelineEXT;
 ANGLE_UTIL_EXPORT PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC l_glFramebufferFetchBarrierEXT;
+ANGLE_UTIL_EXPORT PFNGLTEXPAGECOMMITMENTEXTPROC l_glTexPageCommitmentEXT;
 ANGLE_UTIL_EXPORT PFNGLPATCHPARAMETERIEXTPROC l_glPatchParameteriEXT;
 ANGLE_UTIL_EXPORT PFNGLGETSAMPLERPARAMETERIIVEXTPROC l_glGetSamplerParameterIivEXT;
 ANGLE_UTIL_EXPORT PFNGLGETSAMPLERPARAMETERIUIVEXTPROC l_glGetSamplerParameterIuivEXT;
@@ -1350,6 +1352,7 @@ ANGLE_UTIL_EXPORT PFNGLMULTIDRAWELEMENTSANGLECONTEXTANGLEPROC
     l_glMultiDrawElementsANGLEContextANGLE;
 ANGLE_UTIL_EXPORT PFNGLMULTIDRAWELEMENTSINSTANCEDANGLECONTEXTANGLEPROC
     l_glMultiDrawElementsInstancedANGLEContextANGLE;
+ANGLE_UTIL_EXPORT PFNGLPREWARMDRAWSTATEANGLECONTEXTANGLEPROC l_glPrewarmDrawStateANGLEContextANGLE;
 ANGLE_UTIL_EXPORT PFNGLPROVOKINGVERTEXANGLECONTEXTANGLEPROC l_glProvokingVertexANGLEContextANGLE;
 ANGLE_UTIL_EXPORT PFNGLDISABLEEXTENSIONANGLECONTEXTANGLEPROC l_glDisableExtensionANGLEContextANGLE;
 ANGLE_UTIL_EXPORT PFNGLREQUESTEXTENSIONANGLECONTEXTANGLEPROC l_glRequestExtensionANGLEContextANGLE;
@@ -1662,6 +1665,7 @@ ANGLE_UTIL_EXPORT PFNGLVALIDATEPROGRAMPIPELINEEXTCONTEXTANGLEPROC
     l_glValidateProgramPipelineEXTContextANGLE;
 ANGLE_UTIL_EXPORT PFNGLFRAMEBUFFERFETCHBARRIEREXTCONTEXTANGLEPROC
     l_glFramebufferFetchBarrierEXTContextANGLE;
+ANGLE_UTIL_EXPORT PFNGLTEXPAGECOMMITMENTEXTCONTEXTANGLEPROC l_glTexPageCommitmentEXTContextANGLE;
 ANGLE_UTIL_EXPORT PFNGLPATCHPARAMETERIEXTCONTEXTANGLEPROC l_glPatchParameteriEXTContextANGLE;
 ANGLE_UTIL_EXPORT PFNGLGETSAMPLERPARAMETERIIVEXTCONTEXTANGLEPROC
     l_glGetSamplerParameterIivEXTContextANGLE;
@@ -2503,6 +2507,8 @@ void LoadGLES(LoadProc loadProc)
     l_glMultiDrawElementsInstancedANGLE =
         reinterpret_cast<PFNGLMULTIDRAWELEMENTSINSTANCEDANGLEPROC>(
             loadProc("glMultiDrawElementsInstancedANGLE"));
+    l_glPrewarmDrawStateANGLE =
+        reinterpret_cast<PFNGLPREWARMDRAWSTATEANGLEPROC>(loadProc("glPrewarmDrawStateANGLE"));
     l_glProvokingVertexANGLE =
         reinterpret_cast<PFNGLPROVOKINGVERTEXANGLEPROC>(loadProc("glProvokingVertexANGLE"));
     l_glDisableExtensionANGLE =
@@ -2910,6 +2916,8 @@ void LoadGLES(LoadProc loadProc)
         loadProc("glValidateProgramPipelineEXT"));
     l_glFramebufferFetchBarrierEXT = reinterpret_cast<PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC>(
         loadProc("glFramebufferFetchBarrierEXT"));
+    l_glTexPageCommitmentEXT =
+        reinterpret_cast<PFNGLTEXPAGECOMMITMENTEXTPROC>(loadProc("glTexPageCommitmentEXT"));
     l_glPatchParameteriEXT =
         reinterpret_cast<PFNGLPATCHPARAMETERIEXTPROC>(loadProc("glPatchParameteriEXT"));
     l_glGetSamplerParameterIivEXT = reinterpret_cast<PFNGLGETSAMPLERPARAMETERIIVEXTPROC>(
@@ -4158,6 +4166,9 @@ void LoadGLES(LoadProc loadProc)
     l_glMultiDrawElementsInstancedANGLEContextANGLE =
         reinterpret_cast<PFNGLMULTIDRAWELEMENTSINSTANCEDANGLECONTEXTANGLEPROC>(
             loadProc("glMultiDrawElementsInstancedANGLEContextANGLE"));
+    l_glPrewarmDrawStateANGLEContextANGLE =
+        reinterpret_cast<PFNGLPREWARMDRAWSTATEANGLECONTEXTANGLEPROC>(
+            loadProc("glPrewarmDrawStateANGLEContextANGLE"));
     l_glProvokingVertexANGLEContextANGLE =
         reinterpret_cast<PFNGLPROVOKINGVERTEXANGLECONTEXTANGLEPROC>(
             loadProc("glProvokingVertexANGLEContextANGLE"));
@@ -4721,6 +4732,9 @@ void LoadGLES(LoadProc loadProc)
     l_glFramebufferFetchBarrierEXTContextANGLE =
         reinterpret_cast<PFNGLFRAMEBUFFERFETCHBARRIEREXTCONTEXTANGLEPROC>(
             loadProc("glFramebufferFetchBarrierEXTContextANGLE"));
+    l_glTexPageCommitmentEXTContextANGLE =
+        reinterpret_cast<PFNGLTEXPAGECOMMITMENTEXTCONTEXTANGLEPROC>(
+            loadProc("glTexPageCommitmentEXTContextANGLE"));
     l_glPatchParameteriEXTContextANGLE = reinterpret_cast<PFNGLPATCHPARAMETERIEXTCONTEXTANGLEPROC>(
         loadProc("glPatchParameteriEXTContextANGLE"));
     l_glGetSamplerParameterIivEXTContextANGLE =
@@ -487,6 +487,7 @@
 #define glMultiDrawArraysInstancedANGLE l_glMultiDrawArraysInstancedANGLE
 #define glMultiDrawElementsANGLE l_glMultiDrawElementsANGLE
 #define glMultiDrawElementsInstancedANGLE l_glMultiDrawElementsInstancedANGLE
+#define glPrewarmDrawStateANGLE l_glPrewarmDrawStateANGLE
 #define glProvokingVertexANGLE l_glProvokingVertexANGLE
 #define glDisableExtensionANGLE l_glDisableExtensionANGLE
 #define glRequestExtensionANGLE l_glRequestExtensionANGLE
@@ -687,6 +688,7 @@
 #define glUseProgramStagesEXT l_glUseProgramStagesEXT
 #define glValidateProgramPipelineEXT l_glValidateProgramPipelineEXT
 #define glFramebufferFetchBarrierEXT l_glFramebufferFetchBarrierEXT
+#define glTexPageCommitmentEXT l_glTexPageCommitmentEXT
 #define glPatchParameteriEXT l_glPatchParameteriEXT
 #define glGetSamplerParameterIivEXT l_glGetSamplerParameterIivEXT
 #define glGetSamplerParameterIuivEXT l_glGetSamplerParameterIuivEXT
@@ -1279,6 +1281,7 @@
 #define glMultiDrawElementsANGLEContextANGLE l_glMultiDrawElementsANGLEContextANGLE
 #define glMultiDrawElementsInstancedANGLEContextANGLE \
     l_glMultiDrawElementsInstancedANGLEContextANGLE
+#define glPrewarmDrawStateANGLEContextANGLE l_glPrewarmDrawStateANGLEContextANGLE
 #define glProvokingVertexANGLEContextANGLE l_glProvokingVertexANGLEContextANGLE
 #define glDisableExtensionANGLEContextANGLE l_glDisableExtensionANGLEContextANGLE
 #define glRequestExtensionANGLEContextANGLE l_glRequestExtensionANGLEContextANGLE
@@ -1503,6 +1506,7 @@
 #define glUseProgramStagesEXTContextANGLE l_glUseProgramStagesEXTContextANGLE
 #define glValidateProgramPipelineEXTContextANGLE l_glValidateProgramPipelineEXTContextANGLE
 #define glFramebufferFetchBarrierEXTContextANGLE l_glFramebufferFetchBarrierEXTContextANGLE
+#define glTexPageCommitmentEXTContextANGLE l_glTexPageCommitmentEXTContextANGLE
 #define glPatchParameteriEXTContextANGLE l_glPatchParameteriEXTContextANGLE
 #define glGetSamplerParameterIivEXTContextANGLE l_glGetSamplerParameterIivEXTContextANGLE
 #define glGetSamplerParameterIuivEXTContextANGLE l_glGetSamplerParameterIuivEXTContextANGLE
@@ -2099,6 +2103,7 @@ ANGLE_UTIL_EXPORT extern PFNGLMULTIDRAWARRAYSINSTANCEDANGLEPROC l_glMultiDrawArr
 ANGLE_UTIL_EXPORT extern PFNGLMULTIDRAWELEMENTSANGLEPROC l_glMultiDrawElementsANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLMULTIDRAWELEMENTSINSTANCEDANGLEPROC
     l_glMultiDrawElementsInstancedANGLE;
+ANGLE_UTIL_EXPORT extern PFNGLPREWARMDRAWSTATEANGLEPROC l_glPrewarmDrawStateANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLPROVOKINGVERTEXANGLEPROC l_glProvokingVertexANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLDISABLEEXTENSIONANGLEPROC l_glDisableExtensionANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLREQUESTEXTENSIONANGLEPROC l_glRequestExtensionANGLE;
@@ -2323,6 +2328,7 @@ ANGLE_UTIL_EXPORT extern PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC l_glProgramUnifor
 ANGLE_UTIL_EXPORT extern PFNGLUSEPROGRAMSTAGESEXTPROC l_glUseProgramStagesEXT;
 ANGLE_UTIL_EXPORT extern PFNGLVALIDATEPROGRAMPIPELINEEXTPROC l_glValidateProgramPipelineEXT;
 ANGLE_UTIL_EXPORT extern PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC l_glFramebufferFetchBarrierEXT;
+ANGLE_UTIL_EXPORT extern PFNGLTEXPAGECOMMITMENTEXTPROC l_glTexPageCommitmentEXT;
 ANGLE_UTIL_EXPORT extern PFNGLPATCHPARAMETERIEXTPROC l_glPatchParameteriEXT;
 ANGLE_UTIL_EXPORT extern PFNGLGETSAMPLERPARAMETERIIVEXTPROC l_glGetSamplerParameterIivEXT;
 ANGLE_UTIL_EXPORT extern PFNGLGETSAMPLERPARAMETERIUIVEXTPROC l_glGetSamplerParameterIuivEXT;
@@ -3030,6 +3036,8 @@ ANGLE_UTIL_EXPORT extern PFNGLMULTIDRAWELEMENTSANGLECONTEXTANGLEPROC
     l_glMultiDrawElementsANGLEContextANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLMULTIDRAWELEMENTSINSTANCEDANGLECONTEXTANGLEPROC
     l_glMultiDrawElementsInstancedANGLEContextANGLE;
+ANGLE_UTIL_EXPORT extern PFNGLPREWARMDRAWSTATEANGLECONTEXTANGLEPROC
+    l_glPrewarmDrawStateANGLEContextANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLPROVOKINGVERTEXANGLECONTEXTANGLEPROC
     l_glProvokingVertexANGLEContextANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLDISABLEEXTENSIONANGLECONTEXTANGLEPROC
@@ -3394,6 +3402,8 @@ ANGLE_UTIL_EXPORT extern PFNGLVALIDATEPROGRAMPIPELINEEXTCONTEXTANGLEPROC
     l_glValidateProgramPipelineEXTContextANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLFRAMEBUFFERFETCHBARRIEREXTCONTEXTANGLEPROC
     l_glFramebufferFetchBarrierEXTContextANGLE;
+ANGLE_UTIL_EXPORT extern PFNGLTEXPAGECOMMITMENTEXTCONTEXTANGLEPROC
+    l_glTexPageCommitmentEXTContextANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLPATCHPARAMETERIEXTCONTEXTANGLEPROC l_glPatchParameteriEXTContextANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLGETSAMPLERPARAMETERIIVEXTCONTEXTANGLEPROC
     l_glGetSamplerParameterIivEXTContextANGLE;
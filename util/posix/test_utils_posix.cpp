@@ -34,6 +34,10 @@
 #    include <crt_externs.h>
 #endif
 
+#if defined(ANGLE_PLATFORM_APPLE)
+#    include <mach/mach.h>
+#endif
+
 namespace angle
 {
 namespace
@@ -448,6 +452,39 @@ int NumberOfProcessors()
     return static_cast<int>(res);
 }
 
+uint64_t GetProcessResidentMemoryBytes()
+{
+#if defined(ANGLE_PLATFORM_APPLE)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info),
+                  &count) != KERN_SUCCESS)
+    {
+        return 0;
+    }
+    return info.resident_size;
+#else
+    // The second field of statm is the number of resident pages.
+    FILE *fp = fopen("/proc/self/statm", "r");
+    if (!fp)
+    {
+        return 0;
+    }
+
+    unsigned long long sizePages     = 0;
+    unsigned long long residentPages = 0;
+    int fieldCount                   = fscanf(fp, "%llu %llu", &sizePages, &residentPages);
+    fclose(fp);
+
+    long pageSize = sysconf(_SC_PAGESIZE);
+    if (fieldCount != 2 || pageSize <= 0)
+    {
+        return 0;
+    }
+    return residentPages * static_cast<uint64_t>(pageSize);
+#endif  // defined(ANGLE_PLATFORM_APPLE)
+}
+
 const char *GetNativeEGLLibraryNameWithExtension()
 {
 #if defined(ANGLE_PLATFORM_ANDROID)
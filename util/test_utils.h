@@ -120,6 +120,9 @@ Process *LaunchProcess(const std::vector<const char *> &args,
 
 int NumberOfProcessors();
 
+// Get the resident memory of the current process in bytes. Returns 0 if it can't be queried.
+uint64_t GetProcessResidentMemoryBytes();
+
 const char *GetNativeEGLLibraryNameWithExtension();
 
 // Intercept Metal shader cache access to avoid slow caching mechanism that caused the test timeout
@@ -29,4 +29,10 @@ int NumberOfProcessors()
     // A portable implementation could probably use GetLogicalProcessorInformation
     return 1;
 }
+
+uint64_t GetProcessResidentMemoryBytes()
+{
+    // Not available on UWP
+    return 0;
+}
 }  // namespace angle
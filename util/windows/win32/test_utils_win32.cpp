@@ -9,6 +9,8 @@
 #include "util/test_utils.h"
 
 #include <windows.h>
+
+#include <psapi.h>
 #include <array>
 
 #include "util/windows/third_party/StackWalker/src/StackWalker.h"
@@ -167,4 +169,14 @@ int NumberOfProcessors()
     // A portable implementation could probably use GetLogicalProcessorInformation
     return ::GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
 }
+
+uint64_t GetProcessResidentMemoryBytes()
+{
+    PROCESS_MEMORY_COUNTERS counters = {};
+    if (!::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return 0;
+    }
+    return counters.WorkingSetSize;
+}
 }  // namespace angle